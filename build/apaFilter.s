@@ -0,0 +1,3411 @@
+	.file	"apaFilter.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/apaFilter.c"
+	.type	apaFilter_Push, @function
+apaFilter_Push:
+.LFB6:
+	.file 1 "source/apaFilter.c"
+	.loc 1 31 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -72[rbp], rdi
+	movss	DWORD PTR -76[rbp], xmm0
+	.loc 1 32 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -40[rbp], eax
+	.loc 1 33 13
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 35 17
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 35 9
+	lea	edx, -1[rax]
+	.loc 1 35 8
+	mov	rax, QWORD PTR -72[rbp]
+	mov	DWORD PTR 32[rax], edx
+	.loc 1 35 17
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 35 8
+	test	eax, eax
+	jns	.L2
+	.loc 1 37 38
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 37 54
+	lea	edx, -1[rax]
+	.loc 1 37 30
+	mov	rax, QWORD PTR -72[rbp]
+	mov	DWORD PTR 32[rax], edx
+.L2:
+	.loc 1 39 11
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 39 27
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	cdqe
+	.loc 1 39 20
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 39 43
+	movss	xmm0, DWORD PTR -76[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 40 11
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 40 27
+	mov	rax, QWORD PTR -72[rbp]
+	mov	ecx, DWORD PTR 32[rax]
+	.loc 1 40 50
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 40 42
+	add	eax, ecx
+	cdqe
+	.loc 1 40 20
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 40 67
+	movss	xmm0, DWORD PTR -76[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 44 29
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 44 45
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	cdqe
+	.loc 1 44 38
+	sal	rax, 2
+	.loc 1 44 18
+	add	rax, rdx
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 45 37
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	cdqe
+	.loc 1 45 30
+	lea	rdx, 0[0+rax*4]
+	.loc 1 45 18
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 46 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 46 8
+	test	eax, eax
+	jne	.L3
+.LBB2:
+	.loc 1 48 18
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 48 9
+	jmp	.L4
+.L7:
+.LBB3:
+	.loc 1 50 20
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -16[rbp], xmm0
+.LBB4:
+	.loc 1 52 22
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 52 13
+	jmp	.L5
+.L6:
+	.loc 1 54 33 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 54 24 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 54 43 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 54 40 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 54 37 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 54 21 discriminator 3
+	movsd	xmm1, QWORD PTR -16[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 52 50 discriminator 3
+	add	DWORD PTR -20[rbp], 1
+.L5:
+	.loc 1 52 39 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 52 31 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jl	.L6
+.LBE4:
+	.loc 1 56 19 discriminator 2
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 56 32 discriminator 2
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 56 36 discriminator 2
+	movsd	xmm0, QWORD PTR -16[rbp]
+	movsd	QWORD PTR [rax], xmm0
+.LBE3:
+	.loc 1 48 37 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L4:
+	.loc 1 48 27 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -40[rbp]
+	jl	.L7
+	jmp	.L8
+.L3:
+.LBE2:
+.LBB5:
+	.loc 1 61 18
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 61 9
+	jmp	.L9
+.L10:
+	.loc 1 63 19 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 63 32 discriminator 3
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 63 48 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 63 39 discriminator 3
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, xmm0
+	.loc 1 63 55 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 63 52 discriminator 3
+	mulsd	xmm0, xmm2
+	.loc 1 63 76 discriminator 3
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 63 61 discriminator 3
+	pxor	xmm3, xmm3
+	cvtss2sd	xmm3, xmm2
+	.loc 1 63 89 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	cvtss2sd	xmm2, xmm2
+	.loc 1 63 80 discriminator 3
+	mulsd	xmm2, xmm3
+	.loc 1 63 59 discriminator 3
+	subsd	xmm0, xmm2
+	.loc 1 63 19 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 63 32 discriminator 3
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 63 36 discriminator 3
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 61 37 discriminator 3
+	add	DWORD PTR -24[rbp], 1
+.L9:
+	.loc 1 61 27 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -40[rbp]
+	jl	.L10
+.L8:
+.LBE5:
+.LBB6:
+	.loc 1 67 14
+	mov	eax, DWORD PTR -40[rbp]
+	sub	eax, 1
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 67 5
+	jmp	.L11
+.L14:
+.LBB7:
+	.loc 1 69 18
+	mov	eax, DWORD PTR -40[rbp]
+	sub	eax, 1
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 69 9
+	jmp	.L12
+.L13:
+	.loc 1 71 43 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	sub	eax, 1
+	.loc 1 71 48 discriminator 3
+	imul	eax, DWORD PTR -40[rbp]
+	.loc 1 71 61 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	sub	edx, 1
+	.loc 1 71 56 discriminator 3
+	add	eax, edx
+	cdqe
+	.loc 1 71 39 discriminator 3
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 71 20 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	imul	eax, DWORD PTR -40[rbp]
+	mov	ecx, eax
+	.loc 1 71 28 discriminator 3
+	mov	eax, DWORD PTR -32[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 71 17 discriminator 3
+	lea	rcx, 0[0+rax*8]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rcx
+	.loc 1 71 39 discriminator 3
+	movsd	xmm0, QWORD PTR [rdx]
+	.loc 1 71 33 discriminator 3
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 69 41 discriminator 3
+	sub	DWORD PTR -32[rbp], 1
+.L12:
+	.loc 1 69 35 discriminator 1
+	cmp	DWORD PTR -32[rbp], 0
+	jg	.L13
+.LBE7:
+	.loc 1 67 37 discriminator 2
+	sub	DWORD PTR -28[rbp], 1
+.L11:
+	.loc 1 67 31 discriminator 1
+	cmp	DWORD PTR -28[rbp], 0
+	jg	.L14
+.LBE6:
+.LBB8:
+	.loc 1 74 14
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 74 5
+	jmp	.L15
+.L16:
+	.loc 1 76 25 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 76 38 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rdx, rax
+	.loc 1 76 13 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rcx, 0[0+rax*8]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rcx
+	.loc 1 76 38 discriminator 3
+	movsd	xmm0, QWORD PTR [rdx]
+	.loc 1 76 17 discriminator 3
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 77 33 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 77 46 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rdx, rax
+	.loc 1 77 16 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	imul	eax, DWORD PTR -40[rbp]
+	cdqe
+	.loc 1 77 13 discriminator 3
+	lea	rcx, 0[0+rax*8]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rcx
+	.loc 1 77 46 discriminator 3
+	movsd	xmm0, QWORD PTR [rdx]
+	.loc 1 77 25 discriminator 3
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 74 33 discriminator 3
+	add	DWORD PTR -36[rbp], 1
+.L15:
+	.loc 1 74 23 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -40[rbp]
+	jl	.L16
+.LBE8:
+	.loc 1 79 12
+	mov	rax, QWORD PTR -56[rbp]
+	.loc 1 80 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	apaFilter_Push, .-apaFilter_Push
+	.type	apaFilter_Solve, @function
+apaFilter_Solve:
+.LFB7:
+	.loc 1 87 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 88
+	.cfi_offset 3, -24
+	mov	QWORD PTR -88[rbp], rdi
+	mov	DWORD PTR -92[rbp], esi
+	.loc 1 88 15
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -56[rbp], eax
+	.loc 1 89 60
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 89 66
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 89 52
+	movsd	xmm0, QWORD PTR .LC1[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 89 110
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 89 102
+	pxor	xmm2, xmm2
+	cvtsi2sd	xmm2, eax
+	movsd	xmm0, QWORD PTR .LC2[rip]
+	mulsd	xmm0, xmm2
+	.loc 1 89 18
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 90 13
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	mov	QWORD PTR -72[rbp], rax
+	.loc 1 91 13
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	mov	QWORD PTR -80[rbp], rax
+.LBB9:
+	.loc 1 93 14
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 93 5
+	jmp	.L19
+.L31:
+.LBB10:
+	.loc 1 95 18
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 95 9
+	jmp	.L20
+.L30:
+.LBB11:
+	.loc 1 97 32
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 64[rax]
+	.loc 1 97 41
+	mov	eax, DWORD PTR -20[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	ecx, eax
+	.loc 1 97 49
+	mov	eax, DWORD PTR -24[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 97 38
+	sal	rax, 3
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 97 74
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -24[rbp]
+	jne	.L21
+	.loc 1 97 74 is_stmt 0 discriminator 1
+	movsd	xmm0, QWORD PTR -64[rbp]
+	jmp	.L22
+.L21:
+	.loc 1 97 74 discriminator 2
+	pxor	xmm0, xmm0
+.L22:
+	.loc 1 97 20 is_stmt 1 discriminator 4
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -32[rbp], xmm0
+.LBB12:
+	.loc 1 99 22 discriminator 4
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 99 13 discriminator 4
+	jmp	.L23
+.L24:
+	.loc 1 101 33 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	edx, eax
+	.loc 1 101 41 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 101 30 discriminator 3
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 101 57 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	edx, eax
+	.loc 1 101 65 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 101 54 discriminator 3
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 101 46 discriminator 3
+	mulsd	xmm1, xmm0
+	.loc 1 101 21 discriminator 3
+	movsd	xmm0, QWORD PTR -32[rbp]
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 99 37 discriminator 3
+	add	DWORD PTR -36[rbp], 1
+.L23:
+	.loc 1 99 31 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -24[rbp]
+	jl	.L24
+.LBE12:
+	.loc 1 103 16
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -24[rbp]
+	jne	.L25
+	.loc 1 106 41
+	movsd	xmm0, QWORD PTR -32[rbp]
+	comisd	xmm0, QWORD PTR -64[rbp]
+	jbe	.L41
+	.loc 1 106 41 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	jmp	.L28
+.L41:
+	.loc 1 106 41 discriminator 2
+	mov	rax, QWORD PTR -64[rbp]
+.L28:
+	.loc 1 106 26 is_stmt 1 discriminator 4
+	mov	edx, DWORD PTR -20[rbp]
+	mov	ecx, edx
+	imul	ecx, DWORD PTR -56[rbp]
+	.loc 1 106 34 discriminator 4
+	mov	edx, DWORD PTR -20[rbp]
+	add	edx, ecx
+	movsx	rdx, edx
+	.loc 1 106 23 discriminator 4
+	lea	rcx, 0[0+rdx*8]
+	mov	rdx, QWORD PTR -72[rbp]
+	lea	rbx, [rcx+rdx]
+	.loc 1 106 41 discriminator 4
+	movq	xmm0, rax
+	call	sqrt@PLT
+	movq	rax, xmm0
+	.loc 1 106 39 discriminator 4
+	mov	QWORD PTR [rbx], rax
+	jmp	.L29
+.L25:
+	.loc 1 110 56
+	mov	eax, DWORD PTR -24[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	edx, eax
+	.loc 1 110 64
+	mov	eax, DWORD PTR -24[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 110 53
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 110 26
+	mov	eax, DWORD PTR -20[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	edx, eax
+	.loc 1 110 34
+	mov	eax, DWORD PTR -24[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 110 23
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	.loc 1 110 45
+	movsd	xmm0, QWORD PTR -32[rbp]
+	divsd	xmm0, xmm1
+	.loc 1 110 39
+	movsd	QWORD PTR [rax], xmm0
+.L29:
+.LBE11:
+	.loc 1 95 34 discriminator 2
+	add	DWORD PTR -24[rbp], 1
+.L20:
+	.loc 1 95 27 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jle	.L30
+.LBE10:
+	.loc 1 93 32 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L19:
+	.loc 1 93 23 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -92[rbp]
+	jl	.L31
+.LBE9:
+.LBB13:
+	.loc 1 114 14
+	mov	DWORD PTR -40[rbp], 0
+	.loc 1 114 5
+	jmp	.L32
+.L35:
+.LBB14:
+	.loc 1 116 18
+	mov	DWORD PTR -44[rbp], 0
+	.loc 1 116 9
+	jmp	.L33
+.L34:
+	.loc 1 118 14 discriminator 3
+	mov	eax, DWORD PTR -40[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 118 30 discriminator 3
+	mov	eax, DWORD PTR -40[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	edx, eax
+	.loc 1 118 38 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 118 27 discriminator 3
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movsd	xmm2, QWORD PTR [rax]
+	.loc 1 118 46 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 118 43 discriminator 3
+	mulsd	xmm1, xmm2
+	.loc 1 118 14 discriminator 3
+	mov	eax, DWORD PTR -40[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 118 18 discriminator 3
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 116 33 discriminator 3
+	add	DWORD PTR -44[rbp], 1
+.L33:
+	.loc 1 116 27 discriminator 1
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -40[rbp]
+	jl	.L34
+.LBE14:
+	.loc 1 120 10 discriminator 2
+	mov	eax, DWORD PTR -40[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 120 26 discriminator 2
+	mov	eax, DWORD PTR -40[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	edx, eax
+	.loc 1 120 34 discriminator 2
+	mov	eax, DWORD PTR -40[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 120 23 discriminator 2
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 120 10 discriminator 2
+	mov	eax, DWORD PTR -40[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 120 14 discriminator 2
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 114 32 discriminator 2
+	add	DWORD PTR -40[rbp], 1
+.L32:
+	.loc 1 114 23 discriminator 1
+	mov	eax, DWORD PTR -40[rbp]
+	cmp	eax, DWORD PTR -92[rbp]
+	jl	.L35
+.LBE13:
+.LBB15:
+	.loc 1 122 14
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, 1
+	mov	DWORD PTR -48[rbp], eax
+	.loc 1 122 5
+	jmp	.L36
+.L39:
+.LBB16:
+	.loc 1 124 18
+	mov	eax, DWORD PTR -48[rbp]
+	add	eax, 1
+	mov	DWORD PTR -52[rbp], eax
+	.loc 1 124 9
+	jmp	.L37
+.L38:
+	.loc 1 126 14 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 126 30 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	edx, eax
+	.loc 1 126 38 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 126 27 discriminator 3
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movsd	xmm2, QWORD PTR [rax]
+	.loc 1 126 46 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 126 43 discriminator 3
+	mulsd	xmm1, xmm2
+	.loc 1 126 14 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 126 18 discriminator 3
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 124 40 discriminator 3
+	add	DWORD PTR -52[rbp], 1
+.L37:
+	.loc 1 124 31 discriminator 1
+	mov	eax, DWORD PTR -52[rbp]
+	cmp	eax, DWORD PTR -92[rbp]
+	jl	.L38
+.LBE16:
+	.loc 1 128 10 discriminator 2
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 128 26 discriminator 2
+	mov	eax, DWORD PTR -48[rbp]
+	imul	eax, DWORD PTR -56[rbp]
+	mov	edx, eax
+	.loc 1 128 34 discriminator 2
+	mov	eax, DWORD PTR -48[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 128 23 discriminator 2
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 128 10 discriminator 2
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 128 14 discriminator 2
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 122 37 discriminator 2
+	sub	DWORD PTR -48[rbp], 1
+.L36:
+	.loc 1 122 30 discriminator 1
+	cmp	DWORD PTR -48[rbp], 0
+	jns	.L39
+.LBE15:
+	.loc 1 130 1
+	nop
+	nop
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	apaFilter_Solve, .-apaFilter_Solve
+	.section	.rodata
+	.align 8
+.LC5:
+	.string	"Wrong APA filter length %d, order %d or step size %g\n"
+	.align 8
+.LC6:
+	.string	"Error allocating APA filter of length %d\n"
+	.text
+	.globl	apaFilter_Init
+	.type	apaFilter_Init, @function
+apaFilter_Init:
+.LFB8:
+	.loc 1 133 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 96
+	mov	QWORD PTR -72[rbp], rdi
+	movss	DWORD PTR -76[rbp], xmm0
+	mov	DWORD PTR -80[rbp], esi
+	mov	DWORD PTR -84[rbp], edx
+	.loc 1 134 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 136 5
+	mov	rax, QWORD PTR -72[rbp]
+	mov	edx, 104
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 137 8
+	cmp	DWORD PTR -84[rbp], 0
+	jne	.L43
+	.loc 1 139 15
+	mov	DWORD PTR -84[rbp], 4
+.L43:
+	.loc 1 141 8
+	cmp	DWORD PTR -80[rbp], 0
+	jle	.L44
+	.loc 1 141 22 discriminator 1
+	cmp	DWORD PTR -84[rbp], 0
+	jle	.L44
+	.loc 1 141 37 discriminator 2
+	cmp	DWORD PTR -84[rbp], 32
+	jg	.L44
+	.loc 1 141 81 discriminator 3
+	movss	xmm0, DWORD PTR -76[rbp]
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 141 74 discriminator 3
+	xor	eax, 1
+	.loc 1 141 71 discriminator 3
+	test	al, al
+	jne	.L44
+	.loc 1 141 99 discriminator 4
+	movss	xmm0, DWORD PTR .LC4[rip]
+	comiss	xmm0, DWORD PTR -76[rbp]
+	seta	al
+	.loc 1 141 92 discriminator 4
+	xor	eax, 1
+	.loc 1 141 89 discriminator 4
+	test	al, al
+	je	.L45
+.L44:
+	.loc 1 143 9
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, DWORD PTR -76[rbp]
+	movq	rcx, xmm2
+	mov	edx, DWORD PTR -84[rbp]
+	mov	eax, DWORD PTR -80[rbp]
+	movq	xmm0, rcx
+	mov	esi, eax
+	lea	rax, .LC5[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 144 16
+	mov	eax, 1
+	jmp	.L46
+.L45:
+	.loc 1 146 18
+	mov	rax, QWORD PTR -72[rbp]
+	movss	xmm0, DWORD PTR -76[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 147 20
+	mov	rax, QWORD PTR -72[rbp]
+	mov	edx, DWORD PTR -80[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 148 19
+	mov	rax, QWORD PTR -72[rbp]
+	mov	edx, DWORD PTR -84[rbp]
+	mov	DWORD PTR 8[rax], edx
+	.loc 1 149 36
+	mov	edx, DWORD PTR -80[rbp]
+	mov	eax, DWORD PTR -84[rbp]
+	add	edx, eax
+	.loc 1 149 27
+	mov	rax, QWORD PTR -72[rbp]
+	mov	DWORD PTR 12[rax], edx
+	.loc 1 150 22
+	call	lmsKernel_GetBest@PLT
+	.loc 1 150 20
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	QWORD PTR 88[rdx], rax
+	.loc 1 152 62
+	mov	eax, DWORD PTR -80[rbp]
+	cdqe
+	.loc 1 152 37
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 153 76
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 153 62
+	cdqe
+	.loc 1 153 33
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 154 62
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	.loc 1 154 33
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 155 57
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	.loc 1 155 32
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 156 57
+	mov	eax, DWORD PTR -84[rbp]
+	movsx	rdx, eax
+	.loc 1 156 71
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 156 32
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 157 48
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rdx, rax
+	.loc 1 157 63
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 157 96
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	add	rax, rax
+	.loc 1 157 18
+	add	rax, rcx
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 159 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r8, QWORD PTR [rax]
+	.loc 1 159 41
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 159 22
+	mov	rcx, QWORD PTR -56[rbp]
+	mov	edx, 64
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	r8
+.LVL0:
+	.loc 1 159 20
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	QWORD PTR 96[rdx], rax
+	.loc 1 160 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	.loc 1 160 8
+	test	rax, rax
+	jne	.L47
+	.loc 1 162 9
+	mov	eax, DWORD PTR -80[rbp]
+	mov	esi, eax
+	lea	rax, .LC6[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 163 16
+	mov	eax, 1
+	jmp	.L46
+.L47:
+	.loc 1 165 5
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 167 20
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 168 26
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 169 10
+	mov	rax, QWORD PTR -16[rbp]
+	add	QWORD PTR -64[rbp], rax
+	.loc 1 170 21
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 171 10
+	mov	rax, QWORD PTR -24[rbp]
+	add	QWORD PTR -64[rbp], rax
+	.loc 1 172 21
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 40[rax], rdx
+	.loc 1 173 10
+	mov	rax, QWORD PTR -32[rbp]
+	add	QWORD PTR -64[rbp], rax
+	.loc 1 174 25
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 56[rax], rdx
+	.loc 1 175 10
+	mov	rax, QWORD PTR -40[rbp]
+	add	QWORD PTR -64[rbp], rax
+	.loc 1 176 22
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 80[rax], rdx
+	.loc 1 177 10
+	mov	rax, QWORD PTR -40[rbp]
+	add	QWORD PTR -64[rbp], rax
+	.loc 1 178 18
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	.loc 1 179 10
+	mov	rax, QWORD PTR -48[rbp]
+	add	QWORD PTR -64[rbp], rax
+	.loc 1 180 20
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	.loc 1 182 12
+	mov	eax, 0
+.L46:
+	.loc 1 183 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	apaFilter_Init, .-apaFilter_Init
+	.globl	apaFilter_Free
+	.type	apaFilter_Free, @function
+apaFilter_Free:
+.LFB9:
+	.loc 1 186 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 187 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 189 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 189 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 96[rax]
+	.loc 1 189 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 189 5
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+	.loc 1 190 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 96[rax], 0
+	.loc 1 191 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	apaFilter_Free, .-apaFilter_Free
+	.globl	apaFilter_PushSample
+	.type	apaFilter_PushSample, @function
+apaFilter_PushSample:
+.LFB10:
+	.loc 1 194 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 195 5
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	apaFilter_Push
+	.loc 1 196 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 52[rax], 0
+	.loc 1 197 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	apaFilter_PushSample, .-apaFilter_PushSample
+	.globl	apaFilter_ProcessBlock
+	.type	apaFilter_ProcessBlock, @function
+apaFilter_ProcessBlock:
+.LFB11:
+	.loc 1 201 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 112
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	QWORD PTR -88[rbp], rdx
+	mov	QWORD PTR -96[rbp], rcx
+	mov	QWORD PTR -104[rbp], r8
+	mov	DWORD PTR -108[rbp], r9d
+	.loc 1 202 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 203 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 204 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -4[rbp], xmm0
+.LBB17:
+	.loc 1 206 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 206 5
+	jmp	.L51
+.L62:
+.LBB18:
+	.loc 1 208 54
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 208 26
+	mov	edx, DWORD PTR [rax]
+	mov	rax, QWORD PTR -72[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	apaFilter_Push
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 209 56
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L52
+	.loc 1 209 52 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 209 56 discriminator 1
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L53
+.L52:
+	.loc 1 209 59 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	sal	rax, 2
+	lea	rdx, -4[rax]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 209 56 discriminator 2
+	movss	xmm0, DWORD PTR [rax]
+.L53:
+	.loc 1 209 21 discriminator 4
+	movss	DWORD PTR -36[rbp], xmm0
+	.loc 1 211 21 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 211 13 discriminator 4
+	lea	edx, -1[rax]
+	.loc 1 211 12 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	DWORD PTR 48[rax], edx
+	.loc 1 211 21 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 211 12 discriminator 4
+	test	eax, eax
+	jns	.L54
+	.loc 1 213 42
+	mov	eax, DWORD PTR -24[rbp]
+	lea	edx, -1[rax]
+	.loc 1 213 34
+	mov	rax, QWORD PTR -72[rbp]
+	mov	DWORD PTR 48[rax], edx
+.L54:
+	.loc 1 215 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 215 31
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	cdqe
+	.loc 1 215 24
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 215 47
+	movss	xmm0, DWORD PTR -36[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 216 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 216 31
+	mov	rax, QWORD PTR -72[rbp]
+	mov	ecx, DWORD PTR 48[rax]
+	.loc 1 216 46
+	mov	eax, DWORD PTR -24[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 216 24
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 216 55
+	movss	xmm0, DWORD PTR -36[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 217 19
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 52[rax]
+	.loc 1 217 12
+	cmp	DWORD PTR -24[rbp], eax
+	jle	.L55
+	.loc 1 219 19
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 52[rax]
+	.loc 1 219 30
+	lea	edx, 1[rax]
+	mov	rax, QWORD PTR -72[rbp]
+	mov	DWORD PTR 52[rax], edx
+.L55:
+	.loc 1 223 40
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 223 56
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	cdqe
+	.loc 1 223 49
+	sal	rax, 2
+	.loc 1 223 22
+	add	rax, rdx
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 224 19
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 52[rax]
+	mov	DWORD PTR -52[rbp], eax
+.LBB19:
+	.loc 1 225 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 225 9
+	jmp	.L56
+.L57:
+	.loc 1 227 43 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	movss	DWORD PTR -112[rbp], xmm2
+	.loc 1 227 55 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 227 63 discriminator 3
+	mov	rcx, QWORD PTR 16[rax]
+	.loc 1 227 93 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 227 49 discriminator 3
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rsi, [rdx+rax]
+	.loc 1 227 75 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 227 49 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rdi, rax
+	call	rcx
+.LVL2:
+	.loc 1 227 47 discriminator 3
+	movss	xmm1, DWORD PTR -112[rbp]
+	subss	xmm1, xmm0
+	.loc 1 227 19 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 227 29 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 227 47 discriminator 3
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, xmm1
+	.loc 1 227 33 discriminator 3
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 225 36 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L56:
+	.loc 1 225 27 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	jl	.L57
+.LBE19:
+	.loc 1 229 30
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 229 40
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 229 17
+	pxor	xmm1, xmm1
+	cvtsd2ss	xmm1, xmm0
+	.loc 1 229 11
+	movss	xmm0, DWORD PTR -36[rbp]
+	subss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 230 12
+	cmp	QWORD PTR -96[rbp], 0
+	je	.L58
+	.loc 1 232 19
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 232 23
+	movss	xmm0, DWORD PTR -4[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L58:
+	.loc 1 234 12
+	cmp	QWORD PTR -104[rbp], 0
+	je	.L59
+	.loc 1 236 37
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 236 47
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 236 18
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 236 24
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 236 22
+	movss	DWORD PTR [rax], xmm0
+.L59:
+	.loc 1 239 9
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -72[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	apaFilter_Solve
+.LBB20:
+	.loc 1 240 18
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 240 9
+	jmp	.L60
+.L61:
+	.loc 1 242 19 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 242 27 discriminator 3
+	mov	r8, QWORD PTR 24[rax]
+	.loc 1 242 79 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 242 94 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 242 104 discriminator 3
+	mov	edx, DWORD PTR -16[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 242 86 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 242 13 discriminator 3
+	pxor	xmm3, xmm3
+	cvtsd2ss	xmm3, xmm0
+	movd	ecx, xmm3
+	.loc 1 242 60 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 242 13 discriminator 3
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rsi, [rdx+rax]
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	mov	edx, DWORD PTR -20[rbp]
+	movd	xmm0, ecx
+	mov	rdi, rax
+	call	r8
+.LVL3:
+	.loc 1 240 36 discriminator 3
+	add	DWORD PTR -16[rbp], 1
+.L60:
+	.loc 1 240 27 discriminator 1
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	jl	.L61
+.LBE20:
+.LBE18:
+	.loc 1 206 40 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L51:
+	.loc 1 206 23 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -108[rbp]
+	jl	.L62
+.LBE17:
+	.loc 1 245 13
+	movss	xmm0, DWORD PTR -4[rbp]
+	movss	xmm1, DWORD PTR .LC7[rip]
+	andps	xmm1, xmm0
+	.loc 1 245 46
+	movss	xmm0, DWORD PTR .LC8[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	movzx	eax, al
+	.loc 1 246 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	apaFilter_ProcessBlock, .-apaFilter_ProcessBlock
+	.globl	apaFilter_NormSquared
+	.type	apaFilter_NormSquared, @function
+apaFilter_NormSquared:
+.LFB12:
+	.loc 1 249 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 250 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBB21:
+	.loc 1 252 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 252 5
+	jmp	.L65
+.L66:
+	.loc 1 254 30 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 254 44 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 254 16 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 254 56 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 254 70 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 254 48 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 254 13 discriminator 3
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 252 42 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L65:
+	.loc 1 252 31 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 252 23 discriminator 1
+	cmp	DWORD PTR -12[rbp], eax
+	jl	.L66
+.LBE21:
+	.loc 1 256 12
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movq	rax, xmm0
+	.loc 1 257 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	apaFilter_NormSquared, .-apaFilter_NormSquared
+	.section	.rodata
+	.align 8
+.LC1:
+	.long	-350469331
+	.long	1058682594
+	.align 8
+.LC2:
+	.long	-1598689907
+	.long	1051772663
+	.align 4
+.LC4:
+	.long	1073741824
+	.align 16
+.LC7:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC8:
+	.long	2139095039
+	.text
+.Letext0:
+	.file 2 "include/lmsAllocator.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "include/lmsKernel.h"
+	.file 5 "include/apaFilter.h"
+	.file 6 "/usr/include/stdio.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x9e3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF82
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xb
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0x9
+	.long	0x2e
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x46
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x16
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x9
+	.long	0x85
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x6
+	.long	0x8c
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x9
+	.long	0x9d
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x9
+	.long	0xa9
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0xe
+	.byte	0x18
+	.byte	0x2
+	.byte	0x10
+	.long	0xec
+	.uleb128 0x2
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x13
+	.byte	0xd
+	.long	0x105
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x16
+	.byte	0xc
+	.long	0x11a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x18
+	.byte	0xb
+	.long	0x83
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0x83
+	.long	0x105
+	.uleb128 0x1
+	.long	0x83
+	.uleb128 0x1
+	.long	0x2e
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0xec
+	.uleb128 0xf
+	.long	0x11a
+	.uleb128 0x1
+	.long	0x83
+	.uleb128 0x1
+	.long	0x83
+	.byte	0
+	.uleb128 0x6
+	.long	0x10a
+	.uleb128 0xb
+	.long	.LASF19
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0xbc
+	.uleb128 0x9
+	.long	0x11f
+	.uleb128 0x6
+	.long	0x60
+	.uleb128 0x17
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0x4
+	.byte	0xf
+	.byte	0x1
+	.long	0x162
+	.uleb128 0xc
+	.long	.LASF20
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF21
+	.byte	0x1
+	.uleb128 0xc
+	.long	.LASF22
+	.byte	0x2
+	.uleb128 0xc
+	.long	.LASF23
+	.byte	0x3
+	.uleb128 0xc
+	.long	.LASF24
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x15
+	.byte	0x3
+	.long	0x135
+	.uleb128 0xe
+	.byte	0x40
+	.byte	0x4
+	.byte	0x17
+	.long	0x1df
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x19
+	.byte	0x15
+	.long	0x162
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x11
+	.long	0x98
+	.byte	0x8
+	.uleb128 0x18
+	.string	"dot"
+	.byte	0x4
+	.byte	0x1d
+	.byte	0xd
+	.long	0x1fd
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x20
+	.byte	0xc
+	.long	0x221
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x23
+	.byte	0xd
+	.long	0x249
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x27
+	.byte	0xd
+	.long	0x276
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xd
+	.long	0x249
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x30
+	.byte	0xc
+	.long	0x2a4
+	.byte	0x38
+	.byte	0
+	.uleb128 0xd
+	.long	0x9d
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x6
+	.long	0xa4
+	.uleb128 0x6
+	.long	0x1df
+	.uleb128 0xf
+	.long	0x21c
+	.uleb128 0x1
+	.long	0x21c
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x9d
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x6
+	.long	0x202
+	.uleb128 0xd
+	.long	0x9d
+	.long	0x249
+	.uleb128 0x1
+	.long	0x21c
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x9d
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x6
+	.long	0x226
+	.uleb128 0xd
+	.long	0x9d
+	.long	0x276
+	.uleb128 0x1
+	.long	0x21c
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x9d
+	.uleb128 0x1
+	.long	0x9d
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x6
+	.long	0x24e
+	.uleb128 0xf
+	.long	0x2a4
+	.uleb128 0x1
+	.long	0x21c
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x1f8
+	.uleb128 0x1
+	.long	0x21c
+	.uleb128 0x1
+	.long	0x46
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x6
+	.long	0x27b
+	.uleb128 0xb
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x32
+	.byte	0x3
+	.long	0x16e
+	.uleb128 0x9
+	.long	0x2a9
+	.uleb128 0xe
+	.byte	0x68
+	.byte	0x5
+	.byte	0x13
+	.long	0x393
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x5
+	.byte	0x15
+	.byte	0xb
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x16
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x17
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x18
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x19
+	.byte	0xc
+	.long	0x21c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x1a
+	.byte	0xc
+	.long	0x21c
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x5
+	.byte	0x1c
+	.byte	0xc
+	.long	0x21c
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x1d
+	.byte	0x9
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x9
+	.long	0x46
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x5
+	.byte	0x1f
+	.byte	0xd
+	.long	0x393
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF45
+	.byte	0x5
+	.byte	0x20
+	.byte	0xd
+	.long	0x393
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x5
+	.byte	0x21
+	.byte	0xd
+	.long	0x393
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF47
+	.byte	0x5
+	.byte	0x22
+	.byte	0xd
+	.long	0x393
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF48
+	.byte	0x5
+	.byte	0x23
+	.byte	0x18
+	.long	0x398
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF49
+	.byte	0x5
+	.byte	0x24
+	.byte	0xb
+	.long	0x83
+	.byte	0x60
+	.byte	0
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x6
+	.long	0x2b5
+	.uleb128 0xb
+	.long	.LASF50
+	.byte	0x5
+	.byte	0x25
+	.byte	0x3
+	.long	0x2ba
+	.uleb128 0x9
+	.long	0x39d
+	.uleb128 0x10
+	.long	.LASF51
+	.byte	0x2
+	.byte	0x43
+	.byte	0x8
+	.long	0x2e
+	.long	0x3c4
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF54
+	.byte	0x4
+	.byte	0x47
+	.byte	0x14
+	.long	0x398
+	.uleb128 0x19
+	.long	.LASF52
+	.byte	0x6
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0x3e8
+	.uleb128 0x1
+	.long	0x98
+	.uleb128 0x1a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF53
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x408
+	.uleb128 0x1
+	.long	0x83
+	.uleb128 0x1
+	.long	0x46
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF55
+	.byte	0x2
+	.byte	0x27
+	.byte	0x17
+	.long	0x414
+	.uleb128 0x6
+	.long	0x12b
+	.uleb128 0x10
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x8f
+	.byte	0x1
+	.long	0xa9
+	.long	0x42f
+	.uleb128 0x1
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF57
+	.byte	0x1
+	.byte	0xf8
+	.byte	0x8
+	.long	0xa9
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x48c
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0xf8
+	.byte	0x31
+	.long	0x48c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.string	"sum"
+	.byte	0xfa
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.uleb128 0x3
+	.string	"k"
+	.byte	0xfc
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3a9
+	.uleb128 0x12
+	.long	.LASF58
+	.byte	0xc7
+	.long	0x46
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5d9
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0xc7
+	.byte	0x29
+	.long	0x5d9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0xc7
+	.byte	0x3e
+	.long	0x1f8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x5
+	.long	.LASF41
+	.byte	0xc7
+	.byte	0x52
+	.long	0x1f8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xc8
+	.byte	0x23
+	.long	0x21c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xc8
+	.byte	0x32
+	.long	0x21c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xc8
+	.byte	0x3d
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0xca
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0xcb
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.string	"y"
+	.byte	0xcc
+	.byte	0xb
+	.long	0x9d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x7
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.uleb128 0x3
+	.string	"i"
+	.byte	0xce
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.uleb128 0x3
+	.string	"x"
+	.byte	0xd0
+	.byte	0x16
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.string	"d"
+	.byte	0xd1
+	.byte	0x15
+	.long	0xa4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x4
+	.long	.LASF64
+	.byte	0xdf
+	.byte	0x16
+	.long	0x1f8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF65
+	.byte	0xe0
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xa
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.long	0x5b8
+	.uleb128 0x3
+	.string	"k"
+	.byte	0xe1
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x7
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.uleb128 0x3
+	.string	"k"
+	.byte	0xf0
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x39d
+	.uleb128 0x13
+	.long	.LASF67
+	.byte	0xc1
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x617
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0xc1
+	.byte	0x28
+	.long	0x5d9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.long	.LASF66
+	.byte	0xc1
+	.byte	0x36
+	.long	0x9d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF68
+	.byte	0xb9
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x650
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0xb9
+	.byte	0x22
+	.long	0x5d9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF69
+	.byte	0xbb
+	.byte	0x1b
+	.long	0x414
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF70
+	.byte	0x84
+	.long	0x46
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x71f
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0x84
+	.byte	0x21
+	.long	0x5d9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x5
+	.long	.LASF34
+	.byte	0x84
+	.byte	0x2f
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x5
+	.long	.LASF35
+	.byte	0x84
+	.byte	0x39
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x5
+	.long	.LASF36
+	.byte	0x84
+	.byte	0x45
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x4
+	.long	.LASF69
+	.byte	0x86
+	.byte	0x1b
+	.long	0x414
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0x98
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0x99
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0x9a
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0x9b
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0x9c
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0x9d
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0xa7
+	.byte	0x14
+	.long	0x130
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF79
+	.byte	0x1
+	.byte	0x56
+	.byte	0xd
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x891
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0x56
+	.byte	0x2a
+	.long	0x5d9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0x56
+	.byte	0x36
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x58
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0x59
+	.byte	0x12
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF46
+	.byte	0x5a
+	.byte	0xd
+	.long	0x393
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.string	"a"
+	.byte	0x5b
+	.byte	0xd
+	.long	0x393
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0xa
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.long	0x813
+	.uleb128 0x3
+	.string	"i"
+	.byte	0x5d
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x7
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x3
+	.string	"j"
+	.byte	0x5f
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0x3
+	.string	"sum"
+	.byte	0x61
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x63
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.long	0x853
+	.uleb128 0x3
+	.string	"i"
+	.byte	0x72
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x74
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.uleb128 0x3
+	.string	"i"
+	.byte	0x7a
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x7c
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF80
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x15
+	.long	0x1f8
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0x1e
+	.byte	0x31
+	.long	0x5d9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x5
+	.long	.LASF66
+	.byte	0x1e
+	.byte	0x3f
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x20
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF45
+	.byte	0x21
+	.byte	0xd
+	.long	0x393
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.string	"x"
+	.byte	0x2c
+	.byte	0x12
+	.long	0x1f8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0x2d
+	.byte	0x12
+	.long	0x1f8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xa
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.long	0x965
+	.uleb128 0x3
+	.string	"j"
+	.byte	0x30
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x7
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x3
+	.string	"sum"
+	.byte	0x32
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x34
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.long	0x987
+	.uleb128 0x3
+	.string	"j"
+	.byte	0x3d
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0xa
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.long	0x9c7
+	.uleb128 0x3
+	.string	"i"
+	.byte	0x43
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x7
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x3
+	.string	"j"
+	.byte	0x45
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x3
+	.string	"j"
+	.byte	0x4a
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF52:
+	.string	"printf"
+.LASF18:
+	.string	"size_t"
+.LASF77:
+	.string	"next"
+.LASF65:
+	.string	"rows"
+.LASF26:
+	.string	"type"
+.LASF80:
+	.string	"apaFilter_Push"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF36:
+	.string	"order"
+.LASF78:
+	.string	"delta"
+.LASF24:
+	.string	"LMS_KERNEL_COUNT"
+.LASF66:
+	.string	"sample"
+.LASF25:
+	.string	"LmsKernelType_t"
+.LASF30:
+	.string	"leakyUpdateDot"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF16:
+	.string	"release"
+.LASF64:
+	.string	"dHistory"
+.LASF3:
+	.string	"long int"
+.LASF13:
+	.string	"double"
+.LASF23:
+	.string	"LMS_KERNEL_AVX512"
+.LASF58:
+	.string	"apaFilter_ProcessBlock"
+.LASF31:
+	.string	"signUpdateDot"
+.LASF79:
+	.string	"apaFilter_Solve"
+.LASF49:
+	.string	"memory"
+.LASF67:
+	.string	"apaFilter_PushSample"
+.LASF7:
+	.string	"unsigned int"
+.LASF20:
+	.string	"LMS_KERNEL_SCALAR"
+.LASF74:
+	.string	"vectorBytes"
+.LASF2:
+	.string	"long unsigned int"
+.LASF27:
+	.string	"name"
+.LASF6:
+	.string	"short unsigned int"
+.LASF50:
+	.string	"ApaFilter_t"
+.LASF72:
+	.string	"historyBytes"
+.LASF71:
+	.string	"coefficientBytes"
+.LASF44:
+	.string	"correlation"
+.LASF22:
+	.string	"LMS_KERNEL_AVX2"
+.LASF57:
+	.string	"apaFilter_NormSquared"
+.LASF42:
+	.string	"desiredIndex"
+.LASF61:
+	.string	"output"
+.LASF45:
+	.string	"gram"
+.LASF76:
+	.string	"totalBytes"
+.LASF68:
+	.string	"apaFilter_Free"
+.LASF14:
+	.string	"long double"
+.LASF21:
+	.string	"LMS_KERNEL_SSE2"
+.LASF29:
+	.string	"updateDot"
+.LASF12:
+	.string	"float"
+.LASF62:
+	.string	"error"
+.LASF19:
+	.string	"LmsAllocator_t"
+.LASF39:
+	.string	"history"
+.LASF51:
+	.string	"lmsAllocator_AlignedSize"
+.LASF5:
+	.string	"unsigned char"
+.LASF63:
+	.string	"numOfSamples"
+.LASF34:
+	.string	"step"
+.LASF9:
+	.string	"short int"
+.LASF55:
+	.string	"lmsAllocator_Heap"
+.LASF38:
+	.string	"coefficients"
+.LASF54:
+	.string	"lmsKernel_GetBest"
+.LASF41:
+	.string	"desired"
+.LASF60:
+	.string	"input"
+.LASF47:
+	.string	"solution"
+.LASF69:
+	.string	"heap"
+.LASF35:
+	.string	"length"
+.LASF10:
+	.string	"char"
+.LASF82:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF75:
+	.string	"matrixBytes"
+.LASF37:
+	.string	"historyLength"
+.LASF70:
+	.string	"apaFilter_Init"
+.LASF17:
+	.string	"context"
+.LASF59:
+	.string	"filter"
+.LASF28:
+	.string	"update"
+.LASF53:
+	.string	"memset"
+.LASF81:
+	.string	"leaving"
+.LASF46:
+	.string	"factor"
+.LASF32:
+	.string	"bankUpdateDot"
+.LASF56:
+	.string	"sqrt"
+.LASF43:
+	.string	"validRows"
+.LASF40:
+	.string	"historyIndex"
+.LASF73:
+	.string	"desiredBytes"
+.LASF48:
+	.string	"kernel"
+.LASF33:
+	.string	"LmsKernel_t"
+.LASF15:
+	.string	"allocate"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/apaFilter.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
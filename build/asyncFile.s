@@ -0,0 +1,7602 @@
+	.file	"asyncFile.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/asyncFile.c"
+	.section	.rodata
+.LC0:
+	.string	"auto"
+.LC1:
+	.string	"uring"
+.LC2:
+	.string	"thread"
+.LC3:
+	.string	"stdio"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	asyncFileBackendNames, @object
+	.size	asyncFileBackendNames, 64
+asyncFileBackendNames:
+	.quad	.LC0
+	.long	1
+	.zero	4
+	.quad	.LC1
+	.long	2
+	.zero	4
+	.quad	.LC2
+	.long	3
+	.zero	4
+	.quad	.LC3
+	.long	4
+	.zero	4
+	.text
+	.type	asyncFile_Transfer, @function
+asyncFile_Transfer:
+.LFB6:
+	.file 1 "source/asyncFile.c"
+	.loc 1 47 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	DWORD PTR -20[rbp], edi
+	mov	DWORD PTR -24[rbp], esi
+	mov	QWORD PTR -32[rbp], rdx
+	mov	QWORD PTR -40[rbp], rcx
+	mov	QWORD PTR -48[rbp], r8
+	.loc 1 48 12
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 50 11
+	jmp	.L2
+.L11:
+.LBB2:
+	.loc 1 53 49
+	cmp	DWORD PTR -24[rbp], 0
+	jne	.L3
+	.loc 1 52 96
+	mov	rdx, QWORD PTR -8[rbp]
+	.loc 1 52 51
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rcx, [rdx+rax]
+	mov	rax, QWORD PTR -40[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	mov	rdx, rax
+	.loc 1 52 61
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rsi, rax
+	.loc 1 52 51
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edi, eax
+	call	pread@PLT
+	jmp	.L4
+.L3:
+	.loc 1 53 97 discriminator 1
+	mov	rdx, QWORD PTR -8[rbp]
+	.loc 1 53 51 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rcx, [rdx+rax]
+	mov	rax, QWORD PTR -40[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	mov	rdx, rax
+	.loc 1 53 62 discriminator 1
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rsi, rax
+	.loc 1 53 51 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edi, eax
+	call	pwrite@PLT
+.L4:
+	.loc 1 52 17 discriminator 1
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 54 12 discriminator 1
+	cmp	QWORD PTR -16[rbp], 0
+	jns	.L5
+	.loc 1 56 17
+	call	__errno_location@PLT
+	mov	eax, DWORD PTR [rax]
+	.loc 1 56 16
+	cmp	eax, 4
+	je	.L12
+	.loc 1 60 21
+	call	__errno_location@PLT
+	mov	eax, DWORD PTR [rax]
+	.loc 1 60 20
+	neg	eax
+	cdqe
+	jmp	.L8
+.L5:
+	.loc 1 62 12
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L13
+	.loc 1 66 17
+	mov	rax, QWORD PTR -16[rbp]
+	.loc 1 66 14
+	add	QWORD PTR -8[rbp], rax
+	jmp	.L2
+.L12:
+	.loc 1 58 17
+	nop
+.L2:
+.LBE2:
+	.loc 1 50 17
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -40[rbp]
+	jb	.L11
+	jmp	.L10
+.L13:
+.LBB3:
+	.loc 1 64 13
+	nop
+.L10:
+.LBE3:
+	.loc 1 68 12
+	mov	rax, QWORD PTR -8[rbp]
+.L8:
+	.loc 1 69 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	asyncFile_Transfer, .-asyncFile_Transfer
+	.type	asyncFile_RingFree, @function
+asyncFile_RingFree:
+.LFB7:
+	.loc 1 75 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 76 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 76 8
+	test	rax, rax
+	je	.L15
+	.loc 1 78 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	munmap@PLT
+.L15:
+	.loc 1 80 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 80 8
+	test	rax, rax
+	je	.L16
+	.loc 1 80 40 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 80 56 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 80 32 discriminator 1
+	cmp	rdx, rax
+	je	.L16
+	.loc 1 82 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	munmap@PLT
+.L16:
+	.loc 1 84 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 84 8
+	test	rax, rax
+	je	.L17
+	.loc 1 86 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	munmap@PLT
+.L17:
+	.loc 1 88 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 88 8
+	test	eax, eax
+	js	.L18
+	.loc 1 90 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR [rax]
+	mov	edi, eax
+	call	close@PLT
+.L18:
+	.loc 1 92 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, 120
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 93 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR [rax], -1
+	.loc 1 94 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	asyncFile_RingFree, .-asyncFile_RingFree
+	.type	asyncFile_RingMap, @function
+asyncFile_RingMap:
+.LFB8:
+	.loc 1 101 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	DWORD PTR -20[rbp], edi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 102 20
+	mov	rcx, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	r9, rcx
+	mov	r8d, edx
+	mov	ecx, 32769
+	mov	edx, 3
+	mov	rsi, rax
+	mov	edi, 0
+	call	mmap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 104 44
+	cmp	QWORD PTR -8[rbp], -1
+	je	.L20
+	.loc 1 104 44 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	jmp	.L22
+.L20:
+	.loc 1 104 44 discriminator 2
+	mov	eax, 0
+.L22:
+	.loc 1 105 1 is_stmt 1 discriminator 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	asyncFile_RingMap, .-asyncFile_RingMap
+	.type	asyncFile_RingSetup, @function
+asyncFile_RingSetup:
+.LFB9:
+	.loc 1 112 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 240
+	mov	QWORD PTR -232[rbp], rdi
+	.loc 1 113 22
+	mov	rax, QWORD PTR -232[rbp]
+	add	rax, 224
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 117 5
+	lea	rax, -160[rbp]
+	mov	edx, 120
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 118 21
+	lea	rax, -160[rbp]
+	mov	rdx, rax
+	mov	esi, 4
+	mov	edi, 425
+	mov	eax, 0
+	call	syscall@PLT
+	.loc 1 118 16
+	mov	edx, eax
+	.loc 1 118 14
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 119 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 119 8
+	test	eax, eax
+	jns	.L24
+	.loc 1 121 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR [rax], -1
+	.loc 1 122 16
+	mov	eax, 1
+	jmp	.L35
+.L24:
+	.loc 1 125 37
+	mov	eax, DWORD PTR -96[rbp]
+	mov	edx, eax
+	.loc 1 125 52
+	mov	eax, DWORD PTR -160[rbp]
+	mov	eax, eax
+	.loc 1 125 64
+	sal	rax, 2
+	.loc 1 125 44
+	add	rdx, rax
+	.loc 1 125 22
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 126 37
+	mov	eax, DWORD PTR -60[rbp]
+	mov	edx, eax
+	.loc 1 126 51
+	mov	eax, DWORD PTR -156[rbp]
+	mov	eax, eax
+	.loc 1 126 63
+	sal	rax, 4
+	.loc 1 126 43
+	add	rdx, rax
+	.loc 1 126 22
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 32[rax], rdx
+	.loc 1 127 15
+	mov	eax, DWORD PTR -140[rbp]
+	.loc 1 127 25
+	and	eax, 1
+	.loc 1 127 8
+	test	eax, eax
+	je	.L26
+	.loc 1 129 17
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 129 36
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR 16[rdx]
+	.loc 1 129 12
+	cmp	rdx, rax
+	jnb	.L27
+	.loc 1 131 36
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 131 30
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 16[rax], rdx
+.L27:
+	.loc 1 133 32
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 133 26
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 32[rax], rdx
+.L26:
+	.loc 1 135 20
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR 16[rax]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	mov	edx, 0
+	mov	rsi, rcx
+	mov	edi, eax
+	call	asyncFile_RingMap
+	.loc 1 135 18
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 8[rdx], rax
+	.loc 1 136 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 136 8
+	test	rax, rax
+	je	.L28
+	.loc 1 138 31
+	mov	eax, DWORD PTR -140[rbp]
+	.loc 1 138 41
+	and	eax, 1
+	.loc 1 139 37
+	test	eax, eax
+	je	.L29
+	.loc 1 139 37 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	jmp	.L30
+.L29:
+	.loc 1 139 39 is_stmt 1 discriminator 2
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR 32[rax]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	mov	edx, 134217728
+	mov	rsi, rcx
+	mov	edi, eax
+	call	asyncFile_RingMap
+.L30:
+	.loc 1 138 22
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 24[rdx], rax
+.L28:
+	.loc 1 141 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 141 8
+	test	rax, rax
+	je	.L31
+	.loc 1 143 32
+	mov	eax, DWORD PTR -160[rbp]
+	mov	eax, eax
+	.loc 1 143 44
+	sal	rax, 6
+	mov	rdx, rax
+	.loc 1 143 24
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 144 22
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR 48[rax]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	mov	edx, 268435456
+	mov	rsi, rcx
+	mov	edi, eax
+	call	asyncFile_RingMap
+	.loc 1 144 20
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 40[rdx], rax
+.L31:
+	.loc 1 146 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 146 8
+	test	rax, rax
+	jne	.L32
+.LBB4:
+	.loc 1 148 21
+	call	__errno_location@PLT
+	.loc 1 148 13
+	mov	eax, DWORD PTR [rax]
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 149 9
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	asyncFile_RingFree
+	.loc 1 150 9
+	call	__errno_location@PLT
+	.loc 1 150 15
+	mov	edx, DWORD PTR -36[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 151 16
+	mov	eax, 1
+	jmp	.L35
+.L32:
+.LBE4:
+	.loc 1 154 20
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 155 20
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 156 54
+	mov	eax, DWORD PTR -116[rbp]
+	mov	edx, eax
+	.loc 1 156 39
+	mov	rax, QWORD PTR -24[rbp]
+	add	rdx, rax
+	.loc 1 156 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 56[rax], rdx
+	.loc 1 157 54
+	mov	eax, DWORD PTR -112[rbp]
+	mov	edx, eax
+	.loc 1 157 39
+	mov	rax, QWORD PTR -24[rbp]
+	add	rdx, rax
+	.loc 1 157 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	.loc 1 158 55
+	mov	eax, DWORD PTR -96[rbp]
+	mov	edx, eax
+	.loc 1 158 40
+	mov	rax, QWORD PTR -24[rbp]
+	add	rdx, rax
+	.loc 1 158 19
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	.loc 1 159 54
+	mov	eax, DWORD PTR -80[rbp]
+	mov	edx, eax
+	.loc 1 159 39
+	mov	rax, QWORD PTR -32[rbp]
+	add	rdx, rax
+	.loc 1 159 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 80[rax], rdx
+	.loc 1 160 54
+	mov	eax, DWORD PTR -76[rbp]
+	mov	edx, eax
+	.loc 1 160 39
+	mov	rax, QWORD PTR -32[rbp]
+	add	rdx, rax
+	.loc 1 160 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 88[rax], rdx
+	.loc 1 161 54
+	mov	eax, DWORD PTR -72[rbp]
+	mov	edx, eax
+	.loc 1 161 39
+	mov	rax, QWORD PTR -32[rbp]
+	add	rdx, rax
+	.loc 1 161 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 96[rax], rdx
+	.loc 1 162 36
+	mov	eax, DWORD PTR -60[rbp]
+	mov	edx, eax
+	.loc 1 162 21
+	mov	rax, QWORD PTR -32[rbp]
+	add	rdx, rax
+	.loc 1 162 16
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 104[rax], rdx
+.LBB5:
+	.loc 1 164 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 164 5
+	jmp	.L33
+.L34:
+	.loc 1 166 46 discriminator 3
+	mov	rcx, QWORD PTR -232[rbp]
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rcx
+	add	rax, 24
+	mov	rax, QWORD PTR [rax]
+	.loc 1 166 28 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 4
+	add	rdx, rbp
+	sub	rdx, 224
+	mov	QWORD PTR [rdx], rax
+	.loc 1 167 27 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	sal	rax, 4
+	add	rax, rbp
+	sub	rax, 216
+	mov	QWORD PTR [rax], 262144
+	.loc 1 164 44 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L33:
+	.loc 1 164 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], 3
+	jle	.L34
+.LBE5:
+	.loc 1 169 25
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	lea	rdx, -224[rbp]
+	mov	r8d, 4
+	mov	rcx, rdx
+	mov	edx, 0
+	mov	esi, eax
+	mov	edi, 427
+	mov	eax, 0
+	call	syscall@PLT
+	.loc 1 169 118
+	test	rax, rax
+	sete	al
+	movzx	edx, al
+	.loc 1 169 22
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 112[rax], edx
+	.loc 1 171 12
+	mov	eax, 0
+.L35:
+	.loc 1 172 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	asyncFile_RingSetup, .-asyncFile_RingSetup
+	.type	asyncFile_RingSubmit, @function
+asyncFile_RingSubmit:
+.LFB10:
+	.loc 1 178 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	mov	DWORD PTR -44[rbp], esi
+	.loc 1 179 22
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 224
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 180 24
+	mov	eax, DWORD PTR -44[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, 16[rax]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	add	rax, 8
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 181 36
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 181 24
+	mov	eax, DWORD PTR [rax]
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 182 43
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 182 38
+	mov	eax, DWORD PTR [rax]
+	.loc 1 182 24
+	and	eax, DWORD PTR -20[rbp]
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 183 60
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 183 67
+	mov	edx, DWORD PTR -24[rbp]
+	sal	rdx, 6
+	.loc 1 183 26
+	add	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 185 5
+	mov	rax, QWORD PTR -32[rbp]
+	mov	edx, 64
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 186 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 186 8
+	test	eax, eax
+	jne	.L37
+	.loc 1 188 27
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 112[rax]
+	.loc 1 188 21
+	test	eax, eax
+	je	.L38
+	.loc 1 188 21 is_stmt 0 discriminator 1
+	mov	edx, 4
+	jmp	.L39
+.L38:
+	.loc 1 188 21 discriminator 2
+	mov	edx, 22
+.L39:
+	.loc 1 188 21 discriminator 4
+	mov	rax, QWORD PTR -32[rbp]
+	mov	BYTE PTR [rax], dl
+	jmp	.L40
+.L37:
+	.loc 1 192 27 is_stmt 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 112[rax]
+	.loc 1 192 21
+	test	eax, eax
+	je	.L41
+	.loc 1 192 21 is_stmt 0 discriminator 1
+	mov	edx, 5
+	jmp	.L42
+.L41:
+	.loc 1 192 21 discriminator 2
+	mov	edx, 23
+.L42:
+	.loc 1 192 21 discriminator 4
+	mov	rax, QWORD PTR -32[rbp]
+	mov	BYTE PTR [rax], dl
+.L40:
+	.loc 1 194 19 is_stmt 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR [rax]
+	.loc 1 194 13
+	mov	rax, QWORD PTR -32[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 195 44
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 195 17
+	mov	rdx, rax
+	.loc 1 195 15
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 196 32
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 196 16
+	mov	edx, eax
+	.loc 1 196 14
+	mov	rax, QWORD PTR -32[rbp]
+	mov	DWORD PTR 24[rax], edx
+	.loc 1 197 32
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 197 16
+	mov	rdx, rax
+	.loc 1 197 14
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 198 22
+	mov	eax, DWORD PTR -44[rbp]
+	mov	edx, eax
+	.loc 1 198 20
+	mov	rax, QWORD PTR -32[rbp]
+	mov	WORD PTR 40[rax], dx
+	.loc 1 199 22
+	mov	eax, DWORD PTR -44[rbp]
+	movsx	rdx, eax
+	.loc 1 199 20
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR 32[rax], rdx
+	.loc 1 200 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 200 18
+	mov	edx, DWORD PTR -24[rbp]
+	sal	rdx, 2
+	add	rdx, rax
+	.loc 1 200 25
+	mov	eax, DWORD PTR -24[rbp]
+	mov	DWORD PTR [rdx], eax
+	.loc 1 201 5
+	mov	eax, DWORD PTR -20[rbp]
+	lea	edx, 1[rax]
+	.loc 1 201 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 201 5
+	mov	DWORD PTR [rax], edx
+	.loc 1 203 11
+	jmp	.L43
+.L45:
+	.loc 1 205 13
+	call	__errno_location@PLT
+	mov	eax, DWORD PTR [rax]
+	.loc 1 205 12
+	cmp	eax, 4
+	je	.L43
+	.loc 1 208 34
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 208 13
+	mov	edx, DWORD PTR -20[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 209 31
+	call	__errno_location@PLT
+	mov	eax, DWORD PTR [rax]
+	.loc 1 209 30
+	neg	eax
+	movsx	rdx, eax
+	.loc 1 209 28
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 210 27
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 32[rax], 2
+	.loc 1 211 13
+	jmp	.L44
+.L43:
+	.loc 1 203 12
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR [rax]
+	sub	rsp, 8
+	push	0
+	mov	r9d, 0
+	mov	r8d, 0
+	mov	ecx, 0
+	mov	edx, 1
+	mov	esi, eax
+	mov	edi, 426
+	mov	eax, 0
+	call	syscall@PLT
+	add	rsp, 16
+	.loc 1 203 69
+	test	rax, rax
+	js	.L45
+	.loc 1 214 1
+	nop
+.L44:
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	asyncFile_RingSubmit, .-asyncFile_RingSubmit
+	.type	asyncFile_RingReap, @function
+asyncFile_RingReap:
+.LFB11:
+	.loc 1 220 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -56[rbp], rdi
+	.loc 1 221 22
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, 224
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 222 32
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 223 30
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 223 18
+	mov	eax, DWORD PTR [rax]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 224 51
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 224 31
+	mov	eax, DWORD PTR [rax]
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 226 5
+	jmp	.L47
+.L49:
+.LBB6:
+	.loc 1 228 60
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	.loc 1 228 55
+	mov	eax, DWORD PTR [rax]
+	.loc 1 228 53
+	and	eax, DWORD PTR -4[rbp]
+	mov	eax, eax
+	.loc 1 228 47
+	sal	rax, 4
+	mov	rdx, rax
+	.loc 1 228 36
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 229 16
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 229 12
+	cmp	rax, 3
+	ja	.L48
+.LBB7:
+	.loc 1 231 59
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 231 32
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, 16[rax]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	add	rax, 8
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 232 33
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	movsx	rdx, eax
+	.loc 1 232 28
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 233 27
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 32[rax], 2
+.L48:
+.LBE7:
+.LBE6:
+	.loc 1 226 30
+	add	DWORD PTR -4[rbp], 1
+.L47:
+	.loc 1 226 17 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -28[rbp]
+	jne	.L49
+	.loc 1 236 26
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 236 5
+	mov	edx, DWORD PTR -4[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 237 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	asyncFile_RingReap, .-asyncFile_RingReap
+	.type	asyncFile_RingDrain, @function
+asyncFile_RingDrain:
+.LFB12:
+	.loc 1 245 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -56[rbp], rdi
+	.loc 1 246 22
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, 224
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 247 9
+	mov	DWORD PTR -4[rbp], 0
+.L64:
+.LBB8:
+	.loc 1 251 22
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 253 9
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	asyncFile_RingReap
+.LBB9:
+	.loc 1 254 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 254 9
+	jmp	.L51
+.L52:
+	.loc 1 256 45 discriminator 3
+	mov	rcx, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rcx
+	add	rax, 56
+	mov	eax, DWORD PTR [rax]
+	.loc 1 256 52 discriminator 3
+	cmp	eax, 1
+	sete	al
+	movzx	eax, al
+	.loc 1 256 25 discriminator 3
+	add	DWORD PTR -8[rbp], eax
+	.loc 1 254 48 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L51:
+	.loc 1 254 27 discriminator 1
+	cmp	DWORD PTR -12[rbp], 3
+	jle	.L52
+.LBE9:
+	.loc 1 258 12
+	cmp	DWORD PTR -8[rbp], 0
+	jne	.L53
+	.loc 1 260 20
+	mov	eax, 0
+	jmp	.L54
+.L53:
+	.loc 1 262 14
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR [rax]
+	sub	rsp, 8
+	push	0
+	mov	r9d, 0
+	mov	r8d, 1
+	mov	ecx, 1
+	mov	edx, 0
+	mov	esi, eax
+	mov	edi, 426
+	mov	eax, 0
+	call	syscall@PLT
+	add	rsp, 16
+	.loc 1 262 12
+	test	rax, rax
+	jns	.L65
+	.loc 1 262 102 discriminator 2
+	call	__errno_location@PLT
+	mov	eax, DWORD PTR [rax]
+	.loc 1 262 98 discriminator 2
+	cmp	eax, 4
+	je	.L65
+	.loc 1 266 12
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L58
+	.loc 1 268 20
+	mov	eax, 1
+	jmp	.L54
+.L58:
+	.loc 1 272 34
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 272 22
+	mov	eax, DWORD PTR [rax]
+	mov	DWORD PTR -16[rbp], eax
+.LBB10:
+	.loc 1 273 18
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 273 9
+	jmp	.L59
+.L61:
+	.loc 1 275 33
+	mov	rcx, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rcx
+	add	rax, 56
+	mov	eax, DWORD PTR [rax]
+	.loc 1 275 16
+	cmp	eax, 1
+	jne	.L60
+.LBB11:
+	.loc 1 277 47
+	mov	eax, DWORD PTR -16[rbp]
+	lea	edx, 1[rax]
+	mov	DWORD PTR -16[rbp], edx
+	.loc 1 277 57
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 64[rdx]
+	.loc 1 277 52
+	mov	edx, DWORD PTR [rdx]
+	.loc 1 277 36
+	and	eax, edx
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 278 72
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 278 79
+	mov	edx, DWORD PTR -36[rbp]
+	sal	rdx, 6
+	.loc 1 278 38
+	add	rax, rdx
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 280 17
+	mov	rax, QWORD PTR -48[rbp]
+	mov	edx, 64
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 281 29
+	mov	rax, QWORD PTR -48[rbp]
+	mov	BYTE PTR [rax], 14
+	.loc 1 282 29
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rdx, eax
+	.loc 1 282 27
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 283 32
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR 32[rax], 4
+	.loc 1 284 21
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 284 30
+	mov	edx, DWORD PTR -36[rbp]
+	sal	rdx, 2
+	add	rdx, rax
+	.loc 1 284 37
+	mov	eax, DWORD PTR -36[rbp]
+	mov	DWORD PTR [rdx], eax
+.L60:
+.LBE11:
+	.loc 1 273 48 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L59:
+	.loc 1 273 27 discriminator 1
+	cmp	DWORD PTR -20[rbp], 3
+	jle	.L61
+.LBE10:
+	.loc 1 287 30
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 287 9
+	mov	edx, DWORD PTR -16[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 288 15
+	jmp	.L62
+.L63:
+	.loc 1 290 17
+	call	__errno_location@PLT
+	mov	eax, DWORD PTR [rax]
+	.loc 1 290 16
+	cmp	eax, 4
+	je	.L62
+	.loc 1 292 24
+	mov	eax, 1
+	jmp	.L54
+.L62:
+	.loc 1 288 16
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR [rax]
+	mov	edx, DWORD PTR -8[rbp]
+	sub	rsp, 8
+	push	0
+	mov	r9d, 0
+	mov	r8d, 0
+	mov	ecx, 0
+	mov	esi, eax
+	mov	edi, 426
+	mov	eax, 0
+	call	syscall@PLT
+	add	rsp, 16
+	.loc 1 288 83
+	test	rax, rax
+	js	.L63
+	.loc 1 295 19
+	mov	DWORD PTR -4[rbp], 1
+	jmp	.L64
+.L65:
+	.loc 1 264 13
+	nop
+.LBE8:
+	.loc 1 250 5
+	jmp	.L64
+.L54:
+	.loc 1 297 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	asyncFile_RingDrain, .-asyncFile_RingDrain
+	.type	asyncFile_Thread, @function
+asyncFile_Thread:
+.LFB13:
+	.loc 1 304 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 305 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 307 5
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+.L72:
+.LBB12:
+	.loc 1 310 56
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 488[rax]
+	.loc 1 310 67
+	and	eax, 3
+	mov	rdx, rax
+	.loc 1 310 28
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, 16[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	add	rax, 8
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 311 15
+	jmp	.L67
+.L69:
+	.loc 1 313 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 352[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 392
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	pthread_cond_wait@PLT
+.L67:
+	.loc 1 311 23
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 311 60
+	cmp	eax, 1
+	je	.L68
+	.loc 1 311 68 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 496[rax]
+	.loc 1 311 60 discriminator 1
+	test	eax, eax
+	je	.L69
+.L68:
+	.loc 1 315 19
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 315 12
+	cmp	eax, 1
+	jne	.L75
+	.loc 1 319 9
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 321 26
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, QWORD PTR 8[rax]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR 16[rax]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR [rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	esi, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR [rax]
+	mov	r8, rdi
+	mov	edi, eax
+	call	asyncFile_Transfer
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 323 9
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 324 24
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 325 23
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 32[rax], 2
+	.loc 1 326 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 488[rax]
+	.loc 1 326 23
+	lea	rdx, 1[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 488[rax], rdx
+	.loc 1 327 9
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 440
+	mov	rdi, rax
+	call	pthread_cond_broadcast@PLT
+.LBE12:
+	.loc 1 309 5
+	jmp	.L72
+.L75:
+.LBB13:
+	.loc 1 317 13
+	nop
+.LBE13:
+	.loc 1 329 5
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 331 12
+	mov	eax, 0
+	.loc 1 332 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	asyncFile_Thread, .-asyncFile_Thread
+	.type	asyncFile_Submit, @function
+asyncFile_Submit:
+.LFB14:
+	.loc 1 338 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 339 33
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 339 15
+	and	eax, 3
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 340 24
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, 16[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	add	rax, 8
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 342 26
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 200[rax]
+	.loc 1 342 20
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 343 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 344 20
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 24[rax], 0
+	.loc 1 345 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 200[rax]
+	.loc 1 345 21
+	mov	rax, QWORD PTR -32[rbp]
+	.loc 1 345 18
+	add	rdx, rax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 200[rax], rdx
+	.loc 1 346 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 346 20
+	lea	rdx, 1[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 184[rax], rdx
+	.loc 1 348 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 348 8
+	cmp	eax, 2
+	jne	.L77
+	.loc 1 350 23
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 351 9
+	mov	edx, DWORD PTR -4[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	asyncFile_RingSubmit
+	.loc 1 360 1
+	jmp	.L79
+.L77:
+	.loc 1 355 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 356 23
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 357 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 392
+	mov	rdi, rax
+	call	pthread_cond_signal@PLT
+	.loc 1 358 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+.L79:
+	.loc 1 360 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	asyncFile_Submit, .-asyncFile_Submit
+	.type	asyncFile_Wait, @function
+asyncFile_Wait:
+.LFB15:
+	.loc 1 368 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 369 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 369 8
+	cmp	eax, 2
+	jne	.L81
+	.loc 1 371 15
+	jmp	.L83
+.L86:
+	.loc 1 373 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	asyncFile_RingReap
+	.loc 1 374 24
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 374 16
+	cmp	eax, 2
+	je	.L83
+	.loc 1 375 21
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 224[rax]
+	sub	rsp, 8
+	push	0
+	mov	r9d, 0
+	mov	r8d, 1
+	mov	ecx, 1
+	mov	edx, 0
+	mov	esi, eax
+	mov	edi, 426
+	mov	eax, 0
+	call	syscall@PLT
+	add	rsp, 16
+	.loc 1 375 17
+	test	rax, rax
+	jns	.L83
+	.loc 1 376 21
+	call	__errno_location@PLT
+	mov	eax, DWORD PTR [rax]
+	.loc 1 376 17
+	cmp	eax, 4
+	je	.L83
+	.loc 1 379 25
+	call	__errno_location@PLT
+	mov	eax, DWORD PTR [rax]
+	.loc 1 379 24
+	neg	eax
+	cdqe
+	jmp	.L85
+.L83:
+	.loc 1 371 22
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 371 30
+	cmp	eax, 2
+	jne	.L86
+	.loc 1 382 20
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 382 12
+	test	rax, rax
+	jle	.L87
+	.loc 1 382 52 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 382 38 discriminator 1
+	mov	rdx, rax
+	.loc 1 382 69 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 382 34 discriminator 1
+	cmp	rdx, rax
+	jnb	.L87
+.LBB14:
+	.loc 1 385 92
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	.loc 1 385 109
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 384 28
+	lea	rdi, [rdx+rax]
+	.loc 1 385 53
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 385 76
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 384 28
+	mov	rcx, rdx
+	sub	rcx, rax
+	.loc 1 384 76
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 384 89
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 384 28
+	add	rdx, rax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	mov	r8, rdi
+	mov	edi, eax
+	call	asyncFile_Transfer
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 386 48
+	cmp	QWORD PTR -8[rbp], 0
+	js	.L88
+	.loc 1 386 56 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 386 48 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	jmp	.L89
+.L88:
+	.loc 1 386 48 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -8[rbp]
+.L89:
+	.loc 1 386 28 is_stmt 1 discriminator 4
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	QWORD PTR 24[rdx], rax
+	jmp	.L87
+.L81:
+.LBE14:
+	.loc 1 391 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 392 15
+	jmp	.L90
+.L91:
+	.loc 1 394 13
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, 352[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 440
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	pthread_cond_wait@PLT
+.L90:
+	.loc 1 392 22
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 392 30
+	cmp	eax, 2
+	jne	.L91
+	.loc 1 396 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+.L87:
+	.loc 1 398 18
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 24[rax]
+.L85:
+	.loc 1 399 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	asyncFile_Wait, .-asyncFile_Wait
+	.type	asyncFile_FreeBuffer, @function
+asyncFile_FreeBuffer:
+.LFB16:
+	.loc 1 405 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	.loc 1 406 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 406 8
+	cmp	eax, 3
+	jne	.L93
+	.loc 1 408 9
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 409 23
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 32[rax], 0
+	.loc 1 410 9
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 416 1
+	jmp	.L95
+.L93:
+	.loc 1 414 23
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 32[rax], 0
+.L95:
+	.loc 1 416 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	asyncFile_FreeBuffer, .-asyncFile_FreeBuffer
+	.type	asyncFile_ReapWrite, @function
+asyncFile_ReapWrite:
+.LFB17:
+	.loc 1 423 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 424 52
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 192[rax]
+	.loc 1 424 64
+	and	eax, 3
+	mov	rdx, rax
+	.loc 1 424 24
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, 16[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	add	rax, 8
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 425 22
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	asyncFile_Wait
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 427 35
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 427 17
+	mov	rax, QWORD PTR -16[rbp]
+	.loc 1 427 8
+	cmp	rdx, rax
+	je	.L97
+	.loc 1 427 51 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 216[rax]
+	.loc 1 427 43 discriminator 1
+	test	eax, eax
+	jne	.L97
+	.loc 1 429 51
+	cmp	QWORD PTR -16[rbp], 0
+	jns	.L98
+	.loc 1 429 38 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	neg	eax
+	.loc 1 429 51 discriminator 1
+	mov	edx, eax
+	jmp	.L99
+.L98:
+	.loc 1 429 51 is_stmt 0 discriminator 2
+	mov	edx, 28
+.L99:
+	.loc 1 429 21 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 216[rax], edx
+.L97:
+	.loc 1 431 5
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	asyncFile_FreeBuffer
+	.loc 1 432 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 192[rax]
+	.loc 1 432 20
+	lea	rdx, 1[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 192[rax], rdx
+	.loc 1 434 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 216[rax]
+	.loc 1 434 46
+	test	eax, eax
+	setne	al
+	movzx	eax, al
+	.loc 1 435 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	asyncFile_ReapWrite, .-asyncFile_ReapWrite
+	.section	.rodata
+	.align 8
+.LC4:
+	.string	"ERROR: Unknown argument for --io, expected auto, uring, thread or stdio"
+	.text
+	.globl	asyncFile_ProcessArgumentBackend
+	.type	asyncFile_ProcessArgumentBackend, @function
+asyncFile_ProcessArgumentBackend:
+.LFB18:
+	.loc 1 438 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+.LBB15:
+	.loc 1 439 23
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 439 5
+	jmp	.L102
+.L105:
+	.loc 1 441 53
+	mov	eax, DWORD PTR -4[rbp]
+	sal	rax, 4
+	mov	rdx, rax
+	lea	rax, asyncFileBackendNames[rip]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 441 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 441 12
+	test	eax, eax
+	jne	.L103
+	.loc 1 443 44
+	mov	eax, DWORD PTR -4[rbp]
+	sal	rax, 4
+	mov	rdx, rax
+	lea	rax, asyncFileBackendNames[rip+8]
+	mov	eax, DWORD PTR [rdx+rax]
+	jmp	.L104
+.L103:
+	.loc 1 439 101 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L102:
+	.loc 1 439 32 discriminator 1
+	cmp	DWORD PTR -4[rbp], 3
+	jbe	.L105
+.LBE15:
+	.loc 1 446 5
+	lea	rax, .LC4[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 447 12
+	mov	eax, 0
+.L104:
+	.loc 1 448 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	asyncFile_ProcessArgumentBackend, .-asyncFile_ProcessArgumentBackend
+	.section	.rodata
+.LC5:
+	.string	"unknown"
+	.text
+	.globl	asyncFile_BackendName
+	.type	asyncFile_BackendName, @function
+asyncFile_BackendName:
+.LFB19:
+	.loc 1 451 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -20[rbp], edi
+.LBB16:
+	.loc 1 452 23
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 452 5
+	jmp	.L107
+.L110:
+	.loc 1 454 37
+	mov	eax, DWORD PTR -4[rbp]
+	sal	rax, 4
+	mov	rdx, rax
+	lea	rax, asyncFileBackendNames[rip+8]
+	mov	eax, DWORD PTR [rdx+rax]
+	.loc 1 454 12
+	cmp	DWORD PTR -20[rbp], eax
+	jne	.L108
+	.loc 1 456 44
+	mov	eax, DWORD PTR -4[rbp]
+	sal	rax, 4
+	mov	rdx, rax
+	lea	rax, asyncFileBackendNames[rip]
+	mov	rax, QWORD PTR [rdx+rax]
+	jmp	.L109
+.L108:
+	.loc 1 452 101 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L107:
+	.loc 1 452 32 discriminator 1
+	cmp	DWORD PTR -4[rbp], 3
+	jbe	.L110
+.LBE16:
+	.loc 1 459 12
+	lea	rax, .LC5[rip]
+.L109:
+	.loc 1 460 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	asyncFile_BackendName, .-asyncFile_BackendName
+	.section	.rodata
+.LC6:
+	.string	"Error allocating I/O buffers"
+.LC7:
+	.string	"io_uring"
+.LC8:
+	.string	"pthread_create"
+	.text
+	.globl	asyncFile_Open
+	.type	asyncFile_Open, @function
+asyncFile_Open:
+.LFB20:
+	.loc 1 463 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -40[rbp], rdi
+	mov	DWORD PTR -44[rbp], esi
+	mov	DWORD PTR -48[rbp], edx
+	mov	DWORD PTR -52[rbp], ecx
+	mov	QWORD PTR -64[rbp], r8
+	mov	QWORD PTR -72[rbp], r9
+	.loc 1 464 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 466 5
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, 504
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 467 14
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -44[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 468 16
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -48[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 469 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 200[rax], rdx
+	.loc 1 470 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	QWORD PTR 208[rax], rdx
+	.loc 1 471 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 224[rax], -1
+	.loc 1 473 40
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR [rax]
+	.loc 1 473 55
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 473 36
+	mov	edx, 4096
+	mov	esi, 1048576
+	mov	rdi, rax
+	call	rcx
+.LVL0:
+	.loc 1 473 18
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 16[rdx], rax
+	.loc 1 475 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 475 8
+	test	rax, rax
+	jne	.L112
+	.loc 1 477 9
+	lea	rax, .LC6[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 478 16
+	mov	eax, 1
+	jmp	.L113
+.L112:
+.LBB17:
+	.loc 1 480 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 480 5
+	jmp	.L114
+.L115:
+	.loc 1 482 38 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 482 47 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	.loc 1 482 57 discriminator 3
+	sal	rdx, 18
+	.loc 1 482 33 discriminator 3
+	lea	rcx, [rax+rdx]
+	.loc 1 482 31 discriminator 3
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rsi
+	add	rax, 24
+	mov	QWORD PTR [rax], rcx
+	.loc 1 480 44 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L114:
+	.loc 1 480 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], 3
+	jle	.L115
+.LBE17:
+	.loc 1 485 8
+	cmp	DWORD PTR -52[rbp], 3
+	je	.L116
+	.loc 1 485 52 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	asyncFile_RingSetup
+	.loc 1 485 48 discriminator 1
+	test	eax, eax
+	jne	.L116
+	.loc 1 487 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 8[rax], 2
+	jmp	.L117
+.L116:
+	.loc 1 489 13
+	cmp	DWORD PTR -52[rbp], 2
+	jne	.L118
+	.loc 1 491 9
+	lea	rax, .LC7[rip]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 492 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 492 42
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 492 27
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 492 9
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+	.loc 1 493 22
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 494 16
+	mov	eax, 1
+	jmp	.L113
+.L118:
+	.loc 1 498 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 8[rax], 3
+	.loc 1 499 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 352
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_mutex_init@PLT
+	.loc 1 500 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 392
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_cond_init@PLT
+	.loc 1 501 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 440
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_cond_init@PLT
+	.loc 1 502 13
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rdi, 344[rax]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rcx, rax
+	lea	rax, asyncFile_Thread[rip]
+	mov	rdx, rax
+	mov	esi, 0
+	call	pthread_create@PLT
+	.loc 1 502 12
+	test	eax, eax
+	je	.L119
+	.loc 1 504 13
+	lea	rax, .LC8[rip]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 505 13
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 440
+	mov	rdi, rax
+	call	pthread_cond_destroy@PLT
+	.loc 1 506 13
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 392
+	mov	rdi, rax
+	call	pthread_cond_destroy@PLT
+	.loc 1 507 13
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_destroy@PLT
+	.loc 1 508 17
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 508 46
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 508 31
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 508 13
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL2:
+	.loc 1 509 26
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 510 20
+	mov	eax, 1
+	jmp	.L113
+.L117:
+	.loc 1 515 11
+	jmp	.L119
+.L123:
+.LBB18:
+	.loc 1 517 32
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 208[rax]
+	.loc 1 517 44
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 200[rax]
+	.loc 1 517 21
+	sub	rdx, rax
+	mov	QWORD PTR -24[rbp], rdx
+	.loc 1 518 9
+	cmp	QWORD PTR -24[rbp], 262143
+	jg	.L120
+	.loc 1 518 9 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	jmp	.L121
+.L120:
+	.loc 1 518 9 discriminator 2
+	mov	eax, 262144
+.L121:
+	.loc 1 518 9 discriminator 4
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rsi, rax
+	mov	rdi, rdx
+	call	asyncFile_Submit
+.L119:
+.LBE18:
+	.loc 1 515 78 is_stmt 1
+	cmp	DWORD PTR -48[rbp], 0
+	jne	.L122
+	.loc 1 515 46 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 515 38 discriminator 1
+	cmp	rax, 3
+	ja	.L122
+	.loc 1 515 86 discriminator 2
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 200[rax]
+	.loc 1 515 101 discriminator 2
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 208[rax]
+	.loc 1 515 78 discriminator 2
+	cmp	rdx, rax
+	jl	.L123
+.L122:
+	.loc 1 520 12
+	mov	eax, 0
+.L113:
+	.loc 1 521 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	asyncFile_Open, .-asyncFile_Open
+	.globl	asyncFile_AcquireRead
+	.type	asyncFile_AcquireRead, @function
+asyncFile_AcquireRead:
+.LFB21:
+	.loc 1 524 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 525 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 192[rax]
+	.loc 1 525 32
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 525 8
+	cmp	rdx, rax
+	jne	.L125
+	.loc 1 527 16
+	mov	eax, 0
+	jmp	.L126
+.L125:
+	.loc 1 530 52
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 192[rax]
+	.loc 1 530 64
+	and	eax, 3
+	mov	rdx, rax
+	.loc 1 530 24
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, 16[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	add	rax, 8
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 531 22
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	asyncFile_Wait
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 532 8
+	cmp	QWORD PTR -16[rbp], 0
+	jns	.L127
+	.loc 1 534 23
+	mov	rax, QWORD PTR -16[rbp]
+	neg	eax
+	mov	edx, eax
+	.loc 1 534 21
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 216[rax], edx
+	.loc 1 535 9
+	call	__errno_location@PLT
+	.loc 1 535 21
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 216[rdx]
+	.loc 1 535 15
+	mov	DWORD PTR [rax], edx
+	.loc 1 536 16
+	mov	rax, -1
+	jmp	.L126
+.L127:
+	.loc 1 539 32
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 539 24
+	mov	rdx, QWORD PTR -16[rbp]
+	.loc 1 539 8
+	cmp	rdx, rax
+	jnb	.L128
+	.loc 1 541 27
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	.loc 1 541 36
+	mov	rax, QWORD PTR -16[rbp]
+	add	rdx, rax
+	.loc 1 541 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 208[rax], rdx
+.L128:
+	.loc 1 543 19
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 543 11
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 544 12
+	mov	rax, QWORD PTR -16[rbp]
+.L126:
+	.loc 1 545 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	asyncFile_AcquireRead, .-asyncFile_AcquireRead
+	.globl	asyncFile_ReleaseRead
+	.type	asyncFile_ReleaseRead, @function
+asyncFile_ReleaseRead:
+.LFB22:
+	.loc 1 548 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 549 51
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 192[rax]
+	.loc 1 549 63
+	and	eax, 3
+	mov	rdx, rax
+	.loc 1 549 5
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, 16[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	lea	rdx, 8[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	asyncFile_FreeBuffer
+	.loc 1 550 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 192[rax]
+	.loc 1 550 20
+	lea	rdx, 1[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 192[rax], rdx
+	.loc 1 552 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 200[rax]
+	.loc 1 552 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 208[rax]
+	.loc 1 552 8
+	cmp	rdx, rax
+	jge	.L133
+.LBB19:
+	.loc 1 554 32
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 208[rax]
+	.loc 1 554 44
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 200[rax]
+	.loc 1 554 21
+	sub	rdx, rax
+	mov	QWORD PTR -8[rbp], rdx
+	.loc 1 555 9
+	cmp	QWORD PTR -8[rbp], 262143
+	jg	.L131
+	.loc 1 555 9 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	jmp	.L132
+.L131:
+	.loc 1 555 9 discriminator 2
+	mov	eax, 262144
+.L132:
+	.loc 1 555 9 discriminator 4
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, rax
+	mov	rdi, rdx
+	call	asyncFile_Submit
+.L133:
+.LBE19:
+	.loc 1 557 1 is_stmt 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	asyncFile_ReleaseRead, .-asyncFile_ReleaseRead
+	.globl	asyncFile_AcquireWrite
+	.type	asyncFile_AcquireWrite, @function
+asyncFile_AcquireWrite:
+.LFB23:
+	.loc 1 560 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 561 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 184[rax]
+	.loc 1 561 32
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 192[rax]
+	.loc 1 561 26
+	sub	rdx, rax
+	.loc 1 561 8
+	cmp	rdx, 4
+	jne	.L135
+	.loc 1 561 69 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	asyncFile_ReapWrite
+	.loc 1 561 65 discriminator 1
+	test	eax, eax
+	je	.L135
+	.loc 1 563 9
+	call	__errno_location@PLT
+	.loc 1 563 21
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 216[rdx]
+	.loc 1 563 15
+	mov	DWORD PTR [rax], edx
+	.loc 1 564 16
+	mov	eax, 0
+	jmp	.L136
+.L135:
+	.loc 1 566 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 216[rax]
+	.loc 1 566 8
+	test	eax, eax
+	je	.L137
+	.loc 1 568 9
+	call	__errno_location@PLT
+	.loc 1 568 21
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 216[rdx]
+	.loc 1 568 15
+	mov	DWORD PTR [rax], edx
+	.loc 1 569 16
+	mov	eax, 0
+	jmp	.L136
+.L137:
+	.loc 1 571 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 571 42
+	and	eax, 3
+	mov	rdx, rax
+	.loc 1 571 61
+	mov	rcx, QWORD PTR -8[rbp]
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rcx
+	add	rax, 24
+	mov	rax, QWORD PTR [rax]
+.L136:
+	.loc 1 572 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	asyncFile_AcquireWrite, .-asyncFile_AcquireWrite
+	.globl	asyncFile_CommitWrite
+	.type	asyncFile_CommitWrite, @function
+asyncFile_CommitWrite:
+.LFB24:
+	.loc 1 575 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	.loc 1 576 8
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L140
+	.loc 1 578 9
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	asyncFile_Submit
+.L140:
+	.loc 1 580 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	asyncFile_CommitWrite, .-asyncFile_CommitWrite
+	.globl	asyncFile_Flush
+	.type	asyncFile_Flush, @function
+asyncFile_Flush:
+.LFB25:
+	.loc 1 583 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 584 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 584 8
+	cmp	eax, 1
+	jne	.L142
+	.loc 1 586 15
+	jmp	.L143
+.L144:
+	.loc 1 588 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	asyncFile_ReapWrite
+.L143:
+	.loc 1 586 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 192[rax]
+	.loc 1 586 38
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 586 32
+	cmp	rdx, rax
+	jb	.L144
+	jmp	.L145
+.L142:
+.LBB20:
+	.loc 1 594 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 192[rax]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 594 9
+	jmp	.L146
+.L147:
+	.loc 1 596 51 discriminator 3
+	mov	rax, QWORD PTR -8[rbp]
+	and	eax, 3
+	mov	rdx, rax
+	.loc 1 596 13 discriminator 3
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, 16[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	lea	rdx, 8[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	asyncFile_Wait
+	.loc 1 594 71 discriminator 3
+	add	QWORD PTR -8[rbp], 1
+.L146:
+	.loc 1 594 57 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 594 51 discriminator 1
+	cmp	QWORD PTR -8[rbp], rax
+	jb	.L147
+.L145:
+.LBE20:
+	.loc 1 599 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 216[rax]
+	.loc 1 599 8
+	test	eax, eax
+	je	.L148
+	.loc 1 601 9
+	call	__errno_location@PLT
+	.loc 1 601 21
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 216[rdx]
+	.loc 1 601 15
+	mov	DWORD PTR [rax], edx
+	.loc 1 602 16
+	mov	eax, 1
+	jmp	.L149
+.L148:
+	.loc 1 604 12
+	mov	eax, 0
+.L149:
+	.loc 1 605 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	asyncFile_Flush, .-asyncFile_Flush
+	.section	.rodata
+	.align 8
+.LC9:
+	.string	"Error: io_uring transfers can not be drained, their buffers are not released"
+	.text
+	.globl	asyncFile_Close
+	.type	asyncFile_Close, @function
+asyncFile_Close:
+.LFB26:
+	.loc 1 608 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 609 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 611 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 611 8
+	test	rax, rax
+	jne	.L151
+	.loc 1 613 16
+	mov	eax, 0
+	jmp	.L152
+.L151:
+	.loc 1 616 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	asyncFile_Flush
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 617 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 216[rax]
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 618 9
+	mov	DWORD PTR -12[rbp], 1
+	.loc 1 620 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 620 8
+	cmp	eax, 2
+	jne	.L153
+	.loc 1 624 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	asyncFile_RingDrain
+	.loc 1 624 12
+	test	eax, eax
+	je	.L154
+	.loc 1 626 13
+	lea	rax, .LC9[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 627 21
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 628 20
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 629 42
+	cmp	DWORD PTR -8[rbp], 0
+	je	.L155
+	.loc 1 629 42 is_stmt 0 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	jmp	.L156
+.L155:
+	.loc 1 629 42 discriminator 2
+	mov	eax, 5
+.L156:
+	.loc 1 629 19 is_stmt 1 discriminator 4
+	mov	DWORD PTR -8[rbp], eax
+.L154:
+	.loc 1 631 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 224
+	mov	rdi, rax
+	call	asyncFile_RingFree
+	jmp	.L157
+.L153:
+	.loc 1 635 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 636 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 496[rax], 1
+	.loc 1 637 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 392
+	mov	rdi, rax
+	call	pthread_cond_signal@PLT
+	.loc 1 638 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 639 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 344[rax]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_join@PLT
+	.loc 1 640 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 440
+	mov	rdi, rax
+	call	pthread_cond_destroy@PLT
+	.loc 1 641 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 392
+	mov	rdi, rax
+	call	pthread_cond_destroy@PLT
+	.loc 1 642 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 352
+	mov	rdi, rax
+	call	pthread_mutex_destroy@PLT
+.L157:
+	.loc 1 644 8
+	cmp	DWORD PTR -12[rbp], 0
+	je	.L158
+	.loc 1 646 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 646 42
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 646 27
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 646 9
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL3:
+.L158:
+	.loc 1 648 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 650 5
+	call	__errno_location@PLT
+	.loc 1 650 11
+	mov	edx, DWORD PTR -8[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 651 12
+	mov	eax, DWORD PTR -4[rbp]
+.L152:
+	.loc 1 652 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	asyncFile_Close, .-asyncFile_Close
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 10 "/usr/include/stdint.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.file 12 "/usr/include/asm-generic/int-ll64.h"
+	.file 13 "/usr/include/linux/io_uring.h"
+	.file 14 "include/lmsAllocator.h"
+	.file 15 "include/asyncFile.h"
+	.file 16 "/usr/include/pthread.h"
+	.file 17 "/usr/include/string.h"
+	.file 18 "/usr/include/unistd.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 20 "/usr/include/errno.h"
+	.file 21 "/usr/include/stdio.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1a48
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2c
+	.long	.LASF319
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.long	0x41
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xd
+	.long	0x5b
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xd
+	.long	0x6e
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x67
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x4d
+	.uleb128 0x2e
+	.byte	0x8
+	.uleb128 0x15
+	.long	0xb8
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x4d
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0xd
+	.long	0xcb
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x55
+	.byte	0x11
+	.long	0xac
+	.uleb128 0xd
+	.long	0xd7
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0xbf
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x3
+	.long	0x118
+	.uleb128 0x2
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0x6e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x12
+	.long	0x6e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.byte	0x19
+	.byte	0x9
+	.long	0x13a
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x28
+	.long	0x13a
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x5
+	.byte	0x20
+	.byte	0x5
+	.long	0xf4
+	.byte	0
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF23
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x21
+	.byte	0x3
+	.long	0x118
+	.uleb128 0x1b
+	.long	.LASF28
+	.byte	0x10
+	.byte	0x6
+	.byte	0x33
+	.byte	0x10
+	.long	0x175
+	.uleb128 0x2
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x35
+	.byte	0x23
+	.long	0x175
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x36
+	.byte	0x23
+	.long	0x175
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x14d
+	.uleb128 0x5
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x37
+	.byte	0x3
+	.long	0x14d
+	.uleb128 0x1b
+	.long	.LASF29
+	.byte	0x28
+	.byte	0x7
+	.byte	0x16
+	.byte	0x8
+	.long	0x1fc
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x7
+	.byte	0x18
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0x7
+	.byte	0x19
+	.byte	0x10
+	.long	0x6e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x7
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0x6e
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x20
+	.byte	0x7
+	.long	0x41
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x22
+	.byte	0x9
+	.long	0x81
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x7
+	.byte	0x23
+	.byte	0x9
+	.long	0x81
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x7
+	.byte	0x24
+	.byte	0x14
+	.long	0x17a
+	.byte	0x18
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF38
+	.byte	0x30
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x8
+	.long	0x265
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x60
+	.byte	0x19
+	.long	0x141
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x61
+	.byte	0x19
+	.long	0x141
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x62
+	.byte	0x10
+	.long	0x265
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x63
+	.byte	0x10
+	.long	0x265
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x64
+	.byte	0x10
+	.long	0x6e
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x65
+	.byte	0x10
+	.long	0x6e
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x66
+	.byte	0x10
+	.long	0x265
+	.byte	0x28
+	.byte	0
+	.uleb128 0xb
+	.long	0x6e
+	.long	0x275
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x8
+	.byte	0x20
+	.byte	0x9
+	.long	0x2a3
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x22
+	.byte	0x8
+	.long	0x2a3
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x23
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0xb
+	.long	0xcb
+	.long	0x2b3
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF49
+	.byte	0x8
+	.byte	0x24
+	.byte	0x3
+	.long	0x281
+	.uleb128 0xd
+	.long	0x2b3
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x8
+	.byte	0x29
+	.byte	0x9
+	.long	0x2e6
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x8
+	.long	0x2a3
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x2c
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF50
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x3
+	.long	0x2c4
+	.uleb128 0xd
+	.long	0x2e6
+	.uleb128 0x2f
+	.long	.LASF51
+	.byte	0x38
+	.byte	0x8
+	.byte	0x38
+	.byte	0x7
+	.long	0x31d
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x8
+	.long	0x31d
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x3b
+	.byte	0xc
+	.long	0x4d
+	.byte	0
+	.uleb128 0xb
+	.long	0xcb
+	.long	0x32d
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x37
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF51
+	.byte	0x8
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x2f7
+	.uleb128 0xd
+	.long	0x32d
+	.uleb128 0x11
+	.byte	0x28
+	.byte	0x8
+	.byte	0x43
+	.byte	0x9
+	.long	0x36c
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0x8
+	.byte	0x45
+	.byte	0x1c
+	.long	0x186
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x46
+	.byte	0x8
+	.long	0x36c
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x47
+	.byte	0xc
+	.long	0x4d
+	.byte	0
+	.uleb128 0xb
+	.long	0xcb
+	.long	0x37c
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x27
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x8
+	.byte	0x48
+	.byte	0x3
+	.long	0x33e
+	.uleb128 0x11
+	.byte	0x30
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x9
+	.long	0x3b6
+	.uleb128 0x4
+	.long	.LASF52
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x1fc
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x8
+	.long	0x3b6
+	.uleb128 0x4
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x54
+	.byte	0
+	.uleb128 0xb
+	.long	0xcb
+	.long	0x3c6
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x50
+	.byte	0x3
+	.long	0x388
+	.uleb128 0x7
+	.long	0x3d7
+	.uleb128 0x30
+	.uleb128 0x7
+	.long	0xd2
+	.uleb128 0x5
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x19
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x5
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x5
+	.long	.LASF57
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa0
+	.uleb128 0x5
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x1b
+	.long	.LASF59
+	.byte	0x10
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x8
+	.long	0x435
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x1c
+	.byte	0xb
+	.long	0xb8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF61
+	.byte	0xb
+	.byte	0x1d
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xc
+	.byte	0x15
+	.byte	0x17
+	.long	0x5b
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xc
+	.byte	0x18
+	.byte	0x18
+	.long	0x67
+	.uleb128 0x5
+	.long	.LASF64
+	.byte	0xc
+	.byte	0x1a
+	.byte	0x18
+	.long	0x41
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x5
+	.long	.LASF66
+	.byte	0xc
+	.byte	0x1f
+	.byte	0x2a
+	.long	0x13a
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x3
+	.long	0x495
+	.uleb128 0x2
+	.long	.LASF67
+	.byte	0xd
+	.byte	0x1f
+	.byte	0xa
+	.long	0x459
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF68
+	.byte	0xd
+	.byte	0x20
+	.byte	0xa
+	.long	0x459
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x2
+	.long	0x4bb
+	.uleb128 0x23
+	.string	"off"
+	.byte	0x1c
+	.byte	0x9
+	.long	0x465
+	.uleb128 0x4
+	.long	.LASF69
+	.byte	0xd
+	.byte	0x1d
+	.byte	0x9
+	.long	0x465
+	.uleb128 0x1e
+	.long	0x471
+	.byte	0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0xd
+	.byte	0x23
+	.byte	0x2
+	.long	0x4dd
+	.uleb128 0x4
+	.long	.LASF70
+	.byte	0xd
+	.byte	0x24
+	.byte	0x9
+	.long	0x465
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0xd
+	.byte	0x25
+	.byte	0x9
+	.long	0x465
+	.byte	0
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0xd
+	.byte	0x28
+	.byte	0x2
+	.long	0x5cb
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0xd
+	.byte	0x29
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0xd
+	.byte	0x2a
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0xd
+	.byte	0x2b
+	.byte	0xa
+	.long	0x441
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0xd
+	.byte	0x2c
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0xd
+	.byte	0x2d
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0xd
+	.byte	0x2e
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0xd
+	.byte	0x2f
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0xd
+	.byte	0x30
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0xd
+	.byte	0x31
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0xd
+	.byte	0x32
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0xd
+	.byte	0x33
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF83
+	.byte	0xd
+	.byte	0x34
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF84
+	.byte	0xd
+	.byte	0x35
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF85
+	.byte	0xd
+	.byte	0x36
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF86
+	.byte	0xd
+	.byte	0x37
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF87
+	.byte	0xd
+	.byte	0x38
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF88
+	.byte	0xd
+	.byte	0x39
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF89
+	.byte	0xd
+	.byte	0x3a
+	.byte	0xa
+	.long	0x459
+	.uleb128 0x4
+	.long	.LASF90
+	.byte	0xd
+	.byte	0x3b
+	.byte	0xa
+	.long	0x459
+	.byte	0
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0xd
+	.byte	0x3f
+	.byte	0x2
+	.long	0x5ed
+	.uleb128 0x4
+	.long	.LASF91
+	.byte	0xd
+	.byte	0x41
+	.byte	0x9
+	.long	0x441
+	.uleb128 0x4
+	.long	.LASF92
+	.byte	0xd
+	.byte	0x43
+	.byte	0x9
+	.long	0x441
+	.byte	0
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0xd
+	.byte	0x4a
+	.byte	0x3
+	.long	0x611
+	.uleb128 0x2
+	.long	.LASF93
+	.byte	0xd
+	.byte	0x4b
+	.byte	0xa
+	.long	0x441
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF94
+	.byte	0xd
+	.byte	0x4c
+	.byte	0xa
+	.long	0x611
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0x441
+	.long	0x621
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0xd
+	.byte	0x47
+	.byte	0x2
+	.long	0x648
+	.uleb128 0x4
+	.long	.LASF95
+	.byte	0xd
+	.byte	0x48
+	.byte	0x9
+	.long	0x44d
+	.uleb128 0x4
+	.long	.LASF96
+	.byte	0xd
+	.byte	0x49
+	.byte	0x9
+	.long	0x459
+	.uleb128 0x1e
+	.long	0x5ed
+	.byte	0
+	.uleb128 0x13
+	.byte	0x10
+	.byte	0xd
+	.byte	0x50
+	.byte	0x3
+	.long	0x66c
+	.uleb128 0x2
+	.long	.LASF97
+	.byte	0xd
+	.byte	0x51
+	.byte	0xa
+	.long	0x465
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF98
+	.byte	0xd
+	.byte	0x52
+	.byte	0xa
+	.long	0x66c
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0x465
+	.long	0x67c
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.byte	0x10
+	.byte	0xd
+	.byte	0x4f
+	.byte	0x2
+	.long	0x696
+	.uleb128 0x1e
+	.long	0x648
+	.uleb128 0x23
+	.string	"cmd"
+	.byte	0x58
+	.byte	0x8
+	.long	0x696
+	.byte	0
+	.uleb128 0xb
+	.long	0x435
+	.long	0x6a6
+	.uleb128 0x31
+	.long	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF99
+	.byte	0x40
+	.byte	0xd
+	.byte	0x16
+	.byte	0x8
+	.long	0x732
+	.uleb128 0x2
+	.long	.LASF100
+	.byte	0xd
+	.byte	0x17
+	.byte	0x7
+	.long	0x435
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF101
+	.byte	0xd
+	.byte	0x18
+	.byte	0x7
+	.long	0x435
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF102
+	.byte	0xd
+	.byte	0x19
+	.byte	0x8
+	.long	0x441
+	.byte	0x2
+	.uleb128 0x1c
+	.string	"fd"
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x8
+	.long	0x44d
+	.byte	0x4
+	.uleb128 0x16
+	.long	0x495
+	.byte	0x8
+	.uleb128 0x16
+	.long	0x4bb
+	.byte	0x10
+	.uleb128 0x1c
+	.string	"len"
+	.byte	0xd
+	.byte	0x27
+	.byte	0x8
+	.long	0x459
+	.byte	0x18
+	.uleb128 0x16
+	.long	0x4dd
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF103
+	.byte	0xd
+	.byte	0x3d
+	.byte	0x8
+	.long	0x465
+	.byte	0x20
+	.uleb128 0x16
+	.long	0x5cb
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF104
+	.byte	0xd
+	.byte	0x46
+	.byte	0x8
+	.long	0x441
+	.byte	0x2a
+	.uleb128 0x16
+	.long	0x621
+	.byte	0x2c
+	.uleb128 0x16
+	.long	0x67c
+	.byte	0x30
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF320
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0xd
+	.byte	0xa8
+	.byte	0x6
+	.long	0x871
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF124
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x31
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF155
+	.byte	0x10
+	.value	0x15a
+	.long	0x8b3
+	.uleb128 0x6
+	.long	.LASF103
+	.value	0x15b
+	.byte	0x8
+	.long	0x465
+	.byte	0
+	.uleb128 0x33
+	.string	"res"
+	.byte	0xd
+	.value	0x15c
+	.byte	0x8
+	.long	0x44d
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF101
+	.value	0x15d
+	.byte	0x8
+	.long	0x459
+	.byte	0xc
+	.uleb128 0x6
+	.long	.LASF156
+	.value	0x163
+	.byte	0x8
+	.long	0x8b8
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0x871
+	.uleb128 0xb
+	.long	0x465
+	.long	0x8c7
+	.uleb128 0x34
+	.long	0x3a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF157
+	.byte	0x28
+	.value	0x183
+	.long	0x949
+	.uleb128 0x6
+	.long	.LASF158
+	.value	0x184
+	.byte	0x8
+	.long	0x459
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF159
+	.value	0x185
+	.byte	0x8
+	.long	0x459
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF160
+	.value	0x186
+	.byte	0x8
+	.long	0x459
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF161
+	.value	0x187
+	.byte	0x8
+	.long	0x459
+	.byte	0xc
+	.uleb128 0x6
+	.long	.LASF101
+	.value	0x188
+	.byte	0x8
+	.long	0x459
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF162
+	.value	0x189
+	.byte	0x8
+	.long	0x459
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF163
+	.value	0x18a
+	.byte	0x8
+	.long	0x459
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF164
+	.value	0x18b
+	.byte	0x8
+	.long	0x459
+	.byte	0x1c
+	.uleb128 0x6
+	.long	.LASF165
+	.value	0x18c
+	.byte	0x8
+	.long	0x465
+	.byte	0x20
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF166
+	.byte	0x28
+	.value	0x196
+	.long	0x9cb
+	.uleb128 0x6
+	.long	.LASF158
+	.value	0x197
+	.byte	0x8
+	.long	0x459
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF159
+	.value	0x198
+	.byte	0x8
+	.long	0x459
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF160
+	.value	0x199
+	.byte	0x8
+	.long	0x459
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF161
+	.value	0x19a
+	.byte	0x8
+	.long	0x459
+	.byte	0xc
+	.uleb128 0x6
+	.long	.LASF167
+	.value	0x19b
+	.byte	0x8
+	.long	0x459
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF168
+	.value	0x19c
+	.byte	0x8
+	.long	0x459
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF101
+	.value	0x19d
+	.byte	0x8
+	.long	0x459
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF164
+	.value	0x19e
+	.byte	0x8
+	.long	0x459
+	.byte	0x1c
+	.uleb128 0x6
+	.long	.LASF165
+	.value	0x19f
+	.byte	0x8
+	.long	0x465
+	.byte	0x20
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF169
+	.byte	0x78
+	.value	0x1b5
+	.long	0xa5a
+	.uleb128 0x6
+	.long	.LASF170
+	.value	0x1b6
+	.byte	0x8
+	.long	0x459
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF171
+	.value	0x1b7
+	.byte	0x8
+	.long	0x459
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF101
+	.value	0x1b8
+	.byte	0x8
+	.long	0x459
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF172
+	.value	0x1b9
+	.byte	0x8
+	.long	0x459
+	.byte	0xc
+	.uleb128 0x6
+	.long	.LASF173
+	.value	0x1ba
+	.byte	0x8
+	.long	0x459
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF174
+	.value	0x1bb
+	.byte	0x8
+	.long	0x459
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF175
+	.value	0x1bc
+	.byte	0x8
+	.long	0x459
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF176
+	.value	0x1bd
+	.byte	0x8
+	.long	0xa5a
+	.byte	0x1c
+	.uleb128 0x6
+	.long	.LASF177
+	.value	0x1be
+	.byte	0x1b
+	.long	0x8c7
+	.byte	0x28
+	.uleb128 0x6
+	.long	.LASF178
+	.value	0x1bf
+	.byte	0x1b
+	.long	0x949
+	.byte	0x50
+	.byte	0
+	.uleb128 0xb
+	.long	0x459
+	.long	0xa6a
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x35
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0xd
+	.value	0x1d6
+	.byte	0x6
+	.long	0xb1c
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x10
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF206
+	.uleb128 0x13
+	.byte	0x18
+	.byte	0xe
+	.byte	0x10
+	.byte	0x9
+	.long	0xb54
+	.uleb128 0x2
+	.long	.LASF207
+	.byte	0xe
+	.byte	0x13
+	.byte	0xd
+	.long	0xb6d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF208
+	.byte	0xe
+	.byte	0x16
+	.byte	0xc
+	.long	0xb82
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF209
+	.byte	0xe
+	.byte	0x18
+	.byte	0xb
+	.long	0xb8
+	.byte	0x10
+	.byte	0
+	.uleb128 0x24
+	.long	0xb8
+	.long	0xb6d
+	.uleb128 0x3
+	.long	0xb8
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0xb54
+	.uleb128 0x36
+	.long	0xb82
+	.uleb128 0x3
+	.long	0xb8
+	.uleb128 0x3
+	.long	0xb8
+	.byte	0
+	.uleb128 0x7
+	.long	0xb72
+	.uleb128 0x5
+	.long	.LASF210
+	.byte	0xe
+	.byte	0x19
+	.byte	0x3
+	.long	0xb23
+	.uleb128 0xd
+	.long	0xb87
+	.uleb128 0x7
+	.long	0x5b
+	.uleb128 0x1f
+	.long	0x6e
+	.byte	0x15
+	.long	0xbc6
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF213
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF215
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF216
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x3
+	.long	0xb9d
+	.uleb128 0x1f
+	.long	0x6e
+	.byte	0x1e
+	.long	0xbe9
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF218
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF219
+	.byte	0xf
+	.byte	0x21
+	.byte	0x3
+	.long	0xbd2
+	.uleb128 0x1f
+	.long	0x6e
+	.byte	0x24
+	.long	0xc12
+	.uleb128 0x1
+	.long	.LASF220
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF221
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF222
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF223
+	.byte	0xf
+	.byte	0x28
+	.byte	0x3
+	.long	0xbf5
+	.uleb128 0x13
+	.byte	0x28
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x9
+	.long	0xc69
+	.uleb128 0x2
+	.long	.LASF224
+	.byte	0xf
+	.byte	0x2c
+	.byte	0x14
+	.long	0xb98
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF225
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xb
+	.long	0xd7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF226
+	.byte	0xf
+	.byte	0x2e
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF227
+	.byte	0xf
+	.byte	0x2f
+	.byte	0xd
+	.long	0xe8
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF228
+	.byte	0xf
+	.byte	0x30
+	.byte	0x1c
+	.long	0xc12
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0xf
+	.byte	0x31
+	.byte	0x3
+	.long	0xc1e
+	.uleb128 0x13
+	.byte	0x78
+	.byte	0xf
+	.byte	0x34
+	.byte	0x9
+	.long	0xd41
+	.uleb128 0x1c
+	.string	"fd"
+	.byte	0xf
+	.byte	0x36
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF230
+	.byte	0xf
+	.byte	0x37
+	.byte	0xb
+	.long	0xb8
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF231
+	.byte	0xf
+	.byte	0x38
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF232
+	.byte	0xf
+	.byte	0x39
+	.byte	0xb
+	.long	0xb8
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF233
+	.byte	0xf
+	.byte	0x3a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF234
+	.byte	0xf
+	.byte	0x3b
+	.byte	0xb
+	.long	0xb8
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF235
+	.byte	0xf
+	.byte	0x3c
+	.byte	0xc
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF236
+	.byte	0xf
+	.byte	0x3d
+	.byte	0x13
+	.long	0xd41
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF237
+	.byte	0xf
+	.byte	0x3e
+	.byte	0x13
+	.long	0xd41
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF238
+	.byte	0xf
+	.byte	0x3f
+	.byte	0x13
+	.long	0xd41
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF239
+	.byte	0xf
+	.byte	0x40
+	.byte	0x13
+	.long	0xd41
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF240
+	.byte	0xf
+	.byte	0x41
+	.byte	0x13
+	.long	0xd41
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF241
+	.byte	0xf
+	.byte	0x42
+	.byte	0x13
+	.long	0xd41
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF168
+	.byte	0xf
+	.byte	0x43
+	.byte	0xb
+	.long	0xb8
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF242
+	.byte	0xf
+	.byte	0x44
+	.byte	0x9
+	.long	0x41
+	.byte	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	0x6e
+	.uleb128 0x5
+	.long	.LASF243
+	.byte	0xf
+	.byte	0x45
+	.byte	0x3
+	.long	0xc75
+	.uleb128 0x37
+	.value	0x1f8
+	.byte	0xf
+	.byte	0x49
+	.byte	0x9
+	.long	0xe39
+	.uleb128 0x1c
+	.string	"fd"
+	.byte	0xf
+	.byte	0x4b
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF244
+	.byte	0xf
+	.byte	0x4c
+	.byte	0x15
+	.long	0xbe9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF245
+	.byte	0xf
+	.byte	0x4d
+	.byte	0x18
+	.long	0xbc6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF246
+	.byte	0xf
+	.byte	0x4e
+	.byte	0x14
+	.long	0xb98
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF247
+	.byte	0xf
+	.byte	0x4f
+	.byte	0x17
+	.long	0xe39
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF248
+	.byte	0xf
+	.byte	0x50
+	.byte	0x13
+	.long	0x3a
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF249
+	.byte	0xf
+	.byte	0x51
+	.byte	0x13
+	.long	0x3a
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF225
+	.byte	0xf
+	.byte	0x52
+	.byte	0xb
+	.long	0xd7
+	.byte	0xc8
+	.uleb128 0x1c
+	.string	"end"
+	.byte	0xf
+	.byte	0x53
+	.byte	0xb
+	.long	0xd7
+	.byte	0xd0
+	.uleb128 0x2
+	.long	.LASF250
+	.byte	0xf
+	.byte	0x54
+	.byte	0x9
+	.long	0x41
+	.byte	0xd8
+	.uleb128 0x2
+	.long	.LASF251
+	.byte	0xf
+	.byte	0x55
+	.byte	0x15
+	.long	0xd46
+	.byte	0xe0
+	.uleb128 0x17
+	.long	.LASF252
+	.byte	0x56
+	.byte	0xf
+	.long	0x275
+	.value	0x158
+	.uleb128 0x17
+	.long	.LASF253
+	.byte	0x57
+	.byte	0x15
+	.long	0x37c
+	.value	0x160
+	.uleb128 0x17
+	.long	.LASF254
+	.byte	0x58
+	.byte	0x14
+	.long	0x3c6
+	.value	0x188
+	.uleb128 0x17
+	.long	.LASF255
+	.byte	0x59
+	.byte	0x14
+	.long	0x3c6
+	.value	0x1b8
+	.uleb128 0x17
+	.long	.LASF256
+	.byte	0x5a
+	.byte	0x13
+	.long	0x3a
+	.value	0x1e8
+	.uleb128 0x17
+	.long	.LASF257
+	.byte	0x5b
+	.byte	0x9
+	.long	0x41
+	.value	0x1f0
+	.byte	0
+	.uleb128 0xb
+	.long	0xc69
+	.long	0xe49
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF258
+	.byte	0xf
+	.byte	0x5c
+	.byte	0x3
+	.long	0xd52
+	.uleb128 0x13
+	.byte	0x10
+	.byte	0x1
+	.byte	0x1e
+	.byte	0xe
+	.long	0xe79
+	.uleb128 0x2
+	.long	.LASF259
+	.byte	0x1
+	.byte	0x20
+	.byte	0x11
+	.long	0x3d8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF245
+	.byte	0x1
+	.byte	0x21
+	.byte	0x18
+	.long	0xbc6
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	0xe55
+	.uleb128 0xb
+	.long	0xe79
+	.long	0xe8e
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.long	0xe7e
+	.uleb128 0x9
+	.long	.LASF281
+	.byte	0x22
+	.byte	0x3
+	.long	0xe8e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	asyncFileBackendNames
+	.uleb128 0x18
+	.long	.LASF260
+	.byte	0x10
+	.byte	0xdb
+	.byte	0xc
+	.long	0x41
+	.long	0xec3
+	.uleb128 0x3
+	.long	0x275
+	.uleb128 0x3
+	.long	0xec3
+	.byte	0
+	.uleb128 0x7
+	.long	0xb8
+	.uleb128 0xc
+	.long	.LASF261
+	.byte	0x10
+	.value	0x312
+	.byte	0xc
+	.long	0x41
+	.long	0xedf
+	.uleb128 0x3
+	.long	0xedf
+	.byte	0
+	.uleb128 0x7
+	.long	0x37c
+	.uleb128 0x15
+	.long	0xedf
+	.uleb128 0xc
+	.long	.LASF262
+	.byte	0x10
+	.value	0x45d
+	.byte	0xc
+	.long	0x41
+	.long	0xf00
+	.uleb128 0x3
+	.long	0xf00
+	.byte	0
+	.uleb128 0x7
+	.long	0x3c6
+	.uleb128 0x15
+	.long	0xf00
+	.uleb128 0x18
+	.long	.LASF263
+	.byte	0x10
+	.byte	0xca
+	.byte	0xc
+	.long	0x41
+	.long	0xf2f
+	.uleb128 0x3
+	.long	0xf34
+	.uleb128 0x3
+	.long	0xf3e
+	.uleb128 0x3
+	.long	0xf43
+	.uleb128 0x3
+	.long	0xba
+	.byte	0
+	.uleb128 0x7
+	.long	0x275
+	.uleb128 0x15
+	.long	0xf2f
+	.uleb128 0x7
+	.long	0x339
+	.uleb128 0x15
+	.long	0xf39
+	.uleb128 0x7
+	.long	0xf48
+	.uleb128 0x24
+	.long	0xb8
+	.long	0xf57
+	.uleb128 0x3
+	.long	0xb8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF264
+	.byte	0x10
+	.value	0x458
+	.byte	0xc
+	.long	0x41
+	.long	0xf73
+	.uleb128 0x3
+	.long	0xf05
+	.uleb128 0x3
+	.long	0xf78
+	.byte	0
+	.uleb128 0x7
+	.long	0x2f2
+	.uleb128 0x15
+	.long	0xf73
+	.uleb128 0xc
+	.long	.LASF265
+	.byte	0x10
+	.value	0x30d
+	.byte	0xc
+	.long	0x41
+	.long	0xf99
+	.uleb128 0x3
+	.long	0xedf
+	.uleb128 0x3
+	.long	0xf99
+	.byte	0
+	.uleb128 0x7
+	.long	0x2bf
+	.uleb128 0x38
+	.long	.LASF321
+	.byte	0x15
+	.value	0x324
+	.byte	0xd
+	.long	0xfb1
+	.uleb128 0x3
+	.long	0x3d8
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF277
+	.byte	0xe
+	.byte	0x27
+	.byte	0x17
+	.long	0xfbd
+	.uleb128 0x7
+	.long	0xb93
+	.uleb128 0x18
+	.long	.LASF266
+	.byte	0x11
+	.byte	0x9c
+	.byte	0xc
+	.long	0x41
+	.long	0xfdd
+	.uleb128 0x3
+	.long	0x3d8
+	.uleb128 0x3
+	.long	0x3d8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF267
+	.byte	0x10
+	.value	0x461
+	.byte	0xc
+	.long	0x41
+	.long	0xff4
+	.uleb128 0x3
+	.long	0xf00
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF268
+	.byte	0x10
+	.value	0x465
+	.byte	0xc
+	.long	0x41
+	.long	0x100b
+	.uleb128 0x3
+	.long	0xf00
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF269
+	.byte	0x10
+	.value	0x343
+	.byte	0xc
+	.long	0x41
+	.long	0x1022
+	.uleb128 0x3
+	.long	0xedf
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF270
+	.byte	0x10
+	.value	0x46d
+	.byte	0xc
+	.long	0x41
+	.long	0x103e
+	.uleb128 0x3
+	.long	0xf05
+	.uleb128 0x3
+	.long	0xee4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF271
+	.byte	0x10
+	.value	0x31a
+	.byte	0xc
+	.long	0x41
+	.long	0x1055
+	.uleb128 0x3
+	.long	0xedf
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF272
+	.byte	0x12
+	.value	0x443
+	.byte	0x11
+	.long	0x4d
+	.long	0x106d
+	.uleb128 0x3
+	.long	0x4d
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF273
+	.byte	0x13
+	.byte	0x39
+	.byte	0xe
+	.long	0xb8
+	.long	0x109c
+	.uleb128 0x3
+	.long	0xb8
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0xac
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF274
+	.byte	0x11
+	.byte	0x3d
+	.byte	0xe
+	.long	0xb8
+	.long	0x10bc
+	.uleb128 0x3
+	.long	0xb8
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF275
+	.byte	0x12
+	.value	0x166
+	.byte	0xc
+	.long	0x41
+	.long	0x10d3
+	.uleb128 0x3
+	.long	0x41
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF276
+	.byte	0x13
+	.byte	0x4c
+	.byte	0xc
+	.long	0x41
+	.long	0x10ee
+	.uleb128 0x3
+	.long	0xb8
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF278
+	.byte	0x14
+	.byte	0x25
+	.byte	0xd
+	.long	0x10fa
+	.uleb128 0x7
+	.long	0x41
+	.uleb128 0xc
+	.long	.LASF279
+	.byte	0x12
+	.value	0x18e
+	.byte	0x10
+	.long	0xe8
+	.long	0x1125
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x3d2
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0xac
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF280
+	.byte	0x12
+	.value	0x185
+	.byte	0x10
+	.long	0xe8
+	.long	0x114b
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0xb8
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0xac
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF285
+	.value	0x25f
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11b9
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x25f
+	.byte	0x22
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xa
+	.long	.LASF282
+	.value	0x261
+	.byte	0x1b
+	.long	0xfbd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xa
+	.long	.LASF283
+	.value	0x268
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xa
+	.long	.LASF250
+	.value	0x269
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	.LASF284
+	.value	0x26a
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x7
+	.long	0xe49
+	.uleb128 0x19
+	.long	.LASF286
+	.value	0x246
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x120f
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x246
+	.byte	0x22
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xe
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.uleb128 0x1a
+	.string	"n"
+	.value	0x252
+	.byte	0x1c
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF289
+	.value	0x23e
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x124b
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x23e
+	.byte	0x29
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.long	.LASF226
+	.value	0x23e
+	.byte	0x36
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF288
+	.value	0x22f
+	.byte	0x10
+	.long	0xb98
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x127d
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x22f
+	.byte	0x34
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF290
+	.value	0x223
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12cb
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x223
+	.byte	0x29
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xe
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0xa
+	.long	.LASF291
+	.value	0x22a
+	.byte	0x15
+	.long	0xe3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF292
+	.value	0x20b
+	.byte	0x9
+	.long	0xe8
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x132a
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x20b
+	.byte	0x2c
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF224
+	.value	0x20b
+	.byte	0x48
+	.long	0x132a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xa
+	.long	.LASF293
+	.value	0x212
+	.byte	0x18
+	.long	0x1334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	.LASF227
+	.value	0x213
+	.byte	0xd
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x7
+	.long	0x132f
+	.uleb128 0x7
+	.long	0x62
+	.uleb128 0x7
+	.long	0xc69
+	.uleb128 0x19
+	.long	.LASF294
+	.value	0x1ce
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1407
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x1ce
+	.byte	0x21
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x27
+	.string	"fd"
+	.byte	0x2b
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x8
+	.long	.LASF244
+	.value	0x1ce
+	.byte	0x3f
+	.long	0xbe9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.long	.LASF245
+	.value	0x1ce
+	.byte	0x58
+	.long	0xbc6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x8
+	.long	.LASF225
+	.value	0x1ce
+	.byte	0x67
+	.long	0xd7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x27
+	.string	"end"
+	.byte	0x75
+	.long	0xd7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0xa
+	.long	.LASF282
+	.value	0x1d0
+	.byte	0x1b
+	.long	0xfbd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x20
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.long	0x13e5
+	.uleb128 0x1a
+	.string	"i"
+	.value	0x1e0
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.uleb128 0xa
+	.long	.LASF291
+	.value	0x205
+	.byte	0x15
+	.long	0xe3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF295
+	.byte	0x1
+	.value	0x1c2
+	.byte	0xd
+	.long	0x3d8
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1459
+	.uleb128 0x8
+	.long	.LASF245
+	.value	0x1c2
+	.byte	0x36
+	.long	0xbc6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xe
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x1a
+	.string	"i"
+	.value	0x1c4
+	.byte	0x17
+	.long	0x6e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF296
+	.value	0x1b5
+	.byte	0x14
+	.long	0xbc6
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14aa
+	.uleb128 0x8
+	.long	.LASF245
+	.value	0x1b5
+	.byte	0x41
+	.long	0x3d8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xe
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.uleb128 0x1a
+	.string	"i"
+	.value	0x1b7
+	.byte	0x17
+	.long	0x6e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF297
+	.value	0x1a6
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14fa
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x1a6
+	.byte	0x2d
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xa
+	.long	.LASF293
+	.value	0x1a8
+	.byte	0x18
+	.long	0x1334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	.LASF227
+	.value	0x1a9
+	.byte	0xd
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF300
+	.value	0x194
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1536
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x194
+	.byte	0x2f
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.long	.LASF293
+	.value	0x194
+	.byte	0x48
+	.long	0x1334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF298
+	.value	0x16f
+	.byte	0x10
+	.long	0xe8
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1598
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x16f
+	.byte	0x2c
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF293
+	.value	0x16f
+	.byte	0x45
+	.long	0x1334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xe
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0xa
+	.long	.LASF299
+	.value	0x180
+	.byte	0x15
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF301
+	.value	0x151
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15f2
+	.uleb128 0x8
+	.long	.LASF287
+	.value	0x151
+	.byte	0x2b
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF226
+	.value	0x151
+	.byte	0x38
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xa
+	.long	.LASF302
+	.value	0x153
+	.byte	0xf
+	.long	0x48
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xa
+	.long	.LASF293
+	.value	0x154
+	.byte	0x18
+	.long	0x1334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF303
+	.value	0x12f
+	.byte	0xe
+	.long	0xb8
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1657
+	.uleb128 0x8
+	.long	.LASF304
+	.value	0x12f
+	.byte	0x25
+	.long	0xb8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xa
+	.long	.LASF287
+	.value	0x131
+	.byte	0x12
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x29
+	.long	.LLRL1
+	.uleb128 0xa
+	.long	.LASF293
+	.value	0x136
+	.byte	0x1c
+	.long	0x1334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xa
+	.long	.LASF227
+	.value	0x141
+	.byte	0x11
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF305
+	.byte	0xf4
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1744
+	.uleb128 0xf
+	.long	.LASF287
+	.byte	0xf4
+	.byte	0x2d
+	.long	0x11b9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x9
+	.long	.LASF251
+	.byte	0xf6
+	.byte	0x16
+	.long	0x1744
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x9
+	.long	.LASF306
+	.byte	0xf7
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xe
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x9
+	.long	.LASF307
+	.byte	0xfb
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	.LASF159
+	.value	0x110
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x20
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.long	0x16f3
+	.uleb128 0x14
+	.string	"i"
+	.byte	0xfe
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x1a
+	.string	"i"
+	.value	0x111
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xe
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0xa
+	.long	.LASF308
+	.value	0x115
+	.byte	0x24
+	.long	0x75
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x1a
+	.string	"sqe"
+	.value	0x116
+	.byte	0x26
+	.long	0x1749
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0xd46
+	.uleb128 0x7
+	.long	0x6a6
+	.uleb128 0x3b
+	.long	.LASF309
+	.byte	0x1
+	.byte	0xdb
+	.byte	0xd
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17f4
+	.uleb128 0xf
+	.long	.LASF287
+	.byte	0xdb
+	.byte	0x2d
+	.long	0x11b9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x9
+	.long	.LASF251
+	.byte	0xdd
+	.byte	0x16
+	.long	0x1744
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x9
+	.long	.LASF168
+	.byte	0xde
+	.byte	0x20
+	.long	0x17f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x9
+	.long	.LASF158
+	.byte	0xdf
+	.byte	0x12
+	.long	0x6e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x9
+	.long	.LASF159
+	.byte	0xe0
+	.byte	0x18
+	.long	0x75
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0xe
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x14
+	.string	"cqe"
+	.byte	0xe4
+	.byte	0x24
+	.long	0x17f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xe
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x9
+	.long	.LASF293
+	.byte	0xe7
+	.byte	0x20
+	.long	0x1334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x8b3
+	.uleb128 0x2a
+	.long	.LASF310
+	.byte	0xb1
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1878
+	.uleb128 0xf
+	.long	.LASF287
+	.byte	0xb1
+	.byte	0x2f
+	.long	0x11b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xf
+	.long	.LASF302
+	.byte	0xb1
+	.byte	0x39
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x9
+	.long	.LASF251
+	.byte	0xb3
+	.byte	0x16
+	.long	0x1744
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x9
+	.long	.LASF293
+	.byte	0xb4
+	.byte	0x18
+	.long	0x1334
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x9
+	.long	.LASF159
+	.byte	0xb5
+	.byte	0x18
+	.long	0x75
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x9
+	.long	.LASF308
+	.byte	0xb6
+	.byte	0x18
+	.long	0x75
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x14
+	.string	"sqe"
+	.byte	0xb7
+	.byte	0x1a
+	.long	0x1749
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF311
+	.byte	0x6f
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1931
+	.uleb128 0xf
+	.long	.LASF287
+	.byte	0x6f
+	.byte	0x2d
+	.long	0x11b9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.uleb128 0x9
+	.long	.LASF251
+	.byte	0x71
+	.byte	0x16
+	.long	0x1744
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x9
+	.long	.LASF312
+	.byte	0x72
+	.byte	0x1c
+	.long	0x9cb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x9
+	.long	.LASF313
+	.byte	0x73
+	.byte	0x12
+	.long	0x1931
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x14
+	.string	"sq"
+	.byte	0x9a
+	.byte	0x14
+	.long	0xb98
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x14
+	.string	"cq"
+	.byte	0x9b
+	.byte	0x14
+	.long	0xb98
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x20
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.long	0x1912
+	.uleb128 0x9
+	.long	.LASF250
+	.byte	0x94
+	.byte	0xd
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x14
+	.string	"i"
+	.byte	0xa4
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x40d
+	.long	0x1941
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF314
+	.byte	0x64
+	.byte	0xe
+	.long	0xb8
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x199a
+	.uleb128 0x2b
+	.string	"fd"
+	.byte	0x64
+	.byte	0x24
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xf
+	.long	.LASF226
+	.byte	0x64
+	.byte	0x2f
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.long	.LASF315
+	.byte	0x64
+	.byte	0x3b
+	.long	0xd7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.long	.LASF316
+	.byte	0x66
+	.byte	0xb
+	.long	0xb8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF317
+	.byte	0x4a
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19c5
+	.uleb128 0xf
+	.long	.LASF251
+	.byte	0x4a
+	.byte	0x31
+	.long	0x1744
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF318
+	.byte	0x1
+	.byte	0x2e
+	.byte	0x10
+	.long	0xe8
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2b
+	.string	"fd"
+	.byte	0x2e
+	.byte	0x27
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xf
+	.long	.LASF244
+	.byte	0x2e
+	.byte	0x3b
+	.long	0xbe9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.long	.LASF224
+	.byte	0x2e
+	.byte	0x50
+	.long	0xb98
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xf
+	.long	.LASF226
+	.byte	0x2e
+	.byte	0x5d
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xf
+	.long	.LASF225
+	.byte	0x2e
+	.byte	0x69
+	.long	0xd7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x9
+	.long	.LASF255
+	.byte	0x30
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x29
+	.long	.LLRL0
+	.uleb128 0x14
+	.string	"got"
+	.byte	0x34
+	.byte	0x11
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 462
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB2-.Ltext0
+	.uleb128 .LBE2-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB12-.Ltext0
+	.uleb128 .LBE12-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB13-.Ltext0
+	.uleb128 .LBE13-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF186:
+	.string	"IORING_REGISTER_EVENTFD_ASYNC"
+.LASF22:
+	.string	"__value32"
+.LASF10:
+	.string	"size_t"
+.LASF34:
+	.string	"__kind"
+.LASF54:
+	.string	"pthread_cond_t"
+.LASF159:
+	.string	"tail"
+.LASF108:
+	.string	"IORING_OP_FSYNC"
+.LASF229:
+	.string	"AsyncFileBuffer_t"
+.LASF15:
+	.string	"__ssize_t"
+.LASF144:
+	.string	"IORING_OP_LINKAT"
+.LASF27:
+	.string	"__pthread_list_t"
+.LASF71:
+	.string	"splice_off_in"
+.LASF63:
+	.string	"__u16"
+.LASF192:
+	.string	"IORING_REGISTER_FILES2"
+.LASF155:
+	.string	"io_uring_cqe"
+.LASF62:
+	.string	"__u8"
+.LASF269:
+	.string	"pthread_mutex_unlock"
+.LASF313:
+	.string	"iovecs"
+.LASF26:
+	.string	"__next"
+.LASF82:
+	.string	"statx_flags"
+.LASF52:
+	.string	"__data"
+.LASF89:
+	.string	"msg_ring_flags"
+.LASF25:
+	.string	"__prev"
+.LASF147:
+	.string	"IORING_OP_SETXATTR"
+.LASF194:
+	.string	"IORING_REGISTER_BUFFERS2"
+.LASF140:
+	.string	"IORING_OP_RENAMEAT"
+.LASF175:
+	.string	"wq_fd"
+.LASF284:
+	.string	"drained"
+.LASF28:
+	.string	"__pthread_internal_list"
+.LASF263:
+	.string	"pthread_create"
+.LASF130:
+	.string	"IORING_OP_MADVISE"
+.LASF286:
+	.string	"asyncFile_Flush"
+.LASF236:
+	.string	"sqTail"
+.LASF143:
+	.string	"IORING_OP_SYMLINKAT"
+.LASF32:
+	.string	"__owner"
+.LASF239:
+	.string	"cqHead"
+.LASF106:
+	.string	"IORING_OP_READV"
+.LASF124:
+	.string	"IORING_OP_CLOSE"
+.LASF166:
+	.string	"io_cqring_offsets"
+.LASF21:
+	.string	"__value64"
+.LASF266:
+	.string	"strcmp"
+.LASF18:
+	.string	"ssize_t"
+.LASF65:
+	.string	"__u32"
+.LASF279:
+	.string	"pwrite"
+.LASF67:
+	.string	"cmd_op"
+.LASF197:
+	.string	"IORING_UNREGISTER_IOWQ_AFF"
+.LASF107:
+	.string	"IORING_OP_WRITEV"
+.LASF314:
+	.string	"asyncFile_RingMap"
+.LASF227:
+	.string	"result"
+.LASF198:
+	.string	"IORING_REGISTER_IOWQ_MAX_WORKERS"
+.LASF131:
+	.string	"IORING_OP_SEND"
+.LASF84:
+	.string	"splice_flags"
+.LASF80:
+	.string	"cancel_flags"
+.LASF3:
+	.string	"long int"
+.LASF272:
+	.string	"syscall"
+.LASF299:
+	.string	"rest"
+.LASF176:
+	.string	"resv"
+.LASF77:
+	.string	"msg_flags"
+.LASF211:
+	.string	"ASYNC_FILE_BACKEND_UNKNOWN"
+.LASF123:
+	.string	"IORING_OP_OPENAT"
+.LASF189:
+	.string	"IORING_UNREGISTER_PERSONALITY"
+.LASF158:
+	.string	"head"
+.LASF112:
+	.string	"IORING_OP_POLL_REMOVE"
+.LASF154:
+	.string	"IORING_OP_LAST"
+.LASF33:
+	.string	"__nusers"
+.LASF282:
+	.string	"heap"
+.LASF231:
+	.string	"sqRingSize"
+.LASF142:
+	.string	"IORING_OP_MKDIRAT"
+.LASF8:
+	.string	"signed char"
+.LASF289:
+	.string	"asyncFile_CommitWrite"
+.LASF223:
+	.string	"AsyncFileBufferState_t"
+.LASF305:
+	.string	"asyncFile_RingDrain"
+.LASF66:
+	.string	"__u64"
+.LASF250:
+	.string	"error"
+.LASF209:
+	.string	"context"
+.LASF29:
+	.string	"__pthread_mutex_s"
+.LASF196:
+	.string	"IORING_REGISTER_IOWQ_AFF"
+.LASF213:
+	.string	"ASYNC_FILE_BACKEND_URING"
+.LASF76:
+	.string	"sync_range_flags"
+.LASF5:
+	.string	"unsigned char"
+.LASF35:
+	.string	"__spins"
+.LASF303:
+	.string	"asyncFile_Thread"
+.LASF125:
+	.string	"IORING_OP_FILES_UPDATE"
+.LASF93:
+	.string	"addr_len"
+.LASF133:
+	.string	"IORING_OP_OPENAT2"
+.LASF88:
+	.string	"xattr_flags"
+.LASF101:
+	.string	"flags"
+.LASF242:
+	.string	"registered"
+.LASF16:
+	.string	"char"
+.LASF50:
+	.string	"pthread_condattr_t"
+.LASF20:
+	.string	"__high"
+.LASF99:
+	.string	"io_uring_sqe"
+.LASF11:
+	.string	"__uint16_t"
+.LASF136:
+	.string	"IORING_OP_PROVIDE_BUFFERS"
+.LASF181:
+	.string	"IORING_REGISTER_FILES"
+.LASF278:
+	.string	"__errno_location"
+.LASF258:
+	.string	"AsyncFile_t"
+.LASF218:
+	.string	"ASYNC_FILE_WRITE"
+.LASF207:
+	.string	"allocate"
+.LASF19:
+	.string	"__low"
+.LASF249:
+	.string	"completed"
+.LASF81:
+	.string	"open_flags"
+.LASF265:
+	.string	"pthread_mutex_init"
+.LASF320:
+	.string	"io_uring_op"
+.LASF202:
+	.string	"IORING_UNREGISTER_PBUF_RING"
+.LASF296:
+	.string	"asyncFile_ProcessArgumentBackend"
+.LASF164:
+	.string	"resv1"
+.LASF165:
+	.string	"resv2"
+.LASF180:
+	.string	"IORING_UNREGISTER_BUFFERS"
+.LASF273:
+	.string	"mmap"
+.LASF174:
+	.string	"features"
+.LASF233:
+	.string	"cqRingSize"
+.LASF110:
+	.string	"IORING_OP_WRITE_FIXED"
+.LASF193:
+	.string	"IORING_REGISTER_FILES_UPDATE2"
+.LASF294:
+	.string	"asyncFile_Open"
+.LASF287:
+	.string	"file"
+.LASF163:
+	.string	"array"
+.LASF285:
+	.string	"asyncFile_Close"
+.LASF204:
+	.string	"IORING_REGISTER_FILE_ALLOC_RANGE"
+.LASF90:
+	.string	"uring_cmd_flags"
+.LASF79:
+	.string	"accept_flags"
+.LASF152:
+	.string	"IORING_OP_SEND_ZC"
+.LASF246:
+	.string	"memory"
+.LASF172:
+	.string	"sq_thread_cpu"
+.LASF91:
+	.string	"buf_index"
+.LASF177:
+	.string	"sq_off"
+.LASF30:
+	.string	"__lock"
+.LASF291:
+	.string	"left"
+.LASF215:
+	.string	"ASYNC_FILE_BACKEND_STDIO"
+.LASF232:
+	.string	"cqRing"
+.LASF280:
+	.string	"pread"
+.LASF302:
+	.string	"index"
+.LASF190:
+	.string	"IORING_REGISTER_RESTRICTIONS"
+.LASF238:
+	.string	"sqArray"
+.LASF222:
+	.string	"ASYNC_FILE_BUFFER_DONE"
+.LASF40:
+	.string	"__g1_start"
+.LASF13:
+	.string	"__uint64_t"
+.LASF115:
+	.string	"IORING_OP_RECVMSG"
+.LASF301:
+	.string	"asyncFile_Submit"
+.LASF2:
+	.string	"long unsigned int"
+.LASF241:
+	.string	"cqMask"
+.LASF111:
+	.string	"IORING_OP_POLL_ADD"
+.LASF214:
+	.string	"ASYNC_FILE_BACKEND_THREAD"
+.LASF46:
+	.string	"pthread_t"
+.LASF173:
+	.string	"sq_thread_idle"
+.LASF276:
+	.string	"munmap"
+.LASF182:
+	.string	"IORING_UNREGISTER_FILES"
+.LASF127:
+	.string	"IORING_OP_READ"
+.LASF119:
+	.string	"IORING_OP_ASYNC_CANCEL"
+.LASF264:
+	.string	"pthread_cond_init"
+.LASF212:
+	.string	"ASYNC_FILE_BACKEND_AUTO"
+.LASF92:
+	.string	"buf_group"
+.LASF310:
+	.string	"asyncFile_RingSubmit"
+.LASF58:
+	.string	"uintptr_t"
+.LASF47:
+	.string	"__size"
+.LASF255:
+	.string	"done"
+.LASF283:
+	.string	"retval"
+.LASF183:
+	.string	"IORING_REGISTER_EVENTFD"
+.LASF73:
+	.string	"fsync_flags"
+.LASF247:
+	.string	"buffers"
+.LASF170:
+	.string	"sq_entries"
+.LASF43:
+	.string	"__g1_orig_size"
+.LASF157:
+	.string	"io_sqring_offsets"
+.LASF298:
+	.string	"asyncFile_Wait"
+.LASF12:
+	.string	"__uint32_t"
+.LASF4:
+	.string	"long long int"
+.LASF132:
+	.string	"IORING_OP_RECV"
+.LASF148:
+	.string	"IORING_OP_FGETXATTR"
+.LASF167:
+	.string	"overflow"
+.LASF59:
+	.string	"iovec"
+.LASF85:
+	.string	"rename_flags"
+.LASF74:
+	.string	"poll_events"
+.LASF275:
+	.string	"close"
+.LASF72:
+	.string	"rw_flags"
+.LASF311:
+	.string	"asyncFile_RingSetup"
+.LASF51:
+	.string	"pthread_attr_t"
+.LASF168:
+	.string	"cqes"
+.LASF113:
+	.string	"IORING_OP_SYNC_FILE_RANGE"
+.LASF257:
+	.string	"stop"
+.LASF70:
+	.string	"addr"
+.LASF135:
+	.string	"IORING_OP_SPLICE"
+.LASF44:
+	.string	"__wrefs"
+.LASF139:
+	.string	"IORING_OP_SHUTDOWN"
+.LASF7:
+	.string	"unsigned int"
+.LASF321:
+	.string	"perror"
+.LASF151:
+	.string	"IORING_OP_URING_CMD"
+.LASF53:
+	.string	"pthread_mutex_t"
+.LASF292:
+	.string	"asyncFile_AcquireRead"
+.LASF68:
+	.string	"__pad1"
+.LASF98:
+	.string	"__pad2"
+.LASF94:
+	.string	"__pad3"
+.LASF121:
+	.string	"IORING_OP_CONNECT"
+.LASF195:
+	.string	"IORING_REGISTER_BUFFERS_UPDATE"
+.LASF316:
+	.string	"mapped"
+.LASF319:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF61:
+	.string	"iov_len"
+.LASF225:
+	.string	"offset"
+.LASF317:
+	.string	"asyncFile_RingFree"
+.LASF306:
+	.string	"cancelled"
+.LASF234:
+	.string	"sqes"
+.LASF31:
+	.string	"__count"
+.LASF240:
+	.string	"cqTail"
+.LASF17:
+	.string	"off_t"
+.LASF150:
+	.string	"IORING_OP_SOCKET"
+.LASF116:
+	.string	"IORING_OP_TIMEOUT"
+.LASF199:
+	.string	"IORING_REGISTER_RING_FDS"
+.LASF281:
+	.string	"asyncFileBackendNames"
+.LASF243:
+	.string	"AsyncFileRing_t"
+.LASF201:
+	.string	"IORING_REGISTER_PBUF_RING"
+.LASF206:
+	.string	"long double"
+.LASF156:
+	.string	"big_cqe"
+.LASF114:
+	.string	"IORING_OP_SENDMSG"
+.LASF205:
+	.string	"IORING_REGISTER_LAST"
+.LASF86:
+	.string	"unlink_flags"
+.LASF318:
+	.string	"asyncFile_Transfer"
+.LASF216:
+	.string	"AsyncFileBackend_t"
+.LASF141:
+	.string	"IORING_OP_UNLINKAT"
+.LASF87:
+	.string	"hardlink_flags"
+.LASF217:
+	.string	"ASYNC_FILE_READ"
+.LASF226:
+	.string	"size"
+.LASF171:
+	.string	"cq_entries"
+.LASF23:
+	.string	"long long unsigned int"
+.LASF312:
+	.string	"params"
+.LASF100:
+	.string	"opcode"
+.LASF37:
+	.string	"__list"
+.LASF55:
+	.string	"uint16_t"
+.LASF14:
+	.string	"__off_t"
+.LASF267:
+	.string	"pthread_cond_signal"
+.LASF42:
+	.string	"__g_size"
+.LASF262:
+	.string	"pthread_cond_destroy"
+.LASF122:
+	.string	"IORING_OP_FALLOCATE"
+.LASF64:
+	.string	"__s32"
+.LASF288:
+	.string	"asyncFile_AcquireWrite"
+.LASF24:
+	.string	"__atomic_wide_counter"
+.LASF120:
+	.string	"IORING_OP_LINK_TIMEOUT"
+.LASF220:
+	.string	"ASYNC_FILE_BUFFER_FREE"
+.LASF254:
+	.string	"queued"
+.LASF295:
+	.string	"asyncFile_BackendName"
+.LASF145:
+	.string	"IORING_OP_MSG_RING"
+.LASF129:
+	.string	"IORING_OP_FADVISE"
+.LASF274:
+	.string	"memset"
+.LASF41:
+	.string	"__g_refs"
+.LASF245:
+	.string	"backend"
+.LASF153:
+	.string	"IORING_OP_SENDMSG_ZC"
+.LASF95:
+	.string	"splice_fd_in"
+.LASF75:
+	.string	"poll32_events"
+.LASF290:
+	.string	"asyncFile_ReleaseRead"
+.LASF48:
+	.string	"__align"
+.LASF268:
+	.string	"pthread_cond_broadcast"
+.LASF169:
+	.string	"io_uring_params"
+.LASF96:
+	.string	"file_index"
+.LASF187:
+	.string	"IORING_REGISTER_PROBE"
+.LASF146:
+	.string	"IORING_OP_FSETXATTR"
+.LASF251:
+	.string	"ring"
+.LASF149:
+	.string	"IORING_OP_GETXATTR"
+.LASF277:
+	.string	"lmsAllocator_Heap"
+.LASF307:
+	.string	"numOfQueued"
+.LASF161:
+	.string	"ring_entries"
+.LASF252:
+	.string	"thread"
+.LASF83:
+	.string	"fadvise_advice"
+.LASF259:
+	.string	"name"
+.LASF235:
+	.string	"sqesSize"
+.LASF293:
+	.string	"buffer"
+.LASF39:
+	.string	"__wseq"
+.LASF138:
+	.string	"IORING_OP_TEE"
+.LASF191:
+	.string	"IORING_REGISTER_ENABLE_RINGS"
+.LASF160:
+	.string	"ring_mask"
+.LASF9:
+	.string	"short int"
+.LASF248:
+	.string	"submitted"
+.LASF57:
+	.string	"uint64_t"
+.LASF244:
+	.string	"mode"
+.LASF49:
+	.string	"pthread_mutexattr_t"
+.LASF271:
+	.string	"pthread_mutex_lock"
+.LASF36:
+	.string	"__elision"
+.LASF300:
+	.string	"asyncFile_FreeBuffer"
+.LASF134:
+	.string	"IORING_OP_EPOLL_CTL"
+.LASF38:
+	.string	"__pthread_cond_s"
+.LASF102:
+	.string	"ioprio"
+.LASF162:
+	.string	"dropped"
+.LASF219:
+	.string	"AsyncFileMode_t"
+.LASF104:
+	.string	"personality"
+.LASF45:
+	.string	"__g_signals"
+.LASF230:
+	.string	"sqRing"
+.LASF128:
+	.string	"IORING_OP_WRITE"
+.LASF200:
+	.string	"IORING_UNREGISTER_RING_FDS"
+.LASF210:
+	.string	"LmsAllocator_t"
+.LASF78:
+	.string	"timeout_flags"
+.LASF126:
+	.string	"IORING_OP_STATX"
+.LASF137:
+	.string	"IORING_OP_REMOVE_BUFFERS"
+.LASF270:
+	.string	"pthread_cond_wait"
+.LASF237:
+	.string	"sqMask"
+.LASF117:
+	.string	"IORING_OP_TIMEOUT_REMOVE"
+.LASF260:
+	.string	"pthread_join"
+.LASF179:
+	.string	"IORING_REGISTER_BUFFERS"
+.LASF178:
+	.string	"cq_off"
+.LASF56:
+	.string	"uint32_t"
+.LASF297:
+	.string	"asyncFile_ReapWrite"
+.LASF185:
+	.string	"IORING_REGISTER_FILES_UPDATE"
+.LASF221:
+	.string	"ASYNC_FILE_BUFFER_QUEUED"
+.LASF208:
+	.string	"release"
+.LASF261:
+	.string	"pthread_mutex_destroy"
+.LASF309:
+	.string	"asyncFile_RingReap"
+.LASF184:
+	.string	"IORING_UNREGISTER_EVENTFD"
+.LASF256:
+	.string	"serviced"
+.LASF6:
+	.string	"short unsigned int"
+.LASF105:
+	.string	"IORING_OP_NOP"
+.LASF60:
+	.string	"iov_base"
+.LASF304:
+	.string	"argument"
+.LASF308:
+	.string	"slot"
+.LASF103:
+	.string	"user_data"
+.LASF118:
+	.string	"IORING_OP_ACCEPT"
+.LASF228:
+	.string	"state"
+.LASF203:
+	.string	"IORING_REGISTER_SYNC_CANCEL"
+.LASF109:
+	.string	"IORING_OP_READ_FIXED"
+.LASF69:
+	.string	"addr2"
+.LASF97:
+	.string	"addr3"
+.LASF224:
+	.string	"data"
+.LASF188:
+	.string	"IORING_REGISTER_PERSONALITY"
+.LASF315:
+	.string	"part"
+.LASF253:
+	.string	"lock"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/asyncFile.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2623 @@
+	.file	"fastFloat.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/fastFloat.c"
+	.section	.rodata
+	.align 32
+	.type	powersOfTen, @object
+	.size	powersOfTen, 184
+powersOfTen:
+	.long	0
+	.long	1072693248
+	.long	0
+	.long	1076101120
+	.long	0
+	.long	1079574528
+	.long	0
+	.long	1083129856
+	.long	0
+	.long	1086556160
+	.long	0
+	.long	1090021888
+	.long	0
+	.long	1093567616
+	.long	0
+	.long	1097011920
+	.long	0
+	.long	1100470148
+	.long	0
+	.long	1104006501
+	.long	536870912
+	.long	1107468383
+	.long	-402653184
+	.long	1110919286
+	.long	-1577058304
+	.long	1114446484
+	.long	-448790528
+	.long	1117925532
+	.long	512753664
+	.long	1121369284
+	.long	640942080
+	.long	1124887541
+	.long	937459712
+	.long	1128383353
+	.long	-2049400832
+	.long	1131820119
+	.long	1733216256
+	.long	1135329645
+	.long	1620131072
+	.long	1138841828
+	.long	2025163840
+	.long	1142271773
+	.long	-689770672
+	.long	1145772772
+	.long	105764242
+	.long	1149300943
+	.text
+	.type	fastFloat_IsDigit, @function
+fastFloat_IsDigit:
+.LFB6:
+	.file 1 "source/fastFloat.c"
+	.loc 1 28 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	eax, edi
+	mov	BYTE PTR -4[rbp], al
+	.loc 1 29 12
+	movzx	eax, BYTE PTR -4[rbp]
+	sub	eax, 48
+	.loc 1 29 45
+	cmp	al, 9
+	setbe	al
+	movzx	eax, al
+	.loc 1 30 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	fastFloat_IsDigit, .-fastFloat_IsDigit
+	.type	fastFloat_IsSpace, @function
+fastFloat_IsSpace:
+.LFB7:
+	.loc 1 33 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	eax, edi
+	mov	BYTE PTR -4[rbp], al
+	.loc 1 34 31
+	cmp	BYTE PTR -4[rbp], 32
+	je	.L4
+	.loc 1 34 35 discriminator 2
+	movzx	eax, BYTE PTR -4[rbp]
+	sub	eax, 9
+	.loc 1 34 31 discriminator 2
+	cmp	al, 4
+	ja	.L5
+.L4:
+	.loc 1 34 31 is_stmt 0 discriminator 3
+	mov	eax, 1
+	jmp	.L7
+.L5:
+	.loc 1 34 31 discriminator 4
+	mov	eax, 0
+.L7:
+	.loc 1 35 1 is_stmt 1 discriminator 7
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	fastFloat_IsSpace, .-fastFloat_IsSpace
+	.type	fastFloat_MatchWord, @function
+fastFloat_MatchWord:
+.LFB8:
+	.loc 1 42 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 43 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	strlen@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 45 22
+	mov	rax, QWORD PTR -32[rbp]
+	sub	rax, QWORD PTR -24[rbp]
+	.loc 1 45 8
+	cmp	rax, QWORD PTR -16[rbp]
+	jnb	.L9
+	.loc 1 47 16
+	mov	eax, 0
+	jmp	.L10
+.L9:
+.LBB2:
+	.loc 1 49 17
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 49 5
+	jmp	.L11
+.L13:
+	.loc 1 51 19
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 51 31
+	or	eax, 32
+	mov	ecx, eax
+	.loc 1 51 38
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 51 12
+	cmp	cl, al
+	je	.L12
+	.loc 1 53 20
+	mov	eax, 0
+	jmp	.L10
+.L12:
+	.loc 1 49 37 discriminator 2
+	add	QWORD PTR -8[rbp], 1
+.L11:
+	.loc 1 49 26 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -16[rbp]
+	jb	.L13
+.LBE2:
+	.loc 1 56 12
+	mov	rax, QWORD PTR -16[rbp]
+.L10:
+	.loc 1 57 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	fastFloat_MatchWord, .-fastFloat_MatchWord
+	.type	fastFloat_IsFloatHalfway, @function
+fastFloat_IsFloatHalfway:
+.LFB9:
+	.loc 1 64 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 67 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 68 19
+	mov	rax, QWORD PTR -8[rbp]
+	and	eax, 536870911
+	.loc 1 68 58
+	cmp	rax, 268435456
+	je	.L15
+	.loc 1 68 62 discriminator 2
+	movsd	xmm0, QWORD PTR -24[rbp]
+	movq	xmm1, QWORD PTR .LC0[rip]
+	andpd	xmm1, xmm0
+	.loc 1 68 58 discriminator 2
+	movsd	xmm0, QWORD PTR .LC1[rip]
+	comisd	xmm0, xmm1
+	jbe	.L20
+.L15:
+	.loc 1 68 58 is_stmt 0 discriminator 3
+	mov	eax, 1
+	jmp	.L19
+.L20:
+	.loc 1 68 58 discriminator 4
+	mov	eax, 0
+.L19:
+	.loc 1 69 1 is_stmt 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	fastFloat_IsFloatHalfway, .-fastFloat_IsFloatHalfway
+	.section	.rodata
+.LC2:
+	.string	"e%d"
+	.text
+	.type	fastFloat_ParseSlow, @function
+fastFloat_ParseSlow:
+.LFB10:
+	.loc 1 82 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 208
+	mov	QWORD PTR -184[rbp], rdi
+	mov	QWORD PTR -192[rbp], rsi
+	mov	DWORD PTR -196[rbp], edx
+	.loc 1 84 12
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 85 9
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 86 9
+	mov	DWORD PTR -16[rbp], 0
+.LBB3:
+	.loc 1 88 22
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 88 5
+	jmp	.L22
+.L27:
+	.loc 1 90 13
+	mov	rax, QWORD PTR -24[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 90 12
+	cmp	al, 46
+	jne	.L23
+	.loc 1 92 22
+	mov	DWORD PTR -12[rbp], 1
+	jmp	.L24
+.L23:
+	.loc 1 94 17
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L25
+	.loc 1 94 36 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 94 32 discriminator 1
+	cmp	al, 48
+	jne	.L25
+	.loc 1 96 22
+	mov	eax, DWORD PTR -12[rbp]
+	sub	DWORD PTR -196[rbp], eax
+	jmp	.L24
+.L25:
+	.loc 1 98 17
+	cmp	QWORD PTR -8[rbp], 127
+	ja	.L26
+	.loc 1 100 24
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -8[rbp], rdx
+	.loc 1 100 30
+	mov	rdx, QWORD PTR -24[rbp]
+	movzx	edx, BYTE PTR [rdx]
+	.loc 1 100 28
+	mov	BYTE PTR -176[rbp+rax], dl
+	.loc 1 101 22
+	mov	eax, DWORD PTR -12[rbp]
+	sub	DWORD PTR -196[rbp], eax
+	jmp	.L24
+.L26:
+	.loc 1 105 25
+	cmp	DWORD PTR -12[rbp], 0
+	sete	al
+	movzx	eax, al
+	.loc 1 105 22
+	add	DWORD PTR -196[rbp], eax
+	.loc 1 106 24
+	mov	rax, QWORD PTR -24[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 106 27
+	cmp	al, 48
+	setne	al
+	movzx	eax, al
+	.loc 1 106 20
+	or	DWORD PTR -16[rbp], eax
+.L24:
+	.loc 1 88 44 discriminator 2
+	add	QWORD PTR -24[rbp], 1
+.L22:
+	.loc 1 88 36 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	cmp	rax, QWORD PTR -192[rbp]
+	jb	.L27
+.LBE3:
+	.loc 1 109 8
+	cmp	DWORD PTR -16[rbp], 0
+	je	.L28
+	.loc 1 111 20
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -8[rbp], rdx
+	.loc 1 111 24
+	mov	BYTE PTR -176[rbp+rax], 49
+	.loc 1 112 17
+	sub	DWORD PTR -196[rbp], 1
+.L28:
+	.loc 1 114 8
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L29
+	.loc 1 116 20
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -8[rbp], rdx
+	.loc 1 116 24
+	mov	BYTE PTR -176[rbp+rax], 48
+.L29:
+	.loc 1 118 5
+	mov	eax, 144
+	sub	rax, QWORD PTR -8[rbp]
+	lea	rcx, -176[rbp]
+	mov	rdx, QWORD PTR -8[rbp]
+	lea	rdi, [rcx+rdx]
+	mov	edx, DWORD PTR -196[rbp]
+	mov	ecx, edx
+	lea	rdx, .LC2[rip]
+	mov	rsi, rax
+	mov	eax, 0
+	call	snprintf@PLT
+	.loc 1 119 12
+	lea	rax, -176[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	strtof@PLT
+	.loc 1 120 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	fastFloat_ParseSlow, .-fastFloat_ParseSlow
+	.section	.rodata
+.LC3:
+	.string	"inf"
+.LC4:
+	.string	"inity"
+.LC7:
+	.string	"nan"
+	.text
+	.globl	fastFloat_Parse
+	.type	fastFloat_Parse, @function
+fastFloat_Parse:
+.LFB11:
+	.loc 1 123 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	add	rsp, -128
+	mov	QWORD PTR -104[rbp], rdi
+	mov	QWORD PTR -112[rbp], rsi
+	mov	QWORD PTR -120[rbp], rdx
+	.loc 1 124 17
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 125 14
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 126 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 127 9
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 128 9
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 129 9
+	mov	DWORD PTR -32[rbp], 0
+	.loc 1 130 9
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 133 11
+	jmp	.L32
+.L34:
+	.loc 1 135 10
+	add	QWORD PTR -8[rbp], 1
+.L32:
+	.loc 1 133 22
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L33
+	.loc 1 133 43 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 133 25 discriminator 1
+	movsx	eax, al
+	mov	edi, eax
+	call	fastFloat_IsSpace
+	.loc 1 133 22 discriminator 1
+	test	eax, eax
+	jne	.L34
+.L33:
+	.loc 1 137 8
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L35
+	.loc 1 137 24 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 137 19 discriminator 1
+	cmp	al, 45
+	je	.L36
+	.loc 1 137 39 discriminator 2
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 137 35 discriminator 2
+	cmp	al, 43
+	jne	.L35
+.L36:
+	.loc 1 139 21
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 139 24
+	cmp	al, 45
+	sete	al
+	.loc 1 139 18
+	movzx	eax, al
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 140 10
+	add	QWORD PTR -8[rbp], 1
+.L35:
+	.loc 1 142 8
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jne	.L37
+	.loc 1 144 16
+	mov	eax, 0
+	jmp	.L38
+.L37:
+	.loc 1 147 20
+	mov	rcx, QWORD PTR -112[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, .LC3[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fastFloat_MatchWord
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 147 8
+	cmp	QWORD PTR -64[rbp], 0
+	je	.L39
+	.loc 1 149 11
+	mov	rax, QWORD PTR -64[rbp]
+	add	QWORD PTR -8[rbp], rax
+	.loc 1 150 14
+	mov	rcx, QWORD PTR -112[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, .LC4[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fastFloat_MatchWord
+	.loc 1 150 11
+	add	QWORD PTR -8[rbp], rax
+	.loc 1 151 39
+	cmp	DWORD PTR -24[rbp], 0
+	je	.L40
+	.loc 1 151 39 is_stmt 0 discriminator 1
+	movss	xmm0, DWORD PTR .LC5[rip]
+	jmp	.L41
+.L40:
+	.loc 1 151 39 discriminator 2
+	movss	xmm0, DWORD PTR .LC6[rip]
+.L41:
+	.loc 1 151 16 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -120[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 152 16 discriminator 4
+	mov	rax, QWORD PTR -8[rbp]
+	jmp	.L38
+.L39:
+	.loc 1 154 20
+	mov	rcx, QWORD PTR -112[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, .LC7[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fastFloat_MatchWord
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 154 8
+	cmp	QWORD PTR -64[rbp], 0
+	je	.L42
+	.loc 1 156 16
+	mov	rax, QWORD PTR -120[rbp]
+	movss	xmm0, DWORD PTR .LC8[rip]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 157 18
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	jmp	.L38
+.L42:
+	.loc 1 159 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR -72[rbp], rax
+	.loc 1 162 5
+	jmp	.L43
+.L47:
+	.loc 1 164 12
+	movabs	rax, 1844674407370955159
+	cmp	rax, QWORD PTR -16[rbp]
+	jb	.L44
+	.loc 1 166 33
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	add	rax, rax
+	mov	rdx, rax
+	.loc 1 166 41
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	movsx	eax, al
+	.loc 1 166 44
+	sub	eax, 48
+	cdqe
+	.loc 1 166 22
+	add	rax, rdx
+	mov	QWORD PTR -16[rbp], rax
+	jmp	.L45
+.L44:
+	.loc 1 170 21
+	add	DWORD PTR -20[rbp], 1
+	.loc 1 171 27
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 171 30
+	cmp	al, 48
+	setne	al
+	movzx	eax, al
+	.loc 1 171 23
+	or	DWORD PTR -36[rbp], eax
+.L45:
+	.loc 1 173 18
+	mov	DWORD PTR -32[rbp], 1
+	.loc 1 162 49
+	add	QWORD PTR -8[rbp], 1
+.L43:
+	.loc 1 162 22 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L46
+	.loc 1 162 43 discriminator 2
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 162 25 discriminator 2
+	movsx	eax, al
+	mov	edi, eax
+	call	fastFloat_IsDigit
+	.loc 1 162 22 discriminator 2
+	test	eax, eax
+	jne	.L47
+.L46:
+	.loc 1 175 8
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L48
+	.loc 1 175 23 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 175 19 discriminator 1
+	cmp	al, 46
+	jne	.L48
+	.loc 1 177 15
+	add	QWORD PTR -8[rbp], 1
+	.loc 1 177 9
+	jmp	.L49
+.L52:
+	.loc 1 179 16
+	movabs	rax, 1844674407370955159
+	cmp	rax, QWORD PTR -16[rbp]
+	jb	.L50
+	.loc 1 181 37
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	add	rax, rax
+	mov	rdx, rax
+	.loc 1 181 45
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	movsx	eax, al
+	.loc 1 181 48
+	sub	eax, 48
+	cdqe
+	.loc 1 181 26
+	add	rax, rdx
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 182 25
+	sub	DWORD PTR -20[rbp], 1
+	jmp	.L51
+.L50:
+	.loc 1 186 31
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 186 34
+	cmp	al, 48
+	setne	al
+	movzx	eax, al
+	.loc 1 186 27
+	or	DWORD PTR -36[rbp], eax
+.L51:
+	.loc 1 188 22 discriminator 2
+	mov	DWORD PTR -32[rbp], 1
+	.loc 1 177 56 discriminator 2
+	add	QWORD PTR -8[rbp], 1
+.L49:
+	.loc 1 177 29 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L48
+	.loc 1 177 50 discriminator 3
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 177 32 discriminator 3
+	movsx	eax, al
+	mov	edi, eax
+	call	fastFloat_IsDigit
+	.loc 1 177 29 discriminator 3
+	test	eax, eax
+	jne	.L52
+.L48:
+	.loc 1 191 8
+	cmp	DWORD PTR -32[rbp], 0
+	jne	.L53
+	.loc 1 193 16
+	mov	eax, 0
+	jmp	.L38
+.L53:
+	.loc 1 195 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR -80[rbp], rax
+	.loc 1 197 8
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L54
+	.loc 1 197 24 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 197 35 discriminator 1
+	or	eax, 32
+	.loc 1 197 19 discriminator 1
+	cmp	al, 101
+	jne	.L54
+.LBB4:
+	.loc 1 199 21
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 1
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 200 13
+	mov	DWORD PTR -52[rbp], 0
+	.loc 1 202 12
+	mov	rax, QWORD PTR -48[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L55
+	.loc 1 202 28 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 202 23 discriminator 1
+	cmp	al, 45
+	je	.L56
+	.loc 1 202 43 discriminator 2
+	mov	rax, QWORD PTR -48[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 202 39 discriminator 2
+	cmp	al, 43
+	jne	.L55
+.L56:
+	.loc 1 204 33
+	mov	rax, QWORD PTR -48[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 204 36
+	cmp	al, 45
+	sete	al
+	.loc 1 204 30
+	movzx	eax, al
+	mov	DWORD PTR -52[rbp], eax
+	.loc 1 205 14
+	add	QWORD PTR -48[rbp], 1
+.L55:
+	.loc 1 207 12
+	mov	rax, QWORD PTR -48[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L54
+	.loc 1 207 44 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 207 26 discriminator 1
+	movsx	eax, al
+	mov	edi, eax
+	call	fastFloat_IsDigit
+	.loc 1 207 23 discriminator 1
+	test	eax, eax
+	je	.L54
+	.loc 1 209 13
+	jmp	.L57
+.L60:
+	.loc 1 211 20
+	cmp	DWORD PTR -28[rbp], 9999
+	jg	.L58
+	.loc 1 213 57
+	mov	edx, DWORD PTR -28[rbp]
+	mov	eax, edx
+	sal	eax, 2
+	add	eax, edx
+	add	eax, eax
+	mov	edx, eax
+	.loc 1 213 65
+	mov	rax, QWORD PTR -48[rbp]
+	movzx	eax, BYTE PTR [rax]
+	movsx	eax, al
+	.loc 1 213 68
+	sub	eax, 48
+	.loc 1 213 38
+	add	eax, edx
+	mov	DWORD PTR -28[rbp], eax
+.L58:
+	.loc 1 209 57
+	add	QWORD PTR -48[rbp], 1
+.L57:
+	.loc 1 209 30 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	cmp	rax, QWORD PTR -112[rbp]
+	jnb	.L59
+	.loc 1 209 51 discriminator 2
+	mov	rax, QWORD PTR -48[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 209 33 discriminator 2
+	movsx	eax, al
+	mov	edi, eax
+	call	fastFloat_IsDigit
+	.loc 1 209 30 discriminator 2
+	test	eax, eax
+	jne	.L60
+.L59:
+	.loc 1 216 69
+	cmp	DWORD PTR -52[rbp], 0
+	je	.L61
+	.loc 1 216 69 is_stmt 0 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	neg	eax
+	jmp	.L62
+.L61:
+	.loc 1 216 69 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+.L62:
+	.loc 1 216 30 is_stmt 1 discriminator 4
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 217 22 discriminator 4
+	mov	eax, DWORD PTR -28[rbp]
+	add	DWORD PTR -20[rbp], eax
+	.loc 1 218 15 discriminator 4
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR -8[rbp], rax
+.L54:
+.LBE4:
+	.loc 1 225 8
+	cmp	DWORD PTR -36[rbp], 0
+	jne	.L63
+	.loc 1 225 26 discriminator 1
+	movabs	rax, 9007199254740991
+	cmp	rax, QWORD PTR -16[rbp]
+	jb	.L63
+	.loc 1 225 55 discriminator 2
+	cmp	DWORD PTR -20[rbp], -22
+	jl	.L63
+	.loc 1 226 9
+	cmp	DWORD PTR -20[rbp], 22
+	jg	.L63
+.LBB5:
+	.loc 1 229 46
+	cmp	DWORD PTR -20[rbp], 0
+	jns	.L64
+	.loc 1 228 49 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	test	rax, rax
+	js	.L65
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L66
+.L65:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L66:
+	.loc 1 228 80 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	neg	eax
+	.loc 1 228 79 discriminator 1
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, powersOfTen[rip]
+	movsd	xmm1, QWORD PTR [rdx+rax]
+	.loc 1 229 46 discriminator 1
+	divsd	xmm0, xmm1
+	jmp	.L67
+.L64:
+	.loc 1 229 49 discriminator 2
+	mov	rax, QWORD PTR -16[rbp]
+	test	rax, rax
+	js	.L68
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L69
+.L68:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L69:
+	.loc 1 229 79 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, powersOfTen[rip]
+	movsd	xmm1, QWORD PTR [rdx+rax]
+	.loc 1 229 46 discriminator 2
+	mulsd	xmm0, xmm1
+.L67:
+	.loc 1 228 22
+	movsd	QWORD PTR -88[rbp], xmm0
+	.loc 1 232 32
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L70
+	.loc 1 231 35
+	cmp	DWORD PTR -20[rbp], 0
+	je	.L70
+	.loc 1 231 58 discriminator 1
+	mov	rax, QWORD PTR -88[rbp]
+	movq	xmm0, rax
+	call	fastFloat_IsFloatHalfway
+	.loc 1 231 54 discriminator 1
+	test	eax, eax
+	jne	.L71
+.L70:
+	.loc 1 232 32 discriminator 1
+	pxor	xmm2, xmm2
+	cvtsd2ss	xmm2, QWORD PTR -88[rbp]
+	movd	eax, xmm2
+	jmp	.L72
+.L71:
+	.loc 1 232 34
+	mov	edx, DWORD PTR -28[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fastFloat_ParseSlow
+	movd	eax, xmm0
+.L72:
+	.loc 1 231 16
+	mov	DWORD PTR -56[rbp], eax
+.LBE5:
+	.loc 1 227 5
+	jmp	.L73
+.L63:
+	.loc 1 236 18
+	mov	edx, DWORD PTR -28[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fastFloat_ParseSlow
+	movd	eax, xmm0
+	mov	DWORD PTR -56[rbp], eax
+.L73:
+	.loc 1 239 33
+	cmp	DWORD PTR -24[rbp], 0
+	je	.L74
+	.loc 1 239 33 is_stmt 0 discriminator 1
+	movss	xmm0, DWORD PTR -56[rbp]
+	movss	xmm1, DWORD PTR .LC9[rip]
+	xorps	xmm0, xmm1
+	jmp	.L75
+.L74:
+	.loc 1 239 33 discriminator 2
+	movss	xmm0, DWORD PTR -56[rbp]
+.L75:
+	.loc 1 239 12 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -120[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 240 12 discriminator 4
+	mov	rax, QWORD PTR -8[rbp]
+.L38:
+	.loc 1 241 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	fastFloat_Parse, .-fastFloat_Parse
+	.globl	fastFloat_FormatInteger
+	.type	fastFloat_FormatInteger, @function
+fastFloat_FormatInteger:
+.LFB12:
+	.loc 1 244 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -56[rbp], rdi
+	mov	QWORD PTR -64[rbp], rsi
+	.loc 1 246 12
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 247 12
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 248 67
+	cmp	QWORD PTR -64[rbp], 0
+	jns	.L77
+	.loc 1 248 46 discriminator 1
+	mov	rax, QWORD PTR -64[rbp]
+	.loc 1 248 67 discriminator 1
+	neg	rax
+	jmp	.L78
+.L77:
+	.loc 1 248 67 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -64[rbp]
+.L78:
+	.loc 1 248 19 is_stmt 1 discriminator 4
+	mov	QWORD PTR -24[rbp], rax
+.L79:
+	.loc 1 252 44 discriminator 1
+	mov	rcx, QWORD PTR -24[rbp]
+	movabs	rdx, -3689348814741910323
+	mov	rax, rcx
+	mul	rdx
+	shr	rdx, 3
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	add	rax, rax
+	sub	rcx, rax
+	mov	rdx, rcx
+	.loc 1 252 31 discriminator 1
+	mov	eax, edx
+	lea	ecx, 48[rax]
+	.loc 1 252 21 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -8[rbp], rdx
+	.loc 1 252 31 discriminator 1
+	mov	edx, ecx
+	.loc 1 252 25 discriminator 1
+	mov	BYTE PTR -48[rbp+rax], dl
+	.loc 1 253 19 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	movabs	rdx, -3689348814741910323
+	mul	rdx
+	mov	rax, rdx
+	shr	rax, 3
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 254 24 discriminator 1
+	cmp	QWORD PTR -24[rbp], 0
+	jne	.L79
+	.loc 1 256 8
+	cmp	QWORD PTR -64[rbp], 0
+	jns	.L81
+	.loc 1 258 22
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -16[rbp], rdx
+	.loc 1 258 15
+	mov	rdx, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 258 26
+	mov	BYTE PTR [rax], 45
+	.loc 1 260 11
+	jmp	.L81
+.L82:
+	.loc 1 262 26
+	sub	QWORD PTR -8[rbp], 1
+	.loc 1 262 22
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -16[rbp], rdx
+	.loc 1 262 15
+	mov	rdx, QWORD PTR -56[rbp]
+	add	rdx, rax
+	.loc 1 262 34
+	lea	rcx, -48[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rcx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 262 26
+	mov	BYTE PTR [rdx], al
+.L81:
+	.loc 1 260 18
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L82
+	.loc 1 264 12
+	mov	rax, QWORD PTR -16[rbp]
+	.loc 1 265 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	fastFloat_FormatInteger, .-fastFloat_FormatInteger
+	.section	.rodata
+.LC12:
+	.string	"%.*f"
+	.text
+	.globl	fastFloat_Format
+	.type	fastFloat_Format, @function
+fastFloat_Format:
+.LFB13:
+	.loc 1 268 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -56[rbp], rdi
+	movss	DWORD PTR -60[rbp], xmm0
+	mov	DWORD PTR -64[rbp], esi
+	.loc 1 272 27
+	movss	xmm0, DWORD PTR -60[rbp]
+	movss	xmm1, DWORD PTR .LC10[rip]
+	andps	xmm0, xmm1
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 272 116
+	cmp	DWORD PTR -64[rbp], 9
+	jg	.L85
+	.loc 1 272 116 is_stmt 0 discriminator 1
+	mov	eax, DWORD PTR -64[rbp]
+	jmp	.L86
+.L85:
+	.loc 1 272 116 discriminator 2
+	mov	eax, 0
+.L86:
+	.loc 1 272 60 is_stmt 1 discriminator 4
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, powersOfTen[rip]
+	movsd	xmm0, QWORD PTR [rdx+rax]
+	.loc 1 272 18 discriminator 4
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 273 12 discriminator 4
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 275 8 discriminator 4
+	cmp	DWORD PTR -64[rbp], 9
+	jg	.L87
+	.loc 1 275 64 discriminator 1
+	movsd	xmm0, QWORD PTR .LC11[rip]
+	comisd	xmm0, QWORD PTR -32[rbp]
+	seta	al
+	.loc 1 275 55 discriminator 1
+	xor	eax, 1
+	.loc 1 275 52 discriminator 1
+	test	al, al
+	je	.L88
+.L87:
+	.loc 1 277 16
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, DWORD PTR -60[rbp]
+	movq	rcx, xmm2
+	mov	edx, DWORD PTR -64[rbp]
+	mov	rax, QWORD PTR -56[rbp]
+	movq	xmm0, rcx
+	mov	ecx, edx
+	lea	rdx, .LC12[rip]
+	mov	esi, 64
+	mov	rdi, rax
+	mov	eax, 1
+	call	snprintf@PLT
+	cdqe
+	jmp	.L89
+.L88:
+	.loc 1 280 43
+	mov	rax, QWORD PTR -32[rbp]
+	movq	xmm0, rax
+	call	nearbyint@PLT
+	.loc 1 280 20
+	comisd	xmm0, QWORD PTR .LC13[rip]
+	jnb	.L90
+	cvttsd2si	rax, xmm0
+	mov	QWORD PTR -40[rbp], rax
+	jmp	.L91
+.L90:
+	movsd	xmm1, QWORD PTR .LC13[rip]
+	subsd	xmm0, xmm1
+	cvttsd2si	rax, xmm0
+	mov	QWORD PTR -40[rbp], rax
+	movabs	rax, -9223372036854775808
+	xor	QWORD PTR -40[rbp], rax
+.L91:
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 281 49
+	mov	eax, DWORD PTR -64[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, powersOfTen[rip]
+	movsd	xmm0, QWORD PTR [rdx+rax]
+	.loc 1 281 20
+	comisd	xmm0, QWORD PTR .LC13[rip]
+	jnb	.L92
+	cvttsd2si	rax, xmm0
+	mov	QWORD PTR -48[rbp], rax
+	jmp	.L93
+.L92:
+	movsd	xmm1, QWORD PTR .LC13[rip]
+	subsd	xmm0, xmm1
+	cvttsd2si	rax, xmm0
+	mov	QWORD PTR -48[rbp], rax
+	movabs	rax, -9223372036854775808
+	xor	QWORD PTR -48[rbp], rax
+.L93:
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 282 14
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, 0
+	div	QWORD PTR -48[rbp]
+	mov	QWORD PTR -16[rbp], rdx
+	.loc 1 284 9
+	mov	eax, DWORD PTR -60[rbp]
+	and	eax, -2147483648
+	.loc 1 284 8
+	test	eax, eax
+	je	.L94
+	.loc 1 286 22
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -8[rbp], rdx
+	.loc 1 286 15
+	mov	rdx, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 286 26
+	mov	BYTE PTR [rax], 45
+.L94:
+	.loc 1 288 74
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, 0
+	div	QWORD PTR -48[rbp]
+	.loc 1 288 15
+	mov	rcx, rax
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fastFloat_FormatInteger
+	.loc 1 288 12
+	add	QWORD PTR -8[rbp], rax
+	.loc 1 290 8
+	cmp	DWORD PTR -64[rbp], 0
+	jle	.L95
+	.loc 1 292 22
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -8[rbp], rdx
+	.loc 1 292 15
+	mov	rdx, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 292 26
+	mov	BYTE PTR [rax], 46
+.LBB6:
+	.loc 1 293 18
+	mov	eax, DWORD PTR -64[rbp]
+	sub	eax, 1
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 293 9
+	jmp	.L96
+.L97:
+	.loc 1 295 50 discriminator 3
+	mov	rcx, QWORD PTR -16[rbp]
+	movabs	rdx, -3689348814741910323
+	mov	rax, rcx
+	mul	rdx
+	shr	rdx, 3
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	add	rax, rax
+	sub	rcx, rax
+	mov	rdx, rcx
+	.loc 1 295 38 discriminator 3
+	mov	eax, edx
+	lea	ecx, 48[rax]
+	.loc 1 295 27 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -8[rbp]
+	add	rdx, rax
+	.loc 1 295 19 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 295 38 discriminator 3
+	mov	edx, ecx
+	.loc 1 295 32 discriminator 3
+	mov	BYTE PTR [rax], dl
+	.loc 1 296 22 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	movabs	rdx, -3689348814741910323
+	mul	rdx
+	mov	rax, rdx
+	shr	rax, 3
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 293 45 discriminator 3
+	sub	DWORD PTR -20[rbp], 1
+.L96:
+	.loc 1 293 38 discriminator 1
+	cmp	DWORD PTR -20[rbp], 0
+	jns	.L97
+.LBE6:
+	.loc 1 298 16
+	mov	eax, DWORD PTR -64[rbp]
+	cdqe
+	add	QWORD PTR -8[rbp], rax
+.L95:
+	.loc 1 300 12
+	mov	rax, QWORD PTR -8[rbp]
+.L89:
+	.loc 1 301 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	fastFloat_Format, .-fastFloat_Format
+	.section	.rodata
+	.align 16
+.LC0:
+	.long	-1
+	.long	2147483647
+	.long	0
+	.long	0
+	.align 8
+.LC1:
+	.long	0
+	.long	940572672
+	.align 4
+.LC5:
+	.long	-8388608
+	.align 4
+.LC6:
+	.long	2139095040
+	.align 4
+.LC8:
+	.long	2143289344
+	.align 16
+.LC9:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.align 16
+.LC10:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.align 8
+.LC11:
+	.long	0
+	.long	1128267776
+	.align 8
+.LC13:
+	.long	0
+	.long	1138753536
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 6 "/usr/include/stdlib.h"
+	.file 7 "/usr/include/stdio.h"
+	.file 8 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x5ba
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x13
+	.long	.LASF57
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xa
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0xa
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x6
+	.long	0x8a
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF12
+	.uleb128 0x7
+	.long	0x8a
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF13
+	.uleb128 0xa
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0x79
+	.uleb128 0x7
+	.long	0x9d
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x10
+	.long	0xae
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF15
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF16
+	.uleb128 0x7
+	.long	0xbf
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF17
+	.uleb128 0xb
+	.long	0xc6
+	.long	0xe2
+	.uleb128 0xc
+	.long	0x3a
+	.byte	0x16
+	.byte	0
+	.uleb128 0x7
+	.long	0xd2
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x15
+	.byte	0x15
+	.long	0xe2
+	.uleb128 0x9
+	.byte	0x3
+	.quad	powersOfTen
+	.uleb128 0xd
+	.long	.LASF18
+	.byte	0x5
+	.value	0x129
+	.byte	0x1
+	.long	0xbf
+	.long	0x113
+	.uleb128 0x4
+	.long	0xbf
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF19
+	.byte	0x6
+	.byte	0x7c
+	.byte	0xe
+	.long	0xb8
+	.long	0x12e
+	.uleb128 0x4
+	.long	0xb3
+	.uleb128 0x4
+	.long	0x133
+	.byte	0
+	.uleb128 0x6
+	.long	0x85
+	.uleb128 0x10
+	.long	0x12e
+	.uleb128 0xd
+	.long	.LASF20
+	.byte	0x7
+	.value	0x17a
+	.byte	0xc
+	.long	0x41
+	.long	0x15a
+	.uleb128 0x4
+	.long	0x85
+	.uleb128 0x4
+	.long	0x2e
+	.uleb128 0x4
+	.long	0xae
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF21
+	.byte	0x8
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x171
+	.uleb128 0x4
+	.long	0xae
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF31
+	.byte	0x1
+	.value	0x10b
+	.byte	0x8
+	.long	0x2e
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x22a
+	.uleb128 0xe
+	.long	.LASF22
+	.byte	0x1f
+	.long	0x85
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xe
+	.long	.LASF23
+	.byte	0x2d
+	.long	0xb8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0xe
+	.long	.LASF24
+	.byte	0x38
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x5
+	.long	.LASF26
+	.value	0x110
+	.byte	0x12
+	.long	0xc6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF27
+	.value	0x111
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.long	.LASF28
+	.value	0x118
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF29
+	.value	0x119
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x5
+	.long	.LASF30
+	.value	0x11a
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x8
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x1
+	.value	0x125
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF32
+	.byte	0x1
+	.byte	0xf3
+	.byte	0x8
+	.long	0x2e
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a3
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0xf3
+	.byte	0x26
+	.long	0x85
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0xf3
+	.byte	0x33
+	.long	0x48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0xf5
+	.byte	0xa
+	.long	0x2a3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0xf6
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0xf7
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0xf8
+	.byte	0x13
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0xb
+	.long	0x8a
+	.long	0x2b3
+	.uleb128 0xc
+	.long	0x3a
+	.byte	0x17
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x7a
+	.byte	0xd
+	.long	0xae
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3f1
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x7a
+	.byte	0x29
+	.long	0xae
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xf
+	.string	"end"
+	.byte	0x7a
+	.byte	0x3c
+	.long	0xae
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x7a
+	.byte	0x48
+	.long	0x3f1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x9
+	.string	"p"
+	.byte	0x7c
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x7d
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x7e
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x7f
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x80
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x81
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x82
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x83
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x9f
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0xc3
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0xe0
+	.byte	0xb
+	.long	0xb8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1b
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.long	0x3cf
+	.uleb128 0x9
+	.string	"q"
+	.byte	0xc7
+	.byte	0x15
+	.long	0xae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0xc8
+	.byte	0xd
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.uleb128 0x8
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0xe4
+	.byte	0x16
+	.long	0xc6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xb8
+	.uleb128 0x11
+	.long	.LASF50
+	.byte	0x51
+	.byte	0xe
+	.long	0xb8
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x49c
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x51
+	.byte	0x2e
+	.long	0xae
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0xf
+	.string	"end"
+	.byte	0x51
+	.byte	0x42
+	.long	0xae
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x51
+	.byte	0x4b
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x53
+	.byte	0xa
+	.long	0x49c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x54
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x55
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x56
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x8
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x9
+	.string	"p"
+	.byte	0x58
+	.byte	0x16
+	.long	0xae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x8a
+	.long	0x4ac
+	.uleb128 0xc
+	.long	0x3a
+	.byte	0x8f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF51
+	.byte	0x3f
+	.long	0x41
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4e9
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x3f
+	.byte	0x33
+	.long	0xbf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x41
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF53
+	.byte	0x29
+	.byte	0xf
+	.long	0x2e
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x561
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x29
+	.byte	0x2f
+	.long	0xae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.string	"end"
+	.byte	0x29
+	.byte	0x42
+	.long	0xae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0x29
+	.byte	0x53
+	.long	0xae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x2b
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x8
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x31
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF55
+	.byte	0x20
+	.long	0x41
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x590
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x20
+	.byte	0x2a
+	.long	0x8a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF58
+	.byte	0x1
+	.byte	0x1b
+	.byte	0x13
+	.long	0x41
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x1b
+	.byte	0x2a
+	.long	0x8a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 267
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF54:
+	.string	"word"
+.LASF33:
+	.string	"digits"
+.LASF10:
+	.string	"size_t"
+.LASF24:
+	.string	"decimals"
+.LASF56:
+	.string	"character"
+.LASF32:
+	.string	"fastFloat_FormatInteger"
+.LASF23:
+	.string	"value"
+.LASF34:
+	.string	"count"
+.LASF20:
+	.string	"snprintf"
+.LASF38:
+	.string	"mantissa"
+.LASF14:
+	.string	"uint64_t"
+.LASF37:
+	.string	"begin"
+.LASF43:
+	.string	"truncated"
+.LASF57:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF29:
+	.string	"scale"
+.LASF21:
+	.string	"strlen"
+.LASF47:
+	.string	"exponentNegative"
+.LASF28:
+	.string	"fixedPoint"
+.LASF5:
+	.string	"unsigned char"
+.LASF48:
+	.string	"text"
+.LASF2:
+	.string	"long unsigned int"
+.LASF31:
+	.string	"fastFloat_Format"
+.LASF6:
+	.string	"short unsigned int"
+.LASF25:
+	.string	"powersOfTen"
+.LASF58:
+	.string	"fastFloat_IsDigit"
+.LASF45:
+	.string	"digitsEnd"
+.LASF16:
+	.string	"double"
+.LASF53:
+	.string	"fastFloat_MatchWord"
+.LASF19:
+	.string	"strtof"
+.LASF7:
+	.string	"unsigned int"
+.LASF41:
+	.string	"explicitExponent"
+.LASF50:
+	.string	"fastFloat_ParseSlow"
+.LASF13:
+	.string	"long long unsigned int"
+.LASF46:
+	.string	"result"
+.LASF44:
+	.string	"matched"
+.LASF22:
+	.string	"buffer"
+.LASF36:
+	.string	"fastFloat_Parse"
+.LASF4:
+	.string	"long long int"
+.LASF26:
+	.string	"scaled"
+.LASF12:
+	.string	"char"
+.LASF52:
+	.string	"bits"
+.LASF51:
+	.string	"fastFloat_IsFloatHalfway"
+.LASF49:
+	.string	"sticky"
+.LASF39:
+	.string	"exponent"
+.LASF9:
+	.string	"short int"
+.LASF11:
+	.string	"__uint64_t"
+.LASF35:
+	.string	"magnitude"
+.LASF18:
+	.string	"nearbyint"
+.LASF40:
+	.string	"negative"
+.LASF3:
+	.string	"long int"
+.LASF17:
+	.string	"long double"
+.LASF15:
+	.string	"float"
+.LASF8:
+	.string	"signed char"
+.LASF30:
+	.string	"fraction"
+.LASF27:
+	.string	"length"
+.LASF42:
+	.string	"anyDigit"
+.LASF55:
+	.string	"fastFloat_IsSpace"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/fastFloat.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
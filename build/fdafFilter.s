@@ -0,0 +1,3812 @@
+	.file	"fdafFilter.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/fdafFilter.c"
+	.type	fdafFilter_MultiplySpectra, @function
+fdafFilter_MultiplySpectra:
+.LFB6:
+	.file 1 "source/fdafFilter.c"
+	.loc 1 31 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	mov	DWORD PTR -60[rbp], ecx
+	mov	DWORD PTR -64[rbp], r8d
+	mov	DWORD PTR -68[rbp], r9d
+	.loc 1 32 42
+	cmp	DWORD PTR -64[rbp], 0
+	je	.L2
+	.loc 1 32 42 is_stmt 0 discriminator 1
+	movss	xmm0, DWORD PTR .LC0[rip]
+	jmp	.L3
+.L2:
+	.loc 1 32 42 discriminator 2
+	movss	xmm0, DWORD PTR .LC1[rip]
+.L3:
+	.loc 1 32 17 is_stmt 1 discriminator 4
+	movss	DWORD PTR -8[rbp], xmm0
+.LBB2:
+	.loc 1 34 14 discriminator 4
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 34 5 discriminator 4
+	jmp	.L4
+.L7:
+.LBB3:
+	.loc 1 36 30
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 36 27
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 36 21
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 37 37
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	.loc 1 37 34
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 37 21
+	movss	xmm1, DWORD PTR -8[rbp]
+	mulss	xmm0, xmm1
+	movss	DWORD PTR -16[rbp], xmm0
+	.loc 1 38 30
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 38 27
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 38 21
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -20[rbp], xmm0
+	.loc 1 39 30
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	.loc 1 39 27
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 39 21
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -24[rbp], xmm0
+	.loc 1 40 29
+	movss	xmm0, DWORD PTR -12[rbp]
+	mulss	xmm0, DWORD PTR -20[rbp]
+	.loc 1 40 39
+	movss	xmm1, DWORD PTR -16[rbp]
+	mulss	xmm1, DWORD PTR -24[rbp]
+	.loc 1 40 21
+	subss	xmm0, xmm1
+	movss	DWORD PTR -28[rbp], xmm0
+	.loc 1 41 29
+	movss	xmm0, DWORD PTR -12[rbp]
+	movaps	xmm1, xmm0
+	mulss	xmm1, DWORD PTR -24[rbp]
+	.loc 1 41 39
+	movss	xmm0, DWORD PTR -16[rbp]
+	mulss	xmm0, DWORD PTR -20[rbp]
+	.loc 1 41 21
+	addss	xmm0, xmm1
+	movss	DWORD PTR -32[rbp], xmm0
+	.loc 1 43 12
+	cmp	DWORD PTR -68[rbp], 0
+	je	.L5
+	.loc 1 45 19
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 45 27
+	addss	xmm0, DWORD PTR -28[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 46 19
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 46 31
+	addss	xmm0, DWORD PTR -32[rbp]
+	movss	DWORD PTR [rax], xmm0
+	jmp	.L6
+.L5:
+	.loc 1 50 22
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 50 19
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 50 27
+	movss	xmm0, DWORD PTR -28[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 51 22
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	.loc 1 51 19
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 51 31
+	movss	xmm0, DWORD PTR -32[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L6:
+.LBE3:
+	.loc 1 34 37 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L4:
+	.loc 1 34 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -60[rbp]
+	jl	.L7
+.LBE2:
+	.loc 1 54 1
+	nop
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	fdafFilter_MultiplySpectra, .-fdafFilter_MultiplySpectra
+	.type	fdafFilter_Weights, @function
+fdafFilter_Weights:
+.LFB7:
+	.loc 1 57 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	DWORD PTR -12[rbp], esi
+	.loc 1 58 19
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 64[rax]
+	.loc 1 58 29
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	.loc 1 58 60
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 58 72
+	add	eax, 1
+	cdqe
+	.loc 1 58 12
+	imul	rax, rdx
+	sal	rax, 3
+	add	rax, rcx
+	.loc 1 59 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	fdafFilter_Weights, .-fdafFilter_Weights
+	.type	fdafFilter_Spectrum, @function
+fdafFilter_Spectrum:
+.LFB8:
+	.loc 1 65 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	DWORD PTR -28[rbp], esi
+	.loc 1 66 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 80[rax]
+	.loc 1 66 36
+	mov	eax, DWORD PTR -28[rbp]
+	add	edx, eax
+	.loc 1 66 51
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 12[rax]
+	.loc 1 66 15
+	mov	eax, edx
+	cdq
+	idiv	ecx
+	mov	DWORD PTR -4[rbp], edx
+	.loc 1 67 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 72[rax]
+	.loc 1 67 29
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 67 55
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 67 67
+	add	eax, 1
+	cdqe
+	.loc 1 67 12
+	imul	rax, rdx
+	sal	rax, 3
+	add	rax, rcx
+	.loc 1 68 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	fdafFilter_Spectrum, .-fdafFilter_Spectrum
+	.type	fdafFilter_PreparePastOutput, @function
+fdafFilter_PreparePastOutput:
+.LFB9:
+	.loc 1 76 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r12
+	push	rbx
+	sub	rsp, 32
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 77 33
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 77 15
+	add	eax, 1
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 79 37
+	mov	eax, DWORD PTR -24[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 79 5
+	lea	rdx, 0[0+rax*4]
+	.loc 1 79 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 79 5
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+.LBB4:
+	.loc 1 80 14
+	mov	DWORD PTR -20[rbp], 1
+	.loc 1 80 5
+	jmp	.L13
+.L14:
+	.loc 1 82 9 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rbx, QWORD PTR 88[rax]
+	.loc 1 82 68 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	fdafFilter_Weights
+	mov	r12, rax
+	.loc 1 82 36 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	fdafFilter_Spectrum
+	mov	rdi, rax
+	.loc 1 82 9 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	mov	r9d, 1
+	mov	r8d, 0
+	mov	ecx, eax
+	mov	rdx, rbx
+	mov	rsi, r12
+	call	fdafFilter_MultiplySpectra
+	.loc 1 80 51 discriminator 3
+	add	DWORD PTR -20[rbp], 1
+.L13:
+	.loc 1 80 31 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 80 23 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jl	.L14
+.LBE4:
+	.loc 1 85 1
+	nop
+	nop
+	add	rsp, 32
+	pop	rbx
+	pop	r12
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	fdafFilter_PreparePastOutput, .-fdafFilter_PreparePastOutput
+	.type	fdafFilter_Evaluate, @function
+fdafFilter_Evaluate:
+.LFB10:
+	.loc 1 99 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 88
+	.cfi_offset 3, -24
+	mov	QWORD PTR -56[rbp], rdi
+	mov	DWORD PTR -60[rbp], esi
+	mov	DWORD PTR -64[rbp], edx
+	mov	QWORD PTR -72[rbp], rcx
+	mov	QWORD PTR -80[rbp], r8
+	mov	QWORD PTR -88[rbp], r9
+	.loc 1 100 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 101 15
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, 1
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 102 22
+	mov	rax, QWORD PTR -56[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	fdafFilter_Spectrum
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 103 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -20[rbp], xmm0
+	.loc 1 106 37
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	.loc 1 106 17
+	mov	rdx, QWORD PTR -56[rbp]
+	lea	rcx, 16[rdx]
+	.loc 1 106 5
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	fft_Forward@PLT
+	.loc 1 107 34
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, DWORD PTR 148[rax]
+	.loc 1 107 26
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 152[rax], edx
+	.loc 1 109 56
+	mov	eax, DWORD PTR -32[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 109 5
+	lea	rdx, 0[0+rax*4]
+	.loc 1 109 40
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR 88[rax]
+	.loc 1 109 18
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 109 5
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 110 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rbx, QWORD PTR 104[rax]
+	.loc 1 110 41
+	mov	rax, QWORD PTR -56[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	fdafFilter_Weights
+	mov	rsi, rax
+	.loc 1 110 5
+	mov	edx, DWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	r9d, 1
+	mov	r8d, 0
+	mov	ecx, edx
+	mov	rdx, rbx
+	mov	rdi, rax
+	call	fdafFilter_MultiplySpectra
+	.loc 1 111 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 120[rax]
+	.loc 1 111 37
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 111 17
+	mov	rcx, QWORD PTR -56[rbp]
+	add	rcx, 16
+	.loc 1 111 5
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	fft_Inverse@PLT
+.LBB5:
+	.loc 1 113 14
+	mov	eax, DWORD PTR -60[rbp]
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 113 5
+	jmp	.L16
+.L19:
+	.loc 1 115 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 120[rax]
+	.loc 1 115 36
+	mov	ecx, DWORD PTR -28[rbp]
+	mov	edx, DWORD PTR -24[rbp]
+	add	edx, ecx
+	movsx	rdx, edx
+	.loc 1 115 25
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 115 11
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -20[rbp], xmm0
+	.loc 1 116 38
+	mov	eax, DWORD PTR -24[rbp]
+	sub	eax, DWORD PTR -60[rbp]
+	cdqe
+	.loc 1 116 35
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 116 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 128[rax]
+	.loc 1 116 22
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 116 46
+	subss	xmm0, DWORD PTR -20[rbp]
+	.loc 1 116 26
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 117 12
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L17
+	.loc 1 119 22
+	mov	eax, DWORD PTR -24[rbp]
+	sub	eax, DWORD PTR -60[rbp]
+	cdqe
+	.loc 1 119 19
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 119 30
+	movss	xmm0, DWORD PTR -20[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L17:
+	.loc 1 121 12
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L18
+	.loc 1 123 37
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 128[rax]
+	.loc 1 123 44
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rdx, rax
+	.loc 1 123 21
+	mov	eax, DWORD PTR -24[rbp]
+	sub	eax, DWORD PTR -60[rbp]
+	cdqe
+	.loc 1 123 18
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rcx
+	.loc 1 123 44
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 123 29
+	movss	DWORD PTR [rax], xmm0
+.L18:
+	.loc 1 113 33 discriminator 2
+	add	DWORD PTR -24[rbp], 1
+.L16:
+	.loc 1 113 26 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -64[rbp]
+	jl	.L19
+.LBE5:
+	.loc 1 126 12
+	movss	xmm0, DWORD PTR -20[rbp]
+	.loc 1 127 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	fdafFilter_Evaluate, .-fdafFilter_Evaluate
+	.type	fdafFilter_CompleteBlock, @function
+fdafFilter_CompleteBlock:
+.LFB11:
+	.loc 1 134 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r12
+	push	rbx
+	sub	rsp, 48
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	mov	QWORD PTR -56[rbp], rdi
+	.loc 1 135 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 136 15
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, 1
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 138 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 152[rax]
+	.loc 1 138 8
+	cmp	DWORD PTR -28[rbp], eax
+	je	.L22
+	.loc 1 140 9
+	mov	rax, QWORD PTR -56[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	fdafFilter_Spectrum
+	mov	rdx, rax
+	.loc 1 140 41
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	.loc 1 140 21
+	mov	rcx, QWORD PTR -56[rbp]
+	add	rcx, 16
+	.loc 1 140 9
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	fft_Forward@PLT
+.L22:
+	.loc 1 143 5
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 143 18
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 120[rax]
+	.loc 1 143 5
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 144 5
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 144 44
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 128[rax]
+	.loc 1 144 19
+	mov	rcx, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR 120[rcx]
+	.loc 1 144 25
+	mov	esi, DWORD PTR -28[rbp]
+	movsx	rsi, esi
+	sal	rsi, 2
+	.loc 1 144 12
+	add	rcx, rsi
+	.loc 1 144 5
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	memcpy@PLT
+	.loc 1 145 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 96[rax]
+	.loc 1 145 37
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 120[rax]
+	.loc 1 145 17
+	mov	rcx, QWORD PTR -56[rbp]
+	add	rcx, 16
+	.loc 1 145 5
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	fft_Forward@PLT
+.LBB6:
+	.loc 1 148 14
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 148 5
+	jmp	.L23
+.L26:
+.LBB7:
+	.loc 1 150 33
+	mov	rax, QWORD PTR -56[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 150 46
+	mov	eax, DWORD PTR -20[rbp]
+	imul	eax, DWORD PTR -28[rbp]
+	mov	edx, eax
+	.loc 1 150 42
+	mov	eax, ecx
+	sub	eax, edx
+	.loc 1 150 19
+	mov	edx, DWORD PTR -28[rbp]
+	cmp	edx, eax
+	cmovle	eax, edx
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 151 26
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR -56[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	fdafFilter_Weights
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 153 9
+	mov	rax, QWORD PTR -56[rbp]
+	mov	r12, QWORD PTR 104[rax]
+	.loc 1 153 74
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rbx, QWORD PTR 96[rax]
+	.loc 1 153 36
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR -56[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	fdafFilter_Spectrum
+	mov	rdi, rax
+	.loc 1 153 9
+	mov	eax, DWORD PTR -32[rbp]
+	mov	r9d, 0
+	mov	r8d, 1
+	mov	ecx, eax
+	mov	rdx, r12
+	mov	rsi, rbx
+	call	fdafFilter_MultiplySpectra
+	.loc 1 155 9
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 120[rax]
+	.loc 1 155 41
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 155 21
+	mov	rcx, QWORD PTR -56[rbp]
+	add	rcx, 16
+	.loc 1 155 9
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	fft_Inverse@PLT
+	.loc 1 156 43
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, eax
+	.loc 1 156 55
+	sub	eax, DWORD PTR -36[rbp]
+	cdqe
+	.loc 1 156 9
+	lea	rdx, 0[0+rax*4]
+	.loc 1 156 23
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 120[rax]
+	.loc 1 156 29
+	mov	ecx, DWORD PTR -36[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	.loc 1 156 16
+	add	rax, rcx
+	.loc 1 156 9
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 157 9
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 104[rax]
+	.loc 1 157 41
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 120[rax]
+	.loc 1 157 21
+	mov	rcx, QWORD PTR -56[rbp]
+	add	rcx, 16
+	.loc 1 157 9
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	fft_Forward@PLT
+.LBB8:
+	.loc 1 159 18
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 159 9
+	jmp	.L24
+.L25:
+	.loc 1 161 20 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 161 33 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 161 48 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 161 62 discriminator 3
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 161 40 discriminator 3
+	mulss	xmm0, xmm2
+	.loc 1 161 20 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 161 24 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 159 45 discriminator 3
+	add	DWORD PTR -24[rbp], 1
+.L24:
+	.loc 1 159 31 discriminator 1
+	mov	eax, DWORD PTR -32[rbp]
+	add	eax, eax
+	.loc 1 159 27 discriminator 1
+	cmp	DWORD PTR -24[rbp], eax
+	jl	.L25
+.LBE8:
+.LBE7:
+	.loc 1 148 51 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L23:
+	.loc 1 148 31 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 148 23 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jl	.L26
+.LBE6:
+	.loc 1 166 27
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, DWORD PTR 80[rax]
+	.loc 1 166 42
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 166 34
+	add	eax, edx
+	.loc 1 166 60
+	lea	edx, -1[rax]
+	.loc 1 166 73
+	mov	rax, QWORD PTR -56[rbp]
+	mov	ecx, DWORD PTR 12[rax]
+	.loc 1 166 65
+	mov	eax, edx
+	cdq
+	idiv	ecx
+	.loc 1 166 18
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 80[rax], edx
+	.loc 1 167 5
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 167 34
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	.loc 1 167 41
+	mov	ecx, DWORD PTR -28[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	.loc 1 167 27
+	add	rcx, rax
+	.loc 1 167 18
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	.loc 1 167 5
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 168 5
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 168 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	.loc 1 168 26
+	mov	ecx, DWORD PTR -28[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	.loc 1 168 12
+	add	rax, rcx
+	.loc 1 168 5
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 169 5
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 169 18
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 128[rax]
+	.loc 1 169 5
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 170 18
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 148[rax], 0
+	.loc 1 171 26
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 152[rax], -1
+	.loc 1 172 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	fdafFilter_PreparePastOutput
+	.loc 1 173 1
+	nop
+	add	rsp, 48
+	pop	rbx
+	pop	r12
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	fdafFilter_CompleteBlock, .-fdafFilter_CompleteBlock
+	.type	fdafFilter_Store, @function
+fdafFilter_Store:
+.LFB12:
+	.loc 1 182 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 183 11
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 112[rax]
+	.loc 1 183 25
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, DWORD PTR 8[rax]
+	.loc 1 183 45
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	.loc 1 183 37
+	add	eax, ecx
+	cdqe
+	.loc 1 183 18
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 183 53
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 184 11
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 136[rax]
+	.loc 1 184 29
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	cdqe
+	.loc 1 184 22
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 184 43
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 185 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 185 9
+	lea	edx, 1[rax]
+	.loc 1 185 8
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 144[rax], edx
+	.loc 1 185 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 144[rax]
+	.loc 1 185 39
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 185 8
+	cmp	edx, eax
+	jne	.L28
+	.loc 1 187 28
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 144[rax], 0
+.L28:
+	.loc 1 189 18
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 136[rax]
+	.loc 1 189 36
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 189 57
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	esi, DWORD PTR 4[rdx]
+	.loc 1 189 49
+	cdq
+	idiv	esi
+	mov	eax, edx
+	cdqe
+	.loc 1 189 29
+	sal	rax, 2
+	add	rax, rcx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 190 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	fdafFilter_Store, .-fdafFilter_Store
+	.globl	fdafFilter_BlockSize
+	.type	fdafFilter_BlockSize, @function
+fdafFilter_BlockSize:
+.LFB13:
+	.loc 1 193 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 194 27
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edx, 2
+	cmp	eax, edx
+	cmovl	eax, edx
+	mov	edi, eax
+	call	fft_NextPowerOfTwo@PLT
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 196 82
+	mov	eax, DWORD PTR -4[rbp]
+	mov	edx, 256
+	cmp	eax, edx
+	cmovg	eax, edx
+	.loc 1 197 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	fdafFilter_BlockSize, .-fdafFilter_BlockSize
+	.section	.rodata
+.LC3:
+	.string	"Wrong filter length %d\n"
+	.align 8
+.LC4:
+	.string	"Error allocating filter of length %d\n"
+	.text
+	.globl	fdafFilter_Init
+	.type	fdafFilter_Init, @function
+fdafFilter_Init:
+.LFB14:
+	.loc 1 200 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -56[rbp], rdi
+	movss	DWORD PTR -60[rbp], xmm0
+	mov	DWORD PTR -64[rbp], esi
+	.loc 1 201 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 203 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, 168
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 204 8
+	cmp	DWORD PTR -64[rbp], 0
+	jg	.L33
+	.loc 1 206 9
+	mov	eax, DWORD PTR -64[rbp]
+	mov	esi, eax
+	lea	rax, .LC3[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 207 16
+	mov	eax, 1
+	jmp	.L34
+.L33:
+	.loc 1 209 18
+	mov	rax, QWORD PTR -56[rbp]
+	movss	xmm0, DWORD PTR -60[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 210 20
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, DWORD PTR -64[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 211 25
+	mov	eax, DWORD PTR -64[rbp]
+	mov	edi, eax
+	call	fdafFilter_BlockSize
+	.loc 1 211 23
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	DWORD PTR 8[rdx], eax
+	.loc 1 212 47
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, DWORD PTR 8[rax]
+	.loc 1 212 39
+	mov	eax, DWORD PTR -64[rbp]
+	add	eax, edx
+	.loc 1 212 59
+	lea	ecx, -1[rax]
+	.loc 1 212 72
+	mov	rax, QWORD PTR -56[rbp]
+	mov	esi, DWORD PTR 8[rax]
+	.loc 1 212 64
+	mov	eax, ecx
+	cdq
+	idiv	esi
+	mov	edx, eax
+	.loc 1 212 29
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 12[rax], edx
+	.loc 1 213 26
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 152[rax], -1
+	.loc 1 215 42
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 215 9
+	lea	edx, [rax+rax]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, 16
+	mov	esi, edx
+	mov	rdi, rax
+	call	fft_Init@PLT
+	.loc 1 215 8
+	test	eax, eax
+	je	.L35
+	.loc 1 217 16
+	mov	eax, 1
+	jmp	.L34
+.L35:
+	.loc 1 220 70
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 220 56
+	cdqe
+	.loc 1 220 31
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 221 73
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 221 59
+	cdqe
+	.loc 1 221 85
+	add	rax, 1
+	.loc 1 221 29
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 222 56
+	mov	eax, DWORD PTR -64[rbp]
+	cdqe
+	.loc 1 222 31
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 223 50
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 223 36
+	cdqe
+	.loc 1 223 34
+	add	rax, rax
+	.loc 1 223 68
+	add	rax, 3
+	.loc 1 223 73
+	imul	rax, QWORD PTR -24[rbp]
+	mov	rcx, rax
+	.loc 1 223 88
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 223 84
+	lea	rdx, [rcx+rax]
+	.loc 1 223 18
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 225 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r8, QWORD PTR [rax]
+	.loc 1 225 41
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 225 22
+	mov	rcx, QWORD PTR -40[rbp]
+	mov	edx, 64
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	r8
+.LVL0:
+	.loc 1 225 20
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	QWORD PTR 160[rdx], rax
+	.loc 1 226 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 160[rax]
+	.loc 1 226 8
+	test	rax, rax
+	jne	.L36
+	.loc 1 228 9
+	mov	eax, DWORD PTR -64[rbp]
+	mov	esi, eax
+	lea	rax, .LC4[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 229 9
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, 16
+	mov	rdi, rax
+	call	fft_Free@PLT
+	.loc 1 230 16
+	mov	eax, 1
+	jmp	.L34
+.L36:
+	.loc 1 232 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 160[rax]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 234 20
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 160[rax]
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 235 21
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	.loc 1 236 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 236 37
+	imul	rax, QWORD PTR -24[rbp]
+	.loc 1 236 10
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 237 21
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	.loc 1 238 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 238 37
+	imul	rax, QWORD PTR -24[rbp]
+	.loc 1 238 10
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 239 24
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 88[rax], rdx
+	.loc 1 240 10
+	mov	rax, QWORD PTR -24[rbp]
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 241 27
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 96[rax], rdx
+	.loc 1 242 10
+	mov	rax, QWORD PTR -24[rbp]
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 243 26
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 104[rax], rdx
+	.loc 1 244 10
+	mov	rax, QWORD PTR -24[rbp]
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 245 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 112[rax], rdx
+	.loc 1 246 15
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rax
+	.loc 1 246 10
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 247 18
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 120[rax], rdx
+	.loc 1 248 15
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rax
+	.loc 1 248 10
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 249 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 128[rax], rdx
+	.loc 1 250 10
+	mov	rax, QWORD PTR -16[rbp]
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 251 23
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 136[rax], rdx
+	.loc 1 253 12
+	mov	eax, 0
+.L34:
+	.loc 1 254 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	fdafFilter_Init, .-fdafFilter_Init
+	.globl	fdafFilter_Free
+	.type	fdafFilter_Free, @function
+fdafFilter_Free:
+.LFB15:
+	.loc 1 257 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 258 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 260 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 260 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 160[rax]
+	.loc 1 260 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 260 5
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+	.loc 1 261 5
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 16
+	mov	rdi, rax
+	call	fft_Free@PLT
+	.loc 1 262 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 160[rax], 0
+	.loc 1 263 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	fdafFilter_Free, .-fdafFilter_Free
+	.globl	fdafFilter_PushSample
+	.type	fdafFilter_PushSample, @function
+fdafFilter_PushSample:
+.LFB16:
+	.loc 1 266 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 267 5
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	fdafFilter_Store
+	.loc 1 268 11
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 128[rax]
+	.loc 1 268 25
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	cdqe
+	.loc 1 268 18
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 268 33
+	pxor	xmm0, xmm0
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 269 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 152[rax], -1
+	.loc 1 270 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	.loc 1 270 9
+	lea	edx, 1[rax]
+	.loc 1 270 8
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 148[rax], edx
+	.loc 1 270 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 148[rax]
+	.loc 1 270 33
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 270 8
+	cmp	edx, eax
+	jne	.L40
+	.loc 1 272 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	fdafFilter_CompleteBlock
+.L40:
+	.loc 1 274 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	fdafFilter_PushSample, .-fdafFilter_PushSample
+	.globl	fdafFilter_ProcessBlock
+	.type	fdafFilter_ProcessBlock, @function
+fdafFilter_ProcessBlock:
+.LFB17:
+	.loc 1 278 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	mov	QWORD PTR -64[rbp], rcx
+	mov	QWORD PTR -72[rbp], r8
+	mov	DWORD PTR -76[rbp], r9d
+	.loc 1 279 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 280 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 281 9
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 283 11
+	jmp	.L42
+.L53:
+.LBB9:
+	.loc 1 285 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 286 13
+	mov	eax, DWORD PTR -20[rbp]
+	sub	eax, DWORD PTR -24[rbp]
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 287 34
+	mov	eax, DWORD PTR -76[rbp]
+	sub	eax, DWORD PTR -8[rbp]
+	.loc 1 287 12
+	cmp	DWORD PTR -12[rbp], eax
+	jle	.L43
+	.loc 1 289 19
+	mov	eax, DWORD PTR -76[rbp]
+	sub	eax, DWORD PTR -8[rbp]
+	mov	DWORD PTR -12[rbp], eax
+.L43:
+.LBB10:
+	.loc 1 294 18
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 294 9
+	jmp	.L44
+.L47:
+.LBB11:
+	.loc 1 296 67
+	mov	edx, DWORD PTR -8[rbp]
+	mov	eax, DWORD PTR -16[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 296 64
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 296 34
+	mov	edx, DWORD PTR [rax]
+	mov	rax, QWORD PTR -40[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	fdafFilter_Store
+	movd	eax, xmm0
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 297 74
+	cmp	QWORD PTR -56[rbp], 0
+	je	.L45
+	.loc 1 297 69 discriminator 1
+	mov	edx, DWORD PTR -8[rbp]
+	mov	eax, DWORD PTR -16[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 297 66 discriminator 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 297 74 discriminator 1
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L46
+.L45:
+	.loc 1 297 74 is_stmt 0 discriminator 2
+	movss	xmm0, DWORD PTR -28[rbp]
+.L46:
+	.loc 1 297 19 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 128[rax]
+	.loc 1 297 32 discriminator 4
+	mov	ecx, DWORD PTR -24[rbp]
+	mov	edx, DWORD PTR -16[rbp]
+	add	edx, ecx
+	movsx	rdx, edx
+	.loc 1 297 26 discriminator 4
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 297 37 discriminator 4
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 298 19 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	.loc 1 298 25 discriminator 4
+	lea	edx, 1[rax]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 148[rax], edx
+.LBE11:
+	.loc 1 294 37 discriminator 4
+	add	DWORD PTR -16[rbp], 1
+.L44:
+	.loc 1 294 27 discriminator 2
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jl	.L47
+.LBE10:
+	.loc 1 301 13
+	cmp	QWORD PTR -72[rbp], 0
+	je	.L48
+	.loc 1 302 95 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 301 13 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	lea	r8, [rdx+rax]
+	jmp	.L49
+.L48:
+	.loc 1 301 13 is_stmt 0 discriminator 2
+	mov	r8d, 0
+.L49:
+	.loc 1 301 13 discriminator 4
+	cmp	QWORD PTR -64[rbp], 0
+	je	.L50
+	.loc 1 302 59 is_stmt 1 discriminator 5
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 301 13 discriminator 5
+	mov	rax, QWORD PTR -64[rbp]
+	lea	rdi, [rdx+rax]
+	jmp	.L51
+.L50:
+	.loc 1 301 13 is_stmt 0 discriminator 6
+	mov	edi, 0
+.L51:
+	.loc 1 301 68 is_stmt 1 discriminator 8
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 128[rax]
+	.loc 1 301 75 discriminator 8
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	.loc 1 301 61 discriminator 8
+	lea	rcx, [rax+rdx]
+	.loc 1 301 13 discriminator 8
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR 148[rax]
+	mov	esi, DWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	r9, r8
+	mov	r8, rdi
+	mov	rdi, rax
+	call	fdafFilter_Evaluate
+	movd	eax, xmm0
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 303 19 discriminator 8
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	.loc 1 303 12 discriminator 8
+	cmp	DWORD PTR -20[rbp], eax
+	jne	.L52
+	.loc 1 305 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	fdafFilter_CompleteBlock
+.L52:
+	.loc 1 307 11
+	mov	eax, DWORD PTR -12[rbp]
+	add	DWORD PTR -8[rbp], eax
+.L42:
+.LBE9:
+	.loc 1 283 14
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -76[rbp]
+	jl	.L53
+	.loc 1 311 13
+	movss	xmm0, DWORD PTR -4[rbp]
+	movss	xmm1, DWORD PTR .LC5[rip]
+	andps	xmm1, xmm0
+	.loc 1 311 46
+	movss	xmm0, DWORD PTR .LC6[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	movzx	eax, al
+	.loc 1 312 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	fdafFilter_ProcessBlock, .-fdafFilter_ProcessBlock
+	.globl	fdafFilter_GetCoefficients
+	.type	fdafFilter_GetCoefficients, @function
+fdafFilter_GetCoefficients:
+.LFB18:
+	.loc 1 315 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 40
+	.cfi_offset 3, -24
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+.LBB12:
+	.loc 1 317 14
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 317 5
+	jmp	.L56
+.L60:
+	.loc 1 319 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rbx, QWORD PTR 120[rax]
+	.loc 1 319 35
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	fdafFilter_Weights
+	mov	rcx, rax
+	.loc 1 319 21
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 16
+	.loc 1 319 9
+	mov	rdx, rbx
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fft_Inverse@PLT
+.LBB13:
+	.loc 1 320 18
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 320 9
+	jmp	.L57
+.L59:
+	.loc 1 322 84 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 120[rax]
+	.loc 1 322 90 discriminator 4
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rdx, rax
+	.loc 1 322 32 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 322 41 discriminator 4
+	lea	esi, -1[rax]
+	.loc 1 322 58 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 322 50 discriminator 4
+	imul	eax, DWORD PTR -20[rbp]
+	mov	ecx, eax
+	.loc 1 322 70 discriminator 4
+	mov	eax, DWORD PTR -24[rbp]
+	add	eax, ecx
+	.loc 1 322 45 discriminator 4
+	sub	esi, eax
+	mov	ecx, esi
+	movsx	rax, ecx
+	.loc 1 322 25 discriminator 4
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rcx
+	.loc 1 322 90 discriminator 4
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 322 76 discriminator 4
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 320 99 discriminator 4
+	add	DWORD PTR -24[rbp], 1
+.L57:
+	.loc 1 320 36 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 320 49 discriminator 1
+	cmp	DWORD PTR -24[rbp], eax
+	jge	.L58
+	.loc 1 320 63 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 320 55 discriminator 3
+	imul	eax, DWORD PTR -20[rbp]
+	mov	edx, eax
+	.loc 1 320 75 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	add	edx, eax
+	.loc 1 320 87 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 320 49 discriminator 3
+	cmp	edx, eax
+	jl	.L59
+.L58:
+.LBE13:
+	.loc 1 317 51 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L56:
+	.loc 1 317 31 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 317 23 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jl	.L60
+.LBE12:
+	.loc 1 325 1
+	nop
+	nop
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	fdafFilter_GetCoefficients, .-fdafFilter_GetCoefficients
+	.section	.rodata
+	.align 4
+.LC0:
+	.long	-1082130432
+	.align 4
+.LC1:
+	.long	1065353216
+	.align 16
+.LC5:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC6:
+	.long	2139095039
+	.text
+.Letext0:
+	.file 2 "include/lmsAllocator.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "include/fft.h"
+	.file 5 "include/fdafFilter.h"
+	.file 6 "/usr/include/stdio.h"
+	.file 7 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xa4b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF89
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xe
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0xa
+	.long	0x2e
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x46
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0xa
+	.long	0x85
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x19
+	.uleb128 0x6
+	.long	0x8c
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0xa
+	.long	0xa3
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x5
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0x10
+	.byte	0x18
+	.byte	0x2
+	.byte	0x10
+	.long	0xed
+	.uleb128 0x1
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x13
+	.byte	0xd
+	.long	0x106
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x16
+	.byte	0xc
+	.long	0x11b
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x18
+	.byte	0xb
+	.long	0x83
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1a
+	.long	0x83
+	.long	0x106
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0xed
+	.uleb128 0x1b
+	.long	0x11b
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x83
+	.byte	0
+	.uleb128 0x6
+	.long	0x10b
+	.uleb128 0xe
+	.long	.LASF19
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0xbd
+	.uleb128 0xa
+	.long	0x120
+	.uleb128 0x6
+	.long	0x60
+	.uleb128 0x10
+	.byte	0x30
+	.byte	0x4
+	.byte	0xc
+	.long	0x18d
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x4
+	.byte	0xe
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x4
+	.byte	0xf
+	.byte	0xc
+	.long	0x18d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x10
+	.byte	0xc
+	.long	0x18d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x11
+	.byte	0xa
+	.long	0x192
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x4
+	.byte	0x12
+	.byte	0xc
+	.long	0x18d
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x13
+	.byte	0xb
+	.long	0x83
+	.byte	0x28
+	.byte	0
+	.uleb128 0x6
+	.long	0xa3
+	.uleb128 0x6
+	.long	0x46
+	.uleb128 0xe
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x14
+	.byte	0x3
+	.long	0x136
+	.uleb128 0xa
+	.long	0x197
+	.uleb128 0x10
+	.byte	0xa8
+	.byte	0x5
+	.byte	0x12
+	.long	0x2a8
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x5
+	.byte	0x14
+	.byte	0xb
+	.long	0xa3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x15
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x5
+	.byte	0x16
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x17
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1c
+	.string	"fft"
+	.byte	0x5
+	.byte	0x18
+	.byte	0xb
+	.long	0x197
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x5
+	.byte	0x19
+	.byte	0xc
+	.long	0x18d
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x5
+	.byte	0x1a
+	.byte	0xc
+	.long	0x18d
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x9
+	.long	0x46
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x5
+	.byte	0x1c
+	.byte	0xc
+	.long	0x18d
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x1d
+	.byte	0xc
+	.long	0x18d
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x1e
+	.byte	0xc
+	.long	0x18d
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x1f
+	.byte	0xc
+	.long	0x18d
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x20
+	.byte	0xc
+	.long	0x18d
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x21
+	.byte	0xc
+	.long	0x18d
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x22
+	.byte	0xc
+	.long	0x18d
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x23
+	.byte	0x9
+	.long	0x46
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x5
+	.byte	0x24
+	.byte	0x9
+	.long	0x46
+	.byte	0x94
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x25
+	.byte	0x9
+	.long	0x46
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x26
+	.byte	0xb
+	.long	0x83
+	.byte	0xa0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x27
+	.byte	0x3
+	.long	0x1a8
+	.uleb128 0xa
+	.long	0x2a8
+	.uleb128 0x11
+	.long	.LASF48
+	.byte	0x22
+	.long	0x2c9
+	.uleb128 0x2
+	.long	0x2c9
+	.byte	0
+	.uleb128 0x6
+	.long	0x197
+	.uleb128 0xb
+	.long	.LASF44
+	.byte	0x2
+	.byte	0x43
+	.byte	0x8
+	.long	0x2e
+	.long	0x2e4
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF45
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x5
+	.long	0x46
+	.long	0x2ff
+	.uleb128 0x2
+	.long	0x2c9
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF46
+	.byte	0x6
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0x317
+	.uleb128 0x2
+	.long	0x9e
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF90
+	.byte	0x2
+	.byte	0x27
+	.byte	0x17
+	.long	0x323
+	.uleb128 0x6
+	.long	0x12c
+	.uleb128 0xb
+	.long	.LASF47
+	.byte	0x4
+	.byte	0x39
+	.byte	0x5
+	.long	0x46
+	.long	0x33e
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF49
+	.byte	0x32
+	.long	0x358
+	.uleb128 0x2
+	.long	0x358
+	.uleb128 0x2
+	.long	0x35d
+	.uleb128 0x2
+	.long	0x18d
+	.byte	0
+	.uleb128 0x6
+	.long	0x1a3
+	.uleb128 0x6
+	.long	0xaa
+	.uleb128 0xb
+	.long	.LASF50
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xe
+	.long	0x83
+	.long	0x382
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF51
+	.byte	0x2a
+	.long	0x39c
+	.uleb128 0x2
+	.long	0x358
+	.uleb128 0x2
+	.long	0x35d
+	.uleb128 0x2
+	.long	0x18d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF52
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x3bc
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF61
+	.value	0x13a
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x436
+	.uleb128 0x9
+	.long	.LASF53
+	.value	0x13a
+	.byte	0x2f
+	.long	0x436
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.long	.LASF54
+	.value	0x13a
+	.byte	0x3e
+	.long	0x18d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0xc
+	.string	"p"
+	.value	0x13d
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x7
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.uleb128 0xc
+	.string	"j"
+	.value	0x140
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2a8
+	.uleb128 0x20
+	.long	.LASF66
+	.byte	0x1
+	.value	0x114
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x556
+	.uleb128 0x9
+	.long	.LASF53
+	.value	0x114
+	.byte	0x2b
+	.long	0x436
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.long	.LASF37
+	.value	0x114
+	.byte	0x40
+	.long	0x35d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x9
+	.long	.LASF55
+	.value	0x114
+	.byte	0x54
+	.long	0x35d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x9
+	.long	.LASF56
+	.value	0x115
+	.byte	0x24
+	.long	0x18d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x9
+	.long	.LASF38
+	.value	0x115
+	.byte	0x33
+	.long	0x18d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x9
+	.long	.LASF57
+	.value	0x115
+	.byte	0x3e
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0xd
+	.long	.LASF29
+	.value	0x117
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xc
+	.string	"y"
+	.value	0x118
+	.byte	0xb
+	.long	0xa3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xc
+	.string	"n"
+	.value	0x119
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0xd
+	.long	.LASF58
+	.value	0x11d
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.long	.LASF59
+	.value	0x11e
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x7
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0xc
+	.string	"i"
+	.value	0x126
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0xd
+	.long	.LASF60
+	.value	0x128
+	.byte	0x19
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF62
+	.value	0x109
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x592
+	.uleb128 0x9
+	.long	.LASF53
+	.value	0x109
+	.byte	0x2a
+	.long	0x436
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x9
+	.long	.LASF63
+	.value	0x109
+	.byte	0x38
+	.long	0xa3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF64
+	.value	0x100
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5ce
+	.uleb128 0x9
+	.long	.LASF53
+	.value	0x100
+	.byte	0x24
+	.long	0x436
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.long	.LASF65
+	.value	0x102
+	.byte	0x1b
+	.long	0x323
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF67
+	.byte	0xc7
+	.long	0x46
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x670
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0xc7
+	.byte	0x23
+	.long	0x436
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0xc7
+	.byte	0x31
+	.long	0xa3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0xc7
+	.byte	0x3b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF65
+	.byte	0xc9
+	.byte	0x1b
+	.long	0x323
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF68
+	.byte	0xdc
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF69
+	.byte	0xdd
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF70
+	.byte	0xde
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0xdf
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0xea
+	.byte	0x14
+	.long	0x131
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF73
+	.byte	0xc0
+	.long	0x46
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6ad
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0xc0
+	.byte	0x1e
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0xc2
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF76
+	.byte	0xb5
+	.byte	0x15
+	.long	0xa3
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6eb
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0xb5
+	.byte	0x34
+	.long	0x436
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF63
+	.byte	0xb5
+	.byte	0x42
+	.long	0xa3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF79
+	.byte	0x85
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x79d
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x85
+	.byte	0x34
+	.long	0x436
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x87
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0x88
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x8
+	.string	"p"
+	.byte	0x94
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x7
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x4
+	.long	.LASF75
+	.byte	0x96
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x97
+	.byte	0x10
+	.long	0x18d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x8
+	.string	"k"
+	.byte	0x9f
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF77
+	.byte	0x1
+	.byte	0x61
+	.byte	0xe
+	.long	0xa3
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x86d
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x61
+	.byte	0x30
+	.long	0x436
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF58
+	.byte	0x61
+	.byte	0x3c
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0xf
+	.string	"to"
+	.byte	0x61
+	.byte	0x46
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF55
+	.byte	0x61
+	.byte	0x57
+	.long	0x35d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x62
+	.byte	0x29
+	.long	0x18d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x62
+	.byte	0x38
+	.long	0x18d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x64
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0x65
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0x66
+	.byte	0xc
+	.long	0x18d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.string	"y"
+	.byte	0x67
+	.byte	0xb
+	.long	0xa3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x7
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x8
+	.string	"i"
+	.byte	0x71
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF80
+	.byte	0x4b
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8c4
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x4b
+	.byte	0x38
+	.long	0x436
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF74
+	.byte	0x4d
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x8
+	.string	"p"
+	.byte	0x50
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF81
+	.byte	0x40
+	.byte	0x16
+	.long	0x18d
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x910
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x40
+	.byte	0x3e
+	.long	0x910
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xf
+	.string	"age"
+	.byte	0x40
+	.byte	0x4a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0x42
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x6
+	.long	0x2b4
+	.uleb128 0x13
+	.long	.LASF83
+	.byte	0x38
+	.byte	0x16
+	.long	0x18d
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x953
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x38
+	.byte	0x3d
+	.long	0x910
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF84
+	.byte	0x38
+	.byte	0x49
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF91
+	.byte	0x1
+	.byte	0x1d
+	.byte	0xd
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xf
+	.string	"a"
+	.byte	0x1d
+	.byte	0x35
+	.long	0x35d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xf
+	.string	"b"
+	.byte	0x1d
+	.byte	0x45
+	.long	0x35d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.long	.LASF85
+	.byte	0x1d
+	.byte	0x4f
+	.long	0x18d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF74
+	.byte	0x1d
+	.byte	0x5b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x3
+	.long	.LASF86
+	.byte	0x1e
+	.byte	0x2c
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF87
+	.byte	0x1e
+	.byte	0x3b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x4
+	.long	.LASF88
+	.byte	0x20
+	.byte	0x11
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x8
+	.string	"k"
+	.byte	0x22
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x7
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x8
+	.string	"ar"
+	.byte	0x24
+	.byte	0x15
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x8
+	.string	"ai"
+	.byte	0x25
+	.byte	0x15
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x8
+	.string	"br"
+	.byte	0x26
+	.byte	0x15
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x8
+	.string	"bi"
+	.byte	0x27
+	.byte	0x15
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.string	"re"
+	.byte	0x28
+	.byte	0x15
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x8
+	.string	"im"
+	.byte	0x29
+	.byte	0x15
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF61:
+	.string	"fdafFilter_GetCoefficients"
+.LASF85:
+	.string	"result"
+.LASF90:
+	.string	"lmsAllocator_Heap"
+.LASF24:
+	.string	"work"
+.LASF69:
+	.string	"binBytes"
+.LASF89:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF9:
+	.string	"short int"
+.LASF18:
+	.string	"size_t"
+.LASF37:
+	.string	"input"
+.LASF32:
+	.string	"spectra"
+.LASF51:
+	.string	"fft_Forward"
+.LASF73:
+	.string	"fdafFilter_BlockSize"
+.LASF26:
+	.string	"Fft_t"
+.LASF77:
+	.string	"fdafFilter_Evaluate"
+.LASF29:
+	.string	"blockSize"
+.LASF14:
+	.string	"long double"
+.LASF87:
+	.string	"accumulate"
+.LASF80:
+	.string	"fdafFilter_PreparePastOutput"
+.LASF50:
+	.string	"memcpy"
+.LASF41:
+	.string	"fill"
+.LASF33:
+	.string	"head"
+.LASF36:
+	.string	"workSpectrum"
+.LASF76:
+	.string	"fdafFilter_Store"
+.LASF67:
+	.string	"fdafFilter_Init"
+.LASF65:
+	.string	"heap"
+.LASF45:
+	.string	"fft_Init"
+.LASF34:
+	.string	"pastOutput"
+.LASF28:
+	.string	"length"
+.LASF25:
+	.string	"memory"
+.LASF12:
+	.string	"float"
+.LASF60:
+	.string	"oldest"
+.LASF4:
+	.string	"long long int"
+.LASF84:
+	.string	"partition"
+.LASF52:
+	.string	"memset"
+.LASF75:
+	.string	"taps"
+.LASF21:
+	.string	"twiddles"
+.LASF46:
+	.string	"printf"
+.LASF17:
+	.string	"context"
+.LASF43:
+	.string	"FdafFilter_t"
+.LASF70:
+	.string	"delayBytes"
+.LASF5:
+	.string	"unsigned char"
+.LASF62:
+	.string	"fdafFilter_PushSample"
+.LASF16:
+	.string	"release"
+.LASF47:
+	.string	"fft_NextPowerOfTwo"
+.LASF23:
+	.string	"bitReverse"
+.LASF30:
+	.string	"numOfPartitions"
+.LASF8:
+	.string	"signed char"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF78:
+	.string	"current"
+.LASF7:
+	.string	"unsigned int"
+.LASF71:
+	.string	"totalBytes"
+.LASF82:
+	.string	"slot"
+.LASF79:
+	.string	"fdafFilter_CompleteBlock"
+.LASF15:
+	.string	"allocate"
+.LASF63:
+	.string	"sample"
+.LASF68:
+	.string	"blockBytes"
+.LASF6:
+	.string	"short unsigned int"
+.LASF54:
+	.string	"coefficients"
+.LASF10:
+	.string	"char"
+.LASF86:
+	.string	"conjugate"
+.LASF81:
+	.string	"fdafFilter_Spectrum"
+.LASF40:
+	.string	"delayIndex"
+.LASF57:
+	.string	"numOfSamples"
+.LASF39:
+	.string	"delayLine"
+.LASF91:
+	.string	"fdafFilter_MultiplySpectra"
+.LASF53:
+	.string	"filter"
+.LASF2:
+	.string	"long unsigned int"
+.LASF88:
+	.string	"sign"
+.LASF13:
+	.string	"double"
+.LASF66:
+	.string	"fdafFilter_ProcessBlock"
+.LASF19:
+	.string	"LmsAllocator_t"
+.LASF31:
+	.string	"weights"
+.LASF44:
+	.string	"lmsAllocator_AlignedSize"
+.LASF20:
+	.string	"size"
+.LASF59:
+	.string	"count"
+.LASF83:
+	.string	"fdafFilter_Weights"
+.LASF22:
+	.string	"realTwiddles"
+.LASF56:
+	.string	"output"
+.LASF49:
+	.string	"fft_Inverse"
+.LASF38:
+	.string	"error"
+.LASF64:
+	.string	"fdafFilter_Free"
+.LASF48:
+	.string	"fft_Free"
+.LASF42:
+	.string	"spectrumFill"
+.LASF3:
+	.string	"long int"
+.LASF74:
+	.string	"numOfBins"
+.LASF55:
+	.string	"desired"
+.LASF27:
+	.string	"step"
+.LASF58:
+	.string	"from"
+.LASF72:
+	.string	"next"
+.LASF35:
+	.string	"errorSpectrum"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"source/fdafFilter.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2860 @@
+	.file	"fft.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/fft.c"
+	.type	fft_Complex, @function
+fft_Complex:
+.LFB6:
+	.file 1 "source/fft.c"
+	.loc 1 24 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	DWORD PTR -84[rbp], edx
+	.loc 1 25 22
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 25 15
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 26 39
+	cmp	DWORD PTR -84[rbp], 0
+	je	.L2
+	.loc 1 26 39 is_stmt 0 discriminator 1
+	movss	xmm0, DWORD PTR .LC0[rip]
+	jmp	.L3
+.L2:
+	.loc 1 26 39 discriminator 2
+	movss	xmm0, DWORD PTR .LC1[rip]
+.L3:
+	.loc 1 26 17 is_stmt 1 discriminator 4
+	movss	DWORD PTR -24[rbp], xmm0
+.LBB2:
+	.loc 1 28 14 discriminator 4
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 28 24 discriminator 4
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 28 5 discriminator 4
+	jmp	.L4
+.L9:
+.LBB3:
+	.loc 1 30 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 30 9
+	jmp	.L5
+.L8:
+.LBB4:
+	.loc 1 32 22
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 32 13
+	jmp	.L6
+.L7:
+.LBB5:
+	.loc 1 34 37 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	.loc 1 34 54 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	imul	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 34 47 discriminator 3
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 34 29 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -28[rbp], xmm0
+	.loc 1 35 44 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	.loc 1 35 61 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	imul	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	.loc 1 35 54 discriminator 3
+	cdqe
+	add	rax, 1
+	sal	rax, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 35 29 discriminator 3
+	movss	xmm1, DWORD PTR -24[rbp]
+	mulss	xmm0, xmm1
+	movss	DWORD PTR -32[rbp], xmm0
+	.loc 1 36 45 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	mov	eax, DWORD PTR -16[rbp]
+	add	eax, edx
+	.loc 1 36 36 discriminator 3
+	add	eax, eax
+	cdqe
+	.loc 1 36 33 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	.loc 1 36 24 discriminator 3
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 37 45 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	mov	eax, DWORD PTR -16[rbp]
+	add	edx, eax
+	.loc 1 37 49 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, edx
+	.loc 1 37 36 discriminator 3
+	add	eax, eax
+	cdqe
+	.loc 1 37 33 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	.loc 1 37 24 discriminator 3
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 38 35 discriminator 3
+	mov	rax, QWORD PTR -48[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 38 39 discriminator 3
+	mulss	xmm0, DWORD PTR -28[rbp]
+	.loc 1 38 47 discriminator 3
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, 4
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 38 51 discriminator 3
+	mulss	xmm1, DWORD PTR -32[rbp]
+	.loc 1 38 29 discriminator 3
+	subss	xmm0, xmm1
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 39 35 discriminator 3
+	mov	rax, QWORD PTR -48[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 39 39 discriminator 3
+	movaps	xmm1, xmm0
+	mulss	xmm1, DWORD PTR -32[rbp]
+	.loc 1 39 47 discriminator 3
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, 4
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 39 51 discriminator 3
+	mulss	xmm0, DWORD PTR -28[rbp]
+	.loc 1 39 29 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR -56[rbp], xmm0
+	.loc 1 41 25 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 41 29 discriminator 3
+	subss	xmm0, DWORD PTR -52[rbp]
+	.loc 1 41 22 discriminator 3
+	mov	rax, QWORD PTR -48[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 42 25 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 4
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 42 18 discriminator 3
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, 4
+	.loc 1 42 29 discriminator 3
+	subss	xmm0, DWORD PTR -56[rbp]
+	.loc 1 42 22 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 43 18 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 43 22 discriminator 3
+	addss	xmm0, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 44 18 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 4
+	movss	xmm0, DWORD PTR [rax]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 4
+	.loc 1 44 22 discriminator 3
+	addss	xmm0, DWORD PTR -56[rbp]
+	movss	DWORD PTR [rax], xmm0
+.LBE5:
+	.loc 1 32 40 discriminator 3
+	add	DWORD PTR -16[rbp], 1
+.L6:
+	.loc 1 32 31 discriminator 1
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -4[rbp]
+	jl	.L7
+.LBE4:
+	.loc 1 30 51 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	.loc 1 30 46 discriminator 2
+	add	DWORD PTR -12[rbp], eax
+.L5:
+	.loc 1 30 35 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L8
+.LBE3:
+	.loc 1 28 53 discriminator 2
+	sal	DWORD PTR -4[rbp]
+	.loc 1 28 64 discriminator 2
+	mov	eax, DWORD PTR -8[rbp]
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	DWORD PTR -8[rbp], eax
+.L4:
+	.loc 1 28 43 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L9
+.LBE2:
+	.loc 1 48 1
+	nop
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	fft_Complex, .-fft_Complex
+	.globl	fft_NextPowerOfTwo
+	.type	fft_NextPowerOfTwo, @function
+fft_NextPowerOfTwo:
+.LFB7:
+	.loc 1 51 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 52 9
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 54 11
+	jmp	.L11
+.L12:
+	.loc 1 56 15
+	sal	DWORD PTR -4[rbp]
+.L11:
+	.loc 1 54 18
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L12
+	.loc 1 58 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 59 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	fft_NextPowerOfTwo, .-fft_NextPowerOfTwo
+	.section	.rodata
+	.align 8
+.LC2:
+	.string	"FFT size must be a power of two"
+.LC3:
+	.string	"Error allocating FFT"
+	.text
+	.globl	fft_Init
+	.type	fft_Init, @function
+fft_Init:
+.LFB8:
+	.loc 1 62 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 96
+	mov	QWORD PTR -88[rbp], rdi
+	mov	DWORD PTR -92[rbp], esi
+	.loc 1 63 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 64 15
+	mov	eax, DWORD PTR -92[rbp]
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 66 5
+	mov	rax, QWORD PTR -88[rbp]
+	mov	edx, 48
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 67 8
+	cmp	DWORD PTR -92[rbp], 3
+	jle	.L15
+	.loc 1 67 38 discriminator 1
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, 1
+	.loc 1 67 30 discriminator 1
+	and	eax, DWORD PTR -92[rbp]
+	.loc 1 67 20 discriminator 1
+	test	eax, eax
+	je	.L16
+.L15:
+	.loc 1 69 9
+	lea	rax, .LC2[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 70 16
+	mov	eax, 1
+	jmp	.L17
+.L16:
+	.loc 1 73 58
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	.loc 1 73 33
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 74 62
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	.loc 1 74 37
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 75 61
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	.loc 1 75 36
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 76 55
+	mov	eax, DWORD PTR -92[rbp]
+	cdqe
+	.loc 1 76 30
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -72[rbp], rax
+	.loc 1 78 23
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rcx, QWORD PTR [rax]
+	.loc 1 78 62
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rdx, rax
+	.loc 1 78 81
+	mov	rax, QWORD PTR -64[rbp]
+	add	rdx, rax
+	.loc 1 78 19
+	mov	rax, QWORD PTR -72[rbp]
+	lea	rsi, [rdx+rax]
+	.loc 1 78 38
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 78 19
+	mov	edx, 64
+	mov	rdi, rax
+	call	rcx
+.LVL0:
+	.loc 1 78 17
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	QWORD PTR 40[rdx], rax
+	.loc 1 80 12
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 80 8
+	test	rax, rax
+	jne	.L18
+	.loc 1 82 9
+	lea	rax, .LC3[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 83 16
+	mov	eax, 1
+	jmp	.L17
+.L18:
+	.loc 1 85 15
+	mov	rax, QWORD PTR -88[rbp]
+	mov	edx, DWORD PTR -92[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 86 32
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 86 19
+	mov	rax, QWORD PTR -88[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 87 53
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	.loc 1 87 25
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 87 23
+	mov	rax, QWORD PTR -88[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 88 49
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 88 23
+	mov	rax, QWORD PTR -56[rbp]
+	add	rdx, rax
+	.loc 1 88 21
+	mov	rax, QWORD PTR -88[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 89 45
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 89 17
+	mov	rax, QWORD PTR -64[rbp]
+	add	rdx, rax
+	.loc 1 89 15
+	mov	rax, QWORD PTR -88[rbp]
+	mov	QWORD PTR 32[rax], rdx
+.LBB6:
+	.loc 1 92 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 92 5
+	jmp	.L19
+.L20:
+	.loc 1 94 54 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -4[rbp]
+	movsd	xmm0, QWORD PTR .LC4[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 94 39 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -36[rbp]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	cos@PLT
+	.loc 1 94 12 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 94 25 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	add	edx, edx
+	movsx	rdx, edx
+	.loc 1 94 22 discriminator 3
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 94 32 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 94 30 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 95 58 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -4[rbp]
+	movsd	xmm0, QWORD PTR .LC4[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 95 43 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -36[rbp]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	sin@PLT
+	.loc 1 95 12 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 95 25 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	add	edx, edx
+	.loc 1 95 22 discriminator 3
+	movsx	rdx, edx
+	add	rdx, 1
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 95 36 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 95 34 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 92 33 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L19:
+	.loc 1 92 27 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	.loc 1 92 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], eax
+	jl	.L20
+.LBE6:
+.LBB7:
+	.loc 1 97 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 97 5
+	jmp	.L21
+.L22:
+	.loc 1 99 58 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR .LC4[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 99 43 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -92[rbp]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	cos@PLT
+	.loc 1 99 12 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 99 29 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	add	edx, edx
+	movsx	rdx, edx
+	.loc 1 99 26 discriminator 3
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 99 36 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 99 34 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 100 62 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR .LC4[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 100 47 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -92[rbp]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	sin@PLT
+	.loc 1 100 12 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 100 29 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	add	edx, edx
+	.loc 1 100 26 discriminator 3
+	movsx	rdx, edx
+	add	rdx, 1
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 100 40 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 100 38 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 97 29 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L21:
+	.loc 1 97 23 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -36[rbp]
+	jl	.L22
+.LBE7:
+	.loc 1 103 9
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 104 11
+	jmp	.L23
+.L24:
+	.loc 1 106 13
+	add	DWORD PTR -12[rbp], 1
+.L23:
+	.loc 1 104 15
+	mov	eax, DWORD PTR -12[rbp]
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	.loc 1 104 24
+	cmp	DWORD PTR -36[rbp], eax
+	jg	.L24
+.LBB8:
+	.loc 1 108 14
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 108 5
+	jmp	.L25
+.L28:
+.LBB9:
+	.loc 1 110 13
+	mov	DWORD PTR -20[rbp], 0
+.LBB10:
+	.loc 1 111 18
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 111 9
+	jmp	.L26
+.L27:
+	.loc 1 113 29 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	mov	edx, DWORD PTR -16[rbp]
+	mov	ecx, eax
+	sar	edx, cl
+	mov	eax, edx
+	.loc 1 113 35 discriminator 3
+	and	eax, 1
+	mov	edx, eax
+	.loc 1 113 49 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	sub	eax, 1
+	.loc 1 113 53 discriminator 3
+	sub	eax, DWORD PTR -24[rbp]
+	.loc 1 113 40 discriminator 3
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	.loc 1 113 22 discriminator 3
+	or	DWORD PTR -20[rbp], eax
+	.loc 1 111 36 discriminator 3
+	add	DWORD PTR -24[rbp], 1
+.L26:
+	.loc 1 111 27 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jl	.L27
+.LBE10:
+	.loc 1 115 12 discriminator 2
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 115 24 discriminator 2
+	mov	edx, DWORD PTR -16[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rdx, rax
+	.loc 1 115 28 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	mov	DWORD PTR [rdx], eax
+.LBE9:
+	.loc 1 108 29 discriminator 2
+	add	DWORD PTR -16[rbp], 1
+.L25:
+	.loc 1 108 23 discriminator 1
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -36[rbp]
+	jl	.L28
+.LBE8:
+	.loc 1 117 12
+	mov	eax, 0
+.L17:
+	.loc 1 118 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	fft_Init, .-fft_Init
+	.globl	fft_Free
+	.type	fft_Free, @function
+fft_Free:
+.LFB9:
+	.loc 1 121 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 122 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 124 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 124 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 124 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 124 5
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+	.loc 1 125 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, 48
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 126 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	fft_Free, .-fft_Free
+	.globl	fft_Forward
+	.type	fft_Forward, @function
+fft_Forward:
+.LFB10:
+	.loc 1 129 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 104
+	mov	QWORD PTR -88[rbp], rdi
+	mov	QWORD PTR -96[rbp], rsi
+	mov	QWORD PTR -104[rbp], rdx
+	.loc 1 130 22
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 130 15
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 131 12
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	mov	QWORD PTR -24[rbp], rax
+.LBB11:
+	.loc 1 134 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 134 5
+	jmp	.L31
+.L32:
+.LBB12:
+	.loc 1 136 26 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 136 38 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 136 19 discriminator 3
+	mov	eax, DWORD PTR [rax]
+	mov	DWORD PTR -68[rbp], eax
+	.loc 1 137 28 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 137 25 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rdx, rax
+	.loc 1 137 13 discriminator 3
+	mov	eax, DWORD PTR -68[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 137 10 discriminator 3
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rcx
+	.loc 1 137 25 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 137 18 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 138 32 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	.loc 1 138 29 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rdx, rax
+	.loc 1 138 13 discriminator 3
+	mov	eax, DWORD PTR -68[rbp]
+	add	eax, eax
+	.loc 1 138 10 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rcx
+	.loc 1 138 29 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 138 22 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+.LBE12:
+	.loc 1 134 29 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L31:
+	.loc 1 134 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jl	.L32
+.LBE11:
+	.loc 1 140 5
+	mov	rcx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -88[rbp]
+	mov	edx, 0
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fft_Complex
+	.loc 1 143 20
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 143 27
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 4
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 143 24
+	addss	xmm0, xmm1
+	.loc 1 143 17
+	mov	rax, QWORD PTR -104[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 144 13
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 4
+	.loc 1 144 17
+	pxor	xmm0, xmm0
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 145 24
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 145 31
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 4
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 145 16
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 145 13
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 145 28
+	subss	xmm0, xmm1
+	.loc 1 145 21
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 146 16
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, eax
+	.loc 1 146 13
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 146 25
+	pxor	xmm0, xmm0
+	movss	DWORD PTR [rax], xmm0
+.LBB13:
+	.loc 1 147 14
+	mov	DWORD PTR -8[rbp], 1
+	.loc 1 147 5
+	jmp	.L33
+.L34:
+.LBB14:
+	.loc 1 149 30 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 149 27 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 149 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -28[rbp], xmm0
+	.loc 1 150 30 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	.loc 1 150 27 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 150 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -32[rbp], xmm0
+	.loc 1 151 35 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	sub	eax, DWORD PTR -8[rbp]
+	.loc 1 151 30 discriminator 3
+	add	eax, eax
+	cdqe
+	.loc 1 151 27 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 151 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -36[rbp], xmm0
+	.loc 1 152 36 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	sub	eax, DWORD PTR -8[rbp]
+	.loc 1 152 31 discriminator 3
+	add	eax, eax
+	.loc 1 152 28 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 152 21 discriminator 3
+	movss	xmm1, DWORD PTR .LC6[rip]
+	xorps	xmm0, xmm1
+	movss	DWORD PTR -40[rbp], xmm0
+	.loc 1 153 40 discriminator 3
+	movss	xmm0, DWORD PTR -28[rbp]
+	movaps	xmm1, xmm0
+	addss	xmm1, DWORD PTR -36[rbp]
+	.loc 1 153 21 discriminator 3
+	movss	xmm0, DWORD PTR .LC7[rip]
+	mulss	xmm0, xmm1
+	movss	DWORD PTR -44[rbp], xmm0
+	.loc 1 154 40 discriminator 3
+	movss	xmm0, DWORD PTR -32[rbp]
+	movaps	xmm1, xmm0
+	addss	xmm1, DWORD PTR -40[rbp]
+	.loc 1 154 21 discriminator 3
+	movss	xmm0, DWORD PTR .LC7[rip]
+	mulss	xmm0, xmm1
+	movss	DWORD PTR -48[rbp], xmm0
+	.loc 1 155 39 discriminator 3
+	movss	xmm0, DWORD PTR -32[rbp]
+	movaps	xmm1, xmm0
+	subss	xmm1, DWORD PTR -40[rbp]
+	.loc 1 155 21 discriminator 3
+	movss	xmm0, DWORD PTR .LC7[rip]
+	mulss	xmm0, xmm1
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 156 40 discriminator 3
+	movss	xmm0, DWORD PTR -28[rbp]
+	movaps	xmm1, xmm0
+	subss	xmm1, DWORD PTR -36[rbp]
+	.loc 1 156 21 discriminator 3
+	movss	xmm0, DWORD PTR .LC8[rip]
+	mulss	xmm0, xmm1
+	movss	DWORD PTR -56[rbp], xmm0
+	.loc 1 157 29 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 157 46 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	add	edx, edx
+	movsx	rdx, edx
+	.loc 1 157 43 discriminator 3
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 157 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -60[rbp], xmm0
+	.loc 1 158 30 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 158 47 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	add	edx, edx
+	.loc 1 158 44 discriminator 3
+	movsx	rdx, edx
+	add	rdx, 1
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 158 21 discriminator 3
+	movss	xmm1, DWORD PTR .LC6[rip]
+	xorps	xmm0, xmm1
+	movss	DWORD PTR -64[rbp], xmm0
+	.loc 1 160 40 discriminator 3
+	movss	xmm0, DWORD PTR -52[rbp]
+	mulss	xmm0, DWORD PTR -60[rbp]
+	.loc 1 160 33 discriminator 3
+	addss	xmm0, DWORD PTR -44[rbp]
+	.loc 1 160 52 discriminator 3
+	movss	xmm1, DWORD PTR -56[rbp]
+	mulss	xmm1, DWORD PTR -64[rbp]
+	.loc 1 160 20 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 160 17 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 160 45 discriminator 3
+	subss	xmm0, xmm1
+	.loc 1 160 25 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 161 44 discriminator 3
+	movss	xmm0, DWORD PTR -52[rbp]
+	mulss	xmm0, DWORD PTR -64[rbp]
+	.loc 1 161 37 discriminator 3
+	movaps	xmm1, xmm0
+	addss	xmm1, DWORD PTR -48[rbp]
+	.loc 1 161 56 discriminator 3
+	movss	xmm0, DWORD PTR -56[rbp]
+	mulss	xmm0, DWORD PTR -60[rbp]
+	.loc 1 161 20 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	.loc 1 161 17 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 161 49 discriminator 3
+	addss	xmm0, xmm1
+	.loc 1 161 29 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+.LBE14:
+	.loc 1 147 29 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L33:
+	.loc 1 147 23 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jl	.L34
+.LBE13:
+	.loc 1 163 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	fft_Forward, .-fft_Forward
+	.globl	fft_Inverse
+	.type	fft_Inverse, @function
+fft_Inverse:
+.LFB11:
+	.loc 1 166 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 104
+	mov	QWORD PTR -88[rbp], rdi
+	mov	QWORD PTR -96[rbp], rsi
+	mov	QWORD PTR -104[rbp], rdx
+	.loc 1 167 22
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 167 15
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 168 12
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 169 42
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 169 32
+	pxor	xmm1, xmm1
+	cvtsi2ss	xmm1, eax
+	.loc 1 169 17
+	movss	xmm0, DWORD PTR .LC0[rip]
+	divss	xmm0, xmm1
+	movss	DWORD PTR -28[rbp], xmm0
+.LBB15:
+	.loc 1 172 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 172 5
+	jmp	.L36
+.L37:
+.LBB16:
+	.loc 1 174 37 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 174 34 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 174 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -32[rbp], xmm0
+	.loc 1 175 37 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	.loc 1 175 34 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 175 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -36[rbp], xmm0
+	.loc 1 176 42 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	sub	eax, DWORD PTR -4[rbp]
+	.loc 1 176 37 discriminator 3
+	add	eax, eax
+	cdqe
+	.loc 1 176 34 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 176 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -40[rbp], xmm0
+	.loc 1 177 43 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	sub	eax, DWORD PTR -4[rbp]
+	.loc 1 177 38 discriminator 3
+	add	eax, eax
+	.loc 1 177 35 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 177 21 discriminator 3
+	movss	xmm1, DWORD PTR .LC6[rip]
+	xorps	xmm0, xmm1
+	movss	DWORD PTR -44[rbp], xmm0
+	.loc 1 178 21 discriminator 3
+	movss	xmm0, DWORD PTR -32[rbp]
+	addss	xmm0, DWORD PTR -40[rbp]
+	movss	DWORD PTR -48[rbp], xmm0
+	.loc 1 179 21 discriminator 3
+	movss	xmm0, DWORD PTR -36[rbp]
+	addss	xmm0, DWORD PTR -44[rbp]
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 180 21 discriminator 3
+	movss	xmm0, DWORD PTR -32[rbp]
+	subss	xmm0, DWORD PTR -40[rbp]
+	movss	DWORD PTR -56[rbp], xmm0
+	.loc 1 181 21 discriminator 3
+	movss	xmm0, DWORD PTR -36[rbp]
+	subss	xmm0, DWORD PTR -44[rbp]
+	movss	DWORD PTR -60[rbp], xmm0
+	.loc 1 182 29 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 182 46 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	add	edx, edx
+	movsx	rdx, edx
+	.loc 1 182 43 discriminator 3
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 182 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -64[rbp], xmm0
+	.loc 1 183 29 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 183 46 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	add	edx, edx
+	.loc 1 183 43 discriminator 3
+	movsx	rdx, edx
+	add	rdx, 1
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 183 21 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -68[rbp], xmm0
+	.loc 1 184 31 discriminator 3
+	movss	xmm0, DWORD PTR -56[rbp]
+	mulss	xmm0, DWORD PTR -64[rbp]
+	.loc 1 184 41 discriminator 3
+	movss	xmm1, DWORD PTR -60[rbp]
+	mulss	xmm1, DWORD PTR -68[rbp]
+	.loc 1 184 21 discriminator 3
+	subss	xmm0, xmm1
+	movss	DWORD PTR -72[rbp], xmm0
+	.loc 1 185 31 discriminator 3
+	movss	xmm0, DWORD PTR -56[rbp]
+	movaps	xmm1, xmm0
+	mulss	xmm1, DWORD PTR -68[rbp]
+	.loc 1 185 41 discriminator 3
+	movss	xmm0, DWORD PTR -60[rbp]
+	mulss	xmm0, DWORD PTR -64[rbp]
+	.loc 1 185 21 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR -76[rbp], xmm0
+	.loc 1 186 26 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 186 38 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 186 19 discriminator 3
+	mov	eax, DWORD PTR [rax]
+	mov	DWORD PTR -80[rbp], eax
+	.loc 1 188 13 discriminator 3
+	mov	eax, DWORD PTR -80[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 188 10 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 188 26 discriminator 3
+	movss	xmm0, DWORD PTR -48[rbp]
+	subss	xmm0, DWORD PTR -76[rbp]
+	.loc 1 188 18 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 189 13 discriminator 3
+	mov	eax, DWORD PTR -80[rbp]
+	add	eax, eax
+	.loc 1 189 10 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 189 30 discriminator 3
+	movss	xmm0, DWORD PTR -52[rbp]
+	addss	xmm0, DWORD PTR -72[rbp]
+	.loc 1 189 22 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+.LBE16:
+	.loc 1 172 29 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L36:
+	.loc 1 172 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jl	.L37
+.LBE15:
+	.loc 1 191 5
+	mov	rcx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -88[rbp]
+	mov	edx, 1
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fft_Complex
+.LBB17:
+	.loc 1 193 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 193 5
+	jmp	.L38
+.L39:
+	.loc 1 195 29 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 195 26 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 195 18 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 195 15 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 195 34 discriminator 3
+	mulss	xmm0, DWORD PTR -28[rbp]
+	.loc 1 195 23 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 196 33 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	.loc 1 196 30 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 196 18 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, eax
+	.loc 1 196 15 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 196 42 discriminator 3
+	mulss	xmm0, DWORD PTR -28[rbp]
+	.loc 1 196 27 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 193 29 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L38:
+	.loc 1 193 23 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jl	.L39
+.LBE17:
+	.loc 1 198 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	fft_Inverse, .-fft_Inverse
+	.section	.rodata
+	.align 4
+.LC0:
+	.long	1065353216
+	.align 4
+.LC1:
+	.long	-1082130432
+	.align 8
+.LC4:
+	.long	1413754136
+	.long	1075388923
+	.align 16
+.LC6:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC7:
+	.long	1056964608
+	.align 4
+.LC8:
+	.long	-1090519040
+	.text
+.Letext0:
+	.file 2 "include/lmsAllocator.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "include/fft.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 6 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x7cb
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF57
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xc
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0x9
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x9
+	.long	0x93
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x3
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0xe
+	.byte	0x18
+	.byte	0x2
+	.byte	0x10
+	.long	0xdd
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x13
+	.byte	0xd
+	.long	0xf6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x16
+	.byte	0xc
+	.long	0x10b
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x18
+	.byte	0xb
+	.long	0x83
+	.byte	0x10
+	.byte	0
+	.uleb128 0x14
+	.long	0x83
+	.long	0xf6
+	.uleb128 0x5
+	.long	0x83
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0xdd
+	.uleb128 0x15
+	.long	0x10b
+	.uleb128 0x5
+	.long	0x83
+	.uleb128 0x5
+	.long	0x83
+	.byte	0
+	.uleb128 0x7
+	.long	0xfb
+	.uleb128 0xc
+	.long	.LASF19
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0xad
+	.uleb128 0x9
+	.long	0x110
+	.uleb128 0xe
+	.byte	0x30
+	.byte	0x4
+	.byte	0xc
+	.long	0x178
+	.uleb128 0x6
+	.long	.LASF20
+	.byte	0x4
+	.byte	0xe
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x4
+	.byte	0xf
+	.byte	0xc
+	.long	0x178
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x10
+	.byte	0xc
+	.long	0x178
+	.byte	0x10
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x11
+	.byte	0xa
+	.long	0x17d
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF24
+	.byte	0x4
+	.byte	0x12
+	.byte	0xc
+	.long	0x178
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x13
+	.byte	0xb
+	.long	0x83
+	.byte	0x28
+	.byte	0
+	.uleb128 0x7
+	.long	0x93
+	.uleb128 0x7
+	.long	0x46
+	.uleb128 0xc
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x14
+	.byte	0x3
+	.long	0x121
+	.uleb128 0x9
+	.long	0x182
+	.uleb128 0xf
+	.string	"sin"
+	.byte	0x40
+	.long	0x9f
+	.long	0x1a7
+	.uleb128 0x5
+	.long	0x9f
+	.byte	0
+	.uleb128 0xf
+	.string	"cos"
+	.byte	0x3e
+	.long	0x9f
+	.long	0x1bb
+	.uleb128 0x5
+	.long	0x9f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF27
+	.byte	0x2
+	.byte	0x43
+	.byte	0x8
+	.long	0x2e
+	.long	0x1d1
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF28
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x1f1
+	.uleb128 0x5
+	.long	0x83
+	.uleb128 0x5
+	.long	0x46
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF58
+	.byte	0x2
+	.byte	0x27
+	.byte	0x17
+	.long	0x1fd
+	.uleb128 0x7
+	.long	0x11c
+	.uleb128 0xd
+	.long	.LASF36
+	.byte	0xa5
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x378
+	.uleb128 0xa
+	.string	"fft"
+	.byte	0xa5
+	.byte	0x1f
+	.long	0x378
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x8
+	.long	.LASF29
+	.byte	0xa5
+	.byte	0x31
+	.long	0x37d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x8
+	.long	.LASF30
+	.byte	0xa5
+	.byte	0x42
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x1
+	.string	"n"
+	.byte	0xa7
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x1
+	.string	"z"
+	.byte	0xa8
+	.byte	0xc
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0xa9
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0xb
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.long	0x359
+	.uleb128 0x1
+	.string	"k"
+	.byte	0xac
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x4
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x1
+	.string	"ar"
+	.byte	0xae
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.string	"ai"
+	.byte	0xaf
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x1
+	.string	"br"
+	.byte	0xb0
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1
+	.string	"bi"
+	.byte	0xb1
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0xb2
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0xb3
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x1
+	.string	"dr"
+	.byte	0xb4
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1
+	.string	"di"
+	.byte	0xb5
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x1
+	.string	"wr"
+	.byte	0xb6
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.string	"wi"
+	.byte	0xb7
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0xb8
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0xb9
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x1
+	.string	"j"
+	.byte	0xba
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.uleb128 0x1
+	.string	"i"
+	.byte	0xc1
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x18e
+	.uleb128 0x7
+	.long	0x9a
+	.uleb128 0xd
+	.long	.LASF37
+	.byte	0x80
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4df
+	.uleb128 0xa
+	.string	"fft"
+	.byte	0x80
+	.byte	0x1f
+	.long	0x378
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x8
+	.long	.LASF38
+	.byte	0x80
+	.byte	0x31
+	.long	0x37d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x8
+	.long	.LASF29
+	.byte	0x80
+	.byte	0x3f
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x1
+	.string	"n"
+	.byte	0x82
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x1
+	.string	"z"
+	.byte	0x83
+	.byte	0xc
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xb
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.long	0x424
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x86
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x4
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x1
+	.string	"j"
+	.byte	0x88
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.uleb128 0x1
+	.string	"k"
+	.byte	0x93
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0x1
+	.string	"ar"
+	.byte	0x95
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x1
+	.string	"ai"
+	.byte	0x96
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.string	"br"
+	.byte	0x97
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x1
+	.string	"bi"
+	.byte	0x98
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x99
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0x9a
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x9b
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x9c
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1
+	.string	"wr"
+	.byte	0x9d
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x1
+	.string	"wi"
+	.byte	0x9e
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF39
+	.byte	0x78
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x518
+	.uleb128 0xa
+	.string	"fft"
+	.byte	0x78
+	.byte	0x16
+	.long	0x518
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x7a
+	.byte	0x1b
+	.long	0x1fd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x7
+	.long	0x182
+	.uleb128 0x17
+	.long	.LASF47
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x661
+	.uleb128 0xa
+	.string	"fft"
+	.byte	0x3d
+	.byte	0x15
+	.long	0x518
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x8
+	.long	.LASF20
+	.byte	0x3d
+	.byte	0x1e
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x3f
+	.byte	0x1b
+	.long	0x1fd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.string	"n"
+	.byte	0x40
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x49
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x4a
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x4b
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x4c
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x2
+	.long	.LASF45
+	.byte	0x67
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0xb
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.long	0x5e2
+	.uleb128 0x1
+	.string	"k"
+	.byte	0x5c
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0xb
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.long	0x604
+	.uleb128 0x1
+	.string	"k"
+	.byte	0x61
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x4
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x6c
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x6e
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x4
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x1
+	.string	"b"
+	.byte	0x6f
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF48
+	.byte	0x1
+	.byte	0x32
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6a0
+	.uleb128 0x8
+	.long	.LASF49
+	.byte	0x32
+	.byte	0x1c
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0x34
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF59
+	.byte	0x1
+	.byte	0x17
+	.byte	0xd
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xa
+	.string	"fft"
+	.byte	0x17
+	.byte	0x26
+	.long	0x378
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x8
+	.long	.LASF51
+	.byte	0x17
+	.byte	0x32
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x8
+	.long	.LASF52
+	.byte	0x17
+	.byte	0x3c
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x1
+	.string	"n"
+	.byte	0x19
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x2
+	.long	.LASF53
+	.byte	0x1a
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x2
+	.long	.LASF54
+	.byte	0x1c
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x2
+	.long	.LASF55
+	.byte	0x1c
+	.byte	0x18
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0x1e
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x4
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x1
+	.string	"k"
+	.byte	0x20
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x1
+	.string	"wr"
+	.byte	0x22
+	.byte	0x1d
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x1
+	.string	"wi"
+	.byte	0x23
+	.byte	0x1d
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.string	"a"
+	.byte	0x24
+	.byte	0x18
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1
+	.string	"b"
+	.byte	0x25
+	.byte	0x18
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.string	"tr"
+	.byte	0x26
+	.byte	0x1d
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x1
+	.string	"ti"
+	.byte	0x27
+	.byte	0x1d
+	.long	0x9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF47:
+	.string	"fft_Init"
+.LASF31:
+	.string	"scale"
+.LASF18:
+	.string	"size_t"
+.LASF39:
+	.string	"fft_Free"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF37:
+	.string	"fft_Forward"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF16:
+	.string	"release"
+.LASF21:
+	.string	"twiddles"
+.LASF45:
+	.string	"bits"
+.LASF3:
+	.string	"long int"
+.LASF59:
+	.string	"fft_Complex"
+.LASF13:
+	.string	"double"
+.LASF33:
+	.string	"evenI"
+.LASF25:
+	.string	"memory"
+.LASF32:
+	.string	"evenR"
+.LASF7:
+	.string	"unsigned int"
+.LASF2:
+	.string	"long unsigned int"
+.LASF51:
+	.string	"data"
+.LASF20:
+	.string	"size"
+.LASF6:
+	.string	"short unsigned int"
+.LASF29:
+	.string	"spectrum"
+.LASF49:
+	.string	"number"
+.LASF23:
+	.string	"bitReverse"
+.LASF52:
+	.string	"inverse"
+.LASF35:
+	.string	"oddI"
+.LASF30:
+	.string	"output"
+.LASF34:
+	.string	"oddR"
+.LASF46:
+	.string	"reversed"
+.LASF14:
+	.string	"long double"
+.LASF12:
+	.string	"float"
+.LASF19:
+	.string	"LmsAllocator_t"
+.LASF27:
+	.string	"lmsAllocator_AlignedSize"
+.LASF5:
+	.string	"unsigned char"
+.LASF55:
+	.string	"step"
+.LASF9:
+	.string	"short int"
+.LASF58:
+	.string	"lmsAllocator_Heap"
+.LASF38:
+	.string	"input"
+.LASF40:
+	.string	"heap"
+.LASF10:
+	.string	"char"
+.LASF57:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF36:
+	.string	"fft_Inverse"
+.LASF50:
+	.string	"power"
+.LASF24:
+	.string	"work"
+.LASF17:
+	.string	"context"
+.LASF44:
+	.string	"workBytes"
+.LASF28:
+	.string	"memset"
+.LASF42:
+	.string	"realTwiddleBytes"
+.LASF54:
+	.string	"half"
+.LASF53:
+	.string	"sign"
+.LASF22:
+	.string	"realTwiddles"
+.LASF43:
+	.string	"bitReverseBytes"
+.LASF41:
+	.string	"twiddleBytes"
+.LASF56:
+	.string	"start"
+.LASF26:
+	.string	"Fft_t"
+.LASF48:
+	.string	"fft_NextPowerOfTwo"
+.LASF15:
+	.string	"allocate"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/fft.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1210 @@
+	.file	"lmsAllocator.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsAllocator.c"
+	.type	lmsAllocator_HeapAllocate, @function
+lmsAllocator_HeapAllocate:
+.LFB6:
+	.file 1 "source/lmsAllocator.c"
+	.loc 1 14 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 15 11
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 18 9
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rcx, QWORD PTR -40[rbp]
+	lea	rax, -8[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	posix_memalign@PLT
+	.loc 1 18 8
+	test	eax, eax
+	je	.L2
+	.loc 1 20 16
+	mov	QWORD PTR -8[rbp], 0
+.L2:
+	.loc 1 22 12
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 23 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	lmsAllocator_HeapAllocate, .-lmsAllocator_HeapAllocate
+	.type	lmsAllocator_HeapRelease, @function
+lmsAllocator_HeapRelease:
+.LFB7:
+	.loc 1 26 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	.loc 1 28 5
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 29 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	lmsAllocator_HeapRelease, .-lmsAllocator_HeapRelease
+	.type	lmsArena_Allocate, @function
+lmsArena_Allocate:
+.LFB8:
+	.loc 1 32 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	.loc 1 33 17
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 34 48
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 34 62
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 34 55
+	add	rax, rdx
+	.loc 1 34 21
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 35 50
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, 0
+	div	QWORD PTR -56[rbp]
+	.loc 1 35 39
+	mov	rax, QWORD PTR -56[rbp]
+	sub	rax, rdx
+	.loc 1 35 18
+	mov	edx, 0
+	div	QWORD PTR -56[rbp]
+	mov	QWORD PTR -24[rbp], rdx
+	.loc 1 37 15
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 37 22
+	mov	rax, QWORD PTR -24[rbp]
+	add	rdx, rax
+	.loc 1 37 39
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 37 8
+	cmp	rax, rdx
+	jb	.L6
+	.loc 1 37 63 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	.loc 1 37 77 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 37 70 discriminator 1
+	sub	rdx, rax
+	.loc 1 37 84 discriminator 1
+	mov	rax, rdx
+	sub	rax, QWORD PTR -24[rbp]
+	.loc 1 37 47 discriminator 1
+	cmp	rax, QWORD PTR -48[rbp]
+	jnb	.L7
+.L6:
+	.loc 1 39 16
+	mov	eax, 0
+	jmp	.L8
+.L7:
+	.loc 1 41 10
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 41 28
+	mov	rcx, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	add	rdx, rcx
+	.loc 1 41 17
+	add	rdx, rax
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 42 28
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+.L8:
+	.loc 1 43 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	lmsArena_Allocate, .-lmsArena_Allocate
+	.globl	lmsAllocator_Heap
+	.type	lmsAllocator_Heap, @function
+lmsAllocator_Heap:
+.LFB9:
+	.loc 1 46 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	.loc 1 48 12
+	lea	rax, heap.0[rip]
+	.loc 1 49 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	lmsAllocator_Heap, .-lmsAllocator_Heap
+	.globl	lmsArena_Init
+	.type	lmsArena_Init, @function
+lmsArena_Init:
+.LFB10:
+	.loc 1 52 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	.loc 1 53 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 54 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 55 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 56 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	lmsArena_Init, .-lmsArena_Init
+	.globl	lmsArena_Allocator
+	.type	lmsArena_Allocator, @function
+lmsArena_Allocator:
+.LFB11:
+	.loc 1 59 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	.loc 1 60 20
+	lea	rax, lmsArena_Allocate[rip]
+	mov	QWORD PTR -32[rbp], rax
+	mov	QWORD PTR -24[rbp], 0
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 61 12
+	mov	rcx, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 16[rcx], rax
+	.loc 1 62 1
+	mov	rax, QWORD PTR -40[rbp]
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	lmsArena_Allocator, .-lmsArena_Allocator
+	.globl	lmsArena_Reset
+	.type	lmsArena_Reset, @function
+lmsArena_Reset:
+.LFB12:
+	.loc 1 65 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 66 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 67 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	lmsArena_Reset, .-lmsArena_Reset
+	.globl	lmsAllocator_AlignedSize
+	.type	lmsAllocator_AlignedSize, @function
+lmsAllocator_AlignedSize:
+.LFB13:
+	.loc 1 70 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 71 44
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 63
+	.loc 1 71 75
+	and	rax, -64
+	.loc 1 72 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	lmsAllocator_AlignedSize, .-lmsAllocator_AlignedSize
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	heap.0, @object
+	.size	heap.0, 24
+heap.0:
+	.quad	lmsAllocator_HeapAllocate
+	.quad	lmsAllocator_HeapRelease
+	.quad	0
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/stdint.h"
+	.file 4 "include/lmsAllocator.h"
+	.file 5 "/usr/include/stdlib.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3b2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xc
+	.long	.LASF38
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.long	.LASF12
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0x8
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0xe
+	.byte	0x8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x7
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x8
+	.long	0x8e
+	.uleb128 0x2
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0xa
+	.byte	0x10
+	.long	0xd1
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x13
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF16
+	.byte	0x16
+	.byte	0xc
+	.long	0xff
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF17
+	.byte	0x18
+	.byte	0xb
+	.long	0x7e
+	.byte	0x10
+	.byte	0
+	.uleb128 0xf
+	.long	0x7e
+	.long	0xea
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0xd1
+	.uleb128 0x10
+	.long	0xff
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x5
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x19
+	.byte	0x3
+	.long	0xa6
+	.uleb128 0x8
+	.long	0x104
+	.uleb128 0xa
+	.byte	0x1c
+	.long	0x140
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x1e
+	.byte	0x14
+	.long	0x140
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF20
+	.byte	0x1f
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF21
+	.byte	0x20
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b
+	.uleb128 0x7
+	.long	.LASF22
+	.byte	0x4
+	.byte	0x21
+	.byte	0x3
+	.long	0x115
+	.uleb128 0x11
+	.long	.LASF39
+	.byte	0x5
+	.value	0x238
+	.byte	0xd
+	.long	0x164
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF40
+	.byte	0x5
+	.value	0x257
+	.byte	0xc
+	.long	0x46
+	.long	0x185
+	.uleb128 0x3
+	.long	0x185
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x7e
+	.uleb128 0x9
+	.long	.LASF24
+	.byte	0x45
+	.byte	0x8
+	.long	0x2e
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ba
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x45
+	.byte	0x28
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF26
+	.byte	0x40
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e5
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x40
+	.byte	0x21
+	.long	0x1e5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x5
+	.long	0x145
+	.uleb128 0x9
+	.long	.LASF25
+	.byte	0x3a
+	.byte	0x10
+	.long	0x104
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x228
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x3a
+	.byte	0x2f
+	.long	0x1e5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF30
+	.byte	0x3c
+	.byte	0x14
+	.long	0x104
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF27
+	.byte	0x33
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x26f
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x33
+	.byte	0x20
+	.long	0x1e5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x33
+	.byte	0x2d
+	.long	0x7e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x33
+	.byte	0x3c
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF29
+	.byte	0x2d
+	.byte	0x17
+	.long	0x2a6
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2a6
+	.uleb128 0x6
+	.long	.LASF31
+	.byte	0x2f
+	.byte	0x21
+	.long	0x110
+	.uleb128 0x9
+	.byte	0x3
+	.quad	heap.0
+	.byte	0
+	.uleb128 0x5
+	.long	0x110
+	.uleb128 0x13
+	.long	.LASF41
+	.byte	0x1
+	.byte	0x1f
+	.byte	0xe
+	.long	0x7e
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x323
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x1f
+	.byte	0x26
+	.long	0x7e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x1f
+	.byte	0x36
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x1f
+	.byte	0x43
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x21
+	.byte	0x11
+	.long	0x1e5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.long	.LASF33
+	.byte	0x22
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x6
+	.long	.LASF34
+	.byte	0x23
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF36
+	.byte	0x1
+	.byte	0x19
+	.byte	0xd
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x35e
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x19
+	.byte	0x2c
+	.long	0x7e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x19
+	.byte	0x3b
+	.long	0x7e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF37
+	.byte	0x1
+	.byte	0xd
+	.byte	0xe
+	.long	0x7e
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0xd
+	.byte	0x2e
+	.long	0x7e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0xd
+	.byte	0x3e
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0xd
+	.byte	0x4b
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF35
+	.byte	0xf
+	.byte	0xb
+	.long	0x7e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF40:
+	.string	"posix_memalign"
+.LASF12:
+	.string	"size_t"
+.LASF41:
+	.string	"lmsArena_Allocate"
+.LASF18:
+	.string	"LmsAllocator_t"
+.LASF13:
+	.string	"uintptr_t"
+.LASF21:
+	.string	"used"
+.LASF7:
+	.string	"unsigned int"
+.LASF38:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF26:
+	.string	"lmsArena_Reset"
+.LASF20:
+	.string	"size"
+.LASF2:
+	.string	"long unsigned int"
+.LASF6:
+	.string	"short unsigned int"
+.LASF27:
+	.string	"lmsArena_Init"
+.LASF5:
+	.string	"unsigned char"
+.LASF29:
+	.string	"lmsAllocator_Heap"
+.LASF15:
+	.string	"allocate"
+.LASF19:
+	.string	"base"
+.LASF23:
+	.string	"arena"
+.LASF33:
+	.string	"address"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF31:
+	.string	"heap"
+.LASF34:
+	.string	"padding"
+.LASF37:
+	.string	"lmsAllocator_HeapAllocate"
+.LASF17:
+	.string	"context"
+.LASF39:
+	.string	"free"
+.LASF4:
+	.string	"long long int"
+.LASF32:
+	.string	"alignment"
+.LASF10:
+	.string	"char"
+.LASF9:
+	.string	"short int"
+.LASF28:
+	.string	"buffer"
+.LASF36:
+	.string	"lmsAllocator_HeapRelease"
+.LASF3:
+	.string	"long int"
+.LASF22:
+	.string	"LmsArena_t"
+.LASF25:
+	.string	"lmsArena_Allocator"
+.LASF14:
+	.string	"long double"
+.LASF8:
+	.string	"signed char"
+.LASF24:
+	.string	"lmsAllocator_AlignedSize"
+.LASF30:
+	.string	"allocator"
+.LASF35:
+	.string	"memory"
+.LASF16:
+	.string	"release"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"source/lmsAllocator.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8206 @@
+	.file	"lmsBench.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsBench.c"
+	.type	lmsBench_ProcessLms, @function
+lmsBench_ProcessLms:
+.LFB5007:
+	.file 1 "source/lmsBench.c"
+	.loc 1 87 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	DWORD PTR -36[rbp], r8d
+	.loc 1 88 12
+	mov	edi, DWORD PTR -36[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r9d, edi
+	mov	r8, rcx
+	mov	rcx, rdx
+	mov	edx, 0
+	mov	rdi, rax
+	call	lmsFilter_ProcessBlock@PLT
+	.loc 1 89 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5007:
+	.size	lmsBench_ProcessLms, .-lmsBench_ProcessLms
+	.type	lmsBench_ProcessEngine, @function
+lmsBench_ProcessEngine:
+.LFB5008:
+	.loc 1 92 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	DWORD PTR -36[rbp], r8d
+	.loc 1 93 12
+	mov	edi, DWORD PTR -36[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r9d, edi
+	mov	r8, rcx
+	mov	rcx, rdx
+	mov	edx, 0
+	mov	rdi, rax
+	call	lmsEngine_ProcessBlock@PLT
+	.loc 1 94 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5008:
+	.size	lmsBench_ProcessEngine, .-lmsBench_ProcessEngine
+	.type	lmsBench_ProcessFixed, @function
+lmsBench_ProcessFixed:
+.LFB5009:
+	.loc 1 97 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	mov	QWORD PTR -48[rbp], rcx
+	mov	DWORD PTR -52[rbp], r8d
+	.loc 1 98 22
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 101 49
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 101 70
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 101 63
+	mov	rcx, QWORD PTR -32[rbp]
+	sub	rcx, rax
+	mov	rax, rcx
+	sar	rax, 2
+	.loc 1 101 56
+	add	rax, rax
+	.loc 1 101 43
+	lea	rsi, [rdx+rax]
+	.loc 1 101 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edi, DWORD PTR -52[rbp]
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	r9d, edi
+	mov	r8, rcx
+	mov	rcx, rdx
+	mov	edx, 0
+	mov	rdi, rax
+	call	lmsFixed_ProcessBlock@PLT
+	.loc 1 103 12
+	mov	eax, 0
+	.loc 1 104 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5009:
+	.size	lmsBench_ProcessFixed, .-lmsBench_ProcessFixed
+	.type	lmsBench_Now, @function
+lmsBench_Now:
+.LFB5010:
+	.loc 1 107 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	.loc 1 109 5
+	lea	rax, -16[rbp]
+	mov	rsi, rax
+	mov	edi, 1
+	call	clock_gettime@PLT
+	.loc 1 110 15
+	mov	rax, QWORD PTR -16[rbp]
+	.loc 1 110 23
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, rax
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 110 34
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 110 29
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	addsd	xmm0, xmm1
+	movq	rax, xmm0
+	.loc 1 111 1
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5010:
+	.size	lmsBench_Now, .-lmsBench_Now
+	.type	lmsBench_Cycles, @function
+lmsBench_Cycles:
+.LFB5011:
+	.loc 1 114 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+.LBB4:
+.LBB5:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/ia32intrin.h"
+	.loc 2 114 10
+	rdtsc
+	sal	rdx, 32
+	or	rax, rdx
+.LBE5:
+.LBE4:
+	.loc 1 120 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5011:
+	.size	lmsBench_Cycles, .-lmsBench_Cycles
+	.type	lmsBench_CompareDouble, @function
+lmsBench_CompareDouble:
+.LFB5012:
+	.loc 1 123 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 124 18
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR [rax]
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 125 18
+	mov	rax, QWORD PTR -32[rbp]
+	movsd	xmm0, QWORD PTR [rax]
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 126 15
+	movsd	xmm0, QWORD PTR -8[rbp]
+	comisd	xmm0, QWORD PTR -16[rbp]
+	seta	al
+	movzx	edx, al
+	.loc 1 126 25
+	movsd	xmm0, QWORD PTR -16[rbp]
+	comisd	xmm0, QWORD PTR -8[rbp]
+	seta	al
+	movzx	eax, al
+	.loc 1 126 20
+	sub	edx, eax
+	mov	eax, edx
+	.loc 1 127 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5012:
+	.size	lmsBench_CompareDouble, .-lmsBench_CompareDouble
+	.section	.rodata
+	.align 8
+.LC1:
+	.string	"Error allocating benchmark results"
+	.text
+	.type	lmsBench_Measure, @function
+lmsBench_Measure:
+.LFB5013:
+	.loc 1 143 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	add	rsp, -128
+	mov	QWORD PTR -88[rbp], rdi
+	mov	QWORD PTR -96[rbp], rsi
+	mov	QWORD PTR -104[rbp], rdx
+	mov	QWORD PTR -112[rbp], rcx
+	mov	QWORD PTR -120[rbp], r8
+	mov	QWORD PTR -128[rbp], r9
+	.loc 1 144 55
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 144 45
+	add	eax, eax
+	cdqe
+	.loc 1 144 36
+	sal	rax, 3
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 145 8
+	cmp	QWORD PTR -24[rbp], 0
+	jne	.L15
+	.loc 1 147 9
+	lea	rax, .LC1[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 148 16
+	mov	eax, 1
+	jmp	.L16
+.L15:
+	.loc 1 150 52
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	cdqe
+	.loc 1 150 43
+	lea	rdx, 0[0+rax*8]
+	.loc 1 150 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 152 20
+	mov	rax, QWORD PTR 16[rbp]
+	mov	DWORD PTR 56[rax], 1
+.LBB6:
+	.loc 1 153 31
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	.loc 1 153 14
+	neg	eax
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 153 5
+	jmp	.L17
+.L26:
+.LBB7:
+	.loc 1 155 30
+	call	lmsBench_Now
+	movq	rax, xmm0
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 156 48
+	call	lmsBench_Cycles
+	mov	QWORD PTR -48[rbp], rax
+.LBB8:
+	.loc 1 158 19
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 158 9
+	jmp	.L18
+.L22:
+.LBB9:
+	.loc 1 160 39
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 160 24
+	sub	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR -72[rbp], rax
+	.loc 1 161 45
+	mov	rax, QWORD PTR 16[rbp]
+	mov	eax, DWORD PTR 28[rax]
+	cdqe
+	.loc 1 161 70
+	cmp	QWORD PTR -72[rbp], rax
+	jge	.L19
+	.loc 1 161 70 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	jmp	.L20
+.L19:
+	.loc 1 161 70 discriminator 2
+	mov	rax, QWORD PTR 16[rbp]
+	mov	eax, DWORD PTR 28[rax]
+.L20:
+	.loc 1 161 23 is_stmt 1 discriminator 4
+	mov	DWORD PTR -76[rbp], eax
+	.loc 1 162 39 discriminator 4
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 162 17 discriminator 4
+	mov	rax, QWORD PTR -112[rbp]
+	lea	rsi, [rdx+rax]
+	mov	edi, DWORD PTR -76[rbp]
+	mov	rcx, QWORD PTR -128[rbp]
+	mov	rdx, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR -104[rbp]
+	mov	r9, QWORD PTR -96[rbp]
+	mov	r8d, edi
+	mov	rdi, rax
+	call	r9
+.LVL0:
+	.loc 1 162 16 discriminator 4
+	test	eax, eax
+	je	.L21
+	.loc 1 164 32
+	mov	rax, QWORD PTR 16[rbp]
+	mov	DWORD PTR 56[rax], 0
+.L21:
+.LBE9:
+	.loc 1 158 65 discriminator 2
+	mov	rax, QWORD PTR 16[rbp]
+	mov	eax, DWORD PTR 28[rax]
+	cdqe
+	.loc 1 158 56 discriminator 2
+	add	QWORD PTR -16[rbp], rax
+.L18:
+	.loc 1 158 38 discriminator 1
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 158 28 discriminator 1
+	cmp	QWORD PTR -16[rbp], rax
+	jl	.L22
+.LBE8:
+	.loc 1 168 43
+	call	lmsBench_Cycles
+	.loc 1 168 34
+	sub	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 169 32
+	call	lmsBench_Now
+	movq	rax, xmm0
+	.loc 1 169 22
+	movq	xmm0, rax
+	subsd	xmm0, QWORD PTR -40[rbp]
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 170 12
+	cmp	DWORD PTR -4[rbp], 0
+	js	.L23
+	.loc 1 172 52
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 172 42
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, rax
+	.loc 1 172 24
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 172 42
+	movsd	xmm0, QWORD PTR -64[rbp]
+	divsd	xmm0, xmm1
+	.loc 1 172 32
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 173 38
+	mov	rax, QWORD PTR -56[rbp]
+	test	rax, rax
+	js	.L24
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L25
+.L24:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L25:
+	.loc 1 173 63
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 173 53
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, rax
+	.loc 1 173 28
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 173 53
+	divsd	xmm0, xmm1
+	.loc 1 173 36
+	movsd	QWORD PTR [rax], xmm0
+.L23:
+.LBE7:
+	.loc 1 153 78 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L17:
+	.loc 1 153 63 discriminator 1
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 153 53 discriminator 1
+	cmp	DWORD PTR -4[rbp], eax
+	jl	.L26
+.LBE6:
+	.loc 1 177 32
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 177 5
+	movsx	rsi, eax
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, lmsBench_CompareDouble[rip]
+	mov	rcx, rdx
+	mov	edx, 8
+	mov	rdi, rax
+	call	qsort@PLT
+	.loc 1 178 36
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 178 5
+	movsx	rsi, eax
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, lmsBench_CompareDouble[rip]
+	mov	rcx, rdx
+	mov	edx, 8
+	mov	rdi, rax
+	call	qsort@PLT
+	.loc 1 179 53
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 179 62
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	cdqe
+	.loc 1 179 44
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 179 31
+	mov	rax, QWORD PTR 16[rbp]
+	movsd	QWORD PTR 32[rax], xmm0
+	.loc 1 180 41
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 180 28
+	mov	rax, QWORD PTR 16[rbp]
+	movsd	QWORD PTR 40[rax], xmm0
+	.loc 1 181 55
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 181 64
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	cdqe
+	.loc 1 181 46
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 181 29
+	mov	rax, QWORD PTR 16[rbp]
+	movsd	QWORD PTR 48[rax], xmm0
+	.loc 1 183 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 184 12
+	mov	eax, 0
+.L16:
+	.loc 1 185 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5013:
+	.size	lmsBench_Measure, .-lmsBench_Measure
+	.section	.rodata
+	.align 8
+.LC3:
+	.string	"Error allocating benchmark buffers"
+	.text
+	.type	lmsBench_InitTask, @function
+lmsBench_InitTask:
+.LFB5014:
+	.loc 1 195 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	add	rsp, -128
+	mov	QWORD PTR -120[rbp], rdi
+	mov	DWORD PTR -124[rbp], esi
+	.loc 1 197 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 199 31
+	mov	eax, DWORD PTR -124[rbp]
+	cdqe
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 200 8
+	cmp	QWORD PTR -48[rbp], 0
+	jne	.L28
+	.loc 1 202 9
+	lea	rax, .LC3[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 203 16
+	mov	eax, 1
+	jmp	.L38
+.L28:
+	.loc 1 205 5
+	lea	rax, -112[rbp]
+	mov	rdi, rax
+	call	signalGenerator_DefaultSettings@PLT
+	.loc 1 206 20
+	mov	DWORD PTR -112[rbp], 5
+	.loc 1 207 20
+	mov	QWORD PTR -80[rbp], 2
+	.loc 1 208 5
+	mov	eax, DWORD PTR -124[rbp]
+	movsx	rdx, eax
+	mov	rcx, QWORD PTR -48[rbp]
+	lea	rax, -112[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	signalGenerator_generateSamples@PLT
+.LBB10:
+	.loc 1 209 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 209 5
+	jmp	.L30
+.L31:
+	.loc 1 211 57 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -12[rbp]
+	movsd	xmm0, QWORD PTR .LC4[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 211 31 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -124[rbp]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	exp@PLT
+	.loc 1 211 24 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsd2ss	xmm1, xmm0
+	.loc 1 211 17 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 211 21 discriminator 3
+	mulss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 212 33 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 212 17 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 212 47 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 212 37 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 212 14 discriminator 3
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 209 34 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L30:
+	.loc 1 209 23 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -124[rbp]
+	jl	.L31
+.LBE10:
+	.loc 1 216 39
+	mov	rax, QWORD PTR -8[rbp]
+	movq	xmm0, rax
+	call	sqrt@PLT
+	.loc 1 216 37
+	movsd	xmm1, QWORD PTR .LC5[rip]
+	divsd	xmm1, xmm0
+	.loc 1 216 17
+	pxor	xmm0, xmm0
+	cvtsd2ss	xmm0, xmm1
+	movss	DWORD PTR -52[rbp], xmm0
+.LBB11:
+	.loc 1 217 15
+	mov	QWORD PTR -24[rbp], 0
+	.loc 1 217 5
+	jmp	.L32
+.L37:
+.LBB12:
+	.loc 1 219 29
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, 1[rax]
+	.loc 1 219 33
+	mov	eax, DWORD PTR -124[rbp]
+	cdqe
+	.loc 1 219 56
+	cmp	rdx, rax
+	jge	.L33
+	.loc 1 219 45 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	.loc 1 219 56 discriminator 1
+	add	eax, 1
+	jmp	.L34
+.L33:
+	.loc 1 219 56 is_stmt 0 discriminator 2
+	mov	eax, DWORD PTR -124[rbp]
+.L34:
+	.loc 1 219 19 is_stmt 1 discriminator 4
+	mov	DWORD PTR -56[rbp], eax
+	.loc 1 220 16 discriminator 4
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -32[rbp], xmm0
+.LBB13:
+	.loc 1 222 18 discriminator 4
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 222 9 discriminator 4
+	jmp	.L35
+.L36:
+	.loc 1 224 36 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 224 20 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 224 46 discriminator 3
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 224 56 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	mov	rcx, QWORD PTR -24[rbp]
+	sub	rcx, rax
+	mov	rax, rcx
+	.loc 1 224 53 discriminator 3
+	sal	rax, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 224 40 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 224 17 discriminator 3
+	movsd	xmm1, QWORD PTR -32[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 222 36 discriminator 3
+	add	DWORD PTR -36[rbp], 1
+.L35:
+	.loc 1 222 27 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jl	.L36
+.LBE13:
+	.loc 1 226 28 discriminator 2
+	pxor	xmm0, xmm0
+	cvtsd2ss	xmm0, QWORD PTR -32[rbp]
+	.loc 1 226 13 discriminator 2
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 226 22 discriminator 2
+	mov	rdx, QWORD PTR -24[rbp]
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 226 39 discriminator 2
+	mulss	xmm0, DWORD PTR -52[rbp]
+	.loc 1 226 26 discriminator 2
+	movss	DWORD PTR [rax], xmm0
+.LBE12:
+	.loc 1 217 47 discriminator 2
+	add	QWORD PTR -24[rbp], 1
+.L32:
+	.loc 1 217 30 discriminator 1
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 217 24 discriminator 1
+	cmp	QWORD PTR -24[rbp], rax
+	jl	.L37
+.LBE11:
+	.loc 1 228 5
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 229 12
+	mov	eax, 0
+.L38:
+	.loc 1 230 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5014:
+	.size	lmsBench_InitTask, .-lmsBench_InitTask
+	.type	lmsBench_Converge, @function
+lmsBench_Converge:
+.LFB5015:
+	.loc 1 241 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	.loc 1 242 10
+	mov	QWORD PTR -8[rbp], -1
+.LBB14:
+	.loc 1 244 15
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 244 5
+	jmp	.L40
+.L49:
+.LBB15:
+	.loc 1 246 31
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 246 20
+	sub	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 247 69
+	cmp	QWORD PTR -48[rbp], 255
+	jg	.L41
+	.loc 1 247 69 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	jmp	.L42
+.L41:
+	.loc 1 247 69 discriminator 2
+	mov	eax, 256
+.L42:
+	.loc 1 247 19 is_stmt 1 discriminator 4
+	mov	DWORD PTR -52[rbp], eax
+	.loc 1 248 16 discriminator 4
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 249 16 discriminator 4
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 251 90 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdi, QWORD PTR 16[rax]
+	.loc 1 251 66 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 251 75 discriminator 4
+	mov	rdx, QWORD PTR -16[rbp]
+	sal	rdx, 2
+	.loc 1 251 61 discriminator 4
+	add	rdx, rax
+	.loc 1 251 49 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 251 56 discriminator 4
+	mov	rcx, QWORD PTR -16[rbp]
+	sal	rcx, 2
+	.loc 1 251 44 discriminator 4
+	lea	rsi, [rax+rcx]
+	.loc 1 251 13 discriminator 4
+	mov	ecx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -80[rbp]
+	mov	r9d, ecx
+	mov	r8, rdi
+	mov	ecx, 0
+	mov	rdi, rax
+	call	lmsEngine_ProcessBlock@PLT
+	.loc 1 251 12 discriminator 4
+	test	eax, eax
+	je	.L43
+	.loc 1 253 20
+	mov	rax, -1
+	jmp	.L44
+.L43:
+.LBB16:
+	.loc 1 255 18
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 255 9
+	jmp	.L45
+.L46:
+	.loc 1 257 39 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 257 46 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 257 27 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 257 56 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 257 63 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 257 50 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 257 24 discriminator 3
+	movsd	xmm1, QWORD PTR -24[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 258 41 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 258 53 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rcx, edx
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	.loc 1 258 50 discriminator 3
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 258 29 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 258 64 discriminator 3
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 258 76 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rcx, edx
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	.loc 1 258 73 discriminator 3
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 258 58 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 258 26 discriminator 3
+	movsd	xmm1, QWORD PTR -32[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 255 37 discriminator 3
+	add	DWORD PTR -36[rbp], 1
+.L45:
+	.loc 1 255 27 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	jl	.L46
+.LBE16:
+	.loc 1 260 49
+	movsd	xmm1, QWORD PTR -32[rbp]
+	movsd	xmm0, QWORD PTR .LC6[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 260 26
+	comisd	xmm0, QWORD PTR -24[rbp]
+	seta	al
+	.loc 1 260 13
+	xor	eax, 1
+	.loc 1 260 12
+	test	al, al
+	je	.L47
+	.loc 1 262 25
+	mov	QWORD PTR -8[rbp], -1
+	jmp	.L48
+.L47:
+	.loc 1 264 17
+	cmp	QWORD PTR -8[rbp], 0
+	jns	.L48
+	.loc 1 266 29
+	mov	eax, DWORD PTR -52[rbp]
+	movsx	rdx, eax
+	.loc 1 266 25
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -8[rbp], rax
+.L48:
+.LBE15:
+	.loc 1 244 48 discriminator 2
+	add	QWORD PTR -16[rbp], 256
+.L40:
+	.loc 1 244 30 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 244 24 discriminator 1
+	cmp	QWORD PTR -16[rbp], rax
+	jl	.L49
+.LBE14:
+	.loc 1 269 12
+	mov	rax, QWORD PTR -8[rbp]
+.L44:
+	.loc 1 270 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5015:
+	.size	lmsBench_Converge, .-lmsBench_Converge
+	.type	lmsBench_ConvergeEngine, @function
+lmsBench_ConvergeEngine:
+.LFB5016:
+	.loc 1 281 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	.loc 1 283 10
+	mov	QWORD PTR -8[rbp], -1
+	.loc 1 285 9
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR -48[rbp]
+	lea	rax, -32[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsEngine_Open@PLT
+	.loc 1 285 8
+	test	eax, eax
+	jne	.L51
+	.loc 1 287 23
+	lea	rdx, -32[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsBench_Converge
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 288 9
+	lea	rax, -32[rbp]
+	mov	rdi, rax
+	call	lmsEngine_Close@PLT
+.L51:
+	.loc 1 290 12
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 291 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5016:
+	.size	lmsBench_ConvergeEngine, .-lmsBench_ConvergeEngine
+	.type	lmsBench_MeasureEngine, @function
+lmsBench_MeasureEngine:
+.LFB5017:
+	.loc 1 308 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	add	rsp, -128
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	movss	DWORD PTR -84[rbp], xmm0
+	mov	QWORD PTR -96[rbp], rdx
+	mov	QWORD PTR -104[rbp], rcx
+	mov	QWORD PTR -112[rbp], r8
+	mov	QWORD PTR -120[rbp], r9
+	.loc 1 310 25
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR [rcx]
+	mov	rdx, QWORD PTR 8[rcx]
+	mov	QWORD PTR -64[rbp], rax
+	mov	QWORD PTR -56[rbp], rdx
+	mov	rax, QWORD PTR 16[rcx]
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 312 8
+	movss	xmm0, DWORD PTR -84[rbp]
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	jbe	.L54
+	.loc 1 314 27
+	movss	xmm0, DWORD PTR -84[rbp]
+	movss	DWORD PTR -60[rbp], xmm0
+.L54:
+	.loc 1 316 9
+	lea	rcx, -64[rbp]
+	lea	rax, -32[rbp]
+	mov	edx, 0
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsEngine_Open@PLT
+	.loc 1 316 8
+	test	eax, eax
+	je	.L56
+	.loc 1 318 16
+	mov	eax, 1
+	jmp	.L58
+.L56:
+	.loc 1 320 24
+	mov	rdi, QWORD PTR -120[rbp]
+	mov	rsi, QWORD PTR -112[rbp]
+	mov	rcx, QWORD PTR -104[rbp]
+	lea	rdx, -32[rbp]
+	mov	rax, QWORD PTR -72[rbp]
+	sub	rsp, 8
+	push	QWORD PTR 16[rbp]
+	mov	r9, rdi
+	mov	r8, rsi
+	lea	rsi, lmsBench_ProcessEngine[rip]
+	mov	rdi, rax
+	call	lmsBench_Measure
+	add	rsp, 16
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 321 5
+	lea	rax, -32[rbp]
+	mov	rdi, rax
+	call	lmsEngine_Close@PLT
+	.loc 1 323 27
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR -96[rbp]
+	mov	edx, 0
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsBench_ConvergeEngine
+	.loc 1 323 25
+	mov	rdx, QWORD PTR 16[rbp]
+	mov	QWORD PTR 64[rdx], rax
+	.loc 1 324 12
+	mov	eax, DWORD PTR -4[rbp]
+.L58:
+	.loc 1 325 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5017:
+	.size	lmsBench_MeasureEngine, .-lmsBench_MeasureEngine
+	.section	.rodata
+	.align 8
+.LC8:
+	.string	"algorithm,variant,kernel,length,block,samples,trials,samples_per_sec,median_ns_per_sample,min_ns_per_sample,ns_per_tap,cycles_per_tap,stable,converged_at\n"
+.LC9:
+	.string	"{\n"
+.LC10:
+	.string	"  \"version\": \"%d.%d.%d\",\n"
+.LC11:
+	.string	"  \"best_kernel\": \"%s\",\n"
+.LC12:
+	.string	"  \"samples\": %ld,\n"
+.LC13:
+	.string	"  \"trials\": %d,\n"
+.LC14:
+	.string	"  \"warmup\": %d,\n"
+.LC15:
+	.string	"  \"task_samples\": %ld,\n"
+.LC16:
+	.string	"  \"results\": ["
+	.align 8
+.LC17:
+	.string	"Samples per trial:            %ld\n"
+	.align 8
+.LC18:
+	.string	"Trials:                       %d (+%d warmup), median reported\n"
+	.align 8
+.LC19:
+	.string	"Convergence:                  samples until error is 20 dB below desired, pink noise through an unknown system of the filter length, %ld samples\n"
+.LC20:
+	.string	"length"
+.LC21:
+	.string	"kernel"
+.LC22:
+	.string	"variant"
+.LC23:
+	.string	"algorithm"
+	.align 8
+.LC24:
+	.string	"%-9s %-10s %-7s %7s %6s %13s %10s %10s %9s %10s %9s\n"
+.LC25:
+	.string	"converge"
+.LC26:
+	.string	"cycles/tap"
+.LC27:
+	.string	"ns/tap"
+.LC28:
+	.string	"min ns"
+.LC29:
+	.string	"ns/sample"
+.LC30:
+	.string	"samples/s"
+.LC31:
+	.string	"block"
+	.text
+	.type	lmsBench_PrintHeader, @function
+lmsBench_PrintHeader:
+.LFB5018:
+	.loc 1 334 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	.loc 1 335 21
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 176[rax]
+	.loc 1 335 5
+	cmp	eax, 2
+	je	.L61
+	cmp	eax, 3
+	je	.L62
+	jmp	.L65
+.L61:
+	.loc 1 338 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rax
+	mov	edx, 154
+	mov	esi, 1
+	lea	rax, .LC8[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 340 13
+	jmp	.L64
+.L62:
+	.loc 1 343 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rax
+	mov	edx, 2
+	mov	esi, 1
+	lea	rax, .LC9[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 344 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r8d, 0
+	mov	ecx, 0
+	mov	edx, 1
+	lea	rsi, .LC10[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 345 59
+	call	lmsKernel_GetBest@PLT
+	.loc 1 345 78
+	mov	rdx, QWORD PTR 8[rax]
+	.loc 1 345 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rcx, .LC11[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 346 60
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR 136[rax]
+	.loc 1 346 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rcx, .LC12[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 347 58
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, DWORD PTR 144[rax]
+	.loc 1 347 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rcx, .LC13[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 348 58
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, DWORD PTR 148[rax]
+	.loc 1 348 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rcx, .LC14[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 349 61
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 349 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rcx, .LC15[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 350 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rax
+	mov	edx, 14
+	mov	esi, 1
+	lea	rax, .LC16[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 351 13
+	jmp	.L64
+.L65:
+	.loc 1 354 74
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR 136[rax]
+	.loc 1 354 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rcx, .LC17[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 356 47
+	mov	rax, QWORD PTR -16[rbp]
+	mov	ecx, DWORD PTR 148[rax]
+	.loc 1 356 29
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, DWORD PTR 144[rax]
+	.loc 1 355 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rsi, .LC18[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 358 88
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 357 13
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rcx, .LC19[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 359 13
+	mov	rax, QWORD PTR -8[rbp]
+	sub	rsp, 8
+	lea	rdx, .LC25[rip]
+	push	rdx
+	lea	rdx, .LC26[rip]
+	push	rdx
+	lea	rdx, .LC27[rip]
+	push	rdx
+	lea	rdx, .LC28[rip]
+	push	rdx
+	lea	rdx, .LC29[rip]
+	push	rdx
+	lea	rdx, .LC30[rip]
+	push	rdx
+	lea	rdx, .LC31[rip]
+	push	rdx
+	lea	r9, .LC20[rip]
+	lea	r8, .LC21[rip]
+	lea	rdx, .LC22[rip]
+	mov	rcx, rdx
+	lea	rdx, .LC23[rip]
+	lea	rsi, .LC24[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	add	rsp, 64
+	.loc 1 361 13
+	nop
+.L64:
+	.loc 1 363 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5018:
+	.size	lmsBench_PrintHeader, .-lmsBench_PrintHeader
+	.section	.rodata
+.LC32:
+	.string	"%ld"
+.LC33:
+	.string	""
+	.align 8
+.LC34:
+	.string	"%s,%s,%s,%d,%d,%ld,%d,%.0f,%.3f,%.3f,%.4f,%.4f,%d,%s\n"
+.LC35:
+	.string	"null"
+.LC36:
+	.string	"true"
+.LC37:
+	.string	"false"
+.LC38:
+	.string	","
+	.align 8
+.LC39:
+	.string	"%s\n    { \"algorithm\": \"%s\", \"variant\": \"%s\", \"kernel\": \"%s\", \"length\": %d, \"block\": %d, \"samples_per_sec\": %.0f, \"median_ns_per_sample\": %.3f, \"min_ns_per_sample\": %.3f, \"ns_per_tap\": %.4f, \"cycles_per_tap\": %.4f, \"stable\": %s, \"converged_at\": %s }"
+.LC40:
+	.string	"  unstable"
+	.align 8
+.LC41:
+	.string	"%-9s %-10s %-7s %7d %6d %13.0f %10.2f %10.2f %9.4f %10.4f %9s%s\n"
+	.text
+	.type	lmsBench_PrintResult, @function
+lmsBench_PrintResult:
+.LFB5019:
+	.loc 1 374 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r12
+	push	rbx
+	sub	rsp, 80
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	QWORD PTR -88[rbp], rdx
+	mov	DWORD PTR -92[rbp], ecx
+	.loc 1 375 49
+	mov	rax, QWORD PTR -88[rbp]
+	movsd	xmm1, QWORD PTR 32[rax]
+	.loc 1 375 18
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 376 35
+	mov	rax, QWORD PTR -88[rbp]
+	movsd	xmm0, QWORD PTR 32[rax]
+	.loc 1 376 63
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 376 55
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, eax
+	.loc 1 376 18
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 377 39
+	mov	rax, QWORD PTR -88[rbp]
+	movsd	xmm0, QWORD PTR 48[rax]
+	.loc 1 377 65
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 377 57
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, eax
+	.loc 1 377 18
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR -40[rbp], xmm0
+	.loc 1 378 10
+	mov	QWORD PTR -64[rbp], 45
+	mov	QWORD PTR -56[rbp], 0
+	mov	QWORD PTR -48[rbp], 0
+	.loc 1 380 15
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 380 8
+	test	rax, rax
+	js	.L67
+	.loc 1 382 65
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 64[rax]
+	.loc 1 382 9
+	lea	rax, -64[rbp]
+	mov	rcx, rdx
+	lea	rdx, .LC32[rip]
+	mov	esi, 24
+	mov	rdi, rax
+	mov	eax, 0
+	call	snprintf@PLT
+.L67:
+	.loc 1 385 21
+	mov	rax, QWORD PTR -80[rbp]
+	mov	eax, DWORD PTR 176[rax]
+	.loc 1 385 5
+	cmp	eax, 2
+	je	.L68
+	cmp	eax, 3
+	je	.L69
+	jmp	.L82
+.L68:
+	.loc 1 391 58
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 388 13
+	test	rax, rax
+	js	.L71
+	.loc 1 388 13 is_stmt 0 discriminator 1
+	lea	rax, -64[rbp]
+	jmp	.L72
+.L71:
+	.loc 1 388 13 discriminator 2
+	lea	rax, .LC33[rip]
+.L72:
+	.loc 1 391 41 is_stmt 1 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	r11d, DWORD PTR 56[rdx]
+	.loc 1 390 90 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	movsd	xmm1, QWORD PTR 40[rdx]
+	.loc 1 390 63 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	movsd	xmm0, QWORD PTR 32[rdx]
+	.loc 1 390 29 discriminator 4
+	mov	rdx, QWORD PTR -80[rbp]
+	mov	r10d, DWORD PTR 144[rdx]
+	.loc 1 389 97 discriminator 4
+	mov	rdx, QWORD PTR -80[rbp]
+	mov	r9, QWORD PTR 136[rdx]
+	.loc 1 389 76 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	r8d, DWORD PTR 28[rdx]
+	.loc 1 389 60 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	r12d, DWORD PTR 24[rdx]
+	.loc 1 389 44 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rbx, QWORD PTR 16[rdx]
+	.loc 1 389 27 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rcx, QWORD PTR 8[rdx]
+	.loc 1 388 91 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR [rdx]
+	.loc 1 388 13 discriminator 4
+	movsd	xmm3, QWORD PTR -40[rbp]
+	movsd	xmm2, QWORD PTR -32[rbp]
+	mov	rsi, QWORD PTR -24[rbp]
+	mov	rdi, QWORD PTR -72[rbp]
+	sub	rsp, 8
+	push	rax
+	push	r11
+	push	r10
+	push	r9
+	push	r8
+	movapd	xmm4, xmm3
+	movapd	xmm3, xmm2
+	movapd	xmm2, xmm1
+	movapd	xmm1, xmm0
+	movq	xmm0, rsi
+	mov	r9d, r12d
+	mov	r8, rbx
+	lea	rax, .LC34[rip]
+	mov	rsi, rax
+	mov	eax, 5
+	call	fprintf@PLT
+	add	rsp, 48
+	.loc 1 392 13 discriminator 4
+	jmp	.L73
+.L69:
+	.loc 1 402 28
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 395 13
+	test	rax, rax
+	js	.L74
+	.loc 1 395 13 is_stmt 0 discriminator 1
+	lea	rdx, -64[rbp]
+	jmp	.L75
+.L74:
+	.loc 1 395 13 discriminator 2
+	lea	rdx, .LC35[rip]
+.L75:
+	.loc 1 401 51 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 395 13 discriminator 4
+	test	eax, eax
+	je	.L76
+	.loc 1 395 13 is_stmt 0 discriminator 5
+	lea	rcx, .LC36[rip]
+	jmp	.L77
+.L76:
+	.loc 1 395 13 discriminator 6
+	lea	rcx, .LC37[rip]
+.L77:
+	.loc 1 400 91 is_stmt 1 discriminator 8
+	mov	rax, QWORD PTR -88[rbp]
+	movsd	xmm1, QWORD PTR 40[rax]
+	.loc 1 400 64 discriminator 8
+	mov	rax, QWORD PTR -88[rbp]
+	movsd	xmm0, QWORD PTR 32[rax]
+	.loc 1 400 27 discriminator 8
+	mov	rax, QWORD PTR -88[rbp]
+	mov	r10d, DWORD PTR 28[rax]
+	.loc 1 399 97 discriminator 8
+	mov	rax, QWORD PTR -88[rbp]
+	mov	r9d, DWORD PTR 24[rax]
+	.loc 1 399 81 discriminator 8
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rbx, QWORD PTR 16[rax]
+	.loc 1 399 64 discriminator 8
+	mov	rax, QWORD PTR -88[rbp]
+	mov	r11, QWORD PTR 8[rax]
+	.loc 1 399 45 discriminator 8
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rsi, QWORD PTR [rax]
+	.loc 1 395 13 discriminator 8
+	cmp	DWORD PTR -92[rbp], 0
+	je	.L78
+	.loc 1 395 13 is_stmt 0 discriminator 9
+	lea	rax, .LC33[rip]
+	jmp	.L79
+.L78:
+	.loc 1 395 13 discriminator 10
+	lea	rax, .LC38[rip]
+.L79:
+	.loc 1 395 13 discriminator 12
+	movsd	xmm3, QWORD PTR -40[rbp]
+	movsd	xmm2, QWORD PTR -32[rbp]
+	mov	r8, QWORD PTR -24[rbp]
+	mov	rdi, QWORD PTR -72[rbp]
+	push	rdx
+	push	rcx
+	push	r10
+	push	r9
+	movapd	xmm4, xmm3
+	movapd	xmm3, xmm2
+	movapd	xmm2, xmm1
+	movapd	xmm1, xmm0
+	movq	xmm0, r8
+	mov	r9, rbx
+	mov	r8, r11
+	mov	rcx, rsi
+	mov	rdx, rax
+	lea	rax, .LC39[rip]
+	mov	rsi, rax
+	mov	eax, 5
+	call	fprintf@PLT
+	add	rsp, 32
+	.loc 1 403 13 is_stmt 1 discriminator 12
+	jmp	.L73
+.L82:
+	.loc 1 409 27
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 406 13
+	test	eax, eax
+	je	.L80
+	.loc 1 406 13 is_stmt 0 discriminator 1
+	lea	rax, .LC33[rip]
+	jmp	.L81
+.L80:
+	.loc 1 406 13 discriminator 2
+	lea	rax, .LC40[rip]
+.L81:
+	.loc 1 408 54 is_stmt 1 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	movsd	xmm1, QWORD PTR 40[rdx]
+	.loc 1 408 27 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	movsd	xmm0, QWORD PTR 32[rdx]
+	.loc 1 407 76 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	r8d, DWORD PTR 28[rdx]
+	.loc 1 407 60 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	r9d, DWORD PTR 24[rdx]
+	.loc 1 407 44 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	r10, QWORD PTR 16[rdx]
+	.loc 1 407 27 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rcx, QWORD PTR 8[rdx]
+	.loc 1 406 102 discriminator 4
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR [rdx]
+	.loc 1 406 13 discriminator 4
+	movsd	xmm3, QWORD PTR -40[rbp]
+	movsd	xmm2, QWORD PTR -32[rbp]
+	mov	rsi, QWORD PTR -24[rbp]
+	mov	rdi, QWORD PTR -72[rbp]
+	sub	rsp, 8
+	push	rax
+	lea	rax, -64[rbp]
+	push	rax
+	push	r8
+	movapd	xmm4, xmm3
+	movapd	xmm3, xmm2
+	movapd	xmm2, xmm1
+	movapd	xmm1, xmm0
+	movq	xmm0, rsi
+	mov	r8, r10
+	lea	rax, .LC41[rip]
+	mov	rsi, rax
+	mov	eax, 5
+	call	fprintf@PLT
+	add	rsp, 32
+	.loc 1 410 13 discriminator 4
+	nop
+.L73:
+	.loc 1 412 5
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdi, rax
+	call	fflush@PLT
+	.loc 1 413 1
+	nop
+	lea	rsp, -16[rbp]
+	pop	rbx
+	pop	r12
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5019:
+	.size	lmsBench_PrintResult, .-lmsBench_PrintResult
+	.globl	lmsBench_DefaultSettings
+	.type	lmsBench_DefaultSettings, @function
+lmsBench_DefaultSettings:
+.LFB5020:
+	.loc 1 416 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 420 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, 192
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 421 20
+	mov	rcx, QWORD PTR -8[rbp]
+	.loc 1 421 5
+	mov	rax, QWORD PTR lengths.1[rip]
+	mov	rdx, QWORD PTR lengths.1[rip+8]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+	.loc 1 422 28
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 64[rax], 4
+	.loc 1 423 20
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 68[rax]
+	.loc 1 423 5
+	mov	rax, QWORD PTR blockSizes.0[rip]
+	mov	QWORD PTR [rdx], rax
+	.loc 1 424 31
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 132[rax], 2
+	.loc 1 425 28
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 136[rax], 131072
+	.loc 1 426 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 144[rax], 5
+	.loc 1 427 28
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 148[rax], 1
+	.loc 1 428 27
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 152[rax], 0
+	.loc 1 429 27
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 156[rax], 1
+	.loc 1 430 28
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 160[rax], 1
+	.loc 1 431 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 164[rax], 1
+	.loc 1 432 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 168[rax], 1
+	.loc 1 433 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 172[rax], 1
+	.loc 1 434 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 176[rax], 1
+	.loc 1 435 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 184[rax], 0
+	.loc 1 436 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5020:
+	.size	lmsBench_DefaultSettings, .-lmsBench_DefaultSettings
+	.section	.rodata
+.LC42:
+	.string	"table"
+.LC43:
+	.string	"csv"
+.LC44:
+	.string	"json"
+	.align 8
+.LC45:
+	.string	"ERROR: Argument <format> must be table, csv or json"
+	.text
+	.globl	lmsBench_processArgumentFormat
+	.type	lmsBench_processArgumentFormat, @function
+lmsBench_processArgumentFormat:
+.LFB5021:
+	.loc 1 439 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 440 22
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 442 9
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC42[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 442 8
+	test	eax, eax
+	jne	.L85
+	.loc 1 444 16
+	mov	DWORD PTR -4[rbp], 1
+	jmp	.L86
+.L85:
+	.loc 1 446 14
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC43[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 446 13
+	test	eax, eax
+	jne	.L87
+	.loc 1 448 16
+	mov	DWORD PTR -4[rbp], 2
+	jmp	.L86
+.L87:
+	.loc 1 450 14
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC44[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 450 13
+	test	eax, eax
+	jne	.L88
+	.loc 1 452 16
+	mov	DWORD PTR -4[rbp], 3
+	jmp	.L86
+.L88:
+	.loc 1 456 9
+	lea	rax, .LC45[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L86:
+	.loc 1 458 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 459 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5021:
+	.size	lmsBench_processArgumentFormat, .-lmsBench_processArgumentFormat
+	.section	.rodata
+	.align 8
+.LC46:
+	.string	"ERROR: List must contain positive integers separated by commas"
+	.align 8
+.LC47:
+	.string	"ERROR: List must contain up to %d positive integers separated by commas\n"
+.LC48:
+	.string	"ERROR: List is empty"
+	.text
+	.globl	lmsBench_processArgumentList
+	.type	lmsBench_processArgumentList, @function
+lmsBench_processArgumentList:
+.LFB5022:
+	.loc 1 462 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	DWORD PTR -52[rbp], edx
+	.loc 1 463 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 464 17
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 466 11
+	jmp	.L91
+.L99:
+.LBB17:
+	.loc 1 471 14
+	call	__ctype_b_loc@PLT
+	mov	rdx, QWORD PTR [rax]
+	mov	rax, QWORD PTR -16[rbp]
+	movzx	eax, BYTE PTR [rax]
+	movzx	eax, al
+	add	rax, rax
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	movzx	eax, ax
+	and	eax, 2048
+	.loc 1 471 12
+	test	eax, eax
+	jne	.L92
+	.loc 1 473 13
+	lea	rax, .LC46[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 474 20
+	mov	eax, 0
+	jmp	.L98
+.L92:
+	.loc 1 476 17
+	lea	rcx, -32[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, 10
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	strtol@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 477 12
+	cmp	QWORD PTR -24[rbp], 0
+	jle	.L94
+	.loc 1 477 25 discriminator 1
+	cmp	QWORD PTR -24[rbp], 1000000
+	jg	.L94
+	.loc 1 477 46 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	je	.L94
+	.loc 1 477 75 discriminator 3
+	mov	rax, QWORD PTR -32[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 477 70 discriminator 3
+	cmp	al, 44
+	je	.L95
+	.loc 1 477 92 discriminator 4
+	mov	rax, QWORD PTR -32[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 477 88 discriminator 4
+	test	al, al
+	je	.L95
+.L94:
+	.loc 1 479 13
+	mov	eax, DWORD PTR -52[rbp]
+	mov	esi, eax
+	lea	rax, .LC47[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 480 20
+	mov	eax, 0
+	jmp	.L98
+.L95:
+	.loc 1 482 21
+	mov	eax, DWORD PTR -4[rbp]
+	lea	edx, 1[rax]
+	mov	DWORD PTR -4[rbp], edx
+	cdqe
+	.loc 1 482 15
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 482 27
+	mov	rdx, QWORD PTR -24[rbp]
+	.loc 1 482 25
+	mov	DWORD PTR [rax], edx
+	.loc 1 483 21
+	mov	rax, QWORD PTR -32[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 483 18
+	cmp	al, 44
+	jne	.L96
+	.loc 1 483 40 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	.loc 1 483 18 discriminator 1
+	add	rax, 1
+	jmp	.L97
+.L96:
+	.loc 1 483 18 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -32[rbp]
+.L97:
+	.loc 1 483 18 discriminator 4
+	mov	QWORD PTR -16[rbp], rax
+.L91:
+.LBE17:
+	.loc 1 466 12 is_stmt 1
+	mov	rax, QWORD PTR -16[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 466 22
+	test	al, al
+	jne	.L99
+	.loc 1 485 8
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L100
+	.loc 1 487 9
+	lea	rax, .LC48[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L100:
+	.loc 1 489 12
+	mov	eax, DWORD PTR -4[rbp]
+.L98:
+	.loc 1 490 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5022:
+	.size	lmsBench_processArgumentList, .-lmsBench_processArgumentList
+	.section	.rodata
+	.align 8
+.LC49:
+	.string	"ERROR: Number of samples and trials must be positive"
+.LC50:
+	.string	"order-%d"
+.LC51:
+	.string	"w"
+.LC53:
+	.string	"fdaf"
+.LC54:
+	.string	"lms"
+.LC55:
+	.string	"fft"
+.LC56:
+	.string	"subband"
+.LC57:
+	.string	"nlms"
+.LC58:
+	.string	"dft"
+.LC60:
+	.string	"rls"
+.LC61:
+	.string	"scalar"
+.LC63:
+	.string	"apa"
+.LC65:
+	.string	"q15"
+.LC66:
+	.string	"\n  ]\n}\n"
+	.text
+	.globl	lmsBench_Run
+	.type	lmsBench_Run, @function
+lmsBench_Run:
+.LFB5023:
+	.loc 1 493 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 784
+	mov	QWORD PTR -776[rbp], rdi
+	.loc 1 494 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 495 9
+	mov	DWORD PTR -8[rbp], 1
+	.loc 1 496 9
+	mov	DWORD PTR -12[rbp], 1
+	.loc 1 497 11
+	mov	rax, QWORD PTR stdout[rip]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 502 18
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 502 8
+	test	rax, rax
+	jle	.L102
+	.loc 1 502 50 discriminator 1
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 502 38 discriminator 1
+	test	eax, eax
+	jle	.L102
+	.loc 1 502 76 discriminator 2
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	.loc 1 502 64 discriminator 2
+	test	eax, eax
+	jns	.L103
+.L102:
+	.loc 1 504 9
+	lea	rax, .LC49[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 505 16
+	mov	eax, 1
+	jmp	.L148
+.L103:
+.LBB18:
+	.loc 1 507 14
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 507 5
+	jmp	.L105
+.L107:
+	.loc 1 509 33
+	mov	rax, QWORD PTR -776[rbp]
+	mov	edx, DWORD PTR -28[rbp]
+	movsx	rdx, edx
+	add	rdx, 16
+	mov	eax, DWORD PTR 4[rax+rdx*4]
+	.loc 1 509 12
+	cmp	DWORD PTR -8[rbp], eax
+	jge	.L106
+	.loc 1 511 26
+	mov	rax, QWORD PTR -776[rbp]
+	mov	edx, DWORD PTR -28[rbp]
+	movsx	rdx, edx
+	add	rdx, 16
+	mov	eax, DWORD PTR 4[rax+rdx*4]
+	mov	DWORD PTR -8[rbp], eax
+.L106:
+	.loc 1 507 53 discriminator 2
+	add	DWORD PTR -28[rbp], 1
+.L105:
+	.loc 1 507 33 discriminator 1
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 132[rax]
+	.loc 1 507 23 discriminator 1
+	cmp	DWORD PTR -28[rbp], eax
+	jl	.L107
+.LBE18:
+	.loc 1 514 34
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 514 100
+	mov	edx, 65536
+	cmp	rax, rdx
+	cmovg	rax, rdx
+	.loc 1 514 23
+	mov	QWORD PTR -216[rbp], rax
+	.loc 1 517 43
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 517 28
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -80[rbp], rax
+	.loc 1 518 29
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -88[rbp], rax
+	.loc 1 519 28
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -96[rbp], rax
+	.loc 1 520 52
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 520 37
+	add	rax, rax
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 521 50
+	mov	rax, QWORD PTR -216[rbp]
+	.loc 1 521 64
+	sub	rax, -128
+	.loc 1 521 34
+	sal	rax, 3
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 522 8
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L108
+	.loc 1 522 25 discriminator 1
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L108
+	.loc 1 522 45 discriminator 2
+	cmp	QWORD PTR -96[rbp], 0
+	je	.L108
+	.loc 1 522 64 discriminator 3
+	cmp	QWORD PTR -104[rbp], 0
+	je	.L108
+	.loc 1 522 88 discriminator 4
+	cmp	QWORD PTR -112[rbp], 0
+	jne	.L109
+.L108:
+	.loc 1 524 9
+	lea	rax, .LC3[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 525 9
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 526 9
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 527 9
+	mov	rax, QWORD PTR -96[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 528 9
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 529 9
+	mov	rax, QWORD PTR -112[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 530 16
+	mov	eax, 1
+	jmp	.L148
+.L109:
+	.loc 1 532 5
+	lea	rax, -208[rbp]
+	mov	rdi, rax
+	call	signalGenerator_DefaultSettings@PLT
+	.loc 1 533 20
+	mov	DWORD PTR -208[rbp], 1
+	.loc 1 534 26
+	mov	DWORD PTR -200[rbp], 100
+	.loc 1 535 64
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 535 5
+	mov	rdx, rax
+	mov	rcx, QWORD PTR -80[rbp]
+	lea	rax, -208[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	signalGenerator_generateSamples@PLT
+.LBB19:
+	.loc 1 536 15
+	mov	QWORD PTR -40[rbp], 0
+	.loc 1 536 5
+	jmp	.L110
+.L113:
+.LBB20:
+	.loc 1 538 35
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 538 20
+	sub	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -152[rbp], rax
+	.loc 1 539 9
+	cmp	QWORD PTR -152[rbp], 65535
+	jg	.L111
+	.loc 1 539 9 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -152[rbp]
+	mov	esi, eax
+	jmp	.L112
+.L111:
+	.loc 1 539 9 discriminator 2
+	mov	esi, 65536
+.L112:
+	.loc 1 539 50 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 539 44 discriminator 4
+	mov	rax, QWORD PTR -80[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 539 39 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rdx, [rax+rax]
+	.loc 1 539 9 discriminator 4
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	mov	edx, esi
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFixed_FromFloat@PLT
+.LBE20:
+	.loc 1 536 52 discriminator 4
+	add	QWORD PTR -40[rbp], 65536
+.L110:
+	.loc 1 536 34 discriminator 2
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 536 24 discriminator 2
+	cmp	QWORD PTR -40[rbp], rax
+	jl	.L113
+.LBE19:
+	.loc 1 541 16
+	mov	rax, QWORD PTR -112[rbp]
+	mov	QWORD PTR -240[rbp], rax
+	.loc 1 542 37
+	mov	rax, QWORD PTR -216[rbp]
+	.loc 1 542 32
+	lea	rdx, 0[0+rax*4]
+	.loc 1 542 20
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rdx
+	.loc 1 542 18
+	mov	QWORD PTR -232[rbp], rax
+	.loc 1 543 39
+	mov	rax, QWORD PTR -216[rbp]
+	.loc 1 543 30
+	lea	rdx, 0[0+rax*8]
+	.loc 1 543 18
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rdx
+	.loc 1 543 16
+	mov	QWORD PTR -224[rbp], rax
+	.loc 1 544 5
+	lea	rax, -208[rbp]
+	mov	rdi, rax
+	call	signalGenerator_DefaultSettings@PLT
+	.loc 1 545 20
+	mov	DWORD PTR -208[rbp], 6
+	.loc 1 546 65
+	mov	rax, QWORD PTR -216[rbp]
+	.loc 1 546 5
+	mov	rdx, rax
+	mov	rcx, QWORD PTR -240[rbp]
+	lea	rax, -208[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	signalGenerator_generateSamples@PLT
+	.loc 1 547 5
+	lea	rax, -256[rbp]
+	mov	ecx, 4
+	lea	rdx, .LC50[rip]
+	mov	esi, 16
+	mov	rdi, rax
+	mov	eax, 0
+	call	snprintf@PLT
+	.loc 1 549 17
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 549 8
+	test	rax, rax
+	je	.L114
+	.loc 1 551 30
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 551 16
+	lea	rdx, .LC51[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	fopen@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 552 12
+	cmp	QWORD PTR -24[rbp], 0
+	jne	.L114
+	.loc 1 554 28
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 554 13
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 555 13
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 556 13
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 557 13
+	mov	rax, QWORD PTR -96[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 558 13
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 559 13
+	mov	rax, QWORD PTR -112[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 560 20
+	mov	eax, 1
+	jmp	.L148
+.L114:
+	.loc 1 564 5
+	lea	rdx, -240[rbp]
+	mov	rcx, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsBench_PrintHeader
+.LBB21:
+	.loc 1 565 14
+	mov	DWORD PTR -44[rbp], 0
+	.loc 1 565 5
+	jmp	.L115
+.L145:
+.LBB22:
+	.loc 1 567 19
+	mov	rax, QWORD PTR -776[rbp]
+	mov	edx, DWORD PTR -44[rbp]
+	movsx	rdx, edx
+	mov	eax, DWORD PTR [rax+rdx*4]
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 568 49
+	pxor	xmm1, xmm1
+	cvtsi2ss	xmm1, DWORD PTR -116[rbp]
+	.loc 1 568 21
+	movss	xmm0, DWORD PTR .LC52[rip]
+	divss	xmm0, xmm1
+	movss	DWORD PTR -120[rbp], xmm0
+	.loc 1 569 35
+	pxor	xmm0, xmm0
+	movaps	XMMWORD PTR -288[rbp], xmm0
+	movq	QWORD PTR -272[rbp], xmm0
+	mov	DWORD PTR -288[rbp], 1
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR -284[rbp], xmm0
+	mov	eax, DWORD PTR -116[rbp]
+	mov	DWORD PTR -280[rbp], eax
+	mov	DWORD PTR -268[rbp], 1
+	.loc 1 571 35
+	pxor	xmm0, xmm0
+	movaps	XMMWORD PTR -320[rbp], xmm0
+	movq	QWORD PTR -304[rbp], xmm0
+	mov	DWORD PTR -320[rbp], 3
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR -316[rbp], xmm0
+	mov	eax, DWORD PTR -116[rbp]
+	mov	DWORD PTR -312[rbp], eax
+	mov	DWORD PTR -300[rbp], 1
+	.loc 1 577 36
+	lea	rdx, -576[rbp]
+	mov	eax, 0
+	mov	ecx, 32
+	mov	rdi, rdx
+	rep stosq
+	.loc 1 579 23
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 156[rax]
+	.loc 1 577 36
+	mov	DWORD PTR -576[rbp], eax
+	lea	rax, .LC53[rip]
+	mov	QWORD PTR -568[rbp], rax
+	lea	rax, .LC54[rip]
+	mov	QWORD PTR -560[rbp], rax
+	lea	rax, .LC55[rip]
+	mov	QWORD PTR -552[rbp], rax
+	mov	DWORD PTR -544[rbp], 2
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR -540[rbp], xmm0
+	mov	eax, DWORD PTR -116[rbp]
+	mov	DWORD PTR -536[rbp], eax
+	mov	DWORD PTR -524[rbp], 1
+	.loc 1 581 45
+	mov	eax, DWORD PTR -116[rbp]
+	mov	edi, eax
+	call	fdafFilter_BlockSize@PLT
+	.loc 1 581 43
+	pxor	xmm1, xmm1
+	cvtsi2ss	xmm1, eax
+	movss	xmm0, DWORD PTR -120[rbp]
+	divss	xmm0, xmm1
+	.loc 1 577 36
+	movss	DWORD PTR -520[rbp], xmm0
+	.loc 1 582 23
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 164[rax]
+	.loc 1 577 36
+	mov	DWORD PTR -512[rbp], eax
+	lea	rax, .LC56[rip]
+	mov	QWORD PTR -504[rbp], rax
+	lea	rax, .LC57[rip]
+	mov	QWORD PTR -496[rbp], rax
+	lea	rax, .LC58[rip]
+	mov	QWORD PTR -488[rbp], rax
+	mov	DWORD PTR -480[rbp], 4
+	movss	xmm0, DWORD PTR .LC59[rip]
+	movss	DWORD PTR -476[rbp], xmm0
+	mov	eax, DWORD PTR -116[rbp]
+	mov	DWORD PTR -472[rbp], eax
+	mov	DWORD PTR -460[rbp], 1
+	.loc 1 585 23
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	.loc 1 577 36
+	mov	DWORD PTR -448[rbp], eax
+	lea	rax, .LC60[rip]
+	mov	QWORD PTR -440[rbp], rax
+	.loc 1 586 15
+	cmp	DWORD PTR -116[rbp], 64
+	jg	.L116
+	.loc 1 586 15 is_stmt 0 discriminator 1
+	mov	eax, 1
+	jmp	.L117
+.L116:
+	.loc 1 586 15 discriminator 2
+	mov	eax, 2
+.L117:
+	.loc 1 586 15 discriminator 4
+	mov	edi, eax
+	call	rlsFilter_FormName@PLT
+	.loc 1 577 36 is_stmt 1 discriminator 4
+	mov	QWORD PTR -432[rbp], rax
+	lea	rax, .LC61[rip]
+	mov	QWORD PTR -424[rbp], rax
+	mov	DWORD PTR -416[rbp], 5
+	.loc 1 588 93 discriminator 4
+	mov	edx, DWORD PTR -116[rbp]
+	mov	eax, edx
+	sal	eax, 2
+	add	eax, edx
+	add	eax, eax
+	.loc 1 588 69 discriminator 4
+	pxor	xmm1, xmm1
+	cvtsi2ss	xmm1, eax
+	movss	xmm0, DWORD PTR .LC62[rip]
+	divss	xmm0, xmm1
+	.loc 1 577 36 discriminator 4
+	movss	DWORD PTR -412[rbp], xmm0
+	mov	eax, DWORD PTR -116[rbp]
+	mov	DWORD PTR -408[rbp], eax
+	mov	DWORD PTR -396[rbp], 1
+	.loc 1 590 23 discriminator 4
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 172[rax]
+	.loc 1 577 36 discriminator 4
+	mov	DWORD PTR -384[rbp], eax
+	lea	rax, .LC63[rip]
+	mov	QWORD PTR -376[rbp], rax
+	lea	rax, -256[rbp]
+	mov	QWORD PTR -368[rbp], rax
+	.loc 1 590 56 discriminator 4
+	call	lmsKernel_GetBest@PLT
+	.loc 1 590 75 discriminator 4
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 577 36 discriminator 4
+	mov	QWORD PTR -360[rbp], rax
+	mov	DWORD PTR -352[rbp], 6
+	movss	xmm0, DWORD PTR .LC59[rip]
+	movss	DWORD PTR -348[rbp], xmm0
+	mov	eax, DWORD PTR -116[rbp]
+	mov	DWORD PTR -344[rbp], eax
+	mov	DWORD PTR -336[rbp], 4
+	mov	DWORD PTR -332[rbp], 1
+	.loc 1 595 13 discriminator 4
+	mov	edx, DWORD PTR -116[rbp]
+	lea	rax, -240[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsBench_InitTask
+	.loc 1 595 12 discriminator 4
+	test	eax, eax
+	je	.L118
+	.loc 1 597 20
+	mov	DWORD PTR -4[rbp], 1
+	jmp	.L119
+.L118:
+.LBB23:
+	.loc 1 600 18
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 600 9
+	jmp	.L120
+.L144:
+.LBB24:
+	.loc 1 602 30
+	lea	rax, .LC54[rip]
+	mov	QWORD PTR -768[rbp], rax
+	mov	QWORD PTR -760[rbp], 0
+	mov	QWORD PTR -752[rbp], 0
+	mov	eax, DWORD PTR -116[rbp]
+	mov	DWORD PTR -744[rbp], eax
+	.loc 1 602 88
+	mov	rax, QWORD PTR -776[rbp]
+	mov	edx, DWORD PTR -48[rbp]
+	movsx	rdx, edx
+	add	rdx, 16
+	mov	eax, DWORD PTR 4[rax+rdx*4]
+	.loc 1 602 30
+	mov	DWORD PTR -740[rbp], eax
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -736[rbp], xmm0
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -728[rbp], xmm0
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -720[rbp], xmm0
+	mov	DWORD PTR -712[rbp], 1
+	mov	QWORD PTR -704[rbp], -1
+.LBB25:
+	.loc 1 605 22
+	mov	DWORD PTR -52[rbp], 0
+	.loc 1 605 13
+	jmp	.L121
+.L130:
+.LBB26:
+	.loc 1 607 45
+	mov	eax, DWORD PTR -52[rbp]
+	mov	edi, eax
+	call	lmsKernel_Get@PLT
+	mov	QWORD PTR -128[rbp], rax
+	.loc 1 608 51
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 152[rax]
+	.loc 1 608 92
+	test	eax, eax
+	je	.L122
+	.loc 1 608 92 is_stmt 0 discriminator 1
+	mov	eax, 6
+	jmp	.L123
+.L122:
+	.loc 1 608 92 discriminator 2
+	mov	eax, 1
+.L123:
+	.loc 1 608 27 is_stmt 1 discriminator 4
+	mov	DWORD PTR -132[rbp], eax
+.LBB27:
+	.loc 1 610 26 discriminator 4
+	mov	DWORD PTR -56[rbp], 0
+	.loc 1 610 17 discriminator 4
+	jmp	.L124
+.L128:
+.LBB28:
+	.loc 1 613 25
+	mov	edx, DWORD PTR -56[rbp]
+	mov	esi, DWORD PTR -116[rbp]
+	mov	edi, DWORD PTR -120[rbp]
+	lea	rax, -688[rbp]
+	mov	ecx, 0
+	movss	xmm1, DWORD PTR .LC64[rip]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	lmsFilter_InitVariant@PLT
+	.loc 1 613 24
+	test	eax, eax
+	je	.L125
+	.loc 1 616 32
+	mov	DWORD PTR -4[rbp], 1
+	jmp	.L126
+.L125:
+	.loc 1 619 35
+	mov	rax, QWORD PTR -128[rbp]
+	mov	QWORD PTR -616[rbp], rax
+	.loc 1 620 38
+	mov	eax, DWORD PTR -56[rbp]
+	mov	edi, eax
+	call	lmsFilter_VariantName@PLT
+	.loc 1 620 36
+	mov	QWORD PTR -760[rbp], rax
+	.loc 1 621 43
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 621 35
+	mov	QWORD PTR -752[rbp], rax
+	.loc 1 622 30
+	mov	r8, QWORD PTR -96[rbp]
+	mov	rdi, QWORD PTR -88[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	lea	rdx, -688[rbp]
+	mov	rax, QWORD PTR -776[rbp]
+	sub	rsp, 8
+	lea	rsi, -768[rbp]
+	push	rsi
+	mov	r9, r8
+	mov	r8, rdi
+	lea	rsi, lmsBench_ProcessLms[rip]
+	mov	rdi, rax
+	call	lmsBench_Measure
+	add	rsp, 16
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 623 21
+	lea	rax, -688[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free@PLT
+	.loc 1 626 24
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L127
+	.loc 1 627 39
+	mov	edx, DWORD PTR -56[rbp]
+	mov	esi, DWORD PTR -116[rbp]
+	mov	edi, DWORD PTR -120[rbp]
+	lea	rax, -688[rbp]
+	mov	ecx, 0
+	movss	xmm1, DWORD PTR .LC64[rip]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	lmsFilter_InitVariant@PLT
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 627 25
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L127
+	.loc 1 630 39
+	mov	rax, QWORD PTR -128[rbp]
+	mov	QWORD PTR -616[rbp], rax
+	.loc 1 631 46
+	lea	rdx, -688[rbp]
+	lea	rcx, -288[rbp]
+	lea	rax, -240[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsBench_ConvergeEngine
+	.loc 1 631 44
+	mov	QWORD PTR -704[rbp], rax
+	.loc 1 632 25
+	lea	rax, -688[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free@PLT
+	.loc 1 633 25
+	mov	ecx, DWORD PTR -12[rbp]
+	lea	rdx, -768[rbp]
+	mov	rsi, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsBench_PrintResult
+	.loc 1 634 31
+	mov	DWORD PTR -12[rbp], 0
+.L127:
+.LBE28:
+	.loc 1 610 103
+	add	DWORD PTR -56[rbp], 1
+.L124:
+	.loc 1 610 73 discriminator 1
+	cmp	QWORD PTR -128[rbp], 0
+	je	.L126
+	.loc 1 610 50 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	cmp	eax, DWORD PTR -132[rbp]
+	jge	.L126
+	.loc 1 610 73 discriminator 4
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L128
+.L126:
+.LBE27:
+.LBE26:
+	.loc 1 605 82 discriminator 2
+	add	DWORD PTR -52[rbp], 1
+.L121:
+	.loc 1 605 52 discriminator 1
+	cmp	DWORD PTR -52[rbp], 3
+	jg	.L129
+	.loc 1 605 52 is_stmt 0 discriminator 3
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L130
+.L129:
+.LBE25:
+.LBB29:
+	.loc 1 640 22 is_stmt 1
+	mov	DWORD PTR -60[rbp], 0
+	.loc 1 640 13
+	jmp	.L131
+.L137:
+.LBB30:
+	.loc 1 642 50
+	mov	eax, DWORD PTR -60[rbp]
+	mov	edi, eax
+	call	lmsFixed_GetKernel@PLT
+	mov	QWORD PTR -144[rbp], rax
+	.loc 1 643 33
+	pxor	xmm0, xmm0
+	movaps	XMMWORD PTR -688[rbp], xmm0
+	movaps	XMMWORD PTR -672[rbp], xmm0
+	movaps	XMMWORD PTR -656[rbp], xmm0
+	movaps	XMMWORD PTR -640[rbp], xmm0
+	mov	rax, QWORD PTR -80[rbp]
+	mov	QWORD PTR -640[rbp], rax
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR -632[rbp], rax
+	.loc 1 645 20
+	cmp	QWORD PTR -144[rbp], 0
+	je	.L149
+	.loc 1 649 21
+	mov	eax, DWORD PTR -120[rbp]
+	movd	xmm0, eax
+	call	lmsFixed_StepShift@PLT
+	mov	ecx, eax
+	mov	edx, DWORD PTR -116[rbp]
+	lea	rax, -688[rbp]
+	mov	esi, ecx
+	mov	rdi, rax
+	call	lmsFixed_Init@PLT
+	.loc 1 649 20
+	test	eax, eax
+	je	.L134
+	.loc 1 651 28
+	mov	DWORD PTR -4[rbp], 1
+	jmp	.L135
+.L134:
+	.loc 1 654 37
+	mov	rax, QWORD PTR -144[rbp]
+	mov	QWORD PTR -656[rbp], rax
+	.loc 1 655 34
+	lea	rax, .LC65[rip]
+	mov	QWORD PTR -768[rbp], rax
+	.loc 1 656 32
+	lea	rax, .LC54[rip]
+	mov	QWORD PTR -760[rbp], rax
+	.loc 1 657 39
+	mov	rax, QWORD PTR -144[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 657 31
+	mov	QWORD PTR -752[rbp], rax
+	.loc 1 658 26
+	mov	r8, QWORD PTR -96[rbp]
+	mov	rdi, QWORD PTR -88[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	lea	rdx, -688[rbp]
+	mov	rax, QWORD PTR -776[rbp]
+	sub	rsp, 8
+	lea	rsi, -768[rbp]
+	push	rsi
+	mov	r9, r8
+	mov	r8, rdi
+	lea	rsi, lmsBench_ProcessFixed[rip]
+	mov	rdi, rax
+	call	lmsBench_Measure
+	add	rsp, 16
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 659 20
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L136
+	.loc 1 662 42
+	lea	rcx, -320[rbp]
+	lea	rax, -240[rbp]
+	mov	edx, 0
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsBench_ConvergeEngine
+	.loc 1 662 40
+	mov	QWORD PTR -704[rbp], rax
+	.loc 1 663 21
+	mov	ecx, DWORD PTR -12[rbp]
+	lea	rdx, -768[rbp]
+	mov	rsi, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsBench_PrintResult
+	.loc 1 664 27
+	mov	DWORD PTR -12[rbp], 0
+.L136:
+	.loc 1 666 17
+	lea	rax, -688[rbp]
+	mov	rdi, rax
+	call	lmsFixed_Free@PLT
+	jmp	.L133
+.L149:
+	.loc 1 647 21
+	nop
+.L133:
+.LBE30:
+	.loc 1 640 108 discriminator 2
+	add	DWORD PTR -60[rbp], 1
+.L131:
+	.loc 1 640 37 discriminator 1
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 160[rax]
+	.loc 1 640 78 discriminator 1
+	test	eax, eax
+	je	.L135
+	.loc 1 640 52 discriminator 3
+	cmp	DWORD PTR -60[rbp], 3
+	jg	.L135
+	.loc 1 640 78 discriminator 4
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L137
+.L135:
+.LBE29:
+.LBB31:
+	.loc 1 669 25
+	mov	QWORD PTR -72[rbp], 0
+	.loc 1 669 13
+	jmp	.L138
+.L142:
+	.loc 1 671 36
+	mov	rax, QWORD PTR -72[rbp]
+	sal	rax, 6
+	add	rax, rbp
+	sub	rax, 576
+	mov	eax, DWORD PTR [rax]
+	.loc 1 671 20
+	test	eax, eax
+	je	.L150
+	.loc 1 675 50
+	mov	rax, QWORD PTR -72[rbp]
+	sal	rax, 6
+	add	rax, rbp
+	sub	rax, 568
+	mov	rax, QWORD PTR [rax]
+	.loc 1 675 34
+	mov	QWORD PTR -768[rbp], rax
+	.loc 1 676 48
+	mov	rax, QWORD PTR -72[rbp]
+	sal	rax, 6
+	add	rax, rbp
+	sub	rax, 560
+	mov	rax, QWORD PTR [rax]
+	.loc 1 676 32
+	mov	QWORD PTR -760[rbp], rax
+	.loc 1 677 47
+	mov	rax, QWORD PTR -72[rbp]
+	sal	rax, 6
+	add	rax, rbp
+	sub	rax, 552
+	mov	rax, QWORD PTR [rax]
+	.loc 1 677 31
+	mov	QWORD PTR -752[rbp], rax
+	.loc 1 678 97
+	mov	rax, QWORD PTR -72[rbp]
+	sal	rax, 6
+	add	rax, rbp
+	sub	rax, 520
+	mov	esi, DWORD PTR [rax]
+	.loc 1 678 26
+	lea	rax, -576[rbp]
+	mov	rdx, QWORD PTR -72[rbp]
+	sal	rdx, 6
+	add	rdx, 32
+	lea	rdi, [rax+rdx]
+	mov	r9, QWORD PTR -96[rbp]
+	mov	r10, QWORD PTR -88[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	lea	rdx, -240[rbp]
+	mov	rax, QWORD PTR -776[rbp]
+	sub	rsp, 8
+	lea	r8, -768[rbp]
+	push	r8
+	mov	r8, r10
+	movd	xmm0, esi
+	mov	rsi, rdi
+	mov	rdi, rax
+	call	lmsBench_MeasureEngine
+	add	rsp, 16
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 680 20
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L140
+	.loc 1 682 21
+	mov	ecx, DWORD PTR -12[rbp]
+	lea	rdx, -768[rbp]
+	mov	rsi, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsBench_PrintResult
+	.loc 1 683 27
+	mov	DWORD PTR -12[rbp], 0
+	jmp	.L140
+.L150:
+	.loc 1 673 21
+	nop
+.L140:
+	.loc 1 669 113 discriminator 2
+	add	QWORD PTR -72[rbp], 1
+.L138:
+	.loc 1 669 83 discriminator 1
+	cmp	QWORD PTR -72[rbp], 3
+	ja	.L141
+	.loc 1 669 83 is_stmt 0 discriminator 3
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L142
+.L141:
+.LBE31:
+.LBE24:
+	.loc 1 600 87 is_stmt 1 discriminator 2
+	add	DWORD PTR -48[rbp], 1
+.L120:
+	.loc 1 600 38 discriminator 1
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 132[rax]
+	.loc 1 600 57 discriminator 1
+	cmp	DWORD PTR -48[rbp], eax
+	jge	.L143
+	.loc 1 600 57 is_stmt 0 discriminator 3
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L144
+.L143:
+.LBE23:
+.LBE22:
+	.loc 1 565 80 is_stmt 1
+	add	DWORD PTR -44[rbp], 1
+.L115:
+	.loc 1 565 34 discriminator 1
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 565 50 discriminator 1
+	cmp	DWORD PTR -44[rbp], eax
+	jge	.L119
+	.loc 1 565 50 is_stmt 0 discriminator 3
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L145
+.L119:
+.LBE21:
+	.loc 1 688 17 is_stmt 1
+	mov	rax, QWORD PTR -776[rbp]
+	mov	eax, DWORD PTR 176[rax]
+	.loc 1 688 8
+	cmp	eax, 3
+	jne	.L146
+	.loc 1 690 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, rax
+	mov	edx, 7
+	mov	esi, 1
+	lea	rax, .LC66[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+.L146:
+	.loc 1 693 15
+	mov	rax, QWORD PTR stdout[rip]
+	.loc 1 693 8
+	cmp	QWORD PTR -24[rbp], rax
+	je	.L147
+	.loc 1 693 30 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 693 26 discriminator 1
+	test	eax, eax
+	je	.L147
+	.loc 1 695 24
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 695 9
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 696 16
+	mov	DWORD PTR -4[rbp], 1
+.L147:
+	.loc 1 698 5
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 699 5
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 700 5
+	mov	rax, QWORD PTR -96[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 701 5
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 702 5
+	mov	rax, QWORD PTR -112[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 703 12
+	mov	eax, DWORD PTR -4[rbp]
+.L148:
+	.loc 1 704 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE5023:
+	.size	lmsBench_Run, .-lmsBench_Run
+	.section	.rodata
+	.align 16
+	.type	lengths.1, @object
+	.size	lengths.1, 16
+lengths.1:
+	.long	16
+	.long	64
+	.long	256
+	.long	1024
+	.align 8
+	.type	blockSizes.0, @object
+	.size	blockSizes.0, 8
+blockSizes.0:
+	.long	64
+	.long	4096
+	.align 8
+.LC0:
+	.long	0
+	.long	1104006501
+	.align 8
+.LC4:
+	.long	0
+	.long	-1072693248
+	.align 8
+.LC5:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC6:
+	.long	1202590843
+	.long	1065646817
+	.align 4
+.LC52:
+	.long	1036831949
+	.align 4
+.LC59:
+	.long	1056964608
+	.align 4
+.LC62:
+	.long	1065353216
+	.align 4
+.LC64:
+	.long	1008981770
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 8 "/usr/include/stdlib.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 11 "/usr/include/ctype.h"
+	.file 12 "include/lmsBench.h"
+	.file 13 "include/lmsAllocator.h"
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 15 "include/lmsKernel.h"
+	.file 16 "include/sampleIo.h"
+	.file 17 "include/lmsFilter.h"
+	.file 18 "include/lmsEngine.h"
+	.file 19 "include/rlsFilter.h"
+	.file 20 "include/lmsFixed.h"
+	.file 21 "include/signalGenerator.h"
+	.file 22 "/usr/include/stdio.h"
+	.file 23 "include/fdafFilter.h"
+	.file 24 "/usr/include/string.h"
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 26 "/usr/include/time.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1e68
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x27
+	.long	.LASF304
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.long	.LASF9
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x41
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x9
+	.long	0x4d
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x9
+	.long	0x67
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x6
+	.long	.LASF10
+	.byte	0x4
+	.byte	0x27
+	.byte	0x1a
+	.long	0x8d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x6
+	.long	.LASF12
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x19
+	.long	0x4d
+	.uleb128 0x6
+	.long	.LASF13
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x6
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x98
+	.byte	0x19
+	.long	0x4d
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x99
+	.byte	0x1b
+	.long	0x4d
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x4
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x4d
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x4
+	.byte	0xa9
+	.byte	0x1d
+	.long	0x41
+	.uleb128 0x29
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF18
+	.byte	0x4
+	.byte	0xc5
+	.byte	0x21
+	.long	0x4d
+	.uleb128 0x3
+	.long	0xef
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF19
+	.uleb128 0x9
+	.long	0xef
+	.uleb128 0x6
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0xd0
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x19
+	.byte	0x13
+	.long	0x81
+	.uleb128 0x9
+	.long	0x107
+	.uleb128 0x6
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x13
+	.long	0x94
+	.uleb128 0x1b
+	.long	.LASF27
+	.byte	0x10
+	.byte	0x7
+	.byte	0xb
+	.long	0x14b
+	.uleb128 0x2
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x10
+	.byte	0xc
+	.long	0xc4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF24
+	.byte	0x7
+	.byte	0x15
+	.byte	0x15
+	.long	0xde
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF25
+	.uleb128 0x9
+	.long	0x14b
+	.uleb128 0x2a
+	.long	.LASF26
+	.byte	0x8
+	.value	0x33d
+	.byte	0xf
+	.long	0x164
+	.uleb128 0x3
+	.long	0x169
+	.uleb128 0xf
+	.long	0x41
+	.long	0x17d
+	.uleb128 0x1
+	.long	0x17d
+	.uleb128 0x1
+	.long	0x17d
+	.byte	0
+	.uleb128 0x3
+	.long	0x182
+	.uleb128 0x2b
+	.uleb128 0x1b
+	.long	.LASF28
+	.byte	0xd8
+	.byte	0x9
+	.byte	0x31
+	.long	0x309
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x9
+	.byte	0x33
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x9
+	.byte	0x36
+	.byte	0x9
+	.long	0xea
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0x9
+	.byte	0x37
+	.byte	0x9
+	.long	0xea
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x9
+	.byte	0x38
+	.byte	0x9
+	.long	0xea
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0x9
+	.byte	0x39
+	.byte	0x9
+	.long	0xea
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x9
+	.long	0xea
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x9
+	.long	0xea
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x9
+	.long	0xea
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x9
+	.long	0xea
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x40
+	.byte	0x9
+	.long	0xea
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x41
+	.byte	0x9
+	.long	0xea
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x42
+	.byte	0x9
+	.long	0xea
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x9
+	.byte	0x44
+	.byte	0x16
+	.long	0x322
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x9
+	.byte	0x46
+	.byte	0x14
+	.long	0x327
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x9
+	.byte	0x48
+	.byte	0x7
+	.long	0x41
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x9
+	.byte	0x49
+	.byte	0x7
+	.long	0x41
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF45
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xb
+	.long	0xac
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x12
+	.long	0x67
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x4e
+	.byte	0xf
+	.long	0x7a
+	.byte	0x82
+	.uleb128 0x2
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x8
+	.long	0x32c
+	.byte	0x83
+	.uleb128 0x2
+	.long	.LASF49
+	.byte	0x9
+	.byte	0x51
+	.byte	0xf
+	.long	0x33c
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x59
+	.byte	0xd
+	.long	0xb8
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x17
+	.long	0x346
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x5c
+	.byte	0x19
+	.long	0x350
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF53
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x14
+	.long	0x327
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF54
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x9
+	.long	0xdc
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x60
+	.byte	0x7
+	.long	0x41
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF57
+	.byte	0x9
+	.byte	0x62
+	.byte	0x8
+	.long	0x355
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x7
+	.byte	0x19
+	.long	0x183
+	.uleb128 0x2c
+	.long	.LASF305
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1c
+	.long	.LASF59
+	.uleb128 0x3
+	.long	0x31d
+	.uleb128 0x3
+	.long	0x183
+	.uleb128 0x12
+	.long	0xef
+	.long	0x33c
+	.uleb128 0x13
+	.long	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x315
+	.uleb128 0x1c
+	.long	.LASF60
+	.uleb128 0x3
+	.long	0x341
+	.uleb128 0x1c
+	.long	.LASF61
+	.uleb128 0x3
+	.long	0x34b
+	.uleb128 0x12
+	.long	0xef
+	.long	0x365
+	.uleb128 0x13
+	.long	0x3a
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	0x309
+	.uleb128 0x1d
+	.long	0x365
+	.uleb128 0x2d
+	.long	.LASF306
+	.byte	0x16
+	.byte	0x90
+	.byte	0xe
+	.long	0x365
+	.uleb128 0x3
+	.long	0x6e
+	.uleb128 0x3
+	.long	0xf6
+	.uleb128 0x1d
+	.long	0x380
+	.uleb128 0x14
+	.long	0x73
+	.byte	0xb
+	.byte	0x2f
+	.long	0x3e6
+	.uleb128 0x15
+	.long	.LASF62
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF63
+	.value	0x200
+	.uleb128 0x15
+	.long	.LASF64
+	.value	0x400
+	.uleb128 0x15
+	.long	.LASF65
+	.value	0x800
+	.uleb128 0x15
+	.long	.LASF66
+	.value	0x1000
+	.uleb128 0x15
+	.long	.LASF67
+	.value	0x2000
+	.uleb128 0x15
+	.long	.LASF68
+	.value	0x4000
+	.uleb128 0x15
+	.long	.LASF69
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF70
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF71
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF72
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF73
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF74
+	.uleb128 0x9
+	.long	0x3e6
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF75
+	.uleb128 0x9
+	.long	0x3f2
+	.uleb128 0x14
+	.long	0x73
+	.byte	0xc
+	.byte	0x12
+	.long	0x422
+	.uleb128 0x4
+	.long	.LASF76
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF77
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF78
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF79
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF80
+	.byte	0xc
+	.byte	0x17
+	.byte	0x3
+	.long	0x3fe
+	.uleb128 0xe
+	.byte	0xc0
+	.byte	0xc
+	.byte	0x19
+	.long	0x4fa
+	.uleb128 0x2
+	.long	.LASF81
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x9
+	.long	0x4fa
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF82
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x9
+	.long	0x41
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF83
+	.byte	0xc
+	.byte	0x1d
+	.byte	0x9
+	.long	0x4fa
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF84
+	.byte	0xc
+	.byte	0x1e
+	.byte	0x9
+	.long	0x41
+	.byte	0x84
+	.uleb128 0x2
+	.long	.LASF85
+	.byte	0xc
+	.byte	0x1f
+	.byte	0xa
+	.long	0x4d
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF86
+	.byte	0xc
+	.byte	0x20
+	.byte	0x9
+	.long	0x41
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF87
+	.byte	0xc
+	.byte	0x21
+	.byte	0x9
+	.long	0x41
+	.byte	0x94
+	.uleb128 0x2
+	.long	.LASF88
+	.byte	0xc
+	.byte	0x22
+	.byte	0x9
+	.long	0x41
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF89
+	.byte	0xc
+	.byte	0x23
+	.byte	0x9
+	.long	0x41
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF90
+	.byte	0xc
+	.byte	0x24
+	.byte	0x9
+	.long	0x41
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF91
+	.byte	0xc
+	.byte	0x25
+	.byte	0x9
+	.long	0x41
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF92
+	.byte	0xc
+	.byte	0x26
+	.byte	0x9
+	.long	0x41
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF93
+	.byte	0xc
+	.byte	0x27
+	.byte	0x9
+	.long	0x41
+	.byte	0xac
+	.uleb128 0x2
+	.long	.LASF94
+	.byte	0xc
+	.byte	0x28
+	.byte	0x16
+	.long	0x422
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF95
+	.byte	0xc
+	.byte	0x29
+	.byte	0x11
+	.long	0x380
+	.byte	0xb8
+	.byte	0
+	.uleb128 0x12
+	.long	0x41
+	.long	0x50a
+	.uleb128 0x13
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF96
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x3
+	.long	0x42e
+	.uleb128 0x9
+	.long	0x50a
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF97
+	.uleb128 0xe
+	.byte	0x18
+	.byte	0xd
+	.byte	0x10
+	.long	0x552
+	.uleb128 0x2
+	.long	.LASF98
+	.byte	0xd
+	.byte	0x13
+	.byte	0xd
+	.long	0x56b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF99
+	.byte	0xd
+	.byte	0x16
+	.byte	0xc
+	.long	0x580
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF100
+	.byte	0xd
+	.byte	0x18
+	.byte	0xb
+	.long	0xdc
+	.byte	0x10
+	.byte	0
+	.uleb128 0xf
+	.long	0xdc
+	.long	0x56b
+	.uleb128 0x1
+	.long	0xdc
+	.uleb128 0x1
+	.long	0x2e
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	0x552
+	.uleb128 0x19
+	.long	0x580
+	.uleb128 0x1
+	.long	0xdc
+	.uleb128 0x1
+	.long	0xdc
+	.byte	0
+	.uleb128 0x3
+	.long	0x570
+	.uleb128 0x6
+	.long	.LASF101
+	.byte	0xd
+	.byte	0x19
+	.byte	0x3
+	.long	0x522
+	.uleb128 0x9
+	.long	0x585
+	.uleb128 0x6
+	.long	.LASF102
+	.byte	0xe
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa0
+	.uleb128 0x3
+	.long	0x3e6
+	.uleb128 0x14
+	.long	0x73
+	.byte	0xf
+	.byte	0xf
+	.long	0x5d1
+	.uleb128 0x4
+	.long	.LASF103
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF104
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF105
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF106
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF107
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF108
+	.byte	0xf
+	.byte	0x15
+	.byte	0x3
+	.long	0x5a7
+	.uleb128 0xe
+	.byte	0x40
+	.byte	0xf
+	.byte	0x17
+	.long	0x64e
+	.uleb128 0x2
+	.long	.LASF109
+	.byte	0xf
+	.byte	0x19
+	.byte	0x15
+	.long	0x5d1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF110
+	.byte	0xf
+	.byte	0x1a
+	.byte	0x11
+	.long	0x380
+	.byte	0x8
+	.uleb128 0x1e
+	.string	"dot"
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xd
+	.long	0x66c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF111
+	.byte	0xf
+	.byte	0x20
+	.byte	0xc
+	.long	0x68b
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF112
+	.byte	0xf
+	.byte	0x23
+	.byte	0xd
+	.long	0x6b3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF113
+	.byte	0xf
+	.byte	0x27
+	.byte	0xd
+	.long	0x6e0
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF114
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xd
+	.long	0x6b3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF115
+	.byte	0xf
+	.byte	0x30
+	.byte	0xc
+	.long	0x70e
+	.byte	0x38
+	.byte	0
+	.uleb128 0xf
+	.long	0x3e6
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x3ed
+	.uleb128 0x3
+	.long	0x64e
+	.uleb128 0x19
+	.long	0x68b
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x3e6
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x671
+	.uleb128 0xf
+	.long	0x3e6
+	.long	0x6b3
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x3e6
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x690
+	.uleb128 0xf
+	.long	0x3e6
+	.long	0x6e0
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x3e6
+	.uleb128 0x1
+	.long	0x3e6
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x6b8
+	.uleb128 0x19
+	.long	0x70e
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x41
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x6e5
+	.uleb128 0x6
+	.long	.LASF116
+	.byte	0xf
+	.byte	0x32
+	.byte	0x3
+	.long	0x5dd
+	.uleb128 0x9
+	.long	0x713
+	.uleb128 0x19
+	.long	0x72f
+	.uleb128 0x1
+	.long	0xdc
+	.byte	0
+	.uleb128 0x3
+	.long	0x724
+	.uleb128 0x14
+	.long	0x73
+	.byte	0x10
+	.byte	0x14
+	.long	0x764
+	.uleb128 0x4
+	.long	.LASF117
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF118
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF119
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF120
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF121
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF122
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF123
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x3
+	.long	0x734
+	.uleb128 0x3
+	.long	0x3f2
+	.uleb128 0x14
+	.long	0x73
+	.byte	0x11
+	.byte	0x19
+	.long	0x7ab
+	.uleb128 0x4
+	.long	.LASF124
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF125
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF126
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF127
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF128
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF130
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF131
+	.byte	0x11
+	.byte	0x21
+	.byte	0x3
+	.long	0x775
+	.uleb128 0x6
+	.long	.LASF132
+	.byte	0x11
+	.byte	0x23
+	.byte	0x1a
+	.long	0x7c3
+	.uleb128 0x1b
+	.long	.LASF133
+	.byte	0x70
+	.byte	0x11
+	.byte	0x29
+	.long	0x893
+	.uleb128 0x2
+	.long	.LASF134
+	.byte	0x11
+	.byte	0x2b
+	.byte	0xb
+	.long	0x3e6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF135
+	.byte	0x11
+	.byte	0x2c
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF136
+	.byte	0x11
+	.byte	0x2d
+	.byte	0xc
+	.long	0x5a2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF137
+	.byte	0x11
+	.byte	0x2e
+	.byte	0xc
+	.long	0x5a2
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF138
+	.byte	0x11
+	.byte	0x2f
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF139
+	.byte	0x11
+	.byte	0x30
+	.byte	0xb
+	.long	0x3e6
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF140
+	.byte	0x11
+	.byte	0x31
+	.byte	0x9
+	.long	0x41
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF141
+	.byte	0x11
+	.byte	0x32
+	.byte	0xc
+	.long	0x3f2
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF142
+	.byte	0x11
+	.byte	0x33
+	.byte	0x18
+	.long	0x7ab
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF143
+	.byte	0x11
+	.byte	0x34
+	.byte	0xb
+	.long	0x3e6
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF144
+	.byte	0x11
+	.byte	0x35
+	.byte	0xb
+	.long	0x3e6
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF145
+	.byte	0x11
+	.byte	0x36
+	.byte	0x1d
+	.long	0x893
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF146
+	.byte	0x11
+	.byte	0x37
+	.byte	0x18
+	.long	0x8d1
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF147
+	.byte	0x11
+	.byte	0x38
+	.byte	0x14
+	.long	0x585
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF148
+	.byte	0x11
+	.byte	0x39
+	.byte	0xb
+	.long	0xdc
+	.byte	0x68
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF149
+	.byte	0x11
+	.byte	0x26
+	.byte	0xf
+	.long	0x89f
+	.uleb128 0x3
+	.long	0x8a4
+	.uleb128 0xf
+	.long	0x41
+	.long	0x8cc
+	.uleb128 0x1
+	.long	0x8cc
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x7b7
+	.uleb128 0x3
+	.long	0x71f
+	.uleb128 0x14
+	.long	0x73
+	.byte	0x11
+	.byte	0x3d
+	.long	0x90c
+	.uleb128 0x4
+	.long	.LASF150
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF151
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF152
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF153
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF154
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF156
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF157
+	.byte	0x11
+	.byte	0x45
+	.byte	0x3
+	.long	0x8d6
+	.uleb128 0xe
+	.byte	0x28
+	.byte	0x12
+	.byte	0x10
+	.long	0x962
+	.uleb128 0x2
+	.long	.LASF110
+	.byte	0x12
+	.byte	0x12
+	.byte	0x11
+	.long	0x380
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF145
+	.byte	0x12
+	.byte	0x15
+	.byte	0xb
+	.long	0x98a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF158
+	.byte	0x12
+	.byte	0x19
+	.byte	0xc
+	.long	0x99f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF159
+	.byte	0x12
+	.byte	0x1c
+	.byte	0xe
+	.long	0x9b3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF160
+	.byte	0x12
+	.byte	0x1f
+	.byte	0xc
+	.long	0x72f
+	.byte	0x20
+	.byte	0
+	.uleb128 0xf
+	.long	0x41
+	.long	0x98a
+	.uleb128 0x1
+	.long	0xdc
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x962
+	.uleb128 0x19
+	.long	0x99f
+	.uleb128 0x1
+	.long	0xdc
+	.uleb128 0x1
+	.long	0x3e6
+	.byte	0
+	.uleb128 0x3
+	.long	0x98f
+	.uleb128 0xf
+	.long	0x3f2
+	.long	0x9b3
+	.uleb128 0x1
+	.long	0xdc
+	.byte	0
+	.uleb128 0x3
+	.long	0x9a4
+	.uleb128 0x6
+	.long	.LASF161
+	.byte	0x12
+	.byte	0x20
+	.byte	0x3
+	.long	0x918
+	.uleb128 0x9
+	.long	0x9b8
+	.uleb128 0xe
+	.byte	0x10
+	.byte	0x12
+	.byte	0x22
+	.long	0x9ec
+	.uleb128 0x1e
+	.string	"ops"
+	.byte	0x12
+	.byte	0x24
+	.byte	0x1b
+	.long	0x9ec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF162
+	.byte	0x12
+	.byte	0x25
+	.byte	0xb
+	.long	0xdc
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	0x9c4
+	.uleb128 0x6
+	.long	.LASF163
+	.byte	0x12
+	.byte	0x26
+	.byte	0x3
+	.long	0x9c9
+	.uleb128 0x9
+	.long	0x9f1
+	.uleb128 0xe
+	.byte	0x18
+	.byte	0x12
+	.byte	0x28
+	.long	0xa59
+	.uleb128 0x2
+	.long	.LASF164
+	.byte	0x12
+	.byte	0x2a
+	.byte	0x1a
+	.long	0x90c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF134
+	.byte	0x12
+	.byte	0x2b
+	.byte	0xb
+	.long	0x3e6
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF135
+	.byte	0x12
+	.byte	0x2c
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF165
+	.byte	0x12
+	.byte	0x2d
+	.byte	0x9
+	.long	0x41
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF166
+	.byte	0x12
+	.byte	0x2e
+	.byte	0x9
+	.long	0x41
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF167
+	.byte	0x12
+	.byte	0x2f
+	.byte	0x9
+	.long	0x41
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF168
+	.byte	0x12
+	.byte	0x30
+	.byte	0x3
+	.long	0xa02
+	.uleb128 0x9
+	.long	0xa59
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x14
+	.long	0x73
+	.byte	0x13
+	.byte	0x11
+	.long	0xa8d
+	.uleb128 0x4
+	.long	.LASF169
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF170
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF171
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF172
+	.byte	0x13
+	.byte	0x15
+	.byte	0x3
+	.long	0xa6f
+	.uleb128 0xe
+	.byte	0x18
+	.byte	0x14
+	.byte	0x15
+	.long	0xac9
+	.uleb128 0x2
+	.long	.LASF109
+	.byte	0x14
+	.byte	0x17
+	.byte	0x15
+	.long	0x5d1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF110
+	.byte	0x14
+	.byte	0x18
+	.byte	0x11
+	.long	0x380
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF112
+	.byte	0x14
+	.byte	0x1c
+	.byte	0xf
+	.long	0xaf6
+	.byte	0x10
+	.byte	0
+	.uleb128 0xf
+	.long	0x118
+	.long	0xaec
+	.uleb128 0x1
+	.long	0xaec
+	.uleb128 0x1
+	.long	0xaf1
+	.uleb128 0x1
+	.long	0xaf1
+	.uleb128 0x1
+	.long	0x107
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x107
+	.uleb128 0x3
+	.long	0x113
+	.uleb128 0x3
+	.long	0xac9
+	.uleb128 0x6
+	.long	.LASF173
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x3
+	.long	0xa99
+	.uleb128 0x9
+	.long	0xafb
+	.uleb128 0xe
+	.byte	0x30
+	.byte	0x14
+	.byte	0x20
+	.long	0xb7d
+	.uleb128 0x2
+	.long	.LASF135
+	.byte	0x14
+	.byte	0x22
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF174
+	.byte	0x14
+	.byte	0x23
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF136
+	.byte	0x14
+	.byte	0x24
+	.byte	0xe
+	.long	0xaec
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF137
+	.byte	0x14
+	.byte	0x25
+	.byte	0xe
+	.long	0xaec
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF138
+	.byte	0x14
+	.byte	0x26
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF139
+	.byte	0x14
+	.byte	0x27
+	.byte	0xd
+	.long	0x107
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF146
+	.byte	0x14
+	.byte	0x28
+	.byte	0x1d
+	.long	0xb7d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF148
+	.byte	0x14
+	.byte	0x29
+	.byte	0xb
+	.long	0xdc
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	0xb07
+	.uleb128 0x6
+	.long	.LASF175
+	.byte	0x14
+	.byte	0x2a
+	.byte	0x3
+	.long	0xb0c
+	.uleb128 0x14
+	.long	0x73
+	.byte	0x15
+	.byte	0x18
+	.long	0xbd0
+	.uleb128 0x4
+	.long	.LASF176
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF177
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF178
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF179
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF180
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF182
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF183
+	.byte	0x7
+	.uleb128 0x4
+	.long	.LASF184
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF185
+	.byte	0x15
+	.byte	0x22
+	.byte	0x3
+	.long	0xb8e
+	.uleb128 0xe
+	.byte	0x30
+	.byte	0x15
+	.byte	0x24
+	.long	0xc5a
+	.uleb128 0x2
+	.long	.LASF109
+	.byte	0x15
+	.byte	0x26
+	.byte	0x17
+	.long	0xbd0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF186
+	.byte	0x15
+	.byte	0x27
+	.byte	0x12
+	.long	0x73
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF187
+	.byte	0x15
+	.byte	0x28
+	.byte	0x12
+	.long	0x73
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF94
+	.byte	0x15
+	.byte	0x29
+	.byte	0x14
+	.long	0x764
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF188
+	.byte	0x15
+	.byte	0x2a
+	.byte	0xb
+	.long	0x3e6
+	.byte	0x10
+	.uleb128 0x1e
+	.string	"snr"
+	.byte	0x15
+	.byte	0x2b
+	.byte	0xb
+	.long	0x3e6
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF189
+	.byte	0x15
+	.byte	0x2c
+	.byte	0x12
+	.long	0x73
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF190
+	.byte	0x15
+	.byte	0x2d
+	.byte	0xe
+	.long	0x596
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF167
+	.byte	0x15
+	.byte	0x2e
+	.byte	0x9
+	.long	0x41
+	.byte	0x28
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF191
+	.byte	0x15
+	.byte	0x2f
+	.byte	0x3
+	.long	0xbdc
+	.uleb128 0x9
+	.long	0xc5a
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x4
+	.long	.LASF192
+	.uleb128 0x6
+	.long	.LASF193
+	.byte	0x1
+	.byte	0x2a
+	.byte	0xf
+	.long	0xc7e
+	.uleb128 0x3
+	.long	0xc83
+	.uleb128 0xf
+	.long	0x41
+	.long	0xca6
+	.uleb128 0x1
+	.long	0xdc
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0xe
+	.byte	0x48
+	.byte	0x1
+	.byte	0x2c
+	.long	0xd31
+	.uleb128 0x2
+	.long	.LASF164
+	.byte	0x1
+	.byte	0x2e
+	.byte	0x11
+	.long	0x380
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF142
+	.byte	0x1
+	.byte	0x2f
+	.byte	0x11
+	.long	0x380
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF146
+	.byte	0x1
+	.byte	0x30
+	.byte	0x11
+	.long	0x380
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF135
+	.byte	0x1
+	.byte	0x31
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF194
+	.byte	0x1
+	.byte	0x32
+	.byte	0x9
+	.long	0x41
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF195
+	.byte	0x1
+	.byte	0x33
+	.byte	0xc
+	.long	0x3f2
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF196
+	.byte	0x1
+	.byte	0x34
+	.byte	0xc
+	.long	0x3f2
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF197
+	.byte	0x1
+	.byte	0x35
+	.byte	0xc
+	.long	0x3f2
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF198
+	.byte	0x1
+	.byte	0x36
+	.byte	0x9
+	.long	0x41
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF199
+	.byte	0x1
+	.byte	0x37
+	.byte	0xa
+	.long	0x4d
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF200
+	.byte	0x1
+	.byte	0x38
+	.byte	0x3
+	.long	0xca6
+	.uleb128 0x9
+	.long	0xd31
+	.uleb128 0xe
+	.byte	0x20
+	.byte	0x1
+	.byte	0x3b
+	.long	0xd7f
+	.uleb128 0x2
+	.long	.LASF201
+	.byte	0x1
+	.byte	0x3d
+	.byte	0xc
+	.long	0x5a2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF202
+	.byte	0x1
+	.byte	0x3e
+	.byte	0xc
+	.long	0x5a2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF203
+	.byte	0x1
+	.byte	0x3f
+	.byte	0xc
+	.long	0x5a2
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF85
+	.byte	0x1
+	.byte	0x40
+	.byte	0xa
+	.long	0x4d
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF204
+	.byte	0x1
+	.byte	0x41
+	.byte	0x3
+	.long	0xd42
+	.uleb128 0x9
+	.long	0xd7f
+	.uleb128 0xe
+	.byte	0x40
+	.byte	0x1
+	.byte	0x44
+	.long	0xde7
+	.uleb128 0x2
+	.long	.LASF205
+	.byte	0x1
+	.byte	0x46
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF164
+	.byte	0x1
+	.byte	0x47
+	.byte	0x11
+	.long	0x380
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF142
+	.byte	0x1
+	.byte	0x48
+	.byte	0x11
+	.long	0x380
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF146
+	.byte	0x1
+	.byte	0x49
+	.byte	0x11
+	.long	0x380
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF206
+	.byte	0x1
+	.byte	0x4a
+	.byte	0x19
+	.long	0xa59
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF207
+	.byte	0x1
+	.byte	0x4b
+	.byte	0xb
+	.long	0x3e6
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF208
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x3
+	.long	0xd90
+	.uleb128 0x9
+	.long	0xde7
+	.uleb128 0xe
+	.byte	0x40
+	.byte	0x1
+	.byte	0x4f
+	.long	0xe28
+	.uleb128 0x2
+	.long	.LASF209
+	.byte	0x1
+	.byte	0x51
+	.byte	0x10
+	.long	0xb82
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF210
+	.byte	0x1
+	.byte	0x52
+	.byte	0x12
+	.long	0x667
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF201
+	.byte	0x1
+	.byte	0x53
+	.byte	0xe
+	.long	0xaec
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF211
+	.byte	0x1
+	.byte	0x54
+	.byte	0x3
+	.long	0xdf8
+	.uleb128 0xc
+	.long	.LASF212
+	.byte	0x16
+	.byte	0xb2
+	.byte	0xc
+	.long	0x41
+	.long	0xe4a
+	.uleb128 0x1
+	.long	0x365
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF216
+	.byte	0x14
+	.byte	0x39
+	.long	0xe5b
+	.uleb128 0x1
+	.long	0xe5b
+	.byte	0
+	.uleb128 0x3
+	.long	0xb82
+	.uleb128 0xc
+	.long	.LASF213
+	.byte	0x14
+	.byte	0x33
+	.byte	0x5
+	.long	0x41
+	.long	0xe80
+	.uleb128 0x1
+	.long	0xe5b
+	.uleb128 0x1
+	.long	0x41
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF214
+	.byte	0x14
+	.byte	0x54
+	.byte	0x5
+	.long	0x41
+	.long	0xe96
+	.uleb128 0x1
+	.long	0x3e6
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF215
+	.byte	0x14
+	.byte	0x6b
+	.byte	0x19
+	.long	0xb7d
+	.long	0xeac
+	.uleb128 0x1
+	.long	0x5d1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF217
+	.byte	0x11
+	.byte	0x89
+	.long	0xebd
+	.uleb128 0x1
+	.long	0x8cc
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF218
+	.byte	0x11
+	.byte	0xd9
+	.byte	0xd
+	.long	0x380
+	.long	0xed3
+	.uleb128 0x1
+	.long	0x7ab
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF219
+	.byte	0x11
+	.byte	0x7b
+	.byte	0x5
+	.long	0x41
+	.long	0xf02
+	.uleb128 0x1
+	.long	0x8cc
+	.uleb128 0x1
+	.long	0x3e6
+	.uleb128 0x1
+	.long	0x41
+	.uleb128 0x1
+	.long	0x7ab
+	.uleb128 0x1
+	.long	0x3e6
+	.uleb128 0x1
+	.long	0xf02
+	.byte	0
+	.uleb128 0x3
+	.long	0x591
+	.uleb128 0xc
+	.long	.LASF220
+	.byte	0xf
+	.byte	0x40
+	.byte	0x14
+	.long	0x8d1
+	.long	0xf1d
+	.uleb128 0x1
+	.long	0x5d1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF221
+	.byte	0x13
+	.byte	0x63
+	.byte	0xd
+	.long	0x380
+	.long	0xf33
+	.uleb128 0x1
+	.long	0xa8d
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF222
+	.byte	0x17
+	.byte	0x30
+	.byte	0x5
+	.long	0x41
+	.long	0xf49
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF223
+	.byte	0x16
+	.value	0x324
+	.long	0xf5b
+	.uleb128 0x1
+	.long	0x380
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF224
+	.byte	0x16
+	.value	0x102
+	.byte	0xe
+	.long	0x365
+	.long	0xf77
+	.uleb128 0x1
+	.long	0x385
+	.uleb128 0x1
+	.long	0x385
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF225
+	.byte	0x14
+	.byte	0x5c
+	.long	0xf92
+	.uleb128 0x1
+	.long	0xaec
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF226
+	.byte	0x16
+	.value	0x164
+	.byte	0xc
+	.long	0x41
+	.long	0xfaa
+	.uleb128 0x1
+	.long	0x380
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF227
+	.byte	0x8
+	.byte	0xb1
+	.byte	0x11
+	.long	0x4d
+	.long	0xfca
+	.uleb128 0x1
+	.long	0x385
+	.uleb128 0x1
+	.long	0xfcf
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0xea
+	.uleb128 0x1d
+	.long	0xfca
+	.uleb128 0x22
+	.long	.LASF232
+	.byte	0xb
+	.byte	0x4f
+	.byte	0x23
+	.long	0xfe0
+	.uleb128 0x3
+	.long	0x37b
+	.uleb128 0xc
+	.long	.LASF228
+	.byte	0x18
+	.byte	0x9c
+	.byte	0xc
+	.long	0x41
+	.long	0x1000
+	.uleb128 0x1
+	.long	0x380
+	.uleb128 0x1
+	.long	0x380
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF229
+	.byte	0x18
+	.byte	0x3d
+	.byte	0xe
+	.long	0xdc
+	.long	0x1020
+	.uleb128 0x1
+	.long	0xdc
+	.uleb128 0x1
+	.long	0x41
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF230
+	.byte	0x16
+	.byte	0xe6
+	.byte	0xc
+	.long	0x41
+	.long	0x1036
+	.uleb128 0x1
+	.long	0x365
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF231
+	.byte	0x16
+	.value	0x17a
+	.byte	0xc
+	.long	0x41
+	.long	0x1058
+	.uleb128 0x1
+	.long	0xea
+	.uleb128 0x1
+	.long	0x2e
+	.uleb128 0x1
+	.long	0x380
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF233
+	.byte	0xf
+	.byte	0x47
+	.byte	0x14
+	.long	0x8d1
+	.uleb128 0x18
+	.long	.LASF234
+	.byte	0x16
+	.value	0x15e
+	.byte	0xc
+	.long	0x41
+	.long	0x1081
+	.uleb128 0x1
+	.long	0x36a
+	.uleb128 0x1
+	.long	0x385
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF235
+	.byte	0x12
+	.byte	0x40
+	.long	0x1092
+	.uleb128 0x1
+	.long	0x1092
+	.byte	0
+	.uleb128 0x3
+	.long	0x9f1
+	.uleb128 0xc
+	.long	.LASF236
+	.byte	0x12
+	.byte	0x3a
+	.byte	0x5
+	.long	0x41
+	.long	0x10b7
+	.uleb128 0x1
+	.long	0x1092
+	.uleb128 0x1
+	.long	0x10b7
+	.uleb128 0x1
+	.long	0x8cc
+	.byte	0
+	.uleb128 0x3
+	.long	0xa65
+	.uleb128 0xc
+	.long	.LASF237
+	.byte	0x19
+	.byte	0x8f
+	.byte	0x1
+	.long	0x3f2
+	.long	0x10d2
+	.uleb128 0x1
+	.long	0x3f2
+	.byte	0
+	.uleb128 0x2e
+	.string	"exp"
+	.byte	0x19
+	.byte	0x5f
+	.byte	0x1
+	.long	0x3f2
+	.long	0x10e8
+	.uleb128 0x1
+	.long	0x3f2
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF238
+	.byte	0x15
+	.byte	0x68
+	.byte	0x5
+	.long	0x41
+	.long	0x1108
+	.uleb128 0x1
+	.long	0x1108
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	0xc66
+	.uleb128 0x17
+	.long	.LASF239
+	.byte	0x15
+	.byte	0x36
+	.long	0x111e
+	.uleb128 0x1
+	.long	0x111e
+	.byte	0
+	.uleb128 0x3
+	.long	0xc5a
+	.uleb128 0x1f
+	.long	.LASF240
+	.byte	0x8
+	.value	0x238
+	.long	0x1135
+	.uleb128 0x1
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF241
+	.byte	0x8
+	.value	0x353
+	.long	0x1156
+	.uleb128 0x1
+	.long	0xdc
+	.uleb128 0x1
+	.long	0x2e
+	.uleb128 0x1
+	.long	0x2e
+	.uleb128 0x1
+	.long	0x157
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF242
+	.byte	0x8
+	.value	0x229
+	.byte	0xe
+	.long	0xdc
+	.long	0x116d
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF243
+	.byte	0x1a
+	.value	0x120
+	.byte	0xc
+	.long	0x41
+	.long	0x1189
+	.uleb128 0x1
+	.long	0xfb
+	.uleb128 0x1
+	.long	0x1189
+	.byte	0
+	.uleb128 0x3
+	.long	0x124
+	.uleb128 0x17
+	.long	.LASF244
+	.byte	0x14
+	.byte	0x4c
+	.long	0x11b8
+	.uleb128 0x1
+	.long	0xe5b
+	.uleb128 0x1
+	.long	0xaf1
+	.uleb128 0x1
+	.long	0xaf1
+	.uleb128 0x1
+	.long	0xaec
+	.uleb128 0x1
+	.long	0xaec
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF245
+	.byte	0x12
+	.byte	0x4c
+	.byte	0x5
+	.long	0x41
+	.long	0x11e7
+	.uleb128 0x1
+	.long	0x11e7
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x3
+	.long	0x9fd
+	.uleb128 0xc
+	.long	.LASF246
+	.byte	0x11
+	.byte	0xac
+	.byte	0x5
+	.long	0x41
+	.long	0x121b
+	.uleb128 0x1
+	.long	0x8cc
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x667
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x5a2
+	.uleb128 0x1
+	.long	0x41
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF264
+	.value	0x1ec
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB5023
+	.quad	.LFE5023-.LFB5023
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1542
+	.uleb128 0x8
+	.long	.LASF266
+	.value	0x1ec
+	.byte	0x2c
+	.long	0x1542
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -792
+	.uleb128 0x5
+	.long	.LASF247
+	.value	0x1ee
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.long	.LASF248
+	.value	0x1ef
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.long	.LASF249
+	.value	0x1f0
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x5
+	.long	.LASF250
+	.value	0x1f1
+	.byte	0xb
+	.long	0x365
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF251
+	.value	0x1f2
+	.byte	0x17
+	.long	0xc5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x5
+	.long	.LASF252
+	.value	0x1f3
+	.byte	0x14
+	.long	0xd7f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x5
+	.long	.LASF253
+	.value	0x1f4
+	.byte	0xa
+	.long	0x1547
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x5
+	.long	.LASF201
+	.value	0x205
+	.byte	0xc
+	.long	0x5a2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x5
+	.long	.LASF254
+	.value	0x206
+	.byte	0xc
+	.long	0x5a2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x5
+	.long	.LASF203
+	.value	0x207
+	.byte	0xc
+	.long	0x5a2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x5
+	.long	.LASF255
+	.value	0x208
+	.byte	0xe
+	.long	0xaec
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x5
+	.long	.LASF256
+	.value	0x209
+	.byte	0xc
+	.long	0x5a2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1a
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.long	0x132c
+	.uleb128 0x11
+	.string	"b"
+	.value	0x1fb
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.long	0x1371
+	.uleb128 0x11
+	.string	"n"
+	.value	0x218
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xa
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.uleb128 0x5
+	.long	.LASF257
+	.value	0x21a
+	.byte	0x14
+	.long	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.uleb128 0x11
+	.string	"l"
+	.value	0x235
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0xa
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.uleb128 0x5
+	.long	.LASF135
+	.value	0x237
+	.byte	0x13
+	.long	0x48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -132
+	.uleb128 0x5
+	.long	.LASF134
+	.value	0x238
+	.byte	0x15
+	.long	0x3ed
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x5
+	.long	.LASF258
+	.value	0x239
+	.byte	0x23
+	.long	0xa65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0x5
+	.long	.LASF259
+	.value	0x23b
+	.byte	0x23
+	.long	0xa65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x5
+	.long	.LASF260
+	.value	0x241
+	.byte	0x24
+	.long	0x1557
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.uleb128 0xa
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.uleb128 0x11
+	.string	"b"
+	.value	0x258
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.uleb128 0x5
+	.long	.LASF261
+	.value	0x25a
+	.byte	0x1e
+	.long	0xd31
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -784
+	.uleb128 0x1a
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.long	0x14c7
+	.uleb128 0x11
+	.string	"k"
+	.value	0x25d
+	.byte	0x16
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xa
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.uleb128 0x5
+	.long	.LASF146
+	.value	0x25f
+	.byte	0x24
+	.long	0x8d1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x5
+	.long	.LASF262
+	.value	0x260
+	.byte	0x1b
+	.long	0x48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -148
+	.uleb128 0xa
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.uleb128 0x11
+	.string	"v"
+	.value	0x262
+	.byte	0x1a
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xa
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.uleb128 0x5
+	.long	.LASF209
+	.value	0x264
+	.byte	0x21
+	.long	0x7b7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -704
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.long	0x151d
+	.uleb128 0x11
+	.string	"k"
+	.value	0x280
+	.byte	0x16
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0xa
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.uleb128 0x5
+	.long	.LASF146
+	.value	0x282
+	.byte	0x29
+	.long	0xb7d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x5
+	.long	.LASF263
+	.value	0x283
+	.byte	0x21
+	.long	0xe28
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -704
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.uleb128 0x11
+	.string	"e"
+	.value	0x29d
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x516
+	.uleb128 0x12
+	.long	0xef
+	.long	0x1557
+	.uleb128 0x13
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x12
+	.long	0xdf3
+	.long	0x1567
+	.uleb128 0x13
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF265
+	.value	0x1cd
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB5022
+	.quad	.LFE5022-.LFB5022
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1606
+	.uleb128 0x8
+	.long	.LASF267
+	.value	0x1cd
+	.byte	0x2e
+	.long	0x380
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.long	.LASF268
+	.value	0x1cd
+	.byte	0x39
+	.long	0xa6a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.long	.LASF269
+	.value	0x1cd
+	.byte	0x45
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x5
+	.long	.LASF270
+	.value	0x1cf
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.long	.LASF271
+	.value	0x1d0
+	.byte	0x11
+	.long	0x380
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xa
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.uleb128 0x11
+	.string	"end"
+	.value	0x1d4
+	.byte	0xf
+	.long	0xea
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF272
+	.value	0x1d5
+	.byte	0xe
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF273
+	.value	0x1b6
+	.byte	0x12
+	.long	0x422
+	.quad	.LFB5021
+	.quad	.LFE5021-.LFB5021
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1647
+	.uleb128 0x8
+	.long	.LASF94
+	.value	0x1b6
+	.byte	0x3d
+	.long	0x380
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF247
+	.value	0x1b8
+	.byte	0x16
+	.long	0x422
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF307
+	.byte	0x1
+	.value	0x19f
+	.byte	0x6
+	.quad	.LFB5020
+	.quad	.LFE5020-.LFB5020
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16a2
+	.uleb128 0x8
+	.long	.LASF266
+	.value	0x19f
+	.byte	0x33
+	.long	0x16a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.long	.LASF81
+	.value	0x1a1
+	.byte	0x16
+	.long	0x16b7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lengths.1
+	.uleb128 0x5
+	.long	.LASF83
+	.value	0x1a2
+	.byte	0x16
+	.long	0x16cc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	blockSizes.0
+	.byte	0
+	.uleb128 0x3
+	.long	0x50a
+	.uleb128 0x12
+	.long	0x48
+	.long	0x16b7
+	.uleb128 0x13
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	0x16a7
+	.uleb128 0x12
+	.long	0x48
+	.long	0x16cc
+	.uleb128 0x13
+	.long	0x3a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	0x16bc
+	.uleb128 0x23
+	.long	.LASF277
+	.value	0x174
+	.quad	.LFB5019
+	.quad	.LFE5019-.LFB5019
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x176c
+	.uleb128 0x8
+	.long	.LASF250
+	.value	0x174
+	.byte	0x28
+	.long	0x365
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x8
+	.long	.LASF266
+	.value	0x174
+	.byte	0x48
+	.long	0x1542
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x8
+	.long	.LASF261
+	.value	0x174
+	.byte	0x6a
+	.long	0x176c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x8
+	.long	.LASF249
+	.value	0x175
+	.byte	0x26
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x5
+	.long	.LASF274
+	.value	0x177
+	.byte	0x12
+	.long	0x3f9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF275
+	.value	0x178
+	.byte	0x12
+	.long	0x3f9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF276
+	.value	0x179
+	.byte	0x12
+	.long	0x3f9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF199
+	.value	0x17a
+	.byte	0xa
+	.long	0x1771
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x3
+	.long	0xd3d
+	.uleb128 0x12
+	.long	0xef
+	.long	0x1781
+	.uleb128 0x13
+	.long	0x3a
+	.byte	0x17
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF278
+	.value	0x14d
+	.quad	.LFB5018
+	.quad	.LFE5018-.LFB5018
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17cc
+	.uleb128 0x8
+	.long	.LASF250
+	.value	0x14d
+	.byte	0x28
+	.long	0x365
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.long	.LASF266
+	.value	0x14d
+	.byte	0x48
+	.long	0x1542
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x8
+	.long	.LASF252
+	.value	0x14d
+	.byte	0x68
+	.long	0x17cc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x3
+	.long	0xd8b
+	.uleb128 0x24
+	.long	.LASF281
+	.value	0x131
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB5017
+	.quad	.LFE5017-.LFB5017
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18a1
+	.uleb128 0x8
+	.long	.LASF266
+	.value	0x131
+	.byte	0x3d
+	.long	0x1542
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x8
+	.long	.LASF279
+	.value	0x131
+	.byte	0x62
+	.long	0x10b7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x8
+	.long	.LASF207
+	.value	0x132
+	.byte	0x29
+	.long	0x3e6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x8
+	.long	.LASF252
+	.value	0x132
+	.byte	0x49
+	.long	0x17cc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x8
+	.long	.LASF201
+	.value	0x132
+	.byte	0x5c
+	.long	0x667
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x8
+	.long	.LASF254
+	.value	0x132
+	.byte	0x6a
+	.long	0x5a2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x8
+	.long	.LASF203
+	.value	0x133
+	.byte	0x2a
+	.long	0x5a2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x8
+	.long	.LASF261
+	.value	0x133
+	.byte	0x43
+	.long	0x18a1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x5
+	.long	.LASF206
+	.value	0x135
+	.byte	0x11
+	.long	0x9f1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF280
+	.value	0x136
+	.byte	0x19
+	.long	0xa59
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x5
+	.long	.LASF247
+	.value	0x140
+	.byte	0xf
+	.long	0x48
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x3
+	.long	0xd31
+	.uleb128 0x24
+	.long	.LASF282
+	.value	0x117
+	.byte	0xd
+	.long	0x4d
+	.quad	.LFB5016
+	.quad	.LFE5016-.LFB5016
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1915
+	.uleb128 0x8
+	.long	.LASF252
+	.value	0x117
+	.byte	0x3b
+	.long	0x17cc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.long	.LASF279
+	.value	0x117
+	.byte	0x5c
+	.long	0x10b7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.long	.LASF209
+	.value	0x118
+	.byte	0x32
+	.long	0x8cc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x5
+	.long	.LASF206
+	.value	0x11a
+	.byte	0x11
+	.long	0x9f1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF199
+	.value	0x11b
+	.byte	0xa
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF283
+	.byte	0xf0
+	.byte	0xd
+	.long	0x4d
+	.quad	.LFB5015
+	.quad	.LFE5015-.LFB5015
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19ea
+	.uleb128 0x7
+	.long	.LASF252
+	.byte	0xf0
+	.byte	0x35
+	.long	0x17cc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x7
+	.long	.LASF206
+	.byte	0xf0
+	.byte	0x4e
+	.long	0x11e7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0xb
+	.long	.LASF199
+	.byte	0xf2
+	.byte	0xa
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0x10
+	.string	"n"
+	.byte	0xf4
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xa
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.uleb128 0xb
+	.long	.LASF257
+	.byte	0xf6
+	.byte	0x14
+	.long	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xb
+	.long	.LASF270
+	.byte	0xf7
+	.byte	0x13
+	.long	0x48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xb
+	.long	.LASF284
+	.byte	0xf8
+	.byte	0x10
+	.long	0x3f2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xb
+	.long	.LASF285
+	.byte	0xf9
+	.byte	0x10
+	.long	0x3f2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xa
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x10
+	.string	"i"
+	.byte	0xff
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF286
+	.byte	0xc2
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB5014
+	.quad	.LFE5014-.LFB5014
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1af1
+	.uleb128 0x7
+	.long	.LASF252
+	.byte	0xc2
+	.byte	0x2e
+	.long	0x1af1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x7
+	.long	.LASF135
+	.byte	0xc2
+	.byte	0x38
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -140
+	.uleb128 0xb
+	.long	.LASF251
+	.byte	0xc4
+	.byte	0x17
+	.long	0xc5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0xb
+	.long	.LASF287
+	.byte	0xc5
+	.byte	0xc
+	.long	0x3f2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xb
+	.long	.LASF288
+	.byte	0xc7
+	.byte	0xc
+	.long	0x5a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xb
+	.long	.LASF289
+	.byte	0xd8
+	.byte	0x11
+	.long	0x3ed
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x1a
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.long	0x1a85
+	.uleb128 0x10
+	.string	"k"
+	.byte	0xd1
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0xa
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0x10
+	.string	"n"
+	.byte	0xd9
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xa
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0xb
+	.long	.LASF290
+	.byte	0xdb
+	.byte	0x13
+	.long	0x48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x10
+	.string	"sum"
+	.byte	0xdc
+	.byte	0x10
+	.long	0x3f2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xa
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.uleb128 0x10
+	.string	"k"
+	.byte	0xde
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0xd7f
+	.uleb128 0x16
+	.long	.LASF291
+	.byte	0x8d
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB5013
+	.quad	.LFE5013-.LFB5013
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c56
+	.uleb128 0x7
+	.long	.LASF266
+	.byte	0x8d
+	.byte	0x37
+	.long	0x1542
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x7
+	.long	.LASF292
+	.byte	0x8d
+	.byte	0x53
+	.long	0xc72
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x7
+	.long	.LASF206
+	.byte	0x8d
+	.byte	0x62
+	.long	0xdc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x7
+	.long	.LASF201
+	.byte	0x8e
+	.byte	0x2a
+	.long	0x667
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x7
+	.long	.LASF254
+	.byte	0x8e
+	.byte	0x38
+	.long	0x5a2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x7
+	.long	.LASF203
+	.byte	0x8e
+	.byte	0x47
+	.long	0x5a2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x7
+	.long	.LASF261
+	.byte	0x8e
+	.byte	0x60
+	.long	0x18a1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0xb
+	.long	.LASF293
+	.byte	0x90
+	.byte	0xd
+	.long	0x770
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xb
+	.long	.LASF197
+	.byte	0x96
+	.byte	0xd
+	.long	0x770
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xa
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0xb
+	.long	.LASF294
+	.byte	0x99
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xa
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0xb
+	.long	.LASF295
+	.byte	0x9b
+	.byte	0x16
+	.long	0x3f9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xb
+	.long	.LASF296
+	.byte	0x9c
+	.byte	0x22
+	.long	0x152
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xb
+	.long	.LASF186
+	.byte	0xa8
+	.byte	0x22
+	.long	0x152
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xb
+	.long	.LASF297
+	.byte	0xa9
+	.byte	0x16
+	.long	0x3f9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xa
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x10
+	.string	"n"
+	.byte	0x9e
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xa
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0xb
+	.long	.LASF257
+	.byte	0xa0
+	.byte	0x18
+	.long	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0xb
+	.long	.LASF270
+	.byte	0xa1
+	.byte	0x17
+	.long	0x48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF298
+	.byte	0x7a
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB5012
+	.quad	.LFE5012-.LFB5012
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ca8
+	.uleb128 0x26
+	.string	"a"
+	.byte	0x7a
+	.byte	0x2f
+	.long	0x17d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x26
+	.string	"b"
+	.byte	0x7a
+	.byte	0x3e
+	.long	0x17d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x10
+	.string	"x"
+	.byte	0x7c
+	.byte	0x12
+	.long	0x3f9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x10
+	.string	"y"
+	.byte	0x7d
+	.byte	0x12
+	.long	0x3f9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF299
+	.byte	0x71
+	.byte	0x1b
+	.long	0x14b
+	.quad	.LFB5011
+	.quad	.LFE5011-.LFB5011
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ce2
+	.uleb128 0x30
+	.long	0x1e5e
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.byte	0x1
+	.byte	0x74
+	.byte	0xc
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF300
+	.byte	0x6a
+	.byte	0xf
+	.long	0x3f2
+	.quad	.LFB5010
+	.quad	.LFE5010-.LFB5010
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d12
+	.uleb128 0x10
+	.string	"now"
+	.byte	0x6c
+	.byte	0x15
+	.long	0x124
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF301
+	.byte	0x60
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB5009
+	.quad	.LFE5009-.LFB5009
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d89
+	.uleb128 0x7
+	.long	.LASF206
+	.byte	0x60
+	.byte	0x28
+	.long	0xdc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	.LASF201
+	.byte	0x60
+	.byte	0x3d
+	.long	0x667
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF254
+	.byte	0x60
+	.byte	0x4b
+	.long	0x5a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.long	.LASF203
+	.byte	0x60
+	.byte	0x5a
+	.long	0x5a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.long	.LASF85
+	.byte	0x60
+	.byte	0x65
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xb
+	.long	.LASF263
+	.byte	0x62
+	.byte	0x16
+	.long	0x1d89
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x3
+	.long	0xe28
+	.uleb128 0x16
+	.long	.LASF302
+	.byte	0x5b
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB5008
+	.quad	.LFE5008-.LFB5008
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1df6
+	.uleb128 0x7
+	.long	.LASF206
+	.byte	0x5b
+	.byte	0x29
+	.long	0xdc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.long	.LASF201
+	.byte	0x5b
+	.byte	0x3e
+	.long	0x667
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	.LASF254
+	.byte	0x5b
+	.byte	0x4c
+	.long	0x5a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	.LASF203
+	.byte	0x5b
+	.byte	0x5b
+	.long	0x5a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF85
+	.byte	0x5b
+	.byte	0x66
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF303
+	.byte	0x56
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB5007
+	.quad	.LFE5007-.LFB5007
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e5e
+	.uleb128 0x7
+	.long	.LASF206
+	.byte	0x56
+	.byte	0x26
+	.long	0xdc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.long	.LASF201
+	.byte	0x56
+	.byte	0x3b
+	.long	0x667
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	.LASF254
+	.byte	0x56
+	.byte	0x49
+	.long	0x5a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	.LASF203
+	.byte	0x56
+	.byte	0x58
+	.long	0x5a2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF85
+	.byte	0x56
+	.byte	0x63
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF308
+	.byte	0x2
+	.byte	0x70
+	.byte	0x1
+	.long	0x14b
+	.byte	0x3
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF178:
+	.string	"GEN_SIGNAL_SQUARE"
+.LASF9:
+	.string	"size_t"
+.LASF104:
+	.string	"LMS_KERNEL_SSE2"
+.LASF185:
+	.string	"TypeOfGenSignal_t"
+.LASF164:
+	.string	"algorithm"
+.LASF206:
+	.string	"engine"
+.LASF295:
+	.string	"start"
+.LASF132:
+	.string	"LmsFilter_t"
+.LASF69:
+	.string	"_ISgraph"
+.LASF146:
+	.string	"kernel"
+.LASF60:
+	.string	"_IO_codecvt"
+.LASF193:
+	.string	"LmsBenchProcess_t"
+.LASF40:
+	.string	"_IO_save_end"
+.LASF237:
+	.string	"sqrt"
+.LASF152:
+	.string	"LMS_FILTER_ALGORITHM_FDAF"
+.LASF186:
+	.string	"cycles"
+.LASF301:
+	.string	"lmsBench_ProcessFixed"
+.LASF87:
+	.string	"warmupTrials"
+.LASF17:
+	.string	"__clockid_t"
+.LASF182:
+	.string	"GEN_SIGNAL_PINK"
+.LASF116:
+	.string	"LmsKernel_t"
+.LASF215:
+	.string	"lmsFixed_GetKernel"
+.LASF79:
+	.string	"LMS_BENCH_FORMAT_JSON"
+.LASF33:
+	.string	"_IO_write_base"
+.LASF162:
+	.string	"state"
+.LASF49:
+	.string	"_lock"
+.LASF145:
+	.string	"processBlock"
+.LASF245:
+	.string	"lmsEngine_ProcessBlock"
+.LASF266:
+	.string	"settings"
+.LASF77:
+	.string	"LMS_BENCH_FORMAT_TABLE"
+.LASF109:
+	.string	"type"
+.LASF260:
+	.string	"engineCases"
+.LASF26:
+	.string	"__compar_fn_t"
+.LASF38:
+	.string	"_IO_save_base"
+.LASF296:
+	.string	"startCycles"
+.LASF95:
+	.string	"outputFileName"
+.LASF156:
+	.string	"LMS_FILTER_ALGORITHM_APA"
+.LASF123:
+	.string	"SampleFormat_t"
+.LASF42:
+	.string	"_chain"
+.LASF84:
+	.string	"numOfBlockSizes"
+.LASF46:
+	.string	"_cur_column"
+.LASF283:
+	.string	"lmsBench_Converge"
+.LASF227:
+	.string	"strtol"
+.LASF261:
+	.string	"result"
+.LASF172:
+	.string	"RlsFilterForm_t"
+.LASF112:
+	.string	"updateDot"
+.LASF105:
+	.string	"LMS_KERNEL_AVX2"
+.LASF3:
+	.string	"long int"
+.LASF175:
+	.string	"LmsFixed_t"
+.LASF128:
+	.string	"LMS_FILTER_VARIANT_SIGN_DATA"
+.LASF59:
+	.string	"_IO_marker"
+.LASF68:
+	.string	"_ISprint"
+.LASF253:
+	.string	"apaVariant"
+.LASF203:
+	.string	"error"
+.LASF204:
+	.string	"LmsBenchTask_t"
+.LASF286:
+	.string	"lmsBench_InitTask"
+.LASF285:
+	.string	"desiredPower"
+.LASF190:
+	.string	"seed"
+.LASF90:
+	.string	"includeFixed"
+.LASF8:
+	.string	"signed char"
+.LASF144:
+	.string	"leak"
+.LASF28:
+	.string	"_IO_FILE"
+.LASF61:
+	.string	"_IO_wide_data"
+.LASF100:
+	.string	"context"
+.LASF173:
+	.string	"LmsFixedKernel_t"
+.LASF134:
+	.string	"step"
+.LASF289:
+	.string	"scale"
+.LASF5:
+	.string	"unsigned char"
+.LASF53:
+	.string	"_freeres_list"
+.LASF151:
+	.string	"LMS_FILTER_ALGORITHM_LMS"
+.LASF212:
+	.string	"fclose"
+.LASF126:
+	.string	"LMS_FILTER_VARIANT_LEAKY"
+.LASF111:
+	.string	"update"
+.LASF85:
+	.string	"numOfSamples"
+.LASF140:
+	.string	"pendingUpdate"
+.LASF18:
+	.string	"__syscall_slong_t"
+.LASF248:
+	.string	"maxBlockSize"
+.LASF290:
+	.string	"taps"
+.LASF218:
+	.string	"lmsFilter_VariantName"
+.LASF166:
+	.string	"projectionOrder"
+.LASF272:
+	.string	"value"
+.LASF142:
+	.string	"variant"
+.LASF122:
+	.string	"SAMPLE_FORMAT_WAV_F32"
+.LASF86:
+	.string	"trials"
+.LASF19:
+	.string	"char"
+.LASF307:
+	.string	"lmsBench_DefaultSettings"
+.LASF158:
+	.string	"pushSample"
+.LASF117:
+	.string	"SAMPLE_FORMAT_UNKNOWN"
+.LASF302:
+	.string	"lmsBench_ProcessEngine"
+.LASF149:
+	.string	"LmsFilterProcessBlock_t"
+.LASF305:
+	.string	"_IO_lock_t"
+.LASF133:
+	.string	"LmsFilter"
+.LASF287:
+	.string	"norm"
+.LASF194:
+	.string	"blockSize"
+.LASF207:
+	.string	"sineStep"
+.LASF210:
+	.string	"source"
+.LASF98:
+	.string	"allocate"
+.LASF92:
+	.string	"includeRls"
+.LASF275:
+	.string	"nsPerTap"
+.LASF273:
+	.string	"lmsBench_processArgumentFormat"
+.LASF238:
+	.string	"signalGenerator_generateSamples"
+.LASF30:
+	.string	"_IO_read_ptr"
+.LASF83:
+	.string	"blockSizes"
+.LASF228:
+	.string	"strcmp"
+.LASF244:
+	.string	"lmsFixed_ProcessBlock"
+.LASF297:
+	.string	"elapsed"
+.LASF201:
+	.string	"input"
+.LASF120:
+	.string	"SAMPLE_FORMAT_S16"
+.LASF41:
+	.string	"_markers"
+.LASF250:
+	.string	"file"
+.LASF72:
+	.string	"_ISpunct"
+.LASF89:
+	.string	"includeFdaf"
+.LASF263:
+	.string	"fixed"
+.LASF252:
+	.string	"task"
+.LASF258:
+	.string	"lmsSettings"
+.LASF226:
+	.string	"printf"
+.LASF118:
+	.string	"SAMPLE_FORMAT_TEXT"
+.LASF80:
+	.string	"LmsBenchFormat_t"
+.LASF233:
+	.string	"lmsKernel_GetBest"
+.LASF148:
+	.string	"memory"
+.LASF213:
+	.string	"lmsFixed_Init"
+.LASF124:
+	.string	"LMS_FILTER_VARIANT_LMS"
+.LASF82:
+	.string	"numOfLengths"
+.LASF257:
+	.string	"left"
+.LASF78:
+	.string	"LMS_BENCH_FORMAT_CSV"
+.LASF50:
+	.string	"_offset"
+.LASF255:
+	.string	"fixedInput"
+.LASF281:
+	.string	"lmsBench_MeasureEngine"
+.LASF154:
+	.string	"LMS_FILTER_ALGORITHM_SUBBAND"
+.LASF291:
+	.string	"lmsBench_Measure"
+.LASF197:
+	.string	"cyclesPerSample"
+.LASF150:
+	.string	"LMS_FILTER_ALGORITHM_UNKNOWN"
+.LASF276:
+	.string	"cyclesPerTap"
+.LASF136:
+	.string	"coefficients"
+.LASF159:
+	.string	"normSquared"
+.LASF155:
+	.string	"LMS_FILTER_ALGORITHM_RLS"
+.LASF208:
+	.string	"LmsBenchEngineCase_t"
+.LASF13:
+	.string	"__uint64_t"
+.LASF189:
+	.string	"endResolution"
+.LASF2:
+	.string	"long unsigned int"
+.LASF94:
+	.string	"format"
+.LASF44:
+	.string	"_flags2"
+.LASF170:
+	.string	"RLS_FILTER_FORM_DIRECT"
+.LASF32:
+	.string	"_IO_read_base"
+.LASF108:
+	.string	"LmsKernelType_t"
+.LASF181:
+	.string	"GEN_SIGNAL_WHITE"
+.LASF211:
+	.string	"LmsBenchFixed_t"
+.LASF57:
+	.string	"_unused2"
+.LASF292:
+	.string	"process"
+.LASF91:
+	.string	"includeSubband"
+.LASF246:
+	.string	"lmsFilter_ProcessBlock"
+.LASF66:
+	.string	"_ISxdigit"
+.LASF225:
+	.string	"lmsFixed_FromFloat"
+.LASF45:
+	.string	"_old_offset"
+.LASF269:
+	.string	"maxValues"
+.LASF81:
+	.string	"lengths"
+.LASF264:
+	.string	"lmsBench_Run"
+.LASF247:
+	.string	"retval"
+.LASF106:
+	.string	"LMS_KERNEL_AVX512"
+.LASF236:
+	.string	"lmsEngine_Open"
+.LASF137:
+	.string	"delayLine"
+.LASF222:
+	.string	"fdafFilter_BlockSize"
+.LASF180:
+	.string	"GEN_SIGNAL_CHIRP"
+.LASF231:
+	.string	"snprintf"
+.LASF127:
+	.string	"LMS_FILTER_VARIANT_SIGN_ERROR"
+.LASF198:
+	.string	"stable"
+.LASF4:
+	.string	"long long int"
+.LASF88:
+	.string	"allVariants"
+.LASF62:
+	.string	"_ISupper"
+.LASF184:
+	.string	"GEN_SIGNAL_COUNT"
+.LASF232:
+	.string	"__ctype_b_loc"
+.LASF75:
+	.string	"double"
+.LASF71:
+	.string	"_IScntrl"
+.LASF35:
+	.string	"_IO_write_end"
+.LASF216:
+	.string	"lmsFixed_Free"
+.LASF74:
+	.string	"float"
+.LASF270:
+	.string	"count"
+.LASF293:
+	.string	"nsPerSample"
+.LASF36:
+	.string	"_IO_buf_base"
+.LASF168:
+	.string	"LmsEngineSettings_t"
+.LASF7:
+	.string	"unsigned int"
+.LASF303:
+	.string	"lmsBench_ProcessLms"
+.LASF223:
+	.string	"perror"
+.LASF177:
+	.string	"GEN_SIGNAL_SINE"
+.LASF271:
+	.string	"position"
+.LASF55:
+	.string	"__pad5"
+.LASF298:
+	.string	"lmsBench_CompareDouble"
+.LASF171:
+	.string	"RLS_FILTER_FORM_LATTICE"
+.LASF107:
+	.string	"LMS_KERNEL_COUNT"
+.LASF196:
+	.string	"minNsPerSample"
+.LASF179:
+	.string	"GEN_SIGNAL_SAWTOOTH"
+.LASF161:
+	.string	"LmsEngineOps_t"
+.LASF304:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF29:
+	.string	"_flags"
+.LASF267:
+	.string	"list"
+.LASF115:
+	.string	"bankUpdateDot"
+.LASF249:
+	.string	"first"
+.LASF56:
+	.string	"_mode"
+.LASF51:
+	.string	"_codecvt"
+.LASF138:
+	.string	"delayIndex"
+.LASF143:
+	.string	"leakage"
+.LASF141:
+	.string	"power"
+.LASF299:
+	.string	"lmsBench_Cycles"
+.LASF165:
+	.string	"numOfBands"
+.LASF241:
+	.string	"qsort"
+.LASF97:
+	.string	"long double"
+.LASF58:
+	.string	"FILE"
+.LASF277:
+	.string	"lmsBench_PrintResult"
+.LASF27:
+	.string	"timespec"
+.LASF167:
+	.string	"numOfThreads"
+.LASF157:
+	.string	"LmsFilterAlgorithm_t"
+.LASF153:
+	.string	"LMS_FILTER_ALGORITHM_FIXED"
+.LASF64:
+	.string	"_ISalpha"
+.LASF265:
+	.string	"lmsBench_processArgumentList"
+.LASF103:
+	.string	"LMS_KERNEL_SCALAR"
+.LASF300:
+	.string	"lmsBench_Now"
+.LASF25:
+	.string	"long long unsigned int"
+.LASF254:
+	.string	"output"
+.LASF280:
+	.string	"sineSettings"
+.LASF308:
+	.string	"__rdtsc"
+.LASF135:
+	.string	"length"
+.LASF70:
+	.string	"_ISblank"
+.LASF14:
+	.string	"__off_t"
+.LASF73:
+	.string	"_ISalnum"
+.LASF219:
+	.string	"lmsFilter_InitVariant"
+.LASF54:
+	.string	"_freeres_buf"
+.LASF67:
+	.string	"_ISspace"
+.LASF16:
+	.string	"__time_t"
+.LASF20:
+	.string	"clockid_t"
+.LASF229:
+	.string	"memset"
+.LASF282:
+	.string	"lmsBench_ConvergeEngine"
+.LASF10:
+	.string	"__int16_t"
+.LASF39:
+	.string	"_IO_backup_base"
+.LASF48:
+	.string	"_shortbuf"
+.LASF200:
+	.string	"LmsBenchResult_t"
+.LASF192:
+	.string	"_Float16"
+.LASF242:
+	.string	"malloc"
+.LASF15:
+	.string	"__off64_t"
+.LASF262:
+	.string	"numOfVariants"
+.LASF268:
+	.string	"values"
+.LASF125:
+	.string	"LMS_FILTER_VARIANT_NLMS"
+.LASF224:
+	.string	"fopen"
+.LASF96:
+	.string	"LmsBenchSettings_t"
+.LASF147:
+	.string	"allocator"
+.LASF119:
+	.string	"SAMPLE_FORMAT_F32"
+.LASF284:
+	.string	"errorPower"
+.LASF235:
+	.string	"lmsEngine_Close"
+.LASF278:
+	.string	"lmsBench_PrintHeader"
+.LASF37:
+	.string	"_IO_buf_end"
+.LASF202:
+	.string	"desired"
+.LASF110:
+	.string	"name"
+.LASF234:
+	.string	"fprintf"
+.LASF274:
+	.string	"samplesPerSecond"
+.LASF63:
+	.string	"_ISlower"
+.LASF130:
+	.string	"LMS_FILTER_VARIANT_COUNT"
+.LASF217:
+	.string	"lmsFilter_Free"
+.LASF11:
+	.string	"short int"
+.LASF121:
+	.string	"SAMPLE_FORMAT_WAV_S16"
+.LASF102:
+	.string	"uint64_t"
+.LASF187:
+	.string	"resolution"
+.LASF24:
+	.string	"tv_nsec"
+.LASF21:
+	.string	"int16_t"
+.LASF47:
+	.string	"_vtable_offset"
+.LASF259:
+	.string	"fixedSettings"
+.LASF163:
+	.string	"LmsEngine_t"
+.LASF199:
+	.string	"convergedAt"
+.LASF209:
+	.string	"filter"
+.LASF101:
+	.string	"LmsAllocator_t"
+.LASF114:
+	.string	"signUpdateDot"
+.LASF288:
+	.string	"response"
+.LASF12:
+	.string	"__int64_t"
+.LASF76:
+	.string	"LMS_BENCH_FORMAT_UNKNOWN"
+.LASF256:
+	.string	"taskSamples"
+.LASF139:
+	.string	"pendingGain"
+.LASF239:
+	.string	"signalGenerator_DefaultSettings"
+.LASF214:
+	.string	"lmsFixed_StepShift"
+.LASF31:
+	.string	"_IO_read_end"
+.LASF294:
+	.string	"trial"
+.LASF43:
+	.string	"_fileno"
+.LASF99:
+	.string	"release"
+.LASF52:
+	.string	"_wide_data"
+.LASF240:
+	.string	"free"
+.LASF65:
+	.string	"_ISdigit"
+.LASF183:
+	.string	"GEN_SIGNAL_SINE_NOISE"
+.LASF6:
+	.string	"short unsigned int"
+.LASF306:
+	.string	"stdout"
+.LASF129:
+	.string	"LMS_FILTER_VARIANT_SIGN_SIGN"
+.LASF176:
+	.string	"GEN_SIGNAL_UNKNOWN"
+.LASF220:
+	.string	"lmsKernel_Get"
+.LASF131:
+	.string	"LmsFilterVariant_t"
+.LASF195:
+	.string	"medianNsPerSample"
+.LASF34:
+	.string	"_IO_write_ptr"
+.LASF174:
+	.string	"stepShift"
+.LASF188:
+	.string	"amplitude"
+.LASF243:
+	.string	"clock_gettime"
+.LASF22:
+	.string	"int64_t"
+.LASF169:
+	.string	"RLS_FILTER_FORM_AUTO"
+.LASF191:
+	.string	"SignalGenerator_t"
+.LASF279:
+	.string	"engineSettings"
+.LASF205:
+	.string	"included"
+.LASF251:
+	.string	"generator"
+.LASF160:
+	.string	"close"
+.LASF230:
+	.string	"fflush"
+.LASF23:
+	.string	"tv_sec"
+.LASF113:
+	.string	"leakyUpdateDot"
+.LASF221:
+	.string	"rlsFilter_FormName"
+.LASF93:
+	.string	"includeApa"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/lmsBench.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
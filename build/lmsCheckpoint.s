@@ -0,0 +1,3459 @@
+	.file	"lmsCheckpoint.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsCheckpoint.c"
+	.type	lmsCheckpoint_Hash, @function
+lmsCheckpoint_Hash:
+.LFB6:
+	.file 1 "source/lmsCheckpoint.c"
+	.loc 1 31 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 32 26
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR -16[rbp], rax
+.LBB2:
+	.loc 1 34 17
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 34 5
+	jmp	.L2
+.L3:
+	.loc 1 36 29 discriminator 3
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	movzx	eax, al
+	.loc 1 36 22 discriminator 3
+	xor	rax, QWORD PTR -24[rbp]
+	.loc 1 36 14 discriminator 3
+	movabs	rdx, 1099511628211
+	imul	rax, rdx
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 34 35 discriminator 3
+	add	QWORD PTR -8[rbp], 1
+.L2:
+	.loc 1 34 26 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -40[rbp]
+	jb	.L3
+.LBE2:
+	.loc 1 38 12
+	mov	rax, QWORD PTR -24[rbp]
+	.loc 1 39 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	lmsCheckpoint_Hash, .-lmsCheckpoint_Hash
+	.type	lmsCheckpoint_Checksum, @function
+lmsCheckpoint_Checksum:
+.LFB7:
+	.loc 1 45 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 168
+	.cfi_offset 3, -24
+	mov	QWORD PTR -168[rbp], rdi
+	.loc 1 46 47
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 46 27
+	mov	rcx, QWORD PTR [rax]
+	mov	rbx, QWORD PTR 8[rax]
+	mov	QWORD PTR -160[rbp], rcx
+	mov	QWORD PTR -152[rbp], rbx
+	mov	rcx, QWORD PTR 16[rax]
+	mov	rbx, QWORD PTR 24[rax]
+	mov	QWORD PTR -144[rbp], rcx
+	mov	QWORD PTR -136[rbp], rbx
+	mov	rcx, QWORD PTR 32[rax]
+	mov	rbx, QWORD PTR 40[rax]
+	mov	QWORD PTR -128[rbp], rcx
+	mov	QWORD PTR -120[rbp], rbx
+	mov	rcx, QWORD PTR 48[rax]
+	mov	rbx, QWORD PTR 56[rax]
+	mov	QWORD PTR -112[rbp], rcx
+	mov	QWORD PTR -104[rbp], rbx
+	mov	rcx, QWORD PTR 64[rax]
+	mov	rbx, QWORD PTR 72[rax]
+	mov	QWORD PTR -96[rbp], rcx
+	mov	QWORD PTR -88[rbp], rbx
+	mov	rcx, QWORD PTR 80[rax]
+	mov	rbx, QWORD PTR 88[rax]
+	mov	QWORD PTR -80[rbp], rcx
+	mov	QWORD PTR -72[rbp], rbx
+	mov	rcx, QWORD PTR 96[rax]
+	mov	rbx, QWORD PTR 104[rax]
+	mov	QWORD PTR -64[rbp], rcx
+	mov	QWORD PTR -56[rbp], rbx
+	mov	rdx, QWORD PTR 120[rax]
+	mov	rax, QWORD PTR 112[rax]
+	mov	QWORD PTR -48[rbp], rax
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 48 21
+	mov	QWORD PTR -88[rbp], 0
+	.loc 1 49 21
+	lea	rax, -160[rbp]
+	mov	edx, 128
+	mov	rsi, rax
+	movabs	rax, -3750763034362895579
+	mov	rdi, rax
+	call	lmsCheckpoint_Hash
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 51 41
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 50 12
+	lea	rdx, -128[rax]
+	.loc 1 50 69
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 50 12
+	lea	rcx, 128[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsCheckpoint_Hash
+	.loc 1 52 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	lmsCheckpoint_Checksum, .-lmsCheckpoint_Checksum
+	.type	lmsCheckpoint_RowStride, @function
+lmsCheckpoint_RowStride:
+.LFB8:
+	.loc 1 58 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	DWORD PTR -4[rbp], edi
+	.loc 1 59 37
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 59 12
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	.loc 1 59 69
+	shr	rax, 2
+	.loc 1 60 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	lmsCheckpoint_RowStride, .-lmsCheckpoint_RowStride
+	.type	lmsCheckpoint_WindowBytes, @function
+lmsCheckpoint_WindowBytes:
+.LFB9:
+	.loc 1 66 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	DWORD PTR -4[rbp], edi
+	.loc 1 67 38
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 67 53
+	add	rax, 1
+	.loc 1 67 12
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	.loc 1 68 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	lmsCheckpoint_WindowBytes, .-lmsCheckpoint_WindowBytes
+	.type	lmsCheckpoint_Attach, @function
+lmsCheckpoint_Attach:
+.LFB10:
+	.loc 1 74 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 75 34
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 76 56
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 76 20
+	sub	rax, -128
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 78 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 79 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 80 15
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 44[rax]
+	.loc 1 80 8
+	test	eax, eax
+	je	.L13
+	.loc 1 82 63
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 82 49
+	mov	edx, eax
+	.loc 1 82 87
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 28[rax]
+	mov	eax, eax
+	.loc 1 82 79
+	imul	rax, rdx
+	.loc 1 82 99
+	lea	rdx, 0[0+rax*4]
+	.loc 1 82 47
+	mov	rax, QWORD PTR -16[rbp]
+	add	rdx, rax
+	.loc 1 82 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 16[rax], rdx
+.L13:
+	.loc 1 84 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	lmsCheckpoint_Attach, .-lmsCheckpoint_Attach
+	.section	.rodata
+	.align 8
+.LC0:
+	.string	"Error allocating checkpoint of %d channels\n"
+.LC1:
+	.string	"LMSCKPT"
+	.text
+	.globl	lmsCheckpoint_Create
+	.type	lmsCheckpoint_Create, @function
+lmsCheckpoint_Create:
+.LFB11:
+	.loc 1 87 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 72
+	.cfi_offset 3, -24
+	mov	QWORD PTR -56[rbp], rdi
+	mov	DWORD PTR -60[rbp], esi
+	mov	DWORD PTR -64[rbp], edx
+	mov	DWORD PTR -68[rbp], ecx
+	.loc 1 88 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 89 30
+	mov	eax, DWORD PTR -64[rbp]
+	mov	edi, eax
+	call	lmsCheckpoint_RowStride
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 90 33
+	mov	eax, DWORD PTR -60[rbp]
+	cdqe
+	.loc 1 90 55
+	imul	rax, QWORD PTR -32[rbp]
+	.loc 1 90 67
+	lea	rbx, 0[0+rax*4]
+	.loc 1 91 86
+	cmp	DWORD PTR -68[rbp], 0
+	je	.L15
+	.loc 1 91 52 discriminator 1
+	mov	eax, DWORD PTR -64[rbp]
+	mov	edi, eax
+	call	lmsCheckpoint_WindowBytes
+	jmp	.L16
+.L15:
+	.loc 1 91 86 discriminator 2
+	mov	eax, 0
+.L16:
+	.loc 1 90 18
+	add	rax, rbx
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 93 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, 40
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 94 51
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rdx, 128[rax]
+	.loc 1 94 22
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 95 54
+	mov	rax, QWORD PTR -24[rbp]
+	mov	r8, QWORD PTR [rax]
+	.loc 1 95 50
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR 24[rax]
+	.loc 1 95 69
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 95 50
+	mov	edx, 64
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	r8
+.LVL0:
+	.loc 1 95 24
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	QWORD PTR [rdx], rax
+	.loc 1 96 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 96 8
+	test	rax, rax
+	jne	.L17
+	.loc 1 98 9
+	mov	eax, DWORD PTR -60[rbp]
+	mov	esi, eax
+	lea	rax, .LC0[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 99 16
+	mov	eax, 1
+	jmp	.L18
+.L17:
+	.loc 1 101 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 101 22
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 101 5
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 103 28
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 104 18
+	mov	rax, QWORD PTR -48[rbp]
+	.loc 1 104 5
+	mov	edx, 8
+	lea	rcx, .LC1[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 105 21
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 8[rax], 1
+	.loc 1 106 23
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 12[rax], 16909060
+	.loc 1 107 24
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 16[rax], 128
+	.loc 1 108 29
+	mov	edx, DWORD PTR -60[rbp]
+	.loc 1 108 27
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 20[rax], edx
+	.loc 1 109 22
+	mov	edx, DWORD PTR -64[rbp]
+	.loc 1 109 20
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 24[rax], edx
+	.loc 1 110 25
+	mov	rax, QWORD PTR -32[rbp]
+	mov	edx, eax
+	.loc 1 110 23
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 28[rax], edx
+	.loc 1 111 44
+	cmp	DWORD PTR -68[rbp], 0
+	setne	al
+	movzx	edx, al
+	.loc 1 111 22
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 44[rax], edx
+	.loc 1 112 26
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	.loc 1 113 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Attach
+	.loc 1 115 12
+	mov	eax, 0
+.L18:
+	.loc 1 116 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	lmsCheckpoint_Create, .-lmsCheckpoint_Create
+	.globl	lmsCheckpoint_Row
+	.type	lmsCheckpoint_Row, @function
+lmsCheckpoint_Row:
+.LFB12:
+	.loc 1 119 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	DWORD PTR -12[rbp], esi
+	.loc 1 120 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 120 38
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	.loc 1 120 66
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR [rdx]
+	.loc 1 120 74
+	mov	edx, DWORD PTR 28[rdx]
+	mov	edx, edx
+	.loc 1 120 54
+	imul	rax, rdx
+	.loc 1 120 37
+	sal	rax, 2
+	.loc 1 120 12
+	add	rax, rcx
+	.loc 1 121 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	lmsCheckpoint_Row, .-lmsCheckpoint_Row
+	.section	.rodata
+.LC2:
+	.string	".tmp"
+.LC3:
+	.string	"wb"
+.LC4:
+	.string	"Error writing checkpoint %s\n"
+	.text
+	.globl	lmsCheckpoint_Write
+	.type	lmsCheckpoint_Write, @function
+lmsCheckpoint_Write:
+.LFB13:
+	.loc 1 124 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 72
+	.cfi_offset 3, -24
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	.loc 1 125 25
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	strlen@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 126 26
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, 5
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 128 8
+	cmp	QWORD PTR -40[rbp], 0
+	jne	.L22
+	.loc 1 130 16
+	mov	eax, 1
+	jmp	.L23
+.L22:
+	.loc 1 132 5
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 133 12
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 133 5
+	mov	edx, 5
+	lea	rcx, .LC2[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 135 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rbx, QWORD PTR [rax]
+	.loc 1 135 36
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Checksum
+	.loc 1 135 34
+	mov	QWORD PTR 72[rbx], rax
+	.loc 1 137 9
+	mov	DWORD PTR -20[rbp], 1
+	.loc 1 138 18
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rdx, .LC3[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	fopen@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 139 8
+	cmp	QWORD PTR -48[rbp], 0
+	je	.L24
+.LBB3:
+	.loc 1 141 26
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 141 43
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 141 26
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	esi, 1
+	mov	rdi, rax
+	call	fwrite@PLT
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 142 14
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 142 12
+	test	eax, eax
+	jne	.L25
+	.loc 1 142 58 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 142 33 discriminator 1
+	cmp	QWORD PTR -56[rbp], rax
+	jne	.L25
+	.loc 1 142 70 discriminator 2
+	mov	rdx, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rename@PLT
+	.loc 1 142 66 discriminator 2
+	test	eax, eax
+	jne	.L25
+	.loc 1 144 20
+	mov	DWORD PTR -20[rbp], 0
+	jmp	.L24
+.L25:
+	.loc 1 148 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	remove@PLT
+.L24:
+.LBE3:
+	.loc 1 151 8
+	cmp	DWORD PTR -20[rbp], 0
+	je	.L26
+	.loc 1 153 9
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rsi, rax
+	lea	rax, .LC4[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L26:
+	.loc 1 155 5
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 156 12
+	mov	eax, DWORD PTR -20[rbp]
+.L23:
+	.loc 1 157 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	lmsCheckpoint_Write, .-lmsCheckpoint_Write
+	.section	.rodata
+.LC5:
+	.string	"rb"
+.LC6:
+	.string	"Error opening checkpoint %s\n"
+.LC7:
+	.string	"%s is not a checkpoint\n"
+.LC8:
+	.string	"Error mapping checkpoint %s\n"
+	.align 8
+.LC9:
+	.string	"Checkpoint %s has version %u, byte order %08x, expected version %d of this machine\n"
+	.align 8
+.LC10:
+	.string	"Checkpoint %s is truncated or has a wrong size\n"
+	.align 8
+.LC11:
+	.string	"Checkpoint %s is corrupted, checksum does not match\n"
+	.text
+	.globl	lmsCheckpoint_Open
+	.type	lmsCheckpoint_Open, @function
+lmsCheckpoint_Open:
+.LFB14:
+	.loc 1 160 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r12
+	push	rbx
+	sub	rsp, 192
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	mov	QWORD PTR -200[rbp], rdi
+	mov	QWORD PTR -208[rbp], rsi
+	.loc 1 163 5
+	mov	rax, QWORD PTR -200[rbp]
+	mov	edx, 40
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 164 18
+	mov	rax, QWORD PTR -208[rbp]
+	lea	rdx, .LC5[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	fopen@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 165 8
+	cmp	QWORD PTR -24[rbp], 0
+	jne	.L28
+	.loc 1 167 9
+	mov	rax, QWORD PTR -208[rbp]
+	mov	rsi, rax
+	lea	rax, .LC6[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 168 16
+	mov	eax, 1
+	jmp	.L42
+.L28:
+	.loc 1 170 10
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	edx, eax
+	lea	rax, -192[rbp]
+	mov	rsi, rax
+	mov	edi, edx
+	call	fstat@PLT
+	.loc 1 170 8
+	test	eax, eax
+	jne	.L30
+	.loc 1 170 59 discriminator 1
+	mov	rax, QWORD PTR -144[rbp]
+	.loc 1 170 47 discriminator 1
+	cmp	rax, 127
+	jg	.L31
+.L30:
+	.loc 1 172 9
+	mov	rax, QWORD PTR -208[rbp]
+	mov	rsi, rax
+	lea	rax, .LC7[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 173 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 174 16
+	mov	eax, 1
+	jmp	.L42
+.L31:
+	.loc 1 178 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	fileno@PLT
+	.loc 1 178 47
+	mov	rdx, QWORD PTR -144[rbp]
+	.loc 1 178 20
+	mov	rsi, rdx
+	mov	r9d, 0
+	mov	r8d, eax
+	mov	ecx, 2
+	mov	edx, 1
+	mov	edi, 0
+	call	mmap@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 179 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 180 8
+	cmp	QWORD PTR -32[rbp], -1
+	jne	.L32
+	.loc 1 182 9
+	mov	rax, QWORD PTR -208[rbp]
+	mov	rsi, rax
+	lea	rax, .LC8[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 183 16
+	mov	eax, 1
+	jmp	.L42
+.L32:
+	.loc 1 185 24
+	mov	rax, QWORD PTR -200[rbp]
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 186 40
+	mov	rax, QWORD PTR -144[rbp]
+	.loc 1 186 24
+	mov	rdx, rax
+	.loc 1 186 22
+	mov	rax, QWORD PTR -200[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 187 24
+	mov	rax, QWORD PTR -200[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 189 34
+	mov	rax, QWORD PTR -200[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 190 22
+	mov	rax, QWORD PTR -40[rbp]
+	.loc 1 190 9
+	mov	edx, 8
+	lea	rcx, .LC1[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcmp@PLT
+	.loc 1 190 8
+	test	eax, eax
+	je	.L33
+	.loc 1 192 9
+	mov	rax, QWORD PTR -208[rbp]
+	mov	rsi, rax
+	lea	rax, .LC7[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L34
+.L33:
+	.loc 1 194 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 194 13
+	cmp	eax, 1
+	jne	.L35
+	.loc 1 194 68 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 194 58 discriminator 1
+	cmp	eax, 16909060
+	jne	.L35
+	.loc 1 195 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 195 11
+	cmp	eax, 128
+	je	.L36
+.L35:
+	.loc 1 198 49
+	mov	rax, QWORD PTR -40[rbp]
+	mov	ecx, DWORD PTR 12[rax]
+	.loc 1 198 32
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR 8[rax]
+	.loc 1 197 9
+	mov	rax, QWORD PTR -208[rbp]
+	mov	r8d, 1
+	mov	rsi, rax
+	lea	rax, .LC9[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L34
+.L36:
+	.loc 1 200 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 200 13
+	test	eax, eax
+	je	.L37
+	.loc 1 200 52 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 200 42 discriminator 1
+	test	eax, eax
+	je	.L37
+	.loc 1 201 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 28[rax]
+	mov	ebx, eax
+	.loc 1 201 71
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 201 36
+	mov	edi, eax
+	call	lmsCheckpoint_RowStride
+	.loc 1 201 11
+	cmp	rbx, rax
+	jne	.L37
+	.loc 1 202 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 64[rax]
+	.loc 1 202 49
+	mov	rax, QWORD PTR -200[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 202 56
+	add	rax, -128
+	.loc 1 202 11
+	cmp	rdx, rax
+	jne	.L37
+	.loc 1 203 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rbx, QWORD PTR 64[rax]
+	.loc 1 203 55
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 203 39
+	mov	edx, eax
+	.loc 1 203 79
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 28[rax]
+	mov	eax, eax
+	.loc 1 203 71
+	imul	rax, rdx
+	.loc 1 203 91
+	lea	r12, 0[0+rax*4]
+	.loc 1 204 47
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 44[rax]
+	.loc 1 204 113
+	test	eax, eax
+	je	.L38
+	.loc 1 204 103 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 204 66 discriminator 1
+	mov	edi, eax
+	call	lmsCheckpoint_WindowBytes
+	jmp	.L39
+.L38:
+	.loc 1 204 113 discriminator 2
+	mov	eax, 0
+.L39:
+	.loc 1 204 37 discriminator 4
+	add	rax, r12
+	.loc 1 203 11 discriminator 4
+	cmp	rbx, rax
+	je	.L40
+.L37:
+	.loc 1 206 9
+	mov	rax, QWORD PTR -208[rbp]
+	mov	rsi, rax
+	lea	rax, .LC10[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L34
+.L40:
+	.loc 1 208 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rbx, QWORD PTR 72[rax]
+	.loc 1 208 34
+	mov	rax, QWORD PTR -200[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Checksum
+	.loc 1 208 13
+	cmp	rbx, rax
+	je	.L41
+	.loc 1 210 9
+	mov	rax, QWORD PTR -208[rbp]
+	mov	rsi, rax
+	lea	rax, .LC11[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L34
+.L41:
+	.loc 1 214 9
+	mov	rax, QWORD PTR -200[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Attach
+	.loc 1 215 16
+	mov	eax, 0
+	jmp	.L42
+.L34:
+	.loc 1 218 5
+	mov	rax, QWORD PTR -200[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Close
+	.loc 1 219 12
+	mov	eax, 1
+.L42:
+	.loc 1 220 1 discriminator 1
+	add	rsp, 192
+	pop	rbx
+	pop	r12
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	lmsCheckpoint_Open, .-lmsCheckpoint_Open
+	.globl	lmsCheckpoint_Close
+	.type	lmsCheckpoint_Close, @function
+lmsCheckpoint_Close:
+.LFB15:
+	.loc 1 223 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 224 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 224 8
+	test	rax, rax
+	je	.L44
+	.loc 1 226 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 226 12
+	test	eax, eax
+	je	.L45
+	.loc 1 228 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 228 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 228 13
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	munmap@PLT
+	jmp	.L44
+.L45:
+.LBB4:
+	.loc 1 232 42
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 233 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 233 52
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 233 31
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 233 13
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+.L44:
+.LBE4:
+	.loc 1 236 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, 40
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 237 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	lmsCheckpoint_Close, .-lmsCheckpoint_Close
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 9 "include/lmsAllocator.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 11 "include/lmsCheckpoint.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 15 "/usr/include/stdio.h"
+	.file 16 "/usr/include/stdlib.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xc61
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF158
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0x9
+	.long	0x2e
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x9
+	.long	0x5b
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x3
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x5b
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x29
+	.byte	0x14
+	.long	0x46
+	.uleb128 0x3
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x6e
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x4d
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x91
+	.byte	0x19
+	.long	0x3f
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x92
+	.byte	0x19
+	.long	0x6e
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x3
+	.byte	0x93
+	.byte	0x19
+	.long	0x6e
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x3
+	.byte	0x94
+	.byte	0x19
+	.long	0x3f
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x3
+	.byte	0x96
+	.byte	0x1a
+	.long	0x6e
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x3
+	.byte	0x97
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x3
+	.long	.LASF22
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x4d
+	.uleb128 0x3
+	.long	.LASF23
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x4d
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x4d
+	.uleb128 0x16
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x3
+	.byte	0xaf
+	.byte	0x1d
+	.long	0x4d
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x3
+	.byte	0xb4
+	.byte	0x1c
+	.long	0x4d
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x21
+	.long	0x4d
+	.uleb128 0x4
+	.long	0x156
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF28
+	.uleb128 0x9
+	.long	0x156
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8f
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0xa7
+	.uleb128 0xd
+	.long	.LASF34
+	.byte	0x10
+	.byte	0x5
+	.byte	0xb
+	.long	0x1a1
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x5
+	.byte	0x10
+	.byte	0xc
+	.long	0x11f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x5
+	.byte	0x15
+	.byte	0x15
+	.long	0x145
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF33
+	.uleb128 0xb
+	.long	0x156
+	.long	0x1b8
+	.uleb128 0xc
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	0x1c2
+	.uleb128 0xe
+	.long	0x1b8
+	.uleb128 0x17
+	.uleb128 0xd
+	.long	.LASF35
+	.byte	0xd8
+	.byte	0x6
+	.byte	0x31
+	.long	0x349
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x6
+	.byte	0x33
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x36
+	.byte	0x9
+	.long	0x151
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x6
+	.byte	0x37
+	.byte	0x9
+	.long	0x151
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x38
+	.byte	0x9
+	.long	0x151
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0x151
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x9
+	.long	0x151
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x9
+	.long	0x151
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x9
+	.long	0x151
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x9
+	.long	0x151
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x40
+	.byte	0x9
+	.long	0x151
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x6
+	.byte	0x41
+	.byte	0x9
+	.long	0x151
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x6
+	.byte	0x42
+	.byte	0x9
+	.long	0x151
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x6
+	.byte	0x44
+	.byte	0x16
+	.long	0x362
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x6
+	.byte	0x46
+	.byte	0x14
+	.long	0x367
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x6
+	.byte	0x48
+	.byte	0x7
+	.long	0x46
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0x6
+	.byte	0x49
+	.byte	0x7
+	.long	0x46
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xb
+	.long	0x107
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x12
+	.long	0x67
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xf
+	.long	0x75
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x8
+	.long	0x36c
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x6
+	.byte	0x51
+	.byte	0xf
+	.long	0x37c
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x6
+	.byte	0x59
+	.byte	0xd
+	.long	0x113
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x17
+	.long	0x386
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0x6
+	.byte	0x5c
+	.byte	0x19
+	.long	0x390
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x14
+	.long	0x367
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x9
+	.long	0x12b
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x6
+	.byte	0x60
+	.byte	0x7
+	.long	0x46
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x6
+	.byte	0x62
+	.byte	0x8
+	.long	0x395
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF65
+	.byte	0x7
+	.byte	0x7
+	.byte	0x19
+	.long	0x1c3
+	.uleb128 0x18
+	.long	.LASF159
+	.byte	0x6
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0xf
+	.long	.LASF66
+	.uleb128 0x4
+	.long	0x35d
+	.uleb128 0x4
+	.long	0x1c3
+	.uleb128 0xb
+	.long	0x156
+	.long	0x37c
+	.uleb128 0xc
+	.long	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x355
+	.uleb128 0xf
+	.long	.LASF67
+	.uleb128 0x4
+	.long	0x381
+	.uleb128 0xf
+	.long	.LASF68
+	.uleb128 0x4
+	.long	0x38b
+	.uleb128 0xb
+	.long	0x156
+	.long	0x3a5
+	.uleb128 0xc
+	.long	0x3f
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	0x349
+	.uleb128 0xe
+	.long	0x3a5
+	.uleb128 0x4
+	.long	0x15d
+	.uleb128 0xe
+	.long	0x3af
+	.uleb128 0xd
+	.long	.LASF69
+	.byte	0x90
+	.byte	0x8
+	.byte	0x1a
+	.long	0x489
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xd
+	.long	0xbf
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x8
+	.byte	0x24
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xf
+	.long	0xfb
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xe
+	.long	0xef
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0x8
+	.byte	0x2f
+	.byte	0xd
+	.long	0xcb
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0x8
+	.byte	0x30
+	.byte	0xd
+	.long	0xd7
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0x8
+	.byte	0x32
+	.byte	0x9
+	.long	0x46
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0x8
+	.byte	0x34
+	.byte	0xd
+	.long	0xbf
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0x8
+	.byte	0x39
+	.byte	0xd
+	.long	0x107
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x11
+	.long	0x12d
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x10
+	.long	0x139
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x15
+	.long	0x17a
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x15
+	.long	0x17a
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0x8
+	.byte	0x4c
+	.byte	0x15
+	.long	0x17a
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0x8
+	.byte	0x59
+	.byte	0x17
+	.long	0x489
+	.byte	0x78
+	.byte	0
+	.uleb128 0xb
+	.long	0x145
+	.long	0x499
+	.uleb128 0xc
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF85
+	.uleb128 0x10
+	.byte	0x18
+	.byte	0x9
+	.byte	0x10
+	.long	0x4d0
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0x9
+	.byte	0x13
+	.byte	0xd
+	.long	0x4e9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0x9
+	.byte	0x16
+	.byte	0xc
+	.long	0x4fe
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0x9
+	.byte	0x18
+	.byte	0xb
+	.long	0x12b
+	.byte	0x10
+	.byte	0
+	.uleb128 0x19
+	.long	0x12b
+	.long	0x4e9
+	.uleb128 0x2
+	.long	0x12b
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	0x4d0
+	.uleb128 0x1a
+	.long	0x4fe
+	.uleb128 0x2
+	.long	0x12b
+	.uleb128 0x2
+	.long	0x12b
+	.byte	0
+	.uleb128 0x4
+	.long	0x4ee
+	.uleb128 0x3
+	.long	.LASF89
+	.byte	0x9
+	.byte	0x19
+	.byte	0x3
+	.long	0x4a0
+	.uleb128 0x9
+	.long	0x503
+	.uleb128 0x4
+	.long	0x5b
+	.uleb128 0x3
+	.long	.LASF90
+	.byte	0xa
+	.byte	0x18
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF91
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x3
+	.long	.LASF92
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x14
+	.long	0xb3
+	.uleb128 0x10
+	.byte	0x80
+	.byte	0xb
+	.byte	0x18
+	.long	0x630
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0xb
+	.byte	0x1a
+	.byte	0xa
+	.long	0x1a8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xb
+	.byte	0x1b
+	.byte	0xe
+	.long	0x525
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0xb
+	.byte	0x1c
+	.byte	0xe
+	.long	0x525
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0xb
+	.byte	0x1d
+	.byte	0xe
+	.long	0x525
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0xb
+	.byte	0x1e
+	.byte	0xe
+	.long	0x525
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0xb
+	.byte	0x1f
+	.byte	0xe
+	.long	0x525
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0xb
+	.byte	0x20
+	.byte	0xe
+	.long	0x525
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF100
+	.byte	0xb
+	.byte	0x21
+	.byte	0xe
+	.long	0x525
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF101
+	.byte	0xb
+	.byte	0x22
+	.byte	0xb
+	.long	0x630
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0xb
+	.byte	0x23
+	.byte	0xb
+	.long	0x630
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0xb
+	.byte	0x24
+	.byte	0xe
+	.long	0x525
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0xb
+	.byte	0x25
+	.byte	0xd
+	.long	0x162
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0xb
+	.byte	0x26
+	.byte	0xd
+	.long	0x16e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0xb
+	.byte	0x27
+	.byte	0xe
+	.long	0x531
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0xb
+	.byte	0x28
+	.byte	0xe
+	.long	0x531
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0xb
+	.byte	0x29
+	.byte	0xc
+	.long	0x637
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0xb
+	.byte	0x2a
+	.byte	0xb
+	.long	0x630
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xd
+	.long	0x63e
+	.byte	0x5c
+	.byte	0
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF111
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF112
+	.uleb128 0xb
+	.long	0x519
+	.long	0x64e
+	.uleb128 0xc
+	.long	0x3f
+	.byte	0x23
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF113
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x3
+	.long	0x53d
+	.uleb128 0x9
+	.long	0x64e
+	.uleb128 0x10
+	.byte	0x28
+	.byte	0xb
+	.byte	0x2f
+	.long	0x6a9
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0xb
+	.byte	0x31
+	.byte	0x1c
+	.long	0x6a9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0xb
+	.byte	0x32
+	.byte	0xc
+	.long	0x6ae
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0xb
+	.byte	0x33
+	.byte	0xc
+	.long	0x6ae
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0xb
+	.byte	0x34
+	.byte	0xc
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0xb
+	.byte	0x35
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x64e
+	.uleb128 0x4
+	.long	0x630
+	.uleb128 0x3
+	.long	.LASF119
+	.byte	0xb
+	.byte	0x36
+	.byte	0x3
+	.long	0x65f
+	.uleb128 0x9
+	.long	0x6b3
+	.uleb128 0x8
+	.long	.LASF120
+	.byte	0xc
+	.byte	0x4c
+	.byte	0xc
+	.long	0x46
+	.long	0x6df
+	.uleb128 0x2
+	.long	0x12b
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF121
+	.byte	0xd
+	.byte	0x40
+	.byte	0xc
+	.long	0x46
+	.long	0x6ff
+	.uleb128 0x2
+	.long	0x1b8
+	.uleb128 0x2
+	.long	0x1b8
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF122
+	.byte	0xc
+	.byte	0x39
+	.byte	0xe
+	.long	0x12b
+	.long	0x72e
+	.uleb128 0x2
+	.long	0x12b
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x107
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF123
+	.byte	0xe
+	.byte	0xd2
+	.byte	0xc
+	.long	0x46
+	.long	0x749
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x749
+	.byte	0
+	.uleb128 0x4
+	.long	0x3b9
+	.uleb128 0xa
+	.long	.LASF124
+	.byte	0xf
+	.value	0x329
+	.byte	0xc
+	.long	0x46
+	.long	0x765
+	.uleb128 0x2
+	.long	0x3a5
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF160
+	.byte	0x10
+	.value	0x238
+	.byte	0xd
+	.long	0x778
+	.uleb128 0x2
+	.long	0x12b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF125
+	.byte	0xf
+	.byte	0x98
+	.byte	0xc
+	.long	0x46
+	.long	0x78e
+	.uleb128 0x2
+	.long	0x3af
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF126
+	.byte	0xf
+	.byte	0x9a
+	.byte	0xc
+	.long	0x46
+	.long	0x7a9
+	.uleb128 0x2
+	.long	0x3af
+	.uleb128 0x2
+	.long	0x3af
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF127
+	.byte	0xf
+	.byte	0xb2
+	.byte	0xc
+	.long	0x46
+	.long	0x7bf
+	.uleb128 0x2
+	.long	0x3a5
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF128
+	.byte	0xf
+	.value	0x2a9
+	.byte	0xf
+	.long	0x2e
+	.long	0x7e5
+	.uleb128 0x2
+	.long	0x1bd
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x3aa
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF129
+	.byte	0xf
+	.value	0x102
+	.byte	0xe
+	.long	0x3a5
+	.long	0x801
+	.uleb128 0x2
+	.long	0x3b4
+	.uleb128 0x2
+	.long	0x3b4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF130
+	.byte	0x10
+	.value	0x229
+	.byte	0xe
+	.long	0x12b
+	.long	0x818
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF131
+	.byte	0xd
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x82f
+	.uleb128 0x2
+	.long	0x3af
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF132
+	.byte	0xd
+	.byte	0x2b
+	.byte	0xe
+	.long	0x12b
+	.long	0x84f
+	.uleb128 0x2
+	.long	0x12b
+	.uleb128 0x2
+	.long	0x1b8
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF133
+	.byte	0xf
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0x867
+	.uleb128 0x2
+	.long	0x3af
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF134
+	.byte	0xd
+	.byte	0x3d
+	.byte	0xe
+	.long	0x12b
+	.long	0x887
+	.uleb128 0x2
+	.long	0x12b
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF161
+	.byte	0x9
+	.byte	0x27
+	.byte	0x17
+	.long	0x893
+	.uleb128 0x4
+	.long	0x50f
+	.uleb128 0x8
+	.long	.LASF135
+	.byte	0x9
+	.byte	0x43
+	.byte	0x8
+	.long	0x2e
+	.long	0x8ae
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF162
+	.byte	0x1
+	.byte	0xde
+	.byte	0x6
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8fb
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0xde
+	.byte	0x2b
+	.long	0x8fb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x11
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x5
+	.long	.LASF138
+	.byte	0xe8
+	.byte	0x23
+	.long	0x893
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x6b3
+	.uleb128 0x12
+	.long	.LASF141
+	.byte	0x9f
+	.long	0x46
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x978
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0x9f
+	.byte	0x29
+	.long	0x8fb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x6
+	.long	.LASF137
+	.byte	0x9f
+	.byte	0x41
+	.long	0x3af
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x5
+	.long	.LASF139
+	.byte	0xa1
+	.byte	0x11
+	.long	0x3b9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x5
+	.long	.LASF140
+	.byte	0xa4
+	.byte	0xb
+	.long	0x3a5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF118
+	.byte	0xb2
+	.byte	0xb
+	.long	0x12b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0xbd
+	.byte	0x22
+	.long	0x978
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x4
+	.long	0x65a
+	.uleb128 0x12
+	.long	.LASF142
+	.byte	0x7b
+	.long	0x46
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa15
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0x7b
+	.byte	0x2a
+	.long	0x8fb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x6
+	.long	.LASF137
+	.byte	0x7b
+	.byte	0x42
+	.long	0x3af
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x5
+	.long	.LASF143
+	.byte	0x7d
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF144
+	.byte	0x7e
+	.byte	0xb
+	.long	0x151
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF145
+	.byte	0x89
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x5
+	.long	.LASF140
+	.byte	0x8a
+	.byte	0xb
+	.long	0x3a5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x11
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x5
+	.long	.LASF146
+	.byte	0x8d
+	.byte	0x10
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF147
+	.byte	0x1
+	.byte	0x76
+	.byte	0x8
+	.long	0x6ae
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa54
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0x76
+	.byte	0x31
+	.long	0xa54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.long	.LASF148
+	.byte	0x76
+	.byte	0x41
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x4
+	.long	0x6bf
+	.uleb128 0x12
+	.long	.LASF149
+	.byte	0x56
+	.long	0x46
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaee
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0x56
+	.byte	0x2b
+	.long	0x8fb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6
+	.long	.LASF97
+	.byte	0x56
+	.byte	0x3b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x6
+	.long	.LASF98
+	.byte	0x56
+	.byte	0x4e
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x6
+	.long	.LASF103
+	.byte	0x56
+	.byte	0x5a
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x5
+	.long	.LASF138
+	.byte	0x58
+	.byte	0x1b
+	.long	0x893
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF99
+	.byte	0x59
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF106
+	.byte	0x5a
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0x67
+	.byte	0x1c
+	.long	0x6a9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF163
+	.byte	0x1
+	.byte	0x49
+	.byte	0xd
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb37
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0x49
+	.byte	0x33
+	.long	0x8fb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0x4b
+	.byte	0x22
+	.long	0x978
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.long	.LASF150
+	.byte	0x4c
+	.byte	0x14
+	.long	0x514
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF151
+	.byte	0x41
+	.byte	0xf
+	.long	0x2e
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb67
+	.uleb128 0x6
+	.long	.LASF98
+	.byte	0x41
+	.byte	0x2d
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF152
+	.byte	0x39
+	.byte	0xf
+	.long	0x2e
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xb97
+	.uleb128 0x6
+	.long	.LASF98
+	.byte	0x39
+	.byte	0x2b
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF153
+	.byte	0x2c
+	.byte	0x11
+	.long	0x531
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xbe5
+	.uleb128 0x6
+	.long	.LASF136
+	.byte	0x2c
+	.byte	0x3f
+	.long	0xa54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x64e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x5
+	.long	.LASF154
+	.byte	0x31
+	.byte	0xe
+	.long	0x531
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF155
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x11
+	.long	0x531
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc5f
+	.uleb128 0x6
+	.long	.LASF154
+	.byte	0x1e
+	.byte	0x2d
+	.long	0x531
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF156
+	.byte	0x1e
+	.byte	0x3f
+	.long	0x1b8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF117
+	.byte	0x1e
+	.byte	0x4c
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF157
+	.byte	0x20
+	.byte	0x1a
+	.long	0xc5f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x11
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x22
+	.string	"i"
+	.byte	0x1
+	.byte	0x22
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x62
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF55:
+	.string	"_shortbuf"
+.LASF159:
+	.string	"_IO_lock_t"
+.LASF135:
+	.string	"lmsAllocator_AlignedSize"
+.LASF131:
+	.string	"strlen"
+.LASF125:
+	.string	"remove"
+.LASF44:
+	.string	"_IO_buf_end"
+.LASF42:
+	.string	"_IO_write_end"
+.LASF7:
+	.string	"unsigned int"
+.LASF94:
+	.string	"version"
+.LASF136:
+	.string	"checkpoint"
+.LASF60:
+	.string	"_freeres_list"
+.LASF79:
+	.string	"st_blksize"
+.LASF36:
+	.string	"_flags"
+.LASF12:
+	.string	"__int32_t"
+.LASF138:
+	.string	"heap"
+.LASF103:
+	.string	"hasState"
+.LASF48:
+	.string	"_markers"
+.LASF21:
+	.string	"__nlink_t"
+.LASF120:
+	.string	"munmap"
+.LASF102:
+	.string	"leakage"
+.LASF161:
+	.string	"lmsAllocator_Heap"
+.LASF122:
+	.string	"mmap"
+.LASF19:
+	.string	"__ino_t"
+.LASF91:
+	.string	"uint32_t"
+.LASF47:
+	.string	"_IO_save_end"
+.LASF111:
+	.string	"float"
+.LASF107:
+	.string	"checksum"
+.LASF67:
+	.string	"_IO_codecvt"
+.LASF130:
+	.string	"malloc"
+.LASF123:
+	.string	"fstat"
+.LASF33:
+	.string	"long long unsigned int"
+.LASF80:
+	.string	"st_blocks"
+.LASF140:
+	.string	"file"
+.LASF158:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF46:
+	.string	"_IO_backup_base"
+.LASF57:
+	.string	"_offset"
+.LASF155:
+	.string	"lmsCheckpoint_Hash"
+.LASF144:
+	.string	"tempFileName"
+.LASF50:
+	.string	"_fileno"
+.LASF69:
+	.string	"stat"
+.LASF99:
+	.string	"rowStride"
+.LASF32:
+	.string	"tv_nsec"
+.LASF9:
+	.string	"size_t"
+.LASF150:
+	.string	"payload"
+.LASF30:
+	.string	"int64_t"
+.LASF20:
+	.string	"__mode_t"
+.LASF39:
+	.string	"_IO_read_base"
+.LASF75:
+	.string	"st_gid"
+.LASF124:
+	.string	"fileno"
+.LASF142:
+	.string	"lmsCheckpoint_Write"
+.LASF73:
+	.string	"st_mode"
+.LASF157:
+	.string	"bytes"
+.LASF97:
+	.string	"numOfChannels"
+.LASF160:
+	.string	"free"
+.LASF15:
+	.string	"__uint64_t"
+.LASF141:
+	.string	"lmsCheckpoint_Open"
+.LASF163:
+	.string	"lmsCheckpoint_Attach"
+.LASF72:
+	.string	"st_nlink"
+.LASF104:
+	.string	"pendingUpdate"
+.LASF115:
+	.string	"coefficients"
+.LASF34:
+	.string	"timespec"
+.LASF28:
+	.string	"char"
+.LASF63:
+	.string	"_mode"
+.LASF66:
+	.string	"_IO_marker"
+.LASF37:
+	.string	"_IO_read_ptr"
+.LASF156:
+	.string	"data"
+.LASF114:
+	.string	"header"
+.LASF90:
+	.string	"uint8_t"
+.LASF145:
+	.string	"status"
+.LASF118:
+	.string	"mapped"
+.LASF126:
+	.string	"rename"
+.LASF71:
+	.string	"st_ino"
+.LASF40:
+	.string	"_IO_write_base"
+.LASF4:
+	.string	"long long int"
+.LASF133:
+	.string	"printf"
+.LASF116:
+	.string	"window"
+.LASF45:
+	.string	"_IO_save_base"
+.LASF16:
+	.string	"__dev_t"
+.LASF88:
+	.string	"context"
+.LASF95:
+	.string	"byteOrder"
+.LASF27:
+	.string	"__syscall_slong_t"
+.LASF134:
+	.string	"memset"
+.LASF101:
+	.string	"step"
+.LASF117:
+	.string	"size"
+.LASF61:
+	.string	"_freeres_buf"
+.LASF76:
+	.string	"__pad0"
+.LASF62:
+	.string	"__pad5"
+.LASF84:
+	.string	"__glibc_reserved"
+.LASF129:
+	.string	"fopen"
+.LASF54:
+	.string	"_vtable_offset"
+.LASF139:
+	.string	"fileStat"
+.LASF14:
+	.string	"__int64_t"
+.LASF85:
+	.string	"long double"
+.LASF18:
+	.string	"__gid_t"
+.LASF148:
+	.string	"channel"
+.LASF38:
+	.string	"_IO_read_end"
+.LASF11:
+	.string	"short int"
+.LASF82:
+	.string	"st_mtim"
+.LASF3:
+	.string	"long int"
+.LASF154:
+	.string	"hash"
+.LASF98:
+	.string	"length"
+.LASF68:
+	.string	"_IO_wide_data"
+.LASF121:
+	.string	"memcmp"
+.LASF92:
+	.string	"uint64_t"
+.LASF127:
+	.string	"fclose"
+.LASF147:
+	.string	"lmsCheckpoint_Row"
+.LASF25:
+	.string	"__blksize_t"
+.LASF17:
+	.string	"__uid_t"
+.LASF10:
+	.string	"__uint8_t"
+.LASF81:
+	.string	"st_atim"
+.LASF162:
+	.string	"lmsCheckpoint_Close"
+.LASF93:
+	.string	"magic"
+.LASF152:
+	.string	"lmsCheckpoint_RowStride"
+.LASF59:
+	.string	"_wide_data"
+.LASF151:
+	.string	"lmsCheckpoint_WindowBytes"
+.LASF56:
+	.string	"_lock"
+.LASF31:
+	.string	"tv_sec"
+.LASF2:
+	.string	"long unsigned int"
+.LASF52:
+	.string	"_old_offset"
+.LASF35:
+	.string	"_IO_FILE"
+.LASF29:
+	.string	"int32_t"
+.LASF106:
+	.string	"payloadBytes"
+.LASF5:
+	.string	"unsigned char"
+.LASF13:
+	.string	"__uint32_t"
+.LASF41:
+	.string	"_IO_write_ptr"
+.LASF89:
+	.string	"LmsAllocator_t"
+.LASF86:
+	.string	"allocate"
+.LASF24:
+	.string	"__time_t"
+.LASF153:
+	.string	"lmsCheckpoint_Checksum"
+.LASF143:
+	.string	"nameLength"
+.LASF78:
+	.string	"st_size"
+.LASF58:
+	.string	"_codecvt"
+.LASF119:
+	.string	"LmsCheckpoint_t"
+.LASF108:
+	.string	"power"
+.LASF128:
+	.string	"fwrite"
+.LASF74:
+	.string	"st_uid"
+.LASF96:
+	.string	"headerSize"
+.LASF22:
+	.string	"__off_t"
+.LASF83:
+	.string	"st_ctim"
+.LASF149:
+	.string	"lmsCheckpoint_Create"
+.LASF70:
+	.string	"st_dev"
+.LASF8:
+	.string	"signed char"
+.LASF6:
+	.string	"short unsigned int"
+.LASF87:
+	.string	"release"
+.LASF132:
+	.string	"memcpy"
+.LASF100:
+	.string	"variant"
+.LASF110:
+	.string	"reserved"
+.LASF112:
+	.string	"double"
+.LASF146:
+	.string	"written"
+.LASF26:
+	.string	"__blkcnt_t"
+.LASF109:
+	.string	"pendingGain"
+.LASF49:
+	.string	"_chain"
+.LASF77:
+	.string	"st_rdev"
+.LASF65:
+	.string	"FILE"
+.LASF137:
+	.string	"fileName"
+.LASF51:
+	.string	"_flags2"
+.LASF53:
+	.string	"_cur_column"
+.LASF105:
+	.string	"position"
+.LASF23:
+	.string	"__off64_t"
+.LASF64:
+	.string	"_unused2"
+.LASF43:
+	.string	"_IO_buf_base"
+.LASF113:
+	.string	"LmsCheckpointHeader_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/lmsCheckpoint.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,7188 @@
+	.file	"lmsEngine.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsEngine.c"
+	.type	lmsEngine_LmsProcessBlock, @function
+lmsEngine_LmsProcessBlock:
+.LFB6:
+	.file 1 "source/lmsEngine.c"
+	.loc 1 50 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	QWORD PTR -40[rbp], r8
+	mov	DWORD PTR -44[rbp], r9d
+	.loc 1 51 12
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rdi, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	lmsFilter_ProcessBlock@PLT
+	.loc 1 52 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	lmsEngine_LmsProcessBlock, .-lmsEngine_LmsProcessBlock
+	.type	lmsEngine_LmsPushSample, @function
+lmsEngine_LmsPushSample:
+.LFB7:
+	.loc 1 55 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 56 5
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_PushSample@PLT
+	.loc 1 57 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	lmsEngine_LmsPushSample, .-lmsEngine_LmsPushSample
+	.type	lmsEngine_LmsNormSquared, @function
+lmsEngine_LmsNormSquared:
+.LFB8:
+	.loc 1 60 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 61 24
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 62 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBB2:
+	.loc 1 64 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 64 5
+	jmp	.L5
+.L6:
+	.loc 1 66 30 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 66 44 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 66 16 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 66 56 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 66 70 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 66 48 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 66 13 discriminator 3
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 64 42 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L5:
+	.loc 1 64 31 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 64 23 discriminator 1
+	cmp	DWORD PTR -12[rbp], eax
+	jl	.L6
+.LBE2:
+	.loc 1 68 12
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movq	rax, xmm0
+	.loc 1 69 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	lmsEngine_LmsNormSquared, .-lmsEngine_LmsNormSquared
+	.type	lmsEngine_LmsClose, @function
+lmsEngine_LmsClose:
+.LFB9:
+	.loc 1 72 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 75 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	lmsEngine_LmsClose, .-lmsEngine_LmsClose
+	.type	lmsEngine_FdafProcessBlock, @function
+lmsEngine_FdafProcessBlock:
+.LFB10:
+	.loc 1 83 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	QWORD PTR -40[rbp], r8
+	mov	DWORD PTR -44[rbp], r9d
+	.loc 1 84 12
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rdi, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	fdafFilter_ProcessBlock@PLT
+	.loc 1 85 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	lmsEngine_FdafProcessBlock, .-lmsEngine_FdafProcessBlock
+	.type	lmsEngine_FdafPushSample, @function
+lmsEngine_FdafPushSample:
+.LFB11:
+	.loc 1 88 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 89 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR -12[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	fdafFilter_PushSample@PLT
+	.loc 1 90 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	lmsEngine_FdafPushSample, .-lmsEngine_FdafPushSample
+	.type	lmsEngine_FdafNormSquared, @function
+lmsEngine_FdafNormSquared:
+.LFB12:
+	.loc 1 93 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 94 22
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 95 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 97 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 168[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	fdafFilter_GetCoefficients@PLT
+.LBB3:
+	.loc 1 98 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 98 5
+	jmp	.L13
+.L14:
+	.loc 1 100 28 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 168[rax]
+	.loc 1 100 42 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 100 16 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 100 52 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 168[rax]
+	.loc 1 100 66 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 100 46 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 100 13 discriminator 3
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 98 47 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L13:
+	.loc 1 98 37 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 98 23 discriminator 1
+	cmp	DWORD PTR -12[rbp], eax
+	jl	.L14
+.LBE3:
+	.loc 1 102 12
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movq	rax, xmm0
+	.loc 1 103 1
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	lmsEngine_FdafNormSquared, .-lmsEngine_FdafNormSquared
+	.type	lmsEngine_FdafClose, @function
+lmsEngine_FdafClose:
+.LFB13:
+	.loc 1 106 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 107 22
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 109 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	fdafFilter_Free@PLT
+	.loc 1 110 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 168[rax]
+	.loc 1 110 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 111 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 112 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	lmsEngine_FdafClose, .-lmsEngine_FdafClose
+	.type	lmsEngine_FixedProcessBlock, @function
+lmsEngine_FixedProcessBlock:
+.LFB14:
+	.loc 1 120 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 112
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	QWORD PTR -88[rbp], rdx
+	mov	QWORD PTR -96[rbp], rcx
+	mov	QWORD PTR -104[rbp], r8
+	mov	DWORD PTR -108[rbp], r9d
+	.loc 1 121 23
+	mov	rax, QWORD PTR -72[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 122 14
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 123 14
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 8192
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 124 14
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 16384
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 125 14
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24576
+	mov	QWORD PTR -48[rbp], rax
+.LBB4:
+	.loc 1 127 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 127 5
+	jmp	.L18
+.L24:
+.LBB5:
+	.loc 1 129 37
+	mov	eax, DWORD PTR -108[rbp]
+	sub	eax, DWORD PTR -4[rbp]
+	.loc 1 129 19
+	mov	edx, 4096
+	cmp	eax, edx
+	cmovg	eax, edx
+	mov	DWORD PTR -52[rbp], eax
+	.loc 1 131 46
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 131 9
+	mov	rax, QWORD PTR -80[rbp]
+	lea	rcx, [rdx+rax]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFixed_FromFloat@PLT
+	.loc 1 132 12
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L19
+	.loc 1 134 54
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 134 13
+	mov	rax, QWORD PTR -88[rbp]
+	lea	rcx, [rdx+rax]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFixed_FromFloat@PLT
+.L19:
+	.loc 1 136 9
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L20
+	.loc 1 136 9 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	jmp	.L21
+.L20:
+	.loc 1 136 9 discriminator 2
+	mov	eax, 0
+.L21:
+	.loc 1 136 9 discriminator 4
+	mov	rdi, QWORD PTR -16[rbp]
+	mov	r8d, DWORD PTR -52[rbp]
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rsi, QWORD PTR -24[rbp]
+	mov	r9d, r8d
+	mov	r8, rcx
+	mov	rcx, rdx
+	mov	rdx, rax
+	call	lmsFixed_ProcessBlock@PLT
+	.loc 1 138 12 is_stmt 1 discriminator 4
+	cmp	QWORD PTR -96[rbp], 0
+	je	.L22
+	.loc 1 140 37
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 140 13
+	mov	rax, QWORD PTR -96[rbp]
+	lea	rcx, [rdx+rax]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	lmsFixed_ToFloat@PLT
+.L22:
+	.loc 1 142 12
+	cmp	QWORD PTR -104[rbp], 0
+	je	.L23
+	.loc 1 144 36
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 144 13
+	mov	rax, QWORD PTR -104[rbp]
+	lea	rcx, [rdx+rax]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	lmsFixed_ToFloat@PLT
+.L23:
+.LBE5:
+	.loc 1 127 41 discriminator 2
+	add	DWORD PTR -4[rbp], 4096
+.L18:
+	.loc 1 127 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -108[rbp]
+	jl	.L24
+.LBE4:
+	.loc 1 148 12
+	mov	eax, 0
+	.loc 1 149 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	lmsEngine_FixedProcessBlock, .-lmsEngine_FixedProcessBlock
+	.type	lmsEngine_FixedPushSample, @function
+lmsEngine_FixedPushSample:
+.LFB15:
+	.loc 1 152 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	movss	DWORD PTR -28[rbp], xmm0
+	.loc 1 155 5
+	lea	rcx, -28[rbp]
+	lea	rax, -2[rbp]
+	mov	edx, 1
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFixed_FromFloat@PLT
+	.loc 1 156 5
+	movzx	eax, WORD PTR -2[rbp]
+	movsx	edx, ax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsFixed_PushSample@PLT
+	.loc 1 157 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	lmsEngine_FixedPushSample, .-lmsEngine_FixedPushSample
+	.type	lmsEngine_FixedNormSquared, @function
+lmsEngine_FixedNormSquared:
+.LFB16:
+	.loc 1 160 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 161 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 162 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBB6:
+	.loc 1 164 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 164 5
+	jmp	.L28
+.L29:
+	.loc 1 166 30 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 166 44 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	add	rdx, rdx
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	.loc 1 166 16 discriminator 3
+	cwde
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, eax
+	.loc 1 166 56 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 166 70 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	add	rdx, rdx
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	.loc 1 166 48 discriminator 3
+	cwde
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, eax
+	mulsd	xmm0, xmm1
+	.loc 1 166 13 discriminator 3
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 164 42 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L28:
+	.loc 1 164 31 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 164 23 discriminator 1
+	cmp	DWORD PTR -12[rbp], eax
+	jl	.L29
+.LBE6:
+	.loc 1 168 16
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movsd	xmm1, QWORD PTR .LC1[rip]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	.loc 1 169 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	lmsEngine_FixedNormSquared, .-lmsEngine_FixedNormSquared
+	.type	lmsEngine_FixedClose, @function
+lmsEngine_FixedClose:
+.LFB17:
+	.loc 1 172 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 173 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 175 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	lmsFixed_Free@PLT
+	.loc 1 176 15
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 176 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 177 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 178 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	lmsEngine_FixedClose, .-lmsEngine_FixedClose
+	.type	lmsEngine_SubbandProcessBlock, @function
+lmsEngine_SubbandProcessBlock:
+.LFB18:
+	.loc 1 186 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	QWORD PTR -40[rbp], r8
+	mov	DWORD PTR -44[rbp], r9d
+	.loc 1 187 12
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rdi, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	subbandFilter_ProcessBlock@PLT
+	.loc 1 189 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	lmsEngine_SubbandProcessBlock, .-lmsEngine_SubbandProcessBlock
+	.type	lmsEngine_SubbandPushSample, @function
+lmsEngine_SubbandPushSample:
+.LFB19:
+	.loc 1 192 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 193 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR -12[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	subbandFilter_PushSample@PLT
+	.loc 1 194 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	lmsEngine_SubbandPushSample, .-lmsEngine_SubbandPushSample
+	.type	lmsEngine_SubbandNormSquared, @function
+lmsEngine_SubbandNormSquared:
+.LFB20:
+	.loc 1 197 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 198 12
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	subbandFilter_NormSquared@PLT
+	movq	rax, xmm0
+	.loc 1 199 1
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	lmsEngine_SubbandNormSquared, .-lmsEngine_SubbandNormSquared
+	.type	lmsEngine_SubbandClose, @function
+lmsEngine_SubbandClose:
+.LFB21:
+	.loc 1 202 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 203 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 205 16
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 288[rax]
+	.loc 1 205 8
+	test	rax, rax
+	je	.L38
+	.loc 1 207 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 288[rax]
+	mov	rdi, rax
+	call	threadPool_Destroy@PLT
+	.loc 1 208 21
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 288[rax]
+	.loc 1 208 9
+	mov	rdi, rax
+	call	free@PLT
+.L38:
+	.loc 1 210 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	subbandFilter_Free@PLT
+	.loc 1 211 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 212 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	lmsEngine_SubbandClose, .-lmsEngine_SubbandClose
+	.type	lmsEngine_RlsProcessBlock, @function
+lmsEngine_RlsProcessBlock:
+.LFB22:
+	.loc 1 220 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	QWORD PTR -40[rbp], r8
+	mov	DWORD PTR -44[rbp], r9d
+	.loc 1 221 12
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rdi, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	rlsFilter_ProcessBlock@PLT
+	.loc 1 222 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	lmsEngine_RlsProcessBlock, .-lmsEngine_RlsProcessBlock
+	.type	lmsEngine_RlsPushSample, @function
+lmsEngine_RlsPushSample:
+.LFB23:
+	.loc 1 225 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 226 5
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	rlsFilter_PushSample@PLT
+	.loc 1 227 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	lmsEngine_RlsPushSample, .-lmsEngine_RlsPushSample
+	.type	lmsEngine_RlsNormSquared, @function
+lmsEngine_RlsNormSquared:
+.LFB24:
+	.loc 1 230 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 231 12
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	rlsFilter_NormSquared@PLT
+	movq	rax, xmm0
+	.loc 1 232 1
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	lmsEngine_RlsNormSquared, .-lmsEngine_RlsNormSquared
+	.type	lmsEngine_RlsClose, @function
+lmsEngine_RlsClose:
+.LFB25:
+	.loc 1 235 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 236 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	rlsFilter_Free@PLT
+	.loc 1 237 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 238 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	lmsEngine_RlsClose, .-lmsEngine_RlsClose
+	.type	lmsEngine_ApaProcessBlock, @function
+lmsEngine_ApaProcessBlock:
+.LFB26:
+	.loc 1 246 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	QWORD PTR -40[rbp], r8
+	mov	DWORD PTR -44[rbp], r9d
+	.loc 1 247 12
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rdi, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	apaFilter_ProcessBlock@PLT
+	.loc 1 248 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	lmsEngine_ApaProcessBlock, .-lmsEngine_ApaProcessBlock
+	.type	lmsEngine_ApaPushSample, @function
+lmsEngine_ApaPushSample:
+.LFB27:
+	.loc 1 251 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 252 5
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	apaFilter_PushSample@PLT
+	.loc 1 253 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	lmsEngine_ApaPushSample, .-lmsEngine_ApaPushSample
+	.type	lmsEngine_ApaNormSquared, @function
+lmsEngine_ApaNormSquared:
+.LFB28:
+	.loc 1 256 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 257 12
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	apaFilter_NormSquared@PLT
+	movq	rax, xmm0
+	.loc 1 258 1
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	lmsEngine_ApaNormSquared, .-lmsEngine_ApaNormSquared
+	.type	lmsEngine_ApaClose, @function
+lmsEngine_ApaClose:
+.LFB29:
+	.loc 1 261 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 262 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	apaFilter_Free@PLT
+	.loc 1 263 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 264 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	lmsEngine_ApaClose, .-lmsEngine_ApaClose
+	.section	.rodata
+.LC2:
+	.string	"lms"
+.LC3:
+	.string	"fdaf"
+.LC4:
+	.string	"q15"
+.LC5:
+	.string	"subband"
+.LC6:
+	.string	"rls"
+.LC7:
+	.string	"apa"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	lmsEngineOps, @object
+	.size	lmsEngineOps, 280
+lmsEngineOps:
+	.zero	40
+	.quad	.LC2
+	.quad	lmsEngine_LmsProcessBlock
+	.quad	lmsEngine_LmsPushSample
+	.quad	lmsEngine_LmsNormSquared
+	.quad	lmsEngine_LmsClose
+	.quad	.LC3
+	.quad	lmsEngine_FdafProcessBlock
+	.quad	lmsEngine_FdafPushSample
+	.quad	lmsEngine_FdafNormSquared
+	.quad	lmsEngine_FdafClose
+	.quad	.LC4
+	.quad	lmsEngine_FixedProcessBlock
+	.quad	lmsEngine_FixedPushSample
+	.quad	lmsEngine_FixedNormSquared
+	.quad	lmsEngine_FixedClose
+	.quad	.LC5
+	.quad	lmsEngine_SubbandProcessBlock
+	.quad	lmsEngine_SubbandPushSample
+	.quad	lmsEngine_SubbandNormSquared
+	.quad	lmsEngine_SubbandClose
+	.quad	.LC6
+	.quad	lmsEngine_RlsProcessBlock
+	.quad	lmsEngine_RlsPushSample
+	.quad	lmsEngine_RlsNormSquared
+	.quad	lmsEngine_RlsClose
+	.quad	.LC7
+	.quad	lmsEngine_ApaProcessBlock
+	.quad	lmsEngine_ApaPushSample
+	.quad	lmsEngine_ApaNormSquared
+	.quad	lmsEngine_ApaClose
+	.section	.rodata
+.LC8:
+	.string	"Error allocating FDAF engine"
+	.text
+	.type	lmsEngine_OpenFdaf, @function
+lmsEngine_OpenFdaf:
+.LFB30:
+	.loc 1 301 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 302 47
+	mov	esi, 176
+	mov	edi, 1
+	call	calloc@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 304 8
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L52
+	.loc 1 306 9
+	lea	rax, .LC8[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 307 16
+	mov	eax, 0
+	jmp	.L53
+.L52:
+	.loc 1 309 64
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 8[rax]
+	.loc 1 309 48
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 309 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	esi, ecx
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	fdafFilter_Init@PLT
+	.loc 1 309 8
+	test	eax, eax
+	je	.L54
+	.loc 1 311 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 312 16
+	mov	eax, 0
+	jmp	.L53
+.L54:
+	.loc 1 314 49
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	cdqe
+	.loc 1 314 34
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 314 24
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 168[rax], rdx
+	.loc 1 315 13
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 168[rax]
+	.loc 1 315 8
+	test	rax, rax
+	jne	.L55
+	.loc 1 317 9
+	lea	rax, .LC8[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 318 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	lmsEngine_FdafClose
+	.loc 1 319 16
+	mov	eax, 0
+	jmp	.L53
+.L55:
+	.loc 1 321 12
+	mov	rax, QWORD PTR -8[rbp]
+.L53:
+	.loc 1 322 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	lmsEngine_OpenFdaf, .-lmsEngine_OpenFdaf
+	.section	.rodata
+.LC9:
+	.string	"Error allocating Q15 engine"
+	.text
+	.type	lmsEngine_OpenFixed, @function
+lmsEngine_OpenFixed:
+.LFB31:
+	.loc 1 329 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 40
+	.cfi_offset 3, -24
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 330 50
+	mov	esi, 56
+	mov	edi, 1
+	call	calloc@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 332 8
+	cmp	QWORD PTR -24[rbp], 0
+	jne	.L57
+	.loc 1 334 9
+	lea	rax, .LC9[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 335 16
+	mov	eax, 0
+	jmp	.L58
+.L57:
+	.loc 1 337 83
+	mov	rax, QWORD PTR -40[rbp]
+	mov	ebx, DWORD PTR 8[rax]
+	.loc 1 337 66
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 337 9
+	movd	xmm0, eax
+	call	lmsFixed_StepShift@PLT
+	mov	ecx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, ebx
+	mov	esi, ecx
+	mov	rdi, rax
+	call	lmsFixed_Init@PLT
+	.loc 1 337 8
+	test	eax, eax
+	je	.L59
+	.loc 1 339 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 340 16
+	mov	eax, 0
+	jmp	.L58
+.L59:
+	.loc 1 342 32
+	mov	edi, 32768
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 342 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 343 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 343 8
+	test	rax, rax
+	jne	.L60
+	.loc 1 345 9
+	lea	rax, .LC9[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 346 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsEngine_FixedClose
+	.loc 1 347 16
+	mov	eax, 0
+	jmp	.L58
+.L60:
+	.loc 1 349 12
+	mov	rax, QWORD PTR -24[rbp]
+.L58:
+	.loc 1 350 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	lmsEngine_OpenFixed, .-lmsEngine_OpenFixed
+	.section	.rodata
+	.align 8
+.LC10:
+	.string	"Error allocating subband engine"
+	.text
+	.type	lmsEngine_OpenSubband, @function
+lmsEngine_OpenSubband:
+.LFB32:
+	.loc 1 357 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 358 56
+	mov	esi, 296
+	mov	edi, 1
+	call	calloc@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 359 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 361 8
+	cmp	QWORD PTR -16[rbp], 0
+	jne	.L62
+	.loc 1 363 9
+	lea	rax, .LC10[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 364 16
+	mov	eax, 0
+	jmp	.L63
+.L62:
+	.loc 1 366 88
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 12[rax]
+	.loc 1 366 70
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 8[rax]
+	.loc 1 366 54
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 366 9
+	mov	rax, QWORD PTR -16[rbp]
+	movd	xmm0, ecx
+	mov	rdi, rax
+	call	subbandFilter_Init@PLT
+	.loc 1 366 8
+	test	eax, eax
+	je	.L64
+	.loc 1 368 9
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 369 16
+	mov	eax, 0
+	jmp	.L63
+.L64:
+	.loc 1 373 8
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L65
+	.loc 1 375 24
+	call	threadPool_NumberOfCpus@PLT
+	mov	DWORD PTR -4[rbp], eax
+.L65:
+	.loc 1 377 39
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 377 8
+	cmp	DWORD PTR -4[rbp], eax
+	jle	.L66
+	.loc 1 379 22
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	mov	DWORD PTR -4[rbp], eax
+.L66:
+	.loc 1 381 8
+	cmp	DWORD PTR -4[rbp], 1
+	jle	.L67
+	.loc 1 383 40
+	mov	edi, 176
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 383 23
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 288[rax], rdx
+	.loc 1 384 21
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 288[rax]
+	.loc 1 384 12
+	test	rax, rax
+	je	.L68
+	.loc 1 384 41 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 288[rax]
+	mov	edx, DWORD PTR -4[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	threadPool_Init@PLT
+	.loc 1 384 37 discriminator 1
+	test	eax, eax
+	je	.L69
+.L68:
+	.loc 1 386 25
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 288[rax]
+	.loc 1 386 13
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 387 27
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 288[rax], 0
+	.loc 1 388 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	lmsEngine_SubbandClose
+	.loc 1 389 20
+	mov	eax, 0
+	jmp	.L63
+.L69:
+	.loc 1 391 9
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR 288[rax]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	subbandFilter_SetThreadPool@PLT
+.L67:
+	.loc 1 393 12
+	mov	rax, QWORD PTR -16[rbp]
+.L63:
+	.loc 1 394 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	lmsEngine_OpenSubband, .-lmsEngine_OpenSubband
+	.section	.rodata
+.LC11:
+	.string	"Error allocating RLS engine"
+	.text
+	.type	lmsEngine_OpenRls, @function
+lmsEngine_OpenRls:
+.LFB33:
+	.loc 1 401 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 402 38
+	mov	edi, 120
+	call	malloc@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 404 8
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L71
+	.loc 1 406 9
+	lea	rax, .LC11[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 407 16
+	mov	eax, 0
+	jmp	.L72
+.L71:
+	.loc 1 409 67
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 8[rax]
+	.loc 1 409 51
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 4[rax]
+	.loc 1 409 35
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 409 9
+	movsd	xmm0, QWORD PTR .LC12[rip]
+	subsd	xmm0, xmm1
+	movq	rcx, xmm0
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, 0
+	movq	xmm0, rcx
+	mov	rdi, rax
+	call	rlsFilter_Init@PLT
+	.loc 1 409 8
+	test	eax, eax
+	je	.L73
+	.loc 1 411 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 412 16
+	mov	eax, 0
+	jmp	.L72
+.L73:
+	.loc 1 414 12
+	mov	rax, QWORD PTR -8[rbp]
+.L72:
+	.loc 1 415 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	lmsEngine_OpenRls, .-lmsEngine_OpenRls
+	.section	.rodata
+.LC13:
+	.string	"Error allocating APA engine"
+	.text
+	.type	lmsEngine_OpenApa, @function
+lmsEngine_OpenApa:
+.LFB34:
+	.loc 1 422 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 423 38
+	mov	edi, 104
+	call	malloc@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 425 8
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L75
+	.loc 1 427 9
+	lea	rax, .LC13[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 428 16
+	mov	eax, 0
+	jmp	.L76
+.L75:
+	.loc 1 430 71
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 16[rax]
+	.loc 1 430 53
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 8[rax]
+	.loc 1 430 37
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 430 9
+	mov	rax, QWORD PTR -8[rbp]
+	movd	xmm0, ecx
+	mov	rdi, rax
+	call	apaFilter_Init@PLT
+	.loc 1 430 8
+	test	eax, eax
+	je	.L77
+	.loc 1 432 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 433 16
+	mov	eax, 0
+	jmp	.L76
+.L77:
+	.loc 1 435 12
+	mov	rax, QWORD PTR -8[rbp]
+.L76:
+	.loc 1 436 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	lmsEngine_OpenApa, .-lmsEngine_OpenApa
+	.section	.rodata
+	.align 8
+.LC14:
+	.string	"Error: Unknown filter algorithm %d\n"
+	.text
+	.globl	lmsEngine_Open
+	.type	lmsEngine_Open, @function
+lmsEngine_Open:
+.LFB35:
+	.loc 1 439 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 440 11
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 442 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR [rax], 0
+	.loc 1 443 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 8[rax], 0
+	.loc 1 444 21
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 444 5
+	cmp	eax, 6
+	ja	.L79
+	mov	eax, eax
+	lea	rdx, 0[0+rax*4]
+	lea	rax, .L81[rip]
+	mov	eax, DWORD PTR [rdx+rax]
+	cdqe
+	lea	rdx, .L81[rip]
+	add	rax, rdx
+	jmp	rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L81:
+	.long	.L79-.L81
+	.long	.L86-.L81
+	.long	.L85-.L81
+	.long	.L84-.L81
+	.long	.L83-.L81
+	.long	.L82-.L81
+	.long	.L80-.L81
+	.text
+.L86:
+	.loc 1 447 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 448 13
+	jmp	.L87
+.L85:
+	.loc 1 450 21
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	lmsEngine_OpenFdaf
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 451 13
+	jmp	.L87
+.L84:
+	.loc 1 453 21
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	lmsEngine_OpenFixed
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 454 13
+	jmp	.L87
+.L83:
+	.loc 1 456 21
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	lmsEngine_OpenSubband
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 457 13
+	jmp	.L87
+.L82:
+	.loc 1 459 21
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	lmsEngine_OpenRls
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 460 13
+	jmp	.L87
+.L80:
+	.loc 1 462 21
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	lmsEngine_OpenApa
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 463 13
+	jmp	.L87
+.L79:
+	.loc 1 465 73
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 465 13
+	mov	esi, eax
+	lea	rax, .LC14[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 466 13
+	nop
+.L87:
+	.loc 1 468 8
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L88
+	.loc 1 470 16
+	mov	eax, 1
+	jmp	.L89
+.L88:
+	.loc 1 472 41
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 472 19
+	mov	edx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, lmsEngineOps[rip]
+	add	rdx, rax
+	.loc 1 472 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 473 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 474 12
+	mov	eax, 0
+.L89:
+	.loc 1 475 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	lmsEngine_Open, .-lmsEngine_Open
+	.globl	lmsEngine_Close
+	.type	lmsEngine_Close, @function
+lmsEngine_Close:
+.LFB36:
+	.loc 1 478 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 479 15
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 479 8
+	test	rax, rax
+	je	.L91
+	.loc 1 481 15
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 481 20
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 481 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdi, rax
+	call	rdx
+.LVL0:
+.L91:
+	.loc 1 483 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR [rax], 0
+	.loc 1 484 19
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 8[rax], 0
+	.loc 1 485 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	lmsEngine_Close, .-lmsEngine_Close
+	.globl	lmsEngine_ProcessBlock
+	.type	lmsEngine_ProcessBlock, @function
+lmsEngine_ProcessBlock:
+.LFB37:
+	.loc 1 489 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	QWORD PTR -40[rbp], r8
+	mov	DWORD PTR -44[rbp], r9d
+	.loc 1 490 18
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 490 23
+	mov	r10, QWORD PTR 8[rax]
+	.loc 1 490 44
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 490 12
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rdi, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	r10
+.LVL1:
+	.loc 1 491 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	lmsEngine_ProcessBlock, .-lmsEngine_ProcessBlock
+	.globl	lmsEngine_PushSample
+	.type	lmsEngine_PushSample, @function
+lmsEngine_PushSample:
+.LFB38:
+	.loc 1 494 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 495 11
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 495 16
+	mov	rcx, QWORD PTR 16[rax]
+	.loc 1 495 35
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 495 5
+	mov	edx, DWORD PTR -12[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	rcx
+.LVL2:
+	.loc 1 496 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	lmsEngine_PushSample, .-lmsEngine_PushSample
+	.globl	lmsEngine_NormSquared
+	.type	lmsEngine_NormSquared, @function
+lmsEngine_NormSquared:
+.LFB39:
+	.loc 1 499 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 500 18
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 500 23
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 500 43
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 500 12
+	mov	rdi, rax
+	call	rdx
+.LVL3:
+	movq	rax, xmm0
+	.loc 1 501 1
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	lmsEngine_NormSquared, .-lmsEngine_NormSquared
+	.globl	lmsEngine_Name
+	.type	lmsEngine_Name, @function
+lmsEngine_Name:
+.LFB40:
+	.loc 1 504 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 505 18
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 505 23
+	mov	rax, QWORD PTR [rax]
+	.loc 1 506 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE40:
+	.size	lmsEngine_Name, .-lmsEngine_Name
+	.section	.rodata
+	.align 8
+.LC1:
+	.long	0
+	.long	1104150528
+	.align 8
+.LC12:
+	.long	0
+	.long	1072693248
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 9 "include/lmsAllocator.h"
+	.file 10 "include/lmsKernel.h"
+	.file 11 "include/lmsFilter.h"
+	.file 12 "include/lmsEngine.h"
+	.file 13 "include/fft.h"
+	.file 14 "include/fdafFilter.h"
+	.file 15 "include/lmsFixed.h"
+	.file 16 "include/threadPool.h"
+	.file 17 "include/subbandFilter.h"
+	.file 18 "include/rlsFilter.h"
+	.file 19 "include/apaFilter.h"
+	.file 20 "/usr/include/stdio.h"
+	.file 21 "/usr/include/stdlib.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1f4e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF304
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x41
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x27
+	.byte	0x1a
+	.long	0x83
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x4d
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0xa
+	.long	0x98
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x19
+	.byte	0x13
+	.long	0x77
+	.uleb128 0xa
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x13
+	.long	0x8a
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x3
+	.long	0xe5
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0x69
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x12
+	.long	0x69
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x5
+	.byte	0x19
+	.long	0x106
+	.uleb128 0x10
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x28
+	.long	0x106
+	.uleb128 0x10
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x20
+	.byte	0x5
+	.long	0xc1
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF20
+	.uleb128 0x5
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x21
+	.byte	0x3
+	.long	0xe5
+	.uleb128 0x19
+	.long	.LASF25
+	.byte	0x10
+	.byte	0x6
+	.byte	0x33
+	.byte	0x10
+	.long	0x141
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x35
+	.byte	0x23
+	.long	0x141
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x36
+	.byte	0x23
+	.long	0x141
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x119
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x6
+	.byte	0x37
+	.byte	0x3
+	.long	0x119
+	.uleb128 0x19
+	.long	.LASF26
+	.byte	0x28
+	.byte	0x7
+	.byte	0x16
+	.byte	0x8
+	.long	0x1c8
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x18
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x19
+	.byte	0x10
+	.long	0x69
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x7
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0x69
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x7
+	.byte	0x20
+	.byte	0x7
+	.long	0x41
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x7
+	.byte	0x22
+	.byte	0x9
+	.long	0x83
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x23
+	.byte	0x9
+	.long	0x83
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x24
+	.byte	0x14
+	.long	0x146
+	.byte	0x18
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF35
+	.byte	0x30
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x8
+	.long	0x231
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x6
+	.byte	0x60
+	.byte	0x19
+	.long	0x10d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x6
+	.byte	0x61
+	.byte	0x19
+	.long	0x10d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x6
+	.byte	0x62
+	.byte	0x10
+	.long	0x231
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x63
+	.byte	0x10
+	.long	0x231
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x64
+	.byte	0x10
+	.long	0x69
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x65
+	.byte	0x10
+	.long	0x69
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x66
+	.byte	0x10
+	.long	0x231
+	.byte	0x28
+	.byte	0
+	.uleb128 0x1a
+	.long	0x69
+	.long	0x241
+	.uleb128 0x1b
+	.long	0x3a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x1d
+	.byte	0x28
+	.byte	0x8
+	.byte	0x43
+	.long	0x27a
+	.uleb128 0x10
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x45
+	.byte	0x1c
+	.long	0x152
+	.uleb128 0x10
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x46
+	.byte	0x8
+	.long	0x27a
+	.uleb128 0x10
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x47
+	.byte	0xc
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1a
+	.long	0x98
+	.long	0x28a
+	.uleb128 0x1b
+	.long	0x3a
+	.byte	0x27
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x48
+	.byte	0x3
+	.long	0x24d
+	.uleb128 0x1d
+	.byte	0x30
+	.byte	0x8
+	.byte	0x4b
+	.long	0x2c3
+	.uleb128 0x10
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x1c8
+	.uleb128 0x10
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x8
+	.long	0x2c3
+	.uleb128 0x10
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x54
+	.byte	0
+	.uleb128 0x1a
+	.long	0x98
+	.long	0x2d3
+	.uleb128 0x1b
+	.long	0x3a
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x50
+	.byte	0x3
+	.long	0x296
+	.uleb128 0x4
+	.long	0x9f
+	.uleb128 0xc
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF49
+	.uleb128 0x8
+	.byte	0x18
+	.byte	0x9
+	.byte	0x10
+	.byte	0x9
+	.long	0x31c
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x13
+	.byte	0xd
+	.long	0x335
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x16
+	.byte	0xc
+	.long	0x34a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x18
+	.byte	0xb
+	.long	0x96
+	.byte	0x10
+	.byte	0
+	.uleb128 0x11
+	.long	0x96
+	.long	0x335
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	0x31c
+	.uleb128 0x14
+	.long	0x34a
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x96
+	.byte	0
+	.uleb128 0x4
+	.long	0x33a
+	.uleb128 0x5
+	.long	.LASF53
+	.byte	0x9
+	.byte	0x19
+	.byte	0x3
+	.long	0x2eb
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF54
+	.uleb128 0xa
+	.long	0x35b
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF55
+	.uleb128 0x4
+	.long	0x35b
+	.uleb128 0x1c
+	.long	0x69
+	.byte	0xa
+	.byte	0xf
+	.long	0x39d
+	.uleb128 0x6
+	.long	.LASF56
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF57
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF59
+	.byte	0x3
+	.uleb128 0x6
+	.long	.LASF60
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xa
+	.byte	0x15
+	.byte	0x3
+	.long	0x373
+	.uleb128 0x8
+	.byte	0x40
+	.byte	0xa
+	.byte	0x17
+	.byte	0x9
+	.long	0x41b
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x19
+	.byte	0x15
+	.long	0x39d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x11
+	.long	0x2df
+	.byte	0x8
+	.uleb128 0x15
+	.string	"dot"
+	.byte	0xa
+	.byte	0x1d
+	.byte	0xd
+	.long	0x439
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0xa
+	.byte	0x20
+	.byte	0xc
+	.long	0x458
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0xa
+	.byte	0x23
+	.byte	0xd
+	.long	0x480
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0xa
+	.byte	0x27
+	.byte	0xd
+	.long	0x4ad
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xd
+	.long	0x480
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0xa
+	.byte	0x30
+	.byte	0xc
+	.long	0x4db
+	.byte	0x38
+	.byte	0
+	.uleb128 0x11
+	.long	0x35b
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x362
+	.uleb128 0x4
+	.long	0x41b
+	.uleb128 0x14
+	.long	0x458
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x35b
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x43e
+	.uleb128 0x11
+	.long	0x35b
+	.long	0x480
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x35b
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x45d
+	.uleb128 0x11
+	.long	0x35b
+	.long	0x4ad
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x35b
+	.uleb128 0x2
+	.long	0x35b
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x485
+	.uleb128 0x14
+	.long	0x4db
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x4b2
+	.uleb128 0x5
+	.long	.LASF69
+	.byte	0xa
+	.byte	0x32
+	.byte	0x3
+	.long	0x3a9
+	.uleb128 0xa
+	.long	0x4e0
+	.uleb128 0x14
+	.long	0x4fc
+	.uleb128 0x2
+	.long	0x96
+	.byte	0
+	.uleb128 0x4
+	.long	0x4f1
+	.uleb128 0x4
+	.long	0x367
+	.uleb128 0x1c
+	.long	0x69
+	.byte	0xb
+	.byte	0x19
+	.long	0x53c
+	.uleb128 0x6
+	.long	.LASF70
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF71
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF72
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF73
+	.byte	0x3
+	.uleb128 0x6
+	.long	.LASF74
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF76
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF77
+	.byte	0xb
+	.byte	0x21
+	.byte	0x3
+	.long	0x506
+	.uleb128 0x5
+	.long	.LASF78
+	.byte	0xb
+	.byte	0x23
+	.byte	0x1a
+	.long	0x559
+	.uleb128 0xa
+	.long	0x548
+	.uleb128 0x19
+	.long	.LASF79
+	.byte	0x70
+	.byte	0xb
+	.byte	0x29
+	.byte	0x8
+	.long	0x62a
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xb
+	.long	0x35b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xb
+	.byte	0x2d
+	.byte	0xc
+	.long	0x36e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xb
+	.byte	0x2e
+	.byte	0xc
+	.long	0x36e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0xb
+	.byte	0x30
+	.byte	0xb
+	.long	0x35b
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0xb
+	.byte	0x31
+	.byte	0x9
+	.long	0x41
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0xb
+	.byte	0x32
+	.byte	0xc
+	.long	0x367
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0xb
+	.byte	0x33
+	.byte	0x18
+	.long	0x53c
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0xb
+	.byte	0x34
+	.byte	0xb
+	.long	0x35b
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0xb
+	.byte	0x35
+	.byte	0xb
+	.long	0x35b
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0xb
+	.byte	0x36
+	.byte	0x1d
+	.long	0x62a
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0xb
+	.byte	0x37
+	.byte	0x18
+	.long	0x668
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0xb
+	.byte	0x38
+	.byte	0x14
+	.long	0x34f
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xb
+	.byte	0x39
+	.byte	0xb
+	.long	0x96
+	.byte	0x68
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF95
+	.byte	0xb
+	.byte	0x26
+	.byte	0xf
+	.long	0x636
+	.uleb128 0x4
+	.long	0x63b
+	.uleb128 0x11
+	.long	0x41
+	.long	0x663
+	.uleb128 0x2
+	.long	0x663
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x548
+	.uleb128 0x4
+	.long	0x4ec
+	.uleb128 0x1c
+	.long	0x69
+	.byte	0xb
+	.byte	0x3d
+	.long	0x6a3
+	.uleb128 0x6
+	.long	.LASF96
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF97
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF98
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF99
+	.byte	0x3
+	.uleb128 0x6
+	.long	.LASF100
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF102
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0xb
+	.byte	0x45
+	.byte	0x3
+	.long	0x66d
+	.uleb128 0x8
+	.byte	0x28
+	.byte	0xc
+	.byte	0x10
+	.byte	0x9
+	.long	0x6fa
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xc
+	.byte	0x12
+	.byte	0x11
+	.long	0x2df
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0xc
+	.byte	0x15
+	.byte	0xb
+	.long	0x722
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0xc
+	.byte	0x19
+	.byte	0xc
+	.long	0x737
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0xc
+	.byte	0x1c
+	.byte	0xe
+	.long	0x74b
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0xc
+	.byte	0x1f
+	.byte	0xc
+	.long	0x4fc
+	.byte	0x20
+	.byte	0
+	.uleb128 0x11
+	.long	0x41
+	.long	0x722
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x6fa
+	.uleb128 0x14
+	.long	0x737
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x35b
+	.byte	0
+	.uleb128 0x4
+	.long	0x727
+	.uleb128 0x11
+	.long	0x367
+	.long	0x74b
+	.uleb128 0x2
+	.long	0x96
+	.byte	0
+	.uleb128 0x4
+	.long	0x73c
+	.uleb128 0x5
+	.long	.LASF107
+	.byte	0xc
+	.byte	0x20
+	.byte	0x3
+	.long	0x6af
+	.uleb128 0xa
+	.long	0x750
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0xc
+	.byte	0x22
+	.byte	0x9
+	.long	0x785
+	.uleb128 0x15
+	.string	"ops"
+	.byte	0xc
+	.byte	0x24
+	.byte	0x1b
+	.long	0x785
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0xc
+	.byte	0x25
+	.byte	0xb
+	.long	0x96
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x75c
+	.uleb128 0x5
+	.long	.LASF109
+	.byte	0xc
+	.byte	0x26
+	.byte	0x3
+	.long	0x761
+	.uleb128 0xa
+	.long	0x78a
+	.uleb128 0x8
+	.byte	0x18
+	.byte	0xc
+	.byte	0x28
+	.byte	0x9
+	.long	0x7f3
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x1a
+	.long	0x6a3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xb
+	.long	0x35b
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xc
+	.byte	0x2c
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0xc
+	.byte	0x2d
+	.byte	0x9
+	.long	0x41
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0xc
+	.byte	0x2e
+	.byte	0x9
+	.long	0x41
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x9
+	.long	0x41
+	.byte	0x14
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF114
+	.byte	0xc
+	.byte	0x30
+	.byte	0x3
+	.long	0x79b
+	.uleb128 0xa
+	.long	0x7f3
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0xd
+	.byte	0xc
+	.byte	0x9
+	.long	0x85c
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0xd
+	.byte	0xe
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0xd
+	.byte	0xf
+	.byte	0xc
+	.long	0x36e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0xd
+	.byte	0x10
+	.byte	0xc
+	.long	0x36e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0xd
+	.byte	0x11
+	.byte	0xa
+	.long	0x85c
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0xd
+	.byte	0x12
+	.byte	0xc
+	.long	0x36e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xd
+	.byte	0x13
+	.byte	0xb
+	.long	0x96
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	0x41
+	.uleb128 0x5
+	.long	.LASF120
+	.byte	0xd
+	.byte	0x14
+	.byte	0x3
+	.long	0x804
+	.uleb128 0x8
+	.byte	0xa8
+	.byte	0xe
+	.byte	0x12
+	.byte	0x9
+	.long	0x96e
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xe
+	.byte	0x14
+	.byte	0xb
+	.long	0x35b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xe
+	.byte	0x15
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0xe
+	.byte	0x16
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0xe
+	.byte	0x17
+	.byte	0x9
+	.long	0x41
+	.byte	0xc
+	.uleb128 0x15
+	.string	"fft"
+	.byte	0xe
+	.byte	0x18
+	.byte	0xb
+	.long	0x861
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0xe
+	.byte	0x19
+	.byte	0xc
+	.long	0x36e
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF124
+	.byte	0xe
+	.byte	0x1a
+	.byte	0xc
+	.long	0x36e
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0xe
+	.byte	0x1b
+	.byte	0x9
+	.long	0x41
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0xe
+	.byte	0x1c
+	.byte	0xc
+	.long	0x36e
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0xe
+	.byte	0x1d
+	.byte	0xc
+	.long	0x36e
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0xe
+	.byte	0x1e
+	.byte	0xc
+	.long	0x36e
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xc
+	.long	0x36e
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0xe
+	.byte	0x20
+	.byte	0xc
+	.long	0x36e
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0xe
+	.byte	0x21
+	.byte	0xc
+	.long	0x36e
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xe
+	.byte	0x22
+	.byte	0xc
+	.long	0x36e
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xe
+	.byte	0x23
+	.byte	0x9
+	.long	0x41
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0xe
+	.byte	0x24
+	.byte	0x9
+	.long	0x41
+	.byte	0x94
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0xe
+	.byte	0x25
+	.byte	0x9
+	.long	0x41
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xe
+	.byte	0x26
+	.byte	0xb
+	.long	0x96
+	.byte	0xa0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF133
+	.byte	0xe
+	.byte	0x27
+	.byte	0x3
+	.long	0x86d
+	.uleb128 0x8
+	.byte	0x18
+	.byte	0xf
+	.byte	0x15
+	.byte	0x9
+	.long	0x9ab
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xf
+	.byte	0x17
+	.byte	0x15
+	.long	0x39d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xf
+	.byte	0x18
+	.byte	0x11
+	.long	0x2df
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0xf
+	.byte	0x1c
+	.byte	0xf
+	.long	0x9d8
+	.byte	0x10
+	.byte	0
+	.uleb128 0x11
+	.long	0xb5
+	.long	0x9ce
+	.uleb128 0x2
+	.long	0x9ce
+	.uleb128 0x2
+	.long	0x9d3
+	.uleb128 0x2
+	.long	0x9d3
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x4
+	.long	0x9ab
+	.uleb128 0x5
+	.long	.LASF134
+	.byte	0xf
+	.byte	0x1e
+	.byte	0x3
+	.long	0x97a
+	.uleb128 0xa
+	.long	0x9dd
+	.uleb128 0x8
+	.byte	0x30
+	.byte	0xf
+	.byte	0x20
+	.byte	0x9
+	.long	0xa60
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xf
+	.byte	0x22
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0xf
+	.byte	0x23
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xf
+	.byte	0x24
+	.byte	0xe
+	.long	0x9ce
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xf
+	.byte	0x25
+	.byte	0xe
+	.long	0x9ce
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xf
+	.byte	0x26
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0xf
+	.byte	0x27
+	.byte	0xd
+	.long	0xa4
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0xf
+	.byte	0x28
+	.byte	0x1d
+	.long	0xa60
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xf
+	.byte	0x29
+	.byte	0xb
+	.long	0x96
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	0x9e9
+	.uleb128 0x5
+	.long	.LASF136
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x3
+	.long	0x9ee
+	.uleb128 0xa
+	.long	0xa65
+	.uleb128 0x5
+	.long	.LASF137
+	.byte	0x10
+	.byte	0xe
+	.byte	0x10
+	.long	0x4fc
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0x10
+	.byte	0x10
+	.byte	0x9
+	.long	0xaa6
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x10
+	.byte	0x12
+	.byte	0x16
+	.long	0xa76
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x10
+	.byte	0x13
+	.byte	0xb
+	.long	0x96
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF140
+	.byte	0x10
+	.byte	0x14
+	.byte	0x3
+	.long	0xa82
+	.uleb128 0x8
+	.byte	0x40
+	.byte	0x10
+	.byte	0x17
+	.byte	0x9
+	.long	0xafd
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x10
+	.byte	0x19
+	.byte	0x15
+	.long	0x28a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0x10
+	.byte	0x1a
+	.byte	0x16
+	.long	0xafd
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x9
+	.long	0x41
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0x10
+	.byte	0x1c
+	.byte	0x9
+	.long	0x41
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x10
+	.byte	0x1d
+	.byte	0x9
+	.long	0x41
+	.byte	0x38
+	.byte	0
+	.uleb128 0x4
+	.long	0xaa6
+	.uleb128 0x5
+	.long	.LASF145
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x3
+	.long	0xab2
+	.uleb128 0x8
+	.byte	0xb0
+	.byte	0x10
+	.byte	0x20
+	.byte	0x9
+	.long	0xba7
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0x10
+	.byte	0x22
+	.byte	0x10
+	.long	0xba7
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x10
+	.byte	0x23
+	.byte	0x18
+	.long	0xbac
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0x10
+	.byte	0x24
+	.byte	0x9
+	.long	0x41
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0x10
+	.byte	0x25
+	.byte	0x9
+	.long	0x41
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x10
+	.byte	0x26
+	.byte	0x15
+	.long	0x28a
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x10
+	.byte	0x27
+	.byte	0x14
+	.long	0x2d3
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x10
+	.byte	0x28
+	.byte	0x14
+	.long	0x2d3
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x10
+	.byte	0x29
+	.byte	0x9
+	.long	0x41
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x10
+	.byte	0x2a
+	.byte	0x9
+	.long	0x41
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x9
+	.long	0x41
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x10
+	.byte	0x2c
+	.byte	0x9
+	.long	0x41
+	.byte	0xac
+	.byte	0
+	.uleb128 0x4
+	.long	0x241
+	.uleb128 0x4
+	.long	0xb02
+	.uleb128 0x5
+	.long	.LASF155
+	.byte	0x10
+	.byte	0x2d
+	.byte	0x3
+	.long	0xb0e
+	.uleb128 0x20
+	.value	0x120
+	.byte	0x11
+	.byte	0x18
+	.long	0xd9f
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0x11
+	.byte	0x1a
+	.byte	0xb
+	.long	0x35b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x11
+	.byte	0x1b
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0x11
+	.byte	0x1d
+	.byte	0x9
+	.long	0x41
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0x11
+	.byte	0x1e
+	.byte	0x9
+	.long	0x41
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0x11
+	.byte	0x1f
+	.byte	0x9
+	.long	0x41
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0x11
+	.byte	0x20
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x11
+	.byte	0x21
+	.byte	0x9
+	.long	0x41
+	.byte	0x1c
+	.uleb128 0x15
+	.string	"fft"
+	.byte	0x11
+	.byte	0x22
+	.byte	0xb
+	.long	0x861
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x11
+	.byte	0x23
+	.byte	0xc
+	.long	0x36e
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x11
+	.byte	0x24
+	.byte	0xc
+	.long	0x36e
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x11
+	.byte	0x25
+	.byte	0xc
+	.long	0x36e
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x11
+	.byte	0x26
+	.byte	0xc
+	.long	0x36e
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x11
+	.byte	0x27
+	.byte	0x9
+	.long	0x41
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x11
+	.byte	0x28
+	.byte	0xc
+	.long	0x36e
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x11
+	.byte	0x29
+	.byte	0x9
+	.long	0x41
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF168
+	.byte	0x11
+	.byte	0x2a
+	.byte	0xc
+	.long	0x36e
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF169
+	.byte	0x11
+	.byte	0x2b
+	.byte	0x9
+	.long	0x41
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF170
+	.byte	0x11
+	.byte	0x2c
+	.byte	0xc
+	.long	0x36e
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF171
+	.byte	0x11
+	.byte	0x2d
+	.byte	0xc
+	.long	0x36e
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0x11
+	.byte	0x2e
+	.byte	0x9
+	.long	0x41
+	.byte	0xa8
+	.uleb128 0x15
+	.string	"hop"
+	.byte	0x11
+	.byte	0x2f
+	.byte	0x9
+	.long	0x41
+	.byte	0xac
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0x11
+	.byte	0x30
+	.byte	0xc
+	.long	0x36e
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0x11
+	.byte	0x31
+	.byte	0xc
+	.long	0x36e
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0x11
+	.byte	0x32
+	.byte	0xc
+	.long	0x36e
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF176
+	.byte	0x11
+	.byte	0x33
+	.byte	0xc
+	.long	0x36e
+	.byte	0xc8
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0x11
+	.byte	0x34
+	.byte	0x9
+	.long	0x41
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x11
+	.byte	0x35
+	.byte	0xd
+	.long	0x501
+	.byte	0xd8
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x11
+	.byte	0x36
+	.byte	0xc
+	.long	0x36e
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x11
+	.byte	0x37
+	.byte	0xc
+	.long	0x36e
+	.byte	0xe8
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x11
+	.byte	0x38
+	.byte	0xa
+	.long	0x85c
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x11
+	.byte	0x39
+	.byte	0xc
+	.long	0x36e
+	.byte	0xf8
+	.uleb128 0x16
+	.long	.LASF183
+	.byte	0x11
+	.byte	0x3a
+	.byte	0xc
+	.long	0x36e
+	.value	0x100
+	.uleb128 0x16
+	.long	.LASF184
+	.byte	0x11
+	.byte	0x3b
+	.byte	0xc
+	.long	0x36e
+	.value	0x108
+	.uleb128 0x16
+	.long	.LASF185
+	.byte	0x11
+	.byte	0x3c
+	.byte	0x13
+	.long	0xd9f
+	.value	0x110
+	.uleb128 0x16
+	.long	.LASF94
+	.byte	0x11
+	.byte	0x3d
+	.byte	0xb
+	.long	0x96
+	.value	0x118
+	.byte	0
+	.uleb128 0x4
+	.long	0xbb1
+	.uleb128 0x5
+	.long	.LASF186
+	.byte	0x11
+	.byte	0x3e
+	.byte	0x3
+	.long	0xbbd
+	.uleb128 0xa
+	.long	0xda4
+	.uleb128 0x1c
+	.long	0x69
+	.byte	0x12
+	.byte	0x11
+	.long	0xdd3
+	.uleb128 0x6
+	.long	.LASF187
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF188
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF189
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF190
+	.byte	0x12
+	.byte	0x15
+	.byte	0x3
+	.long	0xdb5
+	.uleb128 0x8
+	.byte	0x78
+	.byte	0x12
+	.byte	0x17
+	.byte	0x9
+	.long	0xeb9
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x12
+	.byte	0x19
+	.byte	0xc
+	.long	0x367
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x12
+	.byte	0x1a
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x12
+	.byte	0x1b
+	.byte	0x15
+	.long	0xdd3
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x12
+	.byte	0x1c
+	.byte	0xc
+	.long	0x36e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x12
+	.byte	0x1d
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0x12
+	.byte	0x20
+	.byte	0xd
+	.long	0x501
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x12
+	.byte	0x21
+	.byte	0xd
+	.long	0x501
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x12
+	.byte	0x22
+	.byte	0xd
+	.long	0x501
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x12
+	.byte	0x25
+	.byte	0xd
+	.long	0x501
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x12
+	.byte	0x26
+	.byte	0xd
+	.long	0x501
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x12
+	.byte	0x27
+	.byte	0xd
+	.long	0x501
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x12
+	.byte	0x28
+	.byte	0xd
+	.long	0x501
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0x12
+	.byte	0x29
+	.byte	0xd
+	.long	0x501
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x12
+	.byte	0x2a
+	.byte	0xd
+	.long	0x501
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x12
+	.byte	0x2b
+	.byte	0xd
+	.long	0x501
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0x12
+	.byte	0x2d
+	.byte	0xb
+	.long	0x96
+	.byte	0x70
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF203
+	.byte	0x12
+	.byte	0x2e
+	.byte	0x3
+	.long	0xddf
+	.uleb128 0xa
+	.long	0xeb9
+	.uleb128 0x8
+	.byte	0x68
+	.byte	0x13
+	.byte	0x13
+	.byte	0x9
+	.long	0xfa4
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0x13
+	.byte	0x15
+	.byte	0xb
+	.long	0x35b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x13
+	.byte	0x16
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x13
+	.byte	0x17
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x13
+	.byte	0x18
+	.byte	0x9
+	.long	0x41
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0x13
+	.byte	0x19
+	.byte	0xc
+	.long	0x36e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x13
+	.byte	0x1a
+	.byte	0xc
+	.long	0x36e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x13
+	.byte	0x1b
+	.byte	0x9
+	.long	0x41
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x13
+	.byte	0x1c
+	.byte	0xc
+	.long	0x36e
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x13
+	.byte	0x1d
+	.byte	0x9
+	.long	0x41
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0x13
+	.byte	0x1e
+	.byte	0x9
+	.long	0x41
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0x13
+	.byte	0x1f
+	.byte	0xd
+	.long	0x501
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x13
+	.byte	0x20
+	.byte	0xd
+	.long	0x501
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0x13
+	.byte	0x21
+	.byte	0xd
+	.long	0x501
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0x13
+	.byte	0x22
+	.byte	0xd
+	.long	0x501
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0x13
+	.byte	0x23
+	.byte	0x18
+	.long	0x668
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0x13
+	.byte	0x24
+	.byte	0xb
+	.long	0x96
+	.byte	0x60
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF213
+	.byte	0x13
+	.byte	0x25
+	.byte	0x3
+	.long	0xeca
+	.uleb128 0xa
+	.long	0xfa4
+	.uleb128 0x8
+	.byte	0xb0
+	.byte	0x1
+	.byte	0x18
+	.byte	0x9
+	.long	0xfd9
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x1
+	.byte	0x1a
+	.byte	0x12
+	.long	0x96e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0x1
+	.byte	0x1b
+	.byte	0xc
+	.long	0x36e
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF215
+	.byte	0x1
+	.byte	0x1c
+	.byte	0x3
+	.long	0xfb5
+	.uleb128 0x8
+	.byte	0x38
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x9
+	.long	0x1009
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x1
+	.byte	0x21
+	.byte	0x10
+	.long	0xa65
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF216
+	.byte	0x1
+	.byte	0x22
+	.byte	0xe
+	.long	0x9ce
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF217
+	.byte	0x1
+	.byte	0x23
+	.byte	0x3
+	.long	0xfe5
+	.uleb128 0x20
+	.value	0x128
+	.byte	0x1
+	.byte	0x26
+	.long	0x103a
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x1
+	.byte	0x28
+	.byte	0x15
+	.long	0xda4
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF185
+	.byte	0x1
+	.byte	0x29
+	.byte	0x13
+	.long	0xd9f
+	.value	0x120
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF218
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x3
+	.long	0x1015
+	.uleb128 0x1a
+	.long	0x75c
+	.long	0x1056
+	.uleb128 0x1b
+	.long	0x3a
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.long	0x1046
+	.uleb128 0x13
+	.long	.LASF266
+	.value	0x10a
+	.byte	0x1d
+	.long	0x1056
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsEngineOps
+	.uleb128 0x1e
+	.long	.LASF219
+	.byte	0x14
+	.value	0x164
+	.byte	0xc
+	.long	0x41
+	.long	0x1089
+	.uleb128 0x2
+	.long	0x2df
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF220
+	.byte	0x13
+	.byte	0x2f
+	.byte	0x5
+	.long	0x41
+	.long	0x10ae
+	.uleb128 0x2
+	.long	0x10ae
+	.uleb128 0x2
+	.long	0x35b
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0xfa4
+	.uleb128 0xb
+	.long	.LASF221
+	.byte	0x12
+	.byte	0x39
+	.byte	0x5
+	.long	0x41
+	.long	0x10d8
+	.uleb128 0x2
+	.long	0x10d8
+	.uleb128 0x2
+	.long	0x367
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0xdd3
+	.byte	0
+	.uleb128 0x4
+	.long	0xeb9
+	.uleb128 0x9
+	.long	.LASF229
+	.byte	0x11
+	.byte	0x58
+	.long	0x10f3
+	.uleb128 0x2
+	.long	0x10f3
+	.uleb128 0x2
+	.long	0xd9f
+	.byte	0
+	.uleb128 0x4
+	.long	0xda4
+	.uleb128 0xb
+	.long	.LASF222
+	.byte	0x10
+	.byte	0x35
+	.byte	0x5
+	.long	0x41
+	.long	0x1113
+	.uleb128 0x2
+	.long	0xd9f
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF305
+	.byte	0x10
+	.byte	0x50
+	.byte	0x5
+	.long	0x41
+	.uleb128 0xb
+	.long	.LASF223
+	.byte	0x11
+	.byte	0x4a
+	.byte	0x5
+	.long	0x41
+	.long	0x1144
+	.uleb128 0x2
+	.long	0x10f3
+	.uleb128 0x2
+	.long	0x35b
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF224
+	.byte	0xf
+	.byte	0x33
+	.byte	0x5
+	.long	0x41
+	.long	0x1164
+	.uleb128 0x2
+	.long	0x1164
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0xa65
+	.uleb128 0xb
+	.long	.LASF225
+	.byte	0xf
+	.byte	0x54
+	.byte	0x5
+	.long	0x41
+	.long	0x117f
+	.uleb128 0x2
+	.long	0x35b
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF226
+	.byte	0x15
+	.value	0x229
+	.byte	0xe
+	.long	0x96
+	.long	0x1196
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF227
+	.byte	0xe
+	.byte	0x3a
+	.byte	0x5
+	.long	0x41
+	.long	0x11b6
+	.uleb128 0x2
+	.long	0x11b6
+	.uleb128 0x2
+	.long	0x35b
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x96e
+	.uleb128 0x1e
+	.long	.LASF228
+	.byte	0x15
+	.value	0x22c
+	.byte	0xe
+	.long	0x96
+	.long	0x11d7
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF230
+	.byte	0x13
+	.byte	0x35
+	.long	0x11e8
+	.uleb128 0x2
+	.long	0x10ae
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF231
+	.byte	0x13
+	.byte	0x51
+	.byte	0x8
+	.long	0x367
+	.long	0x11fe
+	.uleb128 0x2
+	.long	0x11fe
+	.byte	0
+	.uleb128 0x4
+	.long	0xfb0
+	.uleb128 0x9
+	.long	.LASF232
+	.byte	0x13
+	.byte	0x3d
+	.long	0x1219
+	.uleb128 0x2
+	.long	0x10ae
+	.uleb128 0x2
+	.long	0x35b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF233
+	.byte	0x13
+	.byte	0x49
+	.byte	0x5
+	.long	0x41
+	.long	0x1248
+	.uleb128 0x2
+	.long	0x10ae
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF234
+	.byte	0x12
+	.byte	0x3f
+	.long	0x1259
+	.uleb128 0x2
+	.long	0x10d8
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF235
+	.byte	0x12
+	.byte	0x5c
+	.byte	0x8
+	.long	0x367
+	.long	0x126f
+	.uleb128 0x2
+	.long	0x126f
+	.byte	0
+	.uleb128 0x4
+	.long	0xec5
+	.uleb128 0x9
+	.long	.LASF236
+	.byte	0x12
+	.byte	0x47
+	.long	0x128a
+	.uleb128 0x2
+	.long	0x10d8
+	.uleb128 0x2
+	.long	0x35b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF237
+	.byte	0x12
+	.byte	0x54
+	.byte	0x5
+	.long	0x41
+	.long	0x12b9
+	.uleb128 0x2
+	.long	0x10d8
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF238
+	.byte	0x11
+	.byte	0x50
+	.long	0x12ca
+	.uleb128 0x2
+	.long	0x10f3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF239
+	.byte	0x10
+	.byte	0x4a
+	.long	0x12db
+	.uleb128 0x2
+	.long	0xd9f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF240
+	.byte	0x11
+	.byte	0x75
+	.byte	0x8
+	.long	0x367
+	.long	0x12f1
+	.uleb128 0x2
+	.long	0x12f1
+	.byte	0
+	.uleb128 0x4
+	.long	0xdb0
+	.uleb128 0x9
+	.long	.LASF241
+	.byte	0x11
+	.byte	0x5f
+	.long	0x130c
+	.uleb128 0x2
+	.long	0x10f3
+	.uleb128 0x2
+	.long	0x35b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF242
+	.byte	0x11
+	.byte	0x6d
+	.byte	0x5
+	.long	0x41
+	.long	0x133b
+	.uleb128 0x2
+	.long	0x10f3
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF243
+	.byte	0xf
+	.byte	0x39
+	.long	0x134c
+	.uleb128 0x2
+	.long	0x1164
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF244
+	.byte	0xf
+	.byte	0x40
+	.long	0x1362
+	.uleb128 0x2
+	.long	0x1164
+	.uleb128 0x2
+	.long	0xa4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF245
+	.byte	0xf
+	.byte	0x64
+	.long	0x137d
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x9d3
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF246
+	.byte	0xf
+	.byte	0x4c
+	.long	0x13a7
+	.uleb128 0x2
+	.long	0x1164
+	.uleb128 0x2
+	.long	0x9d3
+	.uleb128 0x2
+	.long	0x9d3
+	.uleb128 0x2
+	.long	0x9ce
+	.uleb128 0x2
+	.long	0x9ce
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF247
+	.byte	0xf
+	.byte	0x5c
+	.long	0x13c2
+	.uleb128 0x2
+	.long	0x9ce
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF248
+	.byte	0x15
+	.value	0x238
+	.byte	0xd
+	.long	0x13d5
+	.uleb128 0x2
+	.long	0x96
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF249
+	.byte	0xe
+	.byte	0x40
+	.long	0x13e6
+	.uleb128 0x2
+	.long	0x11b6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF250
+	.byte	0xe
+	.byte	0x5d
+	.long	0x13fc
+	.uleb128 0x2
+	.long	0x11b6
+	.uleb128 0x2
+	.long	0x36e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF251
+	.byte	0xe
+	.byte	0x47
+	.long	0x1412
+	.uleb128 0x2
+	.long	0x11b6
+	.uleb128 0x2
+	.long	0x35b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF252
+	.byte	0xe
+	.byte	0x55
+	.byte	0x5
+	.long	0x41
+	.long	0x1441
+	.uleb128 0x2
+	.long	0x11b6
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF253
+	.byte	0xb
+	.byte	0x90
+	.long	0x1457
+	.uleb128 0x2
+	.long	0x663
+	.uleb128 0x2
+	.long	0x35b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF254
+	.byte	0xb
+	.byte	0xac
+	.byte	0x5
+	.long	0x41
+	.long	0x1486
+	.uleb128 0x2
+	.long	0x663
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x434
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x36e
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF255
+	.byte	0x1
+	.value	0x1f7
+	.byte	0xd
+	.long	0x2df
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14b9
+	.uleb128 0x7
+	.long	.LASF257
+	.value	0x1f7
+	.byte	0x2f
+	.long	0x14b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x4
+	.long	0x796
+	.uleb128 0x1f
+	.long	.LASF256
+	.value	0x1f2
+	.byte	0x8
+	.long	0x367
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14f0
+	.uleb128 0x7
+	.long	.LASF257
+	.value	0x1f2
+	.byte	0x31
+	.long	0x14b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF262
+	.value	0x1ed
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x152c
+	.uleb128 0x7
+	.long	.LASF257
+	.value	0x1ed
+	.byte	0x2e
+	.long	0x14b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.long	.LASF258
+	.value	0x1ed
+	.byte	0x3c
+	.long	0x35b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF259
+	.value	0x1e7
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15a9
+	.uleb128 0x7
+	.long	.LASF257
+	.value	0x1e7
+	.byte	0x2f
+	.long	0x14b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.long	.LASF129
+	.value	0x1e7
+	.byte	0x44
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	.LASF206
+	.value	0x1e7
+	.byte	0x58
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	.LASF260
+	.value	0x1e8
+	.byte	0x23
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF130
+	.value	0x1e8
+	.byte	0x32
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.long	.LASF261
+	.value	0x1e8
+	.byte	0x3d
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF263
+	.value	0x1dd
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15d6
+	.uleb128 0x7
+	.long	.LASF257
+	.value	0x1dd
+	.byte	0x23
+	.long	0x15d6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x4
+	.long	0x78a
+	.uleb128 0x1f
+	.long	.LASF264
+	.value	0x1b6
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x163a
+	.uleb128 0x7
+	.long	.LASF257
+	.value	0x1b6
+	.byte	0x21
+	.long	0x15d6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	.LASF265
+	.value	0x1b6
+	.byte	0x44
+	.long	0x163a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF214
+	.value	0x1b6
+	.byte	0x5b
+	.long	0x663
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x13
+	.long	.LASF108
+	.value	0x1b8
+	.byte	0xb
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x4
+	.long	0x7ff
+	.uleb128 0x17
+	.long	.LASF267
+	.value	0x1a5
+	.long	0x96
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x167e
+	.uleb128 0x7
+	.long	.LASF265
+	.value	0x1a5
+	.byte	0x3b
+	.long	0x163a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x22
+	.string	"apa"
+	.value	0x1a7
+	.long	0x10ae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF268
+	.value	0x190
+	.long	0x96
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16bd
+	.uleb128 0x7
+	.long	.LASF265
+	.value	0x190
+	.byte	0x3b
+	.long	0x163a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x22
+	.string	"rls"
+	.value	0x192
+	.long	0x10d8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF269
+	.value	0x164
+	.long	0x96
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x170c
+	.uleb128 0x7
+	.long	.LASF265
+	.value	0x164
+	.byte	0x3f
+	.long	0x163a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x13
+	.long	.LASF270
+	.value	0x166
+	.byte	0x19
+	.long	0x170c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x13
+	.long	.LASF113
+	.value	0x167
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x4
+	.long	0x103a
+	.uleb128 0x17
+	.long	.LASF271
+	.value	0x148
+	.long	0x96
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1751
+	.uleb128 0x7
+	.long	.LASF265
+	.value	0x148
+	.byte	0x3d
+	.long	0x163a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x13
+	.long	.LASF272
+	.value	0x14a
+	.byte	0x17
+	.long	0x1751
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x4
+	.long	0x1009
+	.uleb128 0x17
+	.long	.LASF273
+	.value	0x12c
+	.long	0x96
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1796
+	.uleb128 0x7
+	.long	.LASF265
+	.value	0x12c
+	.byte	0x3c
+	.long	0x163a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x13
+	.long	.LASF274
+	.value	0x12e
+	.byte	0x16
+	.long	0x1796
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x4
+	.long	0xfd9
+	.uleb128 0x2b
+	.long	.LASF276
+	.byte	0x1
+	.value	0x104
+	.byte	0xd
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17ca
+	.uleb128 0x7
+	.long	.LASF108
+	.value	0x104
+	.byte	0x26
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF275
+	.byte	0xff
+	.byte	0xf
+	.long	0x367
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17fa
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xff
+	.byte	0x2e
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF277
+	.byte	0xfa
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1833
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xfa
+	.byte	0x2b
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF258
+	.byte	0xfa
+	.byte	0x38
+	.long	0x35b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF278
+	.byte	0xf4
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18a9
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xf4
+	.byte	0x2c
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF129
+	.byte	0xf4
+	.byte	0x40
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF206
+	.byte	0xf4
+	.byte	0x54
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF260
+	.byte	0xf4
+	.byte	0x64
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF130
+	.byte	0xf5
+	.byte	0x2d
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF261
+	.byte	0xf5
+	.byte	0x38
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF279
+	.byte	0xea
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18d4
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xea
+	.byte	0x26
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF280
+	.byte	0xe5
+	.byte	0xf
+	.long	0x367
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1904
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xe5
+	.byte	0x2e
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF281
+	.byte	0xe0
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x193d
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xe0
+	.byte	0x2b
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF258
+	.byte	0xe0
+	.byte	0x38
+	.long	0x35b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF282
+	.byte	0xda
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19b3
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xda
+	.byte	0x2c
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF129
+	.byte	0xda
+	.byte	0x40
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF206
+	.byte	0xda
+	.byte	0x54
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF260
+	.byte	0xda
+	.byte	0x64
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF130
+	.byte	0xdb
+	.byte	0x2d
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF261
+	.byte	0xdb
+	.byte	0x38
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF283
+	.byte	0xc9
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19ec
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xc9
+	.byte	0x2a
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.long	.LASF270
+	.byte	0xcb
+	.byte	0x19
+	.long	0x170c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF284
+	.byte	0xc4
+	.byte	0xf
+	.long	0x367
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a1c
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xc4
+	.byte	0x32
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF285
+	.byte	0xbf
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a55
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xbf
+	.byte	0x2f
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF258
+	.byte	0xbf
+	.byte	0x3c
+	.long	0x35b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF286
+	.byte	0xb8
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1acb
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xb8
+	.byte	0x30
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF129
+	.byte	0xb8
+	.byte	0x44
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF206
+	.byte	0xb8
+	.byte	0x58
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF260
+	.byte	0xb8
+	.byte	0x68
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF130
+	.byte	0xb9
+	.byte	0x31
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF261
+	.byte	0xb9
+	.byte	0x3c
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF287
+	.byte	0xab
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b04
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0xab
+	.byte	0x28
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.long	.LASF272
+	.byte	0xad
+	.byte	0x17
+	.long	0x1751
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF288
+	.byte	0x9f
+	.long	0x367
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b6d
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x9f
+	.byte	0x30
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xd
+	.long	.LASF214
+	.byte	0xa1
+	.byte	0x17
+	.long	0x1b6d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.string	"sum"
+	.byte	0xa2
+	.byte	0xc
+	.long	0x367
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x18
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x12
+	.string	"k"
+	.byte	0xa4
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xa71
+	.uleb128 0xe
+	.long	.LASF289
+	.byte	0x97
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1bb9
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x97
+	.byte	0x2d
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF258
+	.byte	0x97
+	.byte	0x3a
+	.long	0x35b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0xd
+	.long	.LASF290
+	.byte	0x99
+	.byte	0xd
+	.long	0xa4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -18
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF291
+	.byte	0x76
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cb8
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x76
+	.byte	0x2e
+	.long	0x96
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.long	.LASF129
+	.byte	0x76
+	.byte	0x42
+	.long	0x434
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x3
+	.long	.LASF206
+	.byte	0x76
+	.byte	0x56
+	.long	0x434
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x3
+	.long	.LASF260
+	.byte	0x76
+	.byte	0x66
+	.long	0x36e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x3
+	.long	.LASF130
+	.byte	0x77
+	.byte	0x2f
+	.long	0x36e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x3
+	.long	.LASF261
+	.byte	0x77
+	.byte	0x3a
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0xd
+	.long	.LASF272
+	.byte	0x79
+	.byte	0x17
+	.long	0x1751
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xd
+	.long	.LASF292
+	.byte	0x7a
+	.byte	0xe
+	.long	0x9ce
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.long	.LASF293
+	.byte	0x7b
+	.byte	0xe
+	.long	0x9ce
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xd
+	.long	.LASF294
+	.byte	0x7c
+	.byte	0xe
+	.long	0x9ce
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xd
+	.long	.LASF295
+	.byte	0x7d
+	.byte	0xe
+	.long	0x9ce
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x18
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x7f
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x18
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x12
+	.string	"n"
+	.byte	0x81
+	.byte	0x13
+	.long	0x48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF296
+	.byte	0x69
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cf1
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x69
+	.byte	0x27
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.long	.LASF274
+	.byte	0x6b
+	.byte	0x16
+	.long	0x1796
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF297
+	.byte	0x5c
+	.byte	0xf
+	.long	0x367
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d5b
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x5c
+	.byte	0x2f
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xd
+	.long	.LASF274
+	.byte	0x5e
+	.byte	0x16
+	.long	0x1796
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.string	"sum"
+	.byte	0x5f
+	.byte	0xc
+	.long	0x367
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x18
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x12
+	.string	"k"
+	.byte	0x62
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF298
+	.byte	0x57
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d94
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x57
+	.byte	0x2c
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF258
+	.byte	0x57
+	.byte	0x39
+	.long	0x35b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF299
+	.byte	0x51
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e0a
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x51
+	.byte	0x2d
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF129
+	.byte	0x51
+	.byte	0x41
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF206
+	.byte	0x51
+	.byte	0x55
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF260
+	.byte	0x51
+	.byte	0x65
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF130
+	.byte	0x52
+	.byte	0x2e
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF261
+	.byte	0x52
+	.byte	0x39
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF300
+	.byte	0x1
+	.byte	0x47
+	.byte	0xd
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e37
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x47
+	.byte	0x26
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF301
+	.byte	0x3b
+	.long	0x367
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ea0
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x3b
+	.byte	0x2e
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xd
+	.long	.LASF214
+	.byte	0x3d
+	.byte	0x18
+	.long	0x1ea0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.string	"sum"
+	.byte	0x3e
+	.byte	0xc
+	.long	0x367
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x18
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x12
+	.string	"k"
+	.byte	0x40
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x554
+	.uleb128 0xe
+	.long	.LASF302
+	.byte	0x36
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ede
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x36
+	.byte	0x2b
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF258
+	.byte	0x36
+	.byte	0x38
+	.long	0x35b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF303
+	.byte	0x1
+	.byte	0x30
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x3
+	.long	.LASF108
+	.byte	0x30
+	.byte	0x2c
+	.long	0x96
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF129
+	.byte	0x30
+	.byte	0x40
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF206
+	.byte	0x30
+	.byte	0x54
+	.long	0x434
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF260
+	.byte	0x30
+	.byte	0x64
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF130
+	.byte	0x31
+	.byte	0x2d
+	.long	0x36e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF261
+	.byte	0x31
+	.byte	0x38
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF231:
+	.string	"apaFilter_NormSquared"
+.LASF178:
+	.string	"bandPower"
+.LASF19:
+	.string	"__value32"
+.LASF9:
+	.string	"size_t"
+.LASF57:
+	.string	"LMS_KERNEL_SSE2"
+.LASF110:
+	.string	"algorithm"
+.LASF257:
+	.string	"engine"
+.LASF78:
+	.string	"LmsFilter_t"
+.LASF31:
+	.string	"__kind"
+.LASF271:
+	.string	"lmsEngine_OpenFixed"
+.LASF48:
+	.string	"pthread_cond_t"
+.LASF92:
+	.string	"kernel"
+.LASF232:
+	.string	"apaFilter_PushSample"
+.LASF297:
+	.string	"lmsEngine_FdafNormSquared"
+.LASF24:
+	.string	"__pthread_list_t"
+.LASF82:
+	.string	"coefficients"
+.LASF202:
+	.string	"joint"
+.LASF149:
+	.string	"workAvailable"
+.LASF98:
+	.string	"LMS_FILTER_ALGORITHM_FDAF"
+.LASF154:
+	.string	"shutdown"
+.LASF68:
+	.string	"bankUpdateDot"
+.LASF69:
+	.string	"LmsKernel_t"
+.LASF230:
+	.string	"apaFilter_Free"
+.LASF23:
+	.string	"__next"
+.LASF44:
+	.string	"__data"
+.LASF22:
+	.string	"__prev"
+.LASF108:
+	.string	"state"
+.LASF91:
+	.string	"processBlock"
+.LASF259:
+	.string	"lmsEngine_ProcessBlock"
+.LASF265:
+	.string	"settings"
+.LASF25:
+	.string	"__pthread_internal_list"
+.LASF62:
+	.string	"type"
+.LASF197:
+	.string	"backwardPower"
+.LASF123:
+	.string	"weights"
+.LASF273:
+	.string	"lmsEngine_OpenFdaf"
+.LASF29:
+	.string	"__owner"
+.LASF160:
+	.string	"delay"
+.LASF102:
+	.string	"LMS_FILTER_ALGORITHM_APA"
+.LASF18:
+	.string	"__value64"
+.LASF253:
+	.string	"lmsFilter_PushSample"
+.LASF179:
+	.string	"frameInput"
+.LASF145:
+	.string	"ThreadPoolQueue_t"
+.LASF262:
+	.string	"lmsEngine_PushSample"
+.LASF293:
+	.string	"fixedDesired"
+.LASF170:
+	.string	"overlap"
+.LASF171:
+	.string	"ready"
+.LASF195:
+	.string	"gain"
+.LASF190:
+	.string	"RlsFilterForm_t"
+.LASF65:
+	.string	"updateDot"
+.LASF176:
+	.string	"windowIm"
+.LASF58:
+	.string	"LMS_KERNEL_AVX2"
+.LASF3:
+	.string	"long int"
+.LASF227:
+	.string	"fdafFilter_Init"
+.LASF288:
+	.string	"lmsEngine_FixedNormSquared"
+.LASF163:
+	.string	"inputHistory"
+.LASF294:
+	.string	"fixedOutput"
+.LASF285:
+	.string	"lmsEngine_SubbandPushSample"
+.LASF74:
+	.string	"LMS_FILTER_VARIANT_SIGN_DATA"
+.LASF289:
+	.string	"lmsEngine_FixedPushSample"
+.LASF193:
+	.string	"history"
+.LASF269:
+	.string	"lmsEngine_OpenSubband"
+.LASF201:
+	.string	"backwardReflection"
+.LASF245:
+	.string	"lmsFixed_ToFloat"
+.LASF130:
+	.string	"error"
+.LASF125:
+	.string	"head"
+.LASF256:
+	.string	"lmsEngine_NormSquared"
+.LASF30:
+	.string	"__nusers"
+.LASF174:
+	.string	"weightsIm"
+.LASF8:
+	.string	"signed char"
+.LASF255:
+	.string	"lmsEngine_Name"
+.LASF90:
+	.string	"leak"
+.LASF278:
+	.string	"lmsEngine_ApaProcessBlock"
+.LASF167:
+	.string	"referenceIndex"
+.LASF281:
+	.string	"lmsEngine_RlsPushSample"
+.LASF52:
+	.string	"context"
+.LASF134:
+	.string	"LmsFixedKernel_t"
+.LASF26:
+	.string	"__pthread_mutex_s"
+.LASF80:
+	.string	"step"
+.LASF242:
+	.string	"subbandFilter_ProcessBlock"
+.LASF221:
+	.string	"rlsFilter_Init"
+.LASF5:
+	.string	"unsigned char"
+.LASF205:
+	.string	"historyLength"
+.LASF32:
+	.string	"__spins"
+.LASF181:
+	.string	"framePosition"
+.LASF97:
+	.string	"LMS_FILTER_ALGORITHM_LMS"
+.LASF295:
+	.string	"fixedError"
+.LASF72:
+	.string	"LMS_FILTER_VARIANT_LEAKY"
+.LASF199:
+	.string	"conversion"
+.LASF64:
+	.string	"update"
+.LASF142:
+	.string	"jobs"
+.LASF86:
+	.string	"pendingUpdate"
+.LASF301:
+	.string	"lmsEngine_LmsNormSquared"
+.LASF112:
+	.string	"projectionOrder"
+.LASF88:
+	.string	"variant"
+.LASF153:
+	.string	"nextQueue"
+.LASF156:
+	.string	"decimation"
+.LASF13:
+	.string	"char"
+.LASF104:
+	.string	"pushSample"
+.LASF95:
+	.string	"LmsFilterProcessBlock_t"
+.LASF17:
+	.string	"__high"
+.LASF191:
+	.string	"lambda"
+.LASF165:
+	.string	"historyIndex"
+.LASF208:
+	.string	"validRows"
+.LASF139:
+	.string	"argument"
+.LASF143:
+	.string	"capacity"
+.LASF141:
+	.string	"lock"
+.LASF137:
+	.string	"ThreadPoolTask_t"
+.LASF79:
+	.string	"LmsFilter"
+.LASF121:
+	.string	"blockSize"
+.LASF177:
+	.string	"windowIndex"
+.LASF210:
+	.string	"gram"
+.LASF218:
+	.string	"LmsEngineSubband_t"
+.LASF50:
+	.string	"allocate"
+.LASF270:
+	.string	"subband"
+.LASF16:
+	.string	"__low"
+.LASF277:
+	.string	"lmsEngine_ApaPushSample"
+.LASF287:
+	.string	"lmsEngine_FixedClose"
+.LASF258:
+	.string	"sample"
+.LASF246:
+	.string	"lmsFixed_ProcessBlock"
+.LASF129:
+	.string	"input"
+.LASF131:
+	.string	"fill"
+.LASF216:
+	.string	"samples"
+.LASF229:
+	.string	"subbandFilter_SetThreadPool"
+.LASF251:
+	.string	"fdafFilter_PushSample"
+.LASF272:
+	.string	"fixed"
+.LASF138:
+	.string	"task"
+.LASF219:
+	.string	"printf"
+.LASF94:
+	.string	"memory"
+.LASF237:
+	.string	"rlsFilter_ProcessBlock"
+.LASF224:
+	.string	"lmsFixed_Init"
+.LASF70:
+	.string	"LMS_FILTER_VARIANT_LMS"
+.LASF27:
+	.string	"__lock"
+.LASF234:
+	.string	"rlsFilter_Free"
+.LASF303:
+	.string	"lmsEngine_LmsProcessBlock"
+.LASF128:
+	.string	"workSpectrum"
+.LASF292:
+	.string	"fixedInput"
+.LASF279:
+	.string	"lmsEngine_RlsClose"
+.LASF126:
+	.string	"pastOutput"
+.LASF169:
+	.string	"desiredDelayIndex"
+.LASF96:
+	.string	"LMS_FILTER_ALGORITHM_UNKNOWN"
+.LASF37:
+	.string	"__g1_start"
+.LASF252:
+	.string	"fdafFilter_ProcessBlock"
+.LASF105:
+	.string	"normSquared"
+.LASF233:
+	.string	"apaFilter_ProcessBlock"
+.LASF101:
+	.string	"LMS_FILTER_ALGORITHM_RLS"
+.LASF2:
+	.string	"long unsigned int"
+.LASF43:
+	.string	"pthread_t"
+.LASF276:
+	.string	"lmsEngine_ApaClose"
+.LASF188:
+	.string	"RLS_FILTER_FORM_DIRECT"
+.LASF61:
+	.string	"LmsKernelType_t"
+.LASF175:
+	.string	"windowRe"
+.LASF157:
+	.string	"numOfBins"
+.LASF152:
+	.string	"pending"
+.LASF45:
+	.string	"__size"
+.LASF254:
+	.string	"lmsFilter_ProcessBlock"
+.LASF247:
+	.string	"lmsFixed_FromFloat"
+.LASF100:
+	.string	"LMS_FILTER_ALGORITHM_SUBBAND"
+.LASF59:
+	.string	"LMS_KERNEL_AVX512"
+.LASF264:
+	.string	"lmsEngine_Open"
+.LASF83:
+	.string	"delayLine"
+.LASF204:
+	.string	"order"
+.LASF73:
+	.string	"LMS_FILTER_VARIANT_SIGN_ERROR"
+.LASF40:
+	.string	"__g1_orig_size"
+.LASF283:
+	.string	"lmsEngine_SubbandClose"
+.LASF173:
+	.string	"weightsRe"
+.LASF302:
+	.string	"lmsEngine_LmsPushSample"
+.LASF222:
+	.string	"threadPool_Init"
+.LASF4:
+	.string	"long long int"
+.LASF215:
+	.string	"LmsEngineFdaf_t"
+.LASF217:
+	.string	"LmsEngineFixed_t"
+.LASF275:
+	.string	"lmsEngine_ApaNormSquared"
+.LASF305:
+	.string	"threadPool_NumberOfCpus"
+.LASF117:
+	.string	"realTwiddles"
+.LASF55:
+	.string	"double"
+.LASF243:
+	.string	"lmsFixed_Free"
+.LASF298:
+	.string	"lmsEngine_FdafPushSample"
+.LASF194:
+	.string	"inverse"
+.LASF244:
+	.string	"lmsFixed_PushSample"
+.LASF159:
+	.string	"prototypeLength"
+.LASF54:
+	.string	"float"
+.LASF144:
+	.string	"count"
+.LASF183:
+	.string	"fold"
+.LASF41:
+	.string	"__wrefs"
+.LASF114:
+	.string	"LmsEngineSettings_t"
+.LASF184:
+	.string	"spectrum"
+.LASF7:
+	.string	"unsigned int"
+.LASF47:
+	.string	"pthread_mutex_t"
+.LASF291:
+	.string	"lmsEngine_FixedProcessBlock"
+.LASF286:
+	.string	"lmsEngine_SubbandProcessBlock"
+.LASF124:
+	.string	"spectra"
+.LASF127:
+	.string	"errorSpectrum"
+.LASF189:
+	.string	"RLS_FILTER_FORM_LATTICE"
+.LASF60:
+	.string	"LMS_KERNEL_COUNT"
+.LASF107:
+	.string	"LmsEngineOps_t"
+.LASF296:
+	.string	"lmsEngine_FdafClose"
+.LASF304:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF196:
+	.string	"forwardPower"
+.LASF140:
+	.string	"ThreadPoolJob_t"
+.LASF200:
+	.string	"forwardReflection"
+.LASF172:
+	.string	"readyIndex"
+.LASF158:
+	.string	"subbandLength"
+.LASF300:
+	.string	"lmsEngine_LmsClose"
+.LASF28:
+	.string	"__count"
+.LASF198:
+	.string	"backwardError"
+.LASF239:
+	.string	"threadPool_Destroy"
+.LASF84:
+	.string	"delayIndex"
+.LASF89:
+	.string	"leakage"
+.LASF228:
+	.string	"calloc"
+.LASF87:
+	.string	"power"
+.LASF284:
+	.string	"lmsEngine_SubbandNormSquared"
+.LASF111:
+	.string	"numOfBands"
+.LASF49:
+	.string	"long double"
+.LASF122:
+	.string	"numOfPartitions"
+.LASF168:
+	.string	"desiredDelay"
+.LASF119:
+	.string	"work"
+.LASF212:
+	.string	"solution"
+.LASF113:
+	.string	"numOfThreads"
+.LASF103:
+	.string	"LmsFilterAlgorithm_t"
+.LASF99:
+	.string	"LMS_FILTER_ALGORITHM_FIXED"
+.LASF56:
+	.string	"LMS_KERNEL_SCALAR"
+.LASF116:
+	.string	"twiddles"
+.LASF161:
+	.string	"analysisWindow"
+.LASF115:
+	.string	"size"
+.LASF150:
+	.string	"allDone"
+.LASF20:
+	.string	"long long unsigned int"
+.LASF260:
+	.string	"output"
+.LASF290:
+	.string	"fixedSample"
+.LASF34:
+	.string	"__list"
+.LASF81:
+	.string	"length"
+.LASF223:
+	.string	"subbandFilter_Init"
+.LASF250:
+	.string	"fdafFilter_GetCoefficients"
+.LASF185:
+	.string	"pool"
+.LASF39:
+	.string	"__g_size"
+.LASF182:
+	.string	"delayedDesired"
+.LASF21:
+	.string	"__atomic_wide_counter"
+.LASF282:
+	.string	"lmsEngine_RlsProcessBlock"
+.LASF118:
+	.string	"bitReverse"
+.LASF266:
+	.string	"lmsEngineOps"
+.LASF235:
+	.string	"rlsFilter_NormSquared"
+.LASF203:
+	.string	"RlsFilter_t"
+.LASF151:
+	.string	"queued"
+.LASF147:
+	.string	"queues"
+.LASF133:
+	.string	"FdafFilter_t"
+.LASF261:
+	.string	"numOfSamples"
+.LASF38:
+	.string	"__g_refs"
+.LASF213:
+	.string	"ApaFilter_t"
+.LASF10:
+	.string	"__int16_t"
+.LASF192:
+	.string	"form"
+.LASF249:
+	.string	"fdafFilter_Free"
+.LASF241:
+	.string	"subbandFilter_PushSample"
+.LASF226:
+	.string	"malloc"
+.LASF46:
+	.string	"__align"
+.LASF146:
+	.string	"threads"
+.LASF236:
+	.string	"rlsFilter_PushSample"
+.LASF71:
+	.string	"LMS_FILTER_VARIANT_NLMS"
+.LASF93:
+	.string	"allocator"
+.LASF180:
+	.string	"frameDesired"
+.LASF206:
+	.string	"desired"
+.LASF164:
+	.string	"desiredHistory"
+.LASF63:
+	.string	"name"
+.LASF36:
+	.string	"__wseq"
+.LASF76:
+	.string	"LMS_FILTER_VARIANT_COUNT"
+.LASF155:
+	.string	"ThreadPool_t"
+.LASF11:
+	.string	"short int"
+.LASF132:
+	.string	"spectrumFill"
+.LASF280:
+	.string	"lmsEngine_RlsNormSquared"
+.LASF14:
+	.string	"int16_t"
+.LASF186:
+	.string	"SubbandFilter_t"
+.LASF33:
+	.string	"__elision"
+.LASF35:
+	.string	"__pthread_cond_s"
+.LASF238:
+	.string	"subbandFilter_Free"
+.LASF42:
+	.string	"__g_signals"
+.LASF109:
+	.string	"LmsEngine_t"
+.LASF214:
+	.string	"filter"
+.LASF53:
+	.string	"LmsAllocator_t"
+.LASF67:
+	.string	"signUpdateDot"
+.LASF12:
+	.string	"__int64_t"
+.LASF85:
+	.string	"pendingGain"
+.LASF209:
+	.string	"correlation"
+.LASF263:
+	.string	"lmsEngine_Close"
+.LASF211:
+	.string	"factor"
+.LASF240:
+	.string	"subbandFilter_NormSquared"
+.LASF267:
+	.string	"lmsEngine_OpenApa"
+.LASF162:
+	.string	"synthesisWindow"
+.LASF220:
+	.string	"apaFilter_Init"
+.LASF51:
+	.string	"release"
+.LASF120:
+	.string	"Fft_t"
+.LASF268:
+	.string	"lmsEngine_OpenRls"
+.LASF248:
+	.string	"free"
+.LASF6:
+	.string	"short unsigned int"
+.LASF75:
+	.string	"LMS_FILTER_VARIANT_SIGN_SIGN"
+.LASF77:
+	.string	"LmsFilterVariant_t"
+.LASF207:
+	.string	"desiredIndex"
+.LASF135:
+	.string	"stepShift"
+.LASF225:
+	.string	"lmsFixed_StepShift"
+.LASF166:
+	.string	"referenceLine"
+.LASF15:
+	.string	"int64_t"
+.LASF187:
+	.string	"RLS_FILTER_FORM_AUTO"
+.LASF148:
+	.string	"numOfQueues"
+.LASF274:
+	.string	"fdaf"
+.LASF106:
+	.string	"close"
+.LASF299:
+	.string	"lmsEngine_FdafProcessBlock"
+.LASF136:
+	.string	"LmsFixed_t"
+.LASF66:
+	.string	"leakyUpdateDot"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/lmsEngine.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,23338 @@
+	.file	"lmsFilter.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsFilter.c"
+	.type	lmsFilter_DelayLinePush, @function
+lmsFilter_DelayLinePush:
+.LFB6:
+	.file 1 "source/lmsFilter.c"
+	.loc 1 124 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	movss	DWORD PTR -28[rbp], xmm0
+	.loc 1 125 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 125 15
+	add	eax, 1
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 126 33
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 126 51
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 126 44
+	cdqe
+	add	rax, 1
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 126 17
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 130 11
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 130 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 130 22
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 130 43
+	movss	xmm0, DWORD PTR -28[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 131 11
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 131 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 24[rax]
+	.loc 1 131 42
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 131 22
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 131 50
+	movss	xmm0, DWORD PTR -28[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 133 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 133 9
+	lea	edx, 1[rax]
+	.loc 1 133 8
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 24[rax], edx
+	.loc 1 133 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 133 8
+	cmp	DWORD PTR -4[rbp], eax
+	jne	.L2
+	.loc 1 135 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 24[rax], 0
+.L2:
+	.loc 1 138 11
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm1, QWORD PTR 40[rax]
+	.loc 1 138 22
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, DWORD PTR -28[rbp]
+	.loc 1 138 37
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -28[rbp]
+	mulsd	xmm0, xmm2
+	.loc 1 138 48
+	pxor	xmm3, xmm3
+	cvtss2sd	xmm3, DWORD PTR -8[rbp]
+	.loc 1 138 64
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, DWORD PTR -8[rbp]
+	mulsd	xmm2, xmm3
+	.loc 1 138 46
+	subsd	xmm0, xmm2
+	.loc 1 138 19
+	addsd	xmm0, xmm1
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	QWORD PTR 40[rax], xmm0
+	.loc 1 139 15
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm1, QWORD PTR 40[rax]
+	.loc 1 139 8
+	pxor	xmm0, xmm0
+	comisd	xmm0, xmm1
+	ja	.L5
+	.loc 1 143 1
+	jmp	.L6
+.L5:
+	.loc 1 141 23
+	mov	rax, QWORD PTR -24[rbp]
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR 40[rax], xmm0
+.L6:
+	.loc 1 143 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	lmsFilter_DelayLinePush, .-lmsFilter_DelayLinePush
+	.type	lmsFilter_ProcessBlockLms, @function
+lmsFilter_ProcessBlockLms:
+.LFB9:
+	.loc 1 245 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 176
+	mov	QWORD PTR -136[rbp], rdi
+	mov	QWORD PTR -144[rbp], rsi
+	mov	QWORD PTR -152[rbp], rdx
+	mov	QWORD PTR -160[rbp], rcx
+	mov	QWORD PTR -168[rbp], r8
+	mov	DWORD PTR -172[rbp], r9d
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	mov	rax, QWORD PTR -144[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	mov	rax, QWORD PTR -152[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	mov	rax, QWORD PTR -160[rbp]
+	mov	QWORD PTR -32[rbp], rax
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR -40[rbp], rax
+	mov	eax, DWORD PTR -172[rbp]
+	mov	DWORD PTR -44[rbp], eax
+.LBB35:
+.LBB36:
+	.loc 1 217 9
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 218 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 219 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -120[rbp], xmm0
+.LBB37:
+	.loc 1 221 14
+	mov	DWORD PTR -56[rbp], 0
+	.loc 1 221 5
+	jmp	.L8
+.L26:
+	.loc 1 223 13
+	cmp	QWORD PTR -24[rbp], 0
+	je	.L9
+	.loc 1 223 73
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 223 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	jmp	.L10
+.L9:
+	mov	eax, 0
+.L10:
+	.loc 1 223 40
+	mov	edx, DWORD PTR -56[rbp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	.loc 1 223 13
+	movss	xmm0, DWORD PTR [rdx]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR -64[rbp], rdx
+	movss	DWORD PTR -68[rbp], xmm0
+	mov	QWORD PTR -80[rbp], rax
+	lea	rax, -120[rbp]
+	mov	QWORD PTR -88[rbp], rax
+	mov	DWORD PTR -92[rbp], 0
+.LBB38:
+.LBB39:
+	.loc 1 163 5
+	mov	edx, DWORD PTR -68[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_DelayLinePush
+	.loc 1 165 36
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 165 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 165 47
+	sal	rax, 2
+	.loc 1 165 18
+	add	rax, rdx
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 166 18
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 4
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 168 5
+	cmp	DWORD PTR -92[rbp], 2
+	je	.L11
+	cmp	DWORD PTR -92[rbp], 2
+	jb	.L12
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, 4
+	cmp	eax, 1
+	ja	.L12
+	jmp	.L30
+.L11:
+	.loc 1 172 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 172 31
+	mov	r8, QWORD PTR 40[rax]
+	.loc 1 172 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 173 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 172 17
+	test	eax, eax
+	je	.L14
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm0, DWORD PTR 56[rax]
+	jmp	.L15
+.L14:
+	movss	xmm0, DWORD PTR .LC2[rip]
+.L15:
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL0:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 174 13
+	jmp	.L16
+.L30:
+	.loc 1 178 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 178 31
+	mov	r8, QWORD PTR 48[rax]
+	.loc 1 178 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL1:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 180 13
+	jmp	.L16
+.L12:
+	.loc 1 183 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 183 31
+	mov	r8, QWORD PTR 32[rax]
+	.loc 1 183 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL2:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 185 13
+	nop
+.L16:
+	.loc 1 188 44
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L17
+	mov	rax, QWORD PTR -80[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L18
+.L17:
+	mov	rax, QWORD PTR -112[rbp]
+	movss	xmm0, DWORD PTR [rax]
+.L18:
+	.loc 1 188 56
+	subss	xmm0, DWORD PTR -116[rbp]
+	.loc 1 188 12
+	mov	rax, QWORD PTR -88[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 190 5
+	cmp	DWORD PTR -92[rbp], 5
+	je	.L19
+	cmp	DWORD PTR -92[rbp], 5
+	ja	.L20
+	cmp	DWORD PTR -92[rbp], 1
+	je	.L21
+	cmp	DWORD PTR -92[rbp], 3
+	je	.L19
+	jmp	.L20
+.L21:
+	.loc 1 193 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 193 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 193 48
+	mulss	xmm0, xmm1
+	.loc 1 193 108
+	mov	rax, QWORD PTR -64[rbp]
+	movsd	xmm2, QWORD PTR 40[rax]
+	.loc 1 193 100
+	movsd	xmm1, QWORD PTR .LC3[rip]
+	addsd	xmm1, xmm2
+	.loc 1 193 61
+	cvtsd2ss	xmm1, xmm1
+	.loc 1 193 59
+	divss	xmm0, xmm1
+	.loc 1 193 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 194 13
+	jmp	.L22
+.L19:
+	.loc 1 198 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 198 59
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 198 66
+	pxor	xmm2, xmm2
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	edx, al
+	.loc 1 198 77
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 198 84
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	eax, al
+	.loc 1 198 74
+	sub	edx, eax
+	.loc 1 198 50
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, edx
+	.loc 1 198 48
+	mulss	xmm0, xmm1
+	.loc 1 198 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 199 13
+	jmp	.L22
+.L20:
+	.loc 1 202 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 202 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 202 48
+	mulss	xmm0, xmm1
+	.loc 1 202 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 203 13
+	nop
+.L22:
+	.loc 1 205 27
+	mov	rax, QWORD PTR -64[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 207 12
+	movss	xmm0, DWORD PTR -116[rbp]
+.LBE39:
+.LBE38:
+	.loc 1 223 13
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 225 12
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L24
+	.loc 1 227 19
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 227 23
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L24:
+	.loc 1 229 12
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L25
+	.loc 1 231 18
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 231 22
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L25:
+	.loc 1 221 40
+	add	DWORD PTR -56[rbp], 1
+.L8:
+	.loc 1 221 23
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jg	.L26
+.LBE37:
+	.loc 1 236 9
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	xmm1, DWORD PTR .LC4[rip]
+	andps	xmm1, xmm0
+	movss	xmm0, DWORD PTR .LC5[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 236 8
+	test	eax, eax
+	jne	.L27
+	.loc 1 238 16
+	mov	DWORD PTR -48[rbp], 1
+.L27:
+	.loc 1 240 12
+	mov	eax, DWORD PTR -48[rbp]
+.LBE36:
+.LBE35:
+	.loc 1 248 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	lmsFilter_ProcessBlockLms, .-lmsFilter_ProcessBlockLms
+	.type	lmsFilter_ProcessBlockNlms, @function
+lmsFilter_ProcessBlockNlms:
+.LFB10:
+	.loc 1 252 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 176
+	mov	QWORD PTR -136[rbp], rdi
+	mov	QWORD PTR -144[rbp], rsi
+	mov	QWORD PTR -152[rbp], rdx
+	mov	QWORD PTR -160[rbp], rcx
+	mov	QWORD PTR -168[rbp], r8
+	mov	DWORD PTR -172[rbp], r9d
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	mov	rax, QWORD PTR -144[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	mov	rax, QWORD PTR -152[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	mov	rax, QWORD PTR -160[rbp]
+	mov	QWORD PTR -32[rbp], rax
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR -40[rbp], rax
+	mov	eax, DWORD PTR -172[rbp]
+	mov	DWORD PTR -44[rbp], eax
+.LBB40:
+.LBB41:
+	.loc 1 217 9
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 218 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 219 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -120[rbp], xmm0
+.LBB42:
+	.loc 1 221 14
+	mov	DWORD PTR -56[rbp], 0
+	.loc 1 221 5
+	jmp	.L32
+.L50:
+	.loc 1 223 13
+	cmp	QWORD PTR -24[rbp], 0
+	je	.L33
+	.loc 1 223 73
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 223 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	jmp	.L34
+.L33:
+	mov	eax, 0
+.L34:
+	.loc 1 223 40
+	mov	edx, DWORD PTR -56[rbp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	.loc 1 223 13
+	movss	xmm0, DWORD PTR [rdx]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR -64[rbp], rdx
+	movss	DWORD PTR -68[rbp], xmm0
+	mov	QWORD PTR -80[rbp], rax
+	lea	rax, -120[rbp]
+	mov	QWORD PTR -88[rbp], rax
+	mov	DWORD PTR -92[rbp], 1
+.LBB43:
+.LBB44:
+	.loc 1 163 5
+	mov	edx, DWORD PTR -68[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_DelayLinePush
+	.loc 1 165 36
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 165 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 165 47
+	sal	rax, 2
+	.loc 1 165 18
+	add	rax, rdx
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 166 18
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 4
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 168 5
+	cmp	DWORD PTR -92[rbp], 2
+	je	.L35
+	cmp	DWORD PTR -92[rbp], 2
+	jb	.L36
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, 4
+	cmp	eax, 1
+	ja	.L36
+	jmp	.L54
+.L35:
+	.loc 1 172 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 172 31
+	mov	r8, QWORD PTR 40[rax]
+	.loc 1 172 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 173 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 172 17
+	test	eax, eax
+	je	.L38
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm0, DWORD PTR 56[rax]
+	jmp	.L39
+.L38:
+	movss	xmm0, DWORD PTR .LC2[rip]
+.L39:
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL3:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 174 13
+	jmp	.L40
+.L54:
+	.loc 1 178 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 178 31
+	mov	r8, QWORD PTR 48[rax]
+	.loc 1 178 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL4:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 180 13
+	jmp	.L40
+.L36:
+	.loc 1 183 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 183 31
+	mov	r8, QWORD PTR 32[rax]
+	.loc 1 183 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL5:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 185 13
+	nop
+.L40:
+	.loc 1 188 44
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L41
+	mov	rax, QWORD PTR -80[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L42
+.L41:
+	mov	rax, QWORD PTR -112[rbp]
+	movss	xmm0, DWORD PTR [rax]
+.L42:
+	.loc 1 188 56
+	subss	xmm0, DWORD PTR -116[rbp]
+	.loc 1 188 12
+	mov	rax, QWORD PTR -88[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 190 5
+	cmp	DWORD PTR -92[rbp], 5
+	je	.L43
+	cmp	DWORD PTR -92[rbp], 5
+	ja	.L44
+	cmp	DWORD PTR -92[rbp], 1
+	je	.L45
+	cmp	DWORD PTR -92[rbp], 3
+	je	.L43
+	jmp	.L44
+.L45:
+	.loc 1 193 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 193 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 193 48
+	mulss	xmm0, xmm1
+	.loc 1 193 108
+	mov	rax, QWORD PTR -64[rbp]
+	movsd	xmm2, QWORD PTR 40[rax]
+	.loc 1 193 100
+	movsd	xmm1, QWORD PTR .LC3[rip]
+	addsd	xmm1, xmm2
+	.loc 1 193 61
+	cvtsd2ss	xmm1, xmm1
+	.loc 1 193 59
+	divss	xmm0, xmm1
+	.loc 1 193 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 194 13
+	jmp	.L46
+.L43:
+	.loc 1 198 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 198 59
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 198 66
+	pxor	xmm2, xmm2
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	edx, al
+	.loc 1 198 77
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 198 84
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	eax, al
+	.loc 1 198 74
+	sub	edx, eax
+	.loc 1 198 50
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, edx
+	.loc 1 198 48
+	mulss	xmm0, xmm1
+	.loc 1 198 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 199 13
+	jmp	.L46
+.L44:
+	.loc 1 202 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 202 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 202 48
+	mulss	xmm0, xmm1
+	.loc 1 202 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 203 13
+	nop
+.L46:
+	.loc 1 205 27
+	mov	rax, QWORD PTR -64[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 207 12
+	movss	xmm0, DWORD PTR -116[rbp]
+.LBE44:
+.LBE43:
+	.loc 1 223 13
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 225 12
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L48
+	.loc 1 227 19
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 227 23
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L48:
+	.loc 1 229 12
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L49
+	.loc 1 231 18
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 231 22
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L49:
+	.loc 1 221 40
+	add	DWORD PTR -56[rbp], 1
+.L32:
+	.loc 1 221 23
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jg	.L50
+.LBE42:
+	.loc 1 236 9
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	xmm1, DWORD PTR .LC4[rip]
+	andps	xmm1, xmm0
+	movss	xmm0, DWORD PTR .LC5[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 236 8
+	test	eax, eax
+	jne	.L51
+	.loc 1 238 16
+	mov	DWORD PTR -48[rbp], 1
+.L51:
+	.loc 1 240 12
+	mov	eax, DWORD PTR -48[rbp]
+.LBE41:
+.LBE40:
+	.loc 1 255 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	lmsFilter_ProcessBlockNlms, .-lmsFilter_ProcessBlockNlms
+	.type	lmsFilter_ProcessBlockLeaky, @function
+lmsFilter_ProcessBlockLeaky:
+.LFB11:
+	.loc 1 259 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 176
+	mov	QWORD PTR -136[rbp], rdi
+	mov	QWORD PTR -144[rbp], rsi
+	mov	QWORD PTR -152[rbp], rdx
+	mov	QWORD PTR -160[rbp], rcx
+	mov	QWORD PTR -168[rbp], r8
+	mov	DWORD PTR -172[rbp], r9d
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	mov	rax, QWORD PTR -144[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	mov	rax, QWORD PTR -152[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	mov	rax, QWORD PTR -160[rbp]
+	mov	QWORD PTR -32[rbp], rax
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR -40[rbp], rax
+	mov	eax, DWORD PTR -172[rbp]
+	mov	DWORD PTR -44[rbp], eax
+.LBB45:
+.LBB46:
+	.loc 1 217 9
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 218 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 219 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -120[rbp], xmm0
+.LBB47:
+	.loc 1 221 14
+	mov	DWORD PTR -56[rbp], 0
+	.loc 1 221 5
+	jmp	.L56
+.L74:
+	.loc 1 223 13
+	cmp	QWORD PTR -24[rbp], 0
+	je	.L57
+	.loc 1 223 73
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 223 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	jmp	.L58
+.L57:
+	mov	eax, 0
+.L58:
+	.loc 1 223 40
+	mov	edx, DWORD PTR -56[rbp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	.loc 1 223 13
+	movss	xmm0, DWORD PTR [rdx]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR -64[rbp], rdx
+	movss	DWORD PTR -68[rbp], xmm0
+	mov	QWORD PTR -80[rbp], rax
+	lea	rax, -120[rbp]
+	mov	QWORD PTR -88[rbp], rax
+	mov	DWORD PTR -92[rbp], 2
+.LBB48:
+.LBB49:
+	.loc 1 163 5
+	mov	edx, DWORD PTR -68[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_DelayLinePush
+	.loc 1 165 36
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 165 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 165 47
+	sal	rax, 2
+	.loc 1 165 18
+	add	rax, rdx
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 166 18
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 4
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 168 5
+	cmp	DWORD PTR -92[rbp], 2
+	je	.L59
+	cmp	DWORD PTR -92[rbp], 2
+	jb	.L60
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, 4
+	cmp	eax, 1
+	ja	.L60
+	jmp	.L78
+.L59:
+	.loc 1 172 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 172 31
+	mov	r8, QWORD PTR 40[rax]
+	.loc 1 172 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 173 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 172 17
+	test	eax, eax
+	je	.L62
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm0, DWORD PTR 56[rax]
+	jmp	.L63
+.L62:
+	movss	xmm0, DWORD PTR .LC2[rip]
+.L63:
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL6:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 174 13
+	jmp	.L64
+.L78:
+	.loc 1 178 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 178 31
+	mov	r8, QWORD PTR 48[rax]
+	.loc 1 178 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL7:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 180 13
+	jmp	.L64
+.L60:
+	.loc 1 183 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 183 31
+	mov	r8, QWORD PTR 32[rax]
+	.loc 1 183 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL8:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 185 13
+	nop
+.L64:
+	.loc 1 188 44
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L65
+	mov	rax, QWORD PTR -80[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L66
+.L65:
+	mov	rax, QWORD PTR -112[rbp]
+	movss	xmm0, DWORD PTR [rax]
+.L66:
+	.loc 1 188 56
+	subss	xmm0, DWORD PTR -116[rbp]
+	.loc 1 188 12
+	mov	rax, QWORD PTR -88[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 190 5
+	cmp	DWORD PTR -92[rbp], 5
+	je	.L67
+	cmp	DWORD PTR -92[rbp], 5
+	ja	.L68
+	cmp	DWORD PTR -92[rbp], 1
+	je	.L69
+	cmp	DWORD PTR -92[rbp], 3
+	je	.L67
+	jmp	.L68
+.L69:
+	.loc 1 193 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 193 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 193 48
+	mulss	xmm0, xmm1
+	.loc 1 193 108
+	mov	rax, QWORD PTR -64[rbp]
+	movsd	xmm2, QWORD PTR 40[rax]
+	.loc 1 193 100
+	movsd	xmm1, QWORD PTR .LC3[rip]
+	addsd	xmm1, xmm2
+	.loc 1 193 61
+	cvtsd2ss	xmm1, xmm1
+	.loc 1 193 59
+	divss	xmm0, xmm1
+	.loc 1 193 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 194 13
+	jmp	.L70
+.L67:
+	.loc 1 198 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 198 59
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 198 66
+	pxor	xmm2, xmm2
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	edx, al
+	.loc 1 198 77
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 198 84
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	eax, al
+	.loc 1 198 74
+	sub	edx, eax
+	.loc 1 198 50
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, edx
+	.loc 1 198 48
+	mulss	xmm0, xmm1
+	.loc 1 198 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 199 13
+	jmp	.L70
+.L68:
+	.loc 1 202 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 202 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 202 48
+	mulss	xmm0, xmm1
+	.loc 1 202 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 203 13
+	nop
+.L70:
+	.loc 1 205 27
+	mov	rax, QWORD PTR -64[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 207 12
+	movss	xmm0, DWORD PTR -116[rbp]
+.LBE49:
+.LBE48:
+	.loc 1 223 13
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 225 12
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L72
+	.loc 1 227 19
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 227 23
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L72:
+	.loc 1 229 12
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L73
+	.loc 1 231 18
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 231 22
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L73:
+	.loc 1 221 40
+	add	DWORD PTR -56[rbp], 1
+.L56:
+	.loc 1 221 23
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jg	.L74
+.LBE47:
+	.loc 1 236 9
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	xmm1, DWORD PTR .LC4[rip]
+	andps	xmm1, xmm0
+	movss	xmm0, DWORD PTR .LC5[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 236 8
+	test	eax, eax
+	jne	.L75
+	.loc 1 238 16
+	mov	DWORD PTR -48[rbp], 1
+.L75:
+	.loc 1 240 12
+	mov	eax, DWORD PTR -48[rbp]
+.LBE46:
+.LBE45:
+	.loc 1 262 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	lmsFilter_ProcessBlockLeaky, .-lmsFilter_ProcessBlockLeaky
+	.type	lmsFilter_ProcessBlockSignError, @function
+lmsFilter_ProcessBlockSignError:
+.LFB12:
+	.loc 1 266 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 176
+	mov	QWORD PTR -136[rbp], rdi
+	mov	QWORD PTR -144[rbp], rsi
+	mov	QWORD PTR -152[rbp], rdx
+	mov	QWORD PTR -160[rbp], rcx
+	mov	QWORD PTR -168[rbp], r8
+	mov	DWORD PTR -172[rbp], r9d
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	mov	rax, QWORD PTR -144[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	mov	rax, QWORD PTR -152[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	mov	rax, QWORD PTR -160[rbp]
+	mov	QWORD PTR -32[rbp], rax
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR -40[rbp], rax
+	mov	eax, DWORD PTR -172[rbp]
+	mov	DWORD PTR -44[rbp], eax
+.LBB50:
+.LBB51:
+	.loc 1 217 9
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 218 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 219 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -120[rbp], xmm0
+.LBB52:
+	.loc 1 221 14
+	mov	DWORD PTR -56[rbp], 0
+	.loc 1 221 5
+	jmp	.L80
+.L98:
+	.loc 1 223 13
+	cmp	QWORD PTR -24[rbp], 0
+	je	.L81
+	.loc 1 223 73
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 223 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	jmp	.L82
+.L81:
+	mov	eax, 0
+.L82:
+	.loc 1 223 40
+	mov	edx, DWORD PTR -56[rbp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	.loc 1 223 13
+	movss	xmm0, DWORD PTR [rdx]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR -64[rbp], rdx
+	movss	DWORD PTR -68[rbp], xmm0
+	mov	QWORD PTR -80[rbp], rax
+	lea	rax, -120[rbp]
+	mov	QWORD PTR -88[rbp], rax
+	mov	DWORD PTR -92[rbp], 3
+.LBB53:
+.LBB54:
+	.loc 1 163 5
+	mov	edx, DWORD PTR -68[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_DelayLinePush
+	.loc 1 165 36
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 165 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 165 47
+	sal	rax, 2
+	.loc 1 165 18
+	add	rax, rdx
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 166 18
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 4
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 168 5
+	cmp	DWORD PTR -92[rbp], 2
+	je	.L83
+	cmp	DWORD PTR -92[rbp], 2
+	jb	.L84
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, 4
+	cmp	eax, 1
+	ja	.L84
+	jmp	.L102
+.L83:
+	.loc 1 172 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 172 31
+	mov	r8, QWORD PTR 40[rax]
+	.loc 1 172 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 173 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 172 17
+	test	eax, eax
+	je	.L86
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm0, DWORD PTR 56[rax]
+	jmp	.L87
+.L86:
+	movss	xmm0, DWORD PTR .LC2[rip]
+.L87:
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL9:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 174 13
+	jmp	.L88
+.L102:
+	.loc 1 178 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 178 31
+	mov	r8, QWORD PTR 48[rax]
+	.loc 1 178 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL10:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 180 13
+	jmp	.L88
+.L84:
+	.loc 1 183 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 183 31
+	mov	r8, QWORD PTR 32[rax]
+	.loc 1 183 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL11:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 185 13
+	nop
+.L88:
+	.loc 1 188 44
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L89
+	mov	rax, QWORD PTR -80[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L90
+.L89:
+	mov	rax, QWORD PTR -112[rbp]
+	movss	xmm0, DWORD PTR [rax]
+.L90:
+	.loc 1 188 56
+	subss	xmm0, DWORD PTR -116[rbp]
+	.loc 1 188 12
+	mov	rax, QWORD PTR -88[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 190 5
+	cmp	DWORD PTR -92[rbp], 5
+	je	.L91
+	cmp	DWORD PTR -92[rbp], 5
+	ja	.L92
+	cmp	DWORD PTR -92[rbp], 1
+	je	.L93
+	cmp	DWORD PTR -92[rbp], 3
+	je	.L91
+	jmp	.L92
+.L93:
+	.loc 1 193 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 193 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 193 48
+	mulss	xmm0, xmm1
+	.loc 1 193 108
+	mov	rax, QWORD PTR -64[rbp]
+	movsd	xmm2, QWORD PTR 40[rax]
+	.loc 1 193 100
+	movsd	xmm1, QWORD PTR .LC3[rip]
+	addsd	xmm1, xmm2
+	.loc 1 193 61
+	cvtsd2ss	xmm1, xmm1
+	.loc 1 193 59
+	divss	xmm0, xmm1
+	.loc 1 193 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 194 13
+	jmp	.L94
+.L91:
+	.loc 1 198 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 198 59
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 198 66
+	pxor	xmm2, xmm2
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	edx, al
+	.loc 1 198 77
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 198 84
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	eax, al
+	.loc 1 198 74
+	sub	edx, eax
+	.loc 1 198 50
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, edx
+	.loc 1 198 48
+	mulss	xmm0, xmm1
+	.loc 1 198 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 199 13
+	jmp	.L94
+.L92:
+	.loc 1 202 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 202 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 202 48
+	mulss	xmm0, xmm1
+	.loc 1 202 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 203 13
+	nop
+.L94:
+	.loc 1 205 27
+	mov	rax, QWORD PTR -64[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 207 12
+	movss	xmm0, DWORD PTR -116[rbp]
+.LBE54:
+.LBE53:
+	.loc 1 223 13
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 225 12
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L96
+	.loc 1 227 19
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 227 23
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L96:
+	.loc 1 229 12
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L97
+	.loc 1 231 18
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 231 22
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L97:
+	.loc 1 221 40
+	add	DWORD PTR -56[rbp], 1
+.L80:
+	.loc 1 221 23
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jg	.L98
+.LBE52:
+	.loc 1 236 9
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	xmm1, DWORD PTR .LC4[rip]
+	andps	xmm1, xmm0
+	movss	xmm0, DWORD PTR .LC5[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 236 8
+	test	eax, eax
+	jne	.L99
+	.loc 1 238 16
+	mov	DWORD PTR -48[rbp], 1
+.L99:
+	.loc 1 240 12
+	mov	eax, DWORD PTR -48[rbp]
+.LBE51:
+.LBE50:
+	.loc 1 269 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	lmsFilter_ProcessBlockSignError, .-lmsFilter_ProcessBlockSignError
+	.type	lmsFilter_ProcessBlockSignData, @function
+lmsFilter_ProcessBlockSignData:
+.LFB13:
+	.loc 1 273 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 176
+	mov	QWORD PTR -136[rbp], rdi
+	mov	QWORD PTR -144[rbp], rsi
+	mov	QWORD PTR -152[rbp], rdx
+	mov	QWORD PTR -160[rbp], rcx
+	mov	QWORD PTR -168[rbp], r8
+	mov	DWORD PTR -172[rbp], r9d
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	mov	rax, QWORD PTR -144[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	mov	rax, QWORD PTR -152[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	mov	rax, QWORD PTR -160[rbp]
+	mov	QWORD PTR -32[rbp], rax
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR -40[rbp], rax
+	mov	eax, DWORD PTR -172[rbp]
+	mov	DWORD PTR -44[rbp], eax
+.LBB55:
+.LBB56:
+	.loc 1 217 9
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 218 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 219 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -120[rbp], xmm0
+.LBB57:
+	.loc 1 221 14
+	mov	DWORD PTR -56[rbp], 0
+	.loc 1 221 5
+	jmp	.L104
+.L122:
+	.loc 1 223 13
+	cmp	QWORD PTR -24[rbp], 0
+	je	.L105
+	.loc 1 223 73
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 223 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	jmp	.L106
+.L105:
+	mov	eax, 0
+.L106:
+	.loc 1 223 40
+	mov	edx, DWORD PTR -56[rbp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	.loc 1 223 13
+	movss	xmm0, DWORD PTR [rdx]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR -64[rbp], rdx
+	movss	DWORD PTR -68[rbp], xmm0
+	mov	QWORD PTR -80[rbp], rax
+	lea	rax, -120[rbp]
+	mov	QWORD PTR -88[rbp], rax
+	mov	DWORD PTR -92[rbp], 4
+.LBB58:
+.LBB59:
+	.loc 1 163 5
+	mov	edx, DWORD PTR -68[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_DelayLinePush
+	.loc 1 165 36
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 165 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 165 47
+	sal	rax, 2
+	.loc 1 165 18
+	add	rax, rdx
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 166 18
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 4
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 168 5
+	cmp	DWORD PTR -92[rbp], 2
+	je	.L107
+	cmp	DWORD PTR -92[rbp], 2
+	jb	.L108
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, 4
+	cmp	eax, 1
+	ja	.L108
+	jmp	.L126
+.L107:
+	.loc 1 172 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 172 31
+	mov	r8, QWORD PTR 40[rax]
+	.loc 1 172 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 173 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 172 17
+	test	eax, eax
+	je	.L110
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm0, DWORD PTR 56[rax]
+	jmp	.L111
+.L110:
+	movss	xmm0, DWORD PTR .LC2[rip]
+.L111:
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL12:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 174 13
+	jmp	.L112
+.L126:
+	.loc 1 178 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 178 31
+	mov	r8, QWORD PTR 48[rax]
+	.loc 1 178 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL13:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 180 13
+	jmp	.L112
+.L108:
+	.loc 1 183 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 183 31
+	mov	r8, QWORD PTR 32[rax]
+	.loc 1 183 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL14:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 185 13
+	nop
+.L112:
+	.loc 1 188 44
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L113
+	mov	rax, QWORD PTR -80[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L114
+.L113:
+	mov	rax, QWORD PTR -112[rbp]
+	movss	xmm0, DWORD PTR [rax]
+.L114:
+	.loc 1 188 56
+	subss	xmm0, DWORD PTR -116[rbp]
+	.loc 1 188 12
+	mov	rax, QWORD PTR -88[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 190 5
+	cmp	DWORD PTR -92[rbp], 5
+	je	.L115
+	cmp	DWORD PTR -92[rbp], 5
+	ja	.L116
+	cmp	DWORD PTR -92[rbp], 1
+	je	.L117
+	cmp	DWORD PTR -92[rbp], 3
+	je	.L115
+	jmp	.L116
+.L117:
+	.loc 1 193 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 193 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 193 48
+	mulss	xmm0, xmm1
+	.loc 1 193 108
+	mov	rax, QWORD PTR -64[rbp]
+	movsd	xmm2, QWORD PTR 40[rax]
+	.loc 1 193 100
+	movsd	xmm1, QWORD PTR .LC3[rip]
+	addsd	xmm1, xmm2
+	.loc 1 193 61
+	cvtsd2ss	xmm1, xmm1
+	.loc 1 193 59
+	divss	xmm0, xmm1
+	.loc 1 193 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 194 13
+	jmp	.L118
+.L115:
+	.loc 1 198 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 198 59
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 198 66
+	pxor	xmm2, xmm2
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	edx, al
+	.loc 1 198 77
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 198 84
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	eax, al
+	.loc 1 198 74
+	sub	edx, eax
+	.loc 1 198 50
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, edx
+	.loc 1 198 48
+	mulss	xmm0, xmm1
+	.loc 1 198 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 199 13
+	jmp	.L118
+.L116:
+	.loc 1 202 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 202 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 202 48
+	mulss	xmm0, xmm1
+	.loc 1 202 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 203 13
+	nop
+.L118:
+	.loc 1 205 27
+	mov	rax, QWORD PTR -64[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 207 12
+	movss	xmm0, DWORD PTR -116[rbp]
+.LBE59:
+.LBE58:
+	.loc 1 223 13
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 225 12
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L120
+	.loc 1 227 19
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 227 23
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L120:
+	.loc 1 229 12
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L121
+	.loc 1 231 18
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 231 22
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L121:
+	.loc 1 221 40
+	add	DWORD PTR -56[rbp], 1
+.L104:
+	.loc 1 221 23
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jg	.L122
+.LBE57:
+	.loc 1 236 9
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	xmm1, DWORD PTR .LC4[rip]
+	andps	xmm1, xmm0
+	movss	xmm0, DWORD PTR .LC5[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 236 8
+	test	eax, eax
+	jne	.L123
+	.loc 1 238 16
+	mov	DWORD PTR -48[rbp], 1
+.L123:
+	.loc 1 240 12
+	mov	eax, DWORD PTR -48[rbp]
+.LBE56:
+.LBE55:
+	.loc 1 276 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	lmsFilter_ProcessBlockSignData, .-lmsFilter_ProcessBlockSignData
+	.type	lmsFilter_ProcessBlockSignSign, @function
+lmsFilter_ProcessBlockSignSign:
+.LFB14:
+	.loc 1 280 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 176
+	mov	QWORD PTR -136[rbp], rdi
+	mov	QWORD PTR -144[rbp], rsi
+	mov	QWORD PTR -152[rbp], rdx
+	mov	QWORD PTR -160[rbp], rcx
+	mov	QWORD PTR -168[rbp], r8
+	mov	DWORD PTR -172[rbp], r9d
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	mov	rax, QWORD PTR -144[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	mov	rax, QWORD PTR -152[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	mov	rax, QWORD PTR -160[rbp]
+	mov	QWORD PTR -32[rbp], rax
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR -40[rbp], rax
+	mov	eax, DWORD PTR -172[rbp]
+	mov	DWORD PTR -44[rbp], eax
+.LBB60:
+.LBB61:
+	.loc 1 217 9
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 218 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 219 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -120[rbp], xmm0
+.LBB62:
+	.loc 1 221 14
+	mov	DWORD PTR -56[rbp], 0
+	.loc 1 221 5
+	jmp	.L128
+.L146:
+	.loc 1 223 13
+	cmp	QWORD PTR -24[rbp], 0
+	je	.L129
+	.loc 1 223 73
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 223 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	jmp	.L130
+.L129:
+	mov	eax, 0
+.L130:
+	.loc 1 223 40
+	mov	edx, DWORD PTR -56[rbp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	.loc 1 223 13
+	movss	xmm0, DWORD PTR [rdx]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR -64[rbp], rdx
+	movss	DWORD PTR -68[rbp], xmm0
+	mov	QWORD PTR -80[rbp], rax
+	lea	rax, -120[rbp]
+	mov	QWORD PTR -88[rbp], rax
+	mov	DWORD PTR -92[rbp], 5
+.LBB63:
+.LBB64:
+	.loc 1 163 5
+	mov	edx, DWORD PTR -68[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_DelayLinePush
+	.loc 1 165 36
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 165 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 165 47
+	sal	rax, 2
+	.loc 1 165 18
+	add	rax, rdx
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 166 18
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 4
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 168 5
+	cmp	DWORD PTR -92[rbp], 2
+	je	.L131
+	cmp	DWORD PTR -92[rbp], 2
+	jb	.L132
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, 4
+	cmp	eax, 1
+	ja	.L132
+	jmp	.L150
+.L131:
+	.loc 1 172 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 172 31
+	mov	r8, QWORD PTR 40[rax]
+	.loc 1 172 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	.loc 1 173 54
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 172 17
+	test	eax, eax
+	je	.L134
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm0, DWORD PTR 56[rax]
+	jmp	.L135
+.L134:
+	movss	xmm0, DWORD PTR .LC2[rip]
+.L135:
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL15:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 174 13
+	jmp	.L136
+.L150:
+	.loc 1 178 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 178 31
+	mov	r8, QWORD PTR 48[rax]
+	.loc 1 178 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL16:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 180 13
+	jmp	.L136
+.L132:
+	.loc 1 183 23
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 183 31
+	mov	r8, QWORD PTR 32[rax]
+	.loc 1 183 17
+	mov	rax, QWORD PTR -64[rbp]
+	mov	ecx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edi, DWORD PTR 28[rax]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -112[rbp]
+	mov	rsi, QWORD PTR -104[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	r8
+.LVL17:
+	movd	eax, xmm0
+	mov	DWORD PTR -116[rbp], eax
+	.loc 1 185 13
+	nop
+.L136:
+	.loc 1 188 44
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L137
+	mov	rax, QWORD PTR -80[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L138
+.L137:
+	mov	rax, QWORD PTR -112[rbp]
+	movss	xmm0, DWORD PTR [rax]
+.L138:
+	.loc 1 188 56
+	subss	xmm0, DWORD PTR -116[rbp]
+	.loc 1 188 12
+	mov	rax, QWORD PTR -88[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 190 5
+	cmp	DWORD PTR -92[rbp], 5
+	je	.L139
+	cmp	DWORD PTR -92[rbp], 5
+	ja	.L140
+	cmp	DWORD PTR -92[rbp], 1
+	je	.L141
+	cmp	DWORD PTR -92[rbp], 3
+	je	.L139
+	jmp	.L140
+.L141:
+	.loc 1 193 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 193 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 193 48
+	mulss	xmm0, xmm1
+	.loc 1 193 108
+	mov	rax, QWORD PTR -64[rbp]
+	movsd	xmm2, QWORD PTR 40[rax]
+	.loc 1 193 100
+	movsd	xmm1, QWORD PTR .LC3[rip]
+	addsd	xmm1, xmm2
+	.loc 1 193 61
+	cvtsd2ss	xmm1, xmm1
+	.loc 1 193 59
+	divss	xmm0, xmm1
+	.loc 1 193 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 194 13
+	jmp	.L142
+.L139:
+	.loc 1 198 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 198 59
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 198 66
+	pxor	xmm2, xmm2
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	edx, al
+	.loc 1 198 77
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 198 84
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	eax, al
+	.loc 1 198 74
+	sub	edx, eax
+	.loc 1 198 50
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, edx
+	.loc 1 198 48
+	mulss	xmm0, xmm1
+	.loc 1 198 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 199 13
+	jmp	.L142
+.L140:
+	.loc 1 202 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 202 51
+	mov	rax, QWORD PTR -88[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 202 48
+	mulss	xmm0, xmm1
+	.loc 1 202 33
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 203 13
+	nop
+.L142:
+	.loc 1 205 27
+	mov	rax, QWORD PTR -64[rbp]
+	mov	DWORD PTR 32[rax], 1
+	.loc 1 207 12
+	movss	xmm0, DWORD PTR -116[rbp]
+.LBE64:
+.LBE63:
+	.loc 1 223 13
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 225 12
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L144
+	.loc 1 227 19
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 227 23
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L144:
+	.loc 1 229 12
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L145
+	.loc 1 231 18
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 231 22
+	movss	xmm0, DWORD PTR -120[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L145:
+	.loc 1 221 40
+	add	DWORD PTR -56[rbp], 1
+.L128:
+	.loc 1 221 23
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jg	.L146
+.LBE62:
+	.loc 1 236 9
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	xmm1, DWORD PTR .LC4[rip]
+	andps	xmm1, xmm0
+	movss	xmm0, DWORD PTR .LC5[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 236 8
+	test	eax, eax
+	jne	.L147
+	.loc 1 238 16
+	mov	DWORD PTR -48[rbp], 1
+.L147:
+	.loc 1 240 12
+	mov	eax, DWORD PTR -48[rbp]
+.LBE61:
+.LBE60:
+	.loc 1 283 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	lmsFilter_ProcessBlockSignSign, .-lmsFilter_ProcessBlockSignSign
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	lmsFilterProcessBlocks, @object
+	.size	lmsFilterProcessBlocks, 48
+lmsFilterProcessBlocks:
+	.quad	lmsFilter_ProcessBlockLms
+	.quad	lmsFilter_ProcessBlockNlms
+	.quad	lmsFilter_ProcessBlockLeaky
+	.quad	lmsFilter_ProcessBlockSignError
+	.quad	lmsFilter_ProcessBlockSignData
+	.quad	lmsFilter_ProcessBlockSignSign
+	.section	.rodata
+.LC6:
+	.string	"lms"
+.LC7:
+	.string	"nlms"
+.LC8:
+	.string	"leaky"
+.LC9:
+	.string	"sign-error"
+.LC10:
+	.string	"sign-data"
+.LC11:
+	.string	"sign-sign"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	lmsFilterVariantNames, @object
+	.size	lmsFilterVariantNames, 48
+lmsFilterVariantNames:
+	.quad	.LC6
+	.quad	.LC7
+	.quad	.LC8
+	.quad	.LC9
+	.quad	.LC10
+	.quad	.LC11
+	.text
+	.globl	lmsFilter_Init
+	.type	lmsFilter_Init, @function
+lmsFilter_Init:
+.LFB15:
+	.loc 1 306 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	mov	DWORD PTR -16[rbp], esi
+	.loc 1 307 12
+	mov	esi, DWORD PTR -16[rbp]
+	mov	edi, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, 0
+	pxor	xmm1, xmm1
+	mov	edx, 0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	lmsFilter_InitVariant
+	.loc 1 308 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	lmsFilter_Init, .-lmsFilter_Init
+	.globl	lmsFilter_InitWithAllocator
+	.type	lmsFilter_InitWithAllocator, @function
+lmsFilter_InitWithAllocator:
+.LFB16:
+	.loc 1 311 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	mov	DWORD PTR -16[rbp], esi
+	mov	QWORD PTR -24[rbp], rdx
+	.loc 1 312 12
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR -16[rbp]
+	mov	edi, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rdx
+	pxor	xmm1, xmm1
+	mov	edx, 0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	lmsFilter_InitVariant
+	.loc 1 313 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	lmsFilter_InitWithAllocator, .-lmsFilter_InitWithAllocator
+	.globl	lmsFilter_RequiredMemory
+	.type	lmsFilter_RequiredMemory, @function
+lmsFilter_RequiredMemory:
+.LFB17:
+	.loc 1 316 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 24
+	.cfi_offset 3, -24
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 318 37
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	.loc 1 318 12
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	rbx, rax
+	.loc 1 319 44
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	.loc 1 319 59
+	add	rax, 1
+	.loc 1 319 14
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	.loc 1 319 12
+	add	rax, rbx
+	.loc 1 320 12
+	add	rax, 64
+	.loc 1 321 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	lmsFilter_RequiredMemory, .-lmsFilter_RequiredMemory
+	.section	.rodata
+	.align 8
+.LC12:
+	.string	"Error allocating filter of length %d\n"
+.LC13:
+	.string	"Wrong filter length %d\n"
+	.text
+	.globl	lmsFilter_InitVariant
+	.type	lmsFilter_InitVariant, @function
+lmsFilter_InitVariant:
+.LFB18:
+	.loc 1 325 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	movss	DWORD PTR -44[rbp], xmm0
+	mov	DWORD PTR -48[rbp], esi
+	mov	DWORD PTR -52[rbp], edx
+	movss	DWORD PTR -56[rbp], xmm1
+	mov	QWORD PTR -64[rbp], rcx
+	.loc 1 326 9
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 328 8
+	cmp	QWORD PTR -64[rbp], 0
+	jne	.L158
+	.loc 1 330 21
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -64[rbp], rax
+.L158:
+	.loc 1 332 8
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L159
+	.loc 1 332 44 discriminator 1
+	cmp	DWORD PTR -52[rbp], 5
+	ja	.L159
+	.loc 1 334 12
+	cmp	DWORD PTR -48[rbp], 0
+	jle	.L160
+	.loc 1 334 26 discriminator 1
+	cmp	DWORD PTR -48[rbp], 0
+	js	.L160
+.LBB65:
+	.loc 1 336 70
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	.loc 1 336 45
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 337 48
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	.loc 1 337 63
+	add	rax, 1
+	.loc 1 337 26
+	sal	rax, 3
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 339 39
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rcx, QWORD PTR [rax]
+	.loc 1 339 30
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rsi, [rdx+rax]
+	.loc 1 339 59
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 339 30
+	mov	edx, 64
+	mov	rdi, rax
+	call	rcx
+.LVL18:
+	.loc 1 339 28
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 104[rdx], rax
+	.loc 1 341 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 341 16
+	test	rax, rax
+	je	.L161
+	.loc 1 343 30
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR -44[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 344 32
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -48[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 345 36
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 24[rax], 0
+	.loc 1 346 37
+	mov	rax, QWORD PTR -40[rbp]
+	pxor	xmm0, xmm0
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 347 39
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 32[rax], 0
+	.loc 1 348 31
+	mov	rax, QWORD PTR -40[rbp]
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR 40[rax], xmm0
+	.loc 1 349 33
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	DWORD PTR 48[rax], edx
+	.loc 1 350 33
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR -56[rbp]
+	movss	DWORD PTR 52[rax], xmm0
+	.loc 1 351 44
+	movss	xmm0, DWORD PTR -44[rbp]
+	movaps	xmm1, xmm0
+	mulss	xmm1, DWORD PTR -56[rbp]
+	.loc 1 351 37
+	movss	xmm0, DWORD PTR .LC2[rip]
+	subss	xmm0, xmm1
+	.loc 1 351 30
+	mov	rax, QWORD PTR -40[rbp]
+	movss	DWORD PTR 56[rax], xmm0
+	.loc 1 352 62
+	mov	eax, DWORD PTR -52[rbp]
+	lea	rdx, 0[0+rax*8]
+	lea	rax, lmsFilterProcessBlocks[rip]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 352 38
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	.loc 1 353 34
+	call	lmsKernel_GetBest@PLT
+	.loc 1 353 32
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 72[rdx], rax
+	.loc 1 354 35
+	mov	rcx, QWORD PTR -40[rbp]
+	mov	rsi, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR [rsi]
+	mov	rdx, QWORD PTR 8[rsi]
+	mov	QWORD PTR 80[rcx], rax
+	mov	QWORD PTR 88[rcx], rdx
+	mov	rax, QWORD PTR 16[rsi]
+	mov	QWORD PTR 96[rcx], rax
+	.loc 1 355 54
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 104[rax]
+	.loc 1 355 38
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 356 68
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 104[rax]
+	.loc 1 356 37
+	mov	rax, QWORD PTR -16[rbp]
+	add	rdx, rax
+	.loc 1 356 35
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 358 17
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 359 24
+	mov	DWORD PTR -4[rbp], 0
+.LBE65:
+	.loc 1 335 9
+	jmp	.L159
+.L161:
+.LBB66:
+	.loc 1 363 17
+	mov	eax, DWORD PTR -48[rbp]
+	mov	esi, eax
+	lea	rax, .LC12[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.LBE66:
+	.loc 1 335 9
+	jmp	.L159
+.L160:
+	.loc 1 368 13
+	mov	eax, DWORD PTR -48[rbp]
+	mov	esi, eax
+	lea	rax, .LC13[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L159:
+	.loc 1 371 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 372 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	lmsFilter_InitVariant, .-lmsFilter_InitVariant
+	.globl	lmsFilter_Free
+	.type	lmsFilter_Free, @function
+lmsFilter_Free:
+.LFB19:
+	.loc 1 375 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 376 16
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 376 8
+	test	rax, rax
+	je	.L165
+	.loc 1 376 55 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 376 34 discriminator 1
+	test	rax, rax
+	je	.L165
+	.loc 1 378 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 88[rax]
+	.loc 1 378 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 104[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL19:
+.L165:
+	.loc 1 380 20
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 104[rax], 0
+	.loc 1 381 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 8[rax], 0
+	.loc 1 382 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 383 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	lmsFilter_Free, .-lmsFilter_Free
+	.globl	lmsFilter_PushSample
+	.type	lmsFilter_PushSample, @function
+lmsFilter_PushSample:
+.LFB20:
+	.loc 1 386 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 387 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	lmsFilter_FlushUpdate
+	.loc 1 388 5
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_DelayLinePush
+	.loc 1 389 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	lmsFilter_PushSample, .-lmsFilter_PushSample
+	.globl	lmsFilter_FlushUpdate
+	.type	lmsFilter_FlushUpdate, @function
+lmsFilter_FlushUpdate:
+.LFB21:
+	.loc 1 392 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 393 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 393 8
+	test	eax, eax
+	je	.L178
+.LBB67:
+	.loc 1 395 16
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 396 31
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	lmsFilter_GetWindow
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 397 21
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR 28[rax]
+	movss	DWORD PTR -28[rbp], xmm0
+	.loc 1 399 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 399 9
+	cmp	eax, 2
+	je	.L169
+	cmp	eax, 2
+	jb	.L170
+	sub	eax, 4
+	cmp	eax, 1
+	ja	.L170
+	jmp	.L177
+.L169:
+.LBB68:
+	.loc 1 402 26
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 402 17
+	jmp	.L172
+.L173:
+	.loc 1 404 45 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm1, DWORD PTR 56[rax]
+	.loc 1 404 66 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 404 52 discriminator 3
+	mulss	xmm1, xmm0
+	.loc 1 404 85 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 404 77 discriminator 3
+	mulss	xmm0, DWORD PTR -28[rbp]
+	.loc 1 404 33 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	.loc 1 404 70 discriminator 3
+	addss	xmm0, xmm1
+	.loc 1 404 37 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 402 54 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L172:
+	.loc 1 402 43 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 402 35 discriminator 1
+	cmp	DWORD PTR -4[rbp], eax
+	jl	.L173
+.LBE68:
+	.loc 1 406 17
+	jmp	.L174
+.L177:
+.LBB69:
+	.loc 1 410 26
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 410 17
+	jmp	.L175
+.L176:
+	.loc 1 412 33 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 412 62 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 412 66 discriminator 3
+	pxor	xmm2, xmm2
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	edx, al
+	.loc 1 412 83 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rcx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 412 87 discriminator 3
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm2
+	seta	al
+	movzx	eax, al
+	.loc 1 412 74 discriminator 3
+	sub	edx, eax
+	.loc 1 412 47 discriminator 3
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, edx
+	.loc 1 412 45 discriminator 3
+	mulss	xmm0, DWORD PTR -28[rbp]
+	.loc 1 412 33 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	.loc 1 412 37 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 410 54 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L175:
+	.loc 1 410 43 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 410 35 discriminator 1
+	cmp	DWORD PTR -8[rbp], eax
+	jl	.L176
+.LBE69:
+	.loc 1 414 17
+	jmp	.L174
+.L170:
+	.loc 1 417 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 417 31
+	mov	r8, QWORD PTR 24[rax]
+	.loc 1 417 17
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	mov	esi, DWORD PTR -28[rbp]
+	mov	rcx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	movd	xmm0, esi
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	r8
+.LVL20:
+	.loc 1 418 17
+	nop
+.L174:
+	.loc 1 420 29
+	mov	rax, QWORD PTR -40[rbp]
+	pxor	xmm0, xmm0
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 421 31
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 32[rax], 0
+.L178:
+.LBE67:
+	.loc 1 423 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	lmsFilter_FlushUpdate, .-lmsFilter_FlushUpdate
+	.globl	lmsFilter_GetWindow
+	.type	lmsFilter_GetWindow, @function
+lmsFilter_GetWindow:
+.LFB22:
+	.loc 1 426 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 427 19
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 427 37
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 427 30
+	cdqe
+	add	rax, 1
+	sal	rax, 2
+	.loc 1 427 12
+	add	rax, rdx
+	.loc 1 428 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	lmsFilter_GetWindow, .-lmsFilter_GetWindow
+	.globl	lmsFilter_ProcessBlock
+	.type	lmsFilter_ProcessBlock, @function
+lmsFilter_ProcessBlock:
+.LFB23:
+	.loc 1 432 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	QWORD PTR -40[rbp], r8
+	mov	DWORD PTR -44[rbp], r9d
+	.loc 1 433 18
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r10, QWORD PTR 64[rax]
+	.loc 1 433 12
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rdi, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	r10
+.LVL21:
+	.loc 1 434 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	lmsFilter_ProcessBlock, .-lmsFilter_ProcessBlock
+	.type	lmsFilter_DescribeCheckpoint, @function
+lmsFilter_DescribeCheckpoint:
+.LFB24:
+	.loc 1 443 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	.loc 1 444 39
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, DWORD PTR 48[rax]
+	.loc 1 444 21
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 32[rax], edx
+	.loc 1 445 26
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 445 18
+	mov	rax, QWORD PTR -8[rbp]
+	movss	DWORD PTR 36[rax], xmm0
+	.loc 1 446 29
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm0, DWORD PTR 52[rax]
+	.loc 1 446 21
+	mov	rax, QWORD PTR -8[rbp]
+	movss	DWORD PTR 40[rax], xmm0
+	.loc 1 447 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	QWORD PTR 56[rax], rdx
+	.loc 1 448 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	lmsFilter_DescribeCheckpoint, .-lmsFilter_DescribeCheckpoint
+	.globl	lmsFilter_SaveCheckpoint
+	.type	lmsFilter_SaveCheckpoint, @function
+lmsFilter_SaveCheckpoint:
+.LFB25:
+	.loc 1 451 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r12
+	push	rbx
+	sub	rsp, 80
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	QWORD PTR -88[rbp], rdx
+	.loc 1 454 52
+	mov	rax, QWORD PTR -72[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 454 9
+	lea	rax, -64[rbp]
+	mov	ecx, 1
+	mov	esi, 1
+	mov	rdi, rax
+	call	lmsCheckpoint_Create@PLT
+	.loc 1 454 8
+	test	eax, eax
+	je	.L185
+	.loc 1 456 16
+	mov	eax, 1
+	jmp	.L187
+.L185:
+	.loc 1 458 5
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdx, QWORD PTR -80[rbp]
+	mov	rcx, QWORD PTR -72[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_DescribeCheckpoint
+	.loc 1 459 15
+	mov	rax, QWORD PTR -64[rbp]
+	.loc 1 459 46
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	edx, DWORD PTR 32[rdx]
+	.loc 1 459 38
+	mov	DWORD PTR 48[rax], edx
+	.loc 1 460 15
+	mov	rax, QWORD PTR -64[rbp]
+	.loc 1 460 44
+	mov	rdx, QWORD PTR -72[rbp]
+	movss	xmm0, DWORD PTR 28[rdx]
+	.loc 1 460 36
+	movss	DWORD PTR 88[rax], xmm0
+	.loc 1 461 15
+	mov	rax, QWORD PTR -64[rbp]
+	.loc 1 461 38
+	mov	rdx, QWORD PTR -72[rbp]
+	movsd	xmm0, QWORD PTR 40[rdx]
+	.loc 1 461 30
+	movsd	QWORD PTR 80[rax], xmm0
+	.loc 1 462 83
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 462 69
+	cdqe
+	.loc 1 462 5
+	lea	r12, 0[0+rax*4]
+	.loc 1 462 53
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rbx, QWORD PTR 8[rax]
+	.loc 1 462 12
+	lea	rax, -64[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	lmsCheckpoint_Row@PLT
+	.loc 1 462 5
+	mov	rdx, r12
+	mov	rsi, rbx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 465 86
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 465 72
+	cdqe
+	.loc 1 465 95
+	add	rax, 1
+	.loc 1 465 5
+	lea	rdx, 0[0+rax*4]
+	.loc 1 465 38
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rcx, QWORD PTR 16[rax]
+	.loc 1 465 56
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 465 49
+	sal	rax, 2
+	.loc 1 465 31
+	add	rcx, rax
+	.loc 1 465 22
+	mov	rax, QWORD PTR -48[rbp]
+	.loc 1 465 5
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 467 18
+	mov	rdx, QWORD PTR -88[rbp]
+	lea	rax, -64[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsCheckpoint_Write@PLT
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 468 5
+	lea	rax, -64[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Close@PLT
+	.loc 1 469 12
+	mov	eax, DWORD PTR -20[rbp]
+.L187:
+	.loc 1 470 1 discriminator 1
+	add	rsp, 80
+	pop	rbx
+	pop	r12
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	lmsFilter_SaveCheckpoint, .-lmsFilter_SaveCheckpoint
+	.section	.rodata
+	.align 8
+.LC14:
+	.string	"Error: Checkpoint filter length %u does not match %d\n"
+	.align 8
+.LC15:
+	.string	"Error: Checkpoint has no channel %d\n"
+	.align 8
+.LC16:
+	.string	"Error: Checkpoint holds coefficients only, it can be used for a warm start"
+.LC17:
+	.string	"unknown"
+	.align 8
+.LC18:
+	.string	"Error: Checkpoint was taken with variant %s, step size %g and leakage %g\n"
+	.text
+	.globl	lmsFilter_LoadCheckpoint
+	.type	lmsFilter_LoadCheckpoint, @function
+lmsFilter_LoadCheckpoint:
+.LFB26:
+	.loc 1 473 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 56
+	.cfi_offset 3, -24
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	DWORD PTR -52[rbp], edx
+	mov	DWORD PTR -56[rbp], ecx
+	.loc 1 474 34
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 475 39
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 475 25
+	cdqe
+	.loc 1 475 18
+	add	rax, 1
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 477 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 477 9
+	mov	edx, eax
+	.loc 1 477 38
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 477 8
+	cmp	edx, eax
+	je	.L189
+	.loc 1 479 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 479 80
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 479 9
+	mov	esi, eax
+	lea	rax, .LC14[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 480 16
+	mov	eax, 1
+	jmp	.L190
+.L189:
+	.loc 1 482 8
+	cmp	DWORD PTR -52[rbp], 0
+	js	.L191
+	.loc 1 482 54 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 482 45 discriminator 1
+	mov	edx, DWORD PTR -52[rbp]
+	.loc 1 482 23 discriminator 1
+	cmp	edx, eax
+	jb	.L192
+.L191:
+	.loc 1 484 9
+	mov	eax, DWORD PTR -52[rbp]
+	mov	esi, eax
+	lea	rax, .LC15[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 485 16
+	mov	eax, 1
+	jmp	.L190
+.L192:
+	.loc 1 487 8
+	cmp	DWORD PTR -56[rbp], 0
+	je	.L193
+	.loc 1 489 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 44[rax]
+	.loc 1 489 12
+	test	eax, eax
+	jne	.L194
+	.loc 1 491 13
+	lea	rax, .LC16[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 492 20
+	mov	eax, 1
+	jmp	.L190
+.L194:
+	.loc 1 494 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 32[rax]
+	.loc 1 494 49
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 494 12
+	cmp	edx, eax
+	jne	.L195
+	.loc 1 494 70 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 36[rax]
+	.loc 1 494 86 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 494 60 discriminator 1
+	ucomiss	xmm0, xmm1
+	jp	.L195
+	ucomiss	xmm0, xmm1
+	jne	.L195
+	.loc 1 495 24
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 495 13
+	cmp	eax, 2
+	jne	.L193
+	.loc 1 495 73 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 40[rax]
+	.loc 1 495 92 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm1, DWORD PTR 52[rax]
+	.loc 1 495 63 discriminator 1
+	ucomiss	xmm0, xmm1
+	jp	.L195
+	ucomiss	xmm0, xmm1
+	je	.L193
+.L195:
+	.loc 1 500 40
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 40[rax]
+	.loc 1 497 13
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, xmm0
+	movsd	QWORD PTR -64[rbp], xmm2
+	.loc 1 500 26
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 36[rax]
+	.loc 1 497 13
+	pxor	xmm3, xmm3
+	cvtss2sd	xmm3, xmm0
+	movq	rbx, xmm3
+	.loc 1 498 27
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 497 13
+	cmp	eax, 5
+	ja	.L198
+	.loc 1 499 68
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 499 20
+	mov	edi, eax
+	call	lmsFilter_VariantName
+	jmp	.L199
+.L198:
+	.loc 1 497 13 discriminator 1
+	lea	rax, .LC17[rip]
+.L199:
+	.loc 1 497 13 is_stmt 0 discriminator 2
+	movsd	xmm1, QWORD PTR -64[rbp]
+	movq	xmm0, rbx
+	mov	rsi, rax
+	lea	rax, .LC18[rip]
+	mov	rdi, rax
+	mov	eax, 2
+	call	printf@PLT
+	.loc 1 501 20 is_stmt 1 discriminator 2
+	mov	eax, 1
+	jmp	.L190
+.L193:
+	.loc 1 505 88
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 505 74
+	cdqe
+	.loc 1 505 5
+	lea	rbx, 0[0+rax*4]
+	.loc 1 505 34
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsCheckpoint_Row@PLT
+	mov	rcx, rax
+	.loc 1 505 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 505 5
+	mov	rdx, rbx
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 506 24
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 24[rax], 0
+	.loc 1 507 8
+	cmp	DWORD PTR -56[rbp], 0
+	je	.L200
+	.loc 1 509 9
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 509 45
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rcx, QWORD PTR 16[rax]
+	.loc 1 509 22
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 509 9
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 510 9
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 510 52
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 510 23
+	mov	rcx, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR 16[rcx]
+	.loc 1 510 34
+	mov	rsi, QWORD PTR -32[rbp]
+	sal	rsi, 2
+	.loc 1 510 16
+	add	rcx, rsi
+	.loc 1 510 9
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	memcpy@PLT
+	.loc 1 511 39
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 48[rax]
+	.loc 1 511 31
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 32[rax], edx
+	.loc 1 512 37
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 88[rax]
+	.loc 1 512 29
+	mov	rax, QWORD PTR -40[rbp]
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 513 31
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 80[rax]
+	.loc 1 513 23
+	mov	rax, QWORD PTR -40[rbp]
+	movsd	QWORD PTR 40[rax], xmm0
+	jmp	.L201
+.L200:
+	.loc 1 517 9
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, 0[0+rax*8]
+	.loc 1 517 22
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 517 9
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 518 31
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 32[rax], 0
+	.loc 1 519 29
+	mov	rax, QWORD PTR -40[rbp]
+	pxor	xmm0, xmm0
+	movss	DWORD PTR 28[rax], xmm0
+	.loc 1 520 23
+	mov	rax, QWORD PTR -40[rbp]
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR 40[rax], xmm0
+.L201:
+	.loc 1 522 12
+	mov	eax, 0
+.L190:
+	.loc 1 523 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	lmsFilter_LoadCheckpoint, .-lmsFilter_LoadCheckpoint
+	.section	.rodata
+	.align 8
+.LC19:
+	.string	"ERROR: Argument <variant> must be lms, nlms, leaky, sign-error, sign-data or sign-sign"
+	.text
+	.globl	lmsFilter_processArgumentVariant
+	.type	lmsFilter_processArgumentVariant, @function
+lmsFilter_processArgumentVariant:
+.LFB27:
+	.loc 1 526 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+.LBB70:
+	.loc 1 527 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 527 5
+	jmp	.L204
+.L207:
+	.loc 1 529 50
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, lmsFilterVariantNames[rip]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 529 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 529 12
+	test	eax, eax
+	jne	.L205
+	.loc 1 531 20
+	mov	eax, DWORD PTR -4[rbp]
+	jmp	.L206
+.L205:
+	.loc 1 527 52 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L204:
+	.loc 1 527 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], 5
+	jle	.L207
+.LBE70:
+	.loc 1 534 5
+	lea	rax, .LC19[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 535 12
+	mov	eax, 6
+.L206:
+	.loc 1 536 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	lmsFilter_processArgumentVariant, .-lmsFilter_processArgumentVariant
+	.globl	lmsFilter_VariantName
+	.type	lmsFilter_VariantName, @function
+lmsFilter_VariantName:
+.LFB28:
+	.loc 1 539 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -4[rbp], edi
+	.loc 1 540 102
+	cmp	DWORD PTR -4[rbp], 5
+	ja	.L209
+	.loc 1 540 102 is_stmt 0 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	lea	rdx, 0[0+rax*8]
+	lea	rax, lmsFilterVariantNames[rip]
+	mov	rax, QWORD PTR [rdx+rax]
+	jmp	.L211
+.L209:
+	.loc 1 540 102 discriminator 2
+	lea	rax, .LC17[rip]
+.L211:
+	.loc 1 541 1 is_stmt 1 discriminator 5
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	lmsFilter_VariantName, .-lmsFilter_VariantName
+	.section	.rodata
+.LC20:
+	.string	"fdaf"
+.LC21:
+	.string	"q15"
+.LC22:
+	.string	"subband"
+.LC23:
+	.string	"rls"
+.LC24:
+	.string	"apa"
+	.align 8
+.LC25:
+	.string	"ERROR: Argument <algo> must be lms, fdaf, q15, subband, rls or apa"
+	.text
+	.globl	lmsFilter_processArgumentAlgorithm
+	.type	lmsFilter_processArgumentAlgorithm, @function
+lmsFilter_processArgumentAlgorithm:
+.LFB29:
+	.loc 1 544 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 545 26
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 547 9
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC6[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 547 8
+	test	eax, eax
+	jne	.L213
+	.loc 1 549 16
+	mov	DWORD PTR -4[rbp], 1
+	jmp	.L214
+.L213:
+	.loc 1 551 14
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC20[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 551 13
+	test	eax, eax
+	jne	.L215
+	.loc 1 553 16
+	mov	DWORD PTR -4[rbp], 2
+	jmp	.L214
+.L215:
+	.loc 1 555 14
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC21[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 555 13
+	test	eax, eax
+	jne	.L216
+	.loc 1 557 16
+	mov	DWORD PTR -4[rbp], 3
+	jmp	.L214
+.L216:
+	.loc 1 559 14
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC22[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 559 13
+	test	eax, eax
+	jne	.L217
+	.loc 1 561 16
+	mov	DWORD PTR -4[rbp], 4
+	jmp	.L214
+.L217:
+	.loc 1 563 14
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC23[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 563 13
+	test	eax, eax
+	jne	.L218
+	.loc 1 565 16
+	mov	DWORD PTR -4[rbp], 5
+	jmp	.L214
+.L218:
+	.loc 1 567 14
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, .LC24[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 567 13
+	test	eax, eax
+	jne	.L219
+	.loc 1 569 16
+	mov	DWORD PTR -4[rbp], 6
+	jmp	.L214
+.L219:
+	.loc 1 573 9
+	lea	rax, .LC25[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L214:
+	.loc 1 575 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 576 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	lmsFilter_processArgumentAlgorithm, .-lmsFilter_processArgumentAlgorithm
+	.section	.rodata
+	.align 8
+.LC26:
+	.string	"ERROR: Argument <length> wrong format"
+	.align 8
+.LC27:
+	.string	"ERROR: Number for <length> must be greater than 0"
+	.text
+	.globl	lmsFilter_processArgumentFilterLength
+	.type	lmsFilter_processArgumentFilterLength, @function
+lmsFilter_processArgumentFilterLength:
+.LFB30:
+	.loc 1 579 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 580 18
+	mov	DWORD PTR -4[rbp], 0
+.LBB71:
+	.loc 1 584 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 584 5
+	jmp	.L222
+.L225:
+	.loc 1 586 33
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 586 19
+	movzx	eax, BYTE PTR [rax]
+	mov	BYTE PTR -13[rbp], al
+	.loc 1 587 14
+	call	__ctype_b_loc@PLT
+	mov	rax, QWORD PTR [rax]
+	movsx	rdx, BYTE PTR -13[rbp]
+	add	rdx, rdx
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	movzx	eax, ax
+	and	eax, 2048
+	.loc 1 587 12
+	test	eax, eax
+	jne	.L223
+	.loc 1 589 13
+	lea	rax, .LC26[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 590 20
+	mov	eax, DWORD PTR -4[rbp]
+	jmp	.L224
+.L223:
+	.loc 1 584 49 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L222:
+	.loc 1 584 34 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 584 38 discriminator 1
+	test	al, al
+	jne	.L225
+.LBE71:
+	.loc 1 593 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 593 15
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 594 8
+	cmp	DWORD PTR -12[rbp], 0
+	je	.L226
+	.loc 1 596 16
+	mov	eax, DWORD PTR -12[rbp]
+	mov	DWORD PTR -4[rbp], eax
+	jmp	.L227
+.L226:
+	.loc 1 600 9
+	lea	rax, .LC27[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L227:
+	.loc 1 602 12
+	mov	eax, DWORD PTR -4[rbp]
+.L224:
+	.loc 1 603 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	lmsFilter_processArgumentFilterLength, .-lmsFilter_processArgumentFilterLength
+	.section	.rodata
+	.align 8
+.LC28:
+	.string	"ERROR: Argument <stepsize> wrong format"
+	.align 8
+.LC29:
+	.string	"ERROR: Argument <stepsize> contains non-digit characters"
+	.align 8
+.LC30:
+	.string	"ERROR: Number for <stepsize> must be greater than 0"
+	.text
+	.globl	lmsFilter_processArgumentStepSize
+	.type	lmsFilter_processArgumentStepSize, @function
+lmsFilter_processArgumentStepSize:
+.LFB31:
+	.loc 1 606 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 607 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -4[rbp], xmm0
+.LBB72:
+	.loc 1 612 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 612 5
+	jmp	.L229
+.L236:
+	.loc 1 614 29
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 614 19
+	movzx	eax, BYTE PTR [rax]
+	mov	BYTE PTR -13[rbp], al
+	.loc 1 615 13
+	call	__ctype_b_loc@PLT
+	mov	rax, QWORD PTR [rax]
+	movsx	rdx, BYTE PTR -13[rbp]
+	add	rdx, rdx
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	movzx	eax, ax
+	and	eax, 2048
+	.loc 1 615 12
+	test	eax, eax
+	jne	.L242
+	.loc 1 619 26
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 619 17
+	cmp	al, 46
+	jne	.L232
+	.loc 1 621 17
+	mov	eax, DWORD PTR dotCounter.1[rip]
+	add	eax, 1
+	.loc 1 621 15
+	mov	DWORD PTR dotCounter.1[rip], eax
+	.loc 1 621 17
+	mov	eax, DWORD PTR dotCounter.1[rip]
+	.loc 1 621 15
+	cmp	eax, 1
+	ja	.L233
+	.loc 1 621 35 discriminator 1
+	cmp	DWORD PTR -8[rbp], 0
+	jne	.L243
+.L233:
+	.loc 1 623 17
+	lea	rax, .LC28[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 624 24
+	movss	xmm0, DWORD PTR -4[rbp]
+	jmp	.L235
+.L232:
+	.loc 1 633 13
+	lea	rax, .LC29[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 634 20
+	movss	xmm0, DWORD PTR -4[rbp]
+	jmp	.L235
+.L242:
+	.loc 1 617 13
+	nop
+	jmp	.L231
+.L243:
+	.loc 1 628 17
+	nop
+.L231:
+	.loc 1 612 45 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L229:
+	.loc 1 612 30 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 612 34 discriminator 1
+	test	al, al
+	jne	.L236
+.LBE72:
+	.loc 1 637 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	atof@PLT
+	.loc 1 637 15
+	cvtsd2ss	xmm0, xmm0
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 638 8
+	movss	xmm0, DWORD PTR -12[rbp]
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	jbe	.L241
+	.loc 1 640 16
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	DWORD PTR -4[rbp], xmm0
+	jmp	.L239
+.L241:
+	.loc 1 644 9
+	lea	rax, .LC30[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L239:
+	.loc 1 646 12
+	movss	xmm0, DWORD PTR -4[rbp]
+.L235:
+	.loc 1 647 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	lmsFilter_processArgumentStepSize, .-lmsFilter_processArgumentStepSize
+	.section	.rodata
+.LC31:
+	.string	"filtered"
+.LC32:
+	.string	"-"
+.LC33:
+	.string	"stdin"
+.LC34:
+	.string	""
+.LC35:
+	.string	".%d"
+	.text
+	.type	lmsFilter_OutputFileName, @function
+lmsFilter_OutputFileName:
+.LFB32:
+	.loc 1 658 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 88
+	.cfi_offset 3, -24
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	DWORD PTR -84[rbp], edx
+	.loc 1 659 17
+	lea	rax, .LC31[rip]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 660 29
+	mov	rax, QWORD PTR -72[rbp]
+	lea	rdx, .LC32[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 660 84
+	test	eax, eax
+	je	.L245
+	.loc 1 660 84 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	jmp	.L246
+.L245:
+	.loc 1 660 84 discriminator 2
+	lea	rax, .LC33[rip]
+.L246:
+	.loc 1 660 17 is_stmt 1 discriminator 4
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 661 10 discriminator 4
+	mov	QWORD PTR -64[rbp], 0
+	mov	QWORD PTR -56[rbp], 0
+	.loc 1 663 17 discriminator 4
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 663 8 discriminator 4
+	test	rax, rax
+	je	.L247
+	.loc 1 665 18
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 666 28
+	lea	rax, .LC34[rip]
+	mov	QWORD PTR -24[rbp], rax
+.L247:
+	.loc 1 668 8
+	cmp	DWORD PTR -84[rbp], 0
+	js	.L248
+	.loc 1 670 9
+	mov	edx, DWORD PTR -84[rbp]
+	lea	rax, -64[rbp]
+	mov	ecx, edx
+	lea	rdx, .LC35[rip]
+	mov	esi, 16
+	mov	rdi, rax
+	mov	eax, 0
+	call	snprintf@PLT
+.L248:
+	.loc 1 673 44
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	strlen@PLT
+	mov	rbx, rax
+	.loc 1 673 63
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	strlen@PLT
+	.loc 1 673 61
+	add	rbx, rax
+	.loc 1 673 92
+	lea	rax, -64[rbp]
+	mov	rdi, rax
+	call	strlen@PLT
+	.loc 1 673 90
+	add	rax, rbx
+	.loc 1 673 37
+	add	rax, 1
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 674 8
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L249
+	.loc 1 676 9
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcpy@PLT
+	.loc 1 677 9
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcat@PLT
+	.loc 1 678 9
+	lea	rdx, -64[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcat@PLT
+.L249:
+	.loc 1 680 12
+	mov	rax, QWORD PTR -40[rbp]
+	.loc 1 681 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	lmsFilter_OutputFileName, .-lmsFilter_OutputFileName
+	.type	lmsFilter_CreateLike, @function
+lmsFilter_CreateLike:
+.LFB33:
+	.loc 1 690 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 691 41
+	mov	edi, 112
+	call	malloc@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 693 8
+	cmp	QWORD PTR -8[rbp], 0
+	je	.L252
+	.loc 1 694 61 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 52[rax]
+	.loc 1 693 105 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 48[rax]
+	.loc 1 693 86 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 4[rax]
+	.loc 1 693 69 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edi, DWORD PTR [rax]
+	.loc 1 693 30 discriminator 1
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	lmsFilter_InitVariant
+	.loc 1 693 26 discriminator 1
+	test	eax, eax
+	je	.L252
+	.loc 1 696 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 697 16
+	mov	QWORD PTR -8[rbp], 0
+.L252:
+	.loc 1 699 12
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 700 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	lmsFilter_CreateLike, .-lmsFilter_CreateLike
+	.type	lmsFilter_Destroy, @function
+lmsFilter_Destroy:
+.LFB34:
+	.loc 1 707 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 708 8
+	cmp	QWORD PTR -8[rbp], 0
+	je	.L256
+	.loc 1 710 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free
+	.loc 1 711 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	free@PLT
+.L256:
+	.loc 1 713 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	lmsFilter_Destroy, .-lmsFilter_Destroy
+	.section	.rodata
+	.align 8
+.LC36:
+	.string	"Error allocating filter buffers"
+	.text
+	.type	lmsFilter_ChannelOpen, @function
+lmsFilter_ChannelOpen:
+.LFB35:
+	.loc 1 730 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	mov	QWORD PTR -64[rbp], rcx
+	mov	DWORD PTR -68[rbp], r8d
+	mov	DWORD PTR -72[rbp], r9d
+	.loc 1 731 35
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 733 5
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, 752
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 734 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 735 29
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 616[rax], rdx
+	.loc 1 736 29
+	mov	rax, QWORD PTR -40[rbp]
+	movabs	rsi, 9223372036854775807
+	mov	QWORD PTR 688[rax], rsi
+	.loc 1 737 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 704[rax], 0
+	.loc 1 741 30
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 739 31
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 742 23
+	mov	rax, QWORD PTR -48[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 739 31
+	movss	DWORD PTR -28[rbp], xmm0
+	.loc 1 743 25
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 739 31
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 744 31
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 44[rax]
+	.loc 1 739 31
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 745 36
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 739 31
+	mov	DWORD PTR -16[rbp], eax
+	mov	eax, DWORD PTR 16[rbp]
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 748 9
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rcx, 8[rax]
+	mov	rdx, QWORD PTR -48[rbp]
+	lea	rax, -32[rbp]
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	lmsEngine_Open@PLT
+	.loc 1 748 8
+	test	eax, eax
+	je	.L258
+	.loc 1 750 16
+	mov	eax, 1
+	jmp	.L267
+.L258:
+	.loc 1 755 30
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 755 39
+	lea	edx, -1[rax]
+	.loc 1 755 22
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 640[rax], edx
+	.loc 1 756 36
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 640[rax]
+	movsx	rdx, eax
+	.loc 1 756 27
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 680[rax], rdx
+	.loc 1 757 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 644[rax], 0
+	.loc 1 758 71
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 640[rax]
+	.loc 1 758 62
+	add	eax, 4096
+	cdqe
+	.loc 1 758 32
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 758 22
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 712[rax], rdx
+	.loc 1 759 31
+	mov	edi, 16384
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 759 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 720[rax], rdx
+	.loc 1 760 30
+	mov	edi, 16384
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 760 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 728[rax], rdx
+	.loc 1 761 31
+	mov	edi, 49152
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 761 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 736[rax], rdx
+	.loc 1 762 17
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 712[rax]
+	.loc 1 762 8
+	test	rax, rax
+	je	.L260
+	.loc 1 762 47 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 720[rax]
+	.loc 1 762 36 discriminator 1
+	test	rax, rax
+	je	.L260
+	.loc 1 762 76 discriminator 2
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 728[rax]
+	.loc 1 762 65 discriminator 2
+	test	rax, rax
+	je	.L260
+	.loc 1 762 104 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 736[rax]
+	.loc 1 762 93 discriminator 3
+	test	rax, rax
+	jne	.L261
+.L260:
+	.loc 1 764 9
+	lea	rax, .LC36[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 765 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 766 16
+	mov	eax, 1
+	jmp	.L267
+.L261:
+	.loc 1 769 8
+	cmp	QWORD PTR -8[rbp], 0
+	je	.L262
+	.loc 1 771 47
+	mov	edi, 184
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 771 28
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 772 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 772 12
+	test	rax, rax
+	je	.L263
+	.loc 1 772 46 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	mov	rcx, QWORD PTR -8[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsTelemetry_Init@PLT
+	.loc 1 772 42 discriminator 1
+	test	eax, eax
+	je	.L262
+.L263:
+	.loc 1 774 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 775 20
+	mov	eax, 1
+	jmp	.L267
+.L262:
+	.loc 1 779 17
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 779 8
+	test	rax, rax
+	je	.L264
+	.loc 1 781 37
+	mov	edi, 88
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 781 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 32[rax], rdx
+	.loc 1 782 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 782 12
+	test	rax, rax
+	je	.L265
+	.loc 1 783 17
+	call	lmsPlot_FilterSeriesNames@PLT
+	mov	rdx, rax
+	.loc 1 783 53
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rsi, QWORD PTR 88[rax]
+	.loc 1 783 17
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	mov	rcx, rdx
+	mov	edx, 3
+	mov	rdi, rax
+	call	lmsPlot_Init@PLT
+	.loc 1 783 13
+	test	eax, eax
+	je	.L264
+.L265:
+	.loc 1 785 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 785 13
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 786 27
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 32[rax], 0
+	.loc 1 787 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 788 20
+	mov	eax, 1
+	jmp	.L267
+.L264:
+	.loc 1 793 9
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rdi, 40[rax]
+	mov	ecx, DWORD PTR -72[rbp]
+	mov	edx, DWORD PTR -68[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	r8d, ecx
+	mov	ecx, 3
+	mov	rsi, rax
+	call	sampleIo_OpenWriter@PLT
+	.loc 1 793 8
+	test	eax, eax
+	je	.L266
+	.loc 1 795 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 796 16
+	mov	eax, 1
+	jmp	.L267
+.L266:
+	.loc 1 798 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 624[rax], 1
+	.loc 1 800 12
+	mov	eax, 0
+.L267:
+	.loc 1 801 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	lmsFilter_ChannelOpen, .-lmsFilter_ChannelOpen
+	.type	lmsFilter_ChannelEngine, @function
+lmsFilter_ChannelEngine:
+.LFB36:
+	.loc 1 815 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	mov	QWORD PTR -32[rbp], rcx
+	mov	QWORD PTR -40[rbp], r8
+	mov	DWORD PTR -44[rbp], r9d
+	.loc 1 816 35
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdi, 8[rax]
+	.loc 1 816 12
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	r9d, r8d
+	mov	r8, rsi
+	mov	rsi, rax
+	call	lmsEngine_ProcessBlock@PLT
+	.loc 1 817 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	lmsFilter_ChannelEngine, .-lmsFilter_ChannelEngine
+	.type	lmsFilter_ChannelPush, @function
+lmsFilter_ChannelPush:
+.LFB37:
+	.loc 1 825 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 826 26
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 8[rax]
+	.loc 1 826 5
+	mov	eax, DWORD PTR -12[rbp]
+	movd	xmm0, eax
+	mov	rdi, rdx
+	call	lmsEngine_PushSample@PLT
+	.loc 1 827 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE37:
+	.size	lmsFilter_ChannelPush, .-lmsFilter_ChannelPush
+	.type	lmsFilter_ChannelObserve, @function
+lmsFilter_ChannelObserve:
+.LFB38:
+	.loc 1 838 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	mov	DWORD PTR -44[rbp], ecx
+	.loc 1 839 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	mov	ecx, DWORD PTR -44[rbp]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	lmsTelemetry_Update@PLT
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 841 37
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 841 9
+	mov	rdi, rax
+	call	lmsTelemetry_NormDue@PLT
+	.loc 1 841 8
+	test	eax, eax
+	je	.L272
+	.loc 1 843 85
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 8
+	.loc 1 843 19
+	mov	rdi, rax
+	call	lmsEngine_NormSquared@PLT
+	movq	rax, xmm0
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 24[rdx]
+	movq	xmm0, rax
+	mov	rdi, rdx
+	call	lmsTelemetry_UpdateNorm@PLT
+	.loc 1 843 16
+	or	DWORD PTR -4[rbp], eax
+.L272:
+	.loc 1 845 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 846 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE38:
+	.size	lmsFilter_ChannelObserve, .-lmsFilter_ChannelObserve
+	.section	.rodata
+	.align 8
+.LC37:
+	.string	"WARNING: %s: %s at sample %ld\n"
+	.text
+	.type	lmsFilter_ChannelPrintWarnings, @function
+lmsFilter_ChannelPrintWarnings:
+.LFB39:
+	.loc 1 854 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 40
+	.cfi_offset 3, -24
+	mov	QWORD PTR -40[rbp], rdi
+	mov	DWORD PTR -44[rbp], esi
+.LBB73:
+	.loc 1 855 14
+	mov	DWORD PTR -20[rbp], 1
+	.loc 1 855 5
+	jmp	.L275
+.L277:
+	.loc 1 857 20
+	mov	eax, DWORD PTR -44[rbp]
+	and	eax, DWORD PTR -20[rbp]
+	.loc 1 857 12
+	test	eax, eax
+	je	.L276
+	.loc 1 860 27
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 859 13
+	mov	rbx, QWORD PTR 104[rax]
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edi, eax
+	call	lmsTelemetry_WarningName@PLT
+	mov	rdx, rax
+	.loc 1 859 62
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 616[rax]
+	.loc 1 859 13
+	mov	rcx, rbx
+	mov	rsi, rax
+	lea	rax, .LC37[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L276:
+	.loc 1 855 113 discriminator 2
+	sal	DWORD PTR -20[rbp]
+.L275:
+	.loc 1 855 68 discriminator 1
+	cmp	DWORD PTR -20[rbp], 4
+	jle	.L277
+.LBE73:
+	.loc 1 863 1
+	nop
+	nop
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE39:
+	.size	lmsFilter_ChannelPrintWarnings, .-lmsFilter_ChannelPrintWarnings
+	.section	.rodata
+	.align 8
+.LC38:
+	.string	"WARNING: Algorithm goes unstable! stopped"
+	.text
+	.type	lmsFilter_ChannelFilter, @function
+lmsFilter_ChannelFilter:
+.LFB40:
+	.loc 1 873 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	mov	DWORD PTR -44[rbp], ecx
+	.loc 1 874 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, QWORD PTR 728[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 720[rax]
+	mov	r8d, DWORD PTR -44[rbp]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	lmsFilter_ChannelEngine
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 876 16
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 876 8
+	test	rax, rax
+	je	.L279
+	.loc 1 878 99
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 728[rax]
+	.loc 1 878 9
+	mov	ecx, DWORD PTR -44[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelObserve
+	mov	edx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsFilter_ChannelPrintWarnings
+.L279:
+	.loc 1 880 8
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L281
+	.loc 1 882 9
+	lea	rax, .LC38[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 883 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 704[rax], 1
+.L281:
+	.loc 1 885 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE40:
+	.size	lmsFilter_ChannelFilter, .-lmsFilter_ChannelFilter
+	.type	lmsFilter_ChannelWrite, @function
+lmsFilter_ChannelWrite:
+.LFB41:
+	.loc 1 894 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	DWORD PTR -52[rbp], edx
+	.loc 1 895 29
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 896 12
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 736[rax]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 899 16
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 744[rax]
+	.loc 1 899 8
+	test	rax, rax
+	je	.L283
+	.loc 1 901 42
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 744[rax]
+	mov	rdi, rax
+	call	spscRing_AcquireWrite@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 902 16
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 4
+	mov	QWORD PTR -16[rbp], rax
+.L283:
+.LBB74:
+	.loc 1 904 14
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 904 5
+	jmp	.L284
+.L285:
+	.loc 1 906 30 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 906 18 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	cdqe
+	.loc 1 906 15 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	.loc 1 906 30 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 906 23 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 907 36 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 720[rax]
+	.loc 1 907 44 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	lea	rcx, [rax+rdx]
+	.loc 1 907 18 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	.loc 1 907 15 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	.loc 1 907 44 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 907 27 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 908 36 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 728[rax]
+	.loc 1 908 43 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	lea	rcx, [rax+rdx]
+	.loc 1 908 18 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	.loc 1 908 15 discriminator 3
+	cdqe
+	add	rax, 2
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	.loc 1 908 43 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 908 27 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 904 33 discriminator 3
+	add	DWORD PTR -20[rbp], 1
+.L284:
+	.loc 1 904 23 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	jl	.L285
+.LBE74:
+	.loc 1 910 16
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 910 8
+	test	rax, rax
+	je	.L286
+	.loc 1 912 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsPlot_AddFrames@PLT
+.L286:
+	.loc 1 914 8
+	cmp	QWORD PTR -8[rbp], 0
+	je	.L287
+	.loc 1 916 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 917 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 744[rax]
+	mov	rdi, rax
+	call	spscRing_CommitWrite@PLT
+	jmp	.L288
+.L287:
+	.loc 1 919 14
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rcx, 40[rax]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	sampleIo_Write@PLT
+	.loc 1 919 13
+	test	eax, eax
+	je	.L288
+	.loc 1 921 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 616[rax]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 922 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 704[rax], 1
+.L288:
+	.loc 1 924 12
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 664[rax]
+	.loc 1 924 20
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	add	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 664[rax], rdx
+	.loc 1 925 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE41:
+	.size	lmsFilter_ChannelWrite, .-lmsFilter_ChannelWrite
+	.section	.rodata
+	.align 8
+.LC39:
+	.string	"Resumed at input sample:      %ld\n"
+	.text
+	.type	lmsFilter_ChannelOpenCheckpoint, @function
+lmsFilter_ChannelOpenCheckpoint:
+.LFB42:
+	.loc 1 939 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 96
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	DWORD PTR -84[rbp], edx
+	mov	DWORD PTR -88[rbp], ecx
+	.loc 1 941 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 943 56
+	cmp	DWORD PTR -84[rbp], 0
+	je	.L290
+	.loc 1 943 46 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 640[rax]
+	.loc 1 943 56 discriminator 1
+	cdqe
+	jmp	.L291
+.L290:
+	.loc 1 943 56 is_stmt 0 discriminator 2
+	mov	eax, 0
+.L291:
+	.loc 1 943 27 is_stmt 1 discriminator 4
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	QWORD PTR 680[rdx], rax
+	.loc 1 944 8 discriminator 4
+	cmp	QWORD PTR -80[rbp], 0
+	jne	.L292
+	.loc 1 946 16
+	mov	eax, 0
+	jmp	.L301
+.L292:
+	.loc 1 948 25
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -80[rbp]
+	mov	QWORD PTR 672[rax], rdx
+	.loc 1 950 33
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 950 50
+	test	rax, rax
+	setne	al
+	.loc 1 950 15
+	movzx	eax, al
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 951 62
+	cmp	DWORD PTR -8[rbp], 0
+	je	.L294
+	.loc 1 951 62 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	jmp	.L295
+.L294:
+	.loc 1 951 62 discriminator 2
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR 24[rax]
+.L295:
+	.loc 1 951 17 is_stmt 1 discriminator 4
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 952 8 discriminator 4
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L296
+	.loc 1 954 13
+	mov	rdx, QWORD PTR -16[rbp]
+	lea	rax, -64[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsCheckpoint_Open@PLT
+	.loc 1 954 12
+	test	eax, eax
+	je	.L297
+	.loc 1 956 20
+	mov	eax, 1
+	jmp	.L301
+.L297:
+	.loc 1 958 18
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	edx, DWORD PTR -8[rbp]
+	lea	rsi, -64[rbp]
+	mov	ecx, edx
+	mov	edx, 0
+	mov	rdi, rax
+	call	lmsFilter_LoadCheckpoint
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 959 12
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L298
+	.loc 1 959 38 discriminator 1
+	cmp	DWORD PTR -8[rbp], 0
+	je	.L298
+	.loc 1 961 39
+	mov	rax, QWORD PTR -64[rbp]
+	.loc 1 961 46
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 961 27
+	mov	rax, QWORD PTR -72[rbp]
+	mov	QWORD PTR 696[rax], rdx
+	.loc 1 962 47
+	mov	rax, QWORD PTR -64[rbp]
+	.loc 1 962 54
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 962 35
+	mov	rax, QWORD PTR -72[rbp]
+	mov	QWORD PTR 680[rax], rdx
+	.loc 1 963 16
+	cmp	DWORD PTR -84[rbp], 0
+	je	.L299
+	.loc 1 967 31
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 640[rax]
+	cdqe
+	.loc 1 966 17
+	lea	rdx, 0[0+rax*4]
+	.loc 1 966 53
+	mov	rcx, QWORD PTR -48[rbp]
+	.loc 1 966 68
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 966 76
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 966 85
+	lea	esi, 1[rax]
+	.loc 1 966 98
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 640[rax]
+	.loc 1 966 89
+	sub	esi, eax
+	movsx	rax, esi
+	.loc 1 966 60
+	sal	rax, 2
+	.loc 1 966 42
+	add	rcx, rax
+	.loc 1 966 31
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 712[rax]
+	.loc 1 966 17
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 968 40
+	mov	rax, QWORD PTR -72[rbp]
+	mov	edx, DWORD PTR 640[rax]
+	.loc 1 968 31
+	mov	rax, QWORD PTR -72[rbp]
+	mov	DWORD PTR 644[rax], edx
+	.loc 1 969 33
+	mov	rax, QWORD PTR -72[rbp]
+	mov	DWORD PTR 648[rax], 1
+.L299:
+	.loc 1 971 16
+	cmp	DWORD PTR -88[rbp], 0
+	jne	.L298
+	.loc 1 973 17
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 696[rax]
+	mov	rsi, rax
+	lea	rax, .LC39[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L298:
+	.loc 1 976 9
+	lea	rax, -64[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Close@PLT
+.L296:
+	.loc 1 978 17
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 978 8
+	test	rax, rax
+	jle	.L300
+	.loc 1 980 42
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 680[rax]
+	.loc 1 980 67
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 980 57
+	add	rdx, rax
+	.loc 1 980 33
+	mov	rax, QWORD PTR -72[rbp]
+	mov	QWORD PTR 688[rax], rdx
+.L300:
+	.loc 1 982 12
+	mov	eax, DWORD PTR -4[rbp]
+.L301:
+	.loc 1 983 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE42:
+	.size	lmsFilter_ChannelOpenCheckpoint, .-lmsFilter_ChannelOpenCheckpoint
+	.type	lmsFilter_ChannelSaveCheckpoint, @function
+lmsFilter_ChannelSaveCheckpoint:
+.LFB43:
+	.loc 1 990 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 991 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 672[rax]
+	.loc 1 991 8
+	test	rax, rax
+	je	.L304
+	.loc 1 991 50 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 672[rax]
+	.loc 1 991 62 discriminator 1
+	mov	rax, QWORD PTR [rax]
+	.loc 1 991 39 discriminator 1
+	test	rax, rax
+	je	.L304
+	.loc 1 993 45
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 672[rax]
+	.loc 1 993 57
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 992 62
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 680[rax]
+	.loc 1 992 86
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 664[rax]
+	.loc 1 992 13
+	add	rcx, rax
+	.loc 1 992 45
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 992 13
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_SaveCheckpoint
+	.loc 1 992 9
+	test	eax, eax
+	je	.L304
+	.loc 1 995 25
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 704[rax], 1
+.L304:
+	.loc 1 997 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE43:
+	.size	lmsFilter_ChannelSaveCheckpoint, .-lmsFilter_ChannelSaveCheckpoint
+	.type	lmsFilter_ChannelCheckpointIfDue, @function
+lmsFilter_ChannelCheckpointIfDue:
+.LFB44:
+	.loc 1 1004 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 1005 34
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 680[rax]
+	.loc 1 1005 58
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 664[rax]
+	.loc 1 1005 16
+	add	rax, rdx
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 1007 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 688[rax]
+	.loc 1 1007 8
+	cmp	QWORD PTR -8[rbp], rax
+	jl	.L309
+	.loc 1 1009 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelSaveCheckpoint
+	.loc 1 1010 15
+	jmp	.L307
+.L308:
+	.loc 1 1012 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 688[rax]
+	.loc 1 1012 47
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 672[rax]
+	.loc 1 1012 59
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 1012 37
+	add	rdx, rax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 688[rax], rdx
+.L307:
+	.loc 1 1010 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 688[rax]
+	.loc 1 1010 40
+	cmp	QWORD PTR -8[rbp], rax
+	jge	.L308
+.L309:
+	.loc 1 1015 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE44:
+	.size	lmsFilter_ChannelCheckpointIfDue, .-lmsFilter_ChannelCheckpointIfDue
+	.type	lmsFilter_ChannelProcess, @function
+lmsFilter_ChannelProcess:
+.LFB45:
+	.loc 1 1022 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 1023 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 640[rax]
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 1024 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 644[rax]
+	.loc 1 1024 15
+	sub	eax, DWORD PTR -8[rbp]
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 1026 8
+	cmp	DWORD PTR -12[rbp], 0
+	jle	.L317
+	.loc 1 1026 33 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 704[rax]
+	.loc 1 1026 22 discriminator 1
+	test	eax, eax
+	jne	.L317
+	.loc 1 1032 16
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 648[rax]
+	.loc 1 1032 8
+	test	eax, eax
+	jne	.L314
+.LBB75:
+	.loc 1 1034 18
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 1034 9
+	jmp	.L315
+.L316:
+	.loc 1 1036 51 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 712[rax]
+	.loc 1 1036 60 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 1036 13 discriminator 3
+	mov	edx, DWORD PTR [rax]
+	mov	rax, QWORD PTR -24[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_ChannelPush
+	.loc 1 1034 39 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L315:
+	.loc 1 1034 27 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -8[rbp]
+	jl	.L316
+.LBE75:
+	.loc 1 1038 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 648[rax], 1
+.L314:
+	.loc 1 1042 73
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 712[rax]
+	.loc 1 1042 46
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 712[rax]
+	.loc 1 1042 55
+	mov	ecx, DWORD PTR -8[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	.loc 1 1042 38
+	lea	rsi, [rax+rcx]
+	.loc 1 1042 5
+	mov	ecx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelFilter
+	.loc 1 1043 44
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 712[rax]
+	.loc 1 1043 5
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_ChannelWrite
+	.loc 1 1045 5
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 1045 39
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 712[rax]
+	.loc 1 1045 48
+	mov	ecx, DWORD PTR -12[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	.loc 1 1045 31
+	add	rcx, rax
+	.loc 1 1045 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 712[rax]
+	.loc 1 1045 5
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memmove@PLT
+	.loc 1 1046 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR -8[rbp]
+	mov	DWORD PTR 644[rax], edx
+	.loc 1 1047 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelCheckpointIfDue
+	jmp	.L310
+.L317:
+	.loc 1 1028 9
+	nop
+.L310:
+	.loc 1 1048 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE45:
+	.size	lmsFilter_ChannelProcess, .-lmsFilter_ChannelProcess
+	.type	lmsFilter_ChannelFeed, @function
+lmsFilter_ChannelFeed:
+.LFB46:
+	.loc 1 1058 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	DWORD PTR -52[rbp], edx
+	mov	DWORD PTR -56[rbp], ecx
+	.loc 1 1059 57
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 640[rax]
+	.loc 1 1059 15
+	add	eax, 4096
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 1061 12
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 656[rax]
+	.loc 1 1061 27
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	add	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 656[rax], rdx
+	.loc 1 1062 16
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 696[rax]
+	.loc 1 1062 8
+	test	rax, rax
+	jle	.L322
+.LBB76:
+	.loc 1 1064 37
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 696[rax]
+	.loc 1 1064 44
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	.loc 1 1064 74
+	cmp	rdx, rax
+	jge	.L320
+	.loc 1 1064 67 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 696[rax]
+	jmp	.L321
+.L320:
+	.loc 1 1064 74 discriminator 2
+	mov	eax, DWORD PTR -56[rbp]
+.L321:
+	.loc 1 1064 19 discriminator 4
+	mov	DWORD PTR -16[rbp], eax
+	.loc 1 1065 18 discriminator 4
+	mov	eax, DWORD PTR -16[rbp]
+	movsx	rdx, eax
+	.loc 1 1065 32 discriminator 4
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 1065 15 discriminator 4
+	sal	rax, 2
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 1066 15 discriminator 4
+	mov	eax, DWORD PTR -16[rbp]
+	sub	DWORD PTR -56[rbp], eax
+	.loc 1 1067 16 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 696[rax]
+	.loc 1 1067 23 discriminator 4
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	sub	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 696[rax], rdx
+.LBE76:
+	.loc 1 1069 11 discriminator 4
+	jmp	.L322
+.L328:
+.LBB77:
+	.loc 1 1071 35
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 644[rax]
+	.loc 1 1071 13
+	mov	edx, DWORD PTR -12[rbp]
+	sub	edx, eax
+	mov	DWORD PTR -4[rbp], edx
+	.loc 1 1072 12
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jle	.L323
+	.loc 1 1074 15
+	mov	eax, DWORD PTR -56[rbp]
+	mov	DWORD PTR -4[rbp], eax
+.L323:
+	.loc 1 1076 30
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 712[rax]
+	.loc 1 1076 47
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 644[rax]
+	cdqe
+	.loc 1 1076 39
+	sal	rax, 2
+	.loc 1 1076 16
+	add	rax, rdx
+	mov	QWORD PTR -24[rbp], rax
+.LBB78:
+	.loc 1 1077 18
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 1077 9
+	jmp	.L324
+.L325:
+	.loc 1 1079 28 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	.loc 1 1079 36 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 1079 27 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 1079 16 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rcx
+	.loc 1 1079 27 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 1079 20 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 1077 33 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L324:
+	.loc 1 1077 27 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -4[rbp]
+	jl	.L325
+.LBE78:
+	.loc 1 1081 16
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR 644[rax]
+	.loc 1 1081 23
+	mov	eax, DWORD PTR -4[rbp]
+	add	edx, eax
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 644[rax], edx
+	.loc 1 1082 18
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 1082 26
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 1082 15
+	sal	rax, 2
+	add	QWORD PTR -48[rbp], rax
+	.loc 1 1083 15
+	mov	eax, DWORD PTR -4[rbp]
+	sub	DWORD PTR -56[rbp], eax
+	.loc 1 1085 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 644[rax]
+	.loc 1 1085 12
+	cmp	DWORD PTR -12[rbp], eax
+	jne	.L322
+	.loc 1 1087 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelProcess
+.L322:
+.LBE77:
+	.loc 1 1069 24
+	cmp	DWORD PTR -56[rbp], 0
+	jle	.L329
+	.loc 1 1069 35 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 704[rax]
+	.loc 1 1069 24 discriminator 1
+	test	eax, eax
+	je	.L328
+.L329:
+	.loc 1 1090 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE46:
+	.size	lmsFilter_ChannelFeed, .-lmsFilter_ChannelFeed
+	.section	.rodata
+	.align 8
+.LC40:
+	.string	"Error: Input ends before the position of the resumed checkpoint"
+	.align 8
+.LC41:
+	.string	"Error: Filter length cannot be greater than number of samples in file"
+	.text
+	.type	lmsFilter_ChannelFinish, @function
+lmsFilter_ChannelFinish:
+.LFB47:
+	.loc 1 1098 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 1101 16
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 696[rax]
+	.loc 1 1101 8
+	test	rax, rax
+	jle	.L331
+	.loc 1 1103 9
+	lea	rax, .LC40[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1104 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 704[rax], 1
+	.loc 1 1105 9
+	jmp	.L330
+.L331:
+	.loc 1 1107 16
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 656[rax]
+	.loc 1 1107 40
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 1107 48
+	mov	eax, DWORD PTR 4[rax]
+	cdqe
+	.loc 1 1107 8
+	cmp	rdx, rax
+	jge	.L333
+	.loc 1 1109 9
+	lea	rax, .LC41[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1110 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 704[rax], 1
+	.loc 1 1111 9
+	jmp	.L330
+.L333:
+	.loc 1 1113 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 672[rax]
+	.loc 1 1113 8
+	test	rax, rax
+	je	.L334
+	.loc 1 1113 50 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 672[rax]
+	.loc 1 1113 62 discriminator 1
+	mov	rax, QWORD PTR [rax]
+	.loc 1 1113 39 discriminator 1
+	test	rax, rax
+	je	.L334
+	.loc 1 1115 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelProcess
+	.loc 1 1116 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 704[rax]
+	.loc 1 1116 12
+	test	eax, eax
+	jne	.L335
+	.loc 1 1118 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelSaveCheckpoint
+.L335:
+	.loc 1 1120 33
+	mov	rax, QWORD PTR -24[rbp]
+	movabs	rcx, 9223372036854775807
+	mov	QWORD PTR 688[rax], rcx
+.L334:
+.LBB79:
+	.loc 1 1122 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 640[rax]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 1122 5
+	jmp	.L336
+.L337:
+	.loc 1 1124 9 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	mov	edx, 64
+	cmp	eax, edx
+	cmovle	edx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, edx
+	mov	edx, 1
+	lea	rsi, zeros.0[rip]
+	mov	rdi, rax
+	call	lmsFilter_ChannelFeed
+	.loc 1 1122 54 discriminator 3
+	sub	DWORD PTR -4[rbp], 64
+.L336:
+	.loc 1 1122 44 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jg	.L337
+.LBE79:
+	.loc 1 1126 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelProcess
+	.loc 1 1127 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	lmsFilter_FlushUpdate
+.L330:
+	.loc 1 1128 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE47:
+	.size	lmsFilter_ChannelFinish, .-lmsFilter_ChannelFinish
+	.type	lmsFilter_ChannelClose, @function
+lmsFilter_ChannelClose:
+.LFB48:
+	.loc 1 1136 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 112
+	mov	QWORD PTR -104[rbp], rdi
+	.loc 1 1137 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 1139 16
+	mov	rax, QWORD PTR -104[rbp]
+	mov	eax, DWORD PTR 624[rax]
+	.loc 1 1139 8
+	test	eax, eax
+	je	.L339
+	.loc 1 1139 33 discriminator 1
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 40
+	mov	rdi, rax
+	call	sampleIo_CloseWriter@PLT
+	.loc 1 1139 29 discriminator 1
+	test	eax, eax
+	je	.L339
+	.loc 1 1141 16
+	mov	DWORD PTR -4[rbp], 1
+.L339:
+	.loc 1 1143 17
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1143 8
+	test	rax, rax
+	je	.L340
+	.loc 1 1143 49 discriminator 1
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1143 60 discriminator 1
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 1143 38 discriminator 1
+	test	rax, rax
+	jle	.L340
+.LBB80:
+	.loc 1 1146 38
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1146 9
+	lea	rdx, -96[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsTelemetry_GetStats@PLT
+	.loc 1 1147 9
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdx, QWORD PTR 616[rax]
+	lea	rax, -96[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsTelemetry_PrintStats@PLT
+.L340:
+.LBE80:
+	.loc 1 1149 17
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1149 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1150 24
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 24[rax], 0
+	.loc 1 1151 16
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 1151 8
+	test	rax, rax
+	je	.L341
+	.loc 1 1153 21
+	mov	rax, QWORD PTR -104[rbp]
+	mov	eax, DWORD PTR 704[rax]
+	.loc 1 1153 12
+	test	eax, eax
+	jne	.L342
+	.loc 1 1153 51 discriminator 1
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdx, QWORD PTR 616[rax]
+	.loc 1 1153 72 discriminator 1
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 1153 51 discriminator 1
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsPlot_Write@PLT
+	.loc 1 1153 47 discriminator 1
+	test	eax, eax
+	je	.L342
+	.loc 1 1155 20
+	mov	DWORD PTR -4[rbp], 1
+.L342:
+	.loc 1 1157 9
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	mov	rdi, rax
+	call	lmsPlot_Free@PLT
+	.loc 1 1158 21
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 1158 9
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1159 23
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 32[rax], 0
+.L341:
+	.loc 1 1161 25
+	mov	rax, QWORD PTR -104[rbp]
+	mov	DWORD PTR 624[rax], 0
+	.loc 1 1162 17
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 712[rax]
+	.loc 1 1162 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1163 17
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 720[rax]
+	.loc 1 1163 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1164 17
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 728[rax]
+	.loc 1 1164 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1165 17
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 736[rax]
+	.loc 1 1165 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1166 22
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 712[rax], 0
+	.loc 1 1167 21
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 720[rax], 0
+	.loc 1 1168 20
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 728[rax], 0
+	.loc 1 1169 21
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 736[rax], 0
+	.loc 1 1170 5
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, 8
+	mov	rdi, rax
+	call	lmsEngine_Close@PLT
+	.loc 1 1171 16
+	mov	rax, QWORD PTR -104[rbp]
+	mov	eax, DWORD PTR 628[rax]
+	.loc 1 1171 8
+	test	eax, eax
+	je	.L343
+	.loc 1 1173 9
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	lmsFilter_Destroy
+	.loc 1 1174 25
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR [rax], 0
+.L343:
+	.loc 1 1176 17
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 632[rax]
+	.loc 1 1176 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1177 28
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 632[rax], 0
+	.loc 1 1179 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 1180 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE48:
+	.size	lmsFilter_ChannelClose, .-lmsFilter_ChannelClose
+	.section	.rodata
+	.align 8
+.LC42:
+	.string	"LMS filtering progress:       %d%%\r"
+	.align 8
+.LC43:
+	.string	"LMS filtered samples:         %ld\r"
+	.text
+	.type	lmsFilter_PrintProgress, @function
+lmsFilter_PrintProgress:
+.LFB49:
+	.loc 1 1188 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 1189 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	sampleIo_GetProgress@PLT
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 1190 8
+	cmp	DWORD PTR -4[rbp], 0
+	js	.L346
+	.loc 1 1192 9
+	mov	eax, DWORD PTR -4[rbp]
+	mov	esi, eax
+	lea	rax, .LC42[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L347
+.L346:
+	.loc 1 1196 9
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rsi, rax
+	lea	rax, .LC43[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L347:
+	.loc 1 1198 5
+	mov	rax, QWORD PTR stdout[rip]
+	mov	rdi, rax
+	call	fflush@PLT
+	.loc 1 1199 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE49:
+	.size	lmsFilter_PrintProgress, .-lmsFilter_PrintProgress
+	.type	lmsFilter_ReaderStage, @function
+lmsFilter_ReaderStage:
+.LFB50:
+	.loc 1 1207 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 1208 26
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 1209 10
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 1211 11
+	jmp	.L349
+.L353:
+.LBB81:
+	.loc 1 1213 64
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_AcquireWrite@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 1214 61
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rcx, 4[rax]
+	.loc 1 1214 24
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 4096
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	.loc 1 1214 22
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	DWORD PTR [rdx], eax
+	.loc 1 1215 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 1215 12
+	test	eax, eax
+	je	.L355
+	.loc 1 1219 9
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_CommitWrite@PLT
+	.loc 1 1220 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	cdqe
+	.loc 1 1220 21
+	add	QWORD PTR -8[rbp], rax
+	.loc 1 1222 21
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 456[rax]
+	.loc 1 1222 12
+	test	eax, eax
+	jne	.L349
+	.loc 1 1224 45
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 1224 13
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilter_PrintProgress
+.L349:
+.LBE81:
+	.loc 1 1211 28
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, 448
+	.loc 1 1211 12
+	mov	eax, DWORD PTR [rax]
+	.loc 1 1211 63
+	test	eax, eax
+	je	.L353
+	jmp	.L351
+.L355:
+.LBB82:
+	.loc 1 1217 13
+	nop
+.L351:
+.LBE82:
+	.loc 1 1227 5
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_Close@PLT
+	.loc 1 1228 12
+	mov	eax, 0
+	.loc 1 1229 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE50:
+	.size	lmsFilter_ReaderStage, .-lmsFilter_ReaderStage
+	.type	lmsFilter_WriterStage, @function
+lmsFilter_WriterStage:
+.LFB51:
+	.loc 1 1238 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 1239 26
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 1242 11
+	jmp	.L357
+.L359:
+	.loc 1 1244 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 452[rax]
+	.loc 1 1244 12
+	test	eax, eax
+	jne	.L358
+	.loc 1 1245 80
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 1245 65
+	mov	rdx, QWORD PTR -16[rbp]
+	lea	rsi, 4[rdx]
+	.loc 1 1245 41
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 8[rdx]
+	.loc 1 1245 17
+	lea	rcx, 40[rdx]
+	mov	edx, eax
+	mov	rdi, rcx
+	call	sampleIo_Write@PLT
+	.loc 1 1245 13
+	test	eax, eax
+	je	.L358
+	.loc 1 1247 28
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 1247 13
+	mov	rax, QWORD PTR 616[rax]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1248 35
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 452[rax], 1
+	.loc 1 1249 30
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 448
+	.loc 1 1249 13
+	mov	edx, 1
+	mov	DWORD PTR [rax], edx
+.L358:
+	.loc 1 1251 9
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 256
+	mov	rdi, rax
+	call	spscRing_ReleaseRead@PLT
+.L357:
+	.loc 1 1242 52
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 256
+	mov	rdi, rax
+	call	spscRing_AcquireRead@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 1242 93
+	cmp	QWORD PTR -16[rbp], 0
+	jne	.L359
+	.loc 1 1253 12
+	mov	eax, 0
+	.loc 1 1254 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE51:
+	.size	lmsFilter_WriterStage, .-lmsFilter_WriterStage
+	.section	.rodata
+.LC44:
+	.string	"pthread_create"
+	.text
+	.type	lmsFilter_ChannelRunPipeline, @function
+lmsFilter_ChannelRunPipeline:
+.LFB52:
+	.loc 1 1265 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -64
+	sub	rsp, 640
+	mov	QWORD PTR 40[rsp], rdi
+	mov	QWORD PTR 32[rsp], rsi
+	mov	QWORD PTR 24[rsp], rdx
+	.loc 1 1266 25
+	lea	rdx, 64[rsp]
+	mov	eax, 0
+	mov	ecx, 64
+	mov	rdi, rdx
+	rep stosq
+	mov	rax, QWORD PTR 32[rsp]
+	mov	QWORD PTR 64[rsp], rax
+	mov	rax, QWORD PTR 40[rsp]
+	mov	QWORD PTR 72[rsp], rax
+	.loc 1 1267 84
+	mov	rax, QWORD PTR 24[rsp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 1266 25
+	mov	DWORD PTR 520[rsp], eax
+	.loc 1 1271 9
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	edx, 16388
+	mov	esi, 4
+	mov	rdi, rax
+	call	spscRing_Init@PLT
+	.loc 1 1271 8
+	test	eax, eax
+	je	.L362
+	.loc 1 1273 25
+	mov	rax, QWORD PTR 40[rsp]
+	mov	DWORD PTR 704[rax], 1
+	.loc 1 1274 9
+	jmp	.L361
+.L362:
+	.loc 1 1276 9
+	lea	rax, 64[rsp]
+	add	rax, 256
+	mov	edx, 49156
+	mov	esi, 4
+	mov	rdi, rax
+	call	spscRing_Init@PLT
+	.loc 1 1276 8
+	test	eax, eax
+	je	.L364
+	.loc 1 1278 9
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_Free@PLT
+	.loc 1 1279 25
+	mov	rax, QWORD PTR 40[rsp]
+	mov	DWORD PTR 704[rax], 1
+	.loc 1 1280 9
+	jmp	.L361
+.L364:
+	.loc 1 1282 9
+	lea	rdx, 64[rsp]
+	lea	rax, 56[rsp]
+	mov	rcx, rdx
+	lea	rdx, lmsFilter_ReaderStage[rip]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_create@PLT
+	.loc 1 1282 8
+	test	eax, eax
+	je	.L365
+	.loc 1 1284 9
+	lea	rax, .LC44[rip]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1285 9
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_Free@PLT
+	.loc 1 1286 9
+	lea	rax, 64[rsp]
+	add	rax, 256
+	mov	rdi, rax
+	call	spscRing_Free@PLT
+	.loc 1 1287 25
+	mov	rax, QWORD PTR 40[rsp]
+	mov	DWORD PTR 704[rax], 1
+	.loc 1 1288 9
+	jmp	.L361
+.L365:
+	.loc 1 1290 9
+	lea	rdx, 64[rsp]
+	lea	rax, 48[rsp]
+	mov	rcx, rdx
+	lea	rdx, lmsFilter_WriterStage[rip]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_create@PLT
+	.loc 1 1290 8
+	test	eax, eax
+	je	.L366
+	.loc 1 1292 9
+	lea	rax, .LC44[rip]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1293 9
+	mov	eax, 1
+	mov	DWORD PTR 512[rsp], eax
+	.loc 1 1294 15
+	jmp	.L367
+.L368:
+	.loc 1 1296 13
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_ReleaseRead@PLT
+.L367:
+	.loc 1 1294 16
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_AcquireRead@PLT
+	.loc 1 1294 54
+	test	rax, rax
+	jne	.L368
+	.loc 1 1298 9
+	mov	rax, QWORD PTR 56[rsp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_join@PLT
+	.loc 1 1299 9
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_Free@PLT
+	.loc 1 1300 9
+	lea	rax, 64[rsp]
+	add	rax, 256
+	mov	rdi, rax
+	call	spscRing_Free@PLT
+	.loc 1 1301 25
+	mov	rax, QWORD PTR 40[rsp]
+	mov	DWORD PTR 704[rax], 1
+	.loc 1 1302 9
+	jmp	.L361
+.L366:
+	.loc 1 1305 25
+	mov	rax, QWORD PTR 40[rsp]
+	lea	rdx, 64[rsp]
+	add	rdx, 256
+	mov	QWORD PTR 744[rax], rdx
+	.loc 1 1307 11
+	jmp	.L369
+.L372:
+	.loc 1 1310 20
+	mov	rax, QWORD PTR 40[rsp]
+	mov	eax, DWORD PTR 704[rax]
+	.loc 1 1310 12
+	test	eax, eax
+	jne	.L370
+	.loc 1 1312 68
+	mov	rax, QWORD PTR 632[rsp]
+	mov	edx, DWORD PTR [rax]
+	.loc 1 1312 49
+	mov	rax, QWORD PTR 632[rsp]
+	lea	rsi, 4[rax]
+	.loc 1 1312 13
+	mov	rax, QWORD PTR 40[rsp]
+	mov	ecx, edx
+	mov	edx, 1
+	mov	rdi, rax
+	call	lmsFilter_ChannelFeed
+	jmp	.L371
+.L370:
+	.loc 1 1316 13
+	mov	eax, 1
+	mov	DWORD PTR 512[rsp], eax
+.L371:
+	.loc 1 1318 9
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_ReleaseRead@PLT
+.L369:
+	.loc 1 1307 51
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_AcquireRead@PLT
+	mov	QWORD PTR 632[rsp], rax
+	.loc 1 1307 90
+	cmp	QWORD PTR 632[rsp], 0
+	jne	.L372
+	.loc 1 1320 16
+	mov	rax, QWORD PTR 40[rsp]
+	mov	eax, DWORD PTR 704[rax]
+	.loc 1 1320 8
+	test	eax, eax
+	jne	.L373
+	.loc 1 1322 9
+	mov	rax, QWORD PTR 40[rsp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelFinish
+.L373:
+	.loc 1 1324 5
+	lea	rax, 64[rsp]
+	add	rax, 256
+	mov	rdi, rax
+	call	spscRing_Close@PLT
+	.loc 1 1326 5
+	mov	rax, QWORD PTR 56[rsp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_join@PLT
+	.loc 1 1327 5
+	mov	rax, QWORD PTR 48[rsp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_join@PLT
+	.loc 1 1328 25
+	mov	rax, QWORD PTR 40[rsp]
+	mov	QWORD PTR 744[rax], 0
+	.loc 1 1329 17
+	mov	eax, DWORD PTR 516[rsp]
+	.loc 1 1329 8
+	test	eax, eax
+	je	.L374
+	.loc 1 1331 25
+	mov	rax, QWORD PTR 40[rsp]
+	mov	DWORD PTR 704[rax], 1
+.L374:
+	.loc 1 1333 5
+	lea	rax, 64[rsp]
+	add	rax, 64
+	mov	rdi, rax
+	call	spscRing_Free@PLT
+	.loc 1 1334 5
+	lea	rax, 64[rsp]
+	add	rax, 256
+	mov	rdi, rax
+	call	spscRing_Free@PLT
+.L361:
+	.loc 1 1335 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE52:
+	.size	lmsFilter_ChannelRunPipeline, .-lmsFilter_ChannelRunPipeline
+	.section	.rodata
+	.align 8
+.LC45:
+	.string	"Error: Input file must have %d channel(s)\n"
+	.align 8
+.LC46:
+	.string	"Error: Desired signal file must have one channel"
+	.align 8
+.LC47:
+	.string	"WARNING: Desired signal ends at sample %ld, before the input\n"
+	.align 8
+.LC48:
+	.string	"WARNING: Desired signal is longer than the input, the rest is ignored"
+	.align 8
+.LC49:
+	.string	"\nFiltered samples:             %ld\n"
+	.text
+	.type	lmsFilter_FilterTwoStreams, @function
+lmsFilter_FilterTwoStreams:
+.LFB53:
+	.loc 1 1347 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 2144
+	mov	QWORD PTR -2120[rbp], rdi
+	mov	QWORD PTR -2128[rbp], rsi
+	mov	QWORD PTR -2136[rbp], rdx
+	.loc 1 1348 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 1352 39
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1352 55
+	test	eax, eax
+	je	.L377
+	.loc 1 1352 55 is_stmt 0 discriminator 1
+	mov	eax, 2
+	jmp	.L378
+.L377:
+	.loc 1 1352 55 discriminator 2
+	mov	eax, 1
+.L378:
+	.loc 1 1352 15 is_stmt 1 discriminator 4
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 1354 61 discriminator 4
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 1354 9 discriminator 4
+	mov	ecx, DWORD PTR -20[rbp]
+	mov	rsi, QWORD PTR -2128[rbp]
+	lea	rax, -704[rbp]
+	mov	rdi, rax
+	call	sampleIo_OpenReader@PLT
+	.loc 1 1354 8 discriminator 4
+	test	eax, eax
+	je	.L379
+	.loc 1 1356 16
+	mov	eax, 1
+	jmp	.L413
+.L379:
+	.loc 1 1358 15
+	mov	eax, DWORD PTR -692[rbp]
+	.loc 1 1358 8
+	cmp	DWORD PTR -20[rbp], eax
+	je	.L381
+	.loc 1 1360 9
+	mov	eax, DWORD PTR -20[rbp]
+	mov	esi, eax
+	lea	rax, .LC45[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1361 9
+	lea	rax, -704[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1362 16
+	mov	eax, 1
+	jmp	.L413
+.L381:
+	.loc 1 1364 17
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1364 8
+	test	eax, eax
+	jne	.L382
+	.loc 1 1366 84
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 1366 57
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	rsi, QWORD PTR 24[rax]
+	.loc 1 1366 13
+	lea	rax, -1344[rbp]
+	mov	ecx, 1
+	mov	rdi, rax
+	call	sampleIo_OpenReader@PLT
+	.loc 1 1366 12
+	test	eax, eax
+	je	.L383
+	.loc 1 1368 13
+	lea	rax, -704[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1369 20
+	mov	eax, 1
+	jmp	.L413
+.L383:
+	.loc 1 1371 26
+	mov	eax, DWORD PTR -1332[rbp]
+	.loc 1 1371 12
+	cmp	eax, 1
+	je	.L382
+	.loc 1 1373 13
+	lea	rax, .LC46[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1374 13
+	lea	rax, -1344[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1375 13
+	lea	rax, -704[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1376 20
+	mov	eax, 1
+	jmp	.L413
+.L382:
+	.loc 1 1380 30
+	mov	rcx, QWORD PTR -2136[rbp]
+	mov	rax, QWORD PTR -2128[rbp]
+	mov	edx, -1
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_OutputFileName
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 1381 50
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 1382 64
+	test	eax, eax
+	je	.L384
+	.loc 1 1382 64 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	jmp	.L385
+.L384:
+	.loc 1 1382 64 discriminator 2
+	mov	eax, DWORD PTR -696[rbp]
+.L385:
+	.loc 1 1381 26 is_stmt 1
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 1383 30
+	mov	edi, 16384
+	call	malloc@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 1384 30
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1384 102
+	test	eax, eax
+	je	.L386
+	.loc 1 1384 52 discriminator 1
+	mov	edi, 32768
+	call	malloc@PLT
+	jmp	.L387
+.L386:
+	.loc 1 1384 102 discriminator 2
+	mov	eax, 0
+.L387:
+	.loc 1 1384 12 discriminator 4
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 1386 8 discriminator 4
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L388
+	.loc 1 1386 36 discriminator 1
+	cmp	QWORD PTR -48[rbp], 0
+	je	.L388
+	.loc 1 1386 69 discriminator 2
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1386 57 discriminator 2
+	test	eax, eax
+	je	.L389
+	.loc 1 1386 81 discriminator 3
+	cmp	QWORD PTR -56[rbp], 0
+	je	.L388
+.L389:
+	.loc 1 1388 62
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	edi, DWORD PTR 40[rax]
+	.loc 1 1387 13
+	mov	r9d, DWORD PTR -688[rbp]
+	mov	r8d, DWORD PTR -36[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -2136[rbp]
+	mov	rsi, QWORD PTR -2120[rbp]
+	lea	rax, -2096[rbp]
+	sub	rsp, 8
+	push	rdi
+	mov	rdi, rax
+	call	lmsFilter_ChannelOpen
+	add	rsp, 16
+	.loc 1 1387 9
+	test	eax, eax
+	je	.L390
+.L388:
+	.loc 1 1390 9
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1391 9
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1392 9
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1393 21
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1393 12
+	test	eax, eax
+	jne	.L391
+	.loc 1 1395 13
+	lea	rax, -1344[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+.L391:
+	.loc 1 1397 9
+	lea	rax, -704[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1398 16
+	mov	eax, 1
+	jmp	.L413
+.L390:
+	.loc 1 1401 84
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	edx, DWORD PTR 96[rax]
+	.loc 1 1401 59
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	rsi, QWORD PTR 80[rax]
+	.loc 1 1401 9
+	lea	rax, -2096[rbp]
+	mov	ecx, edx
+	mov	edx, 0
+	mov	rdi, rax
+	call	lmsFilter_ChannelOpenCheckpoint
+	.loc 1 1401 8
+	test	eax, eax
+	je	.L392
+	.loc 1 1403 24
+	mov	DWORD PTR -1392[rbp], 1
+.L392:
+	.loc 1 1407 12
+	mov	rax, QWORD PTR -1384[rbp]
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 1408 9
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 1409 11
+	jmp	.L393
+.L405:
+.LBB83:
+	.loc 1 1412 21
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1412 12
+	test	eax, eax
+	je	.L394
+	.loc 1 1414 21
+	mov	rcx, QWORD PTR -56[rbp]
+	lea	rax, -704[rbp]
+	mov	edx, 4096
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -12[rbp], eax
+.LBB84:
+	.loc 1 1415 22
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 1415 13
+	jmp	.L395
+.L396:
+	.loc 1 1417 38 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 1417 35 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rdx, rax
+	.loc 1 1417 22 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rcx
+	.loc 1 1417 35 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 1417 26 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 1418 40 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	add	eax, eax
+	.loc 1 1418 37 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rdx, rax
+	.loc 1 1418 24 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rcx
+	.loc 1 1418 37 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 1418 28 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 1415 41 discriminator 3
+	add	DWORD PTR -16[rbp], 1
+.L395:
+	.loc 1 1415 31 discriminator 1
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jl	.L396
+	jmp	.L397
+.L394:
+.LBE84:
+.LBB85:
+	.loc 1 1423 21
+	mov	rcx, QWORD PTR -64[rbp]
+	lea	rax, -704[rbp]
+	mov	edx, 4096
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 1424 32
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rcx, QWORD PTR -48[rbp]
+	lea	rax, -1344[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -68[rbp], eax
+	.loc 1 1425 16
+	mov	eax, DWORD PTR -68[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jge	.L397
+	.loc 1 1427 97
+	mov	rdx, QWORD PTR -1432[rbp]
+	.loc 1 1427 17
+	mov	eax, DWORD PTR -68[rbp]
+	cdqe
+	add	rax, rdx
+	mov	rsi, rax
+	lea	rax, .LC47[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1428 23
+	mov	eax, DWORD PTR -68[rbp]
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 1429 30
+	mov	DWORD PTR -8[rbp], 1
+.L397:
+.LBE85:
+	.loc 1 1432 12
+	cmp	DWORD PTR -12[rbp], 0
+	je	.L414
+	.loc 1 1436 20
+	mov	rax, QWORD PTR -1400[rbp]
+	.loc 1 1436 12
+	test	rax, rax
+	jle	.L400
+.LBB86:
+	.loc 1 1439 41
+	mov	rdx, QWORD PTR -1400[rbp]
+	.loc 1 1439 47
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	.loc 1 1439 76
+	cmp	rdx, rax
+	jge	.L401
+	.loc 1 1439 70 discriminator 1
+	mov	rax, QWORD PTR -1400[rbp]
+	jmp	.L402
+.L401:
+	.loc 1 1439 76 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+.L402:
+	.loc 1 1439 23 discriminator 4
+	mov	DWORD PTR -72[rbp], eax
+	.loc 1 1440 52 discriminator 4
+	mov	eax, DWORD PTR -12[rbp]
+	sub	eax, DWORD PTR -72[rbp]
+	cdqe
+	.loc 1 1440 13 discriminator 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 1440 34 discriminator 4
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	lea	rcx, 0[0+rax*4]
+	.loc 1 1440 28 discriminator 4
+	mov	rax, QWORD PTR -64[rbp]
+	add	rcx, rax
+	.loc 1 1440 13 discriminator 4
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memmove@PLT
+	.loc 1 1441 56 discriminator 4
+	mov	eax, DWORD PTR -12[rbp]
+	sub	eax, DWORD PTR -72[rbp]
+	cdqe
+	.loc 1 1441 13 discriminator 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 1441 38 discriminator 4
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	lea	rcx, 0[0+rax*4]
+	.loc 1 1441 30 discriminator 4
+	mov	rax, QWORD PTR -48[rbp]
+	add	rcx, rax
+	.loc 1 1441 13 discriminator 4
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memmove@PLT
+	.loc 1 1442 20 discriminator 4
+	mov	rdx, QWORD PTR -1400[rbp]
+	.loc 1 1442 26 discriminator 4
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	sub	rdx, rax
+	mov	QWORD PTR -1400[rbp], rdx
+	.loc 1 1443 19 discriminator 4
+	mov	eax, DWORD PTR -72[rbp]
+	sub	DWORD PTR -12[rbp], eax
+.L400:
+.LBE86:
+	.loc 1 1445 12
+	cmp	DWORD PTR -12[rbp], 0
+	jle	.L403
+	.loc 1 1447 13
+	mov	ecx, DWORD PTR -12[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rsi, QWORD PTR -64[rbp]
+	lea	rax, -2096[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelFilter
+	.loc 1 1448 13
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rcx, QWORD PTR -64[rbp]
+	lea	rax, -2096[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_ChannelWrite
+	.loc 1 1449 13
+	lea	rax, -2096[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelCheckpointIfDue
+.L403:
+	.loc 1 1452 21
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 1452 12
+	test	eax, eax
+	jne	.L404
+	.loc 1 1454 13
+	mov	rdx, QWORD PTR -1432[rbp]
+	lea	rax, -704[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilter_PrintProgress
+.L404:
+	.loc 1 1456 12
+	cmp	DWORD PTR -8[rbp], 0
+	jne	.L415
+.L393:
+.LBE83:
+	.loc 1 1409 19
+	mov	eax, DWORD PTR -1392[rbp]
+	.loc 1 1409 27
+	test	eax, eax
+	je	.L405
+	jmp	.L399
+.L414:
+.LBB87:
+	.loc 1 1434 13
+	nop
+	jmp	.L399
+.L415:
+	.loc 1 1458 13
+	nop
+.L399:
+.LBE87:
+	.loc 1 1463 18
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1463 8
+	test	eax, eax
+	jne	.L406
+	.loc 1 1463 36 discriminator 1
+	cmp	DWORD PTR -8[rbp], 0
+	jne	.L406
+	.loc 1 1463 70 discriminator 2
+	mov	eax, DWORD PTR -1392[rbp]
+	.loc 1 1463 59 discriminator 2
+	test	eax, eax
+	jne	.L406
+	.loc 1 1464 13
+	lea	rcx, -2100[rbp]
+	lea	rax, -1344[rbp]
+	mov	edx, 1
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	.loc 1 1464 9
+	test	eax, eax
+	jle	.L406
+	.loc 1 1466 9
+	lea	rax, .LC48[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L406:
+	.loc 1 1468 17
+	mov	rax, QWORD PTR -1400[rbp]
+	.loc 1 1468 8
+	test	rax, rax
+	jle	.L407
+	.loc 1 1468 39 discriminator 1
+	mov	eax, DWORD PTR -1392[rbp]
+	.loc 1 1468 28 discriminator 1
+	test	eax, eax
+	jne	.L407
+	.loc 1 1470 9
+	lea	rax, .LC40[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1471 24
+	mov	DWORD PTR -1392[rbp], 1
+.L407:
+	.loc 1 1473 16
+	mov	eax, DWORD PTR -1392[rbp]
+	.loc 1 1473 8
+	test	eax, eax
+	jne	.L408
+	.loc 1 1475 9
+	lea	rax, -2096[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelSaveCheckpoint
+.L408:
+	.loc 1 1477 5
+	mov	rax, QWORD PTR -2120[rbp]
+	mov	rdi, rax
+	call	lmsFilter_FlushUpdate
+	.loc 1 1479 17
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 1479 8
+	test	eax, eax
+	jne	.L409
+	.loc 1 1481 9
+	mov	rax, QWORD PTR -1432[rbp]
+	mov	rsi, rax
+	lea	rax, .LC49[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L409:
+	.loc 1 1483 12
+	mov	eax, DWORD PTR -1392[rbp]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 1485 9
+	lea	rax, -2096[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 1485 8
+	test	eax, eax
+	je	.L410
+	.loc 1 1487 9
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1488 16
+	mov	DWORD PTR -4[rbp], 1
+.L410:
+	.loc 1 1491 5
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1492 5
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1493 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1494 18
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1494 8
+	test	eax, eax
+	jne	.L411
+	.loc 1 1494 39 discriminator 1
+	lea	rax, -1344[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1494 36 discriminator 1
+	test	eax, eax
+	je	.L411
+	.loc 1 1496 24
+	mov	rax, QWORD PTR -2136[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1496 9
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1497 16
+	mov	DWORD PTR -4[rbp], 1
+.L411:
+	.loc 1 1499 9
+	lea	rax, -704[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1499 8
+	test	eax, eax
+	je	.L412
+	.loc 1 1501 9
+	mov	rax, QWORD PTR -2128[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1502 16
+	mov	DWORD PTR -4[rbp], 1
+.L412:
+	.loc 1 1504 12
+	mov	eax, DWORD PTR -4[rbp]
+.L413:
+	.loc 1 1505 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE53:
+	.size	lmsFilter_FilterTwoStreams, .-lmsFilter_FilterTwoStreams
+	.section	.rodata
+	.align 8
+.LC50:
+	.string	"Error allocating memory for samples"
+	.text
+	.type	lmsFilter_ReadAll, @function
+lmsFilter_ReadAll:
+.LFB54:
+	.loc 1 1516 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -56[rbp], rdi
+	mov	QWORD PTR -64[rbp], rsi
+	mov	QWORD PTR -72[rbp], rdx
+	mov	DWORD PTR -76[rbp], ecx
+	.loc 1 1517 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 1518 10
+	mov	QWORD PTR -8[rbp], 4096
+	.loc 1 1519 10
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 1520 12
+	mov	QWORD PTR -24[rbp], 0
+.L425:
+.LBB88:
+	.loc 1 1524 12
+	cmp	QWORD PTR -24[rbp], 0
+	je	.L419
+	.loc 1 1524 40 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 4096[rax]
+	.loc 1 1524 64 discriminator 1
+	mov	eax, DWORD PTR -76[rbp]
+	cdqe
+	add	rax, rdx
+	.loc 1 1524 30 discriminator 1
+	cmp	QWORD PTR -8[rbp], rax
+	jge	.L418
+.LBB89:
+	.loc 1 1526 19
+	jmp	.L419
+.L420:
+	.loc 1 1528 26
+	sal	QWORD PTR -8[rbp]
+.L419:
+	.loc 1 1526 26
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 4096[rax]
+	.loc 1 1526 50
+	mov	eax, DWORD PTR -76[rbp]
+	cdqe
+	add	rax, rdx
+	.loc 1 1526 60
+	cmp	QWORD PTR -8[rbp], rax
+	jl	.L420
+	.loc 1 1530 69
+	mov	eax, DWORD PTR -28[rbp]
+	movsx	rdx, eax
+	.loc 1 1530 52
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 1530 69
+	imul	rax, rdx
+	.loc 1 1530 36
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	realloc@PLT
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 1531 16
+	cmp	QWORD PTR -40[rbp], 0
+	jne	.L421
+	.loc 1 1533 17
+	lea	rax, .LC50[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1534 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1535 24
+	mov	eax, 1
+	jmp	.L422
+.L421:
+	.loc 1 1537 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -24[rbp], rax
+.L418:
+.LBE89:
+	.loc 1 1539 53
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	imul	rax, QWORD PTR -16[rbp]
+	.loc 1 1539 46
+	lea	rdx, 0[0+rax*4]
+	.loc 1 1539 17
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rcx, [rdx+rax]
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, 4096
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -44[rbp], eax
+	.loc 1 1540 12
+	cmp	DWORD PTR -44[rbp], 0
+	je	.L427
+	.loc 1 1544 15
+	mov	eax, DWORD PTR -44[rbp]
+	cdqe
+	add	QWORD PTR -16[rbp], rax
+.LBE88:
+	.loc 1 1523 5
+	jmp	.L425
+.L427:
+.LBB90:
+	.loc 1 1542 13
+	nop
+.LBE90:
+	.loc 1 1546 42
+	mov	eax, DWORD PTR -76[rbp]
+	movsx	rdx, eax
+	.loc 1 1546 58
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 1546 5
+	lea	rdx, 0[0+rax*4]
+	.loc 1 1546 26
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	imul	rax, QWORD PTR -16[rbp]
+	.loc 1 1546 19
+	lea	rcx, 0[0+rax*4]
+	.loc 1 1546 12
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rcx
+	.loc 1 1546 5
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 1547 14
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 1548 13
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 1549 12
+	mov	eax, 0
+.L422:
+	.loc 1 1550 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE54:
+	.size	lmsFilter_ReadAll, .-lmsFilter_ReadAll
+	.type	lmsFilter_RealtimeWorker, @function
+lmsFilter_RealtimeWorker:
+.LFB55:
+	.loc 1 1560 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -72[rbp], rdi
+	.loc 1 1561 29
+	mov	rax, QWORD PTR -72[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 1562 20
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 1563 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 1566 33
+	mov	rax, QWORD PTR -24[rbp]
+	.loc 1 1566 5
+	mov	rdi, rax
+	call	lmsRealtime_ConfigureThread@PLT
+	.loc 1 1567 5
+	lea	rax, -64[rbp]
+	mov	rsi, rax
+	mov	edi, 1
+	call	clock_gettime@PLT
+.LBB91:
+	.loc 1 1569 15
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 1569 5
+	jmp	.L429
+.L440:
+.LBB92:
+	.loc 1 1571 31
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 1571 39
+	sub	rax, QWORD PTR -8[rbp]
+	mov	rdx, rax
+	.loc 1 1571 43
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	.loc 1 1571 80
+	cmp	rdx, rax
+	jge	.L430
+	.loc 1 1571 67 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 1571 75 discriminator 1
+	mov	ecx, eax
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, eax
+	mov	eax, ecx
+	sub	eax, edx
+	jmp	.L431
+.L430:
+	.loc 1 1571 80 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+.L431:
+	.loc 1 1571 19 discriminator 4
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 1576 31 discriminator 4
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 1576 12 discriminator 4
+	test	eax, eax
+	je	.L432
+	.loc 1 1578 13
+	lea	rax, -64[rbp]
+	mov	ecx, 0
+	mov	rdx, rax
+	mov	esi, 1
+	mov	edi, 1
+	call	clock_nanosleep@PLT
+.L432:
+	.loc 1 1580 60
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 1581 111
+	test	eax, eax
+	je	.L433
+	.loc 1 1581 69 discriminator 1
+	mov	rax, QWORD PTR -64[rbp]
+	.loc 1 1581 77 discriminator 1
+	imul	rax, rax, 1000000000
+	.loc 1 1581 102 discriminator 1
+	mov	rdx, QWORD PTR -56[rbp]
+	.loc 1 1581 111 discriminator 1
+	add	rax, rdx
+	jmp	.L434
+.L433:
+	.loc 1 1582 42
+	call	lmsRealtime_Now@PLT
+.L434:
+	.loc 1 1580 34
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 1585 46
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 1585 53
+	mov	rdx, QWORD PTR -8[rbp]
+	sal	rdx, 2
+	.loc 1 1584 18
+	lea	r8, [rax+rdx]
+	.loc 1 1584 94
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1584 102
+	mov	rdx, QWORD PTR -8[rbp]
+	sal	rdx, 2
+	.loc 1 1584 18
+	lea	rcx, [rax+rdx]
+	.loc 1 1584 76
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 1584 85
+	mov	rdx, QWORD PTR -8[rbp]
+	sal	rdx, 2
+	.loc 1 1584 18
+	add	rdx, rax
+	.loc 1 1584 60
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 1584 67
+	mov	rsi, QWORD PTR -8[rbp]
+	sal	rsi, 2
+	.loc 1 1584 18
+	add	rsi, rax
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	edi, DWORD PTR -32[rbp]
+	mov	r9d, edi
+	mov	rdi, rax
+	call	lmsFilter_ChannelEngine
+	mov	DWORD PTR -44[rbp], eax
+	.loc 1 1586 38
+	call	lmsRealtime_Now@PLT
+	.loc 1 1586 9
+	sub	rax, QWORD PTR -40[rbp]
+	mov	rdx, rax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsRealtime_Record@PLT
+	.loc 1 1589 16
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 1589 25
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1589 12
+	test	rax, rax
+	je	.L435
+	.loc 1 1591 74
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 1591 81
+	mov	rdx, QWORD PTR -8[rbp]
+	sal	rdx, 2
+	.loc 1 1591 70
+	lea	rdi, [rax+rdx]
+	.loc 1 1591 56
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 1591 65
+	mov	rdx, QWORD PTR -8[rbp]
+	sal	rdx, 2
+	.loc 1 1591 13
+	lea	rsi, [rax+rdx]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	edx, DWORD PTR -32[rbp]
+	mov	ecx, edx
+	mov	rdx, rdi
+	mov	rdi, rax
+	call	lmsFilter_ChannelObserve
+.L435:
+	.loc 1 1593 28
+	mov	eax, DWORD PTR -32[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -8[rbp]
+	add	rdx, rax
+	.loc 1 1593 24
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 1594 12
+	cmp	DWORD PTR -44[rbp], 0
+	je	.L436
+	.loc 1 1596 25
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 64[rax], 1
+	.loc 1 1597 13
+	jmp	.L437
+.L436:
+	.loc 1 1600 16
+	mov	rdx, QWORD PTR -56[rbp]
+	.loc 1 1600 42
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1600 25
+	add	rax, rdx
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 1601 15
+	jmp	.L438
+.L439:
+	.loc 1 1603 20
+	mov	rax, QWORD PTR -56[rbp]
+	.loc 1 1603 29
+	sub	rax, 1000000000
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 1604 20
+	mov	rax, QWORD PTR -64[rbp]
+	.loc 1 1604 27
+	add	rax, 1
+	mov	QWORD PTR -64[rbp], rax
+.L438:
+	.loc 1 1601 23
+	mov	rax, QWORD PTR -56[rbp]
+	.loc 1 1601 32
+	cmp	rax, 999999999
+	jg	.L439
+.LBE92:
+	.loc 1 1569 40 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	add	QWORD PTR -8[rbp], rax
+.L429:
+	.loc 1 1569 29 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 1569 24 discriminator 1
+	cmp	QWORD PTR -8[rbp], rax
+	jl	.L440
+.L437:
+.LBE91:
+	.loc 1 1607 30
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 1607 5
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	lmsFilter_FlushUpdate
+	.loc 1 1608 12
+	mov	eax, 0
+	.loc 1 1609 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE55:
+	.size	lmsFilter_RealtimeWorker, .-lmsFilter_RealtimeWorker
+	.section	.rodata
+	.align 8
+.LC51:
+	.string	"Error: A real-time run can only warm start from a checkpoint"
+	.align 8
+.LC52:
+	.string	"Filtered samples:             %ld\n"
+	.align 8
+.LC53:
+	.string	"Block size:                   %d samples at %u Hz\n"
+	.text
+	.type	lmsFilter_FilterRealtime, @function
+lmsFilter_FilterRealtime:
+.LFB56:
+	.loc 1 1622 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 2304
+	mov	QWORD PTR -2280[rbp], rdi
+	mov	QWORD PTR -2288[rbp], rsi
+	mov	QWORD PTR -2296[rbp], rdx
+	.loc 1 1623 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 1626 55
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	rcx, QWORD PTR 64[rax]
+	.loc 1 1626 27
+	mov	rax, QWORD PTR [rcx]
+	mov	rdx, QWORD PTR 8[rcx]
+	mov	QWORD PTR -1520[rbp], rax
+	mov	QWORD PTR -1512[rbp], rdx
+	mov	eax, DWORD PTR 16[rcx]
+	mov	DWORD PTR -1504[rbp], eax
+	.loc 1 1627 20
+	mov	QWORD PTR -48[rbp], 0
+	.loc 1 1628 28
+	pxor	xmm0, xmm0
+	movaps	XMMWORD PTR -1600[rbp], xmm0
+	movaps	XMMWORD PTR -1584[rbp], xmm0
+	movaps	XMMWORD PTR -1568[rbp], xmm0
+	movaps	XMMWORD PTR -1552[rbp], xmm0
+	movq	QWORD PTR -1536[rbp], xmm0
+	lea	rax, -1488[rbp]
+	mov	QWORD PTR -1600[rbp], rax
+	.loc 1 1629 37
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1629 64
+	test	rax, rax
+	jne	.L443
+	.loc 1 1629 75 discriminator 2
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1629 64 discriminator 2
+	test	eax, eax
+	je	.L444
+.L443:
+	.loc 1 1629 64 is_stmt 0 discriminator 3
+	mov	eax, 1
+	jmp	.L445
+.L444:
+	.loc 1 1629 64 discriminator 4
+	mov	eax, 0
+.L445:
+	.loc 1 1629 15 is_stmt 1 discriminator 6
+	mov	DWORD PTR -52[rbp], eax
+	.loc 1 1630 39 discriminator 6
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1630 55 discriminator 6
+	test	eax, eax
+	je	.L446
+	.loc 1 1630 55 is_stmt 0 discriminator 1
+	mov	eax, 2
+	jmp	.L447
+.L446:
+	.loc 1 1630 55 discriminator 2
+	mov	eax, 1
+.L447:
+	.loc 1 1630 15 is_stmt 1 discriminator 4
+	mov	DWORD PTR -56[rbp], eax
+	.loc 1 1631 12 discriminator 4
+	mov	QWORD PTR -1608[rbp], 0
+	.loc 1 1632 12 discriminator 4
+	mov	QWORD PTR -1616[rbp], 0
+	.loc 1 1633 12 discriminator 4
+	mov	QWORD PTR -64[rbp], 0
+	.loc 1 1634 10 discriminator 4
+	mov	QWORD PTR -1624[rbp], 0
+	.loc 1 1636 18 discriminator 4
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 1636 8 discriminator 4
+	test	rax, rax
+	je	.L448
+	.loc 1 1637 22
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 1637 34
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 1637 9
+	test	rax, rax
+	jne	.L449
+	.loc 1 1637 72 discriminator 1
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 1637 84 discriminator 1
+	mov	rax, QWORD PTR [rax]
+	.loc 1 1637 60 discriminator 1
+	test	rax, rax
+	je	.L448
+.L449:
+	.loc 1 1639 9
+	lea	rax, .LC51[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1640 16
+	mov	eax, 1
+	jmp	.L496
+.L448:
+	.loc 1 1642 61
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 1642 9
+	mov	ecx, DWORD PTR -56[rbp]
+	mov	rsi, QWORD PTR -2288[rbp]
+	lea	rax, -736[rbp]
+	mov	rdi, rax
+	call	sampleIo_OpenReader@PLT
+	.loc 1 1642 8
+	test	eax, eax
+	je	.L451
+	.loc 1 1644 16
+	mov	eax, 1
+	jmp	.L496
+.L451:
+	.loc 1 1646 15
+	mov	eax, DWORD PTR -724[rbp]
+	.loc 1 1646 8
+	cmp	DWORD PTR -56[rbp], eax
+	je	.L452
+	.loc 1 1648 9
+	mov	eax, DWORD PTR -56[rbp]
+	mov	esi, eax
+	lea	rax, .LC45[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1649 9
+	lea	rax, -736[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1650 16
+	mov	eax, 1
+	jmp	.L496
+.L452:
+	.loc 1 1654 40
+	cmp	DWORD PTR -52[rbp], 0
+	jne	.L453
+	.loc 1 1654 48 discriminator 1
+	mov	rax, QWORD PTR -2280[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 1654 40 discriminator 1
+	sub	eax, 1
+	jmp	.L454
+.L453:
+	.loc 1 1654 40 is_stmt 0 discriminator 2
+	mov	eax, 0
+.L454:
+	.loc 1 1654 15 is_stmt 1 discriminator 4
+	mov	DWORD PTR -68[rbp], eax
+	.loc 1 1655 14 discriminator 4
+	mov	ecx, DWORD PTR -68[rbp]
+	lea	rdx, -1624[rbp]
+	lea	rsi, -1608[rbp]
+	lea	rax, -736[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ReadAll
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 1656 9 discriminator 4
+	lea	rax, -736[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1656 8 discriminator 4
+	test	eax, eax
+	je	.L455
+	.loc 1 1658 9
+	mov	rax, QWORD PTR -2288[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1659 16
+	mov	DWORD PTR -4[rbp], 1
+.L455:
+	.loc 1 1661 8
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L456
+	.loc 1 1663 9
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1664 16
+	mov	eax, 1
+	jmp	.L496
+.L456:
+	.loc 1 1667 17
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1667 8
+	test	eax, eax
+	je	.L457
+	.loc 1 1669 42
+	mov	rax, QWORD PTR -1624[rbp]
+	add	rax, 1
+	.loc 1 1669 27
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	.loc 1 1669 17
+	mov	QWORD PTR -1616[rbp], rax
+	.loc 1 1670 21
+	mov	rax, QWORD PTR -1616[rbp]
+	.loc 1 1670 12
+	test	rax, rax
+	jne	.L458
+	.loc 1 1672 13
+	lea	rax, .LC50[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1673 13
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1674 20
+	mov	eax, 1
+	jmp	.L496
+.L458:
+.LBB93:
+	.loc 1 1676 19
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 1676 9
+	jmp	.L459
+.L460:
+	.loc 1 1678 33 discriminator 3
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	sal	rdx, 3
+	add	rdx, rax
+	.loc 1 1678 20 discriminator 3
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	sal	rcx, 2
+	add	rax, rcx
+	.loc 1 1678 33 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 1678 24 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 1679 33 discriminator 3
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	sal	rdx, 3
+	add	rdx, 4
+	add	rdx, rax
+	.loc 1 1679 20 discriminator 3
+	mov	rax, QWORD PTR -1616[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	sal	rcx, 2
+	add	rax, rcx
+	.loc 1 1679 33 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 1679 24 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 1676 39 discriminator 3
+	add	QWORD PTR -16[rbp], 1
+.L459:
+	.loc 1 1676 28 discriminator 1
+	mov	rax, QWORD PTR -1624[rbp]
+	cmp	QWORD PTR -16[rbp], rax
+	jl	.L460
+	jmp	.L461
+.L457:
+.LBE93:
+	.loc 1 1682 22
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1682 13
+	test	rax, rax
+	je	.L462
+.LBB94:
+	.loc 1 1685 14
+	mov	QWORD PTR -1640[rbp], 0
+	.loc 1 1687 84
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 1687 57
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	rsi, QWORD PTR 24[rax]
+	.loc 1 1687 13
+	lea	rax, -2272[rbp]
+	mov	ecx, 1
+	mov	rdi, rax
+	call	sampleIo_OpenReader@PLT
+	.loc 1 1687 12
+	test	eax, eax
+	je	.L463
+	.loc 1 1689 13
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1690 20
+	mov	eax, 1
+	jmp	.L496
+.L463:
+	.loc 1 1692 27
+	mov	eax, DWORD PTR -2260[rbp]
+	.loc 1 1692 12
+	cmp	eax, 1
+	jne	.L465
+	.loc 1 1693 17
+	lea	rdx, -1640[rbp]
+	lea	rsi, -1616[rbp]
+	lea	rax, -2272[rbp]
+	mov	ecx, 0
+	mov	rdi, rax
+	call	lmsFilter_ReadAll
+	.loc 1 1693 13
+	test	eax, eax
+	je	.L466
+.L465:
+	.loc 1 1695 30
+	mov	eax, DWORD PTR -2260[rbp]
+	.loc 1 1695 16
+	cmp	eax, 1
+	je	.L467
+	.loc 1 1697 17
+	lea	rax, .LC46[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L467:
+	.loc 1 1699 13
+	lea	rax, -2272[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1700 13
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1701 20
+	mov	eax, 1
+	jmp	.L496
+.L466:
+	.loc 1 1703 9
+	lea	rax, -2272[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1704 27
+	mov	rdx, QWORD PTR -1640[rbp]
+	mov	rax, QWORD PTR -1624[rbp]
+	.loc 1 1704 12
+	cmp	rdx, rax
+	jge	.L468
+	.loc 1 1706 13
+	mov	rax, QWORD PTR -1640[rbp]
+	mov	rsi, rax
+	lea	rax, .LC47[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1707 20
+	mov	rax, QWORD PTR -1640[rbp]
+	mov	QWORD PTR -1624[rbp], rax
+	jmp	.L461
+.L468:
+	.loc 1 1709 32
+	mov	rdx, QWORD PTR -1640[rbp]
+	mov	rax, QWORD PTR -1624[rbp]
+	.loc 1 1709 17
+	cmp	rdx, rax
+	jle	.L461
+	.loc 1 1711 13
+	lea	rax, .LC48[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	jmp	.L461
+.L462:
+.LBE94:
+	.loc 1 1714 29
+	mov	rax, QWORD PTR -2280[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	movsx	rdx, eax
+	.loc 1 1714 21
+	mov	rax, QWORD PTR -1624[rbp]
+	.loc 1 1714 13
+	cmp	rdx, rax
+	jle	.L461
+	.loc 1 1716 9
+	lea	rax, .LC41[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1717 9
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1718 16
+	mov	eax, 1
+	jmp	.L496
+.L461:
+	.loc 1 1721 25
+	mov	eax, DWORD PTR -1520[rbp]
+	.loc 1 1721 8
+	test	eax, eax
+	jne	.L470
+	.loc 1 1723 45
+	mov	eax, DWORD PTR -720[rbp]
+	.loc 1 1723 37
+	mov	DWORD PTR -1520[rbp], eax
+.L470:
+	.loc 1 1725 30
+	mov	rcx, QWORD PTR -2296[rbp]
+	mov	rax, QWORD PTR -2288[rbp]
+	mov	edx, -1
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_OutputFileName
+	mov	QWORD PTR -80[rbp], rax
+	.loc 1 1726 50
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 1727 64
+	test	eax, eax
+	je	.L471
+	.loc 1 1727 64 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	jmp	.L472
+.L471:
+	.loc 1 1727 64 discriminator 2
+	mov	eax, DWORD PTR -728[rbp]
+.L472:
+	.loc 1 1726 26 is_stmt 1
+	mov	DWORD PTR -84[rbp], eax
+	.loc 1 1728 32
+	mov	edi, 4160
+	call	malloc@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 1729 42
+	mov	rax, QWORD PTR -1624[rbp]
+	add	rax, 1
+	.loc 1 1729 23
+	sal	rax, 3
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 1731 8
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L473
+	.loc 1 1731 36 discriminator 1
+	cmp	QWORD PTR -48[rbp], 0
+	je	.L473
+	.loc 1 1731 58 discriminator 2
+	cmp	QWORD PTR -64[rbp], 0
+	je	.L473
+	.loc 1 1732 13
+	lea	rdx, -1520[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsRealtime_Init@PLT
+	.loc 1 1732 9
+	test	eax, eax
+	jne	.L473
+	.loc 1 1733 13
+	mov	r8d, DWORD PTR -720[rbp]
+	mov	edi, DWORD PTR -84[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	rdx, QWORD PTR -2296[rbp]
+	mov	rsi, QWORD PTR -2280[rbp]
+	lea	rax, -1488[rbp]
+	sub	rsp, 8
+	push	1
+	mov	r9d, r8d
+	mov	r8d, edi
+	mov	rdi, rax
+	call	lmsFilter_ChannelOpen
+	add	rsp, 16
+	.loc 1 1733 9
+	test	eax, eax
+	je	.L474
+.L473:
+	.loc 1 1736 9
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1737 9
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1738 9
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1739 9
+	mov	rax, QWORD PTR -1616[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1740 9
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1741 16
+	mov	eax, 1
+	jmp	.L496
+.L474:
+	.loc 1 1743 94
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	ecx, DWORD PTR 96[rax]
+	.loc 1 1743 9
+	cmp	DWORD PTR -52[rbp], 0
+	sete	al
+	movzx	edx, al
+	.loc 1 1743 59
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	rsi, QWORD PTR 80[rax]
+	.loc 1 1743 9
+	lea	rax, -1488[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelOpenCheckpoint
+	.loc 1 1743 8
+	test	eax, eax
+	je	.L475
+	.loc 1 1745 9
+	lea	rax, -1488[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 1746 9
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1747 9
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1748 9
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1749 9
+	mov	rax, QWORD PTR -1616[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1750 9
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1751 16
+	mov	eax, 1
+	jmp	.L496
+.L475:
+.LBB95:
+	.loc 1 1755 14
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 1755 5
+	jmp	.L476
+.L477:
+	.loc 1 1757 48 discriminator 3
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 1757 9 discriminator 3
+	mov	edx, DWORD PTR [rax]
+	lea	rax, -1488[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	lmsFilter_ChannelPush
+	.loc 1 1755 35 discriminator 3
+	add	DWORD PTR -20[rbp], 1
+.L476:
+	.loc 1 1755 23 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -68[rbp]
+	jl	.L477
+.LBE95:
+	.loc 1 1759 17
+	mov	rax, QWORD PTR -1608[rbp]
+	.loc 1 1759 25
+	mov	edx, DWORD PTR -68[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	.loc 1 1759 17
+	add	rax, rdx
+	.loc 1 1759 15
+	mov	QWORD PTR -1592[rbp], rax
+	.loc 1 1760 17
+	cmp	DWORD PTR -52[rbp], 0
+	je	.L478
+	.loc 1 1760 17 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -1616[rbp]
+	jmp	.L479
+.L478:
+	.loc 1 1760 17 discriminator 2
+	mov	rax, QWORD PTR -1608[rbp]
+.L479:
+	.loc 1 1760 17 discriminator 4
+	mov	QWORD PTR -1584[rbp], rax
+	.loc 1 1761 16 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -64[rbp]
+	mov	QWORD PTR -1576[rbp], rax
+	.loc 1 1762 25 discriminator 4
+	mov	rax, QWORD PTR -1624[rbp]
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	.loc 1 1762 17 discriminator 4
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	.loc 1 1762 15 discriminator 4
+	mov	QWORD PTR -1568[rbp], rax
+	.loc 1 1763 15 discriminator 4
+	mov	rax, QWORD PTR -1624[rbp]
+	mov	QWORD PTR -1560[rbp], rax
+	.loc 1 1764 18 discriminator 4
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR -1544[rbp], rax
+	.loc 1 1767 9 discriminator 4
+	lea	rdx, -1600[rbp]
+	lea	rax, -1632[rbp]
+	mov	rcx, rdx
+	lea	rdx, lmsFilter_RealtimeWorker[rip]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_create@PLT
+	.loc 1 1767 8 discriminator 4
+	test	eax, eax
+	je	.L480
+	.loc 1 1769 9
+	lea	rax, .LC44[rip]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1770 20
+	mov	DWORD PTR -1536[rbp], 1
+	jmp	.L481
+.L480:
+	.loc 1 1774 9
+	mov	rax, QWORD PTR -1632[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_join@PLT
+.L481:
+	.loc 1 1776 12
+	mov	eax, DWORD PTR -1536[rbp]
+	.loc 1 1776 8
+	test	eax, eax
+	je	.L482
+	.loc 1 1778 9
+	lea	rax, .LC38[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1779 16
+	mov	DWORD PTR -4[rbp], 1
+.L482:
+	.loc 1 1783 53
+	cmp	DWORD PTR -52[rbp], 0
+	jne	.L483
+	.loc 1 1783 53 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -1584[rbp]
+	jmp	.L484
+.L483:
+	.loc 1 1783 53 discriminator 2
+	mov	rax, QWORD PTR -1608[rbp]
+.L484:
+	.loc 1 1783 18 is_stmt 1 discriminator 4
+	mov	QWORD PTR -96[rbp], rax
+.LBB96:
+	.loc 1 1784 15 discriminator 4
+	mov	QWORD PTR -32[rbp], 0
+	.loc 1 1784 5 discriminator 4
+	jmp	.L485
+.L493:
+.LBB97:
+	.loc 1 1786 31
+	mov	rax, QWORD PTR -1552[rbp]
+	.loc 1 1786 42
+	sub	rax, QWORD PTR -32[rbp]
+	.loc 1 1786 98
+	cmp	rax, 4095
+	jg	.L486
+	.loc 1 1786 82 discriminator 1
+	mov	rax, QWORD PTR -1552[rbp]
+	.loc 1 1786 93 discriminator 1
+	mov	ecx, eax
+	mov	rax, QWORD PTR -32[rbp]
+	mov	edx, eax
+	mov	eax, ecx
+	sub	eax, edx
+	jmp	.L487
+.L486:
+	.loc 1 1786 98 discriminator 2
+	mov	eax, 4096
+.L487:
+	.loc 1 1786 19 discriminator 4
+	mov	DWORD PTR -100[rbp], eax
+.LBB98:
+	.loc 1 1787 18 discriminator 4
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 1787 9 discriminator 4
+	jmp	.L488
+.L489:
+	.loc 1 1789 51 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 1789 48 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 1789 20 discriminator 3
+	mov	rsi, QWORD PTR -752[rbp]
+	.loc 1 1789 30 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	cdqe
+	.loc 1 1789 27 discriminator 3
+	sal	rax, 2
+	add	rax, rsi
+	.loc 1 1789 48 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 1789 35 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 1790 44 discriminator 3
+	mov	rax, QWORD PTR -1576[rbp]
+	.loc 1 1790 54 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rcx, edx
+	mov	rdx, QWORD PTR -32[rbp]
+	add	rdx, rcx
+	.loc 1 1790 51 discriminator 3
+	sal	rdx, 2
+	lea	rcx, [rax+rdx]
+	.loc 1 1790 20 discriminator 3
+	mov	rsi, QWORD PTR -752[rbp]
+	.loc 1 1790 30 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	.loc 1 1790 27 discriminator 3
+	cdqe
+	add	rax, 1
+	sal	rax, 2
+	add	rax, rsi
+	.loc 1 1790 51 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 1790 39 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 1791 44 discriminator 3
+	mov	rax, QWORD PTR -1568[rbp]
+	.loc 1 1791 53 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rcx, edx
+	mov	rdx, QWORD PTR -32[rbp]
+	add	rdx, rcx
+	.loc 1 1791 50 discriminator 3
+	sal	rdx, 2
+	lea	rcx, [rax+rdx]
+	.loc 1 1791 20 discriminator 3
+	mov	rsi, QWORD PTR -752[rbp]
+	.loc 1 1791 30 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	.loc 1 1791 27 discriminator 3
+	cdqe
+	add	rax, 2
+	sal	rax, 2
+	add	rax, rsi
+	.loc 1 1791 50 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 1791 39 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 1787 37 discriminator 3
+	add	DWORD PTR -36[rbp], 1
+.L488:
+	.loc 1 1787 27 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -100[rbp]
+	jl	.L489
+.LBE98:
+	.loc 1 1793 20
+	mov	rax, QWORD PTR -1456[rbp]
+	.loc 1 1793 12
+	test	rax, rax
+	je	.L490
+	.loc 1 1795 52
+	mov	rcx, QWORD PTR -752[rbp]
+	.loc 1 1795 13
+	mov	rax, QWORD PTR -1456[rbp]
+	mov	edx, DWORD PTR -100[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsPlot_AddFrames@PLT
+.L490:
+	.loc 1 1797 52
+	mov	rax, QWORD PTR -752[rbp]
+	.loc 1 1797 13
+	mov	edx, DWORD PTR -100[rbp]
+	lea	rcx, -1488[rbp]
+	add	rcx, 40
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	sampleIo_Write@PLT
+	.loc 1 1797 12
+	test	eax, eax
+	je	.L491
+	.loc 1 1799 13
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1800 20
+	mov	DWORD PTR -4[rbp], 1
+.L491:
+.LBE97:
+	.loc 1 1784 73 discriminator 2
+	add	QWORD PTR -32[rbp], 4096
+.L485:
+	.loc 1 1784 30 discriminator 1
+	mov	rax, QWORD PTR -1552[rbp]
+	.loc 1 1784 42 discriminator 1
+	cmp	QWORD PTR -32[rbp], rax
+	jge	.L492
+	.loc 1 1784 42 is_stmt 0 discriminator 3
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L493
+.L492:
+.LBE96:
+	.loc 1 1804 17 is_stmt 1
+	mov	rax, QWORD PTR -2296[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 1804 8
+	test	eax, eax
+	jne	.L494
+.LBB99:
+	.loc 1 1807 9
+	lea	rdx, -2272[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsRealtime_GetStats@PLT
+	.loc 1 1808 9
+	mov	rax, QWORD PTR -1552[rbp]
+	mov	rsi, rax
+	lea	rax, .LC52[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1809 9
+	mov	edx, DWORD PTR -1520[rbp]
+	mov	eax, DWORD PTR -1516[rbp]
+	mov	esi, eax
+	lea	rax, .LC53[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1811 9
+	lea	rax, -2272[rbp]
+	mov	rdi, rax
+	call	lmsRealtime_PrintStats@PLT
+.L494:
+.LBE99:
+	.loc 1 1814 9
+	lea	rax, -1488[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 1814 8
+	test	eax, eax
+	je	.L495
+	.loc 1 1816 9
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1817 16
+	mov	DWORD PTR -4[rbp], 1
+.L495:
+	.loc 1 1819 5
+	mov	rax, QWORD PTR -80[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1820 5
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1821 5
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1822 5
+	mov	rax, QWORD PTR -1616[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1823 5
+	mov	rax, QWORD PTR -1608[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1824 12
+	mov	eax, DWORD PTR -4[rbp]
+.L496:
+	.loc 1 1825 1 discriminator 2
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE56:
+	.size	lmsFilter_FilterRealtime, .-lmsFilter_FilterRealtime
+	.type	lmsFilter_ChannelTask, @function
+lmsFilter_ChannelTask:
+.LFB57:
+	.loc 1 1832 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 1833 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 1835 12
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 1835 8
+	test	eax, eax
+	jle	.L498
+	.loc 1 1837 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, DWORD PTR 20[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 16[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rsi, QWORD PTR 8[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	lmsFilter_ChannelFeed
+	.loc 1 1843 1
+	jmp	.L500
+.L498:
+	.loc 1 1841 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	lmsFilter_ChannelFinish
+.L500:
+	.loc 1 1843 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE57:
+	.size	lmsFilter_ChannelTask, .-lmsFilter_ChannelTask
+	.section	.rodata
+	.align 8
+.LC54:
+	.string	"Error: Input file must have one channel, use --channels for interleaved files"
+	.text
+	.globl	lmsFilter_FilterSignalAndSaveToFile
+	.type	lmsFilter_FilterSignalAndSaveToFile, @function
+lmsFilter_FilterSignalAndSaveToFile:
+.LFB58:
+	.loc 1 1847 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 1456
+	mov	QWORD PTR -1432[rbp], rdi
+	mov	QWORD PTR -1440[rbp], rsi
+	mov	QWORD PTR -1448[rbp], rdx
+	.loc 1 1848 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 1852 17
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 1852 8
+	test	rax, rax
+	je	.L502
+	.loc 1 1854 16
+	mov	rdx, QWORD PTR -1448[rbp]
+	mov	rcx, QWORD PTR -1440[rbp]
+	mov	rax, QWORD PTR -1432[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_FilterRealtime
+	jmp	.L523
+.L502:
+	.loc 1 1856 18
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1856 8
+	test	rax, rax
+	jne	.L504
+	.loc 1 1856 56 discriminator 1
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 1856 45 discriminator 1
+	test	eax, eax
+	je	.L505
+.L504:
+	.loc 1 1858 16
+	mov	rdx, QWORD PTR -1448[rbp]
+	mov	rcx, QWORD PTR -1440[rbp]
+	mov	rax, QWORD PTR -1432[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_FilterTwoStreams
+	jmp	.L523
+.L505:
+	.loc 1 1860 61
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 1860 9
+	mov	rsi, QWORD PTR -1440[rbp]
+	lea	rax, -672[rbp]
+	mov	ecx, 1
+	mov	rdi, rax
+	call	sampleIo_OpenReader@PLT
+	.loc 1 1860 8
+	test	eax, eax
+	je	.L506
+	.loc 1 1862 16
+	mov	eax, 1
+	jmp	.L523
+.L506:
+	.loc 1 1864 15
+	mov	eax, DWORD PTR -660[rbp]
+	.loc 1 1864 8
+	cmp	eax, 1
+	je	.L507
+	.loc 1 1866 9
+	lea	rax, .LC54[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1867 9
+	lea	rax, -672[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1868 16
+	mov	eax, 1
+	jmp	.L523
+.L507:
+	.loc 1 1871 30
+	mov	rcx, QWORD PTR -1448[rbp]
+	mov	rax, QWORD PTR -1440[rbp]
+	mov	edx, -1
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_OutputFileName
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 1872 50
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 1873 64
+	test	eax, eax
+	je	.L508
+	.loc 1 1873 64 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	jmp	.L509
+.L508:
+	.loc 1 1873 64 discriminator 2
+	mov	eax, DWORD PTR -664[rbp]
+.L509:
+	.loc 1 1872 26 is_stmt 1
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 1874 30
+	mov	edi, 16384
+	call	malloc@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 1876 8
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L510
+	.loc 1 1876 36 discriminator 1
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L510
+	.loc 1 1878 62
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	edi, DWORD PTR 40[rax]
+	.loc 1 1877 13
+	mov	r9d, DWORD PTR -656[rbp]
+	mov	r8d, DWORD PTR -20[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR -1448[rbp]
+	mov	rsi, QWORD PTR -1432[rbp]
+	lea	rax, -1424[rbp]
+	sub	rsp, 8
+	push	rdi
+	mov	rdi, rax
+	call	lmsFilter_ChannelOpen
+	add	rsp, 16
+	.loc 1 1877 9
+	test	eax, eax
+	je	.L511
+.L510:
+	.loc 1 1880 9
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1881 9
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1882 9
+	lea	rax, -672[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1883 16
+	mov	eax, 1
+	jmp	.L523
+.L511:
+	.loc 1 1886 84
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	edx, DWORD PTR 96[rax]
+	.loc 1 1886 59
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	rsi, QWORD PTR 80[rax]
+	.loc 1 1886 9
+	lea	rax, -1424[rbp]
+	mov	ecx, edx
+	mov	edx, 1
+	mov	rdi, rax
+	call	lmsFilter_ChannelOpenCheckpoint
+	.loc 1 1886 8
+	test	eax, eax
+	je	.L512
+	.loc 1 1888 24
+	mov	DWORD PTR -720[rbp], 1
+	jmp	.L513
+.L512:
+	.loc 1 1890 22
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 1890 13
+	test	eax, eax
+	je	.L518
+	.loc 1 1892 9
+	mov	rdx, QWORD PTR -1448[rbp]
+	lea	rcx, -672[rbp]
+	lea	rax, -1424[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_ChannelRunPipeline
+	jmp	.L513
+.L519:
+.LBB100:
+	.loc 1 1899 25
+	mov	rcx, QWORD PTR -32[rbp]
+	lea	rax, -672[rbp]
+	mov	edx, 4096
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 1900 16
+	cmp	DWORD PTR -36[rbp], 0
+	je	.L524
+	.loc 1 1904 13
+	mov	edx, DWORD PTR -36[rbp]
+	mov	rsi, QWORD PTR -32[rbp]
+	lea	rax, -1424[rbp]
+	mov	ecx, edx
+	mov	edx, 1
+	mov	rdi, rax
+	call	lmsFilter_ChannelFeed
+	.loc 1 1906 25
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 1906 16
+	test	eax, eax
+	jne	.L518
+	.loc 1 1908 17
+	mov	rdx, QWORD PTR -760[rbp]
+	lea	rax, -672[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilter_PrintProgress
+.L518:
+.LBE100:
+	.loc 1 1897 23
+	mov	eax, DWORD PTR -720[rbp]
+	.loc 1 1897 31
+	test	eax, eax
+	je	.L519
+	jmp	.L517
+.L524:
+.LBB101:
+	.loc 1 1902 17
+	nop
+.L517:
+.LBE101:
+	.loc 1 1911 9
+	lea	rax, -1424[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelFinish
+.L513:
+	.loc 1 1914 17
+	mov	rax, QWORD PTR -1448[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 1914 8
+	test	eax, eax
+	jne	.L520
+	.loc 1 1916 9
+	mov	rax, QWORD PTR -760[rbp]
+	mov	rsi, rax
+	lea	rax, .LC49[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L520:
+	.loc 1 1918 12
+	mov	eax, DWORD PTR -720[rbp]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 1920 5
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1921 9
+	lea	rax, -1424[rbp]
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 1921 8
+	test	eax, eax
+	je	.L521
+	.loc 1 1923 9
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1924 16
+	mov	DWORD PTR -4[rbp], 1
+.L521:
+	.loc 1 1926 9
+	lea	rax, -672[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 1926 8
+	test	eax, eax
+	je	.L522
+	.loc 1 1928 9
+	mov	rax, QWORD PTR -1440[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 1929 16
+	mov	DWORD PTR -4[rbp], 1
+.L522:
+	.loc 1 1931 5
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 1933 12
+	mov	eax, DWORD PTR -4[rbp]
+.L523:
+	.loc 1 1934 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE58:
+	.size	lmsFilter_FilterSignalAndSaveToFile, .-lmsFilter_FilterSignalAndSaveToFile
+	.section	.rodata
+	.align 8
+.LC55:
+	.string	"Error: Checkpoint holds %u channel(s) of length %u, expected %d of length %d\n"
+	.text
+	.type	lmsFilter_OpenWarmStart, @function
+lmsFilter_OpenWarmStart:
+.LFB59:
+	.loc 1 1947 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	DWORD PTR -36[rbp], edx
+	mov	DWORD PTR -40[rbp], ecx
+	.loc 1 1948 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, 40
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 1949 8
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L526
+	.loc 1 1949 40 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 1949 28 discriminator 1
+	test	rax, rax
+	jne	.L527
+.L526:
+	.loc 1 1951 16
+	mov	eax, 0
+	jmp	.L528
+.L527:
+	.loc 1 1953 48
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 1953 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsCheckpoint_Open@PLT
+	.loc 1 1953 8
+	test	eax, eax
+	je	.L529
+	.loc 1 1955 16
+	mov	eax, 1
+	jmp	.L528
+.L529:
+	.loc 1 1957 34
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 1958 21
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 1958 8
+	cmp	DWORD PTR -36[rbp], eax
+	jne	.L530
+	.loc 1 1958 52 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 1958 41 discriminator 1
+	cmp	eax, 1
+	je	.L531
+	.loc 1 1958 89 discriminator 2
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 1958 74 discriminator 2
+	cmp	DWORD PTR -40[rbp], eax
+	je	.L531
+.L530:
+	.loc 1 1961 45
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 24[rax]
+	.loc 1 1961 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 1960 9
+	mov	esi, DWORD PTR -36[rbp]
+	mov	ecx, DWORD PTR -40[rbp]
+	mov	r8d, esi
+	mov	esi, eax
+	lea	rax, .LC55[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1962 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Close@PLT
+	.loc 1 1963 16
+	mov	eax, 1
+	jmp	.L528
+.L531:
+	.loc 1 1965 12
+	mov	eax, 0
+.L528:
+	.loc 1 1966 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE59:
+	.size	lmsFilter_OpenWarmStart, .-lmsFilter_OpenWarmStart
+	.type	lmsFilter_WarmStartRow, @function
+lmsFilter_WarmStartRow:
+.LFB60:
+	.loc 1 1975 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	DWORD PTR -12[rbp], esi
+	.loc 1 1976 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 1976 31
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 1976 57
+	cmp	eax, 1
+	je	.L533
+	.loc 1 1976 57 is_stmt 0 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	jmp	.L535
+.L533:
+	.loc 1 1976 57 discriminator 2
+	mov	eax, 0
+.L535:
+	.loc 1 1977 1 is_stmt 1 discriminator 5
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE60:
+	.size	lmsFilter_WarmStartRow, .-lmsFilter_WarmStartRow
+	.type	lmsFilter_CreateChannelsCheckpoint, @function
+lmsFilter_CreateChannelsCheckpoint:
+.LFB61:
+	.loc 1 1989 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	DWORD PTR -20[rbp], edx
+	mov	QWORD PTR -32[rbp], rcx
+	.loc 1 1990 66
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 1990 9
+	mov	esi, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, 0
+	mov	rdi, rax
+	call	lmsCheckpoint_Create@PLT
+	.loc 1 1990 8
+	test	eax, eax
+	je	.L537
+	.loc 1 1992 16
+	mov	eax, 1
+	jmp	.L538
+.L537:
+	.loc 1 1994 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_DescribeCheckpoint
+	.loc 1 1995 12
+	mov	eax, 0
+.L538:
+	.loc 1 1996 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE61:
+	.size	lmsFilter_CreateChannelsCheckpoint, .-lmsFilter_CreateChannelsCheckpoint
+	.section	.rodata
+	.align 8
+.LC56:
+	.string	"Channels:                     %d\n"
+	.align 8
+.LC57:
+	.string	"Filter bank kernel:           %s\n"
+.LC58:
+	.string	"write"
+	.align 8
+.LC59:
+	.string	"\nFiltered samples per channel: %ld\n"
+	.text
+	.type	lmsFilter_FilterInterleavedFileBank, @function
+lmsFilter_FilterInterleavedFileBank:
+.LFB62:
+	.loc 1 2007 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 976
+	mov	QWORD PTR -952[rbp], rdi
+	mov	QWORD PTR -960[rbp], rsi
+	mov	QWORD PTR -968[rbp], rdx
+	.loc 1 2008 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 2012 84
+	mov	rax, QWORD PTR -968[rbp]
+	mov	ecx, DWORD PTR 36[rax]
+	.loc 1 2012 61
+	mov	rax, QWORD PTR -968[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 2012 9
+	mov	rsi, QWORD PTR -960[rbp]
+	lea	rax, -816[rbp]
+	mov	rdi, rax
+	call	sampleIo_OpenReader@PLT
+	.loc 1 2012 8
+	test	eax, eax
+	je	.L540
+	.loc 1 2014 16
+	mov	eax, 1
+	jmp	.L588
+.L540:
+	.loc 1 2016 15
+	mov	eax, DWORD PTR -804[rbp]
+	mov	DWORD PTR -72[rbp], eax
+	.loc 1 2017 34
+	mov	rax, QWORD PTR -952[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 2017 15
+	sub	eax, 1
+	mov	DWORD PTR -76[rbp], eax
+	.loc 1 2018 15
+	mov	eax, DWORD PTR -76[rbp]
+	add	eax, 4096
+	mov	DWORD PTR -80[rbp], eax
+	.loc 1 2019 50
+	mov	rax, QWORD PTR -968[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 2020 64
+	test	eax, eax
+	je	.L542
+	.loc 1 2020 64 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -968[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	jmp	.L543
+.L542:
+	.loc 1 2020 64 discriminator 2
+	mov	eax, DWORD PTR -808[rbp]
+.L543:
+	.loc 1 2019 26 is_stmt 1
+	mov	DWORD PTR -84[rbp], eax
+	.loc 1 2022 61
+	mov	rax, QWORD PTR -952[rbp]
+	mov	esi, DWORD PTR 4[rax]
+	.loc 1 2022 44
+	mov	rax, QWORD PTR -952[rbp]
+	mov	ecx, DWORD PTR [rax]
+	.loc 1 2022 9
+	mov	edx, DWORD PTR -72[rbp]
+	lea	rax, -896[rbp]
+	movd	xmm0, ecx
+	mov	rdi, rax
+	call	lmsFilterBank_Init@PLT
+	.loc 1 2022 8
+	test	eax, eax
+	je	.L544
+	.loc 1 2024 9
+	lea	rax, -816[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 2025 16
+	mov	eax, 1
+	jmp	.L588
+.L544:
+	.loc 1 2030 77
+	mov	rax, QWORD PTR -952[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 2030 54
+	mov	rax, QWORD PTR -968[rbp]
+	mov	rsi, QWORD PTR 80[rax]
+	.loc 1 2030 9
+	mov	ecx, DWORD PTR -72[rbp]
+	lea	rax, -944[rbp]
+	mov	rdi, rax
+	call	lmsFilter_OpenWarmStart
+	.loc 1 2030 8
+	test	eax, eax
+	je	.L545
+	.loc 1 2032 9
+	lea	rax, -896[rbp]
+	mov	rdi, rax
+	call	lmsFilterBank_Free@PLT
+	.loc 1 2033 9
+	lea	rax, -816[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 2034 16
+	mov	eax, 1
+	jmp	.L588
+.L545:
+	.loc 1 2036 19
+	mov	rax, QWORD PTR -944[rbp]
+	.loc 1 2036 8
+	test	rax, rax
+	je	.L546
+.LBB102:
+	.loc 1 2038 18
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 2038 9
+	jmp	.L547
+.L550:
+.LBB103:
+	.loc 1 2040 32
+	mov	edx, DWORD PTR -8[rbp]
+	lea	rax, -944[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsFilter_WarmStartRow
+	mov	edx, eax
+	lea	rax, -944[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsCheckpoint_Row@PLT
+	mov	QWORD PTR -96[rbp], rax
+.LBB104:
+	.loc 1 2041 22
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 2041 13
+	jmp	.L548
+.L549:
+	.loc 1 2043 69 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 2043 21 discriminator 3
+	mov	rsi, QWORD PTR -880[rbp]
+	.loc 1 2043 35 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	.loc 1 2043 51 discriminator 3
+	mov	eax, DWORD PTR -884[rbp]
+	cdqe
+	.loc 1 2043 45 discriminator 3
+	imul	rdx, rax
+	.loc 1 2043 59 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	add	rax, rdx
+	.loc 1 2043 34 discriminator 3
+	sal	rax, 2
+	add	rax, rsi
+	.loc 1 2043 69 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 2043 64 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 2041 53 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L548:
+	.loc 1 2041 42 discriminator 1
+	mov	rax, QWORD PTR -952[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 2041 31 discriminator 1
+	cmp	DWORD PTR -12[rbp], eax
+	jl	.L549
+.LBE104:
+.LBE103:
+	.loc 1 2038 45 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L547:
+	.loc 1 2038 27 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -72[rbp]
+	jl	.L550
+.LBE102:
+	.loc 1 2046 9
+	lea	rax, -944[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Close@PLT
+.L546:
+	.loc 1 2049 48
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	mov	esi, 576
+	mov	rdi, rax
+	call	calloc@PLT
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 2050 37
+	mov	eax, DWORD PTR -80[rbp]
+	movsx	rdx, eax
+	.loc 1 2050 30
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rax, rdx
+	mov	esi, 4
+	mov	rdi, rax
+	call	calloc@PLT
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 2051 29
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	sal	rax, 14
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -120[rbp], rax
+	.loc 1 2052 28
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	sal	rax, 14
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -128[rbp], rax
+	.loc 1 2053 29
+	mov	edi, 49152
+	call	malloc@PLT
+	mov	QWORD PTR -136[rbp], rax
+	.loc 1 2054 8
+	cmp	QWORD PTR -104[rbp], 0
+	je	.L551
+	.loc 1 2054 27 discriminator 1
+	cmp	QWORD PTR -112[rbp], 0
+	je	.L551
+	.loc 1 2054 48 discriminator 2
+	cmp	QWORD PTR -120[rbp], 0
+	je	.L551
+	.loc 1 2054 68 discriminator 3
+	cmp	QWORD PTR -128[rbp], 0
+	je	.L551
+	.loc 1 2054 87 discriminator 4
+	cmp	QWORD PTR -136[rbp], 0
+	jne	.L552
+.L551:
+	.loc 1 2056 9
+	lea	rax, .LC36[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2057 16
+	mov	DWORD PTR -4[rbp], 1
+.L552:
+	.loc 1 2060 9
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 2061 5
+	jmp	.L553
+.L558:
+.LBB105:
+	.loc 1 2063 34
+	mov	edx, DWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR -968[rbp]
+	mov	rax, QWORD PTR -960[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_OutputFileName
+	mov	QWORD PTR -144[rbp], rax
+	.loc 1 2064 12
+	cmp	QWORD PTR -144[rbp], 0
+	je	.L554
+	.loc 1 2065 17
+	mov	ecx, DWORD PTR -800[rbp]
+	.loc 1 2065 45
+	mov	eax, DWORD PTR -16[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 3
+	add	rax, rdx
+	sal	rax, 6
+	mov	rdx, rax
+	.loc 1 2065 17
+	mov	rax, QWORD PTR -104[rbp]
+	lea	rdi, [rdx+rax]
+	mov	edx, DWORD PTR -84[rbp]
+	mov	rax, QWORD PTR -144[rbp]
+	mov	r8d, ecx
+	mov	ecx, 3
+	mov	rsi, rax
+	call	sampleIo_OpenWriter@PLT
+	.loc 1 2065 13
+	test	eax, eax
+	je	.L555
+.L554:
+	.loc 1 2068 20
+	mov	DWORD PTR -4[rbp], 1
+.L555:
+	.loc 1 2070 9
+	mov	rax, QWORD PTR -144[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2071 12
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L589
+.LBE105:
+	.loc 1 2061 72
+	add	DWORD PTR -16[rbp], 1
+.L553:
+	.loc 1 2061 37 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L557
+	.loc 1 2061 37 is_stmt 0 discriminator 2
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -72[rbp]
+	jl	.L558
+	jmp	.L557
+.L589:
+.LBB106:
+	.loc 1 2073 13 is_stmt 1
+	nop
+.L557:
+.LBE106:
+	.loc 1 2077 8
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L559
+	.loc 1 2077 46 discriminator 1
+	mov	rax, QWORD PTR -968[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2077 34 discriminator 1
+	test	eax, eax
+	jne	.L559
+	.loc 1 2079 9
+	mov	eax, DWORD PTR -72[rbp]
+	mov	esi, eax
+	lea	rax, .LC56[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 2080 58
+	mov	rax, QWORD PTR -840[rbp]
+	.loc 1 2080 65
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 2080 9
+	mov	rsi, rax
+	lea	rax, .LC57[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L559:
+	.loc 1 2084 10
+	mov	QWORD PTR -24[rbp], 0
+	.loc 1 2085 10
+	mov	QWORD PTR -32[rbp], 0
+	.loc 1 2086 9
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 2087 9
+	mov	eax, DWORD PTR -76[rbp]
+	mov	DWORD PTR -40[rbp], eax
+	.loc 1 2088 9
+	mov	DWORD PTR -44[rbp], 0
+	.loc 1 2089 11
+	jmp	.L560
+.L577:
+.LBB107:
+	.loc 1 2091 21
+	mov	eax, DWORD PTR -80[rbp]
+	sub	eax, DWORD PTR -36[rbp]
+	mov	edx, eax
+	.loc 1 2091 53
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rcx, eax
+	.loc 1 2091 66
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rax, rcx
+	.loc 1 2091 52
+	lea	rcx, 0[0+rax*4]
+	.loc 1 2091 21
+	mov	rax, QWORD PTR -112[rbp]
+	add	rcx, rax
+	lea	rax, -816[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -148[rbp], eax
+	.loc 1 2092 21
+	mov	eax, DWORD PTR -148[rbp]
+	cdqe
+	add	QWORD PTR -32[rbp], rax
+	.loc 1 2093 14
+	mov	eax, DWORD PTR -148[rbp]
+	add	DWORD PTR -36[rbp], eax
+	.loc 1 2094 12
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -80[rbp]
+	jge	.L561
+.LBB108:
+	.loc 1 2096 16
+	cmp	DWORD PTR -148[rbp], 0
+	jne	.L562
+	.loc 1 2096 57 discriminator 1
+	mov	rax, QWORD PTR -952[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	cdqe
+	.loc 1 2096 30 discriminator 1
+	cmp	QWORD PTR -32[rbp], rax
+	jge	.L562
+	.loc 1 2098 17
+	lea	rax, .LC41[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2099 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 2100 17
+	jmp	.L563
+.L562:
+	.loc 1 2102 16
+	cmp	DWORD PTR -148[rbp], 0
+	jg	.L590
+	.loc 1 2106 48
+	mov	eax, DWORD PTR -80[rbp]
+	sub	eax, DWORD PTR -36[rbp]
+	.loc 1 2106 17
+	mov	edx, DWORD PTR -40[rbp]
+	cmp	edx, eax
+	cmovle	eax, edx
+	mov	DWORD PTR -152[rbp], eax
+	.loc 1 2107 63
+	mov	eax, DWORD PTR -152[rbp]
+	movsx	rdx, eax
+	.loc 1 2107 77
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 2107 13
+	lea	rdx, 0[0+rax*4]
+	.loc 1 2107 29
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rcx, eax
+	.loc 1 2107 42
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rax, rcx
+	.loc 1 2107 28
+	lea	rcx, 0[0+rax*4]
+	.loc 1 2107 20
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rcx
+	.loc 1 2107 13
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 2108 18
+	mov	eax, DWORD PTR -152[rbp]
+	add	DWORD PTR -36[rbp], eax
+	.loc 1 2109 24
+	mov	eax, DWORD PTR -152[rbp]
+	sub	DWORD PTR -40[rbp], eax
+.L561:
+.LBE108:
+	.loc 1 2112 19
+	mov	eax, DWORD PTR -36[rbp]
+	sub	eax, DWORD PTR -76[rbp]
+	mov	DWORD PTR -156[rbp], eax
+	.loc 1 2113 12
+	cmp	DWORD PTR -156[rbp], 0
+	jle	.L591
+	.loc 1 2117 12
+	cmp	DWORD PTR -44[rbp], 0
+	jne	.L567
+.LBB109:
+	.loc 1 2119 22
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 2119 13
+	jmp	.L568
+.L569:
+	.loc 1 2121 57 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	movsx	rdx, eax
+	.loc 1 2121 67 discriminator 3
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 2121 56 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	.loc 1 2121 48 discriminator 3
+	mov	rax, QWORD PTR -112[rbp]
+	add	rdx, rax
+	.loc 1 2121 17 discriminator 3
+	lea	rax, -896[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilterBank_PushFrame@PLT
+	.loc 1 2119 43 discriminator 3
+	add	DWORD PTR -48[rbp], 1
+.L568:
+	.loc 1 2119 31 discriminator 1
+	mov	eax, DWORD PTR -48[rbp]
+	cmp	eax, DWORD PTR -76[rbp]
+	jl	.L569
+.LBE109:
+	.loc 1 2123 20
+	mov	DWORD PTR -44[rbp], 1
+.L567:
+	.loc 1 2125 57
+	mov	eax, DWORD PTR -76[rbp]
+	movsx	rdx, eax
+	.loc 1 2125 73
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 2125 56
+	lea	rdx, 0[0+rax*4]
+	.loc 1 2125 48
+	mov	rax, QWORD PTR -112[rbp]
+	lea	rsi, [rdx+rax]
+	.loc 1 2125 13
+	mov	r8d, DWORD PTR -156[rbp]
+	mov	rdi, QWORD PTR -128[rbp]
+	mov	rcx, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR -112[rbp]
+	lea	rax, -896[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	lmsFilterBank_ProcessFrames@PLT
+	.loc 1 2125 12
+	test	eax, eax
+	je	.L570
+	.loc 1 2128 13
+	lea	rax, .LC38[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2129 20
+	mov	DWORD PTR -4[rbp], 1
+.L570:
+.LBB110:
+	.loc 1 2132 18
+	mov	DWORD PTR -52[rbp], 0
+	.loc 1 2132 9
+	jmp	.L571
+.L575:
+.LBB111:
+	.loc 1 2134 22
+	mov	DWORD PTR -56[rbp], 0
+	.loc 1 2134 13
+	jmp	.L572
+.L573:
+.LBB112:
+	.loc 1 2136 35 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	movsx	rdx, eax
+	.loc 1 2136 45 discriminator 3
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rdx, rax
+	.loc 1 2136 61 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	.loc 1 2136 30 discriminator 3
+	add	rax, rdx
+	mov	QWORD PTR -168[rbp], rax
+	.loc 1 2137 40 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -112[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 2137 26 discriminator 3
+	mov	edx, DWORD PTR -56[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	cdqe
+	.loc 1 2137 23 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, rdx
+	.loc 1 2137 40 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 2137 31 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 2138 43 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -120[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 2138 26 discriminator 3
+	mov	edx, DWORD PTR -56[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	.loc 1 2138 23 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, rdx
+	.loc 1 2138 43 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 2138 35 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 2139 42 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -128[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 2139 26 discriminator 3
+	mov	edx, DWORD PTR -56[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	.loc 1 2139 23 discriminator 3
+	cdqe
+	add	rax, 2
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, rdx
+	.loc 1 2139 42 discriminator 3
+	movss	xmm0, DWORD PTR [rcx]
+	.loc 1 2139 35 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+.LBE112:
+	.loc 1 2134 41 discriminator 3
+	add	DWORD PTR -56[rbp], 1
+.L572:
+	.loc 1 2134 31 discriminator 1
+	mov	eax, DWORD PTR -56[rbp]
+	cmp	eax, DWORD PTR -156[rbp]
+	jl	.L573
+.LBE111:
+	.loc 1 2141 40
+	mov	eax, DWORD PTR -52[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 3
+	add	rax, rdx
+	sal	rax, 6
+	mov	rdx, rax
+	.loc 1 2141 17
+	mov	rax, QWORD PTR -104[rbp]
+	lea	rcx, [rdx+rax]
+	mov	edx, DWORD PTR -156[rbp]
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	sampleIo_Write@PLT
+	.loc 1 2141 16
+	test	eax, eax
+	je	.L574
+	.loc 1 2143 17
+	lea	rax, .LC58[rip]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 2144 24
+	mov	DWORD PTR -4[rbp], 1
+.L574:
+	.loc 1 2132 45 discriminator 2
+	add	DWORD PTR -52[rbp], 1
+.L571:
+	.loc 1 2132 27 discriminator 1
+	mov	eax, DWORD PTR -52[rbp]
+	cmp	eax, DWORD PTR -72[rbp]
+	jl	.L575
+.LBE110:
+	.loc 1 2147 67
+	mov	eax, DWORD PTR -76[rbp]
+	movsx	rdx, eax
+	.loc 1 2147 83
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 2147 9
+	lea	rdx, 0[0+rax*4]
+	.loc 1 2147 35
+	mov	eax, DWORD PTR -156[rbp]
+	movsx	rcx, eax
+	.loc 1 2147 49
+	mov	eax, DWORD PTR -72[rbp]
+	cdqe
+	imul	rax, rcx
+	.loc 1 2147 34
+	lea	rcx, 0[0+rax*4]
+	.loc 1 2147 26
+	mov	rax, QWORD PTR -112[rbp]
+	add	rcx, rax
+	.loc 1 2147 9
+	mov	rax, QWORD PTR -112[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memmove@PLT
+	.loc 1 2148 14
+	mov	eax, DWORD PTR -76[rbp]
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 2149 15
+	mov	eax, DWORD PTR -156[rbp]
+	cdqe
+	add	QWORD PTR -24[rbp], rax
+	.loc 1 2151 22
+	mov	rax, QWORD PTR -968[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2151 12
+	test	eax, eax
+	jne	.L576
+	.loc 1 2151 36 discriminator 1
+	mov	eax, DWORD PTR -40[rbp]
+	cmp	eax, DWORD PTR -76[rbp]
+	jne	.L576
+	.loc 1 2153 13
+	mov	rdx, QWORD PTR -24[rbp]
+	lea	rax, -816[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilter_PrintProgress
+.L576:
+	.loc 1 2155 12
+	cmp	DWORD PTR -40[rbp], 0
+	je	.L592
+	jmp	.L560
+.L590:
+.LBB113:
+	.loc 1 2104 17
+	nop
+.L560:
+.LBE113:
+.LBE107:
+	.loc 1 2089 19
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L577
+	jmp	.L563
+.L591:
+.LBB114:
+	.loc 1 2115 13
+	nop
+	jmp	.L563
+.L592:
+	.loc 1 2157 13
+	nop
+.L563:
+.LBE114:
+	.loc 1 2160 5
+	lea	rax, -896[rbp]
+	mov	rdi, rax
+	call	lmsFilterBank_FlushUpdate@PLT
+	.loc 1 2162 8
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L578
+	.loc 1 2162 46 discriminator 1
+	mov	rax, QWORD PTR -968[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 2162 34 discriminator 1
+	test	rax, rax
+	je	.L578
+	.loc 1 2162 80 discriminator 2
+	mov	rax, QWORD PTR -968[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 2162 92 discriminator 2
+	mov	rax, QWORD PTR [rax]
+	.loc 1 2162 68 discriminator 2
+	test	rax, rax
+	je	.L578
+	.loc 1 2164 18
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	edx, DWORD PTR -72[rbp]
+	mov	rsi, QWORD PTR -952[rbp]
+	lea	rax, -944[rbp]
+	mov	rdi, rax
+	call	lmsFilter_CreateChannelsCheckpoint
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 2165 12
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L578
+.LBB115:
+	.loc 1 2167 22
+	mov	DWORD PTR -60[rbp], 0
+	.loc 1 2167 13
+	jmp	.L579
+.L582:
+.LBB116:
+	.loc 1 2169 30
+	mov	edx, DWORD PTR -60[rbp]
+	lea	rax, -944[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsCheckpoint_Row@PLT
+	mov	QWORD PTR -176[rbp], rax
+.LBB117:
+	.loc 1 2170 26
+	mov	DWORD PTR -64[rbp], 0
+	.loc 1 2170 17
+	jmp	.L580
+.L581:
+	.loc 1 2172 34 discriminator 3
+	mov	rcx, QWORD PTR -880[rbp]
+	.loc 1 2172 48 discriminator 3
+	mov	eax, DWORD PTR -64[rbp]
+	movsx	rdx, eax
+	.loc 1 2172 64 discriminator 3
+	mov	eax, DWORD PTR -884[rbp]
+	cdqe
+	.loc 1 2172 58 discriminator 3
+	imul	rdx, rax
+	.loc 1 2172 72 discriminator 3
+	mov	eax, DWORD PTR -60[rbp]
+	cdqe
+	add	rax, rdx
+	.loc 1 2172 47 discriminator 3
+	sal	rax, 2
+	lea	rdx, [rcx+rax]
+	.loc 1 2172 24 discriminator 3
+	mov	eax, DWORD PTR -64[rbp]
+	cdqe
+	lea	rcx, 0[0+rax*4]
+	mov	rax, QWORD PTR -176[rbp]
+	add	rax, rcx
+	.loc 1 2172 47 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 2172 28 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 2170 57 discriminator 3
+	add	DWORD PTR -64[rbp], 1
+.L580:
+	.loc 1 2170 46 discriminator 1
+	mov	rax, QWORD PTR -952[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 2170 35 discriminator 1
+	cmp	DWORD PTR -64[rbp], eax
+	jl	.L581
+.LBE117:
+.LBE116:
+	.loc 1 2167 49 discriminator 2
+	add	DWORD PTR -60[rbp], 1
+.L579:
+	.loc 1 2167 31 discriminator 1
+	mov	eax, DWORD PTR -60[rbp]
+	cmp	eax, DWORD PTR -72[rbp]
+	jl	.L582
+.LBE115:
+	.loc 1 2175 63
+	mov	rax, QWORD PTR -968[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 2175 75
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 2175 22
+	lea	rax, -944[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsCheckpoint_Write@PLT
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 2176 13
+	lea	rax, -944[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Close@PLT
+.L578:
+	.loc 1 2180 17
+	mov	rax, QWORD PTR -968[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2180 8
+	test	eax, eax
+	jne	.L583
+	.loc 1 2182 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rax
+	lea	rax, .LC59[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L583:
+.LBB118:
+	.loc 1 2185 14
+	mov	DWORD PTR -68[rbp], 0
+	.loc 1 2185 5
+	jmp	.L584
+.L586:
+	.loc 1 2187 42
+	mov	eax, DWORD PTR -68[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 3
+	add	rax, rdx
+	sal	rax, 6
+	mov	rdx, rax
+	.loc 1 2187 13
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	mov	rdi, rax
+	call	sampleIo_CloseWriter@PLT
+	.loc 1 2187 12
+	test	eax, eax
+	je	.L585
+	.loc 1 2189 20
+	mov	DWORD PTR -4[rbp], 1
+.L585:
+	.loc 1 2185 34 discriminator 2
+	add	DWORD PTR -68[rbp], 1
+.L584:
+	.loc 1 2185 23 discriminator 1
+	mov	eax, DWORD PTR -68[rbp]
+	cmp	eax, DWORD PTR -16[rbp]
+	jl	.L586
+.LBE118:
+	.loc 1 2192 5
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2193 5
+	mov	rax, QWORD PTR -112[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2194 5
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2195 5
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2196 5
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2197 5
+	lea	rax, -896[rbp]
+	mov	rdi, rax
+	call	lmsFilterBank_Free@PLT
+	.loc 1 2198 9
+	lea	rax, -816[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 2198 8
+	test	eax, eax
+	je	.L587
+	.loc 1 2200 9
+	mov	rax, QWORD PTR -960[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 2201 16
+	mov	DWORD PTR -4[rbp], 1
+.L587:
+	.loc 1 2203 12
+	mov	eax, DWORD PTR -4[rbp]
+.L588:
+	.loc 1 2204 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE62:
+	.size	lmsFilter_FilterInterleavedFileBank, .-lmsFilter_FilterInterleavedFileBank
+	.section	.rodata
+	.align 8
+.LC60:
+	.string	"Error: Desired signal stream is supported for a single input channel only"
+	.align 8
+.LC61:
+	.string	"Error: Only a single input channel can be resumed from a checkpoint"
+	.align 8
+.LC62:
+	.string	"Error: Plot is supported for a single input channel only"
+	.align 8
+.LC63:
+	.string	"Error: Filter bank supports the lms algorithm only"
+	.align 8
+.LC64:
+	.string	"Worker threads:               %d\n"
+.LC65:
+	.string	"Channel %d failed\n"
+	.text
+	.globl	lmsFilter_FilterInterleavedFile
+	.type	lmsFilter_FilterInterleavedFile, @function
+lmsFilter_FilterInterleavedFile:
+.LFB63:
+	.loc 1 2208 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r12
+	push	rbx
+	sub	rsp, 1088
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	mov	QWORD PTR -1080[rbp], rdi
+	mov	QWORD PTR -1088[rbp], rsi
+	mov	QWORD PTR -1096[rbp], rdx
+	.loc 1 2209 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 2213 18
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 2213 8
+	test	rax, rax
+	jne	.L594
+	.loc 1 2213 56 discriminator 1
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 2213 45 discriminator 1
+	test	eax, eax
+	je	.L595
+.L594:
+	.loc 1 2215 9
+	lea	rax, .LC60[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2216 16
+	mov	eax, 1
+	jmp	.L636
+.L595:
+	.loc 1 2218 18
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 2218 8
+	test	rax, rax
+	je	.L597
+	.loc 1 2218 52 discriminator 1
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 2218 64 discriminator 1
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 2218 40 discriminator 1
+	test	rax, rax
+	je	.L597
+	.loc 1 2220 9
+	lea	rax, .LC61[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2221 16
+	mov	eax, 1
+	jmp	.L636
+.L597:
+	.loc 1 2223 17
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 2223 8
+	test	rax, rax
+	je	.L598
+	.loc 1 2225 9
+	lea	rax, .LC62[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2226 16
+	mov	eax, 1
+	jmp	.L636
+.L598:
+	.loc 1 2228 17
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	eax, DWORD PTR 52[rax]
+	.loc 1 2228 8
+	test	eax, eax
+	je	.L599
+	.loc 1 2230 21
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 2230 12
+	cmp	eax, 1
+	je	.L600
+	.loc 1 2232 13
+	lea	rax, .LC63[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2233 20
+	mov	eax, 1
+	jmp	.L636
+.L600:
+	.loc 1 2235 16
+	mov	rdx, QWORD PTR -1096[rbp]
+	mov	rcx, QWORD PTR -1088[rbp]
+	mov	rax, QWORD PTR -1080[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_FilterInterleavedFileBank
+	jmp	.L636
+.L599:
+	.loc 1 2237 84
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	ecx, DWORD PTR 36[rax]
+	.loc 1 2237 61
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 2237 9
+	mov	rsi, QWORD PTR -1088[rbp]
+	lea	rax, -768[rbp]
+	mov	rdi, rax
+	call	sampleIo_OpenReader@PLT
+	.loc 1 2237 8
+	test	eax, eax
+	je	.L601
+	.loc 1 2239 16
+	mov	eax, 1
+	jmp	.L636
+.L601:
+	.loc 1 2241 15
+	mov	eax, DWORD PTR -756[rbp]
+	mov	DWORD PTR -56[rbp], eax
+	.loc 1 2242 50
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 2243 64
+	test	eax, eax
+	je	.L602
+	.loc 1 2243 64 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	jmp	.L603
+.L602:
+	.loc 1 2243 64 discriminator 2
+	mov	eax, DWORD PTR -760[rbp]
+.L603:
+	.loc 1 2242 26 is_stmt 1
+	mov	DWORD PTR -60[rbp], eax
+	.loc 1 2246 77
+	mov	rax, QWORD PTR -1080[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 2246 54
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	rsi, QWORD PTR 80[rax]
+	.loc 1 2246 9
+	mov	ecx, DWORD PTR -56[rbp]
+	lea	rax, -992[rbp]
+	mov	rdi, rax
+	call	lmsFilter_OpenWarmStart
+	.loc 1 2246 8
+	test	eax, eax
+	je	.L604
+	.loc 1 2248 9
+	lea	rax, -768[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 2249 16
+	mov	eax, 1
+	jmp	.L636
+.L604:
+	.loc 1 2253 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -72[rbp], rax
+	.loc 1 2254 31
+	mov	eax, DWORD PTR -56[rbp]
+	movsx	rbx, eax
+	.loc 1 2254 89
+	mov	rax, QWORD PTR -1080[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 2254 55
+	mov	edi, eax
+	call	lmsFilter_RequiredMemory
+	.loc 1 2254 18
+	imul	rax, rbx
+	mov	QWORD PTR -80[rbp], rax
+	.loc 1 2255 29
+	mov	rax, QWORD PTR -72[rbp]
+	mov	r8, QWORD PTR [rax]
+	.loc 1 2255 44
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 2255 25
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	edx, 64
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	r8
+.LVL22:
+	mov	QWORD PTR -88[rbp], rax
+	.loc 1 2257 5
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L605
+	.loc 1 2257 5 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -80[rbp]
+	jmp	.L606
+.L605:
+	.loc 1 2257 5 discriminator 2
+	mov	eax, 0
+.L606:
+	.loc 1 2257 5 discriminator 4
+	mov	rsi, QWORD PTR -88[rbp]
+	lea	rcx, -1024[rbp]
+	mov	rdx, rax
+	mov	rdi, rcx
+	call	lmsArena_Init@PLT
+	.loc 1 2258 43 is_stmt 1 discriminator 4
+	lea	rax, -1056[rbp]
+	lea	rdx, -1024[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsArena_Allocator@PLT
+	.loc 1 2260 57 discriminator 4
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	mov	esi, 752
+	mov	rdi, rax
+	call	calloc@PLT
+	mov	QWORD PTR -96[rbp], rax
+	.loc 1 2261 59 discriminator 4
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	mov	esi, 24
+	mov	rdi, rax
+	call	calloc@PLT
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 2263 54 discriminator 4
+	mov	eax, DWORD PTR -56[rbp]
+	sal	eax, 12
+	cdqe
+	.loc 1 2263 25 discriminator 4
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	.loc 1 2263 15 discriminator 4
+	mov	QWORD PTR -1072[rbp], rax
+	.loc 1 2264 54 discriminator 4
+	mov	eax, DWORD PTR -56[rbp]
+	sal	eax, 12
+	cdqe
+	.loc 1 2264 25 discriminator 4
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	.loc 1 2264 15 discriminator 4
+	mov	QWORD PTR -1064[rbp], rax
+	.loc 1 2265 8 discriminator 4
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L607
+	.loc 1 2265 31 discriminator 1
+	cmp	QWORD PTR -96[rbp], 0
+	je	.L607
+	.loc 1 2265 53 discriminator 2
+	cmp	QWORD PTR -104[rbp], 0
+	je	.L607
+	.loc 1 2265 81 discriminator 3
+	mov	rax, QWORD PTR -1072[rbp]
+	.loc 1 2265 71 discriminator 3
+	test	rax, rax
+	je	.L607
+	.loc 1 2265 104 discriminator 4
+	mov	rax, QWORD PTR -1064[rbp]
+	.loc 1 2265 94 discriminator 4
+	test	rax, rax
+	jne	.L608
+.L607:
+	.loc 1 2267 9
+	lea	rax, .LC36[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2268 16
+	mov	DWORD PTR -20[rbp], 1
+.L608:
+	.loc 1 2271 9
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 2272 5
+	jmp	.L609
+.L614:
+.LBB119:
+	.loc 1 2274 31
+	lea	rdx, -1056[rbp]
+	mov	rax, QWORD PTR -1080[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilter_CreateLike
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 2275 34
+	mov	edx, DWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR -1088[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_OutputFileName
+	mov	QWORD PTR -120[rbp], rax
+	.loc 1 2277 12
+	cmp	QWORD PTR -112[rbp], 0
+	je	.L610
+	.loc 1 2277 30 discriminator 1
+	cmp	QWORD PTR -120[rbp], 0
+	je	.L610
+	.loc 1 2278 17
+	mov	r8d, DWORD PTR -752[rbp]
+	.loc 1 2278 48
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	imul	rdx, rax, 752
+	.loc 1 2278 17
+	mov	rax, QWORD PTR -96[rbp]
+	lea	rdi, [rdx+rax]
+	mov	esi, DWORD PTR -60[rbp]
+	mov	rcx, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR -112[rbp]
+	sub	rsp, 8
+	push	1
+	mov	r9d, r8d
+	mov	r8d, esi
+	mov	rsi, rax
+	call	lmsFilter_ChannelOpen
+	add	rsp, 16
+	.loc 1 2278 13
+	test	eax, eax
+	je	.L611
+.L610:
+	.loc 1 2281 13
+	mov	rax, QWORD PTR -112[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Destroy
+	.loc 1 2282 13
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2283 20
+	mov	DWORD PTR -20[rbp], 1
+	.loc 1 2284 13
+	jmp	.L612
+.L611:
+	.loc 1 2286 17
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	imul	rdx, rax, 752
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 2286 37
+	mov	DWORD PTR 628[rax], 1
+	.loc 1 2287 17
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	imul	rdx, rax, 752
+	mov	rax, QWORD PTR -96[rbp]
+	add	rdx, rax
+	.loc 1 2287 40
+	mov	rax, QWORD PTR -120[rbp]
+	mov	QWORD PTR 632[rdx], rax
+	.loc 1 2288 24
+	mov	rax, QWORD PTR -992[rbp]
+	.loc 1 2288 12
+	test	rax, rax
+	je	.L613
+	.loc 1 2289 17
+	mov	edx, DWORD PTR -24[rbp]
+	lea	rax, -992[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsFilter_WarmStartRow
+	mov	edx, eax
+	lea	rsi, -992[rbp]
+	mov	rax, QWORD PTR -112[rbp]
+	mov	ecx, 0
+	mov	rdi, rax
+	call	lmsFilter_LoadCheckpoint
+	.loc 1 2289 13
+	test	eax, eax
+	je	.L613
+	.loc 1 2291 20
+	mov	DWORD PTR -20[rbp], 1
+.L613:
+.LBE119:
+	.loc 1 2272 72
+	add	DWORD PTR -24[rbp], 1
+.L609:
+	.loc 1 2272 37 discriminator 1
+	cmp	DWORD PTR -20[rbp], 0
+	jne	.L612
+	.loc 1 2272 37 is_stmt 0 discriminator 2
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jl	.L614
+.L612:
+	.loc 1 2294 5 is_stmt 1
+	lea	rax, -992[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Close@PLT
+	.loc 1 2296 8
+	cmp	DWORD PTR -20[rbp], 0
+	jne	.L615
+	.loc 1 2296 69 discriminator 1
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	edx, DWORD PTR 40[rax]
+	.loc 1 2296 38 discriminator 1
+	lea	rax, -944[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	threadPool_Init@PLT
+	.loc 1 2296 34 discriminator 1
+	test	eax, eax
+	je	.L615
+	.loc 1 2298 16
+	mov	DWORD PTR -20[rbp], 1
+.L615:
+	.loc 1 2301 8
+	cmp	DWORD PTR -20[rbp], 0
+	jne	.L616
+.LBB120:
+	.loc 1 2303 21
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2303 12
+	test	eax, eax
+	jne	.L617
+	.loc 1 2305 13
+	mov	eax, DWORD PTR -56[rbp]
+	mov	esi, eax
+	lea	rax, .LC56[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 2306 13
+	mov	eax, DWORD PTR -928[rbp]
+	mov	esi, eax
+	lea	rax, .LC64[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L617:
+	.loc 1 2310 13
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 2311 21
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	mov	rcx, QWORD PTR -1072[rbp+rax*8]
+	lea	rax, -768[rbp]
+	mov	edx, 4096
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -32[rbp], eax
+.L623:
+.LBB121:
+.LBB122:
+	.loc 1 2314 22
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 2314 13
+	jmp	.L618
+.L619:
+	.loc 1 2316 44 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	imul	rcx, rax, 752
+	.loc 1 2316 21 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 2316 35 discriminator 3
+	mov	rdx, QWORD PTR -96[rbp]
+	add	rdx, rcx
+	.loc 1 2316 33 discriminator 3
+	mov	QWORD PTR [rax], rdx
+	.loc 1 2317 40 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	mov	rcx, QWORD PTR -1072[rbp+rax*8]
+	.loc 1 2317 49 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rsi, 0[0+rax*4]
+	.loc 1 2317 21 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 2317 33 discriminator 3
+	lea	rdx, [rcx+rsi]
+	.loc 1 2317 31 discriminator 3
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 2318 21 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -104[rbp]
+	add	rdx, rax
+	.loc 1 2318 32 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	mov	DWORD PTR 16[rdx], eax
+	.loc 1 2319 21 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -104[rbp]
+	add	rdx, rax
+	.loc 1 2319 31 discriminator 3
+	mov	eax, DWORD PTR -32[rbp]
+	mov	DWORD PTR 20[rdx], eax
+	.loc 1 2320 70 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	.loc 1 2320 65 discriminator 3
+	mov	rax, QWORD PTR -104[rbp]
+	add	rdx, rax
+	.loc 1 2320 17 discriminator 3
+	lea	rax, -944[rbp]
+	lea	rcx, lmsFilter_ChannelTask[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	threadPool_Submit@PLT
+	.loc 1 2314 49 discriminator 3
+	add	DWORD PTR -36[rbp], 1
+.L618:
+	.loc 1 2314 31 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jl	.L619
+.LBE122:
+	.loc 1 2322 16
+	cmp	DWORD PTR -32[rbp], 0
+	jne	.L620
+	.loc 1 2324 17
+	lea	rax, -944[rbp]
+	mov	rdi, rax
+	call	threadPool_Wait@PLT
+	.loc 1 2325 17
+	nop
+.LBE121:
+	.loc 1 2338 9
+	lea	rax, -944[rbp]
+	mov	rdi, rax
+	call	threadPool_Destroy@PLT
+	.loc 1 2340 21
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2340 12
+	test	eax, eax
+	jne	.L616
+	jmp	.L637
+.L620:
+.LBB123:
+	.loc 1 2328 62
+	mov	eax, DWORD PTR -28[rbp]
+	xor	eax, 1
+	.loc 1 2328 24
+	cdqe
+	mov	rcx, QWORD PTR -1072[rbp+rax*8]
+	lea	rax, -768[rbp]
+	mov	edx, 4096
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -124[rbp], eax
+	.loc 1 2329 13
+	lea	rax, -944[rbp]
+	mov	rdi, rax
+	call	threadPool_Wait@PLT
+	.loc 1 2330 21
+	xor	DWORD PTR -28[rbp], 1
+	.loc 1 2331 19
+	mov	eax, DWORD PTR -124[rbp]
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 2333 25
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2333 16
+	test	eax, eax
+	jne	.L623
+	.loc 1 2335 17
+	mov	rax, QWORD PTR -96[rbp]
+	mov	rdx, QWORD PTR 664[rax]
+	lea	rax, -768[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilter_PrintProgress
+.LBE123:
+	.loc 1 2313 9
+	jmp	.L623
+.L637:
+	.loc 1 2342 13
+	mov	rax, QWORD PTR -96[rbp]
+	mov	rax, QWORD PTR 664[rax]
+	mov	rsi, rax
+	lea	rax, .LC59[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L616:
+.LBE120:
+	.loc 1 2347 8
+	cmp	DWORD PTR -20[rbp], 0
+	jne	.L624
+	.loc 1 2347 46 discriminator 1
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 2347 34 discriminator 1
+	test	rax, rax
+	je	.L624
+	.loc 1 2347 80 discriminator 2
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 2347 92 discriminator 2
+	mov	rax, QWORD PTR [rax]
+	.loc 1 2347 68 discriminator 2
+	test	rax, rax
+	je	.L624
+.LBB124:
+	.loc 1 2349 13
+	mov	DWORD PTR -40[rbp], 0
+.LBB125:
+	.loc 1 2350 18
+	mov	DWORD PTR -44[rbp], 0
+	.loc 1 2350 9
+	jmp	.L625
+.L626:
+	.loc 1 2352 32 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	cdqe
+	imul	rdx, rax, 752
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 2352 35 discriminator 3
+	mov	eax, DWORD PTR 704[rax]
+	.loc 1 2352 43 discriminator 3
+	test	eax, eax
+	setne	al
+	movzx	eax, al
+	.loc 1 2352 20 discriminator 3
+	or	DWORD PTR -40[rbp], eax
+	.loc 1 2350 45 discriminator 3
+	add	DWORD PTR -44[rbp], 1
+.L625:
+	.loc 1 2350 27 discriminator 1
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jl	.L626
+.LBE125:
+	.loc 1 2354 12
+	cmp	DWORD PTR -40[rbp], 0
+	jne	.L627
+	.loc 1 2356 22
+	mov	rax, QWORD PTR -96[rbp]
+	mov	rcx, QWORD PTR 664[rax]
+	mov	edx, DWORD PTR -56[rbp]
+	mov	rsi, QWORD PTR -1080[rbp]
+	lea	rax, -992[rbp]
+	mov	rdi, rax
+	call	lmsFilter_CreateChannelsCheckpoint
+	mov	DWORD PTR -20[rbp], eax
+.L627:
+	.loc 1 2358 12
+	cmp	DWORD PTR -40[rbp], 0
+	jne	.L624
+	.loc 1 2358 27 discriminator 1
+	cmp	DWORD PTR -20[rbp], 0
+	jne	.L624
+.LBB126:
+	.loc 1 2360 22
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 2360 13
+	jmp	.L628
+.L629:
+	.loc 1 2363 41 discriminator 3
+	mov	rax, QWORD PTR -1080[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 2363 24 discriminator 3
+	cdqe
+	.loc 1 2362 17 discriminator 3
+	lea	r12, 0[0+rax*4]
+	.loc 1 2362 67 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	imul	rdx, rax, 752
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 2362 70 discriminator 3
+	mov	rax, QWORD PTR [rax]
+	.loc 1 2362 77 discriminator 3
+	mov	rbx, QWORD PTR 8[rax]
+	.loc 1 2362 24 discriminator 3
+	mov	edx, DWORD PTR -48[rbp]
+	lea	rax, -992[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsCheckpoint_Row@PLT
+	.loc 1 2362 17 discriminator 3
+	mov	rdx, r12
+	mov	rsi, rbx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 2360 49 discriminator 3
+	add	DWORD PTR -48[rbp], 1
+.L628:
+	.loc 1 2360 31 discriminator 1
+	mov	eax, DWORD PTR -48[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jl	.L629
+.LBE126:
+	.loc 1 2365 63
+	mov	rax, QWORD PTR -1096[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 2365 75
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 2365 22
+	lea	rax, -992[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsCheckpoint_Write@PLT
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 2366 13
+	lea	rax, -992[rbp]
+	mov	rdi, rax
+	call	lmsCheckpoint_Close@PLT
+.L624:
+.LBE124:
+.LBB127:
+	.loc 1 2370 14
+	mov	DWORD PTR -52[rbp], 0
+	.loc 1 2370 5
+	jmp	.L630
+.L633:
+	.loc 1 2372 21
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	imul	rdx, rax, 752
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 2372 24
+	mov	eax, DWORD PTR 704[rax]
+	.loc 1 2372 12
+	test	eax, eax
+	je	.L631
+	.loc 1 2374 13
+	mov	eax, DWORD PTR -52[rbp]
+	mov	esi, eax
+	lea	rax, .LC65[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 2375 20
+	mov	DWORD PTR -20[rbp], 1
+.L631:
+	.loc 1 2377 45
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	imul	rdx, rax, 752
+	.loc 1 2377 13
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	mov	rdi, rax
+	call	lmsFilter_ChannelClose
+	.loc 1 2377 12
+	test	eax, eax
+	je	.L632
+	.loc 1 2379 20
+	mov	DWORD PTR -20[rbp], 1
+.L632:
+	.loc 1 2370 34 discriminator 2
+	add	DWORD PTR -52[rbp], 1
+.L630:
+	.loc 1 2370 23 discriminator 1
+	mov	eax, DWORD PTR -52[rbp]
+	cmp	eax, DWORD PTR -24[rbp]
+	jl	.L633
+.LBE127:
+	.loc 1 2382 5
+	mov	rax, QWORD PTR -96[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2383 5
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2384 16
+	mov	rax, QWORD PTR -1072[rbp]
+	.loc 1 2384 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2385 16
+	mov	rax, QWORD PTR -1064[rbp]
+	.loc 1 2385 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2386 8
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L634
+	.loc 1 2388 13
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 2388 27
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 2388 9
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL23:
+.L634:
+	.loc 1 2390 9
+	lea	rax, -768[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 2390 8
+	test	eax, eax
+	je	.L635
+	.loc 1 2392 9
+	mov	rax, QWORD PTR -1088[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 2393 16
+	mov	DWORD PTR -20[rbp], 1
+.L635:
+	.loc 1 2395 12
+	mov	eax, DWORD PTR -20[rbp]
+.L636:
+	.loc 1 2396 1 discriminator 1
+	lea	rsp, -16[rbp]
+	pop	rbx
+	pop	r12
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE63:
+	.size	lmsFilter_FilterInterleavedFile, .-lmsFilter_FilterInterleavedFile
+	.section	.rodata
+	.align 8
+.LC66:
+	.string	"Filtered files:               %d/%d\r"
+	.text
+	.type	lmsFilter_FileTask, @function
+lmsFilter_FileTask:
+.LFB64:
+	.loc 1 2403 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 2404 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 2405 27
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	esi, 0
+	mov	rdi, rax
+	call	lmsFilter_CreateLike
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 2407 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 36[rax], 1
+	.loc 1 2408 8
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L639
+	.loc 1 2410 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_FilterSignalAndSaveToFile
+	.loc 1 2410 21
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	DWORD PTR 36[rdx], eax
+	.loc 1 2411 9
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Destroy
+.L639:
+	.loc 1 2414 38
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 2414 16
+	mov	eax, 1
+	lock xadd	DWORD PTR [rdx], eax
+	add	eax, 1
+	.loc 1 2414 9
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 2415 12
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 2415 22
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2415 8
+	test	eax, eax
+	jne	.L641
+	.loc 1 2417 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 32[rax]
+	mov	eax, DWORD PTR -20[rbp]
+	mov	esi, eax
+	lea	rax, .LC66[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 2418 9
+	mov	rax, QWORD PTR stdout[rip]
+	mov	rdi, rax
+	call	fflush@PLT
+.L641:
+	.loc 1 2420 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE64:
+	.size	lmsFilter_FileTask, .-lmsFilter_FileTask
+	.section	.rodata
+	.align 8
+.LC67:
+	.string	"Error: Interleaved channels are not supported for a batch of files"
+.LC68:
+	.string	"Error allocating filter jobs"
+	.align 8
+.LC69:
+	.string	"Input files:                  %d\n"
+.LC70:
+	.string	"Filtering failed: %s\n"
+	.text
+	.globl	lmsFilter_FilterFiles
+	.type	lmsFilter_FilterFiles, @function
+lmsFilter_FilterFiles:
+.LFB65:
+	.loc 1 2424 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 360
+	.cfi_offset 3, -24
+	mov	QWORD PTR -344[rbp], rdi
+	mov	QWORD PTR -352[rbp], rsi
+	mov	DWORD PTR -356[rbp], edx
+	mov	QWORD PTR -368[rbp], rcx
+	.loc 1 2425 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 2427 9
+	mov	DWORD PTR -228[rbp], 0
+	.loc 1 2430 18
+	mov	rax, QWORD PTR -368[rbp]
+	mov	eax, DWORD PTR 36[rax]
+	.loc 1 2430 8
+	cmp	eax, 1
+	jg	.L643
+	.loc 1 2430 45 discriminator 1
+	mov	rax, QWORD PTR -368[rbp]
+	mov	eax, DWORD PTR 52[rax]
+	.loc 1 2430 34 discriminator 1
+	test	eax, eax
+	je	.L644
+.L643:
+	.loc 1 2432 9
+	lea	rax, .LC67[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2433 16
+	mov	eax, 1
+	jmp	.L657
+.L644:
+	.loc 1 2437 29
+	mov	rax, QWORD PTR -368[rbp]
+	mov	rcx, QWORD PTR [rax]
+	mov	rbx, QWORD PTR 8[rax]
+	mov	QWORD PTR -336[rbp], rcx
+	mov	QWORD PTR -328[rbp], rbx
+	mov	rcx, QWORD PTR 16[rax]
+	mov	rbx, QWORD PTR 24[rax]
+	mov	QWORD PTR -320[rbp], rcx
+	mov	QWORD PTR -312[rbp], rbx
+	mov	rcx, QWORD PTR 32[rax]
+	mov	rbx, QWORD PTR 40[rax]
+	mov	QWORD PTR -304[rbp], rcx
+	mov	QWORD PTR -296[rbp], rbx
+	mov	rcx, QWORD PTR 48[rax]
+	mov	rbx, QWORD PTR 56[rax]
+	mov	QWORD PTR -288[rbp], rcx
+	mov	QWORD PTR -280[rbp], rbx
+	mov	rcx, QWORD PTR 64[rax]
+	mov	rbx, QWORD PTR 72[rax]
+	mov	QWORD PTR -272[rbp], rcx
+	mov	QWORD PTR -264[rbp], rbx
+	mov	rcx, QWORD PTR 80[rax]
+	mov	rbx, QWORD PTR 88[rax]
+	mov	QWORD PTR -256[rbp], rcx
+	mov	QWORD PTR -248[rbp], rbx
+	mov	rax, QWORD PTR 96[rax]
+	mov	QWORD PTR -240[rbp], rax
+	.loc 1 2438 33
+	mov	QWORD PTR -320[rbp], 0
+	.loc 1 2439 24
+	mov	DWORD PTR -240[rbp], 1
+	.loc 1 2440 28
+	mov	DWORD PTR -280[rbp], 0
+	.loc 1 2441 31
+	mov	DWORD PTR -296[rbp], 1
+	.loc 1 2442 23
+	mov	QWORD PTR -248[rbp], 0
+	.loc 1 2444 53
+	mov	eax, DWORD PTR -356[rbp]
+	cdqe
+	mov	esi, 40
+	mov	rdi, rax
+	call	calloc@PLT
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 2445 8
+	cmp	QWORD PTR -40[rbp], 0
+	jne	.L646
+	.loc 1 2447 9
+	lea	rax, .LC68[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 2448 16
+	mov	eax, 1
+	jmp	.L657
+.L646:
+	.loc 1 2450 40
+	mov	rax, QWORD PTR -368[rbp]
+	mov	edx, DWORD PTR 40[rax]
+	.loc 1 2450 9
+	lea	rax, -224[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	threadPool_Init@PLT
+	.loc 1 2450 8
+	test	eax, eax
+	je	.L647
+	.loc 1 2452 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2453 16
+	mov	eax, 1
+	jmp	.L657
+.L647:
+	.loc 1 2455 17
+	mov	rax, QWORD PTR -368[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2455 8
+	test	eax, eax
+	jne	.L648
+	.loc 1 2457 9
+	mov	eax, DWORD PTR -356[rbp]
+	mov	esi, eax
+	lea	rax, .LC69[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 2458 9
+	mov	eax, DWORD PTR -208[rbp]
+	mov	esi, eax
+	lea	rax, .LC64[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L648:
+.LBB128:
+	.loc 1 2461 14
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 2461 5
+	jmp	.L649
+.L652:
+	.loc 1 2463 13
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	add	rdx, rax
+	.loc 1 2463 27
+	mov	rax, QWORD PTR -344[rbp]
+	mov	QWORD PTR [rdx], rax
+	.loc 1 2464 47
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -352[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 2464 13
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	add	rdx, rax
+	.loc 1 2464 47
+	mov	rax, QWORD PTR [rcx]
+	.loc 1 2464 31
+	mov	QWORD PTR 8[rdx], rax
+	.loc 1 2465 13
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	add	rdx, rax
+	.loc 1 2465 26
+	lea	rax, -336[rbp]
+	mov	QWORD PTR 16[rdx], rax
+	.loc 1 2466 13
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	add	rdx, rax
+	.loc 1 2466 27
+	lea	rax, -228[rbp]
+	mov	QWORD PTR 24[rdx], rax
+	.loc 1 2467 13
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	add	rdx, rax
+	.loc 1 2467 28
+	mov	eax, DWORD PTR -356[rbp]
+	mov	DWORD PTR 32[rdx], eax
+	.loc 1 2468 13
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 2468 24
+	mov	DWORD PTR 36[rax], 1
+	.loc 1 2469 63
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	.loc 1 2469 58
+	mov	rax, QWORD PTR -40[rbp]
+	add	rdx, rax
+	.loc 1 2469 13
+	lea	rax, -224[rbp]
+	lea	rcx, lmsFilter_FileTask[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	threadPool_Submit@PLT
+	.loc 1 2469 12
+	test	eax, eax
+	jne	.L658
+	.loc 1 2461 38 discriminator 2
+	add	DWORD PTR -24[rbp], 1
+.L649:
+	.loc 1 2461 23 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -356[rbp]
+	jl	.L652
+	jmp	.L651
+.L658:
+	.loc 1 2471 13
+	nop
+.L651:
+.LBE128:
+	.loc 1 2474 5
+	lea	rax, -224[rbp]
+	mov	rdi, rax
+	call	threadPool_Wait@PLT
+	.loc 1 2475 5
+	lea	rax, -224[rbp]
+	mov	rdi, rax
+	call	threadPool_Destroy@PLT
+	.loc 1 2477 17
+	mov	rax, QWORD PTR -368[rbp]
+	mov	eax, DWORD PTR 96[rax]
+	.loc 1 2477 8
+	test	eax, eax
+	jne	.L653
+	.loc 1 2479 9
+	mov	edi, 10
+	call	putchar@PLT
+.L653:
+.LBB129:
+	.loc 1 2481 14
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 2481 5
+	jmp	.L654
+.L656:
+	.loc 1 2483 17
+	mov	eax, DWORD PTR -28[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 2483 20
+	mov	eax, DWORD PTR 36[rax]
+	.loc 1 2483 12
+	test	eax, eax
+	je	.L655
+	.loc 1 2485 60
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -352[rbp]
+	add	rax, rdx
+	.loc 1 2485 13
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rax
+	lea	rax, .LC70[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 2486 20
+	mov	DWORD PTR -20[rbp], 1
+.L655:
+	.loc 1 2481 38 discriminator 2
+	add	DWORD PTR -28[rbp], 1
+.L654:
+	.loc 1 2481 23 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	cmp	eax, DWORD PTR -356[rbp]
+	jl	.L656
+.LBE129:
+	.loc 1 2489 5
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 2491 12
+	mov	eax, DWORD PTR -20[rbp]
+.L657:
+	.loc 1 2492 1 discriminator 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE65:
+	.size	lmsFilter_FilterFiles, .-lmsFilter_FilterFiles
+	.local	dotCounter.1
+	.comm	dotCounter.1,4,4
+	.section	.rodata
+	.align 32
+	.type	zeros.0, @object
+	.size	zeros.0, 256
+zeros.0:
+	.zero	256
+	.align 4
+.LC2:
+	.long	1065353216
+	.align 8
+.LC3:
+	.long	-1598689907
+	.long	1051772663
+	.align 16
+.LC4:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC5:
+	.long	2139095039
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 14 "include/lmsAllocator.h"
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 16 "include/lmsCheckpoint.h"
+	.file 17 "/usr/include/ctype.h"
+	.file 18 "include/lmsKernel.h"
+	.file 19 "include/asyncFile.h"
+	.file 20 "include/sampleIo.h"
+	.file 21 "include/lmsPlot.h"
+	.file 22 "include/lmsRealtime.h"
+	.file 23 "include/lmsTelemetry.h"
+	.file 24 "include/lmsFilter.h"
+	.file 25 "include/lmsFilterBank.h"
+	.file 26 "include/lmsEngine.h"
+	.file 27 "include/threadPool.h"
+	.file 28 "include/spscRing.h"
+	.file 29 "/usr/include/stdlib.h"
+	.file 30 "/usr/include/time.h"
+	.file 31 "/usr/include/pthread.h"
+	.file 32 "/usr/include/stdio.h"
+	.file 33 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x4ef6
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x39
+	.long	.LASF623
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x6
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0xb
+	.long	0x2e
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.long	0x46
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xb
+	.long	0x52
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x18
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xb
+	.long	0x65
+	.uleb128 0x18
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xb
+	.long	0x71
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x18
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x6
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x26
+	.byte	0x17
+	.long	0x65
+	.uleb128 0x18
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x6
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x29
+	.byte	0x14
+	.long	0x46
+	.uleb128 0x6
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x7d
+	.uleb128 0x6
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x19
+	.long	0x52
+	.uleb128 0x6
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x6
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x52
+	.uleb128 0x6
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x52
+	.uleb128 0x6
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x52
+	.uleb128 0x6
+	.long	.LASF19
+	.byte	0x3
+	.byte	0xa9
+	.byte	0x1d
+	.long	0x46
+	.uleb128 0x3b
+	.byte	0x8
+	.uleb128 0x2a
+	.long	0xfe
+	.uleb128 0x6
+	.long	.LASF20
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x52
+	.uleb128 0x6
+	.long	.LASF21
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x21
+	.long	0x52
+	.uleb128 0x5
+	.long	0x122
+	.uleb128 0x18
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF22
+	.uleb128 0xb
+	.long	0x122
+	.uleb128 0x6
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x55
+	.byte	0x11
+	.long	0xce
+	.uleb128 0x6
+	.long	.LASF24
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0x105
+	.uleb128 0x6
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0xf2
+	.uleb128 0x6
+	.long	.LASF26
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x13
+	.long	0x9e
+	.uleb128 0x6
+	.long	.LASF27
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x13
+	.long	0xb6
+	.uleb128 0x22
+	.long	.LASF36
+	.byte	0x10
+	.byte	0x7
+	.byte	0xb
+	.byte	0x8
+	.long	0x192
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x10
+	.byte	0xc
+	.long	0xe6
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x7
+	.byte	0x15
+	.byte	0x15
+	.long	0x111
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0x16a
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x3
+	.long	0x1bb
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x12
+	.long	0x7d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x1f
+	.byte	0x12
+	.long	0x7d
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2b
+	.byte	0x8
+	.byte	0x8
+	.byte	0x19
+	.long	0x1dc
+	.uleb128 0x1a
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x28
+	.long	0x1dc
+	.uleb128 0x1a
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x20
+	.byte	0x5
+	.long	0x197
+	.byte	0
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF34
+	.uleb128 0xb
+	.long	0x1dc
+	.uleb128 0x6
+	.long	.LASF35
+	.byte	0x8
+	.byte	0x21
+	.byte	0x3
+	.long	0x1bb
+	.uleb128 0x22
+	.long	.LASF37
+	.byte	0x10
+	.byte	0x9
+	.byte	0x33
+	.byte	0x10
+	.long	0x21c
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x35
+	.byte	0x23
+	.long	0x21c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x36
+	.byte	0x23
+	.long	0x21c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x1f4
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x37
+	.byte	0x3
+	.long	0x1f4
+	.uleb128 0x22
+	.long	.LASF41
+	.byte	0x28
+	.byte	0xa
+	.byte	0x16
+	.byte	0x8
+	.long	0x2a3
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0xa
+	.byte	0x18
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0xa
+	.byte	0x19
+	.byte	0x10
+	.long	0x7d
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x7
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x10
+	.long	0x7d
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0xa
+	.byte	0x20
+	.byte	0x7
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0xa
+	.byte	0x22
+	.byte	0x9
+	.long	0x97
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0xa
+	.byte	0x23
+	.byte	0x9
+	.long	0x97
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0xa
+	.byte	0x24
+	.byte	0x14
+	.long	0x221
+	.byte	0x18
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF50
+	.byte	0x30
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x8
+	.long	0x30c
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x60
+	.byte	0x19
+	.long	0x1e8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x61
+	.byte	0x19
+	.long	0x1e8
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x9
+	.byte	0x62
+	.byte	0x10
+	.long	0x30c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x9
+	.byte	0x63
+	.byte	0x10
+	.long	0x30c
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x9
+	.byte	0x64
+	.byte	0x10
+	.long	0x7d
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x9
+	.byte	0x65
+	.byte	0x10
+	.long	0x7d
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x9
+	.byte	0x66
+	.byte	0x10
+	.long	0x30c
+	.byte	0x28
+	.byte	0
+	.uleb128 0x12
+	.long	0x7d
+	.long	0x31c
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x3c
+	.long	.LASF61
+	.byte	0x38
+	.byte	0xb
+	.byte	0x38
+	.byte	0x7
+	.long	0x34e
+	.uleb128 0x1a
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x8
+	.long	0x34e
+	.uleb128 0x1a
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x3b
+	.byte	0xc
+	.long	0x52
+	.byte	0
+	.uleb128 0x12
+	.long	0x122
+	.long	0x35e
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x37
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF61
+	.byte	0xb
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x328
+	.uleb128 0xb
+	.long	0x35e
+	.uleb128 0x2b
+	.byte	0x28
+	.byte	0xb
+	.byte	0x43
+	.long	0x39c
+	.uleb128 0x1a
+	.long	.LASF62
+	.byte	0xb
+	.byte	0x45
+	.byte	0x1c
+	.long	0x22d
+	.uleb128 0x1a
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x46
+	.byte	0x8
+	.long	0x39c
+	.uleb128 0x1a
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x47
+	.byte	0xc
+	.long	0x52
+	.byte	0
+	.uleb128 0x12
+	.long	0x122
+	.long	0x3ac
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x27
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF63
+	.byte	0xb
+	.byte	0x48
+	.byte	0x3
+	.long	0x36f
+	.uleb128 0x2b
+	.byte	0x30
+	.byte	0xb
+	.byte	0x4b
+	.long	0x3e5
+	.uleb128 0x1a
+	.long	.LASF62
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x2a3
+	.uleb128 0x1a
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x4e
+	.byte	0x8
+	.long	0x3e5
+	.uleb128 0x1a
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x5e
+	.byte	0
+	.uleb128 0x12
+	.long	0x122
+	.long	0x3f5
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF64
+	.byte	0xb
+	.byte	0x50
+	.byte	0x3
+	.long	0x3b8
+	.uleb128 0x12
+	.long	0x122
+	.long	0x411
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0x416
+	.uleb128 0x3d
+	.uleb128 0x22
+	.long	.LASF65
+	.byte	0xd8
+	.byte	0xc
+	.byte	0x31
+	.byte	0x8
+	.long	0x59e
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0xc
+	.byte	0x33
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0xc
+	.byte	0x36
+	.byte	0x9
+	.long	0x11d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0xc
+	.byte	0x37
+	.byte	0x9
+	.long	0x11d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0xc
+	.byte	0x38
+	.byte	0x9
+	.long	0x11d
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0xc
+	.byte	0x39
+	.byte	0x9
+	.long	0x11d
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0xc
+	.byte	0x3a
+	.byte	0x9
+	.long	0x11d
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0xc
+	.byte	0x3b
+	.byte	0x9
+	.long	0x11d
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x9
+	.long	0x11d
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x9
+	.long	0x11d
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0xc
+	.byte	0x40
+	.byte	0x9
+	.long	0x11d
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0xc
+	.byte	0x41
+	.byte	0x9
+	.long	0x11d
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0xc
+	.byte	0x42
+	.byte	0x9
+	.long	0x11d
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0xc
+	.byte	0x44
+	.byte	0x16
+	.long	0x5b7
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0xc
+	.byte	0x46
+	.byte	0x14
+	.long	0x5bc
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xc
+	.byte	0x48
+	.byte	0x7
+	.long	0x46
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xc
+	.byte	0x49
+	.byte	0x7
+	.long	0x46
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xb
+	.long	0xce
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xc
+	.byte	0x4d
+	.byte	0x12
+	.long	0x71
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xf
+	.long	0x84
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0xc
+	.byte	0x4f
+	.byte	0x8
+	.long	0x5c1
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0xc
+	.byte	0x51
+	.byte	0xf
+	.long	0x5d1
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0xc
+	.byte	0x59
+	.byte	0xd
+	.long	0xda
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0xc
+	.byte	0x5b
+	.byte	0x17
+	.long	0x5db
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x19
+	.long	0x5e5
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x14
+	.long	0x5bc
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x9
+	.long	0xfe
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0xc
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0xc
+	.byte	0x60
+	.byte	0x7
+	.long	0x46
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xc
+	.byte	0x62
+	.byte	0x8
+	.long	0x5ea
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF95
+	.byte	0xd
+	.byte	0x7
+	.byte	0x19
+	.long	0x417
+	.uleb128 0x3e
+	.long	.LASF624
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x2c
+	.long	.LASF96
+	.uleb128 0x5
+	.long	0x5b2
+	.uleb128 0x5
+	.long	0x417
+	.uleb128 0x12
+	.long	0x122
+	.long	0x5d1
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x5aa
+	.uleb128 0x2c
+	.long	.LASF97
+	.uleb128 0x5
+	.long	0x5d6
+	.uleb128 0x2c
+	.long	.LASF98
+	.uleb128 0x5
+	.long	0x5e0
+	.uleb128 0x12
+	.long	0x122
+	.long	0x5fa
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0x59e
+	.uleb128 0x3f
+	.long	.LASF625
+	.byte	0x20
+	.byte	0x90
+	.byte	0xe
+	.long	0x5fa
+	.uleb128 0x5
+	.long	0x78
+	.uleb128 0x5
+	.long	0x129
+	.uleb128 0xb
+	.long	0x610
+	.uleb128 0x18
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF99
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x11
+	.byte	0x2f
+	.long	0x67d
+	.uleb128 0x1c
+	.long	.LASF100
+	.value	0x100
+	.uleb128 0x1c
+	.long	.LASF101
+	.value	0x200
+	.uleb128 0x1c
+	.long	.LASF102
+	.value	0x400
+	.uleb128 0x1c
+	.long	.LASF103
+	.value	0x800
+	.uleb128 0x1c
+	.long	.LASF104
+	.value	0x1000
+	.uleb128 0x1c
+	.long	.LASF105
+	.value	0x2000
+	.uleb128 0x1c
+	.long	.LASF106
+	.value	0x4000
+	.uleb128 0x1c
+	.long	.LASF107
+	.value	0x8000
+	.uleb128 0x8
+	.long	.LASF108
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF109
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF110
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF111
+	.byte	0x8
+	.byte	0
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF112
+	.uleb128 0xb
+	.long	0x67d
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF113
+	.uleb128 0x26
+	.long	0x69b
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x5
+	.long	0x690
+	.uleb128 0xf
+	.byte	0x18
+	.byte	0xe
+	.byte	0x10
+	.byte	0x9
+	.long	0x6d1
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0xe
+	.byte	0x13
+	.byte	0xd
+	.long	0x6ea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0xe
+	.byte	0x16
+	.byte	0xc
+	.long	0x6ff
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0xe
+	.byte	0x18
+	.byte	0xb
+	.long	0xfe
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1d
+	.long	0xfe
+	.long	0x6ea
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x6d1
+	.uleb128 0x26
+	.long	0x6ff
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x5
+	.long	0x6ef
+	.uleb128 0x6
+	.long	.LASF117
+	.byte	0xe
+	.byte	0x19
+	.byte	0x3
+	.long	0x6a0
+	.uleb128 0xb
+	.long	0x704
+	.uleb128 0xf
+	.byte	0x18
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x9
+	.long	0x746
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x14
+	.long	0x746
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0xe
+	.byte	0x20
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	0x65
+	.uleb128 0x6
+	.long	.LASF121
+	.byte	0xe
+	.byte	0x21
+	.byte	0x3
+	.long	0x715
+	.uleb128 0x6
+	.long	.LASF122
+	.byte	0xf
+	.byte	0x18
+	.byte	0x13
+	.long	0x8b
+	.uleb128 0x6
+	.long	.LASF123
+	.byte	0xf
+	.byte	0x1a
+	.byte	0x14
+	.long	0xaa
+	.uleb128 0x6
+	.long	.LASF124
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x14
+	.long	0xc2
+	.uleb128 0xf
+	.byte	0x80
+	.byte	0x10
+	.byte	0x18
+	.byte	0x9
+	.long	0x86f
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0x10
+	.byte	0x1a
+	.byte	0xa
+	.long	0x401
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0x10
+	.byte	0x1b
+	.byte	0xe
+	.long	0x763
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0x10
+	.byte	0x1c
+	.byte	0xe
+	.long	0x763
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0x10
+	.byte	0x1d
+	.byte	0xe
+	.long	0x763
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0x10
+	.byte	0x1e
+	.byte	0xe
+	.long	0x763
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x10
+	.byte	0x1f
+	.byte	0xe
+	.long	0x763
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0x10
+	.byte	0x20
+	.byte	0xe
+	.long	0x763
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x10
+	.byte	0x21
+	.byte	0xe
+	.long	0x763
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x10
+	.byte	0x22
+	.byte	0xb
+	.long	0x67d
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x10
+	.byte	0x23
+	.byte	0xb
+	.long	0x67d
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x10
+	.byte	0x24
+	.byte	0xe
+	.long	0x763
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0x10
+	.byte	0x25
+	.byte	0xd
+	.long	0x152
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0x10
+	.byte	0x26
+	.byte	0xd
+	.long	0x15e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x10
+	.byte	0x27
+	.byte	0xe
+	.long	0x76f
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x10
+	.byte	0x28
+	.byte	0xe
+	.long	0x76f
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x10
+	.byte	0x29
+	.byte	0xc
+	.long	0x689
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x10
+	.byte	0x2a
+	.byte	0xb
+	.long	0x67d
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0x10
+	.byte	0x2b
+	.byte	0xd
+	.long	0x86f
+	.byte	0x5c
+	.byte	0
+	.uleb128 0x12
+	.long	0x757
+	.long	0x87f
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x23
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF143
+	.byte	0x10
+	.byte	0x2c
+	.byte	0x3
+	.long	0x77b
+	.uleb128 0xb
+	.long	0x87f
+	.uleb128 0xf
+	.byte	0x28
+	.byte	0x10
+	.byte	0x2f
+	.byte	0x9
+	.long	0x8db
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x10
+	.byte	0x31
+	.byte	0x1c
+	.long	0x8db
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x10
+	.byte	0x32
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0x10
+	.byte	0x33
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0x10
+	.byte	0x34
+	.byte	0xc
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x10
+	.byte	0x35
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x87f
+	.uleb128 0x5
+	.long	0x67d
+	.uleb128 0x6
+	.long	.LASF148
+	.byte	0x10
+	.byte	0x36
+	.byte	0x3
+	.long	0x890
+	.uleb128 0xb
+	.long	0x8e5
+	.uleb128 0xf
+	.byte	0x20
+	.byte	0x10
+	.byte	0x39
+	.byte	0x9
+	.long	0x934
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x10
+	.byte	0x3b
+	.byte	0x11
+	.long	0x610
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x10
+	.byte	0x3c
+	.byte	0xa
+	.long	0x52
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x10
+	.byte	0x3d
+	.byte	0x11
+	.long	0x610
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x10
+	.byte	0x3e
+	.byte	0x11
+	.long	0x610
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF153
+	.byte	0x10
+	.byte	0x3f
+	.byte	0x3
+	.long	0x8f6
+	.uleb128 0xb
+	.long	0x934
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x12
+	.byte	0xf
+	.long	0x96f
+	.uleb128 0x8
+	.long	.LASF154
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF155
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF156
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF157
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF158
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF159
+	.byte	0x12
+	.byte	0x15
+	.byte	0x3
+	.long	0x945
+	.uleb128 0xf
+	.byte	0x40
+	.byte	0x12
+	.byte	0x17
+	.byte	0x9
+	.long	0x9ed
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x12
+	.byte	0x19
+	.byte	0x15
+	.long	0x96f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x12
+	.byte	0x1a
+	.byte	0x11
+	.long	0x610
+	.byte	0x8
+	.uleb128 0x1e
+	.string	"dot"
+	.byte	0x12
+	.byte	0x1d
+	.byte	0xd
+	.long	0xa0b
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x12
+	.byte	0x20
+	.byte	0xc
+	.long	0xa2a
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x12
+	.byte	0x23
+	.byte	0xd
+	.long	0xa52
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x12
+	.byte	0x27
+	.byte	0xd
+	.long	0xa7f
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x12
+	.byte	0x2b
+	.byte	0xd
+	.long	0xa52
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x12
+	.byte	0x30
+	.byte	0xc
+	.long	0xaad
+	.byte	0x38
+	.byte	0
+	.uleb128 0x1d
+	.long	0x67d
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	0x684
+	.uleb128 0x5
+	.long	0x9ed
+	.uleb128 0x26
+	.long	0xa2a
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x67d
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	0xa10
+	.uleb128 0x1d
+	.long	0x67d
+	.long	0xa52
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x67d
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	0xa2f
+	.uleb128 0x1d
+	.long	0x67d
+	.long	0xa7f
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x67d
+	.uleb128 0x2
+	.long	0x67d
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	0xa57
+	.uleb128 0x26
+	.long	0xaad
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	0xa84
+	.uleb128 0x6
+	.long	.LASF167
+	.byte	0x12
+	.byte	0x32
+	.byte	0x3
+	.long	0x97b
+	.uleb128 0xb
+	.long	0xab2
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x13
+	.byte	0x15
+	.long	0xaed
+	.uleb128 0x8
+	.long	.LASF168
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF169
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF170
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF171
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF172
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF173
+	.byte	0x13
+	.byte	0x1b
+	.byte	0x3
+	.long	0xac3
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x13
+	.byte	0x1e
+	.long	0xb11
+	.uleb128 0x8
+	.long	.LASF174
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF175
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF176
+	.byte	0x13
+	.byte	0x21
+	.byte	0x3
+	.long	0xaf9
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x13
+	.byte	0x24
+	.long	0xb3b
+	.uleb128 0x8
+	.long	.LASF177
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF178
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF179
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF180
+	.byte	0x13
+	.byte	0x28
+	.byte	0x3
+	.long	0xb1d
+	.uleb128 0xf
+	.byte	0x28
+	.byte	0x13
+	.byte	0x2a
+	.byte	0x9
+	.long	0xb92
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x13
+	.byte	0x2c
+	.byte	0x14
+	.long	0x746
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x13
+	.byte	0x2d
+	.byte	0xb
+	.long	0x12e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0x13
+	.byte	0x2e
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x13
+	.byte	0x2f
+	.byte	0xd
+	.long	0x13a
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x13
+	.byte	0x30
+	.byte	0x1c
+	.long	0xb3b
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF185
+	.byte	0x13
+	.byte	0x31
+	.byte	0x3
+	.long	0xb47
+	.uleb128 0xf
+	.byte	0x78
+	.byte	0x13
+	.byte	0x34
+	.byte	0x9
+	.long	0xc6a
+	.uleb128 0x1e
+	.string	"fd"
+	.byte	0x13
+	.byte	0x36
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x13
+	.byte	0x37
+	.byte	0xb
+	.long	0xfe
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x13
+	.byte	0x38
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x13
+	.byte	0x39
+	.byte	0xb
+	.long	0xfe
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x13
+	.byte	0x3a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x13
+	.byte	0x3b
+	.byte	0xb
+	.long	0xfe
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x13
+	.byte	0x3c
+	.byte	0xc
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x13
+	.byte	0x3d
+	.byte	0x13
+	.long	0xc6a
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x13
+	.byte	0x3e
+	.byte	0x13
+	.long	0xc6a
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x13
+	.byte	0x3f
+	.byte	0x13
+	.long	0xc6a
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x13
+	.byte	0x40
+	.byte	0x13
+	.long	0xc6a
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x13
+	.byte	0x41
+	.byte	0x13
+	.long	0xc6a
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x13
+	.byte	0x42
+	.byte	0x13
+	.long	0xc6a
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x13
+	.byte	0x43
+	.byte	0xb
+	.long	0xfe
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x13
+	.byte	0x44
+	.byte	0x9
+	.long	0x46
+	.byte	0x70
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d
+	.uleb128 0x6
+	.long	.LASF200
+	.byte	0x13
+	.byte	0x45
+	.byte	0x3
+	.long	0xb9e
+	.uleb128 0x1f
+	.value	0x1f8
+	.byte	0x13
+	.byte	0x49
+	.long	0xd67
+	.uleb128 0x1e
+	.string	"fd"
+	.byte	0x13
+	.byte	0x4b
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x13
+	.byte	0x4c
+	.byte	0x15
+	.long	0xb11
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x13
+	.byte	0x4d
+	.byte	0x18
+	.long	0xaed
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x13
+	.byte	0x4e
+	.byte	0x14
+	.long	0x746
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x13
+	.byte	0x4f
+	.byte	0x17
+	.long	0xd67
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x13
+	.byte	0x50
+	.byte	0x13
+	.long	0x3f
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x13
+	.byte	0x51
+	.byte	0x13
+	.long	0x3f
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x13
+	.byte	0x52
+	.byte	0xb
+	.long	0x12e
+	.byte	0xc8
+	.uleb128 0x1e
+	.string	"end"
+	.byte	0x13
+	.byte	0x53
+	.byte	0xb
+	.long	0x12e
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x13
+	.byte	0x54
+	.byte	0x9
+	.long	0x46
+	.byte	0xd8
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0x13
+	.byte	0x55
+	.byte	0x15
+	.long	0xc6f
+	.byte	0xe0
+	.uleb128 0xd
+	.long	.LASF209
+	.byte	0x13
+	.byte	0x56
+	.byte	0xf
+	.long	0x31c
+	.value	0x158
+	.uleb128 0xd
+	.long	.LASF210
+	.byte	0x13
+	.byte	0x57
+	.byte	0x15
+	.long	0x3ac
+	.value	0x160
+	.uleb128 0xd
+	.long	.LASF211
+	.byte	0x13
+	.byte	0x58
+	.byte	0x14
+	.long	0x3f5
+	.value	0x188
+	.uleb128 0xd
+	.long	.LASF212
+	.byte	0x13
+	.byte	0x59
+	.byte	0x14
+	.long	0x3f5
+	.value	0x1b8
+	.uleb128 0xd
+	.long	.LASF213
+	.byte	0x13
+	.byte	0x5a
+	.byte	0x13
+	.long	0x3f
+	.value	0x1e8
+	.uleb128 0xd
+	.long	.LASF214
+	.byte	0x13
+	.byte	0x5b
+	.byte	0x9
+	.long	0x46
+	.value	0x1f0
+	.byte	0
+	.uleb128 0x12
+	.long	0xb92
+	.long	0xd77
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF215
+	.byte	0x13
+	.byte	0x5c
+	.byte	0x3
+	.long	0xc7b
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x14
+	.byte	0x14
+	.long	0xdb3
+	.uleb128 0x8
+	.long	.LASF216
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF217
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF218
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF219
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF220
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF221
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF222
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x3
+	.long	0xd83
+	.uleb128 0xb
+	.long	0xdb3
+	.uleb128 0x1f
+	.value	0x278
+	.byte	0x14
+	.byte	0x1d
+	.long	0xec8
+	.uleb128 0x1
+	.long	.LASF223
+	.byte	0x14
+	.byte	0x1f
+	.byte	0xb
+	.long	0x5fa
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0x14
+	.byte	0x20
+	.byte	0x14
+	.long	0xdb3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0x14
+	.byte	0x21
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0x14
+	.byte	0x22
+	.byte	0x12
+	.long	0x7d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF227
+	.byte	0x14
+	.byte	0x23
+	.byte	0xa
+	.long	0x52
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF228
+	.byte	0x14
+	.byte	0x24
+	.byte	0xa
+	.long	0x52
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF229
+	.byte	0x14
+	.byte	0x25
+	.byte	0xa
+	.long	0x52
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0x14
+	.byte	0x26
+	.byte	0xb
+	.long	0xfe
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF231
+	.byte	0x14
+	.byte	0x27
+	.byte	0x11
+	.long	0x610
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF232
+	.byte	0x14
+	.byte	0x28
+	.byte	0x11
+	.long	0x610
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF233
+	.byte	0x14
+	.byte	0x29
+	.byte	0x11
+	.long	0x610
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF234
+	.byte	0x14
+	.byte	0x2a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF235
+	.byte	0x14
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF236
+	.byte	0x14
+	.byte	0x2c
+	.byte	0x9
+	.long	0x46
+	.byte	0x5c
+	.uleb128 0x1e
+	.string	"io"
+	.byte	0x14
+	.byte	0x2d
+	.byte	0x11
+	.long	0xd77
+	.byte	0x60
+	.uleb128 0xd
+	.long	.LASF237
+	.byte	0x14
+	.byte	0x2e
+	.byte	0x1a
+	.long	0xec8
+	.value	0x258
+	.uleb128 0xd
+	.long	.LASF238
+	.byte	0x14
+	.byte	0x2f
+	.byte	0xc
+	.long	0x2e
+	.value	0x260
+	.uleb128 0xd
+	.long	.LASF239
+	.byte	0x14
+	.byte	0x30
+	.byte	0xc
+	.long	0x2e
+	.value	0x268
+	.uleb128 0xd
+	.long	.LASF240
+	.byte	0x14
+	.byte	0x31
+	.byte	0xa
+	.long	0x52
+	.value	0x270
+	.byte	0
+	.uleb128 0x5
+	.long	0x6c
+	.uleb128 0x6
+	.long	.LASF241
+	.byte	0x14
+	.byte	0x32
+	.byte	0x3
+	.long	0xdc4
+	.uleb128 0xb
+	.long	0xecd
+	.uleb128 0x1f
+	.value	0x240
+	.byte	0x14
+	.byte	0x34
+	.long	0xf76
+	.uleb128 0x1
+	.long	.LASF223
+	.byte	0x14
+	.byte	0x36
+	.byte	0xb
+	.long	0x5fa
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0x14
+	.byte	0x37
+	.byte	0x14
+	.long	0xdb3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0x14
+	.byte	0x38
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0x14
+	.byte	0x39
+	.byte	0x12
+	.long	0x7d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF227
+	.byte	0x14
+	.byte	0x3a
+	.byte	0xa
+	.long	0x52
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF242
+	.byte	0x14
+	.byte	0x3b
+	.byte	0xa
+	.long	0x52
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0x14
+	.byte	0x3c
+	.byte	0xb
+	.long	0xfe
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF243
+	.byte	0x14
+	.byte	0x3e
+	.byte	0xc
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF244
+	.byte	0x14
+	.byte	0x3f
+	.byte	0xc
+	.long	0x2e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF236
+	.byte	0x14
+	.byte	0x40
+	.byte	0x9
+	.long	0x46
+	.byte	0x40
+	.uleb128 0x1e
+	.string	"io"
+	.byte	0x14
+	.byte	0x41
+	.byte	0x11
+	.long	0xd77
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF245
+	.byte	0x14
+	.byte	0x42
+	.byte	0x3
+	.long	0xede
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x15
+	.byte	0x16
+	.long	0xfa0
+	.uleb128 0x8
+	.long	.LASF246
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF247
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF248
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF249
+	.byte	0x15
+	.byte	0x1a
+	.byte	0x3
+	.long	0xf82
+	.uleb128 0xf
+	.byte	0x10
+	.byte	0x15
+	.byte	0x1c
+	.byte	0x9
+	.long	0xfd0
+	.uleb128 0x1
+	.long	.LASF250
+	.byte	0x15
+	.byte	0x1e
+	.byte	0x11
+	.long	0x610
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF251
+	.byte	0x15
+	.byte	0x1f
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF252
+	.byte	0x15
+	.byte	0x20
+	.byte	0x3
+	.long	0xfac
+	.uleb128 0xb
+	.long	0xfd0
+	.uleb128 0xf
+	.byte	0x58
+	.byte	0x15
+	.byte	0x22
+	.byte	0x9
+	.long	0x107a
+	.uleb128 0x1
+	.long	.LASF253
+	.byte	0x15
+	.byte	0x24
+	.byte	0x17
+	.long	0xfd0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0x15
+	.byte	0x25
+	.byte	0x15
+	.long	0xfa0
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF254
+	.byte	0x15
+	.byte	0x26
+	.byte	0x9
+	.long	0x46
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF255
+	.byte	0x15
+	.byte	0x27
+	.byte	0x18
+	.long	0x107a
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF256
+	.byte	0x15
+	.byte	0x28
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF257
+	.byte	0x15
+	.byte	0x29
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF258
+	.byte	0x15
+	.byte	0x2a
+	.byte	0xd
+	.long	0x107f
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF259
+	.byte	0x15
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF260
+	.byte	0x15
+	.byte	0x2c
+	.byte	0xa
+	.long	0x52
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF261
+	.byte	0x15
+	.byte	0x2d
+	.byte	0xa
+	.long	0x52
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF262
+	.byte	0x15
+	.byte	0x2e
+	.byte	0xa
+	.long	0x52
+	.byte	0x50
+	.byte	0
+	.uleb128 0x5
+	.long	0x615
+	.uleb128 0x5
+	.long	0x689
+	.uleb128 0x6
+	.long	.LASF263
+	.byte	0x15
+	.byte	0x2f
+	.byte	0x3
+	.long	0xfe1
+	.uleb128 0xb
+	.long	0x1084
+	.uleb128 0xf
+	.byte	0x14
+	.byte	0x16
+	.byte	0x11
+	.byte	0x9
+	.long	0x10e0
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0x16
+	.byte	0x13
+	.byte	0x12
+	.long	0x7d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF264
+	.byte	0x16
+	.byte	0x14
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF265
+	.byte	0x16
+	.byte	0x15
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1e
+	.string	"cpu"
+	.byte	0x16
+	.byte	0x16
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF266
+	.byte	0x16
+	.byte	0x17
+	.byte	0x9
+	.long	0x46
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF267
+	.byte	0x16
+	.byte	0x18
+	.byte	0x3
+	.long	0x1095
+	.uleb128 0xb
+	.long	0x10e0
+	.uleb128 0x1f
+	.value	0x1018
+	.byte	0x16
+	.byte	0x1b
+	.long	0x1132
+	.uleb128 0x1
+	.long	.LASF268
+	.byte	0x16
+	.byte	0x1d
+	.byte	0x18
+	.long	0x1132
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF269
+	.byte	0x16
+	.byte	0x1e
+	.byte	0x18
+	.long	0x1dc
+	.value	0x1000
+	.uleb128 0xd
+	.long	.LASF270
+	.byte	0x16
+	.byte	0x1f
+	.byte	0x18
+	.long	0x1dc
+	.value	0x1008
+	.uleb128 0xd
+	.long	.LASF271
+	.byte	0x16
+	.byte	0x20
+	.byte	0x18
+	.long	0x1dc
+	.value	0x1010
+	.byte	0
+	.uleb128 0x12
+	.long	0x1dc
+	.long	0x1143
+	.uleb128 0x2d
+	.long	0x3f
+	.value	0x1ff
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF272
+	.byte	0x16
+	.byte	0x21
+	.byte	0x3
+	.long	0x10f1
+	.uleb128 0x1f
+	.value	0x1040
+	.byte	0x16
+	.byte	0x23
+	.long	0x118d
+	.uleb128 0x1
+	.long	.LASF253
+	.byte	0x16
+	.byte	0x25
+	.byte	0x1b
+	.long	0x10e0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF273
+	.byte	0x16
+	.byte	0x26
+	.byte	0x18
+	.long	0x1dc
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF274
+	.byte	0x16
+	.byte	0x27
+	.byte	0x18
+	.long	0x1dc
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF275
+	.byte	0x16
+	.byte	0x28
+	.byte	0x1b
+	.long	0x1143
+	.byte	0x28
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF276
+	.byte	0x16
+	.byte	0x29
+	.byte	0x3
+	.long	0x114f
+	.uleb128 0xb
+	.long	0x118d
+	.uleb128 0xf
+	.byte	0x40
+	.byte	0x16
+	.byte	0x2b
+	.byte	0x9
+	.long	0x1210
+	.uleb128 0x1
+	.long	.LASF277
+	.byte	0x16
+	.byte	0x2d
+	.byte	0x18
+	.long	0x1dc
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF274
+	.byte	0x16
+	.byte	0x2e
+	.byte	0x18
+	.long	0x1dc
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF273
+	.byte	0x16
+	.byte	0x2f
+	.byte	0x18
+	.long	0x1dc
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF278
+	.byte	0x16
+	.byte	0x30
+	.byte	0x18
+	.long	0x1dc
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF279
+	.byte	0x16
+	.byte	0x31
+	.byte	0x18
+	.long	0x1dc
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF280
+	.byte	0x16
+	.byte	0x32
+	.byte	0x18
+	.long	0x1dc
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF271
+	.byte	0x16
+	.byte	0x33
+	.byte	0x18
+	.long	0x1dc
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF281
+	.byte	0x16
+	.byte	0x34
+	.byte	0xc
+	.long	0x689
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF282
+	.byte	0x16
+	.byte	0x35
+	.byte	0x3
+	.long	0x119e
+	.uleb128 0xb
+	.long	0x1210
+	.uleb128 0xf
+	.byte	0x14
+	.byte	0x17
+	.byte	0x19
+	.byte	0x9
+	.long	0x126c
+	.uleb128 0x1
+	.long	.LASF283
+	.byte	0x17
+	.byte	0x1b
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF284
+	.byte	0x17
+	.byte	0x1c
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF285
+	.byte	0x17
+	.byte	0x1d
+	.byte	0xb
+	.long	0x67d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF286
+	.byte	0x17
+	.byte	0x1e
+	.byte	0xb
+	.long	0x67d
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF287
+	.byte	0x17
+	.byte	0x1f
+	.byte	0xb
+	.long	0x67d
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF288
+	.byte	0x17
+	.byte	0x20
+	.byte	0x3
+	.long	0x1221
+	.uleb128 0xb
+	.long	0x126c
+	.uleb128 0xf
+	.byte	0xb8
+	.byte	0x17
+	.byte	0x22
+	.byte	0x9
+	.long	0x1398
+	.uleb128 0x1
+	.long	.LASF253
+	.byte	0x17
+	.byte	0x24
+	.byte	0x1c
+	.long	0x126c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF289
+	.byte	0x17
+	.byte	0x25
+	.byte	0xc
+	.long	0x689
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF290
+	.byte	0x17
+	.byte	0x26
+	.byte	0xc
+	.long	0x689
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF291
+	.byte	0x17
+	.byte	0x27
+	.byte	0xc
+	.long	0x689
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF292
+	.byte	0x17
+	.byte	0x28
+	.byte	0xc
+	.long	0x689
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF293
+	.byte	0x17
+	.byte	0x29
+	.byte	0xc
+	.long	0x689
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF294
+	.byte	0x17
+	.byte	0x2a
+	.byte	0xc
+	.long	0x689
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF295
+	.byte	0x17
+	.byte	0x2b
+	.byte	0xc
+	.long	0x689
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF296
+	.byte	0x17
+	.byte	0x2c
+	.byte	0xc
+	.long	0x689
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF297
+	.byte	0x17
+	.byte	0x2d
+	.byte	0xc
+	.long	0x689
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF298
+	.byte	0x17
+	.byte	0x2e
+	.byte	0xc
+	.long	0x689
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF299
+	.byte	0x17
+	.byte	0x2f
+	.byte	0xa
+	.long	0x52
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF300
+	.byte	0x17
+	.byte	0x30
+	.byte	0xa
+	.long	0x52
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF301
+	.byte	0x17
+	.byte	0x31
+	.byte	0xa
+	.long	0x52
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF302
+	.byte	0x17
+	.byte	0x32
+	.byte	0x9
+	.long	0x46
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF303
+	.byte	0x17
+	.byte	0x33
+	.byte	0xa
+	.long	0x52
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF304
+	.byte	0x17
+	.byte	0x34
+	.byte	0xc
+	.long	0x689
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF305
+	.byte	0x17
+	.byte	0x35
+	.byte	0xc
+	.long	0x689
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF306
+	.byte	0x17
+	.byte	0x36
+	.byte	0xc
+	.long	0x689
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF307
+	.byte	0x17
+	.byte	0x37
+	.byte	0x9
+	.long	0x46
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF308
+	.byte	0x17
+	.byte	0x38
+	.byte	0xa
+	.long	0x52
+	.byte	0xb0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF309
+	.byte	0x17
+	.byte	0x39
+	.byte	0x3
+	.long	0x127d
+	.uleb128 0xb
+	.long	0x1398
+	.uleb128 0xf
+	.byte	0x50
+	.byte	0x17
+	.byte	0x3b
+	.byte	0x9
+	.long	0x1435
+	.uleb128 0x1
+	.long	.LASF299
+	.byte	0x17
+	.byte	0x3d
+	.byte	0xa
+	.long	0x52
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF310
+	.byte	0x17
+	.byte	0x3e
+	.byte	0xc
+	.long	0x689
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF311
+	.byte	0x17
+	.byte	0x3f
+	.byte	0xc
+	.long	0x689
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF312
+	.byte	0x17
+	.byte	0x40
+	.byte	0xc
+	.long	0x689
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF301
+	.byte	0x17
+	.byte	0x41
+	.byte	0xa
+	.long	0x52
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF304
+	.byte	0x17
+	.byte	0x42
+	.byte	0xc
+	.long	0x689
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF313
+	.byte	0x17
+	.byte	0x43
+	.byte	0xc
+	.long	0x689
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF306
+	.byte	0x17
+	.byte	0x44
+	.byte	0xc
+	.long	0x689
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF307
+	.byte	0x17
+	.byte	0x45
+	.byte	0x9
+	.long	0x46
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF308
+	.byte	0x17
+	.byte	0x46
+	.byte	0xa
+	.long	0x52
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF314
+	.byte	0x17
+	.byte	0x47
+	.byte	0x3
+	.long	0x13a9
+	.uleb128 0xb
+	.long	0x1435
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x18
+	.byte	0x19
+	.long	0x147c
+	.uleb128 0x8
+	.long	.LASF315
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF316
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF317
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF318
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF319
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF321
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF322
+	.byte	0x18
+	.byte	0x21
+	.byte	0x3
+	.long	0x1446
+	.uleb128 0xb
+	.long	0x147c
+	.uleb128 0x6
+	.long	.LASF323
+	.byte	0x18
+	.byte	0x23
+	.byte	0x1a
+	.long	0x149e
+	.uleb128 0xb
+	.long	0x148d
+	.uleb128 0x22
+	.long	.LASF324
+	.byte	0x70
+	.byte	0x18
+	.byte	0x29
+	.byte	0x8
+	.long	0x156f
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x18
+	.byte	0x2b
+	.byte	0xb
+	.long	0x67d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x18
+	.byte	0x2c
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x18
+	.byte	0x2d
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF325
+	.byte	0x18
+	.byte	0x2e
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF326
+	.byte	0x18
+	.byte	0x2f
+	.byte	0x9
+	.long	0x46
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x18
+	.byte	0x30
+	.byte	0xb
+	.long	0x67d
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0x18
+	.byte	0x31
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x18
+	.byte	0x32
+	.byte	0xc
+	.long	0x689
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x18
+	.byte	0x33
+	.byte	0x18
+	.long	0x147c
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x18
+	.byte	0x34
+	.byte	0xb
+	.long	0x67d
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF327
+	.byte	0x18
+	.byte	0x35
+	.byte	0xb
+	.long	0x67d
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF328
+	.byte	0x18
+	.byte	0x36
+	.byte	0x1d
+	.long	0x156f
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF329
+	.byte	0x18
+	.byte	0x37
+	.byte	0x18
+	.long	0x15b2
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF330
+	.byte	0x18
+	.byte	0x38
+	.byte	0x14
+	.long	0x704
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x18
+	.byte	0x39
+	.byte	0xb
+	.long	0xfe
+	.byte	0x68
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF331
+	.byte	0x18
+	.byte	0x26
+	.byte	0xf
+	.long	0x1580
+	.uleb128 0xb
+	.long	0x156f
+	.uleb128 0x5
+	.long	0x1585
+	.uleb128 0x1d
+	.long	0x46
+	.long	0x15ad
+	.uleb128 0x2
+	.long	0x15ad
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	0x148d
+	.uleb128 0x5
+	.long	0xabe
+	.uleb128 0x1b
+	.long	0x7d
+	.byte	0x18
+	.byte	0x3d
+	.long	0x15ed
+	.uleb128 0x8
+	.long	.LASF332
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF333
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF334
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF335
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF336
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF338
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF339
+	.byte	0x18
+	.byte	0x45
+	.byte	0x3
+	.long	0x15b7
+	.uleb128 0xf
+	.byte	0x68
+	.byte	0x18
+	.byte	0x47
+	.byte	0x9
+	.long	0x16e0
+	.uleb128 0x1
+	.long	.LASF340
+	.byte	0x18
+	.byte	0x49
+	.byte	0x1a
+	.long	0x15ed
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF341
+	.byte	0x18
+	.byte	0x4a
+	.byte	0x14
+	.long	0xdb3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF342
+	.byte	0x18
+	.byte	0x4b
+	.byte	0x14
+	.long	0xdb3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF343
+	.byte	0x18
+	.byte	0x4c
+	.byte	0x11
+	.long	0x610
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF344
+	.byte	0x18
+	.byte	0x4d
+	.byte	0x11
+	.long	0x610
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF345
+	.byte	0x18
+	.byte	0x4e
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0x18
+	.byte	0x4f
+	.byte	0x9
+	.long	0x46
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF346
+	.byte	0x18
+	.byte	0x50
+	.byte	0x9
+	.long	0x46
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF347
+	.byte	0x18
+	.byte	0x51
+	.byte	0x9
+	.long	0x46
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF348
+	.byte	0x18
+	.byte	0x52
+	.byte	0x9
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF349
+	.byte	0x18
+	.byte	0x53
+	.byte	0x9
+	.long	0x46
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF350
+	.byte	0x18
+	.byte	0x54
+	.byte	0x9
+	.long	0x46
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF351
+	.byte	0x18
+	.byte	0x55
+	.byte	0x22
+	.long	0x16e0
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF352
+	.byte	0x18
+	.byte	0x56
+	.byte	0x23
+	.long	0x16e5
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF353
+	.byte	0x18
+	.byte	0x57
+	.byte	0x24
+	.long	0x16ea
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF354
+	.byte	0x18
+	.byte	0x58
+	.byte	0x1e
+	.long	0x16ef
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF355
+	.byte	0x18
+	.byte	0x59
+	.byte	0x9
+	.long	0x46
+	.byte	0x60
+	.byte	0
+	.uleb128 0x5
+	.long	0x10ec
+	.uleb128 0x5
+	.long	0x1278
+	.uleb128 0x5
+	.long	0x940
+	.uleb128 0x5
+	.long	0xfdc
+	.uleb128 0x6
+	.long	.LASF356
+	.byte	0x18
+	.byte	0x5a
+	.byte	0x3
+	.long	0x15f9
+	.uleb128 0xb
+	.long	0x16f4
+	.uleb128 0xf
+	.byte	0x48
+	.byte	0x19
+	.byte	0xf
+	.byte	0x9
+	.long	0x179e
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x19
+	.byte	0x11
+	.byte	0xb
+	.long	0x67d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x19
+	.byte	0x12
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0x19
+	.byte	0x13
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF357
+	.byte	0x19
+	.byte	0x14
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x19
+	.byte	0x15
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF325
+	.byte	0x19
+	.byte	0x16
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF326
+	.byte	0x19
+	.byte	0x17
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x19
+	.byte	0x18
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF358
+	.byte	0x19
+	.byte	0x19
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF329
+	.byte	0x19
+	.byte	0x1a
+	.byte	0x18
+	.long	0x15b2
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x19
+	.byte	0x1b
+	.byte	0xb
+	.long	0xfe
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF359
+	.byte	0x19
+	.byte	0x1c
+	.byte	0x3
+	.long	0x1705
+	.uleb128 0xf
+	.byte	0x28
+	.byte	0x1a
+	.byte	0x10
+	.byte	0x9
+	.long	0x17f5
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x1a
+	.byte	0x12
+	.byte	0x11
+	.long	0x610
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF328
+	.byte	0x1a
+	.byte	0x15
+	.byte	0xb
+	.long	0x181d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF360
+	.byte	0x1a
+	.byte	0x19
+	.byte	0xc
+	.long	0x1832
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF361
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0xe
+	.long	0x1846
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF362
+	.byte	0x1a
+	.byte	0x1f
+	.byte	0xc
+	.long	0x69b
+	.byte	0x20
+	.byte	0
+	.uleb128 0x1d
+	.long	0x46
+	.long	0x181d
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	0x17f5
+	.uleb128 0x26
+	.long	0x1832
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x67d
+	.byte	0
+	.uleb128 0x5
+	.long	0x1822
+	.uleb128 0x1d
+	.long	0x689
+	.long	0x1846
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x5
+	.long	0x1837
+	.uleb128 0x6
+	.long	.LASF363
+	.byte	0x1a
+	.byte	0x20
+	.byte	0x3
+	.long	0x17aa
+	.uleb128 0xb
+	.long	0x184b
+	.uleb128 0xf
+	.byte	0x10
+	.byte	0x1a
+	.byte	0x22
+	.byte	0x9
+	.long	0x1880
+	.uleb128 0x1e
+	.string	"ops"
+	.byte	0x1a
+	.byte	0x24
+	.byte	0x1b
+	.long	0x1880
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x1a
+	.byte	0x25
+	.byte	0xb
+	.long	0xfe
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x1857
+	.uleb128 0x6
+	.long	.LASF364
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x3
+	.long	0x185c
+	.uleb128 0xb
+	.long	0x1885
+	.uleb128 0xf
+	.byte	0x18
+	.byte	0x1a
+	.byte	0x28
+	.byte	0x9
+	.long	0x18ee
+	.uleb128 0x1
+	.long	.LASF340
+	.byte	0x1a
+	.byte	0x2a
+	.byte	0x1a
+	.long	0x15ed
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x1a
+	.byte	0x2b
+	.byte	0xb
+	.long	0x67d
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x1a
+	.byte	0x2c
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF347
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF348
+	.byte	0x1a
+	.byte	0x2e
+	.byte	0x9
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF346
+	.byte	0x1a
+	.byte	0x2f
+	.byte	0x9
+	.long	0x46
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF365
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x3
+	.long	0x1896
+	.uleb128 0xb
+	.long	0x18ee
+	.uleb128 0x6
+	.long	.LASF366
+	.byte	0x1b
+	.byte	0xe
+	.byte	0x10
+	.long	0x69b
+	.uleb128 0xf
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x10
+	.byte	0x9
+	.long	0x192f
+	.uleb128 0x1
+	.long	.LASF367
+	.byte	0x1b
+	.byte	0x12
+	.byte	0x16
+	.long	0x18ff
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF368
+	.byte	0x1b
+	.byte	0x13
+	.byte	0xb
+	.long	0xfe
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF369
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x3
+	.long	0x190b
+	.uleb128 0xf
+	.byte	0x40
+	.byte	0x1b
+	.byte	0x17
+	.byte	0x9
+	.long	0x1986
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x1b
+	.byte	0x19
+	.byte	0x15
+	.long	0x3ac
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF370
+	.byte	0x1b
+	.byte	0x1a
+	.byte	0x16
+	.long	0x1986
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF371
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0x9
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF372
+	.byte	0x1b
+	.byte	0x1c
+	.byte	0x9
+	.long	0x46
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF373
+	.byte	0x1b
+	.byte	0x1d
+	.byte	0x9
+	.long	0x46
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.long	0x192f
+	.uleb128 0x6
+	.long	.LASF374
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x3
+	.long	0x193b
+	.uleb128 0xf
+	.byte	0xb0
+	.byte	0x1b
+	.byte	0x20
+	.byte	0x9
+	.long	0x1a30
+	.uleb128 0x1
+	.long	.LASF375
+	.byte	0x1b
+	.byte	0x22
+	.byte	0x10
+	.long	0x1a30
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF376
+	.byte	0x1b
+	.byte	0x23
+	.byte	0x18
+	.long	0x1a3a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF346
+	.byte	0x1b
+	.byte	0x24
+	.byte	0x9
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF377
+	.byte	0x1b
+	.byte	0x25
+	.byte	0x9
+	.long	0x46
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x1b
+	.byte	0x26
+	.byte	0x15
+	.long	0x3ac
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF378
+	.byte	0x1b
+	.byte	0x27
+	.byte	0x14
+	.long	0x3f5
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF379
+	.byte	0x1b
+	.byte	0x28
+	.byte	0x14
+	.long	0x3f5
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0x1b
+	.byte	0x29
+	.byte	0x9
+	.long	0x46
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF380
+	.byte	0x1b
+	.byte	0x2a
+	.byte	0x9
+	.long	0x46
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF381
+	.byte	0x1b
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF382
+	.byte	0x1b
+	.byte	0x2c
+	.byte	0x9
+	.long	0x46
+	.byte	0xac
+	.byte	0
+	.uleb128 0x5
+	.long	0x31c
+	.uleb128 0x2a
+	.long	0x1a30
+	.uleb128 0x5
+	.long	0x198b
+	.uleb128 0x6
+	.long	.LASF383
+	.byte	0x1b
+	.byte	0x2d
+	.byte	0x3
+	.long	0x1997
+	.uleb128 0x40
+	.byte	0xc0
+	.byte	0x40
+	.byte	0x1c
+	.byte	0x12
+	.byte	0x9
+	.long	0x1aa4
+	.uleb128 0x1
+	.long	.LASF384
+	.byte	0x1c
+	.byte	0x14
+	.byte	0x14
+	.long	0x746
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF385
+	.byte	0x1c
+	.byte	0x15
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF371
+	.byte	0x1c
+	.byte	0x16
+	.byte	0x12
+	.long	0x7d
+	.byte	0x10
+	.uleb128 0x2e
+	.long	.LASF372
+	.byte	0x1c
+	.byte	0x17
+	.byte	0x12
+	.long	0x7d
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF386
+	.byte	0x1c
+	.byte	0x18
+	.byte	0x9
+	.long	0x46
+	.byte	0x44
+	.uleb128 0x2e
+	.long	.LASF387
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x12
+	.long	0x7d
+	.byte	0x80
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF410
+	.byte	0x1c
+	.byte	0x1a
+	.long	0x1a4b
+	.byte	0x40
+	.uleb128 0x1f
+	.value	0x2f0
+	.byte	0x1
+	.byte	0x1c
+	.long	0x1c05
+	.uleb128 0x1
+	.long	.LASF388
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x12
+	.long	0x15ad
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF389
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x11
+	.long	0x1885
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF352
+	.byte	0x1
+	.byte	0x20
+	.byte	0x15
+	.long	0x1c05
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF354
+	.byte	0x1
+	.byte	0x21
+	.byte	0x10
+	.long	0x1c0a
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF390
+	.byte	0x1
+	.byte	0x22
+	.byte	0x14
+	.long	0xf76
+	.byte	0x28
+	.uleb128 0xd
+	.long	.LASF343
+	.byte	0x1
+	.byte	0x23
+	.byte	0x11
+	.long	0x610
+	.value	0x268
+	.uleb128 0xd
+	.long	.LASF391
+	.byte	0x1
+	.byte	0x24
+	.byte	0x9
+	.long	0x46
+	.value	0x270
+	.uleb128 0xd
+	.long	.LASF392
+	.byte	0x1
+	.byte	0x25
+	.byte	0x9
+	.long	0x46
+	.value	0x274
+	.uleb128 0xd
+	.long	.LASF393
+	.byte	0x1
+	.byte	0x26
+	.byte	0xb
+	.long	0x11d
+	.value	0x278
+	.uleb128 0xd
+	.long	.LASF394
+	.byte	0x1
+	.byte	0x27
+	.byte	0x9
+	.long	0x46
+	.value	0x280
+	.uleb128 0xd
+	.long	.LASF261
+	.byte	0x1
+	.byte	0x28
+	.byte	0x9
+	.long	0x46
+	.value	0x284
+	.uleb128 0xd
+	.long	.LASF395
+	.byte	0x1
+	.byte	0x29
+	.byte	0x9
+	.long	0x46
+	.value	0x288
+	.uleb128 0xd
+	.long	.LASF396
+	.byte	0x1
+	.byte	0x2a
+	.byte	0xa
+	.long	0x52
+	.value	0x290
+	.uleb128 0xd
+	.long	.LASF397
+	.byte	0x1
+	.byte	0x2b
+	.byte	0xa
+	.long	0x52
+	.value	0x298
+	.uleb128 0xd
+	.long	.LASF353
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x24
+	.long	0x16ea
+	.value	0x2a0
+	.uleb128 0xd
+	.long	.LASF398
+	.byte	0x1
+	.byte	0x2d
+	.byte	0xa
+	.long	0x52
+	.value	0x2a8
+	.uleb128 0xd
+	.long	.LASF399
+	.byte	0x1
+	.byte	0x2e
+	.byte	0xa
+	.long	0x52
+	.value	0x2b0
+	.uleb128 0xd
+	.long	.LASF400
+	.byte	0x1
+	.byte	0x2f
+	.byte	0xa
+	.long	0x52
+	.value	0x2b8
+	.uleb128 0xd
+	.long	.LASF401
+	.byte	0x1
+	.byte	0x30
+	.byte	0x9
+	.long	0x46
+	.value	0x2c0
+	.uleb128 0xd
+	.long	.LASF299
+	.byte	0x1
+	.byte	0x31
+	.byte	0xc
+	.long	0x8e0
+	.value	0x2c8
+	.uleb128 0xd
+	.long	.LASF358
+	.byte	0x1
+	.byte	0x32
+	.byte	0xc
+	.long	0x8e0
+	.value	0x2d0
+	.uleb128 0xd
+	.long	.LASF207
+	.byte	0x1
+	.byte	0x33
+	.byte	0xc
+	.long	0x8e0
+	.value	0x2d8
+	.uleb128 0xd
+	.long	.LASF262
+	.byte	0x1
+	.byte	0x34
+	.byte	0xc
+	.long	0x8e0
+	.value	0x2e0
+	.uleb128 0xd
+	.long	.LASF402
+	.byte	0x1
+	.byte	0x35
+	.byte	0x11
+	.long	0x1c0f
+	.value	0x2e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x1398
+	.uleb128 0x5
+	.long	0x1084
+	.uleb128 0x5
+	.long	0x1aa4
+	.uleb128 0x6
+	.long	.LASF403
+	.byte	0x1
+	.byte	0x36
+	.byte	0x3
+	.long	0x1ab0
+	.uleb128 0xb
+	.long	0x1c14
+	.uleb128 0x1f
+	.value	0x4004
+	.byte	0x1
+	.byte	0x39
+	.long	0x1c49
+	.uleb128 0x1
+	.long	.LASF373
+	.byte	0x1
+	.byte	0x3b
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF299
+	.byte	0x1
+	.byte	0x3c
+	.byte	0xb
+	.long	0x1c49
+	.byte	0x4
+	.byte	0
+	.uleb128 0x12
+	.long	0x67d
+	.long	0x1c5a
+	.uleb128 0x2d
+	.long	0x3f
+	.value	0xfff
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF404
+	.byte	0x1
+	.byte	0x3d
+	.byte	0x3
+	.long	0x1c25
+	.uleb128 0xb
+	.long	0x1c5a
+	.uleb128 0x1f
+	.value	0xc004
+	.byte	0x1
+	.byte	0x40
+	.long	0x1c8f
+	.uleb128 0x1
+	.long	.LASF373
+	.byte	0x1
+	.byte	0x42
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF262
+	.byte	0x1
+	.byte	0x43
+	.byte	0xb
+	.long	0x1c8f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x12
+	.long	0x67d
+	.long	0x1ca0
+	.uleb128 0x2d
+	.long	0x3f
+	.value	0x2fff
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF405
+	.byte	0x1
+	.byte	0x44
+	.byte	0x3
+	.long	0x1c6b
+	.uleb128 0xb
+	.long	0x1ca0
+	.uleb128 0x41
+	.value	0x200
+	.byte	0x40
+	.byte	0x1
+	.byte	0x47
+	.byte	0x9
+	.long	0x1d1d
+	.uleb128 0x1
+	.long	.LASF406
+	.byte	0x1
+	.byte	0x49
+	.byte	0x15
+	.long	0x1d1d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF407
+	.byte	0x1
+	.byte	0x4a
+	.byte	0x19
+	.long	0x1d22
+	.byte	0x8
+	.uleb128 0x2e
+	.long	.LASF408
+	.byte	0x1
+	.byte	0x4b
+	.byte	0x10
+	.long	0x1aa4
+	.byte	0x40
+	.uleb128 0x42
+	.long	.LASF358
+	.byte	0x1
+	.byte	0x4c
+	.byte	0x10
+	.long	0x1aa4
+	.byte	0x40
+	.value	0x100
+	.uleb128 0xd
+	.long	.LASF214
+	.byte	0x1
+	.byte	0x4d
+	.byte	0x9
+	.long	0x46
+	.value	0x1c0
+	.uleb128 0xd
+	.long	.LASF409
+	.byte	0x1
+	.byte	0x4e
+	.byte	0x9
+	.long	0x46
+	.value	0x1c4
+	.uleb128 0xd
+	.long	.LASF355
+	.byte	0x1
+	.byte	0x4f
+	.byte	0x9
+	.long	0x46
+	.value	0x1c8
+	.byte	0
+	.uleb128 0x5
+	.long	0xecd
+	.uleb128 0x5
+	.long	0x1c14
+	.uleb128 0x32
+	.long	.LASF411
+	.byte	0x1
+	.byte	0x50
+	.long	0x1cb1
+	.byte	0x40
+	.uleb128 0xf
+	.byte	0x18
+	.byte	0x1
+	.byte	0x52
+	.byte	0x9
+	.long	0x1d71
+	.uleb128 0x1
+	.long	.LASF407
+	.byte	0x1
+	.byte	0x54
+	.byte	0x19
+	.long	0x1d22
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF408
+	.byte	0x1
+	.byte	0x55
+	.byte	0x12
+	.long	0xa06
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF357
+	.byte	0x1
+	.byte	0x56
+	.byte	0x9
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF373
+	.byte	0x1
+	.byte	0x57
+	.byte	0x9
+	.long	0x46
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF412
+	.byte	0x1
+	.byte	0x58
+	.byte	0x3
+	.long	0x1d33
+	.uleb128 0xf
+	.byte	0x48
+	.byte	0x1
+	.byte	0x5b
+	.byte	0x9
+	.long	0x1dfc
+	.uleb128 0x1
+	.long	.LASF407
+	.byte	0x1
+	.byte	0x5d
+	.byte	0x19
+	.long	0x1d22
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF408
+	.byte	0x1
+	.byte	0x5e
+	.byte	0x12
+	.long	0xa06
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF413
+	.byte	0x1
+	.byte	0x5f
+	.byte	0x12
+	.long	0xa06
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF358
+	.byte	0x1
+	.byte	0x60
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x1
+	.byte	0x61
+	.byte	0xc
+	.long	0x8e0
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF373
+	.byte	0x1
+	.byte	0x62
+	.byte	0xa
+	.long	0x52
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF414
+	.byte	0x1
+	.byte	0x63
+	.byte	0xa
+	.long	0x52
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF351
+	.byte	0x1
+	.byte	0x64
+	.byte	0x14
+	.long	0x1dfc
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF401
+	.byte	0x1
+	.byte	0x65
+	.byte	0x9
+	.long	0x46
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.long	0x118d
+	.uleb128 0x6
+	.long	.LASF415
+	.byte	0x1
+	.byte	0x66
+	.byte	0x3
+	.long	0x1d7d
+	.uleb128 0xf
+	.byte	0x28
+	.byte	0x1
+	.byte	0x68
+	.byte	0x9
+	.long	0x1e65
+	.uleb128 0x1
+	.long	.LASF416
+	.byte	0x1
+	.byte	0x6a
+	.byte	0x18
+	.long	0x1e65
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF417
+	.byte	0x1
+	.byte	0x6b
+	.byte	0x11
+	.long	0x610
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF253
+	.byte	0x1
+	.byte	0x6c
+	.byte	0x24
+	.long	0x1e6a
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF418
+	.byte	0x1
+	.byte	0x6d
+	.byte	0xa
+	.long	0x1e6f
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF419
+	.byte	0x1
+	.byte	0x6e
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF401
+	.byte	0x1
+	.byte	0x6f
+	.byte	0x9
+	.long	0x46
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.long	0x1499
+	.uleb128 0x5
+	.long	0x1700
+	.uleb128 0x5
+	.long	0x46
+	.uleb128 0x6
+	.long	.LASF420
+	.byte	0x1
+	.byte	0x70
+	.byte	0x3
+	.long	0x1e0d
+	.uleb128 0x12
+	.long	0x157b
+	.long	0x1e90
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x5
+	.byte	0
+	.uleb128 0xb
+	.long	0x1e80
+	.uleb128 0x3
+	.long	.LASF421
+	.value	0x11d
+	.byte	0x26
+	.long	0x1e90
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsFilterProcessBlocks
+	.uleb128 0x12
+	.long	0x615
+	.long	0x1ebb
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x5
+	.byte	0
+	.uleb128 0xb
+	.long	0x1eab
+	.uleb128 0x3
+	.long	.LASF422
+	.value	0x127
+	.byte	0x1a
+	.long	0x1ebb
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsFilterVariantNames
+	.uleb128 0x10
+	.long	.LASF423
+	.byte	0x1b
+	.byte	0x4a
+	.long	0x1ee7
+	.uleb128 0x2
+	.long	0x1ee7
+	.byte	0
+	.uleb128 0x5
+	.long	0x1a3f
+	.uleb128 0x10
+	.long	.LASF424
+	.byte	0x1b
+	.byte	0x44
+	.long	0x1efd
+	.uleb128 0x2
+	.long	0x1ee7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF425
+	.byte	0x1b
+	.byte	0x3e
+	.byte	0x5
+	.long	0x46
+	.long	0x1f1d
+	.uleb128 0x2
+	.long	0x1ee7
+	.uleb128 0x2
+	.long	0x18ff
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF426
+	.byte	0x1b
+	.byte	0x35
+	.byte	0x5
+	.long	0x46
+	.long	0x1f38
+	.uleb128 0x2
+	.long	0x1ee7
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF427
+	.byte	0xe
+	.byte	0x36
+	.byte	0x10
+	.long	0x704
+	.long	0x1f4e
+	.uleb128 0x2
+	.long	0x1f4e
+	.byte	0
+	.uleb128 0x5
+	.long	0x74b
+	.uleb128 0x10
+	.long	.LASF428
+	.byte	0xe
+	.byte	0x2f
+	.long	0x1f6e
+	.uleb128 0x2
+	.long	0x1f4e
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF429
+	.byte	0x19
+	.byte	0x3a
+	.long	0x1f7f
+	.uleb128 0x2
+	.long	0x1f7f
+	.byte	0
+	.uleb128 0x5
+	.long	0x179e
+	.uleb128 0x9
+	.long	.LASF430
+	.byte	0x19
+	.byte	0x46
+	.byte	0x5
+	.long	0x46
+	.long	0x1fb3
+	.uleb128 0x2
+	.long	0x1f7f
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF431
+	.byte	0x19
+	.byte	0x34
+	.long	0x1fc9
+	.uleb128 0x2
+	.long	0x1f7f
+	.uleb128 0x2
+	.long	0xa06
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF432
+	.byte	0x1d
+	.value	0x22c
+	.byte	0xe
+	.long	0xfe
+	.long	0x1fe5
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF433
+	.byte	0x19
+	.byte	0x2d
+	.long	0x1ff6
+	.uleb128 0x2
+	.long	0x1f7f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF434
+	.byte	0x19
+	.byte	0x27
+	.byte	0x5
+	.long	0x46
+	.long	0x201b
+	.uleb128 0x2
+	.long	0x1f7f
+	.uleb128 0x2
+	.long	0x67d
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF435
+	.byte	0x16
+	.byte	0x5f
+	.long	0x202c
+	.uleb128 0x2
+	.long	0x202c
+	.byte	0
+	.uleb128 0x5
+	.long	0x121c
+	.uleb128 0x10
+	.long	.LASF436
+	.byte	0x16
+	.byte	0x59
+	.long	0x2047
+	.uleb128 0x2
+	.long	0x2047
+	.uleb128 0x2
+	.long	0x204c
+	.byte	0
+	.uleb128 0x5
+	.long	0x1199
+	.uleb128 0x5
+	.long	0x1210
+	.uleb128 0x9
+	.long	.LASF437
+	.byte	0x16
+	.byte	0x3d
+	.byte	0x5
+	.long	0x46
+	.long	0x206c
+	.uleb128 0x2
+	.long	0x1dfc
+	.uleb128 0x2
+	.long	0x16e0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF438
+	.byte	0x16
+	.byte	0x51
+	.long	0x2082
+	.uleb128 0x2
+	.long	0x1dfc
+	.uleb128 0x2
+	.long	0x1dc
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF477
+	.byte	0x16
+	.byte	0x4a
+	.byte	0x14
+	.long	0x1dc
+	.uleb128 0x20
+	.long	.LASF439
+	.byte	0x1e
+	.value	0x143
+	.byte	0xc
+	.long	0x46
+	.long	0x20b4
+	.uleb128 0x2
+	.long	0x146
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x20b4
+	.uleb128 0x2
+	.long	0x20b9
+	.byte	0
+	.uleb128 0x5
+	.long	0x192
+	.uleb128 0x5
+	.long	0x16a
+	.uleb128 0x20
+	.long	.LASF440
+	.byte	0x1e
+	.value	0x120
+	.byte	0xc
+	.long	0x46
+	.long	0x20da
+	.uleb128 0x2
+	.long	0x146
+	.uleb128 0x2
+	.long	0x20b9
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF441
+	.byte	0x16
+	.byte	0x44
+	.long	0x20eb
+	.uleb128 0x2
+	.long	0x16e0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF442
+	.byte	0x1d
+	.value	0x234
+	.byte	0xe
+	.long	0xfe
+	.long	0x2107
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF443
+	.byte	0x14
+	.byte	0x83
+	.byte	0x5
+	.long	0x46
+	.long	0x211d
+	.uleb128 0x2
+	.long	0x1d1d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF444
+	.byte	0x14
+	.byte	0x6c
+	.byte	0x5
+	.long	0x46
+	.long	0x2142
+	.uleb128 0x2
+	.long	0x1d1d
+	.uleb128 0x2
+	.long	0x610
+	.uleb128 0x2
+	.long	0xdb3
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF445
+	.byte	0x1f
+	.byte	0xdb
+	.byte	0xc
+	.long	0x46
+	.long	0x215d
+	.uleb128 0x2
+	.long	0x31c
+	.uleb128 0x2
+	.long	0x215d
+	.byte	0
+	.uleb128 0x5
+	.long	0xfe
+	.uleb128 0x9
+	.long	.LASF446
+	.byte	0x1f
+	.byte	0xca
+	.byte	0xc
+	.long	0x46
+	.long	0x2187
+	.uleb128 0x2
+	.long	0x1a35
+	.uleb128 0x2
+	.long	0x218c
+	.uleb128 0x2
+	.long	0x2191
+	.uleb128 0x2
+	.long	0x100
+	.byte	0
+	.uleb128 0x5
+	.long	0x36a
+	.uleb128 0x2a
+	.long	0x2187
+	.uleb128 0x5
+	.long	0x2196
+	.uleb128 0x1d
+	.long	0xfe
+	.long	0x21a5
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF447
+	.byte	0x1c
+	.byte	0x29
+	.long	0x21b6
+	.uleb128 0x2
+	.long	0x1c0f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF448
+	.byte	0x1c
+	.byte	0x23
+	.byte	0x5
+	.long	0x46
+	.long	0x21d6
+	.uleb128 0x2
+	.long	0x1c0f
+	.uleb128 0x2
+	.long	0x7d
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF449
+	.byte	0x1c
+	.byte	0x43
+	.byte	0x7
+	.long	0xfe
+	.long	0x21ec
+	.uleb128 0x2
+	.long	0x1c0f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF450
+	.byte	0x1c
+	.byte	0x49
+	.long	0x21fd
+	.uleb128 0x2
+	.long	0x1c0f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF451
+	.byte	0x1c
+	.byte	0x3c
+	.long	0x220e
+	.uleb128 0x2
+	.long	0x1c0f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF452
+	.byte	0x14
+	.byte	0x75
+	.byte	0x5
+	.long	0x46
+	.long	0x222e
+	.uleb128 0x2
+	.long	0x1d1d
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF453
+	.byte	0x20
+	.byte	0xe6
+	.byte	0xc
+	.long	0x46
+	.long	0x2244
+	.uleb128 0x2
+	.long	0x5fa
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF454
+	.byte	0x14
+	.byte	0x7c
+	.byte	0x5
+	.long	0x46
+	.long	0x225a
+	.uleb128 0x2
+	.long	0x225a
+	.byte	0
+	.uleb128 0x5
+	.long	0xed9
+	.uleb128 0x10
+	.long	.LASF455
+	.byte	0x1a
+	.byte	0x40
+	.long	0x2270
+	.uleb128 0x2
+	.long	0x2270
+	.byte	0
+	.uleb128 0x5
+	.long	0x1885
+	.uleb128 0x10
+	.long	.LASF456
+	.byte	0x15
+	.byte	0x3f
+	.long	0x2286
+	.uleb128 0x2
+	.long	0x1c0a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF457
+	.byte	0x15
+	.byte	0x4f
+	.byte	0x5
+	.long	0x46
+	.long	0x22a1
+	.uleb128 0x2
+	.long	0x22a1
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x5
+	.long	0x1090
+	.uleb128 0x10
+	.long	.LASF458
+	.byte	0x17
+	.byte	0x85
+	.long	0x22bc
+	.uleb128 0x2
+	.long	0x22bc
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x5
+	.long	0x1441
+	.uleb128 0x10
+	.long	.LASF459
+	.byte	0x17
+	.byte	0x7e
+	.long	0x22d7
+	.uleb128 0x2
+	.long	0x22d7
+	.uleb128 0x2
+	.long	0x22dc
+	.byte	0
+	.uleb128 0x5
+	.long	0x13a4
+	.uleb128 0x5
+	.long	0x1435
+	.uleb128 0x9
+	.long	.LASF460
+	.byte	0x14
+	.byte	0xb4
+	.byte	0x5
+	.long	0x46
+	.long	0x22f7
+	.uleb128 0x2
+	.long	0x22f7
+	.byte	0
+	.uleb128 0x5
+	.long	0xf76
+	.uleb128 0x9
+	.long	.LASF461
+	.byte	0x21
+	.byte	0x2f
+	.byte	0xe
+	.long	0xfe
+	.long	0x231c
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x411
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF462
+	.byte	0x10
+	.byte	0x63
+	.byte	0x5
+	.long	0x46
+	.long	0x2337
+	.uleb128 0x2
+	.long	0x2337
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x5
+	.long	0x8e5
+	.uleb128 0x33
+	.long	.LASF463
+	.byte	0x20
+	.value	0x324
+	.long	0x234e
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF464
+	.byte	0x14
+	.byte	0x99
+	.byte	0x5
+	.long	0x46
+	.long	0x236e
+	.uleb128 0x2
+	.long	0x22f7
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF465
+	.byte	0x1c
+	.byte	0x36
+	.long	0x237f
+	.uleb128 0x2
+	.long	0x1c0f
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF466
+	.byte	0x15
+	.byte	0x47
+	.long	0x239a
+	.uleb128 0x2
+	.long	0x1c0a
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF467
+	.byte	0x1c
+	.byte	0x30
+	.byte	0x7
+	.long	0xfe
+	.long	0x23b0
+	.uleb128 0x2
+	.long	0x1c0f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF468
+	.byte	0x17
+	.byte	0x77
+	.byte	0xd
+	.long	0x610
+	.long	0x23c6
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF469
+	.byte	0x17
+	.byte	0x70
+	.byte	0x5
+	.long	0x46
+	.long	0x23e1
+	.uleb128 0x2
+	.long	0x1c05
+	.uleb128 0x2
+	.long	0x689
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF470
+	.byte	0x1a
+	.byte	0x5c
+	.byte	0x8
+	.long	0x689
+	.long	0x23f7
+	.uleb128 0x2
+	.long	0x23f7
+	.byte	0
+	.uleb128 0x5
+	.long	0x1891
+	.uleb128 0x9
+	.long	.LASF471
+	.byte	0x17
+	.byte	0x68
+	.byte	0x5
+	.long	0x46
+	.long	0x2412
+	.uleb128 0x2
+	.long	0x22d7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF472
+	.byte	0x17
+	.byte	0x61
+	.byte	0x5
+	.long	0x46
+	.long	0x2437
+	.uleb128 0x2
+	.long	0x1c05
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF473
+	.byte	0x1a
+	.byte	0x54
+	.long	0x244d
+	.uleb128 0x2
+	.long	0x23f7
+	.uleb128 0x2
+	.long	0x67d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF474
+	.byte	0x1a
+	.byte	0x4c
+	.byte	0x5
+	.long	0x46
+	.long	0x247c
+	.uleb128 0x2
+	.long	0x23f7
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0xa06
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x8e0
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF475
+	.byte	0x14
+	.byte	0x8f
+	.byte	0x5
+	.long	0x46
+	.long	0x24a6
+	.uleb128 0x2
+	.long	0x22f7
+	.uleb128 0x2
+	.long	0x610
+	.uleb128 0x2
+	.long	0xdb3
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x7d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF476
+	.byte	0x15
+	.byte	0x39
+	.byte	0x5
+	.long	0x46
+	.long	0x24cb
+	.uleb128 0x2
+	.long	0x1c0a
+	.uleb128 0x2
+	.long	0x16ef
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x107a
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF478
+	.byte	0x15
+	.byte	0x65
+	.byte	0x14
+	.long	0x107a
+	.uleb128 0x9
+	.long	.LASF479
+	.byte	0x17
+	.byte	0x57
+	.byte	0x5
+	.long	0x46
+	.long	0x24f7
+	.uleb128 0x2
+	.long	0x1c05
+	.uleb128 0x2
+	.long	0x16e5
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF480
+	.byte	0x1a
+	.byte	0x3a
+	.byte	0x5
+	.long	0x46
+	.long	0x2517
+	.uleb128 0x2
+	.long	0x2270
+	.uleb128 0x2
+	.long	0x2517
+	.uleb128 0x2
+	.long	0x15ad
+	.byte	0
+	.uleb128 0x5
+	.long	0x18fa
+	.uleb128 0x33
+	.long	.LASF481
+	.byte	0x1d
+	.value	0x238
+	.long	0x252e
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF482
+	.byte	0x21
+	.byte	0x95
+	.byte	0xe
+	.long	0x11d
+	.long	0x2549
+	.uleb128 0x2
+	.long	0x11d
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF483
+	.byte	0x21
+	.byte	0x8d
+	.byte	0xe
+	.long	0x11d
+	.long	0x2564
+	.uleb128 0x2
+	.long	0x11d
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF484
+	.byte	0x1d
+	.value	0x229
+	.byte	0xe
+	.long	0xfe
+	.long	0x257b
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF485
+	.byte	0x21
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0x2592
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF486
+	.byte	0x20
+	.value	0x17a
+	.byte	0xc
+	.long	0x46
+	.long	0x25b4
+	.uleb128 0x2
+	.long	0x11d
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x610
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF487
+	.byte	0x1d
+	.byte	0x66
+	.byte	0xf
+	.long	0x689
+	.long	0x25ca
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF488
+	.byte	0x1d
+	.byte	0x69
+	.byte	0xc
+	.long	0x46
+	.long	0x25e0
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF489
+	.byte	0x11
+	.byte	0x4f
+	.byte	0x23
+	.long	0x25ec
+	.uleb128 0x5
+	.long	0x60b
+	.uleb128 0x9
+	.long	.LASF490
+	.byte	0x21
+	.byte	0x9c
+	.byte	0xc
+	.long	0x46
+	.long	0x260c
+	.uleb128 0x2
+	.long	0x610
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF491
+	.byte	0x10
+	.byte	0x69
+	.long	0x261d
+	.uleb128 0x2
+	.long	0x2337
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF492
+	.byte	0x10
+	.byte	0x5b
+	.byte	0x5
+	.long	0x46
+	.long	0x2638
+	.uleb128 0x2
+	.long	0x2337
+	.uleb128 0x2
+	.long	0x610
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF493
+	.byte	0x21
+	.byte	0x2b
+	.byte	0xe
+	.long	0xfe
+	.long	0x2658
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x411
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF494
+	.byte	0x10
+	.byte	0x52
+	.byte	0x8
+	.long	0x8e0
+	.long	0x2673
+	.uleb128 0x2
+	.long	0x2673
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	0x8f1
+	.uleb128 0x9
+	.long	.LASF495
+	.byte	0x10
+	.byte	0x4a
+	.byte	0x5
+	.long	0x46
+	.long	0x269d
+	.uleb128 0x2
+	.long	0x2337
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF496
+	.byte	0x20
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0x26b5
+	.uleb128 0x2
+	.long	0x610
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF497
+	.byte	0x21
+	.byte	0x3d
+	.byte	0xe
+	.long	0xfe
+	.long	0x26d5
+	.uleb128 0x2
+	.long	0xfe
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF498
+	.byte	0x12
+	.byte	0x47
+	.byte	0x14
+	.long	0x15b2
+	.uleb128 0x27
+	.long	.LASF499
+	.byte	0xe
+	.byte	0x27
+	.byte	0x17
+	.long	0x26ed
+	.uleb128 0x5
+	.long	0x710
+	.uleb128 0x9
+	.long	.LASF500
+	.byte	0xe
+	.byte	0x43
+	.byte	0x8
+	.long	0x2e
+	.long	0x2708
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF505
+	.value	0x976
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB65
+	.quad	.LFE65-.LFB65
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x27fb
+	.uleb128 0x4
+	.long	.LASF416
+	.value	0x976
+	.byte	0x2e
+	.long	0x1e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.uleb128 0x4
+	.long	.LASF501
+	.value	0x976
+	.byte	0x4c
+	.long	0x107a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x4
+	.long	.LASF419
+	.value	0x976
+	.byte	0x60
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -372
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x977
+	.byte	0x3a
+	.long	0x1e6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x979
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.long	.LASF503
+	.value	0x97a
+	.byte	0x12
+	.long	0x1a3f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x3
+	.long	.LASF418
+	.value	0x97b
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -244
+	.uleb128 0x3
+	.long	.LASF504
+	.value	0x985
+	.byte	0x1d
+	.long	0x16f4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x3
+	.long	.LASF370
+	.value	0x98c
+	.byte	0x19
+	.long	0x27fb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x13
+	.quad	.LBB128
+	.quad	.LBE128-.LBB128
+	.long	0x27db
+	.uleb128 0xc
+	.string	"i"
+	.value	0x99d
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB129
+	.quad	.LBE129-.LBB129
+	.uleb128 0xc
+	.string	"i"
+	.value	0x9b1
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1e74
+	.uleb128 0x16
+	.long	.LASF528
+	.value	0x962
+	.quad	.LFB64
+	.quad	.LFE64-.LFB64
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x285a
+	.uleb128 0x4
+	.long	.LASF368
+	.value	0x962
+	.byte	0x26
+	.long	0xfe
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xc
+	.string	"job"
+	.value	0x964
+	.byte	0x19
+	.long	0x27fb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF388
+	.value	0x965
+	.byte	0x12
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF212
+	.value	0x96e
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF506
+	.value	0x89e
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB63
+	.quad	.LFE63-.LFB63
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ac1
+	.uleb128 0x4
+	.long	.LASF416
+	.value	0x89e
+	.byte	0x38
+	.long	0x1e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1096
+	.uleb128 0x4
+	.long	.LASF417
+	.value	0x89e
+	.byte	0x4f
+	.long	0x610
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1104
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x89f
+	.byte	0x44
+	.long	0x1e6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1112
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x8a1
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.long	.LASF406
+	.value	0x8a2
+	.byte	0x14
+	.long	0xecd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -784
+	.uleb128 0x3
+	.long	.LASF503
+	.value	0x8a3
+	.byte	0x12
+	.long	0x1a3f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -960
+	.uleb128 0x3
+	.long	.LASF129
+	.value	0x8c1
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF342
+	.value	0x8c2
+	.byte	0x1a
+	.long	0xdbf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x3
+	.long	.LASF353
+	.value	0x8c5
+	.byte	0x15
+	.long	0x8e5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1008
+	.uleb128 0x3
+	.long	.LASF507
+	.value	0x8cd
+	.byte	0x1b
+	.long	0x26ed
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.long	.LASF508
+	.value	0x8ce
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x3
+	.long	.LASF509
+	.value	0x8cf
+	.byte	0xb
+	.long	0xfe
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x3
+	.long	.LASF510
+	.value	0x8d0
+	.byte	0x10
+	.long	0x74b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1040
+	.uleb128 0x3
+	.long	.LASF511
+	.value	0x8d2
+	.byte	0x1a
+	.long	0x710
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1072
+	.uleb128 0x3
+	.long	.LASF225
+	.value	0x8d4
+	.byte	0x19
+	.long	0x1d22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x3
+	.long	.LASF370
+	.value	0x8d5
+	.byte	0x1c
+	.long	0x2ac1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x3
+	.long	.LASF262
+	.value	0x8d6
+	.byte	0xc
+	.long	0x2ac6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1088
+	.uleb128 0x3
+	.long	.LASF512
+	.value	0x8df
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x13
+	.quad	.LBB119
+	.quad	.LBE119-.LBB119
+	.long	0x29d0
+	.uleb128 0x3
+	.long	.LASF388
+	.value	0x8e2
+	.byte	0x16
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x3
+	.long	.LASF513
+	.value	0x8e3
+	.byte	0xf
+	.long	0x11d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB120
+	.quad	.LBE120-.LBB120
+	.long	0x2a39
+	.uleb128 0x3
+	.long	.LASF514
+	.value	0x906
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x3
+	.long	.LASF373
+	.value	0x907
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x23
+	.long	.LLRL8
+	.uleb128 0x3
+	.long	.LASF515
+	.value	0x918
+	.byte	0x11
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -140
+	.uleb128 0xe
+	.quad	.LBB122
+	.quad	.LBE122-.LBB122
+	.uleb128 0xc
+	.string	"c"
+	.value	0x90a
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB124
+	.quad	.LBE124-.LBB124
+	.long	0x2aa0
+	.uleb128 0x3
+	.long	.LASF516
+	.value	0x92d
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x13
+	.quad	.LBB125
+	.quad	.LBE125-.LBB125
+	.long	0x2a80
+	.uleb128 0xc
+	.string	"c"
+	.value	0x92e
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB126
+	.quad	.LBE126-.LBB126
+	.uleb128 0xc
+	.string	"c"
+	.value	0x938
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB127
+	.quad	.LBE127-.LBB127
+	.uleb128 0xc
+	.string	"c"
+	.value	0x942
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1d71
+	.uleb128 0x12
+	.long	0x8e0
+	.long	0x2ad6
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF523
+	.value	0x7d5
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB62
+	.quad	.LFE62-.LFB62
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e1e
+	.uleb128 0x4
+	.long	.LASF416
+	.value	0x7d5
+	.byte	0x43
+	.long	0x1e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -968
+	.uleb128 0x4
+	.long	.LASF417
+	.value	0x7d5
+	.byte	0x5a
+	.long	0x610
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -976
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x7d6
+	.byte	0x4f
+	.long	0x1e6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -984
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x7d8
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF406
+	.value	0x7d9
+	.byte	0x14
+	.long	0xecd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -832
+	.uleb128 0x3
+	.long	.LASF517
+	.value	0x7da
+	.byte	0x15
+	.long	0x179e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -912
+	.uleb128 0x3
+	.long	.LASF129
+	.value	0x7e0
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.long	.LASF394
+	.value	0x7e1
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x3
+	.long	.LASF371
+	.value	0x7e2
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x3
+	.long	.LASF342
+	.value	0x7e3
+	.byte	0x1a
+	.long	0xdbf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x3
+	.long	.LASF353
+	.value	0x7ed
+	.byte	0x15
+	.long	0x8e5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -960
+	.uleb128 0x3
+	.long	.LASF518
+	.value	0x801
+	.byte	0x15
+	.long	0x22f7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x3
+	.long	.LASF299
+	.value	0x802
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x3
+	.long	.LASF358
+	.value	0x803
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x3
+	.long	.LASF207
+	.value	0x804
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x3
+	.long	.LASF262
+	.value	0x805
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x3
+	.long	.LASF512
+	.value	0x80c
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF397
+	.value	0x824
+	.byte	0xa
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF519
+	.value	0x825
+	.byte	0xa
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF261
+	.value	0x826
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x3
+	.long	.LASF520
+	.value	0x827
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF395
+	.value	0x828
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x13
+	.quad	.LBB102
+	.quad	.LBE102-.LBB102
+	.long	0x2cb5
+	.uleb128 0xc
+	.string	"c"
+	.value	0x7f6
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xe
+	.quad	.LBB103
+	.quad	.LBE103-.LBB103
+	.uleb128 0xc
+	.string	"row"
+	.value	0x7f8
+	.byte	0x1a
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0xe
+	.quad	.LBB104
+	.quad	.LBE104-.LBB104
+	.uleb128 0xc
+	.string	"k"
+	.value	0x7f9
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LLRL5
+	.long	0x2ccf
+	.uleb128 0x3
+	.long	.LASF513
+	.value	0x80f
+	.byte	0xf
+	.long	0x11d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0
+	.uleb128 0x2f
+	.long	.LLRL6
+	.long	0x2d97
+	.uleb128 0x3
+	.long	.LASF373
+	.value	0x82b
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -164
+	.uleb128 0x3
+	.long	.LASF521
+	.value	0x840
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -172
+	.uleb128 0x2f
+	.long	.LLRL7
+	.long	0x2d12
+	.uleb128 0x3
+	.long	.LASF522
+	.value	0x83a
+	.byte	0x11
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB109
+	.quad	.LBE109-.LBB109
+	.long	0x2d35
+	.uleb128 0xc
+	.string	"i"
+	.value	0x847
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB110
+	.quad	.LBE110-.LBB110
+	.uleb128 0xc
+	.string	"c"
+	.value	0x854
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xe
+	.quad	.LBB111
+	.quad	.LBE111-.LBB111
+	.uleb128 0xc
+	.string	"i"
+	.value	0x856
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xe
+	.quad	.LBB112
+	.quad	.LBE112-.LBB112
+	.uleb128 0xc
+	.string	"at"
+	.value	0x858
+	.byte	0x1e
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB115
+	.quad	.LBE115-.LBB115
+	.long	0x2dfd
+	.uleb128 0xc
+	.string	"c"
+	.value	0x877
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0xe
+	.quad	.LBB116
+	.quad	.LBE116-.LBB116
+	.uleb128 0xc
+	.string	"row"
+	.value	0x879
+	.byte	0x18
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0xe
+	.quad	.LBB117
+	.quad	.LBE117-.LBB117
+	.uleb128 0xc
+	.string	"k"
+	.value	0x87a
+	.byte	0x1a
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB118
+	.quad	.LBE118-.LBB118
+	.uleb128 0xc
+	.string	"c"
+	.value	0x889
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF524
+	.value	0x7c3
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB61
+	.quad	.LFE61-.LFB61
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e7d
+	.uleb128 0x4
+	.long	.LASF353
+	.value	0x7c3
+	.byte	0x40
+	.long	0x2337
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF416
+	.value	0x7c3
+	.byte	0x5f
+	.long	0x1e65
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF129
+	.value	0x7c4
+	.byte	0x33
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x4
+	.long	.LASF137
+	.value	0x7c4
+	.byte	0x47
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x43
+	.long	.LASF525
+	.byte	0x1
+	.value	0x7b6
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB60
+	.quad	.LFE60-.LFB60
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ebf
+	.uleb128 0x4
+	.long	.LASF353
+	.value	0x7b6
+	.byte	0x3a
+	.long	0x2673
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x7b6
+	.byte	0x4a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF526
+	.value	0x799
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB59
+	.quad	.LFE59-.LFB59
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2f2d
+	.uleb128 0x4
+	.long	.LASF353
+	.value	0x799
+	.byte	0x35
+	.long	0x2337
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x799
+	.byte	0x60
+	.long	0x16ea
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF130
+	.value	0x79a
+	.byte	0x28
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x4
+	.long	.LASF129
+	.value	0x79a
+	.byte	0x34
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF144
+	.value	0x7a5
+	.byte	0x22
+	.long	0x2f2d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x5
+	.long	0x88b
+	.uleb128 0x15
+	.long	.LASF527
+	.value	0x735
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB58
+	.quad	.LFE58-.LFB58
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2ff6
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x735
+	.byte	0x36
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1448
+	.uleb128 0x4
+	.long	.LASF417
+	.value	0x735
+	.byte	0x4a
+	.long	0x610
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1456
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x736
+	.byte	0x48
+	.long	0x1e6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1464
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x738
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF406
+	.value	0x739
+	.byte	0x14
+	.long	0xecd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -688
+	.uleb128 0x3
+	.long	.LASF407
+	.value	0x73a
+	.byte	0x18
+	.long	0x1c14
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1440
+	.uleb128 0x3
+	.long	.LASF513
+	.value	0x74f
+	.byte	0xb
+	.long	0x11d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF342
+	.value	0x750
+	.byte	0x1a
+	.long	0xdbf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.long	.LASF299
+	.value	0x752
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x23
+	.long	.LLRL4
+	.uleb128 0x3
+	.long	.LASF373
+	.value	0x76b
+	.byte	0x11
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF529
+	.value	0x727
+	.quad	.LFB57
+	.quad	.LFE57-.LFB57
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3032
+	.uleb128 0x4
+	.long	.LASF368
+	.value	0x727
+	.byte	0x29
+	.long	0xfe
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xc
+	.string	"job"
+	.value	0x729
+	.byte	0x1c
+	.long	0x2ac1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF530
+	.value	0x654
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB56
+	.quad	.LFE56-.LFB56
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3295
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x654
+	.byte	0x32
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2296
+	.uleb128 0x4
+	.long	.LASF417
+	.value	0x654
+	.byte	0x46
+	.long	0x610
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2304
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x655
+	.byte	0x44
+	.long	0x1e6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2312
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x657
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF406
+	.value	0x658
+	.byte	0x14
+	.long	0xecd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -752
+	.uleb128 0x3
+	.long	.LASF407
+	.value	0x659
+	.byte	0x18
+	.long	0x1c14
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1504
+	.uleb128 0x3
+	.long	.LASF531
+	.value	0x65a
+	.byte	0x1b
+	.long	0x10e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1536
+	.uleb128 0x3
+	.long	.LASF351
+	.value	0x65b
+	.byte	0x14
+	.long	0x1dfc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xc
+	.string	"job"
+	.value	0x65c
+	.byte	0x1c
+	.long	0x1e01
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1616
+	.uleb128 0x3
+	.long	.LASF532
+	.value	0x65d
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x3
+	.long	.LASF533
+	.value	0x65e
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF299
+	.value	0x65f
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1624
+	.uleb128 0x3
+	.long	.LASF413
+	.value	0x660
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1632
+	.uleb128 0x3
+	.long	.LASF534
+	.value	0x661
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF262
+	.value	0x662
+	.byte	0xa
+	.long	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1640
+	.uleb128 0x3
+	.long	.LASF394
+	.value	0x676
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x3
+	.long	.LASF513
+	.value	0x6bd
+	.byte	0xb
+	.long	0x11d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x3
+	.long	.LASF342
+	.value	0x6be
+	.byte	0x1a
+	.long	0xdbf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x3
+	.long	.LASF535
+	.value	0x6e6
+	.byte	0xf
+	.long	0x31c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1648
+	.uleb128 0x3
+	.long	.LASF536
+	.value	0x6f7
+	.byte	0x12
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x13
+	.quad	.LBB93
+	.quad	.LBE93-.LBB93
+	.long	0x31b5
+	.uleb128 0xc
+	.string	"i"
+	.value	0x68c
+	.byte	0x13
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB94
+	.quad	.LBE94-.LBB94
+	.long	0x31eb
+	.uleb128 0x3
+	.long	.LASF537
+	.value	0x694
+	.byte	0x18
+	.long	0xecd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2288
+	.uleb128 0x3
+	.long	.LASF538
+	.value	0x695
+	.byte	0xe
+	.long	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1656
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB95
+	.quad	.LBE95-.LBB95
+	.long	0x320e
+	.uleb128 0xc
+	.string	"i"
+	.value	0x6db
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB96
+	.quad	.LBE96-.LBB96
+	.long	0x3272
+	.uleb128 0xc
+	.string	"i"
+	.value	0x6f8
+	.byte	0xf
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xe
+	.quad	.LBB97
+	.quad	.LBE97-.LBB97
+	.uleb128 0x3
+	.long	.LASF373
+	.value	0x6fa
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -116
+	.uleb128 0xe
+	.quad	.LBB98
+	.quad	.LBE98-.LBB98
+	.uleb128 0xc
+	.string	"j"
+	.value	0x6fb
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB99
+	.quad	.LBE99-.LBB99
+	.uleb128 0x3
+	.long	.LASF539
+	.value	0x70e
+	.byte	0x1c
+	.long	0x1210
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2288
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF540
+	.value	0x617
+	.byte	0xe
+	.long	0xfe
+	.quad	.LFB55
+	.quad	.LFE55-.LFB55
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3363
+	.uleb128 0x4
+	.long	.LASF368
+	.value	0x617
+	.byte	0x2d
+	.long	0xfe
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0xc
+	.string	"job"
+	.value	0x619
+	.byte	0x1d
+	.long	0x3363
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF351
+	.value	0x61a
+	.byte	0x14
+	.long	0x1dfc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF264
+	.value	0x61b
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x3
+	.long	.LASF115
+	.value	0x61c
+	.byte	0x15
+	.long	0x16a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xe
+	.quad	.LBB91
+	.quad	.LBE91-.LBB91
+	.uleb128 0xc
+	.string	"i"
+	.value	0x621
+	.byte	0xf
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xe
+	.quad	.LBB92
+	.quad	.LBE92-.LBB92
+	.uleb128 0x3
+	.long	.LASF373
+	.value	0x623
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF401
+	.value	0x624
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x3
+	.long	.LASF541
+	.value	0x62c
+	.byte	0x22
+	.long	0x1e3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1e01
+	.uleb128 0x11
+	.long	.LASF542
+	.value	0x5eb
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB54
+	.quad	.LFE54-.LFB54
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x343b
+	.uleb128 0x4
+	.long	.LASF406
+	.value	0x5eb
+	.byte	0x2e
+	.long	0x1d1d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF299
+	.value	0x5eb
+	.byte	0x3e
+	.long	0x343b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF262
+	.value	0x5eb
+	.byte	0x4d
+	.long	0x3440
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF543
+	.value	0x5eb
+	.byte	0x59
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x3
+	.long	.LASF225
+	.value	0x5ed
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x3
+	.long	.LASF371
+	.value	0x5ee
+	.byte	0xa
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF373
+	.value	0x5ef
+	.byte	0xa
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF230
+	.value	0x5f0
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x23
+	.long	.LLRL3
+	.uleb128 0xc
+	.string	"n"
+	.value	0x603
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0xe
+	.quad	.LBB89
+	.quad	.LBE89-.LBB89
+	.uleb128 0x3
+	.long	.LASF544
+	.value	0x5fa
+	.byte	0x14
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x8e0
+	.uleb128 0x5
+	.long	0x52
+	.uleb128 0x11
+	.long	.LASF545
+	.value	0x541
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB53
+	.quad	.LFE53-.LFB53
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x35d2
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x541
+	.byte	0x34
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2136
+	.uleb128 0x4
+	.long	.LASF417
+	.value	0x541
+	.byte	0x48
+	.long	0x610
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2144
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x542
+	.byte	0x46
+	.long	0x1e6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2152
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x544
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF406
+	.value	0x545
+	.byte	0x14
+	.long	0xecd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -720
+	.uleb128 0x3
+	.long	.LASF537
+	.value	0x546
+	.byte	0x14
+	.long	0xecd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1360
+	.uleb128 0x3
+	.long	.LASF407
+	.value	0x547
+	.byte	0x18
+	.long	0x1c14
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2112
+	.uleb128 0x3
+	.long	.LASF533
+	.value	0x548
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.long	.LASF513
+	.value	0x564
+	.byte	0xb
+	.long	0x11d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF342
+	.value	0x565
+	.byte	0x1a
+	.long	0xdbf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x3
+	.long	.LASF413
+	.value	0x567
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.long	.LASF546
+	.value	0x568
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF408
+	.value	0x57f
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF547
+	.value	0x580
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF548
+	.value	0x5b6
+	.byte	0xb
+	.long	0x67d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2116
+	.uleb128 0x23
+	.long	.LLRL2
+	.uleb128 0x3
+	.long	.LASF373
+	.value	0x583
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x13
+	.quad	.LBB84
+	.quad	.LBE84-.LBB84
+	.long	0x3588
+	.uleb128 0xc
+	.string	"i"
+	.value	0x587
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x13
+	.quad	.LBB85
+	.quad	.LBE85-.LBB85
+	.long	0x35ae
+	.uleb128 0x3
+	.long	.LASF549
+	.value	0x590
+	.byte	0x11
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB86
+	.quad	.LBE86-.LBB86
+	.uleb128 0x3
+	.long	.LASF550
+	.value	0x59f
+	.byte	0x17
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF551
+	.value	0x4ef
+	.quad	.LFB52
+	.quad	.LFE52-.LFB52
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x365b
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x4ef
+	.byte	0x3e
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.uleb128 0x4
+	.long	.LASF406
+	.value	0x4ef
+	.byte	0x57
+	.long	0x1d1d
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x4f0
+	.byte	0x49
+	.long	0x1e6a
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.uleb128 0x3
+	.long	.LASF552
+	.value	0x4f2
+	.byte	0x19
+	.long	0x1d27
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x3
+	.long	.LASF553
+	.value	0x4f4
+	.byte	0xf
+	.long	0x31c
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.uleb128 0x3
+	.long	.LASF554
+	.value	0x4f5
+	.byte	0xf
+	.long	0x31c
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 48
+	.uleb128 0x3
+	.long	.LASF521
+	.value	0x51a
+	.byte	0x22
+	.long	0x365b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 632
+	.byte	0
+	.uleb128 0x5
+	.long	0x1c66
+	.uleb128 0x11
+	.long	.LASF555
+	.value	0x4d5
+	.byte	0xe
+	.long	0xfe
+	.quad	.LFB51
+	.quad	.LFE51-.LFB51
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x36b0
+	.uleb128 0x4
+	.long	.LASF368
+	.value	0x4d5
+	.byte	0x2a
+	.long	0xfe
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF552
+	.value	0x4d7
+	.byte	0x1a
+	.long	0x36b0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF521
+	.value	0x4d8
+	.byte	0x23
+	.long	0x36b5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x5
+	.long	0x1d27
+	.uleb128 0x5
+	.long	0x1cac
+	.uleb128 0x11
+	.long	.LASF556
+	.value	0x4b6
+	.byte	0xe
+	.long	0xfe
+	.quad	.LFB50
+	.quad	.LFE50-.LFB50
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x371f
+	.uleb128 0x4
+	.long	.LASF368
+	.value	0x4b6
+	.byte	0x2a
+	.long	0xfe
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF552
+	.value	0x4b8
+	.byte	0x1a
+	.long	0x36b0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF557
+	.value	0x4b9
+	.byte	0xa
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x23
+	.long	.LLRL1
+	.uleb128 0x3
+	.long	.LASF521
+	.value	0x4bd
+	.byte	0x20
+	.long	0x371f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1c5a
+	.uleb128 0x16
+	.long	.LASF558
+	.value	0x4a3
+	.quad	.LFB49
+	.quad	.LFE49-.LFB49
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x376f
+	.uleb128 0x4
+	.long	.LASF406
+	.value	0x4a3
+	.byte	0x3b
+	.long	0x225a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF397
+	.value	0x4a3
+	.byte	0x48
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF559
+	.value	0x4a5
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF560
+	.value	0x46f
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB48
+	.quad	.LFE48-.LFB48
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x37d3
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x46f
+	.byte	0x37
+	.long	0x1d22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x471
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xe
+	.quad	.LBB80
+	.quad	.LBE80-.LBB80
+	.uleb128 0x3
+	.long	.LASF539
+	.value	0x479
+	.byte	0x1d
+	.long	0x1435
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF561
+	.value	0x449
+	.quad	.LFB47
+	.quad	.LFE47-.LFB47
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3837
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x449
+	.byte	0x39
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF522
+	.value	0x44b
+	.byte	0x18
+	.long	0x3847
+	.uleb128 0x9
+	.byte	0x3
+	.quad	zeros.0
+	.uleb128 0xe
+	.quad	.LBB79
+	.quad	.LBE79-.LBB79
+	.uleb128 0x3
+	.long	.LASF562
+	.value	0x462
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x684
+	.long	0x3847
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xb
+	.long	0x3837
+	.uleb128 0x16
+	.long	.LASF563
+	.value	0x421
+	.quad	.LFB46
+	.quad	.LFE46-.LFB46
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3929
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x421
+	.byte	0x37
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x421
+	.byte	0x4d
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF357
+	.value	0x421
+	.byte	0x58
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x4
+	.long	.LASF373
+	.value	0x421
+	.byte	0x64
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF371
+	.value	0x423
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x13
+	.quad	.LBB76
+	.quad	.LBE76-.LBB76
+	.long	0x38db
+	.uleb128 0x3
+	.long	.LASF550
+	.value	0x428
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB77
+	.quad	.LBE77-.LBB77
+	.uleb128 0xc
+	.string	"n"
+	.value	0x42f
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xc
+	.string	"dst"
+	.value	0x434
+	.byte	0x10
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xe
+	.quad	.LBB78
+	.quad	.LBE78-.LBB78
+	.uleb128 0xc
+	.string	"i"
+	.value	0x435
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF564
+	.value	0x3fd
+	.quad	.LFB45
+	.quad	.LFE45-.LFB45
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3993
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x3fd
+	.byte	0x3a
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF394
+	.value	0x3ff
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF373
+	.value	0x400
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0xe
+	.quad	.LBB75
+	.quad	.LBE75-.LBB75
+	.uleb128 0xc
+	.string	"i"
+	.value	0x40a
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF565
+	.value	0x3eb
+	.quad	.LFB44
+	.quad	.LFE44-.LFB44
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x39cf
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x3eb
+	.byte	0x42
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF137
+	.value	0x3ed
+	.byte	0x10
+	.long	0x59
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF566
+	.value	0x3dd
+	.quad	.LFB43
+	.quad	.LFE43-.LFB43
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x39fc
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x3dd
+	.byte	0x41
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF567
+	.value	0x3a9
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB42
+	.quad	.LFE42-.LFB42
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3a9c
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x3a9
+	.byte	0x40
+	.long	0x1d22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x3a9
+	.byte	0x68
+	.long	0x16ea
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF568
+	.value	0x3aa
+	.byte	0x30
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x4
+	.long	.LASF355
+	.value	0x3aa
+	.byte	0x3d
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x3
+	.long	.LASF353
+	.value	0x3ac
+	.byte	0x15
+	.long	0x8e5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x3ad
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF569
+	.value	0x3b6
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF250
+	.value	0x3b7
+	.byte	0x11
+	.long	0x610
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF570
+	.value	0x37d
+	.quad	.LFB41
+	.quad	.LFE41-.LFB41
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3b25
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x37d
+	.byte	0x38
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x37d
+	.byte	0x4e
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF373
+	.value	0x37d
+	.byte	0x59
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x3
+	.long	.LASF521
+	.value	0x37f
+	.byte	0x1d
+	.long	0x3b25
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF262
+	.value	0x380
+	.byte	0xc
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xe
+	.quad	.LBB74
+	.quad	.LBE74-.LBB74
+	.uleb128 0xc
+	.string	"i"
+	.value	0x388
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1ca0
+	.uleb128 0x16
+	.long	.LASF571
+	.value	0x368
+	.quad	.LFB40
+	.quad	.LFE40-.LFB40
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3b93
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x368
+	.byte	0x39
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x368
+	.byte	0x4f
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF413
+	.value	0x368
+	.byte	0x63
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF373
+	.value	0x368
+	.byte	0x70
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x3
+	.long	.LASF401
+	.value	0x36a
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF572
+	.value	0x355
+	.quad	.LFB39
+	.quad	.LFE39-.LFB39
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3bf0
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x355
+	.byte	0x46
+	.long	0x3bf0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF573
+	.value	0x355
+	.byte	0x53
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0xe
+	.quad	.LBB73
+	.quad	.LBE73-.LBB73
+	.uleb128 0x3
+	.long	.LASF574
+	.value	0x357
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x1c20
+	.uleb128 0x11
+	.long	.LASF575
+	.value	0x345
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB38
+	.quad	.LFE38-.LFB38
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c63
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x345
+	.byte	0x39
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF413
+	.value	0x345
+	.byte	0x4f
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF207
+	.value	0x345
+	.byte	0x65
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF373
+	.value	0x345
+	.byte	0x70
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x3
+	.long	.LASF573
+	.value	0x347
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF576
+	.value	0x338
+	.quad	.LFB37
+	.quad	.LFE37-.LFB37
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c9f
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x338
+	.byte	0x37
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF577
+	.value	0x338
+	.byte	0x46
+	.long	0x67d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF578
+	.value	0x32d
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3d1c
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x32d
+	.byte	0x38
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x32d
+	.byte	0x4e
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF413
+	.value	0x32d
+	.byte	0x62
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF358
+	.value	0x32e
+	.byte	0x2b
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF207
+	.value	0x32e
+	.byte	0x3a
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF373
+	.value	0x32e
+	.byte	0x45
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF579
+	.value	0x2d7
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3dca
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x2d7
+	.byte	0x36
+	.long	0x1d22
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x2d7
+	.byte	0x4c
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x2d7
+	.byte	0x73
+	.long	0x1e6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF343
+	.value	0x2d8
+	.byte	0x2e
+	.long	0x610
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF342
+	.value	0x2d8
+	.byte	0x4d
+	.long	0xdb3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x4
+	.long	.LASF226
+	.value	0x2d8
+	.byte	0x68
+	.long	0x7d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF346
+	.value	0x2d9
+	.byte	0x26
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x3
+	.long	.LASF352
+	.value	0x2db
+	.byte	0x23
+	.long	0x16e5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF580
+	.value	0x2e3
+	.byte	0x1f
+	.long	0x18fa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF581
+	.value	0x2c2
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3df7
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x2c2
+	.byte	0x2c
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF582
+	.value	0x2b1
+	.byte	0x15
+	.long	0x15ad
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3e47
+	.uleb128 0x4
+	.long	.LASF416
+	.value	0x2b1
+	.byte	0x3d
+	.long	0x1e65
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF330
+	.value	0x2b1
+	.byte	0x5e
+	.long	0x26ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF388
+	.value	0x2b3
+	.byte	0x12
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF583
+	.value	0x290
+	.byte	0xe
+	.long	0x11d
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ed7
+	.uleb128 0x4
+	.long	.LASF417
+	.value	0x290
+	.byte	0x33
+	.long	0x610
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF253
+	.value	0x290
+	.byte	0x61
+	.long	0x1e6a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x291
+	.byte	0x2b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x3
+	.long	.LASF584
+	.value	0x293
+	.byte	0x11
+	.long	0x610
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF585
+	.value	0x294
+	.byte	0x11
+	.long	0x610
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF586
+	.value	0x295
+	.byte	0xa
+	.long	0x3ed7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF513
+	.value	0x2a1
+	.byte	0xb
+	.long	0x11d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x12
+	.long	0x122
+	.long	0x3ee7
+	.uleb128 0x14
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF587
+	.value	0x25d
+	.byte	0x7
+	.long	0x67d
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3f7b
+	.uleb128 0x4
+	.long	.LASF588
+	.value	0x25d
+	.byte	0x35
+	.long	0x610
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x25f
+	.byte	0xb
+	.long	0x67d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF589
+	.value	0x260
+	.byte	0xa
+	.long	0x122
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -29
+	.uleb128 0x3
+	.long	.LASF590
+	.value	0x261
+	.byte	0xb
+	.long	0x67d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x3
+	.long	.LASF591
+	.value	0x262
+	.byte	0x19
+	.long	0x7d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	dotCounter.1
+	.uleb128 0xe
+	.quad	.LBB72
+	.quad	.LBE72-.LBB72
+	.uleb128 0xc
+	.string	"i"
+	.value	0x264
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF592
+	.value	0x242
+	.byte	0xe
+	.long	0x7d
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3ff9
+	.uleb128 0x4
+	.long	.LASF593
+	.value	0x242
+	.byte	0x40
+	.long	0x610
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x244
+	.byte	0x12
+	.long	0x7d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF589
+	.value	0x245
+	.byte	0xa
+	.long	0x122
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -29
+	.uleb128 0x3
+	.long	.LASF590
+	.value	0x246
+	.byte	0x12
+	.long	0x7d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0xe
+	.quad	.LBB71
+	.quad	.LBE71-.LBB71
+	.uleb128 0xc
+	.string	"i"
+	.value	0x248
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF594
+	.value	0x21f
+	.byte	0x16
+	.long	0x15ed
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x403a
+	.uleb128 0x4
+	.long	.LASF340
+	.value	0x21f
+	.byte	0x45
+	.long	0x610
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x221
+	.byte	0x1a
+	.long	0x15ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF595
+	.value	0x21a
+	.byte	0xd
+	.long	0x610
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x406c
+	.uleb128 0x4
+	.long	.LASF132
+	.value	0x21a
+	.byte	0x36
+	.long	0x147c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF596
+	.value	0x20d
+	.byte	0x14
+	.long	0x147c
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x40bd
+	.uleb128 0x4
+	.long	.LASF132
+	.value	0x20d
+	.byte	0x41
+	.long	0x610
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xe
+	.quad	.LBB70
+	.quad	.LBE70-.LBB70
+	.uleb128 0xc
+	.string	"i"
+	.value	0x20f
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF597
+	.value	0x1d8
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x413c
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x1d8
+	.byte	0x2b
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF353
+	.value	0x1d8
+	.byte	0x4a
+	.long	0x2673
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF407
+	.value	0x1d8
+	.byte	0x5a
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x4
+	.long	.LASF569
+	.value	0x1d8
+	.byte	0x67
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF144
+	.value	0x1da
+	.byte	0x22
+	.long	0x2f2d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF119
+	.value	0x1db
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF598
+	.value	0x1c2
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x41ae
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x1c2
+	.byte	0x31
+	.long	0x1e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF137
+	.value	0x1c2
+	.byte	0x3e
+	.long	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF250
+	.value	0x1c2
+	.byte	0x54
+	.long	0x610
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x3
+	.long	.LASF353
+	.value	0x1c4
+	.byte	0x15
+	.long	0x8e5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x1d3
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0x44
+	.long	.LASF599
+	.byte	0x1
+	.value	0x1ba
+	.byte	0xd
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x41fb
+	.uleb128 0x4
+	.long	.LASF144
+	.value	0x1ba
+	.byte	0x41
+	.long	0x8db
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x1ba
+	.byte	0x5c
+	.long	0x1e65
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF137
+	.value	0x1ba
+	.byte	0x69
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF600
+	.value	0x1ae
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4278
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x1ae
+	.byte	0x29
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x1ae
+	.byte	0x3e
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF413
+	.value	0x1ae
+	.byte	0x52
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF358
+	.value	0x1af
+	.byte	0x23
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF207
+	.value	0x1af
+	.byte	0x32
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF601
+	.value	0x1af
+	.byte	0x3d
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF602
+	.value	0x1a9
+	.byte	0xe
+	.long	0xa06
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x42aa
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x1a9
+	.byte	0x35
+	.long	0x1e65
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF604
+	.value	0x187
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4358
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x187
+	.byte	0x29
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xe
+	.quad	.LBB67
+	.quad	.LBE67-.LBB67
+	.uleb128 0x3
+	.long	.LASF145
+	.value	0x18b
+	.byte	0x10
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF146
+	.value	0x18c
+	.byte	0x16
+	.long	0xa06
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF603
+	.value	0x18d
+	.byte	0x15
+	.long	0x684
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x13
+	.quad	.LBB68
+	.quad	.LBE68-.LBB68
+	.long	0x4337
+	.uleb128 0xc
+	.string	"k"
+	.value	0x192
+	.byte	0x1a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB69
+	.quad	.LBE69-.LBB69
+	.uleb128 0xc
+	.string	"k"
+	.value	0x19a
+	.byte	0x1a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF605
+	.value	0x181
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4394
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x181
+	.byte	0x28
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF577
+	.value	0x181
+	.byte	0x36
+	.long	0x67d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF606
+	.value	0x176
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x43c1
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x176
+	.byte	0x22
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF607
+	.value	0x143
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4474
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x143
+	.byte	0x28
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF133
+	.value	0x143
+	.byte	0x36
+	.long	0x67d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x4
+	.long	.LASF130
+	.value	0x143
+	.byte	0x40
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF132
+	.value	0x143
+	.byte	0x5b
+	.long	0x147c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x4
+	.long	.LASF134
+	.value	0x144
+	.byte	0x21
+	.long	0x67d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF330
+	.value	0x144
+	.byte	0x40
+	.long	0x26ed
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF502
+	.value	0x146
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x23
+	.long	.LLRL0
+	.uleb128 0x3
+	.long	.LASF608
+	.value	0x150
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.long	.LASF609
+	.value	0x151
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF610
+	.value	0x13b
+	.byte	0x8
+	.long	0x2e
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x44a6
+	.uleb128 0x4
+	.long	.LASF130
+	.value	0x13b
+	.byte	0x25
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF611
+	.value	0x136
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4505
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x136
+	.byte	0x2e
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF133
+	.value	0x136
+	.byte	0x3c
+	.long	0x67d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x4
+	.long	.LASF130
+	.value	0x136
+	.byte	0x46
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF330
+	.value	0x136
+	.byte	0x64
+	.long	0x26ed
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF612
+	.value	0x131
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4555
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x131
+	.byte	0x21
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF133
+	.value	0x131
+	.byte	0x2f
+	.long	0x67d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x4
+	.long	.LASF130
+	.value	0x131
+	.byte	0x39
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF613
+	.value	0x116
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x46be
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x116
+	.byte	0x38
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x116
+	.byte	0x4d
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x4
+	.long	.LASF413
+	.value	0x116
+	.byte	0x61
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x4
+	.long	.LASF358
+	.value	0x117
+	.byte	0x32
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x4
+	.long	.LASF207
+	.value	0x117
+	.byte	0x41
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x4
+	.long	.LASF601
+	.value	0x117
+	.byte	0x4c
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -188
+	.uleb128 0x28
+	.long	0x4dbb
+	.quad	.LBB60
+	.quad	.LBE60-.LBB60
+	.value	0x119
+	.uleb128 0x24
+	.long	0x4e0c
+	.uleb128 0x7
+	.long	0x4e01
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x7
+	.long	0x4df6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.long	0x4deb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	0x4de0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	0x4dd5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	0x4dca
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	0x4e17
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.long	0x4e22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xa
+	.long	0x4e2b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x25
+	.long	0x4e34
+	.quad	.LBB62
+	.quad	.LBE62-.LBB62
+	.uleb128 0xa
+	.long	0x4e35
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x21
+	.long	0x4e40
+	.quad	.LBB63
+	.quad	.LBE63-.LBB63
+	.byte	0xdf
+	.byte	0xd
+	.uleb128 0x7
+	.long	0x4e7b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x7
+	.long	0x4e70
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x7
+	.long	0x4e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x7
+	.long	0x4e5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x7
+	.long	0x4e4f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xa
+	.long	0x4e86
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -132
+	.uleb128 0xa
+	.long	0x4e8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xa
+	.long	0x4e9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF614
+	.value	0x10f
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4827
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x10f
+	.byte	0x38
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x10f
+	.byte	0x4d
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x4
+	.long	.LASF413
+	.value	0x10f
+	.byte	0x61
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x4
+	.long	.LASF358
+	.value	0x110
+	.byte	0x32
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x4
+	.long	.LASF207
+	.value	0x110
+	.byte	0x41
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x4
+	.long	.LASF601
+	.value	0x110
+	.byte	0x4c
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -188
+	.uleb128 0x28
+	.long	0x4dbb
+	.quad	.LBB55
+	.quad	.LBE55-.LBB55
+	.value	0x112
+	.uleb128 0x24
+	.long	0x4e0c
+	.uleb128 0x7
+	.long	0x4e01
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x7
+	.long	0x4df6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.long	0x4deb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	0x4de0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	0x4dd5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	0x4dca
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	0x4e17
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.long	0x4e22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xa
+	.long	0x4e2b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x25
+	.long	0x4e34
+	.quad	.LBB57
+	.quad	.LBE57-.LBB57
+	.uleb128 0xa
+	.long	0x4e35
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x21
+	.long	0x4e40
+	.quad	.LBB58
+	.quad	.LBE58-.LBB58
+	.byte	0xdf
+	.byte	0xd
+	.uleb128 0x7
+	.long	0x4e7b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x7
+	.long	0x4e70
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x7
+	.long	0x4e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x7
+	.long	0x4e5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x7
+	.long	0x4e4f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xa
+	.long	0x4e86
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -132
+	.uleb128 0xa
+	.long	0x4e8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xa
+	.long	0x4e9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF615
+	.value	0x108
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4990
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x108
+	.byte	0x39
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x108
+	.byte	0x4e
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x4
+	.long	.LASF413
+	.value	0x108
+	.byte	0x62
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x4
+	.long	.LASF358
+	.value	0x109
+	.byte	0x33
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x4
+	.long	.LASF207
+	.value	0x109
+	.byte	0x42
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x4
+	.long	.LASF601
+	.value	0x109
+	.byte	0x4d
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -188
+	.uleb128 0x28
+	.long	0x4dbb
+	.quad	.LBB50
+	.quad	.LBE50-.LBB50
+	.value	0x10b
+	.uleb128 0x24
+	.long	0x4e0c
+	.uleb128 0x7
+	.long	0x4e01
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x7
+	.long	0x4df6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.long	0x4deb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	0x4de0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	0x4dd5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	0x4dca
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	0x4e17
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.long	0x4e22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xa
+	.long	0x4e2b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x25
+	.long	0x4e34
+	.quad	.LBB52
+	.quad	.LBE52-.LBB52
+	.uleb128 0xa
+	.long	0x4e35
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x21
+	.long	0x4e40
+	.quad	.LBB53
+	.quad	.LBE53-.LBB53
+	.byte	0xdf
+	.byte	0xd
+	.uleb128 0x7
+	.long	0x4e7b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x7
+	.long	0x4e70
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x7
+	.long	0x4e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x7
+	.long	0x4e5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x7
+	.long	0x4e4f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xa
+	.long	0x4e86
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -132
+	.uleb128 0xa
+	.long	0x4e8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xa
+	.long	0x4e9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF616
+	.value	0x101
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4af9
+	.uleb128 0x4
+	.long	.LASF388
+	.value	0x101
+	.byte	0x35
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x4
+	.long	.LASF408
+	.value	0x101
+	.byte	0x4a
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x4
+	.long	.LASF413
+	.value	0x101
+	.byte	0x5e
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x4
+	.long	.LASF358
+	.value	0x102
+	.byte	0x2f
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x4
+	.long	.LASF207
+	.value	0x102
+	.byte	0x3e
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x4
+	.long	.LASF601
+	.value	0x102
+	.byte	0x49
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -188
+	.uleb128 0x28
+	.long	0x4dbb
+	.quad	.LBB45
+	.quad	.LBE45-.LBB45
+	.value	0x104
+	.uleb128 0x24
+	.long	0x4e0c
+	.uleb128 0x7
+	.long	0x4e01
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x7
+	.long	0x4df6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.long	0x4deb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	0x4de0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	0x4dd5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	0x4dca
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	0x4e17
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.long	0x4e22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xa
+	.long	0x4e2b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x25
+	.long	0x4e34
+	.quad	.LBB47
+	.quad	.LBE47-.LBB47
+	.uleb128 0xa
+	.long	0x4e35
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x21
+	.long	0x4e40
+	.quad	.LBB48
+	.quad	.LBE48-.LBB48
+	.byte	0xdf
+	.byte	0xd
+	.uleb128 0x7
+	.long	0x4e7b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x7
+	.long	0x4e70
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x7
+	.long	0x4e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x7
+	.long	0x4e5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x7
+	.long	0x4e4f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xa
+	.long	0x4e86
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -132
+	.uleb128 0xa
+	.long	0x4e8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xa
+	.long	0x4e9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF617
+	.byte	0xfa
+	.long	0x46
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4c5a
+	.uleb128 0x17
+	.long	.LASF388
+	.byte	0xfa
+	.byte	0x34
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x17
+	.long	.LASF408
+	.byte	0xfa
+	.byte	0x49
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x17
+	.long	.LASF413
+	.byte	0xfa
+	.byte	0x5d
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x17
+	.long	.LASF358
+	.byte	0xfb
+	.byte	0x2e
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x17
+	.long	.LASF207
+	.byte	0xfb
+	.byte	0x3d
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x17
+	.long	.LASF601
+	.byte	0xfb
+	.byte	0x48
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -188
+	.uleb128 0x21
+	.long	0x4dbb
+	.quad	.LBB40
+	.quad	.LBE40-.LBB40
+	.byte	0xfd
+	.byte	0xc
+	.uleb128 0x24
+	.long	0x4e0c
+	.uleb128 0x7
+	.long	0x4e01
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x7
+	.long	0x4df6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.long	0x4deb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	0x4de0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	0x4dd5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	0x4dca
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	0x4e17
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.long	0x4e22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xa
+	.long	0x4e2b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x25
+	.long	0x4e34
+	.quad	.LBB42
+	.quad	.LBE42-.LBB42
+	.uleb128 0xa
+	.long	0x4e35
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x21
+	.long	0x4e40
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.byte	0xdf
+	.byte	0xd
+	.uleb128 0x7
+	.long	0x4e7b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x7
+	.long	0x4e70
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x7
+	.long	0x4e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x7
+	.long	0x4e5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x7
+	.long	0x4e4f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xa
+	.long	0x4e86
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -132
+	.uleb128 0xa
+	.long	0x4e8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xa
+	.long	0x4e9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF618
+	.byte	0xf3
+	.long	0x46
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4dbb
+	.uleb128 0x17
+	.long	.LASF388
+	.byte	0xf3
+	.byte	0x33
+	.long	0x15ad
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x17
+	.long	.LASF408
+	.byte	0xf3
+	.byte	0x48
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x17
+	.long	.LASF413
+	.byte	0xf3
+	.byte	0x5c
+	.long	0xa06
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x17
+	.long	.LASF358
+	.byte	0xf4
+	.byte	0x2d
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x17
+	.long	.LASF207
+	.byte	0xf4
+	.byte	0x3c
+	.long	0x8e0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x17
+	.long	.LASF601
+	.byte	0xf4
+	.byte	0x47
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -188
+	.uleb128 0x21
+	.long	0x4dbb
+	.quad	.LBB35
+	.quad	.LBE35-.LBB35
+	.byte	0xf6
+	.byte	0xc
+	.uleb128 0x24
+	.long	0x4e0c
+	.uleb128 0x7
+	.long	0x4e01
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x7
+	.long	0x4df6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x7
+	.long	0x4deb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	0x4de0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	0x4dd5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	0x4dca
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.long	0x4e17
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xa
+	.long	0x4e22
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0xa
+	.long	0x4e2b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x25
+	.long	0x4e34
+	.quad	.LBB37
+	.quad	.LBE37-.LBB37
+	.uleb128 0xa
+	.long	0x4e35
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x21
+	.long	0x4e40
+	.quad	.LBB38
+	.quad	.LBE38-.LBB38
+	.byte	0xdf
+	.byte	0xd
+	.uleb128 0x7
+	.long	0x4e7b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x7
+	.long	0x4e70
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x7
+	.long	0x4e65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x7
+	.long	0x4e5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x7
+	.long	0x4e4f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xa
+	.long	0x4e86
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -132
+	.uleb128 0xa
+	.long	0x4e8f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xa
+	.long	0x4e9a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF619
+	.byte	0xd6
+	.byte	0x5
+	.long	0x46
+	.long	0x4e40
+	.uleb128 0x19
+	.long	.LASF388
+	.byte	0xd6
+	.byte	0x30
+	.long	0x15ad
+	.uleb128 0x19
+	.long	.LASF408
+	.byte	0xd6
+	.byte	0x45
+	.long	0xa06
+	.uleb128 0x19
+	.long	.LASF413
+	.byte	0xd6
+	.byte	0x59
+	.long	0xa06
+	.uleb128 0x19
+	.long	.LASF358
+	.byte	0xd7
+	.byte	0x2a
+	.long	0x8e0
+	.uleb128 0x19
+	.long	.LASF207
+	.byte	0xd7
+	.byte	0x39
+	.long	0x8e0
+	.uleb128 0x19
+	.long	.LASF601
+	.byte	0xd7
+	.byte	0x44
+	.long	0x46
+	.uleb128 0x19
+	.long	.LASF132
+	.byte	0xd7
+	.byte	0x6b
+	.long	0x1488
+	.uleb128 0x31
+	.long	.LASF502
+	.byte	0xd9
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x29
+	.string	"y"
+	.byte	0xda
+	.byte	0xb
+	.long	0x67d
+	.uleb128 0x29
+	.string	"e"
+	.byte	0xdb
+	.byte	0xb
+	.long	0x67d
+	.uleb128 0x45
+	.uleb128 0x29
+	.string	"n"
+	.byte	0xdd
+	.byte	0xe
+	.long	0x46
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF620
+	.byte	0x9e
+	.byte	0x7
+	.long	0x67d
+	.long	0x4ea6
+	.uleb128 0x19
+	.long	.LASF388
+	.byte	0x9e
+	.byte	0x22
+	.long	0x15ad
+	.uleb128 0x19
+	.long	.LASF577
+	.byte	0x9e
+	.byte	0x30
+	.long	0x67d
+	.uleb128 0x19
+	.long	.LASF413
+	.byte	0x9e
+	.byte	0x45
+	.long	0xa06
+	.uleb128 0x19
+	.long	.LASF207
+	.byte	0x9e
+	.byte	0x55
+	.long	0x8e0
+	.uleb128 0x19
+	.long	.LASF132
+	.byte	0x9f
+	.byte	0x2e
+	.long	0x1488
+	.uleb128 0x29
+	.string	"y"
+	.byte	0xa1
+	.byte	0xb
+	.long	0x67d
+	.uleb128 0x31
+	.long	.LASF621
+	.byte	0xa5
+	.byte	0x12
+	.long	0xa06
+	.uleb128 0x31
+	.long	.LASF408
+	.byte	0xa6
+	.byte	0x12
+	.long	0xa06
+	.byte	0
+	.uleb128 0x46
+	.long	.LASF626
+	.byte	0x1
+	.byte	0x7b
+	.byte	0x14
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x17
+	.long	.LASF388
+	.byte	0x7b
+	.byte	0x39
+	.long	0x15ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x17
+	.long	.LASF577
+	.byte	0x7b
+	.byte	0x47
+	.long	0x67d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x38
+	.long	.LASF119
+	.byte	0x7d
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x38
+	.long	.LASF622
+	.byte	0x7e
+	.byte	0x11
+	.long	0x684
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 12
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 64
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB65-.Ltext0
+	.uleb128 .LBE65-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB66-.Ltext0
+	.uleb128 .LBE66-.Ltext0
+	.byte	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB81-.Ltext0
+	.uleb128 .LBE81-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB82-.Ltext0
+	.uleb128 .LBE82-.Ltext0
+	.byte	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB83-.Ltext0
+	.uleb128 .LBE83-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB87-.Ltext0
+	.uleb128 .LBE87-.Ltext0
+	.byte	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB88-.Ltext0
+	.uleb128 .LBE88-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB90-.Ltext0
+	.uleb128 .LBE90-.Ltext0
+	.byte	0
+.LLRL4:
+	.byte	0x4
+	.uleb128 .LBB100-.Ltext0
+	.uleb128 .LBE100-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB101-.Ltext0
+	.uleb128 .LBE101-.Ltext0
+	.byte	0
+.LLRL5:
+	.byte	0x4
+	.uleb128 .LBB105-.Ltext0
+	.uleb128 .LBE105-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB106-.Ltext0
+	.uleb128 .LBE106-.Ltext0
+	.byte	0
+.LLRL6:
+	.byte	0x4
+	.uleb128 .LBB107-.Ltext0
+	.uleb128 .LBE107-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB114-.Ltext0
+	.uleb128 .LBE114-.Ltext0
+	.byte	0
+.LLRL7:
+	.byte	0x4
+	.uleb128 .LBB108-.Ltext0
+	.uleb128 .LBE108-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB113-.Ltext0
+	.uleb128 .LBE113-.Ltext0
+	.byte	0
+.LLRL8:
+	.byte	0x4
+	.uleb128 .LBB121-.Ltext0
+	.uleb128 .LBE121-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB123-.Ltext0
+	.uleb128 .LBE123-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF272:
+	.string	"LmsLatencyHistogram_t"
+.LASF370:
+	.string	"jobs"
+.LASF396:
+	.string	"inputSamples"
+.LASF565:
+	.string	"lmsFilter_ChannelCheckpointIfDue"
+.LASF33:
+	.string	"__value32"
+.LASF341:
+	.string	"inputFormat"
+.LASF9:
+	.string	"size_t"
+.LASF155:
+	.string	"LMS_KERNEL_SSE2"
+.LASF492:
+	.string	"lmsCheckpoint_Write"
+.LASF340:
+	.string	"algorithm"
+.LASF389:
+	.string	"engine"
+.LASF498:
+	.string	"lmsKernel_GetBest"
+.LASF541:
+	.string	"start"
+.LASF355:
+	.string	"quiet"
+.LASF280:
+	.string	"p999Ns"
+.LASF46:
+	.string	"__kind"
+.LASF107:
+	.string	"_ISgraph"
+.LASF64:
+	.string	"pthread_cond_t"
+.LASF329:
+	.string	"kernel"
+.LASF602:
+	.string	"lmsFilter_GetWindow"
+.LASF120:
+	.string	"used"
+.LASF437:
+	.string	"lmsRealtime_Init"
+.LASF387:
+	.string	"tail"
+.LASF151:
+	.string	"resumeFileName"
+.LASF185:
+	.string	"AsyncFileBuffer_t"
+.LASF20:
+	.string	"__ssize_t"
+.LASF97:
+	.string	"_IO_codecvt"
+.LASF582:
+	.string	"lmsFilter_CreateLike"
+.LASF431:
+	.string	"lmsFilterBank_PushFrame"
+.LASF26:
+	.string	"int32_t"
+.LASF40:
+	.string	"__pthread_list_t"
+.LASF77:
+	.string	"_IO_save_end"
+.LASF145:
+	.string	"coefficients"
+.LASF378:
+	.string	"workAvailable"
+.LASF409:
+	.string	"writeStatus"
+.LASF250:
+	.string	"fileName"
+.LASF334:
+	.string	"LMS_FILTER_ALGORITHM_FDAF"
+.LASF382:
+	.string	"shutdown"
+.LASF402:
+	.string	"outputRing"
+.LASF19:
+	.string	"__clockid_t"
+.LASF246:
+	.string	"LMS_PLOT_FORMAT_HTML"
+.LASF248:
+	.string	"LMS_PLOT_FORMAT_CSV"
+.LASF167:
+	.string	"LmsKernel_t"
+.LASF146:
+	.string	"window"
+.LASF39:
+	.string	"__next"
+.LASF487:
+	.string	"atof"
+.LASF62:
+	.string	"__data"
+.LASF604:
+	.string	"lmsFilter_FlushUpdate"
+.LASF508:
+	.string	"arenaBytes"
+.LASF70:
+	.string	"_IO_write_base"
+.LASF513:
+	.string	"filteredFileName"
+.LASF411:
+	.string	"LmsFilterPipeline_t"
+.LASF38:
+	.string	"__prev"
+.LASF184:
+	.string	"state"
+.LASF86:
+	.string	"_lock"
+.LASF616:
+	.string	"lmsFilter_ProcessBlockLeaky"
+.LASF328:
+	.string	"processBlock"
+.LASF539:
+	.string	"stats"
+.LASF474:
+	.string	"lmsEngine_ProcessBlock"
+.LASF253:
+	.string	"settings"
+.LASF149:
+	.string	"saveFileName"
+.LASF504:
+	.string	"fileSettings"
+.LASF597:
+	.string	"lmsFilter_LoadCheckpoint"
+.LASF37:
+	.string	"__pthread_internal_list"
+.LASF446:
+	.string	"pthread_create"
+.LASF160:
+	.string	"type"
+.LASF521:
+	.string	"block"
+.LASF135:
+	.string	"hasState"
+.LASF75:
+	.string	"_IO_save_base"
+.LASF549:
+	.string	"desiredCount"
+.LASF44:
+	.string	"__owner"
+.LASF195:
+	.string	"cqHead"
+.LASF354:
+	.string	"plot"
+.LASF338:
+	.string	"LMS_FILTER_ALGORITHM_APA"
+.LASF32:
+	.string	"__value64"
+.LASF222:
+	.string	"SampleFormat_t"
+.LASF590:
+	.string	"argNumber"
+.LASF279:
+	.string	"p99Ns"
+.LASF79:
+	.string	"_chain"
+.LASF24:
+	.string	"ssize_t"
+.LASF342:
+	.string	"outputFormat"
+.LASF83:
+	.string	"_cur_column"
+.LASF10:
+	.string	"__uint8_t"
+.LASF473:
+	.string	"lmsEngine_PushSample"
+.LASF428:
+	.string	"lmsArena_Init"
+.LASF501:
+	.string	"inputFileNames"
+.LASF308:
+	.string	"firstWarningAt"
+.LASF307:
+	.string	"warnings"
+.LASF150:
+	.string	"interval"
+.LASF556:
+	.string	"lmsFilter_ReaderStage"
+.LASF488:
+	.string	"atoi"
+.LASF583:
+	.string	"lmsFilter_OutputFileName"
+.LASF548:
+	.string	"extra"
+.LASF603:
+	.string	"gain"
+.LASF510:
+	.string	"arena"
+.LASF143:
+	.string	"LmsCheckpointHeader_t"
+.LASF163:
+	.string	"updateDot"
+.LASF435:
+	.string	"lmsRealtime_PrintStats"
+.LASF600:
+	.string	"lmsFilter_ProcessBlock"
+.LASF156:
+	.string	"LMS_KERNEL_AVX2"
+.LASF3:
+	.string	"long int"
+.LASF461:
+	.string	"memmove"
+.LASF566:
+	.string	"lmsFilter_ChannelSaveCheckpoint"
+.LASF302:
+	.string	"normInterval"
+.LASF294:
+	.string	"divergenceRatio"
+.LASF439:
+	.string	"clock_nanosleep"
+.LASF587:
+	.string	"lmsFilter_processArgumentStepSize"
+.LASF278:
+	.string	"p50Ns"
+.LASF289:
+	.string	"shortWeight"
+.LASF319:
+	.string	"LMS_FILTER_VARIANT_SIGN_DATA"
+.LASF274:
+	.string	"deadlineMisses"
+.LASF96:
+	.string	"_IO_marker"
+.LASF129:
+	.string	"numOfChannels"
+.LASF168:
+	.string	"ASYNC_FILE_BACKEND_UNKNOWN"
+.LASF148:
+	.string	"LmsCheckpoint_t"
+.LASF241:
+	.string	"SampleReader_t"
+.LASF394:
+	.string	"history"
+.LASF564:
+	.string	"lmsFilter_ChannelProcess"
+.LASF128:
+	.string	"headerSize"
+.LASF106:
+	.string	"_ISprint"
+.LASF207:
+	.string	"error"
+.LASF372:
+	.string	"head"
+.LASF285:
+	.string	"convergenceMargin"
+.LASF232:
+	.string	"textPos"
+.LASF470:
+	.string	"lmsEngine_NormSquared"
+.LASF297:
+	.string	"desiredPower"
+.LASF537:
+	.string	"desiredReader"
+.LASF45:
+	.string	"__nusers"
+.LASF449:
+	.string	"spscRing_AcquireRead"
+.LASF239:
+	.string	"ioPos"
+.LASF585:
+	.string	"baseName"
+.LASF507:
+	.string	"heap"
+.LASF192:
+	.string	"sqTail"
+.LASF8:
+	.string	"signed char"
+.LASF122:
+	.string	"uint8_t"
+.LASF257:
+	.string	"maximum"
+.LASF65:
+	.string	"_IO_FILE"
+.LASF180:
+	.string	"AsyncFileBufferState_t"
+.LASF98:
+	.string	"_IO_wide_data"
+.LASF390:
+	.string	"writer"
+.LASF198:
+	.string	"cqes"
+.LASF419:
+	.string	"numOfFiles"
+.LASF116:
+	.string	"context"
+.LASF41:
+	.string	"__pthread_mutex_s"
+.LASF133:
+	.string	"step"
+.LASF476:
+	.string	"lmsPlot_Init"
+.LASF170:
+	.string	"ASYNC_FILE_BACKEND_URING"
+.LASF5:
+	.string	"unsigned char"
+.LASF357:
+	.string	"stride"
+.LASF47:
+	.string	"__spins"
+.LASF90:
+	.string	"_freeres_list"
+.LASF333:
+	.string	"LMS_FILTER_ALGORITHM_LMS"
+.LASF424:
+	.string	"threadPool_Wait"
+.LASF429:
+	.string	"lmsFilterBank_FlushUpdate"
+.LASF317:
+	.string	"LMS_FILTER_VARIANT_LEAKY"
+.LASF450:
+	.string	"spscRing_ReleaseRead"
+.LASF551:
+	.string	"lmsFilter_ChannelRunPipeline"
+.LASF240:
+	.string	"ioPosition"
+.LASF523:
+	.string	"lmsFilter_FilterInterleavedFileBank"
+.LASF442:
+	.string	"realloc"
+.LASF183:
+	.string	"result"
+.LASF404:
+	.string	"LmsFilterInputBlock_t"
+.LASF162:
+	.string	"update"
+.LASF238:
+	.string	"ioLength"
+.LASF152:
+	.string	"warmStartFileName"
+.LASF138:
+	.string	"payloadBytes"
+.LASF568:
+	.string	"delayed"
+.LASF144:
+	.string	"header"
+.LASF136:
+	.string	"pendingUpdate"
+.LASF247:
+	.string	"LMS_PLOT_FORMAT_SVG"
+.LASF21:
+	.string	"__syscall_slong_t"
+.LASF491:
+	.string	"lmsCheckpoint_Close"
+.LASF595:
+	.string	"lmsFilter_VariantName"
+.LASF348:
+	.string	"projectionOrder"
+.LASF132:
+	.string	"variant"
+.LASF381:
+	.string	"nextQueue"
+.LASF221:
+	.string	"SAMPLE_FORMAT_WAV_F32"
+.LASF147:
+	.string	"mapped"
+.LASF509:
+	.string	"arenaMemory"
+.LASF22:
+	.string	"char"
+.LASF360:
+	.string	"pushSample"
+.LASF216:
+	.string	"SAMPLE_FORMAT_UNKNOWN"
+.LASF263:
+	.string	"LmsPlot_t"
+.LASF331:
+	.string	"LmsFilterProcessBlock_t"
+.LASF273:
+	.string	"deadlineNs"
+.LASF31:
+	.string	"__high"
+.LASF374:
+	.string	"ThreadPoolQueue_t"
+.LASF368:
+	.string	"argument"
+.LASF371:
+	.string	"capacity"
+.LASF624:
+	.string	"_IO_lock_t"
+.LASF478:
+	.string	"lmsPlot_FilterSeriesNames"
+.LASF210:
+	.string	"lock"
+.LASF366:
+	.string	"ThreadPoolTask_t"
+.LASF324:
+	.string	"LmsFilter"
+.LASF304:
+	.string	"norm"
+.LASF569:
+	.string	"resume"
+.LASF264:
+	.string	"blockSize"
+.LASF215:
+	.string	"AsyncFile_t"
+.LASF175:
+	.string	"ASYNC_FILE_WRITE"
+.LASF114:
+	.string	"allocate"
+.LASF586:
+	.string	"channelSuffix"
+.LASF30:
+	.string	"__low"
+.LASF415:
+	.string	"LmsFilterRealtimeJob_t"
+.LASF538:
+	.string	"desiredFrames"
+.LASF609:
+	.string	"delayLineBytes"
+.LASF67:
+	.string	"_IO_read_ptr"
+.LASF525:
+	.string	"lmsFilter_WarmStartRow"
+.LASF546:
+	.string	"columns"
+.LASF490:
+	.string	"strcmp"
+.LASF577:
+	.string	"sample"
+.LASF610:
+	.string	"lmsFilter_RequiredMemory"
+.LASF127:
+	.string	"byteOrder"
+.LASF459:
+	.string	"lmsTelemetry_GetStats"
+.LASF231:
+	.string	"text"
+.LASF189:
+	.string	"cqRingSize"
+.LASF408:
+	.string	"input"
+.LASF219:
+	.string	"SAMPLE_FORMAT_S16"
+.LASF78:
+	.string	"_markers"
+.LASF293:
+	.string	"convergedLevel"
+.LASF292:
+	.string	"convergedHigh"
+.LASF223:
+	.string	"file"
+.LASF110:
+	.string	"_ISpunct"
+.LASF261:
+	.string	"fill"
+.LASF299:
+	.string	"samples"
+.LASF418:
+	.string	"filesDone"
+.LASF234:
+	.string	"mappedSize"
+.LASF606:
+	.string	"lmsFilter_Free"
+.LASF475:
+	.string	"sampleIo_OpenWriter"
+.LASF367:
+	.string	"task"
+.LASF496:
+	.string	"printf"
+.LASF126:
+	.string	"version"
+.LASF217:
+	.string	"SAMPLE_FORMAT_TEXT"
+.LASF230:
+	.string	"buffer"
+.LASF350:
+	.string	"pipelined"
+.LASF343:
+	.string	"outputFileName"
+.LASF203:
+	.string	"memory"
+.LASF611:
+	.string	"lmsFilter_InitWithAllocator"
+.LASF494:
+	.string	"lmsCheckpoint_Row"
+.LASF315:
+	.string	"LMS_FILTER_VARIANT_LMS"
+.LASF42:
+	.string	"__lock"
+.LASF562:
+	.string	"left"
+.LASF573:
+	.string	"raised"
+.LASF456:
+	.string	"lmsPlot_Free"
+.LASF561:
+	.string	"lmsFilter_ChannelFinish"
+.LASF172:
+	.string	"ASYNC_FILE_BACKEND_STDIO"
+.LASF596:
+	.string	"lmsFilter_processArgumentVariant"
+.LASF406:
+	.string	"reader"
+.LASF87:
+	.string	"_offset"
+.LASF301:
+	.string	"convergedAt"
+.LASF618:
+	.string	"lmsFilter_ProcessBlockLms"
+.LASF188:
+	.string	"cqRing"
+.LASF592:
+	.string	"lmsFilter_processArgumentFilterLength"
+.LASF288:
+	.string	"LmsTelemetrySettings_t"
+.LASF580:
+	.string	"engineSettings"
+.LASF397:
+	.string	"index"
+.LASF423:
+	.string	"threadPool_Destroy"
+.LASF430:
+	.string	"lmsFilterBank_ProcessFrames"
+.LASF571:
+	.string	"lmsFilter_ChannelFilter"
+.LASF332:
+	.string	"LMS_FILTER_ALGORITHM_UNKNOWN"
+.LASF472:
+	.string	"lmsTelemetry_Update"
+.LASF194:
+	.string	"sqArray"
+.LASF243:
+	.string	"bufferSize"
+.LASF179:
+	.string	"ASYNC_FILE_BUFFER_DONE"
+.LASF52:
+	.string	"__g1_start"
+.LASF361:
+	.string	"normSquared"
+.LASF528:
+	.string	"lmsFilter_FileTask"
+.LASF337:
+	.string	"LMS_FILTER_ALGORITHM_RLS"
+.LASF15:
+	.string	"__uint64_t"
+.LASF296:
+	.string	"longMse"
+.LASF447:
+	.string	"spscRing_Free"
+.LASF2:
+	.string	"long unsigned int"
+.LASF197:
+	.string	"cqMask"
+.LASF605:
+	.string	"lmsFilter_PushSample"
+.LASF224:
+	.string	"format"
+.LASF518:
+	.string	"writers"
+.LASF171:
+	.string	"ASYNC_FILE_BACKEND_THREAD"
+.LASF58:
+	.string	"pthread_t"
+.LASF483:
+	.string	"strcpy"
+.LASF401:
+	.string	"status"
+.LASF81:
+	.string	"_flags2"
+.LASF533:
+	.string	"inputChannels"
+.LASF298:
+	.string	"shortDesiredPower"
+.LASF615:
+	.string	"lmsFilter_ProcessBlockSignError"
+.LASF407:
+	.string	"channel"
+.LASF69:
+	.string	"_IO_read_base"
+.LASF295:
+	.string	"shortMse"
+.LASF260:
+	.string	"bucketSize"
+.LASF169:
+	.string	"ASYNC_FILE_BACKEND_AUTO"
+.LASF159:
+	.string	"LmsKernelType_t"
+.LASF314:
+	.string	"LmsTelemetryStats_t"
+.LASF94:
+	.string	"_unused2"
+.LASF574:
+	.string	"warning"
+.LASF598:
+	.string	"lmsFilter_SaveCheckpoint"
+.LASF335:
+	.string	"LMS_FILTER_ALGORITHM_FIXED"
+.LASF380:
+	.string	"pending"
+.LASF619:
+	.string	"lmsFilter_ProcessBlockVariant"
+.LASF477:
+	.string	"lmsRealtime_Now"
+.LASF59:
+	.string	"__size"
+.LASF244:
+	.string	"bufferLength"
+.LASF287:
+	.string	"divergenceMargin"
+.LASF286:
+	.string	"convergenceLevel"
+.LASF104:
+	.string	"_ISxdigit"
+.LASF530:
+	.string	"lmsFilter_FilterRealtime"
+.LASF82:
+	.string	"_old_offset"
+.LASF212:
+	.string	"done"
+.LASF336:
+	.string	"LMS_FILTER_ALGORITHM_SUBBAND"
+.LASF502:
+	.string	"retval"
+.LASF511:
+	.string	"arenaAllocator"
+.LASF157:
+	.string	"LMS_KERNEL_AVX512"
+.LASF284:
+	.string	"longWindow"
+.LASF480:
+	.string	"lmsEngine_Open"
+.LASF325:
+	.string	"delayLine"
+.LASF303:
+	.string	"nextNormCheck"
+.LASF486:
+	.string	"snprintf"
+.LASF271:
+	.string	"maxNs"
+.LASF204:
+	.string	"buffers"
+.LASF318:
+	.string	"LMS_FILTER_VARIANT_SIGN_ERROR"
+.LASF581:
+	.string	"lmsFilter_Destroy"
+.LASF55:
+	.string	"__g1_orig_size"
+.LASF412:
+	.string	"LmsFilterChannelJob_t"
+.LASF426:
+	.string	"threadPool_Init"
+.LASF13:
+	.string	"__uint32_t"
+.LASF547:
+	.string	"desiredEnded"
+.LASF4:
+	.string	"long long int"
+.LASF262:
+	.string	"frames"
+.LASF457:
+	.string	"lmsPlot_Write"
+.LASF599:
+	.string	"lmsFilter_DescribeCheckpoint"
+.LASF251:
+	.string	"width"
+.LASF229:
+	.string	"dataBytesLeft"
+.LASF100:
+	.string	"_ISupper"
+.LASF570:
+	.string	"lmsFilter_ChannelWrite"
+.LASF173:
+	.string	"AsyncFileBackend_t"
+.LASF489:
+	.string	"__ctype_b_loc"
+.LASF113:
+	.string	"double"
+.LASF109:
+	.string	"_IScntrl"
+.LASF72:
+	.string	"_IO_write_end"
+.LASF226:
+	.string	"sampleRate"
+.LASF544:
+	.string	"grown"
+.LASF385:
+	.string	"slotSize"
+.LASF266:
+	.string	"paced"
+.LASF386:
+	.string	"closed"
+.LASF512:
+	.string	"opened"
+.LASF259:
+	.string	"buckets"
+.LASF448:
+	.string	"spscRing_Init"
+.LASF131:
+	.string	"rowStride"
+.LASF465:
+	.string	"spscRing_CommitWrite"
+.LASF400:
+	.string	"skip"
+.LASF542:
+	.string	"lmsFilter_ReadAll"
+.LASF112:
+	.string	"float"
+.LASF620:
+	.string	"lmsFilter_Lms"
+.LASF520:
+	.string	"zerosToAdd"
+.LASF61:
+	.string	"pthread_attr_t"
+.LASF373:
+	.string	"count"
+.LASF237:
+	.string	"ioData"
+.LASF214:
+	.string	"stop"
+.LASF56:
+	.string	"__wrefs"
+.LASF617:
+	.string	"lmsFilter_ProcessBlockNlms"
+.LASF578:
+	.string	"lmsFilter_ChannelEngine"
+.LASF73:
+	.string	"_IO_buf_base"
+.LASF365:
+	.string	"LmsEngineSettings_t"
+.LASF7:
+	.string	"unsigned int"
+.LASF559:
+	.string	"progress"
+.LASF463:
+	.string	"perror"
+.LASF416:
+	.string	"prototype"
+.LASF63:
+	.string	"pthread_mutex_t"
+.LASF438:
+	.string	"lmsRealtime_Record"
+.LASF403:
+	.string	"LmsFilterChannel_t"
+.LASF225:
+	.string	"channels"
+.LASF137:
+	.string	"position"
+.LASF92:
+	.string	"__pad5"
+.LASF242:
+	.string	"dataOffset"
+.LASF427:
+	.string	"lmsArena_Allocator"
+.LASF534:
+	.string	"results"
+.LASF268:
+	.string	"counts"
+.LASF158:
+	.string	"LMS_KERNEL_COUNT"
+.LASF433:
+	.string	"lmsFilterBank_Free"
+.LASF479:
+	.string	"lmsTelemetry_Init"
+.LASF613:
+	.string	"lmsFilter_ProcessBlockSignSign"
+.LASF363:
+	.string	"LmsEngineOps_t"
+.LASF464:
+	.string	"sampleIo_Write"
+.LASF572:
+	.string	"lmsFilter_ChannelPrintWarnings"
+.LASF514:
+	.string	"current"
+.LASF623:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF460:
+	.string	"sampleIo_CloseWriter"
+.LASF269:
+	.string	"total"
+.LASF66:
+	.string	"_flags"
+.LASF182:
+	.string	"offset"
+.LASF555:
+	.string	"lmsFilter_WriterStage"
+.LASF369:
+	.string	"ThreadPoolJob_t"
+.LASF388:
+	.string	"filter"
+.LASF166:
+	.string	"bankUpdateDot"
+.LASF93:
+	.string	"_mode"
+.LASF228:
+	.string	"fileSize"
+.LASF422:
+	.string	"lmsFilterVariantNames"
+.LASF190:
+	.string	"sqes"
+.LASF258:
+	.string	"sumSquares"
+.LASF88:
+	.string	"_codecvt"
+.LASF594:
+	.string	"lmsFilter_processArgumentAlgorithm"
+.LASF43:
+	.string	"__count"
+.LASF196:
+	.string	"cqTail"
+.LASF23:
+	.string	"off_t"
+.LASF554:
+	.string	"writerThread"
+.LASF451:
+	.string	"spscRing_Close"
+.LASF626:
+	.string	"lmsFilter_DelayLinePush"
+.LASF282:
+	.string	"LmsRealtimeStats_t"
+.LASF326:
+	.string	"delayIndex"
+.LASF134:
+	.string	"leakage"
+.LASF432:
+	.string	"calloc"
+.LASF344:
+	.string	"desiredFileName"
+.LASF140:
+	.string	"power"
+.LASF200:
+	.string	"AsyncFileRing_t"
+.LASF347:
+	.string	"numOfBands"
+.LASF552:
+	.string	"pipeline"
+.LASF621:
+	.string	"previous"
+.LASF462:
+	.string	"lmsCheckpoint_Open"
+.LASF99:
+	.string	"long double"
+.LASF532:
+	.string	"twoStreams"
+.LASF352:
+	.string	"telemetry"
+.LASF256:
+	.string	"minimum"
+.LASF560:
+	.string	"lmsFilter_ChannelClose"
+.LASF95:
+	.string	"FILE"
+.LASF612:
+	.string	"lmsFilter_Init"
+.LASF395:
+	.string	"primed"
+.LASF139:
+	.string	"checksum"
+.LASF553:
+	.string	"readerThread"
+.LASF36:
+	.string	"timespec"
+.LASF398:
+	.string	"positionBase"
+.LASF454:
+	.string	"sampleIo_GetProgress"
+.LASF421:
+	.string	"lmsFilterProcessBlocks"
+.LASF346:
+	.string	"numOfThreads"
+.LASF339:
+	.string	"LmsFilterAlgorithm_t"
+.LASF236:
+	.string	"async"
+.LASF102:
+	.string	"_ISalpha"
+.LASF154:
+	.string	"LMS_KERNEL_SCALAR"
+.LASF522:
+	.string	"zeros"
+.LASF174:
+	.string	"ASYNC_FILE_READ"
+.LASF119:
+	.string	"size"
+.LASF567:
+	.string	"lmsFilter_ChannelOpenCheckpoint"
+.LASF379:
+	.string	"allDone"
+.LASF519:
+	.string	"inputFrames"
+.LASF34:
+	.string	"long long unsigned int"
+.LASF312:
+	.string	"relativeMseDb"
+.LASF233:
+	.string	"textEnd"
+.LASF358:
+	.string	"output"
+.LASF283:
+	.string	"shortWindow"
+.LASF49:
+	.string	"__list"
+.LASF526:
+	.string	"lmsFilter_OpenWarmStart"
+.LASF444:
+	.string	"sampleIo_OpenReader"
+.LASF130:
+	.string	"length"
+.LASF291:
+	.string	"convergedLow"
+.LASF108:
+	.string	"_ISblank"
+.LASF16:
+	.string	"__off_t"
+.LASF503:
+	.string	"pool"
+.LASF410:
+	.string	"SpscRing_t"
+.LASF267:
+	.string	"LmsRealtimeSettings_t"
+.LASF54:
+	.string	"__g_size"
+.LASF311:
+	.string	"longMseDb"
+.LASF111:
+	.string	"_ISalnum"
+.LASF608:
+	.string	"coefficientBytes"
+.LASF35:
+	.string	"__atomic_wide_counter"
+.LASF591:
+	.string	"dotCounter"
+.LASF434:
+	.string	"lmsFilterBank_Init"
+.LASF425:
+	.string	"threadPool_Submit"
+.LASF91:
+	.string	"_freeres_buf"
+.LASF105:
+	.string	"_ISspace"
+.LASF531:
+	.string	"realtimeSettings"
+.LASF177:
+	.string	"ASYNC_FILE_BUFFER_FREE"
+.LASF211:
+	.string	"queued"
+.LASF601:
+	.string	"numOfSamples"
+.LASF376:
+	.string	"queues"
+.LASF607:
+	.string	"lmsFilter_InitVariant"
+.LASF18:
+	.string	"__time_t"
+.LASF25:
+	.string	"clockid_t"
+.LASF497:
+	.string	"memset"
+.LASF245:
+	.string	"SampleWriter_t"
+.LASF53:
+	.string	"__g_refs"
+.LASF417:
+	.string	"inputFileName"
+.LASF452:
+	.string	"sampleIo_Read"
+.LASF76:
+	.string	"_IO_backup_base"
+.LASF85:
+	.string	"_shortbuf"
+.LASF471:
+	.string	"lmsTelemetry_NormDue"
+.LASF202:
+	.string	"backend"
+.LASF270:
+	.string	"sumNs"
+.LASF558:
+	.string	"lmsFilter_PrintProgress"
+.LASF575:
+	.string	"lmsFilter_ChannelObserve"
+.LASF436:
+	.string	"lmsRealtime_GetStats"
+.LASF468:
+	.string	"lmsTelemetry_WarningName"
+.LASF484:
+	.string	"malloc"
+.LASF60:
+	.string	"__align"
+.LASF17:
+	.string	"__off64_t"
+.LASF359:
+	.string	"LmsFilterBank_t"
+.LASF276:
+	.string	"LmsRealtime_t"
+.LASF375:
+	.string	"threads"
+.LASF316:
+	.string	"LMS_FILTER_VARIANT_NLMS"
+.LASF330:
+	.string	"allocator"
+.LASF218:
+	.string	"SAMPLE_FORMAT_F32"
+.LASF535:
+	.string	"worker"
+.LASF351:
+	.string	"realtime"
+.LASF275:
+	.string	"histogram"
+.LASF208:
+	.string	"ring"
+.LASF249:
+	.string	"LmsPlotFormat_t"
+.LASF74:
+	.string	"_IO_buf_end"
+.LASF499:
+	.string	"lmsAllocator_Heap"
+.LASF529:
+	.string	"lmsFilter_ChannelTask"
+.LASF557:
+	.string	"samplesRead"
+.LASF413:
+	.string	"desired"
+.LASF392:
+	.string	"ownsFilter"
+.LASF209:
+	.string	"thread"
+.LASF187:
+	.string	"sqRingSize"
+.LASF161:
+	.string	"name"
+.LASF191:
+	.string	"sqesSize"
+.LASF576:
+	.string	"lmsFilter_ChannelPush"
+.LASF51:
+	.string	"__wseq"
+.LASF441:
+	.string	"lmsRealtime_ConfigureThread"
+.LASF101:
+	.string	"_ISlower"
+.LASF327:
+	.string	"leak"
+.LASF321:
+	.string	"LMS_FILTER_VARIANT_COUNT"
+.LASF545:
+	.string	"lmsFilter_FilterTwoStreams"
+.LASF121:
+	.string	"LmsArena_t"
+.LASF383:
+	.string	"ThreadPool_t"
+.LASF11:
+	.string	"short int"
+.LASF309:
+	.string	"LmsTelemetry_t"
+.LASF467:
+	.string	"spscRing_AcquireWrite"
+.LASF205:
+	.string	"submitted"
+.LASF220:
+	.string	"SAMPLE_FORMAT_WAV_S16"
+.LASF124:
+	.string	"uint64_t"
+.LASF201:
+	.string	"mode"
+.LASF265:
+	.string	"priority"
+.LASF593:
+	.string	"filterLength"
+.LASF29:
+	.string	"tv_nsec"
+.LASF584:
+	.string	"filteredFileSuffix"
+.LASF579:
+	.string	"lmsFilter_ChannelOpen"
+.LASF300:
+	.string	"holdStart"
+.LASF84:
+	.string	"_vtable_offset"
+.LASF48:
+	.string	"__elision"
+.LASF524:
+	.string	"lmsFilter_CreateChannelsCheckpoint"
+.LASF540:
+	.string	"lmsFilter_RealtimeWorker"
+.LASF420:
+	.string	"LmsFilterFileJob_t"
+.LASF50:
+	.string	"__pthread_cond_s"
+.LASF622:
+	.string	"dropped"
+.LASF306:
+	.string	"peakNorm"
+.LASF393:
+	.string	"ownedFileName"
+.LASF176:
+	.string	"AsyncFileMode_t"
+.LASF57:
+	.string	"__g_signals"
+.LASF349:
+	.string	"useBank"
+.LASF364:
+	.string	"LmsEngine_t"
+.LASF125:
+	.string	"magic"
+.LASF186:
+	.string	"sqRing"
+.LASF206:
+	.string	"completed"
+.LASF384:
+	.string	"slots"
+.LASF255:
+	.string	"names"
+.LASF117:
+	.string	"LmsAllocator_t"
+.LASF505:
+	.string	"lmsFilter_FilterFiles"
+.LASF281:
+	.string	"meanNs"
+.LASF165:
+	.string	"signUpdateDot"
+.LASF485:
+	.string	"strlen"
+.LASF14:
+	.string	"__int64_t"
+.LASF495:
+	.string	"lmsCheckpoint_Create"
+.LASF141:
+	.string	"pendingGain"
+.LASF290:
+	.string	"longWeight"
+.LASF455:
+	.string	"lmsEngine_Close"
+.LASF493:
+	.string	"memcpy"
+.LASF445:
+	.string	"pthread_join"
+.LASF193:
+	.string	"sqMask"
+.LASF68:
+	.string	"_IO_read_end"
+.LASF227:
+	.string	"numOfFrames"
+.LASF543:
+	.string	"padding"
+.LASF550:
+	.string	"skipped"
+.LASF277:
+	.string	"blocks"
+.LASF506:
+	.string	"lmsFilter_FilterInterleavedFile"
+.LASF123:
+	.string	"uint32_t"
+.LASF588:
+	.string	"stepSize"
+.LASF527:
+	.string	"lmsFilter_FilterSignalAndSaveToFile"
+.LASF80:
+	.string	"_fileno"
+.LASF405:
+	.string	"LmsFilterOutputBlock_t"
+.LASF614:
+	.string	"lmsFilter_ProcessBlockSignData"
+.LASF178:
+	.string	"ASYNC_FILE_BUFFER_QUEUED"
+.LASF115:
+	.string	"release"
+.LASF89:
+	.string	"_wide_data"
+.LASF142:
+	.string	"reserved"
+.LASF517:
+	.string	"bank"
+.LASF481:
+	.string	"free"
+.LASF103:
+	.string	"_ISdigit"
+.LASF482:
+	.string	"strcat"
+.LASF213:
+	.string	"serviced"
+.LASF6:
+	.string	"short unsigned int"
+.LASF625:
+	.string	"stdout"
+.LASF563:
+	.string	"lmsFilter_ChannelFeed"
+.LASF500:
+	.string	"lmsAllocator_AlignedSize"
+.LASF320:
+	.string	"LMS_FILTER_VARIANT_SIGN_SIGN"
+.LASF469:
+	.string	"lmsTelemetry_UpdateNorm"
+.LASF118:
+	.string	"base"
+.LASF322:
+	.string	"LmsFilterVariant_t"
+.LASF536:
+	.string	"firstColumn"
+.LASF71:
+	.string	"_IO_write_ptr"
+.LASF305:
+	.string	"convergedNorm"
+.LASF391:
+	.string	"writerOpen"
+.LASF443:
+	.string	"sampleIo_CloseReader"
+.LASF353:
+	.string	"checkpoint"
+.LASF440:
+	.string	"clock_gettime"
+.LASF414:
+	.string	"processed"
+.LASF12:
+	.string	"__int32_t"
+.LASF27:
+	.string	"int64_t"
+.LASF235:
+	.string	"textEof"
+.LASF310:
+	.string	"shortMseDb"
+.LASF377:
+	.string	"numOfQueues"
+.LASF252:
+	.string	"LmsPlotSettings_t"
+.LASF516:
+	.string	"failed"
+.LASF589:
+	.string	"character"
+.LASF356:
+	.string	"LmsFilterFileSettings_t"
+.LASF515:
+	.string	"next"
+.LASF313:
+	.string	"normDriftDb"
+.LASF181:
+	.string	"data"
+.LASF362:
+	.string	"close"
+.LASF453:
+	.string	"fflush"
+.LASF199:
+	.string	"registered"
+.LASF254:
+	.string	"numOfSeries"
+.LASF28:
+	.string	"tv_sec"
+.LASF345:
+	.string	"twoColumn"
+.LASF458:
+	.string	"lmsTelemetry_PrintStats"
+.LASF399:
+	.string	"nextCheckpoint"
+.LASF164:
+	.string	"leakyUpdateDot"
+.LASF466:
+	.string	"lmsPlot_AddFrames"
+.LASF323:
+	.string	"LmsFilter_t"
+.LASF153:
+	.string	"LmsCheckpointSettings_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"source/lmsFilter.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2259 @@
+	.file	"lmsFilterBank.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsFilterBank.c"
+	.type	lmsFilterBank_DelayLinePush, @function
+lmsFilterBank_DelayLinePush:
+.LFB6:
+	.file 1 "source/lmsFilterBank.c"
+	.loc 1 23 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	.loc 1 24 26
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 24 15
+	add	eax, 1
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 25 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR 24[rax]
+	.loc 1 25 47
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 25 35
+	movsx	rdx, eax
+	.loc 1 25 66
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 25 60
+	imul	rax, rdx
+	.loc 1 25 34
+	sal	rax, 2
+	.loc 1 25 12
+	add	rax, rcx
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 26 26
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR 24[rax]
+	.loc 1 26 51
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR 32[rax]
+	.loc 1 26 64
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, edx
+	.loc 1 26 38
+	movsx	rdx, eax
+	.loc 1 26 78
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 26 72
+	imul	rax, rdx
+	.loc 1 26 37
+	sal	rax, 2
+	.loc 1 26 12
+	add	rax, rcx
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 28 28
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	cdqe
+	.loc 1 28 5
+	lea	rdx, 0[0+rax*4]
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 29 31
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	cdqe
+	.loc 1 29 5
+	lea	rdx, 0[0+rax*4]
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 31 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 31 9
+	lea	edx, 1[rax]
+	.loc 1 31 8
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 32[rax], edx
+	.loc 1 31 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 31 8
+	cmp	DWORD PTR -4[rbp], eax
+	jne	.L3
+	.loc 1 33 26
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 32[rax], 0
+.L3:
+	.loc 1 35 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	lmsFilterBank_DelayLinePush, .-lmsFilterBank_DelayLinePush
+	.section	.rodata
+.LC0:
+	.string	"Wrong filter bank parameters"
+.LC1:
+	.string	"Error allocating filter bank"
+	.text
+	.globl	lmsFilterBank_Init
+	.type	lmsFilterBank_Init, @function
+lmsFilterBank_Init:
+.LFB7:
+	.loc 1 38 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	movss	DWORD PTR -44[rbp], xmm0
+	mov	DWORD PTR -48[rbp], esi
+	mov	DWORD PTR -52[rbp], edx
+	.loc 1 39 8
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L5
+	.loc 1 39 24 discriminator 1
+	cmp	DWORD PTR -48[rbp], 0
+	jle	.L5
+	.loc 1 39 40 discriminator 2
+	cmp	DWORD PTR -52[rbp], 0
+	jg	.L6
+.L5:
+	.loc 1 41 9
+	lea	rax, .LC0[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 42 16
+	mov	eax, 1
+	jmp	.L7
+.L6:
+	.loc 1 45 5
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, 72
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 46 16
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR -44[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 47 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -48[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 48 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	DWORD PTR 8[rax], edx
+	.loc 1 49 59
+	mov	eax, DWORD PTR -52[rbp]
+	add	eax, 15
+	.loc 1 49 64
+	lea	edx, 15[rax]
+	test	eax, eax
+	cmovs	eax, edx
+	sar	eax, 4
+	.loc 1 49 88
+	sal	eax, 4
+	mov	edx, eax
+	.loc 1 49 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 12[rax], edx
+	.loc 1 50 20
+	call	lmsKernel_GetBest@PLT
+	.loc 1 50 18
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 56[rdx], rax
+	.loc 1 53 41
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 53 29
+	cdqe
+	.loc 1 53 18
+	sal	rax, 2
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 54 30
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	.loc 1 54 52
+	mov	edx, DWORD PTR -48[rbp]
+	movsx	rdx, edx
+	.loc 1 54 67
+	add	rdx, 1
+	.loc 1 54 49
+	add	rdx, rdx
+	.loc 1 54 45
+	add	rax, rdx
+	.loc 1 54 18
+	add	rax, 2
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 55 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 56 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	r8, QWORD PTR [rax]
+	.loc 1 56 20
+	mov	rax, QWORD PTR -16[rbp]
+	imul	rax, QWORD PTR -8[rbp]
+	mov	rcx, rax
+	.loc 1 56 39
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 56 20
+	mov	edx, 64
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	r8
+.LVL0:
+	.loc 1 56 18
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 64[rdx], rax
+	.loc 1 57 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 57 8
+	test	rax, rax
+	jne	.L8
+	.loc 1 59 9
+	lea	rax, .LC1[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 60 16
+	mov	eax, 1
+	jmp	.L7
+.L8:
+	.loc 1 62 5
+	mov	rax, QWORD PTR -16[rbp]
+	imul	rax, QWORD PTR -8[rbp]
+	mov	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 64 38
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 64[rax]
+	.loc 1 64 24
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 65 28
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR 16[rax]
+	.loc 1 65 43
+	mov	eax, DWORD PTR -48[rbp]
+	movsx	rdx, eax
+	.loc 1 65 64
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 65 58
+	imul	rax, rdx
+	.loc 1 65 42
+	sal	rax, 2
+	.loc 1 65 23
+	lea	rdx, [rcx+rax]
+	.loc 1 65 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 66 30
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 66 47
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	.loc 1 66 62
+	lea	rcx, 1[rax]
+	.loc 1 66 73
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 66 25
+	imul	rax, rcx
+	sal	rax, 3
+	add	rdx, rax
+	.loc 1 66 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 40[rax], rdx
+	.loc 1 67 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 67 43
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 67 38
+	sal	rax, 2
+	.loc 1 67 20
+	add	rdx, rax
+	.loc 1 67 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 69 12
+	mov	eax, 0
+.L7:
+	.loc 1 70 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	lmsFilterBank_Init, .-lmsFilterBank_Init
+	.globl	lmsFilterBank_Free
+	.type	lmsFilterBank_Free, @function
+lmsFilterBank_Free:
+.LFB8:
+	.loc 1 73 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 74 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 76 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 76 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 64[rax]
+	.loc 1 76 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 76 5
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+	.loc 1 77 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 64[rax], 0
+	.loc 1 78 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 79 21
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 24[rax], 0
+	.loc 1 80 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 40[rax], 0
+	.loc 1 81 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 48[rax], 0
+	.loc 1 82 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	lmsFilterBank_Free, .-lmsFilterBank_Free
+	.globl	lmsFilterBank_PushFrame
+	.type	lmsFilterBank_PushFrame, @function
+lmsFilterBank_PushFrame:
+.LFB9:
+	.loc 1 85 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	.loc 1 86 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	lmsFilterBank_FlushUpdate
+	.loc 1 87 5
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilterBank_DelayLinePush
+	.loc 1 88 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	lmsFilterBank_PushFrame, .-lmsFilterBank_PushFrame
+	.globl	lmsFilterBank_FlushUpdate
+	.type	lmsFilterBank_FlushUpdate, @function
+lmsFilterBank_FlushUpdate:
+.LFB10:
+	.loc 1 91 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -56[rbp], rdi
+	.loc 1 92 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 93 32
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR 24[rax]
+	.loc 1 93 57
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 93 70
+	add	eax, 1
+	.loc 1 93 44
+	movsx	rdx, eax
+	.loc 1 93 75
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 93 43
+	sal	rax, 2
+	.loc 1 93 18
+	add	rax, rcx
+	mov	QWORD PTR -24[rbp], rax
+.LBB2:
+	.loc 1 95 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 95 5
+	jmp	.L12
+.L15:
+.LBB3:
+	.loc 1 97 25
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR 16[rax]
+	.loc 1 97 40
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 97 50
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 97 39
+	sal	rax, 2
+	.loc 1 97 16
+	add	rax, rcx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 98 34
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 98 44
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 98 33
+	lea	rdx, 0[0+rax*4]
+	.loc 1 98 22
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -40[rbp], rax
+.LBB4:
+	.loc 1 100 18
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 100 9
+	jmp	.L13
+.L14:
+	.loc 1 102 14 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 102 26 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 102 39 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 102 47 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 102 44 discriminator 3
+	mulss	xmm0, xmm2
+	.loc 1 102 14 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 102 19 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 100 41 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L13:
+	.loc 1 100 29 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jl	.L14
+.LBE4:
+.LBE3:
+	.loc 1 95 40 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L12:
+	.loc 1 95 29 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 95 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], eax
+	jl	.L15
+.LBE2:
+	.loc 1 105 5
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 105 16
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 105 5
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 106 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	lmsFilterBank_FlushUpdate, .-lmsFilterBank_FlushUpdate
+	.globl	lmsFilterBank_ProcessFrames
+	.type	lmsFilterBank_ProcessFrames, @function
+lmsFilterBank_ProcessFrames:
+.LFB11:
+	.loc 1 110 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 112
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	QWORD PTR -88[rbp], rdx
+	mov	QWORD PTR -96[rbp], rcx
+	mov	QWORD PTR -104[rbp], r8
+	mov	DWORD PTR -108[rbp], r9d
+	.loc 1 111 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -16[rbp], eax
+	.loc 1 112 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	mov	DWORD PTR -20[rbp], eax
+.LBB5:
+	.loc 1 114 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 114 5
+	jmp	.L17
+.L24:
+.LBB6:
+	.loc 1 116 30
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 116 40
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	.loc 1 116 22
+	imul	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 118 49
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 118 9
+	mov	rax, QWORD PTR -80[rbp]
+	add	rdx, rax
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsFilterBank_DelayLinePush
+	.loc 1 120 38
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rcx, QWORD PTR 24[rax]
+	.loc 1 120 62
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 120 50
+	movsx	rdx, eax
+	.loc 1 120 75
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 120 49
+	sal	rax, 2
+	.loc 1 120 22
+	add	rax, rcx
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 121 41
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 121 22
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 123 13
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 123 21
+	mov	r10, QWORD PTR 56[rax]
+	.loc 1 123 9
+	mov	rax, QWORD PTR -72[rbp]
+	mov	r9d, DWORD PTR 4[rax]
+	mov	rax, QWORD PTR -72[rbp]
+	mov	r8, QWORD PTR 48[rax]
+	.loc 1 123 80
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rcx, QWORD PTR 40[rax]
+	.loc 1 123 9
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	sub	rsp, 8
+	mov	edi, DWORD PTR -20[rbp]
+	push	rdi
+	mov	rdi, rax
+	call	r10
+.LVL2:
+	add	rsp, 16
+.LBB7:
+	.loc 1 126 18
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 126 9
+	jmp	.L18
+.L23:
+.LBB8:
+	.loc 1 128 33
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 128 41
+	mov	edx, DWORD PTR -8[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 128 25
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -52[rbp], xmm0
+	.loc 1 129 70
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L19
+	.loc 1 129 64 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 129 57 discriminator 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 129 70 discriminator 1
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L20
+.L19:
+	.loc 1 129 79 discriminator 2
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 129 70 discriminator 2
+	movss	xmm0, DWORD PTR [rax]
+.L20:
+	.loc 1 129 25 discriminator 4
+	subss	xmm0, DWORD PTR -52[rbp]
+	movss	DWORD PTR -56[rbp], xmm0
+	.loc 1 131 41 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 131 17 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 131 30 discriminator 4
+	mov	edx, DWORD PTR -8[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 131 48 discriminator 4
+	mulss	xmm0, DWORD PTR -56[rbp]
+	.loc 1 131 35 discriminator 4
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 132 16 discriminator 4
+	cmp	QWORD PTR -96[rbp], 0
+	je	.L21
+	.loc 1 134 30
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 134 23
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 134 36
+	movss	xmm0, DWORD PTR -52[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L21:
+	.loc 1 136 16
+	cmp	QWORD PTR -104[rbp], 0
+	je	.L22
+	.loc 1 138 29
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 138 22
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 138 35
+	movss	xmm0, DWORD PTR -56[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L22:
+.LBE8:
+	.loc 1 126 43 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L18:
+	.loc 1 126 29 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -16[rbp]
+	jl	.L23
+.LBE7:
+.LBE6:
+	.loc 1 114 39 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L17:
+	.loc 1 114 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -108[rbp]
+	jl	.L24
+.LBE5:
+.LBB9:
+	.loc 1 144 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 144 5
+	jmp	.L25
+.L28:
+	.loc 1 146 13
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	movss	xmm1, DWORD PTR .LC2[rip]
+	andps	xmm1, xmm0
+	movss	xmm0, DWORD PTR .LC3[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 146 12
+	test	eax, eax
+	jne	.L26
+	.loc 1 148 20
+	mov	eax, 1
+	jmp	.L27
+.L26:
+	.loc 1 144 39 discriminator 2
+	add	DWORD PTR -12[rbp], 1
+.L25:
+	.loc 1 144 25 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -16[rbp]
+	jl	.L28
+.LBE9:
+	.loc 1 151 12
+	mov	eax, 0
+.L27:
+	.loc 1 152 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	lmsFilterBank_ProcessFrames, .-lmsFilterBank_ProcessFrames
+	.section	.rodata
+	.align 16
+.LC2:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC3:
+	.long	2139095039
+	.text
+.Letext0:
+	.file 2 "include/lmsAllocator.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "include/lmsKernel.h"
+	.file 5 "include/lmsFilterBank.h"
+	.file 6 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x71f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x13
+	.long	.LASF70
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xa
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0x9
+	.long	0x2e
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x46
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x15
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x9
+	.long	0x85
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x16
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x9
+	.long	0xa3
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x5
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0xd
+	.byte	0x18
+	.byte	0x2
+	.byte	0x10
+	.long	0xed
+	.uleb128 0x2
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x13
+	.byte	0xd
+	.long	0x106
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x16
+	.byte	0xc
+	.long	0x11b
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x18
+	.byte	0xb
+	.long	0x83
+	.byte	0x10
+	.byte	0
+	.uleb128 0xc
+	.long	0x83
+	.long	0x106
+	.uleb128 0x1
+	.long	0x83
+	.uleb128 0x1
+	.long	0x2e
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	0xed
+	.uleb128 0xe
+	.long	0x11b
+	.uleb128 0x1
+	.long	0x83
+	.uleb128 0x1
+	.long	0x83
+	.byte	0
+	.uleb128 0x4
+	.long	0x10b
+	.uleb128 0xa
+	.long	.LASF19
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0xbd
+	.uleb128 0x9
+	.long	0x120
+	.uleb128 0x17
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0x4
+	.byte	0xf
+	.byte	0x1
+	.long	0x15e
+	.uleb128 0xb
+	.long	.LASF20
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF21
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF22
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF23
+	.byte	0x3
+	.uleb128 0xb
+	.long	.LASF24
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x15
+	.byte	0x3
+	.long	0x131
+	.uleb128 0xd
+	.byte	0x40
+	.byte	0x4
+	.byte	0x17
+	.long	0x1db
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x19
+	.byte	0x15
+	.long	0x15e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x11
+	.long	0x9e
+	.byte	0x8
+	.uleb128 0x18
+	.string	"dot"
+	.byte	0x4
+	.byte	0x1d
+	.byte	0xd
+	.long	0x1f9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x20
+	.byte	0xc
+	.long	0x21d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x23
+	.byte	0xd
+	.long	0x245
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x27
+	.byte	0xd
+	.long	0x272
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xd
+	.long	0x245
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x30
+	.byte	0xc
+	.long	0x2a0
+	.byte	0x38
+	.byte	0
+	.uleb128 0xc
+	.long	0xa3
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x4
+	.long	0xaa
+	.uleb128 0x4
+	.long	0x1db
+	.uleb128 0xe
+	.long	0x218
+	.uleb128 0x1
+	.long	0x218
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0xa3
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x4
+	.long	0xa3
+	.uleb128 0x4
+	.long	0x1fe
+	.uleb128 0xc
+	.long	0xa3
+	.long	0x245
+	.uleb128 0x1
+	.long	0x218
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0xa3
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x4
+	.long	0x222
+	.uleb128 0xc
+	.long	0xa3
+	.long	0x272
+	.uleb128 0x1
+	.long	0x218
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0xa3
+	.uleb128 0x1
+	.long	0xa3
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x4
+	.long	0x24a
+	.uleb128 0xe
+	.long	0x2a0
+	.uleb128 0x1
+	.long	0x218
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0x1f4
+	.uleb128 0x1
+	.long	0x218
+	.uleb128 0x1
+	.long	0x46
+	.uleb128 0x1
+	.long	0x46
+	.byte	0
+	.uleb128 0x4
+	.long	0x277
+	.uleb128 0xa
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x32
+	.byte	0x3
+	.long	0x16a
+	.uleb128 0x9
+	.long	0x2a5
+	.uleb128 0xd
+	.byte	0x48
+	.byte	0x5
+	.byte	0xf
+	.long	0x34e
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x5
+	.byte	0x11
+	.byte	0xb
+	.long	0xa3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x12
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x13
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x14
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x15
+	.byte	0xc
+	.long	0x218
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x16
+	.byte	0xc
+	.long	0x218
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x17
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF41
+	.byte	0x5
+	.byte	0x18
+	.byte	0xc
+	.long	0x218
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x19
+	.byte	0xc
+	.long	0x218
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x18
+	.long	0x34e
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF44
+	.byte	0x5
+	.byte	0x1b
+	.byte	0xb
+	.long	0x83
+	.byte	0x40
+	.byte	0
+	.uleb128 0x4
+	.long	0x2b1
+	.uleb128 0xa
+	.long	.LASF45
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x3
+	.long	0x2b6
+	.uleb128 0x10
+	.long	.LASF48
+	.byte	0x2b
+	.long	0x83
+	.long	0x37d
+	.uleb128 0x1
+	.long	0x83
+	.uleb128 0x1
+	.long	0x98
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF46
+	.byte	0x2
+	.byte	0x27
+	.byte	0x17
+	.long	0x389
+	.uleb128 0x4
+	.long	0x12c
+	.uleb128 0x11
+	.long	.LASF47
+	.byte	0x4
+	.byte	0x47
+	.byte	0x14
+	.long	0x34e
+	.uleb128 0x10
+	.long	.LASF49
+	.byte	0x3d
+	.long	0x83
+	.long	0x3b8
+	.uleb128 0x1
+	.long	0x83
+	.uleb128 0x1
+	.long	0x46
+	.uleb128 0x1
+	.long	0x2e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF64
+	.byte	0x6c
+	.long	0x46
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x517
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x6c
+	.byte	0x32
+	.long	0x517
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.long	.LASF51
+	.byte	0x6c
+	.byte	0x45
+	.long	0x1f4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x3
+	.long	.LASF52
+	.byte	0x6c
+	.byte	0x59
+	.long	0x1f4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x3
+	.long	.LASF42
+	.byte	0x6d
+	.byte	0x28
+	.long	0x218
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0x6d
+	.byte	0x37
+	.long	0x218
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0x6d
+	.byte	0x42
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0x6
+	.long	.LASF55
+	.byte	0x6f
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x6
+	.long	.LASF37
+	.byte	0x70
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x19
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.long	0x4f7
+	.uleb128 0x7
+	.string	"n"
+	.byte	0x72
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x8
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x6
+	.long	.LASF56
+	.byte	0x74
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF57
+	.byte	0x78
+	.byte	0x16
+	.long	0x1f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0x79
+	.byte	0x16
+	.long	0x1f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x7
+	.string	"ch"
+	.byte	0x7e
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x80
+	.byte	0x19
+	.long	0xaa
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x7
+	.string	"e"
+	.byte	0x81
+	.byte	0x19
+	.long	0xaa
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x7
+	.string	"ch"
+	.byte	0x90
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x353
+	.uleb128 0xf
+	.long	.LASF60
+	.byte	0x5a
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5cb
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x5a
+	.byte	0x31
+	.long	0x517
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6
+	.long	.LASF37
+	.byte	0x5c
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x6
+	.long	.LASF59
+	.byte	0x5d
+	.byte	0x12
+	.long	0x1f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x7
+	.string	"k"
+	.byte	0x5f
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x8
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x7
+	.string	"c"
+	.byte	0x61
+	.byte	0x10
+	.long	0x218
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x62
+	.byte	0x16
+	.long	0x1f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x7
+	.string	"ch"
+	.byte	0x64
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF61
+	.byte	0x54
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x604
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x54
+	.byte	0x2f
+	.long	0x517
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x54
+	.byte	0x42
+	.long	0x1f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF62
+	.byte	0x48
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x63d
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x48
+	.byte	0x2a
+	.long	0x517
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF63
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x389
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF65
+	.byte	0x25
+	.long	0x46
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6c1
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x25
+	.byte	0x29
+	.long	0x517
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x25
+	.byte	0x35
+	.long	0xa3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x25
+	.byte	0x3f
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x25
+	.byte	0x4b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x6
+	.long	.LASF66
+	.byte	0x35
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.long	.LASF67
+	.byte	0x36
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x6
+	.long	.LASF63
+	.byte	0x37
+	.byte	0x1b
+	.long	0x389
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF71
+	.byte	0x1
+	.byte	0x16
+	.byte	0x14
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x3
+	.long	.LASF50
+	.byte	0x16
+	.byte	0x41
+	.long	0x517
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF56
+	.byte	0x16
+	.byte	0x54
+	.long	0x1f4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF68
+	.byte	0x18
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x7
+	.string	"row"
+	.byte	0x19
+	.byte	0xc
+	.long	0x218
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x6
+	.long	.LASF69
+	.byte	0x1a
+	.byte	0xc
+	.long	0x218
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF45:
+	.string	"LmsFilterBank_t"
+.LASF56:
+	.string	"frame"
+.LASF18:
+	.string	"size_t"
+.LASF57:
+	.string	"previous"
+.LASF26:
+	.string	"type"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF24:
+	.string	"LMS_KERNEL_COUNT"
+.LASF25:
+	.string	"LmsKernelType_t"
+.LASF30:
+	.string	"leakyUpdateDot"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF16:
+	.string	"release"
+.LASF66:
+	.string	"rowBytes"
+.LASF39:
+	.string	"delayLine"
+.LASF55:
+	.string	"channels"
+.LASF3:
+	.string	"long int"
+.LASF48:
+	.string	"memcpy"
+.LASF13:
+	.string	"double"
+.LASF23:
+	.string	"LMS_KERNEL_AVX512"
+.LASF31:
+	.string	"signUpdateDot"
+.LASF44:
+	.string	"memory"
+.LASF7:
+	.string	"unsigned int"
+.LASF20:
+	.string	"LMS_KERNEL_SCALAR"
+.LASF2:
+	.string	"long unsigned int"
+.LASF27:
+	.string	"name"
+.LASF68:
+	.string	"size"
+.LASF6:
+	.string	"short unsigned int"
+.LASF59:
+	.string	"window"
+.LASF22:
+	.string	"LMS_KERNEL_AVX2"
+.LASF67:
+	.string	"numOfRows"
+.LASF61:
+	.string	"lmsFilterBank_PushFrame"
+.LASF42:
+	.string	"output"
+.LASF14:
+	.string	"long double"
+.LASF21:
+	.string	"LMS_KERNEL_SSE2"
+.LASF29:
+	.string	"updateDot"
+.LASF65:
+	.string	"lmsFilterBank_Init"
+.LASF64:
+	.string	"lmsFilterBank_ProcessFrames"
+.LASF12:
+	.string	"float"
+.LASF53:
+	.string	"error"
+.LASF62:
+	.string	"lmsFilterBank_Free"
+.LASF19:
+	.string	"LmsAllocator_t"
+.LASF71:
+	.string	"lmsFilterBank_DelayLinePush"
+.LASF5:
+	.string	"unsigned char"
+.LASF34:
+	.string	"step"
+.LASF9:
+	.string	"short int"
+.LASF46:
+	.string	"lmsAllocator_Heap"
+.LASF38:
+	.string	"coefficients"
+.LASF40:
+	.string	"delayIndex"
+.LASF47:
+	.string	"lmsKernel_GetBest"
+.LASF52:
+	.string	"desired"
+.LASF51:
+	.string	"input"
+.LASF58:
+	.string	"current"
+.LASF37:
+	.string	"stride"
+.LASF63:
+	.string	"heap"
+.LASF35:
+	.string	"length"
+.LASF10:
+	.string	"char"
+.LASF70:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF41:
+	.string	"pendingGain"
+.LASF36:
+	.string	"numOfChannels"
+.LASF17:
+	.string	"context"
+.LASF50:
+	.string	"bank"
+.LASF28:
+	.string	"update"
+.LASF49:
+	.string	"memset"
+.LASF69:
+	.string	"mirror"
+.LASF32:
+	.string	"bankUpdateDot"
+.LASF60:
+	.string	"lmsFilterBank_FlushUpdate"
+.LASF54:
+	.string	"numOfFrames"
+.LASF43:
+	.string	"kernel"
+.LASF33:
+	.string	"LmsKernel_t"
+.LASF15:
+	.string	"allocate"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/lmsFilterBank.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
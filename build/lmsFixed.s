@@ -0,0 +1,6770 @@
+	.file	"lmsFixed.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsFixed.c"
+	.type	lmsFixed_Saturate, @function
+lmsFixed_Saturate:
+.LFB4831:
+	.file 1 "source/lmsFixed.c"
+	.loc 1 32 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -4[rbp], edi
+	mov	DWORD PTR -8[rbp], esi
+	mov	DWORD PTR -12[rbp], edx
+	.loc 1 33 12
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -12[rbp]
+	jle	.L2
+	.loc 1 33 12 is_stmt 0 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	jmp	.L6
+.L2:
+	.loc 1 33 12 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -8[rbp]
+	jge	.L4
+	.loc 1 33 12 discriminator 4
+	mov	eax, DWORD PTR -8[rbp]
+	jmp	.L6
+.L4:
+	.loc 1 33 12 discriminator 5
+	mov	eax, DWORD PTR -4[rbp]
+.L6:
+	.loc 1 34 1 is_stmt 1 discriminator 9
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4831:
+	.size	lmsFixed_Saturate, .-lmsFixed_Saturate
+	.type	lmsFixed_UpdateDotScalar, @function
+lmsFixed_UpdateDotScalar:
+.LFB4832:
+	.loc 1 42 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	mov	eax, ecx
+	mov	DWORD PTR -64[rbp], r8d
+	mov	WORD PTR -60[rbp], ax
+	.loc 1 43 13
+	mov	QWORD PTR -8[rbp], 0
+.LBB106:
+	.loc 1 45 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 45 5
+	jmp	.L8
+.L9:
+.LBB107:
+	.loc 1 47 32 discriminator 3
+	movsx	edx, WORD PTR -60[rbp]
+	.loc 1 47 56 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rcx, [rax+rax]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rcx
+	movzx	eax, WORD PTR [rax]
+	cwde
+	.loc 1 47 46 discriminator 3
+	imul	eax, edx
+	.loc 1 47 60 discriminator 3
+	add	eax, 16384
+	.loc 1 47 23 discriminator 3
+	sar	eax, 15
+	mov	DWORD PTR -16[rbp], eax
+	.loc 1 48 57 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	movsx	edx, ax
+	.loc 1 48 27 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	add	eax, edx
+	mov	edx, 32767
+	mov	esi, -32767
+	mov	edi, eax
+	call	lmsFixed_Saturate
+	mov	WORD PTR -18[rbp], ax
+	.loc 1 49 21 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rdx, rax
+	.loc 1 49 25 discriminator 3
+	movzx	eax, WORD PTR -18[rbp]
+	mov	WORD PTR [rdx], ax
+	.loc 1 50 16 discriminator 3
+	movsx	edx, WORD PTR -18[rbp]
+	.loc 1 50 36 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rcx, [rax+rax]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rcx
+	movzx	eax, WORD PTR [rax]
+	cwde
+	.loc 1 50 27 discriminator 3
+	imul	eax, edx
+	cdqe
+	.loc 1 50 13 discriminator 3
+	add	QWORD PTR -8[rbp], rax
+.LBE107:
+	.loc 1 45 34 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L8:
+	.loc 1 45 23 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -64[rbp]
+	jl	.L9
+.LBE106:
+	.loc 1 52 12
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 53 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4832:
+	.size	lmsFixed_UpdateDotScalar, .-lmsFixed_UpdateDotScalar
+	.type	lmsFixed_UpdateDotSse2, @function
+lmsFixed_UpdateDotSse2:
+.LFB4833:
+	.loc 1 64 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 904
+	.cfi_offset 3, -24
+	mov	QWORD PTR -888[rbp], rdi
+	mov	QWORD PTR -896[rbp], rsi
+	mov	QWORD PTR -904[rbp], rdx
+	mov	eax, ecx
+	mov	DWORD PTR -912[rbp], r8d
+	mov	WORD PTR -908[rbp], ax
+	.loc 1 65 23
+	movsx	eax, WORD PTR -908[rbp]
+	mov	WORD PTR -246[rbp], ax
+.LBB108:
+.LBB109:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.loc 2 650 10
+	movsx	eax, WORD PTR -246[rbp]
+	movsx	edx, WORD PTR -246[rbp]
+	movsx	ecx, WORD PTR -246[rbp]
+	movsx	esi, WORD PTR -246[rbp]
+	movsx	edi, WORD PTR -246[rbp]
+	movsx	r8d, WORD PTR -246[rbp]
+	movsx	r9d, WORD PTR -246[rbp]
+	movsx	r10d, WORD PTR -246[rbp]
+	mov	WORD PTR -248[rbp], r10w
+	mov	WORD PTR -250[rbp], r9w
+	mov	WORD PTR -252[rbp], r8w
+	mov	WORD PTR -254[rbp], di
+	mov	WORD PTR -256[rbp], si
+	mov	WORD PTR -258[rbp], cx
+	mov	WORD PTR -260[rbp], dx
+	mov	WORD PTR -262[rbp], ax
+.LBB110:
+.LBB111:
+	.loc 2 611 41
+	movzx	eax, WORD PTR -262[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -260[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm1, xmm0
+	movzx	eax, WORD PTR -258[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -256[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm4, xmm0
+	movzx	eax, WORD PTR -254[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -252[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm2, xmm0
+	movzx	eax, WORD PTR -250[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -248[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm3, xmm0
+	punpckldq	xmm1, xmm4
+	movdqa	xmm0, xmm1
+	movdqa	xmm1, xmm0
+	punpckldq	xmm2, xmm3
+	movdqa	xmm0, xmm2
+	movdqa	xmm2, xmm0
+	punpcklqdq	xmm1, xmm2
+	movdqa	xmm0, xmm1
+.LBE111:
+.LBE110:
+	.loc 2 650 10
+	nop
+.LBE109:
+.LBE108:
+	.loc 1 65 23
+	movaps	XMMWORD PTR -64[rbp], xmm0
+	mov	WORD PTR -228[rbp], 1
+.LBB112:
+.LBB113:
+	.loc 2 650 10
+	movsx	eax, WORD PTR -228[rbp]
+	movsx	edx, WORD PTR -228[rbp]
+	movsx	ecx, WORD PTR -228[rbp]
+	movsx	esi, WORD PTR -228[rbp]
+	movsx	edi, WORD PTR -228[rbp]
+	movsx	r8d, WORD PTR -228[rbp]
+	movsx	r9d, WORD PTR -228[rbp]
+	movsx	r10d, WORD PTR -228[rbp]
+	mov	WORD PTR -230[rbp], r10w
+	mov	WORD PTR -232[rbp], r9w
+	mov	WORD PTR -234[rbp], r8w
+	mov	WORD PTR -236[rbp], di
+	mov	WORD PTR -238[rbp], si
+	mov	WORD PTR -240[rbp], cx
+	mov	WORD PTR -242[rbp], dx
+	mov	WORD PTR -244[rbp], ax
+.LBB114:
+.LBB115:
+	.loc 2 611 41
+	movzx	eax, WORD PTR -244[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -242[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm1, xmm0
+	movzx	eax, WORD PTR -240[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -238[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm4, xmm0
+	movzx	eax, WORD PTR -236[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -234[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm2, xmm0
+	movzx	eax, WORD PTR -232[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -230[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm3, xmm0
+	punpckldq	xmm1, xmm4
+	movdqa	xmm0, xmm1
+	movdqa	xmm1, xmm0
+	punpckldq	xmm2, xmm3
+	movdqa	xmm0, xmm2
+	movdqa	xmm2, xmm0
+	punpcklqdq	xmm1, xmm2
+	movdqa	xmm0, xmm1
+.LBE115:
+.LBE114:
+	.loc 2 650 10
+	nop
+.LBE113:
+.LBE112:
+	.loc 1 66 25
+	movaps	XMMWORD PTR -80[rbp], xmm0
+	mov	WORD PTR -210[rbp], -32767
+.LBB116:
+.LBB117:
+	.loc 2 650 10
+	movsx	eax, WORD PTR -210[rbp]
+	movsx	edx, WORD PTR -210[rbp]
+	movsx	ecx, WORD PTR -210[rbp]
+	movsx	esi, WORD PTR -210[rbp]
+	movsx	edi, WORD PTR -210[rbp]
+	movsx	r8d, WORD PTR -210[rbp]
+	movsx	r9d, WORD PTR -210[rbp]
+	movsx	r10d, WORD PTR -210[rbp]
+	mov	WORD PTR -212[rbp], r10w
+	mov	WORD PTR -214[rbp], r9w
+	mov	WORD PTR -216[rbp], r8w
+	mov	WORD PTR -218[rbp], di
+	mov	WORD PTR -220[rbp], si
+	mov	WORD PTR -222[rbp], cx
+	mov	WORD PTR -224[rbp], dx
+	mov	WORD PTR -226[rbp], ax
+.LBB118:
+.LBB119:
+	.loc 2 611 41
+	movzx	eax, WORD PTR -226[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -224[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm1, xmm0
+	movzx	eax, WORD PTR -222[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -220[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm4, xmm0
+	movzx	eax, WORD PTR -218[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -216[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm2, xmm0
+	movzx	eax, WORD PTR -214[rbp]
+	movd	xmm0, eax
+	movzx	eax, WORD PTR -212[rbp]
+	pinsrw	xmm0, eax, 1
+	movdqa	xmm3, xmm0
+	punpckldq	xmm1, xmm4
+	movdqa	xmm0, xmm1
+	movdqa	xmm1, xmm0
+	punpckldq	xmm2, xmm3
+	movdqa	xmm0, xmm2
+	movdqa	xmm2, xmm0
+	punpcklqdq	xmm1, xmm2
+	movdqa	xmm0, xmm1
+.LBE119:
+.LBE118:
+	.loc 2 650 10
+	nop
+.LBE117:
+.LBE116:
+	.loc 1 67 29
+	movaps	XMMWORD PTR -96[rbp], xmm0
+.LBB120:
+.LBB121:
+	.loc 2 796 24
+	pxor	xmm0, xmm0
+.LBE121:
+.LBE120:
+	.loc 1 68 19
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	.loc 1 69 9
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 71 5
+	jmp	.L19
+.L39:
+.LBB122:
+	.loc 1 74 69 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -896[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -840[rbp], rax
+.LBB123:
+.LBB124:
+	.loc 2 703 10 discriminator 2
+	mov	rax, QWORD PTR -840[rbp]
+	movdqu	xmm0, XMMWORD PTR [rax]
+.LBE124:
+.LBE123:
+	.loc 1 74 27 discriminator 2
+	movaps	XMMWORD PTR -112[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -112[rbp]
+	movaps	XMMWORD PTR -816[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -832[rbp], xmm0
+.LBB125:
+.LBB126:
+	.loc 2 1162 21 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -816[rbp]
+	.loc 2 1162 35 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -832[rbp]
+	.loc 2 1162 33 discriminator 2
+	pmullw	xmm0, xmm1
+.LBE126:
+.LBE125:
+	.loc 1 75 36 discriminator 2
+	movaps	XMMWORD PTR -128[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -112[rbp]
+	movaps	XMMWORD PTR -784[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -800[rbp], xmm0
+.LBB127:
+.LBB128:
+	.loc 2 1156 19 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -800[rbp]
+	movdqa	xmm1, XMMWORD PTR -784[rbp]
+	pmulhw	xmm0, xmm1
+.LBE128:
+.LBE127:
+	.loc 1 76 37 discriminator 2
+	movaps	XMMWORD PTR -144[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -128[rbp]
+	movaps	XMMWORD PTR -752[rbp], xmm0
+	mov	DWORD PTR -756[rbp], 15
+.LBB129:
+.LBB130:
+	.loc 2 1245 19 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -752[rbp]
+	movd	xmm0, DWORD PTR -756[rbp]
+	psrlw	xmm1, xmm0
+	.loc 2 1245 10 discriminator 2
+	movdqa	xmm2, xmm1
+	movdqa	xmm0, XMMWORD PTR -144[rbp]
+	movaps	XMMWORD PTR -720[rbp], xmm0
+	mov	DWORD PTR -724[rbp], 1
+.LBE130:
+.LBE129:
+.LBB131:
+.LBB132:
+	.loc 2 1180 19 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -720[rbp]
+	movd	xmm0, DWORD PTR -724[rbp]
+	psllw	xmm1, xmm0
+	.loc 2 1180 10 discriminator 2
+	movdqa	xmm0, xmm1
+	movaps	XMMWORD PTR -688[rbp], xmm0
+	movaps	XMMWORD PTR -704[rbp], xmm2
+.LBE132:
+.LBE131:
+.LBB133:
+.LBB134:
+	.loc 2 1060 21 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -688[rbp]
+	.loc 2 1060 35 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -704[rbp]
+	.loc 2 1060 33 discriminator 2
+	paddw	xmm0, xmm1
+.LBE134:
+.LBE133:
+	.loc 1 77 25 discriminator 2
+	movaps	XMMWORD PTR -160[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -128[rbp]
+	movaps	XMMWORD PTR -656[rbp], xmm0
+	mov	DWORD PTR -660[rbp], 14
+.LBB135:
+.LBB136:
+	.loc 2 1245 19 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -656[rbp]
+	movd	xmm0, DWORD PTR -660[rbp]
+	psrlw	xmm1, xmm0
+	.loc 2 1245 10 discriminator 2
+	movdqa	xmm0, xmm1
+	movaps	XMMWORD PTR -624[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -80[rbp]
+	movaps	XMMWORD PTR -640[rbp], xmm0
+.LBE136:
+.LBE135:
+.LBB137:
+.LBB138:
+	.loc 2 1311 21 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -624[rbp]
+	.loc 2 1311 35 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -640[rbp]
+	.loc 2 1311 33 discriminator 2
+	pand	xmm0, xmm1
+	.loc 2 1311 10 discriminator 2
+	movdqa	xmm1, xmm0
+	movdqa	xmm0, XMMWORD PTR -160[rbp]
+	movaps	XMMWORD PTR -592[rbp], xmm0
+	movaps	XMMWORD PTR -608[rbp], xmm1
+.LBE138:
+.LBE137:
+.LBB139:
+.LBB140:
+	.loc 2 1060 21 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -592[rbp]
+	.loc 2 1060 35 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -608[rbp]
+	.loc 2 1060 33 discriminator 2
+	paddw	xmm0, xmm1
+.LBE140:
+.LBE139:
+	.loc 1 78 17 discriminator 2
+	movaps	XMMWORD PTR -160[rbp], xmm0
+	.loc 1 80 67 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -888[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -568[rbp], rax
+.LBB141:
+.LBB142:
+	.loc 2 703 10 discriminator 2
+	mov	rax, QWORD PTR -568[rbp]
+	movdqu	xmm0, XMMWORD PTR [rax]
+.LBE142:
+.LBE141:
+	.loc 1 80 21 discriminator 2
+	movaps	XMMWORD PTR -176[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -176[rbp]
+	movaps	XMMWORD PTR -544[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -160[rbp]
+	movaps	XMMWORD PTR -560[rbp], xmm0
+.LBB143:
+.LBB144:
+	.loc 2 1084 19 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -560[rbp]
+	movdqa	xmm1, XMMWORD PTR -544[rbp]
+	paddsw	xmm0, xmm1
+	movaps	XMMWORD PTR -512[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -96[rbp]
+	movaps	XMMWORD PTR -528[rbp], xmm0
+.LBE144:
+.LBE143:
+.LBB145:
+.LBB146:
+	.loc 2 1409 19 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -528[rbp]
+	movdqa	xmm1, XMMWORD PTR -512[rbp]
+	pmaxsw	xmm0, xmm1
+.LBE146:
+.LBE145:
+	.loc 1 81 13 discriminator 2
+	movaps	XMMWORD PTR -176[rbp], xmm0
+	.loc 1 82 50 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -888[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -480[rbp], rax
+	movdqa	xmm0, XMMWORD PTR -176[rbp]
+	movaps	XMMWORD PTR -496[rbp], xmm0
+.LBB147:
+.LBB148:
+	.loc 2 739 8 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -496[rbp]
+	mov	rax, QWORD PTR -480[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 740 1 discriminator 2
+	nop
+.LBE148:
+.LBE147:
+	.loc 1 84 90 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -904[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -472[rbp], rax
+.LBB149:
+.LBB150:
+	.loc 2 703 10 discriminator 2
+	mov	rax, QWORD PTR -472[rbp]
+	movdqu	xmm0, XMMWORD PTR [rax]
+	movdqa	xmm1, xmm0
+	movdqa	xmm0, XMMWORD PTR -176[rbp]
+	movaps	XMMWORD PTR -448[rbp], xmm0
+	movaps	XMMWORD PTR -464[rbp], xmm1
+.LBE150:
+.LBE149:
+.LBB151:
+.LBB152:
+	.loc 2 1150 19 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -464[rbp]
+	movdqa	xmm1, XMMWORD PTR -448[rbp]
+	pmaddwd	xmm0, xmm1
+.LBE152:
+.LBE151:
+	.loc 1 84 31 discriminator 2
+	movaps	XMMWORD PTR -192[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -192[rbp]
+	movaps	XMMWORD PTR -416[rbp], xmm0
+	mov	DWORD PTR -420[rbp], 31
+.LBB153:
+.LBB154:
+	.loc 2 1204 19 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -416[rbp]
+	movd	xmm0, DWORD PTR -420[rbp]
+	psrad	xmm1, xmm0
+	.loc 2 1204 10 discriminator 2
+	movdqa	xmm0, xmm1
+.LBE154:
+.LBE153:
+	.loc 1 85 30 discriminator 2
+	movaps	XMMWORD PTR -208[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -192[rbp]
+	movaps	XMMWORD PTR -384[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -208[rbp]
+	movaps	XMMWORD PTR -400[rbp], xmm0
+.LBB155:
+.LBB156:
+	.loc 2 1042 19 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -400[rbp]
+	movdqa	xmm0, XMMWORD PTR -384[rbp]
+	punpckldq	xmm0, xmm1
+	.loc 2 1042 10 discriminator 2
+	movdqa	xmm1, xmm0
+	movdqa	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -352[rbp], xmm0
+	movaps	XMMWORD PTR -368[rbp], xmm1
+.LBE156:
+.LBE155:
+.LBB157:
+.LBB158:
+	.loc 2 1072 21 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -352[rbp]
+	.loc 2 1072 35 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -368[rbp]
+	.loc 2 1072 33 discriminator 2
+	paddq	xmm0, xmm1
+.LBE158:
+.LBE157:
+	.loc 1 86 15 discriminator 2
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -192[rbp]
+	movaps	XMMWORD PTR -320[rbp], xmm0
+	movdqa	xmm0, XMMWORD PTR -208[rbp]
+	movaps	XMMWORD PTR -336[rbp], xmm0
+.LBB159:
+.LBB160:
+	.loc 2 1018 19 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -336[rbp]
+	movdqa	xmm0, XMMWORD PTR -320[rbp]
+	punpckhdq	xmm0, xmm1
+	.loc 2 1018 10 discriminator 2
+	movdqa	xmm1, xmm0
+	movdqa	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -288[rbp], xmm0
+	movaps	XMMWORD PTR -304[rbp], xmm1
+.LBE160:
+.LBE159:
+.LBB161:
+.LBB162:
+	.loc 2 1072 21 discriminator 2
+	movdqa	xmm1, XMMWORD PTR -288[rbp]
+	.loc 2 1072 35 discriminator 2
+	movdqa	xmm0, XMMWORD PTR -304[rbp]
+	.loc 2 1072 33 discriminator 2
+	paddq	xmm0, xmm1
+	.loc 2 1072 10 discriminator 2
+	nop
+.LBE162:
+.LBE161:
+	.loc 1 87 15 discriminator 2
+	movaps	XMMWORD PTR -32[rbp], xmm0
+.LBE122:
+	.loc 1 71 31 discriminator 2
+	add	DWORD PTR -36[rbp], 8
+.L19:
+	.loc 1 71 18 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, 7
+	cmp	DWORD PTR -912[rbp], eax
+	jg	.L39
+	lea	rax, -880[rbp]
+	mov	QWORD PTR -848[rbp], rax
+	movdqa	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -864[rbp], xmm0
+.LBB163:
+.LBB164:
+	.loc 2 739 8
+	movdqa	xmm0, XMMWORD PTR -864[rbp]
+	mov	rax, QWORD PTR -848[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 740 1
+	nop
+.LBE164:
+.LBE163:
+	.loc 1 92 17
+	mov	rdx, QWORD PTR -880[rbp]
+	.loc 1 92 28
+	mov	rax, QWORD PTR -872[rbp]
+	.loc 1 92 21
+	lea	rbx, [rdx+rax]
+	.loc 1 92 34
+	mov	eax, DWORD PTR -912[rbp]
+	sub	eax, DWORD PTR -36[rbp]
+	mov	r8d, eax
+	movsx	eax, WORD PTR -908[rbp]
+	.loc 1 92 99
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	lea	rcx, [rdx+rdx]
+	.loc 1 92 34
+	mov	rdx, QWORD PTR -904[rbp]
+	add	rdx, rcx
+	.loc 1 92 86
+	mov	ecx, DWORD PTR -36[rbp]
+	movsx	rcx, ecx
+	lea	rsi, [rcx+rcx]
+	.loc 1 92 34
+	mov	rcx, QWORD PTR -896[rbp]
+	add	rsi, rcx
+	.loc 1 92 72
+	mov	ecx, DWORD PTR -36[rbp]
+	movsx	rcx, ecx
+	lea	rdi, [rcx+rcx]
+	.loc 1 92 34
+	mov	rcx, QWORD PTR -888[rbp]
+	add	rdi, rcx
+	mov	ecx, eax
+	call	lmsFixed_UpdateDotScalar
+	.loc 1 92 32
+	add	rax, rbx
+	.loc 1 93 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4833:
+	.size	lmsFixed_UpdateDotSse2, .-lmsFixed_UpdateDotSse2
+	.type	lmsFixed_UpdateDotAvx2, @function
+lmsFixed_UpdateDotAvx2:
+.LFB4834:
+	.loc 1 102 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r15
+	push	r14
+	push	r13
+	push	r12
+	push	rbx
+	and	rsp, -32
+	sub	rsp, 1152
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	mov	QWORD PTR 56[rsp], rdi
+	mov	QWORD PTR 48[rsp], rsi
+	mov	QWORD PTR 40[rsp], rdx
+	mov	eax, ecx
+	mov	DWORD PTR 32[rsp], r8d
+	mov	WORD PTR 36[rsp], ax
+	.loc 1 103 23
+	movsx	eax, WORD PTR 36[rsp]
+	mov	WORD PTR 860[rsp], ax
+.LBB165:
+.LBB166:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h"
+	.loc 3 1335 10
+	movsx	edx, WORD PTR 860[rsp]
+	movsx	ecx, WORD PTR 860[rsp]
+	movsx	esi, WORD PTR 860[rsp]
+	movsx	edi, WORD PTR 860[rsp]
+	movsx	r8d, WORD PTR 860[rsp]
+	movsx	r9d, WORD PTR 860[rsp]
+	movsx	r10d, WORD PTR 860[rsp]
+	movsx	r11d, WORD PTR 860[rsp]
+	movsx	ebx, WORD PTR 860[rsp]
+	movsx	r12d, WORD PTR 860[rsp]
+	movsx	r13d, WORD PTR 860[rsp]
+	movsx	r14d, WORD PTR 860[rsp]
+	movsx	r15d, WORD PTR 860[rsp]
+	movsx	eax, WORD PTR 860[rsp]
+	mov	DWORD PTR 28[rsp], eax
+	movsx	eax, WORD PTR 860[rsp]
+	mov	DWORD PTR 24[rsp], eax
+	movsx	eax, WORD PTR 860[rsp]
+	mov	WORD PTR 858[rsp], ax
+	movzx	eax, WORD PTR 24[rsp]
+	mov	WORD PTR 856[rsp], ax
+	movzx	eax, WORD PTR 28[rsp]
+	mov	WORD PTR 854[rsp], ax
+	mov	WORD PTR 852[rsp], r15w
+	mov	WORD PTR 850[rsp], r14w
+	mov	WORD PTR 848[rsp], r13w
+	mov	WORD PTR 846[rsp], r12w
+	mov	WORD PTR 844[rsp], bx
+	mov	WORD PTR 842[rsp], r11w
+	mov	WORD PTR 840[rsp], r10w
+	mov	WORD PTR 838[rsp], r9w
+	mov	WORD PTR 836[rsp], r8w
+	mov	WORD PTR 834[rsp], di
+	mov	WORD PTR 832[rsp], si
+	mov	WORD PTR 830[rsp], cx
+	mov	WORD PTR 828[rsp], dx
+.LBB167:
+.LBB168:
+	.loc 3 1278 42
+	movzx	eax, WORD PTR 828[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 830[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm1, xmm0
+	movzx	eax, WORD PTR 832[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 834[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm4, xmm0
+	movzx	eax, WORD PTR 836[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 838[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm2, xmm0
+	movzx	eax, WORD PTR 840[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 842[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm3, xmm0
+	vpunpckldq	xmm0, xmm1, xmm4
+	vmovdqa	xmm1, xmm0
+	vpunpckldq	xmm0, xmm2, xmm3
+	vpunpcklqdq	xmm0, xmm1, xmm0
+	vmovdqa	xmm1, xmm0
+	movzx	eax, WORD PTR 844[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 846[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm2, xmm0
+	movzx	eax, WORD PTR 848[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 850[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm5, xmm0
+	movzx	eax, WORD PTR 852[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 854[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm3, xmm0
+	movzx	eax, WORD PTR 856[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 858[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm4, xmm0
+	vpunpckldq	xmm0, xmm2, xmm5
+	vmovdqa	xmm2, xmm0
+	vpunpckldq	xmm0, xmm3, xmm4
+	vpunpcklqdq	xmm0, xmm2, xmm0
+	vinserti128	ymm0, ymm1, xmm0, 0x1
+.LBE168:
+.LBE167:
+	.loc 3 1335 10
+	nop
+.LBE166:
+.LBE165:
+	.loc 1 103 23
+	vmovdqa	YMMWORD PTR 1024[rsp], ymm0
+	mov	WORD PTR 894[rsp], -32767
+.LBB169:
+.LBB170:
+	.loc 3 1335 10
+	movsx	edx, WORD PTR 894[rsp]
+	movsx	ecx, WORD PTR 894[rsp]
+	movsx	esi, WORD PTR 894[rsp]
+	movsx	edi, WORD PTR 894[rsp]
+	movsx	r8d, WORD PTR 894[rsp]
+	movsx	r9d, WORD PTR 894[rsp]
+	movsx	r10d, WORD PTR 894[rsp]
+	movsx	r11d, WORD PTR 894[rsp]
+	movsx	ebx, WORD PTR 894[rsp]
+	movsx	r12d, WORD PTR 894[rsp]
+	movsx	r13d, WORD PTR 894[rsp]
+	movsx	r14d, WORD PTR 894[rsp]
+	movsx	r15d, WORD PTR 894[rsp]
+	movsx	eax, WORD PTR 894[rsp]
+	mov	DWORD PTR 28[rsp], eax
+	movsx	eax, WORD PTR 894[rsp]
+	mov	DWORD PTR 24[rsp], eax
+	movsx	eax, WORD PTR 894[rsp]
+	mov	WORD PTR 892[rsp], ax
+	movzx	eax, WORD PTR 24[rsp]
+	mov	WORD PTR 890[rsp], ax
+	movzx	eax, WORD PTR 28[rsp]
+	mov	WORD PTR 888[rsp], ax
+	mov	WORD PTR 886[rsp], r15w
+	mov	WORD PTR 884[rsp], r14w
+	mov	WORD PTR 882[rsp], r13w
+	mov	WORD PTR 880[rsp], r12w
+	mov	WORD PTR 878[rsp], bx
+	mov	WORD PTR 876[rsp], r11w
+	mov	WORD PTR 874[rsp], r10w
+	mov	WORD PTR 872[rsp], r9w
+	mov	WORD PTR 870[rsp], r8w
+	mov	WORD PTR 868[rsp], di
+	mov	WORD PTR 866[rsp], si
+	mov	WORD PTR 864[rsp], cx
+	mov	WORD PTR 862[rsp], dx
+.LBB171:
+.LBB172:
+	.loc 3 1278 42
+	movzx	eax, WORD PTR 862[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 864[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm1, xmm0
+	movzx	eax, WORD PTR 866[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 868[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm4, xmm0
+	movzx	eax, WORD PTR 870[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 872[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm2, xmm0
+	movzx	eax, WORD PTR 874[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 876[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm3, xmm0
+	vpunpckldq	xmm0, xmm1, xmm4
+	vmovdqa	xmm1, xmm0
+	vpunpckldq	xmm0, xmm2, xmm3
+	vpunpcklqdq	xmm0, xmm1, xmm0
+	vmovdqa	xmm1, xmm0
+	movzx	eax, WORD PTR 878[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 880[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm2, xmm0
+	movzx	eax, WORD PTR 882[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 884[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm5, xmm0
+	movzx	eax, WORD PTR 886[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 888[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm3, xmm0
+	movzx	eax, WORD PTR 890[rsp]
+	vmovd	xmm0, eax
+	movzx	eax, WORD PTR 892[rsp]
+	vpinsrw	xmm0, xmm0, eax, 1
+	vmovdqa	xmm4, xmm0
+	vpunpckldq	xmm0, xmm2, xmm5
+	vmovdqa	xmm2, xmm0
+	vpunpckldq	xmm0, xmm3, xmm4
+	vpunpcklqdq	xmm0, xmm2, xmm0
+	vinserti128	ymm0, ymm1, xmm0, 0x1
+.LBE172:
+.LBE171:
+	.loc 3 1335 10
+	nop
+.LBE170:
+.LBE169:
+	.loc 1 104 29
+	vmovdqa	YMMWORD PTR 992[rsp], ymm0
+.LBB173:
+.LBB174:
+	.loc 3 1244 24
+	vpxor	xmm0, xmm0, xmm0
+.LBE174:
+.LBE173:
+	.loc 1 105 20
+	vmovdqa	YMMWORD PTR 1120[rsp], ymm0
+.LBB175:
+.LBB176:
+	.loc 3 1244 24
+	vpxor	xmm0, xmm0, xmm0
+.LBE176:
+.LBE175:
+	.loc 1 106 20
+	vmovdqa	YMMWORD PTR 1088[rsp], ymm0
+	.loc 1 107 9
+	mov	DWORD PTR 1084[rsp], 0
+	.loc 1 109 5
+	jmp	.L48
+.L61:
+.LBB177:
+	.loc 1 111 96 discriminator 2
+	mov	eax, DWORD PTR 1084[rsp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR 48[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 216[rsp], rax
+.LBB178:
+.LBB179:
+	.loc 3 929 10 discriminator 2
+	mov	rax, QWORD PTR 216[rsp]
+	vmovdqu	ymm0, YMMWORD PTR [rax]
+	vmovdqa	YMMWORD PTR 256[rsp], ymm0
+	vmovdqa	ymm0, YMMWORD PTR 1024[rsp]
+	vmovdqa	YMMWORD PTR 224[rsp], ymm0
+.LBE179:
+.LBE178:
+.LBB180:
+.LBB181:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx2intrin.h"
+	.loc 4 533 20 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 224[rsp]
+	vmovdqa	ymm1, YMMWORD PTR 256[rsp]
+	vpmulhrsw	ymm0, ymm1, ymm0
+.LBE181:
+.LBE180:
+	.loc 1 111 31 discriminator 2
+	vmovdqa	YMMWORD PTR 960[rsp], ymm0
+	.loc 1 112 70 discriminator 2
+	mov	eax, DWORD PTR 1084[rsp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR 56[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 312[rsp], rax
+.LBB182:
+.LBB183:
+	.loc 3 929 10 discriminator 2
+	mov	rax, QWORD PTR 312[rsp]
+	vmovdqu	ymm0, YMMWORD PTR [rax]
+.LBE183:
+.LBE182:
+	.loc 1 112 21 discriminator 2
+	vmovdqa	YMMWORD PTR 928[rsp], ymm0
+	vmovdqa	ymm0, YMMWORD PTR 928[rsp]
+	vmovdqa	YMMWORD PTR 352[rsp], ymm0
+	vmovdqa	ymm0, YMMWORD PTR 960[rsp]
+	vmovdqa	YMMWORD PTR 320[rsp], ymm0
+.LBB184:
+.LBB185:
+	.loc 4 142 19 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 320[rsp]
+	vmovdqa	ymm1, YMMWORD PTR 352[rsp]
+	vpaddsw	ymm0, ymm1, ymm0
+	vmovdqa	YMMWORD PTR 416[rsp], ymm0
+	vmovdqa	ymm0, YMMWORD PTR 992[rsp]
+	vmovdqa	YMMWORD PTR 384[rsp], ymm0
+.LBE185:
+.LBE184:
+.LBB186:
+.LBB187:
+	.loc 4 358 19 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 384[rsp]
+	vmovdqa	ymm1, YMMWORD PTR 416[rsp]
+	vpmaxsw	ymm0, ymm1, ymm0
+.LBE187:
+.LBE186:
+	.loc 1 113 13 discriminator 2
+	vmovdqa	YMMWORD PTR 928[rsp], ymm0
+	.loc 1 114 53 discriminator 2
+	mov	eax, DWORD PTR 1084[rsp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR 56[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 496[rsp], rax
+	vmovdqa	ymm0, YMMWORD PTR 928[rsp]
+	vmovdqa	YMMWORD PTR 448[rsp], ymm0
+.LBB188:
+.LBB189:
+	.loc 3 935 8 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 448[rsp]
+	mov	rax, QWORD PTR 496[rsp]
+	vmovdqu	YMMWORD PTR [rax], ymm0
+	.loc 3 936 1 discriminator 2
+	nop
+.LBE189:
+.LBE188:
+	.loc 1 116 96 discriminator 2
+	mov	eax, DWORD PTR 1084[rsp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR 40[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 504[rsp], rax
+.LBB190:
+.LBB191:
+	.loc 3 929 10 discriminator 2
+	mov	rax, QWORD PTR 504[rsp]
+	vmovdqu	ymm0, YMMWORD PTR [rax]
+	vmovdqa	ymm1, ymm0
+	vmovdqa	ymm0, YMMWORD PTR 928[rsp]
+	vmovdqa	YMMWORD PTR 544[rsp], ymm0
+	vmovdqa	YMMWORD PTR 512[rsp], ymm1
+.LBE191:
+.LBE190:
+.LBB192:
+.LBB193:
+	.loc 4 343 19 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 512[rsp]
+	vmovdqa	ymm1, YMMWORD PTR 544[rsp]
+	vpmaddwd	ymm0, ymm1, ymm0
+.LBE193:
+.LBE192:
+	.loc 1 116 31 discriminator 2
+	vmovdqa	YMMWORD PTR 896[rsp], ymm0
+	vmovdqa	ymm0, YMMWORD PTR 896[rsp]
+	vmovdqa	YMMWORD PTR 576[rsp], ymm0
+.LBB194:
+.LBB195:
+	.loc 3 1469 20 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 576[rsp]
+	vmovdqa	XMMWORD PTR 624[rsp], xmm0
+.LBE195:
+.LBE194:
+.LBB196:
+.LBB197:
+	.loc 4 477 20 discriminator 2
+	vmovdqa	xmm0, XMMWORD PTR 624[rsp]
+	vpmovsxdq	ymm0, xmm0
+	.loc 4 477 10 discriminator 2
+	nop
+	vmovdqa	ymm1, YMMWORD PTR 1120[rsp]
+	vmovdqa	YMMWORD PTR 672[rsp], ymm1
+	vmovdqa	YMMWORD PTR 640[rsp], ymm0
+.LBE197:
+.LBE196:
+.LBB198:
+.LBB199:
+	.loc 4 128 21 discriminator 2
+	vmovdqa	ymm1, YMMWORD PTR 672[rsp]
+	.loc 4 128 35 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 640[rsp]
+	.loc 4 128 33 discriminator 2
+	vpaddq	ymm0, ymm1, ymm0
+.LBE199:
+.LBE198:
+	.loc 1 117 16 discriminator 2
+	vmovdqa	YMMWORD PTR 1120[rsp], ymm0
+	.loc 1 118 61 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 896[rsp]
+	vextracti128	xmm0, ymm0, 0x1
+	vmovdqa	XMMWORD PTR 720[rsp], xmm0
+.LBB200:
+.LBB201:
+	.loc 4 477 20 discriminator 2
+	vmovdqa	xmm0, XMMWORD PTR 720[rsp]
+	vpmovsxdq	ymm0, xmm0
+	.loc 4 477 10 discriminator 2
+	nop
+	vmovdqa	ymm1, YMMWORD PTR 1088[rsp]
+	vmovdqa	YMMWORD PTR 768[rsp], ymm1
+	vmovdqa	YMMWORD PTR 736[rsp], ymm0
+.LBE201:
+.LBE200:
+.LBB202:
+.LBB203:
+	.loc 4 128 21 discriminator 2
+	vmovdqa	ymm1, YMMWORD PTR 768[rsp]
+	.loc 4 128 35 discriminator 2
+	vmovdqa	ymm0, YMMWORD PTR 736[rsp]
+	.loc 4 128 33 discriminator 2
+	vpaddq	ymm0, ymm1, ymm0
+	.loc 4 128 10 discriminator 2
+	nop
+.LBE203:
+.LBE202:
+	.loc 1 118 16 discriminator 2
+	vmovdqa	YMMWORD PTR 1088[rsp], ymm0
+.LBE177:
+	.loc 1 109 32 discriminator 2
+	add	DWORD PTR 1084[rsp], 16
+.L48:
+	.loc 1 109 19 discriminator 1
+	mov	eax, DWORD PTR 1084[rsp]
+	add	eax, 15
+	cmp	DWORD PTR 32[rsp], eax
+	jg	.L61
+	vmovdqa	ymm0, YMMWORD PTR 1120[rsp]
+	vmovdqa	YMMWORD PTR 128[rsp], ymm0
+	vmovdqa	ymm0, YMMWORD PTR 1088[rsp]
+	vmovdqa	YMMWORD PTR 96[rsp], ymm0
+.LBB204:
+.LBB205:
+	.loc 4 128 21
+	vmovdqa	ymm1, YMMWORD PTR 128[rsp]
+	.loc 4 128 35
+	vmovdqa	ymm0, YMMWORD PTR 96[rsp]
+	.loc 4 128 33
+	vpaddq	ymm0, ymm1, ymm0
+	lea	rax, 64[rsp]
+	mov	QWORD PTR 208[rsp], rax
+	vmovdqa	YMMWORD PTR 160[rsp], ymm0
+.LBE205:
+.LBE204:
+.LBB206:
+.LBB207:
+	.loc 3 935 8
+	vmovdqa	ymm0, YMMWORD PTR 160[rsp]
+	mov	rax, QWORD PTR 208[rsp]
+	vmovdqu	YMMWORD PTR [rax], ymm0
+	.loc 3 936 1
+	nop
+.LBE207:
+.LBE206:
+	.loc 1 123 18
+	mov	rdx, QWORD PTR 64[rsp]
+	.loc 1 123 29
+	mov	rax, QWORD PTR 72[rsp]
+	.loc 1 123 22
+	lea	rcx, [rdx+rax]
+	.loc 1 123 42
+	mov	rdx, QWORD PTR 80[rsp]
+	.loc 1 123 53
+	mov	rax, QWORD PTR 88[rsp]
+	.loc 1 123 46
+	add	rax, rdx
+	.loc 1 123 34
+	lea	rbx, [rcx+rax]
+	.loc 1 124 14
+	mov	eax, DWORD PTR 32[rsp]
+	sub	eax, DWORD PTR 1084[rsp]
+	mov	r8d, eax
+	movsx	eax, WORD PTR 36[rsp]
+	.loc 1 124 79
+	mov	edx, DWORD PTR 1084[rsp]
+	movsx	rdx, edx
+	lea	rcx, [rdx+rdx]
+	.loc 1 124 14
+	mov	rdx, QWORD PTR 40[rsp]
+	add	rdx, rcx
+	.loc 1 124 66
+	mov	ecx, DWORD PTR 1084[rsp]
+	movsx	rcx, ecx
+	lea	rsi, [rcx+rcx]
+	.loc 1 124 14
+	mov	rcx, QWORD PTR 48[rsp]
+	add	rsi, rcx
+	.loc 1 124 52
+	mov	ecx, DWORD PTR 1084[rsp]
+	movsx	rcx, ecx
+	lea	rdi, [rcx+rcx]
+	.loc 1 124 14
+	mov	rcx, QWORD PTR 56[rsp]
+	add	rdi, rcx
+	mov	ecx, eax
+	call	lmsFixed_UpdateDotScalar
+	.loc 1 124 12
+	add	rax, rbx
+	.loc 1 125 1
+	lea	rsp, -40[rbp]
+	pop	rbx
+	pop	r12
+	pop	r13
+	pop	r14
+	pop	r15
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4834:
+	.size	lmsFixed_UpdateDotAvx2, .-lmsFixed_UpdateDotAvx2
+	.section	.rodata
+.LC0:
+	.string	"scalar"
+.LC1:
+	.string	"sse2"
+.LC2:
+	.string	"avx2"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	lmsFixedKernels, @object
+	.size	lmsFixedKernels, 96
+lmsFixedKernels:
+	.long	0
+	.zero	4
+	.quad	.LC0
+	.quad	lmsFixed_UpdateDotScalar
+	.long	1
+	.zero	4
+	.quad	.LC1
+	.quad	lmsFixed_UpdateDotSse2
+	.long	2
+	.zero	4
+	.quad	.LC2
+	.quad	lmsFixed_UpdateDotAvx2
+	.zero	24
+	.text
+	.globl	lmsFixed_GetKernel
+	.type	lmsFixed_GetKernel, @function
+lmsFixed_GetKernel:
+.LFB4835:
+	.loc 1 139 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 140 29
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 142 8
+	cmp	DWORD PTR -20[rbp], 3
+	ja	.L65
+	.loc 1 142 60 discriminator 1
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	lea	rax, lmsFixedKernels[rip+16]
+	mov	rax, QWORD PTR [rdx+rax]
+	.loc 1 142 35 discriminator 1
+	test	rax, rax
+	je	.L65
+	.loc 1 142 83 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edi, eax
+	call	lmsKernel_IsSupported@PLT
+	.loc 1 142 80 discriminator 2
+	test	eax, eax
+	je	.L65
+	.loc 1 144 16
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, lmsFixedKernels[rip]
+	add	rax, rdx
+	mov	QWORD PTR -8[rbp], rax
+.L65:
+	.loc 1 146 12
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 147 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4835:
+	.size	lmsFixed_GetKernel, .-lmsFixed_GetKernel
+	.globl	lmsFixed_GetBestKernel
+	.type	lmsFixed_GetBestKernel, @function
+lmsFixed_GetBestKernel:
+.LFB4836:
+	.loc 1 150 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	.loc 1 153 17
+	call	lmsKernel_GetBest@PLT
+	.loc 1 153 36
+	mov	eax, DWORD PTR [rax]
+	.loc 1 153 15
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 153 5
+	jmp	.L68
+.L71:
+	.loc 1 155 13
+	mov	eax, DWORD PTR -4[rbp]
+	mov	edi, eax
+	call	lmsFixed_GetKernel
+	.loc 1 155 12
+	test	rax, rax
+	jne	.L73
+	.loc 1 153 74 discriminator 2
+	sub	DWORD PTR -4[rbp], 1
+.L68:
+	.loc 1 153 49 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jg	.L71
+	jmp	.L70
+.L73:
+	.loc 1 157 13
+	nop
+.L70:
+	.loc 1 160 12
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, lmsFixedKernels[rip]
+	add	rax, rdx
+	.loc 1 161 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4836:
+	.size	lmsFixed_GetBestKernel, .-lmsFixed_GetBestKernel
+	.section	.rodata
+	.align 8
+.LC3:
+	.string	"Wrong step shift %d, expected 0 to %d\n"
+.LC4:
+	.string	"Wrong filter length %d\n"
+	.align 8
+.LC5:
+	.string	"Error allocating filter of length %d\n"
+	.text
+	.globl	lmsFixed_Init
+	.type	lmsFixed_Init, @function
+lmsFixed_Init:
+.LFB4837:
+	.loc 1 164 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	mov	DWORD PTR -44[rbp], esi
+	mov	DWORD PTR -48[rbp], edx
+	.loc 1 165 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 167 8
+	cmp	DWORD PTR -44[rbp], 0
+	js	.L75
+	.loc 1 167 25 discriminator 1
+	cmp	DWORD PTR -44[rbp], 15
+	jle	.L76
+.L75:
+	.loc 1 169 9
+	mov	eax, DWORD PTR -44[rbp]
+	mov	edx, 15
+	mov	esi, eax
+	lea	rax, .LC3[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 170 16
+	mov	eax, 1
+	jmp	.L77
+.L76:
+	.loc 1 172 8
+	cmp	DWORD PTR -48[rbp], 0
+	jle	.L78
+	.loc 1 172 23 discriminator 1
+	cmp	DWORD PTR -48[rbp], 0
+	jns	.L79
+.L78:
+	.loc 1 174 9
+	mov	eax, DWORD PTR -48[rbp]
+	mov	esi, eax
+	lea	rax, .LC4[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 175 16
+	mov	eax, 1
+	jmp	.L77
+.L79:
+	.loc 1 178 62
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	.loc 1 178 37
+	add	rax, rax
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 179 65
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	.loc 1 179 80
+	add	rax, 1
+	.loc 1 179 35
+	sal	rax, 2
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 180 18
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 182 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	r8, QWORD PTR [rax]
+	.loc 1 182 41
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 182 22
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	edx, 64
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	r8
+.LVL0:
+	.loc 1 182 20
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 40[rdx], rax
+	.loc 1 183 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 183 8
+	test	rax, rax
+	jne	.L80
+	.loc 1 185 9
+	mov	eax, DWORD PTR -48[rbp]
+	mov	esi, eax
+	lea	rax, .LC5[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 186 16
+	mov	eax, 1
+	jmp	.L77
+.L80:
+	.loc 1 188 5
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 189 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -48[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 190 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -44[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 191 44
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 191 26
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 192 58
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 192 25
+	mov	rax, QWORD PTR -16[rbp]
+	add	rdx, rax
+	.loc 1 192 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 193 24
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 24[rax], 0
+	.loc 1 194 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	WORD PTR 28[rax], 0
+	.loc 1 195 22
+	call	lmsFixed_GetBestKernel
+	.loc 1 195 20
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 32[rdx], rax
+	.loc 1 196 12
+	mov	eax, 0
+.L77:
+	.loc 1 197 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4837:
+	.size	lmsFixed_Init, .-lmsFixed_Init
+	.globl	lmsFixed_Free
+	.type	lmsFixed_Free, @function
+lmsFixed_Free:
+.LFB4838:
+	.loc 1 200 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 201 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 203 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 203 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 203 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 203 5
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+	.loc 1 204 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 40[rax], 0
+	.loc 1 205 26
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 8[rax], 0
+	.loc 1 206 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 16[rax], 0
+	.loc 1 207 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4838:
+	.size	lmsFixed_Free, .-lmsFixed_Free
+	.type	lmsFixed_DelayLinePush, @function
+lmsFixed_DelayLinePush:
+.LFB4839:
+	.loc 1 215 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	eax, esi
+	mov	WORD PTR -28[rbp], ax
+	.loc 1 216 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 216 15
+	add	eax, 1
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 218 11
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 218 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 218 22
+	add	rax, rax
+	add	rdx, rax
+	.loc 1 218 43
+	movzx	eax, WORD PTR -28[rbp]
+	mov	WORD PTR [rdx], ax
+	.loc 1 219 11
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 219 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 24[rax]
+	.loc 1 219 42
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 219 22
+	add	rax, rax
+	add	rdx, rax
+	.loc 1 219 50
+	movzx	eax, WORD PTR -28[rbp]
+	mov	WORD PTR [rdx], ax
+	.loc 1 220 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 220 9
+	lea	edx, 1[rax]
+	.loc 1 220 8
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 24[rax], edx
+	.loc 1 220 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 220 8
+	cmp	DWORD PTR -4[rbp], eax
+	jne	.L84
+	.loc 1 222 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 24[rax], 0
+.L84:
+	.loc 1 224 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4839:
+	.size	lmsFixed_DelayLinePush, .-lmsFixed_DelayLinePush
+	.globl	lmsFixed_PushSample
+	.type	lmsFixed_PushSample, @function
+lmsFixed_PushSample:
+.LFB4840:
+	.loc 1 227 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	eax, esi
+	mov	WORD PTR -28[rbp], ax
+	.loc 1 229 15
+	mov	rax, QWORD PTR -24[rbp]
+	movzx	eax, WORD PTR 28[rax]
+	.loc 1 229 8
+	test	ax, ax
+	je	.L86
+.LBB208:
+	.loc 1 231 40
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 231 58
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 231 51
+	cdqe
+	add	rax, 1
+	add	rax, rax
+	.loc 1 231 24
+	add	rax, rdx
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 232 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 232 23
+	mov	r9, QWORD PTR 16[rax]
+	.loc 1 232 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edi, DWORD PTR [rax]
+	.loc 1 232 79
+	mov	rax, QWORD PTR -24[rbp]
+	movzx	eax, WORD PTR 28[rax]
+	.loc 1 232 9
+	movsx	ecx, ax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rsi, QWORD PTR -8[rbp]
+	mov	r8d, edi
+	mov	rdi, rax
+	call	r9
+.LVL2:
+	.loc 1 233 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	WORD PTR 28[rax], 0
+.L86:
+.LBE208:
+	.loc 1 235 5
+	movsx	edx, WORD PTR -28[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsFixed_DelayLinePush
+	.loc 1 236 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4840:
+	.size	lmsFixed_PushSample, .-lmsFixed_PushSample
+	.globl	lmsFixed_ProcessBlock
+	.type	lmsFixed_ProcessBlock, @function
+lmsFixed_ProcessBlock:
+.LFB4841:
+	.loc 1 240 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 112
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	QWORD PTR -88[rbp], rdx
+	mov	QWORD PTR -96[rbp], rcx
+	mov	QWORD PTR -104[rbp], r8
+	mov	DWORD PTR -108[rbp], r9d
+	.loc 1 241 34
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 241 84
+	test	eax, eax
+	jle	.L88
+	.loc 1 241 66 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 241 78 discriminator 1
+	sub	eax, 1
+	.loc 1 241 84 discriminator 1
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	jmp	.L89
+.L88:
+	.loc 1 241 84 is_stmt 0 discriminator 2
+	mov	eax, 0
+.L89:
+	.loc 1 241 19 is_stmt 1 discriminator 4
+	mov	DWORD PTR -20[rbp], eax
+.LBB209:
+	.loc 1 243 14 discriminator 4
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 243 5 discriminator 4
+	jmp	.L90
+.L97:
+.LBB210:
+	.loc 1 245 45
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	.loc 1 245 9
+	movsx	edx, ax
+	mov	rax, QWORD PTR -72[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsFixed_DelayLinePush
+	.loc 1 247 42
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 247 60
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 247 53
+	add	rax, rax
+	.loc 1 247 24
+	add	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 248 24
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, 2
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 251 35
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 251 43
+	mov	r9, QWORD PTR 16[rax]
+	.loc 1 251 29
+	mov	rax, QWORD PTR -72[rbp]
+	mov	edi, DWORD PTR [rax]
+	.loc 1 251 102
+	mov	rax, QWORD PTR -72[rbp]
+	movzx	eax, WORD PTR 28[rax]
+	.loc 1 251 29
+	movsx	ecx, ax
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	r8d, edi
+	mov	rdi, rax
+	call	r9
+.LVL3:
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 253 32
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, 16384
+	.loc 1 253 17
+	sar	rax, 15
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 254 12
+	cmp	QWORD PTR -16[rbp], 32767
+	jle	.L91
+	.loc 1 256 21
+	mov	QWORD PTR -16[rbp], 32767
+	jmp	.L92
+.L91:
+	.loc 1 258 17
+	cmp	QWORD PTR -16[rbp], -32768
+	jge	.L92
+	.loc 1 260 21
+	mov	QWORD PTR -16[rbp], -32768
+.L92:
+	.loc 1 262 23
+	mov	rax, QWORD PTR -16[rbp]
+	mov	WORD PTR -50[rbp], ax
+	.loc 1 263 23
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L93
+	.loc 1 263 54 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 263 23 discriminator 1
+	movzx	eax, WORD PTR [rax]
+	jmp	.L94
+.L93:
+	.loc 1 263 23 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -40[rbp]
+	movzx	eax, WORD PTR [rax]
+.L94:
+	.loc 1 263 23 discriminator 4
+	mov	WORD PTR -52[rbp], ax
+	.loc 1 264 45 is_stmt 1 discriminator 4
+	movsx	eax, WORD PTR -52[rbp]
+	.loc 1 264 27 discriminator 4
+	movsx	edx, WORD PTR -50[rbp]
+	sub	eax, edx
+	mov	edx, 32767
+	mov	esi, -32768
+	mov	edi, eax
+	call	lmsFixed_Saturate
+	mov	WORD PTR -54[rbp], ax
+	.loc 1 266 52 discriminator 4
+	movsx	edx, WORD PTR -54[rbp]
+	mov	eax, DWORD PTR -20[rbp]
+	add	edx, eax
+	.loc 1 266 70 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 266 31 discriminator 4
+	mov	ecx, eax
+	sar	edx, cl
+	mov	eax, edx
+	mov	edx, 32767
+	mov	esi, -32767
+	mov	edi, eax
+	call	lmsFixed_Saturate
+	.loc 1 266 29 discriminator 4
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	WORD PTR 28[rdx], ax
+	.loc 1 268 12 discriminator 4
+	cmp	QWORD PTR -96[rbp], 0
+	je	.L95
+	.loc 1 270 19
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rdx, rax
+	.loc 1 270 23
+	movzx	eax, WORD PTR -50[rbp]
+	mov	WORD PTR [rdx], ax
+.L95:
+	.loc 1 272 12
+	cmp	QWORD PTR -104[rbp], 0
+	je	.L96
+	.loc 1 274 18
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rdx, rax
+	.loc 1 274 22
+	movzx	eax, WORD PTR -54[rbp]
+	mov	WORD PTR [rdx], ax
+.L96:
+.LBE210:
+	.loc 1 243 40 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L90:
+	.loc 1 243 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -108[rbp]
+	jl	.L97
+.LBE209:
+	.loc 1 277 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4841:
+	.size	lmsFixed_ProcessBlock, .-lmsFixed_ProcessBlock
+	.globl	lmsFixed_StepShift
+	.type	lmsFixed_StepShift, @function
+lmsFixed_StepShift:
+.LFB4842:
+	.loc 1 280 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	movss	DWORD PTR -20[rbp], xmm0
+	.loc 1 281 59
+	movss	xmm0, DWORD PTR -20[rbp]
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	jbe	.L106
+	.loc 1 281 46 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	movd	xmm0, eax
+	call	log2f@PLT
+	movd	eax, xmm0
+	.loc 1 281 38 discriminator 1
+	movss	xmm0, DWORD PTR .LC7[rip]
+	movd	xmm2, eax
+	xorps	xmm2, xmm0
+	movd	eax, xmm2
+	movd	xmm0, eax
+	call	lrintf@PLT
+	jmp	.L101
+.L106:
+	.loc 1 281 59 discriminator 2
+	mov	eax, 15
+.L101:
+	.loc 1 281 9 discriminator 4
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 283 8 discriminator 4
+	cmp	DWORD PTR -4[rbp], 0
+	jns	.L102
+	.loc 1 285 15
+	mov	DWORD PTR -4[rbp], 0
+	jmp	.L103
+.L102:
+	.loc 1 287 13
+	cmp	DWORD PTR -4[rbp], 15
+	jle	.L103
+	.loc 1 289 15
+	mov	DWORD PTR -4[rbp], 15
+.L103:
+	.loc 1 291 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 292 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4842:
+	.size	lmsFixed_StepShift, .-lmsFixed_StepShift
+	.globl	lmsFixed_FromFloat
+	.type	lmsFixed_FromFloat, @function
+lmsFixed_FromFloat:
+.LFB4843:
+	.loc 1 295 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	DWORD PTR -36[rbp], edx
+.LBB211:
+	.loc 1 296 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 296 5
+	jmp	.L108
+.L113:
+.LBB212:
+	.loc 1 298 27
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 298 15
+	movss	xmm0, DWORD PTR .LC8[rip]
+	mulss	xmm0, xmm1
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 299 12
+	movss	xmm0, DWORD PTR -8[rbp]
+	comiss	xmm0, DWORD PTR .LC9[rip]
+	jbe	.L116
+	.loc 1 301 20
+	movss	xmm0, DWORD PTR .LC9[rip]
+	movss	DWORD PTR -8[rbp], xmm0
+	jmp	.L111
+.L116:
+	.loc 1 303 17
+	movss	xmm0, DWORD PTR .LC10[rip]
+	comiss	xmm0, DWORD PTR -8[rbp]
+	jbe	.L111
+	.loc 1 305 20
+	movss	xmm0, DWORD PTR .LC10[rip]
+	movss	DWORD PTR -8[rbp], xmm0
+.L111:
+	.loc 1 307 27 discriminator 2
+	mov	eax, DWORD PTR -8[rbp]
+	movd	xmm0, eax
+	call	lrintf@PLT
+	mov	rcx, rax
+	.loc 1 307 12 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 307 18 discriminator 2
+	mov	edx, ecx
+	.loc 1 307 16 discriminator 2
+	mov	WORD PTR [rax], dx
+.LBE212:
+	.loc 1 296 33 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L108:
+	.loc 1 296 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -36[rbp]
+	jl	.L113
+.LBE211:
+	.loc 1 309 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4843:
+	.size	lmsFixed_FromFloat, .-lmsFixed_FromFloat
+	.globl	lmsFixed_ToFloat
+	.type	lmsFixed_ToFloat, @function
+lmsFixed_ToFloat:
+.LFB4844:
+	.loc 1 312 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	DWORD PTR -36[rbp], edx
+.LBB213:
+	.loc 1 313 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 313 5
+	jmp	.L118
+.L119:
+	.loc 1 315 21 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	.loc 1 315 25 discriminator 3
+	cwde
+	pxor	xmm1, xmm1
+	cvtsi2ss	xmm1, eax
+	.loc 1 315 12 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 315 25 discriminator 3
+	movss	xmm0, DWORD PTR .LC11[rip]
+	mulss	xmm0, xmm1
+	.loc 1 315 16 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 313 33 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L118:
+	.loc 1 313 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -36[rbp]
+	jl	.L119
+.LBE213:
+	.loc 1 317 1
+	nop
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4844:
+	.size	lmsFixed_ToFloat, .-lmsFixed_ToFloat
+	.section	.rodata
+	.align 16
+.LC7:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC8:
+	.long	1191182336
+	.align 4
+.LC9:
+	.long	1191181824
+	.align 4
+.LC10:
+	.long	-956301312
+	.align 4
+.LC11:
+	.long	939524096
+	.text
+.Letext0:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 8 "include/lmsKernel.h"
+	.file 9 "include/lmsFixed.h"
+	.file 10 "include/lmsAllocator.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 12 "/usr/include/string.h"
+	.file 13 "/usr/include/stdio.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1c8d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2b
+	.long	.LASF173
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x9
+	.long	.LASF9
+	.byte	0x5
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0xc
+	.long	0x2e
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xc
+	.long	0x46
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x9
+	.long	.LASF10
+	.byte	0x6
+	.byte	0x27
+	.byte	0x1a
+	.long	0x88
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x9
+	.long	.LASF12
+	.byte	0x6
+	.byte	0x29
+	.byte	0x14
+	.long	0x46
+	.uleb128 0x9
+	.long	.LASF13
+	.byte	0x6
+	.byte	0x2c
+	.byte	0x19
+	.long	0x52
+	.uleb128 0x2d
+	.byte	0x8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF14
+	.uleb128 0xc
+	.long	0xa9
+	.uleb128 0x9
+	.long	.LASF15
+	.byte	0x7
+	.byte	0x19
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0xc
+	.long	0xb5
+	.uleb128 0x9
+	.long	.LASF16
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8f
+	.uleb128 0xc
+	.long	0xc6
+	.uleb128 0x9
+	.long	.LASF17
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x13
+	.long	0x9b
+	.uleb128 0xc
+	.long	0xd7
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0xa
+	.long	0xb0
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF19
+	.uleb128 0xc
+	.long	0xf4
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF20
+	.uleb128 0x2e
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0x8
+	.byte	0xf
+	.byte	0x1
+	.long	0x134
+	.uleb128 0x12
+	.long	.LASF21
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF22
+	.byte	0x1
+	.uleb128 0x12
+	.long	.LASF23
+	.byte	0x2
+	.uleb128 0x12
+	.long	.LASF24
+	.byte	0x3
+	.uleb128 0x12
+	.long	.LASF25
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF26
+	.byte	0x8
+	.byte	0x15
+	.byte	0x3
+	.long	0x107
+	.uleb128 0x16
+	.byte	0x40
+	.byte	0x8
+	.byte	0x17
+	.long	0x1b1
+	.uleb128 0xb
+	.long	.LASF27
+	.byte	0x8
+	.byte	0x19
+	.byte	0x15
+	.long	0x134
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x11
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2f
+	.string	"dot"
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xd
+	.long	0x1cf
+	.byte	0x10
+	.uleb128 0xb
+	.long	.LASF29
+	.byte	0x8
+	.byte	0x20
+	.byte	0xc
+	.long	0x1f3
+	.byte	0x18
+	.uleb128 0xb
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x23
+	.byte	0xd
+	.long	0x21b
+	.byte	0x20
+	.uleb128 0xb
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x27
+	.byte	0xd
+	.long	0x248
+	.byte	0x28
+	.uleb128 0xb
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xd
+	.long	0x21b
+	.byte	0x30
+	.uleb128 0xb
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x30
+	.byte	0xc
+	.long	0x276
+	.byte	0x38
+	.byte	0
+	.uleb128 0x13
+	.long	0xf4
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0xa
+	.long	0xfb
+	.uleb128 0xa
+	.long	0x1b1
+	.uleb128 0x1b
+	.long	0x1ee
+	.uleb128 0x2
+	.long	0x1ee
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0xf4
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0xa
+	.long	0xf4
+	.uleb128 0xa
+	.long	0x1d4
+	.uleb128 0x13
+	.long	0xf4
+	.long	0x21b
+	.uleb128 0x2
+	.long	0x1ee
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0xf4
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0xa
+	.long	0x1f8
+	.uleb128 0x13
+	.long	0xf4
+	.long	0x248
+	.uleb128 0x2
+	.long	0x1ee
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0xf4
+	.uleb128 0x2
+	.long	0xf4
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0xa
+	.long	0x220
+	.uleb128 0x1b
+	.long	0x276
+	.uleb128 0x2
+	.long	0x1ee
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0x1ca
+	.uleb128 0x2
+	.long	0x1ee
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0xa
+	.long	0x24d
+	.uleb128 0x9
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x32
+	.byte	0x3
+	.long	0x140
+	.uleb128 0xc
+	.long	0x27b
+	.uleb128 0x16
+	.byte	0x18
+	.byte	0x9
+	.byte	0x15
+	.long	0x2bc
+	.uleb128 0xb
+	.long	.LASF27
+	.byte	0x9
+	.byte	0x17
+	.byte	0x15
+	.long	0x134
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF28
+	.byte	0x9
+	.byte	0x18
+	.byte	0x11
+	.long	0xef
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF30
+	.byte	0x9
+	.byte	0x1c
+	.byte	0xf
+	.long	0x2e9
+	.byte	0x10
+	.byte	0
+	.uleb128 0x13
+	.long	0xd7
+	.long	0x2df
+	.uleb128 0x2
+	.long	0x2df
+	.uleb128 0x2
+	.long	0x2e4
+	.uleb128 0x2
+	.long	0x2e4
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0xa
+	.long	0xb5
+	.uleb128 0xa
+	.long	0xc1
+	.uleb128 0xa
+	.long	0x2bc
+	.uleb128 0x9
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x3
+	.long	0x28c
+	.uleb128 0xc
+	.long	0x2ee
+	.uleb128 0x16
+	.byte	0x30
+	.byte	0x9
+	.byte	0x20
+	.long	0x370
+	.uleb128 0xb
+	.long	.LASF36
+	.byte	0x9
+	.byte	0x22
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF37
+	.byte	0x9
+	.byte	0x23
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0xb
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x24
+	.byte	0xe
+	.long	0x2df
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x25
+	.byte	0xe
+	.long	0x2df
+	.byte	0x10
+	.uleb128 0xb
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x26
+	.byte	0x9
+	.long	0x46
+	.byte	0x18
+	.uleb128 0xb
+	.long	.LASF41
+	.byte	0x9
+	.byte	0x27
+	.byte	0xd
+	.long	0xb5
+	.byte	0x1c
+	.uleb128 0xb
+	.long	.LASF42
+	.byte	0x9
+	.byte	0x28
+	.byte	0x1d
+	.long	0x370
+	.byte	0x20
+	.uleb128 0xb
+	.long	.LASF43
+	.byte	0x9
+	.byte	0x29
+	.byte	0xb
+	.long	0xa7
+	.byte	0x28
+	.byte	0
+	.uleb128 0xa
+	.long	0x2fa
+	.uleb128 0x9
+	.long	.LASF44
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x3
+	.long	0x2ff
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF45
+	.uleb128 0x16
+	.byte	0x18
+	.byte	0xa
+	.byte	0x10
+	.long	0x3b8
+	.uleb128 0xb
+	.long	.LASF46
+	.byte	0xa
+	.byte	0x13
+	.byte	0xd
+	.long	0x3d1
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF47
+	.byte	0xa
+	.byte	0x16
+	.byte	0xc
+	.long	0x3e6
+	.byte	0x8
+	.uleb128 0xb
+	.long	.LASF48
+	.byte	0xa
+	.byte	0x18
+	.byte	0xb
+	.long	0xa7
+	.byte	0x10
+	.byte	0
+	.uleb128 0x13
+	.long	0xa7
+	.long	0x3d1
+	.uleb128 0x2
+	.long	0xa7
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	0x3b8
+	.uleb128 0x1b
+	.long	0x3e6
+	.uleb128 0x2
+	.long	0xa7
+	.uleb128 0x2
+	.long	0xa7
+	.byte	0
+	.uleb128 0xa
+	.long	0x3d6
+	.uleb128 0x9
+	.long	.LASF49
+	.byte	0xa
+	.byte	0x19
+	.byte	0x3
+	.long	0x388
+	.uleb128 0xc
+	.long	0x3eb
+	.uleb128 0x9
+	.long	.LASF50
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x408
+	.uleb128 0xf
+	.long	0xe8
+	.long	0x414
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF51
+	.byte	0x2
+	.byte	0x2b
+	.byte	0xd
+	.long	0x420
+	.uleb128 0xf
+	.long	0x46
+	.long	0x42c
+	.uleb128 0x10
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF52
+	.byte	0x2
+	.byte	0x2d
+	.byte	0xf
+	.long	0x438
+	.uleb128 0xf
+	.long	0x88
+	.long	0x444
+	.uleb128 0x10
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF53
+	.byte	0x2
+	.byte	0x2e
+	.byte	0x18
+	.long	0x450
+	.uleb128 0xf
+	.long	0x67
+	.long	0x45c
+	.uleb128 0x10
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF54
+	.byte	0x2
+	.byte	0x35
+	.byte	0x13
+	.long	0x46d
+	.uleb128 0xc
+	.long	0x45c
+	.uleb128 0xf
+	.long	0x59
+	.long	0x479
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF60
+	.byte	0x2
+	.byte	0x39
+	.long	0x46d
+	.uleb128 0xc
+	.long	0x479
+	.uleb128 0x9
+	.long	.LASF55
+	.byte	0x3
+	.byte	0x2b
+	.byte	0x13
+	.long	0x495
+	.uleb128 0xf
+	.long	0x59
+	.long	0x4a1
+	.uleb128 0x10
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF56
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x1c
+	.long	0x4ad
+	.uleb128 0xf
+	.long	0xe8
+	.long	0x4b9
+	.uleb128 0x10
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF57
+	.byte	0x3
+	.byte	0x2d
+	.byte	0xd
+	.long	0x4c5
+	.uleb128 0xf
+	.long	0x46
+	.long	0x4d1
+	.uleb128 0x10
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF58
+	.byte	0x3
+	.byte	0x2f
+	.byte	0xf
+	.long	0x4dd
+	.uleb128 0xf
+	.long	0x88
+	.long	0x4e9
+	.uleb128 0x10
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF59
+	.byte	0x3
+	.byte	0x39
+	.byte	0x13
+	.long	0x4fa
+	.uleb128 0xc
+	.long	0x4e9
+	.uleb128 0xf
+	.long	0x59
+	.long	0x506
+	.uleb128 0x10
+	.byte	0x3
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF61
+	.byte	0x3
+	.byte	0x42
+	.long	0x4fa
+	.uleb128 0xc
+	.long	0x506
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x4
+	.long	.LASF62
+	.uleb128 0x1c
+	.long	0x2fa
+	.long	0x52d
+	.uleb128 0x1d
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	0x51d
+	.uleb128 0x6
+	.long	.LASF72
+	.byte	0x81
+	.byte	0x1f
+	.long	0x52d
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsFixedKernels
+	.uleb128 0x24
+	.long	.LASF63
+	.byte	0xb
+	.value	0x13d
+	.byte	0x1
+	.long	0x52
+	.long	0x55e
+	.uleb128 0x2
+	.long	0xf4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF64
+	.byte	0xb
+	.byte	0x85
+	.byte	0x1
+	.long	0xf4
+	.long	0x574
+	.uleb128 0x2
+	.long	0xf4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF65
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xe
+	.long	0xa7
+	.long	0x594
+	.uleb128 0x2
+	.long	0xa7
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF66
+	.byte	0xa
+	.byte	0x43
+	.byte	0x8
+	.long	0x2e
+	.long	0x5aa
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF67
+	.byte	0xd
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0x5c2
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF68
+	.byte	0xa
+	.byte	0x27
+	.byte	0x17
+	.long	0x5ce
+	.uleb128 0xa
+	.long	0x3f7
+	.uleb128 0x25
+	.long	.LASF69
+	.byte	0x8
+	.byte	0x47
+	.byte	0x14
+	.long	0x5df
+	.uleb128 0xa
+	.long	0x287
+	.uleb128 0x17
+	.long	.LASF70
+	.byte	0x8
+	.byte	0x39
+	.byte	0x5
+	.long	0x46
+	.long	0x5fa
+	.uleb128 0x2
+	.long	0x134
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF73
+	.byte	0x1
+	.value	0x137
+	.byte	0x6
+	.quad	.LFB4844
+	.quad	.LFE4844-.LFB4844
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x666
+	.uleb128 0x18
+	.string	"dst"
+	.value	0x137
+	.byte	0x1e
+	.long	0x1ee
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x18
+	.string	"src"
+	.value	0x137
+	.byte	0x32
+	.long	0x2e4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1e
+	.long	.LASF71
+	.value	0x137
+	.byte	0x3b
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x11
+	.quad	.LBB213
+	.quad	.LBE213-.LBB213
+	.uleb128 0x14
+	.string	"i"
+	.value	0x139
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF74
+	.byte	0x1
+	.value	0x126
+	.byte	0x6
+	.quad	.LFB4843
+	.quad	.LFE4843-.LFB4843
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6f3
+	.uleb128 0x18
+	.string	"dst"
+	.value	0x126
+	.byte	0x22
+	.long	0x2df
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x18
+	.string	"src"
+	.value	0x126
+	.byte	0x34
+	.long	0x1ca
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1e
+	.long	.LASF71
+	.value	0x126
+	.byte	0x3d
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x11
+	.quad	.LBB211
+	.quad	.LBE211-.LBB211
+	.uleb128 0x14
+	.string	"i"
+	.value	0x128
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x11
+	.quad	.LBB212
+	.quad	.LBE212-.LBB212
+	.uleb128 0x26
+	.long	.LASF75
+	.value	0x12a
+	.byte	0xf
+	.long	0xf4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF95
+	.byte	0x1
+	.value	0x117
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB4842
+	.quad	.LFE4842-.LFB4842
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x735
+	.uleb128 0x1e
+	.long	.LASF76
+	.value	0x117
+	.byte	0x1e
+	.long	0xf4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x26
+	.long	.LASF77
+	.value	0x119
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF78
+	.byte	0xee
+	.quad	.LFB4841
+	.quad	.LFE4841-.LFB4841
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x84c
+	.uleb128 0x5
+	.long	.LASF79
+	.byte	0xee
+	.byte	0x28
+	.long	0x84c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x5
+	.long	.LASF80
+	.byte	0xee
+	.byte	0x3f
+	.long	0x2e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x5
+	.long	.LASF81
+	.byte	0xee
+	.byte	0x55
+	.long	0x2e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x5
+	.long	.LASF82
+	.byte	0xef
+	.byte	0x25
+	.long	0x2df
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x5
+	.long	.LASF83
+	.byte	0xef
+	.byte	0x36
+	.long	0x2df
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x5
+	.long	.LASF84
+	.byte	0xef
+	.byte	0x41
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -124
+	.uleb128 0x6
+	.long	.LASF85
+	.byte	0xf1
+	.byte	0x13
+	.long	0xd2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x11
+	.quad	.LBB209
+	.quad	.LBE209-.LBB209
+	.uleb128 0xe
+	.string	"n"
+	.byte	0xf3
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x11
+	.quad	.LBB210
+	.quad	.LBE210-.LBB210
+	.uleb128 0x6
+	.long	.LASF86
+	.byte	0xf7
+	.byte	0x18
+	.long	0x2e4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF87
+	.byte	0xf8
+	.byte	0x18
+	.long	0x2e4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xe
+	.string	"acc"
+	.byte	0xfb
+	.byte	0x17
+	.long	0xe3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF88
+	.byte	0xfd
+	.byte	0x11
+	.long	0xd7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x14
+	.string	"y"
+	.value	0x106
+	.byte	0x17
+	.long	0xc1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -66
+	.uleb128 0x14
+	.string	"d"
+	.value	0x107
+	.byte	0x17
+	.long	0xc1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x14
+	.string	"e"
+	.value	0x108
+	.byte	0x17
+	.long	0xc1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -70
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x375
+	.uleb128 0x1f
+	.long	.LASF89
+	.byte	0xe2
+	.quad	.LFB4840
+	.quad	.LFE4840-.LFB4840
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8aa
+	.uleb128 0x5
+	.long	.LASF79
+	.byte	0xe2
+	.byte	0x26
+	.long	0x84c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF90
+	.byte	0xe2
+	.byte	0x36
+	.long	0xb5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x11
+	.quad	.LBB208
+	.quad	.LBE208-.LBB208
+	.uleb128 0x6
+	.long	.LASF91
+	.byte	0xe7
+	.byte	0x18
+	.long	0x2e4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF174
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x14
+	.quad	.LFB4839
+	.quad	.LFE4839-.LFB4839
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x8f3
+	.uleb128 0x5
+	.long	.LASF79
+	.byte	0xd6
+	.byte	0x37
+	.long	0x84c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF90
+	.byte	0xd6
+	.byte	0x47
+	.long	0xb5
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x6
+	.long	.LASF92
+	.byte	0xd8
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF93
+	.byte	0xc7
+	.quad	.LFB4838
+	.quad	.LFE4838-.LFB4838
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x92c
+	.uleb128 0x5
+	.long	.LASF79
+	.byte	0xc7
+	.byte	0x20
+	.long	0x84c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF94
+	.byte	0xc9
+	.byte	0x1b
+	.long	0x5ce
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF96
+	.byte	0xa3
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB4837
+	.quad	.LFE4837-.LFB4837
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9b0
+	.uleb128 0x5
+	.long	.LASF79
+	.byte	0xa3
+	.byte	0x1f
+	.long	0x84c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF37
+	.byte	0xa3
+	.byte	0x2b
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x5
+	.long	.LASF36
+	.byte	0xa3
+	.byte	0x3a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF94
+	.byte	0xa5
+	.byte	0x1b
+	.long	0x5ce
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.long	.LASF97
+	.byte	0xb2
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x6
+	.long	.LASF98
+	.byte	0xb3
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF99
+	.byte	0xb4
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF100
+	.byte	0x95
+	.byte	0x19
+	.long	0x370
+	.quad	.LFB4836
+	.quad	.LFE4836-.LFB4836
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9e0
+	.uleb128 0x6
+	.long	.LASF27
+	.byte	0x97
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF101
+	.byte	0x8a
+	.byte	0x19
+	.long	0x370
+	.quad	.LFB4835
+	.quad	.LFE4835-.LFB4835
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xa1e
+	.uleb128 0x5
+	.long	.LASF27
+	.byte	0x8a
+	.byte	0x3c
+	.long	0x134
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x6
+	.long	.LASF102
+	.byte	0x8c
+	.byte	0x1d
+	.long	0x370
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF110
+	.byte	0x64
+	.long	0xd7
+	.quad	.LFB4834
+	.quad	.LFE4834-.LFB4834
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf5a
+	.uleb128 0x5
+	.long	.LASF38
+	.byte	0x64
+	.byte	0x30
+	.long	0x2df
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0x64
+	.byte	0x4d
+	.long	0x2e4
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 48
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0x64
+	.byte	0x66
+	.long	0x2e4
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0x65
+	.byte	0x2f
+	.long	0xb5
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 36
+	.uleb128 0x5
+	.long	.LASF36
+	.byte	0x65
+	.byte	0x39
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 32
+	.uleb128 0xe
+	.string	"g"
+	.byte	0x67
+	.byte	0x13
+	.long	0x4f5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1024
+	.uleb128 0x6
+	.long	.LASF104
+	.byte	0x68
+	.byte	0x13
+	.long	0x4f5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 992
+	.uleb128 0x6
+	.long	.LASF105
+	.byte	0x69
+	.byte	0xd
+	.long	0x4e9
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1120
+	.uleb128 0x6
+	.long	.LASF106
+	.byte	0x6a
+	.byte	0xd
+	.long	0x4e9
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1088
+	.uleb128 0xe
+	.string	"k"
+	.byte	0x6b
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1084
+	.uleb128 0x6
+	.long	.LASF107
+	.byte	0x79
+	.byte	0xd
+	.long	0xf5a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.uleb128 0x27
+	.quad	.LBB177
+	.quad	.LBE177-.LBB177
+	.long	0xd37
+	.uleb128 0x6
+	.long	.LASF108
+	.byte	0x6f
+	.byte	0x17
+	.long	0x4f5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 960
+	.uleb128 0xe
+	.string	"c"
+	.byte	0x70
+	.byte	0x11
+	.long	0x4e9
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 928
+	.uleb128 0x6
+	.long	.LASF109
+	.byte	0x74
+	.byte	0x17
+	.long	0x4f5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 896
+	.uleb128 0x4
+	.long	0x194e
+	.quad	.LBB178
+	.quad	.LBE178-.LBB178
+	.byte	0x6f
+	.byte	0x1f
+	.long	0xb3f
+	.uleb128 0x1
+	.long	0x195e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 216
+	.byte	0
+	.uleb128 0x4
+	.long	0x1710
+	.quad	.LBB180
+	.quad	.LBE180-.LBB180
+	.byte	0x6f
+	.byte	0x1f
+	.long	0xb6d
+	.uleb128 0x1
+	.long	0x172d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 224
+	.uleb128 0x1
+	.long	0x1720
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 256
+	.byte	0
+	.uleb128 0x4
+	.long	0x194e
+	.quad	.LBB182
+	.quad	.LBE182-.LBB182
+	.byte	0x70
+	.byte	0x15
+	.long	0xb92
+	.uleb128 0x1
+	.long	0x195e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 312
+	.byte	0
+	.uleb128 0x4
+	.long	0x17af
+	.quad	.LBB184
+	.quad	.LBE184-.LBB184
+	.byte	0x71
+	.byte	0xd
+	.long	0xbc0
+	.uleb128 0x1
+	.long	0x17c8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 320
+	.uleb128 0x1
+	.long	0x17bd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 352
+	.byte	0
+	.uleb128 0x4
+	.long	0x1759
+	.quad	.LBB186
+	.quad	.LBE186-.LBB186
+	.byte	0x71
+	.byte	0xd
+	.long	0xbee
+	.uleb128 0x1
+	.long	0x1776
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 384
+	.uleb128 0x1
+	.long	0x1769
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 416
+	.byte	0
+	.uleb128 0x4
+	.long	0x1922
+	.quad	.LBB188
+	.quad	.LBE188-.LBB188
+	.byte	0x72
+	.byte	0x9
+	.long	0xc1c
+	.uleb128 0x1
+	.long	0x193b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 448
+	.uleb128 0x1
+	.long	0x192e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 496
+	.byte	0
+	.uleb128 0x4
+	.long	0x194e
+	.quad	.LBB190
+	.quad	.LBE190-.LBB190
+	.byte	0x74
+	.byte	0x1f
+	.long	0xc41
+	.uleb128 0x1
+	.long	0x195e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 504
+	.byte	0
+	.uleb128 0x4
+	.long	0x1784
+	.quad	.LBB192
+	.quad	.LBE192-.LBB192
+	.byte	0x74
+	.byte	0x1f
+	.long	0xc6f
+	.uleb128 0x1
+	.long	0x17a1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 512
+	.uleb128 0x1
+	.long	0x1794
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 544
+	.byte	0
+	.uleb128 0x4
+	.long	0x17f9
+	.quad	.LBB194
+	.quad	.LBE194-.LBB194
+	.byte	0x75
+	.byte	0x10
+	.long	0xc94
+	.uleb128 0x1
+	.long	0x1809
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 576
+	.byte	0
+	.uleb128 0x4
+	.long	0x173b
+	.quad	.LBB196
+	.quad	.LBE196-.LBB196
+	.byte	0x75
+	.byte	0x10
+	.long	0xcb9
+	.uleb128 0x1
+	.long	0x174b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 624
+	.byte	0
+	.uleb128 0x4
+	.long	0x17d4
+	.quad	.LBB198
+	.quad	.LBE198-.LBB198
+	.byte	0x75
+	.byte	0x10
+	.long	0xce7
+	.uleb128 0x1
+	.long	0x17ed
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 640
+	.uleb128 0x1
+	.long	0x17e2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 672
+	.byte	0
+	.uleb128 0x4
+	.long	0x173b
+	.quad	.LBB200
+	.quad	.LBE200-.LBB200
+	.byte	0x76
+	.byte	0x10
+	.long	0xd0c
+	.uleb128 0x1
+	.long	0x174b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 720
+	.byte	0
+	.uleb128 0x19
+	.long	0x17d4
+	.quad	.LBB202
+	.quad	.LBE202-.LBB202
+	.byte	0x76
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x17ed
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 736
+	.uleb128 0x1
+	.long	0x17e2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 768
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1817
+	.quad	.LBB165
+	.quad	.LBE165-.LBB165
+	.byte	0x67
+	.byte	0x17
+	.long	0xe05
+	.uleb128 0x1
+	.long	0x1827
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 860
+	.uleb128 0x15
+	.long	0x1835
+	.quad	.LBB167
+	.quad	.LBE167-.LBB167
+	.byte	0x3
+	.value	0x537
+	.uleb128 0x1
+	.long	0x1908
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 828
+	.uleb128 0x1
+	.long	0x18fb
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 830
+	.uleb128 0x1
+	.long	0x18ee
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 832
+	.uleb128 0x1
+	.long	0x18e1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 834
+	.uleb128 0x1
+	.long	0x18d4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 836
+	.uleb128 0x1
+	.long	0x18c7
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 838
+	.uleb128 0x1
+	.long	0x18ba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 840
+	.uleb128 0x1
+	.long	0x18ad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 842
+	.uleb128 0x1
+	.long	0x18a0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 844
+	.uleb128 0x1
+	.long	0x1893
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 846
+	.uleb128 0x1
+	.long	0x1886
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 848
+	.uleb128 0x1
+	.long	0x1879
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 850
+	.uleb128 0x1
+	.long	0x186c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 852
+	.uleb128 0x1
+	.long	0x185f
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 854
+	.uleb128 0x1
+	.long	0x1852
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 856
+	.uleb128 0x1
+	.long	0x1845
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 858
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1817
+	.quad	.LBB169
+	.quad	.LBE169-.LBB169
+	.byte	0x68
+	.byte	0x1d
+	.long	0xed3
+	.uleb128 0x1
+	.long	0x1827
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 894
+	.uleb128 0x15
+	.long	0x1835
+	.quad	.LBB171
+	.quad	.LBE171-.LBB171
+	.byte	0x3
+	.value	0x537
+	.uleb128 0x1
+	.long	0x1908
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 862
+	.uleb128 0x1
+	.long	0x18fb
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 864
+	.uleb128 0x1
+	.long	0x18ee
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 866
+	.uleb128 0x1
+	.long	0x18e1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 868
+	.uleb128 0x1
+	.long	0x18d4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 870
+	.uleb128 0x1
+	.long	0x18c7
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 872
+	.uleb128 0x1
+	.long	0x18ba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 874
+	.uleb128 0x1
+	.long	0x18ad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 876
+	.uleb128 0x1
+	.long	0x18a0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 878
+	.uleb128 0x1
+	.long	0x1893
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 880
+	.uleb128 0x1
+	.long	0x1886
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 882
+	.uleb128 0x1
+	.long	0x1879
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 884
+	.uleb128 0x1
+	.long	0x186c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 886
+	.uleb128 0x1
+	.long	0x185f
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 888
+	.uleb128 0x1
+	.long	0x1852
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 890
+	.uleb128 0x1
+	.long	0x1845
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 892
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x1916
+	.quad	.LBB173
+	.quad	.LBE173-.LBB173
+	.byte	0x69
+	.byte	0x14
+	.uleb128 0x22
+	.long	0x1916
+	.quad	.LBB175
+	.quad	.LBE175-.LBB175
+	.byte	0x6a
+	.byte	0x14
+	.uleb128 0x4
+	.long	0x17d4
+	.quad	.LBB204
+	.quad	.LBE204-.LBB204
+	.byte	0x7a
+	.byte	0x5
+	.long	0xf2f
+	.uleb128 0x1
+	.long	0x17ed
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 96
+	.uleb128 0x1
+	.long	0x17e2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 128
+	.byte	0
+	.uleb128 0x19
+	.long	0x1922
+	.quad	.LBB206
+	.quad	.LBE206-.LBB206
+	.byte	0x7a
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x193b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 160
+	.uleb128 0x1
+	.long	0x192e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 208
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0xd7
+	.long	0xf6a
+	.uleb128 0x1d
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF111
+	.byte	0x3e
+	.long	0xd7
+	.quad	.LFB4833
+	.quad	.LFE4833-.LFB4833
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15f1
+	.uleb128 0x5
+	.long	.LASF38
+	.byte	0x3e
+	.byte	0x30
+	.long	0x2df
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -904
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0x3e
+	.byte	0x4d
+	.long	0x2e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -912
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0x3e
+	.byte	0x66
+	.long	0x2e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -920
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0x3f
+	.byte	0x2f
+	.long	0xb5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -924
+	.uleb128 0x5
+	.long	.LASF36
+	.byte	0x3f
+	.byte	0x39
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -928
+	.uleb128 0xe
+	.string	"g"
+	.byte	0x41
+	.byte	0x13
+	.long	0x468
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xe
+	.string	"one"
+	.byte	0x42
+	.byte	0x13
+	.long	0x468
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x6
+	.long	.LASF104
+	.byte	0x43
+	.byte	0x13
+	.long	0x468
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0xe
+	.string	"acc"
+	.byte	0x44
+	.byte	0xd
+	.long	0x45c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xe
+	.string	"k"
+	.byte	0x45
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x6
+	.long	.LASF107
+	.byte	0x5a
+	.byte	0xd
+	.long	0x15f1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -896
+	.uleb128 0x27
+	.quad	.LBB122
+	.quad	.LBE122-.LBB122
+	.long	0x141d
+	.uleb128 0xe
+	.string	"x"
+	.byte	0x4a
+	.byte	0x17
+	.long	0x468
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x6
+	.long	.LASF112
+	.byte	0x4b
+	.byte	0x17
+	.long	0x468
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x6
+	.long	.LASF113
+	.byte	0x4c
+	.byte	0x17
+	.long	0x468
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x6
+	.long	.LASF108
+	.byte	0x4d
+	.byte	0x11
+	.long	0x45c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0xe
+	.string	"c"
+	.byte	0x50
+	.byte	0x11
+	.long	0x45c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x6
+	.long	.LASF109
+	.byte	0x54
+	.byte	0x17
+	.long	0x468
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x6
+	.long	.LASF114
+	.byte	0x55
+	.byte	0x17
+	.long	0x468
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x4
+	.long	0x1bd8
+	.quad	.LBB123
+	.quad	.LBE123-.LBB123
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x10c8
+	.uleb128 0x1
+	.long	0x1be8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -856
+	.byte	0
+	.uleb128 0x4
+	.long	0x1a48
+	.quad	.LBB125
+	.quad	.LBE125-.LBB125
+	.byte	0x4b
+	.byte	0x24
+	.long	0x10f6
+	.uleb128 0x1
+	.long	0x1a65
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -848
+	.uleb128 0x1
+	.long	0x1a58
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -832
+	.byte	0
+	.uleb128 0x4
+	.long	0x1a73
+	.quad	.LBB127
+	.quad	.LBE127-.LBB127
+	.byte	0x4c
+	.byte	0x25
+	.long	0x1124
+	.uleb128 0x1
+	.long	0x1a90
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -816
+	.uleb128 0x1
+	.long	0x1a83
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -800
+	.byte	0
+	.uleb128 0x4
+	.long	0x19c7
+	.quad	.LBB129
+	.quad	.LBE129-.LBB129
+	.byte	0x4d
+	.byte	0x19
+	.long	0x1152
+	.uleb128 0x1
+	.long	0x19e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -772
+	.uleb128 0x1
+	.long	0x19d7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -768
+	.byte	0
+	.uleb128 0x4
+	.long	0x1a1d
+	.quad	.LBB131
+	.quad	.LBE131-.LBB131
+	.byte	0x4d
+	.byte	0x19
+	.long	0x1180
+	.uleb128 0x1
+	.long	0x1a3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -740
+	.uleb128 0x1
+	.long	0x1a2d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.byte	0
+	.uleb128 0x4
+	.long	0x1b1f
+	.quad	.LBB133
+	.quad	.LBE133-.LBB133
+	.byte	0x4d
+	.byte	0x19
+	.long	0x11ae
+	.uleb128 0x1
+	.long	0x1b3c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -720
+	.uleb128 0x1
+	.long	0x1b2f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -704
+	.byte	0
+	.uleb128 0x4
+	.long	0x19c7
+	.quad	.LBB135
+	.quad	.LBE135-.LBB135
+	.byte	0x4e
+	.byte	0x11
+	.long	0x11dc
+	.uleb128 0x1
+	.long	0x19e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -676
+	.uleb128 0x1
+	.long	0x19d7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -672
+	.byte	0
+	.uleb128 0x4
+	.long	0x199c
+	.quad	.LBB137
+	.quad	.LBE137-.LBB137
+	.byte	0x4e
+	.byte	0x11
+	.long	0x120a
+	.uleb128 0x1
+	.long	0x19b9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -656
+	.uleb128 0x1
+	.long	0x19ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -640
+	.byte	0
+	.uleb128 0x4
+	.long	0x1b1f
+	.quad	.LBB139
+	.quad	.LBE139-.LBB139
+	.byte	0x4e
+	.byte	0x11
+	.long	0x1238
+	.uleb128 0x1
+	.long	0x1b3c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -624
+	.uleb128 0x1
+	.long	0x1b2f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -608
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bd8
+	.quad	.LBB141
+	.quad	.LBE141-.LBB141
+	.byte	0x50
+	.byte	0x15
+	.long	0x125d
+	.uleb128 0x1
+	.long	0x1be8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -584
+	.byte	0
+	.uleb128 0x4
+	.long	0x1ac9
+	.quad	.LBB143
+	.quad	.LBE143-.LBB143
+	.byte	0x51
+	.byte	0xd
+	.long	0x128b
+	.uleb128 0x1
+	.long	0x1ae6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.uleb128 0x1
+	.long	0x1ad9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -560
+	.byte	0
+	.uleb128 0x4
+	.long	0x1971
+	.quad	.LBB145
+	.quad	.LBE145-.LBB145
+	.byte	0x51
+	.byte	0xd
+	.long	0x12b9
+	.uleb128 0x1
+	.long	0x198e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -544
+	.uleb128 0x1
+	.long	0x1981
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -528
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bac
+	.quad	.LBB147
+	.quad	.LBE147-.LBB147
+	.byte	0x52
+	.byte	0x9
+	.long	0x12e7
+	.uleb128 0x1
+	.long	0x1bc5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -512
+	.uleb128 0x1
+	.long	0x1bb8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -496
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bd8
+	.quad	.LBB149
+	.quad	.LBE149-.LBB149
+	.byte	0x54
+	.byte	0x1f
+	.long	0x130c
+	.uleb128 0x1
+	.long	0x1be8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -488
+	.byte	0
+	.uleb128 0x4
+	.long	0x1a9e
+	.quad	.LBB151
+	.quad	.LBE151-.LBB151
+	.byte	0x54
+	.byte	0x1f
+	.long	0x133a
+	.uleb128 0x1
+	.long	0x1abb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -480
+	.uleb128 0x1
+	.long	0x1aae
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -464
+	.byte	0
+	.uleb128 0x4
+	.long	0x19f2
+	.quad	.LBB153
+	.quad	.LBE153-.LBB153
+	.byte	0x55
+	.byte	0x1e
+	.long	0x1368
+	.uleb128 0x1
+	.long	0x1a0f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -436
+	.uleb128 0x1
+	.long	0x1a02
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.byte	0
+	.uleb128 0x4
+	.long	0x1b4a
+	.quad	.LBB155
+	.quad	.LBE155-.LBB155
+	.byte	0x56
+	.byte	0xf
+	.long	0x1396
+	.uleb128 0x1
+	.long	0x1b67
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.uleb128 0x1
+	.long	0x1b5a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.byte	0
+	.uleb128 0x4
+	.long	0x1af4
+	.quad	.LBB157
+	.quad	.LBE157-.LBB157
+	.byte	0x56
+	.byte	0xf
+	.long	0x13c4
+	.uleb128 0x1
+	.long	0x1b11
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.uleb128 0x1
+	.long	0x1b04
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.byte	0
+	.uleb128 0x4
+	.long	0x1b75
+	.quad	.LBB159
+	.quad	.LBE159-.LBB159
+	.byte	0x57
+	.byte	0xf
+	.long	0x13f2
+	.uleb128 0x1
+	.long	0x1b92
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x1
+	.long	0x1b85
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x19
+	.long	0x1af4
+	.quad	.LBB161
+	.quad	.LBE161-.LBB161
+	.byte	0x57
+	.byte	0xf
+	.uleb128 0x1
+	.long	0x1b11
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x1
+	.long	0x1b04
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bfb
+	.quad	.LBB108
+	.quad	.LBE108-.LBB108
+	.byte	0x41
+	.byte	0x17
+	.long	0x14a3
+	.uleb128 0x1
+	.long	0x1c0b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -262
+	.uleb128 0x15
+	.long	0x1c19
+	.quad	.LBB110
+	.quad	.LBE110-.LBB110
+	.byte	0x2
+	.value	0x28a
+	.uleb128 0x1
+	.long	0x1c82
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -278
+	.uleb128 0x1
+	.long	0x1c75
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -276
+	.uleb128 0x1
+	.long	0x1c68
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -274
+	.uleb128 0x1
+	.long	0x1c5b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x1
+	.long	0x1c4e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -270
+	.uleb128 0x1
+	.long	0x1c41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -268
+	.uleb128 0x1
+	.long	0x1c34
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -266
+	.uleb128 0x1
+	.long	0x1c27
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -264
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bfb
+	.quad	.LBB112
+	.quad	.LBE112-.LBB112
+	.byte	0x42
+	.byte	0x19
+	.long	0x1529
+	.uleb128 0x1
+	.long	0x1c0b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -244
+	.uleb128 0x15
+	.long	0x1c19
+	.quad	.LBB114
+	.quad	.LBE114-.LBB114
+	.byte	0x2
+	.value	0x28a
+	.uleb128 0x1
+	.long	0x1c82
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -260
+	.uleb128 0x1
+	.long	0x1c75
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -258
+	.uleb128 0x1
+	.long	0x1c68
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x1
+	.long	0x1c5b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -254
+	.uleb128 0x1
+	.long	0x1c4e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -252
+	.uleb128 0x1
+	.long	0x1c41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -250
+	.uleb128 0x1
+	.long	0x1c34
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.uleb128 0x1
+	.long	0x1c27
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -246
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bfb
+	.quad	.LBB116
+	.quad	.LBE116-.LBB116
+	.byte	0x43
+	.byte	0x1d
+	.long	0x15af
+	.uleb128 0x1
+	.long	0x1c0b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -226
+	.uleb128 0x15
+	.long	0x1c19
+	.quad	.LBB118
+	.quad	.LBE118-.LBB118
+	.byte	0x2
+	.value	0x28a
+	.uleb128 0x1
+	.long	0x1c82
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -242
+	.uleb128 0x1
+	.long	0x1c75
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x1
+	.long	0x1c68
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -238
+	.uleb128 0x1
+	.long	0x1c5b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -236
+	.uleb128 0x1
+	.long	0x1c4e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -234
+	.uleb128 0x1
+	.long	0x1c41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.uleb128 0x1
+	.long	0x1c34
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -230
+	.uleb128 0x1
+	.long	0x1c27
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -228
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	0x1ba0
+	.quad	.LBB120
+	.quad	.LBE120-.LBB120
+	.byte	0x44
+	.byte	0x13
+	.uleb128 0x19
+	.long	0x1bac
+	.quad	.LBB163
+	.quad	.LBE163-.LBB163
+	.byte	0x5b
+	.byte	0x5
+	.uleb128 0x1
+	.long	0x1bc5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -880
+	.uleb128 0x1
+	.long	0x1bb8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -864
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0xd7
+	.long	0x1601
+	.uleb128 0x1d
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF115
+	.byte	0x28
+	.long	0xd7
+	.quad	.LFB4832
+	.quad	.LFE4832-.LFB4832
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16c3
+	.uleb128 0x5
+	.long	.LASF38
+	.byte	0x28
+	.byte	0x32
+	.long	0x2df
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF86
+	.byte	0x28
+	.byte	0x4f
+	.long	0x2e4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x5
+	.long	.LASF87
+	.byte	0x28
+	.byte	0x68
+	.long	0x2e4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x5
+	.long	.LASF103
+	.byte	0x29
+	.byte	0x31
+	.long	0xb5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x5
+	.long	.LASF36
+	.byte	0x29
+	.byte	0x3b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xe
+	.string	"acc"
+	.byte	0x2b
+	.byte	0xd
+	.long	0xd7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x11
+	.quad	.LBB106
+	.quad	.LBE106-.LBB106
+	.uleb128 0xe
+	.string	"k"
+	.byte	0x2d
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x11
+	.quad	.LBB107
+	.quad	.LBE107-.LBB107
+	.uleb128 0x6
+	.long	.LASF108
+	.byte	0x2f
+	.byte	0x17
+	.long	0xd2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xe
+	.string	"c"
+	.byte	0x30
+	.byte	0x17
+	.long	0xc1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -34
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF116
+	.byte	0x1
+	.byte	0x1f
+	.byte	0x17
+	.long	0xb5
+	.quad	.LFB4831
+	.quad	.LFE4831-.LFB4831
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1710
+	.uleb128 0x5
+	.long	.LASF117
+	.byte	0x1f
+	.byte	0x31
+	.long	0xc6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.long	.LASF104
+	.byte	0x1f
+	.byte	0x40
+	.long	0xc6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.long	.LASF118
+	.byte	0x1f
+	.byte	0x51
+	.long	0xc6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF119
+	.byte	0x4
+	.value	0x213
+	.long	0x4e9
+	.long	0x173b
+	.uleb128 0x3
+	.string	"__X"
+	.byte	0x4
+	.value	0x213
+	.byte	0x1e
+	.long	0x4e9
+	.uleb128 0x3
+	.string	"__Y"
+	.byte	0x4
+	.value	0x213
+	.byte	0x2b
+	.long	0x4e9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF120
+	.byte	0x4
+	.value	0x1db
+	.long	0x4e9
+	.long	0x1759
+	.uleb128 0x3
+	.string	"__X"
+	.byte	0x4
+	.value	0x1db
+	.byte	0x20
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF121
+	.byte	0x4
+	.value	0x164
+	.long	0x4e9
+	.long	0x1784
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x4
+	.value	0x164
+	.byte	0x1b
+	.long	0x4e9
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x4
+	.value	0x164
+	.byte	0x28
+	.long	0x4e9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF122
+	.byte	0x4
+	.value	0x155
+	.long	0x4e9
+	.long	0x17af
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x4
+	.value	0x155
+	.byte	0x1c
+	.long	0x4e9
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x4
+	.value	0x155
+	.byte	0x29
+	.long	0x4e9
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF123
+	.byte	0x8c
+	.long	0x4e9
+	.long	0x17d4
+	.uleb128 0x1a
+	.string	"__A"
+	.byte	0x8c
+	.byte	0x1c
+	.long	0x4e9
+	.uleb128 0x1a
+	.string	"__B"
+	.byte	0x8c
+	.byte	0x29
+	.long	0x4e9
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF124
+	.byte	0x7e
+	.long	0x4e9
+	.long	0x17f9
+	.uleb128 0x1a
+	.string	"__A"
+	.byte	0x7e
+	.byte	0x1b
+	.long	0x4e9
+	.uleb128 0x1a
+	.string	"__B"
+	.byte	0x7e
+	.byte	0x28
+	.long	0x4e9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF125
+	.byte	0x3
+	.value	0x5bb
+	.long	0x45c
+	.long	0x1817
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x5bb
+	.byte	0x21
+	.long	0x4e9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF126
+	.byte	0x3
+	.value	0x535
+	.long	0x4e9
+	.long	0x1835
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x535
+	.byte	0x1a
+	.long	0x88
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF127
+	.byte	0x3
+	.value	0x4f9
+	.long	0x4e9
+	.long	0x1916
+	.uleb128 0x7
+	.long	.LASF128
+	.byte	0x3
+	.value	0x4f9
+	.byte	0x19
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF129
+	.byte	0x3
+	.value	0x4f9
+	.byte	0x26
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF130
+	.byte	0x3
+	.value	0x4f9
+	.byte	0x33
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF131
+	.byte	0x3
+	.value	0x4f9
+	.byte	0x40
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF132
+	.byte	0x3
+	.value	0x4fa
+	.byte	0xb
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF133
+	.byte	0x3
+	.value	0x4fa
+	.byte	0x18
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF134
+	.byte	0x3
+	.value	0x4fa
+	.byte	0x25
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF135
+	.byte	0x3
+	.value	0x4fa
+	.byte	0x32
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF136
+	.byte	0x3
+	.value	0x4fb
+	.byte	0xb
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF137
+	.byte	0x3
+	.value	0x4fb
+	.byte	0x18
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF138
+	.byte	0x3
+	.value	0x4fb
+	.byte	0x25
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF139
+	.byte	0x3
+	.value	0x4fb
+	.byte	0x32
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF140
+	.byte	0x3
+	.value	0x4fc
+	.byte	0xb
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF141
+	.byte	0x3
+	.value	0x4fc
+	.byte	0x18
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF142
+	.byte	0x3
+	.value	0x4fc
+	.byte	0x25
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF143
+	.byte	0x3
+	.value	0x4fc
+	.byte	0x32
+	.long	0x88
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF159
+	.byte	0x3
+	.value	0x4da
+	.long	0x4e9
+	.uleb128 0x2a
+	.long	.LASF144
+	.byte	0x3
+	.value	0x3a5
+	.long	0x1949
+	.uleb128 0x3
+	.string	"__P"
+	.byte	0x3
+	.value	0x3a5
+	.byte	0x21
+	.long	0x1949
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x3
+	.value	0x3a5
+	.byte	0x2e
+	.long	0x4e9
+	.byte	0
+	.uleb128 0xa
+	.long	0x506
+	.uleb128 0x8
+	.long	.LASF145
+	.byte	0x3
+	.value	0x39f
+	.long	0x4e9
+	.long	0x196c
+	.uleb128 0x3
+	.string	"__P"
+	.byte	0x3
+	.value	0x39f
+	.byte	0x26
+	.long	0x196c
+	.byte	0
+	.uleb128 0xa
+	.long	0x511
+	.uleb128 0x8
+	.long	.LASF146
+	.byte	0x2
+	.value	0x57f
+	.long	0x45c
+	.long	0x199c
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x57f
+	.byte	0x18
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x57f
+	.byte	0x25
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF147
+	.byte	0x2
+	.value	0x51d
+	.long	0x45c
+	.long	0x19c7
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x51d
+	.byte	0x18
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x51d
+	.byte	0x25
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF148
+	.byte	0x2
+	.value	0x4db
+	.long	0x45c
+	.long	0x19f2
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x4db
+	.byte	0x19
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x4db
+	.byte	0x22
+	.long	0x46
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF149
+	.byte	0x2
+	.value	0x4b2
+	.long	0x45c
+	.long	0x1a1d
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x4b2
+	.byte	0x19
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x4b2
+	.byte	0x22
+	.long	0x46
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF150
+	.byte	0x2
+	.value	0x49a
+	.long	0x45c
+	.long	0x1a48
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x49a
+	.byte	0x19
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x49a
+	.byte	0x22
+	.long	0x46
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF151
+	.byte	0x2
+	.value	0x488
+	.long	0x45c
+	.long	0x1a73
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x488
+	.byte	0x1a
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x488
+	.byte	0x27
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF152
+	.byte	0x2
+	.value	0x482
+	.long	0x45c
+	.long	0x1a9e
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x482
+	.byte	0x1a
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x482
+	.byte	0x27
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF153
+	.byte	0x2
+	.value	0x47c
+	.long	0x45c
+	.long	0x1ac9
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x47c
+	.byte	0x19
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x47c
+	.byte	0x26
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF154
+	.byte	0x2
+	.value	0x43a
+	.long	0x45c
+	.long	0x1af4
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x43a
+	.byte	0x19
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x43a
+	.byte	0x26
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF155
+	.byte	0x2
+	.value	0x42e
+	.long	0x45c
+	.long	0x1b1f
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x42e
+	.byte	0x18
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x42e
+	.byte	0x25
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF156
+	.byte	0x2
+	.value	0x422
+	.long	0x45c
+	.long	0x1b4a
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x422
+	.byte	0x18
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x422
+	.byte	0x25
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF157
+	.byte	0x2
+	.value	0x410
+	.long	0x45c
+	.long	0x1b75
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x410
+	.byte	0x1d
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x410
+	.byte	0x2a
+	.long	0x45c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF158
+	.byte	0x2
+	.value	0x3f8
+	.long	0x45c
+	.long	0x1ba0
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x3f8
+	.byte	0x1d
+	.long	0x45c
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x3f8
+	.byte	0x2a
+	.long	0x45c
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF160
+	.byte	0x2
+	.value	0x31a
+	.long	0x45c
+	.uleb128 0x2a
+	.long	.LASF161
+	.byte	0x2
+	.value	0x2e1
+	.long	0x1bd3
+	.uleb128 0x3
+	.string	"__P"
+	.byte	0x2
+	.value	0x2e1
+	.byte	0x1e
+	.long	0x1bd3
+	.uleb128 0x3
+	.string	"__B"
+	.byte	0x2
+	.value	0x2e1
+	.byte	0x2b
+	.long	0x45c
+	.byte	0
+	.uleb128 0xa
+	.long	0x479
+	.uleb128 0x8
+	.long	.LASF162
+	.byte	0x2
+	.value	0x2bd
+	.long	0x45c
+	.long	0x1bf6
+	.uleb128 0x3
+	.string	"__P"
+	.byte	0x2
+	.value	0x2bd
+	.byte	0x23
+	.long	0x1bf6
+	.byte	0
+	.uleb128 0xa
+	.long	0x484
+	.uleb128 0x8
+	.long	.LASF163
+	.byte	0x2
+	.value	0x288
+	.long	0x45c
+	.long	0x1c19
+	.uleb128 0x3
+	.string	"__A"
+	.byte	0x2
+	.value	0x288
+	.byte	0x17
+	.long	0x88
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF164
+	.byte	0x2
+	.value	0x260
+	.byte	0x1
+	.long	0x45c
+	.byte	0x3
+	.uleb128 0x7
+	.long	.LASF165
+	.byte	0x2
+	.value	0x260
+	.byte	0x16
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF166
+	.byte	0x2
+	.value	0x260
+	.byte	0x22
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF167
+	.byte	0x2
+	.value	0x260
+	.byte	0x2e
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF168
+	.byte	0x2
+	.value	0x260
+	.byte	0x3a
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF169
+	.byte	0x2
+	.value	0x261
+	.byte	0xf
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF170
+	.byte	0x2
+	.value	0x261
+	.byte	0x1b
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF171
+	.byte	0x2
+	.value	0x261
+	.byte	0x27
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF172
+	.byte	0x2
+	.value	0x261
+	.byte	0x33
+	.long	0x88
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0x21
+	.sleb128 10
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF67:
+	.string	"printf"
+.LASF110:
+	.string	"lmsFixed_UpdateDotAvx2"
+.LASF71:
+	.string	"count"
+.LASF62:
+	.string	"_Float16"
+.LASF105:
+	.string	"acc0"
+.LASF106:
+	.string	"acc1"
+.LASF9:
+	.string	"size_t"
+.LASF153:
+	.string	"_mm_madd_epi16"
+.LASF164:
+	.string	"_mm_set_epi16"
+.LASF174:
+	.string	"lmsFixed_DelayLinePush"
+.LASF86:
+	.string	"previous"
+.LASF27:
+	.string	"type"
+.LASF58:
+	.string	"__v16hi"
+.LASF102:
+	.string	"retval"
+.LASF53:
+	.string	"__v8hu"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF160:
+	.string	"_mm_setzero_si128"
+.LASF31:
+	.string	"leakyUpdateDot"
+.LASF59:
+	.string	"__m256i"
+.LASF108:
+	.string	"delta"
+.LASF25:
+	.string	"LMS_KERNEL_COUNT"
+.LASF90:
+	.string	"sample"
+.LASF38:
+	.string	"coefficients"
+.LASF13:
+	.string	"__int64_t"
+.LASF15:
+	.string	"int16_t"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF47:
+	.string	"release"
+.LASF150:
+	.string	"_mm_slli_epi16"
+.LASF148:
+	.string	"_mm_srli_epi16"
+.LASF39:
+	.string	"delayLine"
+.LASF3:
+	.string	"long int"
+.LASF63:
+	.string	"lrintf"
+.LASF159:
+	.string	"_mm256_setzero_si256"
+.LASF171:
+	.string	"__q1"
+.LASF147:
+	.string	"_mm_and_si128"
+.LASF152:
+	.string	"_mm_mulhi_epi16"
+.LASF169:
+	.string	"__q3"
+.LASF96:
+	.string	"lmsFixed_Init"
+.LASF20:
+	.string	"double"
+.LASF166:
+	.string	"__q6"
+.LASF165:
+	.string	"__q7"
+.LASF77:
+	.string	"shift"
+.LASF26:
+	.string	"LmsKernelType_t"
+.LASF163:
+	.string	"_mm_set1_epi16"
+.LASF24:
+	.string	"LMS_KERNEL_AVX512"
+.LASF69:
+	.string	"lmsKernel_GetBest"
+.LASF64:
+	.string	"log2f"
+.LASF74:
+	.string	"lmsFixed_FromFloat"
+.LASF107:
+	.string	"lanes"
+.LASF93:
+	.string	"lmsFixed_Free"
+.LASF68:
+	.string	"lmsAllocator_Heap"
+.LASF32:
+	.string	"signUpdateDot"
+.LASF124:
+	.string	"_mm256_add_epi64"
+.LASF10:
+	.string	"__int16_t"
+.LASF104:
+	.string	"minimum"
+.LASF78:
+	.string	"lmsFixed_ProcessBlock"
+.LASF117:
+	.string	"value"
+.LASF43:
+	.string	"memory"
+.LASF157:
+	.string	"_mm_unpacklo_epi32"
+.LASF7:
+	.string	"unsigned int"
+.LASF149:
+	.string	"_mm_srai_epi32"
+.LASF21:
+	.string	"LMS_KERNEL_SCALAR"
+.LASF145:
+	.string	"_mm256_loadu_si256"
+.LASF126:
+	.string	"_mm256_set1_epi16"
+.LASF82:
+	.string	"output"
+.LASF28:
+	.string	"name"
+.LASF70:
+	.string	"lmsKernel_IsSupported"
+.LASF92:
+	.string	"size"
+.LASF6:
+	.string	"short unsigned int"
+.LASF51:
+	.string	"__v4si"
+.LASF151:
+	.string	"_mm_mullo_epi16"
+.LASF109:
+	.string	"pairs"
+.LASF146:
+	.string	"_mm_max_epi16"
+.LASF115:
+	.string	"lmsFixed_UpdateDotScalar"
+.LASF55:
+	.string	"__v4di"
+.LASF91:
+	.string	"window"
+.LASF97:
+	.string	"coefficientBytes"
+.LASF11:
+	.string	"short int"
+.LASF120:
+	.string	"_mm256_cvtepi32_epi64"
+.LASF23:
+	.string	"LMS_KERNEL_AVX2"
+.LASF81:
+	.string	"desired"
+.LASF95:
+	.string	"lmsFixed_StepShift"
+.LASF161:
+	.string	"_mm_storeu_si128"
+.LASF54:
+	.string	"__m128i"
+.LASF75:
+	.string	"scaled"
+.LASF99:
+	.string	"totalBytes"
+.LASF45:
+	.string	"long double"
+.LASF22:
+	.string	"LMS_KERNEL_SSE2"
+.LASF125:
+	.string	"_mm256_castsi256_si128"
+.LASF30:
+	.string	"updateDot"
+.LASF79:
+	.string	"filter"
+.LASF119:
+	.string	"_mm256_mulhrs_epi16"
+.LASF88:
+	.string	"rounded"
+.LASF123:
+	.string	"_mm256_adds_epi16"
+.LASF87:
+	.string	"current"
+.LASF19:
+	.string	"float"
+.LASF83:
+	.string	"error"
+.LASF49:
+	.string	"LmsAllocator_t"
+.LASF52:
+	.string	"__v8hi"
+.LASF66:
+	.string	"lmsAllocator_AlignedSize"
+.LASF162:
+	.string	"_mm_loadu_si128"
+.LASF103:
+	.string	"gain"
+.LASF72:
+	.string	"lmsFixedKernels"
+.LASF16:
+	.string	"int32_t"
+.LASF158:
+	.string	"_mm_unpackhi_epi32"
+.LASF44:
+	.string	"LmsFixed_t"
+.LASF84:
+	.string	"numOfSamples"
+.LASF168:
+	.string	"__q4"
+.LASF76:
+	.string	"step"
+.LASF167:
+	.string	"__q5"
+.LASF35:
+	.string	"LmsFixedKernel_t"
+.LASF57:
+	.string	"__v8si"
+.LASF143:
+	.string	"__q00"
+.LASF142:
+	.string	"__q01"
+.LASF141:
+	.string	"__q02"
+.LASF140:
+	.string	"__q03"
+.LASF139:
+	.string	"__q04"
+.LASF138:
+	.string	"__q05"
+.LASF137:
+	.string	"__q06"
+.LASF136:
+	.string	"__q07"
+.LASF135:
+	.string	"__q08"
+.LASF134:
+	.string	"__q09"
+.LASF118:
+	.string	"maximum"
+.LASF85:
+	.string	"round"
+.LASF80:
+	.string	"input"
+.LASF116:
+	.string	"lmsFixed_Saturate"
+.LASF133:
+	.string	"__q10"
+.LASF94:
+	.string	"heap"
+.LASF2:
+	.string	"long unsigned int"
+.LASF36:
+	.string	"length"
+.LASF154:
+	.string	"_mm_adds_epi16"
+.LASF14:
+	.string	"char"
+.LASF173:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF41:
+	.string	"pendingGain"
+.LASF155:
+	.string	"_mm_add_epi64"
+.LASF98:
+	.string	"delayLineBytes"
+.LASF12:
+	.string	"__int32_t"
+.LASF172:
+	.string	"__q0"
+.LASF40:
+	.string	"delayIndex"
+.LASF170:
+	.string	"__q2"
+.LASF50:
+	.string	"__v2du"
+.LASF132:
+	.string	"__q11"
+.LASF131:
+	.string	"__q12"
+.LASF130:
+	.string	"__q13"
+.LASF129:
+	.string	"__q14"
+.LASF128:
+	.string	"__q15"
+.LASF48:
+	.string	"context"
+.LASF5:
+	.string	"unsigned char"
+.LASF122:
+	.string	"_mm256_madd_epi16"
+.LASF112:
+	.string	"productLow"
+.LASF29:
+	.string	"update"
+.LASF100:
+	.string	"lmsFixed_GetBestKernel"
+.LASF127:
+	.string	"_mm256_set_epi16"
+.LASF65:
+	.string	"memset"
+.LASF111:
+	.string	"lmsFixed_UpdateDotSse2"
+.LASF144:
+	.string	"_mm256_storeu_si256"
+.LASF60:
+	.string	"__m128i_u"
+.LASF114:
+	.string	"sign"
+.LASF33:
+	.string	"bankUpdateDot"
+.LASF56:
+	.string	"__v4du"
+.LASF61:
+	.string	"__m256i_u"
+.LASF37:
+	.string	"stepShift"
+.LASF73:
+	.string	"lmsFixed_ToFloat"
+.LASF121:
+	.string	"_mm256_max_epi16"
+.LASF113:
+	.string	"productHigh"
+.LASF17:
+	.string	"int64_t"
+.LASF42:
+	.string	"kernel"
+.LASF101:
+	.string	"lmsFixed_GetKernel"
+.LASF34:
+	.string	"LmsKernel_t"
+.LASF156:
+	.string	"_mm_add_epi16"
+.LASF46:
+	.string	"allocate"
+.LASF89:
+	.string	"lmsFixed_PushSample"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"source/lmsFixed.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
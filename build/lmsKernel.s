@@ -0,0 +1,20316 @@
+	.file	"lmsKernel.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsKernel.c"
+	.type	lmsKernel_DotScalar, @function
+lmsKernel_DotScalar:
+.LFB4831:
+	.file 1 "source/lmsKernel.c"
+	.loc 1 25 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	DWORD PTR -52[rbp], edx
+	.loc 1 26 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 26 24
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 26 37
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 26 50
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -16[rbp], xmm0
+	.loc 1 27 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 29 5
+	jmp	.L2
+.L3:
+	.loc 1 31 18 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 31 25 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 31 22 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 31 14 discriminator 2
+	movss	xmm1, DWORD PTR -4[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 32 18 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 32 29 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 32 26 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 32 14 discriminator 2
+	movss	xmm1, DWORD PTR -8[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 33 18 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	add	rax, 2
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 33 29 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	add	rax, 2
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 33 26 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 33 14 discriminator 2
+	movss	xmm1, DWORD PTR -12[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 34 18 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	add	rax, 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 34 29 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	add	rax, 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 34 26 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 34 14 discriminator 2
+	movss	xmm1, DWORD PTR -16[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -16[rbp], xmm0
+	.loc 1 29 31 discriminator 2
+	add	DWORD PTR -20[rbp], 4
+.L2:
+	.loc 1 29 18 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	add	eax, 3
+	cmp	DWORD PTR -52[rbp], eax
+	jg	.L3
+	.loc 1 36 5
+	jmp	.L4
+.L5:
+	.loc 1 38 18 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 38 25 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 38 22 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 38 14 discriminator 2
+	movss	xmm1, DWORD PTR -4[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 36 25 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L4:
+	.loc 1 36 14 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	jl	.L5
+	.loc 1 40 18
+	movss	xmm0, DWORD PTR -4[rbp]
+	movaps	xmm1, xmm0
+	addss	xmm1, DWORD PTR -8[rbp]
+	.loc 1 40 34
+	movss	xmm0, DWORD PTR -12[rbp]
+	addss	xmm0, DWORD PTR -16[rbp]
+	.loc 1 40 26
+	addss	xmm0, xmm1
+	.loc 1 41 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4831:
+	.size	lmsKernel_DotScalar, .-lmsKernel_DotScalar
+	.type	lmsKernel_UpdateScalar, @function
+lmsKernel_UpdateScalar:
+.LFB4832:
+	.loc 1 44 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	movss	DWORD PTR -36[rbp], xmm0
+	mov	DWORD PTR -40[rbp], edx
+.LBB789:
+	.loc 1 45 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 45 5
+	jmp	.L8
+.L9:
+	.loc 1 47 21 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 47 40 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 47 33 discriminator 3
+	mulss	xmm0, DWORD PTR -36[rbp]
+	.loc 1 47 21 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 47 25 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 45 34 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L8:
+	.loc 1 45 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -40[rbp]
+	jl	.L9
+.LBE789:
+	.loc 1 49 1
+	nop
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4832:
+	.size	lmsKernel_UpdateScalar, .-lmsKernel_UpdateScalar
+	.type	lmsKernel_UpdateDotScalar, @function
+lmsKernel_UpdateDotScalar:
+.LFB4833:
+	.loc 1 53 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	movss	DWORD PTR -44[rbp], xmm0
+	mov	DWORD PTR -48[rbp], ecx
+	.loc 1 54 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 54 24
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 55 9
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 57 5
+	jmp	.L11
+.L12:
+	.loc 1 59 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 59 43 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 59 33 discriminator 2
+	mulss	xmm0, DWORD PTR -44[rbp]
+	.loc 1 59 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 59 25 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 60 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 60 47 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 60 37 discriminator 2
+	mulss	xmm0, DWORD PTR -44[rbp]
+	.loc 1 60 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 60 29 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 61 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 61 42 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 61 33 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 61 14 discriminator 2
+	movss	xmm1, DWORD PTR -4[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 62 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 62 46 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 62 37 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 62 14 discriminator 2
+	movss	xmm1, DWORD PTR -8[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 57 31 discriminator 2
+	add	DWORD PTR -12[rbp], 2
+.L11:
+	.loc 1 57 18 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, 1
+	cmp	DWORD PTR -48[rbp], eax
+	jg	.L12
+	.loc 1 64 5
+	jmp	.L13
+.L14:
+	.loc 1 66 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 66 43 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 66 33 discriminator 2
+	mulss	xmm0, DWORD PTR -44[rbp]
+	.loc 1 66 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 66 25 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 67 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 67 42 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 67 33 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 67 14 discriminator 2
+	movss	xmm1, DWORD PTR -4[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 64 25 discriminator 2
+	add	DWORD PTR -12[rbp], 1
+.L13:
+	.loc 1 64 14 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -48[rbp]
+	jl	.L14
+	.loc 1 69 17
+	movss	xmm0, DWORD PTR -4[rbp]
+	addss	xmm0, DWORD PTR -8[rbp]
+	.loc 1 70 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4833:
+	.size	lmsKernel_UpdateDotScalar, .-lmsKernel_UpdateDotScalar
+	.type	lmsKernel_LeakyUpdateDotScalar, @function
+lmsKernel_LeakyUpdateDotScalar:
+.LFB4834:
+	.loc 1 74 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	movss	DWORD PTR -44[rbp], xmm0
+	movss	DWORD PTR -48[rbp], xmm1
+	mov	DWORD PTR -52[rbp], ecx
+	.loc 1 75 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 75 24
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 76 9
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 78 5
+	jmp	.L17
+.L18:
+	.loc 1 80 46 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 80 32 discriminator 2
+	movaps	xmm1, xmm0
+	mulss	xmm1, DWORD PTR -48[rbp]
+	.loc 1 80 67 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 80 57 discriminator 2
+	mulss	xmm0, DWORD PTR -44[rbp]
+	.loc 1 80 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 80 50 discriminator 2
+	addss	xmm0, xmm1
+	.loc 1 80 25 discriminator 2
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 81 50 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 81 36 discriminator 2
+	movaps	xmm1, xmm0
+	mulss	xmm1, DWORD PTR -48[rbp]
+	.loc 1 81 75 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 81 65 discriminator 2
+	mulss	xmm0, DWORD PTR -44[rbp]
+	.loc 1 81 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 81 58 discriminator 2
+	addss	xmm0, xmm1
+	.loc 1 81 29 discriminator 2
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 82 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 82 42 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 82 33 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 82 14 discriminator 2
+	movss	xmm1, DWORD PTR -4[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 83 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 83 46 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 83 37 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 83 14 discriminator 2
+	movss	xmm1, DWORD PTR -8[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 78 31 discriminator 2
+	add	DWORD PTR -12[rbp], 2
+.L17:
+	.loc 1 78 18 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, 1
+	cmp	DWORD PTR -52[rbp], eax
+	jg	.L18
+	.loc 1 85 5
+	jmp	.L19
+.L20:
+	.loc 1 87 46 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 87 32 discriminator 2
+	movaps	xmm1, xmm0
+	mulss	xmm1, DWORD PTR -48[rbp]
+	.loc 1 87 67 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 87 57 discriminator 2
+	mulss	xmm0, DWORD PTR -44[rbp]
+	.loc 1 87 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 87 50 discriminator 2
+	addss	xmm0, xmm1
+	.loc 1 87 25 discriminator 2
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 88 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 88 42 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 88 33 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 88 14 discriminator 2
+	movss	xmm1, DWORD PTR -4[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 85 25 discriminator 2
+	add	DWORD PTR -12[rbp], 1
+.L19:
+	.loc 1 85 14 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	jl	.L20
+	.loc 1 90 17
+	movss	xmm0, DWORD PTR -4[rbp]
+	addss	xmm0, DWORD PTR -8[rbp]
+	.loc 1 91 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4834:
+	.size	lmsKernel_LeakyUpdateDotScalar, .-lmsKernel_LeakyUpdateDotScalar
+	.type	lmsKernel_Sign, @function
+lmsKernel_Sign:
+.LFB4835:
+	.loc 1 94 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 95 23
+	movss	xmm0, DWORD PTR -4[rbp]
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	movzx	edx, al
+	.loc 1 95 36
+	pxor	xmm0, xmm0
+	comiss	xmm0, DWORD PTR -4[rbp]
+	seta	al
+	movzx	eax, al
+	.loc 1 95 31
+	sub	edx, eax
+	.loc 1 95 12
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, edx
+	.loc 1 96 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4835:
+	.size	lmsKernel_Sign, .-lmsKernel_Sign
+	.type	lmsKernel_SignUpdateDotScalar, @function
+lmsKernel_SignUpdateDotScalar:
+.LFB4836:
+	.loc 1 100 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	movss	DWORD PTR -44[rbp], xmm0
+	mov	DWORD PTR -48[rbp], ecx
+	.loc 1 101 11
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 101 24
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 102 9
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 104 5
+	jmp	.L25
+.L26:
+	.loc 1 106 58 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 106 35 discriminator 2
+	mov	eax, DWORD PTR [rax]
+	movd	xmm0, eax
+	call	lmsKernel_Sign
+	movd	eax, xmm0
+	.loc 1 106 33 discriminator 2
+	movd	xmm1, eax
+	mulss	xmm1, DWORD PTR -44[rbp]
+	.loc 1 106 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 106 25 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 107 62 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 107 39 discriminator 2
+	mov	eax, DWORD PTR [rax]
+	movd	xmm0, eax
+	call	lmsKernel_Sign
+	movd	eax, xmm0
+	.loc 1 107 37 discriminator 2
+	movd	xmm1, eax
+	mulss	xmm1, DWORD PTR -44[rbp]
+	.loc 1 107 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 107 29 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 108 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 108 42 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 108 33 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 108 14 discriminator 2
+	movss	xmm1, DWORD PTR -4[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 109 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 109 46 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 109 37 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 109 14 discriminator 2
+	movss	xmm1, DWORD PTR -8[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 104 31 discriminator 2
+	add	DWORD PTR -12[rbp], 2
+.L25:
+	.loc 1 104 18 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, 1
+	cmp	DWORD PTR -48[rbp], eax
+	jg	.L26
+	.loc 1 111 5
+	jmp	.L27
+.L28:
+	.loc 1 113 58 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 113 35 discriminator 2
+	mov	eax, DWORD PTR [rax]
+	movd	xmm0, eax
+	call	lmsKernel_Sign
+	movd	eax, xmm0
+	.loc 1 113 33 discriminator 2
+	movd	xmm1, eax
+	mulss	xmm1, DWORD PTR -44[rbp]
+	.loc 1 113 21 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 113 25 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 114 29 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 114 42 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 114 33 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 114 14 discriminator 2
+	movss	xmm1, DWORD PTR -4[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 111 25 discriminator 2
+	add	DWORD PTR -12[rbp], 1
+.L27:
+	.loc 1 111 14 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -48[rbp]
+	jl	.L28
+	.loc 1 116 17
+	movss	xmm0, DWORD PTR -4[rbp]
+	addss	xmm0, DWORD PTR -8[rbp]
+	.loc 1 117 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4836:
+	.size	lmsKernel_SignUpdateDotScalar, .-lmsKernel_SignUpdateDotScalar
+	.type	lmsKernel_BankUpdateDotScalar, @function
+lmsKernel_BankUpdateDotScalar:
+.LFB4837:
+	.loc 1 121 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -56[rbp], rdi
+	mov	QWORD PTR -64[rbp], rsi
+	mov	QWORD PTR -72[rbp], rdx
+	mov	QWORD PTR -80[rbp], rcx
+	mov	QWORD PTR -88[rbp], r8
+	mov	DWORD PTR -92[rbp], r9d
+.LBB790:
+	.loc 1 122 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 122 5
+	jmp	.L31
+.L32:
+	.loc 1 124 15 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 124 20 discriminator 3
+	pxor	xmm0, xmm0
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 122 37 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L31:
+	.loc 1 122 25 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR 16[rbp]
+	jl	.L32
+.LBE790:
+.LBB791:
+	.loc 1 126 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 126 5
+	jmp	.L33
+.L36:
+.LBB792:
+	.loc 1 128 34
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	.loc 1 128 44
+	mov	eax, DWORD PTR 16[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 128 33
+	lea	rdx, 0[0+rax*4]
+	.loc 1 128 16
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 129 36
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	.loc 1 129 46
+	mov	eax, DWORD PTR 16[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 129 35
+	lea	rdx, 0[0+rax*4]
+	.loc 1 129 22
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 130 35
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	.loc 1 130 45
+	mov	eax, DWORD PTR 16[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 130 34
+	lea	rdx, 0[0+rax*4]
+	.loc 1 130 22
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -40[rbp], rax
+.LBB793:
+	.loc 1 132 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 132 9
+	jmp	.L34
+.L35:
+	.loc 1 134 14 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 134 26 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 134 34 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 134 31 discriminator 3
+	mulss	xmm0, xmm2
+	.loc 1 134 14 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 134 19 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 135 19 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 135 28 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 135 36 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 135 33 discriminator 3
+	mulss	xmm0, xmm2
+	.loc 1 135 19 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 135 24 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 132 41 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L34:
+	.loc 1 132 29 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR 16[rbp]
+	jl	.L35
+.LBE793:
+.LBE792:
+	.loc 1 126 34 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L33:
+	.loc 1 126 23 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -92[rbp]
+	jl	.L36
+.LBE791:
+	.loc 1 138 1
+	nop
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4837:
+	.size	lmsKernel_BankUpdateDotScalar, .-lmsKernel_BankUpdateDotScalar
+	.type	lmsKernel_HorizontalSumSse2, @function
+lmsKernel_HorizontalSumSse2:
+.LFB4838:
+	.loc 1 148 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 40
+	movaps	XMMWORD PTR -160[rbp], xmm0
+	.loc 1 149 19
+	movaps	xmm0, XMMWORD PTR -160[rbp]
+	shufps	xmm0, xmm0, 177
+	movaps	XMMWORD PTR -16[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -160[rbp]
+	movaps	XMMWORD PTR -112[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -128[rbp], xmm0
+.LBB794:
+.LBB795:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/xmmintrin.h"
+	.loc 2 186 10
+	movaps	xmm0, XMMWORD PTR -112[rbp]
+	addps	xmm0, XMMWORD PTR -128[rbp]
+.LBE795:
+.LBE794:
+	.loc 1 150 19
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -80[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -96[rbp], xmm0
+.LBB796:
+.LBB797:
+	.loc 2 787 19
+	movaps	xmm0, XMMWORD PTR -80[rbp]
+	movlps	xmm0, QWORD PTR -88[rbp]
+	.loc 2 787 10
+	nop
+.LBE797:
+.LBE796:
+	.loc 1 151 12
+	movaps	XMMWORD PTR -16[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -48[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -64[rbp], xmm0
+.LBB798:
+.LBB799:
+	.loc 2 130 19
+	movaps	xmm0, XMMWORD PTR -48[rbp]
+	addss	xmm0, DWORD PTR -64[rbp]
+	.loc 2 130 10
+	nop
+.LBE799:
+.LBE798:
+	.loc 1 152 12
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -144[rbp], xmm0
+.LBB800:
+.LBB801:
+	.loc 2 969 23
+	movss	xmm0, DWORD PTR -144[rbp]
+.LBE801:
+.LBE800:
+	.loc 1 154 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4838:
+	.size	lmsKernel_HorizontalSumSse2, .-lmsKernel_HorizontalSumSse2
+	.type	lmsKernel_DotSse2, @function
+lmsKernel_DotSse2:
+.LFB4839:
+	.loc 1 158 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 272
+	mov	QWORD PTR -248[rbp], rdi
+	mov	QWORD PTR -256[rbp], rsi
+	mov	DWORD PTR -260[rbp], edx
+.LBB802:
+.LBB803:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE803:
+.LBE802:
+	.loc 1 159 19
+	movaps	XMMWORD PTR -16[rbp], xmm0
+.LBB804:
+.LBB805:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE805:
+.LBE804:
+	.loc 1 160 19
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	.loc 1 161 9
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 163 5
+	jmp	.L46
+.L55:
+	.loc 1 165 80 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 165 16 discriminator 2
+	mov	rax, QWORD PTR -256[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -208[rbp], rax
+.LBB806:
+.LBB807:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -208[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+.LBE807:
+.LBE806:
+	.loc 1 165 59 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 165 16 discriminator 2
+	mov	rax, QWORD PTR -248[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -200[rbp], rax
+.LBB808:
+.LBB809:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -200[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	XMMWORD PTR -176[rbp], xmm0
+	movaps	XMMWORD PTR -192[rbp], xmm1
+.LBE809:
+.LBE808:
+.LBB810:
+.LBB811:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -176[rbp]
+	mulps	xmm0, XMMWORD PTR -192[rbp]
+	movaps	xmm1, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -144[rbp], xmm1
+	movaps	XMMWORD PTR -160[rbp], xmm0
+.LBE811:
+.LBE810:
+.LBB812:
+.LBB813:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -144[rbp]
+	addps	xmm0, XMMWORD PTR -160[rbp]
+.LBE813:
+.LBE812:
+	.loc 1 165 16 discriminator 2
+	movaps	XMMWORD PTR -16[rbp], xmm0
+	.loc 1 166 88 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	add	rax, 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 166 16 discriminator 2
+	mov	rax, QWORD PTR -256[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -128[rbp], rax
+.LBB814:
+.LBB815:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -128[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+.LBE815:
+.LBE814:
+	.loc 1 166 63 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	add	rax, 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 166 16 discriminator 2
+	mov	rax, QWORD PTR -248[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -120[rbp], rax
+.LBB816:
+.LBB817:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -120[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	XMMWORD PTR -96[rbp], xmm0
+	movaps	XMMWORD PTR -112[rbp], xmm1
+.LBE817:
+.LBE816:
+.LBB818:
+.LBB819:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -96[rbp]
+	mulps	xmm0, XMMWORD PTR -112[rbp]
+	movaps	xmm1, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -64[rbp], xmm1
+	movaps	XMMWORD PTR -80[rbp], xmm0
+.LBE819:
+.LBE818:
+.LBB820:
+.LBB821:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -64[rbp]
+	addps	xmm0, XMMWORD PTR -80[rbp]
+.LBE821:
+.LBE820:
+	.loc 1 166 16 discriminator 2
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	.loc 1 163 31 discriminator 2
+	add	DWORD PTR -36[rbp], 8
+.L46:
+	.loc 1 163 18 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, 7
+	cmp	DWORD PTR -260[rbp], eax
+	jg	.L55
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -224[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -240[rbp], xmm0
+.LBB822:
+.LBB823:
+	.loc 2 186 10
+	movaps	xmm0, XMMWORD PTR -224[rbp]
+	addps	xmm0, XMMWORD PTR -240[rbp]
+.LBE823:
+.LBE822:
+	.loc 1 168 17
+	call	lmsKernel_HorizontalSumSse2
+	movd	eax, xmm0
+	mov	DWORD PTR -40[rbp], eax
+	.loc 1 169 5
+	jmp	.L57
+.L58:
+	.loc 1 171 17 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -248[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 171 24 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -256[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 171 21 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 171 13 discriminator 2
+	movss	xmm1, DWORD PTR -40[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -40[rbp], xmm0
+	.loc 1 169 25 discriminator 2
+	add	DWORD PTR -36[rbp], 1
+.L57:
+	.loc 1 169 14 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -260[rbp]
+	jl	.L58
+	.loc 1 173 12
+	movss	xmm0, DWORD PTR -40[rbp]
+	.loc 1 174 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4839:
+	.size	lmsKernel_DotSse2, .-lmsKernel_DotSse2
+	.type	lmsKernel_UpdateSse2, @function
+lmsKernel_UpdateSse2:
+.LFB4840:
+	.loc 1 178 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 72
+	mov	QWORD PTR -168[rbp], rdi
+	mov	QWORD PTR -176[rbp], rsi
+	movss	DWORD PTR -180[rbp], xmm0
+	mov	DWORD PTR -184[rbp], edx
+	movss	xmm0, DWORD PTR -180[rbp]
+	movss	DWORD PTR -52[rbp], xmm0
+.LBB824:
+.LBB825:
+	.loc 2 894 24
+	movss	xmm0, DWORD PTR -52[rbp]
+	shufps	xmm0, xmm0, 0
+.LBE825:
+.LBE824:
+	.loc 1 179 22
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	.loc 1 180 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 182 5
+	jmp	.L62
+.L67:
+.LBB826:
+	.loc 1 184 46 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -160[rbp], rax
+.LBB827:
+.LBB828:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -160[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+.LBE828:
+.LBE827:
+	.loc 1 184 20 discriminator 2
+	movaps	XMMWORD PTR -48[rbp], xmm0
+	.loc 1 185 60 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 185 13 discriminator 2
+	mov	rax, QWORD PTR -176[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -152[rbp], rax
+.LBB829:
+.LBB830:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -152[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -128[rbp], xmm0
+	movaps	XMMWORD PTR -144[rbp], xmm1
+.LBE830:
+.LBE829:
+.LBB831:
+.LBB832:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -128[rbp]
+	mulps	xmm0, XMMWORD PTR -144[rbp]
+	movaps	xmm1, XMMWORD PTR -48[rbp]
+	movaps	XMMWORD PTR -96[rbp], xmm1
+	movaps	XMMWORD PTR -112[rbp], xmm0
+.LBE832:
+.LBE831:
+.LBB833:
+.LBB834:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -96[rbp]
+	addps	xmm0, XMMWORD PTR -112[rbp]
+.LBE834:
+.LBE833:
+	.loc 1 185 13 discriminator 2
+	movaps	XMMWORD PTR -48[rbp], xmm0
+	.loc 1 186 36 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 186 9 discriminator 2
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -64[rbp], rax
+	movaps	xmm0, XMMWORD PTR -48[rbp]
+	movaps	XMMWORD PTR -80[rbp], xmm0
+.LBB835:
+.LBB836:
+	.loc 2 983 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -80[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 2
+	nop
+.LBE836:
+.LBE835:
+.LBE826:
+	.loc 1 182 31 discriminator 2
+	add	DWORD PTR -4[rbp], 4
+.L62:
+	.loc 1 182 18 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 3
+	cmp	DWORD PTR -184[rbp], eax
+	jg	.L67
+	.loc 1 188 5
+	jmp	.L68
+.L69:
+	.loc 1 190 21 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 190 40 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -176[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 190 33 discriminator 2
+	mulss	xmm0, DWORD PTR -180[rbp]
+	.loc 1 190 21 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, rdx
+	.loc 1 190 25 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 188 25 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L68:
+	.loc 1 188 14 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -184[rbp]
+	jl	.L69
+	.loc 1 192 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4840:
+	.size	lmsKernel_UpdateSse2, .-lmsKernel_UpdateSse2
+	.type	lmsKernel_UpdateDotSse2, @function
+lmsKernel_UpdateDotSse2:
+.LFB4841:
+	.loc 1 197 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 288
+	mov	QWORD PTR -264[rbp], rdi
+	mov	QWORD PTR -272[rbp], rsi
+	mov	QWORD PTR -280[rbp], rdx
+	movss	DWORD PTR -284[rbp], xmm0
+	mov	DWORD PTR -288[rbp], ecx
+	movss	xmm0, DWORD PTR -284[rbp]
+	movss	DWORD PTR -68[rbp], xmm0
+.LBB837:
+.LBB838:
+	.loc 2 894 24
+	movss	xmm0, DWORD PTR -68[rbp]
+	shufps	xmm0, xmm0, 0
+.LBE838:
+.LBE837:
+	.loc 1 198 22
+	movaps	XMMWORD PTR -48[rbp], xmm0
+.LBB839:
+.LBB840:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE840:
+.LBE839:
+	.loc 1 199 18
+	movaps	XMMWORD PTR -16[rbp], xmm0
+	.loc 1 200 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 202 5
+	jmp	.L73
+.L81:
+.LBB841:
+	.loc 1 204 46 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -264[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -256[rbp], rax
+.LBB842:
+.LBB843:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -256[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+.LBE843:
+.LBE842:
+	.loc 1 204 20 discriminator 2
+	movaps	XMMWORD PTR -64[rbp], xmm0
+	.loc 1 205 63 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 205 13 discriminator 2
+	mov	rax, QWORD PTR -272[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -248[rbp], rax
+.LBB844:
+.LBB845:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -248[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -48[rbp]
+	movaps	XMMWORD PTR -224[rbp], xmm0
+	movaps	XMMWORD PTR -240[rbp], xmm1
+.LBE845:
+.LBE844:
+.LBB846:
+.LBB847:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -224[rbp]
+	mulps	xmm0, XMMWORD PTR -240[rbp]
+	movaps	xmm1, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -192[rbp], xmm1
+	movaps	XMMWORD PTR -208[rbp], xmm0
+.LBE847:
+.LBE846:
+.LBB848:
+.LBB849:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -192[rbp]
+	addps	xmm0, XMMWORD PTR -208[rbp]
+.LBE849:
+.LBE848:
+	.loc 1 205 13 discriminator 2
+	movaps	XMMWORD PTR -64[rbp], xmm0
+	.loc 1 206 36 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 206 9 discriminator 2
+	mov	rax, QWORD PTR -264[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -160[rbp], rax
+	movaps	xmm0, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -176[rbp], xmm0
+.LBB850:
+.LBB851:
+	.loc 2 983 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -176[rbp]
+	mov	rax, QWORD PTR -160[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 2
+	nop
+.LBE851:
+.LBE850:
+	.loc 1 207 66 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 207 15 discriminator 2
+	mov	rax, QWORD PTR -280[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -152[rbp], rax
+.LBB852:
+.LBB853:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -152[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -128[rbp], xmm0
+	movaps	XMMWORD PTR -144[rbp], xmm1
+.LBE853:
+.LBE852:
+.LBB854:
+.LBB855:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -128[rbp]
+	mulps	xmm0, XMMWORD PTR -144[rbp]
+	movaps	xmm1, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -96[rbp], xmm1
+	movaps	XMMWORD PTR -112[rbp], xmm0
+.LBE855:
+.LBE854:
+.LBB856:
+.LBB857:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -96[rbp]
+	addps	xmm0, XMMWORD PTR -112[rbp]
+.LBE857:
+.LBE856:
+	.loc 1 207 15 discriminator 2
+	movaps	XMMWORD PTR -16[rbp], xmm0
+.LBE841:
+	.loc 1 202 31 discriminator 2
+	add	DWORD PTR -20[rbp], 4
+.L73:
+	.loc 1 202 18 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	add	eax, 3
+	cmp	DWORD PTR -288[rbp], eax
+	jg	.L81
+	.loc 1 209 17
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	call	lmsKernel_HorizontalSumSse2
+	movd	eax, xmm0
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 210 5
+	jmp	.L82
+.L83:
+	.loc 1 212 21 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -264[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 212 43 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -272[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 212 33 discriminator 2
+	mulss	xmm0, DWORD PTR -284[rbp]
+	.loc 1 212 21 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -264[rbp]
+	add	rax, rdx
+	.loc 1 212 25 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 213 28 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -264[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 213 41 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -280[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 213 32 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 213 13 discriminator 2
+	movss	xmm1, DWORD PTR -24[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -24[rbp], xmm0
+	.loc 1 210 25 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L82:
+	.loc 1 210 14 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -288[rbp]
+	jl	.L83
+	.loc 1 215 12
+	movss	xmm0, DWORD PTR -24[rbp]
+	.loc 1 216 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4841:
+	.size	lmsKernel_UpdateDotSse2, .-lmsKernel_UpdateDotSse2
+	.type	lmsKernel_LeakyUpdateDotSse2, @function
+lmsKernel_LeakyUpdateDotSse2:
+.LFB4842:
+	.loc 1 221 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 368
+	mov	QWORD PTR -328[rbp], rdi
+	mov	QWORD PTR -336[rbp], rsi
+	mov	QWORD PTR -344[rbp], rdx
+	movss	DWORD PTR -348[rbp], xmm0
+	movss	DWORD PTR -352[rbp], xmm1
+	mov	DWORD PTR -356[rbp], ecx
+	movss	xmm0, DWORD PTR -348[rbp]
+	movss	DWORD PTR -88[rbp], xmm0
+.LBB858:
+.LBB859:
+	.loc 2 894 24
+	movss	xmm0, DWORD PTR -88[rbp]
+	shufps	xmm0, xmm0, 0
+.LBE859:
+.LBE858:
+	.loc 1 222 22
+	movaps	XMMWORD PTR -48[rbp], xmm0
+	movss	xmm0, DWORD PTR -352[rbp]
+	movss	DWORD PTR -84[rbp], xmm0
+.LBB860:
+.LBB861:
+	.loc 2 894 24
+	movss	xmm0, DWORD PTR -84[rbp]
+	shufps	xmm0, xmm0, 0
+.LBE861:
+.LBE860:
+	.loc 1 223 22
+	movaps	XMMWORD PTR -64[rbp], xmm0
+.LBB862:
+.LBB863:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE863:
+.LBE862:
+	.loc 1 224 18
+	movaps	XMMWORD PTR -16[rbp], xmm0
+	.loc 1 225 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 227 5
+	jmp	.L89
+.L98:
+.LBB864:
+	.loc 1 229 60 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -328[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -312[rbp], rax
+.LBB865:
+.LBB866:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -312[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -288[rbp], xmm0
+	movaps	XMMWORD PTR -304[rbp], xmm1
+.LBE866:
+.LBE865:
+.LBB867:
+.LBB868:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -288[rbp]
+	mulps	xmm0, XMMWORD PTR -304[rbp]
+.LBE868:
+.LBE867:
+	.loc 1 229 20 discriminator 2
+	movaps	XMMWORD PTR -80[rbp], xmm0
+	.loc 1 230 63 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 230 13 discriminator 2
+	mov	rax, QWORD PTR -336[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -264[rbp], rax
+.LBB869:
+.LBB870:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -264[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -48[rbp]
+	movaps	XMMWORD PTR -240[rbp], xmm0
+	movaps	XMMWORD PTR -256[rbp], xmm1
+.LBE870:
+.LBE869:
+.LBB871:
+.LBB872:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -240[rbp]
+	mulps	xmm0, XMMWORD PTR -256[rbp]
+	movaps	xmm1, XMMWORD PTR -80[rbp]
+	movaps	XMMWORD PTR -208[rbp], xmm1
+	movaps	XMMWORD PTR -224[rbp], xmm0
+.LBE872:
+.LBE871:
+.LBB873:
+.LBB874:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -208[rbp]
+	addps	xmm0, XMMWORD PTR -224[rbp]
+.LBE874:
+.LBE873:
+	.loc 1 230 13 discriminator 2
+	movaps	XMMWORD PTR -80[rbp], xmm0
+	.loc 1 231 36 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 231 9 discriminator 2
+	mov	rax, QWORD PTR -328[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -176[rbp], rax
+	movaps	xmm0, XMMWORD PTR -80[rbp]
+	movaps	XMMWORD PTR -192[rbp], xmm0
+.LBB875:
+.LBB876:
+	.loc 2 983 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -192[rbp]
+	mov	rax, QWORD PTR -176[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 2
+	nop
+.LBE876:
+.LBE875:
+	.loc 1 232 66 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 232 15 discriminator 2
+	mov	rax, QWORD PTR -344[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -168[rbp], rax
+.LBB877:
+.LBB878:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -168[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -80[rbp]
+	movaps	XMMWORD PTR -144[rbp], xmm0
+	movaps	XMMWORD PTR -160[rbp], xmm1
+.LBE878:
+.LBE877:
+.LBB879:
+.LBB880:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -144[rbp]
+	mulps	xmm0, XMMWORD PTR -160[rbp]
+	movaps	xmm1, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -112[rbp], xmm1
+	movaps	XMMWORD PTR -128[rbp], xmm0
+.LBE880:
+.LBE879:
+.LBB881:
+.LBB882:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -112[rbp]
+	addps	xmm0, XMMWORD PTR -128[rbp]
+.LBE882:
+.LBE881:
+	.loc 1 232 15 discriminator 2
+	movaps	XMMWORD PTR -16[rbp], xmm0
+.LBE864:
+	.loc 1 227 31 discriminator 2
+	add	DWORD PTR -20[rbp], 4
+.L89:
+	.loc 1 227 18 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	add	eax, 3
+	cmp	DWORD PTR -356[rbp], eax
+	jg	.L98
+	.loc 1 234 17
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	call	lmsKernel_HorizontalSumSse2
+	movd	eax, xmm0
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 235 5
+	jmp	.L99
+.L100:
+	.loc 1 237 46 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -328[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 237 32 discriminator 2
+	movaps	xmm1, xmm0
+	mulss	xmm1, DWORD PTR -352[rbp]
+	.loc 1 237 67 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -336[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 237 57 discriminator 2
+	mulss	xmm0, DWORD PTR -348[rbp]
+	.loc 1 237 21 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -328[rbp]
+	add	rax, rdx
+	.loc 1 237 50 discriminator 2
+	addss	xmm0, xmm1
+	.loc 1 237 25 discriminator 2
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 238 28 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -328[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 238 41 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -344[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 238 32 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 238 13 discriminator 2
+	movss	xmm1, DWORD PTR -24[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -24[rbp], xmm0
+	.loc 1 235 25 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L99:
+	.loc 1 235 14 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -356[rbp]
+	jl	.L100
+	.loc 1 240 12
+	movss	xmm0, DWORD PTR -24[rbp]
+	.loc 1 241 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4842:
+	.size	lmsKernel_LeakyUpdateDotSse2, .-lmsKernel_LeakyUpdateDotSse2
+	.type	lmsKernel_SignedGainSse2, @function
+lmsKernel_SignedGainSse2:
+.LFB4843:
+	.loc 1 246 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 120
+	movaps	XMMWORD PTR -224[rbp], xmm0
+	movaps	XMMWORD PTR -240[rbp], xmm1
+.LBB883:
+.LBB884:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE884:
+.LBE883:
+	.loc 1 247 25
+	movaps	XMMWORD PTR -16[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -224[rbp]
+	movaps	XMMWORD PTR -192[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -208[rbp], xmm0
+.LBB885:
+.LBB886:
+	.loc 2 380 19
+	movaps	xmm0, XMMWORD PTR -208[rbp]
+	cmpltps	xmm0, XMMWORD PTR -192[rbp]
+	.loc 2 380 10
+	nop
+	movaps	XMMWORD PTR -160[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -240[rbp]
+	movaps	XMMWORD PTR -176[rbp], xmm0
+.LBE886:
+.LBE885:
+.LBB887:
+.LBB888:
+	.loc 2 242 10
+	movaps	xmm0, XMMWORD PTR -160[rbp]
+	andps	xmm0, XMMWORD PTR -176[rbp]
+.LBE888:
+.LBE887:
+	.loc 1 248 29
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -224[rbp]
+	movaps	XMMWORD PTR -128[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -144[rbp], xmm0
+.LBB889:
+.LBB890:
+	.loc 2 368 19
+	movaps	xmm0, XMMWORD PTR -128[rbp]
+	cmpltps	xmm0, XMMWORD PTR -144[rbp]
+	.loc 2 368 10
+	nop
+	movaps	XMMWORD PTR -96[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -240[rbp]
+	movaps	XMMWORD PTR -112[rbp], xmm0
+.LBE890:
+.LBE889:
+.LBB891:
+.LBB892:
+	.loc 2 242 10
+	movaps	xmm0, XMMWORD PTR -96[rbp]
+	andps	xmm0, XMMWORD PTR -112[rbp]
+.LBE892:
+.LBE891:
+	.loc 1 249 29
+	movaps	XMMWORD PTR -48[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -64[rbp], xmm0
+	movaps	xmm0, XMMWORD PTR -48[rbp]
+	movaps	XMMWORD PTR -80[rbp], xmm0
+.LBB893:
+.LBB894:
+	.loc 2 192 10
+	movaps	xmm0, XMMWORD PTR -64[rbp]
+	subps	xmm0, XMMWORD PTR -80[rbp]
+.LBE894:
+.LBE893:
+	.loc 1 251 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4843:
+	.size	lmsKernel_SignedGainSse2, .-lmsKernel_SignedGainSse2
+	.type	lmsKernel_SignUpdateDotSse2, @function
+lmsKernel_SignUpdateDotSse2:
+.LFB4844:
+	.loc 1 256 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 256
+	mov	QWORD PTR -232[rbp], rdi
+	mov	QWORD PTR -240[rbp], rsi
+	mov	QWORD PTR -248[rbp], rdx
+	movss	DWORD PTR -252[rbp], xmm0
+	mov	DWORD PTR -256[rbp], ecx
+	movss	xmm0, DWORD PTR -252[rbp]
+	movss	DWORD PTR -68[rbp], xmm0
+.LBB895:
+.LBB896:
+	.loc 2 894 24
+	movss	xmm0, DWORD PTR -68[rbp]
+	shufps	xmm0, xmm0, 0
+.LBE896:
+.LBE895:
+	.loc 1 257 22
+	movaps	XMMWORD PTR -48[rbp], xmm0
+.LBB897:
+.LBB898:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE898:
+.LBE897:
+	.loc 1 258 18
+	movaps	XMMWORD PTR -16[rbp], xmm0
+	.loc 1 259 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 261 5
+	jmp	.L113
+.L120:
+.LBB899:
+	.loc 1 263 110 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 263 20 discriminator 2
+	mov	rax, QWORD PTR -240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -224[rbp], rax
+.LBB900:
+.LBB901:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -224[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm2, xmm0
+.LBE901:
+.LBE900:
+	.loc 1 263 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -48[rbp]
+	movaps	xmm1, xmm0
+	movaps	xmm0, xmm2
+	call	lmsKernel_SignedGainSse2
+	.loc 1 263 57 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -232[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -216[rbp], rax
+.LBB902:
+.LBB903:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -216[rbp]
+	movups	xmm1, XMMWORD PTR [rax]
+	movaps	XMMWORD PTR -192[rbp], xmm1
+	movaps	XMMWORD PTR -208[rbp], xmm0
+.LBE903:
+.LBE902:
+.LBB904:
+.LBB905:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -192[rbp]
+	addps	xmm0, XMMWORD PTR -208[rbp]
+.LBE905:
+.LBE904:
+	.loc 1 263 20 discriminator 2
+	movaps	XMMWORD PTR -64[rbp], xmm0
+	.loc 1 264 36 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 264 9 discriminator 2
+	mov	rax, QWORD PTR -232[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -160[rbp], rax
+	movaps	xmm0, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -176[rbp], xmm0
+.LBB906:
+.LBB907:
+	.loc 2 983 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -176[rbp]
+	mov	rax, QWORD PTR -160[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 2
+	nop
+.LBE907:
+.LBE906:
+	.loc 1 265 66 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 265 15 discriminator 2
+	mov	rax, QWORD PTR -248[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -152[rbp], rax
+.LBB908:
+.LBB909:
+	.loc 2 934 10 discriminator 2
+	mov	rax, QWORD PTR -152[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -128[rbp], xmm0
+	movaps	XMMWORD PTR -144[rbp], xmm1
+.LBE909:
+.LBE908:
+.LBB910:
+.LBB911:
+	.loc 2 198 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -128[rbp]
+	mulps	xmm0, XMMWORD PTR -144[rbp]
+	movaps	xmm1, XMMWORD PTR -16[rbp]
+	movaps	XMMWORD PTR -96[rbp], xmm1
+	movaps	XMMWORD PTR -112[rbp], xmm0
+.LBE911:
+.LBE910:
+.LBB912:
+.LBB913:
+	.loc 2 186 10 discriminator 2
+	movaps	xmm0, XMMWORD PTR -96[rbp]
+	addps	xmm0, XMMWORD PTR -112[rbp]
+.LBE913:
+.LBE912:
+	.loc 1 265 15 discriminator 2
+	movaps	XMMWORD PTR -16[rbp], xmm0
+.LBE899:
+	.loc 1 261 31 discriminator 2
+	add	DWORD PTR -20[rbp], 4
+.L113:
+	.loc 1 261 18 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	add	eax, 3
+	cmp	DWORD PTR -256[rbp], eax
+	jg	.L120
+	.loc 1 267 17
+	movaps	xmm0, XMMWORD PTR -16[rbp]
+	call	lmsKernel_HorizontalSumSse2
+	movd	eax, xmm0
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 268 5
+	jmp	.L121
+.L122:
+	.loc 1 270 58 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -240[rbp]
+	add	rax, rdx
+	.loc 1 270 35 discriminator 2
+	mov	eax, DWORD PTR [rax]
+	movd	xmm0, eax
+	call	lmsKernel_Sign
+	movd	eax, xmm0
+	.loc 1 270 33 discriminator 2
+	movd	xmm1, eax
+	mulss	xmm1, DWORD PTR -252[rbp]
+	.loc 1 270 21 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -232[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -232[rbp]
+	add	rax, rdx
+	.loc 1 270 25 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 271 28 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -232[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 271 41 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -248[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 271 32 discriminator 2
+	mulss	xmm0, xmm1
+	.loc 1 271 13 discriminator 2
+	movss	xmm1, DWORD PTR -24[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -24[rbp], xmm0
+	.loc 1 268 25 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L121:
+	.loc 1 268 14 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -256[rbp]
+	jl	.L122
+	.loc 1 273 12
+	movss	xmm0, DWORD PTR -24[rbp]
+	.loc 1 274 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4844:
+	.size	lmsKernel_SignUpdateDotSse2, .-lmsKernel_SignUpdateDotSse2
+	.type	lmsKernel_BankUpdateDotSse2, @function
+lmsKernel_BankUpdateDotSse2:
+.LFB4845:
+	.loc 1 279 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 1128
+	mov	QWORD PTR -1208[rbp], rdi
+	mov	QWORD PTR -1216[rbp], rsi
+	mov	QWORD PTR -1224[rbp], rdx
+	mov	QWORD PTR -1232[rbp], rcx
+	mov	QWORD PTR -1240[rbp], r8
+	mov	DWORD PTR -1244[rbp], r9d
+.LBB914:
+	.loc 1 281 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 281 5
+	jmp	.L125
+.L164:
+.LBB915:
+	.loc 1 283 45
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 283 27
+	mov	rax, QWORD PTR -1232[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -272[rbp], rax
+.LBB916:
+.LBB917:
+	.loc 2 934 10
+	mov	rax, QWORD PTR -272[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+.LBE917:
+.LBE916:
+	.loc 1 283 27
+	movaps	XMMWORD PTR -112[rbp], xmm0
+	.loc 1 284 50
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	add	rax, 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 284 27
+	mov	rax, QWORD PTR -1232[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -264[rbp], rax
+.LBB918:
+.LBB919:
+	.loc 2 934 10
+	mov	rax, QWORD PTR -264[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+.LBE919:
+.LBE918:
+	.loc 1 284 27
+	movaps	XMMWORD PTR -128[rbp], xmm0
+	.loc 1 285 50
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 285 27
+	mov	rax, QWORD PTR -1232[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -256[rbp], rax
+.LBB920:
+.LBB921:
+	.loc 2 934 10
+	mov	rax, QWORD PTR -256[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+.LBE921:
+.LBE920:
+	.loc 1 285 27
+	movaps	XMMWORD PTR -144[rbp], xmm0
+	.loc 1 286 50
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	add	rax, 12
+	lea	rdx, 0[0+rax*4]
+	.loc 1 286 27
+	mov	rax, QWORD PTR -1232[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -248[rbp], rax
+.LBB922:
+.LBB923:
+	.loc 2 934 10
+	mov	rax, QWORD PTR -248[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+.LBE923:
+.LBE922:
+	.loc 1 286 27
+	movaps	XMMWORD PTR -160[rbp], xmm0
+.LBB924:
+.LBB925:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE925:
+.LBE924:
+	.loc 1 287 23
+	movaps	XMMWORD PTR -32[rbp], xmm0
+.LBB926:
+.LBB927:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE927:
+.LBE926:
+	.loc 1 288 23
+	movaps	XMMWORD PTR -48[rbp], xmm0
+.LBB928:
+.LBB929:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE929:
+.LBE928:
+	.loc 1 289 23
+	movaps	XMMWORD PTR -64[rbp], xmm0
+.LBB930:
+.LBB931:
+	.loc 2 120 10
+	pxor	xmm0, xmm0
+.LBE931:
+.LBE930:
+	.loc 1 290 23
+	movaps	XMMWORD PTR -80[rbp], xmm0
+.LBB932:
+	.loc 1 292 18
+	mov	DWORD PTR -84[rbp], 0
+	.loc 1 292 9
+	jmp	.L134
+.L163:
+.LBB933:
+	.loc 1 294 32 discriminator 3
+	mov	eax, DWORD PTR -84[rbp]
+	movsx	rdx, eax
+	.loc 1 294 42 discriminator 3
+	mov	eax, DWORD PTR 16[rbp]
+	cdqe
+	imul	rdx, rax
+	.loc 1 294 51 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 294 26 discriminator 3
+	add	rax, rdx
+	mov	QWORD PTR -168[rbp], rax
+	.loc 1 295 107 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 295 25 discriminator 3
+	mov	rax, QWORD PTR -1216[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1080[rbp], rax
+.LBB934:
+.LBB935:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -1080[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -112[rbp]
+	movaps	XMMWORD PTR -1056[rbp], xmm0
+	movaps	XMMWORD PTR -1072[rbp], xmm1
+.LBE935:
+.LBE934:
+.LBB936:
+.LBB937:
+	.loc 2 198 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -1056[rbp]
+	mulps	xmm0, XMMWORD PTR -1072[rbp]
+.LBE937:
+.LBE936:
+	.loc 1 295 62 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1208[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1032[rbp], rax
+.LBB938:
+.LBB939:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -1032[rbp]
+	movups	xmm1, XMMWORD PTR [rax]
+	movaps	XMMWORD PTR -1008[rbp], xmm1
+	movaps	XMMWORD PTR -1024[rbp], xmm0
+.LBE939:
+.LBE938:
+.LBB940:
+.LBB941:
+	.loc 2 186 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -1008[rbp]
+	addps	xmm0, XMMWORD PTR -1024[rbp]
+.LBE941:
+.LBE940:
+	.loc 1 295 25 discriminator 3
+	movaps	XMMWORD PTR -192[rbp], xmm0
+	.loc 1 296 117 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 296 25 discriminator 3
+	mov	rax, QWORD PTR -1216[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -984[rbp], rax
+.LBB942:
+.LBB943:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -984[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -128[rbp]
+	movaps	XMMWORD PTR -960[rbp], xmm0
+	movaps	XMMWORD PTR -976[rbp], xmm1
+.LBE943:
+.LBE942:
+.LBB944:
+.LBB945:
+	.loc 2 198 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -960[rbp]
+	mulps	xmm0, XMMWORD PTR -976[rbp]
+.LBE945:
+.LBE944:
+	.loc 1 296 68 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 4
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1208[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -936[rbp], rax
+.LBB946:
+.LBB947:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -936[rbp]
+	movups	xmm1, XMMWORD PTR [rax]
+	movaps	XMMWORD PTR -912[rbp], xmm1
+	movaps	XMMWORD PTR -928[rbp], xmm0
+.LBE947:
+.LBE946:
+.LBB948:
+.LBB949:
+	.loc 2 186 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -912[rbp]
+	addps	xmm0, XMMWORD PTR -928[rbp]
+.LBE949:
+.LBE948:
+	.loc 1 296 25 discriminator 3
+	movaps	XMMWORD PTR -208[rbp], xmm0
+	.loc 1 297 117 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 297 25 discriminator 3
+	mov	rax, QWORD PTR -1216[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -888[rbp], rax
+.LBB950:
+.LBB951:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -888[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -144[rbp]
+	movaps	XMMWORD PTR -864[rbp], xmm0
+	movaps	XMMWORD PTR -880[rbp], xmm1
+.LBE951:
+.LBE950:
+.LBB952:
+.LBB953:
+	.loc 2 198 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -864[rbp]
+	mulps	xmm0, XMMWORD PTR -880[rbp]
+.LBE953:
+.LBE952:
+	.loc 1 297 68 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1208[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -840[rbp], rax
+.LBB954:
+.LBB955:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -840[rbp]
+	movups	xmm1, XMMWORD PTR [rax]
+	movaps	XMMWORD PTR -816[rbp], xmm1
+	movaps	XMMWORD PTR -832[rbp], xmm0
+.LBE955:
+.LBE954:
+.LBB956:
+.LBB957:
+	.loc 2 186 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -816[rbp]
+	addps	xmm0, XMMWORD PTR -832[rbp]
+.LBE957:
+.LBE956:
+	.loc 1 297 25 discriminator 3
+	movaps	XMMWORD PTR -224[rbp], xmm0
+	.loc 1 298 118 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 12
+	lea	rdx, 0[0+rax*4]
+	.loc 1 298 25 discriminator 3
+	mov	rax, QWORD PTR -1216[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -792[rbp], rax
+.LBB958:
+.LBB959:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -792[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -160[rbp]
+	movaps	XMMWORD PTR -768[rbp], xmm0
+	movaps	XMMWORD PTR -784[rbp], xmm1
+.LBE959:
+.LBE958:
+.LBB960:
+.LBB961:
+	.loc 2 198 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -768[rbp]
+	mulps	xmm0, XMMWORD PTR -784[rbp]
+.LBE961:
+.LBE960:
+	.loc 1 298 68 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 12
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1208[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -744[rbp], rax
+.LBB962:
+.LBB963:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -744[rbp]
+	movups	xmm1, XMMWORD PTR [rax]
+	movaps	XMMWORD PTR -720[rbp], xmm1
+	movaps	XMMWORD PTR -736[rbp], xmm0
+.LBE963:
+.LBE962:
+.LBB964:
+.LBB965:
+	.loc 2 186 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -720[rbp]
+	addps	xmm0, XMMWORD PTR -736[rbp]
+.LBE965:
+.LBE964:
+	.loc 1 298 25 discriminator 3
+	movaps	XMMWORD PTR -240[rbp], xmm0
+	.loc 1 299 40 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 299 13 discriminator 3
+	mov	rax, QWORD PTR -1208[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -680[rbp], rax
+	movaps	xmm0, XMMWORD PTR -192[rbp]
+	movaps	XMMWORD PTR -704[rbp], xmm0
+.LBB966:
+.LBB967:
+	.loc 2 983 20 discriminator 3
+	movaps	xmm0, XMMWORD PTR -704[rbp]
+	mov	rax, QWORD PTR -680[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 3
+	nop
+.LBE967:
+.LBE966:
+	.loc 1 300 46 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 300 13 discriminator 3
+	mov	rax, QWORD PTR -1208[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -648[rbp], rax
+	movaps	xmm0, XMMWORD PTR -208[rbp]
+	movaps	XMMWORD PTR -672[rbp], xmm0
+.LBB968:
+.LBB969:
+	.loc 2 983 20 discriminator 3
+	movaps	xmm0, XMMWORD PTR -672[rbp]
+	mov	rax, QWORD PTR -648[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 3
+	nop
+.LBE969:
+.LBE968:
+	.loc 1 301 46 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 301 13 discriminator 3
+	mov	rax, QWORD PTR -1208[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -616[rbp], rax
+	movaps	xmm0, XMMWORD PTR -224[rbp]
+	movaps	XMMWORD PTR -640[rbp], xmm0
+.LBB970:
+.LBB971:
+	.loc 2 983 20 discriminator 3
+	movaps	xmm0, XMMWORD PTR -640[rbp]
+	mov	rax, QWORD PTR -616[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 3
+	nop
+.LBE971:
+.LBE970:
+	.loc 1 302 46 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 12
+	lea	rdx, 0[0+rax*4]
+	.loc 1 302 13 discriminator 3
+	mov	rax, QWORD PTR -1208[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -592[rbp], rax
+	movaps	xmm0, XMMWORD PTR -240[rbp]
+	movaps	XMMWORD PTR -608[rbp], xmm0
+.LBB972:
+.LBB973:
+	.loc 2 983 20 discriminator 3
+	movaps	xmm0, XMMWORD PTR -608[rbp]
+	mov	rax, QWORD PTR -592[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 3
+	nop
+.LBE973:
+.LBE972:
+	.loc 1 303 73 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 303 20 discriminator 3
+	mov	rax, QWORD PTR -1224[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -584[rbp], rax
+.LBB974:
+.LBB975:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -584[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -192[rbp]
+	movaps	XMMWORD PTR -560[rbp], xmm0
+	movaps	XMMWORD PTR -576[rbp], xmm1
+.LBE975:
+.LBE974:
+.LBB976:
+.LBB977:
+	.loc 2 198 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -560[rbp]
+	mulps	xmm0, XMMWORD PTR -576[rbp]
+	movaps	xmm1, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -528[rbp], xmm1
+	movaps	XMMWORD PTR -544[rbp], xmm0
+.LBE977:
+.LBE976:
+.LBB978:
+.LBB979:
+	.loc 2 186 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -528[rbp]
+	addps	xmm0, XMMWORD PTR -544[rbp]
+.LBE979:
+.LBE978:
+	.loc 1 303 20 discriminator 3
+	movaps	XMMWORD PTR -32[rbp], xmm0
+	.loc 1 304 79 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 304 20 discriminator 3
+	mov	rax, QWORD PTR -1224[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -504[rbp], rax
+.LBB980:
+.LBB981:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -504[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -208[rbp]
+	movaps	XMMWORD PTR -480[rbp], xmm0
+	movaps	XMMWORD PTR -496[rbp], xmm1
+.LBE981:
+.LBE980:
+.LBB982:
+.LBB983:
+	.loc 2 198 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -480[rbp]
+	mulps	xmm0, XMMWORD PTR -496[rbp]
+	movaps	xmm1, XMMWORD PTR -48[rbp]
+	movaps	XMMWORD PTR -448[rbp], xmm1
+	movaps	XMMWORD PTR -464[rbp], xmm0
+.LBE983:
+.LBE982:
+.LBB984:
+.LBB985:
+	.loc 2 186 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -448[rbp]
+	addps	xmm0, XMMWORD PTR -464[rbp]
+.LBE985:
+.LBE984:
+	.loc 1 304 20 discriminator 3
+	movaps	XMMWORD PTR -48[rbp], xmm0
+	.loc 1 305 79 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 305 20 discriminator 3
+	mov	rax, QWORD PTR -1224[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -424[rbp], rax
+.LBB986:
+.LBB987:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -424[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -224[rbp]
+	movaps	XMMWORD PTR -400[rbp], xmm0
+	movaps	XMMWORD PTR -416[rbp], xmm1
+.LBE987:
+.LBE986:
+.LBB988:
+.LBB989:
+	.loc 2 198 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -400[rbp]
+	mulps	xmm0, XMMWORD PTR -416[rbp]
+	movaps	xmm1, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -368[rbp], xmm1
+	movaps	XMMWORD PTR -384[rbp], xmm0
+.LBE989:
+.LBE988:
+.LBB990:
+.LBB991:
+	.loc 2 186 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -368[rbp]
+	addps	xmm0, XMMWORD PTR -384[rbp]
+.LBE991:
+.LBE990:
+	.loc 1 305 20 discriminator 3
+	movaps	XMMWORD PTR -64[rbp], xmm0
+	.loc 1 306 79 discriminator 3
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 12
+	lea	rdx, 0[0+rax*4]
+	.loc 1 306 20 discriminator 3
+	mov	rax, QWORD PTR -1224[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -344[rbp], rax
+.LBB992:
+.LBB993:
+	.loc 2 934 10 discriminator 3
+	mov	rax, QWORD PTR -344[rbp]
+	movups	xmm0, XMMWORD PTR [rax]
+	movaps	xmm1, xmm0
+	movaps	xmm0, XMMWORD PTR -240[rbp]
+	movaps	XMMWORD PTR -320[rbp], xmm0
+	movaps	XMMWORD PTR -336[rbp], xmm1
+.LBE993:
+.LBE992:
+.LBB994:
+.LBB995:
+	.loc 2 198 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -320[rbp]
+	mulps	xmm0, XMMWORD PTR -336[rbp]
+	movaps	xmm1, XMMWORD PTR -80[rbp]
+	movaps	XMMWORD PTR -288[rbp], xmm1
+	movaps	XMMWORD PTR -304[rbp], xmm0
+.LBE995:
+.LBE994:
+.LBB996:
+.LBB997:
+	.loc 2 186 10 discriminator 3
+	movaps	xmm0, XMMWORD PTR -288[rbp]
+	addps	xmm0, XMMWORD PTR -304[rbp]
+.LBE997:
+.LBE996:
+	.loc 1 306 20 discriminator 3
+	movaps	XMMWORD PTR -80[rbp], xmm0
+.LBE933:
+	.loc 1 292 38 discriminator 3
+	add	DWORD PTR -84[rbp], 1
+.L134:
+	.loc 1 292 27 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	cmp	eax, DWORD PTR -1244[rbp]
+	jl	.L163
+.LBE932:
+	.loc 1 308 30 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 308 9 discriminator 2
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1176[rbp], rax
+	movaps	xmm0, XMMWORD PTR -32[rbp]
+	movaps	XMMWORD PTR -1200[rbp], xmm0
+.LBB998:
+.LBB999:
+	.loc 2 983 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -1200[rbp]
+	mov	rax, QWORD PTR -1176[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 2
+	nop
+.LBE999:
+.LBE998:
+	.loc 1 309 35 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	add	rax, 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 309 9 discriminator 2
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1144[rbp], rax
+	movaps	xmm0, XMMWORD PTR -48[rbp]
+	movaps	XMMWORD PTR -1168[rbp], xmm0
+.LBB1000:
+.LBB1001:
+	.loc 2 983 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -1168[rbp]
+	mov	rax, QWORD PTR -1144[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 2
+	nop
+.LBE1001:
+.LBE1000:
+	.loc 1 310 35 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 310 9 discriminator 2
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1112[rbp], rax
+	movaps	xmm0, XMMWORD PTR -64[rbp]
+	movaps	XMMWORD PTR -1136[rbp], xmm0
+.LBB1002:
+.LBB1003:
+	.loc 2 983 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -1136[rbp]
+	mov	rax, QWORD PTR -1112[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 2
+	nop
+.LBE1003:
+.LBE1002:
+	.loc 1 311 35 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	add	rax, 12
+	lea	rdx, 0[0+rax*4]
+	.loc 1 311 9 discriminator 2
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1088[rbp], rax
+	movaps	xmm0, XMMWORD PTR -80[rbp]
+	movaps	XMMWORD PTR -1104[rbp], xmm0
+.LBB1004:
+.LBB1005:
+	.loc 2 983 20 discriminator 2
+	movaps	xmm0, XMMWORD PTR -1104[rbp]
+	mov	rax, QWORD PTR -1088[rbp]
+	movups	XMMWORD PTR [rax], xmm0
+	.loc 2 984 1 discriminator 2
+	nop
+.LBE1005:
+.LBE1004:
+.LBE915:
+	.loc 1 281 38 discriminator 2
+	add	DWORD PTR -4[rbp], 16
+.L125:
+	.loc 1 281 25 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR 16[rbp]
+	jl	.L164
+.LBE914:
+	.loc 1 313 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4845:
+	.size	lmsKernel_BankUpdateDotSse2, .-lmsKernel_BankUpdateDotSse2
+	.type	lmsKernel_HorizontalSumAvx2, @function
+lmsKernel_HorizontalSumAvx2:
+.LFB4846:
+	.loc 1 321 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -32
+	sub	rsp, 168
+	vmovaps	YMMWORD PTR -120[rsp], ymm0
+	.loc 1 322 57
+	vmovaps	ymm0, YMMWORD PTR -120[rsp]
+	vextractf128	xmm1, ymm0, 0x1
+	vmovaps	ymm0, YMMWORD PTR -120[rsp]
+	vmovaps	YMMWORD PTR -56[rsp], ymm0
+.LBB1006:
+.LBB1007:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avxintrin.h"
+	.loc 3 1463 19
+	vmovaps	xmm0, XMMWORD PTR -56[rsp]
+	.loc 3 1463 10
+	nop
+	vmovaps	XMMWORD PTR 8[rsp], xmm0
+	vmovaps	XMMWORD PTR -8[rsp], xmm1
+.LBE1007:
+.LBE1006:
+.LBB1008:
+.LBB1009:
+	.loc 2 186 10
+	vmovaps	xmm0, XMMWORD PTR 8[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR -8[rsp]
+.LBE1009:
+.LBE1008:
+	.loc 1 322 19
+	vmovaps	XMMWORD PTR 152[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vmovaps	XMMWORD PTR 24[rsp], xmm0
+.LBB1010:
+.LBB1011:
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/pmmintrin.h"
+	.loc 4 71 19
+	vmovshdup	xmm0, XMMWORD PTR 24[rsp]
+	.loc 4 71 10
+	nop
+.LBE1011:
+.LBE1010:
+	.loc 1 323 19
+	vmovaps	XMMWORD PTR 136[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vmovaps	XMMWORD PTR 56[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 136[rsp]
+	vmovaps	XMMWORD PTR 40[rsp], xmm0
+.LBB1012:
+.LBB1013:
+	.loc 2 186 10
+	vmovaps	xmm0, XMMWORD PTR 56[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 40[rsp]
+.LBE1013:
+.LBE1012:
+	.loc 1 324 12
+	vmovaps	XMMWORD PTR 152[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 136[rsp]
+	vmovaps	XMMWORD PTR 88[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vmovaps	XMMWORD PTR 72[rsp], xmm0
+.LBB1014:
+.LBB1015:
+	.loc 2 787 19
+	vmovaps	xmm0, XMMWORD PTR 88[rsp]
+	vmovlps	xmm0, xmm0, QWORD PTR 80[rsp]
+	.loc 2 787 10
+	nop
+.LBE1015:
+.LBE1014:
+	.loc 1 325 12
+	vmovaps	XMMWORD PTR 136[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vmovaps	XMMWORD PTR 120[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 136[rsp]
+	vmovaps	XMMWORD PTR 104[rsp], xmm0
+.LBB1016:
+.LBB1017:
+	.loc 2 130 19
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vaddss	xmm0, xmm0, DWORD PTR 104[rsp]
+	.loc 2 130 10
+	nop
+.LBE1017:
+.LBE1016:
+	.loc 1 326 12
+	vmovaps	XMMWORD PTR 152[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vmovaps	XMMWORD PTR -72[rsp], xmm0
+.LBB1018:
+.LBB1019:
+	.loc 2 969 23
+	vmovss	xmm0, DWORD PTR -72[rsp]
+.LBE1019:
+.LBE1018:
+	.loc 1 328 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4846:
+	.size	lmsKernel_HorizontalSumAvx2, .-lmsKernel_HorizontalSumAvx2
+	.type	lmsKernel_DotAvx2, @function
+lmsKernel_DotAvx2:
+.LFB4847:
+	.loc 1 332 1
+	.cfi_startproc
+	lea	r10, 8[rsp]
+	.cfi_def_cfa 10, 0
+	and	rsp, -32
+	push	QWORD PTR -8[r10]
+	push	rbp
+	mov	rbp, rsp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	push	r10
+	.cfi_escape 0xf,0x3,0x76,0x78,0x6
+	sub	rsp, 584
+	mov	QWORD PTR -568[rbp], rdi
+	mov	QWORD PTR -576[rbp], rsi
+	mov	DWORD PTR -580[rbp], edx
+.LBB1020:
+.LBB1021:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1021:
+.LBE1020:
+	.loc 1 333 19
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+.LBB1022:
+.LBB1023:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1023:
+.LBE1022:
+	.loc 1 334 19
+	vmovaps	YMMWORD PTR -80[rbp], ymm0
+	.loc 1 335 9
+	mov	DWORD PTR -84[rbp], 0
+	.loc 1 337 5
+	jmp	.L177
+.L184:
+	.loc 1 339 74 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 339 16 discriminator 2
+	mov	rax, QWORD PTR -576[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -352[rbp], rax
+.LBB1024:
+.LBB1025:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -352[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+.LBE1025:
+.LBE1024:
+	.loc 1 339 50 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 339 16 discriminator 2
+	mov	rax, QWORD PTR -568[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -344[rbp], rax
+.LBB1026:
+.LBB1027:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -344[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	YMMWORD PTR -272[rbp], ymm0
+	vmovaps	YMMWORD PTR -304[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -336[rbp], ymm0
+.LBE1027:
+.LBE1026:
+.LBB1028:
+.LBB1029:
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/fmaintrin.h"
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -304[rbp]
+	vmovaps	ymm0, YMMWORD PTR -336[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -272[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1029:
+.LBE1028:
+	.loc 1 339 16 discriminator 2
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+	.loc 1 340 82 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 340 16 discriminator 2
+	mov	rax, QWORD PTR -576[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -224[rbp], rax
+.LBB1030:
+.LBB1031:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -224[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+.LBE1031:
+.LBE1030:
+	.loc 1 340 54 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 340 16 discriminator 2
+	mov	rax, QWORD PTR -568[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -216[rbp], rax
+.LBB1032:
+.LBB1033:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -216[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	YMMWORD PTR -144[rbp], ymm0
+	vmovaps	YMMWORD PTR -176[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -80[rbp]
+	vmovaps	YMMWORD PTR -208[rbp], ymm0
+.LBE1033:
+.LBE1032:
+.LBB1034:
+.LBB1035:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -176[rbp]
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -144[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1035:
+.LBE1034:
+	.loc 1 340 16 discriminator 2
+	vmovaps	YMMWORD PTR -80[rbp], ymm0
+	.loc 1 337 32 discriminator 2
+	add	DWORD PTR -84[rbp], 16
+.L177:
+	.loc 1 337 19 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 15
+	cmp	DWORD PTR -580[rbp], eax
+	jg	.L184
+	.loc 1 342 5
+	jmp	.L185
+.L189:
+	.loc 1 344 74 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 344 16 discriminator 2
+	mov	rax, QWORD PTR -576[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -480[rbp], rax
+.LBB1036:
+.LBB1037:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -480[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+.LBE1037:
+.LBE1036:
+	.loc 1 344 50 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 344 16 discriminator 2
+	mov	rax, QWORD PTR -568[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -472[rbp], rax
+.LBB1038:
+.LBB1039:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -472[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	YMMWORD PTR -400[rbp], ymm0
+	vmovaps	YMMWORD PTR -432[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -464[rbp], ymm0
+.LBE1039:
+.LBE1038:
+.LBB1040:
+.LBB1041:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -432[rbp]
+	vmovaps	ymm0, YMMWORD PTR -464[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -400[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1041:
+.LBE1040:
+	.loc 1 344 16 discriminator 2
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+	.loc 1 342 31 discriminator 2
+	add	DWORD PTR -84[rbp], 8
+.L185:
+	.loc 1 342 18 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 7
+	cmp	DWORD PTR -580[rbp], eax
+	jg	.L189
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -528[rbp], ymm0
+	vmovaps	ymm0, YMMWORD PTR -80[rbp]
+	vmovaps	YMMWORD PTR -560[rbp], ymm0
+.LBB1042:
+.LBB1043:
+	.loc 3 149 10
+	vmovaps	ymm0, YMMWORD PTR -528[rbp]
+	vaddps	ymm0, ymm0, YMMWORD PTR -560[rbp]
+.LBE1043:
+.LBE1042:
+	.loc 1 346 17
+	call	lmsKernel_HorizontalSumAvx2
+	vmovd	eax, xmm0
+	mov	DWORD PTR -88[rbp], eax
+	.loc 1 347 5
+	jmp	.L191
+.L192:
+	.loc 1 349 17 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -568[rbp]
+	add	rax, rdx
+	vmovss	xmm1, DWORD PTR [rax]
+	.loc 1 349 24 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -576[rbp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	.loc 1 349 21 discriminator 2
+	vmulss	xmm0, xmm1, xmm0
+	.loc 1 349 13 discriminator 2
+	vmovss	xmm1, DWORD PTR -88[rbp]
+	vaddss	xmm0, xmm1, xmm0
+	vmovss	DWORD PTR -88[rbp], xmm0
+	.loc 1 347 25 discriminator 2
+	add	DWORD PTR -84[rbp], 1
+.L191:
+	.loc 1 347 14 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	cmp	eax, DWORD PTR -580[rbp]
+	jl	.L192
+	.loc 1 351 12
+	vmovss	xmm0, DWORD PTR -88[rbp]
+	.loc 1 352 1
+	mov	r10, QWORD PTR -8[rbp]
+	.cfi_def_cfa 10, 0
+	leave
+	lea	rsp, -8[r10]
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4847:
+	.size	lmsKernel_DotAvx2, .-lmsKernel_DotAvx2
+	.type	lmsKernel_UpdateAvx2, @function
+lmsKernel_UpdateAvx2:
+.LFB4848:
+	.loc 1 356 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -32
+	sub	rsp, 200
+	mov	QWORD PTR -80[rsp], rdi
+	mov	QWORD PTR -88[rsp], rsi
+	vmovss	DWORD PTR -92[rsp], xmm0
+	mov	DWORD PTR -96[rsp], edx
+	vmovss	xmm0, DWORD PTR -92[rsp]
+	vmovss	DWORD PTR 100[rsp], xmm0
+.LBB1044:
+.LBB1045:
+	.loc 3 1320 10
+	vbroadcastss	ymm0, DWORD PTR 100[rsp]
+.LBE1045:
+.LBE1044:
+	.loc 1 357 22
+	vmovaps	YMMWORD PTR 136[rsp], ymm0
+	.loc 1 358 9
+	mov	DWORD PTR 196[rsp], 0
+	.loc 1 360 5
+	jmp	.L196
+.L200:
+.LBB1046:
+	.loc 1 362 49 discriminator 2
+	mov	eax, DWORD PTR 196[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR -72[rsp], rax
+.LBB1047:
+.LBB1048:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -72[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+.LBE1048:
+.LBE1047:
+	.loc 1 362 20 discriminator 2
+	vmovaps	YMMWORD PTR 104[rsp], ymm0
+	.loc 1 363 54 discriminator 2
+	mov	eax, DWORD PTR 196[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 363 13 discriminator 2
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR -64[rsp], rax
+.LBB1049:
+.LBB1050:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -64[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR 136[rsp]
+	vmovaps	YMMWORD PTR 8[rsp], ymm0
+	vmovaps	YMMWORD PTR -24[rsp], ymm1
+	vmovaps	ymm0, YMMWORD PTR 104[rsp]
+	vmovaps	YMMWORD PTR -56[rsp], ymm0
+.LBE1050:
+.LBE1049:
+.LBB1051:
+.LBB1052:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -24[rsp]
+	vmovaps	ymm0, YMMWORD PTR -56[rsp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR 8[rsp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1052:
+.LBE1051:
+	.loc 1 363 13 discriminator 2
+	vmovaps	YMMWORD PTR 104[rsp], ymm0
+	.loc 1 364 39 discriminator 2
+	mov	eax, DWORD PTR 196[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 364 9 discriminator 2
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 88[rsp], rax
+	vmovaps	ymm0, YMMWORD PTR 104[rsp]
+	vmovaps	YMMWORD PTR 40[rsp], ymm0
+.LBB1053:
+.LBB1054:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR 40[rsp]
+	mov	rax, QWORD PTR 88[rsp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1054:
+.LBE1053:
+.LBE1046:
+	.loc 1 360 31 discriminator 2
+	add	DWORD PTR 196[rsp], 8
+.L196:
+	.loc 1 360 18 discriminator 1
+	mov	eax, DWORD PTR 196[rsp]
+	add	eax, 7
+	cmp	DWORD PTR -96[rsp], eax
+	jg	.L200
+	.loc 1 366 5
+	jmp	.L201
+.L202:
+	.loc 1 368 21 discriminator 2
+	mov	eax, DWORD PTR 196[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	vmovss	xmm1, DWORD PTR [rax]
+	.loc 1 368 40 discriminator 2
+	mov	eax, DWORD PTR 196[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	.loc 1 368 33 discriminator 2
+	vmulss	xmm0, xmm0, DWORD PTR -92[rsp]
+	.loc 1 368 21 discriminator 2
+	mov	eax, DWORD PTR 196[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	.loc 1 368 25 discriminator 2
+	vaddss	xmm0, xmm1, xmm0
+	vmovss	DWORD PTR [rax], xmm0
+	.loc 1 366 25 discriminator 2
+	add	DWORD PTR 196[rsp], 1
+.L201:
+	.loc 1 366 14 discriminator 1
+	mov	eax, DWORD PTR 196[rsp]
+	cmp	eax, DWORD PTR -96[rsp]
+	jl	.L202
+	.loc 1 370 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4848:
+	.size	lmsKernel_UpdateAvx2, .-lmsKernel_UpdateAvx2
+	.type	lmsKernel_UpdateDotAvx2, @function
+lmsKernel_UpdateDotAvx2:
+.LFB4849:
+	.loc 1 375 1
+	.cfi_startproc
+	lea	r10, 8[rsp]
+	.cfi_def_cfa 10, 0
+	and	rsp, -32
+	push	QWORD PTR -8[r10]
+	push	rbp
+	mov	rbp, rsp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	push	r10
+	.cfi_escape 0xf,0x3,0x76,0x78,0x6
+	sub	rsp, 1256
+	mov	QWORD PTR -1240[rbp], rdi
+	mov	QWORD PTR -1248[rbp], rsi
+	mov	QWORD PTR -1256[rbp], rdx
+	vmovss	DWORD PTR -1260[rbp], xmm0
+	mov	DWORD PTR -1264[rbp], ecx
+	vmovss	xmm0, DWORD PTR -1260[rbp]
+	vmovss	DWORD PTR -244[rbp], xmm0
+.LBB1055:
+.LBB1056:
+	.loc 3 1320 10
+	vbroadcastss	ymm0, DWORD PTR -244[rbp]
+.LBE1056:
+.LBE1055:
+	.loc 1 376 22
+	vmovaps	YMMWORD PTR -144[rbp], ymm0
+.LBB1057:
+.LBB1058:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1058:
+.LBE1057:
+	.loc 1 377 19
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+.LBB1059:
+.LBB1060:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1060:
+.LBE1059:
+	.loc 1 378 19
+	vmovaps	YMMWORD PTR -80[rbp], ymm0
+	.loc 1 379 9
+	mov	DWORD PTR -84[rbp], 0
+	.loc 1 381 5
+	jmp	.L207
+.L218:
+.LBB1061:
+	.loc 1 383 50 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -872[rbp], rax
+.LBB1062:
+.LBB1063:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -872[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+.LBE1063:
+.LBE1062:
+	.loc 1 383 21 discriminator 2
+	vmovaps	YMMWORD PTR -208[rbp], ymm0
+	.loc 1 384 54 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -864[rbp], rax
+.LBB1064:
+.LBB1065:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -864[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+.LBE1065:
+.LBE1064:
+	.loc 1 384 21 discriminator 2
+	vmovaps	YMMWORD PTR -240[rbp], ymm0
+	.loc 1 385 58 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 385 14 discriminator 2
+	mov	rax, QWORD PTR -1248[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -856[rbp], rax
+.LBB1066:
+.LBB1067:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -856[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	YMMWORD PTR -784[rbp], ymm0
+	vmovaps	YMMWORD PTR -816[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vmovaps	YMMWORD PTR -848[rbp], ymm0
+.LBE1067:
+.LBE1066:
+.LBB1068:
+.LBB1069:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -816[rbp]
+	vmovaps	ymm0, YMMWORD PTR -848[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -784[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1069:
+.LBE1068:
+	.loc 1 385 14 discriminator 2
+	vmovaps	YMMWORD PTR -208[rbp], ymm0
+	.loc 1 386 62 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 386 14 discriminator 2
+	mov	rax, QWORD PTR -1248[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -728[rbp], rax
+.LBB1070:
+.LBB1071:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -728[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	YMMWORD PTR -656[rbp], ymm0
+	vmovaps	YMMWORD PTR -688[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -240[rbp]
+	vmovaps	YMMWORD PTR -720[rbp], ymm0
+.LBE1071:
+.LBE1070:
+.LBB1072:
+.LBB1073:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -688[rbp]
+	vmovaps	ymm0, YMMWORD PTR -720[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -656[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1073:
+.LBE1072:
+	.loc 1 386 14 discriminator 2
+	vmovaps	YMMWORD PTR -240[rbp], ymm0
+	.loc 1 387 39 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 387 9 discriminator 2
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -568[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vmovaps	YMMWORD PTR -624[rbp], ymm0
+.LBB1074:
+.LBB1075:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -624[rbp]
+	mov	rax, QWORD PTR -568[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1075:
+.LBE1074:
+	.loc 1 388 43 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 388 9 discriminator 2
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -512[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -240[rbp]
+	vmovaps	YMMWORD PTR -560[rbp], ymm0
+.LBB1076:
+.LBB1077:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -560[rbp]
+	mov	rax, QWORD PTR -512[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1077:
+.LBE1076:
+	.loc 1 389 60 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 389 16 discriminator 2
+	mov	rax, QWORD PTR -1256[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -504[rbp], rax
+.LBB1078:
+.LBB1079:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -504[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vmovaps	YMMWORD PTR -432[rbp], ymm0
+	vmovaps	YMMWORD PTR -464[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -496[rbp], ymm0
+.LBE1079:
+.LBE1078:
+.LBB1080:
+.LBB1081:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -464[rbp]
+	vmovaps	ymm0, YMMWORD PTR -496[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -432[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1081:
+.LBE1080:
+	.loc 1 389 16 discriminator 2
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+	.loc 1 390 64 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 390 16 discriminator 2
+	mov	rax, QWORD PTR -1256[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -376[rbp], rax
+.LBB1082:
+.LBB1083:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -376[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -240[rbp]
+	vmovaps	YMMWORD PTR -304[rbp], ymm0
+	vmovaps	YMMWORD PTR -336[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -80[rbp]
+	vmovaps	YMMWORD PTR -368[rbp], ymm0
+.LBE1083:
+.LBE1082:
+.LBB1084:
+.LBB1085:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -336[rbp]
+	vmovaps	ymm0, YMMWORD PTR -368[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -304[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1085:
+.LBE1084:
+	.loc 1 390 16 discriminator 2
+	vmovaps	YMMWORD PTR -80[rbp], ymm0
+.LBE1061:
+	.loc 1 381 32 discriminator 2
+	add	DWORD PTR -84[rbp], 16
+.L207:
+	.loc 1 381 19 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 15
+	cmp	DWORD PTR -1264[rbp], eax
+	jg	.L218
+	.loc 1 392 5
+	jmp	.L219
+.L225:
+.LBB1086:
+	.loc 1 394 49 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1152[rbp], rax
+.LBB1087:
+.LBB1088:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -1152[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+.LBE1088:
+.LBE1087:
+	.loc 1 394 20 discriminator 2
+	vmovaps	YMMWORD PTR -176[rbp], ymm0
+	.loc 1 395 57 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 395 13 discriminator 2
+	mov	rax, QWORD PTR -1248[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1144[rbp], rax
+.LBB1089:
+.LBB1090:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -1144[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	YMMWORD PTR -1072[rbp], ymm0
+	vmovaps	YMMWORD PTR -1104[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -176[rbp]
+	vmovaps	YMMWORD PTR -1136[rbp], ymm0
+.LBE1090:
+.LBE1089:
+.LBB1091:
+.LBB1092:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -1104[rbp]
+	vmovaps	ymm0, YMMWORD PTR -1136[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -1072[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1092:
+.LBE1091:
+	.loc 1 395 13 discriminator 2
+	vmovaps	YMMWORD PTR -176[rbp], ymm0
+	.loc 1 396 39 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 396 9 discriminator 2
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -992[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -176[rbp]
+	vmovaps	YMMWORD PTR -1040[rbp], ymm0
+.LBB1093:
+.LBB1094:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -1040[rbp]
+	mov	rax, QWORD PTR -992[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1094:
+.LBE1093:
+	.loc 1 397 59 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 397 16 discriminator 2
+	mov	rax, QWORD PTR -1256[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -984[rbp], rax
+.LBB1095:
+.LBB1096:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -984[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -176[rbp]
+	vmovaps	YMMWORD PTR -912[rbp], ymm0
+	vmovaps	YMMWORD PTR -944[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -976[rbp], ymm0
+.LBE1096:
+.LBE1095:
+.LBB1097:
+.LBB1098:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -944[rbp]
+	vmovaps	ymm0, YMMWORD PTR -976[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -912[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1098:
+.LBE1097:
+	.loc 1 397 16 discriminator 2
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+.LBE1086:
+	.loc 1 392 31 discriminator 2
+	add	DWORD PTR -84[rbp], 8
+.L219:
+	.loc 1 392 18 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 7
+	cmp	DWORD PTR -1264[rbp], eax
+	jg	.L225
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -1200[rbp], ymm0
+	vmovaps	ymm0, YMMWORD PTR -80[rbp]
+	vmovaps	YMMWORD PTR -1232[rbp], ymm0
+.LBB1099:
+.LBB1100:
+	.loc 3 149 10
+	vmovaps	ymm0, YMMWORD PTR -1200[rbp]
+	vaddps	ymm0, ymm0, YMMWORD PTR -1232[rbp]
+.LBE1100:
+.LBE1099:
+	.loc 1 399 17
+	call	lmsKernel_HorizontalSumAvx2
+	vmovd	eax, xmm0
+	mov	DWORD PTR -88[rbp], eax
+	.loc 1 400 5
+	jmp	.L227
+.L228:
+	.loc 1 402 21 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	vmovss	xmm1, DWORD PTR [rax]
+	.loc 1 402 43 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1248[rbp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	.loc 1 402 33 discriminator 2
+	vmulss	xmm0, xmm0, DWORD PTR -1260[rbp]
+	.loc 1 402 21 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	.loc 1 402 25 discriminator 2
+	vaddss	xmm0, xmm1, xmm0
+	vmovss	DWORD PTR [rax], xmm0
+	.loc 1 403 28 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1240[rbp]
+	add	rax, rdx
+	vmovss	xmm1, DWORD PTR [rax]
+	.loc 1 403 41 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1256[rbp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	.loc 1 403 32 discriminator 2
+	vmulss	xmm0, xmm1, xmm0
+	.loc 1 403 13 discriminator 2
+	vmovss	xmm1, DWORD PTR -88[rbp]
+	vaddss	xmm0, xmm1, xmm0
+	vmovss	DWORD PTR -88[rbp], xmm0
+	.loc 1 400 25 discriminator 2
+	add	DWORD PTR -84[rbp], 1
+.L227:
+	.loc 1 400 14 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	cmp	eax, DWORD PTR -1264[rbp]
+	jl	.L228
+	.loc 1 405 12
+	vmovss	xmm0, DWORD PTR -88[rbp]
+	.loc 1 406 1
+	mov	r10, QWORD PTR -8[rbp]
+	.cfi_def_cfa 10, 0
+	leave
+	lea	rsp, -8[r10]
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4849:
+	.size	lmsKernel_UpdateDotAvx2, .-lmsKernel_UpdateDotAvx2
+	.type	lmsKernel_LeakyUpdateDotAvx2, @function
+lmsKernel_LeakyUpdateDotAvx2:
+.LFB4850:
+	.loc 1 411 1
+	.cfi_startproc
+	lea	r10, 8[rsp]
+	.cfi_def_cfa 10, 0
+	and	rsp, -32
+	push	QWORD PTR -8[r10]
+	push	rbp
+	mov	rbp, rsp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	push	r10
+	.cfi_escape 0xf,0x3,0x76,0x78,0x6
+	sub	rsp, 1608
+	mov	QWORD PTR -1560[rbp], rdi
+	mov	QWORD PTR -1568[rbp], rsi
+	mov	QWORD PTR -1576[rbp], rdx
+	vmovss	DWORD PTR -1580[rbp], xmm0
+	vmovss	DWORD PTR -1584[rbp], xmm1
+	mov	DWORD PTR -1588[rbp], ecx
+	vmovss	xmm0, DWORD PTR -1580[rbp]
+	vmovss	DWORD PTR -280[rbp], xmm0
+.LBB1101:
+.LBB1102:
+	.loc 3 1320 10
+	vbroadcastss	ymm0, DWORD PTR -280[rbp]
+.LBE1102:
+.LBE1101:
+	.loc 1 412 22
+	vmovaps	YMMWORD PTR -144[rbp], ymm0
+	vmovss	xmm0, DWORD PTR -1584[rbp]
+	vmovss	DWORD PTR -276[rbp], xmm0
+.LBB1103:
+.LBB1104:
+	.loc 3 1320 10
+	vbroadcastss	ymm0, DWORD PTR -276[rbp]
+.LBE1104:
+.LBE1103:
+	.loc 1 413 22
+	vmovaps	YMMWORD PTR -176[rbp], ymm0
+.LBB1105:
+.LBB1106:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1106:
+.LBE1105:
+	.loc 1 414 19
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+.LBB1107:
+.LBB1108:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1108:
+.LBE1107:
+	.loc 1 415 19
+	vmovaps	YMMWORD PTR -80[rbp], ymm0
+	.loc 1 416 9
+	mov	DWORD PTR -84[rbp], 0
+	.loc 1 418 5
+	jmp	.L235
+.L248:
+.LBB1109:
+	.loc 1 420 67 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1080[rbp], rax
+.LBB1110:
+.LBB1111:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -1080[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -176[rbp]
+	vmovaps	YMMWORD PTR -1040[rbp], ymm0
+	vmovaps	YMMWORD PTR -1072[rbp], ymm1
+.LBE1111:
+.LBE1110:
+.LBB1112:
+.LBB1113:
+	.loc 3 320 10 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -1040[rbp]
+	vmulps	ymm0, ymm0, YMMWORD PTR -1072[rbp]
+.LBE1113:
+.LBE1112:
+	.loc 1 420 21 discriminator 2
+	vmovaps	YMMWORD PTR -240[rbp], ymm0
+	.loc 1 421 71 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -984[rbp], rax
+.LBB1114:
+.LBB1115:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -984[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -176[rbp]
+	vmovaps	YMMWORD PTR -944[rbp], ymm0
+	vmovaps	YMMWORD PTR -976[rbp], ymm1
+.LBE1115:
+.LBE1114:
+.LBB1116:
+.LBB1117:
+	.loc 3 320 10 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -944[rbp]
+	vmulps	ymm0, ymm0, YMMWORD PTR -976[rbp]
+.LBE1117:
+.LBE1116:
+	.loc 1 421 21 discriminator 2
+	vmovaps	YMMWORD PTR -272[rbp], ymm0
+	.loc 1 422 58 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 422 14 discriminator 2
+	mov	rax, QWORD PTR -1568[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -888[rbp], rax
+.LBB1118:
+.LBB1119:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -888[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	YMMWORD PTR -816[rbp], ymm0
+	vmovaps	YMMWORD PTR -848[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -240[rbp]
+	vmovaps	YMMWORD PTR -880[rbp], ymm0
+.LBE1119:
+.LBE1118:
+.LBB1120:
+.LBB1121:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -848[rbp]
+	vmovaps	ymm0, YMMWORD PTR -880[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -816[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1121:
+.LBE1120:
+	.loc 1 422 14 discriminator 2
+	vmovaps	YMMWORD PTR -240[rbp], ymm0
+	.loc 1 423 62 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 423 14 discriminator 2
+	mov	rax, QWORD PTR -1568[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -760[rbp], rax
+.LBB1122:
+.LBB1123:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -760[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	YMMWORD PTR -688[rbp], ymm0
+	vmovaps	YMMWORD PTR -720[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -272[rbp]
+	vmovaps	YMMWORD PTR -752[rbp], ymm0
+.LBE1123:
+.LBE1122:
+.LBB1124:
+.LBB1125:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -720[rbp]
+	vmovaps	ymm0, YMMWORD PTR -752[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -688[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1125:
+.LBE1124:
+	.loc 1 423 14 discriminator 2
+	vmovaps	YMMWORD PTR -272[rbp], ymm0
+	.loc 1 424 39 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 424 9 discriminator 2
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -600[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -240[rbp]
+	vmovaps	YMMWORD PTR -656[rbp], ymm0
+.LBB1126:
+.LBB1127:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -656[rbp]
+	mov	rax, QWORD PTR -600[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1127:
+.LBE1126:
+	.loc 1 425 43 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 425 9 discriminator 2
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -544[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -272[rbp]
+	vmovaps	YMMWORD PTR -592[rbp], ymm0
+.LBB1128:
+.LBB1129:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -592[rbp]
+	mov	rax, QWORD PTR -544[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1129:
+.LBE1128:
+	.loc 1 426 60 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 426 16 discriminator 2
+	mov	rax, QWORD PTR -1576[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -536[rbp], rax
+.LBB1130:
+.LBB1131:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -536[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -240[rbp]
+	vmovaps	YMMWORD PTR -464[rbp], ymm0
+	vmovaps	YMMWORD PTR -496[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -528[rbp], ymm0
+.LBE1131:
+.LBE1130:
+.LBB1132:
+.LBB1133:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -496[rbp]
+	vmovaps	ymm0, YMMWORD PTR -528[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -464[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1133:
+.LBE1132:
+	.loc 1 426 16 discriminator 2
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+	.loc 1 427 64 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 427 16 discriminator 2
+	mov	rax, QWORD PTR -1576[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -408[rbp], rax
+.LBB1134:
+.LBB1135:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -408[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -272[rbp]
+	vmovaps	YMMWORD PTR -336[rbp], ymm0
+	vmovaps	YMMWORD PTR -368[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -80[rbp]
+	vmovaps	YMMWORD PTR -400[rbp], ymm0
+.LBE1135:
+.LBE1134:
+.LBB1136:
+.LBB1137:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -368[rbp]
+	vmovaps	ymm0, YMMWORD PTR -400[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -336[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1137:
+.LBE1136:
+	.loc 1 427 16 discriminator 2
+	vmovaps	YMMWORD PTR -80[rbp], ymm0
+.LBE1109:
+	.loc 1 418 32 discriminator 2
+	add	DWORD PTR -84[rbp], 16
+.L235:
+	.loc 1 418 19 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 15
+	cmp	DWORD PTR -1588[rbp], eax
+	jg	.L248
+	.loc 1 429 5
+	jmp	.L249
+.L256:
+.LBB1138:
+	.loc 1 431 66 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1464[rbp], rax
+.LBB1139:
+.LBB1140:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -1464[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -176[rbp]
+	vmovaps	YMMWORD PTR -1424[rbp], ymm0
+	vmovaps	YMMWORD PTR -1456[rbp], ymm1
+.LBE1140:
+.LBE1139:
+.LBB1141:
+.LBB1142:
+	.loc 3 320 10 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -1424[rbp]
+	vmulps	ymm0, ymm0, YMMWORD PTR -1456[rbp]
+.LBE1142:
+.LBE1141:
+	.loc 1 431 20 discriminator 2
+	vmovaps	YMMWORD PTR -208[rbp], ymm0
+	.loc 1 432 57 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 432 13 discriminator 2
+	mov	rax, QWORD PTR -1568[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1368[rbp], rax
+.LBB1143:
+.LBB1144:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -1368[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	YMMWORD PTR -1296[rbp], ymm0
+	vmovaps	YMMWORD PTR -1328[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vmovaps	YMMWORD PTR -1360[rbp], ymm0
+.LBE1144:
+.LBE1143:
+.LBB1145:
+.LBB1146:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -1328[rbp]
+	vmovaps	ymm0, YMMWORD PTR -1360[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -1296[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1146:
+.LBE1145:
+	.loc 1 432 13 discriminator 2
+	vmovaps	YMMWORD PTR -208[rbp], ymm0
+	.loc 1 433 39 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 433 9 discriminator 2
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1216[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vmovaps	YMMWORD PTR -1264[rbp], ymm0
+.LBB1147:
+.LBB1148:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -1264[rbp]
+	mov	rax, QWORD PTR -1216[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1148:
+.LBE1147:
+	.loc 1 434 59 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 434 16 discriminator 2
+	mov	rax, QWORD PTR -1576[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1208[rbp], rax
+.LBB1149:
+.LBB1150:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -1208[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vmovaps	YMMWORD PTR -1136[rbp], ymm0
+	vmovaps	YMMWORD PTR -1168[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -1200[rbp], ymm0
+.LBE1150:
+.LBE1149:
+.LBB1151:
+.LBB1152:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -1168[rbp]
+	vmovaps	ymm0, YMMWORD PTR -1200[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -1136[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1152:
+.LBE1151:
+	.loc 1 434 16 discriminator 2
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+.LBE1138:
+	.loc 1 429 31 discriminator 2
+	add	DWORD PTR -84[rbp], 8
+.L249:
+	.loc 1 429 18 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 7
+	cmp	DWORD PTR -1588[rbp], eax
+	jg	.L256
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -1520[rbp], ymm0
+	vmovaps	ymm0, YMMWORD PTR -80[rbp]
+	vmovaps	YMMWORD PTR -1552[rbp], ymm0
+.LBB1153:
+.LBB1154:
+	.loc 3 149 10
+	vmovaps	ymm0, YMMWORD PTR -1520[rbp]
+	vaddps	ymm0, ymm0, YMMWORD PTR -1552[rbp]
+.LBE1154:
+.LBE1153:
+	.loc 1 436 17
+	call	lmsKernel_HorizontalSumAvx2
+	vmovd	eax, xmm0
+	mov	DWORD PTR -88[rbp], eax
+	.loc 1 437 5
+	jmp	.L258
+.L259:
+	.loc 1 439 46 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	.loc 1 439 32 discriminator 2
+	vmulss	xmm1, xmm0, DWORD PTR -1584[rbp]
+	.loc 1 439 67 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1568[rbp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	.loc 1 439 57 discriminator 2
+	vmulss	xmm0, xmm0, DWORD PTR -1580[rbp]
+	.loc 1 439 21 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	.loc 1 439 50 discriminator 2
+	vaddss	xmm0, xmm1, xmm0
+	.loc 1 439 25 discriminator 2
+	vmovss	DWORD PTR [rax], xmm0
+	.loc 1 440 28 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1560[rbp]
+	add	rax, rdx
+	vmovss	xmm1, DWORD PTR [rax]
+	.loc 1 440 41 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1576[rbp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	.loc 1 440 32 discriminator 2
+	vmulss	xmm0, xmm1, xmm0
+	.loc 1 440 13 discriminator 2
+	vmovss	xmm1, DWORD PTR -88[rbp]
+	vaddss	xmm0, xmm1, xmm0
+	vmovss	DWORD PTR -88[rbp], xmm0
+	.loc 1 437 25 discriminator 2
+	add	DWORD PTR -84[rbp], 1
+.L258:
+	.loc 1 437 14 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	cmp	eax, DWORD PTR -1588[rbp]
+	jl	.L259
+	.loc 1 442 12
+	vmovss	xmm0, DWORD PTR -88[rbp]
+	.loc 1 443 1
+	mov	r10, QWORD PTR -8[rbp]
+	.cfi_def_cfa 10, 0
+	leave
+	lea	rsp, -8[r10]
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4850:
+	.size	lmsKernel_LeakyUpdateDotAvx2, .-lmsKernel_LeakyUpdateDotAvx2
+	.type	lmsKernel_SignedGainAvx2, @function
+lmsKernel_SignedGainAvx2:
+.LFB4851:
+	.loc 1 447 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -32
+	sub	rsp, 232
+	vmovaps	YMMWORD PTR -88[rsp], ymm0
+	vmovaps	YMMWORD PTR -120[rsp], ymm1
+.LBB1155:
+.LBB1156:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1156:
+.LBE1155:
+	.loc 1 448 25
+	vmovaps	YMMWORD PTR 200[rsp], ymm0
+	.loc 1 449 43
+	vmovaps	ymm0, YMMWORD PTR -88[rsp]
+	vmovaps	ymm1, YMMWORD PTR 200[rsp]
+	vcmpps	ymm0, ymm0, ymm1, 30
+	vmovaps	YMMWORD PTR -24[rsp], ymm0
+	vmovaps	ymm0, YMMWORD PTR -120[rsp]
+	vmovaps	YMMWORD PTR -56[rsp], ymm0
+.LBB1157:
+.LBB1158:
+	.loc 3 174 19
+	vmovaps	ymm0, YMMWORD PTR -24[rsp]
+	vandps	ymm0, ymm0, YMMWORD PTR -56[rsp]
+	.loc 3 174 10
+	nop
+.LBE1158:
+.LBE1157:
+	.loc 1 449 29
+	vmovaps	YMMWORD PTR 168[rsp], ymm0
+	.loc 1 450 43
+	vmovaps	ymm0, YMMWORD PTR -88[rsp]
+	vmovaps	ymm1, YMMWORD PTR 200[rsp]
+	vcmpps	ymm0, ymm0, ymm1, 17
+	vmovaps	YMMWORD PTR 40[rsp], ymm0
+	vmovaps	ymm0, YMMWORD PTR -120[rsp]
+	vmovaps	YMMWORD PTR 8[rsp], ymm0
+.LBB1159:
+.LBB1160:
+	.loc 3 174 19
+	vmovaps	ymm0, YMMWORD PTR 40[rsp]
+	vandps	ymm0, ymm0, YMMWORD PTR 8[rsp]
+	.loc 3 174 10
+	nop
+.LBE1160:
+.LBE1159:
+	.loc 1 450 29
+	vmovaps	YMMWORD PTR 136[rsp], ymm0
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vmovaps	YMMWORD PTR 104[rsp], ymm0
+	vmovaps	ymm0, YMMWORD PTR 136[rsp]
+	vmovaps	YMMWORD PTR 72[rsp], ymm0
+.LBB1161:
+.LBB1162:
+	.loc 3 368 10
+	vmovaps	ymm0, YMMWORD PTR 104[rsp]
+	vsubps	ymm0, ymm0, YMMWORD PTR 72[rsp]
+.LBE1162:
+.LBE1161:
+	.loc 1 452 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4851:
+	.size	lmsKernel_SignedGainAvx2, .-lmsKernel_SignedGainAvx2
+	.type	lmsKernel_SignUpdateDotAvx2, @function
+lmsKernel_SignUpdateDotAvx2:
+.LFB4852:
+	.loc 1 457 1
+	.cfi_startproc
+	lea	r10, 8[rsp]
+	.cfi_def_cfa 10, 0
+	and	rsp, -32
+	push	QWORD PTR -8[r10]
+	push	rbp
+	mov	rbp, rsp
+	.cfi_escape 0x10,0x6,0x2,0x76,0
+	push	r10
+	.cfi_escape 0xf,0x3,0x76,0x78,0x6
+	sub	rsp, 1160
+	mov	QWORD PTR -1144[rbp], rdi
+	mov	QWORD PTR -1152[rbp], rsi
+	mov	QWORD PTR -1160[rbp], rdx
+	vmovss	DWORD PTR -1164[rbp], xmm0
+	mov	DWORD PTR -1168[rbp], ecx
+	vmovss	xmm0, DWORD PTR -1164[rbp]
+	vmovss	DWORD PTR -244[rbp], xmm0
+.LBB1163:
+.LBB1164:
+	.loc 3 1320 10
+	vbroadcastss	ymm0, DWORD PTR -244[rbp]
+.LBE1164:
+.LBE1163:
+	.loc 1 458 22
+	vmovaps	YMMWORD PTR -144[rbp], ymm0
+.LBB1165:
+.LBB1166:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1166:
+.LBE1165:
+	.loc 1 459 19
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+.LBB1167:
+.LBB1168:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1168:
+.LBE1167:
+	.loc 1 460 19
+	vmovaps	YMMWORD PTR -80[rbp], ymm0
+	.loc 1 461 9
+	mov	DWORD PTR -84[rbp], 0
+	.loc 1 463 5
+	jmp	.L271
+.L282:
+.LBB1169:
+	.loc 1 466 85 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 465 21 discriminator 2
+	mov	rax, QWORD PTR -1152[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -800[rbp], rax
+.LBB1170:
+.LBB1171:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -800[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm2, ymm0
+.LBE1171:
+.LBE1170:
+	.loc 1 465 21 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, ymm2
+	call	lmsKernel_SignedGainAvx2
+	.loc 1 465 64 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -792[rbp], rax
+.LBB1172:
+.LBB1173:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -792[rbp]
+	vmovups	ymm1, YMMWORD PTR [rax]
+	vmovaps	YMMWORD PTR -752[rbp], ymm1
+	vmovaps	YMMWORD PTR -784[rbp], ymm0
+.LBE1173:
+.LBE1172:
+.LBB1174:
+.LBB1175:
+	.loc 3 149 10 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -752[rbp]
+	vaddps	ymm0, ymm0, YMMWORD PTR -784[rbp]
+.LBE1175:
+.LBE1174:
+	.loc 1 465 21 discriminator 2
+	vmovaps	YMMWORD PTR -208[rbp], ymm0
+	.loc 1 468 89 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 467 21 discriminator 2
+	mov	rax, QWORD PTR -1152[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -704[rbp], rax
+.LBB1176:
+.LBB1177:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -704[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm2, ymm0
+.LBE1177:
+.LBE1176:
+	.loc 1 467 21 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, ymm2
+	call	lmsKernel_SignedGainAvx2
+	.loc 1 467 68 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -696[rbp], rax
+.LBB1178:
+.LBB1179:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -696[rbp]
+	vmovups	ymm1, YMMWORD PTR [rax]
+	vmovaps	YMMWORD PTR -656[rbp], ymm1
+	vmovaps	YMMWORD PTR -688[rbp], ymm0
+.LBE1179:
+.LBE1178:
+.LBB1180:
+.LBB1181:
+	.loc 3 149 10 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -656[rbp]
+	vaddps	ymm0, ymm0, YMMWORD PTR -688[rbp]
+.LBE1181:
+.LBE1180:
+	.loc 1 467 21 discriminator 2
+	vmovaps	YMMWORD PTR -240[rbp], ymm0
+	.loc 1 469 39 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 469 9 discriminator 2
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -568[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vmovaps	YMMWORD PTR -624[rbp], ymm0
+.LBB1182:
+.LBB1183:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -624[rbp]
+	mov	rax, QWORD PTR -568[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1183:
+.LBE1182:
+	.loc 1 470 43 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 470 9 discriminator 2
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -512[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -240[rbp]
+	vmovaps	YMMWORD PTR -560[rbp], ymm0
+.LBB1184:
+.LBB1185:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -560[rbp]
+	mov	rax, QWORD PTR -512[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1185:
+.LBE1184:
+	.loc 1 471 60 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 471 16 discriminator 2
+	mov	rax, QWORD PTR -1160[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -504[rbp], rax
+.LBB1186:
+.LBB1187:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -504[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -208[rbp]
+	vmovaps	YMMWORD PTR -432[rbp], ymm0
+	vmovaps	YMMWORD PTR -464[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -496[rbp], ymm0
+.LBE1187:
+.LBE1186:
+.LBB1188:
+.LBB1189:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -464[rbp]
+	vmovaps	ymm0, YMMWORD PTR -496[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -432[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1189:
+.LBE1188:
+	.loc 1 471 16 discriminator 2
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+	.loc 1 472 64 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 472 16 discriminator 2
+	mov	rax, QWORD PTR -1160[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -376[rbp], rax
+.LBB1190:
+.LBB1191:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -376[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -240[rbp]
+	vmovaps	YMMWORD PTR -304[rbp], ymm0
+	vmovaps	YMMWORD PTR -336[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -80[rbp]
+	vmovaps	YMMWORD PTR -368[rbp], ymm0
+.LBE1191:
+.LBE1190:
+.LBB1192:
+.LBB1193:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -336[rbp]
+	vmovaps	ymm0, YMMWORD PTR -368[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -304[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1193:
+.LBE1192:
+	.loc 1 472 16 discriminator 2
+	vmovaps	YMMWORD PTR -80[rbp], ymm0
+.LBE1169:
+	.loc 1 463 32 discriminator 2
+	add	DWORD PTR -84[rbp], 16
+.L271:
+	.loc 1 463 19 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 15
+	cmp	DWORD PTR -1168[rbp], eax
+	jg	.L282
+	.loc 1 474 5
+	jmp	.L283
+.L289:
+.LBB1194:
+	.loc 1 477 84 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 476 20 discriminator 2
+	mov	rax, QWORD PTR -1152[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1056[rbp], rax
+.LBB1195:
+.LBB1196:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -1056[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm2, ymm0
+.LBE1196:
+.LBE1195:
+	.loc 1 476 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -144[rbp]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, ymm2
+	call	lmsKernel_SignedGainAvx2
+	.loc 1 476 63 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -1048[rbp], rax
+.LBB1197:
+.LBB1198:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -1048[rbp]
+	vmovups	ymm1, YMMWORD PTR [rax]
+	vmovaps	YMMWORD PTR -1008[rbp], ymm1
+	vmovaps	YMMWORD PTR -1040[rbp], ymm0
+.LBE1198:
+.LBE1197:
+.LBB1199:
+.LBB1200:
+	.loc 3 149 10 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -1008[rbp]
+	vaddps	ymm0, ymm0, YMMWORD PTR -1040[rbp]
+.LBE1200:
+.LBE1199:
+	.loc 1 476 20 discriminator 2
+	vmovaps	YMMWORD PTR -176[rbp], ymm0
+	.loc 1 478 39 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 478 9 discriminator 2
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -928[rbp], rax
+	vmovaps	ymm0, YMMWORD PTR -176[rbp]
+	vmovaps	YMMWORD PTR -976[rbp], ymm0
+.LBB1201:
+.LBB1202:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -976[rbp]
+	mov	rax, QWORD PTR -928[rbp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1202:
+.LBE1201:
+	.loc 1 479 59 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 479 16 discriminator 2
+	mov	rax, QWORD PTR -1160[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -920[rbp], rax
+.LBB1203:
+.LBB1204:
+	.loc 3 905 10 discriminator 2
+	mov	rax, QWORD PTR -920[rbp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR -176[rbp]
+	vmovaps	YMMWORD PTR -848[rbp], ymm0
+	vmovaps	YMMWORD PTR -880[rbp], ymm1
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -912[rbp], ymm0
+.LBE1204:
+.LBE1203:
+.LBB1205:
+.LBB1206:
+	.loc 5 65 18 discriminator 2
+	vmovaps	ymm1, YMMWORD PTR -880[rbp]
+	vmovaps	ymm0, YMMWORD PTR -912[rbp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR -848[rbp]
+	.loc 5 65 10 discriminator 2
+	nop
+.LBE1206:
+.LBE1205:
+	.loc 1 479 16 discriminator 2
+	vmovaps	YMMWORD PTR -48[rbp], ymm0
+.LBE1194:
+	.loc 1 474 31 discriminator 2
+	add	DWORD PTR -84[rbp], 8
+.L283:
+	.loc 1 474 18 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 7
+	cmp	DWORD PTR -1168[rbp], eax
+	jg	.L289
+	vmovaps	ymm0, YMMWORD PTR -48[rbp]
+	vmovaps	YMMWORD PTR -1104[rbp], ymm0
+	vmovaps	ymm0, YMMWORD PTR -80[rbp]
+	vmovaps	YMMWORD PTR -1136[rbp], ymm0
+.LBB1207:
+.LBB1208:
+	.loc 3 149 10
+	vmovaps	ymm0, YMMWORD PTR -1104[rbp]
+	vaddps	ymm0, ymm0, YMMWORD PTR -1136[rbp]
+.LBE1208:
+.LBE1207:
+	.loc 1 481 17
+	call	lmsKernel_HorizontalSumAvx2
+	vmovd	eax, xmm0
+	mov	DWORD PTR -88[rbp], eax
+	.loc 1 482 5
+	jmp	.L291
+.L292:
+	.loc 1 484 58 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1152[rbp]
+	add	rax, rdx
+	.loc 1 484 35 discriminator 2
+	mov	eax, DWORD PTR [rax]
+	vmovd	xmm0, eax
+	call	lmsKernel_Sign
+	vmovd	eax, xmm0
+	.loc 1 484 33 discriminator 2
+	vmovd	xmm3, eax
+	vmulss	xmm1, xmm3, DWORD PTR -1164[rbp]
+	.loc 1 484 21 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	.loc 1 484 25 discriminator 2
+	vaddss	xmm0, xmm1, xmm0
+	vmovss	DWORD PTR [rax], xmm0
+	.loc 1 485 28 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1144[rbp]
+	add	rax, rdx
+	vmovss	xmm1, DWORD PTR [rax]
+	.loc 1 485 41 discriminator 2
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -1160[rbp]
+	add	rax, rdx
+	vmovss	xmm0, DWORD PTR [rax]
+	.loc 1 485 32 discriminator 2
+	vmulss	xmm0, xmm1, xmm0
+	.loc 1 485 13 discriminator 2
+	vmovss	xmm1, DWORD PTR -88[rbp]
+	vaddss	xmm0, xmm1, xmm0
+	vmovss	DWORD PTR -88[rbp], xmm0
+	.loc 1 482 25 discriminator 2
+	add	DWORD PTR -84[rbp], 1
+.L291:
+	.loc 1 482 14 discriminator 1
+	mov	eax, DWORD PTR -84[rbp]
+	cmp	eax, DWORD PTR -1168[rbp]
+	jl	.L292
+	.loc 1 487 12
+	vmovss	xmm0, DWORD PTR -88[rbp]
+	.loc 1 488 1
+	mov	r10, QWORD PTR -8[rbp]
+	.cfi_def_cfa 10, 0
+	leave
+	lea	rsp, -8[r10]
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4852:
+	.size	lmsKernel_SignUpdateDotAvx2, .-lmsKernel_SignUpdateDotAvx2
+	.type	lmsKernel_BankUpdateDotAvx2, @function
+lmsKernel_BankUpdateDotAvx2:
+.LFB4853:
+	.loc 1 493 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -32
+	sub	rsp, 968
+	mov	QWORD PTR -64[rsp], rdi
+	mov	QWORD PTR -72[rsp], rsi
+	mov	QWORD PTR -80[rsp], rdx
+	mov	QWORD PTR -88[rsp], rcx
+	mov	QWORD PTR -96[rsp], r8
+	mov	DWORD PTR -100[rsp], r9d
+.LBB1209:
+	.loc 1 494 14
+	mov	DWORD PTR 964[rsp], 0
+	.loc 1 494 5
+	jmp	.L295
+.L312:
+.LBB1210:
+	.loc 1 496 48
+	mov	eax, DWORD PTR 964[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 496 27
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 664[rsp], rax
+.LBB1211:
+.LBB1212:
+	.loc 3 905 10
+	mov	rax, QWORD PTR 664[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+.LBE1212:
+.LBE1211:
+	.loc 1 496 27
+	vmovaps	YMMWORD PTR 808[rsp], ymm0
+	.loc 1 497 53
+	mov	eax, DWORD PTR 964[rsp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 497 27
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 672[rsp], rax
+.LBB1213:
+.LBB1214:
+	.loc 3 905 10
+	mov	rax, QWORD PTR 672[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+.LBE1214:
+.LBE1213:
+	.loc 1 497 27
+	vmovaps	YMMWORD PTR 776[rsp], ymm0
+.LBB1215:
+.LBB1216:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1216:
+.LBE1215:
+	.loc 1 498 23
+	vmovaps	YMMWORD PTR 904[rsp], ymm0
+.LBB1217:
+.LBB1218:
+	.loc 3 1237 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1218:
+.LBE1217:
+	.loc 1 499 23
+	vmovaps	YMMWORD PTR 872[rsp], ymm0
+.LBB1219:
+	.loc 1 501 18
+	mov	DWORD PTR 868[rsp], 0
+	.loc 1 501 9
+	jmp	.L300
+.L311:
+.LBB1220:
+	.loc 1 503 32 discriminator 3
+	mov	eax, DWORD PTR 868[rsp]
+	movsx	rdx, eax
+	.loc 1 503 42 discriminator 3
+	mov	eax, DWORD PTR 16[rbp]
+	cdqe
+	imul	rdx, rax
+	.loc 1 503 51 discriminator 3
+	mov	eax, DWORD PTR 964[rsp]
+	cdqe
+	.loc 1 503 26 discriminator 3
+	add	rax, rdx
+	mov	QWORD PTR 768[rsp], rax
+	.loc 1 504 107 discriminator 3
+	mov	rax, QWORD PTR 768[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 56[rsp], rax
+.LBB1221:
+.LBB1222:
+	.loc 3 905 10 discriminator 3
+	mov	rax, QWORD PTR 56[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+.LBE1222:
+.LBE1221:
+	.loc 1 504 70 discriminator 3
+	mov	rax, QWORD PTR 768[rsp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 504 25 discriminator 3
+	mov	rax, QWORD PTR -72[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 64[rsp], rax
+.LBB1223:
+.LBB1224:
+	.loc 3 905 10 discriminator 3
+	mov	rax, QWORD PTR 64[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm2, ymm0
+	vmovaps	ymm0, YMMWORD PTR 808[rsp]
+	vmovaps	YMMWORD PTR 136[rsp], ymm0
+	vmovaps	YMMWORD PTR 104[rsp], ymm2
+	vmovaps	YMMWORD PTR 72[rsp], ymm1
+.LBE1224:
+.LBE1223:
+.LBB1225:
+.LBB1226:
+	.loc 5 65 18 discriminator 3
+	vmovaps	ymm1, YMMWORD PTR 104[rsp]
+	vmovaps	ymm0, YMMWORD PTR 72[rsp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR 136[rsp]
+	.loc 5 65 10 discriminator 3
+	nop
+.LBE1226:
+.LBE1225:
+	.loc 1 504 25 discriminator 3
+	vmovaps	YMMWORD PTR 712[rsp], ymm0
+	.loc 1 505 117 discriminator 3
+	mov	rax, QWORD PTR 768[rsp]
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 184[rsp], rax
+.LBB1227:
+.LBB1228:
+	.loc 3 905 10 discriminator 3
+	mov	rax, QWORD PTR 184[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+.LBE1228:
+.LBE1227:
+	.loc 1 505 76 discriminator 3
+	mov	rax, QWORD PTR 768[rsp]
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 505 25 discriminator 3
+	mov	rax, QWORD PTR -72[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 192[rsp], rax
+.LBB1229:
+.LBB1230:
+	.loc 3 905 10 discriminator 3
+	mov	rax, QWORD PTR 192[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm2, ymm0
+	vmovaps	ymm0, YMMWORD PTR 776[rsp]
+	vmovaps	YMMWORD PTR 264[rsp], ymm0
+	vmovaps	YMMWORD PTR 232[rsp], ymm2
+	vmovaps	YMMWORD PTR 200[rsp], ymm1
+.LBE1230:
+.LBE1229:
+.LBB1231:
+.LBB1232:
+	.loc 5 65 18 discriminator 3
+	vmovaps	ymm1, YMMWORD PTR 232[rsp]
+	vmovaps	ymm0, YMMWORD PTR 200[rsp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR 264[rsp]
+	.loc 5 65 10 discriminator 3
+	nop
+.LBE1232:
+.LBE1231:
+	.loc 1 505 25 discriminator 3
+	vmovaps	YMMWORD PTR 680[rsp], ymm0
+	.loc 1 506 43 discriminator 3
+	mov	rax, QWORD PTR 768[rsp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 506 13 discriminator 3
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 352[rsp], rax
+	vmovaps	ymm0, YMMWORD PTR 712[rsp]
+	vmovaps	YMMWORD PTR 296[rsp], ymm0
+.LBB1233:
+.LBB1234:
+	.loc 3 911 20 discriminator 3
+	vmovaps	ymm0, YMMWORD PTR 296[rsp]
+	mov	rax, QWORD PTR 352[rsp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 3
+	nop
+.LBE1234:
+.LBE1233:
+	.loc 1 507 49 discriminator 3
+	mov	rax, QWORD PTR 768[rsp]
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 507 13 discriminator 3
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 408[rsp], rax
+	vmovaps	ymm0, YMMWORD PTR 680[rsp]
+	vmovaps	YMMWORD PTR 360[rsp], ymm0
+.LBB1235:
+.LBB1236:
+	.loc 3 911 20 discriminator 3
+	vmovaps	ymm0, YMMWORD PTR 360[rsp]
+	mov	rax, QWORD PTR 408[rsp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 3
+	nop
+.LBE1236:
+.LBE1235:
+	.loc 1 508 64 discriminator 3
+	mov	rax, QWORD PTR 768[rsp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 508 20 discriminator 3
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 416[rsp], rax
+.LBB1237:
+.LBB1238:
+	.loc 3 905 10 discriminator 3
+	mov	rax, QWORD PTR 416[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR 712[rsp]
+	vmovaps	YMMWORD PTR 488[rsp], ymm0
+	vmovaps	YMMWORD PTR 456[rsp], ymm1
+	vmovaps	ymm0, YMMWORD PTR 904[rsp]
+	vmovaps	YMMWORD PTR 424[rsp], ymm0
+.LBE1238:
+.LBE1237:
+.LBB1239:
+.LBB1240:
+	.loc 5 65 18 discriminator 3
+	vmovaps	ymm1, YMMWORD PTR 456[rsp]
+	vmovaps	ymm0, YMMWORD PTR 424[rsp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR 488[rsp]
+	.loc 5 65 10 discriminator 3
+	nop
+.LBE1240:
+.LBE1239:
+	.loc 1 508 20 discriminator 3
+	vmovaps	YMMWORD PTR 904[rsp], ymm0
+	.loc 1 509 70 discriminator 3
+	mov	rax, QWORD PTR 768[rsp]
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 509 20 discriminator 3
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 544[rsp], rax
+.LBB1241:
+.LBB1242:
+	.loc 3 905 10 discriminator 3
+	mov	rax, QWORD PTR 544[rsp]
+	vmovups	ymm0, YMMWORD PTR [rax]
+	vmovaps	ymm1, ymm0
+	vmovaps	ymm0, YMMWORD PTR 680[rsp]
+	vmovaps	YMMWORD PTR 616[rsp], ymm0
+	vmovaps	YMMWORD PTR 584[rsp], ymm1
+	vmovaps	ymm0, YMMWORD PTR 872[rsp]
+	vmovaps	YMMWORD PTR 552[rsp], ymm0
+.LBE1242:
+.LBE1241:
+.LBB1243:
+.LBB1244:
+	.loc 5 65 18 discriminator 3
+	vmovaps	ymm1, YMMWORD PTR 584[rsp]
+	vmovaps	ymm0, YMMWORD PTR 552[rsp]
+	vfmadd231ps	ymm0, ymm1, YMMWORD PTR 616[rsp]
+	.loc 5 65 10 discriminator 3
+	nop
+.LBE1244:
+.LBE1243:
+	.loc 1 509 20 discriminator 3
+	vmovaps	YMMWORD PTR 872[rsp], ymm0
+.LBE1220:
+	.loc 1 501 38 discriminator 3
+	add	DWORD PTR 868[rsp], 1
+.L300:
+	.loc 1 501 27 discriminator 1
+	mov	eax, DWORD PTR 868[rsp]
+	cmp	eax, DWORD PTR -100[rsp]
+	jl	.L311
+.LBE1219:
+	.loc 1 511 33 discriminator 2
+	mov	eax, DWORD PTR 964[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 511 9 discriminator 2
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR [rsp], rax
+	vmovaps	ymm0, YMMWORD PTR 904[rsp]
+	vmovaps	YMMWORD PTR -56[rsp], ymm0
+.LBB1245:
+.LBB1246:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR -56[rsp]
+	mov	rax, QWORD PTR [rsp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1246:
+.LBE1245:
+	.loc 1 512 38 discriminator 2
+	mov	eax, DWORD PTR 964[rsp]
+	cdqe
+	add	rax, 8
+	lea	rdx, 0[0+rax*4]
+	.loc 1 512 9 discriminator 2
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 48[rsp], rax
+	vmovaps	ymm0, YMMWORD PTR 872[rsp]
+	vmovaps	YMMWORD PTR 8[rsp], ymm0
+.LBB1247:
+.LBB1248:
+	.loc 3 911 20 discriminator 2
+	vmovaps	ymm0, YMMWORD PTR 8[rsp]
+	mov	rax, QWORD PTR 48[rsp]
+	vmovups	YMMWORD PTR [rax], ymm0
+	.loc 3 912 1 discriminator 2
+	nop
+.LBE1248:
+.LBE1247:
+.LBE1210:
+	.loc 1 494 38 discriminator 2
+	add	DWORD PTR 964[rsp], 16
+.L295:
+	.loc 1 494 25 discriminator 1
+	mov	eax, DWORD PTR 964[rsp]
+	cmp	eax, DWORD PTR 16[rbp]
+	jl	.L312
+.LBE1209:
+	.loc 1 514 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4853:
+	.size	lmsKernel_BankUpdateDotAvx2, .-lmsKernel_BankUpdateDotAvx2
+	.type	lmsKernel_DotAvx512, @function
+lmsKernel_DotAvx512:
+.LFB4854:
+	.loc 1 522 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -64
+	sub	rsp, 1608
+	mov	QWORD PTR -80[rsp], rdi
+	mov	QWORD PTR -88[rsp], rsi
+	mov	DWORD PTR -92[rsp], edx
+.LBB1249:
+.LBB1250:
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/avx512fintrin.h"
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1250:
+.LBE1249:
+	.loc 1 523 19
+	vmovaps	ZMMWORD PTR 1544[rsp], zmm0
+.LBB1251:
+.LBB1252:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1252:
+.LBE1251:
+	.loc 1 524 19
+	vmovaps	ZMMWORD PTR 1480[rsp], zmm0
+	.loc 1 525 9
+	mov	DWORD PTR 1476[rsp], 0
+	.loc 1 527 5
+	jmp	.L316
+.L323:
+	.loc 1 529 74 discriminator 2
+	mov	eax, DWORD PTR 1476[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 952[rsp], rax
+.LBB1253:
+.LBB1254:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 952[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+.LBE1254:
+.LBE1253:
+	.loc 1 529 50 discriminator 2
+	mov	eax, DWORD PTR 1476[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 960[rsp], rax
+.LBB1255:
+.LBB1256:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 960[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	ZMMWORD PTR 1096[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1032[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 1544[rsp]
+	vmovaps	ZMMWORD PTR 968[rsp], zmm0
+.LBE1256:
+.LBE1255:
+.LBB1257:
+.LBB1258:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1096[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1032[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 968[rsp]
+	mov	eax, -1
+	kmovw	k1, eax
+	vfmadd132ps	zmm0{k1}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1258:
+.LBE1257:
+	.loc 1 529 16 discriminator 2
+	vmovaps	ZMMWORD PTR 1544[rsp], zmm0
+	.loc 1 530 83 discriminator 2
+	mov	eax, DWORD PTR 1476[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1208[rsp], rax
+.LBB1259:
+.LBB1260:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1208[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+.LBE1260:
+.LBE1259:
+	.loc 1 530 54 discriminator 2
+	mov	eax, DWORD PTR 1476[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1216[rsp], rax
+.LBB1261:
+.LBB1262:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1216[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	ZMMWORD PTR 1352[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1288[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 1480[rsp]
+	vmovaps	ZMMWORD PTR 1224[rsp], zmm0
+.LBE1262:
+.LBE1261:
+.LBB1263:
+.LBB1264:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1352[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1288[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1224[rsp]
+	mov	eax, -1
+	kmovw	k2, eax
+	vfmadd132ps	zmm0{k2}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1264:
+.LBE1263:
+	.loc 1 530 16 discriminator 2
+	vmovaps	ZMMWORD PTR 1480[rsp], zmm0
+	.loc 1 527 32 discriminator 2
+	add	DWORD PTR 1476[rsp], 32
+.L316:
+	.loc 1 527 19 discriminator 1
+	mov	eax, DWORD PTR 1476[rsp]
+	add	eax, 31
+	cmp	DWORD PTR -92[rsp], eax
+	jg	.L323
+	.loc 1 532 5
+	jmp	.L324
+.L328:
+	.loc 1 534 74 discriminator 2
+	mov	eax, DWORD PTR 1476[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 696[rsp], rax
+.LBB1265:
+.LBB1266:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 696[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+.LBE1266:
+.LBE1265:
+	.loc 1 534 50 discriminator 2
+	mov	eax, DWORD PTR 1476[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 704[rsp], rax
+.LBB1267:
+.LBB1268:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 704[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	ZMMWORD PTR 840[rsp], zmm0
+	vmovaps	ZMMWORD PTR 776[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 1544[rsp]
+	vmovaps	ZMMWORD PTR 712[rsp], zmm0
+.LBE1268:
+.LBE1267:
+.LBB1269:
+.LBB1270:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 840[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 776[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 712[rsp]
+	mov	eax, -1
+	kmovw	k3, eax
+	vfmadd132ps	zmm0{k3}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1270:
+.LBE1269:
+	.loc 1 534 16 discriminator 2
+	vmovaps	ZMMWORD PTR 1544[rsp], zmm0
+	.loc 1 532 32 discriminator 2
+	add	DWORD PTR 1476[rsp], 16
+.L324:
+	.loc 1 532 19 discriminator 1
+	mov	eax, DWORD PTR 1476[rsp]
+	add	eax, 15
+	cmp	DWORD PTR -92[rsp], eax
+	jg	.L328
+	.loc 1 536 8
+	mov	eax, DWORD PTR 1476[rsp]
+	cmp	eax, DWORD PTR -92[rsp]
+	jge	.L329
+.LBB1271:
+	.loc 1 539 53
+	mov	eax, DWORD PTR -92[rsp]
+	sub	eax, DWORD PTR 1476[rsp]
+	.loc 1 539 42
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	.loc 1 539 19
+	sub	eax, 1
+	mov	WORD PTR 1474[rsp], ax
+	.loc 1 540 98
+	mov	eax, DWORD PTR 1476[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rdx, rax
+	.loc 1 540 16
+	movzx	eax, WORD PTR 1474[rsp]
+	mov	WORD PTR 438[rsp], ax
+	mov	QWORD PTR 424[rsp], rdx
+.LBB1272:
+.LBB1273:
+	.loc 6 6349 19
+	movzx	edx, WORD PTR 438[rsp]
+.LBB1274:
+.LBB1275:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1275:
+.LBE1274:
+	.loc 6 6349 19
+	mov	rax, QWORD PTR 424[rsp]
+	kmovw	k4, edx
+	vmovups	zmm0{k4}, ZMMWORD PTR [rax]
+	.loc 6 6349 10
+	nop
+.LBE1273:
+.LBE1272:
+	.loc 1 540 62
+	mov	eax, DWORD PTR 1476[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rdx, rax
+	.loc 1 540 16
+	movzx	eax, WORD PTR 1474[rsp]
+	mov	WORD PTR 454[rsp], ax
+	mov	QWORD PTR 440[rsp], rdx
+.LBB1276:
+.LBB1277:
+	.loc 6 6349 19
+	movzx	edx, WORD PTR 454[rsp]
+.LBB1278:
+.LBB1279:
+	.loc 6 307 10
+	vxorps	xmm1, xmm1, xmm1
+.LBE1279:
+.LBE1278:
+	.loc 6 6349 19
+	mov	rax, QWORD PTR 440[rsp]
+	kmovw	k5, edx
+	vmovups	zmm1{k5}, ZMMWORD PTR [rax]
+	.loc 6 6349 10
+	nop
+	vmovaps	ZMMWORD PTR 584[rsp], zmm1
+	vmovaps	ZMMWORD PTR 520[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 1480[rsp]
+	vmovaps	ZMMWORD PTR 456[rsp], zmm0
+.LBE1277:
+.LBE1276:
+.LBB1280:
+.LBB1281:
+	.loc 6 13368 19
+	vmovaps	zmm0, ZMMWORD PTR 584[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 520[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 456[rsp]
+	mov	eax, -1
+	kmovw	k6, eax
+	vfmadd132ps	zmm0{k6}, zmm1, zmm2
+	.loc 6 13368 10
+	nop
+.LBE1281:
+.LBE1280:
+	.loc 1 540 16
+	vmovaps	ZMMWORD PTR 1480[rsp], zmm0
+.L329:
+	vmovaps	zmm0, ZMMWORD PTR 1544[rsp]
+	vmovaps	ZMMWORD PTR 8[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 1480[rsp]
+	vmovaps	ZMMWORD PTR -56[rsp], zmm0
+.LBE1271:
+.LBB1282:
+.LBB1283:
+	.loc 6 12600 10
+	vmovaps	zmm0, ZMMWORD PTR 8[rsp]
+	vaddps	zmm0, zmm0, ZMMWORD PTR -56[rsp]
+	vmovaps	ZMMWORD PTR 328[rsp], zmm0
+.LBE1283:
+.LBE1282:
+.LBB1284:
+.LBB1285:
+.LBB1286:
+.LBB1287:
+	.loc 3 1211 10
+	vmovapd	ymm1, YMMWORD PTR 296[rsp]
+.LBE1287:
+.LBE1286:
+	.loc 6 16169 3
+	vmovapd	zmm0, ZMMWORD PTR 328[rsp]
+	mov	eax, -1
+	kmovw	k7, eax
+	vextractf64x4	ymm1{k7}, zmm0, 0x1
+	vmovapd	YMMWORD PTR 264[rsp], ymm1
+.LBB1288:
+.LBB1289:
+	.loc 3 1211 10
+	vmovapd	ymm1, YMMWORD PTR 232[rsp]
+.LBE1289:
+.LBE1288:
+	.loc 6 16169 3
+	vmovapd	zmm0, ZMMWORD PTR 328[rsp]
+	mov	eax, -1
+	kmovw	k1, eax
+	vextractf64x4	ymm1{k1}, zmm0, 0x0
+	vmovapd	YMMWORD PTR 200[rsp], ymm1
+	vmovaps	ymm0, YMMWORD PTR 264[rsp]
+	vaddps	ymm0, ymm0, YMMWORD PTR 200[rsp]
+	vmovaps	YMMWORD PTR 168[rsp], ymm0
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vextractf128	XMMWORD PTR 152[rsp], ymm0, 0x1
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vmovaps	XMMWORD PTR 136[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 136[rsp]
+	vmovaps	XMMWORD PTR 120[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vpermilps	xmm0, xmm0, 78
+	vmovaps	XMMWORD PTR 104[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 104[rsp]
+	vmovaps	XMMWORD PTR -72[rsp], xmm0
+	vmovss	xmm1, DWORD PTR -72[rsp]
+	vmovss	xmm0, DWORD PTR -68[rsp]
+	vaddss	xmm0, xmm1, xmm0
+.LBE1285:
+.LBE1284:
+	.loc 1 543 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4854:
+	.size	lmsKernel_DotAvx512, .-lmsKernel_DotAvx512
+	.type	lmsKernel_UpdateAvx512, @function
+lmsKernel_UpdateAvx512:
+.LFB4855:
+	.loc 1 547 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -64
+	sub	rsp, 904
+	mov	QWORD PTR -96[rsp], rdi
+	mov	QWORD PTR -104[rsp], rsi
+	vmovss	DWORD PTR -108[rsp], xmm0
+	mov	DWORD PTR -112[rsp], edx
+	vmovss	xmm0, DWORD PTR -108[rsp]
+	vmovss	DWORD PTR 580[rsp], xmm0
+.LBB1290:
+.LBB1291:
+	.loc 6 250 24
+	vbroadcastss	zmm0, DWORD PTR 580[rsp]
+.LBE1291:
+.LBE1290:
+	.loc 1 548 22
+	vmovaps	ZMMWORD PTR 776[rsp], zmm0
+	.loc 1 549 9
+	mov	DWORD PTR 900[rsp], 0
+	.loc 1 551 5
+	jmp	.L342
+.L346:
+.LBB1292:
+	.loc 1 553 49 discriminator 2
+	mov	eax, DWORD PTR 900[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 248[rsp], rax
+.LBB1293:
+.LBB1294:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 248[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+.LBE1294:
+.LBE1293:
+	.loc 1 553 20 discriminator 2
+	vmovaps	ZMMWORD PTR 584[rsp], zmm0
+	.loc 1 554 54 discriminator 2
+	mov	eax, DWORD PTR 900[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 256[rsp], rax
+.LBB1295:
+.LBB1296:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 256[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 776[rsp]
+	vmovaps	ZMMWORD PTR 392[rsp], zmm0
+	vmovaps	ZMMWORD PTR 328[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 584[rsp]
+	vmovaps	ZMMWORD PTR 264[rsp], zmm0
+.LBE1296:
+.LBE1295:
+.LBB1297:
+.LBB1298:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 392[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 328[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 264[rsp]
+	mov	eax, -1
+	kmovw	k1, eax
+	vfmadd132ps	zmm0{k1}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1298:
+.LBE1297:
+	.loc 1 554 13 discriminator 2
+	vmovaps	ZMMWORD PTR 584[rsp], zmm0
+	.loc 1 555 39 discriminator 2
+	mov	eax, DWORD PTR 900[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 568[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 584[rsp]
+	vmovaps	ZMMWORD PTR 456[rsp], zmm0
+.LBB1299:
+.LBB1300:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 456[rsp]
+	mov	rax, QWORD PTR 568[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1300:
+.LBE1299:
+.LBE1292:
+	.loc 1 551 32 discriminator 2
+	add	DWORD PTR 900[rsp], 16
+.L342:
+	.loc 1 551 19 discriminator 1
+	mov	eax, DWORD PTR 900[rsp]
+	add	eax, 15
+	cmp	DWORD PTR -112[rsp], eax
+	jg	.L346
+	.loc 1 557 8
+	mov	eax, DWORD PTR 900[rsp]
+	cmp	eax, DWORD PTR -112[rsp]
+	jge	.L353
+.LBB1301:
+	.loc 1 559 53
+	mov	eax, DWORD PTR -112[rsp]
+	sub	eax, DWORD PTR 900[rsp]
+	.loc 1 559 42
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	.loc 1 559 19
+	sub	eax, 1
+	mov	WORD PTR 774[rsp], ax
+	.loc 1 560 61
+	mov	eax, DWORD PTR 900[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rdx, rax
+	.loc 1 560 20
+	movzx	eax, WORD PTR 774[rsp]
+	mov	WORD PTR -74[rsp], ax
+	mov	QWORD PTR -88[rsp], rdx
+.LBB1302:
+.LBB1303:
+	.loc 6 6349 19
+	movzx	edx, WORD PTR -74[rsp]
+.LBB1304:
+.LBB1305:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1305:
+.LBE1304:
+	.loc 6 6349 19
+	mov	rax, QWORD PTR -88[rsp]
+	kmovw	k2, edx
+	vmovups	zmm0{k2}, ZMMWORD PTR [rax]
+	.loc 6 6349 10
+	nop
+.LBE1303:
+.LBE1302:
+	.loc 1 560 20
+	vmovaps	ZMMWORD PTR 648[rsp], zmm0
+	.loc 1 561 66
+	mov	eax, DWORD PTR 900[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rsp]
+	add	rdx, rax
+	.loc 1 561 13
+	movzx	eax, WORD PTR 774[rsp]
+	mov	WORD PTR -58[rsp], ax
+	mov	QWORD PTR -72[rsp], rdx
+.LBB1306:
+.LBB1307:
+	.loc 6 6349 19
+	movzx	edx, WORD PTR -58[rsp]
+.LBB1308:
+.LBB1309:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1309:
+.LBE1308:
+	.loc 6 6349 19
+	mov	rax, QWORD PTR -72[rsp]
+	kmovw	k3, edx
+	vmovups	zmm0{k3}, ZMMWORD PTR [rax]
+	.loc 6 6349 10
+	nop
+	vmovaps	zmm1, ZMMWORD PTR 776[rsp]
+	vmovaps	ZMMWORD PTR 72[rsp], zmm1
+	vmovaps	ZMMWORD PTR 8[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 648[rsp]
+	vmovaps	ZMMWORD PTR -56[rsp], zmm0
+.LBE1307:
+.LBE1306:
+.LBB1310:
+.LBB1311:
+	.loc 6 13368 19
+	vmovaps	zmm0, ZMMWORD PTR 72[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 8[rsp]
+	vmovaps	zmm1, ZMMWORD PTR -56[rsp]
+	mov	eax, -1
+	kmovw	k4, eax
+	vfmadd132ps	zmm0{k4}, zmm1, zmm2
+	.loc 6 13368 10
+	nop
+.LBE1311:
+.LBE1310:
+	.loc 1 561 13
+	vmovaps	ZMMWORD PTR 648[rsp], zmm0
+	.loc 1 562 9
+	movzx	eax, WORD PTR 774[rsp]
+	.loc 1 562 44
+	mov	edx, DWORD PTR 900[rsp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -96[rsp]
+	add	rdx, rcx
+	mov	QWORD PTR 240[rsp], rdx
+	mov	WORD PTR 238[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 648[rsp]
+	vmovaps	ZMMWORD PTR 136[rsp], zmm0
+.LBB1312:
+.LBB1313:
+	.loc 6 6366 3
+	movzx	edx, WORD PTR 238[rsp]
+	mov	rax, QWORD PTR 240[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 136[rsp]
+	kmovw	k5, edx
+	vmovups	ZMMWORD PTR [rax]{k5}, zmm0
+	.loc 6 6368 1
+	nop
+.L353:
+.LBE1313:
+.LBE1312:
+.LBE1301:
+	.loc 1 564 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4855:
+	.size	lmsKernel_UpdateAvx512, .-lmsKernel_UpdateAvx512
+	.type	lmsKernel_UpdateDotAvx512, @function
+lmsKernel_UpdateDotAvx512:
+.LFB4856:
+	.loc 1 569 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -64
+	sub	rsp, 3400
+	mov	QWORD PTR -80[rsp], rdi
+	mov	QWORD PTR -88[rsp], rsi
+	mov	QWORD PTR -96[rsp], rdx
+	vmovss	DWORD PTR -100[rsp], xmm0
+	mov	DWORD PTR -104[rsp], ecx
+	vmovss	xmm0, DWORD PTR -100[rsp]
+	vmovss	DWORD PTR 2820[rsp], xmm0
+.LBB1314:
+.LBB1315:
+	.loc 6 250 24
+	vbroadcastss	zmm0, DWORD PTR 2820[rsp]
+.LBE1315:
+.LBE1314:
+	.loc 1 570 22
+	vmovaps	ZMMWORD PTR 3144[rsp], zmm0
+.LBB1316:
+.LBB1317:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1317:
+.LBE1316:
+	.loc 1 571 19
+	vmovaps	ZMMWORD PTR 3336[rsp], zmm0
+.LBB1318:
+.LBB1319:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1319:
+.LBE1318:
+	.loc 1 572 19
+	vmovaps	ZMMWORD PTR 3272[rsp], zmm0
+	.loc 1 573 9
+	mov	DWORD PTR 3268[rsp], 0
+	.loc 1 575 5
+	jmp	.L358
+.L369:
+.LBB1320:
+	.loc 1 577 50 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1584[rsp], rax
+.LBB1321:
+.LBB1322:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1584[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+.LBE1322:
+.LBE1321:
+	.loc 1 577 21 discriminator 2
+	vmovaps	ZMMWORD PTR 2888[rsp], zmm0
+	.loc 1 578 54 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1592[rsp], rax
+.LBB1323:
+.LBB1324:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1592[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+.LBE1324:
+.LBE1323:
+	.loc 1 578 21 discriminator 2
+	vmovaps	ZMMWORD PTR 2824[rsp], zmm0
+	.loc 1 579 58 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1600[rsp], rax
+.LBB1325:
+.LBB1326:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1600[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3144[rsp]
+	vmovaps	ZMMWORD PTR 1736[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1672[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 2888[rsp]
+	vmovaps	ZMMWORD PTR 1608[rsp], zmm0
+.LBE1326:
+.LBE1325:
+.LBB1327:
+.LBB1328:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1736[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1672[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1608[rsp]
+	mov	eax, -1
+	kmovw	k1, eax
+	vfmadd132ps	zmm0{k1}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1328:
+.LBE1327:
+	.loc 1 579 14 discriminator 2
+	vmovaps	ZMMWORD PTR 2888[rsp], zmm0
+	.loc 1 580 62 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1856[rsp], rax
+.LBB1329:
+.LBB1330:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1856[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3144[rsp]
+	vmovaps	ZMMWORD PTR 1992[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1928[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 2824[rsp]
+	vmovaps	ZMMWORD PTR 1864[rsp], zmm0
+.LBE1330:
+.LBE1329:
+.LBB1331:
+.LBB1332:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1992[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1928[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1864[rsp]
+	mov	eax, -1
+	kmovw	k2, eax
+	vfmadd132ps	zmm0{k2}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1332:
+.LBE1331:
+	.loc 1 580 14 discriminator 2
+	vmovaps	ZMMWORD PTR 2824[rsp], zmm0
+	.loc 1 581 39 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2176[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 2888[rsp]
+	vmovaps	ZMMWORD PTR 2056[rsp], zmm0
+.LBB1333:
+.LBB1334:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2056[rsp]
+	mov	rax, QWORD PTR 2176[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1334:
+.LBE1333:
+	.loc 1 582 43 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2296[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 2824[rsp]
+	vmovaps	ZMMWORD PTR 2184[rsp], zmm0
+.LBB1335:
+.LBB1336:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2184[rsp]
+	mov	rax, QWORD PTR 2296[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1336:
+.LBE1335:
+	.loc 1 583 60 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2304[rsp], rax
+.LBB1337:
+.LBB1338:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 2304[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2888[rsp]
+	vmovaps	ZMMWORD PTR 2440[rsp], zmm0
+	vmovaps	ZMMWORD PTR 2376[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 3336[rsp]
+	vmovaps	ZMMWORD PTR 2312[rsp], zmm0
+.LBE1338:
+.LBE1337:
+.LBB1339:
+.LBB1340:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2440[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 2376[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 2312[rsp]
+	mov	eax, -1
+	kmovw	k3, eax
+	vfmadd132ps	zmm0{k3}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1340:
+.LBE1339:
+	.loc 1 583 16 discriminator 2
+	vmovaps	ZMMWORD PTR 3336[rsp], zmm0
+	.loc 1 584 64 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2560[rsp], rax
+.LBB1341:
+.LBB1342:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 2560[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2824[rsp]
+	vmovaps	ZMMWORD PTR 2696[rsp], zmm0
+	vmovaps	ZMMWORD PTR 2632[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 3272[rsp]
+	vmovaps	ZMMWORD PTR 2568[rsp], zmm0
+.LBE1342:
+.LBE1341:
+.LBB1343:
+.LBB1344:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2696[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 2632[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 2568[rsp]
+	mov	eax, -1
+	kmovw	k4, eax
+	vfmadd132ps	zmm0{k4}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1344:
+.LBE1343:
+	.loc 1 584 16 discriminator 2
+	vmovaps	ZMMWORD PTR 3272[rsp], zmm0
+.LBE1320:
+	.loc 1 575 32 discriminator 2
+	add	DWORD PTR 3268[rsp], 32
+.L358:
+	.loc 1 575 19 discriminator 1
+	mov	eax, DWORD PTR 3268[rsp]
+	add	eax, 31
+	cmp	DWORD PTR -104[rsp], eax
+	jg	.L369
+	.loc 1 586 5
+	jmp	.L370
+.L376:
+.LBB1345:
+	.loc 1 588 49 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1016[rsp], rax
+.LBB1346:
+.LBB1347:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1016[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+.LBE1347:
+.LBE1346:
+	.loc 1 588 20 discriminator 2
+	vmovaps	ZMMWORD PTR 2952[rsp], zmm0
+	.loc 1 589 57 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1024[rsp], rax
+.LBB1348:
+.LBB1349:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1024[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3144[rsp]
+	vmovaps	ZMMWORD PTR 1160[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1096[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 2952[rsp]
+	vmovaps	ZMMWORD PTR 1032[rsp], zmm0
+.LBE1349:
+.LBE1348:
+.LBB1350:
+.LBB1351:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1160[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1096[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1032[rsp]
+	mov	eax, -1
+	kmovw	k5, eax
+	vfmadd132ps	zmm0{k5}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1351:
+.LBE1350:
+	.loc 1 589 13 discriminator 2
+	vmovaps	ZMMWORD PTR 2952[rsp], zmm0
+	.loc 1 590 39 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1336[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 2952[rsp]
+	vmovaps	ZMMWORD PTR 1224[rsp], zmm0
+.LBB1352:
+.LBB1353:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1224[rsp]
+	mov	rax, QWORD PTR 1336[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1353:
+.LBE1352:
+	.loc 1 591 59 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1344[rsp], rax
+.LBB1354:
+.LBB1355:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1344[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2952[rsp]
+	vmovaps	ZMMWORD PTR 1480[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1416[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 3336[rsp]
+	vmovaps	ZMMWORD PTR 1352[rsp], zmm0
+.LBE1355:
+.LBE1354:
+.LBB1356:
+.LBB1357:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1480[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1416[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1352[rsp]
+	mov	eax, -1
+	kmovw	k6, eax
+	vfmadd132ps	zmm0{k6}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1357:
+.LBE1356:
+	.loc 1 591 16 discriminator 2
+	vmovaps	ZMMWORD PTR 3336[rsp], zmm0
+.LBE1345:
+	.loc 1 586 32 discriminator 2
+	add	DWORD PTR 3268[rsp], 16
+.L370:
+	.loc 1 586 19 discriminator 1
+	mov	eax, DWORD PTR 3268[rsp]
+	add	eax, 15
+	cmp	DWORD PTR -104[rsp], eax
+	jg	.L376
+	.loc 1 593 8
+	mov	eax, DWORD PTR 3268[rsp]
+	cmp	eax, DWORD PTR -104[rsp]
+	jge	.L377
+.LBB1358:
+	.loc 1 595 53
+	mov	eax, DWORD PTR -104[rsp]
+	sub	eax, DWORD PTR 3268[rsp]
+	.loc 1 595 42
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	.loc 1 595 19
+	sub	eax, 1
+	mov	WORD PTR 3142[rsp], ax
+	.loc 1 596 61
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rdx, rax
+	.loc 1 596 20
+	movzx	eax, WORD PTR 3142[rsp]
+	mov	WORD PTR 438[rsp], ax
+	mov	QWORD PTR 424[rsp], rdx
+.LBB1359:
+.LBB1360:
+	.loc 6 6349 19
+	movzx	edx, WORD PTR 438[rsp]
+.LBB1361:
+.LBB1362:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1362:
+.LBE1361:
+	.loc 6 6349 19
+	mov	rax, QWORD PTR 424[rsp]
+	kmovw	k7, edx
+	vmovups	zmm0{k7}, ZMMWORD PTR [rax]
+	.loc 6 6349 10
+	nop
+.LBE1360:
+.LBE1359:
+	.loc 1 596 20
+	vmovaps	ZMMWORD PTR 3016[rsp], zmm0
+	.loc 1 597 69
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rdx, rax
+	.loc 1 597 13
+	movzx	eax, WORD PTR 3142[rsp]
+	mov	WORD PTR 454[rsp], ax
+	mov	QWORD PTR 440[rsp], rdx
+.LBB1363:
+.LBB1364:
+	.loc 6 6349 19
+	movzx	edx, WORD PTR 454[rsp]
+.LBB1365:
+.LBB1366:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1366:
+.LBE1365:
+	.loc 6 6349 19
+	mov	rax, QWORD PTR 440[rsp]
+	kmovw	k1, edx
+	vmovups	zmm0{k1}, ZMMWORD PTR [rax]
+	.loc 6 6349 10
+	nop
+	vmovaps	zmm1, ZMMWORD PTR 3144[rsp]
+	vmovaps	ZMMWORD PTR 584[rsp], zmm1
+	vmovaps	ZMMWORD PTR 520[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3016[rsp]
+	vmovaps	ZMMWORD PTR 456[rsp], zmm0
+.LBE1364:
+.LBE1363:
+.LBB1367:
+.LBB1368:
+	.loc 6 13368 19
+	vmovaps	zmm0, ZMMWORD PTR 584[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 520[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 456[rsp]
+	mov	eax, -1
+	kmovw	k2, eax
+	vfmadd132ps	zmm0{k2}, zmm1, zmm2
+	.loc 6 13368 10
+	nop
+.LBE1368:
+.LBE1367:
+	.loc 1 597 13
+	vmovaps	ZMMWORD PTR 3016[rsp], zmm0
+	.loc 1 598 9
+	movzx	eax, WORD PTR 3142[rsp]
+	.loc 1 598 44
+	mov	edx, DWORD PTR 3268[rsp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -80[rsp]
+	add	rdx, rcx
+	mov	QWORD PTR 752[rsp], rdx
+	mov	WORD PTR 750[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 3016[rsp]
+	vmovaps	ZMMWORD PTR 648[rsp], zmm0
+.LBB1369:
+.LBB1370:
+	.loc 6 6366 3
+	movzx	edx, WORD PTR 750[rsp]
+	mov	rax, QWORD PTR 752[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 648[rsp]
+	kmovw	k3, edx
+	vmovups	ZMMWORD PTR [rax]{k3}, zmm0
+	.loc 6 6368 1
+	nop
+.LBE1370:
+.LBE1369:
+	.loc 1 599 71
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rdx, rax
+	.loc 1 599 16
+	movzx	eax, WORD PTR 3142[rsp]
+	mov	WORD PTR 774[rsp], ax
+	mov	QWORD PTR 760[rsp], rdx
+.LBB1371:
+.LBB1372:
+	.loc 6 6349 19
+	movzx	edx, WORD PTR 774[rsp]
+.LBB1373:
+.LBB1374:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1374:
+.LBE1373:
+	.loc 6 6349 19
+	mov	rax, QWORD PTR 760[rsp]
+	kmovw	k4, edx
+	vmovups	zmm0{k4}, ZMMWORD PTR [rax]
+	.loc 6 6349 10
+	nop
+	vmovaps	zmm1, ZMMWORD PTR 3016[rsp]
+	vmovaps	ZMMWORD PTR 904[rsp], zmm1
+	vmovaps	ZMMWORD PTR 840[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3272[rsp]
+	vmovaps	ZMMWORD PTR 776[rsp], zmm0
+.LBE1372:
+.LBE1371:
+.LBB1375:
+.LBB1376:
+	.loc 6 13368 19
+	vmovaps	zmm0, ZMMWORD PTR 904[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 840[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 776[rsp]
+	mov	eax, -1
+	kmovw	k5, eax
+	vfmadd132ps	zmm0{k5}, zmm1, zmm2
+	.loc 6 13368 10
+	nop
+.LBE1376:
+.LBE1375:
+	.loc 1 599 16
+	vmovaps	ZMMWORD PTR 3272[rsp], zmm0
+.L377:
+	vmovaps	zmm0, ZMMWORD PTR 3336[rsp]
+	vmovaps	ZMMWORD PTR 8[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3272[rsp]
+	vmovaps	ZMMWORD PTR -56[rsp], zmm0
+.LBE1358:
+.LBB1377:
+.LBB1378:
+	.loc 6 12600 10
+	vmovaps	zmm0, ZMMWORD PTR 8[rsp]
+	vaddps	zmm0, zmm0, ZMMWORD PTR -56[rsp]
+	vmovaps	ZMMWORD PTR 328[rsp], zmm0
+.LBE1378:
+.LBE1377:
+.LBB1379:
+.LBB1380:
+.LBB1381:
+.LBB1382:
+	.loc 3 1211 10
+	vmovapd	ymm1, YMMWORD PTR 296[rsp]
+.LBE1382:
+.LBE1381:
+	.loc 6 16169 3
+	vmovapd	zmm0, ZMMWORD PTR 328[rsp]
+	mov	eax, -1
+	kmovw	k6, eax
+	vextractf64x4	ymm1{k6}, zmm0, 0x1
+	vmovapd	YMMWORD PTR 264[rsp], ymm1
+.LBB1383:
+.LBB1384:
+	.loc 3 1211 10
+	vmovapd	ymm1, YMMWORD PTR 232[rsp]
+.LBE1384:
+.LBE1383:
+	.loc 6 16169 3
+	vmovapd	zmm0, ZMMWORD PTR 328[rsp]
+	mov	eax, -1
+	kmovw	k7, eax
+	vextractf64x4	ymm1{k7}, zmm0, 0x0
+	vmovapd	YMMWORD PTR 200[rsp], ymm1
+	vmovaps	ymm0, YMMWORD PTR 264[rsp]
+	vaddps	ymm0, ymm0, YMMWORD PTR 200[rsp]
+	vmovaps	YMMWORD PTR 168[rsp], ymm0
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vextractf128	XMMWORD PTR 152[rsp], ymm0, 0x1
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vmovaps	XMMWORD PTR 136[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 136[rsp]
+	vmovaps	XMMWORD PTR 120[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vpermilps	xmm0, xmm0, 78
+	vmovaps	XMMWORD PTR 104[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 104[rsp]
+	vmovaps	XMMWORD PTR -72[rsp], xmm0
+	vmovss	xmm1, DWORD PTR -72[rsp]
+	vmovss	xmm0, DWORD PTR -68[rsp]
+	vaddss	xmm0, xmm1, xmm0
+.LBE1380:
+.LBE1379:
+	.loc 1 602 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4856:
+	.size	lmsKernel_UpdateDotAvx512, .-lmsKernel_UpdateDotAvx512
+	.type	lmsKernel_LeakyUpdateDotAvx512, @function
+lmsKernel_LeakyUpdateDotAvx512:
+.LFB4857:
+	.loc 1 607 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -64
+	sub	rsp, 3400
+	mov	QWORD PTR -80[rsp], rdi
+	mov	QWORD PTR -88[rsp], rsi
+	mov	QWORD PTR -96[rsp], rdx
+	vmovss	DWORD PTR -100[rsp], xmm0
+	vmovss	DWORD PTR -104[rsp], xmm1
+	mov	DWORD PTR -108[rsp], ecx
+	vmovss	xmm0, DWORD PTR -100[rsp]
+	vmovss	DWORD PTR 2816[rsp], xmm0
+.LBB1385:
+.LBB1386:
+	.loc 6 250 24
+	vbroadcastss	zmm0, DWORD PTR 2816[rsp]
+.LBE1386:
+.LBE1385:
+	.loc 1 608 22
+	vmovaps	ZMMWORD PTR 3144[rsp], zmm0
+	vmovss	xmm0, DWORD PTR -104[rsp]
+	vmovss	DWORD PTR 2820[rsp], xmm0
+.LBB1387:
+.LBB1388:
+	.loc 6 250 24
+	vbroadcastss	zmm0, DWORD PTR 2820[rsp]
+.LBE1388:
+.LBE1387:
+	.loc 1 609 22
+	vmovaps	ZMMWORD PTR 3080[rsp], zmm0
+.LBB1389:
+.LBB1390:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1390:
+.LBE1389:
+	.loc 1 610 19
+	vmovaps	ZMMWORD PTR 3336[rsp], zmm0
+.LBB1391:
+.LBB1392:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1392:
+.LBE1391:
+	.loc 1 611 19
+	vmovaps	ZMMWORD PTR 3272[rsp], zmm0
+	.loc 1 612 9
+	mov	DWORD PTR 3268[rsp], 0
+	.loc 1 614 5
+	jmp	.L396
+.L409:
+.LBB1393:
+	.loc 1 616 67 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1216[rsp], rax
+.LBB1394:
+.LBB1395:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1216[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3080[rsp]
+	vmovaps	ZMMWORD PTR 1288[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1224[rsp], zmm1
+.LBE1395:
+.LBE1394:
+.LBB1396:
+.LBB1397:
+	.loc 6 12812 10 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1288[rsp]
+	vmulps	zmm0, zmm0, ZMMWORD PTR 1224[rsp]
+.LBE1397:
+.LBE1396:
+	.loc 1 616 21 discriminator 2
+	vmovaps	ZMMWORD PTR 2888[rsp], zmm0
+	.loc 1 617 71 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1408[rsp], rax
+.LBB1398:
+.LBB1399:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1408[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3080[rsp]
+	vmovaps	ZMMWORD PTR 1480[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1416[rsp], zmm1
+.LBE1399:
+.LBE1398:
+.LBB1400:
+.LBB1401:
+	.loc 6 12812 10 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1480[rsp]
+	vmulps	zmm0, zmm0, ZMMWORD PTR 1416[rsp]
+.LBE1401:
+.LBE1400:
+	.loc 1 617 21 discriminator 2
+	vmovaps	ZMMWORD PTR 2824[rsp], zmm0
+	.loc 1 618 58 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1600[rsp], rax
+.LBB1402:
+.LBB1403:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1600[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3144[rsp]
+	vmovaps	ZMMWORD PTR 1736[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1672[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 2888[rsp]
+	vmovaps	ZMMWORD PTR 1608[rsp], zmm0
+.LBE1403:
+.LBE1402:
+.LBB1404:
+.LBB1405:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1736[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1672[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1608[rsp]
+	mov	eax, -1
+	kmovw	k1, eax
+	vfmadd132ps	zmm0{k1}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1405:
+.LBE1404:
+	.loc 1 618 14 discriminator 2
+	vmovaps	ZMMWORD PTR 2888[rsp], zmm0
+	.loc 1 619 62 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1856[rsp], rax
+.LBB1406:
+.LBB1407:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1856[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3144[rsp]
+	vmovaps	ZMMWORD PTR 1992[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1928[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 2824[rsp]
+	vmovaps	ZMMWORD PTR 1864[rsp], zmm0
+.LBE1407:
+.LBE1406:
+.LBB1408:
+.LBB1409:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1992[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1928[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1864[rsp]
+	mov	eax, -1
+	kmovw	k2, eax
+	vfmadd132ps	zmm0{k2}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1409:
+.LBE1408:
+	.loc 1 619 14 discriminator 2
+	vmovaps	ZMMWORD PTR 2824[rsp], zmm0
+	.loc 1 620 39 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2176[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 2888[rsp]
+	vmovaps	ZMMWORD PTR 2056[rsp], zmm0
+.LBB1410:
+.LBB1411:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2056[rsp]
+	mov	rax, QWORD PTR 2176[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1411:
+.LBE1410:
+	.loc 1 621 43 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2296[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 2824[rsp]
+	vmovaps	ZMMWORD PTR 2184[rsp], zmm0
+.LBB1412:
+.LBB1413:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2184[rsp]
+	mov	rax, QWORD PTR 2296[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1413:
+.LBE1412:
+	.loc 1 622 60 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2304[rsp], rax
+.LBB1414:
+.LBB1415:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 2304[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2888[rsp]
+	vmovaps	ZMMWORD PTR 2440[rsp], zmm0
+	vmovaps	ZMMWORD PTR 2376[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 3336[rsp]
+	vmovaps	ZMMWORD PTR 2312[rsp], zmm0
+.LBE1415:
+.LBE1414:
+.LBB1416:
+.LBB1417:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2440[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 2376[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 2312[rsp]
+	mov	eax, -1
+	kmovw	k3, eax
+	vfmadd132ps	zmm0{k3}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1417:
+.LBE1416:
+	.loc 1 622 16 discriminator 2
+	vmovaps	ZMMWORD PTR 3336[rsp], zmm0
+	.loc 1 623 64 discriminator 2
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2560[rsp], rax
+.LBB1418:
+.LBB1419:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 2560[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2824[rsp]
+	vmovaps	ZMMWORD PTR 2696[rsp], zmm0
+	vmovaps	ZMMWORD PTR 2632[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 3272[rsp]
+	vmovaps	ZMMWORD PTR 2568[rsp], zmm0
+.LBE1419:
+.LBE1418:
+.LBB1420:
+.LBB1421:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2696[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 2632[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 2568[rsp]
+	mov	eax, -1
+	kmovw	k4, eax
+	vfmadd132ps	zmm0{k4}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1421:
+.LBE1420:
+	.loc 1 623 16 discriminator 2
+	vmovaps	ZMMWORD PTR 3272[rsp], zmm0
+.LBE1393:
+	.loc 1 614 32 discriminator 2
+	add	DWORD PTR 3268[rsp], 32
+.L396:
+	.loc 1 614 19 discriminator 1
+	mov	eax, DWORD PTR 3268[rsp]
+	add	eax, 31
+	cmp	DWORD PTR -108[rsp], eax
+	jg	.L409
+	.loc 1 625 5
+	jmp	.L410
+.L422:
+.LBB1422:
+	.loc 1 628 34
+	mov	eax, DWORD PTR -108[rsp]
+	sub	eax, DWORD PTR 3268[rsp]
+	.loc 1 628 19
+	cmp	eax, 15
+	jg	.L411
+	.loc 1 628 94 discriminator 1
+	mov	eax, DWORD PTR -108[rsp]
+	sub	eax, DWORD PTR 3268[rsp]
+	.loc 1 628 83 discriminator 1
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	.loc 1 628 19 discriminator 1
+	sub	eax, 1
+	jmp	.L412
+.L411:
+	.loc 1 628 19 is_stmt 0 discriminator 2
+	mov	eax, -1
+.L412:
+	.loc 1 628 19 discriminator 4
+	mov	WORD PTR 3078[rsp], ax
+	.loc 1 629 78 is_stmt 1 discriminator 4
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rdx, rax
+	.loc 1 629 20 discriminator 4
+	movzx	eax, WORD PTR 3078[rsp]
+	mov	WORD PTR 454[rsp], ax
+	mov	QWORD PTR 440[rsp], rdx
+.LBB1423:
+.LBB1424:
+	.loc 6 6349 19 discriminator 4
+	movzx	edx, WORD PTR 454[rsp]
+.LBB1425:
+.LBB1426:
+	.loc 6 307 10 discriminator 4
+	vxorps	xmm0, xmm0, xmm0
+.LBE1426:
+.LBE1425:
+	.loc 6 6349 19 discriminator 4
+	mov	rax, QWORD PTR 440[rsp]
+	kmovw	k5, edx
+	vmovups	zmm0{k5}, ZMMWORD PTR [rax]
+	.loc 6 6349 10 discriminator 4
+	nop
+	vmovaps	zmm1, ZMMWORD PTR 3080[rsp]
+	vmovaps	ZMMWORD PTR 520[rsp], zmm1
+	vmovaps	ZMMWORD PTR 456[rsp], zmm0
+.LBE1424:
+.LBE1423:
+.LBB1427:
+.LBB1428:
+	.loc 6 12812 10 discriminator 4
+	vmovaps	zmm0, ZMMWORD PTR 520[rsp]
+	vmulps	zmm0, zmm0, ZMMWORD PTR 456[rsp]
+.LBE1428:
+.LBE1427:
+	.loc 1 629 20 discriminator 4
+	vmovaps	ZMMWORD PTR 2952[rsp], zmm0
+	.loc 1 630 69 discriminator 4
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rdx, rax
+	.loc 1 630 13 discriminator 4
+	movzx	eax, WORD PTR 3078[rsp]
+	mov	WORD PTR 646[rsp], ax
+	mov	QWORD PTR 632[rsp], rdx
+.LBB1429:
+.LBB1430:
+	.loc 6 6349 19 discriminator 4
+	movzx	edx, WORD PTR 646[rsp]
+.LBB1431:
+.LBB1432:
+	.loc 6 307 10 discriminator 4
+	vxorps	xmm0, xmm0, xmm0
+.LBE1432:
+.LBE1431:
+	.loc 6 6349 19 discriminator 4
+	mov	rax, QWORD PTR 632[rsp]
+	kmovw	k6, edx
+	vmovups	zmm0{k6}, ZMMWORD PTR [rax]
+	.loc 6 6349 10 discriminator 4
+	nop
+	vmovaps	zmm1, ZMMWORD PTR 3144[rsp]
+	vmovaps	ZMMWORD PTR 776[rsp], zmm1
+	vmovaps	ZMMWORD PTR 712[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2952[rsp]
+	vmovaps	ZMMWORD PTR 648[rsp], zmm0
+.LBE1430:
+.LBE1429:
+.LBB1433:
+.LBB1434:
+	.loc 6 13368 19 discriminator 4
+	vmovaps	zmm0, ZMMWORD PTR 776[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 712[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 648[rsp]
+	mov	eax, -1
+	kmovw	k7, eax
+	vfmadd132ps	zmm0{k7}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 4
+	nop
+.LBE1434:
+.LBE1433:
+	.loc 1 630 13 discriminator 4
+	vmovaps	ZMMWORD PTR 2952[rsp], zmm0
+	.loc 1 631 9 discriminator 4
+	movzx	eax, WORD PTR 3078[rsp]
+	.loc 1 631 44 discriminator 4
+	mov	edx, DWORD PTR 3268[rsp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -80[rsp]
+	add	rdx, rcx
+	mov	QWORD PTR 944[rsp], rdx
+	mov	WORD PTR 942[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 2952[rsp]
+	vmovaps	ZMMWORD PTR 840[rsp], zmm0
+.LBB1435:
+.LBB1436:
+	.loc 6 6366 3 discriminator 4
+	movzx	edx, WORD PTR 942[rsp]
+	mov	rax, QWORD PTR 944[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 840[rsp]
+	kmovw	k1, edx
+	vmovups	ZMMWORD PTR [rax]{k1}, zmm0
+	.loc 6 6368 1 discriminator 4
+	nop
+.LBE1436:
+.LBE1435:
+	.loc 1 632 71 discriminator 4
+	mov	eax, DWORD PTR 3268[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rdx, rax
+	.loc 1 632 16 discriminator 4
+	movzx	eax, WORD PTR 3078[rsp]
+	mov	WORD PTR 966[rsp], ax
+	mov	QWORD PTR 952[rsp], rdx
+.LBB1437:
+.LBB1438:
+	.loc 6 6349 19 discriminator 4
+	movzx	edx, WORD PTR 966[rsp]
+.LBB1439:
+.LBB1440:
+	.loc 6 307 10 discriminator 4
+	vxorps	xmm0, xmm0, xmm0
+.LBE1440:
+.LBE1439:
+	.loc 6 6349 19 discriminator 4
+	mov	rax, QWORD PTR 952[rsp]
+	kmovw	k2, edx
+	vmovups	zmm0{k2}, ZMMWORD PTR [rax]
+	.loc 6 6349 10 discriminator 4
+	nop
+	vmovaps	zmm1, ZMMWORD PTR 2952[rsp]
+	vmovaps	ZMMWORD PTR 1096[rsp], zmm1
+	vmovaps	ZMMWORD PTR 1032[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3336[rsp]
+	vmovaps	ZMMWORD PTR 968[rsp], zmm0
+.LBE1438:
+.LBE1437:
+.LBB1441:
+.LBB1442:
+	.loc 6 13368 19 discriminator 4
+	vmovaps	zmm0, ZMMWORD PTR 1096[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1032[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 968[rsp]
+	mov	eax, -1
+	kmovw	k3, eax
+	vfmadd132ps	zmm0{k3}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 4
+	nop
+.LBE1442:
+.LBE1441:
+	.loc 1 632 16 discriminator 4
+	vmovaps	ZMMWORD PTR 3336[rsp], zmm0
+.LBE1422:
+	.loc 1 625 26 discriminator 4
+	add	DWORD PTR 3268[rsp], 16
+.L410:
+	.loc 1 625 14 discriminator 1
+	mov	eax, DWORD PTR 3268[rsp]
+	cmp	eax, DWORD PTR -108[rsp]
+	jl	.L422
+	vmovaps	zmm0, ZMMWORD PTR 3336[rsp]
+	vmovaps	ZMMWORD PTR 8[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3272[rsp]
+	vmovaps	ZMMWORD PTR -56[rsp], zmm0
+.LBB1443:
+.LBB1444:
+	.loc 6 12600 10
+	vmovaps	zmm0, ZMMWORD PTR 8[rsp]
+	vaddps	zmm0, zmm0, ZMMWORD PTR -56[rsp]
+	vmovaps	ZMMWORD PTR 328[rsp], zmm0
+.LBE1444:
+.LBE1443:
+.LBB1445:
+.LBB1446:
+.LBB1447:
+.LBB1448:
+	.loc 3 1211 10
+	vmovapd	ymm1, YMMWORD PTR 296[rsp]
+.LBE1448:
+.LBE1447:
+	.loc 6 16169 3
+	vmovapd	zmm0, ZMMWORD PTR 328[rsp]
+	mov	eax, -1
+	kmovw	k4, eax
+	vextractf64x4	ymm1{k4}, zmm0, 0x1
+	vmovapd	YMMWORD PTR 264[rsp], ymm1
+.LBB1449:
+.LBB1450:
+	.loc 3 1211 10
+	vmovapd	ymm1, YMMWORD PTR 232[rsp]
+.LBE1450:
+.LBE1449:
+	.loc 6 16169 3
+	vmovapd	zmm0, ZMMWORD PTR 328[rsp]
+	mov	eax, -1
+	kmovw	k5, eax
+	vextractf64x4	ymm1{k5}, zmm0, 0x0
+	vmovapd	YMMWORD PTR 200[rsp], ymm1
+	vmovaps	ymm0, YMMWORD PTR 264[rsp]
+	vaddps	ymm0, ymm0, YMMWORD PTR 200[rsp]
+	vmovaps	YMMWORD PTR 168[rsp], ymm0
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vextractf128	XMMWORD PTR 152[rsp], ymm0, 0x1
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vmovaps	XMMWORD PTR 136[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 136[rsp]
+	vmovaps	XMMWORD PTR 120[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vpermilps	xmm0, xmm0, 78
+	vmovaps	XMMWORD PTR 104[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 104[rsp]
+	vmovaps	XMMWORD PTR -72[rsp], xmm0
+	vmovss	xmm1, DWORD PTR -72[rsp]
+	vmovss	xmm0, DWORD PTR -68[rsp]
+	vaddss	xmm0, xmm1, xmm0
+.LBE1446:
+.LBE1445:
+	.loc 1 635 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4857:
+	.size	lmsKernel_LeakyUpdateDotAvx512, .-lmsKernel_LeakyUpdateDotAvx512
+	.type	lmsKernel_SignUpdateDotAvx512, @function
+lmsKernel_SignUpdateDotAvx512:
+.LFB4858:
+	.loc 1 640 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -64
+	sub	rsp, 4360
+	mov	QWORD PTR -80[rsp], rdi
+	mov	QWORD PTR -88[rsp], rsi
+	mov	QWORD PTR -96[rsp], rdx
+	vmovss	DWORD PTR -100[rsp], xmm0
+	mov	DWORD PTR -104[rsp], ecx
+	vmovss	xmm0, DWORD PTR -100[rsp]
+	vmovss	DWORD PTR 3328[rsp], xmm0
+.LBB1451:
+.LBB1452:
+	.loc 6 250 24
+	vbroadcastss	zmm0, DWORD PTR 3328[rsp]
+.LBE1452:
+.LBE1451:
+	.loc 1 641 22
+	vmovaps	ZMMWORD PTR 4104[rsp], zmm0
+	.loc 1 642 33
+	vmovss	xmm0, DWORD PTR -100[rsp]
+	vmovss	xmm1, DWORD PTR .LC1[rip]
+	vxorps	xmm0, xmm0, xmm1
+	vmovss	DWORD PTR 3332[rsp], xmm0
+.LBB1453:
+.LBB1454:
+	.loc 6 250 24
+	vbroadcastss	zmm0, DWORD PTR 3332[rsp]
+.LBE1454:
+.LBE1453:
+	.loc 1 642 33
+	vmovaps	ZMMWORD PTR 4040[rsp], zmm0
+.LBB1455:
+.LBB1456:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1456:
+.LBE1455:
+	.loc 1 643 25
+	vmovaps	ZMMWORD PTR 3976[rsp], zmm0
+.LBB1457:
+.LBB1458:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1458:
+.LBE1457:
+	.loc 1 644 19
+	vmovaps	ZMMWORD PTR 4296[rsp], zmm0
+.LBB1459:
+.LBB1460:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1460:
+.LBE1459:
+	.loc 1 645 19
+	vmovaps	ZMMWORD PTR 4232[rsp], zmm0
+	.loc 1 646 9
+	mov	DWORD PTR 4228[rsp], 0
+	.loc 1 648 5
+	jmp	.L434
+.L449:
+.LBB1461:
+	.loc 1 650 52 discriminator 2
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1400[rsp], rax
+.LBB1462:
+.LBB1463:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1400[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+.LBE1463:
+.LBE1462:
+	.loc 1 650 27 discriminator 2
+	vmovaps	ZMMWORD PTR 3656[rsp], zmm0
+	.loc 1 651 56 discriminator 2
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1408[rsp], rax
+.LBB1464:
+.LBB1465:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1408[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+.LBE1465:
+.LBE1464:
+	.loc 1 651 27 discriminator 2
+	vmovaps	ZMMWORD PTR 3592[rsp], zmm0
+	.loc 1 652 49 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 3656[rsp]
+	mov	eax, -1
+	kmovw	k1, eax
+	vcmpps	k0{k1}, zmm0, ZMMWORD PTR 3976[rsp], 30
+	kmovw	eax, k0
+	.loc 1 652 24 discriminator 2
+	movzx	eax, ax
+	vmovaps	zmm0, ZMMWORD PTR 3976[rsp]
+	vmovaps	ZMMWORD PTR 1544[rsp], zmm0
+	mov	WORD PTR 1542[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 4104[rsp]
+	vmovaps	ZMMWORD PTR 1416[rsp], zmm0
+.LBB1466:
+.LBB1467:
+	.loc 6 362 19 discriminator 2
+	movzx	eax, WORD PTR 1542[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 1544[rsp]
+	kmovw	k2, eax
+	vmovaps	zmm0{k2}, ZMMWORD PTR 1416[rsp]
+	.loc 6 362 10 discriminator 2
+	nop
+.LBE1467:
+.LBE1466:
+	.loc 1 652 24 discriminator 2
+	vmovaps	ZMMWORD PTR 3528[rsp], zmm0
+	.loc 1 653 49 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 3592[rsp]
+	mov	eax, -1
+	kmovw	k3, eax
+	vcmpps	k0{k3}, zmm0, ZMMWORD PTR 3976[rsp], 30
+	kmovw	eax, k0
+	.loc 1 653 24 discriminator 2
+	movzx	eax, ax
+	vmovaps	zmm0, ZMMWORD PTR 3976[rsp]
+	vmovaps	ZMMWORD PTR 1736[rsp], zmm0
+	mov	WORD PTR 1734[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 4104[rsp]
+	vmovaps	ZMMWORD PTR 1608[rsp], zmm0
+.LBB1468:
+.LBB1469:
+	.loc 6 362 19 discriminator 2
+	movzx	eax, WORD PTR 1734[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 1736[rsp]
+	kmovw	k4, eax
+	vmovaps	zmm0{k4}, ZMMWORD PTR 1608[rsp]
+	.loc 6 362 10 discriminator 2
+	nop
+.LBE1469:
+.LBE1468:
+	.loc 1 653 24 discriminator 2
+	vmovaps	ZMMWORD PTR 3464[rsp], zmm0
+	.loc 1 654 43 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 3656[rsp]
+	mov	eax, -1
+	kmovw	k5, eax
+	vcmpps	k0{k5}, zmm0, ZMMWORD PTR 3976[rsp], 17
+	kmovw	eax, k0
+	.loc 1 654 17 discriminator 2
+	movzx	eax, ax
+	vmovaps	zmm0, ZMMWORD PTR 3528[rsp]
+	vmovaps	ZMMWORD PTR 1928[rsp], zmm0
+	mov	WORD PTR 1926[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 4040[rsp]
+	vmovaps	ZMMWORD PTR 1800[rsp], zmm0
+.LBB1470:
+.LBB1471:
+	.loc 6 362 19 discriminator 2
+	movzx	eax, WORD PTR 1926[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 1928[rsp]
+	kmovw	k6, eax
+	vmovaps	zmm0{k6}, ZMMWORD PTR 1800[rsp]
+	.loc 6 362 10 discriminator 2
+	nop
+.LBE1471:
+.LBE1470:
+	.loc 1 654 17 discriminator 2
+	vmovaps	ZMMWORD PTR 3528[rsp], zmm0
+	.loc 1 655 43 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 3592[rsp]
+	mov	eax, -1
+	kmovw	k7, eax
+	vcmpps	k0{k7}, zmm0, ZMMWORD PTR 3976[rsp], 17
+	kmovw	eax, k0
+	.loc 1 655 17 discriminator 2
+	movzx	eax, ax
+	vmovaps	zmm0, ZMMWORD PTR 3464[rsp]
+	vmovaps	ZMMWORD PTR 2120[rsp], zmm0
+	mov	WORD PTR 2118[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 4040[rsp]
+	vmovaps	ZMMWORD PTR 1992[rsp], zmm0
+.LBB1472:
+.LBB1473:
+	.loc 6 362 19 discriminator 2
+	movzx	eax, WORD PTR 2118[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 2120[rsp]
+	kmovw	k1, eax
+	vmovaps	zmm0{k1}, ZMMWORD PTR 1992[rsp]
+	.loc 6 362 10 discriminator 2
+	nop
+.LBE1473:
+.LBE1472:
+	.loc 1 655 17 discriminator 2
+	vmovaps	ZMMWORD PTR 3464[rsp], zmm0
+	.loc 1 656 64 discriminator 2
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2240[rsp], rax
+.LBB1474:
+.LBB1475:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 2240[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	ZMMWORD PTR 2312[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3528[rsp]
+	vmovaps	ZMMWORD PTR 2248[rsp], zmm0
+.LBE1475:
+.LBE1474:
+.LBB1476:
+.LBB1477:
+	.loc 6 12600 10 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2312[rsp]
+	vaddps	zmm0, zmm0, ZMMWORD PTR 2248[rsp]
+.LBE1477:
+.LBE1476:
+	.loc 1 656 21 discriminator 2
+	vmovaps	ZMMWORD PTR 3400[rsp], zmm0
+	.loc 1 657 68 discriminator 2
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2432[rsp], rax
+.LBB1478:
+.LBB1479:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 2432[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	ZMMWORD PTR 2504[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3464[rsp]
+	vmovaps	ZMMWORD PTR 2440[rsp], zmm0
+.LBE1479:
+.LBE1478:
+.LBB1480:
+.LBB1481:
+	.loc 6 12600 10 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2504[rsp]
+	vaddps	zmm0, zmm0, ZMMWORD PTR 2440[rsp]
+.LBE1481:
+.LBE1480:
+	.loc 1 657 21 discriminator 2
+	vmovaps	ZMMWORD PTR 3336[rsp], zmm0
+	.loc 1 658 39 discriminator 2
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2688[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 3400[rsp]
+	vmovaps	ZMMWORD PTR 2568[rsp], zmm0
+.LBB1482:
+.LBB1483:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2568[rsp]
+	mov	rax, QWORD PTR 2688[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1483:
+.LBE1482:
+	.loc 1 659 43 discriminator 2
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2808[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 3336[rsp]
+	vmovaps	ZMMWORD PTR 2696[rsp], zmm0
+.LBB1484:
+.LBB1485:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2696[rsp]
+	mov	rax, QWORD PTR 2808[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1485:
+.LBE1484:
+	.loc 1 660 60 discriminator 2
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2816[rsp], rax
+.LBB1486:
+.LBB1487:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 2816[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3400[rsp]
+	vmovaps	ZMMWORD PTR 2952[rsp], zmm0
+	vmovaps	ZMMWORD PTR 2888[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 4296[rsp]
+	vmovaps	ZMMWORD PTR 2824[rsp], zmm0
+.LBE1487:
+.LBE1486:
+.LBB1488:
+.LBB1489:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 2952[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 2888[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 2824[rsp]
+	mov	eax, -1
+	kmovw	k2, eax
+	vfmadd132ps	zmm0{k2}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1489:
+.LBE1488:
+	.loc 1 660 16 discriminator 2
+	vmovaps	ZMMWORD PTR 4296[rsp], zmm0
+	.loc 1 661 64 discriminator 2
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	add	rax, 16
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 3072[rsp], rax
+.LBB1490:
+.LBB1491:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 3072[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3336[rsp]
+	vmovaps	ZMMWORD PTR 3208[rsp], zmm0
+	vmovaps	ZMMWORD PTR 3144[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 4232[rsp]
+	vmovaps	ZMMWORD PTR 3080[rsp], zmm0
+.LBE1491:
+.LBE1490:
+.LBB1492:
+.LBB1493:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 3208[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 3144[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 3080[rsp]
+	mov	eax, -1
+	kmovw	k3, eax
+	vfmadd132ps	zmm0{k3}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1493:
+.LBE1492:
+	.loc 1 661 16 discriminator 2
+	vmovaps	ZMMWORD PTR 4232[rsp], zmm0
+.LBE1461:
+	.loc 1 648 32 discriminator 2
+	add	DWORD PTR 4228[rsp], 32
+.L434:
+	.loc 1 648 19 discriminator 1
+	mov	eax, DWORD PTR 4228[rsp]
+	add	eax, 31
+	cmp	DWORD PTR -104[rsp], eax
+	jg	.L449
+	.loc 1 663 5
+	jmp	.L450
+.L463:
+.LBB1494:
+	.loc 1 665 34
+	mov	eax, DWORD PTR -104[rsp]
+	sub	eax, DWORD PTR 4228[rsp]
+	.loc 1 665 19
+	cmp	eax, 15
+	jg	.L451
+	.loc 1 665 94 discriminator 1
+	mov	eax, DWORD PTR -104[rsp]
+	sub	eax, DWORD PTR 4228[rsp]
+	.loc 1 665 83 discriminator 1
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	.loc 1 665 19 discriminator 1
+	sub	eax, 1
+	jmp	.L452
+.L451:
+	.loc 1 665 19 is_stmt 0 discriminator 2
+	mov	eax, -1
+.L452:
+	.loc 1 665 19 discriminator 4
+	mov	WORD PTR 3974[rsp], ax
+	.loc 1 666 63 is_stmt 1 discriminator 4
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rdx, rax
+	.loc 1 666 26 discriminator 4
+	movzx	eax, WORD PTR 3974[rsp]
+	mov	WORD PTR 454[rsp], ax
+	mov	QWORD PTR 440[rsp], rdx
+.LBB1495:
+.LBB1496:
+	.loc 6 6349 19 discriminator 4
+	movzx	edx, WORD PTR 454[rsp]
+.LBB1497:
+.LBB1498:
+	.loc 6 307 10 discriminator 4
+	vxorps	xmm0, xmm0, xmm0
+.LBE1498:
+.LBE1497:
+	.loc 6 6349 19 discriminator 4
+	mov	rax, QWORD PTR 440[rsp]
+	kmovw	k4, edx
+	vmovups	zmm0{k4}, ZMMWORD PTR [rax]
+	.loc 6 6349 10 discriminator 4
+	nop
+.LBE1496:
+.LBE1495:
+	.loc 1 666 26 discriminator 4
+	vmovaps	ZMMWORD PTR 3848[rsp], zmm0
+	.loc 1 667 48 discriminator 4
+	vmovaps	zmm0, ZMMWORD PTR 3848[rsp]
+	mov	eax, -1
+	kmovw	k5, eax
+	vcmpps	k1{k5}, zmm0, ZMMWORD PTR 3976[rsp], 30
+	kmovw	eax, k1
+	.loc 1 667 23 discriminator 4
+	movzx	eax, ax
+	vmovaps	zmm0, ZMMWORD PTR 3976[rsp]
+	vmovaps	ZMMWORD PTR 584[rsp], zmm0
+	mov	WORD PTR 582[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 4104[rsp]
+	vmovaps	ZMMWORD PTR 456[rsp], zmm0
+.LBB1499:
+.LBB1500:
+	.loc 6 362 19 discriminator 4
+	movzx	eax, WORD PTR 582[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 584[rsp]
+	kmovw	k6, eax
+	vmovaps	zmm0{k6}, ZMMWORD PTR 456[rsp]
+	.loc 6 362 10 discriminator 4
+	nop
+.LBE1500:
+.LBE1499:
+	.loc 1 667 23 discriminator 4
+	vmovaps	ZMMWORD PTR 3784[rsp], zmm0
+	.loc 1 668 41 discriminator 4
+	vmovaps	zmm0, ZMMWORD PTR 3848[rsp]
+	mov	eax, -1
+	kmovw	k7, eax
+	vcmpps	k2{k7}, zmm0, ZMMWORD PTR 3976[rsp], 17
+	kmovw	eax, k2
+	.loc 1 668 16 discriminator 4
+	movzx	eax, ax
+	vmovaps	zmm0, ZMMWORD PTR 3784[rsp]
+	vmovaps	ZMMWORD PTR 776[rsp], zmm0
+	mov	WORD PTR 774[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 4040[rsp]
+	vmovaps	ZMMWORD PTR 648[rsp], zmm0
+.LBB1501:
+.LBB1502:
+	.loc 6 362 19 discriminator 4
+	movzx	eax, WORD PTR 774[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 776[rsp]
+	kmovw	k1, eax
+	vmovaps	zmm0{k1}, ZMMWORD PTR 648[rsp]
+	.loc 6 362 10 discriminator 4
+	nop
+.LBE1502:
+.LBE1501:
+	.loc 1 668 16 discriminator 4
+	vmovaps	ZMMWORD PTR 3784[rsp], zmm0
+	.loc 1 669 75 discriminator 4
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rdx, rax
+	.loc 1 669 20 discriminator 4
+	movzx	eax, WORD PTR 3974[rsp]
+	mov	WORD PTR 902[rsp], ax
+	mov	QWORD PTR 888[rsp], rdx
+.LBB1503:
+.LBB1504:
+	.loc 6 6349 19 discriminator 4
+	movzx	edx, WORD PTR 902[rsp]
+.LBB1505:
+.LBB1506:
+	.loc 6 307 10 discriminator 4
+	vxorps	xmm0, xmm0, xmm0
+.LBE1506:
+.LBE1505:
+	.loc 6 6349 19 discriminator 4
+	mov	rax, QWORD PTR 888[rsp]
+	kmovw	k2, edx
+	vmovups	zmm0{k2}, ZMMWORD PTR [rax]
+	.loc 6 6349 10 discriminator 4
+	nop
+	vmovaps	ZMMWORD PTR 968[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 3784[rsp]
+	vmovaps	ZMMWORD PTR 904[rsp], zmm0
+.LBE1504:
+.LBE1503:
+.LBB1507:
+.LBB1508:
+	.loc 6 12600 10 discriminator 4
+	vmovaps	zmm0, ZMMWORD PTR 968[rsp]
+	vaddps	zmm0, zmm0, ZMMWORD PTR 904[rsp]
+.LBE1508:
+.LBE1507:
+	.loc 1 669 20 discriminator 4
+	vmovaps	ZMMWORD PTR 3720[rsp], zmm0
+	.loc 1 670 9 discriminator 4
+	movzx	eax, WORD PTR 3974[rsp]
+	.loc 1 670 44 discriminator 4
+	mov	edx, DWORD PTR 4228[rsp]
+	movsx	rdx, edx
+	lea	rcx, 0[0+rdx*4]
+	mov	rdx, QWORD PTR -80[rsp]
+	add	rdx, rcx
+	mov	QWORD PTR 1136[rsp], rdx
+	mov	WORD PTR 1134[rsp], ax
+	vmovaps	zmm0, ZMMWORD PTR 3720[rsp]
+	vmovaps	ZMMWORD PTR 1032[rsp], zmm0
+.LBB1509:
+.LBB1510:
+	.loc 6 6366 3 discriminator 4
+	movzx	edx, WORD PTR 1134[rsp]
+	mov	rax, QWORD PTR 1136[rsp]
+	vmovaps	zmm0, ZMMWORD PTR 1032[rsp]
+	kmovw	k3, edx
+	vmovups	ZMMWORD PTR [rax]{k3}, zmm0
+	.loc 6 6368 1 discriminator 4
+	nop
+.LBE1510:
+.LBE1509:
+	.loc 1 671 71 discriminator 4
+	mov	eax, DWORD PTR 4228[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rdx, rax
+	.loc 1 671 16 discriminator 4
+	movzx	eax, WORD PTR 3974[rsp]
+	mov	WORD PTR 1158[rsp], ax
+	mov	QWORD PTR 1144[rsp], rdx
+.LBB1511:
+.LBB1512:
+	.loc 6 6349 19 discriminator 4
+	movzx	edx, WORD PTR 1158[rsp]
+.LBB1513:
+.LBB1514:
+	.loc 6 307 10 discriminator 4
+	vxorps	xmm0, xmm0, xmm0
+.LBE1514:
+.LBE1513:
+	.loc 6 6349 19 discriminator 4
+	mov	rax, QWORD PTR 1144[rsp]
+	kmovw	k4, edx
+	vmovups	zmm0{k4}, ZMMWORD PTR [rax]
+	.loc 6 6349 10 discriminator 4
+	nop
+	vmovaps	zmm1, ZMMWORD PTR 3720[rsp]
+	vmovaps	ZMMWORD PTR 1288[rsp], zmm1
+	vmovaps	ZMMWORD PTR 1224[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 4296[rsp]
+	vmovaps	ZMMWORD PTR 1160[rsp], zmm0
+.LBE1512:
+.LBE1511:
+.LBB1515:
+.LBB1516:
+	.loc 6 13368 19 discriminator 4
+	vmovaps	zmm0, ZMMWORD PTR 1288[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1224[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1160[rsp]
+	mov	eax, -1
+	kmovw	k5, eax
+	vfmadd132ps	zmm0{k5}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 4
+	nop
+.LBE1516:
+.LBE1515:
+	.loc 1 671 16 discriminator 4
+	vmovaps	ZMMWORD PTR 4296[rsp], zmm0
+.LBE1494:
+	.loc 1 663 26 discriminator 4
+	add	DWORD PTR 4228[rsp], 16
+.L450:
+	.loc 1 663 14 discriminator 1
+	mov	eax, DWORD PTR 4228[rsp]
+	cmp	eax, DWORD PTR -104[rsp]
+	jl	.L463
+	vmovaps	zmm0, ZMMWORD PTR 4296[rsp]
+	vmovaps	ZMMWORD PTR 8[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 4232[rsp]
+	vmovaps	ZMMWORD PTR -56[rsp], zmm0
+.LBB1517:
+.LBB1518:
+	.loc 6 12600 10
+	vmovaps	zmm0, ZMMWORD PTR 8[rsp]
+	vaddps	zmm0, zmm0, ZMMWORD PTR -56[rsp]
+	vmovaps	ZMMWORD PTR 328[rsp], zmm0
+.LBE1518:
+.LBE1517:
+.LBB1519:
+.LBB1520:
+.LBB1521:
+.LBB1522:
+	.loc 3 1211 10
+	vmovapd	ymm1, YMMWORD PTR 296[rsp]
+.LBE1522:
+.LBE1521:
+	.loc 6 16169 3
+	vmovapd	zmm0, ZMMWORD PTR 328[rsp]
+	mov	eax, -1
+	kmovw	k6, eax
+	vextractf64x4	ymm1{k6}, zmm0, 0x1
+	vmovapd	YMMWORD PTR 264[rsp], ymm1
+.LBB1523:
+.LBB1524:
+	.loc 3 1211 10
+	vmovapd	ymm1, YMMWORD PTR 232[rsp]
+.LBE1524:
+.LBE1523:
+	.loc 6 16169 3
+	vmovapd	zmm0, ZMMWORD PTR 328[rsp]
+	mov	eax, -1
+	kmovw	k7, eax
+	vextractf64x4	ymm1{k7}, zmm0, 0x0
+	vmovapd	YMMWORD PTR 200[rsp], ymm1
+	vmovaps	ymm0, YMMWORD PTR 264[rsp]
+	vaddps	ymm0, ymm0, YMMWORD PTR 200[rsp]
+	vmovaps	YMMWORD PTR 168[rsp], ymm0
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vextractf128	XMMWORD PTR 152[rsp], ymm0, 0x1
+	vmovaps	ymm0, YMMWORD PTR 168[rsp]
+	vmovaps	XMMWORD PTR 136[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 152[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 136[rsp]
+	vmovaps	XMMWORD PTR 120[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vpermilps	xmm0, xmm0, 78
+	vmovaps	XMMWORD PTR 104[rsp], xmm0
+	vmovaps	xmm0, XMMWORD PTR 120[rsp]
+	vaddps	xmm0, xmm0, XMMWORD PTR 104[rsp]
+	vmovaps	XMMWORD PTR -72[rsp], xmm0
+	vmovss	xmm1, DWORD PTR -72[rsp]
+	vmovss	xmm0, DWORD PTR -68[rsp]
+	vaddss	xmm0, xmm1, xmm0
+.LBE1520:
+.LBE1519:
+	.loc 1 674 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4858:
+	.size	lmsKernel_SignUpdateDotAvx512, .-lmsKernel_SignUpdateDotAvx512
+	.type	lmsKernel_BankUpdateDotAvx512, @function
+lmsKernel_BankUpdateDotAvx512:
+.LFB4859:
+	.loc 1 679 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	and	rsp, -64
+	sub	rsp, 2632
+	mov	QWORD PTR -64[rsp], rdi
+	mov	QWORD PTR -72[rsp], rsi
+	mov	QWORD PTR -80[rsp], rdx
+	mov	QWORD PTR -88[rsp], rcx
+	mov	QWORD PTR -96[rsp], r8
+	mov	DWORD PTR -100[rsp], r9d
+.LBB1525:
+	.loc 1 680 14
+	mov	DWORD PTR 2628[rsp], 0
+	.loc 1 680 5
+	jmp	.L470
+.L493:
+.LBB1526:
+	.loc 1 682 47
+	mov	eax, DWORD PTR 2628[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1984[rsp], rax
+.LBB1527:
+.LBB1528:
+	.loc 6 6333 10
+	mov	rax, QWORD PTR 1984[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+.LBE1528:
+.LBE1527:
+	.loc 1 682 26
+	vmovaps	ZMMWORD PTR 2312[rsp], zmm0
+.LBB1529:
+.LBB1530:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1530:
+.LBE1529:
+	.loc 1 683 23
+	vmovaps	ZMMWORD PTR 2504[rsp], zmm0
+.LBB1531:
+.LBB1532:
+	.loc 6 307 10
+	vxorps	xmm0, xmm0, xmm0
+.LBE1532:
+.LBE1531:
+	.loc 1 684 23
+	vmovaps	ZMMWORD PTR 2440[rsp], zmm0
+	.loc 1 685 13
+	mov	DWORD PTR 2436[rsp], 0
+	.loc 1 688 9
+	jmp	.L474
+.L485:
+.LBB1533:
+	.loc 1 690 33 discriminator 2
+	mov	eax, DWORD PTR 2436[rsp]
+	movsx	rdx, eax
+	.loc 1 690 43 discriminator 2
+	mov	eax, DWORD PTR 16[rbp]
+	cdqe
+	imul	rdx, rax
+	.loc 1 690 52 discriminator 2
+	mov	eax, DWORD PTR 2628[rsp]
+	cdqe
+	.loc 1 690 26 discriminator 2
+	add	rax, rdx
+	mov	QWORD PTR 2176[rsp], rax
+	.loc 1 691 38 discriminator 2
+	mov	eax, DWORD PTR 16[rbp]
+	movsx	rdx, eax
+	.loc 1 691 26 discriminator 2
+	mov	rax, QWORD PTR 2176[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 2168[rsp], rax
+	.loc 1 692 107 discriminator 2
+	mov	rax, QWORD PTR 2176[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 760[rsp], rax
+.LBB1534:
+.LBB1535:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 760[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+.LBE1535:
+.LBE1534:
+	.loc 1 692 69 discriminator 2
+	mov	rax, QWORD PTR 2176[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 768[rsp], rax
+.LBB1536:
+.LBB1537:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 768[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm2, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2312[rsp]
+	vmovaps	ZMMWORD PTR 904[rsp], zmm0
+	vmovaps	ZMMWORD PTR 840[rsp], zmm2
+	vmovaps	ZMMWORD PTR 776[rsp], zmm1
+.LBE1537:
+.LBE1536:
+.LBB1538:
+.LBB1539:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 904[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 840[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 776[rsp]
+	mov	eax, -1
+	kmovw	k1, eax
+	vfmadd132ps	zmm0{k1}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1539:
+.LBE1538:
+	.loc 1 692 25 discriminator 2
+	vmovaps	ZMMWORD PTR 2056[rsp], zmm0
+	.loc 1 693 107 discriminator 2
+	mov	rax, QWORD PTR 2168[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1016[rsp], rax
+.LBB1540:
+.LBB1541:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1016[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+.LBE1541:
+.LBE1540:
+	.loc 1 693 69 discriminator 2
+	mov	rax, QWORD PTR 2168[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1024[rsp], rax
+.LBB1542:
+.LBB1543:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1024[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm2, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2312[rsp]
+	vmovaps	ZMMWORD PTR 1160[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1096[rsp], zmm2
+	vmovaps	ZMMWORD PTR 1032[rsp], zmm1
+.LBE1543:
+.LBE1542:
+.LBB1544:
+.LBB1545:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1160[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1096[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1032[rsp]
+	mov	eax, -1
+	kmovw	k2, eax
+	vfmadd132ps	zmm0{k2}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1545:
+.LBE1544:
+	.loc 1 693 25 discriminator 2
+	vmovaps	ZMMWORD PTR 1992[rsp], zmm0
+	.loc 1 694 43 discriminator 2
+	mov	rax, QWORD PTR 2176[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1344[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 2056[rsp]
+	vmovaps	ZMMWORD PTR 1224[rsp], zmm0
+.LBB1546:
+.LBB1547:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1224[rsp]
+	mov	rax, QWORD PTR 1344[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1547:
+.LBE1546:
+	.loc 1 695 43 discriminator 2
+	mov	rax, QWORD PTR 2168[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1464[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 1992[rsp]
+	vmovaps	ZMMWORD PTR 1352[rsp], zmm0
+.LBB1548:
+.LBB1549:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1352[rsp]
+	mov	rax, QWORD PTR 1464[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1549:
+.LBE1548:
+	.loc 1 696 64 discriminator 2
+	mov	rax, QWORD PTR 2176[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1472[rsp], rax
+.LBB1550:
+.LBB1551:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1472[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2056[rsp]
+	vmovaps	ZMMWORD PTR 1608[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1544[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 2504[rsp]
+	vmovaps	ZMMWORD PTR 1480[rsp], zmm0
+.LBE1551:
+.LBE1550:
+.LBB1552:
+.LBB1553:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1608[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1544[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1480[rsp]
+	mov	eax, -1
+	kmovw	k3, eax
+	vfmadd132ps	zmm0{k3}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1553:
+.LBE1552:
+	.loc 1 696 20 discriminator 2
+	vmovaps	ZMMWORD PTR 2504[rsp], zmm0
+	.loc 1 697 64 discriminator 2
+	mov	rax, QWORD PTR 2168[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 1728[rsp], rax
+.LBB1554:
+.LBB1555:
+	.loc 6 6333 10 discriminator 2
+	mov	rax, QWORD PTR 1728[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 1992[rsp]
+	vmovaps	ZMMWORD PTR 1864[rsp], zmm0
+	vmovaps	ZMMWORD PTR 1800[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 2440[rsp]
+	vmovaps	ZMMWORD PTR 1736[rsp], zmm0
+.LBE1555:
+.LBE1554:
+.LBB1556:
+.LBB1557:
+	.loc 6 13368 19 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 1864[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 1800[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 1736[rsp]
+	mov	eax, -1
+	kmovw	k4, eax
+	vfmadd132ps	zmm0{k4}, zmm1, zmm2
+	.loc 6 13368 10 discriminator 2
+	nop
+.LBE1557:
+.LBE1556:
+	.loc 1 697 20 discriminator 2
+	vmovaps	ZMMWORD PTR 2440[rsp], zmm0
+.LBE1533:
+	.loc 1 688 35 discriminator 2
+	add	DWORD PTR 2436[rsp], 2
+.L474:
+	.loc 1 688 22 discriminator 1
+	mov	eax, DWORD PTR 2436[rsp]
+	add	eax, 1
+	cmp	DWORD PTR -100[rsp], eax
+	jg	.L485
+	.loc 1 699 12
+	mov	eax, DWORD PTR 2436[rsp]
+	cmp	eax, DWORD PTR -100[rsp]
+	jge	.L486
+.LBB1558:
+	.loc 1 701 32
+	mov	eax, DWORD PTR 2436[rsp]
+	movsx	rdx, eax
+	.loc 1 701 42
+	mov	eax, DWORD PTR 16[rbp]
+	cdqe
+	imul	rdx, rax
+	.loc 1 701 51
+	mov	eax, DWORD PTR 2628[rsp]
+	cdqe
+	.loc 1 701 26
+	add	rax, rdx
+	mov	QWORD PTR 2304[rsp], rax
+	.loc 1 702 105
+	mov	rax, QWORD PTR 2304[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 184[rsp], rax
+.LBB1559:
+.LBB1560:
+	.loc 6 6333 10
+	mov	rax, QWORD PTR 184[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+.LBE1560:
+.LBE1559:
+	.loc 1 702 68
+	mov	rax, QWORD PTR 2304[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 192[rsp], rax
+.LBB1561:
+.LBB1562:
+	.loc 6 6333 10
+	mov	rax, QWORD PTR 192[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm2, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2312[rsp]
+	vmovaps	ZMMWORD PTR 328[rsp], zmm0
+	vmovaps	ZMMWORD PTR 264[rsp], zmm2
+	vmovaps	ZMMWORD PTR 200[rsp], zmm1
+.LBE1562:
+.LBE1561:
+.LBB1563:
+.LBB1564:
+	.loc 6 13368 19
+	vmovaps	zmm0, ZMMWORD PTR 328[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 264[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 200[rsp]
+	mov	eax, -1
+	kmovw	k5, eax
+	vfmadd132ps	zmm0{k5}, zmm1, zmm2
+	.loc 6 13368 10
+	nop
+.LBE1564:
+.LBE1563:
+	.loc 1 702 24
+	vmovaps	ZMMWORD PTR 2184[rsp], zmm0
+	.loc 1 703 43
+	mov	rax, QWORD PTR 2304[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 504[rsp], rax
+	vmovaps	zmm0, ZMMWORD PTR 2184[rsp]
+	vmovaps	ZMMWORD PTR 392[rsp], zmm0
+.LBB1565:
+.LBB1566:
+	.loc 6 6359 20
+	vmovaps	zmm0, ZMMWORD PTR 392[rsp]
+	mov	rax, QWORD PTR 504[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1
+	nop
+.LBE1566:
+.LBE1565:
+	.loc 1 704 63
+	mov	rax, QWORD PTR 2304[rsp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 512[rsp], rax
+.LBB1567:
+.LBB1568:
+	.loc 6 6333 10
+	mov	rax, QWORD PTR 512[rsp]
+	vmovups	zmm0, ZMMWORD PTR [rax]
+	vmovaps	zmm1, zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2184[rsp]
+	vmovaps	ZMMWORD PTR 648[rsp], zmm0
+	vmovaps	ZMMWORD PTR 584[rsp], zmm1
+	vmovaps	zmm0, ZMMWORD PTR 2504[rsp]
+	vmovaps	ZMMWORD PTR 520[rsp], zmm0
+.LBE1568:
+.LBE1567:
+.LBB1569:
+.LBB1570:
+	.loc 6 13368 19
+	vmovaps	zmm0, ZMMWORD PTR 648[rsp]
+	vmovaps	zmm2, ZMMWORD PTR 584[rsp]
+	vmovaps	zmm1, ZMMWORD PTR 520[rsp]
+	mov	eax, -1
+	kmovw	k6, eax
+	vfmadd132ps	zmm0{k6}, zmm1, zmm2
+	.loc 6 13368 10
+	nop
+.LBE1570:
+.LBE1569:
+	.loc 1 704 20
+	vmovaps	ZMMWORD PTR 2504[rsp], zmm0
+.L486:
+	vmovaps	zmm0, ZMMWORD PTR 2504[rsp]
+	vmovaps	ZMMWORD PTR 8[rsp], zmm0
+	vmovaps	zmm0, ZMMWORD PTR 2440[rsp]
+	vmovaps	ZMMWORD PTR -56[rsp], zmm0
+.LBE1558:
+.LBB1571:
+.LBB1572:
+	.loc 6 12600 10 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 8[rsp]
+	vaddps	zmm0, zmm0, ZMMWORD PTR -56[rsp]
+.LBE1572:
+.LBE1571:
+	.loc 1 706 33 discriminator 2
+	mov	eax, DWORD PTR 2628[rsp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rsp]
+	add	rax, rdx
+	mov	QWORD PTR 176[rsp], rax
+	vmovaps	ZMMWORD PTR 72[rsp], zmm0
+.LBB1573:
+.LBB1574:
+	.loc 6 6359 20 discriminator 2
+	vmovaps	zmm0, ZMMWORD PTR 72[rsp]
+	mov	rax, QWORD PTR 176[rsp]
+	vmovups	ZMMWORD PTR [rax], zmm0
+	.loc 6 6360 1 discriminator 2
+	nop
+.LBE1574:
+.LBE1573:
+.LBE1526:
+	.loc 1 680 38 discriminator 2
+	add	DWORD PTR 2628[rsp], 16
+.L470:
+	.loc 1 680 25 discriminator 1
+	mov	eax, DWORD PTR 2628[rsp]
+	cmp	eax, DWORD PTR 16[rbp]
+	jl	.L493
+.LBE1525:
+	.loc 1 708 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4859:
+	.size	lmsKernel_BankUpdateDotAvx512, .-lmsKernel_BankUpdateDotAvx512
+	.section	.rodata
+.LC2:
+	.string	"scalar"
+.LC3:
+	.string	"sse2"
+.LC4:
+	.string	"avx2"
+.LC5:
+	.string	"avx512"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	lmsKernels, @object
+	.size	lmsKernels, 256
+lmsKernels:
+	.long	0
+	.zero	4
+	.quad	.LC2
+	.quad	lmsKernel_DotScalar
+	.quad	lmsKernel_UpdateScalar
+	.quad	lmsKernel_UpdateDotScalar
+	.quad	lmsKernel_LeakyUpdateDotScalar
+	.quad	lmsKernel_SignUpdateDotScalar
+	.quad	lmsKernel_BankUpdateDotScalar
+	.long	1
+	.zero	4
+	.quad	.LC3
+	.quad	lmsKernel_DotSse2
+	.quad	lmsKernel_UpdateSse2
+	.quad	lmsKernel_UpdateDotSse2
+	.quad	lmsKernel_LeakyUpdateDotSse2
+	.quad	lmsKernel_SignUpdateDotSse2
+	.quad	lmsKernel_BankUpdateDotSse2
+	.long	2
+	.zero	4
+	.quad	.LC4
+	.quad	lmsKernel_DotAvx2
+	.quad	lmsKernel_UpdateAvx2
+	.quad	lmsKernel_UpdateDotAvx2
+	.quad	lmsKernel_LeakyUpdateDotAvx2
+	.quad	lmsKernel_SignUpdateDotAvx2
+	.quad	lmsKernel_BankUpdateDotAvx2
+	.long	3
+	.zero	4
+	.quad	.LC5
+	.quad	lmsKernel_DotAvx512
+	.quad	lmsKernel_UpdateAvx512
+	.quad	lmsKernel_UpdateDotAvx512
+	.quad	lmsKernel_LeakyUpdateDotAvx512
+	.quad	lmsKernel_SignUpdateDotAvx512
+	.quad	lmsKernel_BankUpdateDotAvx512
+	.text
+	.globl	lmsKernel_IsSupported
+	.type	lmsKernel_IsSupported, @function
+lmsKernel_IsSupported:
+.LFB4860:
+	.loc 1 735 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 736 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 738 5
+	cmp	DWORD PTR -20[rbp], 3
+	je	.L495
+	cmp	DWORD PTR -20[rbp], 3
+	ja	.L504
+	cmp	DWORD PTR -20[rbp], 2
+	je	.L497
+	cmp	DWORD PTR -20[rbp], 2
+	ja	.L504
+	cmp	DWORD PTR -20[rbp], 0
+	je	.L498
+	cmp	DWORD PTR -20[rbp], 1
+	je	.L499
+	.loc 1 762 13
+	jmp	.L504
+.L498:
+	.loc 1 741 20
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 742 13
+	jmp	.L500
+.L499:
+	.loc 1 746 13
+	call	__cpu_indicator_init@PLT
+	.loc 1 747 20
+	mov	rax, QWORD PTR __cpu_model@GOTPCREL[rip]
+	mov	eax, DWORD PTR 12[rax]
+	and	eax, 16
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 748 13
+	jmp	.L500
+.L497:
+	.loc 1 751 13
+	call	__cpu_indicator_init@PLT
+	.loc 1 752 22
+	mov	rax, QWORD PTR __cpu_model@GOTPCREL[rip]
+	mov	eax, DWORD PTR 12[rax]
+	and	eax, 1024
+	.loc 1 752 53
+	test	eax, eax
+	je	.L501
+	.loc 1 752 53 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR __cpu_model@GOTPCREL[rip]
+	mov	eax, DWORD PTR 12[rax]
+	and	eax, 16384
+	test	eax, eax
+	je	.L501
+	.loc 1 752 53 discriminator 3
+	mov	eax, 1
+	jmp	.L502
+.L501:
+	.loc 1 752 53 discriminator 4
+	mov	eax, 0
+.L502:
+	.loc 1 752 20 is_stmt 1 discriminator 6
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 753 13 discriminator 6
+	jmp	.L500
+.L495:
+	.loc 1 756 13
+	call	__cpu_indicator_init@PLT
+	.loc 1 757 20
+	mov	rax, QWORD PTR __cpu_model@GOTPCREL[rip]
+	mov	eax, DWORD PTR 12[rax]
+	and	eax, 32768
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 758 13
+	jmp	.L500
+.L504:
+	.loc 1 762 13
+	nop
+.L500:
+	.loc 1 764 20
+	cmp	DWORD PTR -4[rbp], 0
+	setne	al
+	movzx	eax, al
+	.loc 1 765 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4860:
+	.size	lmsKernel_IsSupported, .-lmsKernel_IsSupported
+	.globl	lmsKernel_Get
+	.type	lmsKernel_Get, @function
+lmsKernel_Get:
+.LFB4861:
+	.loc 1 768 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 769 24
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 771 8
+	cmp	DWORD PTR -20[rbp], 3
+	ja	.L506
+	.loc 1 771 38 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edi, eax
+	call	lmsKernel_IsSupported
+	.loc 1 771 35 discriminator 1
+	test	eax, eax
+	je	.L506
+	.loc 1 773 16
+	mov	eax, DWORD PTR -20[rbp]
+	sal	rax, 6
+	mov	rdx, rax
+	lea	rax, lmsKernels[rip]
+	add	rax, rdx
+	mov	QWORD PTR -8[rbp], rax
+.L506:
+	.loc 1 775 12
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 776 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4861:
+	.size	lmsKernel_Get, .-lmsKernel_Get
+	.local	lmsKernelBest
+	.comm	lmsKernelBest,8,8
+	.local	lmsKernelBestOnce
+	.comm	lmsKernelBestOnce,4,4
+	.section	.rodata
+.LC6:
+	.string	"LMS_KERNEL"
+	.align 8
+.LC7:
+	.string	"WARNING: LMS_KERNEL=%s is unknown or not supported by this CPU, using the %s kernel\n"
+	.text
+	.type	lmsKernel_ChooseBest, @function
+lmsKernel_ChooseBest:
+.LFB4862:
+	.loc 1 785 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	.loc 1 786 26
+	lea	rax, .LC6[rip]
+	mov	rdi, rax
+	call	getenv@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 790 15
+	mov	DWORD PTR -4[rbp], 3
+	.loc 1 790 5
+	jmp	.L509
+.L512:
+	.loc 1 792 14
+	mov	eax, DWORD PTR -4[rbp]
+	mov	edi, eax
+	call	lmsKernel_Get
+	.loc 1 792 12
+	test	rax, rax
+	je	.L510
+	.loc 1 793 13
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L511
+	.loc 1 793 69 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	sal	rax, 6
+	mov	rdx, rax
+	lea	rax, lmsKernels[rip+8]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 793 38 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 793 34 discriminator 1
+	test	eax, eax
+	je	.L511
+.L510:
+	.loc 1 790 69 discriminator 2
+	sub	DWORD PTR -4[rbp], 1
+.L509:
+	.loc 1 790 44 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jg	.L512
+.L511:
+	.loc 1 798 8
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L513
+	.loc 1 798 61 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	sal	rax, 6
+	mov	rdx, rax
+	lea	rax, lmsKernels[rip+8]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 798 30 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 798 26 discriminator 1
+	test	eax, eax
+	je	.L513
+	.loc 1 801 40
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	sal	rax, 6
+	mov	rdx, rax
+	lea	rax, lmsKernels[rip+8]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 800 9
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rsi, rax
+	lea	rax, .LC7[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L513:
+	.loc 1 803 21
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	sal	rax, 6
+	mov	rdx, rax
+	lea	rax, lmsKernels[rip]
+	add	rax, rdx
+	.loc 1 803 19
+	mov	QWORD PTR lmsKernelBest[rip], rax
+	.loc 1 804 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4862:
+	.size	lmsKernel_ChooseBest, .-lmsKernel_ChooseBest
+	.globl	lmsKernel_GetBest
+	.type	lmsKernel_GetBest, @function
+lmsKernel_GetBest:
+.LFB4863:
+	.loc 1 807 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	.loc 1 809 5
+	lea	rax, lmsKernel_ChooseBest[rip]
+	mov	rsi, rax
+	lea	rax, lmsKernelBestOnce[rip]
+	mov	rdi, rax
+	call	pthread_once@PLT
+	.loc 1 810 12
+	mov	rax, QWORD PTR lmsKernelBest[rip]
+	.loc 1 811 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE4863:
+	.size	lmsKernel_GetBest, .-lmsKernel_GetBest
+	.section	.rodata
+	.align 16
+.LC1:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.text
+.Letext0:
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 9 "include/lmsKernel.h"
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/emmintrin.h"
+	.file 11 "/usr/include/pthread.h"
+	.file 12 "/usr/include/stdio.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "/usr/include/stdlib.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x6163
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2f
+	.long	.LASF162
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x12
+	.long	.LASF12
+	.byte	0x7
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0x1a
+	.long	0x2e
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x31
+	.byte	0x8
+	.uleb128 0x14
+	.long	0x85
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x1a
+	.long	0x85
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x12
+	.long	.LASF13
+	.byte	0x8
+	.byte	0x35
+	.byte	0x1e
+	.long	0x46
+	.uleb128 0x14
+	.long	0xa9
+	.uleb128 0x32
+	.uleb128 0x14
+	.long	0x8c
+	.uleb128 0x33
+	.byte	0x7
+	.byte	0x4
+	.long	0x69
+	.byte	0x9
+	.byte	0xf
+	.byte	0x1
+	.long	0xdc
+	.uleb128 0x21
+	.long	.LASF14
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF15
+	.byte	0x1
+	.uleb128 0x21
+	.long	.LASF16
+	.byte	0x2
+	.uleb128 0x21
+	.long	.LASF17
+	.byte	0x3
+	.uleb128 0x21
+	.long	.LASF18
+	.byte	0x4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF19
+	.byte	0x9
+	.byte	0x15
+	.byte	0x3
+	.long	0xaf
+	.uleb128 0x34
+	.byte	0x40
+	.byte	0x9
+	.byte	0x17
+	.byte	0x9
+	.long	0x153
+	.uleb128 0x1b
+	.long	.LASF20
+	.byte	0x19
+	.byte	0x15
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF21
+	.byte	0x1a
+	.byte	0x11
+	.long	0xaa
+	.byte	0x8
+	.uleb128 0x35
+	.string	"dot"
+	.byte	0x9
+	.byte	0x1d
+	.byte	0xd
+	.long	0x17d
+	.byte	0x10
+	.uleb128 0x1b
+	.long	.LASF22
+	.byte	0x20
+	.byte	0xc
+	.long	0x1a1
+	.byte	0x18
+	.uleb128 0x1b
+	.long	.LASF23
+	.byte	0x23
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x20
+	.uleb128 0x1b
+	.long	.LASF24
+	.byte	0x27
+	.byte	0xd
+	.long	0x1f6
+	.byte	0x28
+	.uleb128 0x1b
+	.long	.LASF25
+	.byte	0x2b
+	.byte	0xd
+	.long	0x1c9
+	.byte	0x30
+	.uleb128 0x1b
+	.long	.LASF26
+	.byte	0x30
+	.byte	0xc
+	.long	0x224
+	.byte	0x38
+	.byte	0
+	.uleb128 0x27
+	.long	0x16c
+	.long	0x16c
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x46
+	.byte	0
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF27
+	.uleb128 0x1a
+	.long	0x16c
+	.uleb128 0x14
+	.long	0x173
+	.uleb128 0x14
+	.long	0x153
+	.uleb128 0x2b
+	.long	0x19c
+	.uleb128 0xc
+	.long	0x19c
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x16c
+	.uleb128 0xc
+	.long	0x46
+	.byte	0
+	.uleb128 0x14
+	.long	0x16c
+	.uleb128 0x14
+	.long	0x182
+	.uleb128 0x27
+	.long	0x16c
+	.long	0x1c9
+	.uleb128 0xc
+	.long	0x19c
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x16c
+	.uleb128 0xc
+	.long	0x46
+	.byte	0
+	.uleb128 0x14
+	.long	0x1a6
+	.uleb128 0x27
+	.long	0x16c
+	.long	0x1f6
+	.uleb128 0xc
+	.long	0x19c
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x16c
+	.uleb128 0xc
+	.long	0x16c
+	.uleb128 0xc
+	.long	0x46
+	.byte	0
+	.uleb128 0x14
+	.long	0x1ce
+	.uleb128 0x2b
+	.long	0x224
+	.uleb128 0xc
+	.long	0x19c
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x178
+	.uleb128 0xc
+	.long	0x19c
+	.uleb128 0xc
+	.long	0x46
+	.uleb128 0xc
+	.long	0x46
+	.byte	0
+	.uleb128 0x14
+	.long	0x1fb
+	.uleb128 0x12
+	.long	.LASF28
+	.byte	0x9
+	.byte	0x32
+	.byte	0x3
+	.long	0xe8
+	.uleb128 0x1a
+	.long	0x229
+	.uleb128 0x13
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF29
+	.uleb128 0x12
+	.long	.LASF30
+	.byte	0x2
+	.byte	0x45
+	.byte	0xf
+	.long	0x252
+	.uleb128 0x1a
+	.long	0x241
+	.uleb128 0x17
+	.long	0x16c
+	.long	0x25e
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF38
+	.byte	0x2
+	.byte	0x48
+	.long	0x252
+	.uleb128 0x12
+	.long	.LASF31
+	.byte	0x2
+	.byte	0x4b
+	.byte	0xf
+	.long	0x275
+	.uleb128 0x17
+	.long	0x16c
+	.long	0x281
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF32
+	.uleb128 0x12
+	.long	.LASF33
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xd
+	.long	0x294
+	.uleb128 0x17
+	.long	0x46
+	.long	0x2a0
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF34
+	.byte	0x3
+	.byte	0x29
+	.byte	0x10
+	.long	0x2ac
+	.uleb128 0x17
+	.long	0x281
+	.long	0x2b8
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF35
+	.byte	0x3
+	.byte	0x2a
+	.byte	0xf
+	.long	0x2c4
+	.uleb128 0x17
+	.long	0x16c
+	.long	0x2d0
+	.uleb128 0x15
+	.byte	0x7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF36
+	.byte	0x3
+	.byte	0x37
+	.byte	0xf
+	.long	0x2e1
+	.uleb128 0x1a
+	.long	0x2d0
+	.uleb128 0x17
+	.long	0x16c
+	.long	0x2ed
+	.uleb128 0x15
+	.byte	0x7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF37
+	.byte	0x3
+	.byte	0x3b
+	.byte	0x10
+	.long	0x2f9
+	.uleb128 0x17
+	.long	0x281
+	.long	0x305
+	.uleb128 0x15
+	.byte	0x3
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF39
+	.byte	0x3
+	.byte	0x3f
+	.long	0x2e1
+	.uleb128 0x12
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x26
+	.byte	0x10
+	.long	0x31c
+	.uleb128 0x17
+	.long	0x281
+	.long	0x328
+	.uleb128 0x15
+	.byte	0x7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x27
+	.byte	0xf
+	.long	0x334
+	.uleb128 0x17
+	.long	0x16c
+	.long	0x340
+	.uleb128 0x15
+	.byte	0xf
+	.byte	0
+	.uleb128 0x17
+	.long	0x16c
+	.long	0x34c
+	.uleb128 0x15
+	.byte	0xf
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x35
+	.byte	0x10
+	.long	0x358
+	.uleb128 0x17
+	.long	0x281
+	.long	0x364
+	.uleb128 0x15
+	.byte	0x7
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x38
+	.long	0x340
+	.uleb128 0x12
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x18
+	.long	0x5b
+	.uleb128 0x12
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x18
+	.long	0x62
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x4
+	.long	.LASF46
+	.uleb128 0x36
+	.long	0x235
+	.long	0x39e
+	.uleb128 0x37
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1a
+	.long	0x38e
+	.uleb128 0x6
+	.long	.LASF47
+	.value	0x2c8
+	.byte	0x1a
+	.long	0x39e
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsKernels
+	.uleb128 0x6
+	.long	.LASF48
+	.value	0x30a
+	.byte	0x1b
+	.long	0x3cf
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsKernelBest
+	.uleb128 0x14
+	.long	0x235
+	.uleb128 0x6
+	.long	.LASF49
+	.value	0x30b
+	.byte	0x17
+	.long	0x98
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsKernelBestOnce
+	.uleb128 0x29
+	.long	.LASF50
+	.byte	0xb
+	.value	0x1fd
+	.byte	0xc
+	.long	0x46
+	.long	0x406
+	.uleb128 0xc
+	.long	0x406
+	.uleb128 0xc
+	.long	0x40b
+	.byte	0
+	.uleb128 0x14
+	.long	0x98
+	.uleb128 0x14
+	.long	0x410
+	.uleb128 0x38
+	.uleb128 0x29
+	.long	.LASF51
+	.byte	0xc
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0x429
+	.uleb128 0xc
+	.long	0xaa
+	.uleb128 0x39
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF52
+	.byte	0xd
+	.byte	0x9c
+	.byte	0xc
+	.long	0x46
+	.long	0x444
+	.uleb128 0xc
+	.long	0xaa
+	.uleb128 0xc
+	.long	0xaa
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF53
+	.byte	0xe
+	.value	0x28e
+	.byte	0xe
+	.long	0x80
+	.long	0x45b
+	.uleb128 0xc
+	.long	0xaa
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF163
+	.byte	0x1
+	.value	0x326
+	.byte	0x14
+	.long	0x3cf
+	.quad	.LFB4863
+	.quad	.LFE4863-.LFB4863
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x3c
+	.long	.LASF58
+	.byte	0x1
+	.value	0x310
+	.byte	0xd
+	.quad	.LFB4862
+	.quad	.LFE4862-.LFB4862
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4b8
+	.uleb128 0x6
+	.long	.LASF54
+	.value	0x312
+	.byte	0x11
+	.long	0xaa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x6
+	.long	.LASF20
+	.value	0x313
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF56
+	.value	0x2ff
+	.byte	0x14
+	.long	0x3cf
+	.quad	.LFB4861
+	.quad	.LFE4861-.LFB4861
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4f9
+	.uleb128 0x4
+	.long	.LASF20
+	.value	0x2ff
+	.byte	0x32
+	.long	0xdc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x6
+	.long	.LASF55
+	.value	0x301
+	.byte	0x18
+	.long	0x3cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF57
+	.value	0x2de
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB4860
+	.quad	.LFE4860-.LFB4860
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x53a
+	.uleb128 0x4
+	.long	.LASF20
+	.value	0x2de
+	.byte	0x2b
+	.long	0xdc
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x6
+	.long	.LASF55
+	.value	0x2e0
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF59
+	.value	0x2a5
+	.quad	.LFB4859
+	.quad	.LFE4859-.LFB4859
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaad
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x2a5
+	.byte	0x32
+	.long	0x19c
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x2a5
+	.byte	0x4d
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x2a5
+	.byte	0x64
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x2a6
+	.byte	0x38
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF64
+	.value	0x2a6
+	.byte	0x45
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x2a6
+	.byte	0x51
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -100
+	.uleb128 0x4
+	.long	.LASF66
+	.value	0x2a6
+	.byte	0x5d
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x16
+	.quad	.LBB1525
+	.quad	.LBE1525-.LBB1525
+	.uleb128 0x3
+	.string	"ch"
+	.value	0x2a8
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2628
+	.uleb128 0x16
+	.quad	.LBB1526
+	.quad	.LBE1526-.LBB1526
+	.uleb128 0x3
+	.string	"g"
+	.value	0x2aa
+	.byte	0x16
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2312
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x2ab
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2504
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x2ac
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2440
+	.uleb128 0x3
+	.string	"k"
+	.value	0x2ad
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2436
+	.uleb128 0xe
+	.quad	.LBB1533
+	.quad	.LBE1533-.LBB1533
+	.long	0x8b0
+	.uleb128 0x6
+	.long	.LASF69
+	.value	0x2b2
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2176
+	.uleb128 0x6
+	.long	.LASF70
+	.value	0x2b3
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2168
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x2b4
+	.byte	0x14
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2056
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x2b5
+	.byte	0x14
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1992
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1534
+	.quad	.LBE1534-.LBB1534
+	.byte	0x1
+	.value	0x2b4
+	.byte	0x19
+	.long	0x6ac
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 760
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1536
+	.quad	.LBE1536-.LBB1536
+	.byte	0x1
+	.value	0x2b4
+	.byte	0x19
+	.long	0x6d3
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 768
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1538
+	.quad	.LBE1538-.LBB1538
+	.byte	0x1
+	.value	0x2b4
+	.byte	0x19
+	.long	0x70c
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 776
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 840
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 904
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1540
+	.quad	.LBE1540-.LBB1540
+	.byte	0x1
+	.value	0x2b5
+	.byte	0x19
+	.long	0x733
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1016
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1542
+	.quad	.LBE1542-.LBB1542
+	.byte	0x1
+	.value	0x2b5
+	.byte	0x19
+	.long	0x75a
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1024
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1544
+	.quad	.LBE1544-.LBB1544
+	.byte	0x1
+	.value	0x2b5
+	.byte	0x19
+	.long	0x793
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1032
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1096
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1160
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1546
+	.quad	.LBE1546-.LBB1546
+	.byte	0x1
+	.value	0x2b6
+	.byte	0xd
+	.long	0x7c3
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1224
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1344
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1548
+	.quad	.LBE1548-.LBB1548
+	.byte	0x1
+	.value	0x2b7
+	.byte	0xd
+	.long	0x7f3
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1352
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1464
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1550
+	.quad	.LBE1550-.LBB1550
+	.byte	0x1
+	.value	0x2b8
+	.byte	0x14
+	.long	0x81a
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1472
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1552
+	.quad	.LBE1552-.LBB1552
+	.byte	0x1
+	.value	0x2b8
+	.byte	0x14
+	.long	0x853
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1480
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1544
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1608
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1554
+	.quad	.LBE1554-.LBB1554
+	.byte	0x1
+	.value	0x2b9
+	.byte	0x14
+	.long	0x87a
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1728
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1556
+	.quad	.LBE1556-.LBB1556
+	.byte	0x1
+	.value	0x2b9
+	.byte	0x14
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1736
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1800
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1864
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1558
+	.quad	.LBE1558-.LBB1558
+	.long	0x9f7
+	.uleb128 0x3
+	.string	"row"
+	.value	0x2bd
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2304
+	.uleb128 0x3
+	.string	"c"
+	.value	0x2be
+	.byte	0x14
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2184
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1559
+	.quad	.LBE1559-.LBB1559
+	.byte	0x1
+	.value	0x2be
+	.byte	0x18
+	.long	0x90a
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 184
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1561
+	.quad	.LBE1561-.LBB1561
+	.byte	0x1
+	.value	0x2be
+	.byte	0x18
+	.long	0x931
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1563
+	.quad	.LBE1563-.LBB1563
+	.byte	0x1
+	.value	0x2be
+	.byte	0x18
+	.long	0x96a
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 200
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 264
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 328
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1565
+	.quad	.LBE1565-.LBB1565
+	.byte	0x1
+	.value	0x2bf
+	.byte	0xd
+	.long	0x99a
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 392
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 504
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1567
+	.quad	.LBE1567-.LBB1567
+	.byte	0x1
+	.value	0x2c0
+	.byte	0x14
+	.long	0x9c1
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 512
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1569
+	.quad	.LBE1569-.LBB1569
+	.byte	0x1
+	.value	0x2c0
+	.byte	0x14
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 520
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 584
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 648
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1527
+	.quad	.LBE1527-.LBB1527
+	.byte	0x1
+	.value	0x2aa
+	.byte	0x1a
+	.long	0xa1e
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1984
+	.byte	0
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1529
+	.quad	.LBE1529-.LBB1529
+	.byte	0x1
+	.value	0x2ab
+	.byte	0x17
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1531
+	.quad	.LBE1531-.LBB1531
+	.byte	0x1
+	.value	0x2ac
+	.byte	0x17
+	.uleb128 0x2
+	.long	0x5cf3
+	.quad	.LBB1571
+	.quad	.LBE1571-.LBB1571
+	.byte	0x1
+	.value	0x2c2
+	.byte	0x9
+	.long	0xa7e
+	.uleb128 0x1
+	.long	0x5d10
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5d03
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0
+	.uleb128 0x7
+	.long	0x5d52
+	.quad	.LBB1573
+	.quad	.LBE1573-.LBB1573
+	.byte	0x1
+	.value	0x2c2
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 72
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 176
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF71
+	.long	0x16c
+	.long	0xabd
+	.uleb128 0x15
+	.byte	0xf
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF71
+	.long	0x16c
+	.long	0xacd
+	.uleb128 0x15
+	.byte	0xf
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF78
+	.value	0x27e
+	.byte	0xe
+	.long	0x16c
+	.quad	.LFB4858
+	.quad	.LFE4858-.LFB4858
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12c3
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x27e
+	.byte	0x33
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x27e
+	.byte	0x4e
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x27e
+	.byte	0x65
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x27f
+	.byte	0x32
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -100
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x27f
+	.byte	0x3c
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -104
+	.uleb128 0x3
+	.string	"g"
+	.value	0x281
+	.byte	0x12
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 4104
+	.uleb128 0x6
+	.long	.LASF72
+	.value	0x282
+	.byte	0x12
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 4040
+	.uleb128 0x6
+	.long	.LASF73
+	.value	0x283
+	.byte	0x12
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3976
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x284
+	.byte	0xc
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 4296
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x285
+	.byte	0xc
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 4232
+	.uleb128 0x3
+	.string	"k"
+	.value	0x286
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 4228
+	.uleb128 0xe
+	.quad	.LBB1461
+	.quad	.LBE1461-.LBB1461
+	.long	0xf09
+	.uleb128 0x3
+	.string	"x0"
+	.value	0x28a
+	.byte	0x16
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3656
+	.uleb128 0x3
+	.string	"x1"
+	.value	0x28b
+	.byte	0x16
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3592
+	.uleb128 0x6
+	.long	.LASF74
+	.value	0x28c
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3528
+	.uleb128 0x6
+	.long	.LASF75
+	.value	0x28d
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3464
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x290
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3400
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x291
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3336
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1462
+	.quad	.LBE1462-.LBB1462
+	.byte	0x1
+	.value	0x28a
+	.byte	0x1b
+	.long	0xc33
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1400
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1464
+	.quad	.LBE1464-.LBB1464
+	.byte	0x1
+	.value	0x28b
+	.byte	0x1b
+	.long	0xc5a
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1408
+	.byte	0
+	.uleb128 0x2
+	.long	0x5dc2
+	.quad	.LBB1466
+	.quad	.LBE1466-.LBB1466
+	.byte	0x1
+	.value	0x28c
+	.byte	0x18
+	.long	0xc93
+	.uleb128 0x1
+	.long	0x5dec
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1416
+	.uleb128 0x1
+	.long	0x5ddf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1542
+	.uleb128 0x1
+	.long	0x5dd2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1544
+	.byte	0
+	.uleb128 0x2
+	.long	0x5dc2
+	.quad	.LBB1468
+	.quad	.LBE1468-.LBB1468
+	.byte	0x1
+	.value	0x28d
+	.byte	0x18
+	.long	0xccc
+	.uleb128 0x1
+	.long	0x5dec
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1608
+	.uleb128 0x1
+	.long	0x5ddf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1734
+	.uleb128 0x1
+	.long	0x5dd2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1736
+	.byte	0
+	.uleb128 0x2
+	.long	0x5dc2
+	.quad	.LBB1470
+	.quad	.LBE1470-.LBB1470
+	.byte	0x1
+	.value	0x28e
+	.byte	0x11
+	.long	0xd05
+	.uleb128 0x1
+	.long	0x5dec
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1800
+	.uleb128 0x1
+	.long	0x5ddf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1926
+	.uleb128 0x1
+	.long	0x5dd2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1928
+	.byte	0
+	.uleb128 0x2
+	.long	0x5dc2
+	.quad	.LBB1472
+	.quad	.LBE1472-.LBB1472
+	.byte	0x1
+	.value	0x28f
+	.byte	0x11
+	.long	0xd3e
+	.uleb128 0x1
+	.long	0x5dec
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1992
+	.uleb128 0x1
+	.long	0x5ddf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2118
+	.uleb128 0x1
+	.long	0x5dd2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2120
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1474
+	.quad	.LBE1474-.LBB1474
+	.byte	0x1
+	.value	0x290
+	.byte	0x15
+	.long	0xd65
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2240
+	.byte	0
+	.uleb128 0x2
+	.long	0x5cf3
+	.quad	.LBB1476
+	.quad	.LBE1476-.LBB1476
+	.byte	0x1
+	.value	0x290
+	.byte	0x15
+	.long	0xd95
+	.uleb128 0x1
+	.long	0x5d10
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2248
+	.uleb128 0x1
+	.long	0x5d03
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2312
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1478
+	.quad	.LBE1478-.LBB1478
+	.byte	0x1
+	.value	0x291
+	.byte	0x15
+	.long	0xdbc
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2432
+	.byte	0
+	.uleb128 0x2
+	.long	0x5cf3
+	.quad	.LBB1480
+	.quad	.LBE1480-.LBB1480
+	.byte	0x1
+	.value	0x291
+	.byte	0x15
+	.long	0xdec
+	.uleb128 0x1
+	.long	0x5d10
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2440
+	.uleb128 0x1
+	.long	0x5d03
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2504
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1482
+	.quad	.LBE1482-.LBB1482
+	.byte	0x1
+	.value	0x292
+	.byte	0x9
+	.long	0xe1c
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2568
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2688
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1484
+	.quad	.LBE1484-.LBB1484
+	.byte	0x1
+	.value	0x293
+	.byte	0x9
+	.long	0xe4c
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2696
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2808
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1486
+	.quad	.LBE1486-.LBB1486
+	.byte	0x1
+	.value	0x294
+	.byte	0x10
+	.long	0xe73
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2816
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1488
+	.quad	.LBE1488-.LBB1488
+	.byte	0x1
+	.value	0x294
+	.byte	0x10
+	.long	0xeac
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2824
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2888
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2952
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1490
+	.quad	.LBE1490-.LBB1490
+	.byte	0x1
+	.value	0x295
+	.byte	0x10
+	.long	0xed3
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3072
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1492
+	.quad	.LBE1492-.LBB1492
+	.byte	0x1
+	.value	0x295
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3080
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3144
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3208
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1494
+	.quad	.LBE1494-.LBB1494
+	.long	0x1146
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x299
+	.byte	0x13
+	.long	0x37b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3974
+	.uleb128 0x3
+	.string	"x"
+	.value	0x29a
+	.byte	0x16
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3848
+	.uleb128 0x6
+	.long	.LASF77
+	.value	0x29b
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3784
+	.uleb128 0x3
+	.string	"c"
+	.value	0x29d
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3720
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1495
+	.quad	.LBE1495-.LBB1495
+	.byte	0x1
+	.value	0x29a
+	.byte	0x1a
+	.long	0xfa3
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 440
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 454
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1497
+	.quad	.LBE1497-.LBB1497
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5dc2
+	.quad	.LBB1499
+	.quad	.LBE1499-.LBB1499
+	.byte	0x1
+	.value	0x29b
+	.byte	0x17
+	.long	0xfdc
+	.uleb128 0x1
+	.long	0x5dec
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 456
+	.uleb128 0x1
+	.long	0x5ddf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 582
+	.uleb128 0x1
+	.long	0x5dd2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 584
+	.byte	0
+	.uleb128 0x2
+	.long	0x5dc2
+	.quad	.LBB1501
+	.quad	.LBE1501-.LBB1501
+	.byte	0x1
+	.value	0x29c
+	.byte	0x10
+	.long	0x1015
+	.uleb128 0x1
+	.long	0x5dec
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 648
+	.uleb128 0x1
+	.long	0x5ddf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 774
+	.uleb128 0x1
+	.long	0x5dd2
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 776
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1503
+	.quad	.LBE1503-.LBB1503
+	.byte	0x1
+	.value	0x29d
+	.byte	0x14
+	.long	0x105e
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 888
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 902
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1505
+	.quad	.LBE1505-.LBB1505
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5cf3
+	.quad	.LBB1507
+	.quad	.LBE1507-.LBB1507
+	.byte	0x1
+	.value	0x29d
+	.byte	0x14
+	.long	0x108e
+	.uleb128 0x1
+	.long	0x5d10
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 904
+	.uleb128 0x1
+	.long	0x5d03
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 968
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d1e
+	.quad	.LBB1509
+	.quad	.LBE1509-.LBB1509
+	.byte	0x1
+	.value	0x29e
+	.byte	0x9
+	.long	0x10c7
+	.uleb128 0x1
+	.long	0x5d44
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1032
+	.uleb128 0x1
+	.long	0x5d37
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1134
+	.uleb128 0x1
+	.long	0x5d2a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1136
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1511
+	.quad	.LBE1511-.LBB1511
+	.byte	0x1
+	.value	0x29f
+	.byte	0x10
+	.long	0x1110
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1144
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1158
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1513
+	.quad	.LBE1513-.LBB1513
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1515
+	.quad	.LBE1515-.LBB1515
+	.byte	0x1
+	.value	0x29f
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1160
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1224
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1288
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e06
+	.quad	.LBB1451
+	.quad	.LBE1451-.LBB1451
+	.byte	0x1
+	.value	0x281
+	.byte	0x16
+	.long	0x116d
+	.uleb128 0x1
+	.long	0x5e15
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3328
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e06
+	.quad	.LBB1453
+	.quad	.LBE1453-.LBB1453
+	.byte	0x1
+	.value	0x282
+	.byte	0x21
+	.long	0x1194
+	.uleb128 0x1
+	.long	0x5e15
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3332
+	.byte	0
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1455
+	.quad	.LBE1455-.LBB1455
+	.byte	0x1
+	.value	0x283
+	.byte	0x19
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1457
+	.quad	.LBE1457-.LBB1457
+	.byte	0x1
+	.value	0x284
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1459
+	.quad	.LBE1459-.LBB1459
+	.byte	0x1
+	.value	0x285
+	.byte	0x13
+	.uleb128 0x2
+	.long	0x5cf3
+	.quad	.LBB1517
+	.quad	.LBE1517-.LBB1517
+	.byte	0x1
+	.value	0x2a1
+	.byte	0xc
+	.long	0x120d
+	.uleb128 0x1
+	.long	0x5d10
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5d03
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c2a
+	.quad	.LBB1519
+	.quad	.LBE1519-.LBB1519
+	.byte	0x1
+	.value	0x2a1
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x5c3a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 328
+	.uleb128 0x9
+	.long	0x5c47
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 264
+	.uleb128 0x9
+	.long	0x5c50
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 200
+	.uleb128 0x9
+	.long	0x5c59
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 168
+	.uleb128 0x9
+	.long	0x5c62
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 152
+	.uleb128 0x9
+	.long	0x5c6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.uleb128 0x9
+	.long	0x5c74
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 120
+	.uleb128 0x9
+	.long	0x5c7d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 104
+	.uleb128 0x9
+	.long	0x5c86
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.uleb128 0x2
+	.long	0x5e6a
+	.quad	.LBB1521
+	.quad	.LBE1521-.LBB1521
+	.byte	0x6
+	.value	0x3f29
+	.byte	0x3
+	.long	0x129e
+	.uleb128 0x9
+	.long	0x5e7a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 296
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e6a
+	.quad	.LBB1523
+	.quad	.LBE1523-.LBB1523
+	.byte	0x6
+	.value	0x3f29
+	.byte	0x3
+	.uleb128 0x9
+	.long	0x5e7a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 232
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF79
+	.value	0x25d
+	.byte	0xe
+	.long	0x16c
+	.quad	.LFB4857
+	.quad	.LFE4857-.LFB4857
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1997
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x25d
+	.byte	0x34
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x25d
+	.byte	0x4f
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x25d
+	.byte	0x66
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x25e
+	.byte	0x33
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -100
+	.uleb128 0x4
+	.long	.LASF80
+	.value	0x25e
+	.byte	0x3f
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -104
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x25e
+	.byte	0x49
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -108
+	.uleb128 0x3
+	.string	"g"
+	.value	0x260
+	.byte	0x12
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3144
+	.uleb128 0x3
+	.string	"l"
+	.value	0x261
+	.byte	0x12
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3080
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x262
+	.byte	0xc
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3336
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x263
+	.byte	0xc
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3272
+	.uleb128 0x3
+	.string	"k"
+	.value	0x264
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3268
+	.uleb128 0xe
+	.quad	.LBB1393
+	.quad	.LBE1393-.LBB1393
+	.long	0x164d
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x268
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2888
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x269
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2824
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1394
+	.quad	.LBE1394-.LBB1394
+	.byte	0x1
+	.value	0x268
+	.byte	0x15
+	.long	0x13e9
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1216
+	.byte	0
+	.uleb128 0x2
+	.long	0x5cc8
+	.quad	.LBB1396
+	.quad	.LBE1396-.LBB1396
+	.byte	0x1
+	.value	0x268
+	.byte	0x15
+	.long	0x1419
+	.uleb128 0x1
+	.long	0x5ce5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1224
+	.uleb128 0x1
+	.long	0x5cd8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1288
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1398
+	.quad	.LBE1398-.LBB1398
+	.byte	0x1
+	.value	0x269
+	.byte	0x15
+	.long	0x1440
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1408
+	.byte	0
+	.uleb128 0x2
+	.long	0x5cc8
+	.quad	.LBB1400
+	.quad	.LBE1400-.LBB1400
+	.byte	0x1
+	.value	0x269
+	.byte	0x15
+	.long	0x1470
+	.uleb128 0x1
+	.long	0x5ce5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1416
+	.uleb128 0x1
+	.long	0x5cd8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1480
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1402
+	.quad	.LBE1402-.LBB1402
+	.byte	0x1
+	.value	0x26a
+	.byte	0xe
+	.long	0x1497
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1600
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1404
+	.quad	.LBE1404-.LBB1404
+	.byte	0x1
+	.value	0x26a
+	.byte	0xe
+	.long	0x14d0
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1608
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1672
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1736
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1406
+	.quad	.LBE1406-.LBB1406
+	.byte	0x1
+	.value	0x26b
+	.byte	0xe
+	.long	0x14f7
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1856
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1408
+	.quad	.LBE1408-.LBB1408
+	.byte	0x1
+	.value	0x26b
+	.byte	0xe
+	.long	0x1530
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1864
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1928
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1992
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1410
+	.quad	.LBE1410-.LBB1410
+	.byte	0x1
+	.value	0x26c
+	.byte	0x9
+	.long	0x1560
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2056
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2176
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1412
+	.quad	.LBE1412-.LBB1412
+	.byte	0x1
+	.value	0x26d
+	.byte	0x9
+	.long	0x1590
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2184
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2296
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1414
+	.quad	.LBE1414-.LBB1414
+	.byte	0x1
+	.value	0x26e
+	.byte	0x10
+	.long	0x15b7
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2304
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1416
+	.quad	.LBE1416-.LBB1416
+	.byte	0x1
+	.value	0x26e
+	.byte	0x10
+	.long	0x15f0
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2312
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2376
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2440
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1418
+	.quad	.LBE1418-.LBB1418
+	.byte	0x1
+	.value	0x26f
+	.byte	0x10
+	.long	0x1617
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2560
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1420
+	.quad	.LBE1420-.LBB1420
+	.byte	0x1
+	.value	0x26f
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2568
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2632
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2696
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1422
+	.quad	.LBE1422-.LBB1422
+	.long	0x1833
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x274
+	.byte	0x13
+	.long	0x37b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3078
+	.uleb128 0x3
+	.string	"c"
+	.value	0x275
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2952
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1423
+	.quad	.LBE1423-.LBB1423
+	.byte	0x1
+	.value	0x275
+	.byte	0x14
+	.long	0x16c9
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 440
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 454
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1425
+	.quad	.LBE1425-.LBB1425
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5cc8
+	.quad	.LBB1427
+	.quad	.LBE1427-.LBB1427
+	.byte	0x1
+	.value	0x275
+	.byte	0x14
+	.long	0x16f9
+	.uleb128 0x1
+	.long	0x5ce5
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 456
+	.uleb128 0x1
+	.long	0x5cd8
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 520
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1429
+	.quad	.LBE1429-.LBB1429
+	.byte	0x1
+	.value	0x276
+	.byte	0xd
+	.long	0x1742
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 632
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 646
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1431
+	.quad	.LBE1431-.LBB1431
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1433
+	.quad	.LBE1433-.LBB1433
+	.byte	0x1
+	.value	0x276
+	.byte	0xd
+	.long	0x177b
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 648
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 712
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 776
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d1e
+	.quad	.LBB1435
+	.quad	.LBE1435-.LBB1435
+	.byte	0x1
+	.value	0x277
+	.byte	0x9
+	.long	0x17b4
+	.uleb128 0x1
+	.long	0x5d44
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 840
+	.uleb128 0x1
+	.long	0x5d37
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 942
+	.uleb128 0x1
+	.long	0x5d2a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 944
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1437
+	.quad	.LBE1437-.LBB1437
+	.byte	0x1
+	.value	0x278
+	.byte	0x10
+	.long	0x17fd
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 952
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 966
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1439
+	.quad	.LBE1439-.LBB1439
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1441
+	.quad	.LBE1441-.LBB1441
+	.byte	0x1
+	.value	0x278
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 968
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1032
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1096
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e06
+	.quad	.LBB1385
+	.quad	.LBE1385-.LBB1385
+	.byte	0x1
+	.value	0x260
+	.byte	0x16
+	.long	0x185a
+	.uleb128 0x1
+	.long	0x5e15
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2816
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e06
+	.quad	.LBB1387
+	.quad	.LBE1387-.LBB1387
+	.byte	0x1
+	.value	0x261
+	.byte	0x16
+	.long	0x1881
+	.uleb128 0x1
+	.long	0x5e15
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2820
+	.byte	0
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1389
+	.quad	.LBE1389-.LBB1389
+	.byte	0x1
+	.value	0x262
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1391
+	.quad	.LBE1391-.LBB1391
+	.byte	0x1
+	.value	0x263
+	.byte	0x13
+	.uleb128 0x2
+	.long	0x5cf3
+	.quad	.LBB1443
+	.quad	.LBE1443-.LBB1443
+	.byte	0x1
+	.value	0x27a
+	.byte	0xc
+	.long	0x18e1
+	.uleb128 0x1
+	.long	0x5d10
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5d03
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c2a
+	.quad	.LBB1445
+	.quad	.LBE1445-.LBB1445
+	.byte	0x1
+	.value	0x27a
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x5c3a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 328
+	.uleb128 0x9
+	.long	0x5c47
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 264
+	.uleb128 0x9
+	.long	0x5c50
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 200
+	.uleb128 0x9
+	.long	0x5c59
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 168
+	.uleb128 0x9
+	.long	0x5c62
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 152
+	.uleb128 0x9
+	.long	0x5c6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.uleb128 0x9
+	.long	0x5c74
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 120
+	.uleb128 0x9
+	.long	0x5c7d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 104
+	.uleb128 0x9
+	.long	0x5c86
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.uleb128 0x2
+	.long	0x5e6a
+	.quad	.LBB1447
+	.quad	.LBE1447-.LBB1447
+	.byte	0x6
+	.value	0x3f29
+	.byte	0x3
+	.long	0x1972
+	.uleb128 0x9
+	.long	0x5e7a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 296
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e6a
+	.quad	.LBB1449
+	.quad	.LBE1449-.LBB1449
+	.byte	0x6
+	.value	0x3f29
+	.byte	0x3
+	.uleb128 0x9
+	.long	0x5e7a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 232
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF81
+	.value	0x237
+	.byte	0xe
+	.long	0x16c
+	.quad	.LFB4856
+	.quad	.LFE4856-.LFB4856
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x20cd
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x237
+	.byte	0x2f
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x237
+	.byte	0x4a
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x237
+	.byte	0x61
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x238
+	.byte	0x2e
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -100
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x238
+	.byte	0x38
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -104
+	.uleb128 0x3
+	.string	"g"
+	.value	0x23a
+	.byte	0x12
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3144
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x23b
+	.byte	0xc
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3336
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x23c
+	.byte	0xc
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3272
+	.uleb128 0x3
+	.string	"k"
+	.value	0x23d
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3268
+	.uleb128 0xe
+	.quad	.LBB1320
+	.quad	.LBE1320-.LBB1320
+	.long	0x1ca3
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x241
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2888
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x242
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2824
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1321
+	.quad	.LBE1321-.LBB1321
+	.byte	0x1
+	.value	0x241
+	.byte	0x15
+	.long	0x1a9f
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1584
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1323
+	.quad	.LBE1323-.LBB1323
+	.byte	0x1
+	.value	0x242
+	.byte	0x15
+	.long	0x1ac6
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1592
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1325
+	.quad	.LBE1325-.LBB1325
+	.byte	0x1
+	.value	0x243
+	.byte	0xe
+	.long	0x1aed
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1600
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1327
+	.quad	.LBE1327-.LBB1327
+	.byte	0x1
+	.value	0x243
+	.byte	0xe
+	.long	0x1b26
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1608
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1672
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1736
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1329
+	.quad	.LBE1329-.LBB1329
+	.byte	0x1
+	.value	0x244
+	.byte	0xe
+	.long	0x1b4d
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1856
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1331
+	.quad	.LBE1331-.LBB1331
+	.byte	0x1
+	.value	0x244
+	.byte	0xe
+	.long	0x1b86
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1864
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1928
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1992
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1333
+	.quad	.LBE1333-.LBB1333
+	.byte	0x1
+	.value	0x245
+	.byte	0x9
+	.long	0x1bb6
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2056
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2176
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1335
+	.quad	.LBE1335-.LBB1335
+	.byte	0x1
+	.value	0x246
+	.byte	0x9
+	.long	0x1be6
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2184
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2296
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1337
+	.quad	.LBE1337-.LBB1337
+	.byte	0x1
+	.value	0x247
+	.byte	0x10
+	.long	0x1c0d
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2304
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1339
+	.quad	.LBE1339-.LBB1339
+	.byte	0x1
+	.value	0x247
+	.byte	0x10
+	.long	0x1c46
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2312
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2376
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2440
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1341
+	.quad	.LBE1341-.LBB1341
+	.byte	0x1
+	.value	0x248
+	.byte	0x10
+	.long	0x1c6d
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2560
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1343
+	.quad	.LBE1343-.LBB1343
+	.byte	0x1
+	.value	0x248
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2568
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2632
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2696
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1345
+	.quad	.LBE1345-.LBB1345
+	.long	0x1dda
+	.uleb128 0x3
+	.string	"c"
+	.value	0x24c
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2952
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1346
+	.quad	.LBE1346-.LBB1346
+	.byte	0x1
+	.value	0x24c
+	.byte	0x14
+	.long	0x1ced
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1016
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1348
+	.quad	.LBE1348-.LBB1348
+	.byte	0x1
+	.value	0x24d
+	.byte	0xd
+	.long	0x1d14
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1024
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1350
+	.quad	.LBE1350-.LBB1350
+	.byte	0x1
+	.value	0x24d
+	.byte	0xd
+	.long	0x1d4d
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1032
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1096
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1160
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d52
+	.quad	.LBB1352
+	.quad	.LBE1352-.LBB1352
+	.byte	0x1
+	.value	0x24e
+	.byte	0x9
+	.long	0x1d7d
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1224
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1336
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1354
+	.quad	.LBE1354-.LBB1354
+	.byte	0x1
+	.value	0x24f
+	.byte	0x10
+	.long	0x1da4
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1344
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1356
+	.quad	.LBE1356-.LBB1356
+	.byte	0x1
+	.value	0x24f
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1352
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1416
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1480
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1358
+	.quad	.LBE1358-.LBB1358
+	.long	0x1f90
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x253
+	.byte	0x13
+	.long	0x37b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3142
+	.uleb128 0x3
+	.string	"c"
+	.value	0x254
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 3016
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1359
+	.quad	.LBE1359-.LBB1359
+	.byte	0x1
+	.value	0x254
+	.byte	0x14
+	.long	0x1e56
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 424
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 438
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1361
+	.quad	.LBE1361-.LBB1361
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1363
+	.quad	.LBE1363-.LBB1363
+	.byte	0x1
+	.value	0x255
+	.byte	0xd
+	.long	0x1e9f
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 440
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 454
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1365
+	.quad	.LBE1365-.LBB1365
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1367
+	.quad	.LBE1367-.LBB1367
+	.byte	0x1
+	.value	0x255
+	.byte	0xd
+	.long	0x1ed8
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 456
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 520
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 584
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d1e
+	.quad	.LBB1369
+	.quad	.LBE1369-.LBB1369
+	.byte	0x1
+	.value	0x256
+	.byte	0x9
+	.long	0x1f11
+	.uleb128 0x1
+	.long	0x5d44
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 648
+	.uleb128 0x1
+	.long	0x5d37
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 750
+	.uleb128 0x1
+	.long	0x5d2a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 752
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1371
+	.quad	.LBE1371-.LBB1371
+	.byte	0x1
+	.value	0x257
+	.byte	0x10
+	.long	0x1f5a
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 760
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 774
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1373
+	.quad	.LBE1373-.LBB1373
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1375
+	.quad	.LBE1375-.LBB1375
+	.byte	0x1
+	.value	0x257
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 776
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 840
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 904
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e06
+	.quad	.LBB1314
+	.quad	.LBE1314-.LBB1314
+	.byte	0x1
+	.value	0x23a
+	.byte	0x16
+	.long	0x1fb7
+	.uleb128 0x1
+	.long	0x5e15
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 2820
+	.byte	0
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1316
+	.quad	.LBE1316-.LBB1316
+	.byte	0x1
+	.value	0x23b
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1318
+	.quad	.LBE1318-.LBB1318
+	.byte	0x1
+	.value	0x23c
+	.byte	0x13
+	.uleb128 0x2
+	.long	0x5cf3
+	.quad	.LBB1377
+	.quad	.LBE1377-.LBB1377
+	.byte	0x1
+	.value	0x259
+	.byte	0xc
+	.long	0x2017
+	.uleb128 0x1
+	.long	0x5d10
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5d03
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c2a
+	.quad	.LBB1379
+	.quad	.LBE1379-.LBB1379
+	.byte	0x1
+	.value	0x259
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x5c3a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 328
+	.uleb128 0x9
+	.long	0x5c47
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 264
+	.uleb128 0x9
+	.long	0x5c50
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 200
+	.uleb128 0x9
+	.long	0x5c59
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 168
+	.uleb128 0x9
+	.long	0x5c62
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 152
+	.uleb128 0x9
+	.long	0x5c6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.uleb128 0x9
+	.long	0x5c74
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 120
+	.uleb128 0x9
+	.long	0x5c7d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 104
+	.uleb128 0x9
+	.long	0x5c86
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.uleb128 0x2
+	.long	0x5e6a
+	.quad	.LBB1381
+	.quad	.LBE1381-.LBB1381
+	.byte	0x6
+	.value	0x3f29
+	.byte	0x3
+	.long	0x20a8
+	.uleb128 0x9
+	.long	0x5e7a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 296
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e6a
+	.quad	.LBB1383
+	.quad	.LBE1383-.LBB1383
+	.byte	0x6
+	.value	0x3f29
+	.byte	0x3
+	.uleb128 0x9
+	.long	0x5e7a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 232
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF82
+	.value	0x222
+	.quad	.LFB4855
+	.quad	.LFE4855-.LFB4855
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2372
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x222
+	.byte	0x2b
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF83
+	.value	0x222
+	.byte	0x46
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -104
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x222
+	.byte	0x53
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -108
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x222
+	.byte	0x5d
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -112
+	.uleb128 0x3
+	.string	"g"
+	.value	0x224
+	.byte	0x12
+	.long	0xaad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 776
+	.uleb128 0x3
+	.string	"k"
+	.value	0x225
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 900
+	.uleb128 0xe
+	.quad	.LBB1292
+	.quad	.LBE1292-.LBB1292
+	.long	0x221d
+	.uleb128 0x3
+	.string	"c"
+	.value	0x229
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 584
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1293
+	.quad	.LBE1293-.LBB1293
+	.byte	0x1
+	.value	0x229
+	.byte	0x14
+	.long	0x2190
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 248
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1295
+	.quad	.LBE1295-.LBB1295
+	.byte	0x1
+	.value	0x22a
+	.byte	0xd
+	.long	0x21b7
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 256
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1297
+	.quad	.LBE1297-.LBB1297
+	.byte	0x1
+	.value	0x22a
+	.byte	0xd
+	.long	0x21f0
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 264
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 328
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 392
+	.byte	0
+	.uleb128 0x7
+	.long	0x5d52
+	.quad	.LBB1299
+	.quad	.LBE1299-.LBB1299
+	.byte	0x1
+	.value	0x22b
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x5d6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 456
+	.uleb128 0x1
+	.long	0x5d5e
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 568
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1301
+	.quad	.LBE1301-.LBB1301
+	.long	0x234e
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x22f
+	.byte	0x13
+	.long	0x37b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 774
+	.uleb128 0x3
+	.string	"c"
+	.value	0x230
+	.byte	0x10
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 648
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1302
+	.quad	.LBE1302-.LBB1302
+	.byte	0x1
+	.value	0x230
+	.byte	0x14
+	.long	0x2299
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -74
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1304
+	.quad	.LBE1304-.LBB1304
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1306
+	.quad	.LBE1306-.LBB1306
+	.byte	0x1
+	.value	0x231
+	.byte	0xd
+	.long	0x22e1
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -58
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1308
+	.quad	.LBE1308-.LBB1308
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1310
+	.quad	.LBE1310-.LBB1310
+	.byte	0x1
+	.value	0x231
+	.byte	0xd
+	.long	0x2318
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 72
+	.byte	0
+	.uleb128 0x7
+	.long	0x5d1e
+	.quad	.LBB1312
+	.quad	.LBE1312-.LBB1312
+	.byte	0x1
+	.value	0x232
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x5d44
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.uleb128 0x1
+	.long	0x5d37
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 238
+	.uleb128 0x1
+	.long	0x5d2a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 240
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e06
+	.quad	.LBB1290
+	.quad	.LBE1290-.LBB1290
+	.byte	0x1
+	.value	0x224
+	.byte	0x16
+	.uleb128 0x1
+	.long	0x5e15
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 580
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF84
+	.value	0x209
+	.byte	0xe
+	.long	0x16c
+	.quad	.LFB4854
+	.quad	.LFE4854-.LFB4854
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2786
+	.uleb128 0x1f
+	.string	"a"
+	.value	0x209
+	.byte	0x2f
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.uleb128 0x1f
+	.string	"b"
+	.value	0x209
+	.byte	0x3f
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x209
+	.byte	0x46
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -92
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x20b
+	.byte	0xc
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1544
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x20c
+	.byte	0xc
+	.long	0xabd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1480
+	.uleb128 0x3
+	.string	"k"
+	.value	0x20d
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1476
+	.uleb128 0xe
+	.quad	.LBB1271
+	.quad	.LBE1271-.LBB1271
+	.long	0x24db
+	.uleb128 0x6
+	.long	.LASF76
+	.value	0x21b
+	.byte	0x13
+	.long	0x37b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1474
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1272
+	.quad	.LBE1272-.LBB1272
+	.byte	0x1
+	.value	0x21c
+	.byte	0x10
+	.long	0x245c
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 424
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 438
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1274
+	.quad	.LBE1274-.LBB1274
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x2
+	.long	0x5d79
+	.quad	.LBB1276
+	.quad	.LBE1276-.LBB1276
+	.byte	0x1
+	.value	0x21c
+	.byte	0x10
+	.long	0x24a5
+	.uleb128 0x1
+	.long	0x5d96
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 440
+	.uleb128 0x1
+	.long	0x5d89
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 454
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1278
+	.quad	.LBE1278-.LBB1278
+	.byte	0x6
+	.value	0x18cf
+	.byte	0x9
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c90
+	.quad	.LBB1280
+	.quad	.LBE1280-.LBB1280
+	.byte	0x1
+	.value	0x21c
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 456
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 520
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 584
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1249
+	.quad	.LBE1249-.LBB1249
+	.byte	0x1
+	.value	0x20b
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x5dfa
+	.quad	.LBB1251
+	.quad	.LBE1251-.LBB1251
+	.byte	0x1
+	.value	0x20c
+	.byte	0x13
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1253
+	.quad	.LBE1253-.LBB1253
+	.byte	0x1
+	.value	0x211
+	.byte	0x10
+	.long	0x2534
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 952
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1255
+	.quad	.LBE1255-.LBB1255
+	.byte	0x1
+	.value	0x211
+	.byte	0x10
+	.long	0x255b
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 960
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1257
+	.quad	.LBE1257-.LBB1257
+	.byte	0x1
+	.value	0x211
+	.byte	0x10
+	.long	0x2594
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 968
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1032
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1096
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1259
+	.quad	.LBE1259-.LBB1259
+	.byte	0x1
+	.value	0x212
+	.byte	0x10
+	.long	0x25bb
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1208
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1261
+	.quad	.LBE1261-.LBB1261
+	.byte	0x1
+	.value	0x212
+	.byte	0x10
+	.long	0x25e2
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1216
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1263
+	.quad	.LBE1263-.LBB1263
+	.byte	0x1
+	.value	0x212
+	.byte	0x10
+	.long	0x261b
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1224
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1288
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 1352
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1265
+	.quad	.LBE1265-.LBB1265
+	.byte	0x1
+	.value	0x216
+	.byte	0x10
+	.long	0x2642
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 696
+	.byte	0
+	.uleb128 0x2
+	.long	0x5da4
+	.quad	.LBB1267
+	.quad	.LBE1267-.LBB1267
+	.byte	0x1
+	.value	0x216
+	.byte	0x10
+	.long	0x2669
+	.uleb128 0x1
+	.long	0x5db4
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 704
+	.byte	0
+	.uleb128 0x2
+	.long	0x5c90
+	.quad	.LBB1269
+	.quad	.LBE1269-.LBB1269
+	.byte	0x1
+	.value	0x216
+	.byte	0x10
+	.long	0x26a2
+	.uleb128 0x1
+	.long	0x5cba
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 712
+	.uleb128 0x1
+	.long	0x5cad
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 776
+	.uleb128 0x1
+	.long	0x5ca0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 840
+	.byte	0
+	.uleb128 0x2
+	.long	0x5cf3
+	.quad	.LBB1282
+	.quad	.LBE1282-.LBB1282
+	.byte	0x1
+	.value	0x21e
+	.byte	0xc
+	.long	0x26d0
+	.uleb128 0x1
+	.long	0x5d10
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5d03
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0
+	.uleb128 0x7
+	.long	0x5c2a
+	.quad	.LBB1284
+	.quad	.LBE1284-.LBB1284
+	.byte	0x1
+	.value	0x21e
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x5c3a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 328
+	.uleb128 0x9
+	.long	0x5c47
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 264
+	.uleb128 0x9
+	.long	0x5c50
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 200
+	.uleb128 0x9
+	.long	0x5c59
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 168
+	.uleb128 0x9
+	.long	0x5c62
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 152
+	.uleb128 0x9
+	.long	0x5c6b
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.uleb128 0x9
+	.long	0x5c74
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 120
+	.uleb128 0x9
+	.long	0x5c7d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 104
+	.uleb128 0x9
+	.long	0x5c86
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.uleb128 0x2
+	.long	0x5e6a
+	.quad	.LBB1286
+	.quad	.LBE1286-.LBB1286
+	.byte	0x6
+	.value	0x3f29
+	.byte	0x3
+	.long	0x2761
+	.uleb128 0x9
+	.long	0x5e7a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 296
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e6a
+	.quad	.LBB1288
+	.quad	.LBE1288-.LBB1288
+	.byte	0x6
+	.value	0x3f29
+	.byte	0x3
+	.uleb128 0x9
+	.long	0x5e7a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 232
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF85
+	.value	0x1eb
+	.quad	.LFB4853
+	.quad	.LFE4853-.LFB4853
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2be8
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x1eb
+	.byte	0x30
+	.long	0x19c
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x1eb
+	.byte	0x4b
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x1eb
+	.byte	0x62
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x1ec
+	.byte	0x36
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF64
+	.value	0x1ec
+	.byte	0x43
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x1ec
+	.byte	0x4f
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -100
+	.uleb128 0x4
+	.long	.LASF66
+	.value	0x1ec
+	.byte	0x5b
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x16
+	.quad	.LBB1209
+	.quad	.LBE1209-.LBB1209
+	.uleb128 0x3
+	.string	"ch"
+	.value	0x1ee
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 964
+	.uleb128 0x16
+	.quad	.LBB1210
+	.quad	.LBE1210-.LBB1210
+	.uleb128 0x3
+	.string	"g0"
+	.value	0x1f0
+	.byte	0x16
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 808
+	.uleb128 0x3
+	.string	"g1"
+	.value	0x1f1
+	.byte	0x16
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 776
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x1f2
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 904
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x1f3
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 872
+	.uleb128 0xe
+	.quad	.LBB1219
+	.quad	.LBE1219-.LBB1219
+	.long	0x2b0d
+	.uleb128 0x3
+	.string	"k"
+	.value	0x1f5
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 868
+	.uleb128 0x16
+	.quad	.LBB1220
+	.quad	.LBE1220-.LBB1220
+	.uleb128 0x3
+	.string	"row"
+	.value	0x1f7
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 768
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x1f8
+	.byte	0x14
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 712
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x1f9
+	.byte	0x14
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 680
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1221
+	.quad	.LBE1221-.LBB1221
+	.byte	0x1
+	.value	0x1f8
+	.byte	0x19
+	.long	0x2908
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1223
+	.quad	.LBE1223-.LBB1223
+	.byte	0x1
+	.value	0x1f8
+	.byte	0x19
+	.long	0x292f
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 64
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1225
+	.quad	.LBE1225-.LBB1225
+	.byte	0x1
+	.value	0x1f8
+	.byte	0x19
+	.long	0x2968
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 72
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 104
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1227
+	.quad	.LBE1227-.LBB1227
+	.byte	0x1
+	.value	0x1f9
+	.byte	0x19
+	.long	0x298f
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 184
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1229
+	.quad	.LBE1229-.LBB1229
+	.byte	0x1
+	.value	0x1f9
+	.byte	0x19
+	.long	0x29b6
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 192
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1231
+	.quad	.LBE1231-.LBB1231
+	.byte	0x1
+	.value	0x1f9
+	.byte	0x19
+	.long	0x29ef
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 200
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 232
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 264
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1233
+	.quad	.LBE1233-.LBB1233
+	.byte	0x1
+	.value	0x1fa
+	.byte	0xd
+	.long	0x2a1f
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 296
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 352
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1235
+	.quad	.LBE1235-.LBB1235
+	.byte	0x1
+	.value	0x1fb
+	.byte	0xd
+	.long	0x2a4f
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 360
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 408
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1237
+	.quad	.LBE1237-.LBB1237
+	.byte	0x1
+	.value	0x1fc
+	.byte	0x14
+	.long	0x2a76
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 416
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1239
+	.quad	.LBE1239-.LBB1239
+	.byte	0x1
+	.value	0x1fc
+	.byte	0x14
+	.long	0x2aaf
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 424
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 456
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 488
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1241
+	.quad	.LBE1241-.LBB1241
+	.byte	0x1
+	.value	0x1fd
+	.byte	0x14
+	.long	0x2ad6
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 544
+	.byte	0
+	.uleb128 0x7
+	.long	0x5bf6
+	.quad	.LBB1243
+	.quad	.LBE1243-.LBB1243
+	.byte	0x1
+	.value	0x1fd
+	.byte	0x14
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 552
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 584
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 616
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1211
+	.quad	.LBE1211-.LBB1211
+	.byte	0x1
+	.value	0x1f0
+	.byte	0x1b
+	.long	0x2b34
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 664
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1213
+	.quad	.LBE1213-.LBB1213
+	.byte	0x1
+	.value	0x1f1
+	.byte	0x1b
+	.long	0x2b5b
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 672
+	.byte	0
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1215
+	.quad	.LBE1215-.LBB1215
+	.byte	0x1
+	.value	0x1f2
+	.byte	0x17
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1217
+	.quad	.LBE1217-.LBB1217
+	.byte	0x1
+	.value	0x1f3
+	.byte	0x17
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1245
+	.quad	.LBE1245-.LBB1245
+	.byte	0x1
+	.value	0x1ff
+	.byte	0x9
+	.long	0x2bbb
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 0
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e88
+	.quad	.LBB1247
+	.quad	.LBE1247-.LBB1247
+	.byte	0x1
+	.value	0x200
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 48
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF86
+	.value	0x1c7
+	.long	0x16c
+	.quad	.LFB4852
+	.quad	.LFE4852-.LFB4852
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x30a4
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x1c7
+	.byte	0x31
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1144
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x1c7
+	.byte	0x4c
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1152
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x1c7
+	.byte	0x63
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1160
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x1c8
+	.byte	0x30
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1164
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x1c8
+	.byte	0x3a
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1168
+	.uleb128 0x3
+	.string	"g"
+	.value	0x1ca
+	.byte	0x12
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -144
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x1cb
+	.byte	0xc
+	.long	0x2d0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x1cc
+	.byte	0xc
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -80
+	.uleb128 0x3
+	.string	"k"
+	.value	0x1cd
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -84
+	.uleb128 0x3
+	.string	"sum"
+	.value	0x1e1
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -88
+	.uleb128 0xe
+	.quad	.LBB1169
+	.quad	.LBE1169-.LBB1169
+	.long	0x2ef0
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x1d1
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -208
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x1d3
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1170
+	.quad	.LBE1170-.LBB1170
+	.byte	0x1
+	.value	0x1d1
+	.byte	0x15
+	.long	0x2cfe
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -800
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1172
+	.quad	.LBE1172-.LBB1172
+	.byte	0x1
+	.value	0x1d1
+	.byte	0x15
+	.long	0x2d25
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -792
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f4b
+	.quad	.LBB1174
+	.quad	.LBE1174-.LBB1174
+	.byte	0x1
+	.value	0x1d1
+	.byte	0x15
+	.long	0x2d55
+	.uleb128 0x1
+	.long	0x5f66
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -784
+	.uleb128 0x1
+	.long	0x5f5a
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -752
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1176
+	.quad	.LBE1176-.LBB1176
+	.byte	0x1
+	.value	0x1d3
+	.byte	0x15
+	.long	0x2d7c
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -704
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1178
+	.quad	.LBE1178-.LBB1178
+	.byte	0x1
+	.value	0x1d3
+	.byte	0x15
+	.long	0x2da3
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -696
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f4b
+	.quad	.LBB1180
+	.quad	.LBE1180-.LBB1180
+	.byte	0x1
+	.value	0x1d3
+	.byte	0x15
+	.long	0x2dd3
+	.uleb128 0x1
+	.long	0x5f66
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -688
+	.uleb128 0x1
+	.long	0x5f5a
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -656
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1182
+	.quad	.LBE1182-.LBB1182
+	.byte	0x1
+	.value	0x1d5
+	.byte	0x9
+	.long	0x2e03
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -624
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -568
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1184
+	.quad	.LBE1184-.LBB1184
+	.byte	0x1
+	.value	0x1d6
+	.byte	0x9
+	.long	0x2e33
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -560
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -512
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1186
+	.quad	.LBE1186-.LBB1186
+	.byte	0x1
+	.value	0x1d7
+	.byte	0x10
+	.long	0x2e5a
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -504
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1188
+	.quad	.LBE1188-.LBB1188
+	.byte	0x1
+	.value	0x1d7
+	.byte	0x10
+	.long	0x2e93
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -496
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -464
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -432
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1190
+	.quad	.LBE1190-.LBB1190
+	.byte	0x1
+	.value	0x1d8
+	.byte	0x10
+	.long	0x2eba
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -376
+	.byte	0
+	.uleb128 0x7
+	.long	0x5bf6
+	.quad	.LBB1192
+	.quad	.LBE1192-.LBB1192
+	.byte	0x1
+	.value	0x1d8
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -368
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -336
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -304
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1194
+	.quad	.LBE1194-.LBB1194
+	.long	0x301e
+	.uleb128 0x3
+	.string	"c"
+	.value	0x1dc
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -176
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1195
+	.quad	.LBE1195-.LBB1195
+	.byte	0x1
+	.value	0x1dc
+	.byte	0x14
+	.long	0x2f3a
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1056
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1197
+	.quad	.LBE1197-.LBB1197
+	.byte	0x1
+	.value	0x1dc
+	.byte	0x14
+	.long	0x2f61
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1048
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f4b
+	.quad	.LBB1199
+	.quad	.LBE1199-.LBB1199
+	.byte	0x1
+	.value	0x1dc
+	.byte	0x14
+	.long	0x2f91
+	.uleb128 0x1
+	.long	0x5f66
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1040
+	.uleb128 0x1
+	.long	0x5f5a
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1008
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1201
+	.quad	.LBE1201-.LBB1201
+	.byte	0x1
+	.value	0x1de
+	.byte	0x9
+	.long	0x2fc1
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -976
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -928
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1203
+	.quad	.LBE1203-.LBB1203
+	.byte	0x1
+	.value	0x1df
+	.byte	0x10
+	.long	0x2fe8
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -920
+	.byte	0
+	.uleb128 0x7
+	.long	0x5bf6
+	.quad	.LBB1205
+	.quad	.LBE1205-.LBB1205
+	.byte	0x1
+	.value	0x1df
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -912
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -880
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -848
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e40
+	.quad	.LBB1163
+	.quad	.LBE1163-.LBB1163
+	.byte	0x1
+	.value	0x1ca
+	.byte	0x16
+	.long	0x3045
+	.uleb128 0x1
+	.long	0x5e50
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -244
+	.byte	0
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1165
+	.quad	.LBE1165-.LBB1165
+	.byte	0x1
+	.value	0x1cb
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1167
+	.quad	.LBE1167-.LBB1167
+	.byte	0x1
+	.value	0x1cc
+	.byte	0x13
+	.uleb128 0x7
+	.long	0x5f4b
+	.quad	.LBB1207
+	.quad	.LBE1207-.LBB1207
+	.byte	0x1
+	.value	0x1e1
+	.byte	0x11
+	.uleb128 0x1
+	.long	0x5f66
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1136
+	.uleb128 0x1
+	.long	0x5f5a
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1104
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF87
+	.value	0x1be
+	.byte	0x16
+	.long	0x2d0
+	.quad	.LFB4851
+	.quad	.LFE4851-.LFB4851
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x31b6
+	.uleb128 0x1f
+	.string	"x"
+	.value	0x1be
+	.byte	0x36
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x1be
+	.byte	0x40
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -120
+	.uleb128 0x6
+	.long	.LASF73
+	.value	0x1c0
+	.byte	0x12
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 200
+	.uleb128 0x6
+	.long	.LASF88
+	.value	0x1c1
+	.byte	0x12
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 168
+	.uleb128 0x6
+	.long	.LASF89
+	.value	0x1c2
+	.byte	0x12
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1155
+	.quad	.LBE1155-.LBB1155
+	.byte	0x1
+	.value	0x1c0
+	.byte	0x19
+	.uleb128 0x2
+	.long	0x5f23
+	.quad	.LBB1157
+	.quad	.LBE1157-.LBB1157
+	.byte	0x1
+	.value	0x1c1
+	.byte	0x1d
+	.long	0x315b
+	.uleb128 0x1
+	.long	0x5f3e
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5f32
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f23
+	.quad	.LBB1159
+	.quad	.LBE1159-.LBB1159
+	.byte	0x1
+	.value	0x1c2
+	.byte	0x1d
+	.long	0x3189
+	.uleb128 0x1
+	.long	0x5f3e
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.uleb128 0x1
+	.long	0x5f32
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.byte	0
+	.uleb128 0x7
+	.long	0x5ecd
+	.quad	.LBB1161
+	.quad	.LBE1161-.LBB1161
+	.byte	0x1
+	.value	0x1c3
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x5eea
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 72
+	.uleb128 0x1
+	.long	0x5edd
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 104
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF90
+	.value	0x199
+	.long	0x16c
+	.quad	.LFB4850
+	.quad	.LFE4850-.LFB4850
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3762
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x199
+	.byte	0x32
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1560
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x199
+	.byte	0x4d
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1568
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x199
+	.byte	0x64
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1576
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x19a
+	.byte	0x31
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1580
+	.uleb128 0x4
+	.long	.LASF80
+	.value	0x19a
+	.byte	0x3d
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1584
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x19a
+	.byte	0x47
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1588
+	.uleb128 0x3
+	.string	"g"
+	.value	0x19c
+	.byte	0x12
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -144
+	.uleb128 0x3
+	.string	"l"
+	.value	0x19d
+	.byte	0x12
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -176
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x19e
+	.byte	0xc
+	.long	0x2d0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x19f
+	.byte	0xc
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -80
+	.uleb128 0x3
+	.string	"k"
+	.value	0x1a0
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -84
+	.uleb128 0x3
+	.string	"sum"
+	.value	0x1b4
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -88
+	.uleb128 0xe
+	.quad	.LBB1109
+	.quad	.LBE1109-.LBB1109
+	.long	0x354e
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x1a4
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x1a5
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -272
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1110
+	.quad	.LBE1110-.LBB1110
+	.byte	0x1
+	.value	0x1a4
+	.byte	0x15
+	.long	0x32ea
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1080
+	.byte	0
+	.uleb128 0x2
+	.long	0x5ef8
+	.quad	.LBB1112
+	.quad	.LBE1112-.LBB1112
+	.byte	0x1
+	.value	0x1a4
+	.byte	0x15
+	.long	0x331a
+	.uleb128 0x1
+	.long	0x5f15
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1072
+	.uleb128 0x1
+	.long	0x5f08
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1040
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1114
+	.quad	.LBE1114-.LBB1114
+	.byte	0x1
+	.value	0x1a5
+	.byte	0x15
+	.long	0x3341
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -984
+	.byte	0
+	.uleb128 0x2
+	.long	0x5ef8
+	.quad	.LBB1116
+	.quad	.LBE1116-.LBB1116
+	.byte	0x1
+	.value	0x1a5
+	.byte	0x15
+	.long	0x3371
+	.uleb128 0x1
+	.long	0x5f15
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -976
+	.uleb128 0x1
+	.long	0x5f08
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -944
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1118
+	.quad	.LBE1118-.LBB1118
+	.byte	0x1
+	.value	0x1a6
+	.byte	0xe
+	.long	0x3398
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -888
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1120
+	.quad	.LBE1120-.LBB1120
+	.byte	0x1
+	.value	0x1a6
+	.byte	0xe
+	.long	0x33d1
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -880
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -848
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -816
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1122
+	.quad	.LBE1122-.LBB1122
+	.byte	0x1
+	.value	0x1a7
+	.byte	0xe
+	.long	0x33f8
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -760
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1124
+	.quad	.LBE1124-.LBB1124
+	.byte	0x1
+	.value	0x1a7
+	.byte	0xe
+	.long	0x3431
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -752
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -720
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -688
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1126
+	.quad	.LBE1126-.LBB1126
+	.byte	0x1
+	.value	0x1a8
+	.byte	0x9
+	.long	0x3461
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -656
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -600
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1128
+	.quad	.LBE1128-.LBB1128
+	.byte	0x1
+	.value	0x1a9
+	.byte	0x9
+	.long	0x3491
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -592
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -544
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1130
+	.quad	.LBE1130-.LBB1130
+	.byte	0x1
+	.value	0x1aa
+	.byte	0x10
+	.long	0x34b8
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -536
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1132
+	.quad	.LBE1132-.LBB1132
+	.byte	0x1
+	.value	0x1aa
+	.byte	0x10
+	.long	0x34f1
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -528
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -496
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -464
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1134
+	.quad	.LBE1134-.LBB1134
+	.byte	0x1
+	.value	0x1ab
+	.byte	0x10
+	.long	0x3518
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -408
+	.byte	0
+	.uleb128 0x7
+	.long	0x5bf6
+	.quad	.LBB1136
+	.quad	.LBE1136-.LBB1136
+	.byte	0x1
+	.value	0x1ab
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -400
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -368
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -336
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1138
+	.quad	.LBE1138-.LBB1138
+	.long	0x36b5
+	.uleb128 0x3
+	.string	"c"
+	.value	0x1af
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -208
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1139
+	.quad	.LBE1139-.LBB1139
+	.byte	0x1
+	.value	0x1af
+	.byte	0x14
+	.long	0x3598
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1464
+	.byte	0
+	.uleb128 0x2
+	.long	0x5ef8
+	.quad	.LBB1141
+	.quad	.LBE1141-.LBB1141
+	.byte	0x1
+	.value	0x1af
+	.byte	0x14
+	.long	0x35c8
+	.uleb128 0x1
+	.long	0x5f15
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1456
+	.uleb128 0x1
+	.long	0x5f08
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1424
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1143
+	.quad	.LBE1143-.LBB1143
+	.byte	0x1
+	.value	0x1b0
+	.byte	0xd
+	.long	0x35ef
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1368
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1145
+	.quad	.LBE1145-.LBB1145
+	.byte	0x1
+	.value	0x1b0
+	.byte	0xd
+	.long	0x3628
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1360
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1328
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1296
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1147
+	.quad	.LBE1147-.LBB1147
+	.byte	0x1
+	.value	0x1b1
+	.byte	0x9
+	.long	0x3658
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1264
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1216
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1149
+	.quad	.LBE1149-.LBB1149
+	.byte	0x1
+	.value	0x1b2
+	.byte	0x10
+	.long	0x367f
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1208
+	.byte	0
+	.uleb128 0x7
+	.long	0x5bf6
+	.quad	.LBB1151
+	.quad	.LBE1151-.LBB1151
+	.byte	0x1
+	.value	0x1b2
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1200
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1168
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1136
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e40
+	.quad	.LBB1101
+	.quad	.LBE1101-.LBB1101
+	.byte	0x1
+	.value	0x19c
+	.byte	0x16
+	.long	0x36dc
+	.uleb128 0x1
+	.long	0x5e50
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -280
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e40
+	.quad	.LBB1103
+	.quad	.LBE1103-.LBB1103
+	.byte	0x1
+	.value	0x19d
+	.byte	0x16
+	.long	0x3703
+	.uleb128 0x1
+	.long	0x5e50
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -276
+	.byte	0
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1105
+	.quad	.LBE1105-.LBB1105
+	.byte	0x1
+	.value	0x19e
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1107
+	.quad	.LBE1107-.LBB1107
+	.byte	0x1
+	.value	0x19f
+	.byte	0x13
+	.uleb128 0x7
+	.long	0x5f4b
+	.quad	.LBB1153
+	.quad	.LBE1153-.LBB1153
+	.byte	0x1
+	.value	0x1b4
+	.byte	0x11
+	.uleb128 0x1
+	.long	0x5f66
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1552
+	.uleb128 0x1
+	.long	0x5f5a
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1520
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF91
+	.value	0x175
+	.long	0x16c
+	.quad	.LFB4849
+	.quad	.LFE4849-.LFB4849
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c39
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x175
+	.byte	0x2d
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1240
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x175
+	.byte	0x48
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1248
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x175
+	.byte	0x5f
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1256
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x176
+	.byte	0x2c
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1260
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x176
+	.byte	0x36
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1264
+	.uleb128 0x3
+	.string	"g"
+	.value	0x178
+	.byte	0x12
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -144
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x179
+	.byte	0xc
+	.long	0x2d0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x17a
+	.byte	0xc
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -80
+	.uleb128 0x3
+	.string	"k"
+	.value	0x17b
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -84
+	.uleb128 0x3
+	.string	"sum"
+	.value	0x18f
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -88
+	.uleb128 0xe
+	.quad	.LBB1061
+	.quad	.LBE1061-.LBB1061
+	.long	0x3a7c
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x17f
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -208
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x180
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -240
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1062
+	.quad	.LBE1062-.LBB1062
+	.byte	0x1
+	.value	0x17f
+	.byte	0x15
+	.long	0x3878
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -872
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1064
+	.quad	.LBE1064-.LBB1064
+	.byte	0x1
+	.value	0x180
+	.byte	0x15
+	.long	0x389f
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -864
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1066
+	.quad	.LBE1066-.LBB1066
+	.byte	0x1
+	.value	0x181
+	.byte	0xe
+	.long	0x38c6
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -856
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1068
+	.quad	.LBE1068-.LBB1068
+	.byte	0x1
+	.value	0x181
+	.byte	0xe
+	.long	0x38ff
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -848
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -816
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -784
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1070
+	.quad	.LBE1070-.LBB1070
+	.byte	0x1
+	.value	0x182
+	.byte	0xe
+	.long	0x3926
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -728
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1072
+	.quad	.LBE1072-.LBB1072
+	.byte	0x1
+	.value	0x182
+	.byte	0xe
+	.long	0x395f
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -720
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -688
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -656
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1074
+	.quad	.LBE1074-.LBB1074
+	.byte	0x1
+	.value	0x183
+	.byte	0x9
+	.long	0x398f
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -624
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -568
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1076
+	.quad	.LBE1076-.LBB1076
+	.byte	0x1
+	.value	0x184
+	.byte	0x9
+	.long	0x39bf
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -560
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -512
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1078
+	.quad	.LBE1078-.LBB1078
+	.byte	0x1
+	.value	0x185
+	.byte	0x10
+	.long	0x39e6
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -504
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1080
+	.quad	.LBE1080-.LBB1080
+	.byte	0x1
+	.value	0x185
+	.byte	0x10
+	.long	0x3a1f
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -496
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -464
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -432
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1082
+	.quad	.LBE1082-.LBB1082
+	.byte	0x1
+	.value	0x186
+	.byte	0x10
+	.long	0x3a46
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -376
+	.byte	0
+	.uleb128 0x7
+	.long	0x5bf6
+	.quad	.LBB1084
+	.quad	.LBE1084-.LBB1084
+	.byte	0x1
+	.value	0x186
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -368
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -336
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -304
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.quad	.LBB1086
+	.quad	.LBE1086-.LBB1086
+	.long	0x3bb3
+	.uleb128 0x3
+	.string	"c"
+	.value	0x18a
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -176
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1087
+	.quad	.LBE1087-.LBB1087
+	.byte	0x1
+	.value	0x18a
+	.byte	0x14
+	.long	0x3ac6
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1152
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1089
+	.quad	.LBE1089-.LBB1089
+	.byte	0x1
+	.value	0x18b
+	.byte	0xd
+	.long	0x3aed
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1144
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1091
+	.quad	.LBE1091-.LBB1091
+	.byte	0x1
+	.value	0x18b
+	.byte	0xd
+	.long	0x3b26
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1136
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1104
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1072
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e88
+	.quad	.LBB1093
+	.quad	.LBE1093-.LBB1093
+	.byte	0x1
+	.value	0x18c
+	.byte	0x9
+	.long	0x3b56
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1040
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -992
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1095
+	.quad	.LBE1095-.LBB1095
+	.byte	0x1
+	.value	0x18d
+	.byte	0x10
+	.long	0x3b7d
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -984
+	.byte	0
+	.uleb128 0x7
+	.long	0x5bf6
+	.quad	.LBB1097
+	.quad	.LBE1097-.LBB1097
+	.byte	0x1
+	.value	0x18d
+	.byte	0x10
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -976
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -944
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -912
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e40
+	.quad	.LBB1055
+	.quad	.LBE1055-.LBB1055
+	.byte	0x1
+	.value	0x178
+	.byte	0x16
+	.long	0x3bda
+	.uleb128 0x1
+	.long	0x5e50
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -244
+	.byte	0
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1057
+	.quad	.LBE1057-.LBB1057
+	.byte	0x1
+	.value	0x179
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1059
+	.quad	.LBE1059-.LBB1059
+	.byte	0x1
+	.value	0x17a
+	.byte	0x13
+	.uleb128 0x7
+	.long	0x5f4b
+	.quad	.LBB1099
+	.quad	.LBE1099-.LBB1099
+	.byte	0x1
+	.value	0x18f
+	.byte	0x11
+	.uleb128 0x1
+	.long	0x5f66
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1232
+	.uleb128 0x1
+	.long	0x5f5a
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -1200
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF92
+	.value	0x163
+	.quad	.LFB4848
+	.quad	.LFE4848-.LFB4848
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3da8
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x163
+	.byte	0x29
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF83
+	.value	0x163
+	.byte	0x44
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x163
+	.byte	0x51
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -92
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x163
+	.byte	0x5b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -96
+	.uleb128 0x3
+	.string	"g"
+	.value	0x165
+	.byte	0x12
+	.long	0x2dc
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.uleb128 0x3
+	.string	"k"
+	.value	0x166
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 196
+	.uleb128 0xe
+	.quad	.LBB1046
+	.quad	.LBE1046-.LBB1046
+	.long	0x3d84
+	.uleb128 0x3
+	.string	"c"
+	.value	0x16a
+	.byte	0x10
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 104
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1047
+	.quad	.LBE1047-.LBB1047
+	.byte	0x1
+	.value	0x16a
+	.byte	0x14
+	.long	0x3cfc
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1049
+	.quad	.LBE1049-.LBB1049
+	.byte	0x1
+	.value	0x16b
+	.byte	0xd
+	.long	0x3d22
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1051
+	.quad	.LBE1051-.LBB1051
+	.byte	0x1
+	.value	0x16b
+	.byte	0xd
+	.long	0x3d58
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -24
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e88
+	.quad	.LBB1053
+	.quad	.LBE1053-.LBB1053
+	.byte	0x1
+	.value	0x16c
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x5ea1
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.uleb128 0x1
+	.long	0x5e94
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 88
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x5e40
+	.quad	.LBB1044
+	.quad	.LBE1044-.LBB1044
+	.byte	0x1
+	.value	0x165
+	.byte	0x16
+	.uleb128 0x1
+	.long	0x5e50
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 100
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF93
+	.value	0x14b
+	.long	0x16c
+	.quad	.LFB4847
+	.quad	.LFE4847-.LFB4847
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4026
+	.uleb128 0x1f
+	.string	"a"
+	.value	0x14b
+	.byte	0x2d
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -568
+	.uleb128 0x1f
+	.string	"b"
+	.value	0x14b
+	.byte	0x3d
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -576
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x14b
+	.byte	0x44
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -580
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x14d
+	.byte	0xc
+	.long	0x2d0
+	.uleb128 0x2
+	.byte	0x76
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x14e
+	.byte	0xc
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -80
+	.uleb128 0x3
+	.string	"k"
+	.value	0x14f
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -84
+	.uleb128 0x3
+	.string	"sum"
+	.value	0x15a
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -88
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1020
+	.quad	.LBE1020-.LBB1020
+	.byte	0x1
+	.value	0x14d
+	.byte	0x13
+	.uleb128 0x8
+	.long	0x5e5e
+	.quad	.LBB1022
+	.quad	.LBE1022-.LBB1022
+	.byte	0x1
+	.value	0x14e
+	.byte	0x13
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1024
+	.quad	.LBE1024-.LBB1024
+	.byte	0x1
+	.value	0x153
+	.byte	0x10
+	.long	0x3e8b
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -352
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1026
+	.quad	.LBE1026-.LBB1026
+	.byte	0x1
+	.value	0x153
+	.byte	0x10
+	.long	0x3eb2
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -344
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1028
+	.quad	.LBE1028-.LBB1028
+	.byte	0x1
+	.value	0x153
+	.byte	0x10
+	.long	0x3eeb
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -336
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -304
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -272
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1030
+	.quad	.LBE1030-.LBB1030
+	.byte	0x1
+	.value	0x154
+	.byte	0x10
+	.long	0x3f12
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -224
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1032
+	.quad	.LBE1032-.LBB1032
+	.byte	0x1
+	.value	0x154
+	.byte	0x10
+	.long	0x3f39
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -216
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1034
+	.quad	.LBE1034-.LBB1034
+	.byte	0x1
+	.value	0x154
+	.byte	0x10
+	.long	0x3f72
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -208
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -176
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -144
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1036
+	.quad	.LBE1036-.LBB1036
+	.byte	0x1
+	.value	0x158
+	.byte	0x10
+	.long	0x3f99
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -480
+	.byte	0
+	.uleb128 0x2
+	.long	0x5eaf
+	.quad	.LBB1038
+	.quad	.LBE1038-.LBB1038
+	.byte	0x1
+	.value	0x158
+	.byte	0x10
+	.long	0x3fc0
+	.uleb128 0x1
+	.long	0x5ebf
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -472
+	.byte	0
+	.uleb128 0x2
+	.long	0x5bf6
+	.quad	.LBB1040
+	.quad	.LBE1040-.LBB1040
+	.byte	0x1
+	.value	0x158
+	.byte	0x10
+	.long	0x3ff9
+	.uleb128 0x1
+	.long	0x5c1d
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -464
+	.uleb128 0x1
+	.long	0x5c11
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -432
+	.uleb128 0x1
+	.long	0x5c05
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -400
+	.byte	0
+	.uleb128 0x7
+	.long	0x5f4b
+	.quad	.LBB1042
+	.quad	.LBE1042-.LBB1042
+	.byte	0x1
+	.value	0x15a
+	.byte	0x11
+	.uleb128 0x1
+	.long	0x5f66
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -560
+	.uleb128 0x1
+	.long	0x5f5a
+	.uleb128 0x3
+	.byte	0x76
+	.sleb128 -528
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF94
+	.value	0x140
+	.byte	0x15
+	.long	0x16c
+	.quad	.LFB4846
+	.quad	.LFE4846-.LFB4846
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x41a2
+	.uleb128 0x1f
+	.string	"v"
+	.value	0x140
+	.byte	0x38
+	.long	0x2d0
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -120
+	.uleb128 0x6
+	.long	.LASF95
+	.value	0x142
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 152
+	.uleb128 0x6
+	.long	.LASF96
+	.value	0x143
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 136
+	.uleb128 0x2
+	.long	0x5e22
+	.quad	.LBB1006
+	.quad	.LBE1006-.LBB1006
+	.byte	0x1
+	.value	0x142
+	.byte	0x13
+	.long	0x409c
+	.uleb128 0x1
+	.long	0x5e32
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -56
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB1008
+	.quad	.LBE1008-.LBB1008
+	.byte	0x1
+	.value	0x142
+	.byte	0x13
+	.long	0x40ca
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 -8
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 8
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f73
+	.quad	.LBB1010
+	.quad	.LBE1010-.LBB1010
+	.byte	0x1
+	.value	0x143
+	.byte	0x13
+	.long	0x40f0
+	.uleb128 0x1
+	.long	0x5f82
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 24
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB1012
+	.quad	.LBE1012-.LBB1012
+	.byte	0x1
+	.value	0x144
+	.byte	0xc
+	.long	0x411e
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 40
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x2
+	.byte	0x77
+	.sleb128 56
+	.byte	0
+	.uleb128 0x2
+	.long	0x6010
+	.quad	.LBB1014
+	.quad	.LBE1014-.LBB1014
+	.byte	0x1
+	.value	0x145
+	.byte	0xc
+	.long	0x414e
+	.uleb128 0x1
+	.long	0x602d
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 72
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 88
+	.byte	0
+	.uleb128 0x2
+	.long	0x6131
+	.quad	.LBB1016
+	.quad	.LBE1016-.LBB1016
+	.byte	0x1
+	.value	0x146
+	.byte	0xc
+	.long	0x417e
+	.uleb128 0x1
+	.long	0x614c
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 104
+	.uleb128 0x1
+	.long	0x6140
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 120
+	.byte	0
+	.uleb128 0x7
+	.long	0x5fb6
+	.quad	.LBB1018
+	.quad	.LBE1018-.LBB1018
+	.byte	0x1
+	.value	0x147
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x5fc6
+	.uleb128 0x3
+	.byte	0x77
+	.sleb128 -72
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF97
+	.value	0x115
+	.quad	.LFB4845
+	.quad	.LFE4845-.LFB4845
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4aa9
+	.uleb128 0x4
+	.long	.LASF60
+	.value	0x115
+	.byte	0x30
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1224
+	.uleb128 0x4
+	.long	.LASF61
+	.value	0x115
+	.byte	0x4b
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1232
+	.uleb128 0x4
+	.long	.LASF62
+	.value	0x115
+	.byte	0x62
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1240
+	.uleb128 0x4
+	.long	.LASF63
+	.value	0x116
+	.byte	0x36
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1248
+	.uleb128 0x4
+	.long	.LASF64
+	.value	0x116
+	.byte	0x43
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1256
+	.uleb128 0x4
+	.long	.LASF65
+	.value	0x116
+	.byte	0x4f
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1260
+	.uleb128 0x4
+	.long	.LASF66
+	.value	0x116
+	.byte	0x5b
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x16
+	.quad	.LBB914
+	.quad	.LBE914-.LBB914
+	.uleb128 0x3
+	.string	"ch"
+	.value	0x119
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x16
+	.quad	.LBB915
+	.quad	.LBE915-.LBB915
+	.uleb128 0x3
+	.string	"g0"
+	.value	0x11b
+	.byte	0x16
+	.long	0x24d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x3
+	.string	"g1"
+	.value	0x11c
+	.byte	0x16
+	.long	0x24d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x3
+	.string	"g2"
+	.value	0x11d
+	.byte	0x16
+	.long	0x24d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x3
+	.string	"g3"
+	.value	0x11e
+	.byte	0x16
+	.long	0x24d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x6
+	.long	.LASF67
+	.value	0x11f
+	.byte	0x10
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF68
+	.value	0x120
+	.byte	0x10
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF98
+	.value	0x121
+	.byte	0x10
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x6
+	.long	.LASF99
+	.value	0x122
+	.byte	0x10
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0xe
+	.quad	.LBB932
+	.quad	.LBE932-.LBB932
+	.long	0x48ea
+	.uleb128 0x3
+	.string	"k"
+	.value	0x124
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x16
+	.quad	.LBB933
+	.quad	.LBE933-.LBB933
+	.uleb128 0x3
+	.string	"row"
+	.value	0x126
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x3
+	.string	"c0"
+	.value	0x127
+	.byte	0x14
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x3
+	.string	"c1"
+	.value	0x128
+	.byte	0x14
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x3
+	.string	"c2"
+	.value	0x129
+	.byte	0x14
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x3
+	.string	"c3"
+	.value	0x12a
+	.byte	0x14
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB934
+	.quad	.LBE934-.LBB934
+	.byte	0x1
+	.value	0x127
+	.byte	0x19
+	.long	0x437f
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1096
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB936
+	.quad	.LBE936-.LBB936
+	.byte	0x1
+	.value	0x127
+	.byte	0x19
+	.long	0x43af
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1088
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1072
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB938
+	.quad	.LBE938-.LBB938
+	.byte	0x1
+	.value	0x127
+	.byte	0x19
+	.long	0x43d6
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1048
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB940
+	.quad	.LBE940-.LBB940
+	.byte	0x1
+	.value	0x127
+	.byte	0x19
+	.long	0x4406
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1040
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1024
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB942
+	.quad	.LBE942-.LBB942
+	.byte	0x1
+	.value	0x128
+	.byte	0x19
+	.long	0x442d
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1000
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB944
+	.quad	.LBE944-.LBB944
+	.byte	0x1
+	.value	0x128
+	.byte	0x19
+	.long	0x445d
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -992
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -976
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB946
+	.quad	.LBE946-.LBB946
+	.byte	0x1
+	.value	0x128
+	.byte	0x19
+	.long	0x4484
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -952
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB948
+	.quad	.LBE948-.LBB948
+	.byte	0x1
+	.value	0x128
+	.byte	0x19
+	.long	0x44b4
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -944
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -928
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB950
+	.quad	.LBE950-.LBB950
+	.byte	0x1
+	.value	0x129
+	.byte	0x19
+	.long	0x44db
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -904
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB952
+	.quad	.LBE952-.LBB952
+	.byte	0x1
+	.value	0x129
+	.byte	0x19
+	.long	0x450b
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -896
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -880
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB954
+	.quad	.LBE954-.LBB954
+	.byte	0x1
+	.value	0x129
+	.byte	0x19
+	.long	0x4532
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -856
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB956
+	.quad	.LBE956-.LBB956
+	.byte	0x1
+	.value	0x129
+	.byte	0x19
+	.long	0x4562
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -848
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -832
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB958
+	.quad	.LBE958-.LBB958
+	.byte	0x1
+	.value	0x12a
+	.byte	0x19
+	.long	0x4589
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -808
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB960
+	.quad	.LBE960-.LBB960
+	.byte	0x1
+	.value	0x12a
+	.byte	0x19
+	.long	0x45b9
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -800
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -784
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB962
+	.quad	.LBE962-.LBB962
+	.byte	0x1
+	.value	0x12a
+	.byte	0x19
+	.long	0x45e0
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -760
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB964
+	.quad	.LBE964-.LBB964
+	.byte	0x1
+	.value	0x12a
+	.byte	0x19
+	.long	0x4610
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -752
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -736
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f8f
+	.quad	.LBB966
+	.quad	.LBE966-.LBB966
+	.byte	0x1
+	.value	0x12b
+	.byte	0xd
+	.long	0x4640
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -720
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -696
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f8f
+	.quad	.LBB968
+	.quad	.LBE968-.LBB968
+	.byte	0x1
+	.value	0x12c
+	.byte	0xd
+	.long	0x4670
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -688
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -664
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f8f
+	.quad	.LBB970
+	.quad	.LBE970-.LBB970
+	.byte	0x1
+	.value	0x12d
+	.byte	0xd
+	.long	0x46a0
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -656
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -632
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f8f
+	.quad	.LBB972
+	.quad	.LBE972-.LBB972
+	.byte	0x1
+	.value	0x12e
+	.byte	0xd
+	.long	0x46d0
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -624
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -608
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB974
+	.quad	.LBE974-.LBB974
+	.byte	0x1
+	.value	0x12f
+	.byte	0x14
+	.long	0x46f7
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -600
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB976
+	.quad	.LBE976-.LBB976
+	.byte	0x1
+	.value	0x12f
+	.byte	0x14
+	.long	0x4727
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -592
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -576
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB978
+	.quad	.LBE978-.LBB978
+	.byte	0x1
+	.value	0x12f
+	.byte	0x14
+	.long	0x4757
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -560
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -544
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB980
+	.quad	.LBE980-.LBB980
+	.byte	0x1
+	.value	0x130
+	.byte	0x14
+	.long	0x477e
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -520
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB982
+	.quad	.LBE982-.LBB982
+	.byte	0x1
+	.value	0x130
+	.byte	0x14
+	.long	0x47ae
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -512
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -496
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB984
+	.quad	.LBE984-.LBB984
+	.byte	0x1
+	.value	0x130
+	.byte	0x14
+	.long	0x47de
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -480
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -464
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB986
+	.quad	.LBE986-.LBB986
+	.byte	0x1
+	.value	0x131
+	.byte	0x14
+	.long	0x4805
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -440
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB988
+	.quad	.LBE988-.LBB988
+	.byte	0x1
+	.value	0x131
+	.byte	0x14
+	.long	0x4835
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -432
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB990
+	.quad	.LBE990-.LBB990
+	.byte	0x1
+	.value	0x131
+	.byte	0x14
+	.long	0x4865
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -384
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB992
+	.quad	.LBE992-.LBB992
+	.byte	0x1
+	.value	0x132
+	.byte	0x14
+	.long	0x488c
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB994
+	.quad	.LBE994-.LBB994
+	.byte	0x1
+	.value	0x132
+	.byte	0x14
+	.long	0x48bc
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.byte	0
+	.uleb128 0x7
+	.long	0x6109
+	.quad	.LBB996
+	.quad	.LBE996-.LBB996
+	.byte	0x1
+	.value	0x132
+	.byte	0x14
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB916
+	.quad	.LBE916-.LBB916
+	.byte	0x1
+	.value	0x11b
+	.byte	0x1b
+	.long	0x4911
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB918
+	.quad	.LBE918-.LBB918
+	.byte	0x1
+	.value	0x11c
+	.byte	0x1b
+	.long	0x4938
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -280
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB920
+	.quad	.LBE920-.LBB920
+	.byte	0x1
+	.value	0x11d
+	.byte	0x1b
+	.long	0x495f
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB922
+	.quad	.LBE922-.LBB922
+	.byte	0x1
+	.value	0x11e
+	.byte	0x1b
+	.long	0x4986
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -264
+	.byte	0
+	.uleb128 0x8
+	.long	0x6159
+	.quad	.LBB924
+	.quad	.LBE924-.LBB924
+	.byte	0x1
+	.value	0x11f
+	.byte	0x17
+	.uleb128 0x8
+	.long	0x6159
+	.quad	.LBB926
+	.quad	.LBE926-.LBB926
+	.byte	0x1
+	.value	0x120
+	.byte	0x17
+	.uleb128 0x8
+	.long	0x6159
+	.quad	.LBB928
+	.quad	.LBE928-.LBB928
+	.byte	0x1
+	.value	0x121
+	.byte	0x17
+	.uleb128 0x8
+	.long	0x6159
+	.quad	.LBB930
+	.quad	.LBE930-.LBB930
+	.byte	0x1
+	.value	0x122
+	.byte	0x17
+	.uleb128 0x2
+	.long	0x5f8f
+	.quad	.LBB998
+	.quad	.LBE998-.LBB998
+	.byte	0x1
+	.value	0x134
+	.byte	0x9
+	.long	0x4a1a
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1216
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1192
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f8f
+	.quad	.LBB1000
+	.quad	.LBE1000-.LBB1000
+	.byte	0x1
+	.value	0x135
+	.byte	0x9
+	.long	0x4a4a
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1184
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1160
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f8f
+	.quad	.LBB1002
+	.quad	.LBE1002-.LBB1002
+	.byte	0x1
+	.value	0x136
+	.byte	0x9
+	.long	0x4a7a
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1152
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1128
+	.byte	0
+	.uleb128 0x7
+	.long	0x5f8f
+	.quad	.LBB1004
+	.quad	.LBE1004-.LBB1004
+	.byte	0x1
+	.value	0x137
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1120
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1104
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF100
+	.byte	0xfe
+	.long	0x16c
+	.quad	.LFB4844
+	.quad	.LFE4844-.LFB4844
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4ce2
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0xfe
+	.byte	0x31
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xfe
+	.byte	0x4c
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xfe
+	.byte	0x63
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -264
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xff
+	.byte	0x30
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -268
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xff
+	.byte	0x3a
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x3
+	.string	"g"
+	.value	0x101
+	.byte	0x12
+	.long	0x24d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.string	"acc"
+	.value	0x102
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x3
+	.string	"k"
+	.value	0x103
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.string	"sum"
+	.value	0x10b
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xe
+	.quad	.LBB899
+	.quad	.LBE899-.LBB899
+	.long	0x4ca1
+	.uleb128 0x3
+	.string	"c"
+	.value	0x107
+	.byte	0x10
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB900
+	.quad	.LBE900-.LBB900
+	.byte	0x1
+	.value	0x107
+	.byte	0x14
+	.long	0x4b96
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB902
+	.quad	.LBE902-.LBB902
+	.byte	0x1
+	.value	0x107
+	.byte	0x14
+	.long	0x4bbd
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -232
+	.byte	0
+	.uleb128 0x2
+	.long	0x6109
+	.quad	.LBB904
+	.quad	.LBE904-.LBB904
+	.byte	0x1
+	.value	0x107
+	.byte	0x14
+	.long	0x4bed
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+	.uleb128 0x2
+	.long	0x5f8f
+	.quad	.LBB906
+	.quad	.LBE906-.LBB906
+	.byte	0x1
+	.value	0x108
+	.byte	0x9
+	.long	0x4c1d
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fd4
+	.quad	.LBB908
+	.quad	.LBE908-.LBB908
+	.byte	0x1
+	.value	0x109
+	.byte	0xf
+	.long	0x4c44
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.byte	0
+	.uleb128 0x2
+	.long	0x60b9
+	.quad	.LBB910
+	.quad	.LBE910-.LBB910
+	.byte	0x1
+	.value	0x109
+	.byte	0xf
+	.long	0x4c74
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.uleb128 0x7
+	.long	0x6109
+	.quad	.LBB912
+	.quad	.LBE912-.LBB912
+	.byte	0x1
+	.value	0x109
+	.byte	0xf
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	0x5ff2
+	.quad	.LBB895
+	.quad	.LBE895-.LBB895
+	.byte	0x1
+	.value	0x101
+	.byte	0x16
+	.long	0x4cc8
+	.uleb128 0x1
+	.long	0x6002
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0
+	.uleb128 0x8
+	.long	0x6159
+	.quad	.LBB897
+	.quad	.LBE897-.LBB897
+	.byte	0x1
+	.value	0x102
+	.byte	0x12
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF101
+	.byte	0xf5
+	.byte	0x16
+	.long	0x241
+	.quad	.LFB4843
+	.quad	.LFE4843-.LFB4843
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4e43
+	.uleb128 0x1c
+	.string	"x"
+	.byte	0xf5
+	.byte	0x36
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xf5
+	.byte	0x40
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x11
+	.long	.LASF73
+	.byte	0xf7
+	.byte	0x12
+	.long	0x24d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x11
+	.long	.LASF88
+	.byte	0xf8
+	.byte	0x12
+	.long	0x24d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x11
+	.long	.LASF89
+	.byte	0xf9
+	.byte	0x12
+	.long	0x24d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x24
+	.long	0x6159
+	.quad	.LBB883
+	.quad	.LBE883-.LBB883
+	.byte	0xf7
+	.byte	0x19
+	.uleb128 0xb
+	.long	0x603b
+	.quad	.LBB885
+	.quad	.LBE885-.LBB885
+	.byte	0xf8
+	.byte	0x1d
+	.long	0x4d8e
+	.uleb128 0x1
+	.long	0x6058
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1
+	.long	0x604b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+	.uleb128 0xb
+	.long	0x6091
+	.quad	.LBB887
+	.quad	.LBE887-.LBB887
+	.byte	0xf8
+	.byte	0x1d
+	.long	0x4dbc
+	.uleb128 0x1
+	.long	0x60ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1
+	.long	0x60a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+	.uleb128 0xb
+	.long	0x6066
+	.quad	.LBB889
+	.quad	.LBE889-.LBB889
+	.byte	0xf9
+	.byte	0x1d
+	.long	0x4dea
+	.uleb128 0x1
+	.long	0x6083
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x1
+	.long	0x6076
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.uleb128 0xb
+	.long	0x6091
+	.quad	.LBB891
+	.quad	.LBE891-.LBB891
+	.byte	0xf9
+	.byte	0x1d
+	.long	0x4e18
+	.uleb128 0x1
+	.long	0x60ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	0x60a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x1d
+	.long	0x60e1
+	.quad	.LBB893
+	.quad	.LBE893-.LBB893
+	.byte	0xfa
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x60fc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.long	0x60f0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF102
+	.byte	0xdb
+	.long	0x16c
+	.quad	.LFB4842
+	.quad	.LFE4842-.LFB4842
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5102
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0xdb
+	.byte	0x32
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xdb
+	.byte	0x4d
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xdb
+	.byte	0x64
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -360
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xdc
+	.byte	0x31
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -364
+	.uleb128 0x5
+	.long	.LASF80
+	.byte	0xdc
+	.byte	0x3d
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xdc
+	.byte	0x47
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -372
+	.uleb128 0xd
+	.string	"g"
+	.byte	0xde
+	.byte	0x12
+	.long	0x24d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xd
+	.string	"l"
+	.byte	0xdf
+	.byte	0x12
+	.long	0x24d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xd
+	.string	"acc"
+	.byte	0xe0
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xd
+	.string	"k"
+	.byte	0xe1
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xd
+	.string	"sum"
+	.byte	0xea
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xe
+	.quad	.LBB864
+	.quad	.LBE864-.LBB864
+	.long	0x50a0
+	.uleb128 0xd
+	.string	"c"
+	.byte	0xe5
+	.byte	0x10
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB865
+	.quad	.LBE865-.LBB865
+	.byte	0xe5
+	.byte	0x14
+	.long	0x4f45
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -328
+	.byte	0
+	.uleb128 0xb
+	.long	0x60b9
+	.quad	.LBB867
+	.quad	.LBE867-.LBB867
+	.byte	0xe5
+	.byte	0x14
+	.long	0x4f73
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -320
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB869
+	.quad	.LBE869-.LBB869
+	.byte	0xe6
+	.byte	0xd
+	.long	0x4f98
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -280
+	.byte	0
+	.uleb128 0xb
+	.long	0x60b9
+	.quad	.LBB871
+	.quad	.LBE871-.LBB871
+	.byte	0xe6
+	.byte	0xd
+	.long	0x4fc6
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.byte	0
+	.uleb128 0xb
+	.long	0x6109
+	.quad	.LBB873
+	.quad	.LBE873-.LBB873
+	.byte	0xe6
+	.byte	0xd
+	.long	0x4ff4
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.uleb128 0xb
+	.long	0x5f8f
+	.quad	.LBB875
+	.quad	.LBE875-.LBB875
+	.byte	0xe7
+	.byte	0x9
+	.long	0x5022
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB877
+	.quad	.LBE877-.LBB877
+	.byte	0xe8
+	.byte	0xf
+	.long	0x5047
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.byte	0
+	.uleb128 0xb
+	.long	0x60b9
+	.quad	.LBB879
+	.quad	.LBE879-.LBB879
+	.byte	0xe8
+	.byte	0xf
+	.long	0x5075
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6109
+	.quad	.LBB881
+	.quad	.LBE881-.LBB881
+	.byte	0xe8
+	.byte	0xf
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x5ff2
+	.quad	.LBB858
+	.quad	.LBE858-.LBB858
+	.byte	0xde
+	.byte	0x16
+	.long	0x50c5
+	.uleb128 0x1
+	.long	0x6002
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0xb
+	.long	0x5ff2
+	.quad	.LBB860
+	.quad	.LBE860-.LBB860
+	.byte	0xdf
+	.byte	0x16
+	.long	0x50ea
+	.uleb128 0x1
+	.long	0x6002
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.byte	0
+	.uleb128 0x24
+	.long	0x6159
+	.quad	.LBB862
+	.quad	.LBE862-.LBB862
+	.byte	0xe0
+	.byte	0x12
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF103
+	.byte	0xc3
+	.long	0x16c
+	.quad	.LFB4841
+	.quad	.LFE4841-.LFB4841
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5352
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0xc3
+	.byte	0x2d
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -280
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xc3
+	.byte	0x48
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0xc3
+	.byte	0x5f
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -296
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xc4
+	.byte	0x2c
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -300
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xc4
+	.byte	0x36
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0xd
+	.string	"g"
+	.byte	0xc6
+	.byte	0x12
+	.long	0x24d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xd
+	.string	"acc"
+	.byte	0xc7
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xd
+	.string	"k"
+	.byte	0xc8
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xd
+	.string	"sum"
+	.byte	0xd1
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xe
+	.quad	.LBB841
+	.quad	.LBE841-.LBB841
+	.long	0x5315
+	.uleb128 0xd
+	.string	"c"
+	.byte	0xcc
+	.byte	0x10
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB842
+	.quad	.LBE842-.LBB842
+	.byte	0xcc
+	.byte	0x14
+	.long	0x51e8
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB844
+	.quad	.LBE844-.LBB844
+	.byte	0xcd
+	.byte	0xd
+	.long	0x520d
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -264
+	.byte	0
+	.uleb128 0xb
+	.long	0x60b9
+	.quad	.LBB846
+	.quad	.LBE846-.LBB846
+	.byte	0xcd
+	.byte	0xd
+	.long	0x523b
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.byte	0
+	.uleb128 0xb
+	.long	0x6109
+	.quad	.LBB848
+	.quad	.LBE848-.LBB848
+	.byte	0xcd
+	.byte	0xd
+	.long	0x5269
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.byte	0
+	.uleb128 0xb
+	.long	0x5f8f
+	.quad	.LBB850
+	.quad	.LBE850-.LBB850
+	.byte	0xce
+	.byte	0x9
+	.long	0x5297
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB852
+	.quad	.LBE852-.LBB852
+	.byte	0xcf
+	.byte	0xf
+	.long	0x52bc
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.byte	0
+	.uleb128 0xb
+	.long	0x60b9
+	.quad	.LBB854
+	.quad	.LBE854-.LBB854
+	.byte	0xcf
+	.byte	0xf
+	.long	0x52ea
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6109
+	.quad	.LBB856
+	.quad	.LBE856-.LBB856
+	.byte	0xcf
+	.byte	0xf
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x5ff2
+	.quad	.LBB837
+	.quad	.LBE837-.LBB837
+	.byte	0xc6
+	.byte	0x16
+	.long	0x533a
+	.uleb128 0x1
+	.long	0x6002
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.byte	0
+	.uleb128 0x24
+	.long	0x6159
+	.quad	.LBB839
+	.quad	.LBE839-.LBB839
+	.byte	0xc7
+	.byte	0x12
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF104
+	.byte	0xb1
+	.quad	.LFB4840
+	.quad	.LFE4840-.LFB4840
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x54d6
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0xb1
+	.byte	0x29
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x5
+	.long	.LASF83
+	.byte	0xb1
+	.byte	0x44
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0xb1
+	.byte	0x51
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -196
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xb1
+	.byte	0x5b
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0xd
+	.string	"g"
+	.byte	0xb3
+	.byte	0x12
+	.long	0x24d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xd
+	.string	"k"
+	.byte	0xb4
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xe
+	.quad	.LBB826
+	.quad	.LBE826-.LBB826
+	.long	0x54b4
+	.uleb128 0xd
+	.string	"c"
+	.byte	0xb8
+	.byte	0x10
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB827
+	.quad	.LBE827-.LBB827
+	.byte	0xb8
+	.byte	0x14
+	.long	0x5408
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB829
+	.quad	.LBE829-.LBB829
+	.byte	0xb9
+	.byte	0xd
+	.long	0x542d
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.byte	0
+	.uleb128 0xb
+	.long	0x60b9
+	.quad	.LBB831
+	.quad	.LBE831-.LBB831
+	.byte	0xb9
+	.byte	0xd
+	.long	0x545b
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.uleb128 0xb
+	.long	0x6109
+	.quad	.LBB833
+	.quad	.LBE833-.LBB833
+	.byte	0xb9
+	.byte	0xd
+	.long	0x5489
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0x1d
+	.long	0x5f8f
+	.quad	.LBB835
+	.quad	.LBE835-.LBB835
+	.byte	0xba
+	.byte	0x9
+	.uleb128 0x1
+	.long	0x5fa8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.long	0x5f9b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	0x5ff2
+	.quad	.LBB824
+	.quad	.LBE824-.LBB824
+	.byte	0xb3
+	.byte	0x16
+	.uleb128 0x1
+	.long	0x6002
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF105
+	.byte	0x9d
+	.long	0x16c
+	.quad	.LFB4839
+	.quad	.LFE4839-.LFB4839
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x56fa
+	.uleb128 0x1c
+	.string	"a"
+	.byte	0x9d
+	.byte	0x2d
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -264
+	.uleb128 0x1c
+	.string	"b"
+	.byte	0x9d
+	.byte	0x3d
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0x9d
+	.byte	0x44
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -276
+	.uleb128 0x11
+	.long	.LASF67
+	.byte	0x9f
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x11
+	.long	.LASF68
+	.byte	0xa0
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xd
+	.string	"k"
+	.byte	0xa1
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0xd
+	.string	"sum"
+	.byte	0xa8
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x24
+	.long	0x6159
+	.quad	.LBB802
+	.quad	.LBE802-.LBB802
+	.byte	0x9f
+	.byte	0x13
+	.uleb128 0x24
+	.long	0x6159
+	.quad	.LBB804
+	.quad	.LBE804-.LBB804
+	.byte	0xa0
+	.byte	0x13
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB806
+	.quad	.LBE806-.LBB806
+	.byte	0xa5
+	.byte	0x10
+	.long	0x55a8
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -224
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB808
+	.quad	.LBE808-.LBB808
+	.byte	0xa5
+	.byte	0x10
+	.long	0x55cd
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.byte	0
+	.uleb128 0xb
+	.long	0x60b9
+	.quad	.LBB810
+	.quad	.LBE810-.LBB810
+	.byte	0xa5
+	.byte	0x10
+	.long	0x55fb
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.byte	0
+	.uleb128 0xb
+	.long	0x6109
+	.quad	.LBB812
+	.quad	.LBE812-.LBB812
+	.byte	0xa5
+	.byte	0x10
+	.long	0x5629
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB814
+	.quad	.LBE814-.LBB814
+	.byte	0xa6
+	.byte	0x10
+	.long	0x564e
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.uleb128 0xb
+	.long	0x5fd4
+	.quad	.LBB816
+	.quad	.LBE816-.LBB816
+	.byte	0xa6
+	.byte	0x10
+	.long	0x5673
+	.uleb128 0x1
+	.long	0x5fe4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.byte	0
+	.uleb128 0xb
+	.long	0x60b9
+	.quad	.LBB818
+	.quad	.LBE818-.LBB818
+	.byte	0xa6
+	.byte	0x10
+	.long	0x56a1
+	.uleb128 0x1
+	.long	0x60d4
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	0x60c8
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.uleb128 0xb
+	.long	0x6109
+	.quad	.LBB820
+	.quad	.LBE820-.LBB820
+	.byte	0xa6
+	.byte	0x10
+	.long	0x56cf
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.uleb128 0x1d
+	.long	0x6109
+	.quad	.LBB822
+	.quad	.LBE822-.LBB822
+	.byte	0xa8
+	.byte	0x11
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF106
+	.byte	0x93
+	.byte	0x15
+	.long	0x16c
+	.quad	.LFB4838
+	.quad	.LFE4838-.LFB4838
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x57ef
+	.uleb128 0x1c
+	.string	"v"
+	.byte	0x93
+	.byte	0x38
+	.long	0x241
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x11
+	.long	.LASF96
+	.byte	0x95
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x11
+	.long	.LASF95
+	.byte	0x96
+	.byte	0xc
+	.long	0x241
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xb
+	.long	0x6109
+	.quad	.LBB794
+	.quad	.LBE794-.LBB794
+	.byte	0x96
+	.byte	0x13
+	.long	0x5772
+	.uleb128 0x1
+	.long	0x6124
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x1
+	.long	0x6118
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.byte	0
+	.uleb128 0xb
+	.long	0x6010
+	.quad	.LBB796
+	.quad	.LBE796-.LBB796
+	.byte	0x97
+	.byte	0xc
+	.long	0x57a0
+	.uleb128 0x1
+	.long	0x602d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x1
+	.long	0x6020
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.uleb128 0xb
+	.long	0x6131
+	.quad	.LBB798
+	.quad	.LBE798-.LBB798
+	.byte	0x98
+	.byte	0xc
+	.long	0x57cd
+	.uleb128 0x1
+	.long	0x614c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.long	0x6140
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x1d
+	.long	0x5fb6
+	.quad	.LBB800
+	.quad	.LBE800-.LBB800
+	.byte	0x99
+	.byte	0xc
+	.uleb128 0x1
+	.long	0x5fc6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF107
+	.byte	0x77
+	.quad	.LFB4837
+	.quad	.LFE4837-.LFB4837
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x590a
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0x77
+	.byte	0x32
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0x77
+	.byte	0x4d
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0x77
+	.byte	0x64
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0x78
+	.byte	0x38
+	.long	0x178
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x5
+	.long	.LASF64
+	.byte	0x78
+	.byte	0x45
+	.long	0x19c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0x78
+	.byte	0x51
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x5
+	.long	.LASF66
+	.byte	0x78
+	.byte	0x5d
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0xe
+	.quad	.LBB790
+	.quad	.LBE790-.LBB790
+	.long	0x5896
+	.uleb128 0xd
+	.string	"ch"
+	.byte	0x7a
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB791
+	.quad	.LBE791-.LBB791
+	.uleb128 0xd
+	.string	"k"
+	.byte	0x7e
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x16
+	.quad	.LBB792
+	.quad	.LBE792-.LBB792
+	.uleb128 0xd
+	.string	"c"
+	.byte	0x80
+	.byte	0x10
+	.long	0x19c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.string	"p"
+	.byte	0x81
+	.byte	0x16
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xd
+	.string	"x"
+	.byte	0x82
+	.byte	0x16
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x16
+	.quad	.LBB793
+	.quad	.LBE793-.LBB793
+	.uleb128 0xd
+	.string	"ch"
+	.byte	0x84
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF108
+	.byte	0x62
+	.long	0x16c
+	.quad	.LFB4836
+	.quad	.LFE4836-.LFB4836
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5999
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0x62
+	.byte	0x33
+	.long	0x19c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0x62
+	.byte	0x4e
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0x62
+	.byte	0x65
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0x63
+	.byte	0x32
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0x63
+	.byte	0x3c
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x11
+	.long	.LASF109
+	.byte	0x65
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x11
+	.long	.LASF110
+	.byte	0x65
+	.byte	0x18
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xd
+	.string	"k"
+	.byte	0x66
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF111
+	.byte	0x5d
+	.byte	0x15
+	.long	0x16c
+	.quad	.LFB4835
+	.quad	.LFE4835-.LFB4835
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x59c7
+	.uleb128 0x1c
+	.string	"x"
+	.byte	0x5d
+	.byte	0x2a
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF112
+	.byte	0x48
+	.byte	0xe
+	.long	0x16c
+	.quad	.LFB4834
+	.quad	.LFE4834-.LFB4834
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5a66
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0x48
+	.byte	0x34
+	.long	0x19c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0x48
+	.byte	0x4f
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0x48
+	.byte	0x66
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0x49
+	.byte	0x33
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x5
+	.long	.LASF80
+	.byte	0x49
+	.byte	0x3f
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0x49
+	.byte	0x49
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x11
+	.long	.LASF109
+	.byte	0x4b
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x11
+	.long	.LASF110
+	.byte	0x4b
+	.byte	0x18
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xd
+	.string	"k"
+	.byte	0x4c
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF113
+	.byte	0x33
+	.byte	0xe
+	.long	0x16c
+	.quad	.LFB4833
+	.quad	.LFE4833-.LFB4833
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5af6
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0x33
+	.byte	0x2f
+	.long	0x19c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0x33
+	.byte	0x4a
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF62
+	.byte	0x33
+	.byte	0x61
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0x34
+	.byte	0x2e
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0x34
+	.byte	0x38
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x11
+	.long	.LASF109
+	.byte	0x36
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x11
+	.long	.LASF110
+	.byte	0x36
+	.byte	0x18
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xd
+	.string	"k"
+	.byte	0x37
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF114
+	.byte	0x2b
+	.quad	.LFB4832
+	.quad	.LFE4832-.LFB4832
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5b69
+	.uleb128 0x5
+	.long	.LASF60
+	.byte	0x2b
+	.byte	0x2b
+	.long	0x19c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF83
+	.byte	0x2b
+	.byte	0x46
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF63
+	.byte	0x2b
+	.byte	0x53
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0x2b
+	.byte	0x5d
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x16
+	.quad	.LBB789
+	.quad	.LBE789-.LBB789
+	.uleb128 0xd
+	.string	"k"
+	.byte	0x2d
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF115
+	.byte	0x18
+	.byte	0xe
+	.long	0x16c
+	.quad	.LFB4831
+	.quad	.LFE4831-.LFB4831
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5bf6
+	.uleb128 0x1c
+	.string	"a"
+	.byte	0x18
+	.byte	0x2f
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1c
+	.string	"b"
+	.byte	0x18
+	.byte	0x3f
+	.long	0x178
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0x18
+	.byte	0x46
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x11
+	.long	.LASF109
+	.byte	0x1a
+	.byte	0xb
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x11
+	.long	.LASF110
+	.byte	0x1a
+	.byte	0x18
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x11
+	.long	.LASF116
+	.byte	0x1a
+	.byte	0x25
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x11
+	.long	.LASF117
+	.byte	0x1a
+	.byte	0x32
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xd
+	.string	"k"
+	.byte	0x1b
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF118
+	.byte	0x5
+	.byte	0x3f
+	.long	0x2d0
+	.long	0x5c2a
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x19
+	.long	0x2d0
+	.uleb128 0xf
+	.string	"__B"
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x25
+	.long	0x2d0
+	.uleb128 0xf
+	.string	"__C"
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x31
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF119
+	.byte	0x6
+	.value	0x3f27
+	.long	0x16c
+	.long	0x5c90
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x6
+	.value	0x3f27
+	.byte	0x1e
+	.long	0xabd
+	.uleb128 0x19
+	.long	.LASF120
+	.long	0x2d0
+	.uleb128 0x19
+	.long	.LASF121
+	.long	0x2d0
+	.uleb128 0x19
+	.long	.LASF122
+	.long	0x2d0
+	.uleb128 0x19
+	.long	.LASF123
+	.long	0x241
+	.uleb128 0x19
+	.long	.LASF124
+	.long	0x241
+	.uleb128 0x19
+	.long	.LASF125
+	.long	0x241
+	.uleb128 0x19
+	.long	.LASF126
+	.long	0x241
+	.uleb128 0x19
+	.long	.LASF127
+	.long	0x241
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF128
+	.byte	0x6
+	.value	0x3436
+	.long	0xabd
+	.long	0x5cc8
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x6
+	.value	0x3436
+	.byte	0x19
+	.long	0xabd
+	.uleb128 0xa
+	.string	"__B"
+	.byte	0x6
+	.value	0x3436
+	.byte	0x25
+	.long	0xabd
+	.uleb128 0xa
+	.string	"__C"
+	.byte	0x6
+	.value	0x3436
+	.byte	0x31
+	.long	0xabd
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF129
+	.byte	0x6
+	.value	0x320a
+	.long	0xabd
+	.long	0x5cf3
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x6
+	.value	0x320a
+	.byte	0x17
+	.long	0xabd
+	.uleb128 0xa
+	.string	"__B"
+	.byte	0x6
+	.value	0x320a
+	.byte	0x23
+	.long	0xabd
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF130
+	.byte	0x6
+	.value	0x3136
+	.long	0xabd
+	.long	0x5d1e
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x6
+	.value	0x3136
+	.byte	0x17
+	.long	0xabd
+	.uleb128 0xa
+	.string	"__B"
+	.byte	0x6
+	.value	0x3136
+	.byte	0x23
+	.long	0xabd
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF131
+	.byte	0x6
+	.value	0x18dc
+	.long	0x5d52
+	.uleb128 0xa
+	.string	"__P"
+	.byte	0x6
+	.value	0x18dc
+	.byte	0x1e
+	.long	0x7e
+	.uleb128 0xa
+	.string	"__U"
+	.byte	0x6
+	.value	0x18dc
+	.byte	0x2d
+	.long	0x37b
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x6
+	.value	0x18dc
+	.byte	0x39
+	.long	0xabd
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF132
+	.byte	0x6
+	.value	0x18d5
+	.long	0x5d79
+	.uleb128 0xa
+	.string	"__P"
+	.byte	0x6
+	.value	0x18d5
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x6
+	.value	0x18d5
+	.byte	0x25
+	.long	0xabd
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF133
+	.byte	0x6
+	.value	0x18cb
+	.long	0xabd
+	.long	0x5da4
+	.uleb128 0xa
+	.string	"__U"
+	.byte	0x6
+	.value	0x18cb
+	.byte	0x22
+	.long	0x37b
+	.uleb128 0xa
+	.string	"__P"
+	.byte	0x6
+	.value	0x18cb
+	.byte	0x33
+	.long	0xa4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF134
+	.byte	0x6
+	.value	0x18bb
+	.long	0xabd
+	.long	0x5dc2
+	.uleb128 0xa
+	.string	"__P"
+	.byte	0x6
+	.value	0x18bb
+	.byte	0x1e
+	.long	0xa4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF135
+	.byte	0x6
+	.value	0x168
+	.long	0xabd
+	.long	0x5dfa
+	.uleb128 0xa
+	.string	"__W"
+	.byte	0x6
+	.value	0x168
+	.byte	0x1c
+	.long	0xabd
+	.uleb128 0xa
+	.string	"__U"
+	.byte	0x6
+	.value	0x168
+	.byte	0x2b
+	.long	0x37b
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x6
+	.value	0x168
+	.byte	0x37
+	.long	0xabd
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF139
+	.byte	0x6
+	.value	0x131
+	.long	0xabd
+	.uleb128 0x18
+	.long	.LASF136
+	.byte	0x6
+	.byte	0xf8
+	.long	0xabd
+	.long	0x5e22
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x6
+	.byte	0xf8
+	.byte	0x17
+	.long	0x16c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF137
+	.byte	0x3
+	.value	0x5b5
+	.long	0x241
+	.long	0x5e40
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x3
+	.value	0x5b5
+	.byte	0x20
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF138
+	.byte	0x3
+	.value	0x526
+	.long	0x2d0
+	.long	0x5e5e
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x3
+	.value	0x526
+	.byte	0x17
+	.long	0x16c
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF140
+	.byte	0x3
+	.value	0x4d3
+	.long	0x2d0
+	.uleb128 0x10
+	.long	.LASF141
+	.byte	0x3
+	.value	0x4b8
+	.long	0x2ed
+	.long	0x5e88
+	.uleb128 0x3d
+	.string	"__Y"
+	.byte	0x3
+	.value	0x4ba
+	.byte	0xb
+	.long	0x2ed
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF142
+	.byte	0x3
+	.value	0x38d
+	.long	0x5eaf
+	.uleb128 0xa
+	.string	"__P"
+	.byte	0x3
+	.value	0x38d
+	.byte	0x1a
+	.long	0x19c
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x3
+	.value	0x38d
+	.byte	0x26
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF143
+	.byte	0x3
+	.value	0x387
+	.long	0x2d0
+	.long	0x5ecd
+	.uleb128 0xa
+	.string	"__P"
+	.byte	0x3
+	.value	0x387
+	.byte	0x1f
+	.long	0x178
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF144
+	.byte	0x3
+	.value	0x16e
+	.long	0x2d0
+	.long	0x5ef8
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x3
+	.value	0x16e
+	.byte	0x17
+	.long	0x2d0
+	.uleb128 0xa
+	.string	"__B"
+	.byte	0x3
+	.value	0x16e
+	.byte	0x23
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF145
+	.byte	0x3
+	.value	0x13e
+	.long	0x2d0
+	.long	0x5f23
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x3
+	.value	0x13e
+	.byte	0x17
+	.long	0x2d0
+	.uleb128 0xa
+	.string	"__B"
+	.byte	0x3
+	.value	0x13e
+	.byte	0x23
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF146
+	.byte	0x3
+	.byte	0xac
+	.long	0x2d0
+	.long	0x5f4b
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x3
+	.byte	0xac
+	.byte	0x17
+	.long	0x2d0
+	.uleb128 0xf
+	.string	"__B"
+	.byte	0x3
+	.byte	0xac
+	.byte	0x23
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF147
+	.byte	0x3
+	.byte	0x93
+	.long	0x2d0
+	.long	0x5f73
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x3
+	.byte	0x93
+	.byte	0x17
+	.long	0x2d0
+	.uleb128 0xf
+	.string	"__B"
+	.byte	0x3
+	.byte	0x93
+	.byte	0x23
+	.long	0x2d0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF148
+	.byte	0x4
+	.byte	0x45
+	.long	0x241
+	.long	0x5f8f
+	.uleb128 0xf
+	.string	"__X"
+	.byte	0x4
+	.byte	0x45
+	.byte	0x19
+	.long	0x241
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF149
+	.byte	0x2
+	.value	0x3d5
+	.long	0x5fb6
+	.uleb128 0xa
+	.string	"__P"
+	.byte	0x2
+	.value	0x3d5
+	.byte	0x17
+	.long	0x19c
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x2
+	.value	0x3d5
+	.byte	0x23
+	.long	0x241
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF150
+	.byte	0x2
+	.value	0x3c7
+	.long	0x16c
+	.long	0x5fd4
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x2
+	.value	0x3c7
+	.byte	0x17
+	.long	0x241
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF151
+	.byte	0x2
+	.value	0x3a4
+	.long	0x241
+	.long	0x5ff2
+	.uleb128 0xa
+	.string	"__P"
+	.byte	0x2
+	.value	0x3a4
+	.byte	0x1c
+	.long	0x178
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF152
+	.byte	0x2
+	.value	0x37c
+	.long	0x241
+	.long	0x6010
+	.uleb128 0xa
+	.string	"__F"
+	.byte	0x2
+	.value	0x37c
+	.byte	0x14
+	.long	0x16c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF153
+	.byte	0x2
+	.value	0x311
+	.long	0x241
+	.long	0x603b
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x2
+	.value	0x311
+	.byte	0x17
+	.long	0x241
+	.uleb128 0xa
+	.string	"__B"
+	.byte	0x2
+	.value	0x311
+	.byte	0x23
+	.long	0x241
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF154
+	.byte	0x2
+	.value	0x17a
+	.long	0x241
+	.long	0x6066
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x2
+	.value	0x17a
+	.byte	0x16
+	.long	0x241
+	.uleb128 0xa
+	.string	"__B"
+	.byte	0x2
+	.value	0x17a
+	.byte	0x22
+	.long	0x241
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF155
+	.byte	0x2
+	.value	0x16e
+	.long	0x241
+	.long	0x6091
+	.uleb128 0xa
+	.string	"__A"
+	.byte	0x2
+	.value	0x16e
+	.byte	0x16
+	.long	0x241
+	.uleb128 0xa
+	.string	"__B"
+	.byte	0x2
+	.value	0x16e
+	.byte	0x22
+	.long	0x241
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF156
+	.byte	0x2
+	.byte	0xf0
+	.long	0x241
+	.long	0x60b9
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x2
+	.byte	0xf0
+	.byte	0x14
+	.long	0x241
+	.uleb128 0xf
+	.string	"__B"
+	.byte	0x2
+	.byte	0xf0
+	.byte	0x20
+	.long	0x241
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF157
+	.byte	0x2
+	.byte	0xc4
+	.long	0x241
+	.long	0x60e1
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x2
+	.byte	0xc4
+	.byte	0x14
+	.long	0x241
+	.uleb128 0xf
+	.string	"__B"
+	.byte	0x2
+	.byte	0xc4
+	.byte	0x20
+	.long	0x241
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF158
+	.byte	0x2
+	.byte	0xbe
+	.long	0x241
+	.long	0x6109
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x2
+	.byte	0xbe
+	.byte	0x14
+	.long	0x241
+	.uleb128 0xf
+	.string	"__B"
+	.byte	0x2
+	.byte	0xbe
+	.byte	0x20
+	.long	0x241
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF159
+	.byte	0x2
+	.byte	0xb8
+	.long	0x241
+	.long	0x6131
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x2
+	.byte	0xb8
+	.byte	0x14
+	.long	0x241
+	.uleb128 0xf
+	.string	"__B"
+	.byte	0x2
+	.byte	0xb8
+	.byte	0x20
+	.long	0x241
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF160
+	.byte	0x2
+	.byte	0x80
+	.long	0x241
+	.long	0x6159
+	.uleb128 0xf
+	.string	"__A"
+	.byte	0x2
+	.byte	0x80
+	.byte	0x14
+	.long	0x241
+	.uleb128 0xf
+	.string	"__B"
+	.byte	0x2
+	.byte	0x80
+	.byte	0x20
+	.long	0x241
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF161
+	.byte	0x2
+	.byte	0x76
+	.byte	0x1
+	.long	0x241
+	.byte	0x3
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0x5
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 16169
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x2107
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF51:
+	.string	"printf"
+.LASF127:
+	.string	"__T8"
+.LASF46:
+	.string	"_Float16"
+.LASF54:
+	.string	"forced"
+.LASF67:
+	.string	"acc0"
+.LASF68:
+	.string	"acc1"
+.LASF98:
+	.string	"acc2"
+.LASF99:
+	.string	"acc3"
+.LASF84:
+	.string	"lmsKernel_DotAvx512"
+.LASF12:
+	.string	"size_t"
+.LASF145:
+	.string	"_mm256_mul_ps"
+.LASF134:
+	.string	"_mm512_loadu_ps"
+.LASF61:
+	.string	"previous"
+.LASF20:
+	.string	"type"
+.LASF66:
+	.string	"stride"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF69:
+	.string	"row0"
+.LASF48:
+	.string	"lmsKernelBest"
+.LASF18:
+	.string	"LMS_KERNEL_COUNT"
+.LASF60:
+	.string	"coefficients"
+.LASF24:
+	.string	"leakyUpdateDot"
+.LASF150:
+	.string	"_mm_cvtss_f32"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF44:
+	.string	"__mmask8"
+.LASF123:
+	.string	"__T4"
+.LASF131:
+	.string	"_mm512_mask_storeu_ps"
+.LASF59:
+	.string	"lmsKernel_BankUpdateDotAvx512"
+.LASF156:
+	.string	"_mm_and_ps"
+.LASF126:
+	.string	"__T7"
+.LASF144:
+	.string	"_mm256_sub_ps"
+.LASF3:
+	.string	"long int"
+.LASF43:
+	.string	"__m512_u"
+.LASF57:
+	.string	"lmsKernel_IsSupported"
+.LASF55:
+	.string	"retval"
+.LASF148:
+	.string	"_mm_movehdup_ps"
+.LASF32:
+	.string	"double"
+.LASF88:
+	.string	"positive"
+.LASF163:
+	.string	"lmsKernel_GetBest"
+.LASF45:
+	.string	"__mmask16"
+.LASF107:
+	.string	"lmsKernel_BankUpdateDotScalar"
+.LASF111:
+	.string	"lmsKernel_Sign"
+.LASF76:
+	.string	"mask"
+.LASF25:
+	.string	"signUpdateDot"
+.LASF133:
+	.string	"_mm512_maskz_loadu_ps"
+.LASF160:
+	.string	"_mm_add_ss"
+.LASF80:
+	.string	"leak"
+.LASF73:
+	.string	"zero"
+.LASF49:
+	.string	"lmsKernelBestOnce"
+.LASF7:
+	.string	"unsigned int"
+.LASF149:
+	.string	"_mm_storeu_ps"
+.LASF143:
+	.string	"_mm256_loadu_ps"
+.LASF74:
+	.string	"step0"
+.LASF64:
+	.string	"output"
+.LASF141:
+	.string	"_mm256_undefined_pd"
+.LASF58:
+	.string	"lmsKernel_ChooseBest"
+.LASF129:
+	.string	"_mm512_mul_ps"
+.LASF21:
+	.string	"name"
+.LASF157:
+	.string	"_mm_mul_ps"
+.LASF19:
+	.string	"LmsKernelType_t"
+.LASF6:
+	.string	"short unsigned int"
+.LASF31:
+	.string	"__v4sf"
+.LASF33:
+	.string	"__v4si"
+.LASF109:
+	.string	"sum0"
+.LASF110:
+	.string	"sum1"
+.LASF116:
+	.string	"sum2"
+.LASF117:
+	.string	"sum3"
+.LASF71:
+	.string	"__m512"
+.LASF47:
+	.string	"lmsKernels"
+.LASF34:
+	.string	"__v4df"
+.LASF87:
+	.string	"lmsKernel_SignedGainAvx2"
+.LASF72:
+	.string	"negativeGain"
+.LASF9:
+	.string	"short int"
+.LASF101:
+	.string	"lmsKernel_SignedGainSse2"
+.LASF16:
+	.string	"LMS_KERNEL_AVX2"
+.LASF52:
+	.string	"strcmp"
+.LASF78:
+	.string	"lmsKernel_SignUpdateDotAvx512"
+.LASF139:
+	.string	"_mm512_setzero_ps"
+.LASF154:
+	.string	"_mm_cmpgt_ps"
+.LASF39:
+	.string	"__m256_u"
+.LASF53:
+	.string	"getenv"
+.LASF36:
+	.string	"__m256"
+.LASF56:
+	.string	"lmsKernel_Get"
+.LASF35:
+	.string	"__v8sf"
+.LASF29:
+	.string	"long double"
+.LASF41:
+	.string	"__v16sf"
+.LASF15:
+	.string	"LMS_KERNEL_SSE2"
+.LASF23:
+	.string	"updateDot"
+.LASF153:
+	.string	"_mm_movehl_ps"
+.LASF108:
+	.string	"lmsKernel_SignUpdateDotScalar"
+.LASF147:
+	.string	"_mm256_add_ps"
+.LASF62:
+	.string	"current"
+.LASF125:
+	.string	"__T6"
+.LASF27:
+	.string	"float"
+.LASF75:
+	.string	"step1"
+.LASF91:
+	.string	"lmsKernel_UpdateDotAvx2"
+.LASF114:
+	.string	"lmsKernel_UpdateScalar"
+.LASF63:
+	.string	"gain"
+.LASF155:
+	.string	"_mm_cmplt_ps"
+.LASF132:
+	.string	"_mm512_storeu_ps"
+.LASF5:
+	.string	"unsigned char"
+.LASF79:
+	.string	"lmsKernel_LeakyUpdateDotAvx512"
+.LASF77:
+	.string	"step"
+.LASF103:
+	.string	"lmsKernel_UpdateDotSse2"
+.LASF138:
+	.string	"_mm256_set1_ps"
+.LASF30:
+	.string	"__m128"
+.LASF90:
+	.string	"lmsKernel_LeakyUpdateDotAvx2"
+.LASF140:
+	.string	"_mm256_setzero_ps"
+.LASF89:
+	.string	"negative"
+.LASF104:
+	.string	"lmsKernel_UpdateSse2"
+.LASF40:
+	.string	"__v8df"
+.LASF119:
+	.string	"_mm512_reduce_add_ps"
+.LASF128:
+	.string	"_mm512_fmadd_ps"
+.LASF83:
+	.string	"input"
+.LASF118:
+	.string	"_mm256_fmadd_ps"
+.LASF102:
+	.string	"lmsKernel_LeakyUpdateDotSse2"
+.LASF112:
+	.string	"lmsKernel_LeakyUpdateDotScalar"
+.LASF2:
+	.string	"long unsigned int"
+.LASF10:
+	.string	"char"
+.LASF113:
+	.string	"lmsKernel_UpdateDotScalar"
+.LASF42:
+	.string	"__m512d"
+.LASF162:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF151:
+	.string	"_mm_loadu_ps"
+.LASF14:
+	.string	"LMS_KERNEL_SCALAR"
+.LASF13:
+	.string	"pthread_once_t"
+.LASF158:
+	.string	"_mm_sub_ps"
+.LASF38:
+	.string	"__m128_u"
+.LASF115:
+	.string	"lmsKernel_DotScalar"
+.LASF97:
+	.string	"lmsKernel_BankUpdateDotSse2"
+.LASF94:
+	.string	"lmsKernel_HorizontalSumAvx2"
+.LASF93:
+	.string	"lmsKernel_DotAvx2"
+.LASF65:
+	.string	"length"
+.LASF142:
+	.string	"_mm256_storeu_ps"
+.LASF146:
+	.string	"_mm256_and_ps"
+.LASF22:
+	.string	"update"
+.LASF85:
+	.string	"lmsKernel_BankUpdateDotAvx2"
+.LASF95:
+	.string	"sums"
+.LASF28:
+	.string	"LmsKernel_t"
+.LASF17:
+	.string	"LMS_KERNEL_AVX512"
+.LASF161:
+	.string	"_mm_setzero_ps"
+.LASF82:
+	.string	"lmsKernel_UpdateAvx512"
+.LASF130:
+	.string	"_mm512_add_ps"
+.LASF106:
+	.string	"lmsKernel_HorizontalSumSse2"
+.LASF105:
+	.string	"lmsKernel_DotSse2"
+.LASF37:
+	.string	"__m256d"
+.LASF159:
+	.string	"_mm_add_ps"
+.LASF152:
+	.string	"_mm_set1_ps"
+.LASF96:
+	.string	"shuf"
+.LASF26:
+	.string	"bankUpdateDot"
+.LASF70:
+	.string	"row1"
+.LASF86:
+	.string	"lmsKernel_SignUpdateDotAvx2"
+.LASF92:
+	.string	"lmsKernel_UpdateAvx2"
+.LASF137:
+	.string	"_mm256_castps256_ps128"
+.LASF81:
+	.string	"lmsKernel_UpdateDotAvx512"
+.LASF50:
+	.string	"pthread_once"
+.LASF100:
+	.string	"lmsKernel_SignUpdateDotSse2"
+.LASF120:
+	.string	"__T1"
+.LASF121:
+	.string	"__T2"
+.LASF122:
+	.string	"__T3"
+.LASF135:
+	.string	"_mm512_mask_mov_ps"
+.LASF124:
+	.string	"__T5"
+.LASF136:
+	.string	"_mm512_set1_ps"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/lmsKernel.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
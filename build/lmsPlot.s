@@ -0,0 +1,6618 @@
+	.file	"lmsPlot.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsPlot.c"
+	.section	.rodata
+.LC0:
+	.string	"input"
+.LC1:
+	.string	"output"
+.LC2:
+	.string	"error"
+	.section	.data.rel.ro.local,"aw"
+	.align 16
+	.type	lmsPlotFilterSeries, @object
+	.size	lmsPlotFilterSeries, 24
+lmsPlotFilterSeries:
+	.quad	.LC0
+	.quad	.LC1
+	.quad	.LC2
+	.section	.rodata
+.LC3:
+	.string	"#1f77b4"
+.LC4:
+	.string	"#2ca02c"
+.LC5:
+	.string	"#d62728"
+.LC6:
+	.string	"#9467bd"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	lmsPlotColors, @object
+	.size	lmsPlotColors, 32
+lmsPlotColors:
+	.quad	.LC3
+	.quad	.LC4
+	.quad	.LC5
+	.quad	.LC6
+	.text
+	.type	lmsPlot_ClearBucket, @function
+lmsPlot_ClearBucket:
+.LFB6:
+	.file 1 "source/lmsPlot.c"
+	.loc 1 37 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	DWORD PTR -28[rbp], esi
+.LBB2:
+	.loc 1 38 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 38 5
+	jmp	.L2
+.L3:
+	.loc 1 40 13 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 40 36 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 40 30 discriminator 3
+	imul	eax, DWORD PTR -28[rbp]
+	mov	ecx, eax
+	.loc 1 40 50 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 40 22 discriminator 3
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 40 55 discriminator 3
+	movss	xmm0, DWORD PTR .LC7[rip]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 41 13 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 41 36 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 41 30 discriminator 3
+	imul	eax, DWORD PTR -28[rbp]
+	mov	ecx, eax
+	.loc 1 41 50 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 41 22 discriminator 3
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 41 55 discriminator 3
+	movss	xmm0, DWORD PTR .LC8[rip]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 42 13 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	.loc 1 42 39 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 42 33 discriminator 3
+	imul	eax, DWORD PTR -28[rbp]
+	mov	ecx, eax
+	.loc 1 42 53 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 42 25 discriminator 3
+	sal	rax, 3
+	add	rax, rdx
+	.loc 1 42 58 discriminator 3
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 38 45 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L2:
+	.loc 1 38 29 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 38 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], eax
+	jl	.L3
+.LBE2:
+	.loc 1 44 1
+	nop
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	lmsPlot_ClearBucket, .-lmsPlot_ClearBucket
+	.type	lmsPlot_NextBucket, @function
+lmsPlot_NextBucket:
+.LFB7:
+	.loc 1 50 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 56
+	.cfi_offset 3, -24
+	mov	QWORD PTR -56[rbp], rdi
+	.loc 1 51 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 53 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 53 9
+	lea	edx, 1[rax]
+	.loc 1 53 8
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 56[rax], edx
+	.loc 1 53 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, DWORD PTR 56[rax]
+	.loc 1 53 42
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 53 8
+	cmp	edx, eax
+	jne	.L5
+	.loc 1 55 13
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 55 23
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	edx, eax
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 56[rax], edx
+	.loc 1 56 13
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 56 26
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 64[rax], rdx
+.LBB3:
+	.loc 1 57 18
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 57 9
+	jmp	.L6
+.L9:
+.LBB4:
+	.loc 1 59 22
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 59 13
+	jmp	.L7
+.L8:
+.LBB5:
+	.loc 1 61 41 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	imul	eax, DWORD PTR -28[rbp]
+	lea	edx, [rax+rax]
+	.loc 1 61 27 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	add	eax, edx
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 62 27 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, edx
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 63 81 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 63 90 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 63 49 discriminator 3
+	mov	eax, DWORD PTR [rax]
+	.loc 1 63 59 discriminator 3
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 32[rdx]
+	.loc 1 63 68 discriminator 3
+	mov	ecx, DWORD PTR -32[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	add	rdx, rcx
+	.loc 1 63 49 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 63 21 discriminator 3
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR 32[rdx]
+	.loc 1 63 33 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	esi, edx
+	imul	esi, DWORD PTR -28[rbp]
+	.loc 1 63 42 discriminator 3
+	mov	edx, DWORD PTR -24[rbp]
+	add	edx, esi
+	movsx	rdx, edx
+	.loc 1 63 30 discriminator 3
+	sal	rdx, 2
+	lea	rbx, [rcx+rdx]
+	.loc 1 63 49 discriminator 3
+	movaps	xmm1, xmm0
+	movd	xmm0, eax
+	call	fminf@PLT
+	movd	eax, xmm0
+	.loc 1 63 47 discriminator 3
+	mov	DWORD PTR [rbx], eax
+	.loc 1 64 81 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 64 90 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 64 49 discriminator 3
+	mov	eax, DWORD PTR [rax]
+	.loc 1 64 59 discriminator 3
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 40[rdx]
+	.loc 1 64 68 discriminator 3
+	mov	ecx, DWORD PTR -32[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	add	rdx, rcx
+	.loc 1 64 49 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 64 21 discriminator 3
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR 40[rdx]
+	.loc 1 64 33 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	mov	esi, edx
+	imul	esi, DWORD PTR -28[rbp]
+	.loc 1 64 42 discriminator 3
+	mov	edx, DWORD PTR -24[rbp]
+	add	edx, esi
+	movsx	rdx, edx
+	.loc 1 64 30 discriminator 3
+	sal	rdx, 2
+	lea	rbx, [rcx+rdx]
+	.loc 1 64 49 discriminator 3
+	movaps	xmm1, xmm0
+	movd	xmm0, eax
+	call	fmaxf@PLT
+	movd	eax, xmm0
+	.loc 1 64 47 discriminator 3
+	mov	DWORD PTR [rbx], eax
+	.loc 1 65 56 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 65 68 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 65 82 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 65 94 discriminator 3
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 65 21 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	.loc 1 65 36 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	imul	eax, DWORD PTR -28[rbp]
+	mov	ecx, eax
+	.loc 1 65 45 discriminator 3
+	mov	eax, DWORD PTR -24[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 65 33 discriminator 3
+	sal	rax, 3
+	add	rax, rdx
+	.loc 1 65 76 discriminator 3
+	addsd	xmm0, xmm1
+	.loc 1 65 50 discriminator 3
+	movsd	QWORD PTR [rax], xmm0
+.LBE5:
+	.loc 1 59 42 discriminator 3
+	add	DWORD PTR -24[rbp], 1
+.L7:
+	.loc 1 59 31 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -28[rbp]
+	jl	.L8
+.LBE4:
+	.loc 1 57 45 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L6:
+	.loc 1 57 33 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 57 27 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jl	.L9
+.L5:
+.LBE3:
+	.loc 1 69 5
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, DWORD PTR 56[rax]
+	mov	rax, QWORD PTR -56[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsPlot_ClearBucket
+	.loc 1 70 16
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 72[rax], 0
+	.loc 1 71 1
+	nop
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	lmsPlot_NextBucket, .-lmsPlot_NextBucket
+	.type	lmsPlot_UsedBuckets, @function
+lmsPlot_UsedBuckets:
+.LFB8:
+	.loc 1 77 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 78 16
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 56[rax]
+	.loc 1 78 34
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 78 50
+	test	rax, rax
+	setg	al
+	movzx	eax, al
+	.loc 1 78 26
+	add	eax, edx
+	.loc 1 79 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	lmsPlot_UsedBuckets, .-lmsPlot_UsedBuckets
+	.type	lmsPlot_BucketFrames, @function
+lmsPlot_BucketFrames:
+.LFB9:
+	.loc 1 85 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	DWORD PTR -12[rbp], esi
+	.loc 1 86 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 86 56
+	cmp	DWORD PTR -12[rbp], eax
+	jge	.L13
+	.loc 1 86 56 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	jmp	.L15
+.L13:
+	.loc 1 86 56 discriminator 2
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 72[rax]
+.L15:
+	.loc 1 87 1 is_stmt 1 discriminator 5
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	lmsPlot_BucketFrames, .-lmsPlot_BucketFrames
+	.section	.rodata
+	.align 8
+.LC10:
+	.string	"Wrong plot width %d or number of series %d\n"
+.LC11:
+	.string	".csv"
+.LC12:
+	.string	".svg"
+	.align 8
+.LC13:
+	.string	"Error allocating plot of %d buckets\n"
+	.text
+	.globl	lmsPlot_Init
+	.type	lmsPlot_Init, @function
+lmsPlot_Init:
+.LFB10:
+	.loc 1 90 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	DWORD PTR -36[rbp], edx
+	mov	QWORD PTR -48[rbp], rcx
+	.loc 1 91 45
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 91 29
+	mov	esi, 46
+	mov	rdi, rax
+	call	strrchr@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 93 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, 88
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 94 18
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 94 8
+	cmp	eax, 15
+	jle	.L17
+	.loc 1 94 60 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 94 48 discriminator 1
+	cmp	eax, 65536
+	jg	.L17
+	.loc 1 95 9
+	cmp	DWORD PTR -36[rbp], 0
+	jle	.L17
+	.loc 1 95 30 discriminator 1
+	cmp	DWORD PTR -36[rbp], 4
+	jle	.L18
+.L17:
+	.loc 1 97 72
+	mov	rax, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 97 9
+	mov	edx, DWORD PTR -36[rbp]
+	mov	esi, eax
+	lea	rax, .LC10[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 98 16
+	mov	eax, 1
+	jmp	.L19
+.L18:
+	.loc 1 100 20
+	mov	rcx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+	.loc 1 101 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 101 26
+	and	eax, -2
+	mov	edx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 8[rax], edx
+	.loc 1 102 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 16[rax], 0
+	.loc 1 103 8
+	cmp	QWORD PTR -8[rbp], 0
+	je	.L20
+	.loc 1 103 33 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, .LC11[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 103 29 discriminator 1
+	test	eax, eax
+	jne	.L20
+	.loc 1 105 22
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 16[rax], 2
+	jmp	.L21
+.L20:
+	.loc 1 107 13
+	cmp	QWORD PTR -8[rbp], 0
+	je	.L21
+	.loc 1 107 38 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, .LC12[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 107 34 discriminator 1
+	test	eax, eax
+	jne	.L21
+	.loc 1 109 22
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 16[rax], 1
+.L21:
+	.loc 1 111 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR -36[rbp]
+	mov	DWORD PTR 20[rax], edx
+	.loc 1 112 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 113 22
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 64[rax], 1
+	.loc 1 115 49
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 115 27
+	movsx	rdx, eax
+	.loc 1 115 56
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	.loc 1 115 18
+	imul	rax, rdx
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 116 29
+	mov	rax, QWORD PTR -16[rbp]
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 116 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 32[rax], rdx
+	.loc 1 117 29
+	mov	rax, QWORD PTR -16[rbp]
+	sal	rax, 2
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 117 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 40[rax], rdx
+	.loc 1 118 33
+	mov	rax, QWORD PTR -16[rbp]
+	sal	rax, 3
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 118 22
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 119 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 119 8
+	test	rax, rax
+	je	.L22
+	.loc 1 119 41 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 119 33 discriminator 1
+	test	rax, rax
+	je	.L22
+	.loc 1 119 68 discriminator 2
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 119 60 discriminator 2
+	test	rax, rax
+	jne	.L23
+.L22:
+	.loc 1 121 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	esi, eax
+	lea	rax, .LC13[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 122 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsPlot_Free
+	.loc 1 123 16
+	mov	eax, 1
+	jmp	.L19
+.L23:
+	.loc 1 125 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	lmsPlot_ClearBucket
+	.loc 1 126 12
+	mov	eax, 0
+.L19:
+	.loc 1 127 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	lmsPlot_Init, .-lmsPlot_Init
+	.globl	lmsPlot_Free
+	.type	lmsPlot_Free, @function
+lmsPlot_Free:
+.LFB11:
+	.loc 1 130 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 131 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 131 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 132 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 132 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 133 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 133 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 134 19
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 32[rax], 0
+	.loc 1 135 19
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 40[rax], 0
+	.loc 1 136 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 48[rax], 0
+	.loc 1 137 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	lmsPlot_Free, .-lmsPlot_Free
+	.globl	lmsPlot_AddFrames
+	.type	lmsPlot_AddFrames, @function
+lmsPlot_AddFrames:
+.LFB12:
+	.loc 1 140 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -56[rbp], rdi
+	mov	QWORD PTR -64[rbp], rsi
+	mov	DWORD PTR -68[rbp], edx
+	.loc 1 141 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 143 9
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 80[rax]
+	.loc 1 143 18
+	mov	eax, DWORD PTR -68[rbp]
+	cdqe
+	add	rdx, rax
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 80[rax], rdx
+	.loc 1 144 11
+	jmp	.L26
+.L40:
+.LBB6:
+	.loc 1 146 17
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 72[rax]
+	.loc 1 146 31
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 146 12
+	cmp	rdx, rax
+	jne	.L27
+	.loc 1 148 13
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	lmsPlot_NextBucket
+.L27:
+	.loc 1 152 28
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 64[rax]
+	.loc 1 152 47
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 152 41
+	sub	rdx, rax
+	.loc 1 152 54
+	mov	eax, DWORD PTR -68[rbp]
+	cdqe
+	.loc 1 152 102
+	cmp	rdx, rax
+	jge	.L28
+	.loc 1 152 75 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 152 88 discriminator 1
+	mov	ecx, eax
+	.loc 1 152 94 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 152 88 discriminator 1
+	mov	edx, eax
+	mov	eax, ecx
+	sub	eax, edx
+	jmp	.L29
+.L28:
+	.loc 1 152 102 discriminator 2
+	mov	eax, DWORD PTR -68[rbp]
+.L29:
+	.loc 1 152 19 discriminator 4
+	mov	DWORD PTR -36[rbp], eax
+.LBB7:
+	.loc 1 153 18 discriminator 4
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 153 9 discriminator 4
+	jmp	.L30
+.L39:
+.LBB8:
+	.loc 1 155 33
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 155 47
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 155 57
+	imul	eax, DWORD PTR -32[rbp]
+	mov	ecx, eax
+	.loc 1 155 66
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 155 42
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 155 19
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 156 33
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 156 47
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 156 57
+	imul	eax, DWORD PTR -32[rbp]
+	mov	ecx, eax
+	.loc 1 156 66
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 156 42
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 156 19
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 157 20
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBB9:
+	.loc 1 159 22
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 159 13
+	jmp	.L31
+.L38:
+.LBB10:
+	.loc 1 161 46
+	mov	eax, DWORD PTR -28[rbp]
+	imul	eax, DWORD PTR -32[rbp]
+	mov	edx, eax
+	.loc 1 161 55
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 161 43
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	.loc 1 161 29
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -40[rbp], xmm0
+	.loc 1 162 53
+	movss	xmm0, DWORD PTR -8[rbp]
+	comiss	xmm0, DWORD PTR -40[rbp]
+	jbe	.L43
+	.loc 1 162 53 is_stmt 0 discriminator 1
+	movss	xmm0, DWORD PTR -40[rbp]
+	jmp	.L34
+.L43:
+	.loc 1 162 53 discriminator 2
+	movss	xmm0, DWORD PTR -8[rbp]
+.L34:
+	.loc 1 162 25 is_stmt 1 discriminator 4
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 163 53 discriminator 4
+	movss	xmm0, DWORD PTR -40[rbp]
+	comiss	xmm0, DWORD PTR -12[rbp]
+	jbe	.L44
+	.loc 1 163 53 is_stmt 0 discriminator 1
+	movss	xmm0, DWORD PTR -40[rbp]
+	jmp	.L37
+.L44:
+	.loc 1 163 53 discriminator 2
+	movss	xmm0, DWORD PTR -12[rbp]
+.L37:
+	.loc 1 163 25 is_stmt 1 discriminator 4
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 164 31 discriminator 4
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, DWORD PTR -40[rbp]
+	.loc 1 164 45 discriminator 4
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -40[rbp]
+	mulsd	xmm0, xmm1
+	.loc 1 164 28 discriminator 4
+	movsd	xmm1, QWORD PTR -24[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBE10:
+	.loc 1 159 37 discriminator 4
+	add	DWORD PTR -28[rbp], 1
+.L31:
+	.loc 1 159 31 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	cmp	eax, DWORD PTR -36[rbp]
+	jl	.L38
+.LBE9:
+	.loc 1 166 17 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 166 31 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 166 41 discriminator 2
+	imul	eax, DWORD PTR -32[rbp]
+	mov	ecx, eax
+	.loc 1 166 50 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 166 26 discriminator 2
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 166 55 discriminator 2
+	movss	xmm0, DWORD PTR -8[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 167 17 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 167 31 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 167 41 discriminator 2
+	imul	eax, DWORD PTR -32[rbp]
+	mov	ecx, eax
+	.loc 1 167 50 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 167 26 discriminator 2
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 167 55 discriminator 2
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 168 17 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	.loc 1 168 34 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 168 29 discriminator 2
+	imul	eax, DWORD PTR -32[rbp]
+	mov	ecx, eax
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	sal	rax, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 168 17 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	.loc 1 168 34 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 168 29 discriminator 2
+	imul	eax, DWORD PTR -32[rbp]
+	mov	ecx, eax
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	sal	rax, 3
+	add	rax, rdx
+	.loc 1 168 58 discriminator 2
+	addsd	xmm0, QWORD PTR -24[rbp]
+	movsd	QWORD PTR [rax], xmm0
+.LBE8:
+	.loc 1 153 38 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L30:
+	.loc 1 153 27 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -32[rbp]
+	jl	.L39
+.LBE7:
+	.loc 1 170 13
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 72[rax]
+	.loc 1 170 20
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	add	rdx, rax
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	.loc 1 171 19
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	.loc 1 171 27
+	mov	eax, DWORD PTR -32[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 171 16
+	sal	rax, 2
+	add	QWORD PTR -64[rbp], rax
+	.loc 1 172 15
+	mov	eax, DWORD PTR -36[rbp]
+	sub	DWORD PTR -68[rbp], eax
+.L26:
+.LBE6:
+	.loc 1 144 18
+	cmp	DWORD PTR -68[rbp], 0
+	jg	.L40
+	.loc 1 174 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	lmsPlot_AddFrames, .-lmsPlot_AddFrames
+	.section	.rodata
+.LC14:
+	.string	"&amp;"
+.LC15:
+	.string	"&lt;"
+.LC16:
+	.string	"&gt;"
+.LC17:
+	.string	"&quot;"
+	.text
+	.type	lmsPlot_WriteEscaped, @function
+lmsPlot_WriteEscaped:
+.LFB13:
+	.loc 1 180 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	.loc 1 181 5
+	jmp	.L46
+.L52:
+	.loc 1 183 17
+	mov	rax, QWORD PTR -16[rbp]
+	movzx	eax, BYTE PTR [rax]
+	movsx	eax, al
+	.loc 1 183 9
+	cmp	eax, 62
+	je	.L47
+	cmp	eax, 62
+	jg	.L48
+	cmp	eax, 60
+	je	.L49
+	cmp	eax, 60
+	jg	.L48
+	cmp	eax, 34
+	je	.L50
+	cmp	eax, 38
+	jne	.L48
+	.loc 1 186 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rax
+	mov	edx, 5
+	mov	esi, 1
+	lea	rax, .LC14[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 187 17
+	jmp	.L51
+.L49:
+	.loc 1 190 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rax
+	mov	edx, 4
+	mov	esi, 1
+	lea	rax, .LC15[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 191 17
+	jmp	.L51
+.L47:
+	.loc 1 194 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rax
+	mov	edx, 4
+	mov	esi, 1
+	lea	rax, .LC16[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 195 17
+	jmp	.L51
+.L50:
+	.loc 1 198 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rax
+	mov	edx, 6
+	mov	esi, 1
+	lea	rax, .LC17[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 199 17
+	jmp	.L51
+.L48:
+	.loc 1 202 23
+	mov	rax, QWORD PTR -16[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 202 17
+	movsx	eax, al
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rsi, rdx
+	mov	edi, eax
+	call	fputc@PLT
+	.loc 1 203 17
+	nop
+.L51:
+	.loc 1 181 31
+	add	QWORD PTR -16[rbp], 1
+.L46:
+	.loc 1 181 12 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 181 18 discriminator 1
+	test	al, al
+	jne	.L52
+	.loc 1 206 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	lmsPlot_WriteEscaped, .-lmsPlot_WriteEscaped
+	.section	.rodata
+.LC18:
+	.string	"first_frame,frames"
+.LC19:
+	.string	",%s_min,%s_max,%s_rms"
+.LC20:
+	.string	"%ld,%ld"
+.LC21:
+	.string	",%.6g,%.6g,%.6g"
+	.text
+	.type	lmsPlot_WriteCsv, @function
+lmsPlot_WriteCsv:
+.LFB14:
+	.loc 1 212 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	.loc 1 213 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	mov	DWORD PTR -16[rbp], eax
+	.loc 1 215 5
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rcx, rax
+	mov	edx, 18
+	mov	esi, 1
+	lea	rax, .LC18[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+.LBB11:
+	.loc 1 216 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 216 5
+	jmp	.L54
+.L55:
+	.loc 1 218 84 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 218 91 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 218 9 discriminator 3
+	mov	rsi, QWORD PTR [rax]
+	.loc 1 218 68 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 218 75 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 218 9 discriminator 3
+	mov	rcx, QWORD PTR [rax]
+	.loc 1 218 52 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 218 59 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 218 9 discriminator 3
+	mov	rdx, QWORD PTR [rax]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	r8, rsi
+	lea	rsi, .LC19[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 216 34 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L54:
+	.loc 1 216 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -16[rbp]
+	jl	.L55
+.LBE11:
+	.loc 1 220 5
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rsi, rax
+	mov	edi, 10
+	call	fputc@PLT
+.LBB12:
+	.loc 1 222 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 222 5
+	jmp	.L56
+.L59:
+.LBB13:
+	.loc 1 224 29
+	mov	edx, DWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsPlot_BucketFrames
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 225 34
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	.loc 1 225 48
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 225 9
+	imul	rdx, rax
+	mov	rcx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rsi, .LC20[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+.LBB14:
+	.loc 1 226 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 226 9
+	jmp	.L57
+.L58:
+	.loc 1 229 30 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	.loc 1 229 45 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	imul	eax, DWORD PTR -16[rbp]
+	mov	ecx, eax
+	.loc 1 229 54 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 229 42 discriminator 3
+	sal	rax, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 228 13 discriminator 3
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, QWORD PTR -24[rbp]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	sqrt@PLT
+	movq	rcx, xmm0
+	.loc 1 228 81 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 228 93 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	imul	eax, DWORD PTR -16[rbp]
+	mov	esi, eax
+	.loc 1 228 102 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, esi
+	cdqe
+	.loc 1 228 90 discriminator 3
+	sal	rax, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 228 13 discriminator 3
+	cvtss2sd	xmm0, xmm0
+	.loc 1 228 50 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 228 62 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	imul	eax, DWORD PTR -16[rbp]
+	mov	esi, eax
+	.loc 1 228 71 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, esi
+	cdqe
+	.loc 1 228 59 discriminator 3
+	sal	rax, 2
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 228 13 discriminator 3
+	pxor	xmm3, xmm3
+	cvtss2sd	xmm3, xmm1
+	movq	rdx, xmm3
+	mov	rax, QWORD PTR -48[rbp]
+	movq	xmm2, rcx
+	movapd	xmm1, xmm0
+	movq	xmm0, rdx
+	lea	rdx, .LC21[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	mov	eax, 3
+	call	fprintf@PLT
+	.loc 1 226 38 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L57:
+	.loc 1 226 27 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -16[rbp]
+	jl	.L58
+.LBE14:
+	.loc 1 231 9 discriminator 2
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rsi, rax
+	mov	edi, 10
+	call	fputc@PLT
+.LBE13:
+	.loc 1 222 53 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L56:
+	.loc 1 222 25 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	lmsPlot_UsedBuckets
+	.loc 1 222 23 discriminator 1
+	cmp	DWORD PTR -8[rbp], eax
+	jl	.L59
+.LBE12:
+	.loc 1 233 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	lmsPlot_WriteCsv, .-lmsPlot_WriteCsv
+	.section	.rodata
+	.align 8
+.LC24:
+	.string	"<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" height=\"%d\" viewBox=\"0 0 %d %d\" font-family=\"sans-serif\" font-size=\"12\">\n"
+	.align 8
+.LC25:
+	.string	"<rect width=\"100%%\" height=\"100%%\" fill=\"white\"/>\n"
+	.align 8
+.LC26:
+	.string	"<text x=\"%d\" y=\"24\" font-size=\"16\">"
+	.align 8
+.LC27:
+	.string	"</text>\n<text x=\"%d\" y=\"42\" fill=\"#555\">%ld frames, %ld per bucket</text>\n"
+	.align 8
+.LC35:
+	.string	"<g>\n<rect x=\"%d\" y=\"%d\" width=\"%d\" height=\"%d\" fill=\"none\" stroke=\"#999\"/>\n"
+	.align 8
+.LC37:
+	.string	"<line x1=\"%d\" y1=\"%.1f\" x2=\"%d\" y2=\"%.1f\" stroke=\"#ccc\"/>\n"
+	.align 8
+.LC38:
+	.string	"<text x=\"%d\" y=\"%d\" text-anchor=\"end\">%.4g</text>\n"
+	.align 8
+.LC39:
+	.string	"<text x=\"%d\" y=\"%d\" fill=\"%s\">"
+.LC40:
+	.string	" (RMS %.4g)</text>\n"
+	.align 8
+.LC41:
+	.string	"<polygon fill=\"%s\" fill-opacity=\"0.35\" stroke=\"%s\" stroke-width=\"0.8\" points=\""
+.LC44:
+	.string	"%.1f,%.1f "
+.LC45:
+	.string	"\"/>\n"
+.LC46:
+	.string	"<text x=\"%d\" y=\"%d\">0</text>\n"
+	.align 8
+.LC47:
+	.string	"<text x=\"%d\" y=\"%d\" text-anchor=\"end\">%ld</text>\n</g>\n"
+.LC48:
+	.string	"</svg>\n"
+	.text
+	.type	lmsPlot_WriteSvg, @function
+lmsPlot_WriteSvg:
+.LFB15:
+	.loc 1 240 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 144
+	mov	QWORD PTR -120[rbp], rdi
+	mov	QWORD PTR -128[rbp], rsi
+	mov	QWORD PTR -136[rbp], rdx
+	.loc 1 241 15
+	mov	rax, QWORD PTR -120[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	mov	DWORD PTR -44[rbp], eax
+	.loc 1 242 22
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdi, rax
+	call	lmsPlot_UsedBuckets
+	mov	DWORD PTR -48[rbp], eax
+	.loc 1 243 15
+	mov	DWORD PTR -52[rbp], 1100
+	.loc 1 244 53
+	mov	eax, DWORD PTR -44[rbp]
+	imul	eax, eax, 220
+	.loc 1 244 15
+	add	eax, 50
+	mov	DWORD PTR -56[rbp], eax
+	.loc 1 245 40
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 245 94
+	test	rax, rax
+	jle	.L61
+	.loc 1 245 68 discriminator 1
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 245 56 discriminator 1
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	.loc 1 245 94 discriminator 1
+	movsd	xmm1, QWORD PTR .LC22[rip]
+	divsd	xmm0, xmm1
+	jmp	.L62
+.L61:
+	.loc 1 245 94 is_stmt 0 discriminator 2
+	movsd	xmm0, QWORD PTR .LC23[rip]
+.L62:
+	.loc 1 245 18 is_stmt 1 discriminator 4
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 247 5 discriminator 4
+	mov	edi, DWORD PTR -56[rbp]
+	mov	esi, DWORD PTR -52[rbp]
+	mov	ecx, DWORD PTR -56[rbp]
+	mov	edx, DWORD PTR -52[rbp]
+	mov	rax, QWORD PTR -128[rbp]
+	mov	r9d, edi
+	mov	r8d, esi
+	lea	rsi, .LC24[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 249 5 discriminator 4
+	mov	rax, QWORD PTR -128[rbp]
+	lea	rdx, .LC25[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 250 5 discriminator 4
+	mov	rax, QWORD PTR -128[rbp]
+	mov	edx, 80
+	lea	rcx, .LC26[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 251 5 discriminator 4
+	mov	rdx, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsPlot_WriteEscaped
+	.loc 1 253 53 discriminator 4
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rcx, QWORD PTR 64[rax]
+	.loc 1 253 39 discriminator 4
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR 80[rax]
+	.loc 1 252 5 discriminator 4
+	mov	rax, QWORD PTR -128[rbp]
+	mov	r8, rcx
+	mov	rcx, rdx
+	mov	edx, 80
+	lea	rsi, .LC27[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+.LBB15:
+	.loc 1 255 14 discriminator 4
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 255 5 discriminator 4
+	jmp	.L63
+.L88:
+.LBB16:
+	.loc 1 257 49
+	mov	eax, DWORD PTR -4[rbp]
+	imul	eax, eax, 220
+	.loc 1 257 19
+	add	eax, 60
+	mov	DWORD PTR -68[rbp], eax
+	.loc 1 258 15
+	movss	xmm0, DWORD PTR .LC7[rip]
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 259 15
+	movss	xmm0, DWORD PTR .LC8[rip]
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 260 16
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBB17:
+	.loc 1 262 18
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 262 9
+	jmp	.L64
+.L65:
+	.loc 1 264 34 discriminator 3
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 264 46 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	imul	eax, DWORD PTR -44[rbp]
+	mov	ecx, eax
+	.loc 1 264 55 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 264 43 discriminator 3
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 264 19 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -8[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, eax
+	call	fminf@PLT
+	movd	eax, xmm0
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 265 36 discriminator 3
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 265 48 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	imul	eax, DWORD PTR -44[rbp]
+	mov	ecx, eax
+	.loc 1 265 57 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 265 45 discriminator 3
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 265 20 discriminator 3
+	movss	xmm0, DWORD PTR [rax]
+	mov	eax, DWORD PTR -12[rbp]
+	movaps	xmm1, xmm0
+	movd	xmm0, eax
+	call	fmaxf@PLT
+	movd	eax, xmm0
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 266 31 discriminator 3
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	.loc 1 266 46 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	imul	eax, DWORD PTR -44[rbp]
+	mov	ecx, eax
+	.loc 1 266 55 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 266 43 discriminator 3
+	sal	rax, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 266 24 discriminator 3
+	movsd	xmm1, QWORD PTR -24[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 262 36 discriminator 3
+	add	DWORD PTR -28[rbp], 1
+.L64:
+	.loc 1 262 27 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	cmp	eax, DWORD PTR -48[rbp]
+	jl	.L65
+.LBE17:
+	.loc 1 268 19
+	movss	xmm0, DWORD PTR -12[rbp]
+	comiss	xmm0, DWORD PTR -8[rbp]
+	setnb	al
+	.loc 1 268 13
+	xor	eax, 1
+	.loc 1 268 12
+	test	al, al
+	jne	.L66
+	.loc 1 268 32 discriminator 1
+	movss	xmm0, DWORD PTR -8[rbp]
+	movss	xmm1, DWORD PTR .LC28[rip]
+	andps	xmm1, xmm0
+	.loc 1 268 28 discriminator 1
+	movss	xmm0, DWORD PTR .LC29[rip]
+	ucomiss	xmm0, xmm1
+	jb	.L66
+	.loc 1 268 50 discriminator 2
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	xmm1, DWORD PTR .LC28[rip]
+	andps	xmm1, xmm0
+	.loc 1 268 46 discriminator 2
+	movss	xmm0, DWORD PTR .LC29[rip]
+	ucomiss	xmm0, xmm1
+	jnb	.L93
+.L66:
+	.loc 1 270 17
+	movss	xmm0, DWORD PTR .LC30[rip]
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 271 18
+	movss	xmm0, DWORD PTR .LC31[rip]
+	movss	DWORD PTR -12[rbp], xmm0
+	jmp	.L69
+.L93:
+	.loc 1 273 23
+	movss	xmm0, DWORD PTR -12[rbp]
+	movaps	xmm1, xmm0
+	subss	xmm1, DWORD PTR -8[rbp]
+	.loc 1 273 48
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	xmm2, DWORD PTR .LC28[rip]
+	andps	xmm2, xmm0
+	.loc 1 273 46
+	movss	xmm0, DWORD PTR .LC31[rip]
+	addss	xmm2, xmm0
+	.loc 1 273 38
+	movss	xmm0, DWORD PTR .LC32[rip]
+	mulss	xmm0, xmm2
+	.loc 1 273 17
+	comiss	xmm0, xmm1
+	jbe	.L69
+	.loc 1 275 35
+	movss	xmm0, DWORD PTR -8[rbp]
+	movss	xmm1, DWORD PTR .LC28[rip]
+	andps	xmm1, xmm0
+	.loc 1 275 33
+	movss	xmm0, DWORD PTR .LC31[rip]
+	addss	xmm1, xmm0
+	.loc 1 275 25
+	movss	xmm0, DWORD PTR .LC33[rip]
+	mulss	xmm1, xmm0
+	.loc 1 275 17
+	movss	xmm0, DWORD PTR -8[rbp]
+	subss	xmm0, xmm1
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 276 36
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	xmm1, DWORD PTR .LC28[rip]
+	andps	xmm1, xmm0
+	.loc 1 276 34
+	movss	xmm0, DWORD PTR .LC31[rip]
+	addss	xmm1, xmm0
+	.loc 1 276 26
+	movss	xmm0, DWORD PTR .LC33[rip]
+	mulss	xmm0, xmm1
+	.loc 1 276 18
+	movss	xmm1, DWORD PTR -12[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -12[rbp], xmm0
+.L69:
+	.loc 1 278 55
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -12[rbp]
+	.loc 1 278 68
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, DWORD PTR -8[rbp]
+	movapd	xmm1, xmm0
+	subsd	xmm1, xmm2
+	.loc 1 278 22
+	movsd	xmm0, QWORD PTR .LC34[rip]
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR -80[rbp], xmm0
+	.loc 1 280 9
+	mov	edx, DWORD PTR -68[rbp]
+	mov	rax, QWORD PTR -128[rbp]
+	mov	r9d, 180
+	mov	r8d, 1000
+	mov	ecx, edx
+	mov	edx, 80
+	lea	rsi, .LC35[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 282 12
+	pxor	xmm0, xmm0
+	comiss	xmm0, DWORD PTR -8[rbp]
+	jbe	.L71
+	.loc 1 282 26 discriminator 1
+	movss	xmm0, DWORD PTR -12[rbp]
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	jbe	.L71
+.LBB18:
+	.loc 1 284 37
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -68[rbp]
+	.loc 1 284 44
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -12[rbp]
+	mulsd	xmm0, QWORD PTR -80[rbp]
+	.loc 1 284 26
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -88[rbp], xmm0
+	.loc 1 285 13
+	movsd	xmm0, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR -128[rbp]
+	movapd	xmm1, xmm0
+	mov	ecx, 1080
+	movq	xmm0, rdx
+	mov	edx, 80
+	lea	rsi, .LC37[rip]
+	mov	rdi, rax
+	mov	eax, 2
+	call	fprintf@PLT
+.L71:
+.LBE18:
+	.loc 1 288 9
+	pxor	xmm3, xmm3
+	cvtss2sd	xmm3, DWORD PTR -12[rbp]
+	movq	rdx, xmm3
+	mov	eax, DWORD PTR -68[rbp]
+	lea	ecx, 10[rax]
+	mov	rax, QWORD PTR -128[rbp]
+	movq	xmm0, rdx
+	mov	edx, 74
+	lea	rsi, .LC38[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	fprintf@PLT
+	.loc 1 289 9
+	pxor	xmm4, xmm4
+	cvtss2sd	xmm4, DWORD PTR -8[rbp]
+	movq	rdx, xmm4
+	mov	eax, DWORD PTR -68[rbp]
+	lea	ecx, 180[rax]
+	mov	rax, QWORD PTR -128[rbp]
+	movq	xmm0, rdx
+	mov	edx, 74
+	lea	rsi, .LC38[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	fprintf@PLT
+	.loc 1 291 112
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, lmsPlotColors[rip]
+	mov	rcx, QWORD PTR [rdx+rax]
+	.loc 1 291 9
+	mov	eax, DWORD PTR -68[rbp]
+	lea	edx, 16[rax]
+	mov	rax, QWORD PTR -128[rbp]
+	mov	r8, rcx
+	mov	ecx, edx
+	mov	edx, 86
+	lea	rsi, .LC39[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 292 40
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 292 47
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 292 9
+	mov	rdx, QWORD PTR [rax]
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsPlot_WriteEscaped
+	.loc 1 293 52
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 293 9
+	test	rax, rax
+	jle	.L74
+	.loc 1 293 90 discriminator 1
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 293 68 discriminator 1
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, rax
+	movsd	xmm0, QWORD PTR -24[rbp]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	sqrt@PLT
+	movq	rax, xmm0
+	jmp	.L75
+.L74:
+	.loc 1 293 9 discriminator 2
+	mov	rax, QWORD PTR .LC9[rip]
+.L75:
+	.loc 1 293 9 is_stmt 0 discriminator 4
+	mov	rdx, QWORD PTR -128[rbp]
+	movq	xmm0, rax
+	lea	rax, .LC40[rip]
+	mov	rsi, rax
+	mov	rdi, rdx
+	mov	eax, 1
+	call	fprintf@PLT
+	.loc 1 297 48 is_stmt 1 discriminator 4
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, lmsPlotColors[rip]
+	mov	rcx, QWORD PTR [rdx+rax]
+	.loc 1 297 30 discriminator 4
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, lmsPlotColors[rip]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 296 9 discriminator 4
+	mov	rax, QWORD PTR -128[rbp]
+	lea	rsi, .LC41[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+.LBB19:
+	.loc 1 298 18 discriminator 4
+	mov	DWORD PTR -32[rbp], 0
+	.loc 1 298 9 discriminator 4
+	jmp	.L76
+.L87:
+.LBB20:
+	.loc 1 300 22
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 300 13
+	jmp	.L77
+.L86:
+.LBB21:
+	.loc 1 302 47
+	cmp	DWORD PTR -32[rbp], 0
+	je	.L78
+	.loc 1 302 55 discriminator 1
+	mov	eax, DWORD PTR -48[rbp]
+	sub	eax, 1
+	.loc 1 302 47 discriminator 1
+	sub	eax, DWORD PTR -36[rbp]
+	jmp	.L79
+.L78:
+	.loc 1 302 47 is_stmt 0 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+.L79:
+	.loc 1 302 27 is_stmt 1 discriminator 4
+	mov	DWORD PTR -92[rbp], eax
+	.loc 1 303 75 discriminator 4
+	cmp	DWORD PTR -32[rbp], 0
+	jne	.L80
+	.loc 1 303 49 discriminator 1
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 303 61 discriminator 1
+	mov	eax, DWORD PTR -92[rbp]
+	imul	eax, DWORD PTR -44[rbp]
+	mov	ecx, eax
+	.loc 1 303 70 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 303 58 discriminator 1
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 303 75 discriminator 1
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L81
+.L80:
+	.loc 1 303 81 discriminator 2
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 303 93 discriminator 2
+	mov	eax, DWORD PTR -92[rbp]
+	imul	eax, DWORD PTR -44[rbp]
+	mov	ecx, eax
+	.loc 1 303 102 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, ecx
+	cdqe
+	.loc 1 303 90 discriminator 2
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 303 75 discriminator 2
+	movss	xmm0, DWORD PTR [rax]
+.L81:
+	.loc 1 303 23 discriminator 4
+	movss	DWORD PTR -40[rbp], xmm0
+	.loc 1 304 22 discriminator 4
+	movss	xmm0, DWORD PTR -40[rbp]
+	movss	xmm1, DWORD PTR .LC28[rip]
+	andps	xmm1, xmm0
+	.loc 1 304 20 discriminator 4
+	movss	xmm0, DWORD PTR .LC29[rip]
+	ucomiss	xmm0, xmm1
+	jnb	.L82
+	.loc 1 306 48
+	cmp	DWORD PTR -32[rbp], 0
+	jne	.L84
+	.loc 1 306 48 is_stmt 0 discriminator 1
+	movss	xmm0, DWORD PTR -12[rbp]
+	jmp	.L85
+.L84:
+	.loc 1 306 48 discriminator 2
+	movss	xmm0, DWORD PTR -8[rbp]
+.L85:
+	.loc 1 306 27 is_stmt 1 discriminator 4
+	movss	DWORD PTR -40[rbp], xmm0
+.L82:
+	.loc 1 308 41 discriminator 2
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -92[rbp]
+	.loc 1 308 55 discriminator 2
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 308 43 discriminator 2
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	.loc 1 308 41 discriminator 2
+	mulsd	xmm1, xmm0
+	movsd	QWORD PTR -144[rbp], xmm1
+	.loc 1 308 76 discriminator 2
+	mov	edx, DWORD PTR -92[rbp]
+	mov	rax, QWORD PTR -120[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	lmsPlot_BucketFrames
+	.loc 1 308 74 discriminator 2
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, rax
+	movsd	xmm0, QWORD PTR .LC42[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 308 30 discriminator 2
+	addsd	xmm0, QWORD PTR -144[rbp]
+	movsd	QWORD PTR -104[rbp], xmm0
+	.loc 1 309 17 discriminator 2
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -68[rbp]
+	.loc 1 310 32 discriminator 2
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -12[rbp]
+	.loc 1 310 45 discriminator 2
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, DWORD PTR -40[rbp]
+	subsd	xmm0, xmm2
+	.loc 1 310 54 discriminator 2
+	mulsd	xmm0, QWORD PTR -80[rbp]
+	.loc 1 309 17 discriminator 2
+	movapd	xmm2, xmm1
+	addsd	xmm2, xmm0
+	.loc 1 309 75 discriminator 2
+	movsd	xmm0, QWORD PTR -104[rbp]
+	movapd	xmm1, xmm0
+	divsd	xmm1, QWORD PTR -64[rbp]
+	.loc 1 309 17 discriminator 2
+	movsd	xmm0, QWORD PTR .LC43[rip]
+	addsd	xmm1, xmm0
+	movq	rdx, xmm1
+	mov	rax, QWORD PTR -128[rbp]
+	movapd	xmm1, xmm2
+	movq	xmm0, rdx
+	lea	rdx, .LC44[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	mov	eax, 2
+	call	fprintf@PLT
+.LBE21:
+	.loc 1 300 40 discriminator 2
+	add	DWORD PTR -36[rbp], 1
+.L77:
+	.loc 1 300 31 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -48[rbp]
+	jl	.L86
+.LBE20:
+	.loc 1 298 42 discriminator 2
+	add	DWORD PTR -32[rbp], 1
+.L76:
+	.loc 1 298 33 discriminator 1
+	cmp	DWORD PTR -32[rbp], 1
+	jle	.L87
+.LBE19:
+	.loc 1 313 9 discriminator 2
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rcx, rax
+	mov	edx, 4
+	mov	esi, 1
+	lea	rax, .LC45[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 315 9 discriminator 2
+	mov	eax, DWORD PTR -68[rbp]
+	lea	edx, 196[rax]
+	mov	rax, QWORD PTR -128[rbp]
+	mov	ecx, edx
+	mov	edx, 80
+	lea	rsi, .LC46[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+	.loc 1 317 94 discriminator 2
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rcx, QWORD PTR 80[rax]
+	.loc 1 316 9 discriminator 2
+	mov	eax, DWORD PTR -68[rbp]
+	lea	edx, 196[rax]
+	mov	rax, QWORD PTR -128[rbp]
+	mov	r8, rcx
+	mov	ecx, edx
+	mov	edx, 1080
+	lea	rsi, .LC47[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	fprintf@PLT
+.LBE16:
+	.loc 1 255 34 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L63:
+	.loc 1 255 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -44[rbp]
+	jl	.L88
+.LBE15:
+	.loc 1 319 5
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rcx, rax
+	mov	edx, 7
+	mov	esi, 1
+	lea	rax, .LC48[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 320 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	lmsPlot_WriteSvg, .-lmsPlot_WriteSvg
+	.section	.rodata
+.LC49:
+	.string	"w"
+	.align 8
+.LC50:
+	.string	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	.align 8
+.LC51:
+	.string	"<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n<title>"
+	.align 8
+.LC52:
+	.string	"</title>\n</head>\n<body style=\"margin:0\">\n"
+.LC53:
+	.string	"</body>\n</html>\n"
+	.text
+	.globl	lmsPlot_Write
+	.type	lmsPlot_Write, @function
+lmsPlot_Write:
+.LFB16:
+	.loc 1 323 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 324 38
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 324 18
+	lea	rdx, .LC49[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	fopen@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 326 8
+	cmp	QWORD PTR -16[rbp], 0
+	jne	.L95
+	.loc 1 328 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 328 9
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 329 16
+	mov	eax, 1
+	jmp	.L96
+.L95:
+	.loc 1 331 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 331 5
+	cmp	eax, 1
+	je	.L97
+	cmp	eax, 2
+	jne	.L98
+	.loc 1 334 13
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsPlot_WriteCsv
+	.loc 1 335 13
+	jmp	.L99
+.L97:
+	.loc 1 338 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, rax
+	mov	edx, 39
+	mov	esi, 1
+	lea	rax, .LC50[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 339 13
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsPlot_WriteSvg
+	.loc 1 340 13
+	jmp	.L99
+.L98:
+	.loc 1 343 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, rax
+	mov	edx, 60
+	mov	esi, 1
+	lea	rax, .LC51[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 344 13
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsPlot_WriteEscaped
+	.loc 1 345 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, rax
+	mov	edx, 41
+	mov	esi, 1
+	lea	rax, .LC52[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 346 13
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsPlot_WriteSvg
+	.loc 1 347 13
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, rax
+	mov	edx, 16
+	mov	esi, 1
+	lea	rax, .LC53[rip]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 348 13
+	nop
+.L99:
+	.loc 1 351 19
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	ferror@PLT
+	.loc 1 351 53
+	test	eax, eax
+	setne	al
+	.loc 1 351 9
+	movzx	eax, al
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 352 9
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 352 8
+	test	eax, eax
+	je	.L100
+	.loc 1 354 16
+	mov	DWORD PTR -4[rbp], 1
+.L100:
+	.loc 1 356 8
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L101
+	.loc 1 358 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 358 9
+	mov	rdi, rax
+	call	perror@PLT
+.L101:
+	.loc 1 360 12
+	mov	eax, DWORD PTR -4[rbp]
+.L96:
+	.loc 1 361 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	lmsPlot_Write, .-lmsPlot_Write
+	.section	.rodata
+	.align 8
+.LC54:
+	.string	"Error: %s is not a filtered file with input, output and error\n"
+	.text
+	.globl	lmsPlot_PlotFile
+	.type	lmsPlot_PlotFile, @function
+lmsPlot_PlotFile:
+.LFB17:
+	.loc 1 364 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 800
+	mov	QWORD PTR -776[rbp], rdi
+	mov	DWORD PTR -780[rbp], esi
+	mov	QWORD PTR -792[rbp], rdx
+	.loc 1 368 8
+	cmp	DWORD PTR -780[rbp], 0
+	jne	.L103
+	.loc 1 370 18
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rdi, rax
+	call	sampleIo_FormatFromFileName@PLT
+	mov	DWORD PTR -780[rbp], eax
+.L103:
+	.loc 1 374 58
+	cmp	DWORD PTR -780[rbp], 1
+	sete	al
+	.loc 1 374 15
+	movzx	eax, al
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 375 9
+	mov	eax, DWORD PTR -12[rbp]
+	lea	ecx, 3[rax]
+	mov	edx, DWORD PTR -780[rbp]
+	mov	rsi, QWORD PTR -776[rbp]
+	lea	rax, -672[rbp]
+	mov	rdi, rax
+	call	sampleIo_OpenReader@PLT
+	.loc 1 375 8
+	test	eax, eax
+	je	.L104
+	.loc 1 377 16
+	mov	eax, 1
+	jmp	.L116
+.L104:
+	.loc 1 379 15
+	mov	edx, DWORD PTR -660[rbp]
+	.loc 1 379 30
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, 3
+	.loc 1 379 8
+	cmp	edx, eax
+	je	.L106
+	.loc 1 381 9
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rsi, rax
+	lea	rax, .LC54[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 382 9
+	lea	rax, -672[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 383 16
+	mov	eax, 1
+	jmp	.L116
+.L106:
+	.loc 1 386 76
+	mov	eax, DWORD PTR -660[rbp]
+	cdqe
+	.loc 1 386 29
+	sal	rax, 14
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 387 18
+	call	lmsPlot_FilterSeriesNames
+	mov	rdx, rax
+	mov	rsi, QWORD PTR -792[rbp]
+	lea	rax, -768[rbp]
+	mov	rcx, rdx
+	mov	edx, 3
+	mov	rdi, rax
+	call	lmsPlot_Init
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 388 8
+	cmp	QWORD PTR -24[rbp], 0
+	jne	.L108
+	.loc 1 390 16
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 394 11
+	jmp	.L108
+.L113:
+	.loc 1 396 12
+	cmp	DWORD PTR -12[rbp], 0
+	je	.L109
+.LBB22:
+	.loc 1 398 22
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 398 13
+	jmp	.L110
+.L111:
+	.loc 1 400 51 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	sal	eax, 2
+	.loc 1 400 48 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	.loc 1 400 41 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 400 35 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	mov	eax, edx
+	add	eax, eax
+	add	eax, edx
+	cdqe
+	.loc 1 400 32 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	.loc 1 400 25 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 400 17 discriminator 3
+	mov	edx, 12
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memmove@PLT
+	.loc 1 398 41 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L110:
+	.loc 1 398 31 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -28[rbp]
+	jl	.L111
+.L109:
+.LBE22:
+	.loc 1 403 9
+	mov	edx, DWORD PTR -28[rbp]
+	mov	rcx, QWORD PTR -24[rbp]
+	lea	rax, -768[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsPlot_AddFrames
+.L108:
+	.loc 1 394 37
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L112
+	.loc 1 394 50 discriminator 1
+	mov	rcx, QWORD PTR -24[rbp]
+	lea	rax, -672[rbp]
+	mov	edx, 4096
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Read@PLT
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 394 37 discriminator 1
+	cmp	DWORD PTR -28[rbp], 0
+	jg	.L113
+.L112:
+	.loc 1 405 8
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L114
+	.loc 1 407 18
+	mov	rdx, QWORD PTR -776[rbp]
+	lea	rax, -768[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	lmsPlot_Write
+	mov	DWORD PTR -4[rbp], eax
+.L114:
+	.loc 1 410 5
+	lea	rax, -768[rbp]
+	mov	rdi, rax
+	call	lmsPlot_Free
+	.loc 1 411 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 412 9
+	lea	rax, -672[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader@PLT
+	.loc 1 412 8
+	test	eax, eax
+	je	.L115
+	.loc 1 414 9
+	mov	rax, QWORD PTR -776[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 415 16
+	mov	DWORD PTR -4[rbp], 1
+.L115:
+	.loc 1 417 12
+	mov	eax, DWORD PTR -4[rbp]
+.L116:
+	.loc 1 418 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	lmsPlot_PlotFile, .-lmsPlot_PlotFile
+	.section	.rodata
+.LC55:
+	.string	"xdg-open"
+.LC56:
+	.string	"Error opening %s with %s\n"
+	.text
+	.globl	lmsPlot_Open
+	.type	lmsPlot_Open, @function
+lmsPlot_Open:
+.LFB18:
+	.loc 1 421 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -56[rbp], rdi
+	.loc 1 422 17
+	lea	rax, .LC55[rip]
+	mov	QWORD PTR -32[rbp], rax
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 426 10
+	mov	rcx, QWORD PTR environ[rip]
+	.loc 1 426 33
+	mov	rsi, QWORD PTR -32[rbp]
+	.loc 1 426 10
+	lea	rdx, -32[rbp]
+	lea	rax, -36[rbp]
+	mov	r9, rcx
+	mov	r8, rdx
+	mov	ecx, 0
+	mov	edx, 0
+	mov	rdi, rax
+	call	posix_spawnp@PLT
+	.loc 1 426 8
+	test	eax, eax
+	jne	.L118
+	.loc 1 427 13
+	mov	eax, DWORD PTR -36[rbp]
+	lea	rcx, -40[rbp]
+	mov	edx, 0
+	mov	rsi, rcx
+	mov	edi, eax
+	call	waitpid@PLT
+	mov	edx, eax
+	.loc 1 427 38
+	mov	eax, DWORD PTR -36[rbp]
+	.loc 1 427 9
+	cmp	edx, eax
+	jne	.L118
+	.loc 1 427 50 discriminator 1
+	mov	eax, DWORD PTR -40[rbp]
+	and	eax, 127
+	.loc 1 427 46 discriminator 1
+	test	eax, eax
+	jne	.L118
+	.loc 1 427 72 discriminator 2
+	mov	eax, DWORD PTR -40[rbp]
+	sar	eax, 8
+	movzx	eax, al
+	.loc 1 427 68 discriminator 2
+	test	eax, eax
+	je	.L119
+.L118:
+	.loc 1 429 60
+	mov	rdx, QWORD PTR -32[rbp]
+	.loc 1 429 9
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rsi, rax
+	lea	rax, .LC56[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 430 16
+	mov	eax, 1
+	jmp	.L121
+.L119:
+	.loc 1 432 12
+	mov	eax, 0
+.L121:
+	.loc 1 433 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	lmsPlot_Open, .-lmsPlot_Open
+	.globl	lmsPlot_FilterSeriesNames
+	.type	lmsPlot_FilterSeriesNames, @function
+lmsPlot_FilterSeriesNames:
+.LFB19:
+	.loc 1 436 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	.loc 1 437 12
+	lea	rax, lmsPlotFilterSeries[rip]
+	.loc 1 438 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	lmsPlot_FilterSeriesNames, .-lmsPlot_FilterSeriesNames
+	.section	.rodata
+	.align 4
+.LC7:
+	.long	2139095040
+	.align 4
+.LC8:
+	.long	-8388608
+	.align 8
+.LC9:
+	.long	0
+	.long	0
+	.align 8
+.LC22:
+	.long	0
+	.long	1083129856
+	.align 8
+.LC23:
+	.long	0
+	.long	1072693248
+	.align 16
+.LC28:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC29:
+	.long	2139095039
+	.align 4
+.LC30:
+	.long	-1082130432
+	.align 4
+.LC31:
+	.long	1065353216
+	.align 4
+.LC32:
+	.long	730643660
+	.align 4
+.LC33:
+	.long	1056964608
+	.align 8
+.LC34:
+	.long	0
+	.long	1080459264
+	.align 8
+.LC42:
+	.long	0
+	.long	1071644672
+	.align 8
+.LC43:
+	.long	0
+	.long	1079246848
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.file 14 "/usr/include/spawn.h"
+	.file 15 "include/asyncFile.h"
+	.file 16 "include/sampleIo.h"
+	.file 17 "include/lmsPlot.h"
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/wait.h"
+	.file 19 "/usr/include/string.h"
+	.file 20 "/usr/include/stdio.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 22 "/usr/include/stdlib.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x162f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF259
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x3
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0xa
+	.long	0x2e
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x46
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xa
+	.long	0x52
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xa
+	.long	0x65
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x3
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x52
+	.uleb128 0x3
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x52
+	.uleb128 0x3
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x9a
+	.byte	0x19
+	.long	0x46
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x52
+	.uleb128 0x4
+	.long	0xc9
+	.uleb128 0xa
+	.long	0xbf
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF15
+	.uleb128 0xa
+	.long	0xc9
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x4
+	.byte	0x55
+	.byte	0x11
+	.long	0x8d
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x61
+	.byte	0x11
+	.long	0xa5
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0xb3
+	.uleb128 0x13
+	.byte	0x80
+	.byte	0x5
+	.byte	0x5
+	.byte	0x9
+	.long	0x110
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0x110
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x3f
+	.long	0x120
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x8
+	.byte	0x3
+	.long	0xf9
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x7
+	.byte	0x14
+	.long	0x120
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x3
+	.long	0x15c
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x12
+	.long	0x78
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x12
+	.long	0x78
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x8
+	.byte	0x7
+	.byte	0x19
+	.long	0x17d
+	.uleb128 0x12
+	.long	.LASF24
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x28
+	.long	0x17d
+	.uleb128 0x12
+	.long	.LASF25
+	.byte	0x7
+	.byte	0x20
+	.byte	0x5
+	.long	0x138
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF26
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x15c
+	.uleb128 0x16
+	.long	.LASF31
+	.byte	0x10
+	.byte	0x8
+	.byte	0x33
+	.byte	0x10
+	.long	0x1b8
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x8
+	.byte	0x35
+	.byte	0x23
+	.long	0x1b8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x8
+	.byte	0x36
+	.byte	0x23
+	.long	0x1b8
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x190
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x8
+	.byte	0x37
+	.byte	0x3
+	.long	0x190
+	.uleb128 0x16
+	.long	.LASF32
+	.byte	0x28
+	.byte	0x9
+	.byte	0x16
+	.byte	0x8
+	.long	0x23f
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x9
+	.byte	0x18
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x9
+	.byte	0x19
+	.byte	0x10
+	.long	0x78
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x7
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x10
+	.long	0x78
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x9
+	.byte	0x20
+	.byte	0x7
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x9
+	.byte	0x22
+	.byte	0x9
+	.long	0x86
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x9
+	.byte	0x23
+	.byte	0x9
+	.long	0x86
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x9
+	.byte	0x24
+	.byte	0x14
+	.long	0x1bd
+	.byte	0x18
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF41
+	.byte	0x30
+	.byte	0x8
+	.byte	0x5e
+	.byte	0x8
+	.long	0x2a8
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x60
+	.byte	0x19
+	.long	0x184
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x61
+	.byte	0x19
+	.long	0x184
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x8
+	.byte	0x62
+	.byte	0x10
+	.long	0x2a8
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x8
+	.byte	0x63
+	.byte	0x10
+	.long	0x2a8
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x8
+	.byte	0x64
+	.byte	0x10
+	.long	0x78
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x8
+	.byte	0x65
+	.byte	0x10
+	.long	0x78
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x8
+	.byte	0x66
+	.byte	0x10
+	.long	0x2a8
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0x78
+	.long	0x2b8
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF49
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x1b
+	.byte	0x28
+	.byte	0xa
+	.byte	0x43
+	.long	0x2f1
+	.uleb128 0x12
+	.long	.LASF50
+	.byte	0xa
+	.byte	0x45
+	.byte	0x1c
+	.long	0x1c9
+	.uleb128 0x12
+	.long	.LASF51
+	.byte	0xa
+	.byte	0x46
+	.byte	0x8
+	.long	0x2f1
+	.uleb128 0x12
+	.long	.LASF52
+	.byte	0xa
+	.byte	0x47
+	.byte	0xc
+	.long	0x52
+	.byte	0
+	.uleb128 0xd
+	.long	0xc9
+	.long	0x301
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0x27
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF53
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0x2c4
+	.uleb128 0x1b
+	.byte	0x30
+	.byte	0xa
+	.byte	0x4b
+	.long	0x33a
+	.uleb128 0x12
+	.long	.LASF50
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x23f
+	.uleb128 0x12
+	.long	.LASF51
+	.byte	0xa
+	.byte	0x4e
+	.byte	0x8
+	.long	0x33a
+	.uleb128 0x12
+	.long	.LASF52
+	.byte	0xa
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x5e
+	.byte	0
+	.uleb128 0xd
+	.long	0xc9
+	.long	0x34a
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF54
+	.byte	0xa
+	.byte	0x50
+	.byte	0x3
+	.long	0x30d
+	.uleb128 0x4
+	.long	0x35b
+	.uleb128 0x27
+	.uleb128 0x16
+	.long	.LASF55
+	.byte	0xd8
+	.byte	0xb
+	.byte	0x31
+	.byte	0x8
+	.long	0x4e3
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0xb
+	.byte	0x33
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0xb
+	.byte	0x36
+	.byte	0x9
+	.long	0xbf
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0xb
+	.byte	0x37
+	.byte	0x9
+	.long	0xbf
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0xb
+	.byte	0x38
+	.byte	0x9
+	.long	0xbf
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0xb
+	.byte	0x39
+	.byte	0x9
+	.long	0xbf
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x9
+	.long	0xbf
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xb
+	.byte	0x3b
+	.byte	0x9
+	.long	0xbf
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x9
+	.long	0xbf
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0xb
+	.byte	0x3d
+	.byte	0x9
+	.long	0xbf
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0xb
+	.byte	0x40
+	.byte	0x9
+	.long	0xbf
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0xb
+	.byte	0x41
+	.byte	0x9
+	.long	0xbf
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0xb
+	.byte	0x42
+	.byte	0x9
+	.long	0xbf
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0xb
+	.byte	0x44
+	.byte	0x16
+	.long	0x4fc
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0xb
+	.byte	0x46
+	.byte	0x14
+	.long	0x501
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0xb
+	.byte	0x48
+	.byte	0x7
+	.long	0x46
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0xb
+	.byte	0x49
+	.byte	0x7
+	.long	0x46
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0xb
+	.byte	0x4a
+	.byte	0xb
+	.long	0x8d
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x12
+	.long	0x71
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0xb
+	.byte	0x4e
+	.byte	0xf
+	.long	0x7f
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0xb
+	.byte	0x4f
+	.byte	0x8
+	.long	0x506
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0xb
+	.byte	0x51
+	.byte	0xf
+	.long	0x516
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0xb
+	.byte	0x59
+	.byte	0xd
+	.long	0x99
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0xb
+	.byte	0x5b
+	.byte	0x17
+	.long	0x520
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0xb
+	.byte	0x5c
+	.byte	0x19
+	.long	0x52a
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xb
+	.byte	0x5d
+	.byte	0x14
+	.long	0x501
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xb
+	.byte	0x5e
+	.byte	0x9
+	.long	0xb1
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xb
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xb
+	.byte	0x60
+	.byte	0x7
+	.long	0x46
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xb
+	.byte	0x62
+	.byte	0x8
+	.long	0x52f
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF85
+	.byte	0xc
+	.byte	0x7
+	.byte	0x19
+	.long	0x35c
+	.uleb128 0x28
+	.long	.LASF260
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x18
+	.long	.LASF86
+	.uleb128 0x4
+	.long	0x4f7
+	.uleb128 0x4
+	.long	0x35c
+	.uleb128 0xd
+	.long	0xc9
+	.long	0x516
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x4ef
+	.uleb128 0x18
+	.long	.LASF87
+	.uleb128 0x4
+	.long	0x51b
+	.uleb128 0x18
+	.long	.LASF88
+	.uleb128 0x4
+	.long	0x525
+	.uleb128 0xd
+	.long	0xc9
+	.long	0x53f
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	0x4e3
+	.uleb128 0x1f
+	.long	0x53f
+	.uleb128 0x4
+	.long	0xd0
+	.uleb128 0xa
+	.long	0x549
+	.uleb128 0x1f
+	.long	0x549
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF89
+	.uleb128 0xa
+	.long	0x558
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF90
+	.uleb128 0xa
+	.long	0x564
+	.uleb128 0x16
+	.long	.LASF91
+	.byte	0x4
+	.byte	0xd
+	.byte	0x17
+	.byte	0x8
+	.long	0x58b
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0xd
+	.byte	0x19
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.value	0x150
+	.byte	0xe
+	.byte	0x1d
+	.long	0x5f3
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xd
+	.long	0x86
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xe
+	.byte	0x20
+	.byte	0x9
+	.long	0xe1
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0xe
+	.byte	0x21
+	.byte	0xc
+	.long	0x12c
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0xe
+	.byte	0x22
+	.byte	0xc
+	.long	0x12c
+	.byte	0x88
+	.uleb128 0xb
+	.long	.LASF97
+	.byte	0xe
+	.byte	0x23
+	.byte	0x16
+	.long	0x570
+	.value	0x108
+	.uleb128 0xb
+	.long	.LASF98
+	.byte	0xe
+	.byte	0x24
+	.byte	0x7
+	.long	0x46
+	.value	0x10c
+	.uleb128 0xb
+	.long	.LASF99
+	.byte	0xe
+	.byte	0x25
+	.byte	0x7
+	.long	0x5f3
+	.value	0x110
+	.byte	0
+	.uleb128 0xd
+	.long	0x46
+	.long	0x603
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF100
+	.byte	0xe
+	.byte	0x26
+	.byte	0x3
+	.long	0x58b
+	.uleb128 0xa
+	.long	0x603
+	.uleb128 0x13
+	.byte	0x50
+	.byte	0xe
+	.byte	0x2b
+	.byte	0x9
+	.long	0x652
+	.uleb128 0x1
+	.long	.LASF101
+	.byte	0xe
+	.byte	0x2d
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0xe
+	.byte	0x2e
+	.byte	0x7
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0xe
+	.byte	0x2f
+	.byte	0x1a
+	.long	0x657
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0xe
+	.byte	0x30
+	.byte	0x7
+	.long	0x5f3
+	.byte	0x10
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF104
+	.uleb128 0x4
+	.long	0x652
+	.uleb128 0x3
+	.long	.LASF105
+	.byte	0xe
+	.byte	0x31
+	.byte	0x3
+	.long	0x614
+	.uleb128 0xa
+	.long	0x65c
+	.uleb128 0x17
+	.long	0x78
+	.byte	0xf
+	.byte	0x15
+	.long	0x697
+	.uleb128 0x6
+	.long	.LASF106
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF107
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF108
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF109
+	.byte	0x3
+	.uleb128 0x6
+	.long	.LASF110
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF111
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x3
+	.long	0x66d
+	.uleb128 0x17
+	.long	0x78
+	.byte	0xf
+	.byte	0x1e
+	.long	0x6bb
+	.uleb128 0x6
+	.long	.LASF112
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF113
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF114
+	.byte	0xf
+	.byte	0x21
+	.byte	0x3
+	.long	0x6a3
+	.uleb128 0x17
+	.long	0x78
+	.byte	0xf
+	.byte	0x24
+	.long	0x6e5
+	.uleb128 0x6
+	.long	.LASF115
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF116
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF117
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF118
+	.byte	0xf
+	.byte	0x28
+	.byte	0x3
+	.long	0x6c7
+	.uleb128 0x13
+	.byte	0x28
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x9
+	.long	0x73c
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0xf
+	.byte	0x2c
+	.byte	0x14
+	.long	0x73c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xb
+	.long	0xd5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0xf
+	.byte	0x2e
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0xf
+	.byte	0x2f
+	.byte	0xd
+	.long	0xed
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0xf
+	.byte	0x30
+	.byte	0x1c
+	.long	0x6e5
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x65
+	.uleb128 0x3
+	.long	.LASF124
+	.byte	0xf
+	.byte	0x31
+	.byte	0x3
+	.long	0x6f1
+	.uleb128 0x13
+	.byte	0x78
+	.byte	0xf
+	.byte	0x34
+	.byte	0x9
+	.long	0x819
+	.uleb128 0x19
+	.string	"fd"
+	.byte	0xf
+	.byte	0x36
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0xf
+	.byte	0x37
+	.byte	0xb
+	.long	0xb1
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0xf
+	.byte	0x38
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0xf
+	.byte	0x39
+	.byte	0xb
+	.long	0xb1
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0xf
+	.byte	0x3a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0xf
+	.byte	0x3b
+	.byte	0xb
+	.long	0xb1
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0xf
+	.byte	0x3c
+	.byte	0xc
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0xf
+	.byte	0x3d
+	.byte	0x13
+	.long	0x819
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0xf
+	.byte	0x3e
+	.byte	0x13
+	.long	0x819
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0xf
+	.byte	0x3f
+	.byte	0x13
+	.long	0x819
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0xf
+	.byte	0x40
+	.byte	0x13
+	.long	0x819
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0xf
+	.byte	0x41
+	.byte	0x13
+	.long	0x819
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0xf
+	.byte	0x42
+	.byte	0x13
+	.long	0x819
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0xf
+	.byte	0x43
+	.byte	0xb
+	.long	0xb1
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0xf
+	.byte	0x44
+	.byte	0x9
+	.long	0x46
+	.byte	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x78
+	.uleb128 0x3
+	.long	.LASF139
+	.byte	0xf
+	.byte	0x45
+	.byte	0x3
+	.long	0x74d
+	.uleb128 0x1c
+	.value	0x1f8
+	.byte	0xf
+	.byte	0x49
+	.long	0x916
+	.uleb128 0x19
+	.string	"fd"
+	.byte	0xf
+	.byte	0x4b
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0xf
+	.byte	0x4c
+	.byte	0x15
+	.long	0x6bb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0xf
+	.byte	0x4d
+	.byte	0x18
+	.long	0x697
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0xf
+	.byte	0x4e
+	.byte	0x14
+	.long	0x73c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0xf
+	.byte	0x4f
+	.byte	0x17
+	.long	0x916
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0xf
+	.byte	0x50
+	.byte	0x13
+	.long	0x3f
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0xf
+	.byte	0x51
+	.byte	0x13
+	.long	0x3f
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0xf
+	.byte	0x52
+	.byte	0xb
+	.long	0xd5
+	.byte	0xc8
+	.uleb128 0x19
+	.string	"end"
+	.byte	0xf
+	.byte	0x53
+	.byte	0xb
+	.long	0xd5
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0xf
+	.byte	0x54
+	.byte	0x9
+	.long	0x46
+	.byte	0xd8
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0xf
+	.byte	0x55
+	.byte	0x15
+	.long	0x81e
+	.byte	0xe0
+	.uleb128 0xb
+	.long	.LASF148
+	.byte	0xf
+	.byte	0x56
+	.byte	0xf
+	.long	0x2b8
+	.value	0x158
+	.uleb128 0xb
+	.long	.LASF149
+	.byte	0xf
+	.byte	0x57
+	.byte	0x15
+	.long	0x301
+	.value	0x160
+	.uleb128 0xb
+	.long	.LASF150
+	.byte	0xf
+	.byte	0x58
+	.byte	0x14
+	.long	0x34a
+	.value	0x188
+	.uleb128 0xb
+	.long	.LASF151
+	.byte	0xf
+	.byte	0x59
+	.byte	0x14
+	.long	0x34a
+	.value	0x1b8
+	.uleb128 0xb
+	.long	.LASF152
+	.byte	0xf
+	.byte	0x5a
+	.byte	0x13
+	.long	0x3f
+	.value	0x1e8
+	.uleb128 0xb
+	.long	.LASF153
+	.byte	0xf
+	.byte	0x5b
+	.byte	0x9
+	.long	0x46
+	.value	0x1f0
+	.byte	0
+	.uleb128 0xd
+	.long	0x741
+	.long	0x926
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF154
+	.byte	0xf
+	.byte	0x5c
+	.byte	0x3
+	.long	0x82a
+	.uleb128 0x17
+	.long	0x78
+	.byte	0x10
+	.byte	0x14
+	.long	0x962
+	.uleb128 0x6
+	.long	.LASF155
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF156
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF157
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF158
+	.byte	0x3
+	.uleb128 0x6
+	.long	.LASF159
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF160
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF161
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x3
+	.long	0x932
+	.uleb128 0x1c
+	.value	0x278
+	.byte	0x10
+	.byte	0x1d
+	.long	0xa72
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x10
+	.byte	0x1f
+	.byte	0xb
+	.long	0x53f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x10
+	.byte	0x20
+	.byte	0x14
+	.long	0x962
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x10
+	.byte	0x21
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x10
+	.byte	0x22
+	.byte	0x12
+	.long	0x78
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x10
+	.byte	0x23
+	.byte	0xa
+	.long	0x52
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x10
+	.byte	0x24
+	.byte	0xa
+	.long	0x52
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF168
+	.byte	0x10
+	.byte	0x25
+	.byte	0xa
+	.long	0x52
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF169
+	.byte	0x10
+	.byte	0x26
+	.byte	0xb
+	.long	0xb1
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF170
+	.byte	0x10
+	.byte	0x27
+	.byte	0x11
+	.long	0x549
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF171
+	.byte	0x10
+	.byte	0x28
+	.byte	0x11
+	.long	0x549
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0x10
+	.byte	0x29
+	.byte	0x11
+	.long	0x549
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0x10
+	.byte	0x2a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0x10
+	.byte	0x2c
+	.byte	0x9
+	.long	0x46
+	.byte	0x5c
+	.uleb128 0x19
+	.string	"io"
+	.byte	0x10
+	.byte	0x2d
+	.byte	0x11
+	.long	0x926
+	.byte	0x60
+	.uleb128 0xb
+	.long	.LASF176
+	.byte	0x10
+	.byte	0x2e
+	.byte	0x1a
+	.long	0xa72
+	.value	0x258
+	.uleb128 0xb
+	.long	.LASF177
+	.byte	0x10
+	.byte	0x2f
+	.byte	0xc
+	.long	0x2e
+	.value	0x260
+	.uleb128 0xb
+	.long	.LASF178
+	.byte	0x10
+	.byte	0x30
+	.byte	0xc
+	.long	0x2e
+	.value	0x268
+	.uleb128 0xb
+	.long	.LASF179
+	.byte	0x10
+	.byte	0x31
+	.byte	0xa
+	.long	0x52
+	.value	0x270
+	.byte	0
+	.uleb128 0x4
+	.long	0x6c
+	.uleb128 0x3
+	.long	.LASF180
+	.byte	0x10
+	.byte	0x32
+	.byte	0x3
+	.long	0x96e
+	.uleb128 0x17
+	.long	0x78
+	.byte	0x11
+	.byte	0x16
+	.long	0xaa1
+	.uleb128 0x6
+	.long	.LASF181
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF182
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF183
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF184
+	.byte	0x11
+	.byte	0x1a
+	.byte	0x3
+	.long	0xa83
+	.uleb128 0x13
+	.byte	0x10
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x9
+	.long	0xad1
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x11
+	.byte	0x1e
+	.byte	0x11
+	.long	0x549
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x11
+	.byte	0x1f
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF187
+	.byte	0x11
+	.byte	0x20
+	.byte	0x3
+	.long	0xaad
+	.uleb128 0xa
+	.long	0xad1
+	.uleb128 0x13
+	.byte	0x58
+	.byte	0x11
+	.byte	0x22
+	.byte	0x9
+	.long	0xb7b
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x11
+	.byte	0x24
+	.byte	0x17
+	.long	0xad1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x11
+	.byte	0x25
+	.byte	0x15
+	.long	0xaa1
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x11
+	.byte	0x26
+	.byte	0x9
+	.long	0x46
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x11
+	.byte	0x27
+	.byte	0x18
+	.long	0xb7b
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x11
+	.byte	0x28
+	.byte	0xc
+	.long	0xb80
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x11
+	.byte	0x29
+	.byte	0xc
+	.long	0xb80
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x11
+	.byte	0x2a
+	.byte	0xd
+	.long	0xb85
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x11
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x11
+	.byte	0x2c
+	.byte	0xa
+	.long	0x52
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x11
+	.byte	0x2d
+	.byte	0xa
+	.long	0x52
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x11
+	.byte	0x2e
+	.byte	0xa
+	.long	0x52
+	.byte	0x50
+	.byte	0
+	.uleb128 0x4
+	.long	0x54e
+	.uleb128 0x4
+	.long	0x558
+	.uleb128 0x4
+	.long	0x564
+	.uleb128 0x3
+	.long	.LASF198
+	.byte	0x11
+	.byte	0x2f
+	.byte	0x3
+	.long	0xae2
+	.uleb128 0xa
+	.long	0xb8a
+	.uleb128 0x29
+	.long	.LASF261
+	.byte	0x1
+	.byte	0x1c
+	.byte	0xf
+	.long	0xba7
+	.uleb128 0x4
+	.long	0xbf
+	.uleb128 0xd
+	.long	0x54e
+	.long	0xbbc
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0xbac
+	.uleb128 0x7
+	.long	.LASF199
+	.byte	0x1e
+	.byte	0x1a
+	.long	0xbbc
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsPlotFilterSeries
+	.uleb128 0xd
+	.long	0x54e
+	.long	0xbe6
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	0xbd6
+	.uleb128 0x7
+	.long	.LASF200
+	.byte	0x1f
+	.byte	0x1a
+	.long	0xbe6
+	.uleb128 0x9
+	.byte	0x3
+	.quad	lmsPlotColors
+	.uleb128 0xf
+	.long	.LASF201
+	.byte	0x12
+	.byte	0x6a
+	.byte	0x10
+	.long	0xa5
+	.long	0xc20
+	.uleb128 0x2
+	.long	0xa5
+	.uleb128 0x2
+	.long	0xc20
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x4
+	.long	0x46
+	.uleb128 0xf
+	.long	.LASF202
+	.byte	0xe
+	.byte	0x55
+	.byte	0xc
+	.long	0x46
+	.long	0xc54
+	.uleb128 0x2
+	.long	0xc54
+	.uleb128 0x2
+	.long	0x549
+	.uleb128 0x2
+	.long	0xc59
+	.uleb128 0x2
+	.long	0xc5e
+	.uleb128 0x2
+	.long	0xc63
+	.uleb128 0x2
+	.long	0xc63
+	.byte	0
+	.uleb128 0x4
+	.long	0xe1
+	.uleb128 0x4
+	.long	0x668
+	.uleb128 0x4
+	.long	0x60f
+	.uleb128 0x4
+	.long	0xc4
+	.uleb128 0xf
+	.long	.LASF203
+	.byte	0x10
+	.byte	0x75
+	.byte	0x5
+	.long	0x46
+	.long	0xc88
+	.uleb128 0x2
+	.long	0xc88
+	.uleb128 0x2
+	.long	0xb80
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x4
+	.long	0xa77
+	.uleb128 0xf
+	.long	.LASF204
+	.byte	0x13
+	.byte	0x2f
+	.byte	0xe
+	.long	0xb1
+	.long	0xcad
+	.uleb128 0x2
+	.long	0xb1
+	.uleb128 0x2
+	.long	0x356
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF205
+	.byte	0x10
+	.byte	0x83
+	.byte	0x5
+	.long	0x46
+	.long	0xcc3
+	.uleb128 0x2
+	.long	0xc88
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF206
+	.byte	0x10
+	.byte	0x6c
+	.byte	0x5
+	.long	0x46
+	.long	0xce8
+	.uleb128 0x2
+	.long	0xc88
+	.uleb128 0x2
+	.long	0x549
+	.uleb128 0x2
+	.long	0x962
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF207
+	.byte	0x10
+	.byte	0x51
+	.byte	0x10
+	.long	0x962
+	.long	0xcfe
+	.uleb128 0x2
+	.long	0x549
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF208
+	.byte	0x14
+	.byte	0xb2
+	.byte	0xc
+	.long	0x46
+	.long	0xd14
+	.uleb128 0x2
+	.long	0x53f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF209
+	.byte	0x14
+	.value	0x316
+	.byte	0xc
+	.long	0x46
+	.long	0xd2b
+	.uleb128 0x2
+	.long	0x53f
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF214
+	.byte	0x14
+	.value	0x324
+	.long	0xd3d
+	.uleb128 0x2
+	.long	0x549
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF210
+	.byte	0x14
+	.value	0x102
+	.byte	0xe
+	.long	0x53f
+	.long	0xd59
+	.uleb128 0x2
+	.long	0x553
+	.uleb128 0x2
+	.long	0x553
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF211
+	.byte	0x15
+	.byte	0x8f
+	.byte	0x1
+	.long	0x564
+	.long	0xd6f
+	.uleb128 0x2
+	.long	0x564
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF212
+	.byte	0x14
+	.value	0x15e
+	.byte	0xc
+	.long	0x46
+	.long	0xd8c
+	.uleb128 0x2
+	.long	0x544
+	.uleb128 0x2
+	.long	0x553
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF213
+	.byte	0x14
+	.value	0x225
+	.byte	0xc
+	.long	0x46
+	.long	0xda8
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x53f
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF215
+	.byte	0x16
+	.value	0x238
+	.long	0xdba
+	.uleb128 0x2
+	.long	0xb1
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF216
+	.byte	0x16
+	.value	0x229
+	.byte	0xe
+	.long	0xb1
+	.long	0xdd1
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF217
+	.byte	0x13
+	.byte	0x9c
+	.byte	0xc
+	.long	0x46
+	.long	0xdec
+	.uleb128 0x2
+	.long	0x549
+	.uleb128 0x2
+	.long	0x549
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF218
+	.byte	0x14
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0xe04
+	.uleb128 0x2
+	.long	0x549
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF219
+	.byte	0x13
+	.byte	0x3d
+	.byte	0xe
+	.long	0xb1
+	.long	0xe24
+	.uleb128 0x2
+	.long	0xb1
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF220
+	.byte	0x13
+	.value	0x111
+	.byte	0xe
+	.long	0xbf
+	.long	0xe40
+	.uleb128 0x2
+	.long	0x549
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF221
+	.byte	0x15
+	.value	0x14d
+	.byte	0x1
+	.long	0x558
+	.long	0xe5c
+	.uleb128 0x2
+	.long	0x558
+	.uleb128 0x2
+	.long	0x558
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF222
+	.byte	0x15
+	.value	0x150
+	.byte	0x1
+	.long	0x558
+	.long	0xe78
+	.uleb128 0x2
+	.long	0x558
+	.uleb128 0x2
+	.long	0x558
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF262
+	.byte	0x1
+	.value	0x1b3
+	.byte	0x14
+	.long	0xb7b
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x1d
+	.long	.LASF225
+	.value	0x1a4
+	.long	0x46
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xef6
+	.uleb128 0x15
+	.long	.LASF185
+	.value	0x1a4
+	.byte	0x1e
+	.long	0x549
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x9
+	.long	.LASF223
+	.value	0x1a6
+	.byte	0x11
+	.long	0xef6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x14
+	.string	"pid"
+	.value	0x1a7
+	.byte	0xb
+	.long	0xe1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x9
+	.long	.LASF224
+	.value	0x1a8
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.uleb128 0xd
+	.long	0xc4
+	.long	0xf06
+	.uleb128 0xe
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF226
+	.value	0x16b
+	.long	0x46
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfd3
+	.uleb128 0x15
+	.long	.LASF227
+	.value	0x16b
+	.byte	0x22
+	.long	0x549
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -792
+	.uleb128 0x15
+	.long	.LASF163
+	.value	0x16b
+	.byte	0x40
+	.long	0x962
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -796
+	.uleb128 0x15
+	.long	.LASF188
+	.value	0x16b
+	.byte	0x61
+	.long	0xfd3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -808
+	.uleb128 0x9
+	.long	.LASF228
+	.value	0x16d
+	.byte	0x14
+	.long	0xa77
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -688
+	.uleb128 0x9
+	.long	.LASF229
+	.value	0x16e
+	.byte	0xf
+	.long	0xb8a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -784
+	.uleb128 0x9
+	.long	.LASF230
+	.value	0x176
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x9
+	.long	.LASF197
+	.value	0x182
+	.byte	0xc
+	.long	0xb80
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x9
+	.long	.LASF231
+	.value	0x183
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x9
+	.long	.LASF232
+	.value	0x189
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x8
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.uleb128 0x14
+	.string	"i"
+	.value	0x18e
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xadd
+	.uleb128 0x1d
+	.long	.LASF233
+	.value	0x142
+	.long	0x46
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1036
+	.uleb128 0x15
+	.long	.LASF229
+	.value	0x142
+	.byte	0x24
+	.long	0x1036
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x15
+	.long	.LASF234
+	.value	0x142
+	.byte	0x36
+	.long	0x549
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x9
+	.long	.LASF162
+	.value	0x144
+	.byte	0xb
+	.long	0x53f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x9
+	.long	.LASF231
+	.value	0x15f
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x4
+	.long	0xb96
+	.uleb128 0x1a
+	.long	.LASF245
+	.byte	0xef
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1213
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0xef
+	.byte	0x2f
+	.long	0x1036
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x5
+	.long	.LASF162
+	.byte	0xef
+	.byte	0x3b
+	.long	0x53f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x5
+	.long	.LASF234
+	.byte	0xef
+	.byte	0x4d
+	.long	0x549
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x7
+	.long	.LASF235
+	.byte	0xf1
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x7
+	.long	.LASF236
+	.byte	0xf2
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.long	.LASF186
+	.byte	0xf3
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x7
+	.long	.LASF237
+	.byte	0xf4
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x7
+	.long	.LASF238
+	.byte	0xf5
+	.byte	0x12
+	.long	0x56b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x8
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.uleb128 0x10
+	.string	"s"
+	.byte	0xff
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x8
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x14
+	.string	"top"
+	.value	0x101
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x14
+	.string	"low"
+	.value	0x102
+	.byte	0xf
+	.long	0x558
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x9
+	.long	.LASF239
+	.value	0x103
+	.byte	0xf
+	.long	0x558
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x9
+	.long	.LASF193
+	.value	0x104
+	.byte	0x10
+	.long	0x564
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x9
+	.long	.LASF240
+	.value	0x116
+	.byte	0x16
+	.long	0x56b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1e
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.long	0x116b
+	.uleb128 0x14
+	.string	"b"
+	.value	0x106
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.uleb128 0x1e
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.long	0x1191
+	.uleb128 0x9
+	.long	.LASF241
+	.value	0x11c
+	.byte	0x1a
+	.long	0x56b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.uleb128 0x8
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0x9
+	.long	.LASF242
+	.value	0x12a
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.uleb128 0x14
+	.string	"i"
+	.value	0x12c
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x8
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.uleb128 0x14
+	.string	"b"
+	.value	0x12e
+	.byte	0x1b
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x9
+	.long	.LASF243
+	.value	0x12f
+	.byte	0x17
+	.long	0x558
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.long	.LASF244
+	.value	0x134
+	.byte	0x1e
+	.long	0x56b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF246
+	.byte	0xd3
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12d8
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0xd3
+	.byte	0x2f
+	.long	0x1036
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.long	.LASF162
+	.byte	0xd3
+	.byte	0x3b
+	.long	0x53f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.long	.LASF235
+	.byte	0xd5
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1e
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.long	0x127b
+	.uleb128 0x10
+	.string	"s"
+	.byte	0xd8
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x8
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x10
+	.string	"b"
+	.byte	0xde
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.uleb128 0x7
+	.long	.LASF197
+	.byte	0xe0
+	.byte	0x14
+	.long	0x59
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0x10
+	.string	"s"
+	.byte	0xe2
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF247
+	.byte	0xb3
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1311
+	.uleb128 0x5
+	.long	.LASF162
+	.byte	0xb3
+	.byte	0x28
+	.long	0x53f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.long	.LASF170
+	.byte	0xb3
+	.byte	0x3a
+	.long	0x549
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF248
+	.byte	0x8b
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x141f
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0x8b
+	.byte	0x23
+	.long	0x141f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x5
+	.long	.LASF197
+	.byte	0x8b
+	.byte	0x36
+	.long	0x1424
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x5
+	.long	.LASF232
+	.byte	0x8b
+	.byte	0x42
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x7
+	.long	.LASF235
+	.byte	0x8d
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x10
+	.string	"n"
+	.byte	0x98
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x8
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x10
+	.string	"s"
+	.byte	0x99
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x8
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x7
+	.long	.LASF191
+	.byte	0x9b
+	.byte	0x13
+	.long	0x558
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.long	.LASF192
+	.byte	0x9c
+	.byte	0x13
+	.long	0x558
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x7
+	.long	.LASF193
+	.byte	0x9d
+	.byte	0x14
+	.long	0x564
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x10
+	.string	"i"
+	.byte	0x9f
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x8
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x7
+	.long	.LASF243
+	.byte	0xa1
+	.byte	0x1d
+	.long	0x55f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xb8a
+	.uleb128 0x4
+	.long	0x55f
+	.uleb128 0x22
+	.long	.LASF249
+	.byte	0x81
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1454
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0x81
+	.byte	0x1e
+	.long	0x141f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF250
+	.byte	0x1
+	.byte	0x59
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x14cb
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0x59
+	.byte	0x1d
+	.long	0x141f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF188
+	.byte	0x59
+	.byte	0x3c
+	.long	0xfd3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.long	.LASF189
+	.byte	0x59
+	.byte	0x4a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x5
+	.long	.LASF190
+	.byte	0x59
+	.byte	0x6a
+	.long	0xb7b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.long	.LASF251
+	.byte	0x5b
+	.byte	0x11
+	.long	0x549
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x7
+	.long	.LASF252
+	.byte	0x73
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF254
+	.byte	0x54
+	.byte	0xd
+	.long	0x52
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1509
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0x54
+	.byte	0x33
+	.long	0x1036
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.long	.LASF253
+	.byte	0x54
+	.byte	0x3d
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF255
+	.byte	0x4c
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1539
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0x4c
+	.byte	0x31
+	.long	0x1036
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF256
+	.byte	0x31
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15dd
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0x31
+	.byte	0x2b
+	.long	0x141f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x7
+	.long	.LASF235
+	.byte	0x33
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x8
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x10
+	.string	"b"
+	.byte	0x39
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x8
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x10
+	.string	"s"
+	.byte	0x3b
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x7
+	.long	.LASF257
+	.byte	0x3d
+	.byte	0x1b
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF258
+	.byte	0x3e
+	.byte	0x1b
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF263
+	.byte	0x1
+	.byte	0x24
+	.byte	0xd
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x5
+	.long	.LASF229
+	.byte	0x24
+	.byte	0x2c
+	.long	0x141f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.long	.LASF253
+	.byte	0x24
+	.byte	0x36
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x8
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x10
+	.string	"s"
+	.byte	0x26
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF152:
+	.string	"serviced"
+.LASF125:
+	.string	"sqRing"
+.LASF49:
+	.string	"pthread_t"
+.LASF75:
+	.string	"_shortbuf"
+.LASF168:
+	.string	"dataBytesLeft"
+.LASF195:
+	.string	"bucketSize"
+.LASF220:
+	.string	"strrchr"
+.LASF260:
+	.string	"_IO_lock_t"
+.LASF163:
+	.string	"format"
+.LASF93:
+	.string	"__flags"
+.LASF64:
+	.string	"_IO_buf_end"
+.LASF180:
+	.string	"SampleReader_t"
+.LASF191:
+	.string	"minimum"
+.LASF169:
+	.string	"buffer"
+.LASF165:
+	.string	"sampleRate"
+.LASF256:
+	.string	"lmsPlot_NextBucket"
+.LASF62:
+	.string	"_IO_write_end"
+.LASF7:
+	.string	"unsigned int"
+.LASF172:
+	.string	"textEnd"
+.LASF80:
+	.string	"_freeres_list"
+.LASF56:
+	.string	"_flags"
+.LASF47:
+	.string	"__wrefs"
+.LASF134:
+	.string	"cqHead"
+.LASF68:
+	.string	"_markers"
+.LASF146:
+	.string	"error"
+.LASF213:
+	.string	"fputc"
+.LASF246:
+	.string	"lmsPlot_WriteCsv"
+.LASF140:
+	.string	"mode"
+.LASF174:
+	.string	"textEof"
+.LASF157:
+	.string	"SAMPLE_FORMAT_F32"
+.LASF262:
+	.string	"lmsPlot_FilterSeriesNames"
+.LASF108:
+	.string	"ASYNC_FILE_BACKEND_URING"
+.LASF207:
+	.string	"sampleIo_FormatFromFileName"
+.LASF113:
+	.string	"ASYNC_FILE_WRITE"
+.LASF249:
+	.string	"lmsPlot_Free"
+.LASF116:
+	.string	"ASYNC_FILE_BUFFER_QUEUED"
+.LASF154:
+	.string	"AsyncFile_t"
+.LASF144:
+	.string	"submitted"
+.LASF54:
+	.string	"pthread_cond_t"
+.LASF31:
+	.string	"__pthread_internal_list"
+.LASF147:
+	.string	"ring"
+.LASF19:
+	.string	"__sigset_t"
+.LASF115:
+	.string	"ASYNC_FILE_BUFFER_FREE"
+.LASF43:
+	.string	"__g1_start"
+.LASF121:
+	.string	"size"
+.LASF67:
+	.string	"_IO_save_end"
+.LASF34:
+	.string	"__count"
+.LASF156:
+	.string	"SAMPLE_FORMAT_TEXT"
+.LASF89:
+	.string	"float"
+.LASF204:
+	.string	"memmove"
+.LASF87:
+	.string	"_IO_codecvt"
+.LASF211:
+	.string	"sqrt"
+.LASF216:
+	.string	"malloc"
+.LASF232:
+	.string	"count"
+.LASF230:
+	.string	"index"
+.LASF139:
+	.string	"AsyncFileRing_t"
+.LASF199:
+	.string	"lmsPlotFilterSeries"
+.LASF122:
+	.string	"result"
+.LASF26:
+	.string	"long long unsigned int"
+.LASF162:
+	.string	"file"
+.LASF222:
+	.string	"fminf"
+.LASF196:
+	.string	"fill"
+.LASF239:
+	.string	"high"
+.LASF107:
+	.string	"ASYNC_FILE_BACKEND_AUTO"
+.LASF259:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF35:
+	.string	"__owner"
+.LASF203:
+	.string	"sampleIo_Read"
+.LASF77:
+	.string	"_offset"
+.LASF201:
+	.string	"waitpid"
+.LASF45:
+	.string	"__g_size"
+.LASF39:
+	.string	"__elision"
+.LASF132:
+	.string	"sqMask"
+.LASF177:
+	.string	"ioLength"
+.LASF212:
+	.string	"fprintf"
+.LASF70:
+	.string	"_fileno"
+.LASF236:
+	.string	"used"
+.LASF137:
+	.string	"cqes"
+.LASF103:
+	.string	"__actions"
+.LASF253:
+	.string	"bucket"
+.LASF242:
+	.string	"pass"
+.LASF10:
+	.string	"size_t"
+.LASF186:
+	.string	"width"
+.LASF127:
+	.string	"cqRing"
+.LASF120:
+	.string	"offset"
+.LASF117:
+	.string	"ASYNC_FILE_BUFFER_DONE"
+.LASF59:
+	.string	"_IO_read_base"
+.LASF233:
+	.string	"lmsPlot_Write"
+.LASF238:
+	.string	"framesPerPixel"
+.LASF143:
+	.string	"buffers"
+.LASF254:
+	.string	"lmsPlot_BucketFrames"
+.LASF215:
+	.string	"free"
+.LASF129:
+	.string	"sqes"
+.LASF105:
+	.string	"posix_spawn_file_actions_t"
+.LASF258:
+	.string	"second"
+.LASF227:
+	.string	"inputFileName"
+.LASF23:
+	.string	"__high"
+.LASF29:
+	.string	"__next"
+.LASF188:
+	.string	"settings"
+.LASF225:
+	.string	"lmsPlot_Open"
+.LASF250:
+	.string	"lmsPlot_Init"
+.LASF15:
+	.string	"char"
+.LASF83:
+	.string	"_mode"
+.LASF229:
+	.string	"plot"
+.LASF251:
+	.string	"extension"
+.LASF209:
+	.string	"ferror"
+.LASF86:
+	.string	"_IO_marker"
+.LASF261:
+	.string	"environ"
+.LASF170:
+	.string	"text"
+.LASF57:
+	.string	"_IO_read_ptr"
+.LASF119:
+	.string	"data"
+.LASF197:
+	.string	"frames"
+.LASF18:
+	.string	"ssize_t"
+.LASF244:
+	.string	"middle"
+.LASF28:
+	.string	"__prev"
+.LASF224:
+	.string	"status"
+.LASF92:
+	.string	"sched_priority"
+.LASF181:
+	.string	"LMS_PLOT_FORMAT_HTML"
+.LASF192:
+	.string	"maximum"
+.LASF183:
+	.string	"LMS_PLOT_FORMAT_CSV"
+.LASF150:
+	.string	"queued"
+.LASF159:
+	.string	"SAMPLE_FORMAT_WAV_S16"
+.LASF193:
+	.string	"sumSquares"
+.LASF231:
+	.string	"retval"
+.LASF60:
+	.string	"_IO_write_base"
+.LASF158:
+	.string	"SAMPLE_FORMAT_S16"
+.LASF13:
+	.string	"__pid_t"
+.LASF118:
+	.string	"AsyncFileBufferState_t"
+.LASF40:
+	.string	"__list"
+.LASF4:
+	.string	"long long int"
+.LASF114:
+	.string	"AsyncFileMode_t"
+.LASF241:
+	.string	"zero"
+.LASF218:
+	.string	"printf"
+.LASF112:
+	.string	"ASYNC_FILE_READ"
+.LASF149:
+	.string	"lock"
+.LASF17:
+	.string	"pid_t"
+.LASF141:
+	.string	"backend"
+.LASF109:
+	.string	"ASYNC_FILE_BACKEND_THREAD"
+.LASF178:
+	.string	"ioPos"
+.LASF171:
+	.string	"textPos"
+.LASF164:
+	.string	"channels"
+.LASF263:
+	.string	"lmsPlot_ClearBucket"
+.LASF99:
+	.string	"__pad"
+.LASF240:
+	.string	"scale"
+.LASF219:
+	.string	"memset"
+.LASF190:
+	.string	"names"
+.LASF101:
+	.string	"__allocated"
+.LASF81:
+	.string	"_freeres_buf"
+.LASF189:
+	.string	"numOfSeries"
+.LASF66:
+	.string	"_IO_backup_base"
+.LASF226:
+	.string	"lmsPlot_PlotFile"
+.LASF37:
+	.string	"__kind"
+.LASF82:
+	.string	"__pad5"
+.LASF200:
+	.string	"lmsPlotColors"
+.LASF252:
+	.string	"values"
+.LASF237:
+	.string	"height"
+.LASF25:
+	.string	"__value32"
+.LASF155:
+	.string	"SAMPLE_FORMAT_UNKNOWN"
+.LASF136:
+	.string	"cqMask"
+.LASF210:
+	.string	"fopen"
+.LASF74:
+	.string	"_vtable_offset"
+.LASF151:
+	.string	"done"
+.LASF153:
+	.string	"stop"
+.LASF98:
+	.string	"__policy"
+.LASF124:
+	.string	"AsyncFileBuffer_t"
+.LASF235:
+	.string	"series"
+.LASF126:
+	.string	"sqRingSize"
+.LASF223:
+	.string	"argv"
+.LASF30:
+	.string	"__pthread_list_t"
+.LASF142:
+	.string	"memory"
+.LASF247:
+	.string	"lmsPlot_WriteEscaped"
+.LASF138:
+	.string	"registered"
+.LASF228:
+	.string	"reader"
+.LASF145:
+	.string	"completed"
+.LASF202:
+	.string	"posix_spawnp"
+.LASF106:
+	.string	"ASYNC_FILE_BACKEND_UNKNOWN"
+.LASF65:
+	.string	"_IO_save_base"
+.LASF58:
+	.string	"_IO_read_end"
+.LASF20:
+	.string	"sigset_t"
+.LASF245:
+	.string	"lmsPlot_WriteSvg"
+.LASF131:
+	.string	"sqTail"
+.LASF9:
+	.string	"short int"
+.LASF3:
+	.string	"long int"
+.LASF95:
+	.string	"__sd"
+.LASF198:
+	.string	"LmsPlot_t"
+.LASF110:
+	.string	"ASYNC_FILE_BACKEND_STDIO"
+.LASF97:
+	.string	"__sp"
+.LASF88:
+	.string	"_IO_wide_data"
+.LASF96:
+	.string	"__ss"
+.LASF102:
+	.string	"__used"
+.LASF208:
+	.string	"fclose"
+.LASF206:
+	.string	"sampleIo_OpenReader"
+.LASF221:
+	.string	"fmaxf"
+.LASF14:
+	.string	"__ssize_t"
+.LASF160:
+	.string	"SAMPLE_FORMAT_WAV_F32"
+.LASF50:
+	.string	"__data"
+.LASF27:
+	.string	"__atomic_wide_counter"
+.LASF111:
+	.string	"AsyncFileBackend_t"
+.LASF128:
+	.string	"cqRingSize"
+.LASF36:
+	.string	"__nusers"
+.LASF79:
+	.string	"_wide_data"
+.LASF104:
+	.string	"__spawn_action"
+.LASF76:
+	.string	"_lock"
+.LASF176:
+	.string	"ioData"
+.LASF24:
+	.string	"__value64"
+.LASF255:
+	.string	"lmsPlot_UsedBuckets"
+.LASF2:
+	.string	"long unsigned int"
+.LASF78:
+	.string	"_codecvt"
+.LASF72:
+	.string	"_old_offset"
+.LASF55:
+	.string	"_IO_FILE"
+.LASF175:
+	.string	"async"
+.LASF148:
+	.string	"thread"
+.LASF53:
+	.string	"pthread_mutex_t"
+.LASF33:
+	.string	"__lock"
+.LASF44:
+	.string	"__g_refs"
+.LASF91:
+	.string	"sched_param"
+.LASF5:
+	.string	"unsigned char"
+.LASF61:
+	.string	"_IO_write_ptr"
+.LASF187:
+	.string	"LmsPlotSettings_t"
+.LASF257:
+	.string	"first"
+.LASF161:
+	.string	"SampleFormat_t"
+.LASF41:
+	.string	"__pthread_cond_s"
+.LASF123:
+	.string	"state"
+.LASF167:
+	.string	"fileSize"
+.LASF48:
+	.string	"__g_signals"
+.LASF42:
+	.string	"__wseq"
+.LASF22:
+	.string	"__low"
+.LASF205:
+	.string	"sampleIo_CloseReader"
+.LASF38:
+	.string	"__spins"
+.LASF11:
+	.string	"__off_t"
+.LASF133:
+	.string	"sqArray"
+.LASF217:
+	.string	"strcmp"
+.LASF179:
+	.string	"ioPosition"
+.LASF8:
+	.string	"signed char"
+.LASF130:
+	.string	"sqesSize"
+.LASF16:
+	.string	"off_t"
+.LASF6:
+	.string	"short unsigned int"
+.LASF248:
+	.string	"lmsPlot_AddFrames"
+.LASF21:
+	.string	"__val"
+.LASF166:
+	.string	"numOfFrames"
+.LASF214:
+	.string	"perror"
+.LASF94:
+	.string	"__pgrp"
+.LASF90:
+	.string	"double"
+.LASF46:
+	.string	"__g1_orig_size"
+.LASF194:
+	.string	"buckets"
+.LASF173:
+	.string	"mappedSize"
+.LASF52:
+	.string	"__align"
+.LASF69:
+	.string	"_chain"
+.LASF85:
+	.string	"FILE"
+.LASF185:
+	.string	"fileName"
+.LASF71:
+	.string	"_flags2"
+.LASF184:
+	.string	"LmsPlotFormat_t"
+.LASF51:
+	.string	"__size"
+.LASF73:
+	.string	"_cur_column"
+.LASF243:
+	.string	"value"
+.LASF135:
+	.string	"cqTail"
+.LASF100:
+	.string	"posix_spawnattr_t"
+.LASF12:
+	.string	"__off64_t"
+.LASF234:
+	.string	"title"
+.LASF84:
+	.string	"_unused2"
+.LASF63:
+	.string	"_IO_buf_base"
+.LASF32:
+	.string	"__pthread_mutex_s"
+.LASF182:
+	.string	"LMS_PLOT_FORMAT_SVG"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/lmsPlot.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2577 @@
+	.file	"lmsRealtime.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsRealtime.c"
+	.type	lmsRealtime_Bucket, @function
+lmsRealtime_Bucket:
+.LFB509:
+	.file 1 "source/lmsRealtime.c"
+	.loc 1 30 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 31 8
+	cmp	QWORD PTR -24[rbp], 7
+	ja	.L2
+	.loc 1 33 16
+	mov	rax, QWORD PTR -24[rbp]
+	jmp	.L3
+.L2:
+	.loc 1 35 40
+	bsr	rax, QWORD PTR -24[rbp]
+	xor	rax, 63
+	mov	edx, eax
+	.loc 1 35 38
+	mov	eax, 63
+	sub	eax, edx
+	.loc 1 35 24
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 36 24
+	mov	eax, DWORD PTR -4[rbp]
+	sub	eax, 3
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 37 56
+	mov	eax, DWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	ecx, eax
+	shr	rdx, cl
+	mov	rax, rdx
+	.loc 1 37 24
+	and	eax, 7
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 38 19
+	mov	eax, DWORD PTR -8[rbp]
+	add	eax, 1
+	.loc 1 38 24
+	lea	edx, 0[0+rax*8]
+	.loc 1 38 51
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, edx
+.L3:
+	.loc 1 39 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE509:
+	.size	lmsRealtime_Bucket, .-lmsRealtime_Bucket
+	.type	lmsRealtime_BucketUpperBound, @function
+lmsRealtime_BucketUpperBound:
+.LFB510:
+	.loc 1 45 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 46 8
+	cmp	DWORD PTR -20[rbp], 7
+	ja	.L5
+	.loc 1 48 16
+	mov	eax, DWORD PTR -20[rbp]
+	jmp	.L6
+.L5:
+	.loc 1 50 39
+	mov	eax, DWORD PTR -20[rbp]
+	shr	eax, 3
+	.loc 1 50 24
+	sub	eax, 1
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 51 75
+	mov	eax, DWORD PTR -20[rbp]
+	and	eax, 7
+	.loc 1 51 66
+	add	eax, 8
+	.loc 1 51 30
+	mov	eax, eax
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 52 23
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 1[rax]
+	.loc 1 52 28
+	mov	eax, DWORD PTR -4[rbp]
+	mov	ecx, eax
+	sal	rdx, cl
+	mov	rax, rdx
+	.loc 1 52 38
+	sub	rax, 1
+.L6:
+	.loc 1 53 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE510:
+	.size	lmsRealtime_BucketUpperBound, .-lmsRealtime_BucketUpperBound
+	.type	lmsRealtime_Percentile, @function
+lmsRealtime_Percentile:
+.LFB511:
+	.loc 1 59 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	movsd	QWORD PTR -48[rbp], xmm0
+	.loc 1 60 72
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 4096[rax]
+	.loc 1 60 61
+	test	rax, rax
+	js	.L8
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L9
+.L8:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L9:
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -48[rbp]
+	.loc 1 60 80
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	addsd	xmm0, xmm1
+	.loc 1 60 24
+	comisd	xmm0, QWORD PTR .LC1[rip]
+	jnb	.L10
+	cvttsd2si	rax, xmm0
+	mov	QWORD PTR -8[rbp], rax
+	jmp	.L11
+.L10:
+	movsd	xmm1, QWORD PTR .LC1[rip]
+	subsd	xmm0, xmm1
+	cvttsd2si	rax, xmm0
+	mov	QWORD PTR -8[rbp], rax
+	movabs	rax, -9223372036854775808
+	xor	QWORD PTR -8[rbp], rax
+.L11:
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 61 24
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 63 8
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L12
+	.loc 1 65 14
+	mov	QWORD PTR -8[rbp], 1
+.L12:
+.LBB9:
+	.loc 1 67 23
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 67 5
+	jmp	.L13
+.L16:
+	.loc 1 69 35
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR [rax+rdx*8]
+	.loc 1 69 15
+	add	QWORD PTR -16[rbp], rax
+	.loc 1 70 12
+	mov	rax, QWORD PTR -16[rbp]
+	cmp	rax, QWORD PTR -8[rbp]
+	jb	.L14
+.LBB10:
+	.loc 1 72 46
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edi, eax
+	call	lmsRealtime_BucketUpperBound
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 73 38
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 4112[rax]
+	.loc 1 73 55
+	mov	rax, QWORD PTR -32[rbp]
+	cmp	rdx, rax
+	cmovbe	rax, rdx
+	jmp	.L15
+.L14:
+.LBE10:
+	.loc 1 67 57 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L13:
+	.loc 1 67 32 discriminator 1
+	cmp	DWORD PTR -20[rbp], 511
+	jbe	.L16
+.LBE9:
+	.loc 1 76 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 4112[rax]
+.L15:
+	.loc 1 77 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE511:
+	.size	lmsRealtime_Percentile, .-lmsRealtime_Percentile
+	.section	.rodata
+	.align 8
+.LC2:
+	.string	"ERROR: Real-time mode needs a sample rate and a positive block size"
+	.text
+	.globl	lmsRealtime_Init
+	.type	lmsRealtime_Init, @function
+lmsRealtime_Init:
+.LFB512:
+	.loc 1 80 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	.loc 1 81 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 81 8
+	test	eax, eax
+	je	.L18
+	.loc 1 81 49 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 81 37 discriminator 1
+	test	eax, eax
+	jg	.L19
+.L18:
+	.loc 1 83 9
+	lea	rax, .LC2[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 84 16
+	mov	eax, 1
+	jmp	.L20
+.L19:
+	.loc 1 86 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, 4160
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 87 24
+	mov	rcx, QWORD PTR -8[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rsi]
+	mov	rdx, QWORD PTR 8[rsi]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+	mov	eax, DWORD PTR 16[rsi]
+	mov	DWORD PTR 16[rcx], eax
+	.loc 1 88 56
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 88 28
+	cdqe
+	.loc 1 88 68
+	imul	rax, rax, 1000000000
+	.loc 1 88 94
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	edx, DWORD PTR [rdx]
+	mov	ecx, edx
+	.loc 1 88 84
+	mov	edx, 0
+	div	rcx
+	mov	rdx, rax
+	.loc 1 88 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 89 12
+	mov	eax, 0
+.L20:
+	.loc 1 90 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE512:
+	.size	lmsRealtime_Init, .-lmsRealtime_Init
+	.section	.rodata
+	.align 8
+.LC3:
+	.string	"WARNING: Cannot pin the worker thread to CPU %d\n"
+	.align 8
+.LC4:
+	.string	"WARNING: SCHED_FIFO priority %d not permitted, running with the default policy\n"
+	.align 8
+.LC5:
+	.string	"WARNING: Memory cannot be locked"
+	.text
+	.globl	lmsRealtime_ConfigureThread
+	.type	lmsRealtime_ConfigureThread, @function
+lmsRealtime_ConfigureThread:
+.LFB513:
+	.loc 1 93 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 160
+	mov	QWORD PTR -152[rbp], rdi
+	.loc 1 94 17
+	mov	rax, QWORD PTR -152[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 94 8
+	test	eax, eax
+	js	.L22
+.LBB11:
+	.loc 1 97 9
+	lea	rax, -144[rbp]
+	mov	rsi, rax
+	mov	eax, 0
+	mov	edx, 16
+	mov	rdi, rsi
+	mov	rcx, rdx
+	rep stosq
+.LBB12:
+	.loc 1 98 9
+	mov	rax, QWORD PTR -152[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	mov	QWORD PTR -8[rbp], rax
+	cmp	QWORD PTR -8[rbp], 1023
+	ja	.L24
+	.loc 1 98 9 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	shr	rax, 6
+	lea	rdx, 0[0+rax*8]
+	lea	rcx, -144[rbp]
+	add	rdx, rcx
+	mov	rdx, QWORD PTR [rdx]
+	mov	rcx, QWORD PTR -8[rbp]
+	and	ecx, 63
+	mov	esi, 1
+	sal	rsi, cl
+	mov	rcx, rsi
+	lea	rsi, 0[0+rax*8]
+	lea	rax, -144[rbp]
+	add	rax, rsi
+	or	rdx, rcx
+	mov	QWORD PTR [rax], rdx
+.L24:
+.LBE12:
+	.loc 1 99 13 is_stmt 1 discriminator 4
+	call	pthread_self@PLT
+	mov	rcx, rax
+	lea	rax, -144[rbp]
+	mov	rdx, rax
+	mov	esi, 128
+	mov	rdi, rcx
+	call	pthread_setaffinity_np@PLT
+	.loc 1 99 12 discriminator 4
+	test	eax, eax
+	je	.L22
+	.loc 1 101 81
+	mov	rax, QWORD PTR -152[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 101 13
+	mov	esi, eax
+	lea	rax, .LC3[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L22:
+.LBE11:
+	.loc 1 104 17
+	mov	rax, QWORD PTR -152[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 104 8
+	test	eax, eax
+	jle	.L26
+.LBB13:
+	.loc 1 106 69
+	mov	rax, QWORD PTR -152[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 106 28
+	mov	DWORD PTR -16[rbp], eax
+	.loc 1 107 13
+	call	pthread_self@PLT
+	mov	rcx, rax
+	lea	rax, -16[rbp]
+	mov	rdx, rax
+	mov	esi, 1
+	mov	rdi, rcx
+	call	pthread_setschedparam@PLT
+	.loc 1 107 12
+	test	eax, eax
+	je	.L27
+	.loc 1 110 28
+	mov	rax, QWORD PTR -152[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 109 13
+	mov	esi, eax
+	lea	rax, .LC4[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L27:
+	.loc 1 114 13
+	mov	edi, 3
+	call	mlockall@PLT
+	.loc 1 114 12
+	test	eax, eax
+	je	.L26
+	.loc 1 116 13
+	lea	rax, .LC5[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L26:
+.LBE13:
+.LBB14:
+.LBB15:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/xmmintrin.h"
+	.loc 2 823 10
+	stmxcsr	DWORD PTR -156[rbp]
+	mov	eax, DWORD PTR -156[rbp]
+.LBE15:
+.LBE14:
+	.loc 1 122 5
+	or	eax, 32832
+	mov	DWORD PTR -12[rbp], eax
+.LBB16:
+.LBB17:
+	.loc 2 855 3
+	mov	eax, DWORD PTR -12[rbp]
+	mov	DWORD PTR -156[rbp], eax
+	ldmxcsr	DWORD PTR -156[rbp]
+	.loc 2 856 1
+	nop
+.LBE17:
+.LBE16:
+	.loc 1 124 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE513:
+	.size	lmsRealtime_ConfigureThread, .-lmsRealtime_ConfigureThread
+	.globl	lmsRealtime_Now
+	.type	lmsRealtime_Now, @function
+lmsRealtime_Now:
+.LFB514:
+	.loc 1 127 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	.loc 1 129 5
+	lea	rax, -16[rbp]
+	mov	rsi, rax
+	mov	edi, 1
+	call	clock_gettime@PLT
+	.loc 1 130 35
+	mov	rax, QWORD PTR -16[rbp]
+	.loc 1 130 43
+	imul	rax, rax, 1000000000
+	.loc 1 130 64
+	mov	rdx, QWORD PTR -8[rbp]
+	.loc 1 130 59
+	add	rax, rdx
+	.loc 1 131 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE514:
+	.size	lmsRealtime_Now, .-lmsRealtime_Now
+	.globl	lmsRealtime_Record
+	.type	lmsRealtime_Record, @function
+lmsRealtime_Record:
+.LFB515:
+	.loc 1 134 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 135 28
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 40
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 137 23
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	lmsRealtime_Bucket
+	mov	ecx, eax
+	.loc 1 137 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, ecx
+	mov	rax, QWORD PTR [rax+rdx*8]
+	.loc 1 137 53
+	lea	rdx, 1[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, ecx
+	mov	QWORD PTR [rax+rcx*8], rdx
+	.loc 1 138 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 4096[rax]
+	.loc 1 138 21
+	lea	rdx, 1[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 4096[rax], rdx
+	.loc 1 139 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 4104[rax]
+	.loc 1 139 22
+	mov	rax, QWORD PTR -32[rbp]
+	add	rdx, rax
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 4104[rax], rdx
+	.loc 1 140 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 4112[rax]
+	.loc 1 140 8
+	cmp	rax, QWORD PTR -32[rbp]
+	jnb	.L33
+	.loc 1 142 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	QWORD PTR 4112[rax], rdx
+.L33:
+	.loc 1 144 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 144 8
+	cmp	rax, QWORD PTR -32[rbp]
+	jnb	.L35
+	.loc 1 146 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 146 33
+	lea	rdx, 1[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 32[rax], rdx
+.L35:
+	.loc 1 148 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE515:
+	.size	lmsRealtime_Record, .-lmsRealtime_Record
+	.globl	lmsRealtime_GetStats
+	.type	lmsRealtime_GetStats, @function
+lmsRealtime_GetStats:
+.LFB516:
+	.loc 1 151 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 152 34
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 40
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 154 5
+	mov	rax, QWORD PTR -32[rbp]
+	mov	edx, 64
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 155 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 4096[rax]
+	.loc 1 155 19
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 156 37
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 156 27
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 157 33
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 157 23
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 158 18
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 4096[rax]
+	.loc 1 158 8
+	test	rax, rax
+	je	.L42
+	.loc 1 160 24
+	mov	rdx, QWORD PTR .LC0[rip]
+	mov	rax, QWORD PTR -8[rbp]
+	movq	xmm0, rdx
+	mov	rdi, rax
+	call	lmsRealtime_Percentile
+	.loc 1 160 22
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	QWORD PTR 24[rdx], rax
+	.loc 1 161 24
+	mov	rdx, QWORD PTR .LC6[rip]
+	mov	rax, QWORD PTR -8[rbp]
+	movq	xmm0, rdx
+	mov	rdi, rax
+	call	lmsRealtime_Percentile
+	.loc 1 161 22
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	QWORD PTR 32[rdx], rax
+	.loc 1 162 25
+	mov	rdx, QWORD PTR .LC7[rip]
+	mov	rax, QWORD PTR -8[rbp]
+	movq	xmm0, rdx
+	mov	rdi, rax
+	call	lmsRealtime_Percentile
+	.loc 1 162 23
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	QWORD PTR 40[rdx], rax
+	.loc 1 163 33
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 4112[rax]
+	.loc 1 163 22
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 164 42
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 4104[rax]
+	.loc 1 164 25
+	test	rax, rax
+	js	.L38
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L39
+.L38:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L39:
+	.loc 1 164 61
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 4096[rax]
+	.loc 1 164 50
+	test	rax, rax
+	js	.L40
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, rax
+	jmp	.L41
+.L40:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, rdx
+	addsd	xmm1, xmm1
+.L41:
+	divsd	xmm0, xmm1
+	.loc 1 164 23
+	mov	rax, QWORD PTR -32[rbp]
+	movsd	QWORD PTR 56[rax], xmm0
+.L42:
+	.loc 1 166 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE516:
+	.size	lmsRealtime_GetStats, .-lmsRealtime_GetStats
+	.section	.rodata
+	.align 8
+.LC8:
+	.string	"Blocks:                       %llu\n"
+	.align 8
+.LC10:
+	.string	"Block deadline:               %.3f us\n"
+	.align 8
+.LC11:
+	.string	"Block time mean:              %.3f us\n"
+	.align 8
+.LC12:
+	.string	"Block time p50:               %.3f us\n"
+	.align 8
+.LC13:
+	.string	"Block time p99:               %.3f us\n"
+	.align 8
+.LC14:
+	.string	"Block time p99.9:             %.3f us\n"
+	.align 8
+.LC15:
+	.string	"Block time max:               %.3f us\n"
+	.align 8
+.LC16:
+	.string	"Deadline misses:              %llu\n"
+	.text
+	.globl	lmsRealtime_PrintStats
+	.type	lmsRealtime_PrintStats, @function
+lmsRealtime_PrintStats:
+.LFB517:
+	.loc 1 169 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 170 57
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 170 5
+	mov	rsi, rax
+	lea	rax, .LC8[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 171 60
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 171 5
+	test	rax, rax
+	js	.L44
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L45
+.L44:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L45:
+	movsd	xmm1, QWORD PTR .LC9[rip]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	lea	rax, .LC10[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 172 60
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR 56[rax]
+	.loc 1 172 5
+	movsd	xmm1, QWORD PTR .LC9[rip]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	lea	rax, .LC11[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 173 60
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 173 5
+	test	rax, rax
+	js	.L46
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L47
+.L46:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L47:
+	movsd	xmm1, QWORD PTR .LC9[rip]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	lea	rax, .LC12[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 174 60
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 174 5
+	test	rax, rax
+	js	.L48
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L49
+.L48:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L49:
+	movsd	xmm1, QWORD PTR .LC9[rip]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	lea	rax, .LC13[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 175 60
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 175 5
+	test	rax, rax
+	js	.L50
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L51
+.L50:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L51:
+	movsd	xmm1, QWORD PTR .LC9[rip]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	lea	rax, .LC14[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 176 60
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 176 5
+	test	rax, rax
+	js	.L52
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L53
+.L52:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L53:
+	movsd	xmm1, QWORD PTR .LC9[rip]
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	lea	rax, .LC15[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 177 57
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 177 5
+	mov	rsi, rax
+	lea	rax, .LC16[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 178 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE517:
+	.size	lmsRealtime_PrintStats, .-lmsRealtime_PrintStats
+	.section	.rodata
+	.align 8
+.LC0:
+	.long	0
+	.long	1071644672
+	.align 8
+.LC1:
+	.long	0
+	.long	1138753536
+	.align 8
+.LC6:
+	.long	2061584302
+	.long	1072672276
+	.align 8
+.LC7:
+	.long	-652835029
+	.long	1072691150
+	.align 8
+.LC9:
+	.long	0
+	.long	1083129856
+	.text
+.Letext0:
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h"
+	.file 10 "include/lmsRealtime.h"
+	.file 11 "/usr/include/time.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 13 "/usr/include/pthread.h"
+	.file 14 "/usr/include/stdio.h"
+	.file 15 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x739
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF80
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x4
+	.long	.LASF11
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF5
+	.uleb128 0x7
+	.long	0x69
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF6
+	.uleb128 0x8
+	.long	0x62
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF7
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF8
+	.uleb128 0x8
+	.long	0x75
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF9
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF10
+	.uleb128 0x4
+	.long	.LASF12
+	.byte	0x4
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x48
+	.uleb128 0x4
+	.long	.LASF13
+	.byte	0x4
+	.byte	0xa9
+	.byte	0x1d
+	.long	0x41
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x4
+	.byte	0xc5
+	.byte	0x21
+	.long	0x48
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0x9b
+	.uleb128 0xe
+	.long	.LASF20
+	.byte	0x10
+	.byte	0x6
+	.byte	0xb
+	.long	0xe8
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x6
+	.byte	0x10
+	.byte	0xc
+	.long	0x8f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x6
+	.byte	0x15
+	.byte	0x15
+	.long	0xa9
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF18
+	.uleb128 0x8
+	.long	0xe8
+	.uleb128 0x4
+	.long	.LASF19
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0xe
+	.long	.LASF21
+	.byte	0x4
+	.byte	0x8
+	.byte	0x17
+	.long	0x11a
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x8
+	.byte	0x19
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x100
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x9
+	.byte	0x20
+	.byte	0x19
+	.long	0x3a
+	.uleb128 0xb
+	.byte	0x80
+	.byte	0x9
+	.byte	0x27
+	.long	0x141
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x9
+	.byte	0x29
+	.byte	0xe
+	.long	0x141
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x11f
+	.long	0x151
+	.uleb128 0x19
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF25
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x3
+	.long	0x12b
+	.uleb128 0x8
+	.long	0x151
+	.uleb128 0xb
+	.byte	0x14
+	.byte	0xa
+	.byte	0x11
+	.long	0x1ac
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0xa
+	.byte	0x13
+	.byte	0x12
+	.long	0x75
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0xa
+	.byte	0x14
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0xa
+	.byte	0x15
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x1a
+	.string	"cpu"
+	.byte	0xa
+	.byte	0x16
+	.byte	0x9
+	.long	0x41
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0xa
+	.byte	0x17
+	.byte	0x9
+	.long	0x41
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0xa
+	.byte	0x18
+	.byte	0x3
+	.long	0x162
+	.uleb128 0x8
+	.long	0x1ac
+	.uleb128 0x10
+	.value	0x1018
+	.byte	0x1b
+	.long	0x1f7
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0xa
+	.byte	0x1d
+	.byte	0x18
+	.long	0x1f7
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF32
+	.byte	0x1e
+	.long	0xe8
+	.value	0x1000
+	.uleb128 0xc
+	.long	.LASF33
+	.byte	0x1f
+	.long	0xe8
+	.value	0x1008
+	.uleb128 0xc
+	.long	.LASF34
+	.byte	0x20
+	.long	0xe8
+	.value	0x1010
+	.byte	0
+	.uleb128 0xf
+	.long	0xe8
+	.long	0x208
+	.uleb128 0x1b
+	.long	0x3a
+	.value	0x1ff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0xa
+	.byte	0x21
+	.byte	0x3
+	.long	0x1bd
+	.uleb128 0x8
+	.long	0x208
+	.uleb128 0x10
+	.value	0x1040
+	.byte	0x23
+	.long	0x256
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0xa
+	.byte	0x25
+	.byte	0x1b
+	.long	0x1ac
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0xa
+	.byte	0x26
+	.byte	0x18
+	.long	0xe8
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0xa
+	.byte	0x27
+	.byte	0x18
+	.long	0xe8
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0xa
+	.byte	0x28
+	.byte	0x1b
+	.long	0x208
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0xa
+	.byte	0x29
+	.byte	0x3
+	.long	0x219
+	.uleb128 0x8
+	.long	0x256
+	.uleb128 0xb
+	.byte	0x40
+	.byte	0xa
+	.byte	0x2b
+	.long	0x2d8
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0xa
+	.byte	0x2d
+	.byte	0x18
+	.long	0xe8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0xa
+	.byte	0x2e
+	.byte	0x18
+	.long	0xe8
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x18
+	.long	0xe8
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0xa
+	.byte	0x30
+	.byte	0x18
+	.long	0xe8
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0xa
+	.byte	0x31
+	.byte	0x18
+	.long	0xe8
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0xa
+	.byte	0x32
+	.byte	0x18
+	.long	0xe8
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0xa
+	.byte	0x33
+	.byte	0x18
+	.long	0xe8
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0xa
+	.byte	0x34
+	.byte	0xc
+	.long	0x2d8
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF46
+	.uleb128 0x4
+	.long	.LASF47
+	.byte	0xa
+	.byte	0x35
+	.byte	0x3
+	.long	0x267
+	.uleb128 0x8
+	.long	0x2df
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF48
+	.uleb128 0x9
+	.long	.LASF49
+	.byte	0xb
+	.value	0x120
+	.long	0x41
+	.long	0x312
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0x312
+	.byte	0
+	.uleb128 0x7
+	.long	0xc1
+	.uleb128 0x11
+	.long	.LASF50
+	.byte	0xc
+	.byte	0x6f
+	.byte	0xc
+	.long	0x41
+	.long	0x32d
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF51
+	.byte	0xd
+	.value	0x1b9
+	.long	0x41
+	.long	0x34d
+	.uleb128 0x2
+	.long	0xf4
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x34d
+	.byte	0
+	.uleb128 0x7
+	.long	0x11a
+	.uleb128 0x9
+	.long	.LASF52
+	.byte	0xe
+	.value	0x164
+	.long	0x41
+	.long	0x369
+	.uleb128 0x2
+	.long	0x5d
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF53
+	.byte	0xd
+	.value	0x1e9
+	.long	0x41
+	.long	0x389
+	.uleb128 0x2
+	.long	0xf4
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x389
+	.byte	0
+	.uleb128 0x7
+	.long	0x15d
+	.uleb128 0x1d
+	.long	.LASF81
+	.byte	0xd
+	.value	0x111
+	.byte	0x12
+	.long	0xf4
+	.uleb128 0x11
+	.long	.LASF54
+	.byte	0xf
+	.byte	0x3d
+	.byte	0xe
+	.long	0xa7
+	.long	0x3bb
+	.uleb128 0x2
+	.long	0xa7
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF55
+	.byte	0xa8
+	.quad	.LFB517
+	.quad	.LFE517-.LFB517
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3e6
+	.uleb128 0x6
+	.long	.LASF57
+	.byte	0xa8
+	.byte	0x37
+	.long	0x3e6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x7
+	.long	0x2eb
+	.uleb128 0xa
+	.long	.LASF56
+	.byte	0x96
+	.quad	.LFB516
+	.quad	.LFE516-.LFB516
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x432
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0x96
+	.byte	0x30
+	.long	0x432
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF57
+	.byte	0x96
+	.byte	0x4e
+	.long	0x437
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x98
+	.byte	0x22
+	.long	0x43c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x7
+	.long	0x262
+	.uleb128 0x7
+	.long	0x2df
+	.uleb128 0x7
+	.long	0x214
+	.uleb128 0xa
+	.long	.LASF59
+	.byte	0x85
+	.quad	.LFB515
+	.quad	.LFE515-.LFB515
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x488
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0x85
+	.byte	0x28
+	.long	0x488
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF60
+	.byte	0x85
+	.byte	0x45
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x87
+	.byte	0x1c
+	.long	0x48d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x7
+	.long	0x256
+	.uleb128 0x7
+	.long	0x208
+	.uleb128 0x12
+	.long	.LASF65
+	.byte	0x7e
+	.byte	0x14
+	.long	0xe8
+	.quad	.LFB514
+	.quad	.LFE514-.LFB514
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4c2
+	.uleb128 0x13
+	.string	"now"
+	.byte	0x80
+	.byte	0x15
+	.long	0xc1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF61
+	.byte	0x5c
+	.quad	.LFB513
+	.quad	.LFE513-.LFB513
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x590
+	.uleb128 0x6
+	.long	.LASF36
+	.byte	0x5c
+	.byte	0x3f
+	.long	0x590
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x14
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.long	0x532
+	.uleb128 0x3
+	.long	.LASF62
+	.byte	0x60
+	.byte	0x13
+	.long	0x151
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0xd
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x3
+	.long	.LASF63
+	.byte	0x62
+	.byte	0x9
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.long	0x556
+	.uleb128 0x3
+	.long	.LASF64
+	.byte	0x6a
+	.byte	0x1c
+	.long	0x100
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x1e
+	.long	0x72e
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.byte	0x1
+	.byte	0x7a
+	.byte	0x10
+	.uleb128 0x1f
+	.long	0x712
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.byte	0x1
+	.byte	0x7a
+	.byte	0x5
+	.uleb128 0x20
+	.long	0x720
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x1b8
+	.uleb128 0x12
+	.long	.LASF66
+	.byte	0x4f
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB512
+	.quad	.LFE512-.LFB512
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5d3
+	.uleb128 0x6
+	.long	.LASF58
+	.byte	0x4f
+	.byte	0x25
+	.long	0x488
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.long	.LASF36
+	.byte	0x4f
+	.byte	0x4c
+	.long	0x590
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF71
+	.byte	0x1
+	.byte	0x3a
+	.byte	0x1b
+	.long	0xe8
+	.quad	.LFB511
+	.quad	.LFE511-.LFB511
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x66c
+	.uleb128 0x6
+	.long	.LASF39
+	.byte	0x3a
+	.byte	0x4f
+	.long	0x43c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF67
+	.byte	0x3a
+	.byte	0x61
+	.long	0x2d8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x3
+	.long	.LASF68
+	.byte	0x3c
+	.byte	0x18
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF69
+	.byte	0x3d
+	.byte	0x18
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xd
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x43
+	.byte	0x17
+	.long	0x75
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xd
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x3
+	.long	.LASF70
+	.byte	0x48
+	.byte	0x26
+	.long	0xef
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF72
+	.byte	0x2c
+	.byte	0x1b
+	.long	0xe8
+	.quad	.LFB510
+	.quad	.LFE510-.LFB510
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x6b8
+	.uleb128 0x6
+	.long	.LASF73
+	.byte	0x2c
+	.byte	0x45
+	.long	0x75
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.long	.LASF74
+	.byte	0x32
+	.byte	0x18
+	.long	0x7c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x33
+	.byte	0x1e
+	.long	0xef
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF76
+	.byte	0x1d
+	.byte	0x15
+	.long	0x75
+	.quad	.LFB509
+	.quad	.LFE509-.LFB509
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x712
+	.uleb128 0x6
+	.long	.LASF77
+	.byte	0x1d
+	.byte	0x3b
+	.long	0xe8
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF78
+	.byte	0x23
+	.byte	0x18
+	.long	0x7c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x3
+	.long	.LASF74
+	.byte	0x24
+	.byte	0x18
+	.long	0x7c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x3
+	.long	.LASF75
+	.byte	0x25
+	.byte	0x18
+	.long	0x7c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF79
+	.byte	0x2
+	.value	0x355
+	.byte	0x1
+	.byte	0x3
+	.long	0x72e
+	.uleb128 0x23
+	.string	"__I"
+	.byte	0x2
+	.value	0x355
+	.byte	0x1a
+	.long	0x75
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF82
+	.byte	0x2
+	.value	0x335
+	.byte	0x1
+	.long	0x75
+	.byte	0x3
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1d
+	.byte	0x1
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x58
+	.uleb128 0xb
+	.uleb128 0x59
+	.uleb128 0xb
+	.uleb128 0x57
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x20
+	.uleb128 0xb
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF44:
+	.string	"p999Ns"
+.LASF17:
+	.string	"tv_nsec"
+.LASF64:
+	.string	"parameters"
+.LASF22:
+	.string	"sched_priority"
+.LASF62:
+	.string	"cpus"
+.LASF28:
+	.string	"priority"
+.LASF16:
+	.string	"tv_sec"
+.LASF80:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF10:
+	.string	"short int"
+.LASF11:
+	.string	"size_t"
+.LASF53:
+	.string	"pthread_setaffinity_np"
+.LASF71:
+	.string	"lmsRealtime_Percentile"
+.LASF57:
+	.string	"stats"
+.LASF27:
+	.string	"blockSize"
+.LASF14:
+	.string	"__syscall_slong_t"
+.LASF75:
+	.string	"mantissa"
+.LASF79:
+	.string	"_mm_setcsr"
+.LASF77:
+	.string	"value"
+.LASF65:
+	.string	"lmsRealtime_Now"
+.LASF82:
+	.string	"_mm_getcsr"
+.LASF68:
+	.string	"rank"
+.LASF78:
+	.string	"exponent"
+.LASF9:
+	.string	"signed char"
+.LASF48:
+	.string	"float"
+.LASF15:
+	.string	"clockid_t"
+.LASF36:
+	.string	"settings"
+.LASF4:
+	.string	"long long int"
+.LASF47:
+	.string	"LmsRealtimeStats_t"
+.LASF29:
+	.string	"paced"
+.LASF3:
+	.string	"long int"
+.LASF74:
+	.string	"shift"
+.LASF73:
+	.string	"bucket"
+.LASF52:
+	.string	"printf"
+.LASF70:
+	.string	"bound"
+.LASF21:
+	.string	"sched_param"
+.LASF56:
+	.string	"lmsRealtime_GetStats"
+.LASF60:
+	.string	"elapsedNs"
+.LASF40:
+	.string	"LmsRealtime_t"
+.LASF59:
+	.string	"lmsRealtime_Record"
+.LASF72:
+	.string	"lmsRealtime_BucketUpperBound"
+.LASF32:
+	.string	"total"
+.LASF7:
+	.string	"unsigned char"
+.LASF55:
+	.string	"lmsRealtime_PrintStats"
+.LASF61:
+	.string	"lmsRealtime_ConfigureThread"
+.LASF18:
+	.string	"long long unsigned int"
+.LASF8:
+	.string	"unsigned int"
+.LASF49:
+	.string	"clock_gettime"
+.LASF2:
+	.string	"long unsigned int"
+.LASF31:
+	.string	"counts"
+.LASF81:
+	.string	"pthread_self"
+.LASF38:
+	.string	"deadlineMisses"
+.LASF67:
+	.string	"fraction"
+.LASF6:
+	.string	"char"
+.LASF35:
+	.string	"LmsLatencyHistogram_t"
+.LASF24:
+	.string	"__bits"
+.LASF5:
+	.string	"short unsigned int"
+.LASF45:
+	.string	"meanNs"
+.LASF26:
+	.string	"sampleRate"
+.LASF76:
+	.string	"lmsRealtime_Bucket"
+.LASF23:
+	.string	"__cpu_mask"
+.LASF43:
+	.string	"p99Ns"
+.LASF46:
+	.string	"double"
+.LASF58:
+	.string	"realtime"
+.LASF42:
+	.string	"p50Ns"
+.LASF37:
+	.string	"deadlineNs"
+.LASF39:
+	.string	"histogram"
+.LASF34:
+	.string	"maxNs"
+.LASF69:
+	.string	"count"
+.LASF13:
+	.string	"__clockid_t"
+.LASF12:
+	.string	"__time_t"
+.LASF30:
+	.string	"LmsRealtimeSettings_t"
+.LASF54:
+	.string	"memset"
+.LASF41:
+	.string	"blocks"
+.LASF33:
+	.string	"sumNs"
+.LASF20:
+	.string	"timespec"
+.LASF63:
+	.string	"__cpu"
+.LASF25:
+	.string	"cpu_set_t"
+.LASF51:
+	.string	"pthread_setschedparam"
+.LASF66:
+	.string	"lmsRealtime_Init"
+.LASF50:
+	.string	"mlockall"
+.LASF19:
+	.string	"pthread_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/lmsRealtime.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2702 @@
+	.file	"lmsTelemetry.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/lmsTelemetry.c"
+	.type	lmsTelemetry_Db, @function
+lmsTelemetry_Db:
+.LFB6:
+	.file 1 "source/lmsTelemetry.c"
+	.loc 1 22 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 23 19
+	movsd	xmm0, QWORD PTR -8[rbp]
+	comisd	xmm0, QWORD PTR .LC0[rip]
+	jbe	.L7
+	.loc 1 23 19 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	jmp	.L4
+.L7:
+	.loc 1 23 19 discriminator 2
+	mov	rax, QWORD PTR .LC0[rip]
+.L4:
+	.loc 1 23 19 discriminator 4
+	movq	xmm0, rax
+	call	log10@PLT
+	.loc 1 23 17 is_stmt 1 discriminator 4
+	movsd	xmm1, QWORD PTR .LC1[rip]
+	mulsd	xmm0, xmm1
+	movq	rax, xmm0
+	.loc 1 24 1 discriminator 4
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	lmsTelemetry_Db, .-lmsTelemetry_Db
+	.type	lmsTelemetry_Raise, @function
+lmsTelemetry_Raise:
+.LFB7:
+	.loc 1 31 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	DWORD PTR -28[rbp], esi
+	.loc 1 32 45
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	.loc 1 32 35
+	not	eax
+	.loc 1 32 15
+	and	eax, DWORD PTR -28[rbp]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 34 8
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L9
+	.loc 1 34 36 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	.loc 1 34 23 discriminator 1
+	test	eax, eax
+	jne	.L9
+	.loc 1 36 46
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 104[rax]
+	.loc 1 36 35
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 176[rax], rdx
+.L9:
+	.loc 1 38 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	.loc 1 38 25
+	or	eax, DWORD PTR -4[rbp]
+	mov	edx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 168[rax], edx
+	.loc 1 39 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 40 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	lmsTelemetry_Raise, .-lmsTelemetry_Raise
+	.globl	lmsTelemetry_DefaultSettings
+	.type	lmsTelemetry_DefaultSettings, @function
+lmsTelemetry_DefaultSettings:
+.LFB8:
+	.loc 1 43 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 44 27
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR [rax], 256
+	.loc 1 45 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 4[rax], 8192
+	.loc 1 46 33
+	mov	rax, QWORD PTR -8[rbp]
+	movss	xmm0, DWORD PTR .LC2[rip]
+	movss	DWORD PTR 8[rax], xmm0
+	.loc 1 47 32
+	mov	rax, QWORD PTR -8[rbp]
+	movss	xmm0, DWORD PTR .LC3[rip]
+	movss	DWORD PTR 12[rax], xmm0
+	.loc 1 48 32
+	mov	rax, QWORD PTR -8[rbp]
+	movss	xmm0, DWORD PTR .LC4[rip]
+	movss	DWORD PTR 16[rax], xmm0
+	.loc 1 49 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	lmsTelemetry_DefaultSettings, .-lmsTelemetry_DefaultSettings
+	.section	.rodata
+	.align 8
+.LC6:
+	.string	"ERROR: Telemetry needs 0 < short window < long window, positive margins and a negative level"
+	.text
+	.globl	lmsTelemetry_Init
+	.type	lmsTelemetry_Init, @function
+lmsTelemetry_Init:
+.LFB9:
+	.loc 1 52 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	DWORD PTR -20[rbp], edx
+	.loc 1 53 18
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 53 8
+	test	eax, eax
+	jle	.L13
+	.loc 1 53 49 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 53 73 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 53 37 discriminator 1
+	cmp	edx, eax
+	jle	.L13
+	.loc 1 54 22
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm0, DWORD PTR 8[rax]
+	.loc 1 54 42
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 54 12
+	xor	eax, 1
+	.loc 1 54 9
+	test	al, al
+	jne	.L13
+	.loc 1 54 60 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm0, DWORD PTR 16[rax]
+	.loc 1 54 79 discriminator 1
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 54 50 discriminator 1
+	xor	eax, 1
+	.loc 1 54 47 discriminator 1
+	test	al, al
+	jne	.L13
+	.loc 1 54 97 discriminator 2
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm1, DWORD PTR 12[rax]
+	.loc 1 54 116 discriminator 2
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 54 87 discriminator 2
+	xor	eax, 1
+	.loc 1 54 84 discriminator 2
+	test	al, al
+	je	.L14
+.L13:
+	.loc 1 56 9
+	lea	rax, .LC6[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 57 16
+	mov	eax, 1
+	jmp	.L15
+.L14:
+	.loc 1 60 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, 184
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 61 25
+	mov	rcx, QWORD PTR -8[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rsi]
+	mov	rdx, QWORD PTR 8[rsi]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+	mov	eax, DWORD PTR 16[rsi]
+	mov	DWORD PTR 16[rcx], eax
+	.loc 1 62 44
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 62 34
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, eax
+	movsd	xmm0, QWORD PTR .LC7[rip]
+	divsd	xmm0, xmm1
+	.loc 1 62 28
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	QWORD PTR 24[rax], xmm0
+	.loc 1 63 43
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 63 33
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, eax
+	movsd	xmm0, QWORD PTR .LC7[rip]
+	divsd	xmm0, xmm1
+	.loc 1 63 27
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	QWORD PTR 32[rax], xmm0
+	.loc 1 64 50
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm0, DWORD PTR 8[rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 64 32
+	movsd	xmm1, QWORD PTR .LC1[rip]
+	divsd	xmm0, xmm1
+	mov	rax, QWORD PTR .LC1[rip]
+	movapd	xmm1, xmm0
+	movq	xmm0, rax
+	call	pow@PLT
+	movq	rax, xmm0
+	.loc 1 64 30
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR 48[rdx], rax
+	.loc 1 65 46
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	xmm1, QWORD PTR 48[rax]
+	.loc 1 65 35
+	movsd	xmm0, QWORD PTR .LC7[rip]
+	divsd	xmm0, xmm1
+	.loc 1 65 29
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	QWORD PTR 40[rax], xmm0
+	.loc 1 66 51
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm0, DWORD PTR 12[rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 66 33
+	movsd	xmm1, QWORD PTR .LC1[rip]
+	divsd	xmm0, xmm1
+	mov	rax, QWORD PTR .LC1[rip]
+	movapd	xmm1, xmm0
+	movq	xmm0, rax
+	call	pow@PLT
+	movq	rax, xmm0
+	.loc 1 66 31
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR 56[rdx], rax
+	.loc 1 67 52
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm0, DWORD PTR 16[rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 67 34
+	movsd	xmm1, QWORD PTR .LC1[rip]
+	divsd	xmm0, xmm1
+	mov	rax, QWORD PTR .LC1[rip]
+	movapd	xmm1, xmm0
+	movq	xmm0, rax
+	call	pow@PLT
+	movq	rax, xmm0
+	.loc 1 67 32
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR 64[rdx], rax
+	.loc 1 68 26
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 112[rax], -1
+	.loc 1 69 28
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 120[rax], -1
+	.loc 1 70 31
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 176[rax], -1
+	.loc 1 73 79
+	mov	eax, DWORD PTR -20[rbp]
+	mov	edx, 4096
+	cmp	eax, edx
+	cmovge	edx, eax
+	.loc 1 73 29
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 128[rax], edx
+	.loc 1 74 41
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	movsx	rdx, eax
+	.loc 1 74 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 136[rax], rdx
+	.loc 1 76 12
+	mov	eax, 0
+.L15:
+	.loc 1 77 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	lmsTelemetry_Init, .-lmsTelemetry_Init
+	.globl	lmsTelemetry_Update
+	.type	lmsTelemetry_Update, @function
+lmsTelemetry_Update:
+.LFB10:
+	.loc 1 80 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	add	rsp, -128
+	mov	QWORD PTR -104[rbp], rdi
+	mov	QWORD PTR -112[rbp], rsi
+	mov	QWORD PTR -120[rbp], rdx
+	mov	DWORD PTR -124[rbp], ecx
+	.loc 1 81 49
+	mov	rax, QWORD PTR -104[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 81 16
+	cdqe
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 82 48
+	mov	rax, QWORD PTR -104[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 82 16
+	cdqe
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 83 12
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 72[rax]
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 84 12
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 80[rax]
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 85 12
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 88[rax]
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 86 12
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 96[rax]
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 87 9
+	mov	DWORD PTR -36[rbp], 0
+.LBB2:
+	.loc 1 89 14
+	mov	DWORD PTR -40[rbp], 0
+	.loc 1 89 5
+	jmp	.L17
+.L36:
+.LBB3:
+	.loc 1 91 40
+	mov	eax, DWORD PTR -40[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -120[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 91 27
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 91 51
+	mov	eax, DWORD PTR -40[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -120[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 91 22
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 92 42
+	mov	eax, DWORD PTR -40[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 92 27
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 92 55
+	mov	eax, DWORD PTR -40[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 92 22
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -72[rbp], xmm0
+	.loc 1 93 35
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 93 24
+	lea	rdx, 1[rax]
+	.loc 1 93 20
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 104[rax], rdx
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	mov	QWORD PTR -80[rbp], rax
+	.loc 1 95 13
+	movsd	xmm0, QWORD PTR -64[rbp]
+	movq	xmm1, QWORD PTR .LC8[rip]
+	andpd	xmm1, xmm0
+	movsd	xmm0, QWORD PTR .LC9[rip]
+	ucomisd	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 95 12
+	test	eax, eax
+	jne	.L18
+	.loc 1 97 25
+	mov	rax, QWORD PTR -104[rbp]
+	mov	esi, 4
+	mov	rdi, rax
+	call	lmsTelemetry_Raise
+	.loc 1 97 22
+	or	DWORD PTR -36[rbp], eax
+	.loc 1 98 13
+	jmp	.L19
+.L18:
+	.loc 1 102 64
+	mov	rax, QWORD PTR -80[rbp]
+	cmp	rax, QWORD PTR -48[rbp]
+	jge	.L20
+	.loc 1 102 60 discriminator 1
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, QWORD PTR -80[rbp]
+	.loc 1 102 64 discriminator 1
+	movsd	xmm0, QWORD PTR .LC7[rip]
+	divsd	xmm0, xmm1
+	jmp	.L21
+.L20:
+	.loc 1 102 64 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 24[rax]
+.L21:
+	.loc 1 102 22 is_stmt 1 discriminator 4
+	movsd	QWORD PTR -88[rbp], xmm0
+	.loc 1 103 62 discriminator 4
+	mov	rax, QWORD PTR -80[rbp]
+	cmp	rax, QWORD PTR -56[rbp]
+	jge	.L22
+	.loc 1 103 58 discriminator 1
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, QWORD PTR -80[rbp]
+	.loc 1 103 62 discriminator 1
+	movsd	xmm0, QWORD PTR .LC7[rip]
+	divsd	xmm0, xmm1
+	jmp	.L23
+.L22:
+	.loc 1 103 62 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 32[rax]
+.L23:
+	.loc 1 103 22 is_stmt 1 discriminator 4
+	movsd	QWORD PTR -96[rbp], xmm0
+	.loc 1 104 39 discriminator 4
+	movsd	xmm0, QWORD PTR -64[rbp]
+	subsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 104 33 discriminator 4
+	mulsd	xmm0, QWORD PTR -88[rbp]
+	.loc 1 104 18 discriminator 4
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 105 37 discriminator 4
+	movsd	xmm0, QWORD PTR -64[rbp]
+	subsd	xmm0, QWORD PTR -16[rbp]
+	.loc 1 105 31 discriminator 4
+	mulsd	xmm0, QWORD PTR -96[rbp]
+	.loc 1 105 17 discriminator 4
+	movsd	xmm1, QWORD PTR -16[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 106 42 discriminator 4
+	movsd	xmm0, QWORD PTR -72[rbp]
+	subsd	xmm0, QWORD PTR -24[rbp]
+	.loc 1 106 36 discriminator 4
+	mulsd	xmm0, QWORD PTR -96[rbp]
+	.loc 1 106 22 discriminator 4
+	movsd	xmm1, QWORD PTR -24[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 107 48 discriminator 4
+	movsd	xmm0, QWORD PTR -72[rbp]
+	subsd	xmm0, QWORD PTR -32[rbp]
+	.loc 1 107 42 discriminator 4
+	mulsd	xmm0, QWORD PTR -88[rbp]
+	.loc 1 107 27 discriminator 4
+	movsd	xmm1, QWORD PTR -32[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 112 12 discriminator 4
+	mov	rax, QWORD PTR -80[rbp]
+	cmp	rax, QWORD PTR -48[rbp]
+	jl	.L24
+	.loc 1 112 77 discriminator 1
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 64[rax]
+	.loc 1 112 66 discriminator 1
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -32[rbp]
+	.loc 1 112 32 discriminator 1
+	movsd	xmm0, QWORD PTR -8[rbp]
+	comisd	xmm0, xmm1
+	ja	.L25
+	.loc 1 113 70
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 64[rax]
+	.loc 1 113 59
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -16[rbp]
+	.loc 1 113 36
+	movsd	xmm0, QWORD PTR -8[rbp]
+	comisd	xmm0, xmm1
+	jbe	.L24
+.L25:
+	.loc 1 115 25
+	mov	rax, QWORD PTR -104[rbp]
+	mov	esi, 1
+	mov	rdi, rax
+	call	lmsTelemetry_Raise
+	.loc 1 115 22
+	or	DWORD PTR -36[rbp], eax
+.L24:
+	.loc 1 117 12
+	mov	rax, QWORD PTR -80[rbp]
+	cmp	rax, QWORD PTR -56[rbp]
+	jl	.L40
+	.loc 1 124 46
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 40[rax]
+	.loc 1 124 35
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -16[rbp]
+	.loc 1 124 12
+	movsd	xmm0, QWORD PTR -8[rbp]
+	comisd	xmm0, xmm1
+	jb	.L29
+	.loc 1 124 97 discriminator 1
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 48[rax]
+	.loc 1 124 86 discriminator 1
+	mulsd	xmm0, QWORD PTR -16[rbp]
+	.loc 1 124 62 discriminator 1
+	comisd	xmm0, QWORD PTR -8[rbp]
+	jnb	.L31
+.L29:
+	.loc 1 125 58
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR 56[rax]
+	.loc 1 125 47
+	mulsd	xmm0, QWORD PTR -32[rbp]
+	.loc 1 125 13
+	comisd	xmm0, QWORD PTR -8[rbp]
+	jb	.L39
+.L31:
+	.loc 1 127 26
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	.loc 1 127 16
+	test	rax, rax
+	jns	.L34
+	.loc 1 129 38
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdx, QWORD PTR -80[rbp]
+	mov	QWORD PTR 112[rax], rdx
+	.loc 1 127 16
+	jmp	.L41
+.L34:
+	.loc 1 131 32
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 120[rax]
+	.loc 1 131 21
+	test	rax, rax
+	jns	.L41
+	.loc 1 131 68 discriminator 1
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	.loc 1 131 57 discriminator 1
+	mov	rdx, QWORD PTR -80[rbp]
+	sub	rdx, rax
+	.loc 1 131 51 discriminator 1
+	cmp	QWORD PTR -56[rbp], rdx
+	jg	.L41
+	.loc 1 133 51
+	mov	rax, QWORD PTR -104[rbp]
+	mov	rdx, QWORD PTR 112[rax]
+	.loc 1 133 40
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 120[rax], rdx
+	.loc 1 127 16
+	jmp	.L41
+.L39:
+	.loc 1 138 34
+	mov	rax, QWORD PTR -104[rbp]
+	mov	QWORD PTR 112[rax], -1
+	jmp	.L28
+.L40:
+	.loc 1 119 13
+	nop
+	jmp	.L28
+.L41:
+	.loc 1 127 16
+	nop
+.L28:
+.LBE3:
+	.loc 1 89 33 discriminator 2
+	add	DWORD PTR -40[rbp], 1
+.L17:
+	.loc 1 89 23 discriminator 1
+	mov	eax, DWORD PTR -40[rbp]
+	cmp	eax, DWORD PTR -124[rbp]
+	jl	.L36
+.L19:
+.LBE2:
+	.loc 1 142 25
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movsd	QWORD PTR 72[rax], xmm0
+	.loc 1 143 24
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR -16[rbp]
+	movsd	QWORD PTR 80[rax], xmm0
+	.loc 1 144 29
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR -24[rbp]
+	movsd	QWORD PTR 88[rax], xmm0
+	.loc 1 145 34
+	mov	rax, QWORD PTR -104[rbp]
+	movsd	xmm0, QWORD PTR -32[rbp]
+	movsd	QWORD PTR 96[rax], xmm0
+	.loc 1 147 12
+	mov	eax, DWORD PTR -36[rbp]
+	.loc 1 148 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	lmsTelemetry_Update, .-lmsTelemetry_Update
+	.globl	lmsTelemetry_NormDue
+	.type	lmsTelemetry_NormDue, @function
+lmsTelemetry_NormDue:
+.LFB11:
+	.loc 1 151 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 152 21
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 104[rax]
+	.loc 1 152 43
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 152 31
+	cmp	rdx, rax
+	setge	al
+	movzx	eax, al
+	.loc 1 153 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	lmsTelemetry_NormDue, .-lmsTelemetry_NormDue
+	.globl	lmsTelemetry_UpdateNorm
+	.type	lmsTelemetry_UpdateNorm, @function
+lmsTelemetry_UpdateNorm:
+.LFB12:
+	.loc 1 156 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 157 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 159 41
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 104[rax]
+	.loc 1 159 62
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	cdqe
+	.loc 1 159 51
+	add	rdx, rax
+	.loc 1 159 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 136[rax], rdx
+	.loc 1 160 9
+	movsd	xmm0, QWORD PTR -32[rbp]
+	movq	xmm1, QWORD PTR .LC8[rip]
+	andpd	xmm1, xmm0
+	movsd	xmm0, QWORD PTR .LC9[rip]
+	ucomisd	xmm0, xmm1
+	setb	al
+	xor	eax, 1
+	movzx	eax, al
+	.loc 1 160 8
+	test	eax, eax
+	jne	.L45
+	.loc 1 162 16
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, 4
+	mov	rdi, rax
+	call	lmsTelemetry_Raise
+	jmp	.L46
+.L45:
+	.loc 1 165 23
+	mov	rax, QWORD PTR -32[rbp]
+	movq	xmm0, rax
+	call	sqrt@PLT
+	movq	rax, xmm0
+	.loc 1 165 21
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	QWORD PTR 144[rdx], rax
+	.loc 1 166 18
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 144[rax]
+	.loc 1 166 36
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm1, QWORD PTR 160[rax]
+	.loc 1 166 8
+	comisd	xmm0, xmm1
+	jbe	.L47
+	.loc 1 168 40
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 144[rax]
+	.loc 1 168 29
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	QWORD PTR 160[rax], xmm0
+.L47:
+	.loc 1 170 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 120[rax]
+	.loc 1 170 8
+	test	rax, rax
+	js	.L49
+	.loc 1 170 52 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 152[rax]
+	.loc 1 170 39 discriminator 1
+	pxor	xmm1, xmm1
+	ucomisd	xmm0, xmm1
+	jp	.L49
+	pxor	xmm1, xmm1
+	ucomisd	xmm0, xmm1
+	jne	.L49
+	.loc 1 172 45
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 144[rax]
+	.loc 1 172 34
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	QWORD PTR 152[rax], xmm0
+.L49:
+	.loc 1 175 19
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 152[rax]
+	.loc 1 175 8
+	pxor	xmm1, xmm1
+	comisd	xmm0, xmm1
+	jbe	.L51
+	.loc 1 176 22
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm1, QWORD PTR 144[rax]
+	.loc 1 176 40
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 144[rax]
+	.loc 1 176 29
+	mulsd	xmm0, xmm1
+	.loc 1 176 58
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm2, QWORD PTR 152[rax]
+	.loc 1 176 85
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm1, QWORD PTR 152[rax]
+	.loc 1 176 74
+	mulsd	xmm2, xmm1
+	.loc 1 176 112
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm1, QWORD PTR 64[rax]
+	.loc 1 176 101
+	mulsd	xmm1, xmm2
+	.loc 1 176 9
+	comisd	xmm0, xmm1
+	jbe	.L51
+	.loc 1 178 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, 2
+	mov	rdi, rax
+	call	lmsTelemetry_Raise
+	mov	DWORD PTR -4[rbp], eax
+.L51:
+	.loc 1 180 12
+	mov	eax, DWORD PTR -4[rbp]
+.L46:
+	.loc 1 181 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	lmsTelemetry_UpdateNorm, .-lmsTelemetry_UpdateNorm
+	.section	.rodata
+	.align 8
+.LC11:
+	.string	"error rising above the desired signal or its long-term level"
+	.align 8
+.LC12:
+	.string	"coefficient norm drifting since convergence"
+	.align 8
+.LC13:
+	.string	"non-finite error or coefficients"
+.LC14:
+	.string	"unknown"
+	.text
+	.globl	lmsTelemetry_WarningName
+	.type	lmsTelemetry_WarningName, @function
+lmsTelemetry_WarningName:
+.LFB13:
+	.loc 1 184 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -4[rbp], edi
+	.loc 1 185 5
+	cmp	DWORD PTR -4[rbp], 4
+	je	.L59
+	cmp	DWORD PTR -4[rbp], 4
+	jg	.L60
+	cmp	DWORD PTR -4[rbp], 1
+	je	.L61
+	cmp	DWORD PTR -4[rbp], 2
+	je	.L62
+	jmp	.L60
+.L61:
+	.loc 1 188 20
+	lea	rax, .LC11[rip]
+	jmp	.L63
+.L62:
+	.loc 1 191 20
+	lea	rax, .LC12[rip]
+	jmp	.L63
+.L59:
+	.loc 1 194 20
+	lea	rax, .LC13[rip]
+	jmp	.L63
+.L60:
+	.loc 1 197 20
+	lea	rax, .LC14[rip]
+.L63:
+	.loc 1 199 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	lmsTelemetry_WarningName, .-lmsTelemetry_WarningName
+	.globl	lmsTelemetry_GetStats
+	.type	lmsTelemetry_GetStats, @function
+lmsTelemetry_GetStats:
+.LFB14:
+	.loc 1 202 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	.loc 1 203 31
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 104[rax]
+	.loc 1 203 20
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 204 50
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 204 25
+	movq	xmm0, rax
+	call	lmsTelemetry_Db
+	movq	rax, xmm0
+	.loc 1 204 23
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 8[rdx], rax
+	.loc 1 205 49
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 205 24
+	movq	xmm0, rax
+	call	lmsTelemetry_Db
+	movq	rax, xmm0
+	.loc 1 205 22
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 16[rdx], rax
+	.loc 1 206 33
+	mov	rax, QWORD PTR -16[rbp]
+	movsd	xmm2, QWORD PTR 16[rax]
+	movsd	QWORD PTR -24[rbp], xmm2
+	.loc 1 206 72
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 206 47
+	movq	xmm0, rax
+	call	lmsTelemetry_Db
+	movapd	xmm1, xmm0
+	.loc 1 206 45
+	movsd	xmm0, QWORD PTR -24[rbp]
+	subsd	xmm0, xmm1
+	.loc 1 206 26
+	mov	rax, QWORD PTR -16[rbp]
+	movsd	QWORD PTR 24[rax], xmm0
+	.loc 1 207 35
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 120[rax]
+	.loc 1 207 24
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 32[rax], rdx
+	.loc 1 208 28
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR 144[rax]
+	.loc 1 208 17
+	mov	rax, QWORD PTR -16[rbp]
+	movsd	QWORD PTR 40[rax], xmm0
+	.loc 1 209 36
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR 152[rax]
+	.loc 1 210 117
+	pxor	xmm1, xmm1
+	comisd	xmm0, xmm1
+	jbe	.L73
+	.loc 1 210 49 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR 144[rax]
+	.loc 1 210 33 discriminator 1
+	pxor	xmm1, xmm1
+	comisd	xmm0, xmm1
+	jbe	.L74
+	.loc 1 210 74 discriminator 3
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR 144[rax]
+	.loc 1 210 92 discriminator 3
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	xmm1, QWORD PTR 152[rax]
+	.loc 1 210 33 discriminator 3
+	divsd	xmm0, xmm1
+	movq	rax, xmm0
+	jmp	.L69
+.L74:
+	.loc 1 210 33 is_stmt 0 discriminator 4
+	mov	rax, QWORD PTR .LC15[rip]
+.L69:
+	.loc 1 210 33 discriminator 6
+	movq	xmm0, rax
+	call	log10@PLT
+	.loc 1 210 117 is_stmt 1 discriminator 6
+	movsd	xmm1, QWORD PTR .LC16[rip]
+	mulsd	xmm0, xmm1
+	jmp	.L70
+.L73:
+	.loc 1 210 117 is_stmt 0 discriminator 2
+	pxor	xmm0, xmm0
+.L70:
+	.loc 1 209 24 is_stmt 1
+	mov	rax, QWORD PTR -16[rbp]
+	movsd	QWORD PTR 48[rax], xmm0
+	.loc 1 211 32
+	mov	rax, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR 160[rax]
+	.loc 1 211 21
+	mov	rax, QWORD PTR -16[rbp]
+	movsd	QWORD PTR 56[rax], xmm0
+	.loc 1 212 32
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 168[rax]
+	.loc 1 212 21
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 64[rax], edx
+	.loc 1 213 38
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 176[rax]
+	.loc 1 213 27
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	.loc 1 214 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	lmsTelemetry_GetStats, .-lmsTelemetry_GetStats
+	.section	.rodata
+	.align 8
+.LC17:
+	.string	"Telemetry of:                 %s\n"
+	.align 8
+.LC18:
+	.string	"MSE short / long window:      %.2f / %.2f dB\n"
+	.align 8
+.LC19:
+	.string	"MSE relative to desired:      %.2f dB\n"
+	.align 8
+.LC20:
+	.string	"Converged at sample:          %ld\n"
+	.align 8
+.LC21:
+	.string	"Converged at sample:          not converged in %ld samples\n"
+	.align 8
+.LC22:
+	.string	"Coefficient norm:             %.6g (peak %.6g)\n"
+	.align 8
+.LC23:
+	.string	"Norm drift since convergence: %+.2f dB\n"
+	.align 8
+.LC24:
+	.string	"Warnings:                     none"
+	.align 8
+.LC25:
+	.string	"Warnings:                     first at sample %ld\n"
+	.align 8
+.LC26:
+	.string	"                              %s\n"
+	.text
+	.globl	lmsTelemetry_PrintStats
+	.type	lmsTelemetry_PrintStats, @function
+lmsTelemetry_PrintStats:
+.LFB15:
+	.loc 1 217 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 218 5
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rsi, rax
+	lea	rax, .LC17[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 219 86
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 16[rax]
+	.loc 1 219 67
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 219 5
+	movapd	xmm1, xmm0
+	movq	xmm0, rax
+	lea	rax, .LC18[rip]
+	mov	rdi, rax
+	mov	eax, 2
+	call	printf@PLT
+	.loc 1 220 60
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 220 5
+	movq	xmm0, rax
+	lea	rax, .LC19[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 221 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 221 8
+	test	rax, rax
+	js	.L76
+	.loc 1 223 60
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 223 9
+	mov	rsi, rax
+	lea	rax, .LC20[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L77
+.L76:
+	.loc 1 227 85
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 227 9
+	mov	rsi, rax
+	lea	rax, .LC21[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L77:
+	.loc 1 229 82
+	mov	rax, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR 56[rax]
+	.loc 1 229 69
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 229 5
+	movapd	xmm1, xmm0
+	movq	xmm0, rax
+	lea	rax, .LC22[rip]
+	mov	rdi, rax
+	mov	eax, 2
+	call	printf@PLT
+	.loc 1 230 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 230 8
+	test	rax, rax
+	js	.L78
+	.loc 1 232 65
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 232 9
+	movq	xmm0, rax
+	lea	rax, .LC23[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+.L78:
+	.loc 1 234 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 234 8
+	test	eax, eax
+	jne	.L79
+	.loc 1 236 9
+	lea	rax, .LC24[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 249 1
+	jmp	.L84
+.L79:
+	.loc 1 240 76
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 240 9
+	mov	rsi, rax
+	lea	rax, .LC25[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.LBB4:
+	.loc 1 241 18
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 241 9
+	jmp	.L81
+.L83:
+	.loc 1 243 22
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 243 33
+	and	eax, DWORD PTR -4[rbp]
+	.loc 1 243 16
+	test	eax, eax
+	je	.L82
+	.loc 1 245 17
+	mov	eax, DWORD PTR -4[rbp]
+	mov	edi, eax
+	call	lmsTelemetry_WarningName
+	mov	rsi, rax
+	lea	rax, .LC26[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L82:
+	.loc 1 241 117 discriminator 2
+	sal	DWORD PTR -4[rbp]
+.L81:
+	.loc 1 241 72 discriminator 1
+	cmp	DWORD PTR -4[rbp], 4
+	jle	.L83
+.L84:
+.LBE4:
+	.loc 1 249 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	lmsTelemetry_PrintStats, .-lmsTelemetry_PrintStats
+	.section	.rodata
+	.align 8
+.LC0:
+	.long	-18103648
+	.long	968116299
+	.align 8
+.LC1:
+	.long	0
+	.long	1076101120
+	.align 4
+.LC2:
+	.long	1069547520
+	.align 4
+.LC3:
+	.long	-1038090240
+	.align 4
+.LC4:
+	.long	1101004800
+	.align 8
+.LC7:
+	.long	0
+	.long	1072693248
+	.align 16
+.LC8:
+	.long	-1
+	.long	2147483647
+	.long	0
+	.long	0
+	.align 8
+.LC9:
+	.long	-1
+	.long	2146435071
+	.align 8
+.LC15:
+	.long	-1629006314
+	.long	1020396463
+	.align 8
+.LC16:
+	.long	0
+	.long	1077149696
+	.text
+.Letext0:
+	.file 2 "include/lmsTelemetry.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/stdio.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 6 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x6b5
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x10
+	.long	.LASF71
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x8
+	.long	.LASF19
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x5
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x12
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x5
+	.long	0x85
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x6
+	.long	0x8c
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x5
+	.long	0x9d
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0xa
+	.byte	0x14
+	.byte	0x19
+	.long	0xf9
+	.uleb128 0x1
+	.long	.LASF14
+	.byte	0x1b
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF15
+	.byte	0x1c
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF16
+	.byte	0x1d
+	.byte	0xb
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF17
+	.byte	0x1e
+	.byte	0xb
+	.long	0x9d
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x1f
+	.byte	0xb
+	.long	0x9d
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF20
+	.byte	0x2
+	.byte	0x20
+	.byte	0x3
+	.long	0xb5
+	.uleb128 0x5
+	.long	0xf9
+	.uleb128 0xa
+	.byte	0xb8
+	.byte	0x22
+	.long	0x20e
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x24
+	.byte	0x1c
+	.long	0xf9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF22
+	.byte	0x25
+	.byte	0xc
+	.long	0xa9
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x26
+	.byte	0xc
+	.long	0xa9
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x27
+	.byte	0xc
+	.long	0xa9
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x28
+	.byte	0xc
+	.long	0xa9
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x29
+	.byte	0xc
+	.long	0xa9
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x2a
+	.byte	0xc
+	.long	0xa9
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x2b
+	.byte	0xc
+	.long	0xa9
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x2c
+	.byte	0xc
+	.long	0xa9
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x2d
+	.byte	0xc
+	.long	0xa9
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x2e
+	.byte	0xc
+	.long	0xa9
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x2f
+	.byte	0xa
+	.long	0x4d
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x30
+	.byte	0xa
+	.long	0x4d
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x31
+	.byte	0xa
+	.long	0x4d
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x32
+	.byte	0x9
+	.long	0x41
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x33
+	.byte	0xa
+	.long	0x4d
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x34
+	.byte	0xc
+	.long	0xa9
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x35
+	.byte	0xc
+	.long	0xa9
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x36
+	.byte	0xc
+	.long	0xa9
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x37
+	.byte	0x9
+	.long	0x41
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x38
+	.byte	0xa
+	.long	0x4d
+	.byte	0xb0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF42
+	.byte	0x2
+	.byte	0x39
+	.byte	0x3
+	.long	0x10a
+	.uleb128 0x5
+	.long	0x20e
+	.uleb128 0xa
+	.byte	0x50
+	.byte	0x3b
+	.long	0x29f
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x3d
+	.byte	0xa
+	.long	0x4d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x3e
+	.byte	0xc
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x3f
+	.byte	0xc
+	.long	0xa9
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x40
+	.byte	0xc
+	.long	0xa9
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x41
+	.byte	0xa
+	.long	0x4d
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x42
+	.byte	0xc
+	.long	0xa9
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x43
+	.byte	0xc
+	.long	0xa9
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x44
+	.byte	0xc
+	.long	0xa9
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x45
+	.byte	0x9
+	.long	0x41
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x46
+	.byte	0xa
+	.long	0x4d
+	.byte	0x48
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF47
+	.byte	0x2
+	.byte	0x47
+	.byte	0x3
+	.long	0x21f
+	.uleb128 0x5
+	.long	0x29f
+	.uleb128 0x13
+	.long	.LASF48
+	.byte	0x4
+	.value	0x164
+	.byte	0xc
+	.long	0x41
+	.long	0x2c8
+	.uleb128 0x7
+	.long	0x98
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF49
+	.byte	0x5
+	.byte	0x8f
+	.byte	0x1
+	.long	0xa9
+	.long	0x2de
+	.uleb128 0x7
+	.long	0xa9
+	.byte	0
+	.uleb128 0x15
+	.string	"pow"
+	.byte	0x5
+	.byte	0x8c
+	.byte	0x1
+	.long	0xa9
+	.long	0x2f9
+	.uleb128 0x7
+	.long	0xa9
+	.uleb128 0x7
+	.long	0xa9
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF50
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x319
+	.uleb128 0x7
+	.long	0x83
+	.uleb128 0x7
+	.long	0x41
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF51
+	.byte	0x5
+	.byte	0x6b
+	.byte	0x1
+	.long	0xa9
+	.long	0x32f
+	.uleb128 0x7
+	.long	0xa9
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF54
+	.byte	0xd8
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x388
+	.uleb128 0x2
+	.long	.LASF52
+	.byte	0xd8
+	.byte	0x39
+	.long	0x388
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF53
+	.byte	0xd8
+	.byte	0x4c
+	.long	0x98
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xc
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x4
+	.long	.LASF57
+	.byte	0xf1
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2ab
+	.uleb128 0xe
+	.long	.LASF55
+	.byte	0xc9
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x3c6
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0xc9
+	.byte	0x32
+	.long	0x3c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x2
+	.long	.LASF52
+	.byte	0xc9
+	.byte	0x52
+	.long	0x3cb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x6
+	.long	0x21a
+	.uleb128 0x6
+	.long	0x29f
+	.uleb128 0xf
+	.long	.LASF58
+	.byte	0xb7
+	.byte	0xd
+	.long	0x98
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x400
+	.uleb128 0x2
+	.long	.LASF57
+	.byte	0xb7
+	.byte	0x2a
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF59
+	.byte	0x9b
+	.long	0x41
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x44b
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0x9b
+	.byte	0x2d
+	.long	0x44b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF60
+	.byte	0x9b
+	.byte	0x3f
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x9d
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x6
+	.long	0x20e
+	.uleb128 0xf
+	.long	.LASF61
+	.byte	0x96
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x480
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0x96
+	.byte	0x30
+	.long	0x3c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF62
+	.byte	0x4f
+	.long	0x41
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5b7
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0x4f
+	.byte	0x29
+	.long	0x44b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x2
+	.long	.LASF63
+	.byte	0x4f
+	.byte	0x41
+	.long	0x5b7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x2
+	.long	.LASF64
+	.byte	0x4f
+	.byte	0x57
+	.long	0x5b7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x2
+	.long	.LASF65
+	.byte	0x4f
+	.byte	0x62
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -140
+	.uleb128 0x4
+	.long	.LASF14
+	.byte	0x51
+	.byte	0x10
+	.long	0x54
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF15
+	.byte	0x52
+	.byte	0x10
+	.long	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF28
+	.byte	0x53
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF29
+	.byte	0x54
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF30
+	.byte	0x55
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF31
+	.byte	0x56
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF40
+	.byte	0x57
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0xc
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x59
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xc
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x9
+	.string	"e2"
+	.byte	0x5b
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x9
+	.string	"d2"
+	.byte	0x5c
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x9
+	.string	"n"
+	.byte	0x5d
+	.byte	0x14
+	.long	0x54
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x66
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x67
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xa4
+	.uleb128 0xd
+	.long	.LASF66
+	.byte	0x33
+	.long	0x41
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x607
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0x33
+	.byte	0x27
+	.long	0x44b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x2
+	.long	.LASF21
+	.byte	0x33
+	.byte	0x50
+	.long	0x607
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2
+	.long	.LASF67
+	.byte	0x33
+	.byte	0x5e
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0x6
+	.long	0x105
+	.uleb128 0x16
+	.long	.LASF68
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x6
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x639
+	.uleb128 0x2
+	.long	.LASF21
+	.byte	0x2a
+	.byte	0x3b
+	.long	0x639
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x6
+	.long	0xf9
+	.uleb128 0x17
+	.long	.LASF72
+	.byte	0x1
+	.byte	0x1e
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x68b
+	.uleb128 0x2
+	.long	.LASF56
+	.byte	0x1e
+	.byte	0x2f
+	.long	0x44b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF40
+	.byte	0x1e
+	.byte	0x3e
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x4
+	.long	.LASF69
+	.byte	0x20
+	.byte	0xf
+	.long	0x48
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF73
+	.byte	0x1
+	.byte	0x15
+	.byte	0xf
+	.long	0xa9
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF70
+	.byte	0x15
+	.byte	0x26
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF48:
+	.string	"printf"
+.LASF65:
+	.string	"count"
+.LASF17:
+	.string	"convergenceLevel"
+.LASF19:
+	.string	"size_t"
+.LASF24:
+	.string	"convergedLow"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF58:
+	.string	"lmsTelemetry_WarningName"
+.LASF36:
+	.string	"nextNormCheck"
+.LASF16:
+	.string	"convergenceMargin"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF61:
+	.string	"lmsTelemetry_NormDue"
+.LASF35:
+	.string	"normInterval"
+.LASF3:
+	.string	"long int"
+.LASF52:
+	.string	"stats"
+.LASF20:
+	.string	"LmsTelemetrySettings_t"
+.LASF13:
+	.string	"double"
+.LASF44:
+	.string	"longMseDb"
+.LASF28:
+	.string	"shortMse"
+.LASF34:
+	.string	"convergedAt"
+.LASF42:
+	.string	"LmsTelemetry_t"
+.LASF40:
+	.string	"warnings"
+.LASF45:
+	.string	"relativeMseDb"
+.LASF62:
+	.string	"lmsTelemetry_Update"
+.LASF47:
+	.string	"LmsTelemetryStats_t"
+.LASF30:
+	.string	"desiredPower"
+.LASF7:
+	.string	"unsigned int"
+.LASF51:
+	.string	"log10"
+.LASF2:
+	.string	"long unsigned int"
+.LASF53:
+	.string	"name"
+.LASF6:
+	.string	"short unsigned int"
+.LASF18:
+	.string	"divergenceMargin"
+.LASF26:
+	.string	"convergedLevel"
+.LASF33:
+	.string	"holdStart"
+.LASF46:
+	.string	"normDriftDb"
+.LASF22:
+	.string	"shortWeight"
+.LASF32:
+	.string	"samples"
+.LASF49:
+	.string	"sqrt"
+.LASF37:
+	.string	"norm"
+.LASF23:
+	.string	"longWeight"
+.LASF31:
+	.string	"shortDesiredPower"
+.LASF21:
+	.string	"settings"
+.LASF59:
+	.string	"lmsTelemetry_UpdateNorm"
+.LASF73:
+	.string	"lmsTelemetry_Db"
+.LASF12:
+	.string	"float"
+.LASF64:
+	.string	"error"
+.LASF38:
+	.string	"convergedNorm"
+.LASF57:
+	.string	"warning"
+.LASF56:
+	.string	"telemetry"
+.LASF5:
+	.string	"unsigned char"
+.LASF9:
+	.string	"short int"
+.LASF41:
+	.string	"firstWarningAt"
+.LASF63:
+	.string	"desired"
+.LASF72:
+	.string	"lmsTelemetry_Raise"
+.LASF67:
+	.string	"length"
+.LASF10:
+	.string	"char"
+.LASF71:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF66:
+	.string	"lmsTelemetry_Init"
+.LASF70:
+	.string	"power"
+.LASF29:
+	.string	"longMse"
+.LASF60:
+	.string	"normSquared"
+.LASF55:
+	.string	"lmsTelemetry_GetStats"
+.LASF50:
+	.string	"memset"
+.LASF25:
+	.string	"convergedHigh"
+.LASF43:
+	.string	"shortMseDb"
+.LASF14:
+	.string	"shortWindow"
+.LASF39:
+	.string	"peakNorm"
+.LASF27:
+	.string	"divergenceRatio"
+.LASF15:
+	.string	"longWindow"
+.LASF54:
+	.string	"lmsTelemetry_PrintStats"
+.LASF69:
+	.string	"raised"
+.LASF68:
+	.string	"lmsTelemetry_DefaultSettings"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/lmsTelemetry.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10500 @@
+	.file	"main.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/main.c"
+	.section	.rodata
+.LC0:
+	.string	"Options:\n"
+	.align 8
+.LC1:
+	.string	"  --help                                               Display this information.\n"
+	.align 8
+.LC2:
+	.string	"  --version                                            Display version information.\n"
+	.align 8
+.LC3:
+	.string	"  --generate <type> <resolution> <cycles> <file>       Generate samples for the selected waveform and number of cycles and save them to a file. Types: sine, square, sawtooth, chirp, white, pink, sine-noise\n"
+	.align 8
+.LC4:
+	.string	"      [--amplitude <a>]                                Peak of periodic waveforms, noise RMS is <a> / 4. Default 1\n"
+	.align 8
+.LC5:
+	.string	"      [--snr <db>]                                     Sine to noise ratio of sine-noise. Default 20\n"
+	.align 8
+.LC6:
+	.string	"      [--end-resolution <n>]                           Samples per cycle at the end of a chirp, which starts at <resolution>. Default 4\n"
+	.align 8
+.LC7:
+	.string	"      [--seed <n>]                                     Seed of noise, the same seed gives the same noise. Default 1\n"
+	.align 8
+.LC8:
+	.string	"      [--threads <n>]                                  Threads generating binary files, the output does not depend on it. Default number of CPUs\n"
+	.align 8
+.LC9:
+	.string	"      [--format <format>]                              Output sample format: text, f32, s16, wav, wavf32. Default from file extension (.f32, .s16, .wav), otherwise text\n"
+	.align 8
+.LC10:
+	.string	"      [--io <io>]                                      File I/O: auto (io_uring, a pread/pwrite thread when not available), uring, thread or stdio (blocking, on the calling thread). Default auto\n"
+	.align 8
+.LC11:
+	.ascii	"  --filter <length> <stepsize> <file>                  Filte"
+	.ascii	"r the signal "
+	.string	"in the form of samples read from the file. The parameters of the LMS filter are filter length(order) and step size. Use - for <file> to read standard input. A glob pattern (quoted) or @<listfile> with one file per line filters a batch of files in parallel\n"
+	.align 8
+.LC12:
+	.ascii	"      [--algo <algo>]                                  Filte"
+	.ascii	"ring algorithm: lms (time domain), fdaf (frequency-domain bl"
+	.ascii	"ock LMS, for filters of thousands of taps, adapts every 256 "
+	.ascii	"samples so narrowband input needs a smaller step), q15 (fixe"
+	.ascii	"d-point time domain LMS, bit-exact on every CPU, step size r"
+	.ascii	"ounded to a power of two), subband (normalized LMS in decima"
+	.ascii	"ted filterbank bands, for long filters and colored input, st"
+	.ascii	"ep size 0 to 2 per band, output delayed by 8 * <bands> sampl"
+	.ascii	"es), rls ("
+	.string	"recursive least squares, step size is 1 - forgetting factor, e.g. 0.001, direct form up to 64 taps and O(L) lattice above) or apa (affine projection, converges fast on colored input, normalized step size 0 to 2, 1 for the fastest convergence). Default lms\n"
+	.align 8
+.LC13:
+	.string	"      [--bands <n>]                                    Filterbank bands of the subband algorithm, power of two from 4 to 1024. Default 32\n"
+	.align 8
+.LC14:
+	.string	"      [--projection <n>]                               Input vectors of one projection of the apa algorithm, 1 (NLMS) to 32. Default 4\n"
+	.align 8
+.LC15:
+	.string	"      [--variant <variant>]                            LMS update rule: lms, nlms, leaky, sign-error, sign-data, sign-sign. Default lms\n"
+	.align 8
+.LC16:
+	.string	"      [--leakage <leakage>]                            Leakage of the leaky variant, coefficients decay by stepsize * leakage per sample. Default 0.01\n"
+	.align 8
+.LC17:
+	.string	"      [--desired <file>]                               Desired signal read in lock-step with the input, e.g. for system identification or echo cancellation. Default input delayed by <length> - 1 samples\n"
+	.align 8
+.LC18:
+	.string	"      [--two-column]                                   Input file holds frames of input and desired samples\n"
+	.align 8
+.LC19:
+	.string	"      [--format <format>]                              Input sample format. Default from file extension, WAV details from header\n"
+	.align 8
+.LC20:
+	.string	"      [--output <file>]                                Output file. Default <file>filtered\n"
+	.align 8
+.LC21:
+	.string	"      [--output-format <format>]                       Output sample format. Default same as input\n"
+	.align 8
+.LC22:
+	.string	"      [--channels <n>]                                 Number of interleaved channels in raw and text input, each filtered separately to <output>.<channel>. Default 1\n"
+	.align 8
+.LC23:
+	.string	"      [--bank]                                         Filter all interleaved channels with one vectorized filter bank (structure of arrays), for many channels with short filters\n"
+	.align 8
+.LC24:
+	.string	"      [--threads <n>]                                  Worker threads for batch and multi-channel filtering and for the bands of a single subband filter. Default number of CPUs\n"
+	.align 8
+.LC25:
+	.string	"      [--no-pipeline]                                  Read, filter and write a single file on one thread. Default separate reader, filter and writer threads\n"
+	.align 8
+.LC26:
+	.string	"      [--realtime]                                     Load the file, filter it in small blocks on a real-time worker thread and report block time percentiles and deadline misses\n"
+	.align 8
+.LC27:
+	.string	"      [--rt-block <n>]                                 Real-time block size in samples. Default 64\n"
+	.align 8
+.LC28:
+	.string	"      [--rt-rate <hz>]                                 Sample rate giving the block deadline. Default from the input\n"
+	.align 8
+.LC29:
+	.string	"      [--rt-priority <n>]                              SCHED_FIFO priority of the worker thread, where permitted. Default 0, normal scheduling\n"
+	.align 8
+.LC30:
+	.string	"      [--rt-cpu <n>]                                   Pin the worker thread to a CPU. Default any\n"
+	.align 8
+.LC31:
+	.string	"      [--rt-paced]                                     Release blocks at the sample clock instead of back-to-back\n"
+	.align 8
+.LC32:
+	.string	"      [--telemetry]                                    Track running MSE, coefficient norm and convergence of every filter, warn when the error starts rising and print a summary per output\n"
+	.align 8
+.LC33:
+	.string	"      [--telemetry-window <short> <long>]              Windows of the fast and slow MSE averages in samples. Default 256 8192\n"
+	.align 8
+.LC34:
+	.string	"      [--telemetry-margin <converged> <diverging>]     Converged once both averages stay within <converged> dB for a long window, warn when the fast one or the norm rises <diverging> dB. Default 1.5 20\n"
+	.align 8
+.LC35:
+	.string	"      [--telemetry-level <dB>]                         Also converged once the fast average stays <dB> below the desired signal power for a long window. Default -40\n"
+	.align 8
+.LC36:
+	.string	"      [--checkpoint <file>]                            lms algorithm: save the adapted filter (coefficients, delay line, step size, variant) after the last input sample. Multi-channel runs save the coefficients of all channels in one file\n"
+	.align 8
+.LC37:
+	.string	"      [--checkpoint-every <n>]                         Also save the checkpoint every <n> input samples of a single channel run\n"
+	.align 8
+.LC38:
+	.string	"      [--resume <file>]                                Continue a single channel run from a checkpoint: the state is restored and the input samples it has filtered are skipped, the output continues bit-exactly\n"
+	.align 8
+.LC39:
+	.string	"      [--warm-start <file>]                            Start from the coefficients of a checkpoint instead of zeros, one row per channel or one row for all channels\n"
+	.align 8
+.LC40:
+	.string	"      [--plot <file>]                                  Save a min/max envelope of input, output and error, collected while filtering a single channel: .csv, .svg, otherwise self-contained HTML\n"
+	.align 8
+.LC41:
+	.string	"      [--plot-width <n>]                               Buckets of the envelope, about one per pixel. Default 1024\n"
+	.align 8
+.LC42:
+	.string	"      [--plot-open]                                    Open the saved plot with the desktop viewer\n"
+	.align 8
+.LC43:
+	.ascii	"      [--io <io>]         "
+	.string	"                             File I/O: auto (io_uring, a pread/pwrite thread when not available), uring, thread or stdio (blocking, on the calling thread). Regular binary input is read ahead and regular output written behind in large buffers. Default auto\n"
+	.align 8
+.LC44:
+	.string	"  --bench                                              Measure filter throughput on synthetic input in memory with every kernel the CPU supports, and the samples each algorithm needs to identify an unknown system driven by pink noise\n"
+	.align 8
+.LC45:
+	.string	"      [--lengths <list>]                               Comma separated filter lengths. Default 16,64,256,1024\n"
+	.align 8
+.LC46:
+	.string	"      [--blocks <list>]                                Comma separated block sizes. Default 64,4096\n"
+	.align 8
+.LC47:
+	.string	"      [--samples <n>]                                  Samples filtered in one trial. Default 131072\n"
+	.align 8
+.LC48:
+	.string	"      [--trials <n>]                                   Measured trials, median and minimum are reported. Default 5\n"
+	.align 8
+.LC49:
+	.string	"      [--warmup <n>]                                   Trials run before measuring. Default 1\n"
+	.align 8
+.LC50:
+	.string	"      [--variants]                                     Measure all LMS variants. Default lms only\n"
+	.align 8
+.LC51:
+	.string	"      [--no-fdaf]                                      Skip the fdaf algorithm\n"
+	.align 8
+.LC52:
+	.string	"      [--no-q15]                                       Skip the q15 fixed-point algorithm\n"
+	.align 8
+.LC53:
+	.string	"      [--no-subband]                                   Skip the subband algorithm\n"
+	.align 8
+.LC54:
+	.string	"      [--no-rls]                                       Skip the recursive least squares algorithm\n"
+	.align 8
+.LC55:
+	.string	"      [--no-apa]                                       Skip the affine projection algorithm\n"
+	.align 8
+.LC56:
+	.string	"      [--format <format>]                              Report format: table, csv, json. Default table\n"
+	.align 8
+.LC57:
+	.string	"      [--output <file>]                                Report file. Default standard output\n"
+	.align 8
+.LC58:
+	.string	"  --plot <file>                                        Save a min/max envelope plot of a filtered file, read as a stream\n"
+	.align 8
+.LC59:
+	.string	"      [--output <file>]                                Plot file: .csv, .svg, otherwise self-contained HTML. Default <file>.html\n"
+	.align 8
+.LC60:
+	.string	"      [--width <n>]                                    Buckets of the envelope, about one per pixel. Default 1024\n"
+	.align 8
+.LC61:
+	.string	"      [--format <format>]                              Sample format of the filtered file. Default from file extension\n"
+	.align 8
+.LC62:
+	.string	"      [--open]                                         Open the saved plot with the desktop viewer\n"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	usage, @object
+	.size	usage, 512
+usage:
+	.quad	.LC0
+	.quad	.LC1
+	.quad	.LC2
+	.quad	.LC3
+	.quad	.LC4
+	.quad	.LC5
+	.quad	.LC6
+	.quad	.LC7
+	.quad	.LC8
+	.quad	.LC9
+	.quad	.LC10
+	.quad	.LC11
+	.quad	.LC12
+	.quad	.LC13
+	.quad	.LC14
+	.quad	.LC15
+	.quad	.LC16
+	.quad	.LC17
+	.quad	.LC18
+	.quad	.LC19
+	.quad	.LC20
+	.quad	.LC21
+	.quad	.LC22
+	.quad	.LC23
+	.quad	.LC24
+	.quad	.LC25
+	.quad	.LC26
+	.quad	.LC27
+	.quad	.LC28
+	.quad	.LC29
+	.quad	.LC30
+	.quad	.LC31
+	.quad	.LC32
+	.quad	.LC33
+	.quad	.LC34
+	.quad	.LC35
+	.quad	.LC36
+	.quad	.LC37
+	.quad	.LC38
+	.quad	.LC39
+	.quad	.LC40
+	.quad	.LC41
+	.quad	.LC42
+	.quad	.LC43
+	.quad	.LC44
+	.quad	.LC45
+	.quad	.LC46
+	.quad	.LC47
+	.quad	.LC48
+	.quad	.LC49
+	.quad	.LC50
+	.quad	.LC51
+	.quad	.LC52
+	.quad	.LC53
+	.quad	.LC54
+	.quad	.LC55
+	.quad	.LC56
+	.quad	.LC57
+	.quad	.LC58
+	.quad	.LC59
+	.quad	.LC60
+	.quad	.LC61
+	.quad	.LC62
+	.quad	0
+	.section	.rodata
+	.align 16
+	.type	illegalFilenameChars, @object
+	.size	illegalFilenameChars, 17
+illegalFilenameChars:
+	.ascii	"#%{}\\/*?$!:@+=^~,"
+.LC63:
+	.string	"Usage: %s [options] file...\n"
+.LC64:
+	.string	"%s"
+	.text
+	.type	showUsage, @function
+showUsage:
+.LFB6:
+	.file 1 "source/main.c"
+	.loc 1 124 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 125 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 127 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rax
+	lea	rax, .LC63[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 129 11
+	jmp	.L2
+.L3:
+	.loc 1 131 33
+	mov	eax, DWORD PTR -4[rbp]
+	lea	edx, 1[rax]
+	mov	DWORD PTR -4[rbp], edx
+	.loc 1 131 27
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, usage[rip]
+	mov	rax, QWORD PTR [rdx+rax]
+	.loc 1 131 9
+	mov	rsi, rax
+	lea	rax, .LC64[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L2:
+	.loc 1 129 17
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, usage[rip]
+	mov	rax, QWORD PTR [rdx+rax]
+	.loc 1 129 25
+	test	rax, rax
+	jne	.L3
+	.loc 1 133 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	showUsage, .-showUsage
+	.section	.rodata
+.LC65:
+	.string	"\nERROR: wrong argument\n"
+	.text
+	.type	printArgumentError, @function
+printArgumentError:
+.LFB7:
+	.loc 1 140 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 141 5
+	lea	rax, .LC65[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 142 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	showUsage
+	.loc 1 143 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	printArgumentError, .-printArgumentError
+	.section	.rodata
+.LC66:
+	.string	"\nERROR: Missing parameter\n"
+	.text
+	.type	printMissingParameterError, @function
+printMissingParameterError:
+.LFB8:
+	.loc 1 150 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 151 5
+	lea	rax, .LC66[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 152 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdi, rax
+	call	showUsage
+	.loc 1 153 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	printMissingParameterError, .-printMissingParameterError
+	.section	.rodata
+	.align 8
+.LC67:
+	.string	"ERROR: Argument <file> can not contain following characters: space "
+.LC68:
+	.string	"%c "
+	.text
+	.type	processGenerateArgumentFile, @function
+processGenerateArgumentFile:
+.LFB9:
+	.loc 1 161 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 162 9
+	mov	DWORD PTR -16[rbp], 0
+.LBB2:
+	.loc 1 164 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 164 5
+	jmp	.L7
+.L14:
+.LBB3:
+	.loc 1 166 27
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 166 9
+	jmp	.L8
+.L13:
+	.loc 1 168 25
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movzx	edx, BYTE PTR [rax]
+	.loc 1 168 52
+	mov	eax, DWORD PTR -8[rbp]
+	lea	rcx, illegalFilenameChars[rip]
+	movzx	eax, BYTE PTR [rax+rcx]
+	.loc 1 168 16
+	cmp	dl, al
+	jne	.L9
+	.loc 1 170 17
+	lea	rax, .LC67[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.LBB4:
+	.loc 1 171 35
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 171 17
+	jmp	.L10
+.L11:
+	.loc 1 173 55 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	lea	rdx, illegalFilenameChars[rip]
+	movzx	eax, BYTE PTR [rax+rdx]
+	.loc 1 173 21 discriminator 3
+	movsx	eax, al
+	mov	esi, eax
+	lea	rax, .LC68[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 171 77 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L10:
+	.loc 1 171 44 discriminator 1
+	cmp	DWORD PTR -12[rbp], 16
+	jbe	.L11
+.LBE4:
+	.loc 1 175 17
+	mov	edi, 10
+	call	putchar@PLT
+	.loc 1 176 24
+	mov	eax, 1
+	jmp	.L12
+.L9:
+	.loc 1 166 69 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L8:
+	.loc 1 166 36 discriminator 1
+	cmp	DWORD PTR -8[rbp], 16
+	jbe	.L13
+.LBE3:
+	.loc 1 164 45 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L7:
+	.loc 1 164 30 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 164 34 discriminator 1
+	test	al, al
+	jne	.L14
+.LBE2:
+	.loc 1 180 12
+	mov	eax, DWORD PTR -16[rbp]
+.L12:
+	.loc 1 181 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	processGenerateArgumentFile, .-processGenerateArgumentFile
+	.section	.rodata
+.LC69:
+	.string	"-"
+.LC70:
+	.string	"File is empty"
+.LC71:
+	.string	"File does not exist"
+	.text
+	.type	verifyFilterArgumentFile, @function
+verifyFilterArgumentFile:
+.LFB10:
+	.loc 1 189 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 176
+	mov	QWORD PTR -168[rbp], rdi
+	.loc 1 190 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 193 9
+	mov	rax, QWORD PTR -168[rbp]
+	lea	rdx, .LC69[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 193 8
+	test	eax, eax
+	je	.L16
+	.loc 1 197 14
+	lea	rdx, -160[rbp]
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	stat@PLT
+	.loc 1 197 13
+	test	eax, eax
+	jne	.L17
+	.loc 1 199 13
+	mov	eax, DWORD PTR -136[rbp]
+	and	eax, 61440
+	.loc 1 199 12
+	cmp	eax, 32768
+	jne	.L16
+	.loc 1 199 51 discriminator 1
+	mov	rax, QWORD PTR -112[rbp]
+	.loc 1 199 39 discriminator 1
+	test	rax, rax
+	jne	.L16
+	.loc 1 201 13
+	lea	rax, .LC70[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 202 20
+	mov	DWORD PTR -4[rbp], 1
+	jmp	.L16
+.L17:
+	.loc 1 207 9
+	lea	rax, .LC71[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 208 16
+	mov	DWORD PTR -4[rbp], 1
+.L16:
+	.loc 1 210 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 211 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	verifyFilterArgumentFile, .-verifyFilterArgumentFile
+	.section	.rodata
+.LC72:
+	.string	"*?["
+	.text
+	.type	isFilterFileBatch, @function
+isFilterFileBatch:
+.LFB11:
+	.loc 1 219 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 220 17
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 220 67
+	cmp	al, 64
+	je	.L20
+	.loc 1 220 33 discriminator 2
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, .LC72[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strpbrk@PLT
+	.loc 1 220 67 discriminator 2
+	test	rax, rax
+	je	.L21
+.L20:
+	.loc 1 220 67 is_stmt 0 discriminator 3
+	mov	eax, 1
+	jmp	.L23
+.L21:
+	.loc 1 220 67 discriminator 4
+	mov	eax, 0
+.L23:
+	.loc 1 221 1 is_stmt 1 discriminator 7
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	isFilterFileBatch, .-isFilterFileBatch
+	.section	.rodata
+.LC73:
+	.string	"Error allocating file list"
+	.text
+	.type	appendInputFile, @function
+appendInputFile:
+.LFB12:
+	.loc 1 228 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 56
+	.cfi_offset 3, -24
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	mov	QWORD PTR -64[rbp], rcx
+	.loc 1 229 9
+	mov	rax, QWORD PTR -48[rbp]
+	mov	edx, DWORD PTR [rax]
+	.loc 1 229 24
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 229 8
+	cmp	edx, eax
+	jne	.L25
+.LBB5:
+	.loc 1 231 28
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 231 61
+	test	eax, eax
+	jle	.L26
+	.loc 1 231 50 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 231 61 discriminator 1
+	add	eax, eax
+	jmp	.L27
+.L26:
+	.loc 1 231 61 is_stmt 0 discriminator 2
+	mov	eax, 16
+.L27:
+	.loc 1 231 13 is_stmt 1 discriminator 4
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 232 39 discriminator 4
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	realloc@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 233 12 discriminator 4
+	cmp	QWORD PTR -32[rbp], 0
+	jne	.L28
+	.loc 1 235 13
+	lea	rax, .LC73[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 236 20
+	mov	eax, 1
+	jmp	.L29
+.L28:
+	.loc 1 238 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 239 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, DWORD PTR -20[rbp]
+	mov	DWORD PTR [rax], edx
+.L25:
+.LBE5:
+	.loc 1 241 6
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 241 18
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR [rax]
+	cdqe
+	.loc 1 241 17
+	sal	rax, 3
+	lea	rbx, [rdx+rax]
+	.loc 1 241 33
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdi, rax
+	call	strdup@PLT
+	.loc 1 241 31
+	mov	QWORD PTR [rbx], rax
+	.loc 1 242 10
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 242 22
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR [rax]
+	cdqe
+	.loc 1 242 21
+	sal	rax, 3
+	add	rax, rdx
+	mov	rax, QWORD PTR [rax]
+	.loc 1 242 8
+	test	rax, rax
+	jne	.L30
+	.loc 1 244 9
+	lea	rax, .LC73[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 245 16
+	mov	eax, 1
+	jmp	.L29
+.L30:
+	.loc 1 247 6
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 247 18
+	lea	edx, 1[rax]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR [rax], edx
+	.loc 1 248 12
+	mov	eax, 0
+.L29:
+	.loc 1 249 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	appendInputFile, .-appendInputFile
+	.type	freeInputFiles, @function
+freeInputFiles:
+.LFB13:
+	.loc 1 255 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	DWORD PTR -28[rbp], esi
+.LBB6:
+	.loc 1 256 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 256 5
+	jmp	.L32
+.L33:
+	.loc 1 258 23 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 258 9 discriminator 3
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 256 38 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L32:
+	.loc 1 256 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -28[rbp]
+	jl	.L33
+.LBE6:
+	.loc 1 260 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 261 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	freeInputFiles, .-freeInputFiles
+	.section	.rodata
+.LC74:
+	.string	"r"
+.LC75:
+	.string	"\r\n"
+.LC76:
+	.string	"No files match %s\n"
+.LC77:
+	.string	"No input files"
+.LC78:
+	.string	"Input file: %s\n"
+	.text
+	.type	expandFilterArgumentFile, @function
+expandFilterArgumentFile:
+.LFB14:
+	.loc 1 272 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 4176
+	mov	QWORD PTR -4152[rbp], rdi
+	mov	QWORD PTR -4160[rbp], rsi
+	mov	QWORD PTR -4168[rbp], rdx
+	.loc 1 273 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 274 9
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 276 16
+	mov	rax, QWORD PTR -4160[rbp]
+	mov	QWORD PTR [rax], 0
+	.loc 1 277 17
+	mov	rax, QWORD PTR -4168[rbp]
+	mov	DWORD PTR [rax], 0
+	.loc 1 279 9
+	mov	rax, QWORD PTR -4152[rbp]
+	mov	rdi, rax
+	call	isFilterFileBatch
+	.loc 1 279 8
+	test	eax, eax
+	jne	.L35
+	.loc 1 281 16
+	mov	rcx, QWORD PTR -4152[rbp]
+	lea	rdx, -36[rbp]
+	mov	rsi, QWORD PTR -4168[rbp]
+	mov	rax, QWORD PTR -4160[rbp]
+	mov	rdi, rax
+	call	appendInputFile
+	jmp	.L54
+.L35:
+	.loc 1 284 12
+	mov	rax, QWORD PTR -4152[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 284 8
+	cmp	al, 64
+	jne	.L37
+.LBB7:
+	.loc 1 286 26
+	mov	rax, QWORD PTR -4152[rbp]
+	add	rax, 1
+	lea	rdx, .LC74[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	fopen@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 289 12
+	cmp	QWORD PTR -32[rbp], 0
+	jne	.L40
+	.loc 1 291 13
+	mov	rax, QWORD PTR -4152[rbp]
+	add	rax, 1
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 292 20
+	mov	eax, 1
+	jmp	.L54
+.L42:
+	.loc 1 296 18
+	lea	rax, -4144[rbp]
+	lea	rdx, .LC75[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcspn@PLT
+	.loc 1 296 41
+	mov	BYTE PTR -4144[rbp+rax], 0
+	.loc 1 297 21
+	movzx	eax, BYTE PTR -4144[rbp]
+	.loc 1 297 16
+	test	al, al
+	je	.L40
+	.loc 1 299 26
+	lea	rcx, -4144[rbp]
+	lea	rdx, -36[rbp]
+	mov	rsi, QWORD PTR -4168[rbp]
+	mov	rax, QWORD PTR -4160[rbp]
+	mov	rdi, rax
+	call	appendInputFile
+	mov	DWORD PTR -4[rbp], eax
+.L40:
+	.loc 1 294 41
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L41
+	.loc 1 294 45 discriminator 1
+	mov	rdx, QWORD PTR -32[rbp]
+	lea	rax, -4144[rbp]
+	mov	esi, 4096
+	mov	rdi, rax
+	call	fgets@PLT
+	.loc 1 294 41 discriminator 1
+	test	rax, rax
+	jne	.L42
+.L41:
+	.loc 1 302 9
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	fclose@PLT
+.LBE7:
+	jmp	.L43
+.L37:
+.LBB8:
+	.loc 1 308 13
+	lea	rdx, -4144[rbp]
+	mov	rax, QWORD PTR -4152[rbp]
+	mov	rcx, rdx
+	mov	edx, 0
+	mov	esi, 0
+	mov	rdi, rax
+	call	glob@PLT
+	.loc 1 308 12
+	test	eax, eax
+	je	.L44
+	.loc 1 310 13
+	mov	rax, QWORD PTR -4152[rbp]
+	mov	rsi, rax
+	lea	rax, .LC76[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 311 20
+	mov	eax, 1
+	jmp	.L54
+.L44:
+.LBB9:
+	.loc 1 313 21
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 313 9
+	jmp	.L45
+.L47:
+	.loc 1 315 82 discriminator 4
+	mov	rax, QWORD PTR -4136[rbp]
+	.loc 1 315 91 discriminator 4
+	mov	rdx, QWORD PTR -16[rbp]
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 315 22 discriminator 4
+	mov	rcx, QWORD PTR [rax]
+	lea	rdx, -36[rbp]
+	mov	rsi, QWORD PTR -4168[rbp]
+	mov	rax, QWORD PTR -4160[rbp]
+	mov	rdi, rax
+	call	appendInputFile
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 313 84 discriminator 4
+	add	QWORD PTR -16[rbp], 1
+.L45:
+	.loc 1 313 53 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L46
+	.loc 1 313 71 discriminator 3
+	mov	rax, QWORD PTR -4144[rbp]
+	.loc 1 313 53 discriminator 3
+	cmp	QWORD PTR -16[rbp], rax
+	jb	.L47
+.L46:
+.LBE9:
+	.loc 1 317 9
+	lea	rax, -4144[rbp]
+	mov	rdi, rax
+	call	globfree@PLT
+.L43:
+.LBE8:
+	.loc 1 320 8
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L48
+	.loc 1 320 38 discriminator 1
+	mov	rax, QWORD PTR -4168[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 320 34 discriminator 1
+	test	eax, eax
+	jne	.L48
+	.loc 1 322 9
+	lea	rax, .LC77[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 323 16
+	mov	DWORD PTR -4[rbp], 1
+.L48:
+.LBB10:
+	.loc 1 325 14
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 325 5
+	jmp	.L49
+.L52:
+	.loc 1 327 39
+	mov	rax, QWORD PTR -4160[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 327 50
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 327 13
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	verifyFilterArgumentFile
+	.loc 1 327 12
+	test	eax, eax
+	je	.L50
+	.loc 1 329 41
+	mov	rax, QWORD PTR -4160[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 329 52
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 329 13
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rax
+	lea	rax, .LC78[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 330 20
+	mov	DWORD PTR -4[rbp], 1
+.L50:
+	.loc 1 325 69 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L49:
+	.loc 1 325 46 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L51
+	.loc 1 325 54 discriminator 3
+	mov	rax, QWORD PTR -4168[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 325 46 discriminator 3
+	cmp	DWORD PTR -20[rbp], eax
+	jl	.L52
+.L51:
+.LBE10:
+	.loc 1 333 8
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L53
+	.loc 1 335 9
+	mov	rax, QWORD PTR -4168[rbp]
+	mov	edx, DWORD PTR [rax]
+	mov	rax, QWORD PTR -4160[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	esi, edx
+	mov	rdi, rax
+	call	freeInputFiles
+	.loc 1 336 20
+	mov	rax, QWORD PTR -4160[rbp]
+	mov	QWORD PTR [rax], 0
+	.loc 1 337 21
+	mov	rax, QWORD PTR -4168[rbp]
+	mov	DWORD PTR [rax], 0
+.L53:
+	.loc 1 339 12
+	mov	eax, DWORD PTR -4[rbp]
+.L54:
+	.loc 1 340 1 discriminator 2
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	expandFilterArgumentFile, .-expandFilterArgumentFile
+	.type	processArgsToGenerateWaveform, @function
+processArgsToGenerateWaveform:
+.LFB15:
+	.loc 1 350 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	DWORD PTR -28[rbp], esi
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 351 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 353 5
+	cmp	DWORD PTR -28[rbp], 5
+	je	.L56
+	cmp	DWORD PTR -28[rbp], 5
+	ja	.L57
+	cmp	DWORD PTR -28[rbp], 4
+	je	.L58
+	cmp	DWORD PTR -28[rbp], 4
+	ja	.L57
+	cmp	DWORD PTR -28[rbp], 2
+	je	.L59
+	cmp	DWORD PTR -28[rbp], 3
+	je	.L60
+	jmp	.L57
+.L59:
+	.loc 1 356 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	signalGenerator_processArgumentType@PLT
+	.loc 1 356 28
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR [rdx], eax
+	.loc 1 357 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 357 16
+	test	eax, eax
+	jne	.L67
+	.loc 1 359 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 361 13
+	jmp	.L67
+.L58:
+	.loc 1 364 32
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	signalGenerator_processArgumentCycles@PLT
+	.loc 1 364 30
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 4[rdx], eax
+	.loc 1 365 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 365 16
+	test	eax, eax
+	jne	.L68
+	.loc 1 367 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 369 13
+	jmp	.L68
+.L60:
+	.loc 1 372 36
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	signalGenerator_processArgumentResolution@PLT
+	.loc 1 372 34
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 8[rdx], eax
+	.loc 1 373 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 373 16
+	test	eax, eax
+	jne	.L69
+	.loc 1 375 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 377 13
+	jmp	.L69
+.L56:
+	.loc 1 380 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	processGenerateArgumentFile
+	.loc 1 380 16
+	test	eax, eax
+	je	.L70
+	.loc 1 382 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 384 13
+	jmp	.L70
+.L57:
+	.loc 1 387 20
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 388 13
+	jmp	.L62
+.L67:
+	.loc 1 361 13
+	nop
+	jmp	.L62
+.L68:
+	.loc 1 369 13
+	nop
+	jmp	.L62
+.L69:
+	.loc 1 377 13
+	nop
+	jmp	.L62
+.L70:
+	.loc 1 384 13
+	nop
+.L62:
+	.loc 1 390 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 391 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	processArgsToGenerateWaveform, .-processArgsToGenerateWaveform
+	.section	.rodata
+.LC79:
+	.string	"--format"
+.LC80:
+	.string	"--io"
+.LC81:
+	.string	"--amplitude"
+	.align 8
+.LC83:
+	.string	"ERROR: Argument <amplitude> must be a positive number"
+.LC84:
+	.string	"--snr"
+.LC85:
+	.string	"--end-resolution"
+.LC86:
+	.string	"--seed"
+.LC87:
+	.string	"--threads"
+	.align 8
+.LC88:
+	.string	"ERROR: Number of threads must be positive"
+.LC89:
+	.string	"ERROR: Unknown option %s\n"
+	.text
+	.type	processGenerateOptions, @function
+processGenerateOptions:
+.LFB16:
+	.loc 1 401 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	DWORD PTR -20[rbp], edi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+.LBB11:
+	.loc 1 402 14
+	mov	DWORD PTR -4[rbp], 6
+	.loc 1 402 5
+	jmp	.L72
+.L87:
+	.loc 1 404 25
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 404 14
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC79[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 404 12
+	test	eax, eax
+	jne	.L73
+	.loc 1 404 54 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 404 48 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L73
+	.loc 1 406 30
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 406 68
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 406 67
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 406 32
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	sampleIo_processArgumentFormat@PLT
+	.loc 1 406 30
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 12[rdx], eax
+	.loc 1 407 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 407 16
+	test	eax, eax
+	jne	.L76
+	.loc 1 409 24
+	mov	eax, 1
+	jmp	.L75
+.L73:
+	.loc 1 412 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 412 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC80[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 412 17
+	test	eax, eax
+	jne	.L77
+	.loc 1 412 55 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 412 49 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L77
+.LBB12:
+	.loc 1 414 32
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 414 80
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 414 79
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 414 42
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	asyncFile_ProcessArgumentBackend@PLT
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 415 16
+	cmp	DWORD PTR -8[rbp], 0
+	jne	.L78
+	.loc 1 417 24
+	mov	eax, 1
+	jmp	.L75
+.L78:
+	.loc 1 419 13
+	mov	eax, DWORD PTR -8[rbp]
+	mov	edi, eax
+	call	sampleIo_SetBackend@PLT
+.LBE12:
+	.loc 1 413 9
+	jmp	.L76
+.L77:
+	.loc 1 421 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 421 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC81[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 421 17
+	test	eax, eax
+	jne	.L79
+	.loc 1 421 62 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 421 56 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L79
+	.loc 1 423 33
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 423 52
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 423 51
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 423 42
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atof@PLT
+	.loc 1 423 35
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 423 33
+	mov	rax, QWORD PTR -40[rbp]
+	movss	DWORD PTR 16[rax], xmm0
+	.loc 1 424 27
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR 16[rax]
+	.loc 1 424 39
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 424 17
+	xor	eax, 1
+	.loc 1 424 16
+	test	al, al
+	je	.L76
+	.loc 1 426 17
+	lea	rax, .LC83[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 427 24
+	mov	eax, 1
+	jmp	.L75
+.L79:
+	.loc 1 430 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 430 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC84[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 430 17
+	test	eax, eax
+	jne	.L81
+	.loc 1 430 56 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 430 50 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L81
+	.loc 1 432 27
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 432 46
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 432 45
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 432 36
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atof@PLT
+	.loc 1 432 29
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 432 27
+	mov	rax, QWORD PTR -40[rbp]
+	movss	DWORD PTR 20[rax], xmm0
+	jmp	.L76
+.L81:
+	.loc 1 434 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 434 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC85[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 434 17
+	test	eax, eax
+	jne	.L82
+	.loc 1 434 67 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 434 61 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L82
+	.loc 1 436 37
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 436 86
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 436 85
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 436 39
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	signalGenerator_processArgumentResolution@PLT
+	.loc 1 436 37
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 24[rdx], eax
+	.loc 1 437 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 437 16
+	test	eax, eax
+	jne	.L76
+	.loc 1 439 24
+	mov	eax, 1
+	jmp	.L75
+.L82:
+	.loc 1 442 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 442 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC86[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 442 17
+	test	eax, eax
+	jne	.L84
+	.loc 1 442 57 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 442 51 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L84
+	.loc 1 444 28
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 444 44
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 444 43
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 444 30
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 0
+	mov	esi, 0
+	mov	rdi, rax
+	call	strtoull@PLT
+	.loc 1 444 28
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 32[rdx], rax
+	jmp	.L76
+.L84:
+	.loc 1 446 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 446 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC87[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 446 17
+	test	eax, eax
+	jne	.L85
+	.loc 1 446 60 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 446 54 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L85
+	.loc 1 448 36
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 448 48
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 448 47
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 448 38
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 448 36
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 40[rdx], eax
+	.loc 1 449 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 40[rax]
+	.loc 1 449 16
+	test	eax, eax
+	jg	.L76
+	.loc 1 451 17
+	lea	rax, .LC88[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 452 24
+	mov	eax, 1
+	jmp	.L75
+.L85:
+	.loc 1 457 54
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 457 13
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rax
+	lea	rax, .LC89[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 458 20
+	mov	eax, 1
+	jmp	.L75
+.L76:
+	.loc 1 402 60 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L72:
+	.loc 1 402 51 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L87
+.LBE11:
+	.loc 1 461 12
+	mov	eax, 0
+.L75:
+	.loc 1 462 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	processGenerateOptions, .-processGenerateOptions
+	.section	.rodata
+	.align 8
+.LC90:
+	.string	"ERROR: Checkpoints are supported by the lms algorithm only"
+	.align 8
+.LC91:
+	.string	"ERROR: Checkpoints cannot be used with multiple input files"
+	.align 8
+.LC92:
+	.string	"ERROR: --resume cannot be used with --warm-start"
+	.align 8
+.LC93:
+	.string	"ERROR: --resume continues a single input file with one channel, without --realtime"
+	.align 8
+.LC94:
+	.string	"ERROR: --checkpoint-every needs --checkpoint and a single channel, multi-channel runs are saved at the end"
+	.align 8
+.LC95:
+	.string	"ERROR: --checkpoint cannot be used with --realtime"
+	.text
+	.type	validateCheckpointOptions, @function
+validateCheckpointOptions:
+.LFB17:
+	.loc 1 471 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	DWORD PTR -28[rbp], esi
+	.loc 1 472 36
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 473 39
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 36[rax]
+	.loc 1 473 55
+	cmp	eax, 1
+	jg	.L89
+	.loc 1 473 66 discriminator 2
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 52[rax]
+	.loc 1 473 55 discriminator 2
+	test	eax, eax
+	je	.L90
+.L89:
+	.loc 1 473 55 is_stmt 0 discriminator 3
+	mov	eax, 1
+	jmp	.L91
+.L90:
+	.loc 1 473 55 discriminator 4
+	mov	eax, 0
+.L91:
+	.loc 1 473 15 is_stmt 1 discriminator 6
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 475 8 discriminator 6
+	cmp	QWORD PTR -8[rbp], 0
+	jne	.L92
+	.loc 1 477 16
+	mov	eax, 0
+	jmp	.L93
+.L92:
+	.loc 1 479 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 479 8
+	cmp	eax, 1
+	je	.L94
+	.loc 1 481 9
+	lea	rax, .LC90[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 482 16
+	mov	eax, 1
+	jmp	.L93
+.L94:
+	.loc 1 484 8
+	cmp	DWORD PTR -28[rbp], 0
+	je	.L95
+	.loc 1 486 9
+	lea	rax, .LC91[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 487 16
+	mov	eax, 1
+	jmp	.L93
+.L95:
+	.loc 1 489 20
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 489 8
+	test	rax, rax
+	je	.L96
+	.loc 1 489 60 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 489 46 discriminator 1
+	test	rax, rax
+	je	.L96
+	.loc 1 491 9
+	lea	rax, .LC92[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 492 16
+	mov	eax, 1
+	jmp	.L93
+.L96:
+	.loc 1 494 20
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 494 8
+	test	rax, rax
+	je	.L97
+	.loc 1 494 46 discriminator 1
+	cmp	DWORD PTR -12[rbp], 0
+	jne	.L98
+	.loc 1 494 75 discriminator 2
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 494 63 discriminator 2
+	test	rax, rax
+	je	.L97
+.L98:
+	.loc 1 496 9
+	lea	rax, .LC93[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 497 16
+	mov	eax, 1
+	jmp	.L93
+.L97:
+	.loc 1 499 20
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 499 8
+	test	rax, rax
+	jle	.L99
+	.loc 1 499 51 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 499 36 discriminator 1
+	test	rax, rax
+	je	.L100
+	.loc 1 499 75 discriminator 2
+	cmp	DWORD PTR -12[rbp], 0
+	je	.L99
+.L100:
+	.loc 1 501 9
+	lea	rax, .LC94[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 502 16
+	mov	eax, 1
+	jmp	.L93
+.L99:
+	.loc 1 504 20
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 504 8
+	test	rax, rax
+	je	.L101
+	.loc 1 504 56 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 504 44 discriminator 1
+	test	rax, rax
+	je	.L101
+	.loc 1 506 9
+	lea	rax, .LC95[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 507 16
+	mov	eax, 1
+	jmp	.L93
+.L101:
+	.loc 1 509 12
+	mov	eax, 0
+.L93:
+	.loc 1 510 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	validateCheckpointOptions, .-validateCheckpointOptions
+	.section	.rodata
+.LC96:
+	.string	"--variant"
+.LC97:
+	.string	"--leakage"
+	.align 8
+.LC98:
+	.string	"ERROR: Argument <leakage> must be a positive number"
+.LC99:
+	.string	"--algo"
+.LC100:
+	.string	"--bands"
+	.align 8
+.LC101:
+	.string	"ERROR: Number of bands must be a power of two from %d to %d\n"
+.LC102:
+	.string	"--projection"
+	.align 8
+.LC103:
+	.string	"ERROR: Projection order must be from 1 to %d\n"
+.LC104:
+	.string	"--desired"
+.LC105:
+	.string	"--two-column"
+.LC106:
+	.string	"--output"
+.LC107:
+	.string	"--output-format"
+.LC108:
+	.string	"--channels"
+	.align 8
+.LC109:
+	.string	"ERROR: Number of channels must be positive"
+.LC110:
+	.string	"--bank"
+.LC111:
+	.string	"--no-pipeline"
+.LC112:
+	.string	"--realtime"
+.LC113:
+	.string	"--rt-block"
+	.align 8
+.LC114:
+	.string	"ERROR: Real-time block size must be positive"
+.LC115:
+	.string	"--rt-rate"
+	.align 8
+.LC116:
+	.string	"ERROR: Sample rate must be positive"
+.LC117:
+	.string	"--rt-priority"
+	.align 8
+.LC118:
+	.string	"ERROR: Real-time priority must be from 0 to 99"
+.LC119:
+	.string	"--rt-cpu"
+	.align 8
+.LC120:
+	.string	"ERROR: CPU number cannot be negative"
+.LC121:
+	.string	"--rt-paced"
+.LC122:
+	.string	"--telemetry"
+.LC123:
+	.string	"--telemetry-window"
+	.align 8
+.LC124:
+	.string	"ERROR: Telemetry windows must be positive and the long one longer than the short one"
+.LC125:
+	.string	"--telemetry-level"
+	.align 8
+.LC126:
+	.string	"ERROR: Telemetry convergence level must be negative"
+.LC127:
+	.string	"--telemetry-margin"
+	.align 8
+.LC128:
+	.string	"ERROR: Telemetry margins must be positive"
+.LC129:
+	.string	"--checkpoint"
+.LC130:
+	.string	"--checkpoint-every"
+	.align 8
+.LC131:
+	.string	"ERROR: Checkpoint interval must be positive"
+.LC132:
+	.string	"--resume"
+.LC133:
+	.string	"--warm-start"
+.LC134:
+	.string	"--plot"
+.LC135:
+	.string	"--plot-width"
+	.align 8
+.LC136:
+	.string	"ERROR: Plot width must be from %d to %d\n"
+.LC137:
+	.string	"--plot-open"
+	.text
+	.type	processFilterOptions, @function
+processFilterOptions:
+.LFB18:
+	.loc 1 528 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	DWORD PTR -20[rbp], edi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	mov	QWORD PTR -48[rbp], rcx
+	mov	QWORD PTR -56[rbp], r8
+	mov	QWORD PTR -64[rbp], r9
+.LBB13:
+	.loc 1 529 14
+	mov	DWORD PTR -4[rbp], 5
+	.loc 1 529 5
+	jmp	.L103
+.L164:
+	.loc 1 531 25
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 531 14
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC96[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 531 12
+	test	eax, eax
+	jne	.L104
+	.loc 1 531 55 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 531 49 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L104
+	.loc 1 533 29
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 533 69
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 533 68
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 533 31
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	lmsFilter_processArgumentVariant@PLT
+	.loc 1 533 29
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 48[rdx], eax
+	.loc 1 534 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 534 16
+	cmp	eax, 6
+	jne	.L107
+	.loc 1 536 24
+	mov	eax, 1
+	jmp	.L106
+.L104:
+	.loc 1 539 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 539 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC97[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 539 17
+	test	eax, eax
+	jne	.L108
+	.loc 1 539 60 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 539 54 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L108
+	.loc 1 541 29
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 541 48
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 541 47
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 541 38
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atof@PLT
+	.loc 1 541 31
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 541 29
+	mov	rax, QWORD PTR -40[rbp]
+	movss	DWORD PTR 52[rax], xmm0
+	.loc 1 542 25
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR 52[rax]
+	.loc 1 542 35
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 542 17
+	xor	eax, 1
+	.loc 1 542 16
+	test	al, al
+	je	.L107
+	.loc 1 544 17
+	lea	rax, .LC98[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 545 24
+	mov	eax, 1
+	jmp	.L106
+.L108:
+	.loc 1 548 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 548 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC99[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 548 17
+	test	eax, eax
+	jne	.L110
+	.loc 1 548 57 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 548 51 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L110
+	.loc 1 550 33
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 550 75
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 550 74
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 550 35
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	lmsFilter_processArgumentAlgorithm@PLT
+	.loc 1 550 33
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	DWORD PTR [rdx], eax
+	.loc 1 551 25
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 551 16
+	test	eax, eax
+	jne	.L107
+	.loc 1 553 24
+	mov	eax, 1
+	jmp	.L106
+.L110:
+	.loc 1 556 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 556 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC100[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 556 17
+	test	eax, eax
+	jne	.L112
+	.loc 1 556 58 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 556 52 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L112
+	.loc 1 558 34
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 558 46
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 558 45
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 558 36
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 558 34
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	DWORD PTR 44[rdx], eax
+	.loc 1 559 26
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 44[rax]
+	.loc 1 559 16
+	cmp	eax, 3
+	jle	.L113
+	.loc 1 559 79 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 44[rax]
+	.loc 1 559 67 discriminator 1
+	cmp	eax, 1024
+	jg	.L113
+	.loc 1 560 30
+	mov	rax, QWORD PTR -48[rbp]
+	mov	edx, DWORD PTR 44[rax]
+	.loc 1 560 54
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 44[rax]
+	.loc 1 560 67
+	sub	eax, 1
+	.loc 1 560 43
+	and	eax, edx
+	.loc 1 560 17
+	test	eax, eax
+	je	.L165
+.L113:
+	.loc 1 562 17
+	mov	edx, 1024
+	mov	esi, 4
+	lea	rax, .LC101[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 564 24
+	mov	eax, 1
+	jmp	.L106
+.L112:
+	.loc 1 567 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 567 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC102[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 567 17
+	test	eax, eax
+	jne	.L115
+	.loc 1 567 63 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 567 57 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L115
+	.loc 1 569 39
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 569 51
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 569 50
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 569 41
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 569 39
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	DWORD PTR 48[rdx], eax
+	.loc 1 570 26
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 570 16
+	test	eax, eax
+	jle	.L116
+	.loc 1 570 61 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 570 49 discriminator 1
+	cmp	eax, 32
+	jle	.L166
+.L116:
+	.loc 1 572 17
+	mov	esi, 32
+	lea	rax, .LC103[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 573 24
+	mov	eax, 1
+	jmp	.L106
+.L115:
+	.loc 1 576 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 576 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC104[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 576 17
+	test	eax, eax
+	jne	.L118
+	.loc 1 576 60 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 576 54 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L118
+	.loc 1 578 39
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 578 46
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 578 45
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 578 39
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 579 17
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	mov	rdi, rax
+	call	verifyFilterArgumentFile
+	.loc 1 579 16
+	test	eax, eax
+	je	.L107
+	.loc 1 581 24
+	mov	eax, 1
+	jmp	.L106
+.L118:
+	.loc 1 584 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 584 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC105[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 584 17
+	test	eax, eax
+	jne	.L120
+	.loc 1 586 33
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 32[rax], 1
+	jmp	.L107
+.L120:
+	.loc 1 588 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 588 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC79[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 588 17
+	test	eax, eax
+	jne	.L121
+	.loc 1 588 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 588 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L121
+	.loc 1 590 35
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 590 73
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 590 72
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 590 37
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	sampleIo_processArgumentFormat@PLT
+	.loc 1 590 35
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	DWORD PTR 4[rdx], eax
+	.loc 1 591 25
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 591 16
+	test	eax, eax
+	jne	.L107
+	.loc 1 593 24
+	mov	eax, 1
+	jmp	.L106
+.L121:
+	.loc 1 596 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 596 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC106[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 596 17
+	test	eax, eax
+	jne	.L123
+	.loc 1 596 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 596 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L123
+	.loc 1 598 38
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 598 45
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 598 44
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 598 38
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	jmp	.L107
+.L123:
+	.loc 1 600 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 600 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC107[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 600 17
+	test	eax, eax
+	jne	.L124
+	.loc 1 600 66 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 600 60 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L124
+	.loc 1 602 36
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 602 74
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 602 73
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 602 38
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	sampleIo_processArgumentFormat@PLT
+	.loc 1 602 36
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	DWORD PTR 8[rdx], eax
+	.loc 1 603 25
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 603 16
+	test	eax, eax
+	jne	.L107
+	.loc 1 605 24
+	mov	eax, 1
+	jmp	.L106
+.L124:
+	.loc 1 608 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 608 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC108[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 608 17
+	test	eax, eax
+	jne	.L126
+	.loc 1 608 61 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 608 55 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L126
+	.loc 1 610 32
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 610 44
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 610 43
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 610 34
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 610 32
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	DWORD PTR 36[rdx], eax
+	.loc 1 611 25
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 36[rax]
+	.loc 1 611 16
+	test	eax, eax
+	jg	.L107
+	.loc 1 613 17
+	lea	rax, .LC109[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 614 24
+	mov	eax, 1
+	jmp	.L106
+.L126:
+	.loc 1 617 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 617 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC110[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 617 17
+	test	eax, eax
+	jne	.L128
+	.loc 1 619 31
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 52[rax], 1
+	jmp	.L107
+.L128:
+	.loc 1 621 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 621 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC111[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 621 17
+	test	eax, eax
+	jne	.L129
+	.loc 1 623 33
+	mov	rax, QWORD PTR -48[rbp]
+	mov	DWORD PTR 56[rax], 0
+	jmp	.L107
+.L129:
+	.loc 1 625 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 625 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC112[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 625 17
+	test	eax, eax
+	jne	.L130
+	.loc 1 627 32
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	jmp	.L107
+.L130:
+	.loc 1 629 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 629 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC113[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 629 17
+	test	eax, eax
+	jne	.L131
+	.loc 1 629 61 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 629 55 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L131
+	.loc 1 631 33
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 631 45
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 631 44
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 631 35
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 631 33
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	DWORD PTR 4[rdx], eax
+	.loc 1 632 25
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 632 16
+	test	eax, eax
+	jg	.L107
+	.loc 1 634 17
+	lea	rax, .LC114[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 635 24
+	mov	eax, 1
+	jmp	.L106
+.L131:
+	.loc 1 638 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 638 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC115[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 638 17
+	test	eax, eax
+	jne	.L133
+	.loc 1 638 60 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 638 54 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L133
+.LBB14:
+	.loc 1 640 17
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 640 40
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 640 39
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 640 30
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 641 16
+	cmp	DWORD PTR -8[rbp], 0
+	jg	.L134
+	.loc 1 643 17
+	lea	rax, .LC116[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 644 24
+	mov	eax, 1
+	jmp	.L106
+.L134:
+	.loc 1 646 36
+	mov	edx, DWORD PTR -8[rbp]
+	.loc 1 646 34
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR [rax], edx
+.LBE14:
+	.loc 1 639 9
+	jmp	.L107
+.L133:
+	.loc 1 648 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 648 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC117[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 648 17
+	test	eax, eax
+	jne	.L135
+	.loc 1 648 64 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 648 58 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L135
+	.loc 1 650 32
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 650 44
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 650 43
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 650 34
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 650 32
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	DWORD PTR 8[rdx], eax
+	.loc 1 651 26
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 651 16
+	test	eax, eax
+	js	.L136
+	.loc 1 651 54 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 651 42 discriminator 1
+	cmp	eax, 99
+	jle	.L167
+.L136:
+	.loc 1 653 17
+	lea	rax, .LC118[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 654 24
+	mov	eax, 1
+	jmp	.L106
+.L135:
+	.loc 1 657 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 657 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC119[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 657 17
+	test	eax, eax
+	jne	.L138
+	.loc 1 657 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 657 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L138
+	.loc 1 659 27
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 659 39
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 659 38
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 659 29
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 659 27
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	DWORD PTR 12[rdx], eax
+	.loc 1 660 25
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 660 16
+	test	eax, eax
+	jns	.L107
+	.loc 1 662 17
+	lea	rax, .LC120[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 663 24
+	mov	eax, 1
+	jmp	.L106
+.L138:
+	.loc 1 666 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 666 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC121[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 666 17
+	test	eax, eax
+	jne	.L140
+	.loc 1 668 29
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR 16[rax], 1
+	jmp	.L107
+.L140:
+	.loc 1 670 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 670 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC122[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 670 17
+	test	eax, eax
+	jne	.L141
+	.loc 1 672 33
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	jmp	.L107
+.L141:
+	.loc 1 674 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 674 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC123[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 674 17
+	test	eax, eax
+	jne	.L142
+	.loc 1 674 69 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 2
+	.loc 1 674 63 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L142
+	.loc 1 676 36
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 676 48
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 676 47
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 676 38
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 676 36
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	DWORD PTR [rdx], eax
+	.loc 1 677 35
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 677 47
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 677 46
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 677 37
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 677 35
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	DWORD PTR 4[rdx], eax
+	.loc 1 678 27
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 678 16
+	test	eax, eax
+	jle	.L143
+	.loc 1 678 59 discriminator 1
+	mov	rax, QWORD PTR -64[rbp]
+	mov	edx, DWORD PTR 4[rax]
+	.loc 1 678 84 discriminator 1
+	mov	rax, QWORD PTR -64[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 678 46 discriminator 1
+	cmp	edx, eax
+	jg	.L168
+.L143:
+	.loc 1 680 17
+	lea	rax, .LC124[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 681 24
+	mov	eax, 1
+	jmp	.L106
+.L142:
+	.loc 1 684 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 684 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC125[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 684 17
+	test	eax, eax
+	jne	.L145
+	.loc 1 684 68 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 684 62 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L145
+	.loc 1 686 41
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 686 60
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 686 59
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 686 50
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atof@PLT
+	.loc 1 686 43
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 686 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 12[rax], xmm0
+	.loc 1 687 28
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm1, DWORD PTR 12[rax]
+	.loc 1 687 47
+	pxor	xmm0, xmm0
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 687 17
+	xor	eax, 1
+	.loc 1 687 16
+	test	al, al
+	je	.L107
+	.loc 1 689 17
+	lea	rax, .LC126[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 690 24
+	mov	eax, 1
+	jmp	.L106
+.L145:
+	.loc 1 693 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 693 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC127[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 693 17
+	test	eax, eax
+	jne	.L147
+	.loc 1 693 69 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 2
+	.loc 1 693 63 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L147
+	.loc 1 695 42
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 695 61
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 695 60
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 695 51
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atof@PLT
+	.loc 1 695 44
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 695 42
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 8[rax], xmm0
+	.loc 1 696 41
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 696 60
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 696 59
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 696 50
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atof@PLT
+	.loc 1 696 43
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 696 41
+	mov	rax, QWORD PTR -64[rbp]
+	movss	DWORD PTR 16[rax], xmm0
+	.loc 1 697 28
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm0, DWORD PTR 8[rax]
+	.loc 1 697 48
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 697 17
+	xor	eax, 1
+	.loc 1 697 16
+	test	al, al
+	jne	.L148
+	.loc 1 697 67 discriminator 1
+	mov	rax, QWORD PTR -64[rbp]
+	movss	xmm0, DWORD PTR 16[rax]
+	.loc 1 697 86 discriminator 1
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 697 56 discriminator 1
+	xor	eax, 1
+	.loc 1 697 53 discriminator 1
+	test	al, al
+	je	.L169
+.L148:
+	.loc 1 699 17
+	lea	rax, .LC128[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 700 24
+	mov	eax, 1
+	jmp	.L106
+.L147:
+	.loc 1 703 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 703 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC129[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 703 17
+	test	eax, eax
+	jne	.L150
+	.loc 1 703 63 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 703 57 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L150
+	.loc 1 705 38
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 705 45
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 705 44
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 705 38
+	mov	rax, QWORD PTR 16[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 706 34
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR 16[rbp]
+	mov	QWORD PTR 80[rax], rdx
+	jmp	.L107
+.L150:
+	.loc 1 708 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 708 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC130[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 708 17
+	test	eax, eax
+	jne	.L151
+	.loc 1 708 69 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 708 63 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L151
+	.loc 1 710 34
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 710 46
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 710 45
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 710 36
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atol@PLT
+	.loc 1 710 34
+	mov	rdx, QWORD PTR 16[rbp]
+	mov	QWORD PTR 8[rdx], rax
+	.loc 1 711 34
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR 16[rbp]
+	mov	QWORD PTR 80[rax], rdx
+	.loc 1 712 27
+	mov	rax, QWORD PTR 16[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 712 16
+	test	rax, rax
+	jg	.L107
+	.loc 1 714 17
+	lea	rax, .LC131[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 715 24
+	mov	eax, 1
+	jmp	.L106
+.L151:
+	.loc 1 718 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 718 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC132[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 718 17
+	test	eax, eax
+	jne	.L153
+	.loc 1 718 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 718 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L153
+	.loc 1 720 40
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 720 47
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 720 46
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 720 40
+	mov	rax, QWORD PTR 16[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 721 34
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR 16[rbp]
+	mov	QWORD PTR 80[rax], rdx
+	jmp	.L107
+.L153:
+	.loc 1 723 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 723 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC133[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 723 17
+	test	eax, eax
+	jne	.L154
+	.loc 1 723 63 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 723 57 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L154
+	.loc 1 725 43
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 725 50
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 725 49
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 725 43
+	mov	rax, QWORD PTR 16[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 726 34
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR 16[rbp]
+	mov	QWORD PTR 80[rax], rdx
+	jmp	.L107
+.L154:
+	.loc 1 728 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 728 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC134[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 728 17
+	test	eax, eax
+	jne	.L155
+	.loc 1 728 57 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 728 51 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L155
+	.loc 1 730 28
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 730 35
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 730 34
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 730 28
+	mov	rax, QWORD PTR 24[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 731 28
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR 24[rbp]
+	mov	QWORD PTR 88[rax], rdx
+	jmp	.L107
+.L155:
+	.loc 1 733 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 733 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC135[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 733 17
+	test	eax, eax
+	jne	.L156
+	.loc 1 733 63 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 733 57 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L156
+	.loc 1 735 25
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 735 37
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 735 36
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 735 27
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 735 25
+	mov	rdx, QWORD PTR 24[rbp]
+	mov	DWORD PTR 8[rdx], eax
+	.loc 1 736 22
+	mov	rax, QWORD PTR 24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 736 16
+	cmp	eax, 15
+	jle	.L157
+	.loc 1 736 60 discriminator 1
+	mov	rax, QWORD PTR 24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 736 52 discriminator 1
+	cmp	eax, 65536
+	jle	.L170
+.L157:
+	.loc 1 738 17
+	mov	edx, 65536
+	mov	esi, 16
+	lea	rax, .LC136[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 739 24
+	mov	eax, 1
+	jmp	.L106
+.L156:
+	.loc 1 742 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 742 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC137[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 742 17
+	test	eax, eax
+	jne	.L159
+	.loc 1 744 23
+	mov	rax, QWORD PTR 32[rbp]
+	mov	DWORD PTR [rax], 1
+	jmp	.L107
+.L159:
+	.loc 1 746 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 746 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC80[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 746 17
+	test	eax, eax
+	jne	.L160
+	.loc 1 746 55 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 746 49 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L160
+.LBB15:
+	.loc 1 748 32
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 748 80
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 748 79
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 748 42
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	asyncFile_ProcessArgumentBackend@PLT
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 749 16
+	cmp	DWORD PTR -12[rbp], 0
+	jne	.L161
+	.loc 1 751 24
+	mov	eax, 1
+	jmp	.L106
+.L161:
+	.loc 1 753 13
+	mov	eax, DWORD PTR -12[rbp]
+	mov	edi, eax
+	call	sampleIo_SetBackend@PLT
+.LBE15:
+	.loc 1 747 9
+	jmp	.L107
+.L160:
+	.loc 1 755 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 755 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC87[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 755 17
+	test	eax, eax
+	jne	.L162
+	.loc 1 755 60 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 755 54 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L162
+	.loc 1 757 36
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 757 48
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 757 47
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 757 38
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 757 36
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	DWORD PTR 40[rdx], eax
+	.loc 1 758 25
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR 40[rax]
+	.loc 1 758 16
+	test	eax, eax
+	jg	.L107
+	.loc 1 760 17
+	lea	rax, .LC88[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 761 24
+	mov	eax, 1
+	jmp	.L106
+.L162:
+	.loc 1 766 54
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 766 13
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rax
+	lea	rax, .LC89[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 767 20
+	mov	eax, 1
+	jmp	.L106
+.L165:
+	.loc 1 559 16
+	nop
+	jmp	.L107
+.L166:
+	.loc 1 570 16
+	nop
+	jmp	.L107
+.L167:
+	.loc 1 651 16
+	nop
+	jmp	.L107
+.L168:
+	.loc 1 678 16
+	nop
+	jmp	.L107
+.L169:
+	.loc 1 697 16
+	nop
+	jmp	.L107
+.L170:
+	.loc 1 736 16
+	nop
+.L107:
+	.loc 1 529 58 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L103:
+	.loc 1 529 49 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L164
+.LBE13:
+	.loc 1 770 12
+	mov	eax, 0
+.L106:
+	.loc 1 771 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	processFilterOptions, .-processFilterOptions
+	.section	.rodata
+.LC138:
+	.string	"--lengths"
+.LC139:
+	.string	"--blocks"
+.LC140:
+	.string	"--samples"
+	.align 8
+.LC141:
+	.string	"ERROR: Number of samples must be positive"
+.LC142:
+	.string	"--trials"
+	.align 8
+.LC143:
+	.string	"ERROR: Number of trials must be positive"
+.LC144:
+	.string	"--warmup"
+	.align 8
+.LC145:
+	.string	"ERROR: Number of warmup trials must not be negative"
+.LC146:
+	.string	"--variants"
+.LC147:
+	.string	"--no-fdaf"
+.LC148:
+	.string	"--no-q15"
+.LC149:
+	.string	"--no-subband"
+.LC150:
+	.string	"--no-rls"
+.LC151:
+	.string	"--no-apa"
+	.text
+	.type	processBenchOptions, @function
+processBenchOptions:
+.LFB19:
+	.loc 1 781 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	DWORD PTR -20[rbp], edi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+.LBB16:
+	.loc 1 782 14
+	mov	DWORD PTR -4[rbp], 2
+	.loc 1 782 5
+	jmp	.L172
+.L194:
+	.loc 1 784 25
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 784 14
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC138[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 784 12
+	test	eax, eax
+	jne	.L173
+	.loc 1 784 55 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 784 49 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L173
+	.loc 1 786 86
+	mov	rcx, QWORD PTR -40[rbp]
+	.loc 1 786 36
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 786 72
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 786 71
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 786 38
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 16
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsBench_processArgumentList@PLT
+	.loc 1 786 36
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 64[rdx], eax
+	.loc 1 787 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 787 16
+	test	eax, eax
+	jne	.L176
+	.loc 1 789 24
+	mov	eax, 1
+	jmp	.L175
+.L173:
+	.loc 1 792 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 792 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC139[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 792 17
+	test	eax, eax
+	jne	.L177
+	.loc 1 792 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 792 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L177
+	.loc 1 794 89
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rcx, 68[rax]
+	.loc 1 794 39
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 794 75
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 794 74
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 794 41
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 16
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsBench_processArgumentList@PLT
+	.loc 1 794 39
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 132[rdx], eax
+	.loc 1 796 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 132[rax]
+	.loc 1 796 16
+	test	eax, eax
+	jne	.L176
+	.loc 1 798 24
+	mov	eax, 1
+	jmp	.L175
+.L177:
+	.loc 1 801 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 801 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC140[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 801 17
+	test	eax, eax
+	jne	.L179
+	.loc 1 801 60 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 801 54 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L179
+	.loc 1 803 36
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 803 48
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 803 47
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 803 38
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atol@PLT
+	.loc 1 803 36
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 136[rdx], rax
+	.loc 1 804 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 136[rax]
+	.loc 1 804 16
+	test	rax, rax
+	jg	.L176
+	.loc 1 806 17
+	lea	rax, .LC141[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 807 24
+	mov	eax, 1
+	jmp	.L175
+.L179:
+	.loc 1 810 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 810 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC142[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 810 17
+	test	eax, eax
+	jne	.L181
+	.loc 1 810 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 810 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L181
+	.loc 1 812 30
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 812 42
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 812 41
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 812 32
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 812 30
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 144[rdx], eax
+	.loc 1 813 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 813 16
+	test	eax, eax
+	jg	.L176
+	.loc 1 815 17
+	lea	rax, .LC143[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 816 24
+	mov	eax, 1
+	jmp	.L175
+.L181:
+	.loc 1 819 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 819 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC144[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 819 17
+	test	eax, eax
+	jne	.L183
+	.loc 1 819 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 819 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L183
+	.loc 1 821 36
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 821 48
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 821 47
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 821 38
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 821 36
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 148[rdx], eax
+	.loc 1 822 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 148[rax]
+	.loc 1 822 16
+	test	eax, eax
+	jns	.L176
+	.loc 1 824 17
+	lea	rax, .LC145[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 825 24
+	mov	eax, 1
+	jmp	.L175
+.L183:
+	.loc 1 828 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 828 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC146[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 828 17
+	test	eax, eax
+	jne	.L185
+	.loc 1 830 35
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 152[rax], 1
+	jmp	.L176
+.L185:
+	.loc 1 832 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 832 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC147[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 832 17
+	test	eax, eax
+	jne	.L186
+	.loc 1 834 35
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 156[rax], 0
+	jmp	.L176
+.L186:
+	.loc 1 836 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 836 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC148[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 836 17
+	test	eax, eax
+	jne	.L187
+	.loc 1 838 36
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 160[rax], 0
+	jmp	.L176
+.L187:
+	.loc 1 840 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 840 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC149[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 840 17
+	test	eax, eax
+	jne	.L188
+	.loc 1 842 38
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 164[rax], 0
+	jmp	.L176
+.L188:
+	.loc 1 844 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 844 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC150[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 844 17
+	test	eax, eax
+	jne	.L189
+	.loc 1 846 34
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 168[rax], 0
+	jmp	.L176
+.L189:
+	.loc 1 848 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 848 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC151[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 848 17
+	test	eax, eax
+	jne	.L190
+	.loc 1 850 34
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 172[rax], 0
+	jmp	.L176
+.L190:
+	.loc 1 852 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 852 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC79[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 852 17
+	test	eax, eax
+	jne	.L191
+	.loc 1 852 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 852 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L191
+	.loc 1 854 30
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 854 68
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 854 67
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 854 32
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	lmsBench_processArgumentFormat@PLT
+	.loc 1 854 30
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 176[rdx], eax
+	.loc 1 855 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 176[rax]
+	.loc 1 855 16
+	test	eax, eax
+	jne	.L176
+	.loc 1 857 24
+	mov	eax, 1
+	jmp	.L175
+.L191:
+	.loc 1 860 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 860 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC106[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 860 17
+	test	eax, eax
+	jne	.L193
+	.loc 1 860 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 860 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L193
+	.loc 1 862 38
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 862 45
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 862 44
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 862 38
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 184[rax], rdx
+	jmp	.L176
+.L193:
+	.loc 1 866 54
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 866 13
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rax
+	lea	rax, .LC89[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 867 20
+	mov	eax, 1
+	jmp	.L175
+.L176:
+	.loc 1 782 57 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L172:
+	.loc 1 782 48 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L194
+.LBE16:
+	.loc 1 870 12
+	mov	eax, 0
+.L175:
+	.loc 1 871 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	processBenchOptions, .-processBenchOptions
+	.section	.rodata
+.LC152:
+	.string	"--width"
+.LC153:
+	.string	"--open"
+	.text
+	.type	processPlotOptions, @function
+processPlotOptions:
+.LFB20:
+	.loc 1 883 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	DWORD PTR -20[rbp], edi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	mov	QWORD PTR -48[rbp], rcx
+	mov	QWORD PTR -56[rbp], r8
+.LBB17:
+	.loc 1 884 14
+	mov	DWORD PTR -4[rbp], 3
+	.loc 1 884 5
+	jmp	.L196
+.L206:
+	.loc 1 886 25
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 886 14
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC106[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 886 12
+	test	eax, eax
+	jne	.L197
+	.loc 1 886 54 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 886 48 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L197
+	.loc 1 888 32
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 888 39
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 888 38
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 888 32
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR [rax], rdx
+	jmp	.L198
+.L197:
+	.loc 1 890 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 890 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC152[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 890 17
+	test	eax, eax
+	jne	.L199
+	.loc 1 890 58 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 890 52 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L199
+	.loc 1 892 29
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 892 41
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 892 40
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 892 31
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 892 29
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 8[rdx], eax
+	.loc 1 893 26
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 893 16
+	cmp	eax, 15
+	jle	.L200
+	.loc 1 893 68 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 893 56 discriminator 1
+	cmp	eax, 65536
+	jle	.L207
+.L200:
+	.loc 1 895 17
+	mov	edx, 65536
+	mov	esi, 16
+	lea	rax, .LC136[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 896 24
+	mov	eax, 1
+	jmp	.L202
+.L199:
+	.loc 1 899 30
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 899 19
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC79[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 899 17
+	test	eax, eax
+	jne	.L203
+	.loc 1 899 59 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 899 53 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jle	.L203
+	.loc 1 901 21
+	add	DWORD PTR -4[rbp], 1
+	.loc 1 901 59
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 901 58
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 901 23
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	sampleIo_processArgumentFormat@PLT
+	.loc 1 901 21
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	DWORD PTR [rdx], eax
+	.loc 1 902 17
+	mov	rax, QWORD PTR -48[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 902 16
+	test	eax, eax
+	jne	.L198
+	.loc 1 904 24
+	mov	eax, 1
+	jmp	.L202
+.L203:
+	.loc 1 907 29
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 907 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC153[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 907 17
+	test	eax, eax
+	jne	.L205
+	.loc 1 909 23
+	mov	rax, QWORD PTR -56[rbp]
+	mov	DWORD PTR [rax], 1
+	jmp	.L198
+.L205:
+	.loc 1 913 54
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 913 13
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rax
+	lea	rax, .LC89[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 914 20
+	mov	eax, 1
+	jmp	.L202
+.L207:
+	.loc 1 893 16
+	nop
+.L198:
+	.loc 1 884 56 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L196:
+	.loc 1 884 47 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L206
+.LBE17:
+	.loc 1 917 12
+	mov	eax, 0
+.L202:
+	.loc 1 918 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	processPlotOptions, .-processPlotOptions
+	.section	.rodata
+	.align 8
+.LC154:
+	.string	"Filter length:                %d \n"
+	.align 8
+.LC155:
+	.string	"Step size:                    %f \n"
+	.text
+	.type	processArgsToStartFiltering, @function
+processArgsToStartFiltering:
+.LFB21:
+	.loc 1 928 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	DWORD PTR -28[rbp], esi
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 929 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 931 5
+	cmp	DWORD PTR -28[rbp], 4
+	je	.L209
+	cmp	DWORD PTR -28[rbp], 4
+	ja	.L210
+	cmp	DWORD PTR -28[rbp], 2
+	je	.L211
+	cmp	DWORD PTR -28[rbp], 3
+	je	.L212
+	jmp	.L210
+.L211:
+	.loc 1 934 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_processArgumentFilterLength@PLT
+	mov	edx, eax
+	.loc 1 934 28
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 935 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 935 16
+	test	eax, eax
+	jg	.L213
+	.loc 1 937 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 943 13
+	jmp	.L215
+.L213:
+	.loc 1 941 17
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	mov	esi, eax
+	lea	rax, .LC154[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 943 13
+	jmp	.L215
+.L212:
+	.loc 1 946 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	lmsFilter_processArgumentStepSize@PLT
+	movd	eax, xmm0
+	.loc 1 946 26
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR [rdx], eax
+	.loc 1 947 25
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 947 32
+	pxor	xmm1, xmm1
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 947 17
+	xor	eax, 1
+	.loc 1 947 16
+	test	al, al
+	je	.L216
+	.loc 1 949 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 955 13
+	jmp	.L215
+.L216:
+	.loc 1 953 69
+	mov	rax, QWORD PTR -40[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 953 17
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, xmm0
+	movq	rax, xmm2
+	movq	xmm0, rax
+	lea	rax, .LC155[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 955 13
+	jmp	.L215
+.L209:
+	.loc 1 959 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	isFilterFileBatch
+	.loc 1 959 16
+	test	eax, eax
+	jne	.L220
+	.loc 1 959 51 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	verifyFilterArgumentFile
+	.loc 1 959 47 discriminator 1
+	test	eax, eax
+	je	.L220
+	.loc 1 961 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 963 13
+	jmp	.L220
+.L210:
+	.loc 1 966 20
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 967 13
+	jmp	.L215
+.L220:
+	.loc 1 963 13
+	nop
+.L215:
+	.loc 1 969 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 970 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	processArgsToStartFiltering, .-processArgsToStartFiltering
+	.section	.rodata
+.LC156:
+	.string	"--help"
+.LC157:
+	.string	"--version"
+.LC158:
+	.string	"Version: %d.%d.%d\n"
+.LC159:
+	.string	"--generate"
+.LC160:
+	.string	"--filter"
+	.align 8
+.LC162:
+	.string	"ERROR: --variant is supported by the lms algorithm without --bank only"
+	.align 8
+.LC163:
+	.string	"ERROR: --desired and --two-column filter a single input file with one channel"
+	.align 8
+.LC164:
+	.string	"ERROR: --realtime filters a single input file with one channel"
+	.align 8
+.LC165:
+	.string	"ERROR: --telemetry cannot be used with --bank"
+	.align 8
+.LC166:
+	.string	"ERROR: --bands is supported by the subband algorithm only"
+	.align 8
+.LC167:
+	.string	"ERROR: --projection is supported by the apa algorithm only"
+	.align 8
+.LC169:
+	.string	"ERROR: Step size of the rls algorithm is 1 - forgetting factor and must be below 1"
+	.align 8
+.LC171:
+	.string	"ERROR: Step size of the apa algorithm must be below 2"
+	.align 8
+.LC172:
+	.string	"ERROR: --desired cannot be used with --two-column"
+	.align 8
+.LC173:
+	.string	"ERROR: --plot summarizes a single input file with one channel"
+	.align 8
+.LC174:
+	.string	"ERROR: --plot-open needs --plot"
+	.align 8
+.LC175:
+	.string	"Variant:                      %s\n"
+	.align 8
+.LC177:
+	.string	"Step shift:                   %d (step size %g)\n"
+	.align 8
+.LC178:
+	.string	"Subband bands:                %d (output delayed by %d samples)\n"
+	.align 8
+.LC179:
+	.string	"RLS form:                     %s (forgetting factor %g)\n"
+	.align 8
+.LC180:
+	.string	"Projection order:             %d\n"
+	.align 8
+.LC181:
+	.string	"ERROR: --output cannot be used with multiple input files"
+	.align 8
+.LC182:
+	.string	"ERROR: --channels and --bank cannot be used with multiple input files"
+	.align 8
+.LC183:
+	.string	"Plot:                         %s\n"
+.LC184:
+	.string	"--bench"
+.LC185:
+	.string	"stdin"
+.LC186:
+	.string	"%s.html"
+	.text
+	.globl	main
+	.type	main, @function
+main:
+.LFB22:
+	.loc 1 973 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 536
+	.cfi_offset 3, -24
+	mov	DWORD PTR -532[rbp], edi
+	mov	QWORD PTR -544[rbp], rsi
+	.loc 1 974 6
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 976 8
+	cmp	DWORD PTR -532[rbp], 1
+	jle	.L222
+	.loc 1 978 25
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 8
+	.loc 1 978 13
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 6
+	lea	rcx, .LC156[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	strncmp@PLT
+	.loc 1 978 12
+	test	eax, eax
+	jne	.L223
+	.loc 1 980 13
+	mov	rax, QWORD PTR -544[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	showUsage
+	jmp	.L224
+.L223:
+	.loc 1 982 30
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 8
+	.loc 1 982 18
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 9
+	lea	rcx, .LC157[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	strncmp@PLT
+	.loc 1 982 17
+	test	eax, eax
+	jne	.L225
+	.loc 1 984 13
+	mov	ecx, 0
+	mov	edx, 0
+	mov	esi, 1
+	lea	rax, .LC158[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L224
+.L225:
+	.loc 1 986 30
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 8
+	.loc 1 986 18
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 10
+	lea	rcx, .LC159[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	strncmp@PLT
+	.loc 1 986 17
+	test	eax, eax
+	jne	.L226
+	.loc 1 988 16
+	cmp	DWORD PTR -532[rbp], 5
+	jle	.L227
+.LBB18:
+	.loc 1 992 17
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	signalGenerator_DefaultSettings@PLT
+.LBB19:
+	.loc 1 994 26
+	mov	DWORD PTR -24[rbp], 2
+	.loc 1 994 17
+	jmp	.L228
+.L231:
+	.loc 1 996 25
+	mov	ecx, DWORD PTR -24[rbp]
+	.loc 1 996 59
+	mov	eax, DWORD PTR -24[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, rdx
+	.loc 1 996 25
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, -384[rbp]
+	mov	esi, ecx
+	mov	rdi, rax
+	call	processArgsToGenerateWaveform
+	.loc 1 996 24
+	test	eax, eax
+	je	.L229
+	.loc 1 998 32
+	mov	eax, 1
+	jmp	.L233
+.L229:
+	.loc 1 994 69 discriminator 2
+	add	DWORD PTR -24[rbp], 1
+.L228:
+	.loc 1 994 35 discriminator 1
+	cmp	DWORD PTR -24[rbp], 5
+	jle	.L231
+.LBE19:
+	.loc 1 1001 21
+	lea	rdx, -384[rbp]
+	mov	rcx, QWORD PTR -544[rbp]
+	mov	eax, DWORD PTR -532[rbp]
+	mov	rsi, rcx
+	mov	edi, eax
+	call	processGenerateOptions
+	.loc 1 1001 20
+	test	eax, eax
+	je	.L232
+	.loc 1 1003 28
+	mov	eax, 1
+	jmp	.L233
+.L232:
+	.loc 1 1005 78
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 40
+	.loc 1 1005 26
+	mov	rdx, QWORD PTR [rax]
+	lea	rax, -384[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	signalGenerator_generateSignal@PLT
+	mov	DWORD PTR -20[rbp], eax
+.LBE18:
+	jmp	.L224
+.L227:
+	.loc 1 1009 17
+	mov	rax, QWORD PTR -544[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	printMissingParameterError
+	.loc 1 1010 24
+	mov	eax, 1
+	jmp	.L233
+.L226:
+	.loc 1 1013 30
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 8
+	.loc 1 1013 18
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 8
+	lea	rcx, .LC160[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	strncmp@PLT
+	.loc 1 1013 17
+	test	eax, eax
+	jne	.L234
+	.loc 1 1015 16
+	cmp	DWORD PTR -532[rbp], 4
+	jle	.L235
+.LBB20:
+	.loc 1 1017 29
+	lea	rdx, -384[rbp]
+	mov	eax, 0
+	mov	ecx, 14
+	mov	rdi, rdx
+	rep stosq
+	movss	xmm0, DWORD PTR .LC161[rip]
+	movss	DWORD PTR -332[rbp], xmm0
+	.loc 1 1018 41
+	lea	rdx, -496[rbp]
+	mov	eax, 0
+	mov	ecx, 13
+	mov	rdi, rdx
+	rep stosq
+	mov	DWORD PTR -496[rbp], 1
+	mov	DWORD PTR -460[rbp], 1
+	mov	DWORD PTR -440[rbp], 1
+	.loc 1 1035 39
+	mov	DWORD PTR -80[rbp], 0
+	mov	DWORD PTR -76[rbp], 64
+	mov	DWORD PTR -72[rbp], 0
+	mov	DWORD PTR -68[rbp], -1
+	mov	DWORD PTR -64[rbp], 0
+	.loc 1 1041 41
+	mov	QWORD PTR -528[rbp], 0
+	mov	QWORD PTR -520[rbp], 0
+	mov	QWORD PTR -512[rbp], 0
+	mov	QWORD PTR -504[rbp], 0
+	.loc 1 1045 35
+	mov	QWORD PTR -128[rbp], 0
+	mov	DWORD PTR -120[rbp], 1024
+	.loc 1 1046 21
+	mov	DWORD PTR -132[rbp], 0
+	.loc 1 1047 24
+	mov	QWORD PTR -144[rbp], 0
+	.loc 1 1048 21
+	mov	DWORD PTR -148[rbp], 0
+	.loc 1 1050 17
+	lea	rax, -112[rbp]
+	mov	rdi, rax
+	call	lmsTelemetry_DefaultSettings@PLT
+.LBB21:
+	.loc 1 1052 26
+	mov	DWORD PTR -28[rbp], 2
+	.loc 1 1052 17
+	jmp	.L236
+.L239:
+	.loc 1 1054 25
+	mov	ecx, DWORD PTR -28[rbp]
+	.loc 1 1054 57
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, rdx
+	.loc 1 1054 25
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, -384[rbp]
+	mov	esi, ecx
+	mov	rdi, rax
+	call	processArgsToStartFiltering
+	.loc 1 1054 24
+	test	eax, eax
+	je	.L237
+	.loc 1 1056 32
+	mov	eax, 1
+	jmp	.L233
+.L237:
+	.loc 1 1052 67 discriminator 2
+	add	DWORD PTR -28[rbp], 1
+.L236:
+	.loc 1 1052 35 discriminator 1
+	cmp	DWORD PTR -28[rbp], 4
+	jle	.L239
+.LBE21:
+	.loc 1 1059 21
+	lea	r9, -112[rbp]
+	lea	r8, -80[rbp]
+	lea	rcx, -496[rbp]
+	lea	rdx, -384[rbp]
+	mov	rsi, QWORD PTR -544[rbp]
+	mov	eax, DWORD PTR -532[rbp]
+	sub	rsp, 8
+	lea	rdi, -132[rbp]
+	push	rdi
+	lea	rdi, -128[rbp]
+	push	rdi
+	lea	rdi, -528[rbp]
+	push	rdi
+	mov	edi, eax
+	call	processFilterOptions
+	add	rsp, 32
+	.loc 1 1059 20
+	test	eax, eax
+	je	.L240
+	.loc 1 1062 28
+	mov	eax, 1
+	jmp	.L233
+.L240:
+	.loc 1 1064 28
+	mov	eax, DWORD PTR -336[rbp]
+	.loc 1 1064 20
+	test	eax, eax
+	je	.L241
+	.loc 1 1065 38
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1065 21
+	cmp	eax, 1
+	jne	.L242
+	.loc 1 1065 93 discriminator 1
+	mov	eax, DWORD PTR -444[rbp]
+	.loc 1 1065 78 discriminator 1
+	test	eax, eax
+	je	.L241
+.L242:
+	.loc 1 1067 21
+	lea	rax, .LC162[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1068 28
+	mov	eax, 1
+	jmp	.L233
+.L241:
+	.loc 1 1070 35
+	mov	rax, QWORD PTR -472[rbp]
+	.loc 1 1070 20
+	test	rax, rax
+	jne	.L243
+	.loc 1 1070 76 discriminator 1
+	mov	eax, DWORD PTR -464[rbp]
+	.loc 1 1070 61 discriminator 1
+	test	eax, eax
+	je	.L244
+.L243:
+	.loc 1 1071 38
+	mov	eax, DWORD PTR -460[rbp]
+	.loc 1 1071 21
+	cmp	eax, 1
+	jg	.L245
+	.loc 1 1071 68 discriminator 1
+	mov	eax, DWORD PTR -444[rbp]
+	.loc 1 1071 53 discriminator 1
+	test	eax, eax
+	jne	.L245
+	.loc 1 1071 102 discriminator 2
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 32
+	.loc 1 1071 80 discriminator 2
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	isFilterFileBatch
+	.loc 1 1071 77 discriminator 2
+	test	eax, eax
+	je	.L244
+.L245:
+	.loc 1 1073 21
+	lea	rax, .LC163[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1074 28
+	mov	eax, 1
+	jmp	.L233
+.L244:
+	.loc 1 1076 34
+	mov	rax, QWORD PTR -432[rbp]
+	.loc 1 1076 20
+	test	rax, rax
+	je	.L246
+	.loc 1 1077 38
+	mov	eax, DWORD PTR -460[rbp]
+	.loc 1 1077 21
+	cmp	eax, 1
+	jg	.L247
+	.loc 1 1077 68 discriminator 1
+	mov	eax, DWORD PTR -444[rbp]
+	.loc 1 1077 53 discriminator 1
+	test	eax, eax
+	jne	.L247
+	.loc 1 1077 102 discriminator 2
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 32
+	.loc 1 1077 80 discriminator 2
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	isFilterFileBatch
+	.loc 1 1077 77 discriminator 2
+	test	eax, eax
+	je	.L246
+.L247:
+	.loc 1 1079 21
+	lea	rax, .LC164[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1080 28
+	mov	eax, 1
+	jmp	.L233
+.L246:
+	.loc 1 1082 34
+	mov	rax, QWORD PTR -424[rbp]
+	.loc 1 1082 20
+	test	rax, rax
+	je	.L248
+	.loc 1 1082 69 discriminator 1
+	mov	eax, DWORD PTR -444[rbp]
+	.loc 1 1082 54 discriminator 1
+	test	eax, eax
+	je	.L248
+	.loc 1 1084 21
+	lea	rax, .LC165[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1085 28
+	mov	eax, 1
+	jmp	.L233
+.L248:
+	.loc 1 1087 34
+	mov	eax, DWORD PTR -452[rbp]
+	.loc 1 1087 20
+	test	eax, eax
+	je	.L249
+	.loc 1 1087 68 discriminator 1
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1087 52 discriminator 1
+	cmp	eax, 4
+	je	.L249
+	.loc 1 1089 21
+	lea	rax, .LC166[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1090 28
+	mov	eax, 1
+	jmp	.L233
+.L249:
+	.loc 1 1092 34
+	mov	eax, DWORD PTR -448[rbp]
+	.loc 1 1092 20
+	test	eax, eax
+	je	.L250
+	.loc 1 1092 73 discriminator 1
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1092 57 discriminator 1
+	cmp	eax, 6
+	je	.L250
+	.loc 1 1094 21
+	lea	rax, .LC167[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1095 28
+	mov	eax, 1
+	jmp	.L233
+.L250:
+	.loc 1 1097 34
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1097 20
+	cmp	eax, 5
+	jne	.L251
+	.loc 1 1097 85 discriminator 1
+	movss	xmm1, DWORD PTR -384[rbp]
+	.loc 1 1097 91 discriminator 1
+	movss	xmm0, DWORD PTR .LC168[rip]
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 1097 77 discriminator 1
+	xor	eax, 1
+	.loc 1 1097 74 discriminator 1
+	test	al, al
+	je	.L251
+	.loc 1 1099 21
+	lea	rax, .LC169[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1100 28
+	mov	eax, 1
+	jmp	.L233
+.L251:
+	.loc 1 1102 34
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1102 20
+	cmp	eax, 6
+	jne	.L252
+	.loc 1 1102 85 discriminator 1
+	movss	xmm1, DWORD PTR -384[rbp]
+	.loc 1 1102 91 discriminator 1
+	movss	xmm0, DWORD PTR .LC170[rip]
+	comiss	xmm0, xmm1
+	seta	al
+	.loc 1 1102 77 discriminator 1
+	xor	eax, 1
+	.loc 1 1102 74 discriminator 1
+	test	al, al
+	je	.L252
+	.loc 1 1104 21
+	lea	rax, .LC171[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1105 28
+	mov	eax, 1
+	jmp	.L233
+.L252:
+	.loc 1 1107 34
+	mov	rax, QWORD PTR -472[rbp]
+	.loc 1 1107 20
+	test	rax, rax
+	je	.L253
+	.loc 1 1107 75 discriminator 1
+	mov	eax, DWORD PTR -464[rbp]
+	.loc 1 1107 60 discriminator 1
+	test	eax, eax
+	je	.L253
+	.loc 1 1109 21
+	lea	rax, .LC172[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1110 28
+	mov	eax, 1
+	jmp	.L233
+.L253:
+	.loc 1 1112 84
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 32
+	.loc 1 1112 21
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	isFilterFileBatch
+	mov	edx, eax
+	lea	rax, -496[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	validateCheckpointOptions
+	.loc 1 1112 20
+	test	eax, eax
+	je	.L254
+	.loc 1 1114 28
+	mov	eax, 1
+	jmp	.L233
+.L254:
+	.loc 1 1116 34
+	mov	rax, QWORD PTR -408[rbp]
+	.loc 1 1116 20
+	test	rax, rax
+	je	.L255
+	.loc 1 1117 38
+	mov	eax, DWORD PTR -460[rbp]
+	.loc 1 1117 21
+	cmp	eax, 1
+	jg	.L256
+	.loc 1 1117 68 discriminator 1
+	mov	eax, DWORD PTR -444[rbp]
+	.loc 1 1117 53 discriminator 1
+	test	eax, eax
+	jne	.L256
+	.loc 1 1117 102 discriminator 2
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 32
+	.loc 1 1117 80 discriminator 2
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	isFilterFileBatch
+	.loc 1 1117 77 discriminator 2
+	test	eax, eax
+	je	.L255
+.L256:
+	.loc 1 1119 21
+	lea	rax, .LC173[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1120 28
+	mov	eax, 1
+	jmp	.L233
+.L255:
+	.loc 1 1122 21
+	mov	eax, DWORD PTR -132[rbp]
+	.loc 1 1122 20
+	test	eax, eax
+	je	.L257
+	.loc 1 1122 46 discriminator 1
+	mov	rax, QWORD PTR -408[rbp]
+	.loc 1 1122 30 discriminator 1
+	test	rax, rax
+	jne	.L257
+	.loc 1 1124 21
+	lea	rax, .LC174[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1125 28
+	mov	eax, 1
+	jmp	.L233
+.L257:
+	.loc 1 1127 21
+	movss	xmm0, DWORD PTR -332[rbp]
+	mov	edx, DWORD PTR -336[rbp]
+	mov	esi, DWORD PTR -380[rbp]
+	mov	edi, DWORD PTR -384[rbp]
+	lea	rax, -384[rbp]
+	mov	ecx, 0
+	movaps	xmm1, xmm0
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	lmsFilter_InitVariant@PLT
+	.loc 1 1127 20
+	test	eax, eax
+	je	.L258
+	.loc 1 1130 28
+	mov	eax, 1
+	jmp	.L233
+.L258:
+	.loc 1 1132 17
+	mov	eax, DWORD PTR -336[rbp]
+	mov	edi, eax
+	call	lmsFilter_VariantName@PLT
+	mov	rsi, rax
+	lea	rax, .LC175[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1133 33
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1133 20
+	cmp	eax, 3
+	jne	.L259
+	.loc 1 1136 40
+	mov	eax, DWORD PTR -384[rbp]
+	movd	xmm0, eax
+	call	lmsFixed_StepShift@PLT
+	.loc 1 1136 37
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	mov	eax, edx
+	.loc 1 1135 21
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, eax
+	movsd	xmm0, QWORD PTR .LC176[rip]
+	divsd	xmm0, xmm1
+	movq	rbx, xmm0
+	mov	eax, DWORD PTR -384[rbp]
+	movd	xmm0, eax
+	call	lmsFixed_StepShift@PLT
+	movq	xmm0, rbx
+	mov	esi, eax
+	lea	rax, .LC177[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+.L259:
+	.loc 1 1138 33
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1138 20
+	cmp	eax, 4
+	jne	.L260
+.LBB22:
+	.loc 1 1140 57
+	mov	eax, DWORD PTR -452[rbp]
+	.loc 1 1140 101
+	test	eax, eax
+	je	.L261
+	.loc 1 1140 101 is_stmt 0 discriminator 1
+	mov	eax, DWORD PTR -452[rbp]
+	jmp	.L262
+.L261:
+	.loc 1 1140 101 discriminator 2
+	mov	eax, 32
+.L262:
+	.loc 1 1140 31 is_stmt 1 discriminator 4
+	mov	DWORD PTR -60[rbp], eax
+	.loc 1 1142 21 discriminator 4
+	mov	eax, DWORD PTR -60[rbp]
+	lea	edx, 0[0+rax*8]
+	mov	eax, DWORD PTR -60[rbp]
+	mov	esi, eax
+	lea	rax, .LC178[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L260:
+.LBE22:
+	.loc 1 1145 33
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1145 20
+	cmp	eax, 5
+	jne	.L263
+	.loc 1 1149 85
+	movss	xmm0, DWORD PTR -384[rbp]
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 1147 21
+	movsd	xmm0, QWORD PTR .LC176[rip]
+	subsd	xmm0, xmm1
+	movq	rbx, xmm0
+	.loc 1 1148 54
+	mov	eax, DWORD PTR -380[rbp]
+	.loc 1 1147 21
+	cmp	eax, 64
+	jg	.L264
+	.loc 1 1147 21 is_stmt 0 discriminator 1
+	mov	eax, 1
+	jmp	.L265
+.L264:
+	.loc 1 1147 21 discriminator 2
+	mov	eax, 2
+.L265:
+	.loc 1 1147 21 discriminator 4
+	mov	edi, eax
+	call	rlsFilter_FormName@PLT
+	movq	xmm0, rbx
+	mov	rsi, rax
+	lea	rax, .LC179[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+.L263:
+	.loc 1 1151 33 is_stmt 1
+	mov	eax, DWORD PTR -496[rbp]
+	.loc 1 1151 20
+	cmp	eax, 6
+	jne	.L266
+	.loc 1 1153 79
+	mov	eax, DWORD PTR -448[rbp]
+	.loc 1 1153 21
+	test	eax, eax
+	je	.L267
+	.loc 1 1153 21 is_stmt 0 discriminator 1
+	mov	eax, DWORD PTR -448[rbp]
+	jmp	.L268
+.L267:
+	.loc 1 1153 21 discriminator 2
+	mov	eax, 4
+.L268:
+	.loc 1 1153 21 discriminator 4
+	mov	esi, eax
+	lea	rax, .LC180[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L266:
+	.loc 1 1156 50 is_stmt 1
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 32
+	.loc 1 1156 21
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, -148[rbp]
+	lea	rcx, -144[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	expandFilterArgumentFile
+	.loc 1 1156 20
+	test	eax, eax
+	je	.L269
+	.loc 1 1158 21
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free@PLT
+	.loc 1 1159 28
+	mov	eax, 1
+	jmp	.L233
+.L269:
+	.loc 1 1161 37
+	mov	eax, DWORD PTR -148[rbp]
+	.loc 1 1161 20
+	cmp	eax, 1
+	jle	.L270
+	.loc 1 1163 37
+	mov	rax, QWORD PTR -480[rbp]
+	.loc 1 1163 24
+	test	rax, rax
+	je	.L271
+	.loc 1 1165 25
+	lea	rax, .LC181[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1166 25
+	mov	edx, DWORD PTR -148[rbp]
+	mov	rax, QWORD PTR -144[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	freeInputFiles
+	.loc 1 1167 25
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free@PLT
+	.loc 1 1168 32
+	mov	eax, 1
+	jmp	.L233
+.L271:
+	.loc 1 1170 38
+	mov	eax, DWORD PTR -460[rbp]
+	.loc 1 1170 24
+	cmp	eax, 1
+	jg	.L272
+	.loc 1 1170 68 discriminator 1
+	mov	eax, DWORD PTR -444[rbp]
+	.loc 1 1170 53 discriminator 1
+	test	eax, eax
+	je	.L273
+.L272:
+	.loc 1 1172 25
+	lea	rax, .LC182[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 1173 25
+	mov	edx, DWORD PTR -148[rbp]
+	mov	rax, QWORD PTR -144[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	freeInputFiles
+	.loc 1 1174 25
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free@PLT
+	.loc 1 1175 32
+	mov	eax, 1
+	jmp	.L233
+.L273:
+	.loc 1 1177 30
+	mov	edx, DWORD PTR -148[rbp]
+	mov	rsi, QWORD PTR -144[rbp]
+	lea	rcx, -496[rbp]
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsFilter_FilterFiles@PLT
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 1179 21
+	mov	edx, DWORD PTR -148[rbp]
+	mov	rax, QWORD PTR -144[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	freeInputFiles
+	.loc 1 1180 21
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free@PLT
+	.loc 1 1181 28
+	mov	eax, DWORD PTR -20[rbp]
+	jmp	.L233
+.L270:
+	.loc 1 1183 33
+	mov	eax, DWORD PTR -460[rbp]
+	.loc 1 1183 20
+	cmp	eax, 1
+	jle	.L274
+	.loc 1 1185 30
+	mov	rax, QWORD PTR -144[rbp]
+	mov	rcx, QWORD PTR [rax]
+	lea	rdx, -496[rbp]
+	lea	rax, -384[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_FilterInterleavedFile@PLT
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 1186 21
+	mov	edx, DWORD PTR -148[rbp]
+	mov	rax, QWORD PTR -144[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	freeInputFiles
+	.loc 1 1187 21
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free@PLT
+	.loc 1 1188 28
+	mov	eax, DWORD PTR -20[rbp]
+	jmp	.L233
+.L274:
+	.loc 1 1190 26
+	mov	rax, QWORD PTR -144[rbp]
+	mov	rcx, QWORD PTR [rax]
+	lea	rdx, -496[rbp]
+	lea	rax, -384[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	lmsFilter_FilterSignalAndSaveToFile@PLT
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 1191 17
+	mov	edx, DWORD PTR -148[rbp]
+	mov	rax, QWORD PTR -144[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	freeInputFiles
+	.loc 1 1192 17
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsFilter_Free@PLT
+	.loc 1 1194 20
+	cmp	DWORD PTR -20[rbp], 0
+	jne	.L224
+	.loc 1 1194 62 discriminator 1
+	mov	rax, QWORD PTR -408[rbp]
+	.loc 1 1194 46 discriminator 1
+	test	rax, rax
+	je	.L224
+	.loc 1 1196 21
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rsi, rax
+	lea	rax, .LC183[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1197 25
+	mov	eax, DWORD PTR -132[rbp]
+	.loc 1 1197 24
+	test	eax, eax
+	je	.L224
+	.loc 1 1199 34
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rdi, rax
+	call	lmsPlot_Open@PLT
+	mov	DWORD PTR -20[rbp], eax
+	jmp	.L224
+.L235:
+.LBE20:
+	.loc 1 1205 17
+	mov	rax, QWORD PTR -544[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	printMissingParameterError
+	.loc 1 1206 24
+	mov	eax, 1
+	jmp	.L233
+.L234:
+	.loc 1 1209 29
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 8
+	.loc 1 1209 18
+	mov	rax, QWORD PTR [rax]
+	lea	rdx, .LC184[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 1209 17
+	test	eax, eax
+	jne	.L276
+.LBB23:
+	.loc 1 1213 13
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsBench_DefaultSettings@PLT
+	.loc 1 1214 17
+	lea	rdx, -384[rbp]
+	mov	rcx, QWORD PTR -544[rbp]
+	mov	eax, DWORD PTR -532[rbp]
+	mov	rsi, rcx
+	mov	edi, eax
+	call	processBenchOptions
+	.loc 1 1214 16
+	test	eax, eax
+	je	.L277
+	.loc 1 1216 24
+	mov	eax, 1
+	jmp	.L233
+.L277:
+	.loc 1 1218 22
+	lea	rax, -384[rbp]
+	mov	rdi, rax
+	call	lmsBench_Run@PLT
+	mov	DWORD PTR -20[rbp], eax
+.LBE23:
+	jmp	.L224
+.L276:
+	.loc 1 1220 30
+	mov	rax, QWORD PTR -544[rbp]
+	add	rax, 8
+	.loc 1 1220 18
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 6
+	lea	rcx, .LC134[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	strncmp@PLT
+	.loc 1 1220 17
+	test	eax, eax
+	jne	.L278
+	.loc 1 1222 16
+	cmp	DWORD PTR -532[rbp], 2
+	jle	.L279
+.LBB24:
+	.loc 1 1224 29
+	mov	rax, QWORD PTR -544[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 1225 35
+	mov	QWORD PTR -176[rbp], 0
+	mov	DWORD PTR -168[rbp], 1024
+	.loc 1 1226 32
+	mov	DWORD PTR -180[rbp], 0
+	.loc 1 1227 23
+	mov	QWORD PTR -40[rbp], 0
+	.loc 1 1228 21
+	mov	DWORD PTR -184[rbp], 0
+	.loc 1 1230 21
+	lea	rdi, -184[rbp]
+	lea	rcx, -180[rbp]
+	lea	rdx, -176[rbp]
+	mov	rsi, QWORD PTR -544[rbp]
+	mov	eax, DWORD PTR -532[rbp]
+	mov	r8, rdi
+	mov	edi, eax
+	call	processPlotOptions
+	.loc 1 1230 20
+	test	eax, eax
+	je	.L280
+	.loc 1 1232 28
+	mov	eax, 1
+	jmp	.L233
+.L280:
+	.loc 1 1234 33
+	mov	rax, QWORD PTR -176[rbp]
+	.loc 1 1234 20
+	test	rax, rax
+	jne	.L282
+.LBB25:
+	.loc 1 1236 45
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rdx, .LC69[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 1236 103
+	test	eax, eax
+	je	.L283
+	.loc 1 1236 103 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	jmp	.L284
+.L283:
+	.loc 1 1236 103 discriminator 2
+	lea	rax, .LC185[rip]
+.L284:
+	.loc 1 1236 33 is_stmt 1 discriminator 4
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 1237 50 discriminator 4
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	strlen@PLT
+	.loc 1 1237 43 discriminator 4
+	add	rax, 6
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 1238 24 discriminator 4
+	cmp	QWORD PTR -40[rbp], 0
+	jne	.L285
+	.loc 1 1240 32
+	mov	eax, 1
+	jmp	.L233
+.L285:
+	.loc 1 1242 21
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	lea	rcx, .LC186[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	mov	eax, 0
+	call	sprintf@PLT
+	.loc 1 1243 43
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -176[rbp], rax
+.L282:
+.LBE25:
+	.loc 1 1245 26
+	mov	ecx, DWORD PTR -180[rbp]
+	lea	rdx, -176[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	esi, ecx
+	mov	rdi, rax
+	call	lmsPlot_PlotFile@PLT
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 1246 20
+	cmp	DWORD PTR -20[rbp], 0
+	jne	.L286
+	.loc 1 1248 21
+	mov	rax, QWORD PTR -176[rbp]
+	mov	rsi, rax
+	lea	rax, .LC183[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 1249 25
+	mov	eax, DWORD PTR -184[rbp]
+	.loc 1 1249 24
+	test	eax, eax
+	je	.L286
+	.loc 1 1251 34
+	mov	rax, QWORD PTR -176[rbp]
+	mov	rdi, rax
+	call	lmsPlot_Open@PLT
+	mov	DWORD PTR -20[rbp], eax
+.L286:
+	.loc 1 1254 17
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	free@PLT
+.LBE24:
+	jmp	.L224
+.L279:
+	.loc 1 1258 17
+	mov	rax, QWORD PTR -544[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	printMissingParameterError
+	.loc 1 1259 24
+	mov	eax, 1
+	jmp	.L233
+.L278:
+	.loc 1 1264 13
+	mov	rax, QWORD PTR -544[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	printArgumentError
+	.loc 1 1265 20
+	mov	eax, 1
+	jmp	.L233
+.L222:
+	.loc 1 1270 9
+	mov	rax, QWORD PTR -544[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	showUsage
+	.loc 1 1271 16
+	mov	eax, 1
+	jmp	.L233
+.L224:
+	.loc 1 1273 9
+	mov	eax, DWORD PTR -20[rbp]
+.L233:
+	.loc 1 1274 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	main, .-main
+	.section	.rodata
+	.align 4
+.LC161:
+	.long	1008981770
+	.align 4
+.LC168:
+	.long	1065353216
+	.align 4
+.LC170:
+	.long	1073741824
+	.align 8
+.LC176:
+	.long	0
+	.long	1072693248
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 8 "/usr/include/glob.h"
+	.file 9 "include/lmsAllocator.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 11 "include/lmsCheckpoint.h"
+	.file 12 "include/lmsKernel.h"
+	.file 13 "include/asyncFile.h"
+	.file 14 "include/sampleIo.h"
+	.file 15 "include/lmsPlot.h"
+	.file 16 "include/lmsRealtime.h"
+	.file 17 "include/lmsTelemetry.h"
+	.file 18 "include/lmsFilter.h"
+	.file 19 "include/rlsFilter.h"
+	.file 20 "include/lmsBench.h"
+	.file 21 "include/signalGenerator.h"
+	.file 22 "/usr/include/stdio.h"
+	.file 23 "/usr/include/stdlib.h"
+	.file 24 "/usr/include/string.h"
+	.file 25 "include/lmsFixed.h"
+	.file 26 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1d2d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF342
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x41
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x5
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x91
+	.byte	0x19
+	.long	0x3a
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x92
+	.byte	0x19
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x93
+	.byte	0x19
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x94
+	.byte	0x19
+	.long	0x3a
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x96
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x97
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x4d
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x4d
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x4d
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0x14
+	.long	0xf6
+	.uleb128 0x5
+	.long	.LASF21
+	.byte	0x3
+	.byte	0xaf
+	.byte	0x1d
+	.long	0x4d
+	.uleb128 0x5
+	.long	.LASF22
+	.byte	0x3
+	.byte	0xb4
+	.byte	0x1c
+	.long	0x4d
+	.uleb128 0x5
+	.long	.LASF23
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x21
+	.long	0x4d
+	.uleb128 0x4
+	.long	0x12b
+	.uleb128 0x14
+	.long	0x121
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF24
+	.uleb128 0xa
+	.long	0x12b
+	.uleb128 0x19
+	.long	.LASF28
+	.byte	0x10
+	.byte	0x4
+	.byte	0xb
+	.long	0x15e
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x10
+	.byte	0xc
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x15
+	.byte	0x15
+	.long	0x115
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF27
+	.uleb128 0x19
+	.long	.LASF29
+	.byte	0xd8
+	.byte	0x5
+	.byte	0x31
+	.long	0x2eb
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x33
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x5
+	.byte	0x36
+	.byte	0x9
+	.long	0x121
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x5
+	.byte	0x37
+	.byte	0x9
+	.long	0x121
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x5
+	.byte	0x38
+	.byte	0x9
+	.long	0x121
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x5
+	.byte	0x39
+	.byte	0x9
+	.long	0x121
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x9
+	.long	0x121
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x9
+	.long	0x121
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x5
+	.byte	0x3c
+	.byte	0x9
+	.long	0x121
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x5
+	.byte	0x3d
+	.byte	0x9
+	.long	0x121
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x40
+	.byte	0x9
+	.long	0x121
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x5
+	.byte	0x41
+	.byte	0x9
+	.long	0x121
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x5
+	.byte	0x42
+	.byte	0x9
+	.long	0x121
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x5
+	.byte	0x44
+	.byte	0x16
+	.long	0x304
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x5
+	.byte	0x46
+	.byte	0x14
+	.long	0x309
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x5
+	.byte	0x48
+	.byte	0x7
+	.long	0x41
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x5
+	.byte	0x49
+	.byte	0x7
+	.long	0x41
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xb
+	.long	0xd2
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x12
+	.long	0x62
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x5
+	.byte	0x4e
+	.byte	0xf
+	.long	0x70
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x5
+	.byte	0x4f
+	.byte	0x8
+	.long	0x30e
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x5
+	.byte	0x51
+	.byte	0xf
+	.long	0x31e
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0x5
+	.byte	0x59
+	.byte	0xd
+	.long	0xde
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x5
+	.byte	0x5b
+	.byte	0x17
+	.long	0x328
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x5
+	.byte	0x5c
+	.byte	0x19
+	.long	0x332
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x5
+	.byte	0x5d
+	.byte	0x14
+	.long	0x309
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x9
+	.long	0xf6
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x5
+	.byte	0x60
+	.byte	0x7
+	.long	0x41
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0x5
+	.byte	0x62
+	.byte	0x8
+	.long	0x337
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF59
+	.byte	0x6
+	.byte	0x7
+	.byte	0x19
+	.long	0x165
+	.uleb128 0x26
+	.long	.LASF343
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1c
+	.long	.LASF60
+	.uleb128 0x4
+	.long	0x2ff
+	.uleb128 0x4
+	.long	0x165
+	.uleb128 0x15
+	.long	0x12b
+	.long	0x31e
+	.uleb128 0x17
+	.long	0x3a
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x2f7
+	.uleb128 0x1c
+	.long	.LASF61
+	.uleb128 0x4
+	.long	0x323
+	.uleb128 0x1c
+	.long	.LASF62
+	.uleb128 0x4
+	.long	0x32d
+	.uleb128 0x15
+	.long	0x12b
+	.long	0x347
+	.uleb128 0x17
+	.long	0x3a
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	0x2eb
+	.uleb128 0x14
+	.long	0x347
+	.uleb128 0x4
+	.long	0x132
+	.uleb128 0x14
+	.long	0x351
+	.uleb128 0xa
+	.long	0x351
+	.uleb128 0x19
+	.long	.LASF63
+	.byte	0x90
+	.byte	0x7
+	.byte	0x1a
+	.long	0x430
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xd
+	.long	0x8a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0x7
+	.byte	0x24
+	.byte	0xd
+	.long	0xae
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xf
+	.long	0xc6
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xe
+	.long	0xba
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x7
+	.byte	0x2f
+	.byte	0xd
+	.long	0x96
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x7
+	.byte	0x30
+	.byte	0xd
+	.long	0xa2
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x7
+	.byte	0x32
+	.byte	0x9
+	.long	0x41
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x7
+	.byte	0x34
+	.byte	0xd
+	.long	0x8a
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x7
+	.byte	0x39
+	.byte	0xd
+	.long	0xd2
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x11
+	.long	0xfd
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x10
+	.long	0x109
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0x7
+	.byte	0x4a
+	.byte	0x15
+	.long	0x137
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x15
+	.long	0x137
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x15
+	.long	0x137
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0x7
+	.byte	0x59
+	.byte	0x17
+	.long	0x430
+	.byte	0x78
+	.byte	0
+	.uleb128 0x15
+	.long	0x115
+	.long	0x440
+	.uleb128 0x17
+	.long	0x3a
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.byte	0x48
+	.byte	0x8
+	.byte	0x52
+	.long	0x4be
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0x8
+	.byte	0x54
+	.byte	0xe
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0x8
+	.byte	0x55
+	.byte	0xc
+	.long	0x4be
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x8
+	.byte	0x56
+	.byte	0xe
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0x8
+	.byte	0x57
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0x8
+	.byte	0x5b
+	.byte	0xc
+	.long	0x4d3
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0x8
+	.byte	0x5f
+	.byte	0xd
+	.long	0x4e7
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0x8
+	.byte	0x61
+	.byte	0xd
+	.long	0x4fb
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0x8
+	.byte	0x66
+	.byte	0xb
+	.long	0x514
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0x8
+	.byte	0x67
+	.byte	0xb
+	.long	0x514
+	.byte	0x40
+	.byte	0
+	.uleb128 0x4
+	.long	0x121
+	.uleb128 0x14
+	.long	0x4be
+	.uleb128 0x1a
+	.long	0x4d3
+	.uleb128 0x2
+	.long	0xf6
+	.byte	0
+	.uleb128 0x4
+	.long	0x4c8
+	.uleb128 0x10
+	.long	0xf6
+	.long	0x4e7
+	.uleb128 0x2
+	.long	0xf6
+	.byte	0
+	.uleb128 0x4
+	.long	0x4d8
+	.uleb128 0x10
+	.long	0xf6
+	.long	0x4fb
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x4
+	.long	0x4ec
+	.uleb128 0x10
+	.long	0x41
+	.long	0x514
+	.uleb128 0x2
+	.long	0x356
+	.uleb128 0x2
+	.long	0xf8
+	.byte	0
+	.uleb128 0x4
+	.long	0x500
+	.uleb128 0x5
+	.long	.LASF88
+	.byte	0x8
+	.byte	0x69
+	.byte	0x5
+	.long	0x440
+	.uleb128 0xb
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF89
+	.uleb128 0xe
+	.byte	0x18
+	.byte	0x9
+	.byte	0x10
+	.long	0x55c
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0x9
+	.byte	0x13
+	.byte	0xd
+	.long	0x575
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0x9
+	.byte	0x16
+	.byte	0xc
+	.long	0x58a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0x9
+	.byte	0x18
+	.byte	0xb
+	.long	0xf6
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	0xf6
+	.long	0x575
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	0x55c
+	.uleb128 0x1a
+	.long	0x58a
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x2
+	.long	0xf6
+	.byte	0
+	.uleb128 0x4
+	.long	0x57a
+	.uleb128 0x5
+	.long	.LASF93
+	.byte	0x9
+	.byte	0x19
+	.byte	0x3
+	.long	0x52c
+	.uleb128 0xa
+	.long	0x58f
+	.uleb128 0x5
+	.long	.LASF94
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF95
+	.uleb128 0xa
+	.long	0x5ac
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF96
+	.uleb128 0x4
+	.long	0x5ac
+	.uleb128 0xe
+	.byte	0x20
+	.byte	0xb
+	.byte	0x39
+	.long	0x601
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0xb
+	.byte	0x3b
+	.byte	0x11
+	.long	0x351
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0xb
+	.byte	0x3c
+	.byte	0xa
+	.long	0x4d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0xb
+	.byte	0x3d
+	.byte	0x11
+	.long	0x351
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF100
+	.byte	0xb
+	.byte	0x3e
+	.byte	0x11
+	.long	0x351
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF101
+	.byte	0xb
+	.byte	0x3f
+	.byte	0x3
+	.long	0x5c4
+	.uleb128 0xa
+	.long	0x601
+	.uleb128 0xf
+	.long	0x69
+	.byte	0xc
+	.byte	0xf
+	.long	0x63c
+	.uleb128 0x3
+	.long	.LASF102
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF103
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF104
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF105
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF106
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF107
+	.byte	0xc
+	.byte	0x15
+	.byte	0x3
+	.long	0x612
+	.uleb128 0xe
+	.byte	0x40
+	.byte	0xc
+	.byte	0x17
+	.long	0x6b9
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0xc
+	.byte	0x19
+	.byte	0x15
+	.long	0x63c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0xc
+	.byte	0x1a
+	.byte	0x11
+	.long	0x351
+	.byte	0x8
+	.uleb128 0x1d
+	.string	"dot"
+	.byte	0xc
+	.byte	0x1d
+	.byte	0xd
+	.long	0x6d7
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0xc
+	.byte	0x20
+	.byte	0xc
+	.long	0x6f6
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0xc
+	.byte	0x23
+	.byte	0xd
+	.long	0x71e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0xc
+	.byte	0x27
+	.byte	0xd
+	.long	0x74b
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xd
+	.long	0x71e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0xc
+	.byte	0x30
+	.byte	0xc
+	.long	0x779
+	.byte	0x38
+	.byte	0
+	.uleb128 0x10
+	.long	0x5ac
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b3
+	.uleb128 0x4
+	.long	0x6b9
+	.uleb128 0x1a
+	.long	0x6f6
+	.uleb128 0x2
+	.long	0x5bf
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x5ac
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x6dc
+	.uleb128 0x10
+	.long	0x5ac
+	.long	0x71e
+	.uleb128 0x2
+	.long	0x5bf
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x5ac
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x6fb
+	.uleb128 0x10
+	.long	0x5ac
+	.long	0x74b
+	.uleb128 0x2
+	.long	0x5bf
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x5ac
+	.uleb128 0x2
+	.long	0x5ac
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x723
+	.uleb128 0x1a
+	.long	0x779
+	.uleb128 0x2
+	.long	0x5bf
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x5bf
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x750
+	.uleb128 0x5
+	.long	.LASF115
+	.byte	0xc
+	.byte	0x32
+	.byte	0x3
+	.long	0x648
+	.uleb128 0xa
+	.long	0x77e
+	.uleb128 0xf
+	.long	0x69
+	.byte	0xd
+	.byte	0x15
+	.long	0x7b9
+	.uleb128 0x3
+	.long	.LASF116
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF117
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF118
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF119
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF120
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF121
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x3
+	.long	0x78f
+	.uleb128 0xf
+	.long	0x69
+	.byte	0xe
+	.byte	0x14
+	.long	0x7f5
+	.uleb128 0x3
+	.long	.LASF122
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF123
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF124
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF125
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF126
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF127
+	.byte	0x5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF128
+	.byte	0xe
+	.byte	0x1b
+	.byte	0x3
+	.long	0x7c5
+	.uleb128 0xe
+	.byte	0x10
+	.byte	0xf
+	.byte	0x1c
+	.long	0x824
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0xf
+	.byte	0x1e
+	.byte	0x11
+	.long	0x351
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0xf
+	.byte	0x1f
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF131
+	.byte	0xf
+	.byte	0x20
+	.byte	0x3
+	.long	0x801
+	.uleb128 0xa
+	.long	0x824
+	.uleb128 0x4
+	.long	0x35b
+	.uleb128 0xe
+	.byte	0x14
+	.byte	0x10
+	.byte	0x11
+	.long	0x884
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x10
+	.byte	0x13
+	.byte	0x12
+	.long	0x69
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x10
+	.byte	0x14
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x10
+	.byte	0x15
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x1d
+	.string	"cpu"
+	.byte	0x10
+	.byte	0x16
+	.byte	0x9
+	.long	0x41
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x10
+	.byte	0x17
+	.byte	0x9
+	.long	0x41
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF136
+	.byte	0x10
+	.byte	0x18
+	.byte	0x3
+	.long	0x83a
+	.uleb128 0xa
+	.long	0x884
+	.uleb128 0xe
+	.byte	0x14
+	.byte	0x11
+	.byte	0x19
+	.long	0x8df
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0x11
+	.byte	0x1b
+	.byte	0x9
+	.long	0x41
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x11
+	.byte	0x1d
+	.byte	0xb
+	.long	0x5ac
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x11
+	.byte	0x1e
+	.byte	0xb
+	.long	0x5ac
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x11
+	.byte	0x1f
+	.byte	0xb
+	.long	0x5ac
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF142
+	.byte	0x11
+	.byte	0x20
+	.byte	0x3
+	.long	0x895
+	.uleb128 0xa
+	.long	0x8df
+	.uleb128 0xf
+	.long	0x69
+	.byte	0x12
+	.byte	0x19
+	.long	0x926
+	.uleb128 0x3
+	.long	.LASF143
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF144
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF145
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF146
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF147
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF149
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF150
+	.byte	0x12
+	.byte	0x21
+	.byte	0x3
+	.long	0x8f0
+	.uleb128 0x5
+	.long	.LASF151
+	.byte	0x12
+	.byte	0x23
+	.byte	0x1a
+	.long	0x943
+	.uleb128 0xa
+	.long	0x932
+	.uleb128 0x19
+	.long	.LASF152
+	.byte	0x70
+	.byte	0x12
+	.byte	0x29
+	.long	0xa13
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x12
+	.byte	0x2b
+	.byte	0xb
+	.long	0x5ac
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x12
+	.byte	0x2c
+	.byte	0x9
+	.long	0x41
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0x12
+	.byte	0x2d
+	.byte	0xc
+	.long	0x5bf
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0x12
+	.byte	0x2e
+	.byte	0xc
+	.long	0x5bf
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0x12
+	.byte	0x2f
+	.byte	0x9
+	.long	0x41
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0x12
+	.byte	0x30
+	.byte	0xb
+	.long	0x5ac
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0x12
+	.byte	0x31
+	.byte	0x9
+	.long	0x41
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x12
+	.byte	0x32
+	.byte	0xc
+	.long	0x5b8
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x12
+	.byte	0x33
+	.byte	0x18
+	.long	0x926
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x12
+	.byte	0x34
+	.byte	0xb
+	.long	0x5ac
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x12
+	.byte	0x35
+	.byte	0xb
+	.long	0x5ac
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x12
+	.byte	0x36
+	.byte	0x1d
+	.long	0xa13
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x12
+	.byte	0x37
+	.byte	0x18
+	.long	0xa51
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x12
+	.byte	0x38
+	.byte	0x14
+	.long	0x58f
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x12
+	.byte	0x39
+	.byte	0xb
+	.long	0xf6
+	.byte	0x68
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF168
+	.byte	0x12
+	.byte	0x26
+	.byte	0xf
+	.long	0xa1f
+	.uleb128 0x4
+	.long	0xa24
+	.uleb128 0x10
+	.long	0x41
+	.long	0xa4c
+	.uleb128 0x2
+	.long	0xa4c
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x6d2
+	.uleb128 0x2
+	.long	0x5bf
+	.uleb128 0x2
+	.long	0x5bf
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x4
+	.long	0x932
+	.uleb128 0x4
+	.long	0x78a
+	.uleb128 0xf
+	.long	0x69
+	.byte	0x12
+	.byte	0x3d
+	.long	0xa8c
+	.uleb128 0x3
+	.long	.LASF169
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF170
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF171
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF172
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF173
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF175
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF176
+	.byte	0x12
+	.byte	0x45
+	.byte	0x3
+	.long	0xa56
+	.uleb128 0xe
+	.byte	0x68
+	.byte	0x12
+	.byte	0x47
+	.long	0xb7e
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0x12
+	.byte	0x49
+	.byte	0x1a
+	.long	0xa8c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x12
+	.byte	0x4a
+	.byte	0x14
+	.long	0x7f5
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x12
+	.byte	0x4b
+	.byte	0x14
+	.long	0x7f5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x12
+	.byte	0x4c
+	.byte	0x11
+	.long	0x351
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x12
+	.byte	0x4d
+	.byte	0x11
+	.long	0x351
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x12
+	.byte	0x4e
+	.byte	0x9
+	.long	0x41
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x12
+	.byte	0x4f
+	.byte	0x9
+	.long	0x41
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x12
+	.byte	0x50
+	.byte	0x9
+	.long	0x41
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x12
+	.byte	0x51
+	.byte	0x9
+	.long	0x41
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x12
+	.byte	0x52
+	.byte	0x9
+	.long	0x41
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x12
+	.byte	0x53
+	.byte	0x9
+	.long	0x41
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x12
+	.byte	0x54
+	.byte	0x9
+	.long	0x41
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x12
+	.byte	0x55
+	.byte	0x22
+	.long	0xb7e
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x12
+	.byte	0x56
+	.byte	0x23
+	.long	0xb83
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x12
+	.byte	0x57
+	.byte	0x24
+	.long	0xb88
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x12
+	.byte	0x58
+	.byte	0x1e
+	.long	0xb8d
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x12
+	.byte	0x59
+	.byte	0x9
+	.long	0x41
+	.byte	0x60
+	.byte	0
+	.uleb128 0x4
+	.long	0x890
+	.uleb128 0x4
+	.long	0x8eb
+	.uleb128 0x4
+	.long	0x60d
+	.uleb128 0x4
+	.long	0x830
+	.uleb128 0x5
+	.long	.LASF194
+	.byte	0x12
+	.byte	0x5a
+	.byte	0x3
+	.long	0xa98
+	.uleb128 0xa
+	.long	0xb92
+	.uleb128 0x4
+	.long	0x41
+	.uleb128 0xf
+	.long	0x69
+	.byte	0x13
+	.byte	0x11
+	.long	0xbc6
+	.uleb128 0x3
+	.long	.LASF195
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF196
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF197
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF198
+	.byte	0x13
+	.byte	0x15
+	.byte	0x3
+	.long	0xba8
+	.uleb128 0xf
+	.long	0x69
+	.byte	0x14
+	.byte	0x12
+	.long	0xbf6
+	.uleb128 0x3
+	.long	.LASF199
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF200
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF201
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF202
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF203
+	.byte	0x14
+	.byte	0x17
+	.byte	0x3
+	.long	0xbd2
+	.uleb128 0xe
+	.byte	0xc0
+	.byte	0x14
+	.byte	0x19
+	.long	0xcce
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x9
+	.long	0xcce
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x9
+	.long	0x41
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x14
+	.byte	0x1d
+	.byte	0x9
+	.long	0xcce
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x9
+	.long	0x41
+	.byte	0x84
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0x14
+	.byte	0x1f
+	.byte	0xa
+	.long	0x4d
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0x14
+	.byte	0x20
+	.byte	0x9
+	.long	0x41
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0x14
+	.byte	0x21
+	.byte	0x9
+	.long	0x41
+	.byte	0x94
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0x14
+	.byte	0x22
+	.byte	0x9
+	.long	0x41
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0x14
+	.byte	0x23
+	.byte	0x9
+	.long	0x41
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF213
+	.byte	0x14
+	.byte	0x24
+	.byte	0x9
+	.long	0x41
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0x14
+	.byte	0x25
+	.byte	0x9
+	.long	0x41
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF215
+	.byte	0x14
+	.byte	0x26
+	.byte	0x9
+	.long	0x41
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF216
+	.byte	0x14
+	.byte	0x27
+	.byte	0x9
+	.long	0x41
+	.byte	0xac
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0x14
+	.byte	0x28
+	.byte	0x16
+	.long	0xbf6
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x14
+	.byte	0x29
+	.byte	0x11
+	.long	0x351
+	.byte	0xb8
+	.byte	0
+	.uleb128 0x15
+	.long	0x41
+	.long	0xcde
+	.uleb128 0x17
+	.long	0x3a
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF218
+	.byte	0x14
+	.byte	0x2a
+	.byte	0x3
+	.long	0xc02
+	.uleb128 0xa
+	.long	0xcde
+	.uleb128 0xf
+	.long	0x69
+	.byte	0x15
+	.byte	0x18
+	.long	0xd31
+	.uleb128 0x3
+	.long	.LASF219
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF220
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF221
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF222
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF223
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF225
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF226
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF227
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF228
+	.byte	0x15
+	.byte	0x22
+	.byte	0x3
+	.long	0xcef
+	.uleb128 0xe
+	.byte	0x30
+	.byte	0x15
+	.byte	0x24
+	.long	0xdbb
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0x15
+	.byte	0x26
+	.byte	0x17
+	.long	0xd31
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF229
+	.byte	0x15
+	.byte	0x27
+	.byte	0x12
+	.long	0x69
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0x15
+	.byte	0x28
+	.byte	0x12
+	.long	0x69
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0x15
+	.byte	0x29
+	.byte	0x14
+	.long	0x7f5
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF231
+	.byte	0x15
+	.byte	0x2a
+	.byte	0xb
+	.long	0x5ac
+	.byte	0x10
+	.uleb128 0x1d
+	.string	"snr"
+	.byte	0x15
+	.byte	0x2b
+	.byte	0xb
+	.long	0x5ac
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF232
+	.byte	0x15
+	.byte	0x2c
+	.byte	0x12
+	.long	0x69
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF233
+	.byte	0x15
+	.byte	0x2d
+	.byte	0xe
+	.long	0x5a0
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x15
+	.byte	0x2e
+	.byte	0x9
+	.long	0x41
+	.byte	0x28
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF234
+	.byte	0x15
+	.byte	0x2f
+	.byte	0x3
+	.long	0xd3d
+	.uleb128 0xa
+	.long	0xdbb
+	.uleb128 0xf
+	.long	0x69
+	.byte	0x1
+	.byte	0x1d
+	.long	0xdf0
+	.uleb128 0x3
+	.long	.LASF235
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF236
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF237
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF238
+	.byte	0x5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF239
+	.byte	0x1
+	.byte	0x22
+	.byte	0x3
+	.long	0xdcc
+	.uleb128 0xf
+	.long	0x69
+	.byte	0x1
+	.byte	0x25
+	.long	0xe1a
+	.uleb128 0x3
+	.long	.LASF240
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF241
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF242
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF243
+	.byte	0x1
+	.byte	0x29
+	.byte	0x3
+	.long	0xdfc
+	.uleb128 0x15
+	.long	0x35b
+	.long	0xe36
+	.uleb128 0x17
+	.long	0x3a
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xa
+	.long	0xe26
+	.uleb128 0x12
+	.long	.LASF244
+	.byte	0x2e
+	.byte	0x1a
+	.long	0xe36
+	.uleb128 0x9
+	.byte	0x3
+	.quad	usage
+	.uleb128 0x15
+	.long	0x132
+	.long	0xe60
+	.uleb128 0x17
+	.long	0x3a
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	0xe50
+	.uleb128 0x12
+	.long	.LASF245
+	.byte	0x72
+	.byte	0x13
+	.long	0xe60
+	.uleb128 0x9
+	.byte	0x3
+	.quad	illegalFilenameChars
+	.uleb128 0x7
+	.long	.LASF246
+	.byte	0xf
+	.byte	0x58
+	.byte	0x5
+	.long	0x41
+	.long	0xe9a
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0x7f5
+	.uleb128 0x2
+	.long	0xb8d
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF247
+	.byte	0x16
+	.value	0x166
+	.byte	0xc
+	.long	0x41
+	.long	0xeb7
+	.uleb128 0x2
+	.long	0x121
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF248
+	.byte	0x17
+	.value	0x229
+	.byte	0xe
+	.long	0xf6
+	.long	0xece
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF249
+	.byte	0x18
+	.value	0x197
+	.byte	0xf
+	.long	0x2e
+	.long	0xee5
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF250
+	.byte	0x14
+	.byte	0x4b
+	.byte	0x5
+	.long	0x41
+	.long	0xefb
+	.uleb128 0x2
+	.long	0xefb
+	.byte	0
+	.uleb128 0x4
+	.long	0xcea
+	.uleb128 0x18
+	.long	.LASF255
+	.byte	0x14
+	.byte	0x30
+	.byte	0x6
+	.long	0xf12
+	.uleb128 0x2
+	.long	0xf12
+	.byte	0
+	.uleb128 0x4
+	.long	0xcde
+	.uleb128 0x7
+	.long	.LASF251
+	.byte	0xf
+	.byte	0x5f
+	.byte	0x5
+	.long	0x41
+	.long	0xf2d
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF252
+	.byte	0x12
+	.byte	0xfd
+	.byte	0x5
+	.long	0x41
+	.long	0xf4d
+	.uleb128 0x2
+	.long	0xa4c
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0xf4d
+	.byte	0
+	.uleb128 0x4
+	.long	0xb9e
+	.uleb128 0xc
+	.long	.LASF253
+	.byte	0x12
+	.value	0x10b
+	.byte	0x5
+	.long	0x41
+	.long	0xf73
+	.uleb128 0x2
+	.long	0xf73
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0xf4d
+	.byte	0
+	.uleb128 0x4
+	.long	0x93e
+	.uleb128 0xc
+	.long	.LASF254
+	.byte	0x12
+	.value	0x117
+	.byte	0x5
+	.long	0x41
+	.long	0xf9e
+	.uleb128 0x2
+	.long	0xf73
+	.uleb128 0x2
+	.long	0x835
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0xf4d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF256
+	.byte	0x12
+	.byte	0x89
+	.byte	0x6
+	.long	0xfb0
+	.uleb128 0x2
+	.long	0xa4c
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF257
+	.byte	0x13
+	.byte	0x63
+	.byte	0xd
+	.long	0x351
+	.long	0xfc6
+	.uleb128 0x2
+	.long	0xbc6
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF258
+	.byte	0x19
+	.byte	0x54
+	.byte	0x5
+	.long	0x41
+	.long	0xfdc
+	.uleb128 0x2
+	.long	0x5ac
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF259
+	.byte	0x12
+	.byte	0xd9
+	.byte	0xd
+	.long	0x351
+	.long	0xff2
+	.uleb128 0x2
+	.long	0x926
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF260
+	.byte	0x12
+	.byte	0x7b
+	.byte	0x5
+	.long	0x41
+	.long	0x1021
+	.uleb128 0x2
+	.long	0xa4c
+	.uleb128 0x2
+	.long	0x5ac
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x926
+	.uleb128 0x2
+	.long	0x5ac
+	.uleb128 0x2
+	.long	0x1021
+	.byte	0
+	.uleb128 0x4
+	.long	0x59b
+	.uleb128 0x18
+	.long	.LASF261
+	.byte	0x11
+	.byte	0x4e
+	.byte	0x6
+	.long	0x1038
+	.uleb128 0x2
+	.long	0x1038
+	.byte	0
+	.uleb128 0x4
+	.long	0x8df
+	.uleb128 0x7
+	.long	.LASF262
+	.byte	0x15
+	.byte	0x71
+	.byte	0x5
+	.long	0x41
+	.long	0x1058
+	.uleb128 0x2
+	.long	0x1058
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x4
+	.long	0xdc7
+	.uleb128 0x18
+	.long	.LASF263
+	.byte	0x15
+	.byte	0x36
+	.byte	0x6
+	.long	0x106f
+	.uleb128 0x2
+	.long	0x106f
+	.byte	0
+	.uleb128 0x4
+	.long	0xdbb
+	.uleb128 0x7
+	.long	.LASF264
+	.byte	0x18
+	.byte	0x9f
+	.byte	0xc
+	.long	0x41
+	.long	0x1094
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF265
+	.byte	0x12
+	.byte	0xe7
+	.byte	0x7
+	.long	0x5ac
+	.long	0x10aa
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF266
+	.byte	0x12
+	.byte	0xcb
+	.byte	0xe
+	.long	0x69
+	.long	0x10c0
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF267
+	.byte	0x14
+	.byte	0x37
+	.byte	0x12
+	.long	0xbf6
+	.long	0x10d6
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF268
+	.byte	0x14
+	.byte	0x40
+	.byte	0x5
+	.long	0x41
+	.long	0x10f6
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0xba3
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF269
+	.byte	0x17
+	.byte	0x6c
+	.byte	0x11
+	.long	0x4d
+	.long	0x110c
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF270
+	.byte	0x12
+	.byte	0xe0
+	.byte	0x16
+	.long	0xa8c
+	.long	0x1122
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF271
+	.byte	0x12
+	.byte	0xd2
+	.byte	0x14
+	.long	0x926
+	.long	0x1138
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF272
+	.byte	0x17
+	.byte	0x69
+	.byte	0xc
+	.long	0x41
+	.long	0x114e
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF273
+	.byte	0x17
+	.byte	0xce
+	.byte	0x1f
+	.long	0x15e
+	.long	0x116e
+	.uleb128 0x2
+	.long	0x356
+	.uleb128 0x2
+	.long	0x4c3
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF274
+	.byte	0x17
+	.byte	0x66
+	.byte	0xf
+	.long	0x5b8
+	.long	0x1184
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF275
+	.byte	0xe
+	.byte	0x5f
+	.byte	0x6
+	.long	0x1196
+	.uleb128 0x2
+	.long	0x7b9
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF276
+	.byte	0xd
+	.byte	0x63
+	.byte	0x14
+	.long	0x7b9
+	.long	0x11ac
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF277
+	.byte	0xe
+	.byte	0x49
+	.byte	0x10
+	.long	0x7f5
+	.long	0x11c2
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF278
+	.byte	0x15
+	.byte	0x4b
+	.byte	0xe
+	.long	0x69
+	.long	0x11d8
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF279
+	.byte	0x15
+	.byte	0x44
+	.byte	0xe
+	.long	0x69
+	.long	0x11ee
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF280
+	.byte	0x15
+	.byte	0x3d
+	.byte	0x13
+	.long	0xd31
+	.long	0x1204
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF281
+	.byte	0x8
+	.byte	0x97
+	.byte	0xd
+	.long	0x1216
+	.uleb128 0x2
+	.long	0x1216
+	.byte	0
+	.uleb128 0x4
+	.long	0x519
+	.uleb128 0x14
+	.long	0x1216
+	.uleb128 0x7
+	.long	.LASF282
+	.byte	0x8
+	.byte	0x92
+	.byte	0xc
+	.long	0x41
+	.long	0x1245
+	.uleb128 0x2
+	.long	0x356
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x1245
+	.uleb128 0x2
+	.long	0x121b
+	.byte	0
+	.uleb128 0x4
+	.long	0x124a
+	.uleb128 0x10
+	.long	0x41
+	.long	0x125e
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0x41
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF283
+	.byte	0x16
+	.byte	0xb2
+	.byte	0xc
+	.long	0x41
+	.long	0x1274
+	.uleb128 0x2
+	.long	0x347
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF284
+	.byte	0x16
+	.value	0x250
+	.byte	0xe
+	.long	0x121
+	.long	0x1295
+	.uleb128 0x2
+	.long	0x126
+	.uleb128 0x2
+	.long	0x41
+	.uleb128 0x2
+	.long	0x34c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF285
+	.byte	0x18
+	.value	0x125
+	.byte	0xf
+	.long	0x2e
+	.long	0x12b1
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF286
+	.byte	0x16
+	.value	0x324
+	.long	0x12c3
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF287
+	.byte	0x16
+	.value	0x102
+	.byte	0xe
+	.long	0x347
+	.long	0x12df
+	.uleb128 0x2
+	.long	0x356
+	.uleb128 0x2
+	.long	0x356
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF288
+	.byte	0x17
+	.value	0x238
+	.long	0x12f1
+	.uleb128 0x2
+	.long	0xf6
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF289
+	.byte	0x18
+	.byte	0xbb
+	.byte	0xe
+	.long	0x121
+	.long	0x1307
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF290
+	.byte	0x17
+	.value	0x234
+	.byte	0xe
+	.long	0xf6
+	.long	0x1323
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF291
+	.byte	0x18
+	.value	0x143
+	.byte	0xe
+	.long	0x121
+	.long	0x133f
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF63
+	.byte	0x1a
+	.byte	0xcd
+	.byte	0xc
+	.long	0x41
+	.long	0x135a
+	.uleb128 0x2
+	.long	0x356
+	.uleb128 0x2
+	.long	0x135f
+	.byte	0
+	.uleb128 0x4
+	.long	0x360
+	.uleb128 0x14
+	.long	0x135a
+	.uleb128 0x7
+	.long	.LASF292
+	.byte	0x18
+	.byte	0x9c
+	.byte	0xc
+	.long	0x41
+	.long	0x137f
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x2
+	.long	0x351
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF293
+	.byte	0x16
+	.value	0x164
+	.byte	0xc
+	.long	0x41
+	.long	0x1397
+	.uleb128 0x2
+	.long	0x351
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF344
+	.byte	0x1
+	.value	0x3cc
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15c2
+	.uleb128 0x8
+	.long	.LASF294
+	.value	0x3cc
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -548
+	.uleb128 0x8
+	.long	.LASF295
+	.value	0x3cc
+	.byte	0x1b
+	.long	0x4be
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -560
+	.uleb128 0x6
+	.long	.LASF296
+	.value	0x3ce
+	.byte	0x6
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x16
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.long	0x142e
+	.uleb128 0x6
+	.long	.LASF297
+	.value	0x3de
+	.byte	0x23
+	.long	0xdbb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.uleb128 0x9
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0x11
+	.string	"i"
+	.value	0x3e2
+	.byte	0x1a
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.long	0x1519
+	.uleb128 0x6
+	.long	.LASF298
+	.value	0x3f9
+	.byte	0x1d
+	.long	0x932
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.uleb128 0x6
+	.long	.LASF299
+	.value	0x3fa
+	.byte	0x29
+	.long	0xb92
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -512
+	.uleb128 0x6
+	.long	.LASF300
+	.value	0x40b
+	.byte	0x27
+	.long	0x884
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x6
+	.long	.LASF301
+	.value	0x410
+	.byte	0x28
+	.long	0x8df
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x6
+	.long	.LASF302
+	.value	0x411
+	.byte	0x29
+	.long	0x601
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -544
+	.uleb128 0x6
+	.long	.LASF303
+	.value	0x415
+	.byte	0x23
+	.long	0x824
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x6
+	.long	.LASF304
+	.value	0x416
+	.byte	0x15
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -148
+	.uleb128 0x6
+	.long	.LASF305
+	.value	0x417
+	.byte	0x18
+	.long	0x4be
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x6
+	.long	.LASF306
+	.value	0x418
+	.byte	0x15
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -164
+	.uleb128 0x16
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.long	0x14f6
+	.uleb128 0x11
+	.string	"i"
+	.value	0x41c
+	.byte	0x1a
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.uleb128 0x9
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.uleb128 0x6
+	.long	.LASF185
+	.value	0x474
+	.byte	0x1f
+	.long	0x48
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.long	0x153f
+	.uleb128 0x6
+	.long	.LASF307
+	.value	0x4bb
+	.byte	0x20
+	.long	0xcde
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.byte	0
+	.uleb128 0x9
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.uleb128 0x6
+	.long	.LASF308
+	.value	0x4c8
+	.byte	0x1d
+	.long	0x351
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF303
+	.value	0x4c9
+	.byte	0x23
+	.long	0x824
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x6
+	.long	.LASF217
+	.value	0x4ca
+	.byte	0x20
+	.long	0x7f5
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -196
+	.uleb128 0x6
+	.long	.LASF309
+	.value	0x4cb
+	.byte	0x17
+	.long	0x121
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF304
+	.value	0x4cc
+	.byte	0x15
+	.long	0x41
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0x9
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.uleb128 0x6
+	.long	.LASF310
+	.value	0x4d4
+	.byte	0x21
+	.long	0x351
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF312
+	.value	0x39f
+	.long	0x41
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1620
+	.uleb128 0x1e
+	.string	"arg"
+	.value	0x39f
+	.byte	0x2e
+	.long	0x121
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF311
+	.value	0x39f
+	.byte	0x3f
+	.long	0xe1a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x8
+	.long	.LASF298
+	.value	0x39f
+	.byte	0x53
+	.long	0xa4c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF296
+	.value	0x3a1
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF313
+	.value	0x372
+	.long	0x41
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16ad
+	.uleb128 0x8
+	.long	.LASF294
+	.value	0x372
+	.byte	0x23
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x8
+	.long	.LASF295
+	.value	0x372
+	.byte	0x30
+	.long	0x4be
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.long	.LASF314
+	.value	0x372
+	.byte	0x49
+	.long	0x16ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.long	.LASF217
+	.value	0x372
+	.byte	0x63
+	.long	0x16b2
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.long	.LASF304
+	.value	0x372
+	.byte	0x70
+	.long	0xba3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x9
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.uleb128 0x11
+	.string	"i"
+	.value	0x374
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x824
+	.uleb128 0x4
+	.long	0x7f5
+	.uleb128 0x13
+	.long	.LASF315
+	.value	0x30c
+	.long	0x41
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1725
+	.uleb128 0x8
+	.long	.LASF294
+	.value	0x30c
+	.byte	0x24
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x8
+	.long	.LASF295
+	.value	0x30c
+	.byte	0x31
+	.long	0x4be
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.long	.LASF314
+	.value	0x30c
+	.byte	0x4b
+	.long	0xf12
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x11
+	.string	"i"
+	.value	0x30e
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF316
+	.value	0x20d
+	.long	0x41
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1835
+	.uleb128 0x8
+	.long	.LASF294
+	.value	0x20d
+	.byte	0x25
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x8
+	.long	.LASF295
+	.value	0x20d
+	.byte	0x32
+	.long	0x4be
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.long	.LASF298
+	.value	0x20d
+	.byte	0x45
+	.long	0xa4c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.long	.LASF314
+	.value	0x20d
+	.byte	0x66
+	.long	0x1835
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.long	.LASF189
+	.value	0x20e
+	.byte	0x38
+	.long	0x183a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x8
+	.long	.LASF190
+	.value	0x20e
+	.byte	0x5a
+	.long	0x1038
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x8
+	.long	.LASF191
+	.value	0x20f
+	.byte	0x3a
+	.long	0x183f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 0
+	.uleb128 0x8
+	.long	.LASF192
+	.value	0x20f
+	.byte	0x59
+	.long	0x16ad
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 8
+	.uleb128 0x8
+	.long	.LASF304
+	.value	0x20f
+	.byte	0x64
+	.long	0xba3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 16
+	.uleb128 0x9
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.uleb128 0x11
+	.string	"i"
+	.value	0x211
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x16
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.long	0x1812
+	.uleb128 0x6
+	.long	.LASF132
+	.value	0x280
+	.byte	0x11
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x9
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.uleb128 0x6
+	.long	.LASF317
+	.value	0x2ec
+	.byte	0x20
+	.long	0x7b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xb92
+	.uleb128 0x4
+	.long	0x884
+	.uleb128 0x4
+	.long	0x601
+	.uleb128 0x13
+	.long	.LASF318
+	.value	0x1d6
+	.long	0x41
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18a2
+	.uleb128 0x8
+	.long	.LASF314
+	.value	0x1d6
+	.byte	0x45
+	.long	0xf4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF319
+	.value	0x1d6
+	.byte	0x53
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x6
+	.long	.LASF191
+	.value	0x1d8
+	.byte	0x24
+	.long	0xb88
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.long	.LASF320
+	.value	0x1d9
+	.byte	0xf
+	.long	0x48
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF321
+	.value	0x190
+	.long	0x41
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1931
+	.uleb128 0x8
+	.long	.LASF294
+	.value	0x190
+	.byte	0x27
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x8
+	.long	.LASF295
+	.value	0x190
+	.byte	0x34
+	.long	0x4be
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.long	.LASF314
+	.value	0x190
+	.byte	0x4d
+	.long	0x106f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0x11
+	.string	"i"
+	.value	0x192
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x9
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x6
+	.long	.LASF317
+	.value	0x19e
+	.byte	0x20
+	.long	0x7b9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF322
+	.value	0x15d
+	.long	0x41
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x198f
+	.uleb128 0x1e
+	.string	"arg"
+	.value	0x15d
+	.byte	0x30
+	.long	0x121
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF311
+	.value	0x15d
+	.byte	0x43
+	.long	0xdf0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x8
+	.long	.LASF314
+	.value	0x15d
+	.byte	0x5d
+	.long	0x106f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF296
+	.value	0x15f
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF323
+	.value	0x10f
+	.long	0x41
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a98
+	.uleb128 0x1e
+	.string	"arg"
+	.value	0x10f
+	.byte	0x31
+	.long	0x351
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4168
+	.uleb128 0x8
+	.long	.LASF324
+	.value	0x10f
+	.byte	0x3e
+	.long	0x1a98
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4176
+	.uleb128 0x8
+	.long	.LASF325
+	.value	0x10f
+	.byte	0x4e
+	.long	0xba3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4184
+	.uleb128 0x6
+	.long	.LASF296
+	.value	0x111
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x6
+	.long	.LASF326
+	.value	0x112
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x16
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.long	0x1a33
+	.uleb128 0x6
+	.long	.LASF327
+	.value	0x11e
+	.byte	0xf
+	.long	0x347
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF328
+	.value	0x11f
+	.byte	0xe
+	.long	0x1a9d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.byte	0
+	.uleb128 0x16
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.long	0x1a78
+	.uleb128 0x6
+	.long	.LASF329
+	.value	0x132
+	.byte	0x10
+	.long	0x519
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x9
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x11
+	.string	"i"
+	.value	0x139
+	.byte	0x15
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x11
+	.string	"i"
+	.value	0x145
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x4be
+	.uleb128 0x15
+	.long	0x12b
+	.long	0x1aae
+	.uleb128 0x28
+	.long	0x3a
+	.value	0xfff
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF338
+	.byte	0xfe
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b06
+	.uleb128 0xd
+	.long	.LASF324
+	.byte	0xfe
+	.byte	0x23
+	.long	0x4be
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.long	.LASF325
+	.byte	0xfe
+	.byte	0x32
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x9
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0x11
+	.string	"i"
+	.value	0x100
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF330
+	.byte	0xe3
+	.long	0x41
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b8f
+	.uleb128 0xd
+	.long	.LASF324
+	.byte	0xe3
+	.byte	0x24
+	.long	0x1a98
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xd
+	.long	.LASF325
+	.byte	0xe3
+	.byte	0x34
+	.long	0xba3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xd
+	.long	.LASF326
+	.byte	0xe3
+	.byte	0x45
+	.long	0xba3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xd
+	.long	.LASF129
+	.byte	0xe3
+	.byte	0x5b
+	.long	0x351
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x9
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x12
+	.long	.LASF331
+	.byte	0xe7
+	.byte	0xd
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x12
+	.long	.LASF332
+	.byte	0xe8
+	.byte	0x10
+	.long	0x4be
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF333
+	.byte	0xda
+	.long	0x41
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1bbf
+	.uleb128 0x29
+	.string	"arg"
+	.byte	0x1
+	.byte	0xda
+	.byte	0x2a
+	.long	0x351
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF334
+	.byte	0xbc
+	.long	0x41
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c0c
+	.uleb128 0xd
+	.long	.LASF335
+	.byte	0xbc
+	.byte	0x31
+	.long	0x351
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x12
+	.long	.LASF296
+	.byte	0xbe
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x12
+	.long	.LASF336
+	.byte	0xbf
+	.byte	0x11
+	.long	0x360
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF337
+	.byte	0xa0
+	.long	0x41
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ca3
+	.uleb128 0xd
+	.long	.LASF335
+	.byte	0xa0
+	.byte	0x34
+	.long	0x351
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.long	.LASF296
+	.byte	0xa2
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x9
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x20
+	.string	"i"
+	.byte	0xa4
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x9
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x20
+	.string	"j"
+	.byte	0xa6
+	.byte	0x1b
+	.long	0x69
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x9
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x20
+	.string	"n"
+	.byte	0xab
+	.byte	0x23
+	.long	0x69
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF339
+	.byte	0x95
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cce
+	.uleb128 0xd
+	.long	.LASF340
+	.byte	0x95
+	.byte	0x34
+	.long	0x351
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF341
+	.byte	0x8b
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cf9
+	.uleb128 0xd
+	.long	.LASF340
+	.byte	0x8b
+	.byte	0x2c
+	.long	0x351
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF345
+	.byte	0x1
+	.byte	0x7b
+	.byte	0xd
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xd
+	.long	.LASF340
+	.byte	0x7b
+	.byte	0x23
+	.long	0x351
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x12
+	.long	.LASF311
+	.byte	0x7d
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF221:
+	.string	"GEN_SIGNAL_SQUARE"
+.LASF78:
+	.string	"__glibc_reserved"
+.LASF77:
+	.string	"st_ctim"
+.LASF178:
+	.string	"inputFormat"
+.LASF10:
+	.string	"size_t"
+.LASF103:
+	.string	"LMS_KERNEL_SSE2"
+.LASF228:
+	.string	"TypeOfGenSignal_t"
+.LASF284:
+	.string	"fgets"
+.LASF177:
+	.string	"algorithm"
+.LASF193:
+	.string	"quiet"
+.LASF151:
+	.string	"LmsFilter_t"
+.LASF165:
+	.string	"kernel"
+.LASF73:
+	.string	"st_blksize"
+.LASF74:
+	.string	"st_blocks"
+.LASF99:
+	.string	"resumeFileName"
+.LASF61:
+	.string	"_IO_codecvt"
+.LASF336:
+	.string	"fileStat"
+.LASF315:
+	.string	"processBenchOptions"
+.LASF187:
+	.string	"useBank"
+.LASF324:
+	.string	"fileNames"
+.LASF41:
+	.string	"_IO_save_end"
+.LASF129:
+	.string	"fileName"
+.LASF171:
+	.string	"LMS_FILTER_ALGORITHM_FDAF"
+.LASF229:
+	.string	"cycles"
+.LASF14:
+	.string	"__gid_t"
+.LASF210:
+	.string	"warmupTrials"
+.LASF114:
+	.string	"bankUpdateDot"
+.LASF76:
+	.string	"st_mtim"
+.LASF225:
+	.string	"GEN_SIGNAL_PINK"
+.LASF115:
+	.string	"LmsKernel_t"
+.LASF319:
+	.string	"batch"
+.LASF202:
+	.string	"LMS_BENCH_FORMAT_JSON"
+.LASF34:
+	.string	"_IO_write_base"
+.LASF308:
+	.string	"filteredFileName"
+.LASF50:
+	.string	"_lock"
+.LASF164:
+	.string	"processBlock"
+.LASF314:
+	.string	"settings"
+.LASF97:
+	.string	"saveFileName"
+.LASF299:
+	.string	"fileSettings"
+.LASF200:
+	.string	"LMS_BENCH_FORMAT_TABLE"
+.LASF108:
+	.string	"type"
+.LASF63:
+	.string	"stat"
+.LASF79:
+	.string	"gl_pathc"
+.LASF39:
+	.string	"_IO_save_base"
+.LASF274:
+	.string	"atof"
+.LASF180:
+	.string	"outputFileName"
+.LASF80:
+	.string	"gl_pathv"
+.LASF345:
+	.string	"showUsage"
+.LASF175:
+	.string	"LMS_FILTER_ALGORITHM_APA"
+.LASF128:
+	.string	"SampleFormat_t"
+.LASF43:
+	.string	"_chain"
+.LASF179:
+	.string	"outputFormat"
+.LASF207:
+	.string	"numOfBlockSizes"
+.LASF47:
+	.string	"_cur_column"
+.LASF220:
+	.string	"GEN_SIGNAL_SINE"
+.LASF262:
+	.string	"signalGenerator_generateSignal"
+.LASF12:
+	.string	"__dev_t"
+.LASF98:
+	.string	"interval"
+.LASF272:
+	.string	"atoi"
+.LASF269:
+	.string	"atol"
+.LASF321:
+	.string	"processGenerateOptions"
+.LASF198:
+	.string	"RlsFilterForm_t"
+.LASF323:
+	.string	"expandFilterArgumentFile"
+.LASF111:
+	.string	"updateDot"
+.LASF104:
+	.string	"LMS_KERNEL_AVX2"
+.LASF3:
+	.string	"long int"
+.LASF265:
+	.string	"lmsFilter_processArgumentStepSize"
+.LASF147:
+	.string	"LMS_FILTER_VARIANT_SIGN_DATA"
+.LASF60:
+	.string	"_IO_marker"
+.LASF344:
+	.string	"main"
+.LASF116:
+	.string	"ASYNC_FILE_BACKEND_UNKNOWN"
+.LASF138:
+	.string	"longWindow"
+.LASF320:
+	.string	"multiChannel"
+.LASF233:
+	.string	"seed"
+.LASF213:
+	.string	"includeFixed"
+.LASF142:
+	.string	"LmsTelemetrySettings_t"
+.LASF192:
+	.string	"plot"
+.LASF236:
+	.string	"GENERATE_ARG_RESOLUTION"
+.LASF8:
+	.string	"signed char"
+.LASF21:
+	.string	"__blksize_t"
+.LASF163:
+	.string	"leak"
+.LASF29:
+	.string	"_IO_FILE"
+.LASF62:
+	.string	"_IO_wide_data"
+.LASF68:
+	.string	"st_uid"
+.LASF92:
+	.string	"context"
+.LASF153:
+	.string	"step"
+.LASF118:
+	.string	"ASYNC_FILE_BACKEND_URING"
+.LASF5:
+	.string	"unsigned char"
+.LASF54:
+	.string	"_freeres_list"
+.LASF71:
+	.string	"st_rdev"
+.LASF283:
+	.string	"fclose"
+.LASF145:
+	.string	"LMS_FILTER_VARIANT_LEAKY"
+.LASF254:
+	.string	"lmsFilter_FilterFiles"
+.LASF290:
+	.string	"realloc"
+.LASF110:
+	.string	"update"
+.LASF100:
+	.string	"warmStartFileName"
+.LASF208:
+	.string	"numOfSamples"
+.LASF241:
+	.string	"FILTER_ARG_STEP_SIZE"
+.LASF159:
+	.string	"pendingUpdate"
+.LASF23:
+	.string	"__syscall_slong_t"
+.LASF259:
+	.string	"lmsFilter_VariantName"
+.LASF186:
+	.string	"projectionOrder"
+.LASF161:
+	.string	"variant"
+.LASF127:
+	.string	"SAMPLE_FORMAT_WAV_F32"
+.LASF240:
+	.string	"FILTER_ARG_LENGTH"
+.LASF209:
+	.string	"trials"
+.LASF24:
+	.string	"char"
+.LASF255:
+	.string	"lmsBench_DefaultSettings"
+.LASF122:
+	.string	"SAMPLE_FORMAT_UNKNOWN"
+.LASF168:
+	.string	"LmsFilterProcessBlock_t"
+.LASF326:
+	.string	"capacity"
+.LASF343:
+	.string	"_IO_lock_t"
+.LASF152:
+	.string	"LmsFilter"
+.LASF133:
+	.string	"blockSize"
+.LASF90:
+	.string	"allocate"
+.LASF16:
+	.string	"__mode_t"
+.LASF215:
+	.string	"includeRls"
+.LASF31:
+	.string	"_IO_read_ptr"
+.LASF206:
+	.string	"blockSizes"
+.LASF276:
+	.string	"asyncFile_ProcessArgumentBackend"
+.LASF292:
+	.string	"strcmp"
+.LASF87:
+	.string	"gl_stat"
+.LASF312:
+	.string	"processArgsToStartFiltering"
+.LASF125:
+	.string	"SAMPLE_FORMAT_S16"
+.LASF42:
+	.string	"_markers"
+.LASF85:
+	.string	"gl_opendir"
+.LASF82:
+	.string	"gl_flags"
+.LASF293:
+	.string	"printf"
+.LASF123:
+	.string	"SAMPLE_FORMAT_TEXT"
+.LASF203:
+	.string	"LmsBenchFormat_t"
+.LASF327:
+	.string	"listFile"
+.LASF188:
+	.string	"pipelined"
+.LASF167:
+	.string	"memory"
+.LASF143:
+	.string	"LMS_FILTER_VARIANT_LMS"
+.LASF205:
+	.string	"numOfLengths"
+.LASF335:
+	.string	"filename"
+.LASF120:
+	.string	"ASYNC_FILE_BACKEND_STDIO"
+.LASF201:
+	.string	"LMS_BENCH_FORMAT_CSV"
+.LASF322:
+	.string	"processArgsToGenerateWaveform"
+.LASF51:
+	.string	"_offset"
+.LASF301:
+	.string	"telemetrySettings"
+.LASF266:
+	.string	"lmsFilter_processArgumentFilterLength"
+.LASF243:
+	.string	"ArgFilter_t"
+.LASF69:
+	.string	"st_gid"
+.LASF311:
+	.string	"index"
+.LASF304:
+	.string	"openPlot"
+.LASF169:
+	.string	"LMS_FILTER_ALGORITHM_UNKNOWN"
+.LASF155:
+	.string	"coefficients"
+.LASF174:
+	.string	"LMS_FILTER_ALGORITHM_RLS"
+.LASF11:
+	.string	"__uint64_t"
+.LASF232:
+	.string	"endResolution"
+.LASF285:
+	.string	"strcspn"
+.LASF2:
+	.string	"long unsigned int"
+.LASF217:
+	.string	"format"
+.LASF119:
+	.string	"ASYNC_FILE_BACKEND_THREAD"
+.LASF45:
+	.string	"_flags2"
+.LASF340:
+	.string	"target"
+.LASF72:
+	.string	"st_size"
+.LASF196:
+	.string	"RLS_FILTER_FORM_DIRECT"
+.LASF33:
+	.string	"_IO_read_base"
+.LASF271:
+	.string	"lmsFilter_processArgumentVariant"
+.LASF117:
+	.string	"ASYNC_FILE_BACKEND_AUTO"
+.LASF107:
+	.string	"LmsKernelType_t"
+.LASF328:
+	.string	"line"
+.LASF224:
+	.string	"GEN_SIGNAL_WHITE"
+.LASF58:
+	.string	"_unused2"
+.LASF242:
+	.string	"FILTER_ARG_FILE"
+.LASF214:
+	.string	"includeSubband"
+.LASF247:
+	.string	"sprintf"
+.LASF141:
+	.string	"divergenceMargin"
+.LASF140:
+	.string	"convergenceLevel"
+.LASF338:
+	.string	"freeInputFiles"
+.LASF294:
+	.string	"argc"
+.LASF46:
+	.string	"_old_offset"
+.LASF173:
+	.string	"LMS_FILTER_ALGORITHM_SUBBAND"
+.LASF250:
+	.string	"lmsBench_Run"
+.LASF296:
+	.string	"retval"
+.LASF295:
+	.string	"argv"
+.LASF105:
+	.string	"LMS_KERNEL_AVX512"
+.LASF22:
+	.string	"__blkcnt_t"
+.LASF156:
+	.string	"delayLine"
+.LASF170:
+	.string	"LMS_FILTER_ALGORITHM_LMS"
+.LASF223:
+	.string	"GEN_SIGNAL_CHIRP"
+.LASF139:
+	.string	"convergenceMargin"
+.LASF146:
+	.string	"LMS_FILTER_VARIANT_SIGN_ERROR"
+.LASF15:
+	.string	"__ino_t"
+.LASF341:
+	.string	"printArgumentError"
+.LASF267:
+	.string	"lmsBench_processArgumentFormat"
+.LASF4:
+	.string	"long long int"
+.LASF211:
+	.string	"allVariants"
+.LASF331:
+	.string	"newCapacity"
+.LASF130:
+	.string	"width"
+.LASF227:
+	.string	"GEN_SIGNAL_COUNT"
+.LASF261:
+	.string	"lmsTelemetry_DefaultSettings"
+.LASF121:
+	.string	"AsyncFileBackend_t"
+.LASF96:
+	.string	"double"
+.LASF36:
+	.string	"_IO_write_end"
+.LASF251:
+	.string	"lmsPlot_Open"
+.LASF132:
+	.string	"sampleRate"
+.LASF135:
+	.string	"paced"
+.LASF318:
+	.string	"validateCheckpointOptions"
+.LASF83:
+	.string	"gl_closedir"
+.LASF95:
+	.string	"float"
+.LASF329:
+	.string	"globResult"
+.LASF282:
+	.string	"glob"
+.LASF37:
+	.string	"_IO_buf_base"
+.LASF310:
+	.string	"baseName"
+.LASF7:
+	.string	"unsigned int"
+.LASF286:
+	.string	"perror"
+.LASF183:
+	.string	"channels"
+.LASF277:
+	.string	"sampleIo_processArgumentFormat"
+.LASF70:
+	.string	"__pad0"
+.LASF56:
+	.string	"__pad5"
+.LASF86:
+	.string	"gl_lstat"
+.LASF330:
+	.string	"appendInputFile"
+.LASF278:
+	.string	"signalGenerator_processArgumentResolution"
+.LASF197:
+	.string	"RLS_FILTER_FORM_LATTICE"
+.LASF106:
+	.string	"LMS_KERNEL_COUNT"
+.LASF212:
+	.string	"includeFdaf"
+.LASF245:
+	.string	"illegalFilenameChars"
+.LASF222:
+	.string	"GEN_SIGNAL_SAWTOOTH"
+.LASF342:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF30:
+	.string	"_flags"
+.LASF280:
+	.string	"signalGenerator_processArgumentType"
+.LASF57:
+	.string	"_mode"
+.LASF291:
+	.string	"strpbrk"
+.LASF52:
+	.string	"_codecvt"
+.LASF238:
+	.string	"GENERATE_ARG_FILE"
+.LASF66:
+	.string	"st_nlink"
+.LASF157:
+	.string	"delayIndex"
+.LASF162:
+	.string	"leakage"
+.LASF181:
+	.string	"desiredFileName"
+.LASF273:
+	.string	"strtoull"
+.LASF160:
+	.string	"power"
+.LASF185:
+	.string	"numOfBands"
+.LASF89:
+	.string	"long double"
+.LASF264:
+	.string	"strncmp"
+.LASF190:
+	.string	"telemetry"
+.LASF81:
+	.string	"gl_offs"
+.LASF59:
+	.string	"FILE"
+.LASF64:
+	.string	"st_dev"
+.LASF279:
+	.string	"signalGenerator_processArgumentCycles"
+.LASF28:
+	.string	"timespec"
+.LASF184:
+	.string	"numOfThreads"
+.LASF176:
+	.string	"LmsFilterAlgorithm_t"
+.LASF334:
+	.string	"verifyFilterArgumentFile"
+.LASF172:
+	.string	"LMS_FILTER_ALGORITHM_FIXED"
+.LASF268:
+	.string	"lmsBench_processArgumentList"
+.LASF102:
+	.string	"LMS_KERNEL_SCALAR"
+.LASF337:
+	.string	"processGenerateArgumentFile"
+.LASF27:
+	.string	"long long unsigned int"
+.LASF325:
+	.string	"numOfFiles"
+.LASF137:
+	.string	"shortWindow"
+.LASF154:
+	.string	"length"
+.LASF18:
+	.string	"__off_t"
+.LASF88:
+	.string	"glob_t"
+.LASF136:
+	.string	"LmsRealtimeSettings_t"
+.LASF260:
+	.string	"lmsFilter_InitVariant"
+.LASF270:
+	.string	"lmsFilter_processArgumentAlgorithm"
+.LASF55:
+	.string	"_freeres_buf"
+.LASF300:
+	.string	"realtimeSettings"
+.LASF305:
+	.string	"inputFiles"
+.LASF20:
+	.string	"__time_t"
+.LASF246:
+	.string	"lmsPlot_PlotFile"
+.LASF40:
+	.string	"_IO_backup_base"
+.LASF49:
+	.string	"_shortbuf"
+.LASF317:
+	.string	"backend"
+.LASF281:
+	.string	"globfree"
+.LASF239:
+	.string	"ArgGenerate_t"
+.LASF309:
+	.string	"plotFileName"
+.LASF339:
+	.string	"printMissingParameterError"
+.LASF248:
+	.string	"malloc"
+.LASF19:
+	.string	"__off64_t"
+.LASF144:
+	.string	"LMS_FILTER_VARIANT_NLMS"
+.LASF287:
+	.string	"fopen"
+.LASF218:
+	.string	"LmsBenchSettings_t"
+.LASF166:
+	.string	"allocator"
+.LASF124:
+	.string	"SAMPLE_FORMAT_F32"
+.LASF289:
+	.string	"strdup"
+.LASF189:
+	.string	"realtime"
+.LASF38:
+	.string	"_IO_buf_end"
+.LASF303:
+	.string	"plotSettings"
+.LASF109:
+	.string	"name"
+.LASF149:
+	.string	"LMS_FILTER_VARIANT_COUNT"
+.LASF256:
+	.string	"lmsFilter_Free"
+.LASF131:
+	.string	"LmsPlotSettings_t"
+.LASF9:
+	.string	"short int"
+.LASF126:
+	.string	"SAMPLE_FORMAT_WAV_S16"
+.LASF94:
+	.string	"uint64_t"
+.LASF134:
+	.string	"priority"
+.LASF297:
+	.string	"signalSettings"
+.LASF235:
+	.string	"GENERATE_ARG_TYPE"
+.LASF230:
+	.string	"resolution"
+.LASF26:
+	.string	"tv_nsec"
+.LASF244:
+	.string	"usage"
+.LASF48:
+	.string	"_vtable_offset"
+.LASF313:
+	.string	"processPlotOptions"
+.LASF316:
+	.string	"processFilterOptions"
+.LASF306:
+	.string	"numOfInputFiles"
+.LASF332:
+	.string	"newFileNames"
+.LASF298:
+	.string	"filter"
+.LASF93:
+	.string	"LmsAllocator_t"
+.LASF204:
+	.string	"lengths"
+.LASF333:
+	.string	"isFilterFileBatch"
+.LASF113:
+	.string	"signUpdateDot"
+.LASF249:
+	.string	"strlen"
+.LASF199:
+	.string	"LMS_BENCH_FORMAT_UNKNOWN"
+.LASF158:
+	.string	"pendingGain"
+.LASF263:
+	.string	"signalGenerator_DefaultSettings"
+.LASF258:
+	.string	"lmsFixed_StepShift"
+.LASF67:
+	.string	"st_mode"
+.LASF13:
+	.string	"__uid_t"
+.LASF32:
+	.string	"_IO_read_end"
+.LASF253:
+	.string	"lmsFilter_FilterInterleavedFile"
+.LASF252:
+	.string	"lmsFilter_FilterSignalAndSaveToFile"
+.LASF44:
+	.string	"_fileno"
+.LASF91:
+	.string	"release"
+.LASF53:
+	.string	"_wide_data"
+.LASF307:
+	.string	"benchSettings"
+.LASF288:
+	.string	"free"
+.LASF226:
+	.string	"GEN_SIGNAL_SINE_NOISE"
+.LASF237:
+	.string	"GENERATE_ARG_CYCLES"
+.LASF6:
+	.string	"short unsigned int"
+.LASF148:
+	.string	"LMS_FILTER_VARIANT_SIGN_SIGN"
+.LASF219:
+	.string	"GEN_SIGNAL_UNKNOWN"
+.LASF150:
+	.string	"LmsFilterVariant_t"
+.LASF35:
+	.string	"_IO_write_ptr"
+.LASF231:
+	.string	"amplitude"
+.LASF191:
+	.string	"checkpoint"
+.LASF302:
+	.string	"checkpointSettings"
+.LASF275:
+	.string	"sampleIo_SetBackend"
+.LASF195:
+	.string	"RLS_FILTER_FORM_AUTO"
+.LASF234:
+	.string	"SignalGenerator_t"
+.LASF65:
+	.string	"st_ino"
+.LASF17:
+	.string	"__nlink_t"
+.LASF194:
+	.string	"LmsFilterFileSettings_t"
+.LASF25:
+	.string	"tv_sec"
+.LASF182:
+	.string	"twoColumn"
+.LASF112:
+	.string	"leakyUpdateDot"
+.LASF257:
+	.string	"rlsFilter_FormName"
+.LASF101:
+	.string	"LmsCheckpointSettings_t"
+.LASF84:
+	.string	"gl_readdir"
+.LASF75:
+	.string	"st_atim"
+.LASF216:
+	.string	"includeApa"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF0:
+	.string	"source/main.c"
+.LASF1:
+	.string	"/root/repo"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
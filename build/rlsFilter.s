@@ -0,0 +1,3548 @@
+	.file	"rlsFilter.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/rlsFilter.c"
+	.type	rlsFilter_Push, @function
+rlsFilter_Push:
+.LFB6:
+	.file 1 "source/rlsFilter.c"
+	.loc 1 35 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 36 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 36 9
+	lea	edx, -1[rax]
+	.loc 1 36 8
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 24[rax], edx
+	.loc 1 36 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 36 8
+	test	eax, eax
+	jns	.L2
+	.loc 1 38 38
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 38 47
+	lea	edx, -1[rax]
+	.loc 1 38 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 24[rax], edx
+.L2:
+	.loc 1 40 11
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 40 27
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 40 20
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 40 43
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 41 11
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 41 27
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, DWORD PTR 24[rax]
+	.loc 1 41 50
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 41 42
+	add	eax, ecx
+	cdqe
+	.loc 1 41 20
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 41 60
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 42 19
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 42 35
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 42 28
+	sal	rax, 2
+	.loc 1 42 12
+	add	rax, rdx
+	.loc 1 43 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	rlsFilter_Push, .-rlsFilter_Push
+	.type	rlsFilter_DirectSample, @function
+rlsFilter_DirectSample:
+.LFB7:
+	.loc 1 50 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -152[rbp], rdi
+	mov	QWORD PTR -160[rbp], rsi
+	movsd	QWORD PTR -168[rbp], xmm0
+	.loc 1 51 15
+	mov	rax, QWORD PTR -152[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -68[rbp], eax
+	.loc 1 52 13
+	mov	rax, QWORD PTR -152[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	mov	QWORD PTR -80[rbp], rax
+	.loc 1 53 13
+	mov	rax, QWORD PTR -152[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	mov	QWORD PTR -88[rbp], rax
+	.loc 1 54 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 55 12
+	mov	rax, QWORD PTR -152[rbp]
+	movsd	xmm0, QWORD PTR [rax]
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 56 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBB2:
+	.loc 1 58 14
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 58 5
+	jmp	.L5
+.L8:
+.LBB3:
+	.loc 1 60 36
+	mov	rax, QWORD PTR -152[rbp]
+	mov	rcx, QWORD PTR 40[rax]
+	.loc 1 60 46
+	mov	eax, DWORD PTR -28[rbp]
+	movsx	rdx, eax
+	.loc 1 60 56
+	mov	eax, DWORD PTR -68[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 60 45
+	sal	rax, 3
+	.loc 1 60 23
+	add	rax, rcx
+	mov	QWORD PTR -144[rbp], rax
+	.loc 1 61 16
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -40[rbp], xmm0
+.LBB4:
+	.loc 1 63 18
+	mov	DWORD PTR -44[rbp], 0
+	.loc 1 63 9
+	jmp	.L6
+.L7:
+	.loc 1 65 23 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -144[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 65 30 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 65 27 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 65 17 discriminator 3
+	movsd	xmm1, QWORD PTR -40[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -40[rbp], xmm0
+	.loc 1 63 38 discriminator 3
+	add	DWORD PTR -44[rbp], 1
+.L6:
+	.loc 1 63 27 discriminator 1
+	mov	eax, DWORD PTR -44[rbp]
+	cmp	eax, DWORD PTR -68[rbp]
+	jl	.L7
+.LBE4:
+	.loc 1 67 13 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 67 17 discriminator 2
+	movsd	xmm0, QWORD PTR -40[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 68 19 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 68 23 discriminator 2
+	mulsd	xmm0, QWORD PTR -40[rbp]
+	.loc 1 68 15 discriminator 2
+	movsd	xmm1, QWORD PTR -16[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 69 21 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 69 28 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 69 25 discriminator 2
+	mulsd	xmm0, xmm1
+	.loc 1 69 11 discriminator 2
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBE3:
+	.loc 1 58 34 discriminator 2
+	add	DWORD PTR -28[rbp], 1
+.L5:
+	.loc 1 58 23 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	cmp	eax, DWORD PTR -68[rbp]
+	jl	.L8
+.LBE2:
+	.loc 1 72 18
+	movsd	xmm0, QWORD PTR -168[rbp]
+	subsd	xmm0, QWORD PTR -8[rbp]
+	movsd	QWORD PTR -96[rbp], xmm0
+	.loc 1 73 18
+	movsd	xmm0, QWORD PTR .LC1[rip]
+	divsd	xmm0, QWORD PTR -16[rbp]
+	movsd	QWORD PTR -104[rbp], xmm0
+.LBB5:
+	.loc 1 74 14
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 74 5
+	jmp	.L9
+.L10:
+	.loc 1 76 16 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 76 27 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 76 31 discriminator 3
+	mulsd	xmm0, QWORD PTR -104[rbp]
+	.loc 1 76 46 discriminator 3
+	mulsd	xmm0, QWORD PTR -96[rbp]
+	.loc 1 76 16 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 76 20 discriminator 3
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 74 34 discriminator 3
+	add	DWORD PTR -48[rbp], 1
+.L9:
+	.loc 1 74 23 discriminator 1
+	mov	eax, DWORD PTR -48[rbp]
+	cmp	eax, DWORD PTR -68[rbp]
+	jl	.L10
+.LBE5:
+.LBB6:
+	.loc 1 80 14
+	mov	DWORD PTR -52[rbp], 0
+	.loc 1 80 5
+	jmp	.L11
+.L14:
+.LBB7:
+	.loc 1 82 30
+	mov	rax, QWORD PTR -152[rbp]
+	mov	rcx, QWORD PTR 40[rax]
+	.loc 1 82 40
+	mov	eax, DWORD PTR -52[rbp]
+	movsx	rdx, eax
+	.loc 1 82 50
+	mov	eax, DWORD PTR -68[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 82 39
+	sal	rax, 3
+	.loc 1 82 17
+	add	rax, rcx
+	mov	QWORD PTR -128[rbp], rax
+	.loc 1 83 35
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 83 22
+	movsd	xmm1, QWORD PTR -104[rbp]
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -136[rbp], xmm0
+.LBB8:
+	.loc 1 85 18
+	mov	eax, DWORD PTR -52[rbp]
+	mov	DWORD PTR -56[rbp], eax
+	.loc 1 85 9
+	jmp	.L12
+.L13:
+	.loc 1 87 16 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -128[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 87 36 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 87 30 discriminator 3
+	mulsd	xmm1, QWORD PTR -136[rbp]
+	.loc 1 87 16 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -128[rbp]
+	add	rax, rdx
+	.loc 1 87 20 discriminator 3
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 88 58 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -128[rbp]
+	lea	rcx, [rdx+rax]
+	.loc 1 88 19 discriminator 3
+	mov	rax, QWORD PTR -152[rbp]
+	mov	rsi, QWORD PTR 40[rax]
+	.loc 1 88 29 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	movsx	rdx, eax
+	.loc 1 88 39 discriminator 3
+	mov	eax, DWORD PTR -68[rbp]
+	cdqe
+	imul	rdx, rax
+	.loc 1 88 48 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	add	rax, rdx
+	.loc 1 88 28 discriminator 3
+	sal	rax, 3
+	add	rax, rsi
+	.loc 1 88 58 discriminator 3
+	movsd	xmm0, QWORD PTR [rcx]
+	.loc 1 88 53 discriminator 3
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 85 38 discriminator 3
+	add	DWORD PTR -56[rbp], 1
+.L12:
+	.loc 1 85 27 discriminator 1
+	mov	eax, DWORD PTR -56[rbp]
+	cmp	eax, DWORD PTR -68[rbp]
+	jl	.L13
+.LBE8:
+	.loc 1 90 21 discriminator 2
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -128[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 90 15 discriminator 2
+	movsd	xmm1, QWORD PTR -24[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBE7:
+	.loc 1 80 34 discriminator 2
+	add	DWORD PTR -52[rbp], 1
+.L11:
+	.loc 1 80 23 discriminator 1
+	mov	eax, DWORD PTR -52[rbp]
+	cmp	eax, DWORD PTR -68[rbp]
+	jl	.L14
+.LBE6:
+	.loc 1 94 37
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -68[rbp]
+	movsd	xmm0, QWORD PTR .LC2[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 94 54
+	mov	rax, QWORD PTR -152[rbp]
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 94 46
+	mulsd	xmm0, xmm1
+	.loc 1 94 8
+	comisd	xmm0, QWORD PTR -24[rbp]
+	jbe	.L15
+.LBB9:
+	.loc 1 96 42
+	mov	rax, QWORD PTR -152[rbp]
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 96 22
+	movsd	xmm0, QWORD PTR .LC1[rip]
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR -112[rbp], xmm0
+	.loc 1 97 29
+	mov	eax, DWORD PTR -68[rbp]
+	movsx	rdx, eax
+	.loc 1 97 44
+	mov	eax, DWORD PTR -68[rbp]
+	cdqe
+	.loc 1 97 22
+	imul	rax, rdx
+	mov	QWORD PTR -120[rbp], rax
+.LBB10:
+	.loc 1 99 21
+	mov	QWORD PTR -64[rbp], 0
+	.loc 1 99 9
+	jmp	.L17
+.L18:
+	.loc 1 101 19 discriminator 3
+	mov	rax, QWORD PTR -152[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 101 28 discriminator 3
+	mov	rdx, QWORD PTR -64[rbp]
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 101 19 discriminator 3
+	mov	rax, QWORD PTR -152[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 101 28 discriminator 3
+	mov	rdx, QWORD PTR -64[rbp]
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 101 32 discriminator 3
+	mulsd	xmm0, QWORD PTR -112[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 99 39 discriminator 3
+	add	QWORD PTR -64[rbp], 1
+.L17:
+	.loc 1 99 30 discriminator 1
+	mov	rax, QWORD PTR -64[rbp]
+	cmp	rax, QWORD PTR -120[rbp]
+	jb	.L18
+.L15:
+.LBE10:
+.LBE9:
+	.loc 1 104 12
+	movsd	xmm0, QWORD PTR -96[rbp]
+	movq	rax, xmm0
+	.loc 1 105 1
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	rlsFilter_DirectSample, .-rlsFilter_DirectSample
+	.type	rlsFilter_LatticeSample, @function
+rlsFilter_LatticeSample:
+.LFB8:
+	.loc 1 113 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 40
+	mov	QWORD PTR -136[rbp], rdi
+	movsd	QWORD PTR -144[rbp], xmm0
+	movsd	QWORD PTR -152[rbp], xmm1
+	mov	DWORD PTR -156[rbp], esi
+	.loc 1 114 18
+	mov	rax, QWORD PTR -136[rbp]
+	movsd	xmm0, QWORD PTR [rax]
+	movsd	QWORD PTR -88[rbp], xmm0
+	.loc 1 115 28
+	mov	rax, QWORD PTR -136[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 115 15
+	sub	eax, 1
+	mov	DWORD PTR -92[rbp], eax
+	.loc 1 116 12
+	movsd	xmm0, QWORD PTR -144[rbp]
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 117 12
+	movsd	xmm0, QWORD PTR -144[rbp]
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 118 12
+	movsd	xmm0, QWORD PTR .LC1[rip]
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 119 12
+	movsd	xmm0, QWORD PTR -152[rbp]
+	movsd	QWORD PTR -32[rbp], xmm0
+.LBB11:
+	.loc 1 121 14
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 121 5
+	jmp	.L22
+.L29:
+.LBB12:
+	.loc 1 123 43
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 123 58
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 123 22
+	movsd	xmm0, QWORD PTR [rax]
+	movsd	QWORD PTR -104[rbp], xmm0
+	.loc 1 124 44
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 124 59
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 124 22
+	movsd	xmm0, QWORD PTR [rax]
+	movsd	QWORD PTR -112[rbp], xmm0
+	.loc 1 125 44
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 125 56
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 125 22
+	movsd	xmm0, QWORD PTR [rax]
+	movsd	QWORD PTR -120[rbp], xmm0
+	.loc 1 126 31
+	movsd	xmm0, QWORD PTR -88[rbp]
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -112[rbp]
+	.loc 1 126 55
+	movsd	xmm0, QWORD PTR -24[rbp]
+	mulsd	xmm0, QWORD PTR -16[rbp]
+	.loc 1 126 62
+	mulsd	xmm0, QWORD PTR -16[rbp]
+	.loc 1 126 16
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -48[rbp], xmm0
+	.loc 1 128 12
+	movsd	xmm0, QWORD PTR .LC3[rip]
+	comisd	xmm0, QWORD PTR -48[rbp]
+	jbe	.L23
+	.loc 1 130 19
+	movsd	xmm0, QWORD PTR .LC3[rip]
+	movsd	QWORD PTR -48[rbp], xmm0
+.L23:
+	.loc 1 132 12
+	cmp	DWORD PTR -156[rbp], 0
+	je	.L25
+.LBB13:
+	.loc 1 134 44
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 134 51
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 134 55
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -16[rbp]
+	.loc 1 134 26
+	movsd	xmm0, QWORD PTR -32[rbp]
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR -128[rbp], xmm0
+	.loc 1 135 19
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 135 26
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 135 39
+	movsd	xmm0, QWORD PTR -24[rbp]
+	mulsd	xmm0, QWORD PTR -16[rbp]
+	.loc 1 135 46
+	mulsd	xmm0, QWORD PTR -128[rbp]
+	.loc 1 135 53
+	divsd	xmm0, QWORD PTR -48[rbp]
+	.loc 1 135 19
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	.loc 1 135 26
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 135 30
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 136 16
+	movsd	xmm0, QWORD PTR -128[rbp]
+	movsd	QWORD PTR -32[rbp], xmm0
+.L25:
+.LBE13:
+	.loc 1 139 16
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -56[rbp], xmm0
+	.loc 1 140 16
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 141 16
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -72[rbp], xmm0
+	.loc 1 142 12
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -92[rbp]
+	jge	.L26
+.LBB14:
+	.loc 1 144 50
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 144 64
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 144 42
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -88[rbp]
+	.loc 1 144 84
+	movsd	xmm0, QWORD PTR -120[rbp]
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 144 90
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 144 20
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -80[rbp], xmm0
+	.loc 1 145 16
+	movsd	xmm0, QWORD PTR .LC3[rip]
+	comisd	xmm0, QWORD PTR -80[rbp]
+	jbe	.L27
+	.loc 1 147 30
+	movsd	xmm0, QWORD PTR .LC3[rip]
+	movsd	QWORD PTR -80[rbp], xmm0
+.L27:
+	.loc 1 149 19
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 149 33
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 149 37
+	movsd	xmm0, QWORD PTR -80[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 151 35
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 151 54
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 151 58
+	mulsd	xmm0, QWORD PTR -104[rbp]
+	.loc 1 151 21
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -56[rbp], xmm0
+	.loc 1 152 45
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	.loc 1 152 65
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 152 69
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 152 22
+	movsd	xmm1, QWORD PTR -104[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 153 19
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 153 38
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 153 59
+	movsd	xmm1, QWORD PTR -120[rbp]
+	mulsd	xmm1, QWORD PTR -104[rbp]
+	.loc 1 153 74
+	mulsd	xmm1, QWORD PTR -56[rbp]
+	.loc 1 153 84
+	divsd	xmm1, QWORD PTR -112[rbp]
+	.loc 1 153 19
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 153 38
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 153 42
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 154 19
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	.loc 1 154 39
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 154 60
+	movsd	xmm1, QWORD PTR -120[rbp]
+	mulsd	xmm1, QWORD PTR -8[rbp]
+	.loc 1 154 66
+	mulsd	xmm1, QWORD PTR -64[rbp]
+	.loc 1 154 77
+	divsd	xmm1, QWORD PTR -80[rbp]
+	.loc 1 154 19
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	.loc 1 154 39
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 154 43
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 155 40
+	movsd	xmm0, QWORD PTR -24[rbp]
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -16[rbp]
+	.loc 1 155 57
+	movsd	xmm0, QWORD PTR -24[rbp]
+	mulsd	xmm0, QWORD PTR -16[rbp]
+	.loc 1 155 48
+	mulsd	xmm0, xmm1
+	.loc 1 155 65
+	movapd	xmm1, xmm0
+	divsd	xmm1, QWORD PTR -48[rbp]
+	.loc 1 155 23
+	movsd	xmm0, QWORD PTR -24[rbp]
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR -72[rbp], xmm0
+.L26:
+.LBE14:
+	.loc 1 158 15 discriminator 2
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 158 30 discriminator 2
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 158 34 discriminator 2
+	movsd	xmm0, QWORD PTR -48[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 159 15 discriminator 2
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 159 30 discriminator 2
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 159 34 discriminator 2
+	movsd	xmm0, QWORD PTR -16[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 160 15 discriminator 2
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 160 27 discriminator 2
+	mov	edx, DWORD PTR -36[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 160 31 discriminator 2
+	movsd	xmm0, QWORD PTR -24[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 161 13 discriminator 2
+	movsd	xmm0, QWORD PTR -56[rbp]
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 162 14 discriminator 2
+	movsd	xmm0, QWORD PTR -64[rbp]
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 163 15 discriminator 2
+	movsd	xmm0, QWORD PTR -72[rbp]
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBE12:
+	.loc 1 121 33 discriminator 2
+	add	DWORD PTR -36[rbp], 1
+.L22:
+	.loc 1 121 23 discriminator 1
+	mov	eax, DWORD PTR -36[rbp]
+	cmp	eax, DWORD PTR -92[rbp]
+	jle	.L29
+.LBE11:
+	.loc 1 165 12
+	movsd	xmm0, QWORD PTR -32[rbp]
+	movq	rax, xmm0
+	.loc 1 166 1
+	movq	xmm0, rax
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	rlsFilter_LatticeSample, .-rlsFilter_LatticeSample
+	.section	.rodata
+	.align 8
+.LC4:
+	.string	"Wrong RLS filter length %d or forgetting factor %g\n"
+	.align 8
+.LC5:
+	.string	"Error allocating RLS filter of length %d\n"
+	.text
+	.globl	rlsFilter_Init
+	.type	rlsFilter_Init, @function
+rlsFilter_Init:
+.LFB9:
+	.loc 1 169 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 160
+	mov	QWORD PTR -136[rbp], rdi
+	movsd	QWORD PTR -144[rbp], xmm0
+	mov	DWORD PTR -148[rbp], esi
+	mov	DWORD PTR -152[rbp], edx
+	.loc 1 170 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 172 5
+	mov	rax, QWORD PTR -136[rbp]
+	mov	edx, 120
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 173 8
+	cmp	DWORD PTR -148[rbp], 0
+	jle	.L34
+	.loc 1 173 34 discriminator 1
+	movsd	xmm0, QWORD PTR -144[rbp]
+	pxor	xmm1, xmm1
+	comisd	xmm0, xmm1
+	seta	al
+	.loc 1 173 25 discriminator 1
+	xor	eax, 1
+	.loc 1 173 22 discriminator 1
+	test	al, al
+	jne	.L34
+	.loc 1 173 53 discriminator 2
+	movsd	xmm0, QWORD PTR .LC1[rip]
+	comisd	xmm0, QWORD PTR -144[rbp]
+	seta	al
+	.loc 1 173 44 discriminator 2
+	xor	eax, 1
+	.loc 1 173 41 discriminator 2
+	test	al, al
+	je	.L35
+.L34:
+	.loc 1 175 9
+	mov	rdx, QWORD PTR -144[rbp]
+	mov	eax, DWORD PTR -148[rbp]
+	movq	xmm0, rdx
+	mov	esi, eax
+	lea	rax, .LC4[rip]
+	mov	rdi, rax
+	mov	eax, 1
+	call	printf@PLT
+	.loc 1 176 16
+	mov	eax, 1
+	jmp	.L36
+.L35:
+	.loc 1 178 8
+	cmp	DWORD PTR -152[rbp], 0
+	jne	.L37
+	.loc 1 180 82
+	cmp	DWORD PTR -148[rbp], 64
+	jg	.L38
+	.loc 1 180 82 is_stmt 0 discriminator 1
+	mov	eax, 1
+	jmp	.L39
+.L38:
+	.loc 1 180 82 discriminator 2
+	mov	eax, 2
+.L39:
+	.loc 1 180 14 is_stmt 1 discriminator 4
+	mov	DWORD PTR -152[rbp], eax
+.L37:
+	.loc 1 182 20
+	mov	rax, QWORD PTR -136[rbp]
+	movsd	xmm0, QWORD PTR -144[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 183 20
+	mov	rax, QWORD PTR -136[rbp]
+	mov	edx, DWORD PTR -148[rbp]
+	mov	DWORD PTR 8[rax], edx
+	.loc 1 184 18
+	mov	rax, QWORD PTR -136[rbp]
+	mov	edx, DWORD PTR -152[rbp]
+	mov	DWORD PTR 12[rax], edx
+	.loc 1 186 62
+	mov	eax, DWORD PTR -148[rbp]
+	cdqe
+	.loc 1 186 33
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 187 57
+	mov	eax, DWORD PTR -148[rbp]
+	cdqe
+	.loc 1 187 32
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 188 57
+	mov	eax, DWORD PTR -148[rbp]
+	movsx	rdx, eax
+	.loc 1 188 72
+	mov	eax, DWORD PTR -148[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 188 32
+	sal	rax, 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 189 96
+	cmp	DWORD PTR -152[rbp], 1
+	jne	.L40
+	.loc 1 189 68 discriminator 1
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rdx, [rax+rax]
+	.loc 1 189 96 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	jmp	.L41
+.L40:
+	.loc 1 189 96 is_stmt 0 discriminator 2
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rax, rdx
+	sal	rax, 3
+	sub	rax, rdx
+.L41:
+	.loc 1 189 18 is_stmt 1 discriminator 4
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 191 26 discriminator 4
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rcx, QWORD PTR [rax]
+	.loc 1 191 22 discriminator 4
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	lea	rsi, [rdx+rax]
+	.loc 1 191 41 discriminator 4
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 191 22 discriminator 4
+	mov	edx, 64
+	mov	rdi, rax
+	call	rcx
+.LVL0:
+	.loc 1 191 20 discriminator 4
+	mov	rdx, QWORD PTR -136[rbp]
+	mov	QWORD PTR 112[rdx], rax
+	.loc 1 192 15 discriminator 4
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	.loc 1 192 8 discriminator 4
+	test	rax, rax
+	jne	.L42
+	.loc 1 194 9
+	mov	eax, DWORD PTR -148[rbp]
+	mov	esi, eax
+	lea	rax, .LC5[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 195 16
+	mov	eax, 1
+	jmp	.L36
+.L42:
+	.loc 1 197 5
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	add	rdx, rax
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 112[rax]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 198 37
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rdx, QWORD PTR 112[rax]
+	.loc 1 198 21
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR 16[rax], rdx
+	.loc 1 200 49
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rdx, QWORD PTR 112[rax]
+	.loc 1 200 20
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -72[rbp], rax
+	.loc 1 201 8
+	cmp	DWORD PTR -152[rbp], 1
+	jne	.L43
+	.loc 1 203 25
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	QWORD PTR 32[rax], rdx
+	.loc 1 204 39
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 204 22
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 205 46
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rdx, [rax+rax]
+	.loc 1 205 42
+	mov	rax, QWORD PTR -72[rbp]
+	add	rdx, rax
+	.loc 1 205 25
+	mov	rax, QWORD PTR -136[rbp]
+	mov	QWORD PTR 40[rax], rdx
+.LBB15:
+	.loc 1 206 18
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 206 9
+	jmp	.L44
+.L45:
+	.loc 1 208 19 discriminator 3
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 208 48 discriminator 3
+	mov	eax, DWORD PTR -148[rbp]
+	cdqe
+	lea	rcx, 1[rax]
+	.loc 1 208 29 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 208 48 discriminator 3
+	imul	rax, rcx
+	.loc 1 208 28 discriminator 3
+	sal	rax, 3
+	add	rax, rdx
+	.loc 1 208 53 discriminator 3
+	movsd	xmm0, QWORD PTR .LC6[rip]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 206 38 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L44:
+	.loc 1 206 27 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -148[rbp]
+	jl	.L45
+	jmp	.L46
+.L43:
+.LBE15:
+.LBB16:
+	.loc 1 215 13
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, 56
+	.loc 1 213 18
+	mov	QWORD PTR -128[rbp], rax
+	.loc 1 215 36
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, 64
+	.loc 1 213 18
+	mov	QWORD PTR -120[rbp], rax
+	.loc 1 215 60
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, 72
+	.loc 1 213 18
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 215 84
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, 80
+	.loc 1 213 18
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 216 13
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, 88
+	.loc 1 213 18
+	mov	QWORD PTR -96[rbp], rax
+	.loc 1 216 41
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, 96
+	.loc 1 213 18
+	mov	QWORD PTR -88[rbp], rax
+	.loc 1 216 70
+	mov	rax, QWORD PTR -136[rbp]
+	add	rax, 104
+	.loc 1 213 18
+	mov	QWORD PTR -80[rbp], rax
+.LBB17:
+	.loc 1 218 21
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 218 9
+	jmp	.L47
+.L48:
+	.loc 1 220 46 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	imul	rax, QWORD PTR -48[rbp]
+	mov	rcx, rax
+	.loc 1 220 21 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -128[rbp+rax*8]
+	.loc 1 220 42 discriminator 3
+	mov	rdx, QWORD PTR -72[rbp]
+	add	rdx, rcx
+	.loc 1 220 25 discriminator 3
+	mov	QWORD PTR [rax], rdx
+	.loc 1 218 71 discriminator 3
+	add	QWORD PTR -16[rbp], 1
+.L47:
+	.loc 1 218 30 discriminator 1
+	cmp	QWORD PTR -16[rbp], 6
+	jbe	.L48
+.LBE17:
+.LBB18:
+	.loc 1 222 18
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 222 9
+	jmp	.L49
+.L50:
+	.loc 1 224 19 discriminator 3
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 224 33 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 224 37 discriminator 3
+	movsd	xmm0, QWORD PTR .LC7[rip]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 225 19 discriminator 3
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 225 34 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 225 38 discriminator 3
+	movsd	xmm0, QWORD PTR .LC7[rip]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 226 19 discriminator 3
+	mov	rax, QWORD PTR -136[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 226 31 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 226 35 discriminator 3
+	movsd	xmm0, QWORD PTR .LC1[rip]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 222 38 discriminator 3
+	add	DWORD PTR -20[rbp], 1
+.L49:
+	.loc 1 222 27 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -148[rbp]
+	jl	.L50
+.L46:
+.LBE18:
+.LBE16:
+	.loc 1 229 12
+	mov	eax, 0
+.L36:
+	.loc 1 230 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	rlsFilter_Init, .-rlsFilter_Init
+	.globl	rlsFilter_Free
+	.type	rlsFilter_Free, @function
+rlsFilter_Free:
+.LFB10:
+	.loc 1 233 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 234 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 236 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 236 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 112[rax]
+	.loc 1 236 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 236 5
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+	.loc 1 237 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 112[rax], 0
+	.loc 1 238 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	rlsFilter_Free, .-rlsFilter_Free
+	.globl	rlsFilter_PushSample
+	.type	rlsFilter_PushSample, @function
+rlsFilter_PushSample:
+.LFB11:
+	.loc 1 241 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 242 5
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	rlsFilter_Push
+	.loc 1 243 15
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 243 8
+	cmp	eax, 2
+	jne	.L54
+	.loc 1 245 9
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, DWORD PTR -12[rbp]
+	movq	rdx, xmm2
+	mov	rax, QWORD PTR -8[rbp]
+	mov	esi, 0
+	pxor	xmm1, xmm1
+	movq	xmm0, rdx
+	mov	rdi, rax
+	call	rlsFilter_LatticeSample
+.L54:
+	.loc 1 247 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	rlsFilter_PushSample, .-rlsFilter_PushSample
+	.globl	rlsFilter_ProcessBlock
+	.type	rlsFilter_ProcessBlock, @function
+rlsFilter_ProcessBlock:
+.LFB12:
+	.loc 1 251 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 96
+	mov	QWORD PTR -56[rbp], rdi
+	mov	QWORD PTR -64[rbp], rsi
+	mov	QWORD PTR -72[rbp], rdx
+	mov	QWORD PTR -80[rbp], rcx
+	mov	QWORD PTR -88[rbp], r8
+	mov	DWORD PTR -92[rbp], r9d
+	.loc 1 252 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBB19:
+	.loc 1 254 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 254 5
+	jmp	.L56
+.L63:
+.LBB20:
+	.loc 1 256 54
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	.loc 1 256 26
+	mov	edx, DWORD PTR [rax]
+	mov	rax, QWORD PTR -56[rbp]
+	movd	xmm0, edx
+	mov	rdi, rax
+	call	rlsFilter_Push
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 257 57
+	cmp	QWORD PTR -72[rbp], 0
+	je	.L57
+	.loc 1 257 53 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	.loc 1 257 57 discriminator 1
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L58
+.L57:
+	.loc 1 257 67 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	cdqe
+	.loc 1 257 60 discriminator 2
+	sal	rax, 2
+	lea	rdx, -4[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 257 57 discriminator 2
+	movss	xmm0, DWORD PTR [rax]
+.L58:
+	.loc 1 257 22 discriminator 4
+	cvtss2sd	xmm0, xmm0
+	movsd	QWORD PTR -32[rbp], xmm0
+	.loc 1 258 33 discriminator 4
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 258 106 discriminator 4
+	cmp	eax, 1
+	jne	.L59
+	.loc 1 258 69 discriminator 1
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -56[rbp]
+	movq	xmm0, rcx
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rlsFilter_DirectSample
+	movq	rax, xmm0
+	jmp	.L60
+.L59:
+	.loc 1 259 63
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 259 26
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, xmm0
+	movq	rdx, xmm2
+	movsd	xmm0, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -56[rbp]
+	mov	esi, 1
+	movapd	xmm1, xmm0
+	movq	xmm0, rdx
+	mov	rdi, rax
+	call	rlsFilter_LatticeSample
+	movq	rax, xmm0
+.L60:
+	.loc 1 258 22 discriminator 2
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 261 11 discriminator 2
+	movsd	xmm0, QWORD PTR -32[rbp]
+	subsd	xmm0, QWORD PTR -40[rbp]
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 262 12 discriminator 2
+	cmp	QWORD PTR -80[rbp], 0
+	je	.L61
+	.loc 1 264 19
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 264 25
+	pxor	xmm0, xmm0
+	cvtsd2ss	xmm0, QWORD PTR -8[rbp]
+	.loc 1 264 23
+	movss	DWORD PTR [rax], xmm0
+.L61:
+	.loc 1 266 12
+	cmp	QWORD PTR -88[rbp], 0
+	je	.L62
+	.loc 1 268 18
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 268 24
+	pxor	xmm0, xmm0
+	cvtsd2ss	xmm0, QWORD PTR -40[rbp]
+	.loc 1 268 22
+	movss	DWORD PTR [rax], xmm0
+.L62:
+.LBE20:
+	.loc 1 254 40 discriminator 2
+	add	DWORD PTR -12[rbp], 1
+.L56:
+	.loc 1 254 23 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -92[rbp]
+	jl	.L63
+.LBE19:
+	.loc 1 271 13
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movq	xmm1, QWORD PTR .LC8[rip]
+	andpd	xmm1, xmm0
+	.loc 1 271 46
+	movsd	xmm0, QWORD PTR .LC9[rip]
+	ucomisd	xmm0, xmm1
+	setb	al
+	movzx	eax, al
+	.loc 1 272 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	rlsFilter_ProcessBlock, .-rlsFilter_ProcessBlock
+	.globl	rlsFilter_NormSquared
+	.type	rlsFilter_NormSquared, @function
+rlsFilter_NormSquared:
+.LFB13:
+	.loc 1 275 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 276 41
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 276 19
+	cmp	eax, 1
+	jne	.L66
+	.loc 1 276 19 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	jmp	.L67
+.L66:
+	.loc 1 276 19 discriminator 2
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 104[rax]
+.L67:
+	.loc 1 276 19 discriminator 4
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 277 12 is_stmt 1 discriminator 4
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBB21:
+	.loc 1 279 14 discriminator 4
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 279 5 discriminator 4
+	jmp	.L68
+.L69:
+	.loc 1 281 28 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movsd	xmm1, QWORD PTR [rax]
+	.loc 1 281 46 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movsd	xmm0, QWORD PTR [rax]
+	.loc 1 281 32 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 281 13 discriminator 3
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 279 42 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L68:
+	.loc 1 279 31 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 279 23 discriminator 1
+	cmp	DWORD PTR -12[rbp], eax
+	jl	.L69
+.LBE21:
+	.loc 1 283 12
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movq	rax, xmm0
+	.loc 1 284 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	rlsFilter_NormSquared, .-rlsFilter_NormSquared
+	.section	.rodata
+.LC10:
+	.string	"direct"
+.LC11:
+	.string	"lattice"
+	.text
+	.globl	rlsFilter_FormName
+	.type	rlsFilter_FormName, @function
+rlsFilter_FormName:
+.LFB14:
+	.loc 1 287 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -4[rbp], edi
+	.loc 1 288 56
+	cmp	DWORD PTR -4[rbp], 1
+	jne	.L72
+	.loc 1 288 56 is_stmt 0 discriminator 1
+	lea	rax, .LC10[rip]
+	jmp	.L74
+.L72:
+	.loc 1 288 56 discriminator 2
+	lea	rax, .LC11[rip]
+.L74:
+	.loc 1 289 1 is_stmt 1 discriminator 5
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	rlsFilter_FormName, .-rlsFilter_FormName
+	.section	.rodata
+	.align 8
+.LC1:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC2:
+	.long	0
+	.long	1093567616
+	.align 8
+.LC3:
+	.long	-18103648
+	.long	968116299
+	.align 8
+.LC6:
+	.long	0
+	.long	1079574528
+	.align 8
+.LC7:
+	.long	1202590843
+	.long	1065646817
+	.align 16
+.LC8:
+	.long	-1
+	.long	2147483647
+	.long	0
+	.long	0
+	.align 8
+.LC9:
+	.long	-1
+	.long	2146435071
+	.text
+.Letext0:
+	.file 2 "include/lmsAllocator.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "include/rlsFilter.h"
+	.file 5 "/usr/include/stdio.h"
+	.file 6 "/usr/include/string.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x9df
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF84
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xc
+	.long	.LASF18
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0x9
+	.long	0x2e
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x46
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x17
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0x9
+	.long	0x85
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF11
+	.uleb128 0x7
+	.long	0x8c
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF12
+	.uleb128 0x9
+	.long	0x9d
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF13
+	.uleb128 0x9
+	.long	0xa9
+	.uleb128 0x6
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF14
+	.uleb128 0xe
+	.byte	0x18
+	.byte	0x2
+	.byte	0x10
+	.long	0xec
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x2
+	.byte	0x13
+	.byte	0xd
+	.long	0x105
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF16
+	.byte	0x2
+	.byte	0x16
+	.byte	0xc
+	.long	0x11a
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x18
+	.byte	0xb
+	.long	0x83
+	.byte	0x10
+	.byte	0
+	.uleb128 0x18
+	.long	0x83
+	.long	0x105
+	.uleb128 0x8
+	.long	0x83
+	.uleb128 0x8
+	.long	0x2e
+	.uleb128 0x8
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0xec
+	.uleb128 0x19
+	.long	0x11a
+	.uleb128 0x8
+	.long	0x83
+	.uleb128 0x8
+	.long	0x83
+	.byte	0
+	.uleb128 0x7
+	.long	0x10a
+	.uleb128 0xc
+	.long	.LASF19
+	.byte	0x2
+	.byte	0x19
+	.byte	0x3
+	.long	0xbc
+	.uleb128 0x9
+	.long	0x11f
+	.uleb128 0x7
+	.long	0x60
+	.uleb128 0x1a
+	.byte	0x7
+	.byte	0x4
+	.long	0x6e
+	.byte	0x4
+	.byte	0x11
+	.byte	0x1
+	.long	0x156
+	.uleb128 0xd
+	.long	.LASF20
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF21
+	.byte	0x1
+	.uleb128 0xd
+	.long	.LASF22
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF23
+	.byte	0x4
+	.byte	0x15
+	.byte	0x3
+	.long	0x135
+	.uleb128 0xe
+	.byte	0x78
+	.byte	0x4
+	.byte	0x17
+	.long	0x23b
+	.uleb128 0x3
+	.long	.LASF24
+	.byte	0x4
+	.byte	0x19
+	.byte	0xc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF25
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF26
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x15
+	.long	0x156
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF27
+	.byte	0x4
+	.byte	0x1c
+	.byte	0xc
+	.long	0x23b
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x9
+	.long	0x46
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x20
+	.byte	0xd
+	.long	0x240
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF30
+	.byte	0x4
+	.byte	0x21
+	.byte	0xd
+	.long	0x240
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF31
+	.byte	0x4
+	.byte	0x22
+	.byte	0xd
+	.long	0x240
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x25
+	.byte	0xd
+	.long	0x240
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x26
+	.byte	0xd
+	.long	0x240
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF34
+	.byte	0x4
+	.byte	0x27
+	.byte	0xd
+	.long	0x240
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF35
+	.byte	0x4
+	.byte	0x28
+	.byte	0xd
+	.long	0x240
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x29
+	.byte	0xd
+	.long	0x240
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xd
+	.long	0x240
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF38
+	.byte	0x4
+	.byte	0x2b
+	.byte	0xd
+	.long	0x240
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF39
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0x83
+	.byte	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	0x9d
+	.uleb128 0x7
+	.long	0xa9
+	.uleb128 0xc
+	.long	.LASF40
+	.byte	0x4
+	.byte	0x2e
+	.byte	0x3
+	.long	0x162
+	.uleb128 0x9
+	.long	0x245
+	.uleb128 0xf
+	.long	.LASF41
+	.byte	0x2
+	.byte	0x43
+	.byte	0x8
+	.long	0x2e
+	.long	0x26c
+	.uleb128 0x8
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF42
+	.byte	0x5
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0x284
+	.uleb128 0x8
+	.long	0x98
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x2a4
+	.uleb128 0x8
+	.long	0x83
+	.uleb128 0x8
+	.long	0x46
+	.uleb128 0x8
+	.long	0x2e
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF85
+	.byte	0x2
+	.byte	0x27
+	.byte	0x17
+	.long	0x2b0
+	.uleb128 0x7
+	.long	0x12b
+	.uleb128 0x10
+	.long	.LASF44
+	.value	0x11e
+	.byte	0xd
+	.long	0x98
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e7
+	.uleb128 0x11
+	.long	.LASF26
+	.value	0x11e
+	.byte	0x30
+	.long	0x156
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF45
+	.value	0x112
+	.byte	0x8
+	.long	0xa9
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x357
+	.uleb128 0x11
+	.long	.LASF46
+	.value	0x112
+	.byte	0x31
+	.long	0x357
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1e
+	.long	.LASF47
+	.byte	0x1
+	.value	0x114
+	.byte	0x13
+	.long	0x35c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xb
+	.string	"sum"
+	.value	0x115
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.uleb128 0xb
+	.string	"k"
+	.value	0x117
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x251
+	.uleb128 0x7
+	.long	0xb0
+	.uleb128 0x12
+	.long	.LASF48
+	.byte	0xf9
+	.long	0x46
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x43f
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0xf9
+	.byte	0x29
+	.long	0x43f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x2
+	.long	.LASF49
+	.byte	0xf9
+	.byte	0x3e
+	.long	0x444
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0xf9
+	.byte	0x52
+	.long	0x444
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x2
+	.long	.LASF51
+	.byte	0xfa
+	.byte	0x23
+	.long	0x23b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x2
+	.long	.LASF52
+	.byte	0xfa
+	.byte	0x32
+	.long	0x23b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x2
+	.long	.LASF53
+	.byte	0xfa
+	.byte	0x3d
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x4
+	.string	"y"
+	.byte	0xfc
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0x4
+	.string	"i"
+	.byte	0xfe
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x5
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.uleb128 0xb
+	.string	"x"
+	.value	0x100
+	.byte	0x16
+	.long	0x444
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xb
+	.string	"d"
+	.value	0x101
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xb
+	.string	"e"
+	.value	0x102
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x245
+	.uleb128 0x7
+	.long	0xa4
+	.uleb128 0x13
+	.long	.LASF55
+	.byte	0xf0
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x482
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0xf0
+	.byte	0x28
+	.long	0x43f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x2
+	.long	.LASF54
+	.byte	0xf0
+	.byte	0x36
+	.long	0x9d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF56
+	.byte	0xe8
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x4bb
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0xe8
+	.byte	0x22
+	.long	0x43f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0xea
+	.byte	0x1b
+	.long	0x2b0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF58
+	.byte	0xa8
+	.long	0x46
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x5f2
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0xa8
+	.byte	0x21
+	.long	0x43f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x2
+	.long	.LASF24
+	.byte	0xa8
+	.byte	0x30
+	.long	0xa9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x2
+	.long	.LASF25
+	.byte	0xa8
+	.byte	0x3c
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -164
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0xa8
+	.byte	0x54
+	.long	0x156
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0xaa
+	.byte	0x1b
+	.long	0x2b0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0xba
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0xbb
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0xbc
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xbd
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xc8
+	.byte	0x14
+	.long	0x130
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0xa
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.long	0x590
+	.uleb128 0x4
+	.string	"i"
+	.byte	0xce
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0xd5
+	.byte	0x12
+	.long	0x5f2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0xa
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.long	0x5d2
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xda
+	.byte	0x15
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.uleb128 0x4
+	.string	"m"
+	.byte	0xde
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x602
+	.long	0x602
+	.uleb128 0x20
+	.long	0x3f
+	.byte	0x6
+	.byte	0
+	.uleb128 0x7
+	.long	0x240
+	.uleb128 0x14
+	.long	.LASF76
+	.byte	0x70
+	.long	0xa9
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x797
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x70
+	.byte	0x34
+	.long	0x43f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x2
+	.long	.LASF54
+	.byte	0x70
+	.byte	0x43
+	.long	0xa9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0x70
+	.byte	0x52
+	.long	0xa9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x2
+	.long	.LASF65
+	.byte	0x70
+	.byte	0x5f
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -172
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x72
+	.byte	0x12
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x73
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x4
+	.string	"eta"
+	.byte	0x74
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x75
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x76
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.string	"xi"
+	.byte	0x77
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0x4
+	.string	"m"
+	.byte	0x79
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x5
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x7b
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x7c
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x7d
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x7e
+	.byte	0x10
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x8b
+	.byte	0x10
+	.long	0xa9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0x8c
+	.byte	0x10
+	.long	0xa9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0x8d
+	.byte	0x10
+	.long	0xa9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0xa
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.long	0x773
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x86
+	.byte	0x1a
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x90
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF77
+	.byte	0x31
+	.long	0xa9
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9a7
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x31
+	.byte	0x33
+	.long	0x43f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x21
+	.string	"x"
+	.byte	0x1
+	.byte	0x31
+	.byte	0x48
+	.long	0x444
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x2
+	.long	.LASF50
+	.byte	0x31
+	.byte	0x52
+	.long	0xa9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x33
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x34
+	.byte	0xd
+	.long	0x240
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x35
+	.byte	0xd
+	.long	0x240
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x4
+	.string	"y"
+	.byte	0x36
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0x37
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0x38
+	.byte	0xc
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.string	"e"
+	.byte	0x48
+	.byte	0x12
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0x49
+	.byte	0x12
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xa
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.long	0x8c3
+	.uleb128 0x4
+	.string	"i"
+	.byte	0x3a
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x5
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x4
+	.string	"row"
+	.byte	0x3c
+	.byte	0x17
+	.long	0x35c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x4
+	.string	"sum"
+	.byte	0x3d
+	.byte	0x10
+	.long	0xa9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x4
+	.string	"j"
+	.byte	0x3f
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.long	0x8e5
+	.uleb128 0x4
+	.string	"i"
+	.byte	0x4a
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0xa
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.long	0x957
+	.uleb128 0x4
+	.string	"i"
+	.byte	0x50
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x5
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x4
+	.string	"row"
+	.byte	0x52
+	.byte	0x11
+	.long	0x240
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x53
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x5
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x4
+	.string	"j"
+	.byte	0x55
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0x60
+	.byte	0x16
+	.long	0xb0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0x61
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x5
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x4
+	.string	"k"
+	.byte	0x63
+	.byte	0x15
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF86
+	.byte	0x1
+	.byte	0x22
+	.byte	0x1c
+	.long	0x444
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF46
+	.byte	0x22
+	.byte	0x38
+	.long	0x43f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x2
+	.long	.LASF54
+	.byte	0x22
+	.byte	0x46
+	.long	0x9d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF42:
+	.string	"printf"
+.LASF82:
+	.string	"scale"
+.LASF62:
+	.string	"stateBytes"
+.LASF37:
+	.string	"backwardReflection"
+.LASF18:
+	.string	"size_t"
+.LASF63:
+	.string	"next"
+.LASF32:
+	.string	"forwardPower"
+.LASF58:
+	.string	"rlsFilter_Init"
+.LASF11:
+	.string	"long long unsigned int"
+.LASF54:
+	.string	"sample"
+.LASF47:
+	.string	"coefficients"
+.LASF24:
+	.string	"lambda"
+.LASF4:
+	.string	"long long int"
+.LASF8:
+	.string	"signed char"
+.LASF16:
+	.string	"release"
+.LASF78:
+	.string	"alpha"
+.LASF73:
+	.string	"nextEta"
+.LASF3:
+	.string	"long int"
+.LASF22:
+	.string	"RLS_FILTER_FORM_LATTICE"
+.LASF56:
+	.string	"rlsFilter_Free"
+.LASF13:
+	.string	"double"
+.LASF64:
+	.string	"vectors"
+.LASF39:
+	.string	"memory"
+.LASF7:
+	.string	"unsigned int"
+.LASF86:
+	.string	"rlsFilter_Push"
+.LASF68:
+	.string	"gamma"
+.LASF35:
+	.string	"conversion"
+.LASF60:
+	.string	"vectorBytes"
+.LASF2:
+	.string	"long unsigned int"
+.LASF80:
+	.string	"inverseAlpha"
+.LASF76:
+	.string	"rlsFilter_LatticeSample"
+.LASF75:
+	.string	"nextGamma"
+.LASF83:
+	.string	"size"
+.LASF6:
+	.string	"short unsigned int"
+.LASF26:
+	.string	"form"
+.LASF66:
+	.string	"last"
+.LASF44:
+	.string	"rlsFilter_FormName"
+.LASF30:
+	.string	"inverse"
+.LASF65:
+	.string	"adaptJoint"
+.LASF48:
+	.string	"rlsFilter_ProcessBlock"
+.LASF74:
+	.string	"nextBeta"
+.LASF51:
+	.string	"output"
+.LASF34:
+	.string	"backwardError"
+.LASF81:
+	.string	"scaled"
+.LASF14:
+	.string	"long double"
+.LASF45:
+	.string	"rlsFilter_NormSquared"
+.LASF38:
+	.string	"joint"
+.LASF50:
+	.string	"desired"
+.LASF12:
+	.string	"float"
+.LASF52:
+	.string	"error"
+.LASF19:
+	.string	"LmsAllocator_t"
+.LASF27:
+	.string	"history"
+.LASF41:
+	.string	"lmsAllocator_AlignedSize"
+.LASF31:
+	.string	"gain"
+.LASF36:
+	.string	"forwardReflection"
+.LASF5:
+	.string	"unsigned char"
+.LASF53:
+	.string	"numOfSamples"
+.LASF9:
+	.string	"short int"
+.LASF85:
+	.string	"lmsAllocator_Heap"
+.LASF33:
+	.string	"backwardPower"
+.LASF29:
+	.string	"weights"
+.LASF49:
+	.string	"input"
+.LASF57:
+	.string	"heap"
+.LASF25:
+	.string	"length"
+.LASF10:
+	.string	"char"
+.LASF84:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF70:
+	.string	"previousPower"
+.LASF61:
+	.string	"matrixBytes"
+.LASF79:
+	.string	"trace"
+.LASF72:
+	.string	"power"
+.LASF17:
+	.string	"context"
+.LASF40:
+	.string	"RlsFilter_t"
+.LASF23:
+	.string	"RlsFilterForm_t"
+.LASF46:
+	.string	"filter"
+.LASF43:
+	.string	"memset"
+.LASF21:
+	.string	"RLS_FILTER_FORM_DIRECT"
+.LASF67:
+	.string	"beta"
+.LASF71:
+	.string	"previousGamma"
+.LASF59:
+	.string	"historyBytes"
+.LASF55:
+	.string	"rlsFilter_PushSample"
+.LASF69:
+	.string	"previousBeta"
+.LASF77:
+	.string	"rlsFilter_DirectSample"
+.LASF20:
+	.string	"RLS_FILTER_FORM_AUTO"
+.LASF28:
+	.string	"historyIndex"
+.LASF15:
+	.string	"allocate"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/rlsFilter.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9190 @@
+	.file	"sampleIo.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/sampleIo.c"
+	.section	.rodata
+.LC0:
+	.string	"text"
+.LC1:
+	.string	"f32"
+.LC2:
+	.string	"s16"
+.LC3:
+	.string	"wav"
+.LC4:
+	.string	"wavf32"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	sampleFormatNames, @object
+	.size	sampleFormatNames, 80
+sampleFormatNames:
+	.quad	.LC0
+	.long	1
+	.zero	4
+	.quad	.LC1
+	.long	2
+	.zero	4
+	.quad	.LC2
+	.long	3
+	.zero	4
+	.quad	.LC3
+	.long	4
+	.zero	4
+	.quad	.LC4
+	.long	5
+	.zero	4
+	.data
+	.align 4
+	.type	sampleIoBackend, @object
+	.size	sampleIoBackend, 4
+sampleIoBackend:
+	.long	1
+	.text
+	.type	sampleIo_BytesPerSample, @function
+sampleIo_BytesPerSample:
+.LFB6:
+	.file 1 "source/sampleIo.c"
+	.loc 1 53 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 54 12
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 56 5
+	cmp	DWORD PTR -20[rbp], 5
+	je	.L2
+	cmp	DWORD PTR -20[rbp], 5
+	ja	.L8
+	cmp	DWORD PTR -20[rbp], 2
+	je	.L2
+	cmp	DWORD PTR -20[rbp], 2
+	jb	.L8
+	mov	eax, DWORD PTR -20[rbp]
+	sub	eax, 3
+	cmp	eax, 1
+	ja	.L8
+	jmp	.L7
+.L2:
+	.loc 1 60 20
+	mov	QWORD PTR -8[rbp], 4
+	.loc 1 61 13
+	jmp	.L5
+.L7:
+	.loc 1 65 20
+	mov	QWORD PTR -8[rbp], 2
+	.loc 1 66 13
+	jmp	.L5
+.L8:
+	.loc 1 69 13
+	nop
+.L5:
+	.loc 1 71 12
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 72 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	sampleIo_BytesPerSample, .-sampleIo_BytesPerSample
+	.type	sampleIo_IsWav, @function
+sampleIo_IsWav:
+.LFB7:
+	.loc 1 75 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -4[rbp], edi
+	.loc 1 76 46
+	cmp	DWORD PTR -4[rbp], 4
+	je	.L10
+	.loc 1 76 46 is_stmt 0 discriminator 2
+	cmp	DWORD PTR -4[rbp], 5
+	jne	.L11
+.L10:
+	.loc 1 76 46 discriminator 3
+	mov	eax, 1
+	jmp	.L13
+.L11:
+	.loc 1 76 46 discriminator 4
+	mov	eax, 0
+.L13:
+	.loc 1 77 1 is_stmt 1 discriminator 7
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	sampleIo_IsWav, .-sampleIo_IsWav
+	.type	sampleIo_FloatToS16, @function
+sampleIo_FloatToS16:
+.LFB8:
+	.loc 1 80 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	movss	DWORD PTR -20[rbp], xmm0
+	.loc 1 81 11
+	movss	xmm1, DWORD PTR -20[rbp]
+	movss	xmm0, DWORD PTR .LC5[rip]
+	mulss	xmm0, xmm1
+	movss	DWORD PTR -4[rbp], xmm0
+	.loc 1 83 8
+	movss	xmm0, DWORD PTR -4[rbp]
+	comiss	xmm0, DWORD PTR .LC5[rip]
+	jbe	.L22
+	.loc 1 85 16
+	movss	xmm0, DWORD PTR .LC5[rip]
+	movss	DWORD PTR -4[rbp], xmm0
+	jmp	.L17
+.L22:
+	.loc 1 87 13
+	movss	xmm0, DWORD PTR .LC6[rip]
+	comiss	xmm0, DWORD PTR -4[rbp]
+	jbe	.L17
+	.loc 1 89 16
+	movss	xmm0, DWORD PTR .LC6[rip]
+	movss	DWORD PTR -4[rbp], xmm0
+.L17:
+	.loc 1 91 21
+	mov	eax, DWORD PTR -4[rbp]
+	movd	xmm0, eax
+	call	lrintf@PLT
+	.loc 1 92 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	sampleIo_FloatToS16, .-sampleIo_FloatToS16
+	.type	sampleIo_GetLe32, @function
+sampleIo_GetLe32:
+.LFB9:
+	.loc 1 95 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 96 27
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 96 12
+	movzx	eax, al
+	.loc 1 96 49
+	mov	rdx, QWORD PTR -8[rbp]
+	add	rdx, 1
+	movzx	edx, BYTE PTR [rdx]
+	.loc 1 96 34
+	movzx	edx, dl
+	.loc 1 96 53
+	sal	edx, 8
+	.loc 1 96 31
+	or	edx, eax
+	.loc 1 96 77
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 2
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 96 62
+	movzx	eax, al
+	.loc 1 96 81
+	sal	eax, 16
+	.loc 1 96 59
+	or	edx, eax
+	.loc 1 96 106
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 3
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 96 91
+	movzx	eax, al
+	.loc 1 96 110
+	sal	eax, 24
+	.loc 1 96 88
+	or	eax, edx
+	.loc 1 97 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	sampleIo_GetLe32, .-sampleIo_GetLe32
+	.type	sampleIo_GetLe16, @function
+sampleIo_GetLe16:
+.LFB10:
+	.loc 1 100 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 101 28
+	mov	rax, QWORD PTR -8[rbp]
+	movzx	eax, BYTE PTR [rax]
+	movzx	edx, al
+	.loc 1 101 40
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 1
+	movzx	eax, BYTE PTR [rax]
+	movzx	eax, al
+	.loc 1 101 44
+	sal	eax, 8
+	.loc 1 101 32
+	or	eax, edx
+	.loc 1 102 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	sampleIo_GetLe16, .-sampleIo_GetLe16
+	.type	sampleIo_PutLe32, @function
+sampleIo_PutLe32:
+.LFB11:
+	.loc 1 105 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	DWORD PTR -12[rbp], esi
+	.loc 1 106 14
+	mov	eax, DWORD PTR -12[rbp]
+	mov	edx, eax
+	mov	rax, QWORD PTR -8[rbp]
+	mov	BYTE PTR [rax], dl
+	.loc 1 107 23
+	mov	eax, DWORD PTR -12[rbp]
+	shr	eax, 8
+	mov	edx, eax
+	.loc 1 107 10
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 1
+	.loc 1 107 14
+	mov	BYTE PTR [rax], dl
+	.loc 1 108 23
+	mov	eax, DWORD PTR -12[rbp]
+	shr	eax, 16
+	mov	edx, eax
+	.loc 1 108 10
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 2
+	.loc 1 108 14
+	mov	BYTE PTR [rax], dl
+	.loc 1 109 30
+	mov	eax, DWORD PTR -12[rbp]
+	shr	eax, 24
+	mov	edx, eax
+	.loc 1 109 10
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 3
+	.loc 1 109 14
+	mov	BYTE PTR [rax], dl
+	.loc 1 110 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	sampleIo_PutLe32, .-sampleIo_PutLe32
+	.type	sampleIo_PutLe16, @function
+sampleIo_PutLe16:
+.LFB12:
+	.loc 1 113 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	eax, esi
+	mov	WORD PTR -12[rbp], ax
+	.loc 1 114 14
+	movzx	eax, WORD PTR -12[rbp]
+	mov	edx, eax
+	mov	rax, QWORD PTR -8[rbp]
+	mov	BYTE PTR [rax], dl
+	.loc 1 115 14
+	movzx	eax, WORD PTR -12[rbp]
+	shr	ax, 8
+	mov	edx, eax
+	.loc 1 115 10
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 1
+	.loc 1 115 14
+	mov	BYTE PTR [rax], dl
+	.loc 1 116 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	sampleIo_PutLe16, .-sampleIo_PutLe16
+	.type	sampleIo_Skip, @function
+sampleIo_Skip:
+.LFB13:
+	.loc 1 125 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 288
+	mov	QWORD PTR -280[rbp], rdi
+	mov	QWORD PTR -288[rbp], rsi
+	.loc 1 128 11
+	jmp	.L30
+.L35:
+.LBB2:
+	.loc 1 130 84
+	cmp	QWORD PTR -288[rbp], 255
+	jg	.L31
+	.loc 1 130 84 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -288[rbp]
+	jmp	.L32
+.L31:
+	.loc 1 130 84 discriminator 2
+	mov	eax, 256
+.L32:
+	.loc 1 130 16 is_stmt 1 discriminator 4
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 131 13 discriminator 4
+	mov	rcx, QWORD PTR -280[rbp]
+	mov	rdx, QWORD PTR -8[rbp]
+	lea	rax, -272[rbp]
+	mov	esi, 1
+	mov	rdi, rax
+	call	fread@PLT
+	.loc 1 131 12 discriminator 4
+	cmp	QWORD PTR -8[rbp], rax
+	je	.L33
+	.loc 1 133 20
+	mov	eax, 1
+	jmp	.L36
+.L33:
+	.loc 1 135 20
+	mov	rax, QWORD PTR -288[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR -288[rbp], rax
+.L30:
+.LBE2:
+	.loc 1 128 23
+	cmp	QWORD PTR -288[rbp], 0
+	jg	.L35
+	.loc 1 137 12
+	mov	eax, 0
+.L36:
+	.loc 1 138 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	sampleIo_Skip, .-sampleIo_Skip
+	.section	.rodata
+.LC7:
+	.string	"RIFF"
+.LC8:
+	.string	"WAVE"
+.LC9:
+	.string	"ERROR: %s is not a WAV file\n"
+.LC10:
+	.string	"fmt "
+	.align 8
+.LC11:
+	.string	"ERROR: %s unsupported WAV format, only 16-bit PCM and 32-bit float\n"
+.LC12:
+	.string	"data"
+	.align 8
+.LC13:
+	.string	"ERROR: %s has invalid WAV header\n"
+	.text
+	.type	sampleIo_ReadWavHeader, @function
+sampleIo_ReadWavHeader:
+.LFB14:
+	.loc 1 147 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 120
+	.cfi_offset 3, -24
+	mov	QWORD PTR -120[rbp], rdi
+	mov	QWORD PTR -128[rbp], rsi
+	.loc 1 151 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 153 10
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR [rax]
+	lea	rax, -54[rbp]
+	mov	rcx, rdx
+	mov	edx, 12
+	mov	esi, 1
+	mov	rdi, rax
+	call	fread@PLT
+	.loc 1 153 8
+	cmp	rax, 12
+	jne	.L38
+	.loc 1 154 13
+	lea	rax, -54[rbp]
+	mov	edx, 4
+	lea	rcx, .LC7[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcmp@PLT
+	.loc 1 154 9
+	test	eax, eax
+	jne	.L38
+	.loc 1 154 49 discriminator 1
+	lea	rax, -54[rbp]
+	add	rax, 8
+	mov	edx, 4
+	lea	rcx, .LC8[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcmp@PLT
+	.loc 1 154 45 discriminator 1
+	test	eax, eax
+	je	.L41
+.L38:
+	.loc 1 156 9
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rsi, rax
+	lea	rax, .LC9[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 157 16
+	mov	eax, 1
+	jmp	.L53
+.L52:
+.LBB3:
+	.loc 1 162 30
+	lea	rax, -62[rbp]
+	add	rax, 4
+	mov	rdi, rax
+	call	sampleIo_GetLe32
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 164 13
+	lea	rax, -62[rbp]
+	mov	edx, 4
+	lea	rcx, .LC10[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcmp@PLT
+	.loc 1 164 12
+	test	eax, eax
+	jne	.L42
+.LBB4:
+	.loc 1 166 68
+	mov	eax, DWORD PTR -28[rbp]
+	mov	edx, 40
+	cmp	eax, edx
+	cmova	eax, edx
+	.loc 1 166 20
+	mov	eax, eax
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 167 16
+	cmp	DWORD PTR -28[rbp], 15
+	jbe	.L43
+	.loc 1 167 38 discriminator 1
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rcx, QWORD PTR [rax]
+	mov	rdx, QWORD PTR -40[rbp]
+	lea	rax, -112[rbp]
+	mov	esi, 1
+	mov	rdi, rax
+	call	fread@PLT
+	.loc 1 167 34 discriminator 1
+	cmp	QWORD PTR -40[rbp], rax
+	jne	.L43
+	.loc 1 171 62
+	mov	eax, DWORD PTR -28[rbp]
+	sub	rax, QWORD PTR -40[rbp]
+	.loc 1 171 85
+	mov	edx, DWORD PTR -28[rbp]
+	and	edx, 1
+	.loc 1 171 72
+	add	rax, rdx
+	.loc 1 171 17
+	mov	rdx, rax
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	sampleIo_Skip
+	.loc 1 171 16
+	test	eax, eax
+	jne	.L54
+	.loc 1 176 34
+	lea	rax, -112[rbp]
+	mov	rdi, rax
+	call	sampleIo_GetLe16
+	mov	WORD PTR -22[rbp], ax
+	.loc 1 177 38
+	lea	rax, -112[rbp]
+	add	rax, 14
+	mov	rdi, rax
+	call	sampleIo_GetLe16
+	mov	WORD PTR -42[rbp], ax
+	.loc 1 178 16
+	cmp	WORD PTR -22[rbp], -2
+	jne	.L45
+	.loc 1 178 54 discriminator 1
+	cmp	QWORD PTR -40[rbp], 25
+	jbe	.L45
+	.loc 1 180 29
+	lea	rax, -112[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	sampleIo_GetLe16
+	mov	WORD PTR -22[rbp], ax
+.L45:
+	.loc 1 182 32
+	lea	rax, -112[rbp]
+	add	rax, 2
+	mov	rdi, rax
+	call	sampleIo_GetLe16
+	movzx	edx, ax
+	.loc 1 182 30
+	mov	rax, QWORD PTR -120[rbp]
+	mov	DWORD PTR 12[rax], edx
+	.loc 1 183 34
+	lea	rax, -112[rbp]
+	add	rax, 4
+	mov	rdi, rax
+	call	sampleIo_GetLe32
+	.loc 1 183 32
+	mov	rdx, QWORD PTR -120[rbp]
+	mov	DWORD PTR 16[rdx], eax
+	.loc 1 185 16
+	cmp	WORD PTR -22[rbp], 1
+	jne	.L46
+	.loc 1 185 47 discriminator 1
+	cmp	WORD PTR -42[rbp], 16
+	jne	.L46
+	.loc 1 187 32
+	mov	rax, QWORD PTR -120[rbp]
+	mov	DWORD PTR 8[rax], 4
+	jmp	.L47
+.L46:
+	.loc 1 189 21
+	cmp	WORD PTR -22[rbp], 3
+	jne	.L48
+	.loc 1 189 59 discriminator 1
+	cmp	WORD PTR -42[rbp], 32
+	jne	.L48
+	.loc 1 191 32
+	mov	rax, QWORD PTR -120[rbp]
+	mov	DWORD PTR 8[rax], 5
+	jmp	.L47
+.L48:
+	.loc 1 195 17
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rsi, rax
+	lea	rax, .LC11[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 196 24
+	mov	eax, 1
+	jmp	.L53
+.L47:
+	.loc 1 198 22
+	mov	DWORD PTR -20[rbp], 1
+.LBE4:
+	jmp	.L41
+.L42:
+	.loc 1 200 18
+	lea	rax, -62[rbp]
+	mov	edx, 4
+	lea	rcx, .LC12[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcmp@PLT
+	.loc 1 200 17
+	test	eax, eax
+	jne	.L50
+	.loc 1 202 16
+	cmp	DWORD PTR -20[rbp], 0
+	je	.L43
+	.loc 1 202 43 discriminator 1
+	mov	rax, QWORD PTR -120[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 202 33 discriminator 1
+	test	eax, eax
+	jle	.L43
+	.loc 1 207 16
+	cmp	DWORD PTR -28[rbp], 0
+	je	.L51
+	.loc 1 207 34 discriminator 1
+	cmp	DWORD PTR -28[rbp], -1
+	je	.L51
+	.loc 1 209 39
+	mov	edx, DWORD PTR -28[rbp]
+	mov	rax, QWORD PTR -120[rbp]
+	mov	QWORD PTR 40[rax], rdx
+	.loc 1 210 49
+	mov	ebx, DWORD PTR -28[rbp]
+	.loc 1 210 52
+	mov	rax, QWORD PTR -120[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	.loc 1 210 100
+	mov	rdx, QWORD PTR -120[rbp]
+	mov	edx, DWORD PTR 12[rdx]
+	movsx	rdx, edx
+	.loc 1 210 92
+	mov	rcx, rdx
+	imul	rcx, rax
+	.loc 1 210 49
+	mov	rax, rbx
+	mov	edx, 0
+	div	rcx
+	mov	rdx, rax
+	.loc 1 210 37
+	mov	rax, QWORD PTR -120[rbp]
+	mov	QWORD PTR 24[rax], rdx
+.L51:
+	.loc 1 212 20
+	mov	eax, 0
+	jmp	.L53
+.L50:
+	.loc 1 214 63
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, 1
+	.loc 1 214 46
+	mov	eax, eax
+	.loc 1 214 18
+	and	eax, 4294967294
+	mov	rdx, rax
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	sampleIo_Skip
+	.loc 1 214 17
+	test	eax, eax
+	jne	.L55
+.L41:
+.LBE3:
+	.loc 1 160 12
+	mov	rax, QWORD PTR -120[rbp]
+	mov	rdx, QWORD PTR [rax]
+	lea	rax, -62[rbp]
+	mov	rcx, rdx
+	mov	edx, 8
+	mov	esi, 1
+	mov	rdi, rax
+	call	fread@PLT
+	.loc 1 160 57
+	cmp	rax, 8
+	je	.L52
+	jmp	.L43
+.L54:
+.LBB6:
+.LBB5:
+	.loc 1 173 17
+	nop
+	jmp	.L43
+.L55:
+.LBE5:
+	.loc 1 216 13
+	nop
+.L43:
+.LBE6:
+	.loc 1 220 5
+	mov	rax, QWORD PTR -128[rbp]
+	mov	rsi, rax
+	lea	rax, .LC13[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 221 12
+	mov	eax, 1
+.L53:
+	.loc 1 222 1 discriminator 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	sampleIo_ReadWavHeader, .-sampleIo_ReadWavHeader
+	.type	sampleIo_WriteWavHeader, @function
+sampleIo_WriteWavHeader:
+.LFB15:
+	.loc 1 230 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -72[rbp], rdi
+	.loc 1 232 37
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	.loc 1 232 20
+	mov	WORD PTR -2[rbp], ax
+	.loc 1 233 37
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 233 20
+	mov	edx, eax
+	.loc 1 233 59
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 233 20
+	imul	edx, eax
+	movzx	eax, WORD PTR -2[rbp]
+	imul	eax, edx
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 235 5
+	lea	rax, -64[rbp]
+	mov	edx, 4
+	lea	rcx, .LC7[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 236 5
+	mov	eax, DWORD PTR -8[rbp]
+	lea	edx, 36[rax]
+	lea	rax, -64[rbp]
+	add	rax, 4
+	mov	esi, edx
+	mov	rdi, rax
+	call	sampleIo_PutLe32
+	.loc 1 237 5
+	lea	rax, -64[rbp]
+	add	rax, 8
+	mov	edx, 4
+	lea	rcx, .LC8[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 238 5
+	lea	rax, -64[rbp]
+	add	rax, 12
+	mov	edx, 4
+	lea	rcx, .LC10[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 239 5
+	lea	rax, -64[rbp]
+	add	rax, 16
+	mov	esi, 16
+	mov	rdi, rax
+	call	sampleIo_PutLe32
+	.loc 1 240 42
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 240 5
+	cmp	eax, 5
+	jne	.L57
+	.loc 1 240 5 is_stmt 0 discriminator 1
+	mov	edx, 3
+	jmp	.L58
+.L57:
+	.loc 1 240 5 discriminator 2
+	mov	edx, 1
+.L58:
+	.loc 1 240 5 discriminator 4
+	lea	rax, -64[rbp]
+	add	rax, 20
+	mov	esi, edx
+	mov	rdi, rax
+	call	sampleIo_PutLe16
+	.loc 1 241 41 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 241 5 discriminator 4
+	movzx	eax, ax
+	lea	rdx, -64[rbp]
+	add	rdx, 22
+	mov	esi, eax
+	mov	rdi, rdx
+	call	sampleIo_PutLe16
+	.loc 1 242 5 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	lea	rdx, -64[rbp]
+	add	rdx, 24
+	mov	esi, eax
+	mov	rdi, rdx
+	call	sampleIo_PutLe32
+	.loc 1 243 41 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 243 62 discriminator 4
+	mov	rdx, QWORD PTR -72[rbp]
+	mov	edx, DWORD PTR 12[rdx]
+	.loc 1 243 54 discriminator 4
+	imul	edx, eax
+	.loc 1 243 5 discriminator 4
+	movzx	eax, WORD PTR -2[rbp]
+	imul	eax, edx
+	lea	rdx, -64[rbp]
+	add	rdx, 28
+	mov	esi, eax
+	mov	rdi, rdx
+	call	sampleIo_PutLe32
+	.loc 1 244 41 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 244 5 discriminator 4
+	imul	ax, WORD PTR -2[rbp]
+	movzx	eax, ax
+	lea	rdx, -64[rbp]
+	add	rdx, 32
+	mov	esi, eax
+	mov	rdi, rdx
+	call	sampleIo_PutLe16
+	.loc 1 245 5 discriminator 4
+	movzx	eax, WORD PTR -2[rbp]
+	sal	eax, 3
+	movzx	eax, ax
+	lea	rdx, -64[rbp]
+	add	rdx, 34
+	mov	esi, eax
+	mov	rdi, rdx
+	call	sampleIo_PutLe16
+	.loc 1 246 5 discriminator 4
+	lea	rax, -64[rbp]
+	add	rax, 36
+	mov	edx, 4
+	lea	rcx, .LC12[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 247 5 discriminator 4
+	mov	eax, DWORD PTR -8[rbp]
+	lea	rdx, -64[rbp]
+	add	rdx, 40
+	mov	esi, eax
+	mov	rdi, rdx
+	call	sampleIo_PutLe32
+	.loc 1 249 13 discriminator 4
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR [rax]
+	lea	rax, -64[rbp]
+	mov	rcx, rdx
+	mov	edx, 44
+	mov	esi, 1
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 249 95 discriminator 4
+	cmp	rax, 44
+	setne	al
+	movzx	eax, al
+	.loc 1 250 1 discriminator 4
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	sampleIo_WriteWavHeader, .-sampleIo_WriteWavHeader
+	.type	sampleIo_OpenText, @function
+sampleIo_OpenText:
+.LFB16:
+	.loc 1 258 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 259 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 259 8
+	test	rax, rax
+	jle	.L61
+.LBB7:
+	.loc 1 261 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	edx, eax
+	.loc 1 261 41
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 261 24
+	mov	r9d, 0
+	mov	r8d, edx
+	mov	ecx, 2
+	mov	edx, 1
+	mov	rsi, rax
+	mov	edi, 0
+	call	mmap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 262 12
+	cmp	QWORD PTR -8[rbp], -1
+	je	.L61
+	.loc 1 264 35
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 264 13
+	mov	rcx, rax
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, 2
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	madvise@PLT
+	.loc 1 265 40
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	mov	rdx, rax
+	.loc 1 265 32
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 80[rax], rdx
+	.loc 1 266 26
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR 56[rax], rdx
+	.loc 1 267 37
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 267 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	.loc 1 268 37
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 268 52
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 268 44
+	add	rdx, rax
+	.loc 1 268 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	.loc 1 269 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 88[rax], 1
+	.loc 1 270 20
+	mov	eax, 0
+	jmp	.L62
+.L61:
+.LBE7:
+	.loc 1 274 22
+	mov	edi, 65536
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 274 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 275 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 275 8
+	test	rax, rax
+	jne	.L63
+	.loc 1 277 16
+	mov	eax, 1
+	jmp	.L62
+.L63:
+	.loc 1 279 39
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	.loc 1 279 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 56[rax], rdx
+	.loc 1 280 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 280 21
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	.loc 1 281 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 281 21
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	.loc 1 282 12
+	mov	eax, 0
+.L62:
+	.loc 1 283 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	sampleIo_OpenText, .-sampleIo_OpenText
+	.type	sampleIo_RefillText, @function
+sampleIo_RefillText:
+.LFB17:
+	.loc 1 290 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 291 11
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 292 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 72[rax]
+	.loc 1 292 43
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 292 35
+	sub	rdx, rax
+	.loc 1 292 12
+	mov	QWORD PTR -16[rbp], rdx
+	.loc 1 294 27
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR 64[rax]
+	.loc 1 294 5
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memmove@PLT
+	.loc 1 295 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR [rax]
+	mov	eax, 65536
+	sub	rax, QWORD PTR -16[rbp]
+	.loc 1 295 24
+	mov	rsi, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	lea	rdi, [rsi+rcx]
+	.loc 1 295 18
+	mov	rcx, rdx
+	mov	rdx, rax
+	mov	esi, 1
+	call	fread@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 296 32
+	mov	eax, 65536
+	sub	rax, QWORD PTR -16[rbp]
+	.loc 1 296 8
+	cmp	QWORD PTR -24[rbp], rax
+	jnb	.L65
+	.loc 1 298 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 88[rax], 1
+.L65:
+	.loc 1 300 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR 64[rax], rdx
+	.loc 1 301 37
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rdx, rax
+	mov	rax, QWORD PTR -8[rbp]
+	add	rdx, rax
+	.loc 1 301 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 72[rax], rdx
+	.loc 1 302 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	sampleIo_RefillText, .-sampleIo_RefillText
+	.type	sampleIo_ReadText, @function
+sampleIo_ReadText:
+.LFB18:
+	.loc 1 312 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	DWORD PTR -36[rbp], edx
+	.loc 1 315 12
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 315 5
+	jmp	.L67
+.L72:
+.LBB8:
+	.loc 1 317 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 88[rax]
+	.loc 1 317 12
+	test	eax, eax
+	jne	.L68
+	.loc 1 317 46 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 72[rax]
+	.loc 1 317 64 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 317 56 discriminator 1
+	sub	rdx, rax
+	.loc 1 317 36 discriminator 1
+	cmp	rdx, 255
+	jg	.L68
+	.loc 1 319 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	sampleIo_RefillText
+.L68:
+	.loc 1 322 86
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 322 28
+	mov	rax, QWORD PTR -32[rbp]
+	add	rdx, rax
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 72[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	fastFloat_Parse@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 323 12
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L74
+	.loc 1 327 27
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 72[rax]
+	.loc 1 327 12
+	cmp	QWORD PTR -16[rbp], rax
+	jnb	.L71
+	.loc 1 327 42 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 327 38 discriminator 1
+	cmp	al, 59
+	jne	.L71
+	.loc 1 329 17
+	add	QWORD PTR -16[rbp], 1
+.L71:
+	.loc 1 331 25 discriminator 2
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 64[rax], rdx
+.LBE8:
+	.loc 1 315 29 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L67:
+	.loc 1 315 19 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -36[rbp]
+	jl	.L72
+	jmp	.L70
+.L74:
+.LBB9:
+	.loc 1 325 13
+	nop
+.L70:
+.LBE9:
+	.loc 1 333 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 334 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	sampleIo_ReadText, .-sampleIo_ReadText
+	.type	sampleIo_FlushBuffer, @function
+sampleIo_FlushBuffer:
+.LFB19:
+	.loc 1 343 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 344 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 346 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 346 8
+	test	eax, eax
+	je	.L76
+	.loc 1 348 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 348 12
+	test	rax, rax
+	je	.L77
+	.loc 1 350 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	mov	rdx, QWORD PTR -24[rbp]
+	add	rdx, 72
+	mov	rsi, rax
+	mov	rdi, rdx
+	call	asyncFile_CommitWrite@PLT
+	.loc 1 351 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 40[rax], 0
+	jmp	.L77
+.L76:
+	.loc 1 354 21
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 354 13
+	test	rax, rax
+	je	.L77
+	.loc 1 355 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR [rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 355 31
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 355 18
+	mov	esi, 1
+	mov	rdi, rax
+	call	fwrite@PLT
+	mov	rdx, rax
+	.loc 1 355 89
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 355 14
+	cmp	rdx, rax
+	je	.L77
+	.loc 1 357 16
+	mov	DWORD PTR -4[rbp], 1
+.L77:
+	.loc 1 359 26
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 56[rax], 0
+	.loc 1 360 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 361 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	sampleIo_FlushBuffer, .-sampleIo_FlushBuffer
+	.type	sampleIo_AcquireBuffer, @function
+sampleIo_AcquireBuffer:
+.LFB20:
+	.loc 1 369 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 370 15
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 370 8
+	test	rax, rax
+	jne	.L80
+	.loc 1 372 26
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 72
+	mov	rdi, rax
+	call	asyncFile_AcquireWrite@PLT
+	.loc 1 372 24
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	QWORD PTR 40[rdx], rax
+.L80:
+	.loc 1 374 19
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 374 52
+	test	rax, rax
+	sete	al
+	movzx	eax, al
+	.loc 1 375 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	sampleIo_AcquireBuffer, .-sampleIo_AcquireBuffer
+	.type	sampleIo_WriteText, @function
+sampleIo_WriteText:
+.LFB21:
+	.loc 1 386 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -56[rbp], rdi
+	mov	QWORD PTR -64[rbp], rsi
+	mov	DWORD PTR -68[rbp], edx
+	.loc 1 387 45
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, DWORD PTR 12[rax]
+	.loc 1 387 56
+	mov	eax, edx
+	sal	eax, 6
+	add	eax, edx
+	.loc 1 387 91
+	add	eax, 25
+	.loc 1 387 18
+	cdqe
+	mov	QWORD PTR -32[rbp], rax
+.LBB10:
+	.loc 1 389 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 389 5
+	jmp	.L83
+.L90:
+.LBB11:
+	.loc 1 391 49
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 391 41
+	imul	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 391 38
+	lea	rdx, 0[0+rax*4]
+	.loc 1 391 22
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 392 16
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 394 20
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 394 33
+	sub	rax, QWORD PTR -16[rbp]
+	.loc 1 394 12
+	cmp	rax, QWORD PTR -32[rbp]
+	jnb	.L84
+	.loc 1 394 63 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	sampleIo_FlushBuffer
+	.loc 1 394 59 discriminator 1
+	test	eax, eax
+	je	.L84
+	.loc 1 396 20
+	mov	eax, 1
+	jmp	.L85
+.L84:
+	.loc 1 398 13
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdi, rax
+	call	sampleIo_AcquireBuffer
+	.loc 1 398 12
+	test	eax, eax
+	je	.L86
+	.loc 1 400 20
+	mov	eax, 1
+	jmp	.L85
+.L86:
+	.loc 1 402 16
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 403 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 405 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 405 12
+	cmp	eax, 1
+	jle	.L87
+	.loc 1 407 70
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 407 23
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	add	rdx, rax
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rcx
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	fastFloat_FormatInteger@PLT
+	.loc 1 407 20
+	add	QWORD PTR -16[rbp], rax
+	.loc 1 408 26
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -16[rbp], rdx
+	.loc 1 408 19
+	mov	rdx, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 408 30
+	mov	BYTE PTR [rax], 59
+.L87:
+.LBB12:
+	.loc 1 410 18
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 410 9
+	jmp	.L88
+.L89:
+	.loc 1 412 62 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 412 23 discriminator 3
+	mov	eax, DWORD PTR [rax]
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rdx, rcx
+	mov	esi, 6
+	movd	xmm0, eax
+	mov	rdi, rdx
+	call	fastFloat_Format@PLT
+	.loc 1 412 20 discriminator 3
+	add	QWORD PTR -16[rbp], rax
+	.loc 1 413 26 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -16[rbp], rdx
+	.loc 1 413 19 discriminator 3
+	mov	rdx, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 413 30 discriminator 3
+	mov	BYTE PTR [rax], 59
+	.loc 1 410 48 discriminator 3
+	add	DWORD PTR -20[rbp], 1
+.L88:
+	.loc 1 410 35 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 410 27 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jl	.L89
+.LBE12:
+	.loc 1 415 22 discriminator 2
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 1[rax]
+	mov	QWORD PTR -16[rbp], rdx
+	.loc 1 415 15 discriminator 2
+	mov	rdx, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 415 26 discriminator 2
+	mov	BYTE PTR [rax], 10
+	.loc 1 416 30 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 56[rax], rdx
+.LBE11:
+	.loc 1 389 39 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L83:
+	.loc 1 389 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -68[rbp]
+	jl	.L90
+.LBE10:
+	.loc 1 418 11
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 418 25
+	mov	eax, DWORD PTR -68[rbp]
+	cdqe
+	add	rdx, rax
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 420 12
+	mov	eax, 0
+.L85:
+	.loc 1 421 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	sampleIo_WriteText, .-sampleIo_WriteText
+	.type	sampleIo_ReadAsync, @function
+sampleIo_ReadAsync:
+.LFB22:
+	.loc 1 432 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 80
+	mov	QWORD PTR -56[rbp], rdi
+	mov	QWORD PTR -64[rbp], rsi
+	mov	QWORD PTR -72[rbp], rdx
+	.loc 1 433 35
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 434 12
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 436 11
+	jmp	.L92
+.L103:
+.LBB13:
+	.loc 1 438 19
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 616[rax]
+	.loc 1 438 36
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 608[rax]
+	.loc 1 438 12
+	cmp	rdx, rax
+	jne	.L93
+.LBB14:
+	.loc 1 440 23
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 600[rax]
+	.loc 1 440 16
+	test	rax, rax
+	je	.L94
+	.loc 1 442 17
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, 96
+	mov	rdi, rax
+	call	asyncFile_ReleaseRead@PLT
+	.loc 1 443 32
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 600[rax], 0
+.L94:
+	.loc 1 445 27
+	mov	rax, QWORD PTR -56[rbp]
+	lea	rdx, 600[rax]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, 96
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	asyncFile_AcquireRead@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 446 16
+	cmp	QWORD PTR -48[rbp], 0
+	jg	.L95
+	.loc 1 448 32
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 600[rax], 0
+	.loc 1 449 34
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 608[rax], 0
+	.loc 1 450 31
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 616[rax], 0
+	.loc 1 451 17
+	jmp	.L96
+.L95:
+	.loc 1 453 32
+	mov	rcx, QWORD PTR -48[rbp]
+	.loc 1 453 46
+	mov	rax, QWORD PTR -48[rbp]
+	.loc 1 453 58
+	mov	edx, 0
+	div	QWORD PTR -32[rbp]
+	mov	rax, rdx
+	.loc 1 453 44
+	sub	rcx, rax
+	mov	rdx, rcx
+	.loc 1 453 30
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 608[rax], rdx
+	.loc 1 454 27
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 616[rax], 0
+	.loc 1 455 13
+	jmp	.L92
+.L93:
+.LBE14:
+	.loc 1 458 27
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 608[rax]
+	.loc 1 458 46
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 616[rax]
+	.loc 1 458 38
+	sub	rdx, rax
+	.loc 1 458 16
+	mov	rax, rdx
+	mov	edx, 0
+	div	QWORD PTR -32[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 459 23
+	mov	rax, QWORD PTR -72[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	.loc 1 459 12
+	cmp	rax, QWORD PTR -16[rbp]
+	jnb	.L98
+	.loc 1 461 15
+	mov	rax, QWORD PTR -72[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR -16[rbp], rax
+.L98:
+	.loc 1 463 12
+	cmp	QWORD PTR -32[rbp], 4
+	jne	.L99
+	.loc 1 465 13
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 465 43
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rcx, QWORD PTR 600[rax]
+	.loc 1 465 58
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 616[rax]
+	.loc 1 465 36
+	add	rcx, rax
+	.loc 1 465 28
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rsi, 0[0+rax*4]
+	.loc 1 465 20
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rsi
+	.loc 1 465 13
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	jmp	.L100
+.L99:
+.LBB15:
+	.loc 1 469 57
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 600[rax]
+	.loc 1 469 72
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 616[rax]
+	.loc 1 469 28
+	add	rax, rdx
+	mov	QWORD PTR -40[rbp], rax
+.LBB16:
+	.loc 1 470 25
+	mov	QWORD PTR -24[rbp], 0
+	.loc 1 470 13
+	jmp	.L101
+.L102:
+	.loc 1 472 40 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	.loc 1 472 44 discriminator 3
+	cwde
+	pxor	xmm1, xmm1
+	cvtsi2ss	xmm1, eax
+	.loc 1 472 30 discriminator 3
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 472 24 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -64[rbp]
+	add	rax, rdx
+	.loc 1 472 44 discriminator 3
+	movss	xmm0, DWORD PTR .LC14[rip]
+	mulss	xmm0, xmm1
+	.loc 1 472 35 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 470 40 discriminator 3
+	add	QWORD PTR -24[rbp], 1
+.L101:
+	.loc 1 470 34 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	cmp	rax, QWORD PTR -16[rbp]
+	jb	.L102
+.L100:
+.LBE16:
+.LBE15:
+	.loc 1 475 14
+	mov	rax, QWORD PTR -16[rbp]
+	add	QWORD PTR -8[rbp], rax
+	.loc 1 476 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 616[rax]
+	.loc 1 476 28
+	mov	rax, QWORD PTR -16[rbp]
+	imul	rax, QWORD PTR -32[rbp]
+	.loc 1 476 23
+	add	rdx, rax
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 616[rax], rdx
+	.loc 1 477 15
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rdx, QWORD PTR 624[rax]
+	.loc 1 477 40
+	mov	rax, QWORD PTR -16[rbp]
+	imul	rax, QWORD PTR -32[rbp]
+	.loc 1 477 28
+	add	rdx, rax
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR 624[rax], rdx
+.L92:
+.LBE13:
+	.loc 1 436 17
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -72[rbp]
+	jb	.L103
+.L96:
+	.loc 1 479 12
+	mov	rax, QWORD PTR -8[rbp]
+	.loc 1 480 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	sampleIo_ReadAsync, .-sampleIo_ReadAsync
+	.type	sampleIo_WriteAsync, @function
+sampleIo_WriteAsync:
+.LFB23:
+	.loc 1 490 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 104
+	.cfi_offset 3, -24
+	mov	QWORD PTR -88[rbp], rdi
+	mov	QWORD PTR -96[rbp], rsi
+	mov	DWORD PTR -100[rbp], edx
+	.loc 1 491 35
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 492 26
+	mov	eax, DWORD PTR -100[rbp]
+	movsx	rdx, eax
+	.loc 1 492 54
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 492 18
+	imul	rax, rdx
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 493 12
+	mov	QWORD PTR -24[rbp], 0
+	.loc 1 495 11
+	jmp	.L106
+.L115:
+.LBB17:
+	.loc 1 497 20
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 497 44
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 497 12
+	cmp	rdx, rax
+	jne	.L107
+	.loc 1 497 62 discriminator 1
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdi, rax
+	call	sampleIo_FlushBuffer
+	.loc 1 497 58 discriminator 1
+	test	eax, eax
+	je	.L107
+	.loc 1 499 20
+	mov	eax, 1
+	jmp	.L108
+.L107:
+	.loc 1 501 13
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdi, rax
+	call	sampleIo_AcquireBuffer
+	.loc 1 501 12
+	test	eax, eax
+	je	.L109
+	.loc 1 503 20
+	mov	eax, 1
+	jmp	.L108
+.L109:
+	.loc 1 506 27
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 48[rax]
+	.loc 1 506 48
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 506 40
+	sub	rdx, rax
+	.loc 1 506 16
+	mov	rax, rdx
+	mov	edx, 0
+	div	QWORD PTR -48[rbp]
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 507 23
+	mov	rax, QWORD PTR -56[rbp]
+	sub	rax, QWORD PTR -24[rbp]
+	.loc 1 507 12
+	cmp	rax, QWORD PTR -32[rbp]
+	jnb	.L110
+	.loc 1 509 15
+	mov	rax, QWORD PTR -56[rbp]
+	sub	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -32[rbp], rax
+.L110:
+	.loc 1 511 52
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 511 69
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 511 24
+	add	rax, rdx
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 512 12
+	cmp	QWORD PTR -48[rbp], 4
+	jne	.L111
+	.loc 1 514 13
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 514 33
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rcx, 0[0+rax*4]
+	.loc 1 514 25
+	mov	rax, QWORD PTR -96[rbp]
+	add	rcx, rax
+	.loc 1 514 13
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	jmp	.L112
+.L111:
+.LBB18:
+	.loc 1 518 22
+	mov	rax, QWORD PTR -64[rbp]
+	mov	QWORD PTR -72[rbp], rax
+.LBB19:
+	.loc 1 519 25
+	mov	QWORD PTR -40[rbp], 0
+	.loc 1 519 13
+	jmp	.L113
+.L114:
+	.loc 1 521 65 discriminator 3
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 521 59 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	.loc 1 521 32 discriminator 3
+	mov	eax, DWORD PTR [rax]
+	.loc 1 521 26 discriminator 3
+	mov	rdx, QWORD PTR -40[rbp]
+	lea	rcx, [rdx+rdx]
+	mov	rdx, QWORD PTR -72[rbp]
+	lea	rbx, [rcx+rdx]
+	.loc 1 521 32 discriminator 3
+	movd	xmm0, eax
+	call	sampleIo_FloatToS16
+	.loc 1 521 30 discriminator 3
+	mov	WORD PTR [rbx], ax
+	.loc 1 519 40 discriminator 3
+	add	QWORD PTR -40[rbp], 1
+.L113:
+	.loc 1 519 34 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	cmp	rax, QWORD PTR -32[rbp]
+	jb	.L114
+.L112:
+.LBE19:
+.LBE18:
+	.loc 1 524 15
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 56[rax]
+	.loc 1 524 35
+	mov	rax, QWORD PTR -32[rbp]
+	imul	rax, QWORD PTR -48[rbp]
+	.loc 1 524 30
+	add	rdx, rax
+	mov	rax, QWORD PTR -88[rbp]
+	mov	QWORD PTR 56[rax], rdx
+	.loc 1 525 14
+	mov	rax, QWORD PTR -32[rbp]
+	add	QWORD PTR -24[rbp], rax
+.L106:
+.LBE17:
+	.loc 1 495 17
+	mov	rax, QWORD PTR -24[rbp]
+	cmp	rax, QWORD PTR -56[rbp]
+	jb	.L115
+	.loc 1 527 11
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 527 25
+	mov	eax, DWORD PTR -100[rbp]
+	cdqe
+	add	rdx, rax
+	mov	rax, QWORD PTR -88[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 529 12
+	mov	eax, 0
+.L108:
+	.loc 1 530 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	sampleIo_WriteAsync, .-sampleIo_WriteAsync
+	.globl	sampleIo_SetBackend
+	.type	sampleIo_SetBackend, @function
+sampleIo_SetBackend:
+.LFB24:
+	.loc 1 533 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -4[rbp], edi
+	.loc 1 534 21
+	mov	eax, DWORD PTR -4[rbp]
+	mov	DWORD PTR sampleIoBackend[rip], eax
+	.loc 1 535 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	sampleIo_SetBackend, .-sampleIo_SetBackend
+	.section	.rodata
+	.align 8
+.LC15:
+	.string	"ERROR: Unknown argument for <format>, expected text, f32, s16, wav or wavf32"
+	.text
+	.globl	sampleIo_processArgumentFormat
+	.type	sampleIo_processArgumentFormat, @function
+sampleIo_processArgumentFormat:
+.LFB25:
+	.loc 1 538 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+.LBB20:
+	.loc 1 539 23
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 539 5
+	jmp	.L118
+.L121:
+	.loc 1 541 48
+	mov	eax, DWORD PTR -4[rbp]
+	sal	rax, 4
+	mov	rdx, rax
+	lea	rax, sampleFormatNames[rip]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 541 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 541 12
+	test	eax, eax
+	jne	.L119
+	.loc 1 543 40
+	mov	eax, DWORD PTR -4[rbp]
+	sal	rax, 4
+	mov	rdx, rax
+	lea	rax, sampleFormatNames[rip+8]
+	mov	eax, DWORD PTR [rdx+rax]
+	jmp	.L120
+.L119:
+	.loc 1 539 93 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L118:
+	.loc 1 539 32 discriminator 1
+	cmp	DWORD PTR -4[rbp], 4
+	jbe	.L121
+.LBE20:
+	.loc 1 546 5
+	lea	rax, .LC15[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 547 12
+	mov	eax, 0
+.L120:
+	.loc 1 548 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	sampleIo_processArgumentFormat, .-sampleIo_processArgumentFormat
+	.section	.rodata
+.LC16:
+	.string	".f32"
+.LC17:
+	.string	".s16"
+.LC18:
+	.string	".pcm"
+.LC19:
+	.string	".wav"
+	.text
+	.globl	sampleIo_FormatFromFileName
+	.type	sampleIo_FormatFromFileName, @function
+sampleIo_FormatFromFileName:
+.LFB26:
+	.loc 1 551 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 552 20
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 553 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, 46
+	mov	rdi, rax
+	call	strrchr@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 555 8
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L123
+	.loc 1 557 13
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, .LC16[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 557 12
+	test	eax, eax
+	jne	.L124
+	.loc 1 559 20
+	mov	DWORD PTR -4[rbp], 2
+	jmp	.L123
+.L124:
+	.loc 1 561 19
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, .LC17[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 561 17
+	test	eax, eax
+	je	.L125
+	.loc 1 561 55 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, .LC18[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 561 51 discriminator 1
+	test	eax, eax
+	jne	.L126
+.L125:
+	.loc 1 563 20
+	mov	DWORD PTR -4[rbp], 3
+	jmp	.L123
+.L126:
+	.loc 1 565 18
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, .LC19[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 565 17
+	test	eax, eax
+	jne	.L123
+	.loc 1 567 20
+	mov	DWORD PTR -4[rbp], 4
+.L123:
+	.loc 1 570 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 571 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	sampleIo_FormatFromFileName, .-sampleIo_FormatFromFileName
+	.section	.rodata
+.LC20:
+	.string	"unknown"
+	.text
+	.globl	sampleIo_FormatName
+	.type	sampleIo_FormatName, @function
+sampleIo_FormatName:
+.LFB27:
+	.loc 1 574 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -20[rbp], edi
+.LBB21:
+	.loc 1 575 23
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 575 5
+	jmp	.L129
+.L132:
+	.loc 1 577 33
+	mov	eax, DWORD PTR -4[rbp]
+	sal	rax, 4
+	mov	rdx, rax
+	lea	rax, sampleFormatNames[rip+8]
+	mov	eax, DWORD PTR [rdx+rax]
+	.loc 1 577 12
+	cmp	DWORD PTR -20[rbp], eax
+	jne	.L130
+	.loc 1 579 40
+	mov	eax, DWORD PTR -4[rbp]
+	sal	rax, 4
+	mov	rdx, rax
+	lea	rax, sampleFormatNames[rip]
+	mov	rax, QWORD PTR [rdx+rax]
+	jmp	.L131
+.L130:
+	.loc 1 575 93 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L129:
+	.loc 1 575 32 discriminator 1
+	cmp	DWORD PTR -4[rbp], 4
+	jbe	.L132
+.LBE21:
+	.loc 1 582 12
+	lea	rax, .LC20[rip]
+.L131:
+	.loc 1 583 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	sampleIo_FormatName, .-sampleIo_FormatName
+	.section	.rodata
+.LC21:
+	.string	"-"
+.LC22:
+	.string	"r"
+.LC23:
+	.string	"rb"
+.LC24:
+	.string	"Error allocating read buffer"
+	.text
+	.globl	sampleIo_OpenReader
+	.type	sampleIo_OpenReader, @function
+sampleIo_OpenReader:
+.LFB28:
+	.loc 1 586 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r12
+	push	rbx
+	sub	rsp, 192
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	mov	QWORD PTR -184[rbp], rdi
+	mov	QWORD PTR -192[rbp], rsi
+	mov	DWORD PTR -196[rbp], edx
+	mov	DWORD PTR -200[rbp], ecx
+	.loc 1 589 5
+	mov	rax, QWORD PTR -184[rbp]
+	mov	edx, 632
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 590 65
+	cmp	DWORD PTR -196[rbp], 0
+	jne	.L134
+	.loc 1 590 67 discriminator 1
+	mov	rax, QWORD PTR -192[rbp]
+	mov	rdi, rax
+	call	sampleIo_FormatFromFileName
+	jmp	.L135
+.L134:
+	.loc 1 590 65 discriminator 2
+	mov	eax, DWORD PTR -196[rbp]
+.L135:
+	.loc 1 590 20 discriminator 4
+	mov	rdx, QWORD PTR -184[rbp]
+	mov	DWORD PTR 8[rdx], eax
+	.loc 1 591 22 discriminator 4
+	mov	rax, QWORD PTR -184[rbp]
+	mov	edx, DWORD PTR -200[rbp]
+	mov	DWORD PTR 12[rax], edx
+	.loc 1 592 24 discriminator 4
+	mov	rax, QWORD PTR -184[rbp]
+	mov	DWORD PTR 16[rax], 48000
+	.loc 1 593 25 discriminator 4
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR 24[rax], -1
+	.loc 1 594 22 discriminator 4
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR 32[rax], -1
+	.loc 1 595 27 discriminator 4
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR 40[rax], -1
+	.loc 1 597 9 discriminator 4
+	mov	rax, QWORD PTR -192[rbp]
+	lea	rdx, .LC21[rip]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 597 8 discriminator 4
+	test	eax, eax
+	jne	.L136
+	.loc 1 599 22
+	mov	rdx, QWORD PTR stdin[rip]
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR [rax], rdx
+	jmp	.L137
+.L136:
+	.loc 1 603 47
+	mov	rax, QWORD PTR -184[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 603 24
+	cmp	eax, 1
+	jne	.L138
+	.loc 1 603 24 is_stmt 0 discriminator 1
+	lea	rax, .LC22[rip]
+	jmp	.L139
+.L138:
+	.loc 1 603 24 discriminator 2
+	lea	rax, .LC23[rip]
+.L139:
+	.loc 1 603 24 discriminator 4
+	mov	rdx, QWORD PTR -192[rbp]
+	mov	rsi, rax
+	mov	rdi, rdx
+	call	fopen@PLT
+	mov	rdx, rax
+	.loc 1 603 22 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR [rax], rdx
+.L137:
+	.loc 1 605 15
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 605 8
+	test	rax, rax
+	jne	.L140
+	.loc 1 607 9
+	mov	rax, QWORD PTR -192[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 608 16
+	mov	eax, 1
+	jmp	.L153
+.L140:
+	.loc 1 612 10
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	edx, eax
+	lea	rax, -176[rbp]
+	mov	rsi, rax
+	mov	edi, edx
+	call	fstat@PLT
+	.loc 1 612 8
+	test	eax, eax
+	jne	.L142
+	.loc 1 612 58 discriminator 1
+	mov	eax, DWORD PTR -152[rbp]
+	and	eax, 61440
+	.loc 1 612 55 discriminator 1
+	cmp	eax, 32768
+	jne	.L142
+	.loc 1 614 36
+	mov	rdx, QWORD PTR -128[rbp]
+	.loc 1 614 26
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR 32[rax], rdx
+.L142:
+	.loc 1 617 9
+	mov	rax, QWORD PTR -184[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_IsWav
+	.loc 1 617 8
+	test	eax, eax
+	je	.L143
+	.loc 1 619 13
+	mov	rdx, QWORD PTR -192[rbp]
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	sampleIo_ReadWavHeader
+	.loc 1 619 12
+	test	eax, eax
+	je	.L144
+	.loc 1 621 13
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader
+	.loc 1 622 20
+	mov	eax, 1
+	jmp	.L153
+.L143:
+	.loc 1 625 21
+	mov	rax, QWORD PTR -184[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 625 13
+	cmp	eax, 1
+	je	.L144
+	.loc 1 625 63 discriminator 1
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 625 53 discriminator 1
+	test	rax, rax
+	js	.L144
+	.loc 1 627 37
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rbx, QWORD PTR 32[rax]
+	.loc 1 627 57
+	mov	rax, QWORD PTR -184[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	.loc 1 627 97
+	mov	edx, DWORD PTR -200[rbp]
+	movsx	rdx, edx
+	imul	rax, rdx
+	.loc 1 627 50
+	mov	rcx, rax
+	.loc 1 627 48
+	mov	rax, rbx
+	cqo
+	idiv	rcx
+	mov	rdx, rax
+	.loc 1 627 29
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR 24[rax], rdx
+.L144:
+	.loc 1 630 15
+	mov	rax, QWORD PTR -184[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 630 8
+	cmp	eax, 1
+	jne	.L145
+	.loc 1 632 13
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rdi, rax
+	call	sampleIo_OpenText
+	.loc 1 632 12
+	test	eax, eax
+	je	.L146
+	.loc 1 634 13
+	lea	rax, .LC24[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 635 13
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader
+	.loc 1 636 20
+	mov	eax, 1
+	jmp	.L153
+.L145:
+	.loc 1 639 31
+	mov	eax, DWORD PTR sampleIoBackend[rip]
+	.loc 1 639 13
+	cmp	eax, 4
+	je	.L147
+	.loc 1 639 70 discriminator 1
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 639 60 discriminator 1
+	test	rax, rax
+	js	.L147
+.LBB22:
+	.loc 1 642 30
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	ftell@PLT
+	.loc 1 642 28
+	mov	rdx, QWORD PTR -184[rbp]
+	mov	QWORD PTR 624[rdx], rax
+	.loc 1 643 27
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 643 94
+	test	rax, rax
+	js	.L148
+	.loc 1 643 57 discriminator 1
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rdx, QWORD PTR 624[rax]
+	.loc 1 643 78 discriminator 1
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 643 94 discriminator 1
+	add	rax, rdx
+	jmp	.L149
+.L148:
+	.loc 1 643 94 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 32[rax]
+.L149:
+	.loc 1 643 14 is_stmt 1 discriminator 4
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 644 25 discriminator 4
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 644 12 discriminator 4
+	cmp	QWORD PTR -24[rbp], rax
+	jle	.L150
+	.loc 1 646 17
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	mov	QWORD PTR -24[rbp], rax
+.L150:
+	.loc 1 648 20
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 624[rax]
+	.loc 1 648 12
+	test	rax, rax
+	js	.L151
+	.loc 1 648 42 discriminator 1
+	mov	rax, QWORD PTR -184[rbp]
+	mov	r12, QWORD PTR 624[rax]
+	mov	ebx, DWORD PTR sampleIoBackend[rip]
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	esi, eax
+	mov	rax, QWORD PTR -184[rbp]
+	add	rax, 96
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	r9, rdx
+	mov	r8, r12
+	mov	ecx, ebx
+	mov	edx, 0
+	mov	rdi, rax
+	call	asyncFile_Open@PLT
+	.loc 1 648 38 discriminator 1
+	test	eax, eax
+	je	.L152
+.L151:
+	.loc 1 651 13
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader
+	.loc 1 652 20
+	mov	eax, 1
+	jmp	.L153
+.L152:
+	.loc 1 654 23
+	mov	rax, QWORD PTR -184[rbp]
+	mov	DWORD PTR 92[rax], 1
+.LBE22:
+	.loc 1 640 5
+	jmp	.L146
+.L147:
+	.loc 1 658 65
+	mov	rax, QWORD PTR -184[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 658 57
+	sal	eax, 12
+	movsx	rbx, eax
+	.loc 1 658 78
+	mov	rax, QWORD PTR -184[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	.loc 1 658 26
+	imul	rax, rbx
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 658 24
+	mov	rax, QWORD PTR -184[rbp]
+	mov	QWORD PTR 48[rax], rdx
+	.loc 1 659 19
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	.loc 1 659 12
+	test	rax, rax
+	jne	.L146
+	.loc 1 661 13
+	lea	rax, .LC24[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 662 13
+	mov	rax, QWORD PTR -184[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseReader
+	.loc 1 663 20
+	mov	eax, 1
+	jmp	.L153
+.L146:
+	.loc 1 666 12
+	mov	eax, 0
+.L153:
+	.loc 1 667 1 discriminator 1
+	add	rsp, 192
+	pop	rbx
+	pop	r12
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	sampleIo_OpenReader, .-sampleIo_OpenReader
+	.globl	sampleIo_Read
+	.type	sampleIo_Read, @function
+sampleIo_Read:
+.LFB29:
+	.loc 1 670 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 112
+	mov	QWORD PTR -88[rbp], rdi
+	mov	QWORD PTR -96[rbp], rsi
+	mov	DWORD PTR -100[rbp], edx
+	.loc 1 671 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 673 15
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 673 8
+	cmp	eax, 1
+	jne	.L155
+	.loc 1 675 71
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 675 16
+	imul	eax, DWORD PTR -100[rbp]
+	mov	edx, eax
+	mov	rcx, QWORD PTR -96[rbp]
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_ReadText
+	.loc 1 675 91
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	edi, DWORD PTR 12[rdx]
+	.loc 1 675 83
+	cdq
+	idiv	edi
+	jmp	.L156
+.L155:
+	.loc 1 677 15
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 92[rax]
+	.loc 1 677 8
+	test	eax, eax
+	je	.L157
+	.loc 1 679 58
+	mov	eax, DWORD PTR -100[rbp]
+	movsx	rdx, eax
+	.loc 1 679 86
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 679 22
+	imul	rdx, rax
+	mov	rcx, QWORD PTR -96[rbp]
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_ReadAsync
+	.loc 1 679 106
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	edx, DWORD PTR 12[rdx]
+	movsx	rsi, edx
+	.loc 1 679 98
+	mov	edx, 0
+	div	rsi
+	.loc 1 679 16
+	jmp	.L156
+.L157:
+	.loc 1 682 31
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	.loc 1 682 79
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	edx, DWORD PTR 12[rdx]
+	movsx	rdx, edx
+	.loc 1 682 18
+	imul	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 684 31
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 684 62
+	cmp	eax, 2
+	je	.L158
+	.loc 1 684 72 discriminator 2
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 684 62 discriminator 2
+	cmp	eax, 5
+	jne	.L159
+.L158:
+	.loc 1 684 62 is_stmt 0 discriminator 3
+	mov	eax, 1
+	jmp	.L160
+.L159:
+	.loc 1 684 62 discriminator 4
+	mov	eax, 0
+.L160:
+	.loc 1 684 15 is_stmt 1 discriminator 6
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 686 11 discriminator 6
+	jmp	.L161
+.L172:
+.LBB23:
+	.loc 1 688 38
+	mov	eax, DWORD PTR -100[rbp]
+	sub	eax, DWORD PTR -4[rbp]
+	.loc 1 688 16
+	cdqe
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 689 12
+	cmp	DWORD PTR -36[rbp], 0
+	jne	.L162
+	.loc 1 689 27 discriminator 1
+	cmp	QWORD PTR -16[rbp], 4096
+	jbe	.L162
+	.loc 1 691 21
+	mov	QWORD PTR -16[rbp], 4096
+.L162:
+	.loc 1 693 20
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 693 12
+	test	rax, rax
+	js	.L163
+	.loc 1 693 54 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	imul	rax, QWORD PTR -32[rbp]
+	.loc 1 693 83 discriminator 1
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rdx, QWORD PTR 40[rdx]
+	.loc 1 693 42 discriminator 1
+	cmp	rdx, rax
+	jnb	.L163
+	.loc 1 695 29
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 695 21
+	mov	edx, 0
+	div	QWORD PTR -32[rbp]
+	mov	QWORD PTR -16[rbp], rax
+.L163:
+	.loc 1 697 12
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L173
+	.loc 1 702 50
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 702 42
+	imul	eax, DWORD PTR -4[rbp]
+	cdqe
+	.loc 1 702 30
+	lea	rdx, 0[0+rax*4]
+	.loc 1 702 16
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 703 22
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rcx, QWORD PTR [rax]
+	cmp	DWORD PTR -36[rbp], 0
+	jne	.L166
+	.loc 1 703 22 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	jmp	.L167
+.L166:
+	.loc 1 703 22 discriminator 2
+	mov	rax, QWORD PTR -48[rbp]
+.L167:
+	.loc 1 703 22 discriminator 4
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	fread@PLT
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 704 42 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -88[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 704 22 discriminator 4
+	mov	rdx, QWORD PTR -56[rbp]
+	imul	rax, rdx
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 706 12 discriminator 4
+	cmp	DWORD PTR -36[rbp], 0
+	jne	.L168
+.LBB24:
+	.loc 1 708 28
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	mov	QWORD PTR -72[rbp], rax
+.LBB25:
+	.loc 1 709 25
+	mov	QWORD PTR -24[rbp], 0
+	.loc 1 709 13
+	jmp	.L169
+.L170:
+	.loc 1 711 29 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, [rax+rax]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	.loc 1 711 33 discriminator 3
+	cwde
+	pxor	xmm1, xmm1
+	cvtsi2ss	xmm1, eax
+	.loc 1 711 20 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 711 33 discriminator 3
+	movss	xmm0, DWORD PTR .LC14[rip]
+	mulss	xmm0, xmm1
+	.loc 1 711 24 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 709 44 discriminator 3
+	add	QWORD PTR -24[rbp], 1
+.L169:
+	.loc 1 709 34 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	cmp	rax, QWORD PTR -64[rbp]
+	jb	.L170
+.L168:
+.LBE25:
+.LBE24:
+	.loc 1 715 19
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 715 12
+	test	rax, rax
+	js	.L171
+	.loc 1 717 19
+	mov	rax, QWORD PTR -88[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	mov	rdx, rax
+	.loc 1 717 42
+	mov	rax, QWORD PTR -56[rbp]
+	imul	rax, QWORD PTR -32[rbp]
+	.loc 1 717 35
+	sub	rdx, rax
+	mov	rax, QWORD PTR -88[rbp]
+	mov	QWORD PTR 40[rax], rdx
+.L171:
+	.loc 1 719 20
+	mov	rax, QWORD PTR -56[rbp]
+	mov	edx, eax
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, edx
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 720 12
+	mov	rax, QWORD PTR -56[rbp]
+	cmp	rax, QWORD PTR -16[rbp]
+	jb	.L174
+.L161:
+.LBE23:
+	.loc 1 686 23
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -100[rbp]
+	jl	.L172
+	jmp	.L165
+.L173:
+.LBB26:
+	.loc 1 699 13
+	nop
+	jmp	.L165
+.L174:
+	.loc 1 722 13
+	nop
+.L165:
+.LBE26:
+	.loc 1 725 12
+	mov	eax, DWORD PTR -4[rbp]
+.L156:
+	.loc 1 726 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	sampleIo_Read, .-sampleIo_Read
+	.globl	sampleIo_GetProgress
+	.type	sampleIo_GetProgress, @function
+sampleIo_GetProgress:
+.LFB30:
+	.loc 1 729 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 730 9
+	mov	DWORD PTR -4[rbp], -1
+	.loc 1 732 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 732 8
+	test	rax, rax
+	jle	.L176
+.LBB27:
+	.loc 1 734 31
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 92[rax]
+	.loc 1 734 60
+	test	eax, eax
+	je	.L177
+	.loc 1 734 60 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 624[rax]
+	jmp	.L178
+.L177:
+	.loc 1 734 74 is_stmt 1 discriminator 2
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 734 62 discriminator 2
+	mov	rdi, rax
+	call	ftell@PLT
+.L178:
+	.loc 1 734 14 discriminator 4
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 735 19 discriminator 4
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 735 12 discriminator 4
+	test	rax, rax
+	je	.L179
+	.loc 1 737 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 64[rax]
+	.loc 1 737 48
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 737 22
+	sub	rdx, rax
+	mov	QWORD PTR -16[rbp], rdx
+	jmp	.L180
+.L179:
+	.loc 1 739 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 739 17
+	cmp	eax, 1
+	jne	.L180
+	.loc 1 741 31
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 72[rax]
+	.loc 1 741 49
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 64[rax]
+	.loc 1 741 41
+	sub	rdx, rax
+	.loc 1 741 22
+	sub	QWORD PTR -16[rbp], rdx
+.L180:
+	.loc 1 743 12
+	cmp	QWORD PTR -16[rbp], 0
+	js	.L176
+	.loc 1 745 29
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, QWORD PTR -16[rbp]
+	.loc 1 745 54
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 745 46
+	pxor	xmm2, xmm2
+	cvtsi2sd	xmm2, rax
+	movapd	xmm1, xmm0
+	divsd	xmm1, xmm2
+	.loc 1 745 66
+	movsd	xmm0, QWORD PTR .LC25[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 745 20
+	cvttsd2si	eax, xmm0
+	mov	DWORD PTR -4[rbp], eax
+.L176:
+.LBE27:
+	.loc 1 748 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 749 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	sampleIo_GetProgress, .-sampleIo_GetProgress
+	.globl	sampleIo_CloseReader
+	.type	sampleIo_CloseReader, @function
+sampleIo_CloseReader:
+.LFB31:
+	.loc 1 752 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 753 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 755 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 755 8
+	test	rax, rax
+	je	.L183
+	.loc 1 757 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 80[rax]
+	.loc 1 757 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 56[rax]
+	.loc 1 757 9
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	munmap@PLT
+	.loc 1 758 28
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 80[rax], 0
+.L183:
+	.loc 1 760 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 92[rax]
+	.loc 1 760 8
+	test	eax, eax
+	je	.L184
+	.loc 1 762 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 96
+	mov	rdi, rax
+	call	asyncFile_Close@PLT
+	.loc 1 763 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 92[rax], 0
+.L184:
+	.loc 1 765 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 48[rax]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 766 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 48[rax], 0
+	.loc 1 767 16
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 767 23
+	mov	rax, QWORD PTR stdin[rip]
+	.loc 1 767 8
+	cmp	rdx, rax
+	je	.L185
+	.loc 1 767 36 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 767 33 discriminator 1
+	test	eax, eax
+	je	.L185
+	.loc 1 769 16
+	mov	DWORD PTR -4[rbp], 1
+.L185:
+	.loc 1 771 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 772 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	sampleIo_CloseReader, .-sampleIo_CloseReader
+	.section	.rodata
+.LC26:
+	.string	"w"
+.LC27:
+	.string	"wb"
+.LC28:
+	.string	"Error allocating write buffer"
+	.text
+	.globl	sampleIo_OpenWriter
+	.type	sampleIo_OpenWriter, @function
+sampleIo_OpenWriter:
+.LFB32:
+	.loc 1 776 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	r12
+	push	rbx
+	sub	rsp, 176
+	.cfi_offset 12, -24
+	.cfi_offset 3, -32
+	mov	QWORD PTR -168[rbp], rdi
+	mov	QWORD PTR -176[rbp], rsi
+	mov	DWORD PTR -180[rbp], edx
+	mov	DWORD PTR -184[rbp], ecx
+	mov	DWORD PTR -188[rbp], r8d
+	.loc 1 779 5
+	mov	rax, QWORD PTR -168[rbp]
+	mov	edx, 576
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 780 65
+	cmp	DWORD PTR -180[rbp], 0
+	jne	.L188
+	.loc 1 780 67 discriminator 1
+	mov	rax, QWORD PTR -176[rbp]
+	mov	rdi, rax
+	call	sampleIo_FormatFromFileName
+	jmp	.L189
+.L188:
+	.loc 1 780 65 discriminator 2
+	mov	eax, DWORD PTR -180[rbp]
+.L189:
+	.loc 1 780 20 discriminator 4
+	mov	rdx, QWORD PTR -168[rbp]
+	mov	DWORD PTR 8[rdx], eax
+	.loc 1 781 22 discriminator 4
+	mov	rax, QWORD PTR -168[rbp]
+	mov	edx, DWORD PTR -184[rbp]
+	mov	DWORD PTR 12[rax], edx
+	.loc 1 782 24 discriminator 4
+	mov	rax, QWORD PTR -168[rbp]
+	mov	edx, DWORD PTR -188[rbp]
+	mov	DWORD PTR 16[rax], edx
+	.loc 1 784 43 discriminator 4
+	mov	rax, QWORD PTR -168[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 784 20 discriminator 4
+	cmp	eax, 1
+	jne	.L190
+	.loc 1 784 20 is_stmt 0 discriminator 1
+	lea	rax, .LC26[rip]
+	jmp	.L191
+.L190:
+	.loc 1 784 20 discriminator 2
+	lea	rax, .LC27[rip]
+.L191:
+	.loc 1 784 20 discriminator 4
+	mov	rdx, QWORD PTR -176[rbp]
+	mov	rsi, rax
+	mov	rdi, rdx
+	call	fopen@PLT
+	mov	rdx, rax
+	.loc 1 784 18 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 785 15 discriminator 4
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 785 8 discriminator 4
+	test	rax, rax
+	jne	.L192
+	.loc 1 787 9
+	mov	rax, QWORD PTR -176[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 788 16
+	mov	eax, 1
+	jmp	.L201
+.L192:
+	.loc 1 792 9
+	mov	rax, QWORD PTR -168[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_IsWav
+	.loc 1 792 8
+	test	eax, eax
+	je	.L194
+	.loc 1 792 45 discriminator 1
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rdi, rax
+	call	sampleIo_WriteWavHeader
+	.loc 1 792 40 discriminator 1
+	test	eax, eax
+	jne	.L195
+	.loc 1 792 98 discriminator 2
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fflush@PLT
+	.loc 1 792 94 discriminator 2
+	test	eax, eax
+	je	.L194
+.L195:
+	.loc 1 794 9
+	mov	rax, QWORD PTR -176[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 795 9
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 796 16
+	mov	eax, 1
+	jmp	.L201
+.L194:
+	.loc 1 800 26
+	mov	eax, DWORD PTR sampleIoBackend[rip]
+	.loc 1 800 8
+	cmp	eax, 4
+	je	.L196
+	.loc 1 800 59 discriminator 1
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	edx, eax
+	lea	rax, -160[rbp]
+	mov	rsi, rax
+	mov	edi, edx
+	call	fstat@PLT
+	.loc 1 800 55 discriminator 1
+	test	eax, eax
+	jne	.L196
+	.loc 1 801 12
+	mov	eax, DWORD PTR -136[rbp]
+	and	eax, 61440
+	.loc 1 801 9
+	cmp	eax, 32768
+	jne	.L196
+	.loc 1 803 13
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	ftell@PLT
+	mov	r12, rax
+	mov	ebx, DWORD PTR sampleIoBackend[rip]
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	esi, eax
+	mov	rax, QWORD PTR -168[rbp]
+	add	rax, 72
+	mov	r9d, 0
+	mov	r8, r12
+	mov	ecx, ebx
+	mov	edx, 1
+	mov	rdi, rax
+	call	asyncFile_Open@PLT
+	.loc 1 803 12
+	test	eax, eax
+	je	.L197
+	.loc 1 806 13
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 807 20
+	mov	eax, 1
+	jmp	.L201
+.L197:
+	.loc 1 809 23
+	mov	rax, QWORD PTR -168[rbp]
+	mov	DWORD PTR 64[rax], 1
+	.loc 1 810 28
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR 48[rax], 262144
+	.loc 1 811 16
+	mov	eax, 0
+	jmp	.L201
+.L196:
+	.loc 1 814 15
+	mov	rax, QWORD PTR -168[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 814 8
+	cmp	eax, 1
+	jne	.L198
+	.loc 1 816 26
+	mov	edi, 65536
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 816 24
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR 40[rax], rdx
+	.loc 1 817 28
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR 48[rax], 65536
+	jmp	.L199
+.L198:
+	.loc 1 821 57
+	mov	eax, DWORD PTR -184[rbp]
+	sal	eax, 12
+	movsx	rbx, eax
+	.loc 1 821 70
+	mov	rax, QWORD PTR -168[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	.loc 1 821 26
+	imul	rax, rbx
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	rdx, rax
+	.loc 1 821 24
+	mov	rax, QWORD PTR -168[rbp]
+	mov	QWORD PTR 40[rax], rdx
+.L199:
+	.loc 1 823 15
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 823 8
+	test	rax, rax
+	jne	.L200
+	.loc 1 825 9
+	lea	rax, .LC28[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 826 9
+	mov	rax, QWORD PTR -168[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 827 16
+	mov	eax, 1
+	jmp	.L201
+.L200:
+	.loc 1 829 12
+	mov	eax, 0
+.L201:
+	.loc 1 830 1 discriminator 1
+	add	rsp, 176
+	pop	rbx
+	pop	r12
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE32:
+	.size	sampleIo_OpenWriter, .-sampleIo_OpenWriter
+	.globl	sampleIo_Write
+	.type	sampleIo_Write, @function
+sampleIo_Write:
+.LFB33:
+	.loc 1 833 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 88
+	.cfi_offset 3, -24
+	mov	QWORD PTR -72[rbp], rdi
+	mov	QWORD PTR -80[rbp], rsi
+	mov	DWORD PTR -84[rbp], edx
+	.loc 1 834 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 834 8
+	cmp	eax, 1
+	jne	.L203
+	.loc 1 836 16
+	mov	edx, DWORD PTR -84[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_WriteText
+	jmp	.L204
+.L203:
+	.loc 1 838 15
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 838 8
+	test	eax, eax
+	je	.L205
+	.loc 1 840 16
+	mov	edx, DWORD PTR -84[rbp]
+	mov	rcx, QWORD PTR -80[rbp]
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_WriteAsync
+	jmp	.L204
+.L205:
+	.loc 1 843 35
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 844 9
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 846 11
+	jmp	.L206
+.L214:
+.LBB28:
+	.loc 1 848 13
+	mov	eax, DWORD PTR -84[rbp]
+	sub	eax, DWORD PTR -20[rbp]
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 849 12
+	cmp	DWORD PTR -24[rbp], 4096
+	jle	.L207
+	.loc 1 851 20
+	mov	DWORD PTR -24[rbp], 4096
+.L207:
+	.loc 1 853 59
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 853 51
+	imul	eax, DWORD PTR -20[rbp]
+	cdqe
+	.loc 1 853 36
+	lea	rdx, 0[0+rax*4]
+	.loc 1 853 22
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 854 30
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	.loc 1 854 53
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 854 22
+	imul	rax, rdx
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 856 20
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 856 12
+	cmp	eax, 2
+	je	.L208
+	.loc 1 856 61 discriminator 1
+	mov	rax, QWORD PTR -72[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 856 51 discriminator 1
+	cmp	eax, 5
+	jne	.L209
+.L208:
+	.loc 1 859 17
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rcx, QWORD PTR [rax]
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	esi, 4
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 859 16
+	cmp	QWORD PTR -56[rbp], rax
+	je	.L211
+	.loc 1 861 24
+	mov	eax, 1
+	jmp	.L204
+.L209:
+.LBB29:
+	.loc 1 866 22
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	mov	QWORD PTR -64[rbp], rax
+.LBB30:
+	.loc 1 867 25
+	mov	QWORD PTR -32[rbp], 0
+	.loc 1 867 13
+	jmp	.L212
+.L213:
+	.loc 1 869 49 discriminator 3
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 869 26 discriminator 3
+	mov	eax, DWORD PTR [rax]
+	.loc 1 869 20 discriminator 3
+	mov	rdx, QWORD PTR -32[rbp]
+	lea	rcx, [rdx+rdx]
+	mov	rdx, QWORD PTR -64[rbp]
+	lea	rbx, [rcx+rdx]
+	.loc 1 869 26 discriminator 3
+	movd	xmm0, eax
+	call	sampleIo_FloatToS16
+	.loc 1 869 24 discriminator 3
+	mov	WORD PTR [rbx], ax
+	.loc 1 867 44 discriminator 3
+	add	QWORD PTR -32[rbp], 1
+.L212:
+	.loc 1 867 34 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	cmp	rax, QWORD PTR -56[rbp]
+	jb	.L213
+.LBE30:
+	.loc 1 871 17
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rcx, QWORD PTR [rax]
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -64[rbp]
+	mov	rdi, rax
+	call	fwrite@PLT
+	.loc 1 871 16
+	cmp	QWORD PTR -56[rbp], rax
+	je	.L211
+	.loc 1 873 24
+	mov	eax, 1
+	jmp	.L204
+.L211:
+.LBE29:
+	.loc 1 876 23
+	mov	eax, DWORD PTR -24[rbp]
+	add	DWORD PTR -20[rbp], eax
+.L206:
+.LBE28:
+	.loc 1 846 26
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -84[rbp]
+	jl	.L214
+	.loc 1 878 11
+	mov	rax, QWORD PTR -72[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 878 25
+	mov	eax, DWORD PTR -84[rbp]
+	cdqe
+	add	rdx, rax
+	mov	rax, QWORD PTR -72[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 880 12
+	mov	eax, 0
+.L204:
+	.loc 1 881 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE33:
+	.size	sampleIo_Write, .-sampleIo_Write
+	.globl	sampleIo_ReserveFrames
+	.type	sampleIo_ReserveFrames, @function
+sampleIo_ReserveFrames:
+.LFB34:
+	.loc 1 884 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 40
+	.cfi_offset 3, -24
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	.loc 1 885 45
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 885 31
+	movsx	rbx, eax
+	.loc 1 885 58
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	.loc 1 885 18
+	imul	rax, rbx
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 887 8
+	cmp	QWORD PTR -24[rbp], 0
+	jne	.L216
+	.loc 1 889 16
+	mov	eax, 1
+	jmp	.L217
+.L216:
+	.loc 1 891 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 891 8
+	test	eax, eax
+	je	.L218
+	.loc 1 894 14
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	sampleIo_FlushBuffer
+	.loc 1 894 12
+	test	eax, eax
+	jne	.L219
+	.loc 1 894 64 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 72
+	mov	rdi, rax
+	call	asyncFile_Flush@PLT
+	.loc 1 894 60 discriminator 1
+	test	eax, eax
+	je	.L220
+.L219:
+	.loc 1 896 20
+	mov	eax, 1
+	jmp	.L217
+.L220:
+	.loc 1 898 46
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 272[rax]
+	.loc 1 898 28
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 32[rax], rdx
+	.loc 1 899 51
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 899 80
+	mov	rax, QWORD PTR -24[rbp]
+	.loc 1 899 78
+	imul	rax, QWORD PTR -48[rbp]
+	.loc 1 899 13
+	lea	rbx, [rdx+rax]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	rsi, rbx
+	mov	edi, eax
+	call	ftruncate@PLT
+	.loc 1 899 12
+	test	eax, eax
+	je	.L221
+	.loc 1 901 20
+	mov	eax, 1
+	jmp	.L217
+.L221:
+	.loc 1 903 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 272[rax]
+	.loc 1 903 52
+	mov	rax, QWORD PTR -24[rbp]
+	.loc 1 903 30
+	imul	rax, QWORD PTR -48[rbp]
+	.loc 1 903 27
+	add	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 272[rax], rdx
+	jmp	.L222
+.L218:
+	.loc 1 907 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fflush@PLT
+	.loc 1 907 12
+	test	eax, eax
+	je	.L223
+	.loc 1 909 20
+	mov	eax, 1
+	jmp	.L217
+.L223:
+	.loc 1 911 30
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	ftell@PLT
+	.loc 1 911 28
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR 32[rdx], rax
+	.loc 1 912 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 912 12
+	test	rax, rax
+	js	.L224
+	.loc 1 913 55
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 913 84
+	mov	rax, QWORD PTR -24[rbp]
+	.loc 1 913 82
+	imul	rax, QWORD PTR -48[rbp]
+	.loc 1 913 17
+	lea	rbx, [rdx+rax]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	rsi, rbx
+	mov	edi, eax
+	call	ftruncate@PLT
+	.loc 1 913 13
+	test	eax, eax
+	jne	.L224
+	.loc 1 914 17
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 2
+	mov	esi, 0
+	mov	rdi, rax
+	call	fseek@PLT
+	.loc 1 914 13
+	test	eax, eax
+	je	.L222
+.L224:
+	.loc 1 916 20
+	mov	eax, 1
+	jmp	.L217
+.L222:
+	.loc 1 919 11
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 24[rax]
+	.loc 1 919 25
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 24[rax], rdx
+	.loc 1 921 12
+	mov	eax, 0
+.L217:
+	.loc 1 922 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE34:
+	.size	sampleIo_ReserveFrames, .-sampleIo_ReserveFrames
+	.globl	sampleIo_WriteFramesAt
+	.type	sampleIo_WriteFramesAt, @function
+sampleIo_WriteFramesAt:
+.LFB35:
+	.loc 1 925 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 8304
+	mov	QWORD PTR -8280[rbp], rdi
+	mov	QWORD PTR -8288[rbp], rsi
+	mov	DWORD PTR -8292[rbp], edx
+	mov	QWORD PTR -8304[rbp], rcx
+	.loc 1 926 65
+	mov	rax, QWORD PTR -8280[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 926 35
+	mov	edi, eax
+	call	sampleIo_BytesPerSample
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 927 33
+	mov	rax, QWORD PTR -8280[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 927 20
+	mov	rdi, rax
+	call	fileno@PLT
+	mov	DWORD PTR -52[rbp], eax
+	.loc 1 929 12
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 930 26
+	mov	eax, DWORD PTR -8292[rbp]
+	movsx	rdx, eax
+	.loc 1 930 54
+	mov	rax, QWORD PTR -8280[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 930 18
+	imul	rax, rdx
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 931 26
+	mov	rax, QWORD PTR -8280[rbp]
+	mov	rdx, QWORD PTR 32[rax]
+	.loc 1 931 67
+	mov	rax, QWORD PTR -8280[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 931 78
+	imul	rax, QWORD PTR -48[rbp]
+	.loc 1 931 52
+	imul	rax, QWORD PTR -8304[rbp]
+	.loc 1 931 11
+	add	rax, rdx
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 934 11
+	jmp	.L226
+.L234:
+.LBB31:
+	.loc 1 936 16
+	mov	rax, QWORD PTR -64[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 937 37
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 937 21
+	mov	rax, QWORD PTR -8288[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 939 12
+	cmp	QWORD PTR -48[rbp], 2
+	jne	.L227
+	.loc 1 941 16
+	cmp	QWORD PTR -24[rbp], 4096
+	jbe	.L228
+	.loc 1 943 23
+	mov	QWORD PTR -24[rbp], 4096
+.L228:
+.LBB32:
+	.loc 1 945 25
+	mov	QWORD PTR -40[rbp], 0
+	.loc 1 945 13
+	jmp	.L229
+.L230:
+	.loc 1 947 65 discriminator 3
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	.loc 1 947 59 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -8288[rbp]
+	add	rax, rdx
+	.loc 1 947 32 discriminator 3
+	mov	eax, DWORD PTR [rax]
+	movd	xmm0, eax
+	call	sampleIo_FloatToS16
+	.loc 1 947 30 discriminator 3
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	WORD PTR -8272[rbp+rdx*2], ax
+	.loc 1 945 44 discriminator 3
+	add	QWORD PTR -40[rbp], 1
+.L229:
+	.loc 1 945 34 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	cmp	rax, QWORD PTR -24[rbp]
+	jb	.L230
+.LBE32:
+	.loc 1 949 19
+	lea	rax, -8272[rbp]
+	mov	QWORD PTR -32[rbp], rax
+.L227:
+	.loc 1 952 27
+	mov	rax, QWORD PTR -24[rbp]
+	imul	rax, QWORD PTR -48[rbp]
+	mov	rdx, rax
+	mov	rcx, QWORD PTR -16[rbp]
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -52[rbp]
+	mov	edi, eax
+	call	pwrite@PLT
+	mov	QWORD PTR -72[rbp], rax
+	.loc 1 953 12
+	cmp	QWORD PTR -72[rbp], 0
+	jg	.L231
+	.loc 1 955 20
+	mov	eax, 1
+	jmp	.L235
+.L231:
+	.loc 1 958 17
+	mov	rax, QWORD PTR -72[rbp]
+	.loc 1 958 15
+	mov	edx, 0
+	div	QWORD PTR -48[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 959 12
+	cmp	QWORD PTR -24[rbp], 0
+	jne	.L233
+	.loc 1 961 20
+	mov	eax, 1
+	jmp	.L235
+.L233:
+	.loc 1 963 14
+	mov	rax, QWORD PTR -24[rbp]
+	add	QWORD PTR -8[rbp], rax
+	.loc 1 964 33
+	mov	rax, QWORD PTR -24[rbp]
+	imul	rax, QWORD PTR -48[rbp]
+	.loc 1 964 16
+	add	QWORD PTR -16[rbp], rax
+.L226:
+.LBE31:
+	.loc 1 934 17
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -64[rbp]
+	jb	.L234
+	.loc 1 966 12
+	mov	eax, 0
+.L235:
+	.loc 1 967 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE35:
+	.size	sampleIo_WriteFramesAt, .-sampleIo_WriteFramesAt
+	.globl	sampleIo_CloseWriter
+	.type	sampleIo_CloseWriter, @function
+sampleIo_CloseWriter:
+.LFB36:
+	.loc 1 970 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 971 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 973 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 973 8
+	cmp	eax, 1
+	je	.L237
+	.loc 1 973 58 discriminator 2
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 973 49 discriminator 2
+	test	eax, eax
+	je	.L238
+.L237:
+	.loc 1 973 71 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	sampleIo_FlushBuffer
+	.loc 1 973 67 discriminator 3
+	test	eax, eax
+	je	.L238
+	.loc 1 975 16
+	mov	DWORD PTR -4[rbp], 1
+.L238:
+	.loc 1 977 15
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 977 8
+	test	eax, eax
+	je	.L239
+	.loc 1 979 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 72
+	mov	rdi, rax
+	call	asyncFile_Close@PLT
+	.loc 1 979 12
+	test	eax, eax
+	je	.L240
+	.loc 1 981 20
+	mov	DWORD PTR -4[rbp], 1
+.L240:
+	.loc 1 983 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 64[rax], 0
+	.loc 1 984 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 40[rax], 0
+.L239:
+	.loc 1 986 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	edi, eax
+	call	sampleIo_IsWav
+	.loc 1 986 8
+	test	eax, eax
+	je	.L241
+	.loc 1 988 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	edx, 0
+	mov	esi, 0
+	mov	rdi, rax
+	call	fseek@PLT
+	.loc 1 988 12
+	test	eax, eax
+	jne	.L242
+	.loc 1 988 58 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	sampleIo_WriteWavHeader
+	.loc 1 988 54 discriminator 1
+	test	eax, eax
+	je	.L241
+.L242:
+	.loc 1 990 20
+	mov	DWORD PTR -4[rbp], 1
+.L241:
+	.loc 1 993 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 994 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 40[rax], 0
+	.loc 1 995 9
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	fclose@PLT
+	.loc 1 995 8
+	test	eax, eax
+	je	.L243
+	.loc 1 997 16
+	mov	DWORD PTR -4[rbp], 1
+.L243:
+	.loc 1 999 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 1000 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE36:
+	.size	sampleIo_CloseWriter, .-sampleIo_CloseWriter
+	.section	.rodata
+	.align 4
+.LC5:
+	.long	1191181824
+	.align 4
+.LC6:
+	.long	-956301312
+	.align 4
+.LC14:
+	.long	939524096
+	.align 8
+.LC25:
+	.long	0
+	.long	1079574528
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 15 "include/asyncFile.h"
+	.file 16 "include/sampleIo.h"
+	.file 17 "/usr/include/unistd.h"
+	.file 18 "/usr/include/stdio.h"
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 21 "/usr/include/stdlib.h"
+	.file 22 "/usr/include/string.h"
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 24 "include/fastFloat.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x1e78
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF308
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x5
+	.long	.LASF9
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0x10
+	.long	0x2e
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x10
+	.long	0x46
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x10
+	.long	0x60
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x5
+	.long	.LASF10
+	.byte	0x3
+	.byte	0x27
+	.byte	0x1a
+	.long	0x8d
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF11
+	.uleb128 0x5
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1c
+	.long	0x6c
+	.uleb128 0x5
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x2a
+	.byte	0x16
+	.long	0x73
+	.uleb128 0x5
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x91
+	.byte	0x19
+	.long	0x3f
+	.uleb128 0x5
+	.long	.LASF15
+	.byte	0x3
+	.byte	0x92
+	.byte	0x19
+	.long	0x73
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x3
+	.byte	0x93
+	.byte	0x19
+	.long	0x73
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x3
+	.byte	0x94
+	.byte	0x19
+	.long	0x3f
+	.uleb128 0x5
+	.long	.LASF18
+	.byte	0x3
+	.byte	0x96
+	.byte	0x1a
+	.long	0x73
+	.uleb128 0x5
+	.long	.LASF19
+	.byte	0x3
+	.byte	0x97
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x52
+	.uleb128 0x5
+	.long	.LASF21
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x52
+	.uleb128 0x5
+	.long	.LASF22
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x52
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0x18
+	.long	0x118
+	.uleb128 0x5
+	.long	.LASF23
+	.byte	0x3
+	.byte	0xaf
+	.byte	0x1d
+	.long	0x52
+	.uleb128 0x5
+	.long	.LASF24
+	.byte	0x3
+	.byte	0xb4
+	.byte	0x1c
+	.long	0x52
+	.uleb128 0x5
+	.long	.LASF25
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x52
+	.uleb128 0x5
+	.long	.LASF26
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x21
+	.long	0x52
+	.uleb128 0x6
+	.long	0x154
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF27
+	.uleb128 0x10
+	.long	0x154
+	.uleb128 0x5
+	.long	.LASF28
+	.byte	0x4
+	.byte	0x55
+	.byte	0x11
+	.long	0xf4
+	.uleb128 0x5
+	.long	.LASF29
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0x137
+	.uleb128 0x5
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x19
+	.byte	0x13
+	.long	0x81
+	.uleb128 0x10
+	.long	0x178
+	.uleb128 0x16
+	.long	.LASF39
+	.byte	0x10
+	.byte	0x6
+	.byte	0xb
+	.byte	0x8
+	.long	0x1b1
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x6
+	.byte	0x10
+	.byte	0xc
+	.long	0x10c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x6
+	.byte	0x15
+	.byte	0x15
+	.long	0x143
+	.byte	0x8
+	.byte	0
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x3
+	.long	0x1d5
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x12
+	.long	0x73
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x12
+	.long	0x73
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x7
+	.byte	0x19
+	.long	0x1f6
+	.uleb128 0x14
+	.long	.LASF35
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x28
+	.long	0x1f6
+	.uleb128 0x14
+	.long	.LASF36
+	.byte	0x7
+	.byte	0x20
+	.byte	0x5
+	.long	0x1b1
+	.byte	0
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF37
+	.uleb128 0x5
+	.long	.LASF38
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x1d5
+	.uleb128 0x16
+	.long	.LASF40
+	.byte	0x10
+	.byte	0x8
+	.byte	0x33
+	.byte	0x10
+	.long	0x231
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x35
+	.byte	0x23
+	.long	0x231
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x8
+	.byte	0x36
+	.byte	0x23
+	.long	0x231
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0x209
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0x8
+	.byte	0x37
+	.byte	0x3
+	.long	0x209
+	.uleb128 0x16
+	.long	.LASF44
+	.byte	0x28
+	.byte	0x9
+	.byte	0x16
+	.byte	0x8
+	.long	0x2b8
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x9
+	.byte	0x18
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x9
+	.byte	0x19
+	.byte	0x10
+	.long	0x73
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x7
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x10
+	.long	0x73
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x9
+	.byte	0x20
+	.byte	0x7
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x22
+	.byte	0x9
+	.long	0x8d
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x23
+	.byte	0x9
+	.long	0x8d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x24
+	.byte	0x14
+	.long	0x236
+	.byte	0x18
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF53
+	.byte	0x30
+	.byte	0x8
+	.byte	0x5e
+	.byte	0x8
+	.long	0x321
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x60
+	.byte	0x19
+	.long	0x1fd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x8
+	.byte	0x61
+	.byte	0x19
+	.long	0x1fd
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x62
+	.byte	0x10
+	.long	0x321
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x8
+	.byte	0x63
+	.byte	0x10
+	.long	0x321
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0x8
+	.byte	0x64
+	.byte	0x10
+	.long	0x73
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0x8
+	.byte	0x65
+	.byte	0x10
+	.long	0x73
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0x8
+	.byte	0x66
+	.byte	0x10
+	.long	0x321
+	.byte	0x28
+	.byte	0
+	.uleb128 0xc
+	.long	0x73
+	.long	0x331
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF61
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x1d
+	.byte	0x28
+	.byte	0xa
+	.byte	0x43
+	.long	0x36a
+	.uleb128 0x14
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x45
+	.byte	0x1c
+	.long	0x242
+	.uleb128 0x14
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x46
+	.byte	0x8
+	.long	0x36a
+	.uleb128 0x14
+	.long	.LASF64
+	.byte	0xa
+	.byte	0x47
+	.byte	0xc
+	.long	0x52
+	.byte	0
+	.uleb128 0xc
+	.long	0x154
+	.long	0x37a
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x27
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF65
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0x33d
+	.uleb128 0x1d
+	.byte	0x30
+	.byte	0xa
+	.byte	0x4b
+	.long	0x3b3
+	.uleb128 0x14
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x2b8
+	.uleb128 0x14
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x4e
+	.byte	0x8
+	.long	0x3b3
+	.uleb128 0x14
+	.long	.LASF64
+	.byte	0xa
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x59
+	.byte	0
+	.uleb128 0xc
+	.long	0x154
+	.long	0x3c3
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF66
+	.byte	0xa
+	.byte	0x50
+	.byte	0x3
+	.long	0x386
+	.uleb128 0x6
+	.long	0x3d9
+	.uleb128 0x18
+	.long	0x3cf
+	.uleb128 0x27
+	.uleb128 0x16
+	.long	.LASF67
+	.byte	0xd8
+	.byte	0xb
+	.byte	0x31
+	.byte	0x8
+	.long	0x561
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0xb
+	.byte	0x33
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0xb
+	.byte	0x36
+	.byte	0x9
+	.long	0x14f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0xb
+	.byte	0x37
+	.byte	0x9
+	.long	0x14f
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0xb
+	.byte	0x38
+	.byte	0x9
+	.long	0x14f
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0xb
+	.byte	0x39
+	.byte	0x9
+	.long	0x14f
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x9
+	.long	0x14f
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0xb
+	.byte	0x3b
+	.byte	0x9
+	.long	0x14f
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x9
+	.long	0x14f
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0xb
+	.byte	0x3d
+	.byte	0x9
+	.long	0x14f
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0xb
+	.byte	0x40
+	.byte	0x9
+	.long	0x14f
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0xb
+	.byte	0x41
+	.byte	0x9
+	.long	0x14f
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0xb
+	.byte	0x42
+	.byte	0x9
+	.long	0x14f
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xb
+	.byte	0x44
+	.byte	0x16
+	.long	0x57a
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xb
+	.byte	0x46
+	.byte	0x14
+	.long	0x57f
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xb
+	.byte	0x48
+	.byte	0x7
+	.long	0x46
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xb
+	.byte	0x49
+	.byte	0x7
+	.long	0x46
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xb
+	.byte	0x4a
+	.byte	0xb
+	.long	0xf4
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x12
+	.long	0x6c
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0xb
+	.byte	0x4e
+	.byte	0xf
+	.long	0x7a
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0xb
+	.byte	0x4f
+	.byte	0x8
+	.long	0x584
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0xb
+	.byte	0x51
+	.byte	0xf
+	.long	0x594
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0xb
+	.byte	0x59
+	.byte	0xd
+	.long	0x100
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0xb
+	.byte	0x5b
+	.byte	0x17
+	.long	0x59e
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0xb
+	.byte	0x5c
+	.byte	0x19
+	.long	0x5a8
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0xb
+	.byte	0x5d
+	.byte	0x14
+	.long	0x57f
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0xb
+	.byte	0x5e
+	.byte	0x9
+	.long	0x118
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xb
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0xb
+	.byte	0x60
+	.byte	0x7
+	.long	0x46
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0xb
+	.byte	0x62
+	.byte	0x8
+	.long	0x5ad
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF97
+	.byte	0xc
+	.byte	0x7
+	.byte	0x19
+	.long	0x3da
+	.uleb128 0x28
+	.long	.LASF309
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x1e
+	.long	.LASF98
+	.uleb128 0x6
+	.long	0x575
+	.uleb128 0x6
+	.long	0x3da
+	.uleb128 0xc
+	.long	0x154
+	.long	0x594
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x56d
+	.uleb128 0x1e
+	.long	.LASF99
+	.uleb128 0x6
+	.long	0x599
+	.uleb128 0x1e
+	.long	.LASF100
+	.uleb128 0x6
+	.long	0x5a3
+	.uleb128 0xc
+	.long	0x154
+	.long	0x5bd
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x13
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF310
+	.byte	0x12
+	.byte	0x8f
+	.byte	0xe
+	.long	0x5c9
+	.uleb128 0x6
+	.long	0x561
+	.uleb128 0x18
+	.long	0x5c9
+	.uleb128 0x6
+	.long	0x15b
+	.uleb128 0x18
+	.long	0x5d3
+	.uleb128 0x5
+	.long	.LASF101
+	.byte	0xd
+	.byte	0x19
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x10
+	.long	0x5dd
+	.uleb128 0x5
+	.long	.LASF102
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa0
+	.uleb128 0x10
+	.long	0x5ee
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF103
+	.uleb128 0x10
+	.long	0x5ff
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF104
+	.uleb128 0x16
+	.long	.LASF105
+	.byte	0x90
+	.byte	0xe
+	.byte	0x1a
+	.byte	0x8
+	.long	0x6e3
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xd
+	.long	0xac
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0xe
+	.byte	0x24
+	.byte	0xd
+	.long	0xd0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0xe
+	.byte	0x2c
+	.byte	0xf
+	.long	0xe8
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0xe
+	.byte	0x2d
+	.byte	0xe
+	.long	0xdc
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0xe
+	.byte	0x2f
+	.byte	0xd
+	.long	0xb8
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0xe
+	.byte	0x30
+	.byte	0xd
+	.long	0xc4
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0xe
+	.byte	0x32
+	.byte	0x9
+	.long	0x46
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0xe
+	.byte	0x34
+	.byte	0xd
+	.long	0xac
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0xe
+	.byte	0x39
+	.byte	0xd
+	.long	0xf4
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0xe
+	.byte	0x3d
+	.byte	0x11
+	.long	0x11f
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0xe
+	.byte	0x3f
+	.byte	0x10
+	.long	0x12b
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0xe
+	.byte	0x4a
+	.byte	0x15
+	.long	0x189
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0xe
+	.byte	0x4b
+	.byte	0x15
+	.long	0x189
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0xe
+	.byte	0x4c
+	.byte	0x15
+	.long	0x189
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0xe
+	.byte	0x59
+	.byte	0x17
+	.long	0x6e3
+	.byte	0x78
+	.byte	0
+	.uleb128 0xc
+	.long	0x143
+	.long	0x6f3
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF121
+	.uleb128 0x1a
+	.long	0x73
+	.byte	0xf
+	.byte	0x15
+	.long	0x724
+	.uleb128 0xa
+	.long	.LASF122
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF123
+	.byte	0x1
+	.uleb128 0xa
+	.long	.LASF124
+	.byte	0x2
+	.uleb128 0xa
+	.long	.LASF125
+	.byte	0x3
+	.uleb128 0xa
+	.long	.LASF126
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF127
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x3
+	.long	0x6fa
+	.uleb128 0x1a
+	.long	0x73
+	.byte	0xf
+	.byte	0x1e
+	.long	0x748
+	.uleb128 0xa
+	.long	.LASF128
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF129
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF130
+	.byte	0xf
+	.byte	0x21
+	.byte	0x3
+	.long	0x730
+	.uleb128 0x1a
+	.long	0x73
+	.byte	0xf
+	.byte	0x24
+	.long	0x772
+	.uleb128 0xa
+	.long	.LASF131
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF132
+	.byte	0x1
+	.uleb128 0xa
+	.long	.LASF133
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF134
+	.byte	0xf
+	.byte	0x28
+	.byte	0x3
+	.long	0x754
+	.uleb128 0x19
+	.byte	0x28
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x9
+	.long	0x7c9
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0xf
+	.byte	0x2c
+	.byte	0x14
+	.long	0x7c9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xb
+	.long	0x160
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0xf
+	.byte	0x2e
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0xf
+	.byte	0x2f
+	.byte	0xd
+	.long	0x16c
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0xf
+	.byte	0x30
+	.byte	0x1c
+	.long	0x772
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0x60
+	.uleb128 0x5
+	.long	.LASF140
+	.byte	0xf
+	.byte	0x31
+	.byte	0x3
+	.long	0x77e
+	.uleb128 0x19
+	.byte	0x78
+	.byte	0xf
+	.byte	0x34
+	.byte	0x9
+	.long	0x8a6
+	.uleb128 0x17
+	.string	"fd"
+	.byte	0xf
+	.byte	0x36
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0xf
+	.byte	0x37
+	.byte	0xb
+	.long	0x118
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0xf
+	.byte	0x38
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0xf
+	.byte	0x39
+	.byte	0xb
+	.long	0x118
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0xf
+	.byte	0x3a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0xf
+	.byte	0x3b
+	.byte	0xb
+	.long	0x118
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0xf
+	.byte	0x3c
+	.byte	0xc
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0xf
+	.byte	0x3d
+	.byte	0x13
+	.long	0x8a6
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0xf
+	.byte	0x3e
+	.byte	0x13
+	.long	0x8a6
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0xf
+	.byte	0x3f
+	.byte	0x13
+	.long	0x8a6
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0xf
+	.byte	0x40
+	.byte	0x13
+	.long	0x8a6
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0xf
+	.byte	0x41
+	.byte	0x13
+	.long	0x8a6
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0xf
+	.byte	0x42
+	.byte	0x13
+	.long	0x8a6
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0xf
+	.byte	0x43
+	.byte	0xb
+	.long	0x118
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0xf
+	.byte	0x44
+	.byte	0x9
+	.long	0x46
+	.byte	0x70
+	.byte	0
+	.uleb128 0x6
+	.long	0x73
+	.uleb128 0x5
+	.long	.LASF155
+	.byte	0xf
+	.byte	0x45
+	.byte	0x3
+	.long	0x7da
+	.uleb128 0x1f
+	.value	0x1f8
+	.byte	0xf
+	.byte	0x49
+	.long	0x9a3
+	.uleb128 0x17
+	.string	"fd"
+	.byte	0xf
+	.byte	0x4b
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0xf
+	.byte	0x4c
+	.byte	0x15
+	.long	0x748
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0xf
+	.byte	0x4d
+	.byte	0x18
+	.long	0x724
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0xf
+	.byte	0x4e
+	.byte	0x14
+	.long	0x7c9
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0xf
+	.byte	0x4f
+	.byte	0x17
+	.long	0x9a3
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0xf
+	.byte	0x50
+	.byte	0x13
+	.long	0x3f
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0xf
+	.byte	0x51
+	.byte	0x13
+	.long	0x3f
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0xf
+	.byte	0x52
+	.byte	0xb
+	.long	0x160
+	.byte	0xc8
+	.uleb128 0x17
+	.string	"end"
+	.byte	0xf
+	.byte	0x53
+	.byte	0xb
+	.long	0x160
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0xf
+	.byte	0x54
+	.byte	0x9
+	.long	0x46
+	.byte	0xd8
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0xf
+	.byte	0x55
+	.byte	0x15
+	.long	0x8ab
+	.byte	0xe0
+	.uleb128 0x13
+	.long	.LASF164
+	.byte	0xf
+	.byte	0x56
+	.byte	0xf
+	.long	0x331
+	.value	0x158
+	.uleb128 0x13
+	.long	.LASF165
+	.byte	0xf
+	.byte	0x57
+	.byte	0x15
+	.long	0x37a
+	.value	0x160
+	.uleb128 0x13
+	.long	.LASF166
+	.byte	0xf
+	.byte	0x58
+	.byte	0x14
+	.long	0x3c3
+	.value	0x188
+	.uleb128 0x13
+	.long	.LASF167
+	.byte	0xf
+	.byte	0x59
+	.byte	0x14
+	.long	0x3c3
+	.value	0x1b8
+	.uleb128 0x13
+	.long	.LASF168
+	.byte	0xf
+	.byte	0x5a
+	.byte	0x13
+	.long	0x3f
+	.value	0x1e8
+	.uleb128 0x13
+	.long	.LASF169
+	.byte	0xf
+	.byte	0x5b
+	.byte	0x9
+	.long	0x46
+	.value	0x1f0
+	.byte	0
+	.uleb128 0xc
+	.long	0x7ce
+	.long	0x9b3
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF170
+	.byte	0xf
+	.byte	0x5c
+	.byte	0x3
+	.long	0x8b7
+	.uleb128 0x1a
+	.long	0x73
+	.byte	0x10
+	.byte	0x14
+	.long	0x9ef
+	.uleb128 0xa
+	.long	.LASF171
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF172
+	.byte	0x1
+	.uleb128 0xa
+	.long	.LASF173
+	.byte	0x2
+	.uleb128 0xa
+	.long	.LASF174
+	.byte	0x3
+	.uleb128 0xa
+	.long	.LASF175
+	.byte	0x4
+	.uleb128 0xa
+	.long	.LASF176
+	.byte	0x5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF177
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x3
+	.long	0x9bf
+	.uleb128 0x1f
+	.value	0x278
+	.byte	0x10
+	.byte	0x1d
+	.long	0xaff
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x10
+	.byte	0x1f
+	.byte	0xb
+	.long	0x5c9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x10
+	.byte	0x20
+	.byte	0x14
+	.long	0x9ef
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x10
+	.byte	0x21
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x10
+	.byte	0x22
+	.byte	0x12
+	.long	0x73
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x10
+	.byte	0x23
+	.byte	0xa
+	.long	0x52
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x10
+	.byte	0x24
+	.byte	0xa
+	.long	0x52
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x10
+	.byte	0x25
+	.byte	0xa
+	.long	0x52
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x10
+	.byte	0x26
+	.byte	0xb
+	.long	0x118
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x10
+	.byte	0x27
+	.byte	0x11
+	.long	0x5d3
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x10
+	.byte	0x28
+	.byte	0x11
+	.long	0x5d3
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x10
+	.byte	0x29
+	.byte	0x11
+	.long	0x5d3
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x10
+	.byte	0x2a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x10
+	.byte	0x2c
+	.byte	0x9
+	.long	0x46
+	.byte	0x5c
+	.uleb128 0x17
+	.string	"io"
+	.byte	0x10
+	.byte	0x2d
+	.byte	0x11
+	.long	0x9b3
+	.byte	0x60
+	.uleb128 0x13
+	.long	.LASF192
+	.byte	0x10
+	.byte	0x2e
+	.byte	0x1a
+	.long	0xaff
+	.value	0x258
+	.uleb128 0x13
+	.long	.LASF193
+	.byte	0x10
+	.byte	0x2f
+	.byte	0xc
+	.long	0x2e
+	.value	0x260
+	.uleb128 0x13
+	.long	.LASF194
+	.byte	0x10
+	.byte	0x30
+	.byte	0xc
+	.long	0x2e
+	.value	0x268
+	.uleb128 0x13
+	.long	.LASF195
+	.byte	0x10
+	.byte	0x31
+	.byte	0xa
+	.long	0x52
+	.value	0x270
+	.byte	0
+	.uleb128 0x6
+	.long	0x67
+	.uleb128 0x5
+	.long	.LASF196
+	.byte	0x10
+	.byte	0x32
+	.byte	0x3
+	.long	0x9fb
+	.uleb128 0x10
+	.long	0xb04
+	.uleb128 0x1f
+	.value	0x240
+	.byte	0x10
+	.byte	0x34
+	.long	0xbad
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x10
+	.byte	0x36
+	.byte	0xb
+	.long	0x5c9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x10
+	.byte	0x37
+	.byte	0x14
+	.long	0x9ef
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x10
+	.byte	0x38
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x10
+	.byte	0x39
+	.byte	0x12
+	.long	0x73
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x10
+	.byte	0x3a
+	.byte	0xa
+	.long	0x52
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x10
+	.byte	0x3b
+	.byte	0xa
+	.long	0x52
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x10
+	.byte	0x3c
+	.byte	0xb
+	.long	0x118
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xc
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x10
+	.byte	0x3f
+	.byte	0xc
+	.long	0x2e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x10
+	.byte	0x40
+	.byte	0x9
+	.long	0x46
+	.byte	0x40
+	.uleb128 0x17
+	.string	"io"
+	.byte	0x10
+	.byte	0x41
+	.byte	0x11
+	.long	0x9b3
+	.byte	0x48
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF200
+	.byte	0x10
+	.byte	0x42
+	.byte	0x3
+	.long	0xb15
+	.uleb128 0x10
+	.long	0xbad
+	.uleb128 0x19
+	.byte	0x10
+	.byte	0x1
+	.byte	0x20
+	.byte	0xe
+	.long	0xbe2
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x1
+	.byte	0x22
+	.byte	0x11
+	.long	0x5d3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x1
+	.byte	0x23
+	.byte	0x14
+	.long	0x9ef
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	0xbbe
+	.uleb128 0xc
+	.long	0xbe2
+	.long	0xbf7
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.long	0xbe7
+	.uleb128 0xb
+	.long	.LASF202
+	.byte	0x24
+	.byte	0x3
+	.long	0xbf7
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sampleFormatNames
+	.uleb128 0xb
+	.long	.LASF203
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x724
+	.uleb128 0x9
+	.byte	0x3
+	.quad	sampleIoBackend
+	.uleb128 0x11
+	.long	.LASF204
+	.byte	0x11
+	.value	0x18e
+	.byte	0x10
+	.long	0x16c
+	.long	0xc4c
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0xf4
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF205
+	.byte	0x12
+	.value	0x2c9
+	.byte	0xc
+	.long	0x46
+	.long	0xc6d
+	.uleb128 0x2
+	.long	0x5c9
+	.uleb128 0x2
+	.long	0x52
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF206
+	.byte	0x11
+	.value	0x419
+	.byte	0xc
+	.long	0x46
+	.long	0xc89
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0xf4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF207
+	.byte	0xf
+	.byte	0x9a
+	.byte	0x5
+	.long	0x46
+	.long	0xc9f
+	.uleb128 0x2
+	.long	0xc9f
+	.byte	0
+	.uleb128 0x6
+	.long	0x9b3
+	.uleb128 0x9
+	.long	.LASF208
+	.byte	0x12
+	.byte	0xe6
+	.byte	0xc
+	.long	0x46
+	.long	0xcba
+	.uleb128 0x2
+	.long	0x5c9
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF209
+	.byte	0x12
+	.byte	0xb2
+	.byte	0xc
+	.long	0x46
+	.long	0xcd0
+	.uleb128 0x2
+	.long	0x5c9
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF215
+	.byte	0x15
+	.value	0x238
+	.long	0xce2
+	.uleb128 0x2
+	.long	0x118
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF210
+	.byte	0xf
+	.byte	0xa1
+	.byte	0x5
+	.long	0x46
+	.long	0xcf8
+	.uleb128 0x2
+	.long	0xc9f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF211
+	.byte	0x13
+	.byte	0x4c
+	.byte	0xc
+	.long	0x46
+	.long	0xd13
+	.uleb128 0x2
+	.long	0x118
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF212
+	.byte	0xf
+	.byte	0x76
+	.byte	0x5
+	.long	0x46
+	.long	0xd42
+	.uleb128 0x2
+	.long	0xc9f
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x748
+	.uleb128 0x2
+	.long	0x724
+	.uleb128 0x2
+	.long	0x160
+	.uleb128 0x2
+	.long	0x160
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF213
+	.byte	0x12
+	.value	0x2ce
+	.byte	0x11
+	.long	0x52
+	.long	0xd59
+	.uleb128 0x2
+	.long	0x5c9
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF214
+	.byte	0x14
+	.byte	0xd2
+	.byte	0xc
+	.long	0x46
+	.long	0xd74
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0xd74
+	.byte	0
+	.uleb128 0x6
+	.long	0x612
+	.uleb128 0x21
+	.long	.LASF216
+	.byte	0x12
+	.value	0x324
+	.long	0xd8b
+	.uleb128 0x2
+	.long	0x5d3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF217
+	.byte	0x12
+	.value	0x102
+	.byte	0xe
+	.long	0x5c9
+	.long	0xda7
+	.uleb128 0x2
+	.long	0x5d8
+	.uleb128 0x2
+	.long	0x5d8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF218
+	.byte	0x16
+	.byte	0x3d
+	.byte	0xe
+	.long	0x118
+	.long	0xdc7
+	.uleb128 0x2
+	.long	0x118
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF219
+	.byte	0x16
+	.value	0x111
+	.byte	0xe
+	.long	0x14f
+	.long	0xde3
+	.uleb128 0x2
+	.long	0x5d3
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF220
+	.byte	0x16
+	.byte	0x9c
+	.byte	0xc
+	.long	0x46
+	.long	0xdfe
+	.uleb128 0x2
+	.long	0x5d3
+	.uleb128 0x2
+	.long	0x5d3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF221
+	.byte	0x17
+	.value	0x13d
+	.byte	0x1
+	.long	0x52
+	.long	0xe15
+	.uleb128 0x2
+	.long	0x5ff
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF222
+	.byte	0xf
+	.byte	0x7e
+	.byte	0x9
+	.long	0x16c
+	.long	0xe30
+	.uleb128 0x2
+	.long	0xc9f
+	.uleb128 0x2
+	.long	0xe30
+	.byte	0
+	.uleb128 0x6
+	.long	0xaff
+	.uleb128 0x22
+	.long	.LASF223
+	.byte	0x84
+	.long	0xe45
+	.uleb128 0x2
+	.long	0xc9f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF224
+	.byte	0x18
+	.byte	0x21
+	.byte	0x8
+	.long	0x2e
+	.long	0xe65
+	.uleb128 0x2
+	.long	0x14f
+	.uleb128 0x2
+	.long	0x5ff
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF225
+	.byte	0x18
+	.byte	0x29
+	.byte	0x8
+	.long	0x2e
+	.long	0xe80
+	.uleb128 0x2
+	.long	0x14f
+	.uleb128 0x2
+	.long	0x52
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF226
+	.byte	0xf
+	.byte	0x8c
+	.byte	0x10
+	.long	0x7c9
+	.long	0xe96
+	.uleb128 0x2
+	.long	0xc9f
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF227
+	.byte	0x93
+	.long	0xeab
+	.uleb128 0x2
+	.long	0xc9f
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF228
+	.byte	0x18
+	.byte	0x18
+	.byte	0xd
+	.long	0x5d3
+	.long	0xecb
+	.uleb128 0x2
+	.long	0x5d3
+	.uleb128 0x2
+	.long	0x5d3
+	.uleb128 0x2
+	.long	0xecb
+	.byte	0
+	.uleb128 0x6
+	.long	0x5ff
+	.uleb128 0x9
+	.long	.LASF229
+	.byte	0x16
+	.byte	0x2f
+	.byte	0xe
+	.long	0x118
+	.long	0xef0
+	.uleb128 0x2
+	.long	0x118
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF230
+	.byte	0x15
+	.value	0x229
+	.byte	0xe
+	.long	0x118
+	.long	0xf07
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF231
+	.byte	0x13
+	.byte	0x5e
+	.byte	0xc
+	.long	0x46
+	.long	0xf27
+	.uleb128 0x2
+	.long	0x118
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF232
+	.byte	0x13
+	.byte	0x39
+	.byte	0xe
+	.long	0x118
+	.long	0xf56
+	.uleb128 0x2
+	.long	0x118
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0xf4
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF233
+	.byte	0x12
+	.value	0x329
+	.byte	0xc
+	.long	0x46
+	.long	0xf6d
+	.uleb128 0x2
+	.long	0x5c9
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF234
+	.byte	0x12
+	.value	0x2a9
+	.byte	0xf
+	.long	0x2e
+	.long	0xf93
+	.uleb128 0x2
+	.long	0x3d4
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x5ce
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF235
+	.byte	0x16
+	.byte	0x2b
+	.byte	0xe
+	.long	0x118
+	.long	0xfb3
+	.uleb128 0x2
+	.long	0x118
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF236
+	.byte	0x12
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0xfcb
+	.uleb128 0x2
+	.long	0x5d3
+	.uleb128 0x2a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF237
+	.byte	0x16
+	.byte	0x40
+	.byte	0xc
+	.long	0x46
+	.long	0xfeb
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF238
+	.byte	0x12
+	.value	0x2a3
+	.byte	0xf
+	.long	0x2e
+	.long	0x1011
+	.uleb128 0x2
+	.long	0x11a
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x5ce
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF240
+	.value	0x3c9
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB36
+	.quad	.LFE36-.LFB36
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1052
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x3c9
+	.byte	0x2a
+	.long	0x1052
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x3cb
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x6
+	.long	0xbad
+	.uleb128 0x12
+	.long	.LASF241
+	.value	0x39c
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB35
+	.quad	.LFE35-.LFB35
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x117a
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x39c
+	.byte	0x32
+	.long	0x117a
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8296
+	.uleb128 0x3
+	.long	.LASF243
+	.value	0x39c
+	.byte	0x47
+	.long	0x117f
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8304
+	.uleb128 0x3
+	.long	.LASF182
+	.value	0x39c
+	.byte	0x54
+	.long	0x46
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8308
+	.uleb128 0x3
+	.long	.LASF244
+	.value	0x39c
+	.byte	0x66
+	.long	0x52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8320
+	.uleb128 0x4
+	.long	.LASF245
+	.value	0x39e
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.string	"fd"
+	.value	0x39f
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x4
+	.long	.LASF246
+	.value	0x3a0
+	.byte	0xd
+	.long	0x1184
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -8288
+	.uleb128 0x4
+	.long	.LASF167
+	.value	0x3a1
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF247
+	.value	0x3a2
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x4
+	.long	.LASF136
+	.value	0x3a3
+	.byte	0xb
+	.long	0x160
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x8
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.uleb128 0x4
+	.long	.LASF248
+	.value	0x3a8
+	.byte	0x10
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF249
+	.value	0x3a9
+	.byte	0x15
+	.long	0x3cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF250
+	.value	0x3b8
+	.byte	0x11
+	.long	0x16c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x8
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.uleb128 0x7
+	.string	"i"
+	.value	0x3b1
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xbb9
+	.uleb128 0x6
+	.long	0x606
+	.uleb128 0xc
+	.long	0x178
+	.long	0x1195
+	.uleb128 0x2b
+	.long	0x3f
+	.value	0xfff
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF251
+	.value	0x373
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB34
+	.quad	.LFE34-.LFB34
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x11e5
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x373
+	.byte	0x2c
+	.long	0x1052
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.long	.LASF182
+	.value	0x373
+	.byte	0x39
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF252
+	.value	0x375
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF253
+	.value	0x340
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB33
+	.quad	.LFE33-.LFB33
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x12d7
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x340
+	.byte	0x24
+	.long	0x1052
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x3
+	.long	.LASF243
+	.value	0x340
+	.byte	0x39
+	.long	0x117f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x3
+	.long	.LASF182
+	.value	0x340
+	.byte	0x46
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0x4
+	.long	.LASF245
+	.value	0x34b
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF254
+	.value	0x34c
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x8
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.uleb128 0x4
+	.long	.LASF255
+	.value	0x350
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.string	"src"
+	.value	0x355
+	.byte	0x16
+	.long	0x117f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF247
+	.value	0x356
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x8
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.uleb128 0x7
+	.string	"dst"
+	.value	0x362
+	.byte	0x16
+	.long	0x12d7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x8
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.uleb128 0x7
+	.string	"i"
+	.value	0x363
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x178
+	.uleb128 0x12
+	.long	.LASF256
+	.value	0x306
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB32
+	.quad	.LFE32-.LFB32
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x135f
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x306
+	.byte	0x29
+	.long	0x1052
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x3
+	.long	.LASF257
+	.value	0x306
+	.byte	0x3d
+	.long	0x5d3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x3
+	.long	.LASF179
+	.value	0x306
+	.byte	0x56
+	.long	0x9ef
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -196
+	.uleb128 0x3
+	.long	.LASF180
+	.value	0x307
+	.byte	0x1d
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0x3
+	.long	.LASF181
+	.value	0x307
+	.byte	0x34
+	.long	0x73
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -204
+	.uleb128 0x4
+	.long	.LASF258
+	.value	0x309
+	.byte	0x11
+	.long	0x612
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF259
+	.value	0x2ef
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13a0
+	.uleb128 0x3
+	.long	.LASF260
+	.value	0x2ef
+	.byte	0x2a
+	.long	0x13a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x2f1
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x6
+	.long	0xb04
+	.uleb128 0x12
+	.long	.LASF261
+	.value	0x2d8
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1407
+	.uleb128 0x3
+	.long	.LASF260
+	.value	0x2d8
+	.byte	0x30
+	.long	0x1407
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x2da
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x8
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.uleb128 0x4
+	.long	.LASF262
+	.value	0x2de
+	.byte	0xe
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xb10
+	.uleb128 0x12
+	.long	.LASF263
+	.value	0x29d
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1511
+	.uleb128 0x3
+	.long	.LASF260
+	.value	0x29d
+	.byte	0x23
+	.long	0x13a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x3
+	.long	.LASF243
+	.value	0x29d
+	.byte	0x32
+	.long	0xecb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x3
+	.long	.LASF182
+	.value	0x29d
+	.byte	0x3f
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -116
+	.uleb128 0x4
+	.long	.LASF264
+	.value	0x29f
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x4
+	.long	.LASF252
+	.value	0x2aa
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF265
+	.value	0x2ac
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x1b
+	.long	.LLRL3
+	.uleb128 0x4
+	.long	.LASF266
+	.value	0x2b0
+	.byte	0x10
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.string	"dst"
+	.value	0x2be
+	.byte	0x10
+	.long	0xecb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x7
+	.string	"got"
+	.value	0x2bf
+	.byte	0x10
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF247
+	.value	0x2c0
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x8
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.uleb128 0x7
+	.string	"src"
+	.value	0x2c4
+	.byte	0x1c
+	.long	0x1511
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x8
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.uleb128 0x7
+	.string	"i"
+	.value	0x2c5
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x184
+	.uleb128 0x12
+	.long	.LASF267
+	.value	0x249
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15aa
+	.uleb128 0x3
+	.long	.LASF260
+	.value	0x249
+	.byte	0x29
+	.long	0x13a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -200
+	.uleb128 0x3
+	.long	.LASF257
+	.value	0x249
+	.byte	0x3d
+	.long	0x5d3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -208
+	.uleb128 0x3
+	.long	.LASF179
+	.value	0x249
+	.byte	0x56
+	.long	0x9ef
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -212
+	.uleb128 0x3
+	.long	.LASF180
+	.value	0x249
+	.byte	0x62
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -216
+	.uleb128 0x4
+	.long	.LASF258
+	.value	0x24b
+	.byte	0x11
+	.long	0x612
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x8
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.uleb128 0x7
+	.string	"end"
+	.value	0x283
+	.byte	0xe
+	.long	0x52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF268
+	.byte	0x1
+	.value	0x23d
+	.byte	0xd
+	.long	0x5d3
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x15fc
+	.uleb128 0x3
+	.long	.LASF179
+	.value	0x23d
+	.byte	0x30
+	.long	0x9ef
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x8
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.uleb128 0x7
+	.string	"i"
+	.value	0x23f
+	.byte	0x17
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF269
+	.value	0x226
+	.byte	0x10
+	.long	0x9ef
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x164c
+	.uleb128 0x3
+	.long	.LASF257
+	.value	0x226
+	.byte	0x38
+	.long	0x5d3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x228
+	.byte	0x14
+	.long	0x9ef
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x4
+	.long	.LASF270
+	.value	0x229
+	.byte	0x11
+	.long	0x5d3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF271
+	.value	0x219
+	.byte	0x10
+	.long	0x9ef
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x169d
+	.uleb128 0x3
+	.long	.LASF179
+	.value	0x219
+	.byte	0x3b
+	.long	0x5d3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.uleb128 0x7
+	.string	"i"
+	.value	0x21b
+	.byte	0x17
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF311
+	.byte	0x1
+	.value	0x214
+	.byte	0x6
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x16cc
+	.uleb128 0x3
+	.long	.LASF157
+	.value	0x214
+	.byte	0x2d
+	.long	0x724
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF272
+	.value	0x1e9
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17bd
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x1e9
+	.byte	0x30
+	.long	0x1052
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x3
+	.long	.LASF243
+	.value	0x1e9
+	.byte	0x45
+	.long	0x117f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x3
+	.long	.LASF182
+	.value	0x1e9
+	.byte	0x52
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -116
+	.uleb128 0x4
+	.long	.LASF245
+	.value	0x1eb
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF247
+	.value	0x1ec
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF167
+	.value	0x1ed
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.uleb128 0x7
+	.string	"n"
+	.value	0x1fa
+	.byte	0x10
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.string	"dst"
+	.value	0x1ff
+	.byte	0x18
+	.long	0x7c9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x8
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.uleb128 0x4
+	.long	.LASF246
+	.value	0x206
+	.byte	0x16
+	.long	0x12d7
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x8
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0x7
+	.string	"i"
+	.value	0x207
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF273
+	.value	0x1af
+	.byte	0xf
+	.long	0x2e
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18b2
+	.uleb128 0x3
+	.long	.LASF260
+	.value	0x1af
+	.byte	0x32
+	.long	0x13a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF243
+	.value	0x1af
+	.byte	0x41
+	.long	0xecb
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF247
+	.value	0x1af
+	.byte	0x51
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF245
+	.value	0x1b1
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF167
+	.value	0x1b2
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.uleb128 0x7
+	.string	"n"
+	.value	0x1ca
+	.byte	0x10
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2e
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.long	0x1870
+	.uleb128 0x7
+	.string	"got"
+	.value	0x1bd
+	.byte	0x15
+	.long	0x16c
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x8
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.uleb128 0x7
+	.string	"src"
+	.value	0x1d5
+	.byte	0x1c
+	.long	0x1511
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x7
+	.string	"i"
+	.value	0x1d6
+	.byte	0x19
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF274
+	.value	0x181
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1991
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x181
+	.byte	0x2f
+	.long	0x1052
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x3
+	.long	.LASF243
+	.value	0x181
+	.byte	0x44
+	.long	0x117f
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x3
+	.long	.LASF182
+	.value	0x181
+	.byte	0x51
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -84
+	.uleb128 0x4
+	.long	.LASF275
+	.value	0x183
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x8
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x7
+	.string	"n"
+	.value	0x185
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x8
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0x4
+	.long	.LASF276
+	.value	0x187
+	.byte	0x16
+	.long	0x117f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF277
+	.value	0x188
+	.byte	0x10
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF185
+	.value	0x193
+	.byte	0xf
+	.long	0x14f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x7
+	.string	"c"
+	.value	0x19a
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF278
+	.value	0x170
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x19c3
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x170
+	.byte	0x33
+	.long	0x1052
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF279
+	.value	0x156
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a04
+	.uleb128 0x3
+	.long	.LASF242
+	.value	0x156
+	.byte	0x31
+	.long	0x1052
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x158
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF280
+	.value	0x137
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a76
+	.uleb128 0x3
+	.long	.LASF260
+	.value	0x137
+	.byte	0x2e
+	.long	0x13a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x3
+	.long	.LASF243
+	.value	0x137
+	.byte	0x3d
+	.long	0xecb
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.long	.LASF247
+	.value	0x137
+	.byte	0x4a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x7
+	.string	"i"
+	.value	0x139
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x1b
+	.long	.LLRL2
+	.uleb128 0x4
+	.long	.LASF281
+	.value	0x142
+	.byte	0x15
+	.long	0x5d3
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF297
+	.byte	0x1
+	.value	0x121
+	.byte	0xd
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1ad2
+	.uleb128 0x3
+	.long	.LASF260
+	.value	0x121
+	.byte	0x31
+	.long	0x13a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF185
+	.value	0x123
+	.byte	0xb
+	.long	0x14f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF282
+	.value	0x124
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.string	"got"
+	.value	0x127
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF283
+	.value	0x101
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b25
+	.uleb128 0x3
+	.long	.LASF260
+	.value	0x101
+	.byte	0x2e
+	.long	0x13a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x4
+	.long	.LASF284
+	.value	0x105
+	.byte	0xf
+	.long	0x118
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF285
+	.byte	0xe5
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b81
+	.uleb128 0xd
+	.long	.LASF242
+	.byte	0xe5
+	.byte	0x34
+	.long	0x1052
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0xb
+	.long	.LASF286
+	.byte	0xe7
+	.byte	0x13
+	.long	0x1b81
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0xb
+	.long	.LASF245
+	.byte	0xe8
+	.byte	0x14
+	.long	0x5e9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -18
+	.uleb128 0xb
+	.long	.LASF287
+	.byte	0xe9
+	.byte	0x14
+	.long	0x5fa
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0xc
+	.long	0x60
+	.long	0x1b91
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF288
+	.byte	0x92
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1c51
+	.uleb128 0xd
+	.long	.LASF260
+	.byte	0x92
+	.byte	0x33
+	.long	0x13a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0xd
+	.long	.LASF257
+	.byte	0x92
+	.byte	0x47
+	.long	0x5d3
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0xb
+	.long	.LASF286
+	.byte	0x94
+	.byte	0x13
+	.long	0x1c51
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -70
+	.uleb128 0xb
+	.long	.LASF248
+	.byte	0x95
+	.byte	0x13
+	.long	0x1c61
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -78
+	.uleb128 0x30
+	.string	"fmt"
+	.byte	0x1
+	.byte	0x96
+	.byte	0x13
+	.long	0x1c71
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0xb
+	.long	.LASF289
+	.byte	0x97
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x1b
+	.long	.LLRL0
+	.uleb128 0xb
+	.long	.LASF290
+	.byte	0xa2
+	.byte	0x12
+	.long	0x5ee
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x1b
+	.long	.LLRL1
+	.uleb128 0xb
+	.long	.LASF291
+	.byte	0xa6
+	.byte	0x14
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xb
+	.long	.LASF292
+	.byte	0xb0
+	.byte	0x16
+	.long	0x5dd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -38
+	.uleb128 0xb
+	.long	.LASF293
+	.byte	0xb1
+	.byte	0x16
+	.long	0x5dd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -58
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x60
+	.long	0x1c61
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0xb
+	.byte	0
+	.uleb128 0xc
+	.long	0x60
+	.long	0x1c71
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0xc
+	.long	0x60
+	.long	0x1c81
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0x27
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF294
+	.byte	0x7c
+	.byte	0xc
+	.long	0x46
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cf0
+	.uleb128 0xd
+	.long	.LASF178
+	.byte	0x7c
+	.byte	0x20
+	.long	0x5c9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -296
+	.uleb128 0xd
+	.long	.LASF295
+	.byte	0x7c
+	.byte	0x2b
+	.long	0x52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -304
+	.uleb128 0xb
+	.long	.LASF296
+	.byte	0x7e
+	.byte	0x13
+	.long	0x1cf0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -288
+	.uleb128 0x8
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0xb
+	.long	.LASF266
+	.byte	0x82
+	.byte	0x10
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x60
+	.long	0x1d00
+	.uleb128 0xf
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF298
+	.byte	0x70
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d39
+	.uleb128 0xd
+	.long	.LASF249
+	.byte	0x70
+	.byte	0x2d
+	.long	0x7c9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xd
+	.long	.LASF299
+	.byte	0x70
+	.byte	0x3d
+	.long	0x5dd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF300
+	.byte	0x68
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1d72
+	.uleb128 0xd
+	.long	.LASF249
+	.byte	0x68
+	.byte	0x2d
+	.long	0x7c9
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xd
+	.long	.LASF299
+	.byte	0x68
+	.byte	0x3d
+	.long	0x5ee
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF301
+	.byte	0x63
+	.byte	0x11
+	.long	0x5dd
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1da2
+	.uleb128 0xd
+	.long	.LASF249
+	.byte	0x63
+	.byte	0x37
+	.long	0xaff
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF302
+	.byte	0x5e
+	.byte	0x11
+	.long	0x5ee
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1dd2
+	.uleb128 0xd
+	.long	.LASF249
+	.byte	0x5e
+	.byte	0x37
+	.long	0xaff
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF303
+	.byte	0x4f
+	.byte	0x17
+	.long	0x178
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e10
+	.uleb128 0xd
+	.long	.LASF304
+	.byte	0x4f
+	.byte	0x31
+	.long	0x5ff
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xb
+	.long	.LASF305
+	.byte	0x51
+	.byte	0xb
+	.long	0x5ff
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF306
+	.byte	0x4a
+	.byte	0x13
+	.long	0x46
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1e40
+	.uleb128 0xd
+	.long	.LASF179
+	.byte	0x4a
+	.byte	0x31
+	.long	0x9ef
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF307
+	.byte	0x1
+	.byte	0x34
+	.byte	0xf
+	.long	0x2e
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0xd
+	.long	.LASF179
+	.byte	0x34
+	.byte	0x36
+	.long	0x9ef
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xb
+	.long	.LASF239
+	.byte	0x36
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x55
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_rnglists,"",@progbits
+.Ldebug_ranges0:
+	.long	.Ldebug_ranges3-.Ldebug_ranges2
+.Ldebug_ranges2:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	0
+.LLRL0:
+	.byte	0x4
+	.uleb128 .LBB3-.Ltext0
+	.uleb128 .LBE3-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB6-.Ltext0
+	.uleb128 .LBE6-.Ltext0
+	.byte	0
+.LLRL1:
+	.byte	0x4
+	.uleb128 .LBB4-.Ltext0
+	.uleb128 .LBE4-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB5-.Ltext0
+	.uleb128 .LBE5-.Ltext0
+	.byte	0
+.LLRL2:
+	.byte	0x4
+	.uleb128 .LBB8-.Ltext0
+	.uleb128 .LBE8-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB9-.Ltext0
+	.uleb128 .LBE9-.Ltext0
+	.byte	0
+.LLRL3:
+	.byte	0x4
+	.uleb128 .LBB23-.Ltext0
+	.uleb128 .LBE23-.Ltext0
+	.byte	0x4
+	.uleb128 .LBB26-.Ltext0
+	.uleb128 .LBE26-.Ltext0
+	.byte	0
+.Ldebug_ranges3:
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF120:
+	.string	"__glibc_reserved"
+.LASF36:
+	.string	"__value32"
+.LASF119:
+	.string	"st_ctim"
+.LASF9:
+	.string	"size_t"
+.LASF258:
+	.string	"fileStat"
+.LASF49:
+	.string	"__kind"
+.LASF301:
+	.string	"sampleIo_GetLe16"
+.LASF211:
+	.string	"munmap"
+.LASF248:
+	.string	"chunk"
+.LASF66:
+	.string	"pthread_cond_t"
+.LASF115:
+	.string	"st_blksize"
+.LASF116:
+	.string	"st_blocks"
+.LASF140:
+	.string	"AsyncFileBuffer_t"
+.LASF25:
+	.string	"__ssize_t"
+.LASF306:
+	.string	"sampleIo_IsWav"
+.LASF99:
+	.string	"_IO_codecvt"
+.LASF252:
+	.string	"frameBytes"
+.LASF242:
+	.string	"writer"
+.LASF266:
+	.string	"request"
+.LASF43:
+	.string	"__pthread_list_t"
+.LASF79:
+	.string	"_IO_save_end"
+.LASF257:
+	.string	"fileName"
+.LASF16:
+	.string	"__gid_t"
+.LASF118:
+	.string	"st_mtim"
+.LASF42:
+	.string	"__next"
+.LASF62:
+	.string	"__data"
+.LASF72:
+	.string	"_IO_write_base"
+.LASF41:
+	.string	"__prev"
+.LASF139:
+	.string	"state"
+.LASF88:
+	.string	"_lock"
+.LASF40:
+	.string	"__pthread_internal_list"
+.LASF160:
+	.string	"submitted"
+.LASF105:
+	.string	"stat"
+.LASF207:
+	.string	"asyncFile_Flush"
+.LASF147:
+	.string	"sqTail"
+.LASF77:
+	.string	"_IO_save_base"
+.LASF47:
+	.string	"__owner"
+.LASF150:
+	.string	"cqHead"
+.LASF295:
+	.string	"numOfBytes"
+.LASF35:
+	.string	"__value64"
+.LASF177:
+	.string	"SampleFormat_t"
+.LASF81:
+	.string	"_chain"
+.LASF29:
+	.string	"ssize_t"
+.LASF85:
+	.string	"_cur_column"
+.LASF204:
+	.string	"pwrite"
+.LASF269:
+	.string	"sampleIo_FormatFromFileName"
+.LASF14:
+	.string	"__dev_t"
+.LASF233:
+	.string	"fileno"
+.LASF138:
+	.string	"result"
+.LASF287:
+	.string	"dataSize"
+.LASF3:
+	.string	"long int"
+.LASF229:
+	.string	"memmove"
+.LASF98:
+	.string	"_IO_marker"
+.LASF122:
+	.string	"ASYNC_FILE_BACKEND_UNKNOWN"
+.LASF196:
+	.string	"SampleReader_t"
+.LASF162:
+	.string	"error"
+.LASF187:
+	.string	"textPos"
+.LASF280:
+	.string	"sampleIo_ReadText"
+.LASF303:
+	.string	"sampleIo_FloatToS16"
+.LASF48:
+	.string	"__nusers"
+.LASF194:
+	.string	"ioPos"
+.LASF8:
+	.string	"signed char"
+.LASF23:
+	.string	"__blksize_t"
+.LASF67:
+	.string	"_IO_FILE"
+.LASF134:
+	.string	"AsyncFileBufferState_t"
+.LASF100:
+	.string	"_IO_wide_data"
+.LASF110:
+	.string	"st_uid"
+.LASF153:
+	.string	"cqes"
+.LASF44:
+	.string	"__pthread_mutex_s"
+.LASF124:
+	.string	"ASYNC_FILE_BACKEND_URING"
+.LASF5:
+	.string	"unsigned char"
+.LASF50:
+	.string	"__spins"
+.LASF92:
+	.string	"_freeres_list"
+.LASF298:
+	.string	"sampleIo_PutLe16"
+.LASF113:
+	.string	"st_rdev"
+.LASF209:
+	.string	"fclose"
+.LASF195:
+	.string	"ioPosition"
+.LASF193:
+	.string	"ioLength"
+.LASF265:
+	.string	"direct"
+.LASF286:
+	.string	"header"
+.LASF26:
+	.string	"__syscall_slong_t"
+.LASF249:
+	.string	"bytes"
+.LASF299:
+	.string	"value"
+.LASF176:
+	.string	"SAMPLE_FORMAT_WAV_F32"
+.LASF154:
+	.string	"registered"
+.LASF27:
+	.string	"char"
+.LASF171:
+	.string	"SAMPLE_FORMAT_UNKNOWN"
+.LASF288:
+	.string	"sampleIo_ReadWavHeader"
+.LASF34:
+	.string	"__high"
+.LASF241:
+	.string	"sampleIo_WriteFramesAt"
+.LASF272:
+	.string	"sampleIo_WriteAsync"
+.LASF309:
+	.string	"_IO_lock_t"
+.LASF12:
+	.string	"__uint16_t"
+.LASF300:
+	.string	"sampleIo_PutLe32"
+.LASF170:
+	.string	"AsyncFile_t"
+.LASF129:
+	.string	"ASYNC_FILE_WRITE"
+.LASF18:
+	.string	"__mode_t"
+.LASF33:
+	.string	"__low"
+.LASF69:
+	.string	"_IO_read_ptr"
+.LASF213:
+	.string	"ftell"
+.LASF220:
+	.string	"strcmp"
+.LASF304:
+	.string	"sample"
+.LASF310:
+	.string	"stdin"
+.LASF232:
+	.string	"mmap"
+.LASF186:
+	.string	"text"
+.LASF271:
+	.string	"sampleIo_processArgumentFormat"
+.LASF144:
+	.string	"cqRingSize"
+.LASF212:
+	.string	"asyncFile_Open"
+.LASF290:
+	.string	"chunkSize"
+.LASF174:
+	.string	"SAMPLE_FORMAT_S16"
+.LASF80:
+	.string	"_markers"
+.LASF178:
+	.string	"file"
+.LASF228:
+	.string	"fastFloat_Parse"
+.LASF243:
+	.string	"samples"
+.LASF210:
+	.string	"asyncFile_Close"
+.LASF307:
+	.string	"sampleIo_BytesPerSample"
+.LASF189:
+	.string	"mappedSize"
+.LASF227:
+	.string	"asyncFile_CommitWrite"
+.LASF236:
+	.string	"printf"
+.LASF172:
+	.string	"SAMPLE_FORMAT_TEXT"
+.LASF185:
+	.string	"buffer"
+.LASF158:
+	.string	"memory"
+.LASF275:
+	.string	"maxLineLength"
+.LASF45:
+	.string	"__lock"
+.LASF282:
+	.string	"left"
+.LASF302:
+	.string	"sampleIo_GetLe32"
+.LASF126:
+	.string	"ASYNC_FILE_BACKEND_STDIO"
+.LASF260:
+	.string	"reader"
+.LASF283:
+	.string	"sampleIo_OpenText"
+.LASF89:
+	.string	"_offset"
+.LASF270:
+	.string	"extension"
+.LASF143:
+	.string	"cqRing"
+.LASF111:
+	.string	"st_gid"
+.LASF291:
+	.string	"fmtSize"
+.LASF149:
+	.string	"sqArray"
+.LASF198:
+	.string	"bufferSize"
+.LASF133:
+	.string	"ASYNC_FILE_BUFFER_DONE"
+.LASF55:
+	.string	"__g1_start"
+.LASF161:
+	.string	"completed"
+.LASF2:
+	.string	"long unsigned int"
+.LASF152:
+	.string	"cqMask"
+.LASF179:
+	.string	"format"
+.LASF125:
+	.string	"ASYNC_FILE_BACKEND_THREAD"
+.LASF61:
+	.string	"pthread_t"
+.LASF83:
+	.string	"_flags2"
+.LASF114:
+	.string	"st_size"
+.LASF71:
+	.string	"_IO_read_base"
+.LASF123:
+	.string	"ASYNC_FILE_BACKEND_AUTO"
+.LASF245:
+	.string	"bytesPerSample"
+.LASF96:
+	.string	"_unused2"
+.LASF246:
+	.string	"converted"
+.LASF63:
+	.string	"__size"
+.LASF199:
+	.string	"bufferLength"
+.LASF84:
+	.string	"_old_offset"
+.LASF167:
+	.string	"done"
+.LASF239:
+	.string	"retval"
+.LASF214:
+	.string	"fstat"
+.LASF24:
+	.string	"__blkcnt_t"
+.LASF159:
+	.string	"buffers"
+.LASF58:
+	.string	"__g1_orig_size"
+.LASF17:
+	.string	"__ino_t"
+.LASF13:
+	.string	"__uint32_t"
+.LASF4:
+	.string	"long long int"
+.LASF255:
+	.string	"frames"
+.LASF219:
+	.string	"strrchr"
+.LASF184:
+	.string	"dataBytesLeft"
+.LASF127:
+	.string	"AsyncFileBackend_t"
+.LASF104:
+	.string	"double"
+.LASF74:
+	.string	"_IO_write_end"
+.LASF181:
+	.string	"sampleRate"
+.LASF276:
+	.string	"frame"
+.LASF103:
+	.string	"float"
+.LASF203:
+	.string	"sampleIoBackend"
+.LASF254:
+	.string	"framesWritten"
+.LASF247:
+	.string	"count"
+.LASF192:
+	.string	"ioData"
+.LASF169:
+	.string	"stop"
+.LASF59:
+	.string	"__wrefs"
+.LASF268:
+	.string	"sampleIo_FormatName"
+.LASF75:
+	.string	"_IO_buf_base"
+.LASF285:
+	.string	"sampleIo_WriteWavHeader"
+.LASF7:
+	.string	"unsigned int"
+.LASF297:
+	.string	"sampleIo_RefillText"
+.LASF216:
+	.string	"perror"
+.LASF65:
+	.string	"pthread_mutex_t"
+.LASF221:
+	.string	"lrintf"
+.LASF222:
+	.string	"asyncFile_AcquireRead"
+.LASF180:
+	.string	"channels"
+.LASF262:
+	.string	"position"
+.LASF206:
+	.string	"ftruncate"
+.LASF112:
+	.string	"__pad0"
+.LASF205:
+	.string	"fseek"
+.LASF94:
+	.string	"__pad5"
+.LASF197:
+	.string	"dataOffset"
+.LASF284:
+	.string	"mapped"
+.LASF253:
+	.string	"sampleIo_Write"
+.LASF308:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF240:
+	.string	"sampleIo_CloseWriter"
+.LASF68:
+	.string	"_flags"
+.LASF136:
+	.string	"offset"
+.LASF95:
+	.string	"_mode"
+.LASF183:
+	.string	"fileSize"
+.LASF145:
+	.string	"sqes"
+.LASF90:
+	.string	"_codecvt"
+.LASF46:
+	.string	"__count"
+.LASF151:
+	.string	"cqTail"
+.LASF108:
+	.string	"st_nlink"
+.LASF28:
+	.string	"off_t"
+.LASF155:
+	.string	"AsyncFileRing_t"
+.LASF278:
+	.string	"sampleIo_AcquireBuffer"
+.LASF121:
+	.string	"long double"
+.LASF97:
+	.string	"FILE"
+.LASF106:
+	.string	"st_dev"
+.LASF279:
+	.string	"sampleIo_FlushBuffer"
+.LASF39:
+	.string	"timespec"
+.LASF224:
+	.string	"fastFloat_Format"
+.LASF261:
+	.string	"sampleIo_GetProgress"
+.LASF191:
+	.string	"async"
+.LASF202:
+	.string	"sampleFormatNames"
+.LASF289:
+	.string	"fmtFound"
+.LASF128:
+	.string	"ASYNC_FILE_READ"
+.LASF137:
+	.string	"size"
+.LASF37:
+	.string	"long long unsigned int"
+.LASF52:
+	.string	"__list"
+.LASF267:
+	.string	"sampleIo_OpenReader"
+.LASF277:
+	.string	"length"
+.LASF101:
+	.string	"uint16_t"
+.LASF20:
+	.string	"__off_t"
+.LASF57:
+	.string	"__g_size"
+.LASF226:
+	.string	"asyncFile_AcquireWrite"
+.LASF38:
+	.string	"__atomic_wide_counter"
+.LASF93:
+	.string	"_freeres_buf"
+.LASF251:
+	.string	"sampleIo_ReserveFrames"
+.LASF131:
+	.string	"ASYNC_FILE_BUFFER_FREE"
+.LASF166:
+	.string	"queued"
+.LASF294:
+	.string	"sampleIo_Skip"
+.LASF22:
+	.string	"__time_t"
+.LASF218:
+	.string	"memset"
+.LASF200:
+	.string	"SampleWriter_t"
+.LASF56:
+	.string	"__g_refs"
+.LASF10:
+	.string	"__int16_t"
+.LASF263:
+	.string	"sampleIo_Read"
+.LASF78:
+	.string	"_IO_backup_base"
+.LASF87:
+	.string	"_shortbuf"
+.LASF157:
+	.string	"backend"
+.LASF223:
+	.string	"asyncFile_ReleaseRead"
+.LASF230:
+	.string	"malloc"
+.LASF64:
+	.string	"__align"
+.LASF296:
+	.string	"scratch"
+.LASF21:
+	.string	"__off64_t"
+.LASF217:
+	.string	"fopen"
+.LASF237:
+	.string	"memcmp"
+.LASF173:
+	.string	"SAMPLE_FORMAT_F32"
+.LASF225:
+	.string	"fastFloat_FormatInteger"
+.LASF163:
+	.string	"ring"
+.LASF76:
+	.string	"_IO_buf_end"
+.LASF164:
+	.string	"thread"
+.LASF142:
+	.string	"sqRingSize"
+.LASF201:
+	.string	"name"
+.LASF146:
+	.string	"sqesSize"
+.LASF54:
+	.string	"__wseq"
+.LASF292:
+	.string	"formatTag"
+.LASF11:
+	.string	"short int"
+.LASF175:
+	.string	"SAMPLE_FORMAT_WAV_S16"
+.LASF156:
+	.string	"mode"
+.LASF32:
+	.string	"tv_nsec"
+.LASF30:
+	.string	"int16_t"
+.LASF274:
+	.string	"sampleIo_WriteText"
+.LASF86:
+	.string	"_vtable_offset"
+.LASF51:
+	.string	"__elision"
+.LASF231:
+	.string	"madvise"
+.LASF53:
+	.string	"__pthread_cond_s"
+.LASF130:
+	.string	"AsyncFileMode_t"
+.LASF60:
+	.string	"__g_signals"
+.LASF141:
+	.string	"sqRing"
+.LASF273:
+	.string	"sampleIo_ReadAsync"
+.LASF235:
+	.string	"memcpy"
+.LASF250:
+	.string	"written"
+.LASF109:
+	.string	"st_mode"
+.LASF15:
+	.string	"__uid_t"
+.LASF148:
+	.string	"sqMask"
+.LASF70:
+	.string	"_IO_read_end"
+.LASF182:
+	.string	"numOfFrames"
+.LASF264:
+	.string	"framesRead"
+.LASF102:
+	.string	"uint32_t"
+.LASF82:
+	.string	"_fileno"
+.LASF305:
+	.string	"scaled"
+.LASF132:
+	.string	"ASYNC_FILE_BUFFER_QUEUED"
+.LASF91:
+	.string	"_wide_data"
+.LASF215:
+	.string	"free"
+.LASF188:
+	.string	"textEnd"
+.LASF168:
+	.string	"serviced"
+.LASF244:
+	.string	"firstFrame"
+.LASF6:
+	.string	"short unsigned int"
+.LASF238:
+	.string	"fread"
+.LASF73:
+	.string	"_IO_write_ptr"
+.LASF259:
+	.string	"sampleIo_CloseReader"
+.LASF256:
+	.string	"sampleIo_OpenWriter"
+.LASF311:
+	.string	"sampleIo_SetBackend"
+.LASF190:
+	.string	"textEof"
+.LASF107:
+	.string	"st_ino"
+.LASF19:
+	.string	"__nlink_t"
+.LASF281:
+	.string	"next"
+.LASF135:
+	.string	"data"
+.LASF208:
+	.string	"fflush"
+.LASF31:
+	.string	"tv_sec"
+.LASF234:
+	.string	"fwrite"
+.LASF293:
+	.string	"bitsPerSample"
+.LASF165:
+	.string	"lock"
+.LASF117:
+	.string	"st_atim"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/sampleIo.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9608 @@
+	.file	"signalGenerator.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/signalGenerator.c"
+	.section	.rodata
+.LC0:
+	.string	"unknown"
+.LC1:
+	.string	"sine"
+.LC2:
+	.string	"square"
+.LC3:
+	.string	"sawtooth"
+.LC4:
+	.string	"chirp"
+.LC5:
+	.string	"white"
+.LC6:
+	.string	"pink"
+.LC7:
+	.string	"sine-noise"
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	signalGeneratorTypeNames, @object
+	.size	signalGeneratorTypeNames, 64
+signalGeneratorTypeNames:
+	.quad	.LC0
+	.quad	.LC1
+	.quad	.LC2
+	.quad	.LC3
+	.quad	.LC4
+	.quad	.LC5
+	.quad	.LC6
+	.quad	.LC7
+	.text
+	.type	signalGenerator_Random, @function
+signalGenerator_Random:
+.LFB6:
+	.file 1 "source/signalGenerator.c"
+	.loc 1 52 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 53 36
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, 1[rax]
+	movabs	rax, -7046029254386353131
+	imul	rdx, rax
+	.loc 1 53 14
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 54 17
+	mov	rax, QWORD PTR -8[rbp]
+	shr	rax, 30
+	.loc 1 54 12
+	xor	rax, QWORD PTR -8[rbp]
+	.loc 1 54 7
+	movabs	rdx, -4658895280553007687
+	imul	rax, rdx
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 55 17
+	mov	rax, QWORD PTR -8[rbp]
+	shr	rax, 27
+	.loc 1 55 12
+	xor	rax, QWORD PTR -8[rbp]
+	.loc 1 55 7
+	movabs	rdx, -7723592293110705685
+	imul	rax, rdx
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 56 19
+	mov	rax, QWORD PTR -8[rbp]
+	shr	rax, 31
+	.loc 1 56 14
+	xor	rax, QWORD PTR -8[rbp]
+	.loc 1 57 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	signalGenerator_Random, .-signalGenerator_Random
+	.type	signalGenerator_StreamKey, @function
+signalGenerator_StreamKey:
+.LFB7:
+	.loc 1 66 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	mov	DWORD PTR -12[rbp], esi
+	.loc 1 67 12
+	mov	edx, DWORD PTR -12[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	signalGenerator_Random
+	.loc 1 68 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	signalGenerator_StreamKey, .-signalGenerator_StreamKey
+	.type	signalGenerator_SinPoly, @function
+signalGenerator_SinPoly:
+.LFB8:
+	.loc 1 74 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 75 18
+	movsd	xmm0, QWORD PTR -24[rbp]
+	mulsd	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 77 18
+	movsd	xmm0, QWORD PTR -24[rbp]
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -8[rbp]
+	.loc 1 79 15
+	movsd	xmm2, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR .LC8[rip]
+	mulsd	xmm0, xmm2
+	.loc 1 78 92
+	movsd	xmm2, QWORD PTR .LC9[rip]
+	subsd	xmm0, xmm2
+	.loc 1 78 66
+	movapd	xmm2, xmm0
+	mulsd	xmm2, QWORD PTR -8[rbp]
+	.loc 1 78 61
+	movsd	xmm0, QWORD PTR .LC10[rip]
+	addsd	xmm0, xmm2
+	.loc 1 78 39
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 78 34
+	movsd	xmm2, QWORD PTR .LC11[rip]
+	subsd	xmm0, xmm2
+	.loc 1 78 15
+	movapd	xmm2, xmm0
+	mulsd	xmm2, QWORD PTR -8[rbp]
+	.loc 1 77 94
+	movsd	xmm0, QWORD PTR .LC12[rip]
+	addsd	xmm0, xmm2
+	.loc 1 77 78
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 77 73
+	movsd	xmm2, QWORD PTR .LC13[rip]
+	subsd	xmm0, xmm2
+	.loc 1 77 58
+	movapd	xmm2, xmm0
+	mulsd	xmm2, QWORD PTR -8[rbp]
+	.loc 1 77 53
+	movsd	xmm0, QWORD PTR .LC14[rip]
+	addsd	xmm0, xmm2
+	.loc 1 77 40
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 77 35
+	movsd	xmm2, QWORD PTR .LC15[rip]
+	subsd	xmm0, xmm2
+	.loc 1 77 23
+	mulsd	xmm0, xmm1
+	.loc 1 77 14
+	addsd	xmm0, QWORD PTR -24[rbp]
+	movq	rax, xmm0
+	.loc 1 80 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	signalGenerator_SinPoly, .-signalGenerator_SinPoly
+	.type	signalGenerator_CosPoly, @function
+signalGenerator_CosPoly:
+.LFB9:
+	.loc 1 86 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 87 18
+	movsd	xmm0, QWORD PTR -24[rbp]
+	mulsd	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 91 15
+	movsd	xmm1, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR .LC16[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 90 86
+	movsd	xmm1, QWORD PTR .LC17[rip]
+	subsd	xmm0, xmm1
+	.loc 1 90 62
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -8[rbp]
+	.loc 1 90 57
+	movsd	xmm0, QWORD PTR .LC18[rip]
+	addsd	xmm0, xmm1
+	.loc 1 90 38
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 90 33
+	movsd	xmm1, QWORD PTR .LC19[rip]
+	subsd	xmm0, xmm1
+	.loc 1 90 15
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -8[rbp]
+	.loc 1 89 89
+	movsd	xmm0, QWORD PTR .LC20[rip]
+	addsd	xmm0, xmm1
+	.loc 1 89 74
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 89 69
+	movsd	xmm1, QWORD PTR .LC21[rip]
+	subsd	xmm0, xmm1
+	.loc 1 89 55
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -8[rbp]
+	.loc 1 89 50
+	movsd	xmm0, QWORD PTR .LC22[rip]
+	addsd	xmm0, xmm1
+	.loc 1 89 38
+	mulsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 89 33
+	movsd	xmm1, QWORD PTR .LC23[rip]
+	subsd	xmm0, xmm1
+	.loc 1 89 21
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -8[rbp]
+	.loc 1 89 16
+	movsd	xmm0, QWORD PTR .LC24[rip]
+	addsd	xmm0, xmm1
+	movq	rax, xmm0
+	.loc 1 92 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	signalGenerator_CosPoly, .-signalGenerator_CosPoly
+	.type	signalGenerator_Log, @function
+signalGenerator_Log:
+.LFB10:
+	.loc 1 102 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	DWORD PTR -36[rbp], edi
+	mov	DWORD PTR -40[rbp], esi
+	mov	DWORD PTR -44[rbp], edx
+	.loc 1 103 22
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, DWORD PTR -36[rbp]
+	.loc 1 103 38
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -40[rbp]
+	.loc 1 103 18
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 104 25
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movsd	xmm1, QWORD PTR .LC24[rip]
+	subsd	xmm0, xmm1
+	.loc 1 104 37
+	movsd	xmm2, QWORD PTR -8[rbp]
+	movsd	xmm1, QWORD PTR .LC24[rip]
+	addsd	xmm1, xmm2
+	.loc 1 104 18
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 105 18
+	movsd	xmm0, QWORD PTR -16[rbp]
+	mulsd	xmm0, xmm0
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 107 21
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -44[rbp]
+	movsd	xmm0, QWORD PTR .LC25[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 107 35
+	movsd	xmm0, QWORD PTR -16[rbp]
+	movapd	xmm2, xmm0
+	addsd	xmm2, xmm0
+	.loc 1 108 32
+	movsd	xmm3, QWORD PTR -24[rbp]
+	movsd	xmm0, QWORD PTR .LC26[rip]
+	mulsd	xmm3, xmm0
+	.loc 1 108 27
+	movsd	xmm0, QWORD PTR .LC27[rip]
+	addsd	xmm0, xmm3
+	.loc 1 108 15
+	movapd	xmm3, xmm0
+	mulsd	xmm3, QWORD PTR -24[rbp]
+	.loc 1 107 110
+	movsd	xmm0, QWORD PTR .LC28[rip]
+	addsd	xmm0, xmm3
+	.loc 1 107 99
+	movapd	xmm3, xmm0
+	mulsd	xmm3, QWORD PTR -24[rbp]
+	.loc 1 107 94
+	movsd	xmm0, QWORD PTR .LC29[rip]
+	addsd	xmm0, xmm3
+	.loc 1 107 83
+	movapd	xmm3, xmm0
+	mulsd	xmm3, QWORD PTR -24[rbp]
+	.loc 1 107 78
+	movsd	xmm0, QWORD PTR .LC30[rip]
+	addsd	xmm0, xmm3
+	.loc 1 107 67
+	movapd	xmm3, xmm0
+	mulsd	xmm3, QWORD PTR -24[rbp]
+	.loc 1 107 62
+	movsd	xmm0, QWORD PTR .LC31[rip]
+	addsd	xmm0, xmm3
+	.loc 1 107 51
+	movapd	xmm3, xmm0
+	mulsd	xmm3, QWORD PTR -24[rbp]
+	.loc 1 107 46
+	movsd	xmm0, QWORD PTR .LC24[rip]
+	addsd	xmm0, xmm3
+	.loc 1 107 39
+	mulsd	xmm0, xmm2
+	.loc 1 107 29
+	addsd	xmm0, xmm1
+	movq	rax, xmm0
+	.loc 1 109 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	signalGenerator_Log, .-signalGenerator_Log
+	.type	signalGenerator_SinCosQuadrant, @function
+signalGenerator_SinCosQuadrant:
+.LFB11:
+	.loc 1 118 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 120
+	mov	DWORD PTR -84[rbp], edi
+	mov	DWORD PTR -88[rbp], esi
+	mov	DWORD PTR -92[rbp], edx
+	movsd	QWORD PTR -104[rbp], xmm0
+	mov	QWORD PTR -112[rbp], rcx
+	mov	QWORD PTR -120[rbp], r8
+	.loc 1 119 34
+	mov	eax, DWORD PTR -88[rbp]
+	add	eax, eax
+	.loc 1 119 46
+	cmp	DWORD PTR -92[rbp], eax
+	setb	al
+	.loc 1 119 24
+	movzx	eax, al
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 121 60
+	mov	eax, DWORD PTR -88[rbp]
+	lea	edx, [rax+rax]
+	.loc 1 121 56
+	mov	eax, DWORD PTR -92[rbp]
+	sub	eax, edx
+	.loc 1 121 45
+	imul	eax, DWORD PTR -4[rbp]
+	mov	edx, eax
+	.loc 1 121 38
+	mov	eax, DWORD PTR -88[rbp]
+	add	eax, edx
+	.loc 1 121 74
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, eax
+	.loc 1 121 18
+	movsd	xmm1, QWORD PTR -104[rbp]
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 122 22
+	mov	rax, QWORD PTR -16[rbp]
+	movq	xmm0, rax
+	call	signalGenerator_SinPoly
+	movq	rax, xmm0
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 123 22
+	mov	rax, QWORD PTR -16[rbp]
+	movq	xmm0, rax
+	call	signalGenerator_CosPoly
+	movq	rax, xmm0
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 127 49
+	mov	eax, DWORD PTR -84[rbp]
+	and	eax, 1
+	.loc 1 127 54
+	xor	eax, DWORD PTR -4[rbp]
+	.loc 1 127 18
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, eax
+	movsd	QWORD PTR -40[rbp], xmm0
+	.loc 1 128 57
+	mov	eax, DWORD PTR -84[rbp]
+	shr	eax
+	.loc 1 128 41
+	and	eax, 1
+	.loc 1 128 18
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, eax
+	movsd	QWORD PTR -48[rbp], xmm0
+	.loc 1 129 60
+	mov	eax, DWORD PTR -84[rbp]
+	add	eax, 1
+	.loc 1 129 65
+	shr	eax
+	.loc 1 129 43
+	and	eax, 1
+	.loc 1 129 18
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, eax
+	movsd	QWORD PTR -56[rbp], xmm0
+	.loc 1 130 39
+	movsd	xmm0, QWORD PTR .LC24[rip]
+	subsd	xmm0, QWORD PTR -40[rbp]
+	.loc 1 130 32
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -24[rbp]
+	.loc 1 130 51
+	movsd	xmm0, QWORD PTR -32[rbp]
+	mulsd	xmm0, QWORD PTR -40[rbp]
+	.loc 1 130 18
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 131 41
+	movsd	xmm0, QWORD PTR .LC24[rip]
+	subsd	xmm0, QWORD PTR -40[rbp]
+	.loc 1 131 34
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -32[rbp]
+	.loc 1 131 53
+	movsd	xmm0, QWORD PTR -24[rbp]
+	mulsd	xmm0, QWORD PTR -40[rbp]
+	.loc 1 131 18
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -72[rbp], xmm0
+	.loc 1 133 30
+	movsd	xmm0, QWORD PTR .LC24[rip]
+	subsd	xmm0, QWORD PTR -48[rbp]
+	.loc 1 133 23
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -64[rbp]
+	.loc 1 133 53
+	pxor	xmm0, xmm0
+	subsd	xmm0, QWORD PTR -64[rbp]
+	.loc 1 133 66
+	mulsd	xmm0, QWORD PTR -48[rbp]
+	.loc 1 133 46
+	addsd	xmm0, xmm1
+	.loc 1 133 11
+	mov	rax, QWORD PTR -112[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 134 34
+	movsd	xmm0, QWORD PTR .LC24[rip]
+	subsd	xmm0, QWORD PTR -56[rbp]
+	.loc 1 134 27
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -72[rbp]
+	.loc 1 134 59
+	pxor	xmm0, xmm0
+	subsd	xmm0, QWORD PTR -72[rbp]
+	.loc 1 134 74
+	mulsd	xmm0, QWORD PTR -56[rbp]
+	.loc 1 134 52
+	addsd	xmm0, xmm1
+	.loc 1 134 13
+	mov	rax, QWORD PTR -120[rbp]
+	movsd	QWORD PTR [rax], xmm0
+	.loc 1 135 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	signalGenerator_SinCosQuadrant, .-signalGenerator_SinCosQuadrant
+	.type	signalGenerator_GaussianPairs, @function
+signalGenerator_GaussianPairs:
+.LFB12:
+	.loc 1 148 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 6240
+	mov	QWORD PTR -6216[rbp], rdi
+	mov	QWORD PTR -6224[rbp], rsi
+	mov	DWORD PTR -6228[rbp], edx
+	mov	QWORD PTR -6240[rbp], rcx
+	.loc 1 149 18
+	movsd	xmm0, QWORD PTR .LC33[rip]
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBB2:
+	.loc 1 156 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 156 5
+	jmp	.L13
+.L14:
+.LBB3:
+	.loc 1 158 31 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -6224[rbp]
+	add	rdx, rax
+	mov	rax, QWORD PTR -6216[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	signalGenerator_Random
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 159 42 discriminator 3
+	mov	rax, QWORD PTR -32[rbp]
+	shr	rax, 40
+	.loc 1 159 23 discriminator 3
+	add	eax, 1
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 160 26 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	bsr	eax, eax
+	xor	eax, 31
+	mov	edx, eax
+	.loc 1 160 17 discriminator 3
+	mov	eax, 31
+	sub	eax, edx
+	mov	DWORD PTR -40[rbp], eax
+	.loc 1 163 15 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	.loc 1 163 29 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	.loc 1 163 27 discriminator 3
+	imul	rdx, rax
+	.loc 1 163 56 discriminator 3
+	mov	eax, DWORD PTR -40[rbp]
+	add	eax, eax
+	.loc 1 163 50 discriminator 3
+	mov	esi, 2
+	mov	ecx, eax
+	sal	rsi, cl
+	mov	rax, rsi
+	.loc 1 163 41 discriminator 3
+	cmp	rdx, rax
+	setnb	al
+	movzx	eax, al
+	.loc 1 163 11 discriminator 3
+	add	DWORD PTR -40[rbp], eax
+	.loc 1 164 22 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	mov	edx, DWORD PTR -36[rbp]
+	mov	DWORD PTR -1072[rbp+rax*4], edx
+	.loc 1 165 22 discriminator 3
+	mov	eax, DWORD PTR -40[rbp]
+	mov	edx, 1
+	mov	ecx, eax
+	sal	edx, cl
+	.loc 1 165 18 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	mov	DWORD PTR -2096[rbp+rax*4], edx
+	.loc 1 166 21 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	mov	edx, DWORD PTR -40[rbp]
+	mov	DWORD PTR -3120[rbp+rax*4], edx
+	.loc 1 167 35 discriminator 3
+	mov	rax, QWORD PTR -32[rbp]
+	.loc 1 167 20 discriminator 3
+	and	eax, 16777215
+	mov	edx, eax
+	.loc 1 167 18 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	mov	DWORD PTR -4144[rbp+rax*4], edx
+.LBE3:
+	.loc 1 156 38 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L13:
+	.loc 1 156 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -6228[rbp]
+	jl	.L14
+.LBE2:
+.LBB4:
+	.loc 1 169 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 169 5
+	jmp	.L15
+.L16:
+	.loc 1 172 41 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	mov	edx, DWORD PTR -3120[rbp+rax*4]
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	mov	ecx, DWORD PTR -2096[rbp+rax*4]
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	mov	eax, DWORD PTR -1072[rbp+rax*4]
+	mov	esi, ecx
+	mov	edi, eax
+	call	signalGenerator_Log
+	movapd	xmm1, xmm0
+	.loc 1 172 39 discriminator 3
+	movsd	xmm0, QWORD PTR .LC34[rip]
+	subsd	xmm0, xmm1
+	.loc 1 172 25 discriminator 3
+	addsd	xmm0, xmm0
+	.loc 1 172 19 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	movsd	QWORD PTR -6192[rbp+rax*8], xmm0
+	.loc 1 169 38 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L15:
+	.loc 1 169 23 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -6228[rbp]
+	jl	.L16
+.LBE4:
+.LBB5:
+	.loc 1 175 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 175 5
+	jmp	.L17
+.L18:
+	.loc 1 177 21 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	mov	rax, QWORD PTR -6192[rbp+rax*8]
+	movq	xmm0, rax
+	call	sqrt@PLT
+	movq	rax, xmm0
+	.loc 1 177 19 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	mov	QWORD PTR -6192[rbp+rdx*8], rax
+	.loc 1 175 38 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L17:
+	.loc 1 175 23 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -6228[rbp]
+	jl	.L18
+.LBE5:
+.LBB6:
+	.loc 1 179 14
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 179 5
+	jmp	.L19
+.L20:
+.LBB7:
+	.loc 1 184 89 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	mov	eax, DWORD PTR -4144[rbp+rax*4]
+	.loc 1 184 9 discriminator 3
+	and	eax, 4194303
+	mov	esi, eax
+	.loc 1 184 59 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	mov	eax, DWORD PTR -4144[rbp+rax*4]
+	.loc 1 184 9 discriminator 3
+	shr	eax, 22
+	mov	edi, eax
+	lea	rcx, -6208[rbp]
+	lea	rdx, -6200[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	r8, rcx
+	mov	rcx, rdx
+	movq	xmm0, rax
+	mov	edx, 4194304
+	call	signalGenerator_SinCosQuadrant
+	.loc 1 186 39 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	movsd	xmm1, QWORD PTR -6192[rbp+rax*8]
+	.loc 1 186 43 discriminator 3
+	movsd	xmm0, QWORD PTR -6208[rbp]
+	mulsd	xmm0, xmm1
+	.loc 1 186 18 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 186 15 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -6240[rbp]
+	add	rax, rdx
+	.loc 1 186 25 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 186 23 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 187 43 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	movsd	xmm1, QWORD PTR -6192[rbp+rax*8]
+	.loc 1 187 47 discriminator 3
+	movsd	xmm0, QWORD PTR -6200[rbp]
+	mulsd	xmm0, xmm1
+	.loc 1 187 18 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	add	eax, eax
+	.loc 1 187 15 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -6240[rbp]
+	add	rax, rdx
+	.loc 1 187 29 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 187 27 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+.LBE7:
+	.loc 1 179 38 discriminator 3
+	add	DWORD PTR -16[rbp], 1
+.L19:
+	.loc 1 179 23 discriminator 1
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -6228[rbp]
+	jl	.L20
+.LBE6:
+	.loc 1 189 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	signalGenerator_GaussianPairs, .-signalGenerator_GaussianPairs
+	.type	signalGenerator_Gaussian, @function
+signalGenerator_Gaussian:
+.LFB13:
+	.loc 1 200 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 2128
+	mov	QWORD PTR -2104[rbp], rdi
+	mov	QWORD PTR -2112[rbp], rsi
+	mov	QWORD PTR -2120[rbp], rdx
+	mov	QWORD PTR -2128[rbp], rcx
+	.loc 1 202 12
+	mov	rax, QWORD PTR -2112[rbp]
+	and	eax, 1
+	mov	QWORD PTR -8[rbp], rax
+.LBB8:
+	.loc 1 204 19
+	mov	rax, QWORD PTR -2112[rbp]
+	shr	rax
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 204 5
+	jmp	.L22
+.L25:
+.LBB9:
+	.loc 1 207 37
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -2120[rbp]
+	add	rax, rdx
+	.loc 1 207 45
+	add	rax, 1
+	.loc 1 207 22
+	shr	rax
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 208 80
+	cmp	QWORD PTR -24[rbp], 255
+	ja	.L23
+	.loc 1 208 80 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	jmp	.L24
+.L23:
+	.loc 1 208 80 discriminator 2
+	mov	eax, 256
+.L24:
+	.loc 1 208 19 is_stmt 1 discriminator 4
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 209 38 discriminator 4
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	.loc 1 209 36 discriminator 4
+	add	rax, rax
+	.loc 1 209 22 discriminator 4
+	sub	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 210 22 discriminator 4
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -2120[rbp]
+	cmp	rdx, rax
+	cmovbe	rax, rdx
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 212 9 discriminator 4
+	lea	rcx, -2096[rbp]
+	mov	edx, DWORD PTR -28[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -2104[rbp]
+	mov	rdi, rax
+	call	signalGenerator_GaussianPairs
+	.loc 1 213 9 discriminator 4
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 213 24 discriminator 4
+	lea	rax, -2096[rbp]
+	mov	rcx, QWORD PTR -8[rbp]
+	sal	rcx, 2
+	add	rcx, rax
+	.loc 1 213 9 discriminator 4
+	mov	rax, QWORD PTR -2128[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 214 16 discriminator 4
+	mov	rax, QWORD PTR -48[rbp]
+	sal	rax, 2
+	add	QWORD PTR -2128[rbp], rax
+	.loc 1 215 15 discriminator 4
+	mov	rax, QWORD PTR -48[rbp]
+	sub	QWORD PTR -2120[rbp], rax
+	.loc 1 216 14 discriminator 4
+	mov	QWORD PTR -8[rbp], 0
+.LBE9:
+	.loc 1 204 54 discriminator 4
+	add	QWORD PTR -16[rbp], 256
+.L22:
+	.loc 1 204 44 discriminator 2
+	cmp	QWORD PTR -2120[rbp], 0
+	jne	.L25
+.LBE8:
+	.loc 1 218 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	signalGenerator_Gaussian, .-signalGenerator_Gaussian
+	.type	signalGenerator_SineRange, @function
+signalGenerator_SineRange:
+.LFB14:
+	.loc 1 229 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 104
+	mov	QWORD PTR -88[rbp], rdi
+	mov	DWORD PTR -92[rbp], esi
+	mov	DWORD PTR -96[rbp], edx
+	mov	DWORD PTR -100[rbp], ecx
+	movss	DWORD PTR -104[rbp], xmm0
+	.loc 1 230 42
+	mov	eax, DWORD PTR -100[rbp]
+	test	rax, rax
+	js	.L27
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L28
+.L27:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L28:
+	.loc 1 230 18
+	movsd	xmm1, QWORD PTR .LC35[rip]
+	divsd	xmm1, xmm0
+	movsd	QWORD PTR -24[rbp], xmm1
+.LBB10:
+	.loc 1 232 23
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 232 5
+	jmp	.L29
+.L48:
+.LBB11:
+	.loc 1 234 28
+	mov	eax, DWORD PTR -4[rbp]
+	shr	eax
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 235 33
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 235 19
+	and	eax, 1
+	mov	DWORD PTR -32[rbp], eax
+	.loc 1 237 91
+	cmp	DWORD PTR -32[rbp], 0
+	je	.L30
+	.loc 1 237 53 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, eax
+	.loc 1 237 64 discriminator 1
+	add	eax, 1
+	.loc 1 237 69 discriminator 1
+	imul	eax, DWORD PTR -100[rbp]
+	.loc 1 237 83 discriminator 1
+	shr	eax, 3
+	.loc 1 237 91 discriminator 1
+	add	eax, 1
+	jmp	.L31
+.L30:
+	.loc 1 237 103 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	imul	eax, DWORD PTR -100[rbp]
+	.loc 1 237 116 discriminator 2
+	add	eax, 3
+	.loc 1 237 91 discriminator 2
+	shr	eax, 2
+.L31:
+	.loc 1 237 28 discriminator 4
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 238 85 discriminator 4
+	cmp	DWORD PTR -32[rbp], 0
+	je	.L32
+	.loc 1 238 58 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, 1
+	.loc 1 238 63 discriminator 1
+	imul	eax, DWORD PTR -100[rbp]
+	.loc 1 238 76 discriminator 1
+	add	eax, 3
+	.loc 1 238 85 discriminator 1
+	shr	eax, 2
+	jmp	.L33
+.L32:
+	.loc 1 238 91 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, eax
+	.loc 1 238 102 discriminator 2
+	add	eax, 1
+	.loc 1 238 107 discriminator 2
+	imul	eax, DWORD PTR -100[rbp]
+	.loc 1 238 121 discriminator 2
+	shr	eax, 3
+	.loc 1 238 85 discriminator 2
+	add	eax, 1
+.L33:
+	.loc 1 238 28 discriminator 4
+	mov	DWORD PTR -40[rbp], eax
+	.loc 1 239 28 discriminator 4
+	mov	edx, DWORD PTR -36[rbp]
+	mov	eax, DWORD PTR -92[rbp]
+	cmp	edx, eax
+	cmovnb	eax, edx
+	mov	DWORD PTR -44[rbp], eax
+	.loc 1 240 28 discriminator 4
+	mov	edx, DWORD PTR -40[rbp]
+	mov	eax, DWORD PTR -96[rbp]
+	cmp	edx, eax
+	cmovbe	eax, edx
+	mov	DWORD PTR -48[rbp], eax
+	.loc 1 241 58 discriminator 4
+	mov	eax, DWORD PTR -48[rbp]
+	cmp	DWORD PTR -44[rbp], eax
+	jnb	.L34
+	.loc 1 241 50 discriminator 1
+	mov	eax, DWORD PTR -48[rbp]
+	sub	eax, DWORD PTR -44[rbp]
+	jmp	.L35
+.L34:
+	.loc 1 241 58 discriminator 2
+	mov	eax, 0
+.L35:
+	.loc 1 241 19 discriminator 4
+	mov	DWORD PTR -52[rbp], eax
+	.loc 1 243 80 discriminator 4
+	cmp	DWORD PTR -32[rbp], 0
+	je	.L36
+	.loc 1 243 50 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	add	eax, 1
+	.loc 1 243 55 discriminator 1
+	imul	eax, DWORD PTR -100[rbp]
+	mov	edx, eax
+	.loc 1 243 72 discriminator 1
+	mov	eax, DWORD PTR -44[rbp]
+	sal	eax, 2
+	.loc 1 243 68 discriminator 1
+	sub	edx, eax
+	.loc 1 243 80 discriminator 1
+	mov	eax, edx
+	jmp	.L37
+.L36:
+	.loc 1 243 90 discriminator 2
+	mov	eax, DWORD PTR -44[rbp]
+	lea	edx, 0[0+rax*4]
+	.loc 1 243 108 discriminator 2
+	mov	eax, DWORD PTR -28[rbp]
+	imul	eax, DWORD PTR -100[rbp]
+	.loc 1 243 97 discriminator 2
+	sub	edx, eax
+	.loc 1 243 80 discriminator 2
+	mov	eax, edx
+.L37:
+	.loc 1 243 19 discriminator 4
+	mov	DWORD PTR -56[rbp], eax
+	.loc 1 244 36 discriminator 4
+	cmp	DWORD PTR -32[rbp], 0
+	je	.L38
+	.loc 1 244 36 is_stmt 0 discriminator 1
+	mov	eax, -4
+	jmp	.L39
+.L38:
+	.loc 1 244 36 discriminator 2
+	mov	eax, 4
+.L39:
+	.loc 1 244 19 is_stmt 1 discriminator 4
+	mov	DWORD PTR -60[rbp], eax
+	.loc 1 246 77 discriminator 4
+	cmp	DWORD PTR -28[rbp], 1
+	jbe	.L40
+	.loc 1 246 59 discriminator 1
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -104[rbp]
+	.loc 1 246 77 discriminator 1
+	movq	xmm1, QWORD PTR .LC36[rip]
+	xorpd	xmm0, xmm1
+	jmp	.L41
+.L40:
+	.loc 1 246 77 is_stmt 0 discriminator 2
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -104[rbp]
+.L41:
+	.loc 1 246 22 is_stmt 1 discriminator 4
+	movsd	QWORD PTR -72[rbp], xmm0
+	.loc 1 247 38 discriminator 4
+	mov	eax, DWORD PTR -44[rbp]
+	sub	eax, DWORD PTR -92[rbp]
+	mov	eax, eax
+	.loc 1 247 32 discriminator 4
+	lea	rdx, 0[0+rax*4]
+	.loc 1 247 16 discriminator 4
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -80[rbp], rax
+	.loc 1 249 23 discriminator 4
+	mov	eax, DWORD PTR -28[rbp]
+	and	eax, 1
+	mov	edx, eax
+	.loc 1 249 13 discriminator 4
+	mov	eax, DWORD PTR -32[rbp]
+	.loc 1 249 12 discriminator 4
+	cmp	edx, eax
+	je	.L42
+.LBB12:
+	.loc 1 251 22
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 251 13
+	jmp	.L43
+.L44:
+	.loc 1 253 96 discriminator 3
+	mov	eax, DWORD PTR -60[rbp]
+	imul	eax, DWORD PTR -8[rbp]
+	mov	edx, eax
+	.loc 1 253 89 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	add	eax, edx
+	.loc 1 253 58 discriminator 3
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, eax
+	mulsd	xmm0, QWORD PTR -24[rbp]
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	signalGenerator_CosPoly
+	movq	rax, xmm0
+	.loc 1 253 56 discriminator 3
+	movq	xmm1, rax
+	mulsd	xmm1, QWORD PTR -72[rbp]
+	.loc 1 253 119 discriminator 3
+	pxor	xmm0, xmm0
+	addsd	xmm0, xmm1
+	.loc 1 253 26 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 253 32 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 253 30 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 251 41 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L43:
+	.loc 1 251 31 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	jl	.L44
+	jmp	.L45
+.L42:
+.LBE12:
+.LBB13:
+	.loc 1 258 22
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 258 13
+	jmp	.L46
+.L47:
+	.loc 1 260 96 discriminator 3
+	mov	eax, DWORD PTR -60[rbp]
+	imul	eax, DWORD PTR -12[rbp]
+	mov	edx, eax
+	.loc 1 260 89 discriminator 3
+	mov	eax, DWORD PTR -56[rbp]
+	add	eax, edx
+	.loc 1 260 58 discriminator 3
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, eax
+	mulsd	xmm0, QWORD PTR -24[rbp]
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	signalGenerator_SinPoly
+	movq	rax, xmm0
+	.loc 1 260 56 discriminator 3
+	movq	xmm1, rax
+	mulsd	xmm1, QWORD PTR -72[rbp]
+	.loc 1 260 119 discriminator 3
+	pxor	xmm0, xmm0
+	addsd	xmm0, xmm1
+	.loc 1 260 26 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -80[rbp]
+	add	rax, rdx
+	.loc 1 260 32 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 260 30 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 258 41 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L46:
+	.loc 1 258 31 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -52[rbp]
+	jl	.L47
+.L45:
+.LBE13:
+.LBE11:
+	.loc 1 232 53 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L29:
+	.loc 1 232 42 discriminator 1
+	cmp	DWORD PTR -4[rbp], 7
+	jbe	.L48
+.LBE10:
+	.loc 1 264 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	signalGenerator_SineRange, .-signalGenerator_SineRange
+	.type	signalGenerator_Sine, @function
+signalGenerator_Sine:
+.LFB15:
+	.loc 1 272 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	mov	DWORD PTR -60[rbp], ecx
+	movss	DWORD PTR -64[rbp], xmm0
+	.loc 1 273 70
+	mov	eax, DWORD PTR -60[rbp]
+	.loc 1 273 18
+	mov	rdx, QWORD PTR -56[rbp]
+	cmp	rdx, rax
+	cmovbe	rax, rdx
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 274 56
+	mov	ecx, DWORD PTR -60[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	edx, 0
+	div	rcx
+	mov	rax, rdx
+	.loc 1 274 24
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 276 52
+	mov	eax, DWORD PTR -60[rbp]
+	sub	eax, DWORD PTR -20[rbp]
+	mov	eax, eax
+	.loc 1 276 87
+	cmp	QWORD PTR -16[rbp], rax
+	jnb	.L50
+	.loc 1 276 87 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	jmp	.L51
+.L50:
+	.loc 1 276 87 discriminator 2
+	mov	eax, DWORD PTR -60[rbp]
+	sub	eax, DWORD PTR -20[rbp]
+.L51:
+	.loc 1 276 24 is_stmt 1 discriminator 4
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 278 5 discriminator 4
+	mov	edx, DWORD PTR -20[rbp]
+	mov	eax, DWORD PTR -24[rbp]
+	lea	edi, [rdx+rax]
+	mov	ecx, DWORD PTR -64[rbp]
+	mov	edx, DWORD PTR -60[rbp]
+	mov	esi, DWORD PTR -20[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	movd	xmm0, ecx
+	mov	ecx, edx
+	mov	edx, edi
+	mov	rdi, rax
+	call	signalGenerator_SineRange
+	.loc 1 279 50 discriminator 4
+	mov	rax, QWORD PTR -16[rbp]
+	.loc 1 279 5 discriminator 4
+	sub	eax, DWORD PTR -24[rbp]
+	.loc 1 279 39 discriminator 4
+	mov	edx, DWORD PTR -24[rbp]
+	lea	rcx, 0[0+rdx*4]
+	.loc 1 279 5 discriminator 4
+	mov	rdx, QWORD PTR -40[rbp]
+	lea	rdi, [rcx+rdx]
+	mov	ecx, DWORD PTR -64[rbp]
+	mov	edx, DWORD PTR -60[rbp]
+	movd	xmm0, ecx
+	mov	ecx, edx
+	mov	edx, eax
+	mov	esi, 0
+	call	signalGenerator_SineRange
+.LBB14:
+	.loc 1 280 17 discriminator 4
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 280 5 discriminator 4
+	jmp	.L52
+.L53:
+.LBB15:
+	.loc 1 282 44 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	.loc 1 282 22 discriminator 3
+	mov	rdx, QWORD PTR -16[rbp]
+	cmp	rdx, rax
+	cmovbe	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 283 9 discriminator 3
+	mov	rax, QWORD PTR -32[rbp]
+	lea	rdx, 0[0+rax*4]
+	.loc 1 283 24 discriminator 3
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rcx, 0[0+rax*4]
+	.loc 1 283 16 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	add	rcx, rax
+	.loc 1 283 9 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	memcpy@PLT
+.LBE15:
+	.loc 1 280 49 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	add	QWORD PTR -8[rbp], rax
+.L52:
+	.loc 1 280 31 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -56[rbp]
+	jb	.L53
+.LBE14:
+	.loc 1 285 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	signalGenerator_Sine, .-signalGenerator_Sine
+	.type	signalGenerator_ChirpInterval, @function
+signalGenerator_ChirpInterval:
+.LFB16:
+	.loc 1 294 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 640
+	mov	QWORD PTR -616[rbp], rdi
+	mov	QWORD PTR -624[rbp], rsi
+	mov	QWORD PTR -632[rbp], rdx
+	.loc 1 295 35
+	mov	rax, QWORD PTR -632[rbp]
+	mov	rdi, rax
+	call	signalGenerator_NumOfSamples
+	.loc 1 295 18
+	test	rax, rax
+	js	.L55
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L56
+.L55:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L56:
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 296 49
+	mov	rax, QWORD PTR -632[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	.loc 1 296 39
+	mov	eax, eax
+	test	rax, rax
+	js	.L57
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L58
+.L57:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L58:
+	.loc 1 296 18
+	movsd	xmm1, QWORD PTR .LC24[rip]
+	divsd	xmm1, xmm0
+	movsd	QWORD PTR -32[rbp], xmm1
+	.loc 1 297 41
+	mov	rax, QWORD PTR -632[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 297 31
+	mov	eax, eax
+	test	rax, rax
+	js	.L59
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L60
+.L59:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L60:
+	movsd	xmm1, QWORD PTR .LC24[rip]
+	divsd	xmm1, xmm0
+	.loc 1 297 57
+	subsd	xmm1, QWORD PTR -32[rbp]
+	movapd	xmm0, xmm1
+	.loc 1 297 18
+	divsd	xmm0, QWORD PTR -24[rbp]
+	movsd	QWORD PTR -40[rbp], xmm0
+	.loc 1 298 46
+	movsd	xmm1, QWORD PTR -40[rbp]
+	movsd	xmm0, QWORD PTR .LC37[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 298 54
+	movsd	xmm0, QWORD PTR .LC38[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 298 35
+	movsd	xmm0, QWORD PTR .LC38[rip]
+	mulsd	xmm1, xmm0
+	movq	rax, xmm1
+	movq	xmm0, rax
+	call	cos@PLT
+	movq	rax, xmm0
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 299 46
+	movsd	xmm1, QWORD PTR -40[rbp]
+	movsd	xmm0, QWORD PTR .LC37[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 299 54
+	movsd	xmm0, QWORD PTR .LC38[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 299 35
+	movsd	xmm0, QWORD PTR .LC38[rip]
+	mulsd	xmm1, xmm0
+	movq	rax, xmm1
+	movq	xmm0, rax
+	call	sin@PLT
+	movq	rax, xmm0
+	mov	QWORD PTR -56[rbp], rax
+.LBB16:
+	.loc 1 305 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 305 5
+	jmp	.L61
+.L64:
+.LBB17:
+	.loc 1 307 41 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -624[rbp]
+	add	rax, rdx
+	.loc 1 307 22 discriminator 3
+	test	rax, rax
+	js	.L62
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rax
+	jmp	.L63
+.L62:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, rdx
+	addsd	xmm0, xmm0
+.L63:
+	movsd	QWORD PTR -80[rbp], xmm0
+	.loc 1 308 51 discriminator 3
+	movsd	xmm1, QWORD PTR -40[rbp]
+	movsd	xmm0, QWORD PTR .LC23[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 308 59 discriminator 3
+	mulsd	xmm0, QWORD PTR -80[rbp]
+	.loc 1 308 45 discriminator 3
+	addsd	xmm0, QWORD PTR -32[rbp]
+	.loc 1 308 16 discriminator 3
+	movsd	xmm1, QWORD PTR -80[rbp]
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -88[rbp], xmm0
+	.loc 1 310 76 discriminator 3
+	movsd	xmm1, QWORD PTR -80[rbp]
+	movsd	xmm0, QWORD PTR .LC39[rip]
+	addsd	xmm0, xmm1
+	.loc 1 310 71 discriminator 3
+	mulsd	xmm0, QWORD PTR -40[rbp]
+	.loc 1 310 63 discriminator 3
+	movapd	xmm1, xmm0
+	addsd	xmm1, QWORD PTR -32[rbp]
+	.loc 1 310 16 discriminator 3
+	movsd	xmm0, QWORD PTR .LC38[rip]
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -96[rbp], xmm0
+	.loc 1 312 19 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	movq	xmm0, rax
+	call	floor@PLT
+	movapd	xmm1, xmm0
+	.loc 1 312 16 discriminator 3
+	movsd	xmm0, QWORD PTR -88[rbp]
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR -88[rbp], xmm0
+	.loc 1 313 22 discriminator 3
+	mov	rax, QWORD PTR -96[rbp]
+	movq	xmm0, rax
+	call	floor@PLT
+	movapd	xmm1, xmm0
+	.loc 1 313 19 discriminator 3
+	movsd	xmm0, QWORD PTR -96[rbp]
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR -96[rbp], xmm0
+	.loc 1 314 17 discriminator 3
+	movsd	xmm1, QWORD PTR -88[rbp]
+	movsd	xmm0, QWORD PTR .LC37[rip]
+	mulsd	xmm1, xmm0
+	movq	rax, xmm1
+	movq	xmm0, rax
+	call	cos@PLT
+	movq	rax, xmm0
+	.loc 1 314 15 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	mov	QWORD PTR -224[rbp+rdx*8], rax
+	.loc 1 315 17 discriminator 3
+	movsd	xmm1, QWORD PTR -88[rbp]
+	movsd	xmm0, QWORD PTR .LC37[rip]
+	mulsd	xmm1, xmm0
+	movq	rax, xmm1
+	movq	xmm0, rax
+	call	sin@PLT
+	movq	rax, xmm0
+	.loc 1 315 15 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	mov	QWORD PTR -352[rbp+rdx*8], rax
+	.loc 1 316 25 discriminator 3
+	movsd	xmm1, QWORD PTR -96[rbp]
+	movsd	xmm0, QWORD PTR .LC37[rip]
+	mulsd	xmm1, xmm0
+	movq	rax, xmm1
+	movq	xmm0, rax
+	call	cos@PLT
+	movq	rax, xmm0
+	.loc 1 316 23 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	mov	QWORD PTR -480[rbp+rdx*8], rax
+	.loc 1 317 25 discriminator 3
+	movsd	xmm1, QWORD PTR -96[rbp]
+	movsd	xmm0, QWORD PTR .LC37[rip]
+	mulsd	xmm1, xmm0
+	movq	rax, xmm1
+	movq	xmm0, rax
+	call	sin@PLT
+	movq	rax, xmm0
+	.loc 1 317 23 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	mov	QWORD PTR -608[rbp+rdx*8], rax
+.LBE17:
+	.loc 1 305 44 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L61:
+	.loc 1 305 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], 15
+	jle	.L64
+.LBE16:
+.LBB18:
+	.loc 1 319 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 319 5
+	jmp	.L65
+.L68:
+.LBB19:
+	.loc 1 321 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 321 9
+	jmp	.L66
+.L67:
+.LBB20:
+	.loc 1 323 42 discriminator 3
+	mov	rax, QWORD PTR -632[rbp]
+	movss	xmm0, DWORD PTR 16[rax]
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 323 58 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -352[rbp+rax*8]
+	.loc 1 323 54 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 323 19 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 323 16 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -616[rbp]
+	add	rax, rdx
+	.loc 1 323 26 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 323 24 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 324 37 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm1, QWORD PTR -224[rbp+rax*8]
+	.loc 1 324 53 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -480[rbp+rax*8]
+	.loc 1 324 41 discriminator 3
+	mulsd	xmm0, xmm1
+	.loc 1 324 61 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm2, QWORD PTR -352[rbp+rax*8]
+	.loc 1 324 77 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm1, QWORD PTR -608[rbp+rax*8]
+	.loc 1 324 65 discriminator 3
+	mulsd	xmm1, xmm2
+	.loc 1 324 26 discriminator 3
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 325 23 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm1, QWORD PTR -352[rbp+rax*8]
+	.loc 1 325 39 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -480[rbp+rax*8]
+	.loc 1 325 27 discriminator 3
+	mulsd	xmm1, xmm0
+	.loc 1 325 47 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm2, QWORD PTR -224[rbp+rax*8]
+	.loc 1 325 63 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -608[rbp+rax*8]
+	.loc 1 325 51 discriminator 3
+	mulsd	xmm0, xmm2
+	.loc 1 325 43 discriminator 3
+	addsd	xmm0, xmm1
+	.loc 1 325 19 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	QWORD PTR -352[rbp+rax*8], xmm0
+	.loc 1 326 19 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -64[rbp]
+	movsd	QWORD PTR -224[rbp+rax*8], xmm0
+	.loc 1 327 53 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -480[rbp+rax*8]
+	.loc 1 327 57 discriminator 3
+	mulsd	xmm0, QWORD PTR -48[rbp]
+	.loc 1 327 86 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm1, QWORD PTR -608[rbp+rax*8]
+	.loc 1 327 90 discriminator 3
+	mulsd	xmm1, QWORD PTR -56[rbp]
+	.loc 1 327 26 discriminator 3
+	subsd	xmm0, xmm1
+	movsd	QWORD PTR -72[rbp], xmm0
+	.loc 1 328 39 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -608[rbp+rax*8]
+	.loc 1 328 43 discriminator 3
+	movapd	xmm1, xmm0
+	mulsd	xmm1, QWORD PTR -48[rbp]
+	.loc 1 328 72 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -480[rbp+rax*8]
+	.loc 1 328 76 discriminator 3
+	mulsd	xmm0, QWORD PTR -56[rbp]
+	.loc 1 328 60 discriminator 3
+	addsd	xmm0, xmm1
+	.loc 1 328 27 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	QWORD PTR -608[rbp+rax*8], xmm0
+	.loc 1 329 27 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	movsd	xmm0, QWORD PTR -72[rbp]
+	movsd	QWORD PTR -480[rbp+rax*8], xmm0
+.LBE20:
+	.loc 1 321 48 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L66:
+	.loc 1 321 27 discriminator 1
+	cmp	DWORD PTR -12[rbp], 15
+	jle	.L67
+.LBE19:
+	.loc 1 319 55 discriminator 2
+	add	DWORD PTR -8[rbp], 16
+.L65:
+	.loc 1 319 23 discriminator 1
+	cmp	DWORD PTR -8[rbp], 4095
+	jle	.L68
+.LBE18:
+	.loc 1 332 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	signalGenerator_ChirpInterval, .-signalGenerator_ChirpInterval
+	.type	signalGenerator_Chirp, @function
+signalGenerator_Chirp:
+.LFB17:
+	.loc 1 341 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16464
+	mov	QWORD PTR -16440[rbp], rdi
+	mov	QWORD PTR -16448[rbp], rsi
+	mov	QWORD PTR -16456[rbp], rdx
+	mov	QWORD PTR -16464[rbp], rcx
+	.loc 1 343 20
+	mov	rdx, QWORD PTR -16456[rbp]
+	mov	rax, QWORD PTR -16464[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 344 14
+	mov	rax, QWORD PTR -16456[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 346 11
+	jmp	.L70
+.L76:
+.LBB21:
+	.loc 1 348 24
+	mov	rax, QWORD PTR -8[rbp]
+	and	rax, -4096
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 349 53
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 4096
+	.loc 1 349 24
+	mov	rdx, QWORD PTR -16[rbp]
+	cmp	rdx, rax
+	cmovbe	rax, rdx
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 351 55
+	mov	rax, QWORD PTR -24[rbp]
+	cmp	rax, QWORD PTR -8[rbp]
+	jne	.L71
+	.loc 1 351 71 discriminator 1
+	mov	rax, QWORD PTR -32[rbp]
+	sub	rax, QWORD PTR -24[rbp]
+	.loc 1 351 55 discriminator 1
+	cmp	rax, 4096
+	jne	.L71
+	.loc 1 351 55 is_stmt 0 discriminator 3
+	mov	eax, 1
+	jmp	.L72
+.L71:
+	.loc 1 351 55 discriminator 4
+	mov	eax, 0
+.L72:
+	.loc 1 351 19 is_stmt 1 discriminator 6
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 352 57 discriminator 6
+	cmp	DWORD PTR -36[rbp], 0
+	je	.L73
+	.loc 1 352 48 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	sub	rax, QWORD PTR -16456[rbp]
+	.loc 1 352 38 discriminator 1
+	lea	rdx, 0[0+rax*4]
+	.loc 1 352 57 discriminator 1
+	mov	rax, QWORD PTR -16448[rbp]
+	add	rax, rdx
+	jmp	.L74
+.L73:
+	.loc 1 352 57 is_stmt 0 discriminator 2
+	lea	rax, -16432[rbp]
+.L74:
+	.loc 1 352 16 is_stmt 1 discriminator 4
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 354 9 discriminator 4
+	mov	rdx, QWORD PTR -16440[rbp]
+	mov	rcx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	signalGenerator_ChirpInterval
+	.loc 1 355 12 discriminator 4
+	cmp	DWORD PTR -36[rbp], 0
+	jne	.L75
+	.loc 1 358 41
+	mov	rax, QWORD PTR -32[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	.loc 1 357 13
+	lea	rdx, 0[0+rax*4]
+	.loc 1 357 66
+	mov	rax, QWORD PTR -8[rbp]
+	sub	rax, QWORD PTR -24[rbp]
+	mov	rcx, rax
+	.loc 1 357 48
+	lea	rax, -16432[rbp]
+	sal	rcx, 2
+	add	rcx, rax
+	.loc 1 357 38
+	mov	rax, QWORD PTR -8[rbp]
+	sub	rax, QWORD PTR -16456[rbp]
+	.loc 1 357 28
+	lea	rsi, 0[0+rax*4]
+	.loc 1 357 20
+	mov	rax, QWORD PTR -16448[rbp]
+	add	rax, rsi
+	.loc 1 357 13
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+.L75:
+	.loc 1 360 18
+	mov	rax, QWORD PTR -32[rbp]
+	mov	QWORD PTR -8[rbp], rax
+.L70:
+.LBE21:
+	.loc 1 346 21
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -16[rbp]
+	jb	.L76
+	.loc 1 362 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	signalGenerator_Chirp, .-signalGenerator_Chirp
+	.type	signalGenerator_SquareOrSawtooth, @function
+signalGenerator_SquareOrSawtooth:
+.LFB18:
+	.loc 1 369 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	mov	DWORD PTR -44[rbp], ecx
+	movss	DWORD PTR -48[rbp], xmm0
+	mov	DWORD PTR -52[rbp], r8d
+	.loc 1 370 50
+	mov	ecx, DWORD PTR -44[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	edx, 0
+	div	rcx
+	mov	rax, rdx
+	.loc 1 370 18
+	mov	DWORD PTR -4[rbp], eax
+.LBB22:
+	.loc 1 372 17
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 372 5
+	jmp	.L78
+.L88:
+	.loc 1 374 12
+	cmp	DWORD PTR -52[rbp], 0
+	je	.L79
+	.loc 1 376 29
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	.loc 1 376 66
+	cmp	eax, DWORD PTR -44[rbp]
+	jb	.L80
+	.loc 1 376 66 is_stmt 0 discriminator 1
+	movss	xmm0, DWORD PTR -48[rbp]
+	movss	xmm1, DWORD PTR .LC40[rip]
+	xorps	xmm0, xmm1
+	jmp	.L81
+.L80:
+	.loc 1 376 66 discriminator 2
+	movss	xmm0, DWORD PTR -48[rbp]
+.L81:
+	.loc 1 376 20 is_stmt 1 discriminator 4
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 376 24 discriminator 4
+	movss	DWORD PTR [rax], xmm0
+	jmp	.L82
+.L79:
+	.loc 1 380 44
+	mov	eax, DWORD PTR -4[rbp]
+	test	rax, rax
+	js	.L83
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, rax
+	jmp	.L84
+.L83:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, rdx
+	addss	xmm0, xmm0
+.L84:
+	movaps	xmm1, xmm0
+	addss	xmm1, xmm0
+	.loc 1 380 55
+	mov	eax, DWORD PTR -44[rbp]
+	test	rax, rax
+	js	.L85
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, rax
+	jmp	.L86
+.L85:
+	mov	rdx, rax
+	shr	rdx
+	and	eax, 1
+	or	rdx, rax
+	pxor	xmm0, xmm0
+	cvtsi2ss	xmm0, rdx
+	addss	xmm0, xmm0
+.L86:
+	divss	xmm1, xmm0
+	.loc 1 380 68
+	movss	xmm2, DWORD PTR .LC41[rip]
+	subss	xmm1, xmm2
+	movaps	xmm0, xmm1
+	.loc 1 380 20
+	mov	rax, QWORD PTR -16[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 380 36
+	mulss	xmm0, DWORD PTR -48[rbp]
+	.loc 1 380 24
+	movss	DWORD PTR [rax], xmm0
+.L82:
+	.loc 1 382 12
+	add	DWORD PTR -4[rbp], 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -44[rbp]
+	jne	.L87
+	.loc 1 384 22
+	mov	DWORD PTR -4[rbp], 0
+.L87:
+	.loc 1 372 43 discriminator 2
+	add	QWORD PTR -16[rbp], 1
+.L78:
+	.loc 1 372 26 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	cmp	rax, QWORD PTR -40[rbp]
+	jb	.L88
+.LBE22:
+	.loc 1 387 1
+	nop
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	signalGenerator_SquareOrSawtooth, .-signalGenerator_SquareOrSawtooth
+	.type	signalGenerator_AddWhite, @function
+signalGenerator_AddWhite:
+.LFB19:
+	.loc 1 393 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16464
+	mov	QWORD PTR -16424[rbp], rdi
+	mov	QWORD PTR -16432[rbp], rsi
+	mov	QWORD PTR -16440[rbp], rdx
+	mov	QWORD PTR -16448[rbp], rcx
+	movss	DWORD PTR -16452[rbp], xmm0
+.LBB23:
+	.loc 1 396 17
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 396 5
+	jmp	.L90
+.L93:
+.LBB24:
+	.loc 1 398 44
+	mov	rax, QWORD PTR -16440[rbp]
+	sub	rax, QWORD PTR -8[rbp]
+	.loc 1 398 22
+	mov	edx, 4096
+	cmp	rax, rdx
+	cmova	rax, rdx
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 400 9
+	mov	rdx, QWORD PTR -16432[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rsi, [rdx+rax]
+	lea	rcx, -16416[rbp]
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR -16448[rbp]
+	mov	rdi, rax
+	call	signalGenerator_Gaussian
+.LBB25:
+	.loc 1 401 21
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 401 9
+	jmp	.L91
+.L92:
+	.loc 1 403 20 discriminator 3
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16424[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 403 42 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	movss	xmm0, DWORD PTR -16416[rbp+rax*4]
+	.loc 1 403 35 discriminator 3
+	mulss	xmm0, DWORD PTR -16452[rbp]
+	.loc 1 403 20 discriminator 3
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -16424[rbp]
+	add	rax, rdx
+	.loc 1 403 28 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 401 40 discriminator 3
+	add	QWORD PTR -16[rbp], 1
+.L91:
+	.loc 1 401 30 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	cmp	rax, QWORD PTR -24[rbp]
+	jb	.L92
+.LBE25:
+.LBE24:
+	.loc 1 396 44 discriminator 2
+	add	QWORD PTR -8[rbp], 4096
+.L90:
+	.loc 1 396 26 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	cmp	rax, QWORD PTR -16440[rbp]
+	jb	.L93
+.LBE23:
+	.loc 1 406 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	signalGenerator_AddWhite, .-signalGenerator_AddWhite
+	.type	signalGenerator_AddPink, @function
+signalGenerator_AddPink:
+.LFB20:
+	.loc 1 414 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 17152
+	mov	QWORD PTR -17112[rbp], rdi
+	mov	QWORD PTR -17120[rbp], rsi
+	mov	QWORD PTR -17128[rbp], rdx
+	mov	QWORD PTR -17136[rbp], rcx
+	movss	DWORD PTR -17140[rbp], xmm0
+	.loc 1 415 17
+	movss	xmm0, DWORD PTR -17140[rbp]
+	movss	xmm1, DWORD PTR .LC42[rip]
+	divss	xmm0, xmm1
+	movss	DWORD PTR -48[rbp], xmm0
+.LBB26:
+	.loc 1 423 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 423 5
+	jmp	.L95
+.L96:
+	.loc 1 425 74 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, 1
+	.loc 1 425 19 discriminator 3
+	mov	edx, eax
+	mov	rax, QWORD PTR -17136[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	signalGenerator_StreamKey
+	.loc 1 425 17 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	mov	QWORD PTR -224[rbp+rdx*8], rax
+	.loc 1 423 49 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L95:
+	.loc 1 423 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], 16
+	jle	.L96
+.LBE26:
+	.loc 1 427 5
+	mov	rcx, QWORD PTR -224[rbp]
+	mov	edi, DWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR -17128[rbp]
+	mov	rsi, QWORD PTR -17120[rbp]
+	mov	rax, QWORD PTR -17112[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	signalGenerator_AddWhite
+	.loc 1 429 36
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -17036[rbp], xmm0
+.LBB27:
+	.loc 1 430 17
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 430 5
+	jmp	.L97
+.L106:
+.LBB28:
+	.loc 1 432 44
+	mov	rax, QWORD PTR -17128[rbp]
+	sub	rax, QWORD PTR -16[rbp]
+	.loc 1 432 22
+	mov	edx, 4096
+	cmp	rax, rdx
+	cmova	rax, rdx
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 433 24
+	mov	rdx, QWORD PTR -17120[rbp]
+	mov	rax, QWORD PTR -16[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -64[rbp], rax
+	.loc 1 434 16
+	lea	rax, -16736[rbp]
+	mov	QWORD PTR -24[rbp], rax
+.LBB29:
+	.loc 1 436 18
+	mov	DWORD PTR -28[rbp], 1
+	.loc 1 436 9
+	jmp	.L98
+.L99:
+.LBB30:
+	.loc 1 438 54 discriminator 3
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR -56[rbp]
+	add	rax, rdx
+	.loc 1 438 62 discriminator 3
+	lea	rdx, -1[rax]
+	.loc 1 438 67 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	mov	rsi, rdx
+	mov	ecx, eax
+	shr	rsi, cl
+	.loc 1 438 82 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	ecx, eax
+	shr	rdx, cl
+	mov	rax, rdx
+	.loc 1 438 73 discriminator 3
+	sub	rsi, rax
+	mov	rdx, rsi
+	.loc 1 438 26 discriminator 3
+	lea	rax, 1[rdx]
+	mov	QWORD PTR -88[rbp], rax
+	.loc 1 440 30 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	ecx, eax
+	shr	rdx, cl
+	.loc 1 440 22 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	mov	QWORD PTR -17024[rbp+rax*8], rdx
+	.loc 1 441 13 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	mov	rsi, QWORD PTR -17024[rbp+rax*8]
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	mov	rax, QWORD PTR -224[rbp+rax*8]
+	mov	rcx, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR -88[rbp]
+	mov	rdi, rax
+	call	signalGenerator_Gaussian
+	.loc 1 442 21 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	QWORD PTR -16880[rbp+rax*8], rdx
+	.loc 1 443 18 discriminator 3
+	mov	rax, QWORD PTR -88[rbp]
+	sal	rax, 2
+	add	QWORD PTR -24[rbp], rax
+.LBE30:
+	.loc 1 436 53 discriminator 3
+	add	DWORD PTR -28[rbp], 1
+.L98:
+	.loc 1 436 27 discriminator 1
+	cmp	DWORD PTR -28[rbp], 16
+	jle	.L99
+.LBE29:
+.LBB31:
+	.loc 1 445 21
+	mov	QWORD PTR -40[rbp], 0
+	.loc 1 445 9
+	jmp	.L100
+.L105:
+.LBB32:
+	.loc 1 447 28
+	mov	rdx, QWORD PTR -64[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -72[rbp], rax
+	.loc 1 449 73
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L101
+	.loc 1 449 37 discriminator 1
+	cmp	QWORD PTR -72[rbp], 0
+	je	.L101
+	.loc 1 449 75 discriminator 3
+	xor	eax, eax
+	rep bsf	rax, QWORD PTR -72[rbp]
+	.loc 1 449 73 discriminator 3
+	jmp	.L102
+.L101:
+	.loc 1 449 73 is_stmt 0 discriminator 4
+	mov	eax, 16
+.L102:
+	.loc 1 449 17 is_stmt 1 discriminator 6
+	mov	DWORD PTR -76[rbp], eax
+	.loc 1 451 21 discriminator 6
+	mov	eax, DWORD PTR -76[rbp]
+	mov	edx, 16
+	cmp	eax, edx
+	cmovg	eax, edx
+	mov	DWORD PTR -76[rbp], eax
+.LBB33:
+	.loc 1 454 22 discriminator 6
+	mov	eax, DWORD PTR -76[rbp]
+	mov	DWORD PTR -44[rbp], eax
+	.loc 1 454 13 discriminator 6
+	jmp	.L103
+.L104:
+	.loc 1 456 31 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	cdqe
+	mov	rdx, QWORD PTR -16880[rbp+rax*8]
+	.loc 1 456 38 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	mov	rsi, QWORD PTR -72[rbp]
+	mov	ecx, eax
+	shr	rsi, cl
+	mov	rcx, rsi
+	.loc 1 456 51 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	cdqe
+	mov	rax, QWORD PTR -17024[rbp+rax*8]
+	.loc 1 456 44 discriminator 3
+	sub	rcx, rax
+	.loc 1 456 34 discriminator 3
+	lea	rax, 0[0+rcx*4]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 456 65 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	add	eax, 1
+	.loc 1 456 62 discriminator 3
+	cdqe
+	movss	xmm0, DWORD PTR -17104[rbp+rax*4]
+	.loc 1 456 56 discriminator 3
+	addss	xmm0, xmm1
+	.loc 1 456 25 discriminator 3
+	mov	eax, DWORD PTR -44[rbp]
+	cdqe
+	movss	DWORD PTR -17104[rbp+rax*4], xmm0
+	.loc 1 454 44 discriminator 3
+	sub	DWORD PTR -44[rbp], 1
+.L103:
+	.loc 1 454 37 discriminator 1
+	cmp	DWORD PTR -44[rbp], 0
+	jg	.L104
+.LBE33:
+	.loc 1 458 20 discriminator 2
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -17112[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 458 43 discriminator 2
+	movss	xmm0, DWORD PTR -17100[rbp]
+	.loc 1 458 37 discriminator 2
+	mulss	xmm0, DWORD PTR -48[rbp]
+	.loc 1 458 20 discriminator 2
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, rdx
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -17112[rbp]
+	add	rax, rdx
+	.loc 1 458 28 discriminator 2
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+.LBE32:
+	.loc 1 445 40 discriminator 2
+	add	QWORD PTR -40[rbp], 1
+.L100:
+	.loc 1 445 30 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	cmp	rax, QWORD PTR -56[rbp]
+	jb	.L105
+.LBE31:
+.LBE28:
+	.loc 1 430 44 discriminator 2
+	add	QWORD PTR -16[rbp], 4096
+.L97:
+	.loc 1 430 26 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	cmp	rax, QWORD PTR -17128[rbp]
+	jb	.L106
+.LBE27:
+	.loc 1 461 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE20:
+	.size	signalGenerator_AddPink, .-signalGenerator_AddPink
+	.type	signalGenerator_ChunkTask, @function
+signalGenerator_ChunkTask:
+.LFB21:
+	.loc 1 477 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	.loc 1 478 29
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 479 30
+	mov	edi, 262144
+	call	malloc@PLT
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 481 30
+	cmp	QWORD PTR -24[rbp], 0
+	sete	al
+	movzx	edx, al
+	.loc 1 481 19
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 32[rax], edx
+.LBB34:
+	.loc 1 482 17
+	mov	QWORD PTR -8[rbp], 0
+	.loc 1 482 5
+	jmp	.L108
+.L112:
+.LBB35:
+	.loc 1 484 33
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 484 41
+	sub	rax, QWORD PTR -8[rbp]
+	.loc 1 484 96
+	cmp	rax, 65535
+	ja	.L109
+	.loc 1 484 83 discriminator 1
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 484 91 discriminator 1
+	mov	ecx, eax
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, eax
+	mov	eax, ecx
+	sub	eax, edx
+	jmp	.L110
+.L109:
+	.loc 1 484 96 discriminator 2
+	mov	eax, 65536
+.L110:
+	.loc 1 484 19 discriminator 4
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 486 9 discriminator 4
+	mov	eax, DWORD PTR -28[rbp]
+	movsx	rdx, eax
+	.loc 1 486 70 discriminator 4
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rcx, QWORD PTR 16[rax]
+	.loc 1 486 9 discriminator 4
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdi, [rcx+rax]
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rsi, QWORD PTR -24[rbp]
+	mov	rcx, rdx
+	mov	rdx, rdi
+	mov	rdi, rax
+	call	signalGenerator_generateBlock
+	.loc 1 487 92 discriminator 4
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR 16[rax]
+	.loc 1 487 100 discriminator 4
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	.loc 1 487 26 discriminator 4
+	mov	rcx, rax
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	mov	edx, DWORD PTR -28[rbp]
+	mov	rsi, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	sampleIo_WriteFramesAt@PLT
+	.loc 1 487 106 discriminator 4
+	test	eax, eax
+	setne	al
+	movzx	edx, al
+	.loc 1 487 23 discriminator 4
+	mov	rax, QWORD PTR -16[rbp]
+	mov	DWORD PTR 32[rax], edx
+.LBE35:
+	.loc 1 482 70 discriminator 4
+	add	QWORD PTR -8[rbp], 65536
+.L108:
+	.loc 1 482 30 discriminator 2
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 482 45 discriminator 2
+	test	eax, eax
+	jne	.L111
+	.loc 1 482 58 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 482 45 discriminator 3
+	cmp	QWORD PTR -8[rbp], rax
+	jb	.L112
+.L111:
+.LBE34:
+	.loc 1 489 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 490 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE21:
+	.size	signalGenerator_ChunkTask, .-signalGenerator_ChunkTask
+	.section	.rodata
+	.align 8
+.LC44:
+	.string	"Generator threads:            %d\n"
+	.align 8
+.LC45:
+	.string	"Error allocating generator jobs"
+	.align 8
+.LC46:
+	.string	"Waveform generation progress: %d%%\r"
+	.text
+	.type	signalGenerator_generateParallel, @function
+signalGenerator_generateParallel:
+.LFB22:
+	.loc 1 502 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 256
+	mov	QWORD PTR -232[rbp], rdi
+	mov	QWORD PTR -240[rbp], rsi
+	mov	QWORD PTR -248[rbp], rdx
+	.loc 1 503 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 505 35
+	mov	rax, QWORD PTR -232[rbp]
+	mov	rdi, rax
+	call	signalGenerator_NumOfSamples
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 507 9
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -240[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	sampleIo_ReserveFrames@PLT
+	.loc 1 507 8
+	test	eax, eax
+	je	.L114
+	.loc 1 509 9
+	mov	rax, QWORD PTR -248[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 510 16
+	mov	eax, 1
+	jmp	.L128
+.L114:
+	.loc 1 512 40
+	mov	rax, QWORD PTR -232[rbp]
+	mov	edx, DWORD PTR 40[rax]
+	.loc 1 512 9
+	lea	rax, -224[rbp]
+	mov	esi, edx
+	mov	rdi, rax
+	call	threadPool_Init@PLT
+	.loc 1 512 8
+	test	eax, eax
+	je	.L116
+	.loc 1 514 16
+	mov	eax, 1
+	jmp	.L128
+.L116:
+	.loc 1 516 5
+	mov	eax, DWORD PTR -208[rbp]
+	mov	esi, eax
+	lea	rax, .LC44[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 518 33
+	mov	eax, DWORD PTR -208[rbp]
+	.loc 1 518 15
+	sal	eax, 2
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 519 63
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	mov	esi, 40
+	mov	rdi, rax
+	call	calloc@PLT
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 520 8
+	cmp	QWORD PTR -48[rbp], 0
+	jne	.L117
+	.loc 1 522 9
+	lea	rax, .LC45[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 523 9
+	lea	rax, -224[rbp]
+	mov	rdi, rax
+	call	threadPool_Destroy@PLT
+	.loc 1 524 16
+	mov	eax, 1
+	jmp	.L128
+.L117:
+.LBB36:
+	.loc 1 528 19
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 528 5
+	jmp	.L118
+.L127:
+.LBB37:
+	.loc 1 530 13
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 532 9
+	jmp	.L119
+.L121:
+	.loc 1 534 19 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 534 37 discriminator 3
+	mov	rax, QWORD PTR -232[rbp]
+	mov	QWORD PTR [rdx], rax
+	.loc 1 535 19 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 535 35 discriminator 3
+	mov	rax, QWORD PTR -240[rbp]
+	mov	QWORD PTR 8[rdx], rax
+	.loc 1 536 19 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 536 34 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	mov	QWORD PTR 16[rdx], rax
+	.loc 1 537 50 discriminator 3
+	mov	rax, QWORD PTR -32[rbp]
+	sub	rax, QWORD PTR -16[rbp]
+	mov	rdx, rax
+	.loc 1 537 19 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rcx, eax
+	mov	rax, rcx
+	sal	rax, 2
+	add	rax, rcx
+	sal	rax, 3
+	mov	rcx, rax
+	mov	rax, QWORD PTR -48[rbp]
+	add	rcx, rax
+	.loc 1 537 108 discriminator 3
+	mov	eax, 1048576
+	cmp	rdx, rax
+	cmovbe	rax, rdx
+	.loc 1 537 34 discriminator 3
+	mov	QWORD PTR 24[rcx], rax
+	.loc 1 538 24 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 538 32 discriminator 3
+	mov	rax, QWORD PTR 24[rax]
+	.loc 1 538 15 discriminator 3
+	add	QWORD PTR -16[rbp], rax
+	.loc 1 539 72 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	.loc 1 539 65 discriminator 3
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 539 13 discriminator 3
+	lea	rax, -224[rbp]
+	lea	rcx, signalGenerator_ChunkTask[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	threadPool_Submit@PLT
+	.loc 1 532 68 discriminator 3
+	add	DWORD PTR -20[rbp], 1
+.L119:
+	.loc 1 532 39 discriminator 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -36[rbp]
+	jge	.L120
+	.loc 1 532 39 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -16[rbp]
+	cmp	rax, QWORD PTR -32[rbp]
+	jb	.L121
+.L120:
+	.loc 1 541 9 is_stmt 1
+	lea	rax, -224[rbp]
+	mov	rdi, rax
+	call	threadPool_Wait@PLT
+.LBB38:
+	.loc 1 543 18
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 543 9
+	jmp	.L122
+.L125:
+	.loc 1 545 23
+	mov	eax, DWORD PTR -24[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	sal	rax, 3
+	mov	rdx, rax
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	.loc 1 545 26
+	mov	eax, DWORD PTR 32[rax]
+	.loc 1 545 16
+	test	eax, eax
+	je	.L123
+	.loc 1 547 17
+	mov	rax, QWORD PTR -248[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 548 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 549 17
+	jmp	.L124
+.L123:
+	.loc 1 543 38 discriminator 2
+	add	DWORD PTR -24[rbp], 1
+.L122:
+	.loc 1 543 27 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L125
+.L124:
+.LBE38:
+	.loc 1 552 66
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	lea	rdx, 0[0+rax*4]
+	add	rax, rdx
+	sal	rax, 2
+	.loc 1 552 70
+	mov	edx, 0
+	div	QWORD PTR -32[rbp]
+	.loc 1 552 9
+	mov	esi, eax
+	lea	rax, .LC46[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 553 9
+	mov	rax, QWORD PTR stdout[rip]
+	mov	rdi, rax
+	call	fflush@PLT
+.L118:
+.LBE37:
+	.loc 1 528 51 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L126
+	.loc 1 528 51 is_stmt 0 discriminator 2
+	mov	rax, QWORD PTR -16[rbp]
+	cmp	rax, QWORD PTR -32[rbp]
+	jb	.L127
+.L126:
+.LBE36:
+	.loc 1 555 5 is_stmt 1
+	mov	edi, 10
+	call	putchar@PLT
+	.loc 1 557 5
+	lea	rax, -224[rbp]
+	mov	rdi, rax
+	call	threadPool_Destroy@PLT
+	.loc 1 558 5
+	mov	rax, QWORD PTR -48[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 560 12
+	mov	eax, DWORD PTR -4[rbp]
+.L128:
+	.loc 1 561 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE22:
+	.size	signalGenerator_generateParallel, .-signalGenerator_generateParallel
+	.section	.rodata
+	.align 8
+.LC47:
+	.string	"Output file:                  %s (%s)\n"
+	.align 8
+.LC48:
+	.string	"Error allocating sample buffer"
+	.text
+	.type	signalGenerator_generateToFile, @function
+signalGenerator_generateToFile:
+.LFB23:
+	.loc 1 571 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 640
+	mov	QWORD PTR -632[rbp], rdi
+	mov	QWORD PTR -640[rbp], rsi
+	.loc 1 572 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 574 35
+	mov	rax, QWORD PTR -632[rbp]
+	mov	rdi, rax
+	call	signalGenerator_NumOfSamples
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 576 62
+	mov	rax, QWORD PTR -632[rbp]
+	mov	edx, DWORD PTR 12[rax]
+	.loc 1 576 9
+	mov	rsi, QWORD PTR -640[rbp]
+	lea	rax, -624[rbp]
+	mov	r8d, 48000
+	mov	ecx, 1
+	mov	rdi, rax
+	call	sampleIo_OpenWriter@PLT
+	.loc 1 576 8
+	test	eax, eax
+	je	.L130
+	.loc 1 578 16
+	mov	eax, 1
+	jmp	.L142
+.L130:
+	.loc 1 580 5
+	mov	eax, DWORD PTR -616[rbp]
+	mov	edi, eax
+	call	sampleIo_FormatName@PLT
+	mov	rdx, rax
+	mov	rax, QWORD PTR -640[rbp]
+	mov	rsi, rax
+	lea	rax, .LC47[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 582 15
+	mov	eax, DWORD PTR -616[rbp]
+	.loc 1 582 8
+	cmp	eax, 1
+	je	.L132
+	.loc 1 584 18
+	mov	rdx, QWORD PTR -640[rbp]
+	lea	rcx, -624[rbp]
+	mov	rax, QWORD PTR -632[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	signalGenerator_generateParallel
+	mov	DWORD PTR -4[rbp], eax
+	jmp	.L133
+.L132:
+.LBB39:
+	.loc 1 588 40
+	mov	edi, 262144
+	call	malloc@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 589 12
+	cmp	QWORD PTR -32[rbp], 0
+	jne	.L134
+	.loc 1 591 13
+	lea	rax, .LC48[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 592 20
+	mov	DWORD PTR -4[rbp], 1
+.L134:
+.LBB40:
+	.loc 1 595 23
+	mov	QWORD PTR -16[rbp], 0
+	.loc 1 595 9
+	jmp	.L135
+.L140:
+.LBB41:
+	.loc 1 597 45
+	mov	rax, QWORD PTR -24[rbp]
+	sub	rax, QWORD PTR -16[rbp]
+	.loc 1 597 100
+	cmp	rax, 65535
+	ja	.L136
+	.loc 1 597 95 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, eax
+	mov	rax, QWORD PTR -16[rbp]
+	mov	edx, eax
+	mov	eax, ecx
+	sub	eax, edx
+	jmp	.L137
+.L136:
+	.loc 1 597 100 discriminator 2
+	mov	eax, 65536
+.L137:
+	.loc 1 597 23 discriminator 4
+	mov	DWORD PTR -36[rbp], eax
+	.loc 1 599 13 discriminator 4
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rcx, eax
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -632[rbp]
+	mov	rdi, rax
+	call	signalGenerator_generateBlock
+	.loc 1 600 17 discriminator 4
+	mov	edx, DWORD PTR -36[rbp]
+	mov	rcx, QWORD PTR -32[rbp]
+	lea	rax, -624[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	sampleIo_Write@PLT
+	.loc 1 600 16 discriminator 4
+	test	eax, eax
+	je	.L138
+	.loc 1 602 17
+	mov	rax, QWORD PTR -640[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 603 24
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 604 17
+	jmp	.L139
+.L138:
+	.loc 1 606 75 discriminator 2
+	mov	eax, DWORD PTR -36[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -16[rbp]
+	add	rdx, rax
+	.loc 1 606 70 discriminator 2
+	mov	rax, rdx
+	sal	rax, 2
+	add	rax, rdx
+	lea	rdx, 0[0+rax*4]
+	add	rax, rdx
+	sal	rax, 2
+	.loc 1 606 84 discriminator 2
+	mov	edx, 0
+	div	QWORD PTR -24[rbp]
+	.loc 1 606 13 discriminator 2
+	mov	esi, eax
+	lea	rax, .LC46[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 607 13 discriminator 2
+	mov	rax, QWORD PTR stdout[rip]
+	mov	rdi, rax
+	call	fflush@PLT
+.LBE41:
+	.loc 1 595 80 discriminator 2
+	add	QWORD PTR -16[rbp], 65536
+.L135:
+	.loc 1 595 55 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L139
+	.loc 1 595 55 is_stmt 0 discriminator 3
+	mov	rax, QWORD PTR -16[rbp]
+	cmp	rax, QWORD PTR -24[rbp]
+	jb	.L140
+.L139:
+.LBE40:
+	.loc 1 609 9 is_stmt 1
+	mov	edi, 10
+	call	putchar@PLT
+	.loc 1 611 9
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	free@PLT
+.L133:
+.LBE39:
+	.loc 1 614 9
+	lea	rax, -624[rbp]
+	mov	rdi, rax
+	call	sampleIo_CloseWriter@PLT
+	.loc 1 614 8
+	test	eax, eax
+	je	.L141
+	.loc 1 616 9
+	mov	rax, QWORD PTR -640[rbp]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 617 16
+	mov	eax, 1
+	jmp	.L142
+.L141:
+	.loc 1 619 12
+	mov	eax, DWORD PTR -4[rbp]
+.L142:
+	.loc 1 620 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE23:
+	.size	signalGenerator_generateToFile, .-signalGenerator_generateToFile
+	.globl	signalGenerator_DefaultSettings
+	.type	signalGenerator_DefaultSettings, @function
+signalGenerator_DefaultSettings:
+.LFB24:
+	.loc 1 623 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 624 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, 48
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 625 20
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR [rax], 0
+	.loc 1 626 22
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 12[rax], 0
+	.loc 1 627 25
+	mov	rax, QWORD PTR -8[rbp]
+	movss	xmm0, DWORD PTR .LC41[rip]
+	movss	DWORD PTR 16[rax], xmm0
+	.loc 1 628 19
+	mov	rax, QWORD PTR -8[rbp]
+	movss	xmm0, DWORD PTR .LC49[rip]
+	movss	DWORD PTR 20[rax], xmm0
+	.loc 1 629 29
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 24[rax], 4
+	.loc 1 630 20
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR 32[rax], 1
+	.loc 1 631 28
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 40[rax], 0
+	.loc 1 632 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE24:
+	.size	signalGenerator_DefaultSettings, .-signalGenerator_DefaultSettings
+	.section	.rodata
+	.align 8
+.LC50:
+	.string	"Signal type:                  %s\n"
+	.align 8
+.LC51:
+	.string	"ERROR: Unknown argument for <type>, expected sine, square, sawtooth, chirp, white, pink or sine-noise"
+	.text
+	.globl	signalGenerator_processArgumentType
+	.type	signalGenerator_processArgumentType, @function
+signalGenerator_processArgumentType:
+.LFB25:
+	.loc 1 635 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+.LBB42:
+	.loc 1 636 14
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 636 5
+	jmp	.L145
+.L148:
+	.loc 1 638 50
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, signalGeneratorTypeNames[rip]
+	mov	rdx, QWORD PTR [rdx+rax]
+	.loc 1 638 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	strcmp@PLT
+	.loc 1 638 12
+	test	eax, eax
+	jne	.L146
+	.loc 1 640 82
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*8]
+	lea	rax, signalGeneratorTypeNames[rip]
+	mov	rax, QWORD PTR [rdx+rax]
+	.loc 1 640 13
+	mov	rsi, rax
+	lea	rax, .LC50[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 641 20
+	mov	eax, DWORD PTR -4[rbp]
+	jmp	.L147
+.L146:
+	.loc 1 636 65 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L145:
+	.loc 1 636 44 discriminator 1
+	cmp	DWORD PTR -4[rbp], 7
+	jle	.L148
+.LBE42:
+	.loc 1 644 5
+	lea	rax, .LC51[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 645 12
+	mov	eax, 0
+.L147:
+	.loc 1 646 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE25:
+	.size	signalGenerator_processArgumentType, .-signalGenerator_processArgumentType
+	.section	.rodata
+	.align 8
+.LC52:
+	.string	"ERROR: Argument <cycles> contains non-positive integer characters"
+	.align 8
+.LC53:
+	.string	"Number of cycles:             %d \n"
+	.align 8
+.LC54:
+	.string	"ERROR: Number for <cycles> must be greater than 0"
+	.text
+	.globl	signalGenerator_processArgumentCycles
+	.type	signalGenerator_processArgumentCycles, @function
+signalGenerator_processArgumentCycles:
+.LFB26:
+	.loc 1 649 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 650 18
+	mov	DWORD PTR -4[rbp], 0
+.LBB43:
+	.loc 1 654 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 654 5
+	jmp	.L150
+.L153:
+	.loc 1 656 27
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 656 19
+	movzx	eax, BYTE PTR [rax]
+	mov	BYTE PTR -13[rbp], al
+	.loc 1 657 14
+	call	__ctype_b_loc@PLT
+	mov	rax, QWORD PTR [rax]
+	movsx	rdx, BYTE PTR -13[rbp]
+	add	rdx, rdx
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	movzx	eax, ax
+	and	eax, 2048
+	.loc 1 657 12
+	test	eax, eax
+	jne	.L151
+	.loc 1 659 13
+	lea	rax, .LC52[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 660 20
+	mov	eax, DWORD PTR -4[rbp]
+	jmp	.L152
+.L151:
+	.loc 1 654 43 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L150:
+	.loc 1 654 28 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 654 32 discriminator 1
+	test	al, al
+	jne	.L153
+.LBE43:
+	.loc 1 663 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 663 15
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 664 8
+	cmp	DWORD PTR -12[rbp], 0
+	je	.L154
+	.loc 1 666 16
+	mov	eax, DWORD PTR -12[rbp]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 667 9
+	mov	eax, DWORD PTR -4[rbp]
+	mov	esi, eax
+	lea	rax, .LC53[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L155
+.L154:
+	.loc 1 671 9
+	lea	rax, .LC54[rip]
+	mov	rdi, rax
+	call	puts@PLT
+.L155:
+	.loc 1 673 12
+	mov	eax, DWORD PTR -4[rbp]
+.L152:
+	.loc 1 674 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE26:
+	.size	signalGenerator_processArgumentCycles, .-signalGenerator_processArgumentCycles
+	.section	.rodata
+	.align 8
+.LC55:
+	.string	"ERROR: Argument <resolution> contains non-positive integer characters"
+	.align 8
+.LC56:
+	.string	"Signal resolution:            %d \n"
+	.align 8
+.LC57:
+	.string	"ERROR: Number for <resolution> must be in range: 2 - %d \n"
+	.text
+	.globl	signalGenerator_processArgumentResolution
+	.type	signalGenerator_processArgumentResolution, @function
+signalGenerator_processArgumentResolution:
+.LFB27:
+	.loc 1 677 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 678 18
+	mov	DWORD PTR -4[rbp], 0
+.LBB44:
+	.loc 1 682 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 682 5
+	jmp	.L157
+.L160:
+	.loc 1 684 31
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	.loc 1 684 19
+	movzx	eax, BYTE PTR [rax]
+	mov	BYTE PTR -13[rbp], al
+	.loc 1 685 14
+	call	__ctype_b_loc@PLT
+	mov	rax, QWORD PTR [rax]
+	movsx	rdx, BYTE PTR -13[rbp]
+	add	rdx, rdx
+	add	rax, rdx
+	movzx	eax, WORD PTR [rax]
+	movzx	eax, ax
+	and	eax, 2048
+	.loc 1 685 12
+	test	eax, eax
+	jne	.L158
+	.loc 1 687 13
+	lea	rax, .LC55[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 688 20
+	mov	eax, DWORD PTR -4[rbp]
+	jmp	.L159
+.L158:
+	.loc 1 682 47 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L157:
+	.loc 1 682 32 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	movsx	rdx, eax
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, rdx
+	movzx	eax, BYTE PTR [rax]
+	.loc 1 682 36 discriminator 1
+	test	al, al
+	jne	.L160
+.LBE44:
+	.loc 1 691 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	atoi@PLT
+	.loc 1 691 15
+	mov	DWORD PTR -12[rbp], eax
+	.loc 1 692 8
+	cmp	DWORD PTR -12[rbp], 1
+	jbe	.L161
+	.loc 1 692 25 discriminator 1
+	cmp	DWORD PTR -12[rbp], 100000
+	ja	.L161
+	.loc 1 694 16
+	mov	eax, DWORD PTR -12[rbp]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 695 9
+	mov	eax, DWORD PTR -4[rbp]
+	mov	esi, eax
+	lea	rax, .LC56[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	jmp	.L162
+.L161:
+	.loc 1 699 9
+	mov	esi, 100000
+	lea	rax, .LC57[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+.L162:
+	.loc 1 701 12
+	mov	eax, DWORD PTR -4[rbp]
+.L159:
+	.loc 1 702 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE27:
+	.size	signalGenerator_processArgumentResolution, .-signalGenerator_processArgumentResolution
+	.globl	signalGenerator_NumOfSamples
+	.type	signalGenerator_NumOfSamples, @function
+signalGenerator_NumOfSamples:
+.LFB28:
+	.loc 1 705 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 706 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 706 12
+	mov	edx, eax
+	.loc 1 706 49
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	eax, eax
+	.loc 1 706 39
+	imul	rax, rdx
+	.loc 1 707 1
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE28:
+	.size	signalGenerator_NumOfSamples, .-signalGenerator_NumOfSamples
+	.globl	signalGenerator_generateBlock
+	.type	signalGenerator_generateBlock, @function
+signalGenerator_generateBlock:
+.LFB29:
+	.loc 1 711 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	mov	QWORD PTR -48[rbp], rcx
+	.loc 1 712 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 713 36
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 16[rax]
+	.loc 1 713 17
+	movss	xmm1, DWORD PTR .LC58[rip]
+	divss	xmm0, xmm1
+	movss	DWORD PTR -8[rbp], xmm0
+	.loc 1 714 65
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 32[rax]
+	.loc 1 714 31
+	mov	esi, 0
+	mov	rdi, rax
+	call	signalGenerator_StreamKey
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 716 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 716 5
+	cmp	eax, 7
+	ja	.L166
+	mov	eax, eax
+	lea	rdx, 0[0+rax*4]
+	lea	rax, .L168[rip]
+	mov	eax, DWORD PTR [rdx+rax]
+	cdqe
+	lea	rdx, .L168[rip]
+	add	rax, rdx
+	jmp	rax
+	.section	.rodata
+	.align 4
+	.align 4
+.L168:
+	.long	.L166-.L168
+	.long	.L173-.L168
+	.long	.L172-.L168
+	.long	.L172-.L168
+	.long	.L171-.L168
+	.long	.L170-.L168
+	.long	.L169-.L168
+	.long	.L167-.L168
+	.text
+.L173:
+	.loc 1 719 94
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edi, DWORD PTR 16[rax]
+	.loc 1 719 72
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 8[rax]
+	.loc 1 719 13
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	signalGenerator_Sine
+	.loc 1 720 13
+	jmp	.L174
+.L171:
+	.loc 1 723 13
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	rsi, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	signalGenerator_Chirp
+	.loc 1 724 13
+	jmp	.L174
+.L172:
+	.loc 1 729 54
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 728 13
+	cmp	eax, 2
+	sete	al
+	movzx	r8d, al
+	.loc 1 728 106
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edi, DWORD PTR 16[rax]
+	.loc 1 728 84
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 8[rax]
+	.loc 1 728 13
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	signalGenerator_SquareOrSawtooth
+	.loc 1 730 13
+	jmp	.L174
+.L170:
+	.loc 1 733 13
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 734 13
+	mov	edi, DWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	signalGenerator_AddWhite
+	.loc 1 735 13
+	jmp	.L174
+.L169:
+	.loc 1 738 13
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 739 75
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 32[rax]
+	.loc 1 739 13
+	mov	edi, DWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	signalGenerator_AddPink
+	.loc 1 740 13
+	jmp	.L174
+.L167:
+	.loc 1 744 94
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edi, DWORD PTR 16[rax]
+	.loc 1 744 72
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 8[rax]
+	.loc 1 744 13
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	signalGenerator_Sine
+	.loc 1 746 46
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm2, DWORD PTR 16[rax]
+	movss	DWORD PTR -52[rbp], xmm2
+	.loc 1 746 99
+	mov	rax, QWORD PTR -24[rbp]
+	movss	xmm0, DWORD PTR 20[rax]
+	.loc 1 746 90
+	movss	xmm1, DWORD PTR .LC40[rip]
+	xorps	xmm0, xmm1
+	cvtss2sd	xmm0, xmm0
+	.loc 1 746 80
+	movsd	xmm1, QWORD PTR .LC59[rip]
+	divsd	xmm0, xmm1
+	mov	rax, QWORD PTR .LC60[rip]
+	movapd	xmm1, xmm0
+	movq	xmm0, rax
+	call	pow@PLT
+	.loc 1 746 78
+	movsd	xmm1, QWORD PTR .LC61[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 746 60
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 745 13
+	mulss	xmm0, DWORD PTR -52[rbp]
+	movd	edi, xmm0
+	mov	rcx, QWORD PTR -16[rbp]
+	mov	rdx, QWORD PTR -48[rbp]
+	mov	rsi, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	movd	xmm0, edi
+	mov	rdi, rax
+	call	signalGenerator_AddWhite
+	.loc 1 747 13
+	jmp	.L174
+.L166:
+	.loc 1 750 20
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 751 13
+	nop
+.L174:
+	.loc 1 753 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 754 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE29:
+	.size	signalGenerator_generateBlock, .-signalGenerator_generateBlock
+	.globl	signalGenerator_generateSamples
+	.type	signalGenerator_generateSamples, @function
+signalGenerator_generateSamples:
+.LFB30:
+	.loc 1 757 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	mov	QWORD PTR -24[rbp], rdx
+	.loc 1 758 12
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	rsi, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, rdx
+	mov	edx, 0
+	mov	rdi, rax
+	call	signalGenerator_generateBlock
+	.loc 1 759 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE30:
+	.size	signalGenerator_generateSamples, .-signalGenerator_generateSamples
+	.globl	signalGenerator_generateSignal
+	.type	signalGenerator_generateSignal, @function
+signalGenerator_generateSignal:
+.LFB31:
+	.loc 1 762 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 763 9
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 765 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 765 8
+	test	eax, eax
+	je	.L179
+	.loc 1 765 59 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR [rax]
+	.loc 1 765 47 discriminator 1
+	cmp	eax, 7
+	ja	.L179
+	.loc 1 765 86 discriminator 2
+	cmp	QWORD PTR -32[rbp], 0
+	je	.L179
+	.loc 1 767 18
+	mov	rdx, QWORD PTR -32[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	signalGenerator_generateToFile
+	mov	DWORD PTR -4[rbp], eax
+.L179:
+	.loc 1 769 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 770 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE31:
+	.size	signalGenerator_generateSignal, .-signalGenerator_generateSignal
+	.section	.rodata
+	.align 8
+.LC8:
+	.long	1882238282
+	.long	1021924039
+	.align 8
+.LC9:
+	.long	-416040929
+	.long	1030416371
+	.align 8
+.LC10:
+	.long	329805065
+	.long	1038488134
+	.align 8
+.LC11:
+	.long	1744127204
+	.long	1046144581
+	.align 8
+.LC12:
+	.long	-1521039564
+	.long	1053236707
+	.align 8
+.LC13:
+	.long	436314138
+	.long	1059717536
+	.align 8
+.LC14:
+	.long	286331153
+	.long	1065423121
+	.align 8
+.LC15:
+	.long	1431655765
+	.long	1069897045
+	.align 8
+.LC16:
+	.long	-416040929
+	.long	1026222067
+	.align 8
+.LC17:
+	.long	-1463780195
+	.long	1034500468
+	.align 8
+.LC18:
+	.long	-268904296
+	.long	1042411224
+	.align 8
+.LC19:
+	.long	-1216831652
+	.long	1049787983
+	.align 8
+.LC20:
+	.long	436314138
+	.long	1056571808
+	.align 8
+.LC21:
+	.long	381774871
+	.long	1062650220
+	.align 8
+.LC22:
+	.long	1431655765
+	.long	1067799893
+	.align 8
+.LC23:
+	.long	0
+	.long	1071644672
+	.align 8
+.LC24:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC25:
+	.long	-17155601
+	.long	1072049730
+	.align 8
+.LC26:
+	.long	330382100
+	.long	1068740923
+	.align 8
+.LC27:
+	.long	1952257862
+	.long	1068975569
+	.align 8
+.LC28:
+	.long	477218588
+	.long	1069314503
+	.align 8
+.LC29:
+	.long	-1840700270
+	.long	1069697316
+	.align 8
+.LC30:
+	.long	-1717986918
+	.long	1070176665
+	.align 8
+.LC31:
+	.long	1431655765
+	.long	1070945621
+	.align 8
+.LC33:
+	.long	1413754136
+	.long	1050223099
+	.align 8
+.LC34:
+	.long	1060875123
+	.long	1076929202
+	.align 8
+.LC35:
+	.long	1413754136
+	.long	1073291771
+	.align 16
+.LC36:
+	.long	0
+	.long	-2147483648
+	.long	0
+	.long	0
+	.align 8
+.LC37:
+	.long	1413754136
+	.long	1075388923
+	.align 8
+.LC38:
+	.long	0
+	.long	1076887552
+	.align 8
+.LC39:
+	.long	0
+	.long	1075838976
+	.align 16
+.LC40:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC41:
+	.long	1065353216
+	.align 4
+.LC42:
+	.long	1082388603
+	.align 4
+.LC49:
+	.long	1101004800
+	.align 4
+.LC58:
+	.long	1082130432
+	.align 8
+.LC59:
+	.long	0
+	.long	1077149696
+	.align 8
+.LC60:
+	.long	0
+	.long	1076101120
+	.align 8
+.LC61:
+	.long	1719614413
+	.long	1072079006
+	.text
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 13 "include/threadPool.h"
+	.file 14 "/usr/include/ctype.h"
+	.file 15 "include/asyncFile.h"
+	.file 16 "include/sampleIo.h"
+	.file 17 "include/signalGenerator.h"
+	.file 18 "/usr/include/stdlib.h"
+	.file 19 "/usr/include/string.h"
+	.file 20 "/usr/include/stdio.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x21e8
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2a
+	.long	.LASF336
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0xf
+	.long	0x2e
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xf
+	.long	0x46
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xf
+	.long	0x67
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xf
+	.long	0x73
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x7
+	.long	.LASF11
+	.byte	0x3
+	.byte	0x29
+	.byte	0x14
+	.long	0x46
+	.uleb128 0x7
+	.long	.LASF12
+	.byte	0x3
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x7
+	.long	.LASF13
+	.byte	0x3
+	.byte	0x98
+	.byte	0x19
+	.long	0x52
+	.uleb128 0x7
+	.long	.LASF14
+	.byte	0x3
+	.byte	0x99
+	.byte	0x1b
+	.long	0x52
+	.uleb128 0x2c
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF15
+	.byte	0x3
+	.byte	0xc2
+	.byte	0x1b
+	.long	0x52
+	.uleb128 0x9
+	.long	0xd0
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF16
+	.uleb128 0xf
+	.long	0xd0
+	.uleb128 0x7
+	.long	.LASF17
+	.byte	0x4
+	.byte	0x55
+	.byte	0x11
+	.long	0xa5
+	.uleb128 0x7
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x13
+	.long	0xbf
+	.uleb128 0x7
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8d
+	.uleb128 0xf
+	.long	0xf4
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x3
+	.long	0x129
+	.uleb128 0x1
+	.long	.LASF20
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x12
+	.long	0x73
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF21
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x12
+	.long	0x73
+	.byte	0x4
+	.byte	0
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x6
+	.byte	0x19
+	.long	0x14a
+	.uleb128 0x12
+	.long	.LASF22
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x28
+	.long	0x14a
+	.uleb128 0x12
+	.long	.LASF23
+	.byte	0x6
+	.byte	0x20
+	.byte	0x5
+	.long	0x105
+	.byte	0
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF24
+	.uleb128 0x7
+	.long	.LASF25
+	.byte	0x6
+	.byte	0x21
+	.byte	0x3
+	.long	0x129
+	.uleb128 0x1d
+	.long	.LASF29
+	.byte	0x10
+	.byte	0x7
+	.byte	0x33
+	.byte	0x10
+	.long	0x185
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x7
+	.byte	0x35
+	.byte	0x23
+	.long	0x185
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x7
+	.byte	0x36
+	.byte	0x23
+	.long	0x185
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0x15d
+	.uleb128 0x7
+	.long	.LASF28
+	.byte	0x7
+	.byte	0x37
+	.byte	0x3
+	.long	0x15d
+	.uleb128 0x1d
+	.long	.LASF30
+	.byte	0x28
+	.byte	0x8
+	.byte	0x16
+	.byte	0x8
+	.long	0x20c
+	.uleb128 0x1
+	.long	.LASF31
+	.byte	0x8
+	.byte	0x18
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x8
+	.byte	0x19
+	.byte	0x10
+	.long	0x73
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x7
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x10
+	.long	0x73
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x8
+	.byte	0x20
+	.byte	0x7
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x8
+	.byte	0x22
+	.byte	0x9
+	.long	0x86
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x8
+	.byte	0x23
+	.byte	0x9
+	.long	0x86
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x8
+	.byte	0x24
+	.byte	0x14
+	.long	0x18a
+	.byte	0x18
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF39
+	.byte	0x30
+	.byte	0x7
+	.byte	0x5e
+	.byte	0x8
+	.long	0x275
+	.uleb128 0x1
+	.long	.LASF40
+	.byte	0x7
+	.byte	0x60
+	.byte	0x19
+	.long	0x151
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF41
+	.byte	0x7
+	.byte	0x61
+	.byte	0x19
+	.long	0x151
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF42
+	.byte	0x7
+	.byte	0x62
+	.byte	0x10
+	.long	0x275
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF43
+	.byte	0x7
+	.byte	0x63
+	.byte	0x10
+	.long	0x275
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF44
+	.byte	0x7
+	.byte	0x64
+	.byte	0x10
+	.long	0x73
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF45
+	.byte	0x7
+	.byte	0x65
+	.byte	0x10
+	.long	0x73
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF46
+	.byte	0x7
+	.byte	0x66
+	.byte	0x10
+	.long	0x275
+	.byte	0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0x73
+	.long	0x285
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF47
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x20
+	.byte	0x28
+	.byte	0x9
+	.byte	0x43
+	.long	0x2be
+	.uleb128 0x12
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x45
+	.byte	0x1c
+	.long	0x196
+	.uleb128 0x12
+	.long	.LASF49
+	.byte	0x9
+	.byte	0x46
+	.byte	0x8
+	.long	0x2be
+	.uleb128 0x12
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x47
+	.byte	0xc
+	.long	0x52
+	.byte	0
+	.uleb128 0xd
+	.long	0xd0
+	.long	0x2ce
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x27
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF51
+	.byte	0x9
+	.byte	0x48
+	.byte	0x3
+	.long	0x291
+	.uleb128 0x20
+	.byte	0x30
+	.byte	0x9
+	.byte	0x4b
+	.long	0x307
+	.uleb128 0x12
+	.long	.LASF48
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x20c
+	.uleb128 0x12
+	.long	.LASF49
+	.byte	0x9
+	.byte	0x4e
+	.byte	0x8
+	.long	0x307
+	.uleb128 0x12
+	.long	.LASF50
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x59
+	.byte	0
+	.uleb128 0xd
+	.long	0xd0
+	.long	0x317
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF52
+	.byte	0x9
+	.byte	0x50
+	.byte	0x3
+	.long	0x2da
+	.uleb128 0x9
+	.long	0x328
+	.uleb128 0x2d
+	.uleb128 0x1d
+	.long	.LASF53
+	.byte	0xd8
+	.byte	0xa
+	.byte	0x31
+	.byte	0x8
+	.long	0x4b0
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0xa
+	.byte	0x33
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0xa
+	.byte	0x36
+	.byte	0x9
+	.long	0xcb
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0xa
+	.byte	0x37
+	.byte	0x9
+	.long	0xcb
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0xa
+	.byte	0x38
+	.byte	0x9
+	.long	0xcb
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0xa
+	.byte	0x39
+	.byte	0x9
+	.long	0xcb
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0xa
+	.byte	0x3a
+	.byte	0x9
+	.long	0xcb
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0xa
+	.byte	0x3b
+	.byte	0x9
+	.long	0xcb
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x9
+	.long	0xcb
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xa
+	.byte	0x3d
+	.byte	0x9
+	.long	0xcb
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xa
+	.byte	0x40
+	.byte	0x9
+	.long	0xcb
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0xa
+	.byte	0x41
+	.byte	0x9
+	.long	0xcb
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0xa
+	.byte	0x42
+	.byte	0x9
+	.long	0xcb
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0xa
+	.byte	0x44
+	.byte	0x16
+	.long	0x4c9
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0xa
+	.byte	0x46
+	.byte	0x14
+	.long	0x4ce
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0xa
+	.byte	0x48
+	.byte	0x7
+	.long	0x46
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0xa
+	.byte	0x49
+	.byte	0x7
+	.long	0x46
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0xa
+	.byte	0x4a
+	.byte	0xb
+	.long	0xa5
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x12
+	.long	0x67
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xf
+	.long	0x7f
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0xa
+	.byte	0x4f
+	.byte	0x8
+	.long	0x4d3
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0xa
+	.byte	0x51
+	.byte	0xf
+	.long	0x4e3
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0xa
+	.byte	0x59
+	.byte	0xd
+	.long	0xb1
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0xa
+	.byte	0x5b
+	.byte	0x17
+	.long	0x4ed
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0xa
+	.byte	0x5c
+	.byte	0x19
+	.long	0x4f7
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0xa
+	.byte	0x5d
+	.byte	0x14
+	.long	0x4ce
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0xa
+	.byte	0x5e
+	.byte	0x9
+	.long	0xbd
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xa
+	.byte	0x5f
+	.byte	0xa
+	.long	0x2e
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xa
+	.byte	0x60
+	.byte	0x7
+	.long	0x46
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xa
+	.byte	0x62
+	.byte	0x8
+	.long	0x4fc
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF83
+	.byte	0xb
+	.byte	0x7
+	.byte	0x19
+	.long	0x329
+	.uleb128 0x2e
+	.long	.LASF337
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x21
+	.long	.LASF84
+	.uleb128 0x9
+	.long	0x4c4
+	.uleb128 0x9
+	.long	0x329
+	.uleb128 0xd
+	.long	0xd0
+	.long	0x4e3
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x4bc
+	.uleb128 0x21
+	.long	.LASF85
+	.uleb128 0x9
+	.long	0x4e8
+	.uleb128 0x21
+	.long	.LASF86
+	.uleb128 0x9
+	.long	0x4f2
+	.uleb128 0xd
+	.long	0xd0
+	.long	0x50c
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x13
+	.byte	0
+	.uleb128 0x9
+	.long	0x4b0
+	.uleb128 0x2f
+	.long	.LASF338
+	.byte	0x14
+	.byte	0x90
+	.byte	0xe
+	.long	0x50c
+	.uleb128 0x9
+	.long	0x6e
+	.uleb128 0x9
+	.long	0xd7
+	.uleb128 0xf
+	.long	0x522
+	.uleb128 0x17
+	.long	0x73
+	.byte	0xe
+	.byte	0x2f
+	.long	0x588
+	.uleb128 0x13
+	.long	.LASF87
+	.value	0x100
+	.uleb128 0x13
+	.long	.LASF88
+	.value	0x200
+	.uleb128 0x13
+	.long	.LASF89
+	.value	0x400
+	.uleb128 0x13
+	.long	.LASF90
+	.value	0x800
+	.uleb128 0x13
+	.long	.LASF91
+	.value	0x1000
+	.uleb128 0x13
+	.long	.LASF92
+	.value	0x2000
+	.uleb128 0x13
+	.long	.LASF93
+	.value	0x4000
+	.uleb128 0x13
+	.long	.LASF94
+	.value	0x8000
+	.uleb128 0x8
+	.long	.LASF95
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF96
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF97
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF98
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF99
+	.uleb128 0xf
+	.long	0x588
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF100
+	.uleb128 0xf
+	.long	0x594
+	.uleb128 0x7
+	.long	.LASF101
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x14
+	.long	0x99
+	.uleb128 0xf
+	.long	0x5a0
+	.uleb128 0x30
+	.long	0x5bc
+	.uleb128 0x3
+	.long	0xbd
+	.byte	0
+	.uleb128 0x9
+	.long	0x5b1
+	.uleb128 0x7
+	.long	.LASF102
+	.byte	0xd
+	.byte	0xe
+	.byte	0x10
+	.long	0x5bc
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0xd
+	.byte	0x10
+	.byte	0x9
+	.long	0x5f1
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0xd
+	.byte	0x12
+	.byte	0x16
+	.long	0x5c1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0xd
+	.byte	0x13
+	.byte	0xb
+	.long	0xbd
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF105
+	.byte	0xd
+	.byte	0x14
+	.byte	0x3
+	.long	0x5cd
+	.uleb128 0x14
+	.byte	0x40
+	.byte	0xd
+	.byte	0x17
+	.byte	0x9
+	.long	0x648
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0xd
+	.byte	0x19
+	.byte	0x15
+	.long	0x2ce
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x16
+	.long	0x648
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x9
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x9
+	.long	0x46
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0xd
+	.byte	0x1d
+	.byte	0x9
+	.long	0x46
+	.byte	0x38
+	.byte	0
+	.uleb128 0x9
+	.long	0x5f1
+	.uleb128 0x7
+	.long	.LASF111
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x3
+	.long	0x5fd
+	.uleb128 0x14
+	.byte	0xb0
+	.byte	0xd
+	.byte	0x20
+	.byte	0x9
+	.long	0x6f2
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0xd
+	.byte	0x22
+	.byte	0x10
+	.long	0x6f2
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0xd
+	.byte	0x23
+	.byte	0x18
+	.long	0x6f7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0xd
+	.byte	0x24
+	.byte	0x9
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0xd
+	.byte	0x25
+	.byte	0x9
+	.long	0x46
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0xd
+	.byte	0x26
+	.byte	0x15
+	.long	0x2ce
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0xd
+	.byte	0x27
+	.byte	0x14
+	.long	0x317
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0xd
+	.byte	0x28
+	.byte	0x14
+	.long	0x317
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0xd
+	.byte	0x29
+	.byte	0x9
+	.long	0x46
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0xd
+	.byte	0x2a
+	.byte	0x9
+	.long	0x46
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0xd
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0xd
+	.byte	0x2c
+	.byte	0x9
+	.long	0x46
+	.byte	0xac
+	.byte	0
+	.uleb128 0x9
+	.long	0x285
+	.uleb128 0x9
+	.long	0x64d
+	.uleb128 0x7
+	.long	.LASF122
+	.byte	0xd
+	.byte	0x2d
+	.byte	0x3
+	.long	0x659
+	.uleb128 0x10
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF123
+	.uleb128 0x17
+	.long	0x73
+	.byte	0xf
+	.byte	0x15
+	.long	0x739
+	.uleb128 0x8
+	.long	.LASF124
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF125
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF126
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF127
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF128
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF129
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x3
+	.long	0x70f
+	.uleb128 0x17
+	.long	0x73
+	.byte	0xf
+	.byte	0x1e
+	.long	0x75d
+	.uleb128 0x8
+	.long	.LASF130
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF131
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF132
+	.byte	0xf
+	.byte	0x21
+	.byte	0x3
+	.long	0x745
+	.uleb128 0x17
+	.long	0x73
+	.byte	0xf
+	.byte	0x24
+	.long	0x787
+	.uleb128 0x8
+	.long	.LASF133
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF134
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF135
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF136
+	.byte	0xf
+	.byte	0x28
+	.byte	0x3
+	.long	0x769
+	.uleb128 0x14
+	.byte	0x28
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x9
+	.long	0x7de
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0xf
+	.byte	0x2c
+	.byte	0x14
+	.long	0x7de
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xb
+	.long	0xdc
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0xf
+	.byte	0x2e
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0xf
+	.byte	0x2f
+	.byte	0xd
+	.long	0xe8
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0xf
+	.byte	0x30
+	.byte	0x1c
+	.long	0x787
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	0x60
+	.uleb128 0x7
+	.long	.LASF142
+	.byte	0xf
+	.byte	0x31
+	.byte	0x3
+	.long	0x793
+	.uleb128 0x14
+	.byte	0x78
+	.byte	0xf
+	.byte	0x34
+	.byte	0x9
+	.long	0x8bb
+	.uleb128 0x1b
+	.string	"fd"
+	.byte	0xf
+	.byte	0x36
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0xf
+	.byte	0x37
+	.byte	0xb
+	.long	0xbd
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0xf
+	.byte	0x38
+	.byte	0xc
+	.long	0x2e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0xf
+	.byte	0x39
+	.byte	0xb
+	.long	0xbd
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0xf
+	.byte	0x3a
+	.byte	0xc
+	.long	0x2e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0xf
+	.byte	0x3b
+	.byte	0xb
+	.long	0xbd
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0xf
+	.byte	0x3c
+	.byte	0xc
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0xf
+	.byte	0x3d
+	.byte	0x13
+	.long	0x8bb
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0xf
+	.byte	0x3e
+	.byte	0x13
+	.long	0x8bb
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0xf
+	.byte	0x3f
+	.byte	0x13
+	.long	0x8bb
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0xf
+	.byte	0x40
+	.byte	0x13
+	.long	0x8bb
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0xf
+	.byte	0x41
+	.byte	0x13
+	.long	0x8bb
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0xf
+	.byte	0x42
+	.byte	0x13
+	.long	0x8bb
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0xf
+	.byte	0x43
+	.byte	0xb
+	.long	0xbd
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0xf
+	.byte	0x44
+	.byte	0x9
+	.long	0x46
+	.byte	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	0x73
+	.uleb128 0x7
+	.long	.LASF157
+	.byte	0xf
+	.byte	0x45
+	.byte	0x3
+	.long	0x7ef
+	.uleb128 0x26
+	.value	0x1f8
+	.byte	0xf
+	.byte	0x49
+	.long	0x9b2
+	.uleb128 0x1b
+	.string	"fd"
+	.byte	0xf
+	.byte	0x4b
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0xf
+	.byte	0x4c
+	.byte	0x15
+	.long	0x75d
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0xf
+	.byte	0x4d
+	.byte	0x18
+	.long	0x739
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0xf
+	.byte	0x4e
+	.byte	0x14
+	.long	0x7de
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0xf
+	.byte	0x4f
+	.byte	0x17
+	.long	0x9b2
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0xf
+	.byte	0x50
+	.byte	0x13
+	.long	0x3f
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0xf
+	.byte	0x51
+	.byte	0x13
+	.long	0x3f
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0xf
+	.byte	0x52
+	.byte	0xb
+	.long	0xdc
+	.byte	0xc8
+	.uleb128 0x1b
+	.string	"end"
+	.byte	0xf
+	.byte	0x53
+	.byte	0xb
+	.long	0xdc
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0xf
+	.byte	0x54
+	.byte	0x9
+	.long	0x46
+	.byte	0xd8
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0xf
+	.byte	0x55
+	.byte	0x15
+	.long	0x8c0
+	.byte	0xe0
+	.uleb128 0x18
+	.long	.LASF166
+	.byte	0x56
+	.byte	0xf
+	.long	0x285
+	.value	0x158
+	.uleb128 0x18
+	.long	.LASF106
+	.byte	0x57
+	.byte	0x15
+	.long	0x2ce
+	.value	0x160
+	.uleb128 0x18
+	.long	.LASF118
+	.byte	0x58
+	.byte	0x14
+	.long	0x317
+	.value	0x188
+	.uleb128 0x18
+	.long	.LASF167
+	.byte	0x59
+	.byte	0x14
+	.long	0x317
+	.value	0x1b8
+	.uleb128 0x18
+	.long	.LASF168
+	.byte	0x5a
+	.byte	0x13
+	.long	0x3f
+	.value	0x1e8
+	.uleb128 0x18
+	.long	.LASF169
+	.byte	0x5b
+	.byte	0x9
+	.long	0x46
+	.value	0x1f0
+	.byte	0
+	.uleb128 0xd
+	.long	0x7e3
+	.long	0x9c2
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF170
+	.byte	0xf
+	.byte	0x5c
+	.byte	0x3
+	.long	0x8cc
+	.uleb128 0x17
+	.long	0x73
+	.byte	0x10
+	.byte	0x14
+	.long	0x9fe
+	.uleb128 0x8
+	.long	.LASF171
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF172
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF173
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF174
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF175
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF176
+	.byte	0x5
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF177
+	.byte	0x10
+	.byte	0x1b
+	.byte	0x3
+	.long	0x9ce
+	.uleb128 0x26
+	.value	0x240
+	.byte	0x10
+	.byte	0x34
+	.long	0xaa2
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x10
+	.byte	0x36
+	.byte	0xb
+	.long	0x50c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x10
+	.byte	0x37
+	.byte	0x14
+	.long	0x9fe
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x10
+	.byte	0x38
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x10
+	.byte	0x39
+	.byte	0x12
+	.long	0x73
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x10
+	.byte	0x3a
+	.byte	0xa
+	.long	0x52
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x10
+	.byte	0x3b
+	.byte	0xa
+	.long	0x52
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x10
+	.byte	0x3c
+	.byte	0xb
+	.long	0xbd
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xc
+	.long	0x2e
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x10
+	.byte	0x3f
+	.byte	0xc
+	.long	0x2e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x10
+	.byte	0x40
+	.byte	0x9
+	.long	0x46
+	.byte	0x40
+	.uleb128 0x1b
+	.string	"io"
+	.byte	0x10
+	.byte	0x41
+	.byte	0x11
+	.long	0x9c2
+	.byte	0x48
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF188
+	.byte	0x10
+	.byte	0x42
+	.byte	0x3
+	.long	0xa0a
+	.uleb128 0xf
+	.long	0xaa2
+	.uleb128 0x17
+	.long	0x73
+	.byte	0x11
+	.byte	0x18
+	.long	0xaf5
+	.uleb128 0x8
+	.long	.LASF189
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF190
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF191
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF192
+	.byte	0x3
+	.uleb128 0x8
+	.long	.LASF193
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF195
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF196
+	.byte	0x7
+	.uleb128 0x8
+	.long	.LASF197
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF198
+	.byte	0x11
+	.byte	0x22
+	.byte	0x3
+	.long	0xab3
+	.uleb128 0x14
+	.byte	0x30
+	.byte	0x11
+	.byte	0x24
+	.byte	0x9
+	.long	0xb80
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x11
+	.byte	0x26
+	.byte	0x17
+	.long	0xaf5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0x11
+	.byte	0x27
+	.byte	0x12
+	.long	0x73
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x11
+	.byte	0x28
+	.byte	0x12
+	.long	0x73
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x11
+	.byte	0x29
+	.byte	0x14
+	.long	0x9fe
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x11
+	.byte	0x2a
+	.byte	0xb
+	.long	0x588
+	.byte	0x10
+	.uleb128 0x1b
+	.string	"snr"
+	.byte	0x11
+	.byte	0x2b
+	.byte	0xb
+	.long	0x588
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x11
+	.byte	0x2c
+	.byte	0x12
+	.long	0x73
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x11
+	.byte	0x2d
+	.byte	0xe
+	.long	0x5a0
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0x11
+	.byte	0x2e
+	.byte	0x9
+	.long	0x46
+	.byte	0x28
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF205
+	.byte	0x11
+	.byte	0x2f
+	.byte	0x3
+	.long	0xb01
+	.uleb128 0xf
+	.long	0xb80
+	.uleb128 0xd
+	.long	0x527
+	.long	0xba1
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x7
+	.byte	0
+	.uleb128 0xf
+	.long	0xb91
+	.uleb128 0x6
+	.long	.LASF234
+	.byte	0x20
+	.byte	0x1a
+	.long	0xba1
+	.uleb128 0x9
+	.byte	0x3
+	.quad	signalGeneratorTypeNames
+	.uleb128 0x31
+	.byte	0x28
+	.byte	0x1
+	.value	0x1cf
+	.byte	0x9
+	.long	0xc07
+	.uleb128 0x1c
+	.long	.LASF206
+	.value	0x1d1
+	.byte	0x1e
+	.long	0xc07
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF207
+	.value	0x1d2
+	.byte	0x1b
+	.long	0xc0c
+	.byte	0x8
+	.uleb128 0x1c
+	.long	.LASF208
+	.value	0x1d3
+	.byte	0xe
+	.long	0x5a0
+	.byte	0x10
+	.uleb128 0x1c
+	.long	.LASF110
+	.value	0x1d4
+	.byte	0xc
+	.long	0x2e
+	.byte	0x18
+	.uleb128 0x1c
+	.long	.LASF209
+	.value	0x1d5
+	.byte	0x9
+	.long	0x46
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	0xb8c
+	.uleb128 0x9
+	.long	0xaae
+	.uleb128 0x32
+	.long	.LASF210
+	.byte	0x1
+	.value	0x1d6
+	.byte	0x3
+	.long	0xbbb
+	.uleb128 0x22
+	.string	"pow"
+	.byte	0x8c
+	.long	0x594
+	.long	0xc37
+	.uleb128 0x3
+	.long	0x594
+	.uleb128 0x3
+	.long	0x594
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF211
+	.byte	0x12
+	.byte	0x69
+	.byte	0xc
+	.long	0x46
+	.long	0xc4d
+	.uleb128 0x3
+	.long	0x522
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF339
+	.byte	0xe
+	.byte	0x4f
+	.byte	0x23
+	.long	0xc59
+	.uleb128 0x9
+	.long	0x51d
+	.uleb128 0xe
+	.long	.LASF212
+	.byte	0x13
+	.byte	0x9c
+	.byte	0xc
+	.long	0x46
+	.long	0xc79
+	.uleb128 0x3
+	.long	0x522
+	.uleb128 0x3
+	.long	0x522
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF213
+	.byte	0x13
+	.byte	0x3d
+	.byte	0xe
+	.long	0xbd
+	.long	0xc99
+	.uleb128 0x3
+	.long	0xbd
+	.uleb128 0x3
+	.long	0x46
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF214
+	.byte	0x10
+	.byte	0xb4
+	.byte	0x5
+	.long	0x46
+	.long	0xcaf
+	.uleb128 0x3
+	.long	0xcaf
+	.byte	0
+	.uleb128 0x9
+	.long	0xaa2
+	.uleb128 0xe
+	.long	.LASF215
+	.byte	0x10
+	.byte	0x99
+	.byte	0x5
+	.long	0x46
+	.long	0xcd4
+	.uleb128 0x3
+	.long	0xcaf
+	.uleb128 0x3
+	.long	0xcd4
+	.uleb128 0x3
+	.long	0x46
+	.byte	0
+	.uleb128 0x9
+	.long	0x58f
+	.uleb128 0xe
+	.long	.LASF216
+	.byte	0x10
+	.byte	0x58
+	.byte	0xd
+	.long	0x522
+	.long	0xcef
+	.uleb128 0x3
+	.long	0x9fe
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF217
+	.byte	0x10
+	.byte	0x8f
+	.byte	0x5
+	.long	0x46
+	.long	0xd19
+	.uleb128 0x3
+	.long	0xcaf
+	.uleb128 0x3
+	.long	0x522
+	.uleb128 0x3
+	.long	0x9fe
+	.uleb128 0x3
+	.long	0x46
+	.uleb128 0x3
+	.long	0x73
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF218
+	.byte	0x14
+	.byte	0xe6
+	.byte	0xc
+	.long	0x46
+	.long	0xd2f
+	.uleb128 0x3
+	.long	0x50c
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF220
+	.byte	0x44
+	.long	0xd3f
+	.uleb128 0x3
+	.long	0xd3f
+	.byte	0
+	.uleb128 0x9
+	.long	0x6fc
+	.uleb128 0xe
+	.long	.LASF219
+	.byte	0xd
+	.byte	0x3e
+	.byte	0x5
+	.long	0x46
+	.long	0xd64
+	.uleb128 0x3
+	.long	0xd3f
+	.uleb128 0x3
+	.long	0x5c1
+	.uleb128 0x3
+	.long	0xbd
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF221
+	.byte	0x4a
+	.long	0xd74
+	.uleb128 0x3
+	.long	0xd3f
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF222
+	.byte	0x12
+	.value	0x22c
+	.byte	0xe
+	.long	0xbd
+	.long	0xd90
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF223
+	.byte	0x14
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0xda8
+	.uleb128 0x3
+	.long	0x522
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF224
+	.byte	0xd
+	.byte	0x35
+	.byte	0x5
+	.long	0x46
+	.long	0xdc3
+	.uleb128 0x3
+	.long	0xd3f
+	.uleb128 0x3
+	.long	0x46
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF225
+	.byte	0x14
+	.value	0x324
+	.long	0xdd5
+	.uleb128 0x3
+	.long	0x522
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF226
+	.byte	0x10
+	.byte	0xa2
+	.byte	0x5
+	.long	0x46
+	.long	0xdf0
+	.uleb128 0x3
+	.long	0xcaf
+	.uleb128 0x3
+	.long	0x52
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF227
+	.byte	0x12
+	.value	0x238
+	.long	0xe02
+	.uleb128 0x3
+	.long	0xbd
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF228
+	.byte	0x10
+	.byte	0xad
+	.byte	0x5
+	.long	0x46
+	.long	0xe27
+	.uleb128 0x3
+	.long	0xc0c
+	.uleb128 0x3
+	.long	0xcd4
+	.uleb128 0x3
+	.long	0x46
+	.uleb128 0x3
+	.long	0x52
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF229
+	.byte	0x12
+	.value	0x229
+	.byte	0xe
+	.long	0xbd
+	.long	0xe3e
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF230
+	.byte	0x15
+	.byte	0xa5
+	.byte	0x1
+	.long	0x594
+	.long	0xe54
+	.uleb128 0x3
+	.long	0x594
+	.byte	0
+	.uleb128 0x22
+	.string	"sin"
+	.byte	0x40
+	.long	0x594
+	.long	0xe68
+	.uleb128 0x3
+	.long	0x594
+	.byte	0
+	.uleb128 0x22
+	.string	"cos"
+	.byte	0x3e
+	.long	0x594
+	.long	0xe7c
+	.uleb128 0x3
+	.long	0x594
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF231
+	.byte	0x13
+	.byte	0x2b
+	.byte	0xe
+	.long	0xbd
+	.long	0xe9c
+	.uleb128 0x3
+	.long	0xbd
+	.uleb128 0x3
+	.long	0x323
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF232
+	.byte	0x15
+	.byte	0x8f
+	.byte	0x1
+	.long	0x594
+	.long	0xeb2
+	.uleb128 0x3
+	.long	0x594
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF236
+	.value	0x2f9
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB31
+	.quad	.LFE31-.LFB31
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf02
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x2f9
+	.byte	0x3d
+	.long	0xc07
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF233
+	.value	0x2f9
+	.byte	0x53
+	.long	0x522
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2
+	.long	.LASF235
+	.value	0x2fb
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF237
+	.value	0x2f4
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB30
+	.quad	.LFE30-.LFB30
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf52
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x2f4
+	.byte	0x3e
+	.long	0xc07
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF238
+	.value	0x2f4
+	.byte	0x4f
+	.long	0xf52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x2f4
+	.byte	0x5f
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x9
+	.long	0x588
+	.uleb128 0x19
+	.long	.LASF240
+	.value	0x2c5
+	.byte	0x5
+	.long	0x46
+	.quad	.LFB29
+	.quad	.LFE29-.LFB29
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfe3
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x2c5
+	.byte	0x3c
+	.long	0xc07
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF238
+	.value	0x2c5
+	.byte	0x4d
+	.long	0xf52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF208
+	.value	0x2c5
+	.byte	0x5f
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x2c6
+	.byte	0x2a
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x2
+	.long	.LASF235
+	.value	0x2c8
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x2
+	.long	.LASF241
+	.value	0x2c9
+	.byte	0x11
+	.long	0x58f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x2
+	.long	.LASF242
+	.value	0x2ca
+	.byte	0x14
+	.long	0x5ac
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF243
+	.byte	0x1
+	.value	0x2c0
+	.byte	0xa
+	.long	0x5a0
+	.quad	.LFB28
+	.quad	.LFE28-.LFB28
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1016
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x2c0
+	.byte	0x40
+	.long	0xc07
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF244
+	.value	0x2a4
+	.byte	0xe
+	.long	0x73
+	.quad	.LFB27
+	.quad	.LFE27-.LFB27
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1094
+	.uleb128 0x4
+	.long	.LASF201
+	.value	0x2a4
+	.byte	0x44
+	.long	0x522
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF235
+	.value	0x2a6
+	.byte	0x12
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x2
+	.long	.LASF245
+	.value	0x2a7
+	.byte	0xa
+	.long	0xd0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -29
+	.uleb128 0x2
+	.long	.LASF246
+	.value	0x2a8
+	.byte	0x12
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x5
+	.quad	.LBB44
+	.quad	.LBE44-.LBB44
+	.uleb128 0xa
+	.string	"i"
+	.value	0x2aa
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF247
+	.value	0x288
+	.byte	0xe
+	.long	0x73
+	.quad	.LFB26
+	.quad	.LFE26-.LFB26
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1112
+	.uleb128 0x4
+	.long	.LASF200
+	.value	0x288
+	.byte	0x40
+	.long	0x522
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF235
+	.value	0x28a
+	.byte	0x12
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x2
+	.long	.LASF245
+	.value	0x28b
+	.byte	0xa
+	.long	0xd0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -29
+	.uleb128 0x2
+	.long	.LASF246
+	.value	0x28c
+	.byte	0x12
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x5
+	.quad	.LBB43
+	.quad	.LBE43-.LBB43
+	.uleb128 0xa
+	.string	"i"
+	.value	0x28e
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF248
+	.value	0x27a
+	.byte	0x13
+	.long	0xaf5
+	.quad	.LFB25
+	.quad	.LFE25-.LFB25
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1163
+	.uleb128 0x4
+	.long	.LASF199
+	.value	0x27a
+	.byte	0x43
+	.long	0x522
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.quad	.LBB42
+	.quad	.LBE42-.LBB42
+	.uleb128 0xa
+	.string	"i"
+	.value	0x27c
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF340
+	.byte	0x1
+	.value	0x26e
+	.byte	0x6
+	.quad	.LFB24
+	.quad	.LFE24-.LFB24
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1192
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x26e
+	.byte	0x39
+	.long	0x1192
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x9
+	.long	0xb80
+	.uleb128 0x29
+	.long	.LASF250
+	.value	0x23a
+	.long	0x46
+	.quad	.LFB23
+	.quad	.LFE23-.LFB23
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1268
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x23a
+	.byte	0x44
+	.long	0xc07
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -648
+	.uleb128 0x4
+	.long	.LASF233
+	.value	0x23a
+	.byte	0x5a
+	.long	0x522
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -656
+	.uleb128 0x2
+	.long	.LASF235
+	.value	0x23c
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x2
+	.long	.LASF207
+	.value	0x23d
+	.byte	0x14
+	.long	0xaa2
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -640
+	.uleb128 0x2
+	.long	.LASF239
+	.value	0x23e
+	.byte	0x14
+	.long	0x5ac
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.quad	.LBB39
+	.quad	.LBE39-.LBB39
+	.uleb128 0x2
+	.long	.LASF249
+	.value	0x24c
+	.byte	0x10
+	.long	0xf52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.quad	.LBB40
+	.quad	.LBE40-.LBB40
+	.uleb128 0xa
+	.string	"n"
+	.value	0x253
+	.byte	0x17
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x5
+	.quad	.LBB41
+	.quad	.LBE41-.LBB41
+	.uleb128 0x2
+	.long	.LASF110
+	.value	0x255
+	.byte	0x17
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF251
+	.value	0x1f4
+	.long	0x46
+	.quad	.LFB22
+	.quad	.LFE22-.LFB22
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1365
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x1f4
+	.byte	0x46
+	.long	0xc07
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -248
+	.uleb128 0x4
+	.long	.LASF207
+	.value	0x1f4
+	.byte	0x60
+	.long	0xcaf
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -256
+	.uleb128 0x4
+	.long	.LASF233
+	.value	0x1f5
+	.byte	0x39
+	.long	0x522
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -264
+	.uleb128 0x2
+	.long	.LASF235
+	.value	0x1f7
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x2
+	.long	.LASF252
+	.value	0x1f8
+	.byte	0x12
+	.long	0x6fc
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x2
+	.long	.LASF239
+	.value	0x1f9
+	.byte	0x14
+	.long	0x5ac
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2
+	.long	.LASF253
+	.value	0x206
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x2
+	.long	.LASF254
+	.value	0x207
+	.byte	0x1d
+	.long	0x1365
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x5
+	.quad	.LBB36
+	.quad	.LBE36-.LBB36
+	.uleb128 0xa
+	.string	"n"
+	.value	0x210
+	.byte	0x13
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x5
+	.quad	.LBB37
+	.quad	.LBE37-.LBB37
+	.uleb128 0x2
+	.long	.LASF118
+	.value	0x212
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x5
+	.quad	.LBB38
+	.quad	.LBE38-.LBB38
+	.uleb128 0xa
+	.string	"i"
+	.value	0x21f
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xc11
+	.uleb128 0x1a
+	.long	.LASF256
+	.value	0x1dc
+	.quad	.LFB21
+	.quad	.LFE21-.LFB21
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x13f5
+	.uleb128 0x4
+	.long	.LASF104
+	.value	0x1dc
+	.byte	0x2d
+	.long	0xbd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x2
+	.long	.LASF255
+	.value	0x1de
+	.byte	0x1d
+	.long	0x1365
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2
+	.long	.LASF238
+	.value	0x1df
+	.byte	0xc
+	.long	0xf52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.quad	.LBB34
+	.quad	.LBE34-.LBB34
+	.uleb128 0xa
+	.string	"n"
+	.value	0x1e2
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB35
+	.quad	.LBE35-.LBB35
+	.uleb128 0x2
+	.long	.LASF110
+	.value	0x1e4
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF257
+	.value	0x19d
+	.quad	.LFB20
+	.quad	.LFE20-.LFB20
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1601
+	.uleb128 0x4
+	.long	.LASF238
+	.value	0x19d
+	.byte	0x2c
+	.long	0xf52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -17128
+	.uleb128 0x4
+	.long	.LASF208
+	.value	0x19d
+	.byte	0x3e
+	.long	0x5a0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -17136
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x19d
+	.byte	0x4c
+	.long	0x2e
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -17144
+	.uleb128 0x4
+	.long	.LASF204
+	.value	0x19d
+	.byte	0x63
+	.long	0x5a0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -17152
+	.uleb128 0x1e
+	.string	"rms"
+	.value	0x19d
+	.byte	0x6f
+	.long	0x588
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -17156
+	.uleb128 0x2
+	.long	.LASF258
+	.value	0x19f
+	.byte	0x11
+	.long	0x58f
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x2
+	.long	.LASF259
+	.value	0x1a0
+	.byte	0xe
+	.long	0x1601
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x2
+	.long	.LASF260
+	.value	0x1a2
+	.byte	0xb
+	.long	0x1611
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16752
+	.uleb128 0x2
+	.long	.LASF261
+	.value	0x1a3
+	.byte	0x12
+	.long	0x1622
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16896
+	.uleb128 0x2
+	.long	.LASF262
+	.value	0x1a4
+	.byte	0xe
+	.long	0x1601
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -17040
+	.uleb128 0x2
+	.long	.LASF263
+	.value	0x1a5
+	.byte	0xb
+	.long	0x1632
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -17120
+	.uleb128 0x15
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.long	0x14ed
+	.uleb128 0xa
+	.string	"r"
+	.value	0x1a7
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.uleb128 0xa
+	.string	"i"
+	.value	0x1ae
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x5
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.uleb128 0x2
+	.long	.LASF110
+	.value	0x1b0
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x2
+	.long	.LASF264
+	.value	0x1b1
+	.byte	0x18
+	.long	0x5ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.long	.LASF265
+	.value	0x1b2
+	.byte	0x10
+	.long	0xf52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x15
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.long	0x1590
+	.uleb128 0xa
+	.string	"r"
+	.value	0x1b4
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x5
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.uleb128 0x2
+	.long	.LASF266
+	.value	0x1b6
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.uleb128 0xa
+	.string	"k"
+	.value	0x1bd
+	.byte	0x15
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x5
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.uleb128 0xa
+	.string	"n"
+	.value	0x1bf
+	.byte	0x1c
+	.long	0x5ac
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x2
+	.long	.LASF267
+	.value	0x1c1
+	.byte	0x11
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x5
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.uleb128 0xa
+	.string	"r"
+	.value	0x1c6
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x5a0
+	.long	0x1611
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0x588
+	.long	0x1622
+	.uleb128 0x24
+	.long	0x3f
+	.value	0x101f
+	.byte	0
+	.uleb128 0xd
+	.long	0xcd4
+	.long	0x1632
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x10
+	.byte	0
+	.uleb128 0xd
+	.long	0x588
+	.long	0x1642
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0x11
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF268
+	.value	0x188
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1725
+	.uleb128 0x4
+	.long	.LASF238
+	.value	0x188
+	.byte	0x2d
+	.long	0xf52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16440
+	.uleb128 0x4
+	.long	.LASF208
+	.value	0x188
+	.byte	0x3f
+	.long	0x5a0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16448
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x188
+	.byte	0x4d
+	.long	0x2e
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16456
+	.uleb128 0x1e
+	.string	"key"
+	.value	0x188
+	.byte	0x64
+	.long	0x5a0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16464
+	.uleb128 0x1e
+	.string	"rms"
+	.value	0x188
+	.byte	0x6f
+	.long	0x588
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16468
+	.uleb128 0x2
+	.long	.LASF269
+	.value	0x18a
+	.byte	0xb
+	.long	0x1725
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16432
+	.uleb128 0x5
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.uleb128 0xa
+	.string	"i"
+	.value	0x18c
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.uleb128 0x2
+	.long	.LASF110
+	.value	0x18e
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.uleb128 0xa
+	.string	"k"
+	.value	0x191
+	.byte	0x15
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x588
+	.long	0x1736
+	.uleb128 0x24
+	.long	0x3f
+	.value	0xfff
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF270
+	.byte	0x1
+	.value	0x16f
+	.byte	0xd
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x17df
+	.uleb128 0x4
+	.long	.LASF238
+	.value	0x16f
+	.byte	0x35
+	.long	0xf52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF208
+	.value	0x16f
+	.byte	0x47
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x16f
+	.byte	0x55
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF201
+	.value	0x170
+	.byte	0x3b
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x4
+	.long	.LASF202
+	.value	0x170
+	.byte	0x4d
+	.long	0x588
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF271
+	.value	0x170
+	.byte	0x5c
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x2
+	.long	.LASF272
+	.value	0x172
+	.byte	0x12
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.uleb128 0xa
+	.string	"i"
+	.value	0x174
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF273
+	.value	0x153
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x18be
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x153
+	.byte	0x3c
+	.long	0xc07
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16456
+	.uleb128 0x4
+	.long	.LASF238
+	.value	0x153
+	.byte	0x4d
+	.long	0xf52
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16464
+	.uleb128 0x4
+	.long	.LASF208
+	.value	0x153
+	.byte	0x5f
+	.long	0x5a0
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16472
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x154
+	.byte	0x2a
+	.long	0x2e
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16480
+	.uleb128 0x2
+	.long	.LASF274
+	.value	0x156
+	.byte	0xb
+	.long	0x1725
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -16448
+	.uleb128 0xa
+	.string	"end"
+	.value	0x157
+	.byte	0x14
+	.long	0x5ac
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2
+	.long	.LASF272
+	.value	0x158
+	.byte	0xe
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.uleb128 0x2
+	.long	.LASF275
+	.value	0x15c
+	.byte	0x18
+	.long	0x5ac
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF276
+	.value	0x15d
+	.byte	0x18
+	.long	0x5ac
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2
+	.long	.LASF277
+	.value	0x15f
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0xa
+	.string	"out"
+	.value	0x160
+	.byte	0x10
+	.long	0xf52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF278
+	.value	0x125
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1a69
+	.uleb128 0x1e
+	.string	"out"
+	.value	0x125
+	.byte	0x32
+	.long	0xf52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -632
+	.uleb128 0x4
+	.long	.LASF208
+	.value	0x125
+	.byte	0x40
+	.long	0x5a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -640
+	.uleb128 0x4
+	.long	.LASF206
+	.value	0x125
+	.byte	0x60
+	.long	0xc07
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -648
+	.uleb128 0x2
+	.long	.LASF279
+	.value	0x127
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF280
+	.value	0x128
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x2
+	.long	.LASF281
+	.value	0x129
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x2
+	.long	.LASF282
+	.value	0x12a
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x2
+	.long	.LASF283
+	.value	0x12b
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xa
+	.string	"re"
+	.value	0x12c
+	.byte	0xc
+	.long	0x1a69
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0xa
+	.string	"im"
+	.value	0x12d
+	.byte	0xc
+	.long	0x1a69
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -368
+	.uleb128 0x2
+	.long	.LASF284
+	.value	0x12e
+	.byte	0xc
+	.long	0x1a69
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -496
+	.uleb128 0x2
+	.long	.LASF285
+	.value	0x12f
+	.byte	0xc
+	.long	0x1a69
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -624
+	.uleb128 0x15
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.long	0x19f8
+	.uleb128 0xa
+	.string	"j"
+	.value	0x131
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.uleb128 0xa
+	.string	"n"
+	.value	0x133
+	.byte	0x16
+	.long	0x59b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x2
+	.long	.LASF200
+	.value	0x134
+	.byte	0x10
+	.long	0x594
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x2
+	.long	.LASF286
+	.value	0x136
+	.byte	0x10
+	.long	0x594
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.uleb128 0xa
+	.string	"i"
+	.value	0x13f
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0xa
+	.string	"j"
+	.value	0x141
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x5
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.uleb128 0x2
+	.long	.LASF287
+	.value	0x144
+	.byte	0x1a
+	.long	0x59b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.long	.LASF288
+	.value	0x147
+	.byte	0x1a
+	.long	0x59b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x594
+	.long	0x1a79
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF289
+	.value	0x10e
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1b52
+	.uleb128 0x4
+	.long	.LASF238
+	.value	0x10e
+	.byte	0x29
+	.long	0xf52
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF208
+	.value	0x10e
+	.byte	0x3b
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF239
+	.value	0x10e
+	.byte	0x49
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF201
+	.value	0x10e
+	.byte	0x64
+	.long	0x73
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x4
+	.long	.LASF202
+	.value	0x10f
+	.byte	0x28
+	.long	0x588
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x2
+	.long	.LASF290
+	.value	0x111
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x2
+	.long	.LASF272
+	.value	0x112
+	.byte	0x18
+	.long	0x7a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x2
+	.long	.LASF109
+	.value	0x114
+	.byte	0x18
+	.long	0x7a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0xa
+	.string	"i"
+	.value	0x118
+	.byte	0x11
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.uleb128 0x2
+	.long	.LASF110
+	.value	0x11a
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF291
+	.byte	0xe3
+	.byte	0xd
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cda
+	.uleb128 0x16
+	.string	"out"
+	.byte	0xe3
+	.byte	0x2e
+	.long	0xf52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0xb
+	.long	.LASF292
+	.byte	0xe3
+	.byte	0x40
+	.long	0x73
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0x16
+	.string	"end"
+	.byte	0xe3
+	.byte	0x54
+	.long	0x73
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0xb
+	.long	.LASF201
+	.byte	0xe3
+	.byte	0x66
+	.long	0x73
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -116
+	.uleb128 0xb
+	.long	.LASF202
+	.byte	0xe4
+	.byte	0x2d
+	.long	0x588
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x6
+	.long	.LASF293
+	.byte	0xe6
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x6
+	.long	.LASF294
+	.byte	0xe8
+	.byte	0x17
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0x6
+	.long	.LASF295
+	.byte	0xea
+	.byte	0x1c
+	.long	0x7a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x6
+	.long	.LASF296
+	.byte	0xeb
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF297
+	.byte	0xed
+	.byte	0x1c
+	.long	0x7a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x6
+	.long	.LASF298
+	.byte	0xee
+	.byte	0x1c
+	.long	0x7a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF299
+	.byte	0xef
+	.byte	0x1c
+	.long	0x7a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0xc
+	.string	"to"
+	.byte	0xf0
+	.byte	0x1c
+	.long	0x7a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF110
+	.byte	0xf1
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.uleb128 0x6
+	.long	.LASF300
+	.byte	0xf3
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6
+	.long	.LASF301
+	.byte	0xf4
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x6
+	.long	.LASF302
+	.byte	0xf6
+	.byte	0x16
+	.long	0x59b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x6
+	.long	.LASF303
+	.byte	0xf7
+	.byte	0x10
+	.long	0xf52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x15
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.long	0x1cb8
+	.uleb128 0xc
+	.string	"i"
+	.byte	0xfb
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.uleb128 0xa
+	.string	"i"
+	.value	0x102
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF304
+	.byte	0xc7
+	.byte	0xd
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1db9
+	.uleb128 0x16
+	.string	"key"
+	.byte	0xc7
+	.byte	0x2f
+	.long	0x5a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2120
+	.uleb128 0xb
+	.long	.LASF305
+	.byte	0xc7
+	.byte	0x3d
+	.long	0x5a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2128
+	.uleb128 0xb
+	.long	.LASF110
+	.byte	0xc7
+	.byte	0x4b
+	.long	0x2e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2136
+	.uleb128 0xb
+	.long	.LASF260
+	.byte	0xc7
+	.byte	0x59
+	.long	0xf52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2144
+	.uleb128 0x6
+	.long	.LASF306
+	.byte	0xc9
+	.byte	0xb
+	.long	0x1db9
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2112
+	.uleb128 0x6
+	.long	.LASF307
+	.byte	0xca
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x6
+	.long	.LASF308
+	.byte	0xcc
+	.byte	0x13
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x5
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x6
+	.long	.LASF309
+	.byte	0xcf
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF310
+	.byte	0xd0
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x6
+	.long	.LASF311
+	.byte	0xd1
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xc
+	.string	"n"
+	.byte	0xd2
+	.byte	0x16
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x588
+	.long	0x1dca
+	.uleb128 0x24
+	.long	0x3f
+	.value	0x1ff
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF312
+	.byte	0x93
+	.byte	0xd
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1f69
+	.uleb128 0x16
+	.string	"key"
+	.byte	0x93
+	.byte	0x34
+	.long	0x5a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6232
+	.uleb128 0xb
+	.long	.LASF305
+	.byte	0x93
+	.byte	0x42
+	.long	0x5a0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6240
+	.uleb128 0xb
+	.long	.LASF310
+	.byte	0x93
+	.byte	0x4d
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6244
+	.uleb128 0xb
+	.long	.LASF260
+	.byte	0x93
+	.byte	0x60
+	.long	0xf52
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6256
+	.uleb128 0x6
+	.long	.LASF293
+	.byte	0x95
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF313
+	.byte	0x96
+	.byte	0xd
+	.long	0x1f69
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -1088
+	.uleb128 0x6
+	.long	.LASF314
+	.byte	0x97
+	.byte	0xd
+	.long	0x1f69
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -2112
+	.uleb128 0x6
+	.long	.LASF315
+	.byte	0x98
+	.byte	0xd
+	.long	0x1f69
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -3136
+	.uleb128 0x6
+	.long	.LASF316
+	.byte	0x99
+	.byte	0xd
+	.long	0x1f69
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -4160
+	.uleb128 0x6
+	.long	.LASF317
+	.byte	0x9a
+	.byte	0xc
+	.long	0x1f79
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6208
+	.uleb128 0x15
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.long	0x1ed6
+	.uleb128 0xc
+	.string	"j"
+	.byte	0x9c
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x6
+	.long	.LASF318
+	.byte	0x9e
+	.byte	0x18
+	.long	0x5ac
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xc
+	.string	"m"
+	.byte	0x9f
+	.byte	0x17
+	.long	0x100
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0xc
+	.string	"e"
+	.byte	0xa0
+	.byte	0x11
+	.long	0xf4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.long	0x1ef8
+	.uleb128 0xc
+	.string	"j"
+	.byte	0xa9
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x15
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.long	0x1f1a
+	.uleb128 0xc
+	.string	"j"
+	.byte	0xaf
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.uleb128 0xc
+	.string	"j"
+	.byte	0xb3
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x5
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0x6
+	.long	.LASF319
+	.byte	0xb5
+	.byte	0x10
+	.long	0x594
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6216
+	.uleb128 0x6
+	.long	.LASF320
+	.byte	0xb6
+	.byte	0x10
+	.long	0x594
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -6224
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xf4
+	.long	0x1f79
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0xd
+	.long	0x594
+	.long	0x1f89
+	.uleb128 0x11
+	.long	0x3f
+	.byte	0xff
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF321
+	.byte	0x74
+	.byte	0x14
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x207c
+	.uleb128 0xb
+	.long	.LASF295
+	.byte	0x74
+	.byte	0x40
+	.long	0x73
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -100
+	.uleb128 0xb
+	.long	.LASF322
+	.byte	0x74
+	.byte	0x57
+	.long	0x73
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0xb
+	.long	.LASF323
+	.byte	0x74
+	.byte	0x6f
+	.long	0x73
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -108
+	.uleb128 0xb
+	.long	.LASF293
+	.byte	0x75
+	.byte	0x3a
+	.long	0x594
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0xb
+	.long	.LASF319
+	.byte	0x75
+	.byte	0x52
+	.long	0x207c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0xb
+	.long	.LASF320
+	.byte	0x75
+	.byte	0x60
+	.long	0x207c
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x6
+	.long	.LASF296
+	.byte	0x77
+	.byte	0x18
+	.long	0x7a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xc
+	.string	"x"
+	.byte	0x79
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xc
+	.string	"s"
+	.byte	0x7a
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xc
+	.string	"c"
+	.byte	0x7b
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF324
+	.byte	0x7f
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF325
+	.byte	0x80
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF326
+	.byte	0x81
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6
+	.long	.LASF327
+	.byte	0x82
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.uleb128 0x6
+	.long	.LASF328
+	.byte	0x83
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.byte	0
+	.uleb128 0x9
+	.long	0x594
+	.uleb128 0x25
+	.long	.LASF329
+	.byte	0x65
+	.long	0x594
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x20f1
+	.uleb128 0xb
+	.long	.LASF330
+	.byte	0x65
+	.byte	0x32
+	.long	0xf4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0xb
+	.long	.LASF314
+	.byte	0x65
+	.byte	0x41
+	.long	0xf4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0xb
+	.long	.LASF315
+	.byte	0x65
+	.byte	0x50
+	.long	0xf4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0xc
+	.string	"x"
+	.byte	0x67
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xc
+	.string	"s"
+	.byte	0x68
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xc
+	.string	"s2"
+	.byte	0x69
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF331
+	.byte	0x55
+	.long	0x594
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x212b
+	.uleb128 0x16
+	.string	"x"
+	.byte	0x55
+	.byte	0x35
+	.long	0x594
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xc
+	.string	"x2"
+	.byte	0x57
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF332
+	.byte	0x49
+	.long	0x594
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2165
+	.uleb128 0x16
+	.string	"x"
+	.byte	0x49
+	.byte	0x35
+	.long	0x594
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xc
+	.string	"x2"
+	.byte	0x4b
+	.byte	0x12
+	.long	0x59b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF333
+	.byte	0x1
+	.byte	0x41
+	.byte	0x11
+	.long	0x5a0
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x21a4
+	.uleb128 0xb
+	.long	.LASF204
+	.byte	0x41
+	.byte	0x34
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xb
+	.long	.LASF334
+	.byte	0x41
+	.byte	0x47
+	.long	0x73
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF335
+	.byte	0x1
+	.byte	0x33
+	.byte	0x18
+	.long	0x5a0
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x16
+	.string	"key"
+	.byte	0x33
+	.byte	0x38
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xb
+	.long	.LASF305
+	.byte	0x33
+	.byte	0x46
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xc
+	.string	"z"
+	.byte	0x35
+	.byte	0xe
+	.long	0x5a0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF298:
+	.string	"octantEnd"
+.LASF256:
+	.string	"signalGenerator_ChunkTask"
+.LASF168:
+	.string	"serviced"
+.LASF143:
+	.string	"sqRing"
+.LASF47:
+	.string	"pthread_t"
+.LASF73:
+	.string	"_shortbuf"
+.LASF299:
+	.string	"from"
+.LASF185:
+	.string	"bufferSize"
+.LASF337:
+	.string	"_IO_lock_t"
+.LASF323:
+	.string	"quarter"
+.LASF315:
+	.string	"exponent"
+.LASF102:
+	.string	"ThreadPoolTask_t"
+.LASF179:
+	.string	"format"
+.LASF108:
+	.string	"capacity"
+.LASF62:
+	.string	"_IO_buf_end"
+.LASF333:
+	.string	"signalGenerator_StreamKey"
+.LASF220:
+	.string	"threadPool_Wait"
+.LASF104:
+	.string	"argument"
+.LASF339:
+	.string	"__ctype_b_loc"
+.LASF320:
+	.string	"cosine"
+.LASF218:
+	.string	"fflush"
+.LASF184:
+	.string	"buffer"
+.LASF181:
+	.string	"sampleRate"
+.LASF286:
+	.string	"increment"
+.LASF284:
+	.string	"rotationRe"
+.LASF115:
+	.string	"numOfQueues"
+.LASF60:
+	.string	"_IO_write_end"
+.LASF7:
+	.string	"unsigned int"
+.LASF265:
+	.string	"next"
+.LASF193:
+	.string	"GEN_SIGNAL_CHIRP"
+.LASF283:
+	.string	"accelerationIm"
+.LASF78:
+	.string	"_freeres_list"
+.LASF54:
+	.string	"_flags"
+.LASF109:
+	.string	"head"
+.LASF305:
+	.string	"index"
+.LASF11:
+	.string	"__int32_t"
+.LASF45:
+	.string	"__wrefs"
+.LASF258:
+	.string	"scale"
+.LASF326:
+	.string	"cosineNegative"
+.LASF209:
+	.string	"failed"
+.LASF152:
+	.string	"cqHead"
+.LASF66:
+	.string	"_markers"
+.LASF306:
+	.string	"pairs"
+.LASF224:
+	.string	"threadPool_Init"
+.LASF164:
+	.string	"error"
+.LASF295:
+	.string	"quadrant"
+.LASF158:
+	.string	"mode"
+.LASF312:
+	.string	"signalGenerator_GaussianPairs"
+.LASF173:
+	.string	"SAMPLE_FORMAT_F32"
+.LASF293:
+	.string	"radiansPerUnit"
+.LASF222:
+	.string	"calloc"
+.LASF289:
+	.string	"signalGenerator_Sine"
+.LASF280:
+	.string	"startFrequency"
+.LASF126:
+	.string	"ASYNC_FILE_BACKEND_URING"
+.LASF190:
+	.string	"GEN_SIGNAL_SINE"
+.LASF249:
+	.string	"outputSamples"
+.LASF207:
+	.string	"writer"
+.LASF131:
+	.string	"ASYNC_FILE_WRITE"
+.LASF134:
+	.string	"ASYNC_FILE_BUFFER_QUEUED"
+.LASF340:
+	.string	"signalGenerator_DefaultSettings"
+.LASF291:
+	.string	"signalGenerator_SineRange"
+.LASF170:
+	.string	"AsyncFile_t"
+.LASF162:
+	.string	"submitted"
+.LASF52:
+	.string	"pthread_cond_t"
+.LASF328:
+	.string	"cosineValue"
+.LASF29:
+	.string	"__pthread_internal_list"
+.LASF165:
+	.string	"ring"
+.LASF203:
+	.string	"endResolution"
+.LASF133:
+	.string	"ASYNC_FILE_BUFFER_FREE"
+.LASF338:
+	.string	"stdout"
+.LASF41:
+	.string	"__g1_start"
+.LASF139:
+	.string	"size"
+.LASF65:
+	.string	"_IO_save_end"
+.LASF32:
+	.string	"__count"
+.LASF268:
+	.string	"signalGenerator_AddWhite"
+.LASF172:
+	.string	"SAMPLE_FORMAT_TEXT"
+.LASF99:
+	.string	"float"
+.LASF85:
+	.string	"_IO_codecvt"
+.LASF232:
+	.string	"sqrt"
+.LASF229:
+	.string	"malloc"
+.LASF110:
+	.string	"count"
+.LASF194:
+	.string	"GEN_SIGNAL_WHITE"
+.LASF157:
+	.string	"AsyncFileRing_t"
+.LASF140:
+	.string	"result"
+.LASF217:
+	.string	"sampleIo_OpenWriter"
+.LASF24:
+	.string	"long long unsigned int"
+.LASF178:
+	.string	"file"
+.LASF307:
+	.string	"skip"
+.LASF215:
+	.string	"sampleIo_Write"
+.LASF255:
+	.string	"chunk"
+.LASF116:
+	.string	"workAvailable"
+.LASF198:
+	.string	"TypeOfGenSignal_t"
+.LASF297:
+	.string	"octantBegin"
+.LASF125:
+	.string	"ASYNC_FILE_BACKEND_AUTO"
+.LASF336:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF281:
+	.string	"sweep"
+.LASF33:
+	.string	"__owner"
+.LASF75:
+	.string	"_offset"
+.LASF121:
+	.string	"shutdown"
+.LASF43:
+	.string	"__g_size"
+.LASF37:
+	.string	"__elision"
+.LASF111:
+	.string	"ThreadPoolQueue_t"
+.LASF150:
+	.string	"sqMask"
+.LASF183:
+	.string	"dataOffset"
+.LASF304:
+	.string	"signalGenerator_Gaussian"
+.LASF107:
+	.string	"jobs"
+.LASF221:
+	.string	"threadPool_Destroy"
+.LASF88:
+	.string	"_ISlower"
+.LASF68:
+	.string	"_fileno"
+.LASF327:
+	.string	"sineValue"
+.LASF331:
+	.string	"signalGenerator_CosPoly"
+.LASF329:
+	.string	"signalGenerator_Log"
+.LASF262:
+	.string	"bases"
+.LASF10:
+	.string	"size_t"
+.LASF145:
+	.string	"cqRing"
+.LASF138:
+	.string	"offset"
+.LASF135:
+	.string	"ASYNC_FILE_BUFFER_DONE"
+.LASF91:
+	.string	"_ISxdigit"
+.LASF239:
+	.string	"numOfSamples"
+.LASF245:
+	.string	"character"
+.LASF57:
+	.string	"_IO_read_base"
+.LASF234:
+	.string	"signalGeneratorTypeNames"
+.LASF161:
+	.string	"buffers"
+.LASF278:
+	.string	"signalGenerator_ChirpInterval"
+.LASF227:
+	.string	"free"
+.LASF12:
+	.string	"__uint64_t"
+.LASF119:
+	.string	"pending"
+.LASF188:
+	.string	"SampleWriter_t"
+.LASF277:
+	.string	"whole"
+.LASF147:
+	.string	"sqes"
+.LASF252:
+	.string	"pool"
+.LASF21:
+	.string	"__high"
+.LASF332:
+	.string	"signalGenerator_SinPoly"
+.LASF27:
+	.string	"__next"
+.LASF206:
+	.string	"settings"
+.LASF274:
+	.string	"scratch"
+.LASF16:
+	.string	"char"
+.LASF214:
+	.string	"sampleIo_CloseWriter"
+.LASF187:
+	.string	"async"
+.LASF81:
+	.string	"_mode"
+.LASF233:
+	.string	"outputFileName"
+.LASF84:
+	.string	"_IO_marker"
+.LASF55:
+	.string	"_IO_read_ptr"
+.LASF246:
+	.string	"argNumber"
+.LASF160:
+	.string	"memory"
+.LASF195:
+	.string	"GEN_SIGNAL_PINK"
+.LASF189:
+	.string	"GEN_SIGNAL_UNKNOWN"
+.LASF137:
+	.string	"data"
+.LASF242:
+	.string	"whiteKey"
+.LASF18:
+	.string	"ssize_t"
+.LASF201:
+	.string	"resolution"
+.LASF26:
+	.string	"__prev"
+.LASF118:
+	.string	"queued"
+.LASF175:
+	.string	"SAMPLE_FORMAT_WAV_S16"
+.LASF316:
+	.string	"angle"
+.LASF318:
+	.string	"bits"
+.LASF247:
+	.string	"signalGenerator_processArgumentCycles"
+.LASF263:
+	.string	"sums"
+.LASF235:
+	.string	"retval"
+.LASF324:
+	.string	"swap"
+.LASF113:
+	.string	"queues"
+.LASF285:
+	.string	"rotationIm"
+.LASF58:
+	.string	"_IO_write_base"
+.LASF174:
+	.string	"SAMPLE_FORMAT_S16"
+.LASF238:
+	.string	"samples"
+.LASF243:
+	.string	"signalGenerator_NumOfSamples"
+.LASF136:
+	.string	"AsyncFileBufferState_t"
+.LASF38:
+	.string	"__list"
+.LASF4:
+	.string	"long long int"
+.LASF132:
+	.string	"AsyncFileMode_t"
+.LASF223:
+	.string	"printf"
+.LASF114:
+	.string	"numOfThreads"
+.LASF106:
+	.string	"lock"
+.LASF63:
+	.string	"_IO_save_base"
+.LASF103:
+	.string	"task"
+.LASF159:
+	.string	"backend"
+.LASF96:
+	.string	"_IScntrl"
+.LASF127:
+	.string	"ASYNC_FILE_BACKEND_THREAD"
+.LASF287:
+	.string	"nextRe"
+.LASF192:
+	.string	"GEN_SIGNAL_SAWTOOTH"
+.LASF180:
+	.string	"channels"
+.LASF237:
+	.string	"signalGenerator_generateSamples"
+.LASF90:
+	.string	"_ISdigit"
+.LASF213:
+	.string	"memset"
+.LASF276:
+	.string	"intervalEnd"
+.LASF301:
+	.string	"step"
+.LASF271:
+	.string	"square"
+.LASF92:
+	.string	"_ISspace"
+.LASF79:
+	.string	"_freeres_buf"
+.LASF64:
+	.string	"_IO_backup_base"
+.LASF310:
+	.string	"numOfPairs"
+.LASF302:
+	.string	"signedAmplitude"
+.LASF35:
+	.string	"__kind"
+.LASF80:
+	.string	"__pad5"
+.LASF260:
+	.string	"values"
+.LASF23:
+	.string	"__value32"
+.LASF171:
+	.string	"SAMPLE_FORMAT_UNKNOWN"
+.LASF204:
+	.string	"seed"
+.LASF154:
+	.string	"cqMask"
+.LASF309:
+	.string	"needed"
+.LASF72:
+	.string	"_vtable_offset"
+.LASF167:
+	.string	"done"
+.LASF169:
+	.string	"stop"
+.LASF335:
+	.string	"signalGenerator_Random"
+.LASF142:
+	.string	"AsyncFileBuffer_t"
+.LASF144:
+	.string	"sqRingSize"
+.LASF197:
+	.string	"GEN_SIGNAL_COUNT"
+.LASF28:
+	.string	"__pthread_list_t"
+.LASF123:
+	.string	"long double"
+.LASF296:
+	.string	"fold"
+.LASF230:
+	.string	"floor"
+.LASF317:
+	.string	"radius"
+.LASF156:
+	.string	"registered"
+.LASF259:
+	.string	"keys"
+.LASF288:
+	.string	"nextRotationRe"
+.LASF122:
+	.string	"ThreadPool_t"
+.LASF257:
+	.string	"signalGenerator_AddPink"
+.LASF244:
+	.string	"signalGenerator_processArgumentResolution"
+.LASF163:
+	.string	"completed"
+.LASF124:
+	.string	"ASYNC_FILE_BACKEND_UNKNOWN"
+.LASF196:
+	.string	"GEN_SIGNAL_SINE_NOISE"
+.LASF97:
+	.string	"_ISpunct"
+.LASF56:
+	.string	"_IO_read_end"
+.LASF282:
+	.string	"accelerationRe"
+.LASF248:
+	.string	"signalGenerator_processArgumentType"
+.LASF93:
+	.string	"_ISprint"
+.LASF149:
+	.string	"sqTail"
+.LASF9:
+	.string	"short int"
+.LASF216:
+	.string	"sampleIo_FormatName"
+.LASF205:
+	.string	"SignalGenerator_t"
+.LASF3:
+	.string	"long int"
+.LASF311:
+	.string	"available"
+.LASF279:
+	.string	"length"
+.LASF128:
+	.string	"ASYNC_FILE_BACKEND_STDIO"
+.LASF202:
+	.string	"amplitude"
+.LASF86:
+	.string	"_IO_wide_data"
+.LASF225:
+	.string	"perror"
+.LASF101:
+	.string	"uint64_t"
+.LASF236:
+	.string	"signalGenerator_generateSignal"
+.LASF15:
+	.string	"__ssize_t"
+.LASF176:
+	.string	"SAMPLE_FORMAT_WAV_F32"
+.LASF322:
+	.string	"remainder"
+.LASF48:
+	.string	"__data"
+.LASF94:
+	.string	"_ISgraph"
+.LASF264:
+	.string	"start"
+.LASF25:
+	.string	"__atomic_wide_counter"
+.LASF129:
+	.string	"AsyncFileBackend_t"
+.LASF146:
+	.string	"cqRingSize"
+.LASF319:
+	.string	"sine"
+.LASF34:
+	.string	"__nusers"
+.LASF77:
+	.string	"_wide_data"
+.LASF155:
+	.string	"cqes"
+.LASF241:
+	.string	"noiseRms"
+.LASF74:
+	.string	"_lock"
+.LASF240:
+	.string	"signalGenerator_generateBlock"
+.LASF22:
+	.string	"__value64"
+.LASF2:
+	.string	"long unsigned int"
+.LASF76:
+	.string	"_codecvt"
+.LASF70:
+	.string	"_old_offset"
+.LASF112:
+	.string	"threads"
+.LASF53:
+	.string	"_IO_FILE"
+.LASF275:
+	.string	"intervalStart"
+.LASF186:
+	.string	"bufferLength"
+.LASF19:
+	.string	"int32_t"
+.LASF89:
+	.string	"_ISalpha"
+.LASF273:
+	.string	"signalGenerator_Chirp"
+.LASF166:
+	.string	"thread"
+.LASF51:
+	.string	"pthread_mutex_t"
+.LASF31:
+	.string	"__lock"
+.LASF251:
+	.string	"signalGenerator_generateParallel"
+.LASF42:
+	.string	"__g_refs"
+.LASF321:
+	.string	"signalGenerator_SinCosQuadrant"
+.LASF199:
+	.string	"type"
+.LASF219:
+	.string	"threadPool_Submit"
+.LASF5:
+	.string	"unsigned char"
+.LASF105:
+	.string	"ThreadPoolJob_t"
+.LASF226:
+	.string	"sampleIo_ReserveFrames"
+.LASF59:
+	.string	"_IO_write_ptr"
+.LASF191:
+	.string	"GEN_SIGNAL_SQUARE"
+.LASF208:
+	.string	"first"
+.LASF267:
+	.string	"changed"
+.LASF177:
+	.string	"SampleFormat_t"
+.LASF250:
+	.string	"signalGenerator_generateToFile"
+.LASF39:
+	.string	"__pthread_cond_s"
+.LASF141:
+	.string	"state"
+.LASF98:
+	.string	"_ISalnum"
+.LASF228:
+	.string	"sampleIo_WriteFramesAt"
+.LASF117:
+	.string	"allDone"
+.LASF46:
+	.string	"__g_signals"
+.LASF40:
+	.string	"__wseq"
+.LASF20:
+	.string	"__low"
+.LASF266:
+	.string	"rowCount"
+.LASF314:
+	.string	"power"
+.LASF254:
+	.string	"chunks"
+.LASF36:
+	.string	"__spins"
+.LASF294:
+	.string	"octant"
+.LASF13:
+	.string	"__off_t"
+.LASF151:
+	.string	"sqArray"
+.LASF212:
+	.string	"strcmp"
+.LASF95:
+	.string	"_ISblank"
+.LASF8:
+	.string	"signed char"
+.LASF290:
+	.string	"period"
+.LASF148:
+	.string	"sqesSize"
+.LASF17:
+	.string	"off_t"
+.LASF6:
+	.string	"short unsigned int"
+.LASF292:
+	.string	"begin"
+.LASF261:
+	.string	"rows"
+.LASF231:
+	.string	"memcpy"
+.LASF270:
+	.string	"signalGenerator_SquareOrSawtooth"
+.LASF211:
+	.string	"atoi"
+.LASF182:
+	.string	"numOfFrames"
+.LASF253:
+	.string	"numOfChunks"
+.LASF130:
+	.string	"ASYNC_FILE_READ"
+.LASF100:
+	.string	"double"
+.LASF269:
+	.string	"noise"
+.LASF303:
+	.string	"octantOut"
+.LASF300:
+	.string	"units"
+.LASF44:
+	.string	"__g1_orig_size"
+.LASF50:
+	.string	"__align"
+.LASF200:
+	.string	"cycles"
+.LASF67:
+	.string	"_chain"
+.LASF87:
+	.string	"_ISupper"
+.LASF313:
+	.string	"magnitude"
+.LASF120:
+	.string	"nextQueue"
+.LASF83:
+	.string	"FILE"
+.LASF69:
+	.string	"_flags2"
+.LASF325:
+	.string	"sineNegative"
+.LASF49:
+	.string	"__size"
+.LASF71:
+	.string	"_cur_column"
+.LASF330:
+	.string	"value"
+.LASF153:
+	.string	"cqTail"
+.LASF308:
+	.string	"pair"
+.LASF272:
+	.string	"position"
+.LASF14:
+	.string	"__off64_t"
+.LASF82:
+	.string	"_unused2"
+.LASF61:
+	.string	"_IO_buf_base"
+.LASF210:
+	.string	"SignalGeneratorChunk_t"
+.LASF30:
+	.string	"__pthread_mutex_s"
+.LASF334:
+	.string	"stream"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/signalGenerator.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1356 @@
+	.file	"spscRing.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/spscRing.c"
+	.type	spscRing_Wait, @function
+spscRing_Wait:
+.LFB6:
+	.file 1 "source/spscRing.c"
+	.loc 1 24 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	DWORD PTR -20[rbp], edi
+	.loc 1 25 8
+	cmp	DWORD PTR -20[rbp], 63
+	ja	.L2
+	.loc 1 27 9
+	call	sched_yield@PLT
+	.loc 1 34 1
+	jmp	.L4
+.L2:
+.LBB2:
+	.loc 1 31 31
+	mov	QWORD PTR -16[rbp], 0
+	mov	QWORD PTR -8[rbp], 20000
+	.loc 1 32 9
+	lea	rax, -16[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	nanosleep@PLT
+.L4:
+.LBE2:
+	.loc 1 34 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	spscRing_Wait, .-spscRing_Wait
+	.section	.rodata
+.LC0:
+	.string	"Error allocating ring buffer"
+	.text
+	.globl	spscRing_Init
+	.type	spscRing_Init, @function
+spscRing_Init:
+.LFB7:
+	.loc 1 37 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	DWORD PTR -28[rbp], esi
+	mov	QWORD PTR -40[rbp], rdx
+	.loc 1 38 18
+	mov	DWORD PTR -4[rbp], 1
+	.loc 1 40 11
+	jmp	.L6
+.L7:
+	.loc 1 42 14
+	sal	DWORD PTR -4[rbp]
+.L6:
+	.loc 1 40 17
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -28[rbp]
+	jb	.L7
+	.loc 1 44 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR -4[rbp]
+	mov	DWORD PTR 16[rax], edx
+	.loc 1 45 55
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 63
+	.loc 1 45 60
+	and	rax, -64
+	mov	rdx, rax
+	.loc 1 45 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 46 16
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 64[rax], 0
+	.loc 1 47 16
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 128[rax], 0
+	.loc 1 48 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 68[rax], 0
+	.loc 1 49 75
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	.loc 1 49 35
+	mov	eax, DWORD PTR -4[rbp]
+	imul	rax, rdx
+	mov	rsi, rax
+	mov	edi, 64
+	call	aligned_alloc@PLT
+	mov	rdx, rax
+	.loc 1 49 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 50 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 50 8
+	test	rax, rax
+	jne	.L8
+	.loc 1 52 9
+	lea	rax, .LC0[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 53 16
+	mov	eax, 1
+	jmp	.L9
+.L8:
+	.loc 1 55 12
+	mov	eax, 0
+.L9:
+	.loc 1 56 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	spscRing_Init, .-spscRing_Init
+	.globl	spscRing_Free
+	.type	spscRing_Free, @function
+spscRing_Free:
+.LFB8:
+	.loc 1 59 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 60 14
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 60 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 61 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	QWORD PTR [rax], 0
+	.loc 1 62 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	spscRing_Free, .-spscRing_Free
+	.globl	spscRing_AcquireWrite
+	.type	spscRing_AcquireWrite, @function
+spscRing_AcquireWrite:
+.LFB9:
+	.loc 1 65 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 66 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	mov	DWORD PTR -8[rbp], eax
+.LBB3:
+	.loc 1 69 23
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 69 5
+	jmp	.L12
+.L13:
+	.loc 1 71 9 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	mov	edi, eax
+	call	spscRing_Wait
+	.loc 1 69 112 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L12:
+	.loc 1 69 57 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	sub	rax, -128
+	.loc 1 69 41 discriminator 1
+	mov	eax, DWORD PTR [rax]
+	.loc 1 69 39 discriminator 1
+	mov	edx, DWORD PTR -8[rbp]
+	sub	edx, eax
+	.loc 1 69 95 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 69 88 discriminator 1
+	cmp	edx, eax
+	je	.L13
+.LBE3:
+	.loc 1 73 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 73 46
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 73 57
+	sub	eax, 1
+	.loc 1 73 39
+	and	eax, DWORD PTR -8[rbp]
+	.loc 1 73 25
+	mov	ecx, eax
+	.loc 1 73 69
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 73 63
+	imul	rax, rcx
+	.loc 1 73 12
+	add	rax, rdx
+	.loc 1 74 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	spscRing_AcquireWrite, .-spscRing_AcquireWrite
+	.globl	spscRing_CommitWrite
+	.type	spscRing_CommitWrite, @function
+spscRing_CommitWrite:
+.LFB10:
+	.loc 1 77 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 78 39
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 64[rax]
+	.loc 1 78 5
+	lea	edx, 1[rax]
+	.loc 1 78 22
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 64
+	.loc 1 78 5
+	mov	DWORD PTR [rax], edx
+	.loc 1 79 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	spscRing_CommitWrite, .-spscRing_CommitWrite
+	.globl	spscRing_Close
+	.type	spscRing_Close, @function
+spscRing_Close:
+.LFB11:
+	.loc 1 82 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 83 22
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 68
+	.loc 1 83 5
+	mov	edx, 1
+	mov	DWORD PTR [rax], edx
+	.loc 1 84 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	spscRing_Close, .-spscRing_Close
+	.globl	spscRing_AcquireRead
+	.type	spscRing_AcquireRead, @function
+spscRing_AcquireRead:
+.LFB12:
+	.loc 1 87 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 88 24
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	mov	DWORD PTR -8[rbp], eax
+.LBB4:
+	.loc 1 90 23
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 90 5
+	jmp	.L18
+.L23:
+	.loc 1 93 29
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 68
+	.loc 1 93 13
+	mov	eax, DWORD PTR [rax]
+	.loc 1 93 12
+	test	eax, eax
+	je	.L19
+	.loc 1 95 33
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 64
+	.loc 1 95 17
+	mov	eax, DWORD PTR [rax]
+	.loc 1 95 16
+	cmp	DWORD PTR -8[rbp], eax
+	jne	.L24
+	.loc 1 97 24
+	mov	eax, 0
+	jmp	.L21
+.L19:
+	.loc 1 101 9 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	mov	edi, eax
+	call	spscRing_Wait
+	.loc 1 90 95 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L18:
+	.loc 1 90 50 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 64
+	.loc 1 90 34 discriminator 1
+	mov	eax, DWORD PTR [rax]
+	.loc 1 90 81 discriminator 1
+	cmp	DWORD PTR -8[rbp], eax
+	je	.L23
+	jmp	.L22
+.L24:
+	.loc 1 99 13
+	nop
+.L22:
+.LBE4:
+	.loc 1 103 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR [rax]
+	.loc 1 103 46
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 103 57
+	sub	eax, 1
+	.loc 1 103 39
+	and	eax, DWORD PTR -8[rbp]
+	.loc 1 103 25
+	mov	ecx, eax
+	.loc 1 103 69
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 103 63
+	imul	rax, rcx
+	.loc 1 103 12
+	add	rax, rdx
+.L21:
+	.loc 1 104 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	spscRing_AcquireRead, .-spscRing_AcquireRead
+	.globl	spscRing_ReleaseRead
+	.type	spscRing_ReleaseRead, @function
+spscRing_ReleaseRead:
+.LFB13:
+	.loc 1 107 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 108 39
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	.loc 1 108 5
+	lea	edx, 1[rax]
+	.loc 1 108 22
+	mov	rax, QWORD PTR -8[rbp]
+	sub	rax, -128
+	.loc 1 108 5
+	mov	DWORD PTR [rax], edx
+	.loc 1 109 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	spscRing_ReleaseRead, .-spscRing_ReleaseRead
+.Letext0:
+	.file 2 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 5 "include/spscRing.h"
+	.file 6 "/usr/include/stdlib.h"
+	.file 7 "/usr/include/time.h"
+	.file 8 "/usr/include/sched.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x3b3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xe
+	.long	.LASF37
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x7
+	.long	.LASF10
+	.byte	0x2
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xb
+	.long	0x64
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x7
+	.long	.LASF11
+	.byte	0x3
+	.byte	0xa0
+	.byte	0x1a
+	.long	0x48
+	.uleb128 0x10
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF12
+	.byte	0x3
+	.byte	0xc5
+	.byte	0x21
+	.long	0x48
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF13
+	.uleb128 0x11
+	.long	.LASF38
+	.byte	0x10
+	.byte	0x4
+	.byte	0xb
+	.byte	0x8
+	.long	0xc7
+	.uleb128 0x3
+	.long	.LASF14
+	.byte	0x4
+	.byte	0x10
+	.byte	0xc
+	.long	0x7e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF15
+	.byte	0x4
+	.byte	0x15
+	.byte	0x15
+	.long	0x8c
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0x9f
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF16
+	.uleb128 0x1
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF17
+	.uleb128 0x12
+	.byte	0xc0
+	.byte	0x40
+	.byte	0x5
+	.byte	0x12
+	.byte	0x9
+	.long	0x131
+	.uleb128 0x3
+	.long	.LASF18
+	.byte	0x5
+	.byte	0x14
+	.byte	0x14
+	.long	0x131
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF19
+	.byte	0x5
+	.byte	0x15
+	.byte	0xc
+	.long	0x2e
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF20
+	.byte	0x5
+	.byte	0x16
+	.byte	0x12
+	.long	0x64
+	.byte	0x10
+	.uleb128 0xc
+	.long	.LASF22
+	.byte	0x17
+	.long	0x64
+	.byte	0x40
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF21
+	.byte	0x5
+	.byte	0x18
+	.byte	0x9
+	.long	0x41
+	.byte	0x44
+	.uleb128 0xc
+	.long	.LASF23
+	.byte	0x19
+	.long	0x64
+	.byte	0x40
+	.byte	0x80
+	.byte	0
+	.uleb128 0x6
+	.long	0x56
+	.uleb128 0x13
+	.long	.LASF39
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x3
+	.long	0xda
+	.byte	0x40
+	.uleb128 0x14
+	.long	.LASF40
+	.byte	0x6
+	.value	0x238
+	.byte	0xd
+	.long	0x156
+	.uleb128 0x5
+	.long	0x8a
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF24
+	.byte	0x6
+	.value	0x25d
+	.byte	0xe
+	.long	0x8a
+	.long	0x172
+	.uleb128 0x5
+	.long	0x2e
+	.uleb128 0x5
+	.long	0x2e
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF25
+	.byte	0x7
+	.value	0x119
+	.byte	0xc
+	.long	0x41
+	.long	0x18e
+	.uleb128 0x5
+	.long	0x18e
+	.uleb128 0x5
+	.long	0x193
+	.byte	0
+	.uleb128 0x6
+	.long	0xc7
+	.uleb128 0x6
+	.long	0x9f
+	.uleb128 0x15
+	.long	.LASF41
+	.byte	0x8
+	.byte	0x44
+	.byte	0xc
+	.long	0x41
+	.uleb128 0x8
+	.long	.LASF28
+	.byte	0x6a
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1cf
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x6a
+	.byte	0x27
+	.long	0x1cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x6
+	.long	0x136
+	.uleb128 0x9
+	.long	.LASF31
+	.byte	0x56
+	.byte	0x7
+	.long	0x8a
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x232
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x56
+	.byte	0x28
+	.long	0x1cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF23
+	.byte	0x58
+	.byte	0x18
+	.long	0x6b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x5a
+	.byte	0x17
+	.long	0x64
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF29
+	.byte	0x51
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x25d
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x51
+	.byte	0x21
+	.long	0x1cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF30
+	.byte	0x4c
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x288
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x4c
+	.byte	0x27
+	.long	0x1cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF32
+	.byte	0x40
+	.byte	0x7
+	.long	0x8a
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x2e6
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x40
+	.byte	0x29
+	.long	0x1cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF22
+	.byte	0x42
+	.byte	0x18
+	.long	0x6b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xa
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0x4
+	.long	.LASF27
+	.byte	0x45
+	.byte	0x17
+	.long	0x64
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF33
+	.byte	0x1
+	.byte	0x3a
+	.byte	0x6
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x313
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x3a
+	.byte	0x20
+	.long	0x1cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF34
+	.byte	0x24
+	.byte	0x5
+	.long	0x41
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x36d
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x24
+	.byte	0x1f
+	.long	0x1cf
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x2
+	.long	.LASF20
+	.byte	0x24
+	.byte	0x32
+	.long	0x64
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x2
+	.long	.LASF19
+	.byte	0x24
+	.byte	0x43
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF35
+	.byte	0x26
+	.byte	0x12
+	.long	0x64
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF42
+	.byte	0x1
+	.byte	0x17
+	.byte	0xd
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x17
+	.byte	0x28
+	.long	0x64
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0xa
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x4
+	.long	.LASF36
+	.byte	0x1f
+	.byte	0x1f
+	.long	0xc7
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF30:
+	.string	"spscRing_CommitWrite"
+.LASF26:
+	.string	"ring"
+.LASF10:
+	.string	"size_t"
+.LASF20:
+	.string	"capacity"
+.LASF28:
+	.string	"spscRing_ReleaseRead"
+.LASF15:
+	.string	"tv_nsec"
+.LASF36:
+	.string	"pause"
+.LASF39:
+	.string	"SpscRing_t"
+.LASF38:
+	.string	"timespec"
+.LASF24:
+	.string	"aligned_alloc"
+.LASF35:
+	.string	"size"
+.LASF18:
+	.string	"slots"
+.LASF2:
+	.string	"long unsigned int"
+.LASF6:
+	.string	"short unsigned int"
+.LASF21:
+	.string	"closed"
+.LASF11:
+	.string	"__time_t"
+.LASF5:
+	.string	"unsigned char"
+.LASF34:
+	.string	"spscRing_Init"
+.LASF22:
+	.string	"head"
+.LASF14:
+	.string	"tv_sec"
+.LASF7:
+	.string	"unsigned int"
+.LASF16:
+	.string	"long long unsigned int"
+.LASF23:
+	.string	"tail"
+.LASF37:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF40:
+	.string	"free"
+.LASF4:
+	.string	"long long int"
+.LASF13:
+	.string	"char"
+.LASF42:
+	.string	"spscRing_Wait"
+.LASF41:
+	.string	"sched_yield"
+.LASF9:
+	.string	"short int"
+.LASF33:
+	.string	"spscRing_Free"
+.LASF19:
+	.string	"slotSize"
+.LASF31:
+	.string	"spscRing_AcquireRead"
+.LASF29:
+	.string	"spscRing_Close"
+.LASF3:
+	.string	"long int"
+.LASF27:
+	.string	"waits"
+.LASF17:
+	.string	"long double"
+.LASF32:
+	.string	"spscRing_AcquireWrite"
+.LASF8:
+	.string	"signed char"
+.LASF25:
+	.string	"nanosleep"
+.LASF12:
+	.string	"__syscall_slong_t"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/spscRing.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6944 @@
+	.file	"subbandFilter.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/subbandFilter.c"
+	.type	subbandFilter_BesselI0, @function
+subbandFilter_BesselI0:
+.LFB6:
+	.file 1 "source/subbandFilter.c"
+	.loc 1 42 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	movsd	QWORD PTR -40[rbp], xmm0
+	.loc 1 43 12
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 44 12
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	movsd	QWORD PTR -16[rbp], xmm0
+.LBB2:
+	.loc 1 46 14
+	mov	DWORD PTR -20[rbp], 1
+	.loc 1 46 5
+	jmp	.L2
+.L6:
+	.loc 1 48 27
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, DWORD PTR -20[rbp]
+	movapd	xmm2, xmm0
+	addsd	xmm2, xmm0
+	.loc 1 48 20
+	movsd	xmm0, QWORD PTR -40[rbp]
+	movapd	xmm1, xmm0
+	divsd	xmm1, xmm2
+	.loc 1 48 45
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, DWORD PTR -20[rbp]
+	movapd	xmm2, xmm0
+	addsd	xmm2, xmm0
+	.loc 1 48 38
+	movsd	xmm0, QWORD PTR -40[rbp]
+	divsd	xmm0, xmm2
+	.loc 1 48 33
+	mulsd	xmm0, xmm1
+	.loc 1 48 14
+	movsd	xmm1, QWORD PTR -16[rbp]
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 49 13
+	movsd	xmm0, QWORD PTR -8[rbp]
+	addsd	xmm0, QWORD PTR -16[rbp]
+	movsd	QWORD PTR -8[rbp], xmm0
+	.loc 1 50 26
+	movsd	xmm1, QWORD PTR -8[rbp]
+	movsd	xmm0, QWORD PTR .LC1[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 50 12
+	comisd	xmm0, QWORD PTR -16[rbp]
+	ja	.L8
+	.loc 1 46 30 discriminator 2
+	add	DWORD PTR -20[rbp], 1
+.L2:
+	.loc 1 46 23 discriminator 1
+	cmp	DWORD PTR -20[rbp], 49
+	jle	.L6
+	jmp	.L5
+.L8:
+	.loc 1 52 13
+	nop
+.L5:
+.LBE2:
+	.loc 1 55 12
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movq	rax, xmm0
+	.loc 1 56 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	subbandFilter_BesselI0, .-subbandFilter_BesselI0
+	.type	subbandFilter_DesignLowpass, @function
+subbandFilter_DesignLowpass:
+.LFB7:
+	.loc 1 66 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 96
+	mov	QWORD PTR -72[rbp], rdi
+	mov	DWORD PTR -76[rbp], esi
+	movsd	QWORD PTR -88[rbp], xmm0
+	movsd	QWORD PTR -96[rbp], xmm1
+	.loc 1 67 35
+	mov	eax, DWORD PTR -76[rbp]
+	sub	eax, 1
+	.loc 1 67 40
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, eax
+	.loc 1 67 18
+	movsd	xmm1, QWORD PTR .LC2[rip]
+	divsd	xmm0, xmm1
+	movsd	QWORD PTR -24[rbp], xmm0
+	.loc 1 68 25
+	mov	rax, QWORD PTR .LC3[rip]
+	movq	xmm0, rax
+	call	subbandFilter_BesselI0
+	movq	rax, xmm0
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 69 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBB3:
+	.loc 1 71 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 71 5
+	jmp	.L10
+.L14:
+.LBB4:
+	.loc 1 73 28
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, DWORD PTR -12[rbp]
+	.loc 1 73 22
+	subsd	xmm0, QWORD PTR -24[rbp]
+	movsd	QWORD PTR -40[rbp], xmm0
+	.loc 1 74 22
+	movsd	xmm0, QWORD PTR -40[rbp]
+	divsd	xmm0, QWORD PTR -24[rbp]
+	movsd	QWORD PTR -48[rbp], xmm0
+	.loc 1 75 55
+	pxor	xmm0, xmm0
+	ucomisd	xmm0, QWORD PTR -40[rbp]
+	jp	.L11
+	pxor	xmm0, xmm0
+	ucomisd	xmm0, QWORD PTR -40[rbp]
+	jne	.L11
+	.loc 1 75 55 is_stmt 0 discriminator 1
+	movsd	xmm0, QWORD PTR -88[rbp]
+	addsd	xmm0, xmm0
+	jmp	.L13
+.L11:
+	.loc 1 75 72 is_stmt 1 discriminator 2
+	movsd	xmm1, QWORD PTR -88[rbp]
+	movsd	xmm0, QWORD PTR .LC5[rip]
+	mulsd	xmm0, xmm1
+	.loc 1 75 57 discriminator 2
+	mulsd	xmm0, QWORD PTR -40[rbp]
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	sin@PLT
+	movq	rax, xmm0
+	.loc 1 75 94 discriminator 2
+	movsd	xmm1, QWORD PTR -40[rbp]
+	movsd	xmm0, QWORD PTR .LC6[rip]
+	mulsd	xmm1, xmm0
+	.loc 1 75 55 discriminator 2
+	movq	xmm0, rax
+	divsd	xmm0, xmm1
+.L13:
+	.loc 1 75 22 discriminator 4
+	movsd	QWORD PTR -56[rbp], xmm0
+	.loc 1 76 100 discriminator 4
+	movsd	xmm0, QWORD PTR -48[rbp]
+	movapd	xmm1, xmm0
+	mulsd	xmm1, xmm0
+	.loc 1 76 83 discriminator 4
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	subsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	sqrt@PLT
+	.loc 1 76 31 discriminator 4
+	movsd	xmm1, QWORD PTR .LC3[rip]
+	mulsd	xmm0, xmm1
+	movq	rax, xmm0
+	movq	xmm0, rax
+	call	subbandFilter_BesselI0
+	movq	rax, xmm0
+	.loc 1 76 22 discriminator 4
+	movq	xmm0, rax
+	divsd	xmm0, QWORD PTR -32[rbp]
+	movsd	QWORD PTR -64[rbp], xmm0
+	.loc 1 78 32 discriminator 4
+	movsd	xmm0, QWORD PTR -56[rbp]
+	mulsd	xmm0, QWORD PTR -64[rbp]
+	.loc 1 78 13 discriminator 4
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	.loc 1 78 19 discriminator 4
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 78 17 discriminator 4
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 79 20 discriminator 4
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 79 13 discriminator 4
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBE4:
+	.loc 1 71 34 discriminator 4
+	add	DWORD PTR -12[rbp], 1
+.L10:
+	.loc 1 71 23 discriminator 2
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -76[rbp]
+	jl	.L14
+.LBE3:
+.LBB5:
+	.loc 1 81 14
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 81 5
+	jmp	.L15
+.L16:
+	.loc 1 83 31 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 83 35 discriminator 3
+	mulsd	xmm0, QWORD PTR -96[rbp]
+	.loc 1 83 42 discriminator 3
+	divsd	xmm0, QWORD PTR -8[rbp]
+	.loc 1 83 13 discriminator 3
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -72[rbp]
+	add	rax, rdx
+	.loc 1 83 19 discriminator 3
+	cvtsd2ss	xmm0, xmm0
+	.loc 1 83 17 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 81 34 discriminator 3
+	add	DWORD PTR -16[rbp], 1
+.L15:
+	.loc 1 81 23 discriminator 1
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -76[rbp]
+	jl	.L16
+.LBE5:
+	.loc 1 85 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	subbandFilter_DesignLowpass, .-subbandFilter_DesignLowpass
+	.type	subbandFilter_HistoryPush, @function
+subbandFilter_HistoryPush:
+.LFB8:
+	.loc 1 91 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	DWORD PTR -12[rbp], esi
+	mov	DWORD PTR -16[rbp], edx
+	movss	DWORD PTR -20[rbp], xmm0
+	.loc 1 92 12
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	.loc 1 92 20
+	movss	xmm0, DWORD PTR -20[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 93 19
+	mov	edx, DWORD PTR -16[rbp]
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 93 12
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, rdx
+	.loc 1 93 27
+	movss	xmm0, DWORD PTR -20[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 94 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	subbandFilter_HistoryPush, .-subbandFilter_HistoryPush
+	.type	subbandFilter_Analyse, @function
+subbandFilter_Analyse:
+.LFB9:
+	.loc 1 103 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	.loc 1 104 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 105 12
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 264[rax]
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 110 5
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rcx, QWORD PTR -48[rbp]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+.LBB6:
+	.loc 1 111 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 111 5
+	jmp	.L20
+.L21:
+	.loc 1 113 12 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 113 25 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 113 41 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 113 12 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 113 16 discriminator 3
+	mulss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 111 38 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L20:
+	.loc 1 111 23 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L21
+.LBE6:
+.LBB7:
+	.loc 1 115 14
+	mov	eax, DWORD PTR -20[rbp]
+	mov	DWORD PTR -8[rbp], eax
+	.loc 1 115 5
+	jmp	.L22
+.L25:
+.LBB8:
+	.loc 1 117 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 117 9
+	jmp	.L23
+.L24:
+	.loc 1 119 16 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 119 29 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	.loc 1 119 48 discriminator 3
+	mov	ecx, DWORD PTR -8[rbp]
+	mov	edx, DWORD PTR -12[rbp]
+	add	edx, ecx
+	movsx	rdx, edx
+	.loc 1 119 45 discriminator 3
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 119 64 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	mov	eax, DWORD PTR -12[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 119 61 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 119 53 discriminator 3
+	mulss	xmm0, xmm2
+	.loc 1 119 16 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rax, rdx
+	.loc 1 119 20 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 117 42 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L23:
+	.loc 1 117 27 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L24
+.LBE8:
+	.loc 1 115 65 discriminator 2
+	mov	eax, DWORD PTR -20[rbp]
+	add	DWORD PTR -8[rbp], eax
+.L22:
+	.loc 1 115 40 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 115 58 discriminator 1
+	sub	eax, 1
+	.loc 1 115 32 discriminator 1
+	cmp	DWORD PTR -8[rbp], eax
+	jl	.L25
+.LBE7:
+	.loc 1 122 8
+	mov	rax, QWORD PTR -32[rbp]
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 122 21
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 80[rax]
+	.loc 1 122 44
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 122 37
+	sal	rax, 2
+	sub	rax, 4
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 122 82
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 122 75
+	sal	rax, 2
+	lea	rdx, -4[rax]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 122 67
+	mulss	xmm0, xmm2
+	.loc 1 122 12
+	addss	xmm0, xmm1
+	mov	rax, QWORD PTR -32[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 124 11
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 256[rax]
+	.loc 1 124 26
+	mov	rdx, QWORD PTR -32[rbp]
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 124 21
+	movss	DWORD PTR [rax], xmm0
+.LBB9:
+	.loc 1 125 14
+	mov	DWORD PTR -16[rbp], 1
+	.loc 1 125 5
+	jmp	.L26
+.L27:
+	.loc 1 127 42 discriminator 3
+	mov	eax, DWORD PTR -20[rbp]
+	sub	eax, DWORD PTR -16[rbp]
+	cdqe
+	.loc 1 127 30 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -32[rbp]
+	add	rdx, rax
+	.loc 1 127 15 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 256[rax]
+	.loc 1 127 21 discriminator 3
+	mov	ecx, DWORD PTR -16[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	add	rax, rcx
+	.loc 1 127 30 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 127 25 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 125 38 discriminator 3
+	add	DWORD PTR -16[rbp], 1
+.L26:
+	.loc 1 125 23 discriminator 1
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -20[rbp]
+	jl	.L27
+.LBE9:
+	.loc 1 129 37
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 256[rax]
+	.loc 1 129 17
+	mov	rdx, QWORD PTR -40[rbp]
+	lea	rcx, 32[rdx]
+	.loc 1 129 5
+	mov	rdx, QWORD PTR -56[rbp]
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	fft_Forward@PLT
+	.loc 1 130 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	subbandFilter_Analyse, .-subbandFilter_Analyse
+	.type	subbandFilter_Synthesize, @function
+subbandFilter_Synthesize:
+.LFB10:
+	.loc 1 139 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	.loc 1 140 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -16[rbp], eax
+	.loc 1 141 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	mov	DWORD PTR -20[rbp], eax
+	.loc 1 142 15
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	mov	DWORD PTR -24[rbp], eax
+.LBB10:
+	.loc 1 144 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 144 5
+	jmp	.L29
+.L30:
+	.loc 1 146 43 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	cdqe
+	.loc 1 146 40 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rdx, rax
+	.loc 1 146 15 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 264[rax]
+	.loc 1 146 28 discriminator 3
+	mov	ecx, DWORD PTR -4[rbp]
+	add	ecx, ecx
+	movsx	rcx, ecx
+	.loc 1 146 25 discriminator 3
+	sal	rcx, 2
+	add	rax, rcx
+	.loc 1 146 40 discriminator 3
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 146 33 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 147 48 discriminator 3
+	mov	eax, DWORD PTR -4[rbp]
+	add	eax, eax
+	.loc 1 147 45 discriminator 3
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -48[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 147 15 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 264[rax]
+	.loc 1 147 28 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	add	edx, edx
+	.loc 1 147 25 discriminator 3
+	movsx	rdx, edx
+	add	rdx, 1
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 147 39 discriminator 3
+	movss	xmm1, DWORD PTR .LC7[rip]
+	xorps	xmm0, xmm1
+	.loc 1 147 37 discriminator 3
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 144 45 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L29:
+	.loc 1 144 31 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 144 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], eax
+	jl	.L30
+.LBE10:
+	.loc 1 149 5
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdx, QWORD PTR 256[rax]
+	.loc 1 149 37
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 264[rax]
+	.loc 1 149 17
+	mov	rcx, QWORD PTR -40[rbp]
+	add	rcx, 32
+	.loc 1 149 5
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	fft_Inverse@PLT
+.LBB11:
+	.loc 1 152 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 152 5
+	jmp	.L31
+.L34:
+.LBB12:
+	.loc 1 154 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 154 9
+	jmp	.L32
+.L33:
+	.loc 1 156 19 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 152[rax]
+	.loc 1 156 28 discriminator 3
+	mov	ecx, DWORD PTR -8[rbp]
+	mov	edx, DWORD PTR -12[rbp]
+	add	edx, ecx
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 156 45 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 156 65 discriminator 3
+	mov	ecx, DWORD PTR -8[rbp]
+	mov	edx, DWORD PTR -12[rbp]
+	add	edx, ecx
+	movsx	rdx, edx
+	.loc 1 156 62 discriminator 3
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 156 78 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 256[rax]
+	.loc 1 156 84 discriminator 3
+	mov	edx, DWORD PTR -12[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 156 70 discriminator 3
+	mulss	xmm0, xmm2
+	.loc 1 156 19 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 152[rax]
+	.loc 1 156 28 discriminator 3
+	mov	ecx, DWORD PTR -8[rbp]
+	mov	edx, DWORD PTR -12[rbp]
+	add	edx, ecx
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	.loc 1 156 36 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 154 42 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L32:
+	.loc 1 154 27 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -16[rbp]
+	jl	.L33
+.LBE12:
+	.loc 1 152 39 discriminator 2
+	mov	eax, DWORD PTR -16[rbp]
+	add	DWORD PTR -8[rbp], eax
+.L31:
+	.loc 1 152 32 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	sub	eax, 1
+	.loc 1 152 23 discriminator 1
+	cmp	DWORD PTR -8[rbp], eax
+	jl	.L34
+.LBE11:
+	.loc 1 159 11
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 152[rax]
+	.loc 1 159 20
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	sub	rdx, 4
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 159 42
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	.loc 1 159 59
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	sub	rdx, 4
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 159 80
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 256[rax]
+	.loc 1 159 86
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 159 72
+	mulss	xmm0, xmm2
+	.loc 1 159 11
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 152[rax]
+	.loc 1 159 20
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	sub	rdx, 4
+	add	rax, rdx
+	.loc 1 159 33
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 160 5
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 160 33
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR 152[rax]
+	.loc 1 160 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 160[rax]
+	.loc 1 160 5
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memcpy@PLT
+	.loc 1 161 68
+	mov	eax, DWORD PTR -24[rbp]
+	sub	eax, DWORD PTR -20[rbp]
+	cdqe
+	.loc 1 161 5
+	lea	rdx, 0[0+rax*4]
+	.loc 1 161 37
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 152[rax]
+	.loc 1 161 46
+	mov	ecx, DWORD PTR -20[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	.loc 1 161 30
+	add	rcx, rax
+	.loc 1 161 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 152[rax]
+	.loc 1 161 5
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	memmove@PLT
+	.loc 1 162 5
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 162 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rcx, QWORD PTR 152[rax]
+	.loc 1 162 36
+	mov	eax, DWORD PTR -24[rbp]
+	sub	eax, DWORD PTR -20[rbp]
+	cdqe
+	.loc 1 162 28
+	sal	rax, 2
+	.loc 1 162 12
+	add	rax, rcx
+	.loc 1 162 5
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 163 24
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 168[rax], 0
+	.loc 1 164 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	subbandFilter_Synthesize, .-subbandFilter_Synthesize
+	.type	subbandFilter_AdaptBands, @function
+subbandFilter_AdaptBands:
+.LFB11:
+	.loc 1 175 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 352
+	mov	QWORD PTR -328[rbp], rdi
+	mov	DWORD PTR -332[rbp], esi
+	mov	DWORD PTR -336[rbp], edx
+	mov	DWORD PTR -340[rbp], ecx
+	.loc 1 176 15
+	mov	rax, QWORD PTR -328[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	mov	DWORD PTR -56[rbp], eax
+	.loc 1 177 34
+	mov	rax, QWORD PTR -328[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 177 15
+	add	eax, eax
+	mov	DWORD PTR -60[rbp], eax
+	.loc 1 178 65
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -56[rbp]
+	.loc 1 178 18
+	movsd	xmm0, QWORD PTR .LC8[rip]
+	mulsd	xmm0, xmm1
+	movsd	QWORD PTR -72[rbp], xmm0
+	.loc 1 179 31
+	mov	rax, QWORD PTR -328[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 179 18
+	cvtss2sd	xmm0, xmm0
+	movsd	QWORD PTR -80[rbp], xmm0
+	.loc 1 180 18
+	mov	rax, QWORD PTR -328[rbp]
+	mov	rax, QWORD PTR 224[rax]
+	mov	QWORD PTR -88[rbp], rax
+	.loc 1 181 12
+	mov	rax, QWORD PTR -328[rbp]
+	mov	rax, QWORD PTR 232[rax]
+	mov	QWORD PTR -96[rbp], rax
+.LBB13:
+	.loc 1 183 14
+	mov	eax, DWORD PTR -332[rbp]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 183 5
+	jmp	.L36
+.L53:
+.LBB14:
+	.loc 1 185 44
+	mov	rax, QWORD PTR -328[rbp]
+	mov	rcx, QWORD PTR 176[rax]
+	.loc 1 185 56
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 185 66
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 185 55
+	sal	rax, 2
+	.loc 1 185 25
+	add	rax, rcx
+	mov	QWORD PTR -104[rbp], rax
+	.loc 1 186 44
+	mov	rax, QWORD PTR -328[rbp]
+	mov	rcx, QWORD PTR 184[rax]
+	.loc 1 186 56
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 186 66
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	imul	rax, rdx
+	.loc 1 186 55
+	sal	rax, 2
+	.loc 1 186 25
+	add	rax, rcx
+	mov	QWORD PTR -112[rbp], rax
+	.loc 1 187 35
+	mov	rax, QWORD PTR -328[rbp]
+	mov	rcx, QWORD PTR 192[rax]
+	.loc 1 187 46
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 187 28
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	imul	rax, rdx
+	sal	rax, 3
+	.loc 1 187 16
+	add	rax, rcx
+	mov	QWORD PTR -120[rbp], rax
+	.loc 1 188 35
+	mov	rax, QWORD PTR -328[rbp]
+	mov	rcx, QWORD PTR 200[rax]
+	.loc 1 188 46
+	mov	eax, DWORD PTR -4[rbp]
+	movsx	rdx, eax
+	.loc 1 188 28
+	mov	eax, DWORD PTR -56[rbp]
+	cdqe
+	imul	rax, rdx
+	sal	rax, 3
+	.loc 1 188 16
+	add	rax, rcx
+	mov	QWORD PTR -128[rbp], rax
+	.loc 1 189 30
+	mov	rax, QWORD PTR -328[rbp]
+	mov	rax, QWORD PTR 216[rax]
+	.loc 1 189 41
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 189 16
+	movsd	xmm0, QWORD PTR [rax]
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 190 13
+	mov	rax, QWORD PTR -328[rbp]
+	mov	eax, DWORD PTR 208[rax]
+	mov	DWORD PTR -20[rbp], eax
+.LBB15:
+	.loc 1 192 18
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 192 9
+	jmp	.L37
+.L52:
+.LBB16:
+	.loc 1 194 44
+	mov	eax, DWORD PTR -24[rbp]
+	imul	eax, DWORD PTR -60[rbp]
+	.loc 1 194 57
+	mov	edx, DWORD PTR -4[rbp]
+	add	edx, edx
+	.loc 1 194 53
+	add	eax, edx
+	cdqe
+	.loc 1 194 41
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 194 25
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -132[rbp], xmm0
+	.loc 1 195 44
+	mov	eax, DWORD PTR -24[rbp]
+	imul	eax, DWORD PTR -60[rbp]
+	.loc 1 195 57
+	mov	edx, DWORD PTR -4[rbp]
+	add	edx, edx
+	.loc 1 195 53
+	add	eax, edx
+	.loc 1 195 41
+	cdqe
+	add	rax, 1
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -88[rbp]
+	add	rax, rdx
+	.loc 1 195 25
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -136[rbp], xmm0
+	.loc 1 196 43
+	mov	eax, DWORD PTR -24[rbp]
+	imul	eax, DWORD PTR -60[rbp]
+	.loc 1 196 56
+	mov	edx, DWORD PTR -4[rbp]
+	add	edx, edx
+	.loc 1 196 52
+	add	eax, edx
+	cdqe
+	.loc 1 196 40
+	lea	rdx, 0[0+rax*4]
+	.loc 1 196 20
+	mov	rax, QWORD PTR -96[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -144[rbp], rax
+	.loc 1 199 22
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, DWORD PTR -132[rbp]
+	.loc 1 199 34
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -132[rbp]
+	mulsd	xmm1, xmm0
+	.loc 1 199 42
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, DWORD PTR -136[rbp]
+	.loc 1 199 54
+	pxor	xmm0, xmm0
+	cvtss2sd	xmm0, DWORD PTR -136[rbp]
+	mulsd	xmm0, xmm2
+	.loc 1 199 40
+	addsd	xmm0, xmm1
+	.loc 1 200 42
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -120[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 200 25
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, xmm1
+	.loc 1 200 61
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -120[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	cvtss2sd	xmm1, xmm1
+	.loc 1 200 50
+	mulsd	xmm2, xmm1
+	.loc 1 200 88
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -128[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 200 71
+	pxor	xmm3, xmm3
+	cvtss2sd	xmm3, xmm1
+	.loc 1 200 107
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -128[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	cvtss2sd	xmm1, xmm1
+	.loc 1 200 96
+	mulsd	xmm1, xmm3
+	.loc 1 200 69
+	addsd	xmm1, xmm2
+	.loc 1 200 22
+	subsd	xmm0, xmm1
+	.loc 1 199 19
+	movsd	xmm1, QWORD PTR -16[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 201 16
+	pxor	xmm0, xmm0
+	comisd	xmm0, QWORD PTR -16[rbp]
+	jbe	.L38
+	.loc 1 203 23
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -16[rbp], xmm0
+.L38:
+	.loc 1 205 13
+	mov	esi, DWORD PTR -132[rbp]
+	mov	edx, DWORD PTR -20[rbp]
+	mov	ecx, DWORD PTR -56[rbp]
+	mov	rax, QWORD PTR -120[rbp]
+	movd	xmm0, esi
+	mov	esi, ecx
+	mov	rdi, rax
+	call	subbandFilter_HistoryPush
+	.loc 1 206 13
+	mov	esi, DWORD PTR -136[rbp]
+	mov	edx, DWORD PTR -20[rbp]
+	mov	ecx, DWORD PTR -56[rbp]
+	mov	rax, QWORD PTR -128[rbp]
+	movd	xmm0, esi
+	mov	esi, ecx
+	mov	rdi, rax
+	call	subbandFilter_HistoryPush
+	.loc 1 207 16
+	add	DWORD PTR -20[rbp], 1
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jne	.L40
+	.loc 1 209 23
+	mov	DWORD PTR -20[rbp], 0
+.L40:
+	.loc 1 211 56
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 211 35
+	mov	rax, QWORD PTR -120[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -152[rbp], rax
+	.loc 1 212 56
+	mov	eax, DWORD PTR -20[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 212 35
+	mov	rax, QWORD PTR -128[rbp]
+	add	rax, rdx
+	mov	QWORD PTR -160[rbp], rax
+	.loc 1 215 16
+	cmp	DWORD PTR -20[rbp], 0
+	jne	.L41
+	.loc 1 217 23
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -16[rbp], xmm0
+.LBB17:
+	.loc 1 218 26
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 218 17
+	jmp	.L42
+.L43:
+	.loc 1 220 46 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -152[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 220 30 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 220 60 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -152[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 220 50 discriminator 3
+	mulsd	xmm1, xmm0
+	.loc 1 220 82 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 220 66 discriminator 3
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, xmm0
+	.loc 1 220 96 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 220 86 discriminator 3
+	mulsd	xmm0, xmm2
+	.loc 1 220 64 discriminator 3
+	addsd	xmm0, xmm1
+	.loc 1 220 27 discriminator 3
+	movsd	xmm1, QWORD PTR -16[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -16[rbp], xmm0
+	.loc 1 218 44 discriminator 3
+	add	DWORD PTR -28[rbp], 1
+.L42:
+	.loc 1 218 35 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jl	.L43
+.L41:
+.LBE17:
+	.loc 1 225 19
+	pxor	xmm0, xmm0
+	movaps	XMMWORD PTR -320[rbp], xmm0
+	movaps	XMMWORD PTR -304[rbp], xmm0
+	movaps	XMMWORD PTR -288[rbp], xmm0
+	movaps	XMMWORD PTR -272[rbp], xmm0
+	.loc 1 226 19
+	pxor	xmm0, xmm0
+	movaps	XMMWORD PTR -256[rbp], xmm0
+	movaps	XMMWORD PTR -240[rbp], xmm0
+	movaps	XMMWORD PTR -224[rbp], xmm0
+	movaps	XMMWORD PTR -208[rbp], xmm0
+.LBB18:
+	.loc 1 227 22
+	mov	DWORD PTR -32[rbp], 0
+	.loc 1 227 13
+	jmp	.L44
+.L47:
+.LBB19:
+	.loc 1 229 26
+	mov	DWORD PTR -36[rbp], 0
+	.loc 1 229 17
+	jmp	.L45
+.L46:
+	.loc 1 231 26 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	movss	xmm1, DWORD PTR -320[rbp+rax*4]
+	.loc 1 231 45 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 231 42 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 231 63 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 231 60 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -152[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 231 50 discriminator 3
+	mulss	xmm0, xmm2
+	.loc 1 231 82 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 231 79 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rdx
+	movss	xmm3, DWORD PTR [rax]
+	.loc 1 231 100 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 231 97 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 231 87 discriminator 3
+	mulss	xmm2, xmm3
+	.loc 1 231 68 discriminator 3
+	subss	xmm0, xmm2
+	.loc 1 231 30 discriminator 3
+	addss	xmm0, xmm1
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	movss	DWORD PTR -320[rbp+rax*4], xmm0
+	.loc 1 232 26 discriminator 3
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	movss	xmm1, DWORD PTR -256[rbp+rax*4]
+	.loc 1 232 45 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 232 42 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 232 63 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 232 60 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 232 50 discriminator 3
+	mulss	xmm2, xmm0
+	.loc 1 232 82 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 232 79 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rdx
+	movss	xmm3, DWORD PTR [rax]
+	.loc 1 232 100 discriminator 3
+	mov	edx, DWORD PTR -32[rbp]
+	mov	eax, DWORD PTR -36[rbp]
+	add	eax, edx
+	cdqe
+	.loc 1 232 97 discriminator 3
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -152[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 232 87 discriminator 3
+	mulss	xmm0, xmm3
+	.loc 1 232 68 discriminator 3
+	addss	xmm0, xmm2
+	.loc 1 232 30 discriminator 3
+	addss	xmm0, xmm1
+	mov	eax, DWORD PTR -36[rbp]
+	cdqe
+	movss	DWORD PTR -256[rbp+rax*4], xmm0
+	.loc 1 229 60 discriminator 3
+	add	DWORD PTR -36[rbp], 1
+.L45:
+	.loc 1 229 35 discriminator 1
+	cmp	DWORD PTR -36[rbp], 15
+	jle	.L46
+.LBE19:
+	.loc 1 227 41 discriminator 2
+	add	DWORD PTR -32[rbp], 16
+.L44:
+	.loc 1 227 31 discriminator 1
+	mov	eax, DWORD PTR -32[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jl	.L47
+.LBE18:
+	.loc 1 235 19
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -40[rbp], xmm0
+	.loc 1 236 19
+	pxor	xmm0, xmm0
+	movss	DWORD PTR -44[rbp], xmm0
+.LBB20:
+	.loc 1 237 22
+	mov	DWORD PTR -48[rbp], 0
+	.loc 1 237 13
+	jmp	.L48
+.L49:
+	.loc 1 239 29 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	movss	xmm0, DWORD PTR -320[rbp+rax*4]
+	.loc 1 239 21 discriminator 3
+	movss	xmm1, DWORD PTR -40[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -40[rbp], xmm0
+	.loc 1 240 29 discriminator 3
+	mov	eax, DWORD PTR -48[rbp]
+	cdqe
+	movss	xmm0, DWORD PTR -256[rbp+rax*4]
+	.loc 1 240 21 discriminator 3
+	movss	xmm1, DWORD PTR -44[rbp]
+	addss	xmm0, xmm1
+	movss	DWORD PTR -44[rbp], xmm0
+	.loc 1 237 56 discriminator 3
+	add	DWORD PTR -48[rbp], 1
+.L48:
+	.loc 1 237 31 discriminator 1
+	cmp	DWORD PTR -48[rbp], 15
+	jle	.L49
+.LBE20:
+	.loc 1 243 35
+	mov	rax, QWORD PTR -144[rbp]
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 243 25
+	subss	xmm0, DWORD PTR -40[rbp]
+	movss	DWORD PTR -164[rbp], xmm0
+	.loc 1 244 35
+	mov	rax, QWORD PTR -144[rbp]
+	add	rax, 4
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 244 25
+	subss	xmm0, DWORD PTR -44[rbp]
+	movss	DWORD PTR -168[rbp], xmm0
+	.loc 1 245 54
+	movsd	xmm0, QWORD PTR -16[rbp]
+	movapd	xmm1, xmm0
+	addsd	xmm1, QWORD PTR -72[rbp]
+	.loc 1 245 45
+	movsd	xmm0, QWORD PTR -80[rbp]
+	divsd	xmm0, xmm1
+	.loc 1 245 25
+	cvtsd2ss	xmm0, xmm0
+	movss	DWORD PTR -172[rbp], xmm0
+	.loc 1 246 25
+	movss	xmm0, DWORD PTR -172[rbp]
+	mulss	xmm0, DWORD PTR -164[rbp]
+	movss	DWORD PTR -176[rbp], xmm0
+	.loc 1 247 25
+	movss	xmm0, DWORD PTR -172[rbp]
+	mulss	xmm0, DWORD PTR -168[rbp]
+	movss	DWORD PTR -180[rbp], xmm0
+.LBB21:
+	.loc 1 248 22
+	mov	DWORD PTR -52[rbp], 0
+	.loc 1 248 13
+	jmp	.L50
+.L51:
+	.loc 1 250 26 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 250 47 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -152[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 250 37 discriminator 3
+	movaps	xmm2, xmm0
+	mulss	xmm2, DWORD PTR -176[rbp]
+	.loc 1 250 67 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 250 57 discriminator 3
+	mulss	xmm0, DWORD PTR -180[rbp]
+	.loc 1 250 51 discriminator 3
+	addss	xmm0, xmm2
+	.loc 1 250 26 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -104[rbp]
+	add	rax, rdx
+	.loc 1 250 30 discriminator 3
+	addss	xmm0, xmm1
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 251 26 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rdx
+	movss	xmm2, DWORD PTR [rax]
+	.loc 1 251 47 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -152[rbp]
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 251 37 discriminator 3
+	mulss	xmm0, DWORD PTR -180[rbp]
+	.loc 1 251 67 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -160[rbp]
+	add	rax, rdx
+	movss	xmm1, DWORD PTR [rax]
+	.loc 1 251 57 discriminator 3
+	mulss	xmm1, DWORD PTR -176[rbp]
+	.loc 1 251 51 discriminator 3
+	subss	xmm0, xmm1
+	.loc 1 251 26 discriminator 3
+	mov	eax, DWORD PTR -52[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -112[rbp]
+	add	rax, rdx
+	.loc 1 251 30 discriminator 3
+	addss	xmm0, xmm2
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 248 40 discriminator 3
+	add	DWORD PTR -52[rbp], 1
+.L50:
+	.loc 1 248 31 discriminator 1
+	mov	eax, DWORD PTR -52[rbp]
+	cmp	eax, DWORD PTR -56[rbp]
+	jl	.L51
+.LBE21:
+	.loc 1 255 21 discriminator 2
+	mov	rax, QWORD PTR -144[rbp]
+	movss	xmm0, DWORD PTR -40[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 256 17 discriminator 2
+	mov	rax, QWORD PTR -144[rbp]
+	add	rax, 4
+	.loc 1 256 21 discriminator 2
+	movss	xmm0, DWORD PTR -44[rbp]
+	movss	DWORD PTR [rax], xmm0
+.LBE16:
+	.loc 1 192 43 discriminator 2
+	add	DWORD PTR -24[rbp], 1
+.L37:
+	.loc 1 192 27 discriminator 1
+	mov	eax, DWORD PTR -24[rbp]
+	cmp	eax, DWORD PTR -340[rbp]
+	jl	.L52
+.LBE15:
+	.loc 1 258 15 discriminator 2
+	mov	rax, QWORD PTR -328[rbp]
+	mov	rax, QWORD PTR 216[rax]
+	.loc 1 258 26 discriminator 2
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 258 30 discriminator 2
+	movsd	xmm0, QWORD PTR -16[rbp]
+	movsd	QWORD PTR [rax], xmm0
+.LBE14:
+	.loc 1 183 42 discriminator 2
+	add	DWORD PTR -4[rbp], 1
+.L36:
+	.loc 1 183 30 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -336[rbp]
+	jl	.L53
+.LBE13:
+	.loc 1 260 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	subbandFilter_AdaptBands, .-subbandFilter_AdaptBands
+	.type	subbandFilter_BandTask, @function
+subbandFilter_BandTask:
+.LFB12:
+	.loc 1 267 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 268 29
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 269 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, DWORD PTR 16[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 12[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	esi, DWORD PTR 8[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	rdi, rax
+	call	subbandFilter_AdaptBands
+	.loc 1 270 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	subbandFilter_BandTask, .-subbandFilter_BandTask
+	.section	.rodata
+	.align 8
+.LC10:
+	.string	"Wrong subband filter length %d or number of bands %d\n"
+	.align 8
+.LC11:
+	.string	"Error allocating subband filter of length %d\n"
+	.text
+	.globl	subbandFilter_Init
+	.type	subbandFilter_Init, @function
+subbandFilter_Init:
+.LFB13:
+	.loc 1 273 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 416
+	mov	QWORD PTR -392[rbp], rdi
+	movss	DWORD PTR -396[rbp], xmm0
+	mov	DWORD PTR -400[rbp], esi
+	mov	DWORD PTR -404[rbp], edx
+	.loc 1 274 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -40[rbp], rax
+	.loc 1 276 5
+	mov	rax, QWORD PTR -392[rbp]
+	mov	edx, 288
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 277 8
+	cmp	DWORD PTR -404[rbp], 0
+	jne	.L57
+	.loc 1 279 20
+	mov	DWORD PTR -404[rbp], 32
+.L57:
+	.loc 1 281 8
+	cmp	DWORD PTR -400[rbp], 0
+	jle	.L58
+	.loc 1 281 22 discriminator 1
+	cmp	DWORD PTR -404[rbp], 3
+	jle	.L58
+	.loc 1 281 65 discriminator 2
+	cmp	DWORD PTR -404[rbp], 1024
+	jg	.L58
+	.loc 1 282 13
+	mov	eax, DWORD PTR -404[rbp]
+	mov	edi, eax
+	call	fft_NextPowerOfTwo@PLT
+	.loc 1 282 9
+	cmp	DWORD PTR -404[rbp], eax
+	je	.L59
+.L58:
+	.loc 1 284 9
+	mov	edx, DWORD PTR -404[rbp]
+	mov	eax, DWORD PTR -400[rbp]
+	mov	esi, eax
+	lea	rax, .LC10[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 285 16
+	mov	eax, 1
+	jmp	.L67
+.L59:
+	.loc 1 287 18
+	mov	rax, QWORD PTR -392[rbp]
+	movss	xmm0, DWORD PTR -396[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 288 20
+	mov	rax, QWORD PTR -392[rbp]
+	mov	edx, DWORD PTR -400[rbp]
+	mov	DWORD PTR 4[rax], edx
+	.loc 1 289 24
+	mov	rax, QWORD PTR -392[rbp]
+	mov	edx, DWORD PTR -404[rbp]
+	mov	DWORD PTR 8[rax], edx
+	.loc 1 290 37
+	mov	eax, DWORD PTR -404[rbp]
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	edx, eax
+	.loc 1 290 24
+	mov	rax, QWORD PTR -392[rbp]
+	mov	DWORD PTR 12[rax], edx
+	.loc 1 291 36
+	mov	eax, DWORD PTR -404[rbp]
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	.loc 1 291 40
+	lea	edx, 1[rax]
+	.loc 1 291 23
+	mov	rax, QWORD PTR -392[rbp]
+	mov	DWORD PTR 16[rax], edx
+	.loc 1 292 63
+	mov	eax, DWORD PTR -404[rbp]
+	sal	eax, 3
+	.loc 1 292 76
+	lea	edx, 1[rax]
+	.loc 1 292 29
+	mov	rax, QWORD PTR -392[rbp]
+	mov	DWORD PTR 24[rax], edx
+	.loc 1 293 27
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 293 45
+	lea	edx, -1[rax]
+	.loc 1 293 19
+	mov	rax, QWORD PTR -392[rbp]
+	mov	DWORD PTR 28[rax], edx
+	.loc 1 296 45
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 296 63
+	mov	edx, eax
+	shr	edx, 31
+	add	eax, edx
+	sar	eax
+	mov	edx, eax
+	.loc 1 296 37
+	mov	eax, DWORD PTR -400[rbp]
+	add	edx, eax
+	.loc 1 296 75
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 296 67
+	add	eax, edx
+	.loc 1 296 88
+	lea	ecx, -1[rax]
+	.loc 1 296 101
+	mov	rax, QWORD PTR -392[rbp]
+	mov	esi, DWORD PTR 12[rax]
+	.loc 1 296 93
+	mov	eax, ecx
+	cdq
+	idiv	esi
+	mov	edx, eax
+	.loc 1 296 27
+	mov	rax, QWORD PTR -392[rbp]
+	mov	DWORD PTR 20[rax], edx
+	.loc 1 297 36
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 297 75
+	add	eax, 15
+	.loc 1 297 80
+	and	eax, -16
+	mov	edx, eax
+	.loc 1 297 27
+	mov	rax, QWORD PTR -392[rbp]
+	mov	DWORD PTR 20[rax], edx
+	.loc 1 299 9
+	mov	rax, QWORD PTR -392[rbp]
+	lea	rdx, 32[rax]
+	mov	eax, DWORD PTR -404[rbp]
+	mov	esi, eax
+	mov	rdi, rdx
+	call	fft_Init@PLT
+	.loc 1 299 8
+	test	eax, eax
+	je	.L61
+	.loc 1 301 16
+	mov	eax, 1
+	jmp	.L67
+.L61:
+	.loc 1 304 31
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 304 18
+	cdqe
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 305 31
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 305 18
+	cdqe
+	mov	QWORD PTR -56[rbp], rax
+	.loc 1 308 15
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 308 33
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -224[rbp], rax
+	.loc 1 309 15
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 309 33
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -216[rbp], rax
+	.loc 1 310 19
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 310 11
+	add	eax, eax
+	cdqe
+	.loc 1 310 37
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -208[rbp], rax
+	.loc 1 311 19
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 311 11
+	add	eax, eax
+	cdqe
+	.loc 1 311 37
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -200[rbp], rax
+	.loc 1 312 16
+	mov	eax, DWORD PTR -400[rbp]
+	cdqe
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -192[rbp], rax
+	.loc 1 313 15
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 28[rax]
+	cdqe
+	.loc 1 313 23
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -184[rbp], rax
+	.loc 1 314 15
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	cdqe
+	.loc 1 314 33
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -176[rbp], rax
+	.loc 1 315 15
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 315 28
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -168[rbp], rax
+	.loc 1 316 14
+	mov	rax, QWORD PTR -48[rbp]
+	imul	rax, QWORD PTR -56[rbp]
+	.loc 1 316 21
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -160[rbp], rax
+	.loc 1 317 14
+	mov	rax, QWORD PTR -48[rbp]
+	imul	rax, QWORD PTR -56[rbp]
+	.loc 1 317 21
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -152[rbp], rax
+	.loc 1 318 18
+	mov	rax, QWORD PTR -48[rbp]
+	imul	rax, QWORD PTR -56[rbp]
+	.loc 1 306 18
+	sal	rax, 3
+	mov	QWORD PTR -144[rbp], rax
+	.loc 1 319 18
+	mov	rax, QWORD PTR -48[rbp]
+	imul	rax, QWORD PTR -56[rbp]
+	.loc 1 306 18
+	sal	rax, 3
+	mov	QWORD PTR -136[rbp], rax
+	.loc 1 320 14
+	mov	rax, QWORD PTR -48[rbp]
+	sal	rax, 3
+	.loc 1 306 18
+	mov	QWORD PTR -128[rbp], rax
+	mov	rax, QWORD PTR -48[rbp]
+	sal	rax, 9
+	mov	QWORD PTR -120[rbp], rax
+	mov	rax, QWORD PTR -48[rbp]
+	sal	rax, 9
+	mov	QWORD PTR -112[rbp], rax
+	mov	QWORD PTR -104[rbp], 256
+	.loc 1 324 51
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	cdqe
+	.loc 1 324 64
+	sal	rax, 8
+	.loc 1 306 18
+	mov	QWORD PTR -96[rbp], rax
+	.loc 1 325 20
+	mov	eax, DWORD PTR -404[rbp]
+	cdqe
+	sal	rax, 2
+	.loc 1 306 18
+	mov	QWORD PTR -88[rbp], rax
+	mov	rax, QWORD PTR -48[rbp]
+	sal	rax, 3
+	mov	QWORD PTR -80[rbp], rax
+	.loc 1 330 17
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 80
+	.loc 1 328 12
+	mov	QWORD PTR -384[rbp], rax
+	.loc 1 330 50
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 88
+	.loc 1 328 12
+	mov	QWORD PTR -376[rbp], rax
+	.loc 1 330 84
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 96
+	.loc 1 328 12
+	mov	QWORD PTR -368[rbp], rax
+	.loc 1 331 17
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 104
+	.loc 1 328 12
+	mov	QWORD PTR -360[rbp], rax
+	.loc 1 331 50
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 120
+	.loc 1 328 12
+	mov	QWORD PTR -352[rbp], rax
+	.loc 1 331 82
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 136
+	.loc 1 328 12
+	mov	QWORD PTR -344[rbp], rax
+	.loc 1 332 17
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 152
+	.loc 1 328 12
+	mov	QWORD PTR -336[rbp], rax
+	.loc 1 332 43
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 160
+	.loc 1 328 12
+	mov	QWORD PTR -328[rbp], rax
+	.loc 1 332 67
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 176
+	.loc 1 328 12
+	mov	QWORD PTR -320[rbp], rax
+	.loc 1 332 95
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 184
+	.loc 1 328 12
+	mov	QWORD PTR -312[rbp], rax
+	.loc 1 333 17
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 192
+	.loc 1 328 12
+	mov	QWORD PTR -304[rbp], rax
+	.loc 1 333 44
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 200
+	.loc 1 328 12
+	mov	QWORD PTR -296[rbp], rax
+	.loc 1 333 71
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 216
+	.loc 1 328 12
+	mov	QWORD PTR -288[rbp], rax
+	.loc 1 334 17
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 224
+	.loc 1 328 12
+	mov	QWORD PTR -280[rbp], rax
+	.loc 1 334 46
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 232
+	.loc 1 328 12
+	mov	QWORD PTR -272[rbp], rax
+	.loc 1 334 77
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 240
+	.loc 1 328 12
+	mov	QWORD PTR -264[rbp], rax
+	.loc 1 335 17
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 248
+	.loc 1 328 12
+	mov	QWORD PTR -256[rbp], rax
+	.loc 1 335 50
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 256
+	.loc 1 328 12
+	mov	QWORD PTR -248[rbp], rax
+	.loc 1 335 73
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 264
+	.loc 1 328 12
+	mov	QWORD PTR -240[rbp], rax
+	.loc 1 337 15
+	mov	DWORD PTR -60[rbp], 19
+	.loc 1 338 12
+	mov	QWORD PTR -8[rbp], 0
+.LBB22:
+	.loc 1 340 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 340 5
+	jmp	.L62
+.L63:
+	.loc 1 342 53 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	cdqe
+	mov	rax, QWORD PTR -224[rbp+rax*8]
+	.loc 1 342 23 discriminator 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	.loc 1 342 20 discriminator 3
+	add	QWORD PTR -8[rbp], rax
+	.loc 1 340 41 discriminator 3
+	add	DWORD PTR -12[rbp], 1
+.L62:
+	.loc 1 340 23 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -60[rbp]
+	jl	.L63
+.LBE22:
+	.loc 1 344 26
+	mov	rax, QWORD PTR -40[rbp]
+	mov	r8, QWORD PTR [rax]
+	.loc 1 344 41
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 344 22
+	mov	rcx, QWORD PTR -8[rbp]
+	mov	edx, 64
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	r8
+.LVL0:
+	.loc 1 344 20
+	mov	rdx, QWORD PTR -392[rbp]
+	mov	QWORD PTR 280[rdx], rax
+	.loc 1 345 15
+	mov	rax, QWORD PTR -392[rbp]
+	mov	rax, QWORD PTR 280[rax]
+	.loc 1 345 8
+	test	rax, rax
+	jne	.L64
+	.loc 1 347 9
+	mov	eax, DWORD PTR -400[rbp]
+	mov	esi, eax
+	lea	rax, .LC11[rip]
+	mov	rdi, rax
+	mov	eax, 0
+	call	printf@PLT
+	.loc 1 348 9
+	mov	rax, QWORD PTR -392[rbp]
+	add	rax, 32
+	mov	rdi, rax
+	call	fft_Free@PLT
+	.loc 1 349 16
+	mov	eax, 1
+	jmp	.L67
+.L64:
+	.loc 1 351 5
+	mov	rax, QWORD PTR -392[rbp]
+	mov	rax, QWORD PTR 280[rax]
+	mov	rdx, QWORD PTR -8[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 353 20
+	mov	rax, QWORD PTR -392[rbp]
+	mov	rax, QWORD PTR 280[rax]
+	mov	QWORD PTR -24[rbp], rax
+.LBB23:
+	.loc 1 354 14
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 354 5
+	jmp	.L65
+.L66:
+	.loc 1 356 18 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	mov	rax, QWORD PTR -384[rbp+rax*8]
+	.loc 1 356 22 discriminator 3
+	mov	rdx, QWORD PTR -24[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 357 47 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	mov	rax, QWORD PTR -224[rbp+rax*8]
+	.loc 1 357 17 discriminator 3
+	mov	rdi, rax
+	call	lmsAllocator_AlignedSize@PLT
+	.loc 1 357 14 discriminator 3
+	add	QWORD PTR -24[rbp], rax
+	.loc 1 354 41 discriminator 3
+	add	DWORD PTR -28[rbp], 1
+.L65:
+	.loc 1 354 23 discriminator 1
+	mov	eax, DWORD PTR -28[rbp]
+	cmp	eax, DWORD PTR -60[rbp]
+	jl	.L66
+.LBE23:
+	.loc 1 362 5
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -404[rbp]
+	movsd	xmm0, QWORD PTR .LC12[rip]
+	divsd	xmm0, xmm1
+	movq	rcx, xmm0
+	mov	rax, QWORD PTR -392[rbp]
+	mov	edx, DWORD PTR 24[rax]
+	mov	rax, QWORD PTR -392[rbp]
+	mov	rax, QWORD PTR 80[rax]
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	movapd	xmm1, xmm0
+	movq	xmm0, rcx
+	mov	esi, edx
+	mov	rdi, rax
+	call	subbandFilter_DesignLowpass
+	.loc 1 364 47
+	mov	rax, QWORD PTR -392[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 364 33
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, eax
+	.loc 1 363 5
+	pxor	xmm0, xmm0
+	cvtsi2sd	xmm0, DWORD PTR -404[rbp]
+	movapd	xmm2, xmm1
+	mulsd	xmm2, xmm0
+	pxor	xmm1, xmm1
+	cvtsi2sd	xmm1, DWORD PTR -404[rbp]
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	divsd	xmm0, xmm1
+	movq	rcx, xmm0
+	mov	rax, QWORD PTR -392[rbp]
+	mov	edx, DWORD PTR 24[rax]
+	mov	rax, QWORD PTR -392[rbp]
+	mov	rax, QWORD PTR 88[rax]
+	movapd	xmm1, xmm2
+	movq	xmm0, rcx
+	mov	esi, edx
+	mov	rdi, rax
+	call	subbandFilter_DesignLowpass
+	.loc 1 366 12
+	mov	eax, 0
+.L67:
+	.loc 1 367 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	subbandFilter_Init, .-subbandFilter_Init
+	.globl	subbandFilter_Free
+	.type	subbandFilter_Free, @function
+subbandFilter_Free:
+.LFB14:
+	.loc 1 370 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 371 34
+	call	lmsAllocator_Heap@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 373 9
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 373 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 280[rax]
+	.loc 1 373 23
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 16[rax]
+	.loc 1 373 5
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	rcx
+.LVL1:
+	.loc 1 374 5
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 32
+	mov	rdi, rax
+	call	fft_Free@PLT
+	.loc 1 375 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 280[rax], 0
+	.loc 1 376 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE14:
+	.size	subbandFilter_Free, .-subbandFilter_Free
+	.globl	subbandFilter_SetThreadPool
+	.type	subbandFilter_SetThreadPool, @function
+subbandFilter_SetThreadPool:
+.LFB15:
+	.loc 1 379 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -8[rbp], rdi
+	mov	QWORD PTR -16[rbp], rsi
+	.loc 1 380 18
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 272[rax], rdx
+	.loc 1 381 1
+	nop
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE15:
+	.size	subbandFilter_SetThreadPool, .-subbandFilter_SetThreadPool
+	.globl	subbandFilter_PushSample
+	.type	subbandFilter_PushSample, @function
+subbandFilter_PushSample:
+.LFB16:
+	.loc 1 384 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 385 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 112[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, DWORD PTR 24[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	mov	esi, DWORD PTR -12[rbp]
+	movd	xmm0, esi
+	mov	esi, ecx
+	mov	rdi, rax
+	call	subbandFilter_HistoryPush
+	.loc 1 386 5
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 112[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	ecx, DWORD PTR 24[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	mov	esi, DWORD PTR .LC9[rip]
+	movd	xmm0, esi
+	mov	esi, ecx
+	mov	rdi, rax
+	call	subbandFilter_HistoryPush
+	.loc 1 387 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 112[rax]
+	.loc 1 387 9
+	lea	edx, 1[rax]
+	.loc 1 387 8
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 112[rax], edx
+	.loc 1 387 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 112[rax]
+	.loc 1 387 41
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 387 8
+	cmp	edx, eax
+	jne	.L71
+	.loc 1 389 30
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 112[rax], 0
+.L71:
+	.loc 1 391 11
+	mov	rax, QWORD PTR -8[rbp]
+	mov	rdx, QWORD PTR 120[rax]
+	.loc 1 391 33
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	cdqe
+	.loc 1 391 26
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 391 51
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 392 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	.loc 1 392 9
+	lea	edx, 1[rax]
+	.loc 1 392 8
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 128[rax], edx
+	.loc 1 392 17
+	mov	rax, QWORD PTR -8[rbp]
+	mov	edx, DWORD PTR 128[rax]
+	.loc 1 392 43
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 392 8
+	cmp	edx, eax
+	jne	.L73
+	.loc 1 394 32
+	mov	rax, QWORD PTR -8[rbp]
+	mov	DWORD PTR 128[rax], 0
+.L73:
+	.loc 1 396 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE16:
+	.size	subbandFilter_PushSample, .-subbandFilter_PushSample
+	.type	subbandFilter_ProcessFrames, @function
+subbandFilter_ProcessFrames:
+.LFB17:
+	.loc 1 404 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 12400
+	mov	QWORD PTR -12360[rbp], rdi
+	mov	QWORD PTR -12368[rbp], rsi
+	mov	QWORD PTR -12376[rbp], rdx
+	mov	QWORD PTR -12384[rbp], rcx
+	mov	QWORD PTR -12392[rbp], r8
+	mov	DWORD PTR -12396[rbp], r9d
+	.loc 1 405 34
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 405 15
+	add	eax, eax
+	mov	DWORD PTR -24[rbp], eax
+	.loc 1 406 9
+	mov	DWORD PTR -4[rbp], 0
+.LBB24:
+	.loc 1 408 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 408 5
+	jmp	.L75
+.L82:
+.LBB25:
+	.loc 1 412 62
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -12368[rbp]
+	add	rdx, rax
+	.loc 1 412 15
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rcx, QWORD PTR 120[rax]
+	.loc 1 412 37
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	cdqe
+	.loc 1 412 30
+	sal	rax, 2
+	add	rax, rcx
+	.loc 1 412 62
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 412 55
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 413 21
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	.loc 1 413 13
+	lea	edx, 1[rax]
+	.loc 1 413 12
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 128[rax], edx
+	.loc 1 413 21
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 128[rax]
+	.loc 1 413 47
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 4[rax]
+	.loc 1 413 12
+	cmp	edx, eax
+	jne	.L76
+	.loc 1 415 36
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 128[rax], 0
+.L76:
+	.loc 1 417 52
+	cmp	QWORD PTR -12376[rbp], 0
+	je	.L77
+	.loc 1 417 48 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -12376[rbp]
+	add	rax, rdx
+	.loc 1 417 52 discriminator 1
+	movss	xmm0, DWORD PTR [rax]
+	jmp	.L78
+.L77:
+	.loc 1 417 60 discriminator 2
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rdx, QWORD PTR 120[rax]
+	.loc 1 417 82 discriminator 2
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 128[rax]
+	cdqe
+	.loc 1 417 75 discriminator 2
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 417 52 discriminator 2
+	movss	xmm0, DWORD PTR [rax]
+.L78:
+	.loc 1 417 19 discriminator 4
+	movss	DWORD PTR -36[rbp], xmm0
+	.loc 1 419 109 discriminator 4
+	mov	eax, DWORD PTR -8[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -12368[rbp]
+	add	rax, rdx
+	.loc 1 419 9 discriminator 4
+	mov	esi, DWORD PTR [rax]
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 112[rax]
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	ecx, DWORD PTR 24[rax]
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 96[rax]
+	movd	xmm0, esi
+	mov	esi, ecx
+	mov	rdi, rax
+	call	subbandFilter_HistoryPush
+	.loc 1 420 9 discriminator 4
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 112[rax]
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	ecx, DWORD PTR 24[rax]
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 104[rax]
+	mov	esi, DWORD PTR -36[rbp]
+	movd	xmm0, esi
+	mov	esi, ecx
+	mov	rdi, rax
+	call	subbandFilter_HistoryPush
+	.loc 1 421 21 discriminator 4
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 112[rax]
+	.loc 1 421 13 discriminator 4
+	lea	edx, 1[rax]
+	.loc 1 421 12 discriminator 4
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 112[rax], edx
+	.loc 1 421 21 discriminator 4
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 112[rax]
+	.loc 1 421 45 discriminator 4
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 24[rax]
+	.loc 1 421 12 discriminator 4
+	cmp	edx, eax
+	jne	.L79
+	.loc 1 423 34
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 112[rax], 0
+.L79:
+	.loc 1 426 43
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rdx, QWORD PTR 136[rax]
+	.loc 1 426 64
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	cdqe
+	.loc 1 426 57
+	sal	rax, 2
+	add	rdx, rax
+	.loc 1 426 15
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 248[rax]
+	.loc 1 426 31
+	mov	ecx, DWORD PTR -8[rbp]
+	movsx	rcx, ecx
+	sal	rcx, 2
+	add	rax, rcx
+	.loc 1 426 57
+	movss	xmm0, DWORD PTR [rdx]
+	.loc 1 426 35
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 427 15
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rdx, QWORD PTR 136[rax]
+	.loc 1 427 36
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	cdqe
+	.loc 1 427 29
+	sal	rax, 2
+	add	rax, rdx
+	.loc 1 427 57
+	movss	xmm0, DWORD PTR -36[rbp]
+	movss	DWORD PTR [rax], xmm0
+	.loc 1 428 21
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 144[rax]
+	.loc 1 428 13
+	lea	edx, 1[rax]
+	.loc 1 428 12
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 144[rax], edx
+	.loc 1 428 21
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 144[rax]
+	.loc 1 428 50
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 28[rax]
+	.loc 1 428 12
+	cmp	edx, eax
+	jne	.L80
+	.loc 1 430 39
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 144[rax], 0
+.L80:
+	.loc 1 433 21
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 172[rax]
+	.loc 1 433 13
+	lea	edx, 1[rax]
+	.loc 1 433 12
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 172[rax], edx
+	.loc 1 433 21
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 172[rax]
+	.loc 1 433 36
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 433 12
+	cmp	edx, eax
+	jne	.L81
+	.loc 1 435 25
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 172[rax], 0
+	.loc 1 437 42
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rdx, QWORD PTR 224[rax]
+	.loc 1 437 67
+	mov	eax, DWORD PTR -4[rbp]
+	imul	eax, DWORD PTR -24[rbp]
+	cdqe
+	.loc 1 437 54
+	sal	rax, 2
+	.loc 1 436 13
+	add	rdx, rax
+	.loc 1 436 50
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rcx, QWORD PTR 96[rax]
+	.loc 1 436 71
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 112[rax]
+	cdqe
+	.loc 1 436 64
+	sal	rax, 2
+	.loc 1 436 43
+	add	rcx, rax
+	.loc 1 436 13
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	subbandFilter_Analyse
+	.loc 1 439 42
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rdx, QWORD PTR 232[rax]
+	.loc 1 439 69
+	mov	eax, DWORD PTR -4[rbp]
+	imul	eax, DWORD PTR -24[rbp]
+	cdqe
+	.loc 1 439 56
+	sal	rax, 2
+	.loc 1 438 13
+	add	rdx, rax
+	.loc 1 438 50
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rcx, QWORD PTR 104[rax]
+	.loc 1 438 73
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 112[rax]
+	cdqe
+	.loc 1 438 66
+	sal	rax, 2
+	.loc 1 438 43
+	add	rcx, rax
+	.loc 1 438 13
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	subbandFilter_Analyse
+	.loc 1 440 19
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rcx, QWORD PTR 240[rax]
+	.loc 1 440 46
+	mov	eax, DWORD PTR -4[rbp]
+	lea	edx, 1[rax]
+	mov	DWORD PTR -4[rbp], edx
+	cdqe
+	.loc 1 440 34
+	sal	rax, 2
+	lea	rdx, [rcx+rax]
+	.loc 1 440 50
+	mov	eax, DWORD PTR -8[rbp]
+	mov	DWORD PTR [rdx], eax
+.L81:
+.LBE25:
+	.loc 1 408 40 discriminator 2
+	add	DWORD PTR -8[rbp], 1
+.L75:
+	.loc 1 408 23 discriminator 1
+	mov	eax, DWORD PTR -8[rbp]
+	cmp	eax, DWORD PTR -12396[rbp]
+	jl	.L82
+.LBE24:
+	.loc 1 444 16
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 272[rax]
+	.loc 1 444 8
+	test	rax, rax
+	je	.L83
+	.loc 1 444 32 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	jle	.L83
+.LBB26:
+	.loc 1 447 67
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 16[rax]
+	.loc 1 447 38
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 272[rax]
+	.loc 1 447 44
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 447 19
+	cmp	edx, eax
+	cmovle	eax, edx
+	mov	DWORD PTR -28[rbp], eax
+.LBB27:
+	.loc 1 450 18
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 450 9
+	jmp	.L84
+.L86:
+	.loc 1 452 28
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rbp
+	lea	rdx, -12352[rax]
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	QWORD PTR [rdx], rax
+	.loc 1 453 42
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 453 34
+	imul	eax, DWORD PTR -12[rbp]
+	.loc 1 453 54
+	cdq
+	idiv	DWORD PTR -28[rbp]
+	mov	ecx, eax
+	.loc 1 453 30
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rbp
+	sub	rax, 12344
+	mov	DWORD PTR [rax], ecx
+	.loc 1 454 34
+	mov	eax, DWORD PTR -12[rbp]
+	lea	edx, 1[rax]
+	.loc 1 454 47
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 454 39
+	imul	eax, edx
+	.loc 1 454 59
+	cdq
+	idiv	DWORD PTR -28[rbp]
+	mov	ecx, eax
+	.loc 1 454 29
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rbp
+	sub	rax, 12340
+	mov	DWORD PTR [rax], ecx
+	.loc 1 455 33
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rbp
+	lea	rdx, -12336[rax]
+	mov	eax, DWORD PTR -4[rbp]
+	mov	DWORD PTR [rdx], eax
+	.loc 1 456 73
+	lea	rcx, -12352[rbp]
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	lea	rdx, [rcx+rax]
+	.loc 1 456 17
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 272[rax]
+	lea	rcx, subbandFilter_BandTask[rip]
+	mov	rsi, rcx
+	mov	rdi, rax
+	call	threadPool_Submit@PLT
+	.loc 1 456 16
+	test	eax, eax
+	je	.L85
+	.loc 1 458 40
+	lea	rcx, -12352[rbp]
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	mov	rax, rdx
+	add	rax, rax
+	add	rax, rdx
+	sal	rax, 3
+	add	rax, rcx
+	.loc 1 458 17
+	mov	rdi, rax
+	call	subbandFilter_BandTask
+.L85:
+	.loc 1 450 41 discriminator 2
+	add	DWORD PTR -12[rbp], 1
+.L84:
+	.loc 1 450 27 discriminator 1
+	mov	eax, DWORD PTR -12[rbp]
+	cmp	eax, DWORD PTR -28[rbp]
+	jl	.L86
+.LBE27:
+	.loc 1 461 9
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 272[rax]
+	mov	rdi, rax
+	call	threadPool_Wait@PLT
+.LBE26:
+	.loc 1 445 5
+	jmp	.L87
+.L83:
+	.loc 1 465 9
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 16[rax]
+	mov	ecx, DWORD PTR -4[rbp]
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	esi, 0
+	mov	rdi, rax
+	call	subbandFilter_AdaptBands
+.L87:
+	.loc 1 467 34
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	edx, DWORD PTR 208[rax]
+	.loc 1 467 48
+	mov	eax, DWORD PTR -4[rbp]
+	add	edx, eax
+	.loc 1 467 71
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	ecx, DWORD PTR 20[rax]
+	.loc 1 467 63
+	mov	eax, edx
+	cdq
+	idiv	ecx
+	.loc 1 467 25
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 208[rax], edx
+.LBB28:
+	.loc 1 470 14
+	mov	DWORD PTR -16[rbp], 0
+	.loc 1 470 21
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 470 5
+	jmp	.L88
+.L92:
+.LBB29:
+	.loc 1 472 12
+	mov	eax, DWORD PTR -20[rbp]
+	cmp	eax, DWORD PTR -4[rbp]
+	jge	.L89
+	.loc 1 472 41 discriminator 1
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 240[rax]
+	.loc 1 472 56 discriminator 1
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	mov	eax, DWORD PTR [rax]
+	.loc 1 472 31 discriminator 1
+	cmp	DWORD PTR -16[rbp], eax
+	jne	.L89
+	.loc 1 474 53
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rdx, QWORD PTR 232[rax]
+	.loc 1 474 70
+	mov	eax, DWORD PTR -20[rbp]
+	imul	eax, DWORD PTR -24[rbp]
+	cdqe
+	.loc 1 474 67
+	sal	rax, 2
+	.loc 1 474 46
+	add	rdx, rax
+	.loc 1 474 13
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	subbandFilter_Synthesize
+	.loc 1 475 14
+	add	DWORD PTR -20[rbp], 1
+.L89:
+	.loc 1 477 31
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rsi, QWORD PTR 160[rax]
+	.loc 1 477 45
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	.loc 1 477 57
+	lea	ecx, 1[rax]
+	mov	rdx, QWORD PTR -12360[rbp]
+	mov	DWORD PTR 168[rdx], ecx
+	cdqe
+	.loc 1 477 38
+	sal	rax, 2
+	add	rax, rsi
+	.loc 1 477 21
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -32[rbp], xmm0
+	.loc 1 479 12
+	cmp	QWORD PTR -12384[rbp], 0
+	je	.L90
+	.loc 1 481 19
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -12384[rbp]
+	add	rax, rdx
+	.loc 1 481 23
+	movss	xmm0, DWORD PTR -32[rbp]
+	movss	DWORD PTR [rax], xmm0
+.L90:
+	.loc 1 483 12
+	cmp	QWORD PTR -12392[rbp], 0
+	je	.L91
+	.loc 1 485 30
+	mov	rax, QWORD PTR -12360[rbp]
+	mov	rax, QWORD PTR 248[rax]
+	.loc 1 485 46
+	mov	edx, DWORD PTR -16[rbp]
+	movsx	rdx, edx
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 485 18
+	mov	eax, DWORD PTR -16[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	mov	rax, QWORD PTR -12392[rbp]
+	add	rax, rdx
+	.loc 1 485 50
+	subss	xmm0, DWORD PTR -32[rbp]
+	.loc 1 485 22
+	movss	DWORD PTR [rax], xmm0
+.L91:
+.LBE29:
+	.loc 1 470 47 discriminator 2
+	add	DWORD PTR -16[rbp], 1
+.L88:
+	.loc 1 470 30 discriminator 1
+	mov	eax, DWORD PTR -16[rbp]
+	cmp	eax, DWORD PTR -12396[rbp]
+	jl	.L92
+.LBE28:
+	.loc 1 488 1
+	nop
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE17:
+	.size	subbandFilter_ProcessFrames, .-subbandFilter_ProcessFrames
+	.globl	subbandFilter_ProcessBlock
+	.type	subbandFilter_ProcessBlock, @function
+subbandFilter_ProcessBlock:
+.LFB18:
+	.loc 1 492 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	QWORD PTR -40[rbp], rdx
+	mov	QWORD PTR -48[rbp], rcx
+	mov	QWORD PTR -56[rbp], r8
+	mov	DWORD PTR -60[rbp], r9d
+	.loc 1 494 57
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 12[rax]
+	.loc 1 494 15
+	sal	eax, 6
+	mov	DWORD PTR -8[rbp], eax
+.LBB30:
+	.loc 1 496 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 496 5
+	jmp	.L94
+.L101:
+.LBB31:
+	.loc 1 498 41
+	mov	eax, DWORD PTR -60[rbp]
+	sub	eax, DWORD PTR -4[rbp]
+	.loc 1 498 19
+	mov	edx, DWORD PTR -8[rbp]
+	cmp	edx, eax
+	cmovle	eax, edx
+	mov	DWORD PTR -16[rbp], eax
+	.loc 1 500 9
+	cmp	QWORD PTR -56[rbp], 0
+	je	.L95
+	.loc 1 501 99 discriminator 1
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 500 9 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	lea	rdi, [rdx+rax]
+	jmp	.L96
+.L95:
+	.loc 1 500 9 is_stmt 0 discriminator 2
+	mov	edi, 0
+.L96:
+	.loc 1 500 9 discriminator 4
+	cmp	QWORD PTR -48[rbp], 0
+	je	.L97
+	.loc 1 501 63 is_stmt 1 discriminator 5
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 500 9 discriminator 5
+	mov	rax, QWORD PTR -48[rbp]
+	lea	rcx, [rdx+rax]
+	jmp	.L98
+.L97:
+	.loc 1 500 9 is_stmt 0 discriminator 6
+	mov	ecx, 0
+.L98:
+	.loc 1 500 9 discriminator 8
+	cmp	QWORD PTR -40[rbp], 0
+	je	.L99
+	.loc 1 500 84 is_stmt 1 discriminator 9
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rdx, 0[0+rax*4]
+	.loc 1 500 9 discriminator 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rdx, rax
+	jmp	.L100
+.L99:
+	.loc 1 500 9 is_stmt 0 discriminator 10
+	mov	edx, 0
+.L100:
+	.loc 1 500 51 is_stmt 1 discriminator 12
+	mov	eax, DWORD PTR -4[rbp]
+	cdqe
+	lea	rsi, 0[0+rax*4]
+	.loc 1 500 9 discriminator 12
+	mov	rax, QWORD PTR -32[rbp]
+	add	rsi, rax
+	mov	r8d, DWORD PTR -16[rbp]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	r9d, r8d
+	mov	r8, rdi
+	mov	rdi, rax
+	call	subbandFilter_ProcessFrames
+.LBE31:
+	.loc 1 496 41 discriminator 12
+	mov	eax, DWORD PTR -8[rbp]
+	add	DWORD PTR -4[rbp], eax
+.L94:
+	.loc 1 496 23 discriminator 2
+	mov	eax, DWORD PTR -4[rbp]
+	cmp	eax, DWORD PTR -60[rbp]
+	jl	.L101
+.LBE30:
+	.loc 1 505 27
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 160[rax]
+	.loc 1 505 42
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	.loc 1 505 34
+	test	eax, eax
+	jle	.L102
+	.loc 1 505 68 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	.loc 1 505 81 discriminator 1
+	sub	eax, 1
+	.loc 1 505 85 discriminator 1
+	cdqe
+	.loc 1 505 34 discriminator 1
+	sal	rax, 2
+	jmp	.L103
+.L102:
+	.loc 1 505 34 is_stmt 0 discriminator 2
+	mov	eax, 0
+.L103:
+	.loc 1 505 34 discriminator 4
+	add	rax, rdx
+	.loc 1 505 17 is_stmt 1 discriminator 4
+	movss	xmm0, DWORD PTR [rax]
+	movss	DWORD PTR -12[rbp], xmm0
+	.loc 1 506 13 discriminator 4
+	movss	xmm0, DWORD PTR -12[rbp]
+	movss	xmm1, DWORD PTR .LC13[rip]
+	andps	xmm1, xmm0
+	.loc 1 506 46 discriminator 4
+	movss	xmm0, DWORD PTR .LC14[rip]
+	ucomiss	xmm0, xmm1
+	setb	al
+	movzx	eax, al
+	.loc 1 507 1 discriminator 4
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE18:
+	.size	subbandFilter_ProcessBlock, .-subbandFilter_ProcessBlock
+	.globl	subbandFilter_NormSquared
+	.type	subbandFilter_NormSquared, @function
+subbandFilter_NormSquared:
+.LFB19:
+	.loc 1 510 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	mov	QWORD PTR -56[rbp], rdi
+	.loc 1 511 12
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBB32:
+	.loc 1 513 14
+	mov	DWORD PTR -12[rbp], 0
+	.loc 1 513 5
+	jmp	.L106
+.L112:
+.LBB33:
+	.loc 1 516 80
+	cmp	DWORD PTR -12[rbp], 0
+	je	.L107
+	.loc 1 516 56 discriminator 2
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 516 68 discriminator 2
+	sub	eax, 1
+	.loc 1 516 41 discriminator 2
+	cmp	DWORD PTR -12[rbp], eax
+	jne	.L108
+.L107:
+	.loc 1 516 80 discriminator 3
+	movsd	xmm0, QWORD PTR .LC0[rip]
+	jmp	.L109
+.L108:
+	.loc 1 516 80 is_stmt 0 discriminator 4
+	movsd	xmm0, QWORD PTR .LC2[rip]
+.L109:
+	.loc 1 516 22 is_stmt 1 discriminator 6
+	movsd	QWORD PTR -40[rbp], xmm0
+	.loc 1 517 16 discriminator 6
+	pxor	xmm0, xmm0
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBB34:
+	.loc 1 519 18 discriminator 6
+	mov	DWORD PTR -28[rbp], 0
+	.loc 1 519 9 discriminator 6
+	jmp	.L110
+.L111:
+.LBB35:
+	.loc 1 521 30 discriminator 3
+	mov	eax, DWORD PTR -12[rbp]
+	movsx	rdx, eax
+	.loc 1 521 48 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	cdqe
+	.loc 1 521 40 discriminator 3
+	imul	rdx, rax
+	.loc 1 521 64 discriminator 3
+	mov	eax, DWORD PTR -28[rbp]
+	cdqe
+	.loc 1 521 26 discriminator 3
+	add	rax, rdx
+	mov	QWORD PTR -48[rbp], rax
+	.loc 1 522 35 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 176[rax]
+	.loc 1 522 46 discriminator 3
+	mov	rdx, QWORD PTR -48[rbp]
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 522 21 discriminator 3
+	pxor	xmm1, xmm1
+	cvtss2sd	xmm1, xmm0
+	.loc 1 522 58 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 176[rax]
+	.loc 1 522 69 discriminator 3
+	mov	rdx, QWORD PTR -48[rbp]
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 522 50 discriminator 3
+	mulsd	xmm1, xmm0
+	.loc 1 522 89 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 522 100 discriminator 3
+	mov	rdx, QWORD PTR -48[rbp]
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	.loc 1 522 75 discriminator 3
+	pxor	xmm2, xmm2
+	cvtss2sd	xmm2, xmm0
+	.loc 1 522 112 discriminator 3
+	mov	rax, QWORD PTR -56[rbp]
+	mov	rax, QWORD PTR 184[rax]
+	.loc 1 522 123 discriminator 3
+	mov	rdx, QWORD PTR -48[rbp]
+	sal	rdx, 2
+	add	rax, rdx
+	movss	xmm0, DWORD PTR [rax]
+	cvtss2sd	xmm0, xmm0
+	.loc 1 522 104 discriminator 3
+	mulsd	xmm0, xmm2
+	.loc 1 522 73 discriminator 3
+	addsd	xmm0, xmm1
+	.loc 1 522 18 discriminator 3
+	movsd	xmm1, QWORD PTR -24[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -24[rbp], xmm0
+.LBE35:
+	.loc 1 519 53 discriminator 3
+	add	DWORD PTR -28[rbp], 1
+.L110:
+	.loc 1 519 35 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 519 27 discriminator 1
+	cmp	DWORD PTR -28[rbp], eax
+	jl	.L111
+.LBE34:
+	.loc 1 524 23 discriminator 2
+	movsd	xmm0, QWORD PTR -40[rbp]
+	mulsd	xmm0, QWORD PTR -24[rbp]
+	.loc 1 524 13 discriminator 2
+	movsd	xmm1, QWORD PTR -8[rbp]
+	addsd	xmm0, xmm1
+	movsd	QWORD PTR -8[rbp], xmm0
+.LBE33:
+	.loc 1 513 45 discriminator 2
+	add	DWORD PTR -12[rbp], 1
+.L106:
+	.loc 1 513 31 discriminator 1
+	mov	rax, QWORD PTR -56[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 513 23 discriminator 1
+	cmp	DWORD PTR -12[rbp], eax
+	jl	.L112
+.LBE32:
+	.loc 1 526 12
+	movsd	xmm0, QWORD PTR -8[rbp]
+	movq	rax, xmm0
+	.loc 1 527 1
+	movq	xmm0, rax
+	pop	rbp
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE19:
+	.size	subbandFilter_NormSquared, .-subbandFilter_NormSquared
+	.section	.rodata
+	.align 8
+.LC0:
+	.long	0
+	.long	1072693248
+	.align 8
+.LC1:
+	.long	-2127697391
+	.long	1030854553
+	.align 8
+.LC2:
+	.long	0
+	.long	1073741824
+	.align 8
+.LC3:
+	.long	-1717986918
+	.long	1075222937
+	.align 8
+.LC5:
+	.long	1413754136
+	.long	1075388923
+	.align 8
+.LC6:
+	.long	1413754136
+	.long	1074340347
+	.align 16
+.LC7:
+	.long	-2147483648
+	.long	0
+	.long	0
+	.long	0
+	.align 8
+.LC8:
+	.long	-1598689907
+	.long	1051772663
+	.align 4
+.LC9:
+	.long	0
+	.align 8
+.LC12:
+	.long	0
+	.long	1071644672
+	.align 16
+.LC13:
+	.long	2147483647
+	.long	0
+	.long	0
+	.long	0
+	.align 4
+.LC14:
+	.long	2139095039
+	.text
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 7 "include/lmsAllocator.h"
+	.file 8 "include/fft.h"
+	.file 9 "include/threadPool.h"
+	.file 10 "include/subbandFilter.h"
+	.file 11 "/usr/include/stdio.h"
+	.file 12 "/usr/include/string.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0x14cd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF183
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0xa
+	.long	.LASF16
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3f
+	.uleb128 0xe
+	.long	0x2e
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	0x46
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0xe
+	.long	0x85
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x2
+	.byte	0x1c
+	.byte	0x3
+	.long	0xb5
+	.uleb128 0x1
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x1e
+	.byte	0x12
+	.long	0x6e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x1f
+	.byte	0x12
+	.long	0x6e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x2
+	.byte	0x19
+	.long	0xd6
+	.uleb128 0xf
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x28
+	.long	0xd6
+	.uleb128 0xf
+	.long	.LASF14
+	.byte	0x2
+	.byte	0x20
+	.byte	0x5
+	.long	0x91
+	.byte	0
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0xa
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x21
+	.byte	0x3
+	.long	0xb5
+	.uleb128 0x18
+	.long	.LASF21
+	.byte	0x10
+	.byte	0x4
+	.byte	0x33
+	.byte	0x10
+	.long	0x111
+	.uleb128 0x1
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x35
+	.byte	0x23
+	.long	0x111
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x36
+	.byte	0x23
+	.long	0x111
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0xe9
+	.uleb128 0xa
+	.long	.LASF20
+	.byte	0x4
+	.byte	0x37
+	.byte	0x3
+	.long	0xe9
+	.uleb128 0x18
+	.long	.LASF22
+	.byte	0x28
+	.byte	0x5
+	.byte	0x16
+	.byte	0x8
+	.long	0x198
+	.uleb128 0x1
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x18
+	.byte	0x7
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x19
+	.byte	0x10
+	.long	0x6e
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x7
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF26
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x10
+	.long	0x6e
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF27
+	.byte	0x5
+	.byte	0x20
+	.byte	0x7
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x22
+	.byte	0x9
+	.long	0x7c
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF29
+	.byte	0x5
+	.byte	0x23
+	.byte	0x9
+	.long	0x7c
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x24
+	.byte	0x14
+	.long	0x116
+	.byte	0x18
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF31
+	.byte	0x30
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x8
+	.long	0x201
+	.uleb128 0x1
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x60
+	.byte	0x19
+	.long	0xdd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x61
+	.byte	0x19
+	.long	0xdd
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF34
+	.byte	0x4
+	.byte	0x62
+	.byte	0x10
+	.long	0x201
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF35
+	.byte	0x4
+	.byte	0x63
+	.byte	0x10
+	.long	0x201
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x64
+	.byte	0x10
+	.long	0x6e
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x65
+	.byte	0x10
+	.long	0x6e
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF38
+	.byte	0x4
+	.byte	0x66
+	.byte	0x10
+	.long	0x201
+	.byte	0x28
+	.byte	0
+	.uleb128 0x12
+	.long	0x6e
+	.long	0x211
+	.uleb128 0x13
+	.long	0x3f
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3f
+	.uleb128 0x17
+	.byte	0x28
+	.byte	0x6
+	.byte	0x43
+	.long	0x24a
+	.uleb128 0xf
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x45
+	.byte	0x1c
+	.long	0x122
+	.uleb128 0xf
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x46
+	.byte	0x8
+	.long	0x24a
+	.uleb128 0xf
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x47
+	.byte	0xc
+	.long	0x52
+	.byte	0
+	.uleb128 0x12
+	.long	0x85
+	.long	0x25a
+	.uleb128 0x13
+	.long	0x3f
+	.byte	0x27
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x48
+	.byte	0x3
+	.long	0x21d
+	.uleb128 0x17
+	.byte	0x30
+	.byte	0x6
+	.byte	0x4b
+	.long	0x293
+	.uleb128 0xf
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x198
+	.uleb128 0xf
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x4e
+	.byte	0x8
+	.long	0x293
+	.uleb128 0xf
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x59
+	.byte	0
+	.uleb128 0x12
+	.long	0x85
+	.long	0x2a3
+	.uleb128 0x13
+	.long	0x3f
+	.byte	0x2f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x50
+	.byte	0x3
+	.long	0x266
+	.uleb128 0x7
+	.long	0x2b4
+	.uleb128 0x22
+	.uleb128 0x7
+	.long	0x8c
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF45
+	.uleb128 0xe
+	.long	0x2ba
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF46
+	.uleb128 0xe
+	.long	0x2c6
+	.uleb128 0xc
+	.byte	0x10
+	.byte	0x4
+	.long	.LASF47
+	.uleb128 0x11
+	.byte	0x18
+	.byte	0x7
+	.byte	0x10
+	.byte	0x9
+	.long	0x30a
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0x7
+	.byte	0x13
+	.byte	0xd
+	.long	0x323
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x7
+	.byte	0x16
+	.byte	0xc
+	.long	0x338
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x7
+	.byte	0x18
+	.byte	0xb
+	.long	0x83
+	.byte	0x10
+	.byte	0
+	.uleb128 0x23
+	.long	0x83
+	.long	0x323
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x2e
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0x30a
+	.uleb128 0x19
+	.long	0x338
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x83
+	.byte	0
+	.uleb128 0x7
+	.long	0x328
+	.uleb128 0xa
+	.long	.LASF51
+	.byte	0x7
+	.byte	0x19
+	.byte	0x3
+	.long	0x2d9
+	.uleb128 0xe
+	.long	0x33d
+	.uleb128 0x7
+	.long	0x60
+	.uleb128 0x11
+	.byte	0x30
+	.byte	0x8
+	.byte	0xc
+	.byte	0x9
+	.long	0x3ab
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x8
+	.byte	0xe
+	.byte	0x9
+	.long	0x46
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x8
+	.byte	0xf
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x8
+	.byte	0x10
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x8
+	.byte	0x11
+	.byte	0xa
+	.long	0x3b5
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x8
+	.byte	0x12
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x8
+	.byte	0x13
+	.byte	0xb
+	.long	0x83
+	.byte	0x28
+	.byte	0
+	.uleb128 0x7
+	.long	0x2ba
+	.uleb128 0x1a
+	.long	0x3ab
+	.uleb128 0x7
+	.long	0x46
+	.uleb128 0xa
+	.long	.LASF58
+	.byte	0x8
+	.byte	0x14
+	.byte	0x3
+	.long	0x353
+	.uleb128 0xe
+	.long	0x3ba
+	.uleb128 0x19
+	.long	0x3d6
+	.uleb128 0x2
+	.long	0x83
+	.byte	0
+	.uleb128 0x7
+	.long	0x3cb
+	.uleb128 0xa
+	.long	.LASF59
+	.byte	0x9
+	.byte	0xe
+	.byte	0x10
+	.long	0x3d6
+	.uleb128 0x11
+	.byte	0x10
+	.byte	0x9
+	.byte	0x10
+	.byte	0x9
+	.long	0x40b
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0x9
+	.byte	0x12
+	.byte	0x16
+	.long	0x3db
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0x9
+	.byte	0x13
+	.byte	0xb
+	.long	0x83
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF62
+	.byte	0x9
+	.byte	0x14
+	.byte	0x3
+	.long	0x3e7
+	.uleb128 0x11
+	.byte	0x40
+	.byte	0x9
+	.byte	0x17
+	.byte	0x9
+	.long	0x462
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x9
+	.byte	0x19
+	.byte	0x15
+	.long	0x25a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x16
+	.long	0x462
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0x9
+	.byte	0x1b
+	.byte	0x9
+	.long	0x46
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x9
+	.long	0x46
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x9
+	.byte	0x1d
+	.byte	0x9
+	.long	0x46
+	.byte	0x38
+	.byte	0
+	.uleb128 0x7
+	.long	0x40b
+	.uleb128 0xa
+	.long	.LASF68
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x3
+	.long	0x417
+	.uleb128 0x11
+	.byte	0xb0
+	.byte	0x9
+	.byte	0x20
+	.byte	0x9
+	.long	0x50c
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x9
+	.byte	0x22
+	.byte	0x10
+	.long	0x50c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x9
+	.byte	0x23
+	.byte	0x18
+	.long	0x511
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x9
+	.byte	0x24
+	.byte	0x9
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x9
+	.byte	0x25
+	.byte	0x9
+	.long	0x46
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0x9
+	.byte	0x26
+	.byte	0x15
+	.long	0x25a
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x9
+	.byte	0x27
+	.byte	0x14
+	.long	0x2a3
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0x9
+	.byte	0x28
+	.byte	0x14
+	.long	0x2a3
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0x9
+	.byte	0x29
+	.byte	0x9
+	.long	0x46
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x9
+	.long	0x46
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0x9
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0x9
+	.byte	0x2c
+	.byte	0x9
+	.long	0x46
+	.byte	0xac
+	.byte	0
+	.uleb128 0x7
+	.long	0x211
+	.uleb128 0x7
+	.long	0x467
+	.uleb128 0xa
+	.long	.LASF79
+	.byte	0x9
+	.byte	0x2d
+	.byte	0x3
+	.long	0x473
+	.uleb128 0x24
+	.value	0x120
+	.byte	0xa
+	.byte	0x18
+	.byte	0x9
+	.long	0x6ff
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0xa
+	.byte	0x1a
+	.byte	0xb
+	.long	0x2ba
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x9
+	.long	0x46
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0xa
+	.byte	0x1d
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0xa
+	.byte	0x1e
+	.byte	0x9
+	.long	0x46
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0xa
+	.byte	0x1f
+	.byte	0x9
+	.long	0x46
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0xa
+	.byte	0x20
+	.byte	0x9
+	.long	0x46
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0xa
+	.byte	0x21
+	.byte	0x9
+	.long	0x46
+	.byte	0x1c
+	.uleb128 0x1b
+	.string	"fft"
+	.byte	0x22
+	.byte	0xb
+	.long	0x3ba
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0xa
+	.byte	0x23
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0xa
+	.byte	0x24
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0xa
+	.byte	0x25
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0xa
+	.byte	0x26
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0xa
+	.byte	0x27
+	.byte	0x9
+	.long	0x46
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0xa
+	.byte	0x28
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0xa
+	.byte	0x29
+	.byte	0x9
+	.long	0x46
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0xa
+	.byte	0x2a
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0xa
+	.byte	0x2b
+	.byte	0x9
+	.long	0x46
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0xa
+	.byte	0x2c
+	.byte	0xc
+	.long	0x3ab
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0xa
+	.byte	0x2d
+	.byte	0xc
+	.long	0x3ab
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0xa
+	.byte	0x2e
+	.byte	0x9
+	.long	0x46
+	.byte	0xa8
+	.uleb128 0x1b
+	.string	"hop"
+	.byte	0x2f
+	.byte	0x9
+	.long	0x46
+	.byte	0xac
+	.uleb128 0x1
+	.long	.LASF100
+	.byte	0xa
+	.byte	0x30
+	.byte	0xc
+	.long	0x3ab
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF101
+	.byte	0xa
+	.byte	0x31
+	.byte	0xc
+	.long	0x3ab
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0xa
+	.byte	0x32
+	.byte	0xc
+	.long	0x3ab
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0xa
+	.byte	0x33
+	.byte	0xc
+	.long	0x3ab
+	.byte	0xc8
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0xa
+	.byte	0x34
+	.byte	0x9
+	.long	0x46
+	.byte	0xd0
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0xa
+	.byte	0x35
+	.byte	0xd
+	.long	0x6ff
+	.byte	0xd8
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0xa
+	.byte	0x36
+	.byte	0xc
+	.long	0x3ab
+	.byte	0xe0
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0xa
+	.byte	0x37
+	.byte	0xc
+	.long	0x3ab
+	.byte	0xe8
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0xa
+	.byte	0x38
+	.byte	0xa
+	.long	0x3b5
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0xa
+	.byte	0x39
+	.byte	0xc
+	.long	0x3ab
+	.byte	0xf8
+	.uleb128 0x14
+	.long	.LASF110
+	.byte	0x3a
+	.byte	0xc
+	.long	0x3ab
+	.value	0x100
+	.uleb128 0x14
+	.long	.LASF111
+	.byte	0x3b
+	.byte	0xc
+	.long	0x3ab
+	.value	0x108
+	.uleb128 0x14
+	.long	.LASF112
+	.byte	0x3c
+	.byte	0x13
+	.long	0x704
+	.value	0x110
+	.uleb128 0x14
+	.long	.LASF57
+	.byte	0x3d
+	.byte	0xb
+	.long	0x83
+	.value	0x118
+	.byte	0
+	.uleb128 0x7
+	.long	0x2c6
+	.uleb128 0x7
+	.long	0x516
+	.uleb128 0xa
+	.long	.LASF113
+	.byte	0xa
+	.byte	0x3e
+	.byte	0x3
+	.long	0x522
+	.uleb128 0xe
+	.long	0x709
+	.uleb128 0x11
+	.byte	0x18
+	.byte	0x1
+	.byte	0x1e
+	.byte	0x9
+	.long	0x758
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0x1
+	.byte	0x20
+	.byte	0x16
+	.long	0x758
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0x1
+	.byte	0x21
+	.byte	0x9
+	.long	0x46
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0x1
+	.byte	0x22
+	.byte	0x9
+	.long	0x46
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0x1
+	.byte	0x23
+	.byte	0x9
+	.long	0x46
+	.byte	0x10
+	.byte	0
+	.uleb128 0x7
+	.long	0x709
+	.uleb128 0xa
+	.long	.LASF118
+	.byte	0x1
+	.byte	0x24
+	.byte	0x3
+	.long	0x71a
+	.uleb128 0x15
+	.long	.LASF119
+	.byte	0x9
+	.byte	0x44
+	.long	0x77a
+	.uleb128 0x2
+	.long	0x704
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF121
+	.byte	0x9
+	.byte	0x3e
+	.byte	0x5
+	.long	0x46
+	.long	0x79a
+	.uleb128 0x2
+	.long	0x704
+	.uleb128 0x2
+	.long	0x3db
+	.uleb128 0x2
+	.long	0x83
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF120
+	.byte	0x8
+	.byte	0x22
+	.long	0x7ab
+	.uleb128 0x2
+	.long	0x7ab
+	.byte	0
+	.uleb128 0x7
+	.long	0x3ba
+	.uleb128 0x10
+	.long	.LASF122
+	.byte	0x7
+	.byte	0x43
+	.byte	0x8
+	.long	0x2e
+	.long	0x7c6
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF123
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x5
+	.long	0x46
+	.long	0x7e1
+	.uleb128 0x2
+	.long	0x7ab
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF124
+	.byte	0xb
+	.value	0x164
+	.byte	0xc
+	.long	0x46
+	.long	0x7f9
+	.uleb128 0x2
+	.long	0x2b5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF125
+	.byte	0x8
+	.byte	0x39
+	.byte	0x5
+	.long	0x46
+	.long	0x80f
+	.uleb128 0x2
+	.long	0x46
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF184
+	.byte	0x7
+	.byte	0x27
+	.byte	0x17
+	.long	0x81b
+	.uleb128 0x7
+	.long	0x349
+	.uleb128 0x10
+	.long	.LASF126
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x840
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x46
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF127
+	.byte	0xc
+	.byte	0x2f
+	.byte	0xe
+	.long	0x83
+	.long	0x860
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x2af
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF128
+	.byte	0x8
+	.byte	0x32
+	.long	0x87b
+	.uleb128 0x2
+	.long	0x87b
+	.uleb128 0x2
+	.long	0x880
+	.uleb128 0x2
+	.long	0x3ab
+	.byte	0
+	.uleb128 0x7
+	.long	0x3c6
+	.uleb128 0x7
+	.long	0x2c1
+	.uleb128 0x1a
+	.long	0x880
+	.uleb128 0x15
+	.long	.LASF129
+	.byte	0x8
+	.byte	0x2a
+	.long	0x8a5
+	.uleb128 0x2
+	.long	0x87b
+	.uleb128 0x2
+	.long	0x880
+	.uleb128 0x2
+	.long	0x3ab
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF130
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xe
+	.long	0x83
+	.long	0x8c5
+	.uleb128 0x2
+	.long	0x83
+	.uleb128 0x2
+	.long	0x2af
+	.uleb128 0x2
+	.long	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF131
+	.byte	0xd
+	.byte	0x8f
+	.byte	0x1
+	.long	0x2c6
+	.long	0x8db
+	.uleb128 0x2
+	.long	0x2c6
+	.byte	0
+	.uleb128 0x28
+	.string	"sin"
+	.byte	0xd
+	.byte	0x40
+	.byte	0x1
+	.long	0x2c6
+	.long	0x8f1
+	.uleb128 0x2
+	.long	0x2c6
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF134
+	.byte	0x1
+	.value	0x1fd
+	.byte	0x8
+	.long	0x2c6
+	.quad	.LFB19
+	.quad	.LFE19-.LFB19
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x9c1
+	.uleb128 0x6
+	.long	.LASF114
+	.value	0x1fd
+	.byte	0x39
+	.long	0x9c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xb
+	.string	"sum"
+	.value	0x1ff
+	.byte	0xc
+	.long	0x2c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB32
+	.quad	.LBE32-.LBB32
+	.uleb128 0xb
+	.string	"b"
+	.value	0x201
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x5
+	.quad	.LBB33
+	.quad	.LBE33-.LBB33
+	.uleb128 0x8
+	.long	.LASF132
+	.value	0x204
+	.byte	0x16
+	.long	0x2cd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.long	.LASF133
+	.value	0x205
+	.byte	0x10
+	.long	0x2c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.quad	.LBB34
+	.quad	.LBE34-.LBB34
+	.uleb128 0xb
+	.string	"l"
+	.value	0x207
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x5
+	.quad	.LBB35
+	.quad	.LBE35-.LBB35
+	.uleb128 0xb
+	.string	"k"
+	.value	0x209
+	.byte	0x1a
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x715
+	.uleb128 0x1c
+	.long	.LASF135
+	.value	0x1ea
+	.long	0x46
+	.quad	.LFB18
+	.quad	.LFE18-.LFB18
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xaa0
+	.uleb128 0x6
+	.long	.LASF114
+	.value	0x1ea
+	.byte	0x31
+	.long	0x758
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x6
+	.long	.LASF136
+	.value	0x1ea
+	.byte	0x46
+	.long	0x880
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x6
+	.long	.LASF137
+	.value	0x1ea
+	.byte	0x5a
+	.long	0x880
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x6
+	.long	.LASF138
+	.value	0x1eb
+	.byte	0x27
+	.long	0x3ab
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x6
+	.long	.LASF139
+	.value	0x1eb
+	.byte	0x36
+	.long	0x3ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x6
+	.long	.LASF140
+	.value	0x1eb
+	.byte	0x41
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x8
+	.long	.LASF141
+	.value	0x1ee
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xb
+	.string	"y"
+	.value	0x1f9
+	.byte	0x11
+	.long	0x2c1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x5
+	.quad	.LBB30
+	.quad	.LBE30-.LBB30
+	.uleb128 0xb
+	.string	"i"
+	.value	0x1f0
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.quad	.LBB31
+	.quad	.LBE31-.LBB31
+	.uleb128 0x8
+	.long	.LASF67
+	.value	0x1f2
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF158
+	.value	0x192
+	.quad	.LFB17
+	.quad	.LFE17-.LFB17
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc26
+	.uleb128 0x6
+	.long	.LASF114
+	.value	0x192
+	.byte	0x3a
+	.long	0x758
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12376
+	.uleb128 0x6
+	.long	.LASF136
+	.value	0x192
+	.byte	0x4f
+	.long	0x880
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12384
+	.uleb128 0x6
+	.long	.LASF137
+	.value	0x192
+	.byte	0x63
+	.long	0x880
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12392
+	.uleb128 0x6
+	.long	.LASF138
+	.value	0x193
+	.byte	0x30
+	.long	0x3ab
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12400
+	.uleb128 0x6
+	.long	.LASF139
+	.value	0x193
+	.byte	0x3f
+	.long	0x3ab
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12408
+	.uleb128 0x6
+	.long	.LASF140
+	.value	0x193
+	.byte	0x4a
+	.long	0x46
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12412
+	.uleb128 0x8
+	.long	.LASF142
+	.value	0x195
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF117
+	.value	0x196
+	.byte	0x9
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xd
+	.quad	.LBB24
+	.quad	.LBE24-.LBB24
+	.long	0xb85
+	.uleb128 0xb
+	.string	"i"
+	.value	0x198
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB25
+	.quad	.LBE25-.LBB25
+	.uleb128 0x8
+	.long	.LASF143
+	.value	0x19a
+	.byte	0xf
+	.long	0x2ba
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LBB26
+	.quad	.LBE26-.LBB26
+	.long	0xbda
+	.uleb128 0x8
+	.long	.LASF64
+	.value	0x1be
+	.byte	0x20
+	.long	0xc26
+	.uleb128 0x4
+	.byte	0x91
+	.sleb128 -12368
+	.uleb128 0x8
+	.long	.LASF144
+	.value	0x1bf
+	.byte	0x13
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0x5
+	.quad	.LBB27
+	.quad	.LBE27-.LBB27
+	.uleb128 0xb
+	.string	"j"
+	.value	0x1c2
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB28
+	.quad	.LBE28-.LBB28
+	.uleb128 0xb
+	.string	"i"
+	.value	0x1d6
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xb
+	.string	"f"
+	.value	0x1d6
+	.byte	0x15
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x5
+	.quad	.LBB29
+	.quad	.LBE29-.LBB29
+	.uleb128 0xb
+	.string	"y"
+	.value	0x1dd
+	.byte	0x15
+	.long	0x2c1
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x75d
+	.long	0xc37
+	.uleb128 0x2a
+	.long	0x3f
+	.value	0x200
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF146
+	.value	0x17f
+	.quad	.LFB16
+	.quad	.LFE16-.LFB16
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xc73
+	.uleb128 0x6
+	.long	.LASF114
+	.value	0x17f
+	.byte	0x30
+	.long	0x758
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.long	.LASF145
+	.value	0x17f
+	.byte	0x3e
+	.long	0x2ba
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF147
+	.byte	0x1
+	.value	0x17a
+	.byte	0x6
+	.quad	.LFB15
+	.quad	.LFE15-.LFB15
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcb1
+	.uleb128 0x6
+	.long	.LASF114
+	.value	0x17a
+	.byte	0x33
+	.long	0x758
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x6
+	.long	.LASF112
+	.value	0x17a
+	.byte	0x49
+	.long	0x704
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF148
+	.value	0x171
+	.quad	.LFB14
+	.quad	.LFE14-.LFB14
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xced
+	.uleb128 0x6
+	.long	.LASF114
+	.value	0x171
+	.byte	0x2a
+	.long	0x758
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x8
+	.long	.LASF149
+	.value	0x173
+	.byte	0x1b
+	.long	0x81b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF150
+	.value	0x110
+	.long	0x46
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe0d
+	.uleb128 0x6
+	.long	.LASF114
+	.value	0x110
+	.byte	0x29
+	.long	0x758
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -408
+	.uleb128 0x6
+	.long	.LASF80
+	.value	0x110
+	.byte	0x37
+	.long	0x2ba
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -412
+	.uleb128 0x6
+	.long	.LASF81
+	.value	0x110
+	.byte	0x41
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -416
+	.uleb128 0x6
+	.long	.LASF82
+	.value	0x110
+	.byte	0x4d
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -420
+	.uleb128 0x8
+	.long	.LASF149
+	.value	0x112
+	.byte	0x1b
+	.long	0x81b
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x8
+	.long	.LASF151
+	.value	0x130
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x8
+	.long	.LASF152
+	.value	0x131
+	.byte	0x12
+	.long	0x3a
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x8
+	.long	.LASF153
+	.value	0x132
+	.byte	0x12
+	.long	0xe0d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -240
+	.uleb128 0x8
+	.long	.LASF154
+	.value	0x148
+	.byte	0xc
+	.long	0xe1d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -400
+	.uleb128 0x8
+	.long	.LASF155
+	.value	0x151
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x8
+	.long	.LASF156
+	.value	0x152
+	.byte	0xc
+	.long	0x2e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x8
+	.long	.LASF157
+	.value	0x161
+	.byte	0x14
+	.long	0x34e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.quad	.LBB22
+	.quad	.LBE22-.LBB22
+	.long	0xded
+	.uleb128 0xb
+	.string	"i"
+	.value	0x154
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB23
+	.quad	.LBE23-.LBB23
+	.uleb128 0xb
+	.string	"i"
+	.value	0x162
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x3a
+	.long	0xe1d
+	.uleb128 0x13
+	.long	0x3f
+	.byte	0x12
+	.byte	0
+	.uleb128 0x12
+	.long	0xe2d
+	.long	0xe2d
+	.uleb128 0x13
+	.long	0x3f
+	.byte	0x12
+	.byte	0
+	.uleb128 0x7
+	.long	0x83
+	.uleb128 0x1d
+	.long	.LASF159
+	.value	0x10a
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe6e
+	.uleb128 0x6
+	.long	.LASF61
+	.value	0x10a
+	.byte	0x2a
+	.long	0x83
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xb
+	.string	"job"
+	.value	0x10c
+	.byte	0x1d
+	.long	0xe6e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x7
+	.long	0x75d
+	.uleb128 0x16
+	.long	.LASF160
+	.byte	0xae
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1151
+	.uleb128 0x9
+	.long	.LASF114
+	.byte	0xae
+	.byte	0x37
+	.long	0x758
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -344
+	.uleb128 0x9
+	.long	.LASF115
+	.byte	0xae
+	.byte	0x43
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -348
+	.uleb128 0x9
+	.long	.LASF116
+	.byte	0xae
+	.byte	0x51
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -352
+	.uleb128 0x9
+	.long	.LASF117
+	.byte	0xae
+	.byte	0x5e
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -356
+	.uleb128 0x4
+	.long	.LASF152
+	.byte	0xb0
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF142
+	.byte	0xb1
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -76
+	.uleb128 0x4
+	.long	.LASF161
+	.byte	0xb2
+	.byte	0x12
+	.long	0x2cd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x4
+	.long	.LASF80
+	.byte	0xb3
+	.byte	0x12
+	.long	0x2cd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -96
+	.uleb128 0x4
+	.long	.LASF106
+	.byte	0xb4
+	.byte	0x12
+	.long	0x880
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x4
+	.long	.LASF107
+	.byte	0xb5
+	.byte	0xc
+	.long	0x3ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x5
+	.quad	.LBB13
+	.quad	.LBE13-.LBB13
+	.uleb128 0x3
+	.string	"b"
+	.byte	0xb7
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0x5
+	.quad	.LBB14
+	.quad	.LBE14-.LBB14
+	.uleb128 0x4
+	.long	.LASF100
+	.byte	0xb9
+	.byte	0x19
+	.long	0x3b0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -120
+	.uleb128 0x4
+	.long	.LASF101
+	.byte	0xba
+	.byte	0x19
+	.long	0x3b0
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -128
+	.uleb128 0x4
+	.long	.LASF162
+	.byte	0xbb
+	.byte	0x10
+	.long	0x3ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -136
+	.uleb128 0x4
+	.long	.LASF163
+	.byte	0xbc
+	.byte	0x10
+	.long	0x3ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -144
+	.uleb128 0x4
+	.long	.LASF164
+	.byte	0xbd
+	.byte	0x10
+	.long	0x2c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF165
+	.byte	0xbe
+	.byte	0xd
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x5
+	.quad	.LBB15
+	.quad	.LBE15-.LBB15
+	.uleb128 0x3
+	.string	"f"
+	.byte	0xc0
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x5
+	.quad	.LBB16
+	.quad	.LBE16-.LBB16
+	.uleb128 0x3
+	.string	"xRe"
+	.byte	0xc2
+	.byte	0x19
+	.long	0x2c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -148
+	.uleb128 0x3
+	.string	"xIm"
+	.byte	0xc3
+	.byte	0x19
+	.long	0x2c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -152
+	.uleb128 0x4
+	.long	.LASF133
+	.byte	0xc4
+	.byte	0x14
+	.long	0x3ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -160
+	.uleb128 0x4
+	.long	.LASF102
+	.byte	0xd3
+	.byte	0x23
+	.long	0x885
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -168
+	.uleb128 0x4
+	.long	.LASF103
+	.byte	0xd4
+	.byte	0x23
+	.long	0x885
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -176
+	.uleb128 0x4
+	.long	.LASF166
+	.byte	0xe1
+	.byte	0x13
+	.long	0x1151
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -336
+	.uleb128 0x4
+	.long	.LASF167
+	.byte	0xe2
+	.byte	0x13
+	.long	0x1151
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -272
+	.uleb128 0x3
+	.string	"yRe"
+	.byte	0xeb
+	.byte	0x13
+	.long	0x2ba
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.string	"yIm"
+	.byte	0xec
+	.byte	0x13
+	.long	0x2ba
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x3
+	.string	"eRe"
+	.byte	0xf3
+	.byte	0x19
+	.long	0x2c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -180
+	.uleb128 0x3
+	.string	"eIm"
+	.byte	0xf4
+	.byte	0x19
+	.long	0x2c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -184
+	.uleb128 0x4
+	.long	.LASF168
+	.byte	0xf5
+	.byte	0x19
+	.long	0x2c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -188
+	.uleb128 0x3
+	.string	"gRe"
+	.byte	0xf6
+	.byte	0x19
+	.long	0x2c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -192
+	.uleb128 0x3
+	.string	"gIm"
+	.byte	0xf7
+	.byte	0x19
+	.long	0x2c1
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -196
+	.uleb128 0xd
+	.quad	.LBB17
+	.quad	.LBE17-.LBB17
+	.long	0x10cb
+	.uleb128 0x3
+	.string	"l"
+	.byte	0xda
+	.byte	0x1a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.byte	0
+	.uleb128 0xd
+	.quad	.LBB18
+	.quad	.LBE18-.LBB18
+	.long	0x110b
+	.uleb128 0x3
+	.string	"l"
+	.byte	0xe3
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x5
+	.quad	.LBB19
+	.quad	.LBE19-.LBB19
+	.uleb128 0x3
+	.string	"j"
+	.byte	0xe5
+	.byte	0x1a
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.quad	.LBB20
+	.quad	.LBE20-.LBB20
+	.long	0x112d
+	.uleb128 0x3
+	.string	"j"
+	.byte	0xed
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB21
+	.quad	.LBE21-.LBB21
+	.uleb128 0x3
+	.string	"l"
+	.byte	0xf8
+	.byte	0x16
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -68
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x2ba
+	.long	0x1161
+	.uleb128 0x13
+	.long	0x3f
+	.byte	0xf
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF169
+	.byte	0x8a
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1222
+	.uleb128 0x9
+	.long	.LASF114
+	.byte	0x8a
+	.byte	0x37
+	.long	0x758
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.long	.LASF170
+	.byte	0x8a
+	.byte	0x4c
+	.long	0x880
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0x8c
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x4
+	.long	.LASF83
+	.byte	0x8d
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x4
+	.long	.LASF81
+	.byte	0x8e
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.long	0x11e5
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x90
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB11
+	.quad	.LBE11-.LBB11
+	.uleb128 0x3
+	.string	"m"
+	.byte	0x98
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB12
+	.quad	.LBE12-.LBB12
+	.uleb128 0x3
+	.string	"r"
+	.byte	0x9a
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF171
+	.byte	0x66
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x1306
+	.uleb128 0x9
+	.long	.LASF114
+	.byte	0x66
+	.byte	0x34
+	.long	0x758
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.long	.LASF172
+	.byte	0x66
+	.byte	0x49
+	.long	0x880
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x9
+	.long	.LASF170
+	.byte	0x66
+	.byte	0x58
+	.long	0x3ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF82
+	.byte	0x68
+	.byte	0xf
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.uleb128 0x3
+	.string	"sum"
+	.byte	0x69
+	.byte	0xc
+	.long	0x3ab
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0xd
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.long	0x12a7
+	.uleb128 0x3
+	.string	"r"
+	.byte	0x6f
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0xd
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.long	0x12e7
+	.uleb128 0x3
+	.string	"m"
+	.byte	0x73
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x5
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x3
+	.string	"r"
+	.byte	0x75
+	.byte	0x12
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.uleb128 0x3
+	.string	"r"
+	.byte	0x7d
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF173
+	.byte	0x1
+	.byte	0x5a
+	.byte	0x14
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x135d
+	.uleb128 0x9
+	.long	.LASF174
+	.byte	0x5a
+	.byte	0x35
+	.long	0x3ab
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x9
+	.long	.LASF52
+	.byte	0x5a
+	.byte	0x42
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x9
+	.long	.LASF165
+	.byte	0x5a
+	.byte	0x4c
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x9
+	.long	.LASF145
+	.byte	0x5a
+	.byte	0x59
+	.long	0x2ba
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF175
+	.byte	0x41
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0x146a
+	.uleb128 0x9
+	.long	.LASF152
+	.byte	0x41
+	.byte	0x30
+	.long	0x3ab
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -88
+	.uleb128 0x9
+	.long	.LASF81
+	.byte	0x41
+	.byte	0x3a
+	.long	0x46
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -92
+	.uleb128 0x9
+	.long	.LASF176
+	.byte	0x41
+	.byte	0x49
+	.long	0x2c6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -104
+	.uleb128 0x9
+	.long	.LASF168
+	.byte	0x41
+	.byte	0x58
+	.long	0x2c6
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -112
+	.uleb128 0x4
+	.long	.LASF177
+	.byte	0x43
+	.byte	0x12
+	.long	0x2cd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x4
+	.long	.LASF178
+	.byte	0x44
+	.byte	0x12
+	.long	0x2cd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x3
+	.string	"sum"
+	.byte	0x45
+	.byte	0xc
+	.long	0x2c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0xd
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.long	0x144b
+	.uleb128 0x3
+	.string	"j"
+	.byte	0x47
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -28
+	.uleb128 0x5
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x3
+	.string	"t"
+	.byte	0x49
+	.byte	0x16
+	.long	0x2cd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x4
+	.long	.LASF179
+	.byte	0x4a
+	.byte	0x16
+	.long	0x2cd
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x4
+	.long	.LASF180
+	.byte	0x4b
+	.byte	0x16
+	.long	0x2cd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x4
+	.long	.LASF172
+	.byte	0x4c
+	.byte	0x16
+	.long	0x2cd
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -80
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0x3
+	.string	"j"
+	.byte	0x51
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF181
+	.byte	0x1
+	.byte	0x29
+	.byte	0xf
+	.long	0x2c6
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.uleb128 0x2e
+	.string	"x"
+	.byte	0x1
+	.byte	0x29
+	.byte	0x2d
+	.long	0x2c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x3
+	.string	"sum"
+	.byte	0x2b
+	.byte	0xc
+	.long	0x2c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.uleb128 0x4
+	.long	.LASF182
+	.byte	0x2c
+	.byte	0xc
+	.long	0x2c6
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x5
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x2e
+	.byte	0xe
+	.long	0x46
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7a
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF118:
+	.string	"SubbandFilterBandJob_t"
+.LASF166:
+	.string	"accRe"
+.LASF39:
+	.string	"pthread_t"
+.LASF172:
+	.string	"window"
+.LASF105:
+	.string	"bandPower"
+.LASF182:
+	.string	"term"
+.LASF122:
+	.string	"lmsAllocator_AlignedSize"
+.LASF59:
+	.string	"ThreadPoolTask_t"
+.LASF65:
+	.string	"capacity"
+.LASF119:
+	.string	"threadPool_Wait"
+.LASF61:
+	.string	"argument"
+.LASF109:
+	.string	"delayedDesired"
+.LASF142:
+	.string	"stride"
+.LASF103:
+	.string	"windowIm"
+.LASF170:
+	.string	"bands"
+.LASF72:
+	.string	"numOfQueues"
+.LASF115:
+	.string	"firstBin"
+.LASF7:
+	.string	"unsigned int"
+.LASF157:
+	.string	"next"
+.LASF151:
+	.string	"bins"
+.LASF66:
+	.string	"head"
+.LASF37:
+	.string	"__wrefs"
+.LASF149:
+	.string	"heap"
+.LASF139:
+	.string	"error"
+.LASF156:
+	.string	"totalBytes"
+.LASF184:
+	.string	"lmsAllocator_Heap"
+.LASF143:
+	.string	"reference"
+.LASF91:
+	.string	"desiredHistory"
+.LASF141:
+	.string	"chunk"
+.LASF44:
+	.string	"pthread_cond_t"
+.LASF84:
+	.string	"numOfBins"
+.LASF21:
+	.string	"__pthread_internal_list"
+.LASF140:
+	.string	"numOfSamples"
+.LASF33:
+	.string	"__g1_start"
+.LASF24:
+	.string	"__count"
+.LASF111:
+	.string	"spectrum"
+.LASF45:
+	.string	"float"
+.LASF127:
+	.string	"memmove"
+.LASF131:
+	.string	"sqrt"
+.LASF67:
+	.string	"count"
+.LASF165:
+	.string	"index"
+.LASF146:
+	.string	"subbandFilter_PushSample"
+.LASF152:
+	.string	"taps"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF73:
+	.string	"workAvailable"
+.LASF183:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF25:
+	.string	"__owner"
+.LASF78:
+	.string	"shutdown"
+.LASF35:
+	.string	"__g_size"
+.LASF29:
+	.string	"__elision"
+.LASF68:
+	.string	"ThreadPoolQueue_t"
+.LASF129:
+	.string	"fft_Forward"
+.LASF64:
+	.string	"jobs"
+.LASF135:
+	.string	"subbandFilter_ProcessBlock"
+.LASF160:
+	.string	"subbandFilter_AdaptBands"
+.LASF148:
+	.string	"subbandFilter_Free"
+.LASF16:
+	.string	"size_t"
+.LASF94:
+	.string	"referenceIndex"
+.LASF138:
+	.string	"output"
+.LASF90:
+	.string	"inputHistory"
+.LASF85:
+	.string	"subbandLength"
+.LASF95:
+	.string	"desiredDelay"
+.LASF76:
+	.string	"pending"
+.LASF104:
+	.string	"windowIndex"
+.LASF12:
+	.string	"__high"
+.LASF19:
+	.string	"__next"
+.LASF169:
+	.string	"subbandFilter_Synthesize"
+.LASF144:
+	.string	"numOfJobs"
+.LASF176:
+	.string	"cutoff"
+.LASF10:
+	.string	"char"
+.LASF181:
+	.string	"subbandFilter_BesselI0"
+.LASF167:
+	.string	"accIm"
+.LASF134:
+	.string	"subbandFilter_NormSquared"
+.LASF57:
+	.string	"memory"
+.LASF177:
+	.string	"center"
+.LASF28:
+	.string	"__spins"
+.LASF18:
+	.string	"__prev"
+.LASF116:
+	.string	"lastBin"
+.LASF168:
+	.string	"gain"
+.LASF75:
+	.string	"queued"
+.LASF153:
+	.string	"sizes"
+.LASF128:
+	.string	"fft_Inverse"
+.LASF180:
+	.string	"sinc"
+.LASF70:
+	.string	"queues"
+.LASF30:
+	.string	"__list"
+.LASF4:
+	.string	"long long int"
+.LASF124:
+	.string	"printf"
+.LASF71:
+	.string	"numOfThreads"
+.LASF63:
+	.string	"lock"
+.LASF60:
+	.string	"task"
+.LASF82:
+	.string	"numOfBands"
+.LASF50:
+	.string	"context"
+.LASF161:
+	.string	"regularization"
+.LASF98:
+	.string	"ready"
+.LASF126:
+	.string	"memset"
+.LASF174:
+	.string	"history"
+.LASF163:
+	.string	"historyIm"
+.LASF80:
+	.string	"step"
+.LASF52:
+	.string	"size"
+.LASF77:
+	.string	"nextQueue"
+.LASF54:
+	.string	"realTwiddles"
+.LASF113:
+	.string	"SubbandFilter_t"
+.LASF27:
+	.string	"__kind"
+.LASF92:
+	.string	"historyIndex"
+.LASF100:
+	.string	"weightsRe"
+.LASF106:
+	.string	"frameInput"
+.LASF14:
+	.string	"__value32"
+.LASF112:
+	.string	"pool"
+.LASF83:
+	.string	"decimation"
+.LASF20:
+	.string	"__pthread_list_t"
+.LASF47:
+	.string	"long double"
+.LASF110:
+	.string	"fold"
+.LASF171:
+	.string	"subbandFilter_Analyse"
+.LASF102:
+	.string	"windowRe"
+.LASF178:
+	.string	"norm"
+.LASF79:
+	.string	"ThreadPool_t"
+.LASF55:
+	.string	"bitReverse"
+.LASF93:
+	.string	"referenceLine"
+.LASF9:
+	.string	"short int"
+.LASF179:
+	.string	"ratio"
+.LASF3:
+	.string	"long int"
+.LASF97:
+	.string	"overlap"
+.LASF123:
+	.string	"fft_Init"
+.LASF87:
+	.string	"delay"
+.LASF81:
+	.string	"length"
+.LASF114:
+	.string	"filter"
+.LASF107:
+	.string	"frameDesired"
+.LASF56:
+	.string	"work"
+.LASF150:
+	.string	"subbandFilter_Init"
+.LASF132:
+	.string	"weight"
+.LASF96:
+	.string	"desiredDelayIndex"
+.LASF155:
+	.string	"numOfSections"
+.LASF40:
+	.string	"__data"
+.LASF86:
+	.string	"prototypeLength"
+.LASF17:
+	.string	"__atomic_wide_counter"
+.LASF108:
+	.string	"framePosition"
+.LASF58:
+	.string	"Fft_t"
+.LASF158:
+	.string	"subbandFilter_ProcessFrames"
+.LASF26:
+	.string	"__nusers"
+.LASF13:
+	.string	"__value64"
+.LASF2:
+	.string	"long unsigned int"
+.LASF69:
+	.string	"threads"
+.LASF43:
+	.string	"pthread_mutex_t"
+.LASF136:
+	.string	"input"
+.LASF145:
+	.string	"sample"
+.LASF23:
+	.string	"__lock"
+.LASF137:
+	.string	"desired"
+.LASF34:
+	.string	"__g_refs"
+.LASF121:
+	.string	"threadPool_Submit"
+.LASF5:
+	.string	"unsigned char"
+.LASF147:
+	.string	"subbandFilter_SetThreadPool"
+.LASF62:
+	.string	"ThreadPoolJob_t"
+.LASF159:
+	.string	"subbandFilter_BandTask"
+.LASF51:
+	.string	"LmsAllocator_t"
+.LASF162:
+	.string	"historyRe"
+.LASF120:
+	.string	"fft_Free"
+.LASF48:
+	.string	"allocate"
+.LASF31:
+	.string	"__pthread_cond_s"
+.LASF53:
+	.string	"twiddles"
+.LASF74:
+	.string	"allDone"
+.LASF38:
+	.string	"__g_signals"
+.LASF32:
+	.string	"__wseq"
+.LASF11:
+	.string	"__low"
+.LASF164:
+	.string	"power"
+.LASF133:
+	.string	"band"
+.LASF8:
+	.string	"signed char"
+.LASF6:
+	.string	"short unsigned int"
+.LASF49:
+	.string	"release"
+.LASF154:
+	.string	"sections"
+.LASF130:
+	.string	"memcpy"
+.LASF125:
+	.string	"fft_NextPowerOfTwo"
+.LASF175:
+	.string	"subbandFilter_DesignLowpass"
+.LASF117:
+	.string	"numOfFrames"
+.LASF99:
+	.string	"readyIndex"
+.LASF46:
+	.string	"double"
+.LASF36:
+	.string	"__g1_orig_size"
+.LASF42:
+	.string	"__align"
+.LASF173:
+	.string	"subbandFilter_HistoryPush"
+.LASF89:
+	.string	"synthesisWindow"
+.LASF41:
+	.string	"__size"
+.LASF101:
+	.string	"weightsIm"
+.LASF22:
+	.string	"__pthread_mutex_s"
+.LASF88:
+	.string	"analysisWindow"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/subbandFilter.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
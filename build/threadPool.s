@@ -0,0 +1,4314 @@
+	.file	"threadPool.c"
+	.intel_syntax noprefix
+	.text
+.Ltext0:
+	.file 0 "/root/repo" "source/threadPool.c"
+	.section	.tbss,"awT",@nobits
+	.align 8
+	.type	currentPool, @object
+	.size	currentPool, 8
+currentPool:
+	.zero	8
+	.section	.tdata,"awT",@progbits
+	.align 4
+	.type	currentWorker, @object
+	.size	currentWorker, 4
+currentWorker:
+	.long	-1
+	.text
+	.type	threadPool_QueuePush, @function
+threadPool_QueuePush:
+.LFB6:
+	.file 1 "source/threadPool.c"
+	.loc 1 31 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	.loc 1 32 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 34 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 35 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 56[rax]
+	.loc 1 35 30
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 35 8
+	cmp	edx, eax
+	jne	.L2
+.LBB2:
+	.loc 1 37 67
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 37 60
+	add	eax, eax
+	cdqe
+	.loc 1 37 51
+	sal	rax, 4
+	mov	rdi, rax
+	call	malloc@PLT
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 38 12
+	cmp	QWORD PTR -16[rbp], 0
+	je	.L3
+.LBB3:
+	.loc 1 40 22
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 40 13
+	jmp	.L4
+.L5:
+	.loc 1 42 32 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 40[rax]
+	.loc 1 42 45 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 52[rax]
+	.loc 1 42 52 discriminator 3
+	mov	eax, DWORD PTR -8[rbp]
+	add	edx, eax
+	.loc 1 42 64 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 48[rax]
+	.loc 1 42 57 discriminator 3
+	mov	eax, edx
+	cdq
+	idiv	esi
+	mov	eax, edx
+	cdqe
+	.loc 1 42 38 discriminator 3
+	sal	rax, 4
+	add	rax, rcx
+	.loc 1 42 21 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	movsx	rdx, edx
+	mov	rcx, rdx
+	sal	rcx, 4
+	mov	rdx, QWORD PTR -16[rbp]
+	add	rcx, rdx
+	.loc 1 42 25 discriminator 3
+	mov	rdx, QWORD PTR 8[rax]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+	.loc 1 40 48 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L4:
+	.loc 1 40 38 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 40 31 discriminator 1
+	cmp	DWORD PTR -8[rbp], eax
+	jl	.L5
+.LBE3:
+	.loc 1 44 23
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 44 13
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 45 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR -16[rbp]
+	mov	QWORD PTR 40[rax], rdx
+	.loc 1 46 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 48[rax]
+	.loc 1 46 29
+	lea	edx, [rax+rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 48[rax], edx
+	.loc 1 47 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 52[rax], 0
+	jmp	.L2
+.L3:
+	.loc 1 51 20
+	mov	DWORD PTR -4[rbp], 1
+.L2:
+.LBE2:
+	.loc 1 54 8
+	cmp	DWORD PTR -4[rbp], 0
+	jne	.L6
+	.loc 1 56 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 40[rax]
+	.loc 1 56 27
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 52[rax]
+	.loc 1 56 41
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 56 34
+	add	edx, eax
+	.loc 1 56 57
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 48[rax]
+	.loc 1 56 50
+	mov	eax, edx
+	cdq
+	idiv	esi
+	mov	eax, edx
+	cdqe
+	.loc 1 56 20
+	sal	rax, 4
+	add	rcx, rax
+	.loc 1 56 69
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+	.loc 1 57 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 57 21
+	lea	edx, 1[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 56[rax], edx
+.L6:
+	.loc 1 59 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 61 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 62 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE6:
+	.size	threadPool_QueuePush, .-threadPool_QueuePush
+	.type	threadPool_QueueTake, @function
+threadPool_QueueTake:
+.LFB7:
+	.loc 1 69 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 48
+	mov	QWORD PTR -24[rbp], rdi
+	mov	QWORD PTR -32[rbp], rsi
+	mov	DWORD PTR -36[rbp], edx
+	.loc 1 70 9
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 72 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 73 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 73 8
+	test	eax, eax
+	jle	.L9
+	.loc 1 75 12
+	cmp	DWORD PTR -36[rbp], 0
+	je	.L10
+	.loc 1 77 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdx, QWORD PTR 40[rax]
+	.loc 1 77 37
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 52[rax]
+	cdqe
+	.loc 1 77 31
+	sal	rax, 4
+	add	rax, rdx
+	.loc 1 77 18
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+	.loc 1 78 33
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 52[rax]
+	.loc 1 78 40
+	lea	edx, 1[rax]
+	.loc 1 78 52
+	mov	rax, QWORD PTR -24[rbp]
+	mov	ecx, DWORD PTR 48[rax]
+	.loc 1 78 45
+	mov	eax, edx
+	cdq
+	idiv	ecx
+	.loc 1 78 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 52[rax], edx
+	jmp	.L11
+.L10:
+	.loc 1 82 25
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 40[rax]
+	.loc 1 82 38
+	mov	rax, QWORD PTR -24[rbp]
+	mov	edx, DWORD PTR 52[rax]
+	.loc 1 82 52
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 82 45
+	add	eax, edx
+	.loc 1 82 60
+	lea	edx, -1[rax]
+	.loc 1 82 72
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 48[rax]
+	.loc 1 82 65
+	mov	eax, edx
+	cdq
+	idiv	esi
+	mov	eax, edx
+	cdqe
+	.loc 1 82 31
+	sal	rax, 4
+	add	rax, rcx
+	.loc 1 82 18
+	mov	rcx, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR 8[rax]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR [rcx], rax
+	mov	QWORD PTR 8[rcx], rdx
+.L11:
+	.loc 1 84 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 56[rax]
+	.loc 1 84 21
+	lea	edx, -1[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 56[rax], edx
+	.loc 1 85 16
+	mov	DWORD PTR -4[rbp], 1
+.L9:
+	.loc 1 87 5
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 89 12
+	mov	eax, DWORD PTR -4[rbp]
+	.loc 1 90 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE7:
+	.size	threadPool_QueueTake, .-threadPool_QueueTake
+	.type	threadPool_Worker, @function
+threadPool_Worker:
+.LFB8:
+	.loc 1 93 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -56[rbp], rdi
+	.loc 1 94 25
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR -16[rbp], rax
+	.loc 1 95 19
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rax, QWORD PTR [rax]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 96 15
+	mov	rax, QWORD PTR -16[rbp]
+	mov	eax, DWORD PTR 8[rax]
+	mov	DWORD PTR -28[rbp], eax
+	.loc 1 99 5
+	mov	rax, QWORD PTR -16[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 100 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR fs:currentPool@tpoff, rax
+	.loc 1 101 19
+	mov	eax, DWORD PTR -28[rbp]
+	mov	DWORD PTR fs:currentWorker@tpoff, eax
+.L22:
+.LBB4:
+	.loc 1 106 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 107 15
+	jmp	.L14
+.L16:
+	.loc 1 109 13
+	mov	rax, QWORD PTR -24[rbp]
+	lea	rdx, 24[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 64
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	pthread_cond_wait@PLT
+.L14:
+	.loc 1 107 21
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 160[rax]
+	.loc 1 107 36
+	test	eax, eax
+	jne	.L15
+	.loc 1 107 44 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 172[rax]
+	.loc 1 107 36 discriminator 1
+	test	eax, eax
+	je	.L16
+.L15:
+	.loc 1 111 17
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 160[rax]
+	.loc 1 111 12
+	test	eax, eax
+	jne	.L17
+	.loc 1 113 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 114 13
+	jmp	.L24
+.L17:
+	.loc 1 116 13
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 160[rax]
+	.loc 1 116 21
+	lea	edx, -1[rax]
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 160[rax], edx
+	.loc 1 117 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 120 47
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 120 55
+	mov	edx, DWORD PTR -28[rbp]
+	movsx	rdx, edx
+	sal	rdx, 6
+	.loc 1 120 21
+	lea	rcx, [rax+rdx]
+	lea	rax, -48[rbp]
+	mov	edx, 0
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	threadPool_QueueTake
+	mov	DWORD PTR -4[rbp], eax
+.LBB5:
+	.loc 1 121 18
+	mov	DWORD PTR -8[rbp], 1
+	.loc 1 121 9
+	jmp	.L19
+.L20:
+	.loc 1 123 47 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rcx, QWORD PTR 8[rax]
+	.loc 1 123 63 discriminator 3
+	mov	edx, DWORD PTR -28[rbp]
+	mov	eax, DWORD PTR -8[rbp]
+	add	edx, eax
+	.loc 1 123 74 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	esi, DWORD PTR 16[rax]
+	.loc 1 123 68 discriminator 3
+	mov	eax, edx
+	cdq
+	idiv	esi
+	mov	eax, edx
+	cdqe
+	.loc 1 123 55 discriminator 3
+	sal	rax, 6
+	.loc 1 123 21 discriminator 3
+	add	rcx, rax
+	lea	rax, -48[rbp]
+	mov	edx, 1
+	mov	rsi, rax
+	mov	rdi, rcx
+	call	threadPool_QueueTake
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 121 38 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L19:
+	.loc 1 121 31 discriminator 1
+	cmp	DWORD PTR -4[rbp], 0
+	je	.L20
+.LBE5:
+	.loc 1 126 12
+	mov	rdx, QWORD PTR -48[rbp]
+	.loc 1 126 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	rdx
+.LVL0:
+	.loc 1 128 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 129 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 164[rax]
+	.loc 1 129 13
+	lea	edx, -1[rax]
+	.loc 1 129 12
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 164[rax], edx
+	.loc 1 129 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 164[rax]
+	.loc 1 129 12
+	test	eax, eax
+	jne	.L21
+	.loc 1 131 13
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 112
+	mov	rdi, rax
+	call	pthread_cond_broadcast@PLT
+.L21:
+	.loc 1 133 9
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+.LBE4:
+	.loc 1 104 5
+	jmp	.L22
+.L24:
+	.loc 1 135 12
+	mov	eax, 0
+	.loc 1 136 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE8:
+	.size	threadPool_Worker, .-threadPool_Worker
+	.globl	threadPool_NumberOfCpus
+	.type	threadPool_NumberOfCpus, @function
+threadPool_NumberOfCpus:
+.LFB9:
+	.loc 1 139 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	.loc 1 140 17
+	mov	edi, 84
+	call	sysconf@PLT
+	mov	QWORD PTR -8[rbp], rax
+	.loc 1 141 35
+	cmp	QWORD PTR -8[rbp], 0
+	jle	.L26
+	.loc 1 141 35 is_stmt 0 discriminator 1
+	mov	rax, QWORD PTR -8[rbp]
+	jmp	.L28
+.L26:
+	.loc 1 141 35 discriminator 2
+	mov	eax, 1
+.L28:
+	.loc 1 142 1 is_stmt 1 discriminator 5
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE9:
+	.size	threadPool_NumberOfCpus, .-threadPool_NumberOfCpus
+	.section	.rodata
+.LC0:
+	.string	"Error allocating thread pool"
+.LC1:
+	.string	"pthread_create"
+	.text
+	.globl	threadPool_Init
+	.type	threadPool_Init, @function
+threadPool_Init:
+.LFB10:
+	.loc 1 145 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	push	rbx
+	sub	rsp, 40
+	.cfi_offset 3, -24
+	mov	QWORD PTR -40[rbp], rdi
+	mov	DWORD PTR -44[rbp], esi
+	.loc 1 146 5
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, 176
+	mov	esi, 0
+	mov	rdi, rax
+	call	memset@PLT
+	.loc 1 147 60
+	cmp	DWORD PTR -44[rbp], 0
+	jg	.L30
+	.loc 1 147 62 discriminator 1
+	call	threadPool_NumberOfCpus
+	jmp	.L31
+.L30:
+	.loc 1 147 60 discriminator 2
+	mov	eax, DWORD PTR -44[rbp]
+.L31:
+	.loc 1 147 24 discriminator 4
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	DWORD PTR 16[rdx], eax
+	.loc 1 149 44 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 149 33 discriminator 4
+	cdqe
+	mov	esi, 8
+	mov	rdi, rax
+	call	calloc@PLT
+	mov	rdx, rax
+	.loc 1 149 19 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 150 51 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 150 40 discriminator 4
+	cdqe
+	mov	esi, 64
+	mov	rdi, rax
+	call	calloc@PLT
+	mov	rdx, rax
+	.loc 1 150 18 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	QWORD PTR 8[rax], rdx
+	.loc 1 151 14 discriminator 4
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 151 8 discriminator 4
+	test	rax, rax
+	je	.L32
+	.loc 1 151 41 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 151 33 discriminator 1
+	test	rax, rax
+	jne	.L33
+.L32:
+	.loc 1 153 9
+	lea	rax, .LC0[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 154 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 154 9
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 155 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 155 9
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 156 16
+	mov	eax, 1
+	jmp	.L34
+.L33:
+	.loc 1 159 5
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 24
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_mutex_init@PLT
+	.loc 1 160 5
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 64
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_cond_init@PLT
+	.loc 1 161 5
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 112
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_cond_init@PLT
+	.loc 1 163 29
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR 16[rax]
+	.loc 1 163 23
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 20[rax], edx
+.LBB6:
+	.loc 1 164 14
+	mov	DWORD PTR -20[rbp], 0
+	.loc 1 164 5
+	jmp	.L35
+.L36:
+	.loc 1 166 33 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 166 41 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 6
+	add	rax, rdx
+	.loc 1 166 9 discriminator 3
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_mutex_init@PLT
+	.loc 1 167 13 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 167 21 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 6
+	add	rax, rdx
+	.loc 1 167 34 discriminator 3
+	mov	DWORD PTR 48[rax], 64
+	.loc 1 168 13 discriminator 3
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 168 21 discriminator 3
+	mov	edx, DWORD PTR -20[rbp]
+	movsx	rdx, edx
+	sal	rdx, 6
+	lea	rbx, [rax+rdx]
+	.loc 1 168 50 discriminator 3
+	mov	edi, 1024
+	call	malloc@PLT
+	.loc 1 168 30 discriminator 3
+	mov	QWORD PTR 40[rbx], rax
+	.loc 1 164 45 discriminator 3
+	add	DWORD PTR -20[rbp], 1
+.L35:
+	.loc 1 164 29 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 164 23 discriminator 1
+	cmp	DWORD PTR -20[rbp], eax
+	jl	.L36
+.LBE6:
+.LBB7:
+	.loc 1 171 14
+	mov	DWORD PTR -24[rbp], 0
+	.loc 1 171 5
+	jmp	.L37
+.L41:
+.LBB8:
+	.loc 1 173 59
+	mov	edi, 16
+	call	malloc@PLT
+	mov	QWORD PTR -32[rbp], rax
+	.loc 1 174 18
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 174 26
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 6
+	add	rax, rdx
+	.loc 1 174 29
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 174 12
+	test	rax, rax
+	je	.L38
+	.loc 1 174 44 discriminator 1
+	cmp	QWORD PTR -32[rbp], 0
+	jne	.L39
+.L38:
+	.loc 1 176 13
+	lea	rax, .LC0[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 177 13
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 178 32
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -24[rbp]
+	mov	DWORD PTR 16[rax], edx
+	.loc 1 179 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	threadPool_Destroy
+	.loc 1 180 20
+	mov	eax, 1
+	jmp	.L34
+.L39:
+	.loc 1 182 22
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdx, QWORD PTR -40[rbp]
+	mov	QWORD PTR [rax], rdx
+	.loc 1 183 23
+	mov	rax, QWORD PTR -32[rbp]
+	mov	edx, DWORD PTR -24[rbp]
+	mov	DWORD PTR 8[rax], edx
+	.loc 1 184 33
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 184 42
+	mov	edx, DWORD PTR -24[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	.loc 1 184 13
+	lea	rdi, [rax+rdx]
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rcx, rax
+	lea	rax, threadPool_Worker[rip]
+	mov	rdx, rax
+	mov	esi, 0
+	call	pthread_create@PLT
+	.loc 1 184 12
+	test	eax, eax
+	je	.L40
+	.loc 1 186 13
+	lea	rax, .LC1[rip]
+	mov	rdi, rax
+	call	perror@PLT
+	.loc 1 187 13
+	mov	rax, QWORD PTR -32[rbp]
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 188 32
+	mov	rax, QWORD PTR -40[rbp]
+	mov	edx, DWORD PTR -24[rbp]
+	mov	DWORD PTR 16[rax], edx
+	.loc 1 189 13
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rdi, rax
+	call	threadPool_Destroy
+	.loc 1 190 20
+	mov	eax, 1
+	jmp	.L34
+.L40:
+.LBE8:
+	.loc 1 171 46 discriminator 2
+	add	DWORD PTR -24[rbp], 1
+.L37:
+	.loc 1 171 29 discriminator 1
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 171 23 discriminator 1
+	cmp	DWORD PTR -24[rbp], eax
+	jl	.L41
+.LBE7:
+	.loc 1 193 12
+	mov	eax, 0
+.L34:
+	.loc 1 194 1
+	mov	rbx, QWORD PTR -8[rbp]
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE10:
+	.size	threadPool_Init, .-threadPool_Init
+	.section	.rodata
+	.align 8
+.LC2:
+	.string	"Error allocating thread pool queue"
+	.text
+	.globl	threadPool_Submit
+	.type	threadPool_Submit, @function
+threadPool_Submit:
+.LFB11:
+	.loc 1 197 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 64
+	mov	QWORD PTR -40[rbp], rdi
+	mov	QWORD PTR -48[rbp], rsi
+	mov	QWORD PTR -56[rbp], rdx
+	.loc 1 198 27
+	mov	rax, QWORD PTR -48[rbp]
+	mov	QWORD PTR -32[rbp], rax
+	mov	rax, QWORD PTR -56[rbp]
+	mov	QWORD PTR -24[rbp], rax
+	.loc 1 201 5
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 202 21
+	mov	rax, QWORD PTR fs:currentPool@tpoff
+	.loc 1 202 8
+	cmp	QWORD PTR -40[rbp], rax
+	jne	.L43
+	.loc 1 204 20
+	mov	eax, DWORD PTR fs:currentWorker@tpoff
+	mov	DWORD PTR -4[rbp], eax
+	jmp	.L44
+.L43:
+	.loc 1 208 20
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	mov	DWORD PTR -4[rbp], eax
+	.loc 1 209 32
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 168[rax]
+	.loc 1 209 44
+	lea	edx, 1[rax]
+	.loc 1 209 55
+	mov	rax, QWORD PTR -40[rbp]
+	mov	ecx, DWORD PTR 16[rax]
+	.loc 1 209 49
+	mov	eax, edx
+	cdq
+	idiv	ecx
+	.loc 1 209 25
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 168[rax], edx
+.L44:
+	.loc 1 211 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 164[rax]
+	.loc 1 211 18
+	lea	edx, 1[rax]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 164[rax], edx
+	.loc 1 212 5
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 214 35
+	mov	rax, QWORD PTR -40[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 214 43
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 6
+	.loc 1 214 9
+	add	rdx, rax
+	lea	rax, -32[rbp]
+	mov	rsi, rax
+	mov	rdi, rdx
+	call	threadPool_QueuePush
+	.loc 1 214 8
+	test	eax, eax
+	je	.L45
+	.loc 1 216 9
+	lea	rax, .LC2[rip]
+	mov	rdi, rax
+	call	puts@PLT
+	.loc 1 217 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 218 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 164[rax]
+	.loc 1 218 13
+	lea	edx, -1[rax]
+	.loc 1 218 12
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 164[rax], edx
+	.loc 1 218 19
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 164[rax]
+	.loc 1 218 12
+	test	eax, eax
+	jne	.L46
+	.loc 1 220 13
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 112
+	mov	rdi, rax
+	call	pthread_cond_broadcast@PLT
+.L46:
+	.loc 1 222 9
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 223 16
+	mov	eax, 1
+	jmp	.L48
+.L45:
+	.loc 1 226 5
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 227 9
+	mov	rax, QWORD PTR -40[rbp]
+	mov	eax, DWORD PTR 160[rax]
+	.loc 1 227 17
+	lea	edx, 1[rax]
+	mov	rax, QWORD PTR -40[rbp]
+	mov	DWORD PTR 160[rax], edx
+	.loc 1 228 5
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 64
+	mov	rdi, rax
+	call	pthread_cond_signal@PLT
+	.loc 1 229 5
+	mov	rax, QWORD PTR -40[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 231 12
+	mov	eax, 0
+.L48:
+	.loc 1 232 1 discriminator 1
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE11:
+	.size	threadPool_Submit, .-threadPool_Submit
+	.globl	threadPool_Wait
+	.type	threadPool_Wait, @function
+threadPool_Wait:
+.LFB12:
+	.loc 1 235 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 16
+	mov	QWORD PTR -8[rbp], rdi
+	.loc 1 236 5
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 237 11
+	jmp	.L50
+.L51:
+	.loc 1 239 9
+	mov	rax, QWORD PTR -8[rbp]
+	lea	rdx, 24[rax]
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 112
+	mov	rsi, rdx
+	mov	rdi, rax
+	call	pthread_cond_wait@PLT
+.L50:
+	.loc 1 237 16
+	mov	rax, QWORD PTR -8[rbp]
+	mov	eax, DWORD PTR 164[rax]
+	.loc 1 237 26
+	test	eax, eax
+	jg	.L51
+	.loc 1 241 5
+	mov	rax, QWORD PTR -8[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+	.loc 1 242 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE12:
+	.size	threadPool_Wait, .-threadPool_Wait
+	.globl	threadPool_Destroy
+	.type	threadPool_Destroy, @function
+threadPool_Destroy:
+.LFB13:
+	.loc 1 245 1
+	.cfi_startproc
+	push	rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	mov	rbp, rsp
+	.cfi_def_cfa_register 6
+	sub	rsp, 32
+	mov	QWORD PTR -24[rbp], rdi
+	.loc 1 246 5
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_lock@PLT
+	.loc 1 247 20
+	mov	rax, QWORD PTR -24[rbp]
+	mov	DWORD PTR 172[rax], 1
+	.loc 1 248 5
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 64
+	mov	rdi, rax
+	call	pthread_cond_broadcast@PLT
+	.loc 1 249 5
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_unlock@PLT
+.LBB9:
+	.loc 1 251 14
+	mov	DWORD PTR -4[rbp], 0
+	.loc 1 251 5
+	jmp	.L53
+.L54:
+	.loc 1 253 26 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 253 35 discriminator 3
+	mov	edx, DWORD PTR -4[rbp]
+	movsx	rdx, edx
+	sal	rdx, 3
+	add	rax, rdx
+	.loc 1 253 9 discriminator 3
+	mov	rax, QWORD PTR [rax]
+	mov	esi, 0
+	mov	rdi, rax
+	call	pthread_join@PLT
+	.loc 1 251 46 discriminator 3
+	add	DWORD PTR -4[rbp], 1
+.L53:
+	.loc 1 251 29 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 16[rax]
+	.loc 1 251 23 discriminator 1
+	cmp	DWORD PTR -4[rbp], eax
+	jl	.L54
+.LBE9:
+.LBB10:
+	.loc 1 257 14
+	mov	DWORD PTR -8[rbp], 0
+	.loc 1 257 5
+	jmp	.L55
+.L56:
+	.loc 1 259 18 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 259 26 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	movsx	rdx, edx
+	sal	rdx, 6
+	add	rax, rdx
+	.loc 1 259 29 discriminator 3
+	mov	rax, QWORD PTR 40[rax]
+	.loc 1 259 9 discriminator 3
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 260 36 discriminator 3
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 260 44 discriminator 3
+	mov	edx, DWORD PTR -8[rbp]
+	movsx	rdx, edx
+	sal	rdx, 6
+	add	rax, rdx
+	.loc 1 260 9 discriminator 3
+	mov	rdi, rax
+	call	pthread_mutex_destroy@PLT
+	.loc 1 257 45 discriminator 3
+	add	DWORD PTR -8[rbp], 1
+.L55:
+	.loc 1 257 29 discriminator 1
+	mov	rax, QWORD PTR -24[rbp]
+	mov	eax, DWORD PTR 20[rax]
+	.loc 1 257 23 discriminator 1
+	cmp	DWORD PTR -8[rbp], eax
+	jl	.L56
+.LBE10:
+	.loc 1 262 5
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 24
+	mov	rdi, rax
+	call	pthread_mutex_destroy@PLT
+	.loc 1 263 5
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 64
+	mov	rdi, rax
+	call	pthread_cond_destroy@PLT
+	.loc 1 264 5
+	mov	rax, QWORD PTR -24[rbp]
+	add	rax, 112
+	mov	rdi, rax
+	call	pthread_cond_destroy@PLT
+	.loc 1 265 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR [rax]
+	.loc 1 265 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 266 14
+	mov	rax, QWORD PTR -24[rbp]
+	mov	rax, QWORD PTR 8[rax]
+	.loc 1 266 5
+	mov	rdi, rax
+	call	free@PLT
+	.loc 1 267 19
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR [rax], 0
+	.loc 1 268 18
+	mov	rax, QWORD PTR -24[rbp]
+	mov	QWORD PTR 8[rax], 0
+	.loc 1 269 1
+	nop
+	leave
+	.cfi_def_cfa 7, 8
+	ret
+	.cfi_endproc
+.LFE13:
+	.size	threadPool_Destroy, .-threadPool_Destroy
+.Letext0:
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.file 7 "include/threadPool.h"
+	.file 8 "/usr/include/pthread.h"
+	.file 9 "/usr/include/stdlib.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "/usr/include/unistd.h"
+	.file 12 "/usr/include/stdio.h"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.section	.debug_info,"",@progbits
+.Ldebug_info0:
+	.long	0xfb0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF323
+	.byte	0x1d
+	.long	.LASF0
+	.long	.LASF1
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.long	.Ldebug_line0
+	.uleb128 0x5
+	.long	.LASF16
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x17
+	.long	0x3a
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.long	0x41
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF4
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF5
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF6
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF7
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF8
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF9
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0xe
+	.long	0x7e
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF10
+	.uleb128 0xb
+	.long	0x85
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x2
+	.byte	0x1c
+	.byte	0x3
+	.long	0xb5
+	.uleb128 0x2
+	.long	.LASF11
+	.byte	0x2
+	.byte	0x1e
+	.byte	0x12
+	.long	0x69
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF12
+	.byte	0x2
+	.byte	0x1f
+	.byte	0x12
+	.long	0x69
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x2
+	.byte	0x19
+	.long	0xd6
+	.uleb128 0x6
+	.long	.LASF13
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x28
+	.long	0xd6
+	.uleb128 0x6
+	.long	.LASF14
+	.byte	0x2
+	.byte	0x20
+	.byte	0x5
+	.long	0x91
+	.byte	0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF15
+	.uleb128 0x5
+	.long	.LASF17
+	.byte	0x2
+	.byte	0x21
+	.byte	0x3
+	.long	0xb5
+	.uleb128 0x13
+	.long	.LASF21
+	.byte	0x10
+	.byte	0x4
+	.byte	0x33
+	.byte	0x10
+	.long	0x111
+	.uleb128 0x2
+	.long	.LASF18
+	.byte	0x4
+	.byte	0x35
+	.byte	0x23
+	.long	0x111
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF19
+	.byte	0x4
+	.byte	0x36
+	.byte	0x23
+	.long	0x111
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0xe9
+	.uleb128 0x5
+	.long	.LASF20
+	.byte	0x4
+	.byte	0x37
+	.byte	0x3
+	.long	0xe9
+	.uleb128 0x13
+	.long	.LASF22
+	.byte	0x28
+	.byte	0x5
+	.byte	0x16
+	.byte	0x8
+	.long	0x198
+	.uleb128 0x2
+	.long	.LASF23
+	.byte	0x5
+	.byte	0x18
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF24
+	.byte	0x5
+	.byte	0x19
+	.byte	0x10
+	.long	0x69
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF25
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x7
+	.long	0x41
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF26
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x10
+	.long	0x69
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF27
+	.byte	0x5
+	.byte	0x20
+	.byte	0x7
+	.long	0x41
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF28
+	.byte	0x5
+	.byte	0x22
+	.byte	0x9
+	.long	0x77
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF29
+	.byte	0x5
+	.byte	0x23
+	.byte	0x9
+	.long	0x77
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF30
+	.byte	0x5
+	.byte	0x24
+	.byte	0x14
+	.long	0x116
+	.byte	0x18
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF31
+	.byte	0x30
+	.byte	0x4
+	.byte	0x5e
+	.byte	0x8
+	.long	0x201
+	.uleb128 0x2
+	.long	.LASF32
+	.byte	0x4
+	.byte	0x60
+	.byte	0x19
+	.long	0xdd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF33
+	.byte	0x4
+	.byte	0x61
+	.byte	0x19
+	.long	0xdd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF34
+	.byte	0x4
+	.byte	0x62
+	.byte	0x10
+	.long	0x201
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF35
+	.byte	0x4
+	.byte	0x63
+	.byte	0x10
+	.long	0x201
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF36
+	.byte	0x4
+	.byte	0x64
+	.byte	0x10
+	.long	0x69
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF37
+	.byte	0x4
+	.byte	0x65
+	.byte	0x10
+	.long	0x69
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF38
+	.byte	0x4
+	.byte	0x66
+	.byte	0x10
+	.long	0x201
+	.byte	0x28
+	.byte	0
+	.uleb128 0x11
+	.long	0x69
+	.long	0x211
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF39
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x1b
+	.long	0x3a
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x6
+	.byte	0x20
+	.long	0x23e
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x22
+	.byte	0x8
+	.long	0x23e
+	.uleb128 0x6
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x23
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x11
+	.long	0x85
+	.long	0x24e
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF42
+	.byte	0x6
+	.byte	0x24
+	.byte	0x3
+	.long	0x21d
+	.uleb128 0xb
+	.long	0x24e
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x6
+	.byte	0x29
+	.long	0x280
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x8
+	.long	0x23e
+	.uleb128 0x6
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x2c
+	.byte	0x7
+	.long	0x41
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF43
+	.byte	0x6
+	.byte	0x2d
+	.byte	0x3
+	.long	0x25f
+	.uleb128 0xb
+	.long	0x280
+	.uleb128 0x1e
+	.long	.LASF44
+	.byte	0x38
+	.byte	0x6
+	.byte	0x38
+	.byte	0x7
+	.long	0x2b7
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x8
+	.long	0x2b7
+	.uleb128 0x6
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x3b
+	.byte	0xc
+	.long	0x4d
+	.byte	0
+	.uleb128 0x11
+	.long	0x85
+	.long	0x2c7
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x37
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF44
+	.byte	0x6
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x291
+	.uleb128 0xb
+	.long	0x2c7
+	.uleb128 0x10
+	.byte	0x28
+	.byte	0x6
+	.byte	0x43
+	.long	0x305
+	.uleb128 0x6
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x45
+	.byte	0x1c
+	.long	0x122
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x46
+	.byte	0x8
+	.long	0x305
+	.uleb128 0x6
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x47
+	.byte	0xc
+	.long	0x4d
+	.byte	0
+	.uleb128 0x11
+	.long	0x85
+	.long	0x315
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x27
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF46
+	.byte	0x6
+	.byte	0x48
+	.byte	0x3
+	.long	0x2d8
+	.uleb128 0x10
+	.byte	0x30
+	.byte	0x6
+	.byte	0x4b
+	.long	0x34e
+	.uleb128 0x6
+	.long	.LASF45
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x198
+	.uleb128 0x6
+	.long	.LASF40
+	.byte	0x6
+	.byte	0x4e
+	.byte	0x8
+	.long	0x34e
+	.uleb128 0x6
+	.long	.LASF41
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x1f
+	.long	0x54
+	.byte	0
+	.uleb128 0x11
+	.long	0x85
+	.long	0x35e
+	.uleb128 0x12
+	.long	0x3a
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF47
+	.byte	0x6
+	.byte	0x50
+	.byte	0x3
+	.long	0x321
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x1f
+	.byte	0x7
+	.byte	0x4
+	.long	0x69
+	.byte	0xd
+	.byte	0x48
+	.byte	0x3
+	.long	0x894
+	.uleb128 0x1
+	.long	.LASF48
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF49
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF50
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF51
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF52
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF54
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF55
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF56
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF57
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF58
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF59
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF60
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF61
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF62
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF63
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF64
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF65
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF66
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF67
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF68
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF69
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF70
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF71
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF72
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF73
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF74
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF75
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF76
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF77
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF78
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF79
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF80
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF81
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF82
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF83
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF84
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF85
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF86
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF87
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF88
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF89
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF90
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF91
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF92
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF93
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF94
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF95
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF96
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF97
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF98
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF99
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF100
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF101
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF102
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF103
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF104
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF105
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF106
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF107
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF108
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF109
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF110
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF111
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF112
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF113
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF114
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF115
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF116
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF117
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF118
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF119
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF120
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF121
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF122
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF123
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF124
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF125
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF126
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF127
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF128
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF129
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF130
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF131
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF132
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF133
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF134
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF135
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF136
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF137
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF138
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF139
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF140
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF141
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF142
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF143
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF144
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF145
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF146
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF147
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF148
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF149
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF150
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF151
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF152
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF153
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF154
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF155
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF156
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF157
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF158
+	.byte	0x6d
+	.uleb128 0x1
+	.long	.LASF159
+	.byte	0x6e
+	.uleb128 0x1
+	.long	.LASF160
+	.byte	0x6f
+	.uleb128 0x1
+	.long	.LASF161
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF162
+	.byte	0x71
+	.uleb128 0x1
+	.long	.LASF163
+	.byte	0x72
+	.uleb128 0x1
+	.long	.LASF164
+	.byte	0x73
+	.uleb128 0x1
+	.long	.LASF165
+	.byte	0x74
+	.uleb128 0x1
+	.long	.LASF166
+	.byte	0x75
+	.uleb128 0x1
+	.long	.LASF167
+	.byte	0x76
+	.uleb128 0x1
+	.long	.LASF168
+	.byte	0x77
+	.uleb128 0x1
+	.long	.LASF169
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF170
+	.byte	0x79
+	.uleb128 0x1
+	.long	.LASF171
+	.byte	0x7a
+	.uleb128 0x1
+	.long	.LASF172
+	.byte	0x7b
+	.uleb128 0x1
+	.long	.LASF173
+	.byte	0x7c
+	.uleb128 0x1
+	.long	.LASF174
+	.byte	0x7d
+	.uleb128 0x1
+	.long	.LASF175
+	.byte	0x7e
+	.uleb128 0x1
+	.long	.LASF176
+	.byte	0x7f
+	.uleb128 0x1
+	.long	.LASF177
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF178
+	.byte	0x81
+	.uleb128 0x1
+	.long	.LASF179
+	.byte	0x82
+	.uleb128 0x1
+	.long	.LASF180
+	.byte	0x83
+	.uleb128 0x1
+	.long	.LASF181
+	.byte	0x84
+	.uleb128 0x1
+	.long	.LASF182
+	.byte	0x85
+	.uleb128 0x1
+	.long	.LASF183
+	.byte	0x86
+	.uleb128 0x1
+	.long	.LASF184
+	.byte	0x87
+	.uleb128 0x1
+	.long	.LASF185
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF186
+	.byte	0x89
+	.uleb128 0x1
+	.long	.LASF187
+	.byte	0x8a
+	.uleb128 0x1
+	.long	.LASF188
+	.byte	0x8b
+	.uleb128 0x1
+	.long	.LASF189
+	.byte	0x8c
+	.uleb128 0x1
+	.long	.LASF190
+	.byte	0x8d
+	.uleb128 0x1
+	.long	.LASF191
+	.byte	0x8e
+	.uleb128 0x1
+	.long	.LASF192
+	.byte	0x8f
+	.uleb128 0x1
+	.long	.LASF193
+	.byte	0x90
+	.uleb128 0x1
+	.long	.LASF194
+	.byte	0x91
+	.uleb128 0x1
+	.long	.LASF195
+	.byte	0x92
+	.uleb128 0x1
+	.long	.LASF196
+	.byte	0x93
+	.uleb128 0x1
+	.long	.LASF197
+	.byte	0x94
+	.uleb128 0x1
+	.long	.LASF198
+	.byte	0x95
+	.uleb128 0x1
+	.long	.LASF199
+	.byte	0x96
+	.uleb128 0x1
+	.long	.LASF200
+	.byte	0x97
+	.uleb128 0x1
+	.long	.LASF201
+	.byte	0x98
+	.uleb128 0x1
+	.long	.LASF202
+	.byte	0x99
+	.uleb128 0x1
+	.long	.LASF203
+	.byte	0x9a
+	.uleb128 0x1
+	.long	.LASF204
+	.byte	0x9b
+	.uleb128 0x1
+	.long	.LASF205
+	.byte	0x9c
+	.uleb128 0x1
+	.long	.LASF206
+	.byte	0x9d
+	.uleb128 0x1
+	.long	.LASF207
+	.byte	0x9e
+	.uleb128 0x1
+	.long	.LASF208
+	.byte	0x9f
+	.uleb128 0x1
+	.long	.LASF209
+	.byte	0xa0
+	.uleb128 0x1
+	.long	.LASF210
+	.byte	0xa1
+	.uleb128 0x1
+	.long	.LASF211
+	.byte	0xa2
+	.uleb128 0x1
+	.long	.LASF212
+	.byte	0xa3
+	.uleb128 0x1
+	.long	.LASF213
+	.byte	0xa4
+	.uleb128 0x1
+	.long	.LASF214
+	.byte	0xa5
+	.uleb128 0x1
+	.long	.LASF215
+	.byte	0xa6
+	.uleb128 0x1
+	.long	.LASF216
+	.byte	0xa7
+	.uleb128 0x1
+	.long	.LASF217
+	.byte	0xa8
+	.uleb128 0x1
+	.long	.LASF218
+	.byte	0xa9
+	.uleb128 0x1
+	.long	.LASF219
+	.byte	0xaa
+	.uleb128 0x1
+	.long	.LASF220
+	.byte	0xab
+	.uleb128 0x1
+	.long	.LASF221
+	.byte	0xac
+	.uleb128 0x1
+	.long	.LASF222
+	.byte	0xad
+	.uleb128 0x1
+	.long	.LASF223
+	.byte	0xae
+	.uleb128 0x1
+	.long	.LASF224
+	.byte	0xaf
+	.uleb128 0x1
+	.long	.LASF225
+	.byte	0xb0
+	.uleb128 0x1
+	.long	.LASF226
+	.byte	0xb1
+	.uleb128 0x1
+	.long	.LASF227
+	.byte	0xb2
+	.uleb128 0x1
+	.long	.LASF228
+	.byte	0xb3
+	.uleb128 0x1
+	.long	.LASF229
+	.byte	0xb4
+	.uleb128 0x1
+	.long	.LASF230
+	.byte	0xb5
+	.uleb128 0x1
+	.long	.LASF231
+	.byte	0xb6
+	.uleb128 0x1
+	.long	.LASF232
+	.byte	0xb7
+	.uleb128 0x1
+	.long	.LASF233
+	.byte	0xb8
+	.uleb128 0x1
+	.long	.LASF234
+	.byte	0xb9
+	.uleb128 0x1
+	.long	.LASF235
+	.byte	0xba
+	.uleb128 0x1
+	.long	.LASF236
+	.byte	0xbb
+	.uleb128 0x1
+	.long	.LASF237
+	.byte	0xbc
+	.uleb128 0x1
+	.long	.LASF238
+	.byte	0xbd
+	.uleb128 0x1
+	.long	.LASF239
+	.byte	0xbe
+	.uleb128 0x1
+	.long	.LASF240
+	.byte	0xbf
+	.uleb128 0x1
+	.long	.LASF241
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF242
+	.byte	0xc1
+	.uleb128 0x1
+	.long	.LASF243
+	.byte	0xc2
+	.uleb128 0x1
+	.long	.LASF244
+	.byte	0xc3
+	.uleb128 0x1
+	.long	.LASF245
+	.byte	0xc4
+	.uleb128 0x1
+	.long	.LASF246
+	.byte	0xc5
+	.uleb128 0x1
+	.long	.LASF247
+	.byte	0xc6
+	.uleb128 0x1
+	.long	.LASF248
+	.byte	0xc7
+	.uleb128 0x1
+	.long	.LASF249
+	.byte	0xeb
+	.uleb128 0x1
+	.long	.LASF250
+	.byte	0xec
+	.uleb128 0x1
+	.long	.LASF251
+	.byte	0xed
+	.uleb128 0x1
+	.long	.LASF252
+	.byte	0xee
+	.uleb128 0x1
+	.long	.LASF253
+	.byte	0xef
+	.uleb128 0x1
+	.long	.LASF254
+	.byte	0xf0
+	.uleb128 0x1
+	.long	.LASF255
+	.byte	0xf1
+	.uleb128 0x1
+	.long	.LASF256
+	.byte	0xf2
+	.uleb128 0x1
+	.long	.LASF257
+	.byte	0xf3
+	.uleb128 0x1
+	.long	.LASF258
+	.byte	0xf4
+	.uleb128 0x1
+	.long	.LASF259
+	.byte	0xf5
+	.uleb128 0x1
+	.long	.LASF260
+	.byte	0xf6
+	.uleb128 0x1
+	.long	.LASF261
+	.byte	0xf7
+	.uleb128 0x1
+	.long	.LASF262
+	.byte	0xf8
+	.uleb128 0x1
+	.long	.LASF263
+	.byte	0xf9
+	.uleb128 0x1
+	.long	.LASF264
+	.byte	0xfa
+	.byte	0
+	.uleb128 0x20
+	.long	0x89f
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x4
+	.long	0x894
+	.uleb128 0x5
+	.long	.LASF265
+	.byte	0x7
+	.byte	0xe
+	.byte	0x10
+	.long	0x89f
+	.uleb128 0xf
+	.byte	0x10
+	.byte	0x7
+	.byte	0x10
+	.byte	0x9
+	.long	0x8d4
+	.uleb128 0x2
+	.long	.LASF266
+	.byte	0x7
+	.byte	0x12
+	.byte	0x16
+	.long	0x8a4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF267
+	.byte	0x7
+	.byte	0x13
+	.byte	0xb
+	.long	0x7e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF268
+	.byte	0x7
+	.byte	0x14
+	.byte	0x3
+	.long	0x8b0
+	.uleb128 0xb
+	.long	0x8d4
+	.uleb128 0xf
+	.byte	0x40
+	.byte	0x7
+	.byte	0x17
+	.byte	0x9
+	.long	0x930
+	.uleb128 0x2
+	.long	.LASF269
+	.byte	0x7
+	.byte	0x19
+	.byte	0x15
+	.long	0x315
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF270
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x16
+	.long	0x930
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF271
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x9
+	.long	0x41
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF272
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x9
+	.long	0x41
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF273
+	.byte	0x7
+	.byte	0x1d
+	.byte	0x9
+	.long	0x41
+	.byte	0x38
+	.byte	0
+	.uleb128 0x4
+	.long	0x8d4
+	.uleb128 0x5
+	.long	.LASF274
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x3
+	.long	0x8e5
+	.uleb128 0xf
+	.byte	0xb0
+	.byte	0x7
+	.byte	0x20
+	.byte	0x9
+	.long	0x9da
+	.uleb128 0x2
+	.long	.LASF275
+	.byte	0x7
+	.byte	0x22
+	.byte	0x10
+	.long	0x9da
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF276
+	.byte	0x7
+	.byte	0x23
+	.byte	0x18
+	.long	0x9e4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF277
+	.byte	0x7
+	.byte	0x24
+	.byte	0x9
+	.long	0x41
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF278
+	.byte	0x7
+	.byte	0x25
+	.byte	0x9
+	.long	0x41
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF269
+	.byte	0x7
+	.byte	0x26
+	.byte	0x15
+	.long	0x315
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF279
+	.byte	0x7
+	.byte	0x27
+	.byte	0x14
+	.long	0x35e
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF280
+	.byte	0x7
+	.byte	0x28
+	.byte	0x14
+	.long	0x35e
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF281
+	.byte	0x7
+	.byte	0x29
+	.byte	0x9
+	.long	0x41
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF282
+	.byte	0x7
+	.byte	0x2a
+	.byte	0x9
+	.long	0x41
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF283
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x9
+	.long	0x41
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF284
+	.byte	0x7
+	.byte	0x2c
+	.byte	0x9
+	.long	0x41
+	.byte	0xac
+	.byte	0
+	.uleb128 0x4
+	.long	0x211
+	.uleb128 0xe
+	.long	0x9da
+	.uleb128 0x4
+	.long	0x935
+	.uleb128 0x5
+	.long	.LASF285
+	.byte	0x7
+	.byte	0x2d
+	.byte	0x3
+	.long	0x941
+	.uleb128 0xb
+	.long	0x9e9
+	.uleb128 0xf
+	.byte	0x10
+	.byte	0x1
+	.byte	0x11
+	.byte	0x9
+	.long	0xa1e
+	.uleb128 0x2
+	.long	.LASF286
+	.byte	0x1
+	.byte	0x13
+	.byte	0x13
+	.long	0xa1e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF287
+	.byte	0x1
+	.byte	0x14
+	.byte	0x9
+	.long	0x41
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x9e9
+	.uleb128 0x5
+	.long	.LASF288
+	.byte	0x1
+	.byte	0x15
+	.byte	0x3
+	.long	0x9fa
+	.uleb128 0x7
+	.long	.LASF289
+	.byte	0x17
+	.byte	0x25
+	.long	0xa45
+	.uleb128 0xa
+	.byte	0xe
+	.long	currentPool@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0x4
+	.long	0x9f5
+	.uleb128 0x7
+	.long	.LASF290
+	.byte	0x18
+	.byte	0x15
+	.long	0x41
+	.uleb128 0xa
+	.byte	0xe
+	.long	currentWorker@dtpoff, 0
+	.byte	0x9b
+	.uleb128 0x8
+	.long	.LASF291
+	.byte	0x8
+	.value	0x45d
+	.byte	0xc
+	.long	0x41
+	.long	0xa77
+	.uleb128 0x3
+	.long	0xa77
+	.byte	0
+	.uleb128 0x4
+	.long	0x35e
+	.uleb128 0xe
+	.long	0xa77
+	.uleb128 0x8
+	.long	.LASF292
+	.byte	0x8
+	.value	0x312
+	.byte	0xc
+	.long	0x41
+	.long	0xa98
+	.uleb128 0x3
+	.long	0xa98
+	.byte	0
+	.uleb128 0x4
+	.long	0x315
+	.uleb128 0xe
+	.long	0xa98
+	.uleb128 0x14
+	.long	.LASF293
+	.byte	0x8
+	.byte	0xdb
+	.byte	0xc
+	.long	0x41
+	.long	0xabd
+	.uleb128 0x3
+	.long	0x211
+	.uleb128 0x3
+	.long	0xabd
+	.byte	0
+	.uleb128 0x4
+	.long	0x7e
+	.uleb128 0x8
+	.long	.LASF294
+	.byte	0x8
+	.value	0x461
+	.byte	0xc
+	.long	0x41
+	.long	0xad9
+	.uleb128 0x3
+	.long	0xa77
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF304
+	.byte	0xc
+	.value	0x324
+	.long	0xaeb
+	.uleb128 0x3
+	.long	0x36a
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF295
+	.byte	0x8
+	.byte	0xca
+	.byte	0xc
+	.long	0x41
+	.long	0xb10
+	.uleb128 0x3
+	.long	0x9df
+	.uleb128 0x3
+	.long	0xb15
+	.uleb128 0x3
+	.long	0xb1a
+	.uleb128 0x3
+	.long	0x80
+	.byte	0
+	.uleb128 0x4
+	.long	0x2d3
+	.uleb128 0xe
+	.long	0xb10
+	.uleb128 0x4
+	.long	0xb1f
+	.uleb128 0x21
+	.long	0x7e
+	.long	0xb2e
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF296
+	.byte	0x8
+	.value	0x458
+	.byte	0xc
+	.long	0x41
+	.long	0xb4a
+	.uleb128 0x3
+	.long	0xa7c
+	.uleb128 0x3
+	.long	0xb4f
+	.byte	0
+	.uleb128 0x4
+	.long	0x28c
+	.uleb128 0xe
+	.long	0xb4a
+	.uleb128 0x8
+	.long	.LASF297
+	.byte	0x8
+	.value	0x30d
+	.byte	0xc
+	.long	0x41
+	.long	0xb70
+	.uleb128 0x3
+	.long	0xa98
+	.uleb128 0x3
+	.long	0xb70
+	.byte	0
+	.uleb128 0x4
+	.long	0x25a
+	.uleb128 0x8
+	.long	.LASF298
+	.byte	0x9
+	.value	0x22c
+	.byte	0xe
+	.long	0x7e
+	.long	0xb91
+	.uleb128 0x3
+	.long	0x2e
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF299
+	.byte	0xa
+	.byte	0x3d
+	.byte	0xe
+	.long	0x7e
+	.long	0xbb1
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x41
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF300
+	.byte	0xb
+	.value	0x280
+	.byte	0x11
+	.long	0x4d
+	.long	0xbc8
+	.uleb128 0x3
+	.long	0x41
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF301
+	.byte	0x8
+	.value	0x465
+	.byte	0xc
+	.long	0x41
+	.long	0xbdf
+	.uleb128 0x3
+	.long	0xa77
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF302
+	.byte	0x8
+	.value	0x46d
+	.byte	0xc
+	.long	0x41
+	.long	0xbfb
+	.uleb128 0x3
+	.long	0xa7c
+	.uleb128 0x3
+	.long	0xa9d
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF303
+	.byte	0x8
+	.value	0x343
+	.byte	0xc
+	.long	0x41
+	.long	0xc12
+	.uleb128 0x3
+	.long	0xa98
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF305
+	.byte	0x9
+	.value	0x238
+	.long	0xc24
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF306
+	.byte	0x9
+	.value	0x229
+	.byte	0xe
+	.long	0x7e
+	.long	0xc3b
+	.uleb128 0x3
+	.long	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF307
+	.byte	0x8
+	.value	0x31a
+	.byte	0xc
+	.long	0x41
+	.long	0xc52
+	.uleb128 0x3
+	.long	0xa98
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF308
+	.byte	0xf4
+	.quad	.LFB13
+	.quad	.LFE13-.LFB13
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcbf
+	.uleb128 0x9
+	.long	.LASF286
+	.byte	0xf4
+	.byte	0x27
+	.long	0xa1e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x19
+	.quad	.LBB9
+	.quad	.LBE9-.LBB9
+	.long	0xc9e
+	.uleb128 0xc
+	.string	"i"
+	.byte	0xfb
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0xd
+	.quad	.LBB10
+	.quad	.LBE10-.LBB10
+	.uleb128 0x22
+	.string	"i"
+	.byte	0x1
+	.value	0x101
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF309
+	.byte	0xea
+	.quad	.LFB12
+	.quad	.LFE12-.LFB12
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xcea
+	.uleb128 0x9
+	.long	.LASF286
+	.byte	0xea
+	.byte	0x24
+	.long	0xa1e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF311
+	.byte	0xc4
+	.long	0x41
+	.quad	.LFB11
+	.quad	.LFE11-.LFB11
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xd52
+	.uleb128 0x9
+	.long	.LASF286
+	.byte	0xc4
+	.byte	0x25
+	.long	0xa1e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.long	.LASF266
+	.byte	0xc4
+	.byte	0x3c
+	.long	0x8a4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0x9
+	.long	.LASF267
+	.byte	0xc4
+	.byte	0x48
+	.long	0x7e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0xc
+	.string	"job"
+	.byte	0xc6
+	.byte	0x1b
+	.long	0x8e0
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF310
+	.byte	0xc7
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF312
+	.byte	0x90
+	.long	0x41
+	.quad	.LFB10
+	.quad	.LFE10-.LFB10
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xdef
+	.uleb128 0x9
+	.long	.LASF286
+	.byte	0x90
+	.byte	0x23
+	.long	0xa1e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -56
+	.uleb128 0x9
+	.long	.LASF277
+	.byte	0x90
+	.byte	0x2d
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -60
+	.uleb128 0x19
+	.quad	.LBB6
+	.quad	.LBE6-.LBB6
+	.long	0xdb0
+	.uleb128 0xc
+	.string	"i"
+	.byte	0xa4
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -36
+	.byte	0
+	.uleb128 0xd
+	.quad	.LBB7
+	.quad	.LBE7-.LBB7
+	.uleb128 0xc
+	.string	"i"
+	.byte	0xab
+	.byte	0xe
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0xd
+	.quad	.LBB8
+	.quad	.LBE8-.LBB8
+	.uleb128 0x7
+	.long	.LASF313
+	.byte	0xad
+	.byte	0x1d
+	.long	0xdef
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xa23
+	.uleb128 0x15
+	.long	.LASF314
+	.byte	0x8a
+	.long	0x41
+	.quad	.LFB9
+	.quad	.LFE9-.LFB9
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xe23
+	.uleb128 0x7
+	.long	.LASF315
+	.byte	0x8c
+	.byte	0xa
+	.long	0x4d
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF317
+	.byte	0x5c
+	.byte	0xe
+	.long	0x7e
+	.quad	.LFB8
+	.quad	.LFE8-.LFB8
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xeca
+	.uleb128 0x9
+	.long	.LASF267
+	.byte	0x5c
+	.byte	0x26
+	.long	0x7e
+	.uleb128 0x3
+	.byte	0x91
+	.sleb128 -72
+	.uleb128 0x7
+	.long	.LASF313
+	.byte	0x5e
+	.byte	0x19
+	.long	0xdef
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0x7
+	.long	.LASF286
+	.byte	0x5f
+	.byte	0x13
+	.long	0xa1e
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x7
+	.long	.LASF287
+	.byte	0x60
+	.byte	0xf
+	.long	0x48
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -44
+	.uleb128 0xc
+	.string	"job"
+	.byte	0x61
+	.byte	0x15
+	.long	0x8d4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -64
+	.uleb128 0xd
+	.quad	.LBB4
+	.quad	.LBE4-.LBB4
+	.uleb128 0x7
+	.long	.LASF316
+	.byte	0x78
+	.byte	0xd
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xd
+	.quad	.LBB5
+	.quad	.LBE5-.LBB5
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x79
+	.byte	0x12
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF318
+	.byte	0x44
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB7
+	.quad	.LFE7-.LFB7
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xf24
+	.uleb128 0x9
+	.long	.LASF319
+	.byte	0x44
+	.byte	0x34
+	.long	0x9e4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1a
+	.string	"job"
+	.byte	0x44
+	.byte	0x4c
+	.long	0x930
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x9
+	.long	.LASF320
+	.byte	0x44
+	.byte	0x55
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -52
+	.uleb128 0x7
+	.long	.LASF321
+	.byte	0x46
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF322
+	.byte	0x1e
+	.byte	0xc
+	.long	0x41
+	.quad	.LFB6
+	.quad	.LFE6-.LFB6
+	.uleb128 0x1
+	.byte	0x9c
+	.long	0xfae
+	.uleb128 0x9
+	.long	.LASF319
+	.byte	0x1e
+	.byte	0x34
+	.long	0x9e4
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -40
+	.uleb128 0x1a
+	.string	"job"
+	.byte	0x1e
+	.byte	0x52
+	.long	0xfae
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -48
+	.uleb128 0x7
+	.long	.LASF321
+	.byte	0x20
+	.byte	0x9
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -20
+	.uleb128 0xd
+	.quad	.LBB2
+	.quad	.LBE2-.LBB2
+	.uleb128 0x7
+	.long	.LASF270
+	.byte	0x25
+	.byte	0x1a
+	.long	0x930
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -32
+	.uleb128 0xd
+	.quad	.LBB3
+	.quad	.LBE3-.LBB3
+	.uleb128 0xc
+	.string	"i"
+	.byte	0x28
+	.byte	0x16
+	.long	0x41
+	.uleb128 0x2
+	.byte	0x91
+	.sleb128 -24
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x8e0
+	.byte	0
+	.section	.debug_abbrev,"",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x40
+	.uleb128 0x18
+	.uleb128 0x7c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x11
+	.uleb128 0x1
+	.uleb128 0x12
+	.uleb128 0x7
+	.uleb128 0x10
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.debug_aranges,"",@progbits
+	.long	0x2c
+	.value	0x2
+	.long	.Ldebug_info0
+	.byte	0x8
+	.byte	0
+	.value	0
+	.value	0
+	.quad	.Ltext0
+	.quad	.Letext0-.Ltext0
+	.quad	0
+	.quad	0
+	.section	.debug_line,"",@progbits
+.Ldebug_line0:
+	.section	.debug_str,"MS",@progbits,1
+.LASF130:
+	.string	"_SC_THREAD_PRIO_PROTECT"
+.LASF39:
+	.string	"pthread_t"
+.LASF278:
+	.string	"numOfQueues"
+.LASF77:
+	.string	"_SC_VERSION"
+.LASF171:
+	.string	"_SC_NL_NMAX"
+.LASF271:
+	.string	"capacity"
+.LASF264:
+	.string	"_SC_SIGSTKSZ"
+.LASF62:
+	.string	"_SC_SYNCHRONIZED_IO"
+.LASF309:
+	.string	"threadPool_Wait"
+.LASF128:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING"
+.LASF267:
+	.string	"argument"
+.LASF133:
+	.string	"_SC_NPROCESSORS_ONLN"
+.LASF214:
+	.string	"_SC_TYPED_MEMORY_OBJECTS"
+.LASF282:
+	.string	"pending"
+.LASF129:
+	.string	"_SC_THREAD_PRIO_INHERIT"
+.LASF42:
+	.string	"pthread_mutexattr_t"
+.LASF213:
+	.string	"_SC_TIMEOUTS"
+.LASF183:
+	.string	"_SC_BASE"
+.LASF112:
+	.string	"_SC_PII_OSI_COTS"
+.LASF198:
+	.string	"_SC_MONOTONIC_CLOCK"
+.LASF117:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS"
+.LASF7:
+	.string	"unsigned int"
+.LASF109:
+	.string	"_SC_IOV_MAX"
+.LASF53:
+	.string	"_SC_STREAM_MAX"
+.LASF225:
+	.string	"_SC_V6_ILP32_OFF32"
+.LASF61:
+	.string	"_SC_PRIORITIZED_IO"
+.LASF272:
+	.string	"head"
+.LASF290:
+	.string	"currentWorker"
+.LASF37:
+	.string	"__wrefs"
+.LASF210:
+	.string	"_SC_THREAD_SPORADIC_SERVER"
+.LASF293:
+	.string	"pthread_join"
+.LASF163:
+	.string	"_SC_SHRT_MIN"
+.LASF167:
+	.string	"_SC_USHRT_MAX"
+.LASF173:
+	.string	"_SC_NL_TEXTMAX"
+.LASF223:
+	.string	"_SC_STREAMS"
+.LASF295:
+	.string	"pthread_create"
+.LASF122:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF194:
+	.string	"_SC_PIPE"
+.LASF85:
+	.string	"_SC_BC_DIM_MAX"
+.LASF64:
+	.string	"_SC_MAPPED_FILES"
+.LASF95:
+	.string	"_SC_2_C_BIND"
+.LASF312:
+	.string	"threadPool_Init"
+.LASF302:
+	.string	"pthread_cond_wait"
+.LASF301:
+	.string	"pthread_cond_broadcast"
+.LASF75:
+	.string	"_SC_MQ_OPEN_MAX"
+.LASF143:
+	.string	"_SC_XOPEN_SHM"
+.LASF153:
+	.string	"_SC_INT_MAX"
+.LASF97:
+	.string	"_SC_2_FORT_DEV"
+.LASF147:
+	.string	"_SC_XOPEN_XPG2"
+.LASF148:
+	.string	"_SC_XOPEN_XPG3"
+.LASF149:
+	.string	"_SC_XOPEN_XPG4"
+.LASF104:
+	.string	"_SC_PII_INTERNET"
+.LASF253:
+	.string	"_SC_V7_LP64_OFF64"
+.LASF74:
+	.string	"_SC_DELAYTIMER_MAX"
+.LASF310:
+	.string	"queueIndex"
+.LASF298:
+	.string	"calloc"
+.LASF157:
+	.string	"_SC_MB_LEN_MAX"
+.LASF303:
+	.string	"pthread_mutex_unlock"
+.LASF294:
+	.string	"pthread_cond_signal"
+.LASF307:
+	.string	"pthread_mutex_lock"
+.LASF136:
+	.string	"_SC_ATEXIT_MAX"
+.LASF47:
+	.string	"pthread_cond_t"
+.LASF21:
+	.string	"__pthread_internal_list"
+.LASF142:
+	.string	"_SC_XOPEN_ENH_I18N"
+.LASF191:
+	.string	"_SC_DEVICE_SPECIFIC_R"
+.LASF131:
+	.string	"_SC_THREAD_PROCESS_SHARED"
+.LASF56:
+	.string	"_SC_SAVED_IDS"
+.LASF185:
+	.string	"_SC_C_LANG_SUPPORT_R"
+.LASF33:
+	.string	"__g1_start"
+.LASF296:
+	.string	"pthread_cond_init"
+.LASF96:
+	.string	"_SC_2_C_DEV"
+.LASF24:
+	.string	"__count"
+.LASF177:
+	.string	"_SC_XBS5_LPBIG_OFFBIG"
+.LASF320:
+	.string	"steal"
+.LASF145:
+	.string	"_SC_2_C_VERSION"
+.LASF306:
+	.string	"malloc"
+.LASF160:
+	.string	"_SC_SCHAR_MAX"
+.LASF232:
+	.string	"_SC_TRACE_INHERIT"
+.LASF287:
+	.string	"index"
+.LASF159:
+	.string	"_SC_SSIZE_MAX"
+.LASF146:
+	.string	"_SC_2_UPE"
+.LASF249:
+	.string	"_SC_IPV6"
+.LASF84:
+	.string	"_SC_BC_BASE_MAX"
+.LASF15:
+	.string	"long long unsigned int"
+.LASF106:
+	.string	"_SC_POLL"
+.LASF179:
+	.string	"_SC_XOPEN_REALTIME"
+.LASF300:
+	.string	"sysconf"
+.LASF212:
+	.string	"_SC_SYSTEM_DATABASE_R"
+.LASF279:
+	.string	"workAvailable"
+.LASF323:
+	.string	"GNU C17 12.2.0 -masm=intel -mtune=generic -march=x86-64 -g -O0 -fasynchronous-unwind-tables"
+.LASF25:
+	.string	"__owner"
+.LASF115:
+	.string	"_SC_T_IOV_MAX"
+.LASF284:
+	.string	"shutdown"
+.LASF235:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC"
+.LASF35:
+	.string	"__g_size"
+.LASF29:
+	.string	"__elision"
+.LASF222:
+	.string	"_SC_SYMLOOP_MAX"
+.LASF321:
+	.string	"retval"
+.LASF270:
+	.string	"jobs"
+.LASF233:
+	.string	"_SC_TRACE_LOG"
+.LASF188:
+	.string	"_SC_THREAD_CPUTIME"
+.LASF151:
+	.string	"_SC_CHAR_MAX"
+.LASF175:
+	.string	"_SC_XBS5_ILP32_OFFBIG"
+.LASF111:
+	.string	"_SC_PII_INTERNET_DGRAM"
+.LASF16:
+	.string	"size_t"
+.LASF221:
+	.string	"_SC_2_PBS_TRACK"
+.LASF195:
+	.string	"_SC_FILE_ATTRIBUTES"
+.LASF60:
+	.string	"_SC_ASYNCHRONOUS_IO"
+.LASF63:
+	.string	"_SC_FSYNC"
+.LASF238:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC"
+.LASF190:
+	.string	"_SC_DEVICE_SPECIFIC"
+.LASF65:
+	.string	"_SC_MEMLOCK"
+.LASF155:
+	.string	"_SC_LONG_BIT"
+.LASF80:
+	.string	"_SC_SEM_NSEMS_MAX"
+.LASF89:
+	.string	"_SC_EQUIV_CLASS_MAX"
+.LASF322:
+	.string	"threadPool_QueuePush"
+.LASF260:
+	.string	"_SC_XOPEN_STREAMS"
+.LASF236:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE"
+.LASF205:
+	.string	"_SC_REGEX_VERSION"
+.LASF218:
+	.string	"_SC_2_PBS_ACCOUNTING"
+.LASF72:
+	.string	"_SC_AIO_MAX"
+.LASF242:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE"
+.LASF12:
+	.string	"__high"
+.LASF19:
+	.string	"__next"
+.LASF317:
+	.string	"threadPool_Worker"
+.LASF273:
+	.string	"count"
+.LASF196:
+	.string	"_SC_FILE_LOCKING"
+.LASF206:
+	.string	"_SC_SHELL"
+.LASF54:
+	.string	"_SC_TZNAME_MAX"
+.LASF217:
+	.string	"_SC_2_PBS"
+.LASF10:
+	.string	"char"
+.LASF314:
+	.string	"threadPool_NumberOfCpus"
+.LASF209:
+	.string	"_SC_SPORADIC_SERVER"
+.LASF66:
+	.string	"_SC_MEMLOCK_RANGE"
+.LASF135:
+	.string	"_SC_AVPHYS_PAGES"
+.LASF100:
+	.string	"_SC_2_LOCALEDEF"
+.LASF252:
+	.string	"_SC_V7_ILP32_OFFBIG"
+.LASF102:
+	.string	"_SC_PII_XTI"
+.LASF254:
+	.string	"_SC_V7_LPBIG_OFFBIG"
+.LASF297:
+	.string	"pthread_mutex_init"
+.LASF28:
+	.string	"__spins"
+.LASF285:
+	.string	"ThreadPool_t"
+.LASF244:
+	.string	"_SC_LEVEL3_CACHE_ASSOC"
+.LASF18:
+	.string	"__prev"
+.LASF197:
+	.string	"_SC_FILE_SYSTEM"
+.LASF44:
+	.string	"pthread_attr_t"
+.LASF78:
+	.string	"_SC_PAGESIZE"
+.LASF263:
+	.string	"_SC_MINSIGSTKSZ"
+.LASF247:
+	.string	"_SC_LEVEL4_CACHE_ASSOC"
+.LASF226:
+	.string	"_SC_V6_ILP32_OFFBIG"
+.LASF82:
+	.string	"_SC_SIGQUEUE_MAX"
+.LASF208:
+	.string	"_SC_SPAWN"
+.LASF281:
+	.string	"queued"
+.LASF189:
+	.string	"_SC_DEVICE_IO"
+.LASF228:
+	.string	"_SC_V6_LPBIG_OFFBIG"
+.LASF94:
+	.string	"_SC_2_VERSION"
+.LASF246:
+	.string	"_SC_LEVEL4_CACHE_SIZE"
+.LASF276:
+	.string	"queues"
+.LASF30:
+	.string	"__list"
+.LASF4:
+	.string	"long long int"
+.LASF304:
+	.string	"perror"
+.LASF216:
+	.string	"_SC_USER_GROUPS_R"
+.LASF277:
+	.string	"numOfThreads"
+.LASF269:
+	.string	"lock"
+.LASF266:
+	.string	"task"
+.LASF91:
+	.string	"_SC_LINE_MAX"
+.LASF187:
+	.string	"_SC_CPUTIME"
+.LASF108:
+	.string	"_SC_UIO_MAXIOV"
+.LASF229:
+	.string	"_SC_HOST_NAME_MAX"
+.LASF184:
+	.string	"_SC_C_LANG_SUPPORT"
+.LASF123:
+	.string	"_SC_THREAD_KEYS_MAX"
+.LASF299:
+	.string	"memset"
+.LASF124:
+	.string	"_SC_THREAD_STACK_MIN"
+.LASF69:
+	.string	"_SC_SEMAPHORES"
+.LASF165:
+	.string	"_SC_UINT_MAX"
+.LASF49:
+	.string	"_SC_CHILD_MAX"
+.LASF51:
+	.string	"_SC_NGROUPS_MAX"
+.LASF200:
+	.string	"_SC_SINGLE_PROCESS"
+.LASF141:
+	.string	"_SC_XOPEN_CRYPT"
+.LASF245:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE"
+.LASF27:
+	.string	"__kind"
+.LASF121:
+	.string	"_SC_TTY_NAME_MAX"
+.LASF67:
+	.string	"_SC_MEMORY_PROTECTION"
+.LASF14:
+	.string	"__value32"
+.LASF289:
+	.string	"currentPool"
+.LASF150:
+	.string	"_SC_CHAR_BIT"
+.LASF237:
+	.string	"_SC_LEVEL1_DCACHE_SIZE"
+.LASF286:
+	.string	"pool"
+.LASF186:
+	.string	"_SC_CLOCK_SELECTION"
+.LASF288:
+	.string	"ThreadPoolWorker_t"
+.LASF50:
+	.string	"_SC_CLK_TCK"
+.LASF59:
+	.string	"_SC_TIMERS"
+.LASF182:
+	.string	"_SC_BARRIERS"
+.LASF20:
+	.string	"__pthread_list_t"
+.LASF86:
+	.string	"_SC_BC_SCALE_MAX"
+.LASF166:
+	.string	"_SC_ULONG_MAX"
+.LASF76:
+	.string	"_SC_MQ_PRIO_MAX"
+.LASF230:
+	.string	"_SC_TRACE"
+.LASF243:
+	.string	"_SC_LEVEL3_CACHE_SIZE"
+.LASF43:
+	.string	"pthread_condattr_t"
+.LASF239:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE"
+.LASF87:
+	.string	"_SC_BC_STRING_MAX"
+.LASF132:
+	.string	"_SC_NPROCESSORS_CONF"
+.LASF154:
+	.string	"_SC_INT_MIN"
+.LASF251:
+	.string	"_SC_V7_ILP32_OFF32"
+.LASF258:
+	.string	"_SC_TRACE_SYS_MAX"
+.LASF192:
+	.string	"_SC_FD_MGMT"
+.LASF204:
+	.string	"_SC_REGEXP"
+.LASF9:
+	.string	"short int"
+.LASF234:
+	.string	"_SC_LEVEL1_ICACHE_SIZE"
+.LASF57:
+	.string	"_SC_REALTIME_SIGNALS"
+.LASF92:
+	.string	"_SC_RE_DUP_MAX"
+.LASF181:
+	.string	"_SC_ADVISORY_INFO"
+.LASF3:
+	.string	"long int"
+.LASF162:
+	.string	"_SC_SHRT_MAX"
+.LASF176:
+	.string	"_SC_XBS5_LP64_OFF64"
+.LASF202:
+	.string	"_SC_READER_WRITER_LOCKS"
+.LASF274:
+	.string	"ThreadPoolQueue_t"
+.LASF211:
+	.string	"_SC_SYSTEM_DATABASE"
+.LASF180:
+	.string	"_SC_XOPEN_REALTIME_THREADS"
+.LASF262:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF144:
+	.string	"_SC_2_CHAR_TERM"
+.LASF137:
+	.string	"_SC_PASS_MAX"
+.LASF193:
+	.string	"_SC_FIFO"
+.LASF265:
+	.string	"ThreadPoolTask_t"
+.LASF48:
+	.string	"_SC_ARG_MAX"
+.LASF138:
+	.string	"_SC_XOPEN_VERSION"
+.LASF240:
+	.string	"_SC_LEVEL2_CACHE_SIZE"
+.LASF224:
+	.string	"_SC_2_PBS_CHECKPOINT"
+.LASF98:
+	.string	"_SC_2_FORT_RUN"
+.LASF231:
+	.string	"_SC_TRACE_EVENT_FILTER"
+.LASF81:
+	.string	"_SC_SEM_VALUE_MAX"
+.LASF127:
+	.string	"_SC_THREAD_ATTR_STACKSIZE"
+.LASF71:
+	.string	"_SC_AIO_LISTIO_MAX"
+.LASF261:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF116:
+	.string	"_SC_THREADS"
+.LASF305:
+	.string	"free"
+.LASF45:
+	.string	"__data"
+.LASF101:
+	.string	"_SC_PII"
+.LASF283:
+	.string	"nextQueue"
+.LASF17:
+	.string	"__atomic_wide_counter"
+.LASF156:
+	.string	"_SC_WORD_BIT"
+.LASF174:
+	.string	"_SC_XBS5_ILP32_OFF32"
+.LASF26:
+	.string	"__nusers"
+.LASF99:
+	.string	"_SC_2_SW_DEV"
+.LASF152:
+	.string	"_SC_CHAR_MIN"
+.LASF140:
+	.string	"_SC_XOPEN_UNIX"
+.LASF13:
+	.string	"__value64"
+.LASF2:
+	.string	"long unsigned int"
+.LASF105:
+	.string	"_SC_PII_OSI"
+.LASF275:
+	.string	"threads"
+.LASF164:
+	.string	"_SC_UCHAR_MAX"
+.LASF316:
+	.string	"found"
+.LASF161:
+	.string	"_SC_SCHAR_MIN"
+.LASF318:
+	.string	"threadPool_QueueTake"
+.LASF319:
+	.string	"queue"
+.LASF58:
+	.string	"_SC_PRIORITY_SCHEDULING"
+.LASF46:
+	.string	"pthread_mutex_t"
+.LASF23:
+	.string	"__lock"
+.LASF107:
+	.string	"_SC_SELECT"
+.LASF201:
+	.string	"_SC_NETWORKING"
+.LASF83:
+	.string	"_SC_TIMER_MAX"
+.LASF34:
+	.string	"__g_refs"
+.LASF227:
+	.string	"_SC_V6_LP64_OFF64"
+.LASF311:
+	.string	"threadPool_Submit"
+.LASF118:
+	.string	"_SC_GETGR_R_SIZE_MAX"
+.LASF5:
+	.string	"unsigned char"
+.LASF120:
+	.string	"_SC_LOGIN_NAME_MAX"
+.LASF313:
+	.string	"worker"
+.LASF90:
+	.string	"_SC_EXPR_NEST_MAX"
+.LASF110:
+	.string	"_SC_PII_INTERNET_STREAM"
+.LASF268:
+	.string	"ThreadPoolJob_t"
+.LASF255:
+	.string	"_SC_SS_REPL_MAX"
+.LASF250:
+	.string	"_SC_RAW_SOCKETS"
+.LASF248:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE"
+.LASF207:
+	.string	"_SC_SIGNALS"
+.LASF68:
+	.string	"_SC_MESSAGE_PASSING"
+.LASF31:
+	.string	"__pthread_cond_s"
+.LASF170:
+	.string	"_SC_NL_MSGMAX"
+.LASF70:
+	.string	"_SC_SHARED_MEMORY_OBJECTS"
+.LASF93:
+	.string	"_SC_CHARCLASS_NAME_MAX"
+.LASF280:
+	.string	"allDone"
+.LASF113:
+	.string	"_SC_PII_OSI_CLTS"
+.LASF38:
+	.string	"__g_signals"
+.LASF32:
+	.string	"__wseq"
+.LASF203:
+	.string	"_SC_SPIN_LOCKS"
+.LASF11:
+	.string	"__low"
+.LASF134:
+	.string	"_SC_PHYS_PAGES"
+.LASF291:
+	.string	"pthread_cond_destroy"
+.LASF315:
+	.string	"cpus"
+.LASF103:
+	.string	"_SC_PII_SOCKET"
+.LASF199:
+	.string	"_SC_MULTI_PROCESS"
+.LASF241:
+	.string	"_SC_LEVEL2_CACHE_ASSOC"
+.LASF114:
+	.string	"_SC_PII_OSI_M"
+.LASF8:
+	.string	"signed char"
+.LASF52:
+	.string	"_SC_OPEN_MAX"
+.LASF6:
+	.string	"short unsigned int"
+.LASF125:
+	.string	"_SC_THREAD_THREADS_MAX"
+.LASF308:
+	.string	"threadPool_Destroy"
+.LASF158:
+	.string	"_SC_NZERO"
+.LASF119:
+	.string	"_SC_GETPW_R_SIZE_MAX"
+.LASF220:
+	.string	"_SC_2_PBS_MESSAGE"
+.LASF79:
+	.string	"_SC_RTSIG_MAX"
+.LASF126:
+	.string	"_SC_THREAD_ATTR_STACKADDR"
+.LASF36:
+	.string	"__g1_orig_size"
+.LASF257:
+	.string	"_SC_TRACE_NAME_MAX"
+.LASF88:
+	.string	"_SC_COLL_WEIGHTS_MAX"
+.LASF41:
+	.string	"__align"
+.LASF178:
+	.string	"_SC_XOPEN_LEGACY"
+.LASF55:
+	.string	"_SC_JOB_CONTROL"
+.LASF169:
+	.string	"_SC_NL_LANGMAX"
+.LASF215:
+	.string	"_SC_USER_GROUPS"
+.LASF219:
+	.string	"_SC_2_PBS_LOCATE"
+.LASF40:
+	.string	"__size"
+.LASF172:
+	.string	"_SC_NL_SETMAX"
+.LASF168:
+	.string	"_SC_NL_ARGMAX"
+.LASF256:
+	.string	"_SC_TRACE_EVENT_NAME_MAX"
+.LASF259:
+	.string	"_SC_TRACE_USER_EVENT_MAX"
+.LASF292:
+	.string	"pthread_mutex_destroy"
+.LASF22:
+	.string	"__pthread_mutex_s"
+.LASF73:
+	.string	"_SC_AIO_PRIO_DELTA_MAX"
+.LASF139:
+	.string	"_SC_XOPEN_XCU_VERSION"
+	.section	.debug_line_str,"MS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"source/threadPool.c"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,83 @@
+/**
+ * @file apaFilter.h
+ * @author shed258
+ * @brief Affine projection filter header. Every update projects the weights onto the last P input
+ * vectors at once, which whitens colored input and converges much faster than LMS at about P times
+ * its cost. The P x P Gram matrix of the input vectors slides with the window in O(P) per sample
+ * @version 1.0.0
+ *
+ */
+
+#ifndef APA_FILTER_H
+#define APA_FILTER_H
+
+#include "lmsKernel.h"
+
+#define APA_FILTER_DEFAULT_ORDER    4
+#define APA_FILTER_MAX_ORDER        32
+
+typedef struct
+{
+    float step;                     /* normalized step size, 0 < step < 2 */
+    int length;
+    int order;                      /* P, input vectors of one projection */
+    int historyLength;              /* <length> + <order> samples reach the oldest correlation term */
+    float* coefficients;            /* [length] weights of the newest to the oldest sample, 64-byte aligned */
+    float* history;                 /* [2 * historyLength] mirrored, newest sample first */
+    int historyIndex;
+    float* desired;                 /* [2 * order] mirrored desired samples, newest first */
+    int desiredIndex;
+    int validRows;                  /* filtered samples since the last pushed one, at most <order> */
+    double* correlation;            /* [order] products of the newest input vector with the P - 1 older ones */
+    double* gram;                   /* [order * order] products of the last P input vectors */
+    double* factor;                 /* [order * order] Cholesky factor of the regularized Gram matrix */
+    double* solution;               /* [order] errors, then projection weights */
+    const LmsKernel_t* kernel;      /* dot product and coefficient update, best one by default */
+    void* memory;
+} ApaFilter_t;
+
+/**
+ * @brief Initialize the filter. Weights and histories are cleared
+ * @param filter    APA filter structure
+ * @param step      Normalized step size, 0 < step < 2, 1 for the fastest convergence
+ * @param length    Filter length
+ * @param order     Projection order 1 .. APA_FILTER_MAX_ORDER, 0 for APA_FILTER_DEFAULT_ORDER. Order 1 is NLMS
+ * @return EXIT_SUCCESS when filter initialised succesfully. Otherwise, return EXIT_FAILURE
+ */
+int apaFilter_Init(ApaFilter_t* filter, float step, int length, int order);
+
+/**
+ * @brief Release memory of the filter
+ * @param filter    APA filter structure
+ */
+void apaFilter_Free(ApaFilter_t* filter);
+
+/**
+ * @brief Push an input sample without filtering. Projections restart from the next filtered sample,
+ * as no desired sample is known for this one
+ * @param filter    APA filter structure
+ * @param sample    New input sample
+ */
+void apaFilter_PushSample(ApaFilter_t* filter, float sample);
+
+/**
+ * @brief Filter a block of samples, same interface as lmsFilter_ProcessBlock
+ * @param filter        APA filter structure
+ * @param input         Input samples
+ * @param desired       Desired samples or NULL to use the oldest sample in the window
+ * @param output        Filter output or NULL
+ * @param error         Error signal or NULL
+ * @param numOfSamples  Number of samples
+ * @return EXIT_SUCCESS when filter stays stable. Otherwise, return EXIT_FAILURE
+ */
+int apaFilter_ProcessBlock(ApaFilter_t* filter, const float* input, const float* desired,
+                           float* output, float* error, int numOfSamples);
+
+/**
+ * @brief Sum of squares of the coefficients
+ * @param filter    APA filter structure
+ * @return Squared coefficient norm
+ */
+double apaFilter_NormSquared(const ApaFilter_t* filter);
+
+#endif  /* APA_FILTER_H */
@@ -0,0 +1,163 @@
+/**
+ * @file asyncFile.h
+ * @author shed258
+ * @brief Asynchronous sequential file reader and writer header. A few large buffers are kept in
+ * flight through io_uring, or through a pread/pwrite thread when io_uring is not available, and
+ * the caller is only ever handed buffers whose transfer has completed
+ * @version 1.0.0
+ *
+ */
+
+#ifndef ASYNC_FILE_H
+#define ASYNC_FILE_H
+
+#include <pthread.h>
+#include <sys/types.h>
+
+#define ASYNC_FILE_BUFFER_SIZE  (256 * 1024)    /* bytes of one transfer, a multiple of every sample size */
+#define ASYNC_FILE_DEPTH        4               /* buffers, and so transfers, in flight */
+
+typedef enum
+{
+    ASYNC_FILE_BACKEND_UNKNOWN = 0,
+    ASYNC_FILE_BACKEND_AUTO,        /* io_uring, the thread when io_uring can not be set up */
+    ASYNC_FILE_BACKEND_URING,       /* io_uring only */
+    ASYNC_FILE_BACKEND_THREAD,      /* pread/pwrite on a thread of the file */
+    ASYNC_FILE_BACKEND_STDIO,       /* no asynchronous file, blocking stdio on the calling thread */
+} AsyncFileBackend_t;
+
+typedef enum
+{
+    ASYNC_FILE_READ = 0,
+    ASYNC_FILE_WRITE,
+} AsyncFileMode_t;
+
+typedef enum
+{
+    ASYNC_FILE_BUFFER_FREE = 0,
+    ASYNC_FILE_BUFFER_QUEUED,       /* owned by the kernel or the I/O thread */
+    ASYNC_FILE_BUFFER_DONE,         /* transfer completed, <result> is valid */
+} AsyncFileBufferState_t;
+
+typedef struct
+{
+    unsigned char* data;            /* ASYNC_FILE_BUFFER_SIZE bytes */
+    off_t offset;                   /* file offset of the transfer */
+    size_t size;                    /* bytes requested */
+    ssize_t result;                 /* bytes transferred, or -errno */
+    AsyncFileBufferState_t state;
+} AsyncFileBuffer_t;
+
+/* Rings shared with the kernel, mapped from the io_uring file descriptor */
+typedef struct
+{
+    int fd;
+    void* sqRing;
+    size_t sqRingSize;
+    void* cqRing;                   /* the same mapping as sqRing when the kernel maps both at once */
+    size_t cqRingSize;
+    void* sqes;                     /* struct io_uring_sqe[] */
+    size_t sqesSize;
+    unsigned int* sqTail;
+    unsigned int* sqMask;
+    unsigned int* sqArray;
+    unsigned int* cqHead;
+    unsigned int* cqTail;
+    unsigned int* cqMask;
+    void* cqes;                     /* struct io_uring_cqe[] */
+    int registered;                 /* buffers are registered, transfers use the fixed opcodes */
+} AsyncFileRing_t;
+
+/* Buffers are used round robin: transfer <n> goes through buffer <n> % ASYNC_FILE_DEPTH. Only one
+ * thread may call the functions of an asynchronous file */
+typedef struct
+{
+    int fd;
+    AsyncFileMode_t mode;
+    AsyncFileBackend_t backend;     /* ASYNC_FILE_BACKEND_URING or ASYNC_FILE_BACKEND_THREAD once opened */
+    unsigned char* memory;
+    AsyncFileBuffer_t buffers[ASYNC_FILE_DEPTH];
+    unsigned long submitted;        /* transfers submitted */
+    unsigned long completed;        /* transfers given to the caller (read) or reaped (write) */
+    off_t offset;                   /* file offset of the next transfer */
+    off_t end;                      /* reads stop here */
+    int error;                      /* errno of the first failed transfer, 0 when none */
+    AsyncFileRing_t ring;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t queued;
+    pthread_cond_t done;
+    unsigned long serviced;         /* transfers done by the I/O thread */
+    int stop;
+} AsyncFile_t;
+
+/**
+ * @brief Process argument of --io
+ * @param backend   string with argument to process: auto, uring, thread, stdio
+ * @return enumerated backend, ASYNC_FILE_BACKEND_UNKNOWN when not recognized
+ */
+AsyncFileBackend_t asyncFile_ProcessArgumentBackend(const char* backend);
+
+/**
+ * @brief Name of the backend
+ * @param backend   Backend
+ * @return Name as accepted by asyncFile_ProcessArgumentBackend
+ */
+const char* asyncFile_BackendName(AsyncFileBackend_t backend);
+
+/**
+ * @brief Start asynchronous transfers on an open file. Reads are queued at once in all buffers
+ * @param file      Asynchronous file structure
+ * @param fd        Descriptor of a regular file, stays owned by the caller
+ * @param mode      ASYNC_FILE_READ or ASYNC_FILE_WRITE
+ * @param backend   ASYNC_FILE_BACKEND_AUTO, ASYNC_FILE_BACKEND_URING or ASYNC_FILE_BACKEND_THREAD
+ * @param offset    File offset of the first transfer
+ * @param end       Reads stop at this file offset, ignored for writes
+ * @return EXIT_SUCCESS when started. Otherwise, return EXIT_FAILURE
+ */
+int asyncFile_Open(AsyncFile_t* file, int fd, AsyncFileMode_t mode, AsyncFileBackend_t backend, off_t offset, off_t end);
+
+/**
+ * @brief Reader: wait for the next buffer in file order
+ * @param file      Asynchronous file structure
+ * @param data      Set to the data of the buffer, valid until asyncFile_ReleaseRead
+ * @return Number of bytes in the buffer, 0 at the end, -1 on error
+ */
+ssize_t asyncFile_AcquireRead(AsyncFile_t* file, const unsigned char** data);
+
+/**
+ * @brief Reader: give back the buffer of asyncFile_AcquireRead, it is queued again for the next read
+ * @param file      Asynchronous file structure
+ */
+void asyncFile_ReleaseRead(AsyncFile_t* file);
+
+/**
+ * @brief Writer: wait for a free buffer
+ * @param file      Asynchronous file structure
+ * @return ASYNC_FILE_BUFFER_SIZE bytes to fill, submitted with asyncFile_CommitWrite. NULL when
+ * an earlier write failed
+ */
+unsigned char* asyncFile_AcquireWrite(AsyncFile_t* file);
+
+/**
+ * @brief Writer: queue the buffer of asyncFile_AcquireWrite for writing at the current offset
+ * @param file      Asynchronous file structure
+ * @param size      Bytes filled, at most ASYNC_FILE_BUFFER_SIZE
+ */
+void asyncFile_CommitWrite(AsyncFile_t* file, size_t size);
+
+/**
+ * @brief Wait for all transfers in flight
+ * @param file      Asynchronous file structure
+ * @return EXIT_SUCCESS when all of them succeeded. Otherwise, return EXIT_FAILURE with errno set
+ */
+int asyncFile_Flush(AsyncFile_t* file);
+
+/**
+ * @brief Wait for all transfers and release the buffers. The file descriptor is not closed
+ * @param file      Asynchronous file structure
+ * @return EXIT_SUCCESS when all transfers succeeded. Otherwise, return EXIT_FAILURE with errno set
+ */
+int asyncFile_Close(AsyncFile_t* file);
+
+#endif  /* ASYNC_FILE_H */
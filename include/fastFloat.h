@@ -0,0 +1,43 @@
+/**
+ * @file fastFloat.h
+ * @author shed258
+ * @brief Locale-independent float parsing and formatting for text sample files
+ * @version 1.0.0
+ *
+ */
+
+#ifndef FAST_FLOAT_H
+#define FAST_FLOAT_H
+
+#include <stddef.h>
+
+#define FAST_FLOAT_MAX_TEXT_LENGTH  64      /* longest text produced by fastFloat_Format */
+
+/**
+ * @brief Parse a decimal floating point number, e.g. "-0.123456", "1e-3", "inf".
+ * Leading white space is skipped. Decimal point is always '.' regardless of locale
+ * @param begin     Beginning of the text
+ * @param end       End of the text, parser never reads at or past it
+ * @param value     Parsed value
+ * @return Pointer to the first character after the number or NULL when there is no number
+ */
+const char* fastFloat_Parse(const char* begin, const char* end, float* value);
+
+/**
+ * @brief Format a number with fixed number of decimals, same as printf("%.<decimals>f")
+ * @param buffer    Buffer for at least FAST_FLOAT_MAX_TEXT_LENGTH characters, not terminated
+ * @param value     Number to format
+ * @param decimals  Number of decimals, 0 - 9
+ * @return Number of characters written
+ */
+size_t fastFloat_Format(char* buffer, float value, int decimals);
+
+/**
+ * @brief Format an integer, same as printf("%ld")
+ * @param buffer    Buffer for at least 21 characters, not terminated
+ * @param value     Number to format
+ * @return Number of characters written
+ */
+size_t fastFloat_FormatInteger(char* buffer, long value);
+
+#endif  /* FAST_FLOAT_H */
@@ -0,0 +1,95 @@
+/**
+ * @file fdafFilter.h
+ * @author shed258
+ * @brief Frequency-domain block LMS filter (FDAF, partitioned overlap-save) header. Per-sample cost
+ * grows with L / B + log B instead of L of the time-domain filter, which pays off for filters of
+ * hundreds to thousands of taps
+ * @version 1.0.0
+ *
+ */
+
+#ifndef FDAF_FILTER_H
+#define FDAF_FILTER_H
+
+#include "fft.h"
+
+#define FDAF_FILTER_MAX_BLOCK_SIZE  256     /* longer filters are split into partitions of this size */
+
+typedef struct
+{
+    float step;
+    int length;
+    int blockSize;              /* B, power of two, adaptation period and partition size */
+    int numOfPartitions;        /* P, B * P >= length */
+    Fft_t fft;                  /* real FFT of 2B samples */
+    float* weights;             /* P x (B + 1) complex bins, zero-padded impulse response of every partition */
+    float* spectra;             /* P x (B + 1) complex bins, input spectra of the last P blocks */
+    int head;                   /* partition slot of the current block in <spectra> */
+    float* pastOutput;          /* B + 1 complex bins, output of partitions 1 .. P-1 for the current block */
+    float* errorSpectrum;       /* B + 1 complex bins */
+    float* workSpectrum;        /* B + 1 complex bins */
+    float* input;               /* 2B samples, previous block followed by the current one */
+    float* work;                /* 2B samples */
+    float* error;               /* B errors of the current block, zero for pushed samples */
+    float* delayLine;           /* <length> last input samples, reference without desired signal */
+    int delayIndex;
+    int fill;                   /* samples in the current block */
+    int spectrumFill;           /* value of <fill> when the current spectrum was computed, -1 when outdated */
+    void* memory;
+} FdafFilter_t;
+
+/**
+ * @brief Block size of a filter, the next power of two of <length> up to FDAF_FILTER_MAX_BLOCK_SIZE.
+ * The update of a block is the sum of its time-domain updates, so the step size of the time-domain
+ * filter adapts as fast. On narrowband input the stable step range shrinks by up to the block size
+ * @param length    Filter length
+ * @return Block size
+ */
+int fdafFilter_BlockSize(int length);
+
+/**
+ * @brief Initialize the filter with step size and filter length, same parameters as the
+ * time-domain LMS filter. Weights and input history are cleared
+ * @param filter    FDAF filter structure
+ * @param step      Step size
+ * @param length    Filter length
+ * @return EXIT_SUCCESS when filter initialised succesfully. Otherwise, return EXIT_FAILURE
+ */
+int fdafFilter_Init(FdafFilter_t* filter, float step, int length);
+
+/**
+ * @brief Release memory of the filter
+ * @param filter    FDAF filter structure
+ */
+void fdafFilter_Free(FdafFilter_t* filter);
+
+/**
+ * @brief Push an input sample without filtering, e.g. to fill the first window
+ * @param filter    FDAF filter structure
+ * @param sample    New input sample
+ */
+void fdafFilter_PushSample(FdafFilter_t* filter, float sample);
+
+/**
+ * @brief Filter a block of samples, same interface as lmsFilter_ProcessBlock.
+ * Weights are adapted once every B samples. Outputs are produced without latency: samples of an
+ * incomplete block are filtered with zeros in place of the future input, which overlap-save ignores
+ * @param filter        FDAF filter structure
+ * @param input         Input samples
+ * @param desired       Desired samples or NULL to use the oldest sample in the window
+ * @param output        Filter output or NULL
+ * @param error         Error signal or NULL
+ * @param numOfSamples  Number of samples
+ * @return EXIT_SUCCESS when filter stays stable. Otherwise, return EXIT_FAILURE
+ */
+int fdafFilter_ProcessBlock(FdafFilter_t* filter, const float* input, const float* desired,
+                            float* output, float* error, int numOfSamples);
+
+/**
+ * @brief Time-domain coefficients in the order of LmsFilter_t, coefficient 0 weighting the oldest sample
+ * @param filter        FDAF filter structure
+ * @param coefficients  Buffer for <length> coefficients
+ */
+void fdafFilter_GetCoefficients(FdafFilter_t* filter, float* coefficients);
+
+#endif  /* FDAF_FILTER_H */
@@ -0,0 +1,59 @@
+/**
+ * @file fft.h
+ * @author shed258
+ * @brief Radix-2 real FFT header
+ * @version 1.0.0
+ *
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+typedef struct
+{
+    int size;                   /* number of real samples, power of two */
+    float* twiddles;            /* size / 4 complex factors of the half-size complex FFT */
+    float* realTwiddles;        /* size / 2 complex factors splitting the real spectrum */
+    int* bitReverse;            /* size / 2 permutation of the complex FFT input */
+    float* work;                /* size complex work buffer */
+    void* memory;
+} Fft_t;
+
+/**
+ * @brief Prepare twiddle factors of the real FFT
+ * @param fft   FFT structure
+ * @param size  Number of real samples, power of two, at least 4
+ * @return EXIT_SUCCESS when prepared succesfully. Otherwise, return EXIT_FAILURE
+ */
+int fft_Init(Fft_t* fft, int size);
+
+/**
+ * @brief Release memory of the FFT
+ * @param fft   FFT structure
+ */
+void fft_Free(Fft_t* fft);
+
+/**
+ * @brief Forward transform of real samples
+ * @param fft       FFT structure
+ * @param input     <size> real samples
+ * @param spectrum  <size> / 2 + 1 complex bins, interleaved real and imaginary parts
+ */
+void fft_Forward(const Fft_t* fft, const float* input, float* spectrum);
+
+/**
+ * @brief Inverse transform to real samples, scaled by 1 / <size>
+ * @param fft       FFT structure
+ * @param spectrum  <size> / 2 + 1 complex bins, interleaved real and imaginary parts
+ * @param output    <size> real samples
+ */
+void fft_Inverse(const Fft_t* fft, const float* spectrum, float* output);
+
+/**
+ * @brief Smallest power of two not less than the number
+ * @param number    Positive number
+ * @return Power of two
+ */
+int fft_NextPowerOfTwo(int number);
+
+#endif  /* FFT_H */
@@ -0,0 +1,69 @@
+/**
+ * @file lmsAllocator.h
+ * @author shed258
+ * @brief Aligned memory allocation for filter state: heap allocator and caller-supplied arena
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_ALLOCATOR_H
+#define LMS_ALLOCATOR_H
+
+#include <stddef.h>
+
+#define LMS_ALLOCATOR_ALIGNMENT     64      /* cache line, also the widest SIMD load */
+
+typedef struct
+{
+    /* Returns <size> bytes aligned to <alignment> or NULL */
+    void* (*allocate)(void* context, size_t size, size_t alignment);
+
+    /* Releases memory returned by allocate, may be NULL when memory is never released one by one */
+    void (*release)(void* context, void* memory);
+
+    void* context;
+} LmsAllocator_t;
+
+/* Bump allocator over a caller-supplied buffer, released all at once by the caller */
+typedef struct
+{
+    unsigned char* base;
+    size_t size;
+    size_t used;
+} LmsArena_t;
+
+/**
+ * @brief Allocator using the heap
+ * @return Pointer to the heap allocator
+ */
+const LmsAllocator_t* lmsAllocator_Heap(void);
+
+/**
+ * @brief Prepare an arena over a caller-supplied buffer
+ * @param arena     Arena structure
+ * @param buffer    Memory for the arena
+ * @param size      Size of the buffer in bytes
+ */
+void lmsArena_Init(LmsArena_t* arena, void* buffer, size_t size);
+
+/**
+ * @brief Allocator taking memory from the arena. Allocations fail when the arena is full
+ * @param arena     Arena structure, must outlive every object allocated from it
+ * @return Allocator structure
+ */
+LmsAllocator_t lmsArena_Allocator(LmsArena_t* arena);
+
+/**
+ * @brief Forget all allocations, the whole buffer is available again
+ * @param arena     Arena structure
+ */
+void lmsArena_Reset(LmsArena_t* arena);
+
+/**
+ * @brief Size of an array rounded up to LMS_ALLOCATOR_ALIGNMENT, for computing arena sizes
+ * @param size  Size in bytes
+ * @return Rounded size in bytes
+ */
+size_t lmsAllocator_AlignedSize(size_t size);
+
+#endif  /* LMS_ALLOCATOR_H */
@@ -0,0 +1,77 @@
+/**
+ * @file lmsBench.h
+ * @author shed258
+ * @brief Filter throughput benchmark header
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_BENCH_H
+#define LMS_BENCH_H
+
+#define LMS_BENCH_MAX_SWEEP         16          /* values in one sweep list */
+#define LMS_BENCH_DEFAULT_SAMPLES   131072
+#define LMS_BENCH_DEFAULT_TRIALS    5
+#define LMS_BENCH_DEFAULT_WARMUP    1
+
+typedef enum
+{
+    LMS_BENCH_FORMAT_UNKNOWN = 0,
+    LMS_BENCH_FORMAT_TABLE,         /* aligned columns for reading */
+    LMS_BENCH_FORMAT_CSV,           /* header line and one line per case */
+    LMS_BENCH_FORMAT_JSON,          /* object with program version, best kernel and array of cases */
+} LmsBenchFormat_t;
+
+typedef struct
+{
+    int lengths[LMS_BENCH_MAX_SWEEP];
+    int numOfLengths;
+    int blockSizes[LMS_BENCH_MAX_SWEEP];
+    int numOfBlockSizes;
+    long numOfSamples;              /* samples filtered in one trial */
+    int trials;                     /* measured trials, median and minimum are reported */
+    int warmupTrials;               /* trials run before measuring */
+    int allVariants;                /* measure every LMS variant, otherwise plain LMS only */
+    int includeFdaf;                /* measure the frequency-domain engine as well */
+    int includeFixed;               /* measure the Q15 engine as well */
+    int includeSubband;             /* measure the subband engine as well, on one thread */
+    int includeRls;                 /* measure the recursive least squares engine as well */
+    int includeApa;                 /* measure the affine projection engine as well */
+    LmsBenchFormat_t format;
+    const char* outputFileName;     /* NULL for standard output */
+} LmsBenchSettings_t;
+
+/**
+ * @brief Default sweep: lengths 16, 64, 256, 1024, blocks 64, 4096, table on standard output
+ * @param settings  Benchmark settings
+ */
+void lmsBench_DefaultSettings(LmsBenchSettings_t* settings);
+
+/**
+ * @brief Process argument <format>
+ * @param format    string with argument to process: table, csv, json
+ * @return enumerated report format
+ */
+LmsBenchFormat_t lmsBench_processArgumentFormat(const char* format);
+
+/**
+ * @brief Process a comma separated list of positive integers, e.g. "16,64,256"
+ * @param list      string with argument to process
+ * @param values    Array for parsed values
+ * @param maxValues Size of <values>
+ * @return Number of values, 0 when the list is wrong
+ */
+int lmsBench_processArgumentList(const char* list, int* values, int maxValues);
+
+/**
+ * @brief Filter synthetic sine input held in memory with every supported kernel and engine, for each
+ * filter length and block size of the sweep, and report samples/s, ns/sample, ns/tap and cycles/tap.
+ * A fresh filter of every case then identifies an unknown system driven by pink noise, and the samples
+ * it needs to bring the error 20 dB below the desired signal are reported beside its cost.
+ * No file I/O is measured
+ * @param settings  Benchmark settings
+ * @return EXIT_SUCCESS when all cases ran. Otherwise, return EXIT_FAILURE
+ */
+int lmsBench_Run(const LmsBenchSettings_t* settings);
+
+#endif  /* LMS_BENCH_H */
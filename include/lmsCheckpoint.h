@@ -0,0 +1,107 @@
+/**
+ * @file lmsCheckpoint.h
+ * @author shed258
+ * @brief Checkpoint file header. A checkpoint holds the coefficients of one filter with the rest of
+ * its adaptive state, or the coefficients of a bank of channels. The file is an image of memory: a
+ * header of LMS_CHECKPOINT_HEADER_SIZE bytes followed by one coefficient row per channel, every row
+ * 64-byte aligned, so thousands of channels are loaded with a single mmap and no parsing
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_CHECKPOINT_H
+#define LMS_CHECKPOINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define LMS_CHECKPOINT_MAGIC        "LMSCKPT"
+#define LMS_CHECKPOINT_VERSION      1
+#define LMS_CHECKPOINT_HEADER_SIZE  128
+#define LMS_CHECKPOINT_BYTE_ORDER   0x01020304u     /* stored in native order, read back unchanged on the same kind of CPU */
+
+/* Fixed layout of the first LMS_CHECKPOINT_HEADER_SIZE bytes of the file */
+typedef struct
+{
+    char magic[8];                  /* LMS_CHECKPOINT_MAGIC */
+    uint32_t version;               /* LMS_CHECKPOINT_VERSION */
+    uint32_t byteOrder;             /* LMS_CHECKPOINT_BYTE_ORDER */
+    uint32_t headerSize;            /* LMS_CHECKPOINT_HEADER_SIZE */
+    uint32_t numOfChannels;
+    uint32_t length;                /* filter length */
+    uint32_t rowStride;             /* floats from one channel row to the next, 64-byte multiple */
+    uint32_t variant;               /* LmsFilterVariant_t */
+    float step;
+    float leakage;
+    uint32_t hasState;              /* a single filter with delay line and pending update, 0 for coefficients only */
+    int32_t pendingUpdate;          /* coefficient update of the last sample not applied yet */
+    int64_t position;               /* input samples filtered when the checkpoint was taken */
+    uint64_t payloadBytes;          /* bytes after the header */
+    uint64_t checksum;              /* FNV-1a of header and payload, computed with this field zero */
+    double power;                   /* window power of NLMS */
+    float pendingGain;              /* step * error of the pending update */
+    uint8_t reserved[LMS_CHECKPOINT_HEADER_SIZE - 92];
+} LmsCheckpointHeader_t;
+
+/* Checkpoint image held in memory, either built for writing or mapped read-only from a file */
+typedef struct
+{
+    LmsCheckpointHeader_t* header;
+    float* coefficients;            /* [numOfChannels][rowStride] */
+    float* window;                  /* [length + 1] delay line of a single filter, oldest sample first, NULL without state */
+    size_t size;                    /* bytes of the image */
+    int mapped;                     /* image is a read-only mapping of the file */
+} LmsCheckpoint_t;
+
+/* Checkpoint options of a filtering run */
+typedef struct
+{
+    const char* saveFileName;       /* state written at the end of the run, NULL for none */
+    long interval;                  /* also written every <interval> filtered samples, 0 at the end only */
+    const char* resumeFileName;     /* restore the whole state and skip the samples it has filtered, NULL for none */
+    const char* warmStartFileName;  /* start from these coefficients with a clear delay line, NULL for none */
+} LmsCheckpointSettings_t;
+
+/**
+ * @brief Allocate a cleared image for writing. The caller fills the coefficient rows and the header
+ * fields describing the filter
+ * @param checkpoint        Checkpoint image
+ * @param numOfChannels     Number of coefficient rows
+ * @param length            Filter length
+ * @param hasState          Reserve the delay line of a single filter
+ * @return EXIT_SUCCESS when allocated succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsCheckpoint_Create(LmsCheckpoint_t* checkpoint, int numOfChannels, int length, int hasState);
+
+/**
+ * @brief Coefficient row of a channel
+ * @param checkpoint    Checkpoint image
+ * @param channel       Channel number
+ * @return <length> coefficients, 64-byte aligned
+ */
+float* lmsCheckpoint_Row(const LmsCheckpoint_t* checkpoint, int channel);
+
+/**
+ * @brief Write the image with its checksum. The file is written under a temporary name and renamed,
+ * so a reader never sees a partial checkpoint and an interrupted run keeps the previous one
+ * @param checkpoint    Checkpoint image created by lmsCheckpoint_Create
+ * @param fileName      Name of the checkpoint file
+ * @return EXIT_SUCCESS when written succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsCheckpoint_Write(LmsCheckpoint_t* checkpoint, const char* fileName);
+
+/**
+ * @brief Map a checkpoint file read-only and verify its header, size and checksum
+ * @param checkpoint    Checkpoint image
+ * @param fileName      Name of the checkpoint file
+ * @return EXIT_SUCCESS when the file is a valid checkpoint. Otherwise, return EXIT_FAILURE
+ */
+int lmsCheckpoint_Open(LmsCheckpoint_t* checkpoint, const char* fileName);
+
+/**
+ * @brief Release a created or mapped image
+ * @param checkpoint    Checkpoint image, may be closed twice
+ */
+void lmsCheckpoint_Close(LmsCheckpoint_t* checkpoint);
+
+#endif  /* LMS_CHECKPOINT_H */
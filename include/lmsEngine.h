@@ -0,0 +1,101 @@
+/**
+ * @file lmsEngine.h
+ * @author shed258
+ * @brief Adaptive filter engine interface. Every algorithm (time-domain LMS, FDAF, Q15, subband, RLS,
+ * APA) is reached through one table of operations, so file filtering, telemetry and the benchmark
+ * handle them alike
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_ENGINE_H
+#define LMS_ENGINE_H
+
+#include "lmsFilter.h"
+
+typedef struct
+{
+    const char* name;
+
+    /* Same contract as lmsFilter_ProcessBlock, desired may be NULL */
+    int (*processBlock)(void* state, const float* input, const float* desired, float* output, float* error,
+                        int numOfSamples);
+
+    /* Push an input sample into the engine history without filtering */
+    void (*pushSample)(void* state, float sample);
+
+    /* Sum of squares of the coefficients */
+    double (*normSquared)(void* state);
+
+    /* Release the state */
+    void (*close)(void* state);
+} LmsEngineOps_t;
+
+typedef struct
+{
+    const LmsEngineOps_t* ops;
+    void* state;
+} LmsEngine_t;
+
+typedef struct
+{
+    LmsFilterAlgorithm_t algorithm;
+    float step;                     /* step size of LMS engines, 1 - forgetting factor of RLS, normalized step of APA and subband */
+    int length;
+    int numOfBands;                 /* subband: filterbank bands, 0 for the default */
+    int projectionOrder;            /* apa: input vectors of one projection, 0 for the default */
+    int numOfThreads;               /* threads the engine may use, 0 for all CPUs, 1 for the calling thread only */
+} LmsEngineSettings_t;
+
+/**
+ * @brief Create the engine of an algorithm
+ * @param engine    Engine
+ * @param settings  Engine settings
+ * @param filter    Initialized filter run by the lms algorithm, its step size, length and variant
+ *                  apply. Not owned by the engine, NULL for the other algorithms
+ * @return EXIT_SUCCESS when created succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsEngine_Open(LmsEngine_t* engine, const LmsEngineSettings_t* settings, LmsFilter_t* filter);
+
+/**
+ * @brief Release the engine, the filter given to lmsEngine_Open is left to its owner
+ * @param engine    Engine, may be closed twice
+ */
+void lmsEngine_Close(LmsEngine_t* engine);
+
+/**
+ * @brief Filter a block of samples, same interface as lmsFilter_ProcessBlock
+ * @param engine        Engine
+ * @param input         Input samples
+ * @param desired       Desired samples or NULL to use the oldest sample in the window
+ * @param output        Filter output or NULL
+ * @param error         Error signal or NULL
+ * @param numOfSamples  Number of samples
+ * @return EXIT_SUCCESS when processed succesfully. EXIT_FAILURE when algorithm goes unstable
+ */
+int lmsEngine_ProcessBlock(const LmsEngine_t* engine, const float* input, const float* desired,
+                           float* output, float* error, int numOfSamples);
+
+/**
+ * @brief Push an input sample into the history without filtering
+ * @param engine    Engine
+ * @param sample    Input sample
+ */
+void lmsEngine_PushSample(const LmsEngine_t* engine, float sample);
+
+/**
+ * @brief Sum of squares of the coefficients. A pending update of the time-domain filter is left for
+ * its next block, the norm lags it by one sample
+ * @param engine    Engine
+ * @return Squared coefficient norm
+ */
+double lmsEngine_NormSquared(const LmsEngine_t* engine);
+
+/**
+ * @brief Name of the engine, e.g. for reports
+ * @param engine    Engine
+ * @return Algorithm name as given to --algo
+ */
+const char* lmsEngine_Name(const LmsEngine_t* engine);
+
+#endif  /* LMS_ENGINE_H */
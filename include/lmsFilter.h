@@ -9,17 +9,89 @@
 #ifndef LMS_FILTER_H
 #define LMS_FILTER_H
 
-#define MAX_FILTER_LENGTH 1000
+#include <stddef.h>
+#include "lmsAllocator.h"
+#include "lmsCheckpoint.h"
+#include "lmsKernel.h"
+#include "lmsPlot.h"
+#include "lmsRealtime.h"
+#include "lmsTelemetry.h"
+#include "sampleIo.h"
 
-typedef struct
+#define LMS_FILTER_NLMS_REGULARIZATION  1e-6     /* added to the window power, avoids division by zero */
+#define LMS_FILTER_DEFAULT_LEAKAGE      0.01f
+
+typedef enum
+{
+    LMS_FILTER_VARIANT_LMS = 0,         /* c += step * e * x */
+    LMS_FILTER_VARIANT_NLMS,            /* c += step * e * x / (|x|^2 + regularization) */
+    LMS_FILTER_VARIANT_LEAKY,           /* c = (1 - step * leakage) * c + step * e * x */
+    LMS_FILTER_VARIANT_SIGN_ERROR,      /* c += step * sign(e) * x */
+    LMS_FILTER_VARIANT_SIGN_DATA,       /* c += step * e * sign(x) */
+    LMS_FILTER_VARIANT_SIGN_SIGN,       /* c += step * sign(e) * sign(x) */
+    LMS_FILTER_VARIANT_COUNT
+} LmsFilterVariant_t;
+
+typedef struct LmsFilter LmsFilter_t;
+
+/* Block filtering routine specialized for one variant, chosen at init */
+typedef int (*LmsFilterProcessBlock_t)(LmsFilter_t* filter, const float* input, const float* desired,
+                                       float* output, float* error, int numOfSamples);
+
+struct LmsFilter
 {
     float step;
     int length;
-    float coefficients[MAX_FILTER_LENGTH];
-} LmsFilter_t;
+    float* coefficients;                /* [length], 64-byte aligned */
+    float* delayLine;                   /* [2 * (length + 1)] mirrored circular buffer, taps stay contiguous */
+    int delayIndex;                     /* position of the oldest sample in delayLine */
+    float pendingGain;                  /* step * error not yet applied to coefficients */
+    int pendingUpdate;                  /* coefficient update of the last sample not applied yet */
+    double power;                       /* sum of squares of the window, updated per sample for NLMS */
+    LmsFilterVariant_t variant;
+    float leakage;                      /* leaky LMS: coefficients decay by step * leakage per sample */
+    float leak;                         /* 1 - step * leakage */
+    LmsFilterProcessBlock_t processBlock;
+    const LmsKernel_t* kernel;          /* dot product / update routines for this CPU */
+    LmsAllocator_t allocator;           /* allocator of <memory> */
+    void* memory;                       /* single allocation holding coefficients and delay line */
+};
+
+typedef enum
+{
+    LMS_FILTER_ALGORITHM_UNKNOWN = 0,
+    LMS_FILTER_ALGORITHM_LMS,           /* time-domain LMS, O(L) per sample */
+    LMS_FILTER_ALGORITHM_FDAF,          /* frequency-domain block LMS, O(log L) per sample */
+    LMS_FILTER_ALGORITHM_FIXED,         /* Q15 time-domain LMS, step size rounded to a power of two */
+    LMS_FILTER_ALGORITHM_SUBBAND,       /* NLMS in decimated DFT filterbank bands, output delayed by the filterbank */
+    LMS_FILTER_ALGORITHM_RLS,           /* recursive least squares, direct O(L^2) or lattice O(L) per sample */
+    LMS_FILTER_ALGORITHM_APA,           /* affine projection of order P, O(P L) per sample */
+} LmsFilterAlgorithm_t;
+
+typedef struct
+{
+    LmsFilterAlgorithm_t algorithm;
+    SampleFormat_t inputFormat;     /* SAMPLE_FORMAT_UNKNOWN to guess from the file name */
+    SampleFormat_t outputFormat;    /* SAMPLE_FORMAT_UNKNOWN to use the input format */
+    const char* outputFileName;     /* NULL to append "filtered" to the input file name */
+    const char* desiredFileName;    /* desired samples read in lock-step with the input, NULL for none */
+    int twoColumn;                  /* input file holds input and desired samples as two interleaved channels */
+    int channels;                   /* interleaved channels in raw and text input */
+    int numOfThreads;               /* worker threads for batch filtering, 0 for all CPUs */
+    int numOfBands;                 /* bands of the subband algorithm, 0 for the default */
+    int projectionOrder;            /* input vectors of one APA projection, 0 for the default */
+    int useBank;                    /* filter interleaved channels with one SoA filter bank */
+    int pipelined;                  /* single file: read, filter and write on three threads */
+    const LmsRealtimeSettings_t* realtime;  /* single file: block-by-block real-time run, NULL for streaming */
+    const LmsTelemetrySettings_t* telemetry;    /* convergence telemetry of every channel, NULL for none */
+    const LmsCheckpointSettings_t* checkpoint;  /* lms algorithm: save, resume or warm start the filter state, NULL for none */
+    const LmsPlotSettings_t* plot;  /* single file: decimated plot of the output frames, NULL for none */
+    int quiet;                      /* do not print progress */
+} LmsFilterFileSettings_t;
 
 /**
- * @brief Initialize the filter structure with step size and filter length
+ * @brief Initialize the filter structure with step size and filter length.
+ * Coefficients and delay line are allocated on the heap and cleared
  * @param filter    Structure holding LMS filter
  * @param step      Step size
  * @param length    Filter length
@@ -27,6 +99,102 @@ typedef struct
  */
 int lmsFilter_Init(LmsFilter_t* filter, float step, int length);
 
+/**
+ * @brief Initialize the filter structure, coefficients and delay line are taken from the allocator
+ * @param filter    Structure holding LMS filter
+ * @param step      Step size
+ * @param length    Filter length
+ * @param allocator Allocator for filter memory, e.g. an arena shared by many filters
+ * @return EXIT_SUCCESS when filter initialised succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsFilter_InitWithAllocator(LmsFilter_t* filter, float step, int length, const LmsAllocator_t* allocator);
+
+/**
+ * @brief Initialize the filter structure with the update rule of given variant. The block routine
+ * of the variant is chosen here, so filtering does not branch on the variant
+ * @param filter    Structure holding LMS filter
+ * @param step      Step size
+ * @param length    Filter length
+ * @param variant   Update rule
+ * @param leakage   Leakage of LMS_FILTER_VARIANT_LEAKY, ignored by other variants
+ * @param allocator Allocator for filter memory or NULL for the heap
+ * @return EXIT_SUCCESS when filter initialised succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsFilter_InitVariant(LmsFilter_t* filter, float step, int length, LmsFilterVariant_t variant,
+                          float leakage, const LmsAllocator_t* allocator);
+
+/**
+ * @brief Memory taken from the allocator by a filter of given length, alignment included
+ * @param length    Filter length
+ * @return Size in bytes
+ */
+size_t lmsFilter_RequiredMemory(int length);
+
+/**
+ * @brief Release filter memory. Memory from an allocator without release is left to its owner
+ * @param filter    Structure holding LMS filter
+ */
+void lmsFilter_Free(LmsFilter_t* filter);
+
+/**
+ * @brief Push the next input sample into the filter delay line. The oldest sample is dropped
+ * @param filter    Pointer to LMS filter structure
+ * @param sample    New input sample
+ */
+void lmsFilter_PushSample(LmsFilter_t* filter, float sample);
+
+/**
+ * @brief Apply the pending coefficient update. The update from the last sample is deferred
+ * and fused with the filter output pass of the next sample. Call before reading coefficients
+ * @param filter    Pointer to LMS filter structure
+ */
+void lmsFilter_FlushUpdate(LmsFilter_t* filter);
+
+/**
+ * @brief Get the current filter window
+ * @param filter    Pointer to LMS filter structure
+ * @return Pointer to <length> contiguous samples ordered from the oldest to the newest
+ */
+const float* lmsFilter_GetWindow(const LmsFilter_t* filter);
+
+/**
+ * @brief Filter a block of samples. Delay line and coefficients are carried across calls,
+ * so a stream can be processed in blocks of any size. No memory is allocated
+ * @param filter        Pointer to LMS filter structure
+ * @param input         Array of <numOfSamples> input samples
+ * @param desired       Array of <numOfSamples> desired samples. When NULL, the oldest sample
+ *                      in the filter window is used (input and desired signals are equal)
+ * @param output        Array for <numOfSamples> filter output samples, may be NULL
+ * @param error         Array for <numOfSamples> error samples, may be NULL
+ * @param numOfSamples  Number of samples in the block
+ * @return EXIT_SUCCESS when processed succesfully. EXIT_FAILURE when algorithm goes unstable
+ */
+int lmsFilter_ProcessBlock(LmsFilter_t* filter, const float* input, const float* desired,
+                           float* output, float* error, int numOfSamples);
+
+/**
+ * @brief Save the whole adaptive state of the filter: coefficients, delay line, pending update and
+ * window power. The pending update is saved as it is, so a filter loaded with <resume> set continues
+ * bit-exactly where this one stopped
+ * @param filter    Pointer to LMS filter structure
+ * @param position  Input samples the filter has consumed, stored for resuming a file
+ * @param fileName  Name of the checkpoint file
+ * @return EXIT_SUCCESS when saved succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsFilter_SaveCheckpoint(const LmsFilter_t* filter, long position, const char* fileName);
+
+/**
+ * @brief Load filter state from a checkpoint. With <resume> set, the whole state saved by
+ * lmsFilter_SaveCheckpoint is restored and the filter must have the same step size and variant.
+ * Otherwise, only the coefficients of a channel are taken (warm start) and the delay line is cleared
+ * @param filter        Initialized filter with the length of the checkpoint
+ * @param checkpoint    Opened checkpoint
+ * @param channel       Coefficient row to load
+ * @param resume        Restore delay line and pending update too
+ * @return EXIT_SUCCESS when loaded succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsFilter_LoadCheckpoint(LmsFilter_t* filter, const LmsCheckpoint_t* checkpoint, int channel, int resume);
+
 /**
  * @brief Process argument <length>
  * @param filterLength  string with argument to process
@@ -34,6 +202,27 @@ int lmsFilter_Init(LmsFilter_t* filter, float step, int length);
  */
 unsigned int lmsFilter_processArgumentFilterLength(const char* filterLength);
 
+/**
+ * @brief Process argument <variant>
+ * @param variant   string with argument to process: lms, nlms, leaky, sign-error, sign-data, sign-sign
+ * @return enumerated variant, LMS_FILTER_VARIANT_COUNT when unknown
+ */
+LmsFilterVariant_t lmsFilter_processArgumentVariant(const char* variant);
+
+/**
+ * @brief Name of the variant
+ * @param variant   Update rule
+ * @return Name as accepted by lmsFilter_processArgumentVariant
+ */
+const char* lmsFilter_VariantName(LmsFilterVariant_t variant);
+
+/**
+ * @brief Process argument <algo>
+ * @param algorithm     string with argument to process: lms, fdaf, q15, subband
+ * @return enumerated algorithm
+ */
+LmsFilterAlgorithm_t lmsFilter_processArgumentAlgorithm(const char* algorithm);
+
 /**
  * @brief Process argument <stepsize>
  * @param stepSize  string with argument to process
@@ -44,11 +233,50 @@ float lmsFilter_processArgumentStepSize(const char* stepSize);
 /**
  * @brief Filtering function.
  * Applying the filter to the input signal and desired signal.
- * Saving processed samples to the file.
+ * Saving processed samples to the file. Each output frame holds input, filter output and error.
+ * The input is read once, as a stream, so it can be a pipe. With <pipelined> set, parsing, filtering
+ * and formatting run on three threads connected by lock-free rings of sample blocks.
+ * With <desiredFileName> or <twoColumn> set, the desired signal is a second stream read in lock-step
+ * with the input and the error is desired[n] - y[n]. Otherwise, the desired signal is the input
+ * delayed by <length> - 1 samples. With <realtime> set, the file is loaded first and filtered in
+ * real-time blocks on a dedicated thread, block latency statistics are printed instead of progress.
+ * With <telemetry> set, divergence warnings are printed as they are raised and convergence
+ * statistics when the file is done. With <checkpoint> set, the filter starts from a saved state and its
+ * state is saved every <interval> samples and after the last input sample, before the zero tail.
+ * With <plot> set, the output frames are reduced to a min/max envelope as they are written and the
+ * plot is saved when the file is done
  * @param filter            Pointer to LMS filter structure
- * @param inputFileName     Name of the file containing input samples
+ * @param inputFileName     Name of the file containing input samples, SAMPLE_IO_STDIN for standard input
+ * @param settings          Input and output sample formats, output file name, desired signal source
  * @return EXIT_SUCCESS when processed succesfully. Otherwise, return EXIT_FAILURE
  */
-int lmsFilter_FilterSignalAndSaveToFile(LmsFilter_t* filter, const char* inputFileName);
+int lmsFilter_FilterSignalAndSaveToFile(LmsFilter_t* filter, const char* inputFileName,
+                                        const LmsFilterFileSettings_t* settings);
+
+/**
+ * @brief Filter each channel of an interleaved multi-channel file with its own filter.
+ * Channels are distributed over a thread pool, block by block, or filtered together by one
+ * filter bank when <useBank> is set. Output of channel <n> is saved to <file>filtered.<n> and is
+ * the same as filtering that channel alone. With <checkpoint> set, every channel starts from the
+ * coefficients of its row, or of the only row, and the coefficients of all channels are saved at the end
+ * @param prototype         Filter with parameters used for every channel
+ * @param inputFileName     Name of the file containing interleaved input samples
+ * @param settings          Sample formats, number of channels and worker threads
+ * @return EXIT_SUCCESS when all channels processed succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsFilter_FilterInterleavedFile(const LmsFilter_t* prototype, const char* inputFileName,
+                                    const LmsFilterFileSettings_t* settings);
+
+/**
+ * @brief Filter a batch of files, each with its own filter, on a thread pool
+ * @param prototype         Filter with parameters used for every file
+ * @param inputFileNames    Names of the input files
+ * @param numOfFiles        Number of input files
+ * @param settings          Sample formats and worker threads. Output file names are always default, every file
+ *                          holds a single channel
+ * @return EXIT_SUCCESS when all files processed succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsFilter_FilterFiles(const LmsFilter_t* prototype, const char* const* inputFileNames, int numOfFiles,
+                          const LmsFilterFileSettings_t* settings);
 
 #endif  /* LMS_FILTER_H */
\ No newline at end of file
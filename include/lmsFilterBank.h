@@ -0,0 +1,73 @@
+/**
+ * @file lmsFilterBank.h
+ * @author shed258
+ * @brief Multi-channel LMS filter bank header. Coefficients and delay lines of all channels are
+ * interleaved (structure of arrays), so one vector instruction processes the same tap of 8 or 16 channels
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_FILTER_BANK_H
+#define LMS_FILTER_BANK_H
+
+#include "lmsKernel.h"
+
+typedef struct
+{
+    float step;
+    int length;
+    int numOfChannels;
+    int stride;                 /* floats per row, numOfChannels rounded up to LMS_KERNEL_BANK_LANES */
+    float* coefficients;        /* [length][stride] */
+    float* delayLine;           /* [2 * (length + 1)][stride], mirrored circular buffer of frames */
+    int delayIndex;             /* row of the oldest frame in delayLine */
+    float* pendingGain;         /* [stride], step * error not yet applied to coefficients */
+    float* output;              /* [stride], filter output of the last frame */
+    const LmsKernel_t* kernel;
+    void* memory;               /* single 64-byte aligned allocation holding all arrays */
+} LmsFilterBank_t;
+
+/**
+ * @brief Initialize the filter bank, all channels with the same step size and filter length.
+ * Coefficients and delay lines are cleared
+ * @param bank              Filter bank structure
+ * @param step              Step size
+ * @param length            Filter length
+ * @param numOfChannels     Number of channels
+ * @return EXIT_SUCCESS when initialized succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsFilterBank_Init(LmsFilterBank_t* bank, float step, int length, int numOfChannels);
+
+/**
+ * @brief Release memory of the filter bank
+ * @param bank  Filter bank structure
+ */
+void lmsFilterBank_Free(LmsFilterBank_t* bank);
+
+/**
+ * @brief Push an input frame into the delay lines without filtering, e.g. to fill the first window
+ * @param bank      Filter bank structure
+ * @param frame     <numOfChannels> input samples
+ */
+void lmsFilterBank_PushFrame(LmsFilterBank_t* bank, const float* frame);
+
+/**
+ * @brief Apply coefficient update of the last frame. Needed before reading coefficients
+ * @param bank  Filter bank structure
+ */
+void lmsFilterBank_FlushUpdate(LmsFilterBank_t* bank);
+
+/**
+ * @brief Filter a block of interleaved frames, every channel the same as lmsFilter_ProcessBlock
+ * @param bank          Filter bank structure
+ * @param input         <numOfFrames> * <numOfChannels> input samples
+ * @param desired       Desired samples, same layout as input, or NULL to use the oldest sample in the window
+ * @param output        Filter output, same layout as input, or NULL
+ * @param error         Error signal, same layout as input, or NULL
+ * @param numOfFrames   Number of frames
+ * @return EXIT_SUCCESS when all channels stay stable. Otherwise, return EXIT_FAILURE
+ */
+int lmsFilterBank_ProcessFrames(LmsFilterBank_t* bank, const float* input, const float* desired,
+                                float* output, float* error, int numOfFrames);
+
+#endif  /* LMS_FILTER_BANK_H */
@@ -0,0 +1,116 @@
+/**
+ * @file lmsFixed.h
+ * @author shed258
+ * @brief Fixed-point LMS filter: Q15 samples and coefficients, wide accumulators, saturating
+ * arithmetic and a power of two step size. Results are bit-exact across kernels and hosts
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_FIXED_H
+#define LMS_FIXED_H
+
+#include <stdint.h>
+#include "lmsKernel.h"
+
+#define LMS_FIXED_Q15_ONE       32768
+#define LMS_FIXED_Q15_MAX       32767
+#define LMS_FIXED_COEFF_MAX     32767   /* coefficients saturate symmetrically, see lmsFixed.c */
+#define LMS_FIXED_MAX_STEP_SHIFT 15
+
+typedef struct
+{
+    LmsKernelType_t type;
+    const char* name;
+
+    /* Fused pass: coefficients[k] = sat(coefficients[k] + round(gain * previous[k] >> 15)),
+     * then returns sum of coefficients[k] * current[k] in Q30 */
+    int64_t (*updateDot)(int16_t* coefficients, const int16_t* previous, const int16_t* current,
+                         int16_t gain, int length);
+} LmsFixedKernel_t;
+
+typedef struct
+{
+    int length;
+    int stepShift;                  /* step size is 2^-stepShift */
+    int16_t* coefficients;          /* [length] Q15, 64-byte aligned */
+    int16_t* delayLine;             /* [2 * (length + 1)] mirrored circular buffer, as in LmsFilter_t */
+    int delayIndex;                 /* position of the oldest sample in delayLine */
+    int16_t pendingGain;            /* Q15 step * error of the last sample, its update is fused with the next output */
+    const LmsFixedKernel_t* kernel;
+    void* memory;
+} LmsFixed_t;
+
+/**
+ * @brief Initialize the fixed-point filter. Coefficients and delay line are allocated and cleared
+ * @param filter        Fixed-point filter structure
+ * @param stepShift     Step size is 2^-stepShift, from 0 to LMS_FIXED_MAX_STEP_SHIFT
+ * @param length        Filter length
+ * @return EXIT_SUCCESS when filter initialised succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsFixed_Init(LmsFixed_t* filter, int stepShift, int length);
+
+/**
+ * @brief Release memory of the filter
+ * @param filter    Fixed-point filter structure
+ */
+void lmsFixed_Free(LmsFixed_t* filter);
+
+/**
+ * @brief Push an input sample without filtering, e.g. to fill the first window
+ * @param filter    Fixed-point filter structure
+ * @param sample    New Q15 input sample
+ */
+void lmsFixed_PushSample(LmsFixed_t* filter, int16_t sample);
+
+/**
+ * @brief Filter a block of Q15 samples. State is carried across calls, no memory is allocated
+ * @param filter        Fixed-point filter structure
+ * @param input         Array of <numOfSamples> input samples
+ * @param desired       Array of <numOfSamples> desired samples. When NULL, the oldest sample
+ *                      in the filter window is used, as in lmsFilter_ProcessBlock
+ * @param output        Array for <numOfSamples> filter output samples, may be NULL
+ * @param error         Array for <numOfSamples> error samples, may be NULL
+ * @param numOfSamples  Number of samples in the block
+ */
+void lmsFixed_ProcessBlock(LmsFixed_t* filter, const int16_t* input, const int16_t* desired,
+                           int16_t* output, int16_t* error, int numOfSamples);
+
+/**
+ * @brief Step shift nearest to a step size, the fixed-point filter adapts with powers of two only
+ * @param step  Step size of the floating-point filter
+ * @return Step shift from 0 to LMS_FIXED_MAX_STEP_SHIFT
+ */
+int lmsFixed_StepShift(float step);
+
+/**
+ * @brief Convert float samples to Q15, rounded and saturated
+ * @param dst       Q15 samples
+ * @param src       Float samples, full scale is [-1, 1)
+ * @param count     Number of samples
+ */
+void lmsFixed_FromFloat(int16_t* dst, const float* src, int count);
+
+/**
+ * @brief Convert Q15 samples to float
+ * @param dst       Float samples
+ * @param src       Q15 samples
+ * @param count     Number of samples
+ */
+void lmsFixed_ToFloat(float* dst, const int16_t* src, int count);
+
+/**
+ * @brief Get fixed-point kernel of given type
+ * @param type  Kernel type, fixed-point kernels exist for scalar, SSE2 and AVX2
+ * @return Pointer to kernel table or NULL when not available on this CPU
+ */
+const LmsFixedKernel_t* lmsFixed_GetKernel(LmsKernelType_t type);
+
+/**
+ * @brief Get the fastest fixed-point kernel not above the float kernel chosen by lmsKernel_GetBest,
+ * so LMS_KERNEL=<name> limits both
+ * @return Pointer to kernel table
+ */
+const LmsFixedKernel_t* lmsFixed_GetBestKernel(void);
+
+#endif  /* LMS_FIXED_H */
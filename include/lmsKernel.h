@@ -0,0 +1,73 @@
+/**
+ * @file lmsKernel.h
+ * @author shed258
+ * @brief Vectorized LMS kernels with runtime CPU dispatch
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_KERNEL_H
+#define LMS_KERNEL_H
+
+#define LMS_KERNEL_BANK_LANES   16      /* channel stride of filter bank rows is a multiple of it */
+
+typedef enum
+{
+    LMS_KERNEL_SCALAR = 0,
+    LMS_KERNEL_SSE2,
+    LMS_KERNEL_AVX2,
+    LMS_KERNEL_AVX512,
+    LMS_KERNEL_COUNT
+} LmsKernelType_t;
+
+typedef struct
+{
+    LmsKernelType_t type;
+    const char* name;
+
+    /* Returns sum of a[k] * b[k] */
+    float (*dot)(const float* a, const float* b, int length);
+
+    /* coefficients[k] += gain * input[k] */
+    void (*update)(float* coefficients, const float* input, float gain, int length);
+
+    /* Fused pass: coefficients[k] += gain * previous[k], then returns sum of coefficients[k] * current[k] */
+    float (*updateDot)(float* coefficients, const float* previous, const float* current,
+                       float gain, int length);
+
+    /* Leaky fused pass: coefficients[k] = leak * coefficients[k] + gain * previous[k], then returns the dot */
+    float (*leakyUpdateDot)(float* coefficients, const float* previous, const float* current,
+                            float gain, float leak, int length);
+
+    /* Sign-data fused pass: coefficients[k] += gain * sign(previous[k]), then returns the dot */
+    float (*signUpdateDot)(float* coefficients, const float* previous, const float* current,
+                           float gain, int length);
+
+    /* Fused pass of a channel-interleaved filter bank, rows of <stride> channels per tap:
+     * coefficients[k][ch] += gain[ch] * previous[k][ch], then output[ch] = sum of coefficients[k][ch] * current[k][ch] */
+    void (*bankUpdateDot)(float* coefficients, const float* previous, const float* current,
+                          const float* gain, float* output, int length, int stride);
+} LmsKernel_t;
+
+/**
+ * @brief Check whether the CPU running the program supports given kernel
+ * @param type  Kernel type
+ * @return 1 when supported. Otherwise, return 0
+ */
+int lmsKernel_IsSupported(LmsKernelType_t type);
+
+/**
+ * @brief Get kernel table of given type
+ * @param type  Kernel type
+ * @return Pointer to kernel table or NULL when kernel is not supported by the CPU
+ */
+const LmsKernel_t* lmsKernel_Get(LmsKernelType_t type);
+
+/**
+ * @brief Get the fastest kernel supported by the CPU. Detection is done once, on first call from any thread.
+ * LMS_KERNEL=<name> in the environment selects a kernel, a warning is printed when it is not available
+ * @return Pointer to kernel table
+ */
+const LmsKernel_t* lmsKernel_GetBest(void);
+
+#endif  /* LMS_KERNEL_H */
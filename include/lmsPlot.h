@@ -0,0 +1,103 @@
+/**
+ * @file lmsPlot.h
+ * @author shed258
+ * @brief Decimated plot of filter output. Frames are reduced as they are written to a fixed number
+ * of buckets holding the minimum, maximum and RMS of every series, so a plot of any length takes
+ * the same memory and the saved file stays small. Saved as self-contained HTML, SVG or CSV
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_PLOT_H
+#define LMS_PLOT_H
+
+#include "sampleIo.h"
+
+#define LMS_PLOT_DEFAULT_WIDTH  1024    /* buckets, about one per pixel of the plot */
+#define LMS_PLOT_MIN_WIDTH      16
+#define LMS_PLOT_MAX_WIDTH      65536
+#define LMS_PLOT_MAX_SERIES     4
+
+typedef enum
+{
+    LMS_PLOT_FORMAT_HTML = 0,   /* page with an inline SVG, opens in any browser */
+    LMS_PLOT_FORMAT_SVG,
+    LMS_PLOT_FORMAT_CSV,        /* one line per bucket: first sample, then min, max and RMS of every series */
+} LmsPlotFormat_t;
+
+typedef struct
+{
+    const char* fileName;       /* plot file, the format is taken from its extension: .csv, .svg, otherwise HTML */
+    int width;                  /* buckets, LMS_PLOT_MIN_WIDTH to LMS_PLOT_MAX_WIDTH, rounded down to even */
+} LmsPlotSettings_t;
+
+typedef struct
+{
+    LmsPlotSettings_t settings;
+    LmsPlotFormat_t format;
+    int numOfSeries;
+    const char* const* names;   /* [numOfSeries] names of the series */
+    float* minimum;             /* [width][numOfSeries] */
+    float* maximum;             /* [width][numOfSeries] */
+    double* sumSquares;         /* [width][numOfSeries] */
+    int buckets;                /* complete buckets, the next one is being filled */
+    long bucketSize;            /* frames per bucket, doubles whenever all buckets are complete */
+    long fill;                  /* frames in the bucket being filled */
+    long frames;
+} LmsPlot_t;
+
+/**
+ * @brief Prepare an empty plot
+ * @param plot          Plot state
+ * @param settings      Plot file and width
+ * @param numOfSeries   Samples in one frame, at most LMS_PLOT_MAX_SERIES
+ * @param names         Names of the series, must outlive the plot
+ * @return EXIT_SUCCESS when prepared succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsPlot_Init(LmsPlot_t* plot, const LmsPlotSettings_t* settings, int numOfSeries, const char* const* names);
+
+/**
+ * @brief Release the plot
+ * @param plot  Plot state
+ */
+void lmsPlot_Free(LmsPlot_t* plot);
+
+/**
+ * @brief Add interleaved frames to the plot, O(1) amortized per sample
+ * @param plot      Plot state
+ * @param frames    <count> * <numOfSeries> samples
+ * @param count     Number of frames
+ */
+void lmsPlot_AddFrames(LmsPlot_t* plot, const float* frames, int count);
+
+/**
+ * @brief Save the plot to its file
+ * @param plot      Plot state
+ * @param title     Title of the plot, e.g. the name of the plotted file
+ * @return EXIT_SUCCESS when saved succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsPlot_Write(const LmsPlot_t* plot, const char* title);
+
+/**
+ * @brief Plot a file written by filtering: frames of input, filter output and error
+ * @param inputFileName     Name of the filtered file, text output has the frame index in the first column
+ * @param format            Sample format of the file, SAMPLE_FORMAT_UNKNOWN to guess from the file name
+ * @param settings          Plot file and width
+ * @return EXIT_SUCCESS when plotted succesfully. Otherwise, return EXIT_FAILURE
+ */
+int lmsPlot_PlotFile(const char* inputFileName, SampleFormat_t format, const LmsPlotSettings_t* settings);
+
+/**
+ * @brief Open a saved plot with the desktop viewer (xdg-open), without a shell
+ * @param fileName  Plot file
+ * @return EXIT_SUCCESS when the viewer started. Otherwise, return EXIT_FAILURE
+ */
+int lmsPlot_Open(const char* fileName);
+
+/**
+ * @brief Names of the series of a filtered file: input, output, error
+ * @return Array of three names
+ */
+const char* const* lmsPlot_FilterSeriesNames(void);
+
+#endif  /* LMS_PLOT_H */
@@ -0,0 +1,97 @@
+/**
+ * @file lmsRealtime.h
+ * @author shed258
+ * @brief Real-time processing support: worker thread setup, per-block latency histogram and deadline misses
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_REALTIME_H
+#define LMS_REALTIME_H
+
+#define LMS_REALTIME_DEFAULT_BLOCK_SIZE     64
+#define LMS_REALTIME_SUB_BUCKETS_LOG2       3       /* 8 buckets per power of two, 12.5 % resolution */
+#define LMS_REALTIME_SUB_BUCKETS            (1 << LMS_REALTIME_SUB_BUCKETS_LOG2)
+#define LMS_REALTIME_BUCKETS                (64 * LMS_REALTIME_SUB_BUCKETS)
+
+typedef struct
+{
+    unsigned int sampleRate;        /* 0 for the sample rate of the input */
+    int blockSize;                  /* samples per block, the deadline is <blockSize> / <sampleRate> */
+    int priority;                   /* SCHED_FIFO priority of the worker thread, 0 to keep the default policy */
+    int cpu;                        /* CPU the worker thread is pinned to, -1 for any */
+    int paced;                      /* release blocks at the sample clock, otherwise back-to-back */
+} LmsRealtimeSettings_t;
+
+/* Log-linear histogram of block processing times in nanoseconds. Fixed size, recording is O(1) */
+typedef struct
+{
+    unsigned long long counts[LMS_REALTIME_BUCKETS];
+    unsigned long long total;
+    unsigned long long sumNs;
+    unsigned long long maxNs;
+} LmsLatencyHistogram_t;
+
+typedef struct
+{
+    LmsRealtimeSettings_t settings;
+    unsigned long long deadlineNs;
+    unsigned long long deadlineMisses;
+    LmsLatencyHistogram_t histogram;
+} LmsRealtime_t;
+
+typedef struct
+{
+    unsigned long long blocks;
+    unsigned long long deadlineMisses;
+    unsigned long long deadlineNs;
+    unsigned long long p50Ns;
+    unsigned long long p99Ns;
+    unsigned long long p999Ns;
+    unsigned long long maxNs;
+    double meanNs;
+} LmsRealtimeStats_t;
+
+/**
+ * @brief Clear the statistics and compute the block deadline
+ * @param realtime      Real-time state
+ * @param settings      Real-time settings, <sampleRate> must be set
+ * @return EXIT_SUCCESS when settings are correct. Otherwise, return EXIT_FAILURE
+ */
+int lmsRealtime_Init(LmsRealtime_t* realtime, const LmsRealtimeSettings_t* settings);
+
+/**
+ * @brief Prepare the calling thread for real-time work: CPU affinity, SCHED_FIFO priority, locked
+ * memory and flush-to-zero of denormals. Settings the system does not permit are reported and skipped
+ * @param settings      Real-time settings
+ */
+void lmsRealtime_ConfigureThread(const LmsRealtimeSettings_t* settings);
+
+/**
+ * @brief Monotonic time, read without system call, lock or allocation
+ * @return Time in nanoseconds
+ */
+unsigned long long lmsRealtime_Now(void);
+
+/**
+ * @brief Record the processing time of one block. No allocation, stdio or locks
+ * @param realtime      Real-time state
+ * @param elapsedNs     Time from the release of the block to the end of its processing
+ */
+void lmsRealtime_Record(LmsRealtime_t* realtime, unsigned long long elapsedNs);
+
+/**
+ * @brief Percentiles, mean and maximum of recorded blocks. Percentiles are the upper bounds of
+ * their histogram buckets
+ * @param realtime      Real-time state
+ * @param stats         Statistics
+ */
+void lmsRealtime_GetStats(const LmsRealtime_t* realtime, LmsRealtimeStats_t* stats);
+
+/**
+ * @brief Print statistics, not to be called from the real-time thread
+ * @param stats         Statistics
+ */
+void lmsRealtime_PrintStats(const LmsRealtimeStats_t* stats);
+
+#endif  /* LMS_REALTIME_H */
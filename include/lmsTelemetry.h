@@ -0,0 +1,135 @@
+/**
+ * @file lmsTelemetry.h
+ * @author shed258
+ * @brief Convergence telemetry of an adaptive filter: running MSE, coefficient norm drift,
+ * time to convergence and divergence warnings, updated in O(1) per sample
+ * @version 1.0.0
+ *
+ */
+
+#ifndef LMS_TELEMETRY_H
+#define LMS_TELEMETRY_H
+
+#define LMS_TELEMETRY_DEFAULT_SHORT_WINDOW          256
+#define LMS_TELEMETRY_DEFAULT_LONG_WINDOW           8192
+#define LMS_TELEMETRY_DEFAULT_CONVERGENCE_MARGIN    1.5f    /* dB */
+#define LMS_TELEMETRY_DEFAULT_CONVERGENCE_LEVEL     -40.0f  /* dB relative to the desired signal power */
+#define LMS_TELEMETRY_DEFAULT_DIVERGENCE_MARGIN     20.0f   /* dB */
+#define LMS_TELEMETRY_NORM_INTERVAL                 4096    /* samples between coefficient norms, at least the filter length */
+
+/* Warnings, raised once each */
+#define LMS_TELEMETRY_WARNING_ERROR_RISING  0x1     /* short-window MSE above the long-window MSE or the desired power by the divergence margin */
+#define LMS_TELEMETRY_WARNING_NORM_DRIFT    0x2     /* coefficient norm grew by the divergence margin since convergence */
+#define LMS_TELEMETRY_WARNING_NON_FINITE    0x4     /* error or coefficients are not finite */
+
+typedef struct
+{
+    int shortWindow;                /* samples, time constant of the fast MSE average */
+    int longWindow;                 /* samples, time constant of the slow MSE average */
+    float convergenceMargin;        /* dB, converged once both averages stay this close for <longWindow> samples */
+    float convergenceLevel;         /* dB relative to desired power, converged too while the fast average is below */
+    float divergenceMargin;         /* dB, rise of the fast average or of the coefficient norm that raises a warning */
+} LmsTelemetrySettings_t;
+
+typedef struct
+{
+    LmsTelemetrySettings_t settings;
+    double shortWeight;             /* 1 / <shortWindow> */
+    double longWeight;              /* 1 / <longWindow> */
+    double convergedLow;            /* short / long MSE ratio bounds of the convergence margin */
+    double convergedHigh;
+    double convergedLevel;          /* short MSE / short desired power ratio of the convergence level */
+    double divergenceRatio;         /* short / long MSE ratio of the divergence margin */
+    double shortMse;
+    double longMse;
+    double desiredPower;            /* long-window average of desired^2 */
+    double shortDesiredPower;       /* short-window average of desired^2 */
+    long samples;
+    long holdStart;                 /* first sample of the current run converged by margin or level, -1 outside */
+    long convergedAt;               /* -1 until converged */
+    int normInterval;
+    long nextNormCheck;
+    double norm;                    /* coefficient norm of the last check */
+    double convergedNorm;           /* first coefficient norm after convergence, 0 before */
+    double peakNorm;
+    int warnings;                   /* LMS_TELEMETRY_WARNING_* raised so far */
+    long firstWarningAt;            /* -1 without warnings */
+} LmsTelemetry_t;
+
+typedef struct
+{
+    long samples;
+    double shortMseDb;
+    double longMseDb;
+    double relativeMseDb;           /* long-window MSE relative to the desired signal power */
+    long convergedAt;
+    double norm;
+    double normDriftDb;             /* coefficient norm change since convergence */
+    double peakNorm;
+    int warnings;
+    long firstWarningAt;
+} LmsTelemetryStats_t;
+
+/**
+ * @brief Default settings: windows of 256 and 8192 samples, convergence margin 1.5 dB, convergence level -40 dB,
+ * divergence margin 20 dB
+ * @param settings      Telemetry settings
+ */
+void lmsTelemetry_DefaultSettings(LmsTelemetrySettings_t* settings);
+
+/**
+ * @brief Clear the telemetry
+ * @param telemetry     Telemetry state
+ * @param settings      Telemetry settings
+ * @param length        Filter length, coefficient norms are taken at most once per <length> samples
+ * @return EXIT_SUCCESS when settings are correct. Otherwise, return EXIT_FAILURE
+ */
+int lmsTelemetry_Init(LmsTelemetry_t* telemetry, const LmsTelemetrySettings_t* settings, int length);
+
+/**
+ * @brief Update the averages with a block of filtered samples. O(1) per sample, no allocation
+ * @param telemetry     Telemetry state
+ * @param desired       Desired samples of the block
+ * @param error         Error samples of the block
+ * @param count         Number of samples
+ * @return Warnings raised by this block, 0 for none
+ */
+int lmsTelemetry_Update(LmsTelemetry_t* telemetry, const float* desired, const float* error, int count);
+
+/**
+ * @brief Check whether a coefficient norm is due, at most once per LMS_TELEMETRY_NORM_INTERVAL samples
+ * @param telemetry     Telemetry state
+ * @return 1 when lmsTelemetry_UpdateNorm is to be called
+ */
+int lmsTelemetry_NormDue(const LmsTelemetry_t* telemetry);
+
+/**
+ * @brief Record the coefficient norm
+ * @param telemetry     Telemetry state
+ * @param normSquared   Sum of squares of the filter coefficients
+ * @return Warnings raised by the norm, 0 for none
+ */
+int lmsTelemetry_UpdateNorm(LmsTelemetry_t* telemetry, double normSquared);
+
+/**
+ * @brief Name of a warning
+ * @param warning   One LMS_TELEMETRY_WARNING_* flag
+ * @return Description of the warning
+ */
+const char* lmsTelemetry_WarningName(int warning);
+
+/**
+ * @brief Averages in dB, convergence and drift of the coefficient norm
+ * @param telemetry     Telemetry state
+ * @param stats         Statistics
+ */
+void lmsTelemetry_GetStats(const LmsTelemetry_t* telemetry, LmsTelemetryStats_t* stats);
+
+/**
+ * @brief Print statistics
+ * @param stats         Statistics
+ * @param name          Name of the filtered signal, e.g. its output file
+ */
+void lmsTelemetry_PrintStats(const LmsTelemetryStats_t* stats, const char* name);
+
+#endif  /* LMS_TELEMETRY_H */
@@ -0,0 +1,101 @@
+/**
+ * @file rlsFilter.h
+ * @author shed258
+ * @brief Recursive least squares filter header. The direct form updates the inverse input
+ * correlation matrix, O(L^2) per sample. The lattice form (a priori least squares lattice with error
+ * feedback) reaches the same least squares error with O(L) per sample and stays stable in long runs
+ * @version 1.0.0
+ *
+ */
+
+#ifndef RLS_FILTER_H
+#define RLS_FILTER_H
+
+#define RLS_FILTER_DIRECT_MAX_LENGTH    64      /* longest direct form, longer filters take the lattice */
+
+typedef enum
+{
+    RLS_FILTER_FORM_AUTO = 0,       /* direct up to RLS_FILTER_DIRECT_MAX_LENGTH taps, lattice above */
+    RLS_FILTER_FORM_DIRECT,
+    RLS_FILTER_FORM_LATTICE,
+} RlsFilterForm_t;
+
+typedef struct
+{
+    double lambda;                  /* forgetting factor, 0 < lambda < 1 */
+    int length;
+    RlsFilterForm_t form;           /* direct or lattice once initialized */
+    float* history;                 /* [2 * length] mirrored, newest sample first */
+    int historyIndex;
+
+    /* Direct form */
+    double* weights;                /* [length] weights of the newest to the oldest sample */
+    double* inverse;                /* [length * length] inverse correlation matrix, symmetric */
+    double* gain;                   /* [length] inverse matrix times the input vector */
+
+    /* Lattice form, stage m predicts with m past samples */
+    double* forwardPower;           /* [length] least squares forward prediction error power */
+    double* backwardPower;          /* [length] backward prediction error power of the previous sample */
+    double* backwardError;          /* [length] a priori backward prediction error of the previous sample */
+    double* conversion;             /* [length] conversion factor of the previous sample */
+    double* forwardReflection;      /* [length] */
+    double* backwardReflection;     /* [length] */
+    double* joint;                  /* [length] joint process (ladder) coefficients */
+
+    void* memory;
+} RlsFilter_t;
+
+/**
+ * @brief Initialize the filter. Weights are cleared, the inverse correlation starts as a large
+ * multiple of the identity, so the first samples are fitted almost exactly
+ * @param filter    RLS filter structure
+ * @param lambda    Forgetting factor, 0 < lambda < 1, memory of about 1 / (1 - lambda) samples
+ * @param length    Filter length
+ * @param form      Direct, lattice or RLS_FILTER_FORM_AUTO to choose by length
+ * @return EXIT_SUCCESS when filter initialised succesfully. Otherwise, return EXIT_FAILURE
+ */
+int rlsFilter_Init(RlsFilter_t* filter, double lambda, int length, RlsFilterForm_t form);
+
+/**
+ * @brief Release memory of the filter
+ * @param filter    RLS filter structure
+ */
+void rlsFilter_Free(RlsFilter_t* filter);
+
+/**
+ * @brief Push an input sample without filtering. The lattice adapts its prediction stages, which
+ * do not depend on the desired signal
+ * @param filter    RLS filter structure
+ * @param sample    New input sample
+ */
+void rlsFilter_PushSample(RlsFilter_t* filter, float sample);
+
+/**
+ * @brief Filter a block of samples, same interface as lmsFilter_ProcessBlock. Output and error
+ * are a priori, taken before the weights see the desired sample
+ * @param filter        RLS filter structure
+ * @param input         Input samples
+ * @param desired       Desired samples or NULL to use the oldest sample in the window
+ * @param output        Filter output or NULL
+ * @param error         Error signal or NULL
+ * @param numOfSamples  Number of samples
+ * @return EXIT_SUCCESS when filter stays stable. Otherwise, return EXIT_FAILURE
+ */
+int rlsFilter_ProcessBlock(RlsFilter_t* filter, const float* input, const float* desired,
+                           float* output, float* error, int numOfSamples);
+
+/**
+ * @brief Sum of squares of the weights, of the joint process coefficients for the lattice
+ * @param filter    RLS filter structure
+ * @return Squared coefficient norm
+ */
+double rlsFilter_NormSquared(const RlsFilter_t* filter);
+
+/**
+ * @brief Name of a form
+ * @param form  Form of the filter
+ * @return "direct" or "lattice"
+ */
+const char* rlsFilter_FormName(RlsFilterForm_t form);
+
+#endif  /* RLS_FILTER_H */
@@ -0,0 +1,182 @@
+/**
+ * @file sampleIo.h
+ * @author shed258
+ * @brief Sample file reader and writer header
+ * @version 1.0.0
+ *
+ */
+
+#ifndef SAMPLE_IO_H
+#define SAMPLE_IO_H
+
+#include <stdio.h>
+#include "asyncFile.h"
+
+#define SAMPLE_IO_DEFAULT_SAMPLE_RATE   48000
+#define SAMPLE_IO_BUFFER_FRAMES         4096
+#define SAMPLE_IO_STDIN                 "-"     /* file name for reading standard input */
+
+typedef enum
+{
+    SAMPLE_FORMAT_UNKNOWN = 0,
+    SAMPLE_FORMAT_TEXT,         /* one "%f;" sample per line */
+    SAMPLE_FORMAT_F32,          /* raw little-endian float32 */
+    SAMPLE_FORMAT_S16,          /* raw little-endian int16 */
+    SAMPLE_FORMAT_WAV_S16,      /* WAV, 16-bit PCM */
+    SAMPLE_FORMAT_WAV_F32,      /* WAV, 32-bit IEEE float */
+} SampleFormat_t;
+
+typedef struct
+{
+    FILE* file;
+    SampleFormat_t format;
+    int channels;
+    unsigned int sampleRate;
+    long numOfFrames;           /* number of frames in the file, -1 when unknown without reading it */
+    long fileSize;              /* size of regular file, -1 for pipes */
+    long dataBytesLeft;         /* bytes left in WAV data chunk, -1 when not limited */
+    void* buffer;               /* conversion buffer for binary formats, read buffer for text */
+    const char* text;           /* mapped text file or read buffer */
+    const char* textPos;        /* next character to parse */
+    const char* textEnd;        /* end of text available for parsing */
+    size_t mappedSize;          /* size of mapped text file, 0 when read through the buffer */
+    int textEof;                /* no more text to read into the buffer */
+    int async;                  /* binary samples of a regular file are read ahead through <io> */
+    AsyncFile_t io;
+    const unsigned char* ioData;    /* buffer acquired from <io>, NULL when none */
+    size_t ioLength;            /* bytes of whole samples in <ioData> */
+    size_t ioPos;               /* next byte to convert in <ioData> */
+    long ioPosition;            /* file offset of the next byte to convert */
+} SampleReader_t;
+
+typedef struct
+{
+    FILE* file;
+    SampleFormat_t format;
+    int channels;
+    unsigned int sampleRate;
+    long numOfFrames;           /* number of frames written */
+    long dataOffset;            /* file offset of the first frame, set by sampleIo_ReserveFrames */
+    void* buffer;               /* conversion buffer for binary formats, formatting buffer for text. With <async>
+                                 * the buffer acquired from <io>, NULL until the next bytes are written */
+    size_t bufferSize;          /* bytes of the buffer used for text or asynchronous writes */
+    size_t bufferLength;        /* formatted text or converted samples waiting in the buffer */
+    int async;                  /* regular files are written behind through <io> */
+    AsyncFile_t io;
+} SampleWriter_t;
+
+/**
+ * @brief Process argument <format>
+ * @param format    string with argument to process: text, f32, s16, wav, wavf32
+ * @return enumerated sample format
+ */
+SampleFormat_t sampleIo_processArgumentFormat(const char* format);
+
+/**
+ * @brief Guess sample format from the file name extension: .f32, .s16 (.pcm), .wav.
+ * Any other extension means text
+ * @param fileName  Name of the file
+ * @return enumerated sample format
+ */
+SampleFormat_t sampleIo_FormatFromFileName(const char* fileName);
+
+/**
+ * @brief Name of the sample format
+ * @param format    Sample format
+ * @return Format name as accepted by sampleIo_processArgumentFormat
+ */
+const char* sampleIo_FormatName(SampleFormat_t format);
+
+/**
+ * @brief Select how sample files are read and written from now on. Regular binary input and all
+ * regular output files go through asynchronous files unless ASYNC_FILE_BACKEND_STDIO is selected
+ * @param backend   ASYNC_FILE_BACKEND_AUTO by default
+ */
+void sampleIo_SetBackend(AsyncFileBackend_t backend);
+
+/**
+ * @brief Open file for reading samples. For WAV files the exact format, number of channels and
+ * sample rate are taken from the header. Pipes are not read ahead, regular binary files are read
+ * ahead in large asynchronous reads. Regular text files are memory-mapped and parsed without
+ * locale, as with "%f;" in C locale
+ * @param reader    Reader structure
+ * @param fileName  Name of the file with samples, SAMPLE_IO_STDIN for standard input
+ * @param format    Sample format. SAMPLE_FORMAT_UNKNOWN guesses it from the file name
+ * @param channels  Number of interleaved channels in raw and text files
+ * @return EXIT_SUCCESS when file opened succesfully. Otherwise, return EXIT_FAILURE
+ */
+int sampleIo_OpenReader(SampleReader_t* reader, const char* fileName, SampleFormat_t format, int channels);
+
+/**
+ * @brief Read interleaved frames
+ * @param reader    Reader structure
+ * @param samples   Buffer for <numOfFrames> * <channels> samples
+ * @param numOfFrames   Number of frames to read
+ * @return Number of frames read, less than requested at the end of file
+ */
+int sampleIo_Read(SampleReader_t* reader, float* samples, int numOfFrames);
+
+/**
+ * @brief Reading progress based on the byte offset in the file
+ * @param reader    Reader structure
+ * @return Progress in percent or -1 when file size is unknown
+ */
+int sampleIo_GetProgress(const SampleReader_t* reader);
+
+/**
+ * @brief Close reader
+ * @param reader    Reader structure
+ * @return EXIT_SUCCESS when closed succesfully. Otherwise, return EXIT_FAILURE
+ */
+int sampleIo_CloseReader(SampleReader_t* reader);
+
+/**
+ * @brief Create file for writing samples. Text files with more than one channel get the frame
+ * index as the first column
+ * @param writer        Writer structure
+ * @param fileName      Name of the file
+ * @param format        Sample format. SAMPLE_FORMAT_UNKNOWN guesses it from the file name
+ * @param channels      Number of interleaved channels
+ * @param sampleRate    Sample rate stored in WAV header
+ * @return EXIT_SUCCESS when file created succesfully. Otherwise, return EXIT_FAILURE
+ */
+int sampleIo_OpenWriter(SampleWriter_t* writer, const char* fileName, SampleFormat_t format,
+                        int channels, unsigned int sampleRate);
+
+/**
+ * @brief Write interleaved frames
+ * @param writer        Writer structure
+ * @param samples       Buffer with <numOfFrames> * <channels> samples
+ * @param numOfFrames   Number of frames to write
+ * @return EXIT_SUCCESS when written succesfully. Otherwise, return EXIT_FAILURE
+ */
+int sampleIo_Write(SampleWriter_t* writer, const float* samples, int numOfFrames);
+
+/**
+ * @brief Size the file of a binary writer for <numOfFrames> frames, to be filled by sampleIo_WriteFramesAt
+ * in any order and from any thread. Frames written before are kept and the reserved frames follow them
+ * @param writer        Writer structure of a binary format
+ * @param numOfFrames   Number of frames to reserve
+ * @return EXIT_SUCCESS when the file is sized. EXIT_FAILURE for text or on error
+ */
+int sampleIo_ReserveFrames(SampleWriter_t* writer, long numOfFrames);
+
+/**
+ * @brief Write frames at their position among reserved frames with pwrite. Calls with
+ * different frames may run at the same time
+ * @param writer        Writer structure after sampleIo_ReserveFrames
+ * @param samples       Buffer with <numOfFrames> * <channels> samples
+ * @param numOfFrames   Number of frames to write
+ * @param firstFrame    Index of the first frame among reserved frames
+ * @return EXIT_SUCCESS when written succesfully. Otherwise, return EXIT_FAILURE
+ */
+int sampleIo_WriteFramesAt(const SampleWriter_t* writer, const float* samples, int numOfFrames, long firstFrame);
+
+/**
+ * @brief Close writer. WAV header is completed with the final data size
+ * @param writer    Writer structure
+ * @return EXIT_SUCCESS when closed succesfully. Otherwise, return EXIT_FAILURE
+ */
+int sampleIo_CloseWriter(SampleWriter_t* writer);
+
+#endif  /* SAMPLE_IO_H */
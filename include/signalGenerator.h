@@ -9,12 +9,28 @@
 #ifndef SIGNAL_GENERATOR_H
 #define SIGNAL_GENERATOR_H
 
-#define SIGNAL_GEN_MAX_RESOLUTION   100000
+#include <stddef.h>
+#include <stdint.h>
+#include "sampleIo.h"
+
+#define SIGNAL_GEN_MAX_RESOLUTION       100000
+#define SIGNAL_GEN_DEFAULT_AMPLITUDE    1.0f
+#define SIGNAL_GEN_DEFAULT_SNR          20.0f       /* dB, sine-noise */
+#define SIGNAL_GEN_DEFAULT_SEED         1
+#define SIGNAL_GEN_NOISE_CREST_FACTOR   4.0f        /* noise RMS is <amplitude> / crest factor */
+#define SIGNAL_GEN_PINK_ROWS            16          /* octaves of pink noise below the sample rate */
 
 typedef enum
 {
     GEN_SIGNAL_UNKNOWN = 0,
     GEN_SIGNAL_SINE,
+    GEN_SIGNAL_SQUARE,
+    GEN_SIGNAL_SAWTOOTH,
+    GEN_SIGNAL_CHIRP,               /* linear frequency sweep from <resolution> to <endResolution> samples per cycle */
+    GEN_SIGNAL_WHITE,               /* white Gaussian noise */
+    GEN_SIGNAL_PINK,                /* Gaussian noise with 1/f spectrum */
+    GEN_SIGNAL_SINE_NOISE,          /* sine with white Gaussian noise at <snr> */
+    GEN_SIGNAL_COUNT
 } TypeOfGenSignal_t;
 
 typedef struct
@@ -22,11 +38,24 @@ typedef struct
     TypeOfGenSignal_t type;
     unsigned int cycles;
     unsigned int resolution;
+    SampleFormat_t format;          /* SAMPLE_FORMAT_UNKNOWN to guess from the file name */
+    float amplitude;                /* peak of periodic waveforms, <amplitude> / crest factor is the noise RMS */
+    float snr;                      /* sine to noise power ratio in dB */
+    unsigned int endResolution;     /* samples per cycle at the end of a chirp */
+    uint64_t seed;                  /* noise of the same seed is the same on every run */
+    int numOfThreads;               /* threads generating binary files, 0 for all CPUs */
 } SignalGenerator_t;
 
+/**
+ * @brief Default parameters: unknown type, amplitude 1, SNR 20 dB, chirp up to 4 samples per cycle, seed 1,
+ * all CPUs
+ * @param settings  Set of parameters of generated signal
+ */
+void signalGenerator_DefaultSettings(SignalGenerator_t* settings);
+
 /**
  * @brief Process argument <type>
- * @param[in] type  string with argument to process
+ * @param[in] type  string with argument to process: sine, square, sawtooth, chirp, white, pink, sine-noise
  * @return enumerated type of signal
  */
 TypeOfGenSignal_t signalGenerator_processArgumentType(const char* type);
@@ -46,11 +75,41 @@ unsigned int signalGenerator_processArgumentCycles(const char* cycles);
 unsigned int signalGenerator_processArgumentResolution(const char* resolution);
 
 /**
- * @brief Generate waveform based on given parameters
+ * @brief Number of samples in the signal, <cycles> * <resolution>
+ * @param settings  Set of parameters of generated signal
+ * @return Number of samples
+ */
+uint64_t signalGenerator_NumOfSamples(const SignalGenerator_t* settings);
+
+/**
+ * @brief Generate samples <first> to <first> + <numOfSamples> - 1 of the signal straight into a buffer.
+ * Any range can be generated on its own: oscillator phase is computed from the sample index and noise
+ * comes from a counter-based generator, so the result does not depend on how the signal is split
+ * @param settings      Set of parameters of generated signal, <format> is ignored
+ * @param samples       Buffer for <numOfSamples> samples
+ * @param first         Index of the first sample
+ * @param numOfSamples  Number of samples to generate
+ * @return EXIT_SUCCESS when waveform generated
+ */
+int signalGenerator_generateBlock(const SignalGenerator_t* settings, float* samples, uint64_t first,
+                                  size_t numOfSamples);
+
+/**
+ * @brief Generate waveform into a buffer, e.g. synthetic input kept in memory
+ * @param settings      Set of parameters of generated signal, <format> is ignored
+ * @param samples       Buffer for <numOfSamples> samples
+ * @param numOfSamples  Number of samples to generate, periodic waveforms repeat every <resolution> samples
+ * @return EXIT_SUCCESS when waveform generated
+ */
+int signalGenerator_generateSamples(const SignalGenerator_t *settings, float* samples, size_t numOfSamples);
+
+/**
+ * @brief Generate waveform based on given parameters. Binary files are split into chunks generated
+ * on <numOfThreads> threads and written in place, the file is the same for any number of threads
  * @param settings          Set of parameters of generated signal
  * @param outputFileName    The name of the file to save samples to
  * @return EXIT_SUCCESS when waveform generated and saved to the file
  */
 int signalGenerator_generateSignal(const SignalGenerator_t *settings, const char* outputFileName);
 
-#endif  /* SIGNAL_GENERATOR_H */
\ No newline at end of file
+#endif  /* SIGNAL_GENERATOR_H */
@@ -0,0 +1,75 @@
+/**
+ * @file spscRing.h
+ * @author shed258
+ * @brief Lock-free single-producer single-consumer ring of fixed-size slots header
+ * @version 1.0.0
+ *
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stddef.h>
+
+#define SPSC_RING_CACHE_LINE    64
+
+/* Slots are filled and read in place. One thread produces and one thread consumes, the indices
+ * are the only shared state. A full ring blocks the producer, which gives backpressure */
+typedef struct
+{
+    unsigned char* slots;
+    size_t slotSize;
+    unsigned int capacity;          /* number of slots, power of two */
+    unsigned int head __attribute__((aligned(SPSC_RING_CACHE_LINE)));  /* next slot to write, producer only */
+    int closed;                     /* producer will not write any more slots */
+    unsigned int tail __attribute__((aligned(SPSC_RING_CACHE_LINE)));  /* next slot to read, consumer only */
+} SpscRing_t;
+
+/**
+ * @brief Allocate the ring
+ * @param ring          Ring structure
+ * @param capacity      Number of slots, rounded up to a power of two
+ * @param slotSize      Size of one slot in bytes
+ * @return EXIT_SUCCESS when allocated succesfully. Otherwise, return EXIT_FAILURE
+ */
+int spscRing_Init(SpscRing_t* ring, unsigned int capacity, size_t slotSize);
+
+/**
+ * @brief Release the ring. Both threads must be done with it
+ * @param ring  Ring structure
+ */
+void spscRing_Free(SpscRing_t* ring);
+
+/**
+ * @brief Producer: wait for a free slot
+ * @param ring  Ring structure
+ * @return Slot to fill, published with spscRing_CommitWrite
+ */
+void* spscRing_AcquireWrite(SpscRing_t* ring);
+
+/**
+ * @brief Producer: publish the slot returned by spscRing_AcquireWrite
+ * @param ring  Ring structure
+ */
+void spscRing_CommitWrite(SpscRing_t* ring);
+
+/**
+ * @brief Producer: no more slots will be written. The consumer reads the rest and then gets NULL
+ * @param ring  Ring structure
+ */
+void spscRing_Close(SpscRing_t* ring);
+
+/**
+ * @brief Consumer: wait for a filled slot
+ * @param ring  Ring structure
+ * @return Slot to read, given back with spscRing_ReleaseRead. NULL when the ring is closed and empty
+ */
+void* spscRing_AcquireRead(SpscRing_t* ring);
+
+/**
+ * @brief Consumer: give back the slot returned by spscRing_AcquireRead
+ * @param ring  Ring structure
+ */
+void spscRing_ReleaseRead(SpscRing_t* ring);
+
+#endif  /* SPSC_RING_H */
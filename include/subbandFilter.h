@@ -0,0 +1,119 @@
+/**
+ * @file subbandFilter.h
+ * @author shed258
+ * @brief Subband adaptive filter header. Input and desired signals are split by an oversampled DFT
+ * polyphase filterbank into K bands decimated by K / 2, every band runs a short complex NLMS filter
+ * and the output is resynthesized. Per-sample cost falls with the decimation and every band
+ * converges on its own power, which suits long echo paths
+ * @version 1.0.0
+ *
+ */
+
+#ifndef SUBBAND_FILTER_H
+#define SUBBAND_FILTER_H
+
+#include "fft.h"
+#include "threadPool.h"
+
+#define SUBBAND_FILTER_DEFAULT_BANDS    32
+#define SUBBAND_FILTER_MIN_BANDS        4
+#define SUBBAND_FILTER_MAX_BANDS        1024
+#define SUBBAND_FILTER_MAX_FRAMES       64      /* frames analysed before the bands adapt */
+#define SUBBAND_FILTER_PROTOTYPE_FACTOR 8       /* prototype taps per band, also the delay of the bank in samples per band */
+
+typedef struct
+{
+    float step;                 /* normalized NLMS step of every band, 0 < step < 2 */
+    int length;                 /* fullband filter length */
+    int numOfBands;             /* K, power of two */
+    int decimation;             /* D = K / 2 */
+    int numOfBins;              /* K / 2 + 1 adapted bands, the others mirror them */
+    int subbandLength;          /* taps of every band filter */
+    int prototypeLength;        /* taps of the analysis and synthesis prototypes, 8 K + 1 */
+    int delay;                  /* output n estimates desired n - delay */
+    Fft_t fft;                  /* real FFT of K samples */
+    float* analysisWindow;      /* [prototypeLength] lowpass with cutoff at half the band spacing */
+    float* synthesisWindow;     /* [prototypeLength] lowpass passing a whole band, rejects images */
+    float* inputHistory;        /* [2 * prototypeLength] mirrored, as the delay line of LmsFilter_t */
+    float* desiredHistory;      /* [2 * prototypeLength] mirrored */
+    int historyIndex;
+    float* referenceLine;       /* [length] input samples, reference without desired signal */
+    int referenceIndex;
+    float* desiredDelay;        /* [delay] desired samples aligned with the output for the error */
+    int desiredDelayIndex;
+    float* overlap;             /* [prototypeLength] overlap-add of synthesized frames */
+    float* ready;               /* [D] output samples of the last frame */
+    int readyIndex;
+    int hop;                    /* samples since the last frame */
+    float* weightsRe;           /* [numOfBins][subbandLength] complex band coefficients, split */
+    float* weightsIm;
+    float* windowRe;            /* [numOfBins][2 * subbandLength] mirrored band input histories */
+    float* windowIm;
+    int windowIndex;            /* position of the oldest band sample, the same in every band */
+    double* bandPower;          /* [numOfBins] power of every band window */
+    float* frameInput;          /* [SUBBAND_FILTER_MAX_FRAMES][2 * numOfBins] band input of a block */
+    float* frameDesired;        /* [SUBBAND_FILTER_MAX_FRAMES][2 * numOfBins] band desired, then band output */
+    int* framePosition;         /* [SUBBAND_FILTER_MAX_FRAMES] sample of every frame in the block */
+    float* delayedDesired;      /* [SUBBAND_FILTER_MAX_FRAMES * D] desired aligned with the block output */
+    float* fold;                /* [K] polyphase sum of a window */
+    float* spectrum;            /* [2 * numOfBins] scratch of the analysis and synthesis */
+    ThreadPool_t* pool;         /* bands adapt in parallel when set */
+    void* memory;
+} SubbandFilter_t;
+
+/**
+ * @brief Initialize the filter and design the filterbank. Weights and histories are cleared
+ * @param filter        Subband filter structure
+ * @param step          Normalized step size of the band filters
+ * @param length        Fullband filter length, every band gets <length> / D taps and a margin
+ *                      for the filterbank response
+ * @param numOfBands    Number of bands K, power of two from SUBBAND_FILTER_MIN_BANDS to
+ *                      SUBBAND_FILTER_MAX_BANDS, 0 for SUBBAND_FILTER_DEFAULT_BANDS
+ * @return EXIT_SUCCESS when filter initialised succesfully. Otherwise, return EXIT_FAILURE
+ */
+int subbandFilter_Init(SubbandFilter_t* filter, float step, int length, int numOfBands);
+
+/**
+ * @brief Release memory of the filter. The thread pool is left to its owner
+ * @param filter    Subband filter structure
+ */
+void subbandFilter_Free(SubbandFilter_t* filter);
+
+/**
+ * @brief Adapt bands of every block on a thread pool, NULL to adapt them on the calling thread.
+ * The result is the same either way
+ * @param filter    Subband filter structure
+ * @param pool      Started thread pool used by this filter only while it filters
+ */
+void subbandFilter_SetThreadPool(SubbandFilter_t* filter, ThreadPool_t* pool);
+
+/**
+ * @brief Push an input sample into the filterbank history without filtering
+ * @param filter    Subband filter structure
+ * @param sample    New input sample
+ */
+void subbandFilter_PushSample(SubbandFilter_t* filter, float sample);
+
+/**
+ * @brief Filter a block of samples, same interface as lmsFilter_ProcessBlock. The filterbank
+ * delays the signal: output n estimates desired n - <delay> and the error is taken against
+ * that delayed desired sample
+ * @param filter        Subband filter structure
+ * @param input         Input samples
+ * @param desired       Desired samples or NULL to use the oldest sample in the window of <length>
+ * @param output        Filter output or NULL
+ * @param error         Error signal or NULL
+ * @param numOfSamples  Number of samples
+ * @return EXIT_SUCCESS when filter stays stable. Otherwise, return EXIT_FAILURE
+ */
+int subbandFilter_ProcessBlock(SubbandFilter_t* filter, const float* input, const float* desired,
+                               float* output, float* error, int numOfSamples);
+
+/**
+ * @brief Sum of squares of the band coefficients, mirrored bands included
+ * @param filter    Subband filter structure
+ * @return Squared coefficient norm
+ */
+double subbandFilter_NormSquared(const SubbandFilter_t* filter);
+
+#endif  /* SUBBAND_FILTER_H */
@@ -0,0 +1,82 @@
+/**
+ * @file threadPool.h
+ * @author shed258
+ * @brief Fixed-size work-stealing thread pool header
+ * @version 1.0.0
+ *
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <pthread.h>
+
+typedef void (*ThreadPoolTask_t)(void* argument);
+
+typedef struct
+{
+    ThreadPoolTask_t task;
+    void* argument;
+} ThreadPoolJob_t;
+
+/* Per-worker deque. The owner takes the newest job, other workers steal the oldest one */
+typedef struct
+{
+    pthread_mutex_t lock;
+    ThreadPoolJob_t* jobs;
+    int capacity;
+    int head;               /* oldest job, stolen by other workers */
+    int count;
+} ThreadPoolQueue_t;
+
+typedef struct
+{
+    pthread_t* threads;
+    ThreadPoolQueue_t* queues;
+    int numOfThreads;       /* running worker threads */
+    int numOfQueues;
+    pthread_mutex_t lock;
+    pthread_cond_t workAvailable;
+    pthread_cond_t allDone;
+    int queued;             /* jobs waiting in queues and not yet claimed by a worker */
+    int pending;            /* jobs submitted and not finished */
+    int nextQueue;          /* round robin queue for jobs submitted outside of the pool */
+    int shutdown;
+} ThreadPool_t;
+
+/**
+ * @brief Start worker threads
+ * @param pool          Thread pool structure
+ * @param numOfThreads  Number of worker threads, 0 for the number of online CPUs
+ * @return EXIT_SUCCESS when all threads started. Otherwise, return EXIT_FAILURE
+ */
+int threadPool_Init(ThreadPool_t* pool, int numOfThreads);
+
+/**
+ * @brief Queue a job. Jobs submitted from a worker go to its own queue, others are spread round robin
+ * @param pool      Thread pool structure
+ * @param task      Function to run
+ * @param argument  Argument passed to the function
+ * @return EXIT_SUCCESS when queued. Otherwise, return EXIT_FAILURE
+ */
+int threadPool_Submit(ThreadPool_t* pool, ThreadPoolTask_t task, void* argument);
+
+/**
+ * @brief Wait until all submitted jobs are finished
+ * @param pool  Thread pool structure
+ */
+void threadPool_Wait(ThreadPool_t* pool);
+
+/**
+ * @brief Finish queued jobs, stop worker threads and release resources
+ * @param pool  Thread pool structure
+ */
+void threadPool_Destroy(ThreadPool_t* pool);
+
+/**
+ * @brief Number of online CPUs
+ * @return Number of CPUs, at least 1
+ */
+int threadPool_NumberOfCpus(void);
+
+#endif  /* THREAD_POOL_H */
@@ -0,0 +1,106 @@
+#!/bin/sh
+#
+# Byte-for-byte checks of the outputs that must not depend on how the work is split:
+#   - a channel of an interleaved file, and a file of a batch, match the single-threaded run of
+#     that signal alone, for any number of threads
+#   - generated binary files are identical for any number of threads
+#   - a run resumed from a checkpoint continues the output of the uninterrupted run bit-exactly
+#
+# Usage: scripts/check.sh <lms program> <work directory>
+# Every comparison is done with cmp, the exit status is 1 when any check failed
+
+if [ $# -ne 2 ]; then
+    echo "Usage: $0 <lms program> <work directory>"
+    exit 2
+fi
+
+LMS=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+WORK=$2
+LOG=check.log
+FAILED=0
+PASSED=0
+
+rm -rf "$WORK"
+mkdir -p "$WORK"
+# The generator takes plain file names, so everything runs inside the work directory
+cd "$WORK" || exit 2
+
+# Run the program with its output in the log, a failing run fails the check that uses it
+run()
+{
+    echo "$LMS $*" >> $LOG
+    "$LMS" "$@" >> $LOG 2>&1
+}
+
+# check <name> <file> <reference>
+check()
+{
+    if cmp "$2" "$3"; then
+        PASSED=$((PASSED + 1))
+        echo "PASS: $1"
+    else
+        FAILED=$((FAILED + 1))
+        echo "FAIL: $1"
+    fi
+}
+
+fail()
+{
+    FAILED=$((FAILED + 1))
+    echo "FAIL: $1, see $WORK/$LOG"
+}
+
+# Interleaved channels: every channel against the same signal filtered alone on one thread.
+# Both signals have 192000 samples
+run --generate sine 100 1920 a.txt || fail "generate a.txt"
+run --generate square 64 3000 b.txt || fail "generate b.txt"
+paste -d ' ' a.txt b.txt > ab.txt
+run --filter 16 0.01 a.txt --output-format f32 --output a.f32 --no-pipeline || fail "filter a.txt"
+run --filter 16 0.01 b.txt --output-format f32 --output b.f32 --no-pipeline || fail "filter b.txt"
+for threads in 1 3; do
+    run --filter 16 0.01 ab.txt --channels 2 --output-format f32 --output ab$threads.f32 --threads $threads || fail "filter ab.txt"
+    check "channel 0 of 2, $threads threads" ab$threads.f32.0 a.f32
+    check "channel 1 of 2, $threads threads" ab$threads.f32.1 b.f32
+done
+
+# Batch: every file against its own single-threaded run
+run --generate white 100 5000 batch1.s16 --seed 3 || fail "generate batch1.s16"
+run --generate chirp 200 1000 batch2.s16 || fail "generate batch2.s16"
+run --generate pink 100 3000 batch3.s16 || fail "generate batch3.s16"
+for file in 1 2 3; do
+    run --filter 32 0.001 batch$file.s16 --output single$file.s16 --no-pipeline || fail "filter batch$file.s16"
+done
+for threads in 1 3; do
+    run --filter 32 0.001 'batch*.s16' --threads $threads || fail "filter batch, $threads threads"
+    for file in 1 2 3; do
+        check "batch file $file, $threads threads" batch$file.s16filtered single$file.s16
+        rm -f batch$file.s16filtered
+    done
+done
+
+# Generator: 3000000 samples are several chunks, so 4 threads write them out of order
+for type in sine-noise pink chirp; do
+    for format in f32 s16 wav; do
+        run --generate $type 100 30000 gen1.$format --threads 1 || fail "generate $type $format"
+        run --generate $type 100 30000 gen4.$format --threads 4 || fail "generate $type $format"
+        check "generate $type $format, 1 and 4 threads" gen4.$format gen1.$format
+        rm -f gen1.$format gen4.$format
+    done
+done
+
+# Resume: the checkpoint of the first half continues to the output of the whole file. The last
+# <length> - 1 frames of the first run are filtered again by the resumed run, so they are dropped
+run --generate sine-noise 100 2000 resume.f32 || fail "generate resume.f32"
+head -c 400000 resume.f32 > half.f32
+for options in "--variant lms" "--variant nlms" "--variant leaky" "--variant leaky --no-pipeline"; do
+    run --filter 16 0.01 resume.f32 $options --output full.out.f32 || fail "filter resume.f32 $options"
+    run --filter 16 0.01 half.f32 $options --output half.out.f32 --checkpoint half.lmsc || fail "filter half.f32 $options"
+    run --filter 16 0.01 resume.f32 $options --output resumed.out.f32 --resume half.lmsc || fail "resume $options"
+    # f32 output frames are input, output and error, 12 bytes
+    head -c $(($(wc -c < half.out.f32) - 15 * 12)) half.out.f32 > joined.out.f32
+    cat resumed.out.f32 >> joined.out.f32
+    check "resume $options" joined.out.f32 full.out.f32
+done
+
+echo "$PASSED passed, $FAILED failed"
+[ $FAILED -eq 0 ]
@@ -0,0 +1,257 @@
+/**
+ * @file apaFilter.c
+ * @author shed258
+ * @brief Affine projection filter source file
+ * @version 1.0.0
+ *
+ * X holds the last P input vectors x(n), x(n-1) .. x(n-P+1) of L samples each, d the matching desired samples:
+ *   e = d - X' w,  (X' X + delta I) a = e,  w += step X a
+ * Gram entries X' X (i, j) = c(|i - j|) at time n - min(i, j), where c(j) is the product of the newest
+ * vector with the one j samples older. A new sample changes every c(j) by one product in and one out,
+ * and the older entries of the matrix move one row and column down, so the matrix costs O(P^2)
+ * copies and O(P) products per sample instead of O(P^2 L). The c(j) are computed exactly once per
+ * L + P samples, so their rounding does not drift. Errors and the update take 2 P L.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "lmsAllocator.h"
+#include "apaFilter.h"
+
+#define APA_FILTER_REGULARIZATION       1e-4    /* delta relative to the power of the newest input vector */
+#define APA_FILTER_MIN_REGULARIZATION   1e-6    /* delta per tap for silent input */
+
+/**
+ * @brief Store an input sample, update the correlations and slide the Gram matrix
+ * @return Newest input vector, older vectors follow one sample apart
+ */
+static const float* apaFilter_Push(ApaFilter_t* filter, float sample)
+{
+    const int order = filter->order;
+    double* gram = filter->gram;
+
+    if (--filter->historyIndex < 0)
+    {
+        filter->historyIndex = filter->historyLength - 1;
+    }
+    filter->history[filter->historyIndex] = sample;
+    filter->history[filter->historyIndex + filter->historyLength] = sample;
+
+    /* Sample n enters every product, sample n - L leaves it. Rounding of the running sums would build up,
+     * so they are summed again from the window whenever the history wraps, every L + P samples */
+    const float* x = &filter->history[filter->historyIndex];
+    const float* leaving = &x[filter->length];
+    if (filter->historyIndex == 0)
+    {
+        for (int j = 0; j < order; j++)
+        {
+            double sum = 0.0;
+
+            for (int k = 0; k < filter->length; k++)
+            {
+                sum += (double)x[k] * x[k + j];
+            }
+            filter->correlation[j] = sum;
+        }
+    }
+    else
+    {
+        for (int j = 0; j < order; j++)
+        {
+            filter->correlation[j] += (double)x[0] * x[j] - (double)leaving[0] * leaving[j];
+        }
+    }
+
+    for (int i = order - 1; i > 0; i--)
+    {
+        for (int j = order - 1; j > 0; j--)
+        {
+            gram[i * order + j] = gram[(i - 1) * order + (j - 1)];
+        }
+    }
+    for (int j = 0; j < order; j++)
+    {
+        gram[j] = filter->correlation[j];
+        gram[j * order] = filter->correlation[j];
+    }
+    return x;
+}
+
+/**
+ * @brief Solve (G + delta I) a = e for the leading <rows> x <rows> block of the Gram matrix by
+ * Cholesky factorization, <solution> holds e on entry and a on return
+ */
+static void apaFilter_Solve(ApaFilter_t* filter, int rows)
+{
+    const int order = filter->order;
+    const double delta = APA_FILTER_REGULARIZATION * filter->gram[0] + APA_FILTER_MIN_REGULARIZATION * filter->length;
+    double* factor = filter->factor;
+    double* a = filter->solution;
+
+    for (int i = 0; i < rows; i++)
+    {
+        for (int j = 0; j <= i; j++)
+        {
+            double sum = filter->gram[i * order + j] + ((i == j) ? delta : 0.0);
+
+            for (int k = 0; k < j; k++)
+            {
+                sum -= factor[i * order + k] * factor[j * order + k];
+            }
+            if (i == j)
+            {
+                /* Rounding can leave a dependent vector slightly negative, delta keeps it positive */
+                factor[i * order + i] = sqrt((sum > delta) ? sum : delta);
+            }
+            else
+            {
+                factor[i * order + j] = sum / factor[j * order + j];
+            }
+        }
+    }
+    for (int i = 0; i < rows; i++)
+    {
+        for (int k = 0; k < i; k++)
+        {
+            a[i] -= factor[i * order + k] * a[k];
+        }
+        a[i] /= factor[i * order + i];
+    }
+    for (int i = rows - 1; i >= 0; i--)
+    {
+        for (int k = i + 1; k < rows; k++)
+        {
+            a[i] -= factor[k * order + i] * a[k];
+        }
+        a[i] /= factor[i * order + i];
+    }
+}
+
+int apaFilter_Init(ApaFilter_t* filter, float step, int length, int order)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    memset(filter, 0, sizeof(*filter));
+    if (order == 0)
+    {
+        order = APA_FILTER_DEFAULT_ORDER;
+    }
+    if ((length < 1) || (order < 1) || (order > APA_FILTER_MAX_ORDER) || !(step > 0.0f) || !(step < 2.0f))
+    {
+        printf("Wrong APA filter length %d, order %d or step size %g\n", length, order, step);
+        return EXIT_FAILURE;
+    }
+    filter->step = step;
+    filter->length = length;
+    filter->order = order;
+    filter->historyLength = length + order;
+    filter->kernel = lmsKernel_GetBest();
+
+    const size_t coefficientBytes = lmsAllocator_AlignedSize((size_t)length * sizeof(float));
+    const size_t historyBytes = lmsAllocator_AlignedSize(2 * (size_t)filter->historyLength * sizeof(float));
+    const size_t desiredBytes = lmsAllocator_AlignedSize(2 * (size_t)order * sizeof(float));
+    const size_t vectorBytes = lmsAllocator_AlignedSize((size_t)order * sizeof(double));
+    const size_t matrixBytes = lmsAllocator_AlignedSize((size_t)order * order * sizeof(double));
+    const size_t totalBytes = coefficientBytes + historyBytes + desiredBytes + 2 * vectorBytes + 2 * matrixBytes;
+
+    filter->memory = heap->allocate(heap->context, totalBytes, LMS_ALLOCATOR_ALIGNMENT);
+    if (filter->memory == NULL)
+    {
+        printf("Error allocating APA filter of length %d\n", length);
+        return EXIT_FAILURE;
+    }
+    memset(filter->memory, 0, totalBytes);
+
+    unsigned char* next = (unsigned char*)filter->memory;
+    filter->coefficients = (float*)next;
+    next += coefficientBytes;
+    filter->history = (float*)next;
+    next += historyBytes;
+    filter->desired = (float*)next;
+    next += desiredBytes;
+    filter->correlation = (double*)next;
+    next += vectorBytes;
+    filter->solution = (double*)next;
+    next += vectorBytes;
+    filter->gram = (double*)next;
+    next += matrixBytes;
+    filter->factor = (double*)next;
+
+    return EXIT_SUCCESS;
+}
+
+void apaFilter_Free(ApaFilter_t* filter)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    heap->release(heap->context, filter->memory);
+    filter->memory = NULL;
+}
+
+void apaFilter_PushSample(ApaFilter_t* filter, float sample)
+{
+    apaFilter_Push(filter, sample);
+    filter->validRows = 0;
+}
+
+int apaFilter_ProcessBlock(ApaFilter_t* filter, const float* input, const float* desired,
+                           float* output, float* error, int numOfSamples)
+{
+    const int length = filter->length;
+    const int order = filter->order;
+    float y = 0.0f;
+
+    for (int i = 0; i < numOfSamples; i++)
+    {
+        const float* x = apaFilter_Push(filter, input[i]);
+        const float d = (desired != NULL) ? desired[i] : x[length - 1];
+
+        if (--filter->desiredIndex < 0)
+        {
+            filter->desiredIndex = order - 1;
+        }
+        filter->desired[filter->desiredIndex] = d;
+        filter->desired[filter->desiredIndex + order] = d;
+        if (filter->validRows < order)
+        {
+            filter->validRows++;
+        }
+
+        /* Errors of the vectors with a known desired sample, the newest one is the output */
+        const float* dHistory = &filter->desired[filter->desiredIndex];
+        const int rows = filter->validRows;
+        for (int k = 0; k < rows; k++)
+        {
+            filter->solution[k] = dHistory[k] - filter->kernel->dot(filter->coefficients, &x[k], length);
+        }
+        y = d - (float)filter->solution[0];
+        if (output != NULL)
+        {
+            output[i] = y;
+        }
+        if (error != NULL)
+        {
+            error[i] = (float)filter->solution[0];
+        }
+
+        apaFilter_Solve(filter, rows);
+        for (int k = 0; k < rows; k++)
+        {
+            filter->kernel->update(filter->coefficients, &x[k], (float)(filter->step * filter->solution[k]), length);
+        }
+    }
+    return (isfinite(y) == 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+double apaFilter_NormSquared(const ApaFilter_t* filter)
+{
+    double sum = 0.0;
+
+    for (int k = 0; k < filter->length; k++)
+    {
+        sum += (double)filter->coefficients[k] * filter->coefficients[k];
+    }
+    return sum;
+}
@@ -0,0 +1,652 @@
+/**
+ * @file asyncFile.c
+ * @author shed258
+ * @brief Asynchronous sequential file reader and writer source file
+ * @version 1.0.0
+ *
+ * io_uring is used through its system calls, the rings are mapped from the io_uring descriptor.
+ * The buffers are registered with the kernel once, so transfers use READ_FIXED and WRITE_FIXED
+ * without mapping the pages of every request. When the buffers can not be registered, e.g. over
+ * the locked memory limit, the plain READ and WRITE opcodes are used on the same buffers.
+ * Without io_uring, a thread of the file runs the queued transfers in order with pread/pwrite.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#include "lmsAllocator.h"
+#include "asyncFile.h"
+
+#define ASYNC_FILE_ALIGNMENT    4096    /* buffers start on a page, registered pages are pinned whole */
+#define ASYNC_FILE_CANCEL       ASYNC_FILE_DEPTH    /* user data of cancel requests, past every buffer index */
+
+static const struct
+{
+    const char* name;
+    AsyncFileBackend_t backend;
+} asyncFileBackendNames[] =
+{
+    { "auto",   ASYNC_FILE_BACKEND_AUTO },
+    { "uring",  ASYNC_FILE_BACKEND_URING },
+    { "thread", ASYNC_FILE_BACKEND_THREAD },
+    { "stdio",  ASYNC_FILE_BACKEND_STDIO },
+};
+
+/**
+ * @brief Run a whole transfer with pread/pwrite, continuing after short transfers
+ * @return Bytes transferred, less than <size> only at the end of the file, or -errno
+ */
+static ssize_t asyncFile_Transfer(int fd, AsyncFileMode_t mode, unsigned char* data, size_t size, off_t offset)
+{
+    size_t done = 0;
+
+    while (done < size)
+    {
+        ssize_t got = (mode == ASYNC_FILE_READ) ? pread(fd, &data[done], size - done, offset + (off_t)done)
+                                                : pwrite(fd, &data[done], size - done, offset + (off_t)done);
+        if (got < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -errno;
+        }
+        if (got == 0)
+        {
+            break;
+        }
+        done += (size_t)got;
+    }
+    return (ssize_t)done;
+}
+
+/**
+ * @brief Unmap the rings and close the io_uring descriptor, also after a partial setup
+ */
+static void asyncFile_RingFree(AsyncFileRing_t* ring)
+{
+    if (ring->sqes != NULL)
+    {
+        munmap(ring->sqes, ring->sqesSize);
+    }
+    if ((ring->cqRing != NULL) && (ring->cqRing != ring->sqRing))
+    {
+        munmap(ring->cqRing, ring->cqRingSize);
+    }
+    if (ring->sqRing != NULL)
+    {
+        munmap(ring->sqRing, ring->sqRingSize);
+    }
+    if (ring->fd >= 0)
+    {
+        close(ring->fd);
+    }
+    memset(ring, 0, sizeof(*ring));
+    ring->fd = -1;
+}
+
+/**
+ * @brief Map a part of the io_uring descriptor
+ * @return Mapping or NULL
+ */
+static void* asyncFile_RingMap(int fd, size_t size, off_t part)
+{
+    void* mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, part);
+
+    return (mapped != MAP_FAILED) ? mapped : NULL;
+}
+
+/**
+ * @brief Create the io_uring of the file and register its buffers
+ * @return EXIT_SUCCESS when the ring is ready. Otherwise, return EXIT_FAILURE with errno set
+ */
+static int asyncFile_RingSetup(AsyncFile_t* file)
+{
+    AsyncFileRing_t* ring = &file->ring;
+    struct io_uring_params params;
+    struct iovec iovecs[ASYNC_FILE_DEPTH];
+
+    memset(&params, 0, sizeof(params));
+    ring->fd = (int)syscall(__NR_io_uring_setup, ASYNC_FILE_DEPTH, &params);
+    if (ring->fd < 0)
+    {
+        ring->fd = -1;
+        return EXIT_FAILURE;
+    }
+
+    ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (ring->cqRingSize > ring->sqRingSize)
+        {
+            ring->sqRingSize = ring->cqRingSize;
+        }
+        ring->cqRingSize = ring->sqRingSize;
+    }
+    ring->sqRing = asyncFile_RingMap(ring->fd, ring->sqRingSize, IORING_OFF_SQ_RING);
+    if (ring->sqRing != NULL)
+    {
+        ring->cqRing = (params.features & IORING_FEAT_SINGLE_MMAP) ?
+                       ring->sqRing : asyncFile_RingMap(ring->fd, ring->cqRingSize, IORING_OFF_CQ_RING);
+    }
+    if (ring->cqRing != NULL)
+    {
+        ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+        ring->sqes = asyncFile_RingMap(ring->fd, ring->sqesSize, IORING_OFF_SQES);
+    }
+    if (ring->sqes == NULL)
+    {
+        int error = errno;
+        asyncFile_RingFree(ring);
+        errno = error;
+        return EXIT_FAILURE;
+    }
+
+    unsigned char* sq = (unsigned char*)ring->sqRing;
+    unsigned char* cq = (unsigned char*)ring->cqRing;
+    ring->sqTail = (unsigned int*)(sq + params.sq_off.tail);
+    ring->sqMask = (unsigned int*)(sq + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned int*)(sq + params.sq_off.array);
+    ring->cqHead = (unsigned int*)(cq + params.cq_off.head);
+    ring->cqTail = (unsigned int*)(cq + params.cq_off.tail);
+    ring->cqMask = (unsigned int*)(cq + params.cq_off.ring_mask);
+    ring->cqes = cq + params.cq_off.cqes;
+
+    for (int i = 0; i < ASYNC_FILE_DEPTH; i++)
+    {
+        iovecs[i].iov_base = file->buffers[i].data;
+        iovecs[i].iov_len = ASYNC_FILE_BUFFER_SIZE;
+    }
+    ring->registered = (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS, iovecs, ASYNC_FILE_DEPTH) == 0);
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Put the transfer of a buffer on the submission queue and submit it
+ */
+static void asyncFile_RingSubmit(AsyncFile_t* file, int index)
+{
+    AsyncFileRing_t* ring = &file->ring;
+    AsyncFileBuffer_t* buffer = &file->buffers[index];
+    const unsigned int tail = *ring->sqTail;
+    const unsigned int slot = tail & *ring->sqMask;
+    struct io_uring_sqe* sqe = &((struct io_uring_sqe*)ring->sqes)[slot];
+
+    memset(sqe, 0, sizeof(*sqe));
+    if (file->mode == ASYNC_FILE_READ)
+    {
+        sqe->opcode = ring->registered ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    }
+    else
+    {
+        sqe->opcode = ring->registered ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+    }
+    sqe->fd = file->fd;
+    sqe->addr = (uint64_t)(uintptr_t)buffer->data;
+    sqe->len = (uint32_t)buffer->size;
+    sqe->off = (uint64_t)buffer->offset;
+    sqe->buf_index = (uint16_t)index;
+    sqe->user_data = (uint64_t)index;
+    ring->sqArray[slot] = slot;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+
+    while (syscall(__NR_io_uring_enter, ring->fd, 1, 0, 0, NULL, 0) < 0)
+    {
+        if (errno != EINTR)
+        {
+            /* The entry was not consumed, take it back and fail the transfer */
+            __atomic_store_n(ring->sqTail, tail, __ATOMIC_RELEASE);
+            buffer->result = -errno;
+            buffer->state = ASYNC_FILE_BUFFER_DONE;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Mark the buffers of all completions posted so far as done
+ */
+static void asyncFile_RingReap(AsyncFile_t* file)
+{
+    AsyncFileRing_t* ring = &file->ring;
+    const struct io_uring_cqe* cqes = (const struct io_uring_cqe*)ring->cqes;
+    unsigned int head = *ring->cqHead;
+    const unsigned int tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+
+    for (; head != tail; head++)
+    {
+        const struct io_uring_cqe* cqe = &cqes[head & *ring->cqMask];
+        if (cqe->user_data < ASYNC_FILE_CANCEL)
+        {
+            AsyncFileBuffer_t* buffer = &file->buffers[cqe->user_data];
+            buffer->result = cqe->res;
+            buffer->state = ASYNC_FILE_BUFFER_DONE;
+        }
+    }
+    __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Wait until the kernel has given back every buffer. When waiting fails, the transfers still
+ * in flight are cancelled and waited for once more
+ * @return EXIT_SUCCESS when no buffer is left with the kernel. Otherwise, return EXIT_FAILURE
+ */
+static int asyncFile_RingDrain(AsyncFile_t* file)
+{
+    AsyncFileRing_t* ring = &file->ring;
+    int cancelled = 0;
+
+    for (;;)
+    {
+        unsigned int numOfQueued = 0;
+
+        asyncFile_RingReap(file);
+        for (int i = 0; i < ASYNC_FILE_DEPTH; i++)
+        {
+            numOfQueued += (file->buffers[i].state == ASYNC_FILE_BUFFER_QUEUED);
+        }
+        if (numOfQueued == 0)
+        {
+            return EXIT_SUCCESS;
+        }
+        if ((syscall(__NR_io_uring_enter, ring->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) >= 0) || (errno == EINTR))
+        {
+            continue;
+        }
+        if (cancelled)
+        {
+            return EXIT_FAILURE;
+        }
+
+        /* The completion queue holds twice the entries of the submission queue, room for both completions */
+        unsigned int tail = *ring->sqTail;
+        for (int i = 0; i < ASYNC_FILE_DEPTH; i++)
+        {
+            if (file->buffers[i].state == ASYNC_FILE_BUFFER_QUEUED)
+            {
+                const unsigned int slot = tail++ & *ring->sqMask;
+                struct io_uring_sqe* sqe = &((struct io_uring_sqe*)ring->sqes)[slot];
+
+                memset(sqe, 0, sizeof(*sqe));
+                sqe->opcode = IORING_OP_ASYNC_CANCEL;
+                sqe->addr = (uint64_t)i;
+                sqe->user_data = ASYNC_FILE_CANCEL;
+                ring->sqArray[slot] = slot;
+            }
+        }
+        __atomic_store_n(ring->sqTail, tail, __ATOMIC_RELEASE);
+        while (syscall(__NR_io_uring_enter, ring->fd, numOfQueued, 0, 0, NULL, 0) < 0)
+        {
+            if (errno != EINTR)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        cancelled = 1;
+    }
+}
+
+/**
+ * @brief I/O thread of the file: run queued transfers in submission order
+ * @param argument  Pointer to AsyncFile_t
+ */
+static void* asyncFile_Thread(void* argument)
+{
+    AsyncFile_t* file = (AsyncFile_t*)argument;
+
+    pthread_mutex_lock(&file->lock);
+    for (;;)
+    {
+        AsyncFileBuffer_t* buffer = &file->buffers[file->serviced % ASYNC_FILE_DEPTH];
+        while ((buffer->state != ASYNC_FILE_BUFFER_QUEUED) && (file->stop == 0))
+        {
+            pthread_cond_wait(&file->queued, &file->lock);
+        }
+        if (buffer->state != ASYNC_FILE_BUFFER_QUEUED)
+        {
+            break;
+        }
+        pthread_mutex_unlock(&file->lock);
+
+        ssize_t result = asyncFile_Transfer(file->fd, file->mode, buffer->data, buffer->size, buffer->offset);
+
+        pthread_mutex_lock(&file->lock);
+        buffer->result = result;
+        buffer->state = ASYNC_FILE_BUFFER_DONE;
+        file->serviced++;
+        pthread_cond_broadcast(&file->done);
+    }
+    pthread_mutex_unlock(&file->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Queue the transfer of the next buffer at the current offset
+ */
+static void asyncFile_Submit(AsyncFile_t* file, size_t size)
+{
+    const int index = (int)(file->submitted % ASYNC_FILE_DEPTH);
+    AsyncFileBuffer_t* buffer = &file->buffers[index];
+
+    buffer->offset = file->offset;
+    buffer->size = size;
+    buffer->result = 0;
+    file->offset += (off_t)size;
+    file->submitted++;
+
+    if (file->backend == ASYNC_FILE_BACKEND_URING)
+    {
+        buffer->state = ASYNC_FILE_BUFFER_QUEUED;
+        asyncFile_RingSubmit(file, index);
+    }
+    else
+    {
+        pthread_mutex_lock(&file->lock);
+        buffer->state = ASYNC_FILE_BUFFER_QUEUED;
+        pthread_cond_signal(&file->queued);
+        pthread_mutex_unlock(&file->lock);
+    }
+}
+
+/**
+ * @brief Wait until the transfer of a buffer is done. A short transfer that is not at the end
+ * of the file is completed here with pread/pwrite
+ * @return Bytes transferred or -errno
+ */
+static ssize_t asyncFile_Wait(AsyncFile_t* file, AsyncFileBuffer_t* buffer)
+{
+    if (file->backend == ASYNC_FILE_BACKEND_URING)
+    {
+        while (buffer->state != ASYNC_FILE_BUFFER_DONE)
+        {
+            asyncFile_RingReap(file);
+            if ((buffer->state != ASYNC_FILE_BUFFER_DONE)
+                && (syscall(__NR_io_uring_enter, file->ring.fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0)
+                && (errno != EINTR))
+            {
+                /* Nothing completes any more, the kernel owns the buffer until asyncFile_Close drains the ring */
+                return -errno;
+            }
+        }
+        if ((buffer->result > 0) && ((size_t)buffer->result < buffer->size))
+        {
+            ssize_t rest = asyncFile_Transfer(file->fd, file->mode, &buffer->data[buffer->result],
+                                              buffer->size - (size_t)buffer->result, buffer->offset + buffer->result);
+            buffer->result = (rest < 0) ? rest : buffer->result + rest;
+        }
+    }
+    else
+    {
+        pthread_mutex_lock(&file->lock);
+        while (buffer->state != ASYNC_FILE_BUFFER_DONE)
+        {
+            pthread_cond_wait(&file->done, &file->lock);
+        }
+        pthread_mutex_unlock(&file->lock);
+    }
+    return buffer->result;
+}
+
+/**
+ * @brief Give a buffer back for the next transfer. The I/O thread reads the buffer states under the lock
+ */
+static void asyncFile_FreeBuffer(AsyncFile_t* file, AsyncFileBuffer_t* buffer)
+{
+    if (file->backend == ASYNC_FILE_BACKEND_THREAD)
+    {
+        pthread_mutex_lock(&file->lock);
+        buffer->state = ASYNC_FILE_BUFFER_FREE;
+        pthread_mutex_unlock(&file->lock);
+    }
+    else
+    {
+        buffer->state = ASYNC_FILE_BUFFER_FREE;
+    }
+}
+
+/**
+ * @brief Wait for the oldest transfer of a writer and check that it wrote everything
+ * @return EXIT_SUCCESS when written. Otherwise, return EXIT_FAILURE and keep the error
+ */
+static int asyncFile_ReapWrite(AsyncFile_t* file)
+{
+    AsyncFileBuffer_t* buffer = &file->buffers[file->completed % ASYNC_FILE_DEPTH];
+    ssize_t result = asyncFile_Wait(file, buffer);
+
+    if ((result != (ssize_t)buffer->size) && (file->error == 0))
+    {
+        file->error = (result < 0) ? (int)-result : ENOSPC;
+    }
+    asyncFile_FreeBuffer(file, buffer);
+    file->completed++;
+
+    return (file->error == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+AsyncFileBackend_t asyncFile_ProcessArgumentBackend(const char* backend)
+{
+    for (unsigned int i = 0; i < sizeof(asyncFileBackendNames) / sizeof(asyncFileBackendNames[0]); i++)
+    {
+        if (strcmp(backend, asyncFileBackendNames[i].name) == 0)
+        {
+            return asyncFileBackendNames[i].backend;
+        }
+    }
+    printf("ERROR: Unknown argument for --io, expected auto, uring, thread or stdio\n");
+    return ASYNC_FILE_BACKEND_UNKNOWN;
+}
+
+const char* asyncFile_BackendName(AsyncFileBackend_t backend)
+{
+    for (unsigned int i = 0; i < sizeof(asyncFileBackendNames) / sizeof(asyncFileBackendNames[0]); i++)
+    {
+        if (asyncFileBackendNames[i].backend == backend)
+        {
+            return asyncFileBackendNames[i].name;
+        }
+    }
+    return "unknown";
+}
+
+int asyncFile_Open(AsyncFile_t* file, int fd, AsyncFileMode_t mode, AsyncFileBackend_t backend, off_t offset, off_t end)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    memset(file, 0, sizeof(*file));
+    file->fd = fd;
+    file->mode = mode;
+    file->offset = offset;
+    file->end = end;
+    file->ring.fd = -1;
+
+    file->memory = (unsigned char*)heap->allocate(heap->context, (size_t)ASYNC_FILE_DEPTH * ASYNC_FILE_BUFFER_SIZE,
+                                                  ASYNC_FILE_ALIGNMENT);
+    if (file->memory == NULL)
+    {
+        printf("Error allocating I/O buffers\n");
+        return EXIT_FAILURE;
+    }
+    for (int i = 0; i < ASYNC_FILE_DEPTH; i++)
+    {
+        file->buffers[i].data = &file->memory[(size_t)i * ASYNC_FILE_BUFFER_SIZE];
+    }
+
+    if ((backend != ASYNC_FILE_BACKEND_THREAD) && (asyncFile_RingSetup(file) == EXIT_SUCCESS))
+    {
+        file->backend = ASYNC_FILE_BACKEND_URING;
+    }
+    else if (backend == ASYNC_FILE_BACKEND_URING)
+    {
+        perror("io_uring");
+        heap->release(heap->context, file->memory);
+        file->memory = NULL;
+        return EXIT_FAILURE;
+    }
+    else
+    {
+        file->backend = ASYNC_FILE_BACKEND_THREAD;
+        pthread_mutex_init(&file->lock, NULL);
+        pthread_cond_init(&file->queued, NULL);
+        pthread_cond_init(&file->done, NULL);
+        if (pthread_create(&file->thread, NULL, asyncFile_Thread, file) != 0)
+        {
+            perror("pthread_create");
+            pthread_cond_destroy(&file->done);
+            pthread_cond_destroy(&file->queued);
+            pthread_mutex_destroy(&file->lock);
+            heap->release(heap->context, file->memory);
+            file->memory = NULL;
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* Reads are queued ahead in every buffer, the caller waits only when it gets ahead of the disk */
+    while ((mode == ASYNC_FILE_READ) && (file->submitted < ASYNC_FILE_DEPTH) && (file->offset < file->end))
+    {
+        const off_t left = file->end - file->offset;
+        asyncFile_Submit(file, (left < ASYNC_FILE_BUFFER_SIZE) ? (size_t)left : ASYNC_FILE_BUFFER_SIZE);
+    }
+    return EXIT_SUCCESS;
+}
+
+ssize_t asyncFile_AcquireRead(AsyncFile_t* file, const unsigned char** data)
+{
+    if (file->completed == file->submitted)
+    {
+        return 0;
+    }
+
+    AsyncFileBuffer_t* buffer = &file->buffers[file->completed % ASYNC_FILE_DEPTH];
+    ssize_t result = asyncFile_Wait(file, buffer);
+    if (result < 0)
+    {
+        file->error = (int)-result;
+        errno = file->error;
+        return -1;
+    }
+    /* The file ended early, reads queued behind this one return nothing */
+    if ((size_t)result < buffer->size)
+    {
+        file->end = buffer->offset + result;
+    }
+    *data = buffer->data;
+    return result;
+}
+
+void asyncFile_ReleaseRead(AsyncFile_t* file)
+{
+    asyncFile_FreeBuffer(file, &file->buffers[file->completed % ASYNC_FILE_DEPTH]);
+    file->completed++;
+
+    if (file->offset < file->end)
+    {
+        const off_t left = file->end - file->offset;
+        asyncFile_Submit(file, (left < ASYNC_FILE_BUFFER_SIZE) ? (size_t)left : ASYNC_FILE_BUFFER_SIZE);
+    }
+}
+
+unsigned char* asyncFile_AcquireWrite(AsyncFile_t* file)
+{
+    if ((file->submitted - file->completed == ASYNC_FILE_DEPTH) && (asyncFile_ReapWrite(file) != EXIT_SUCCESS))
+    {
+        errno = file->error;
+        return NULL;
+    }
+    if (file->error != 0)
+    {
+        errno = file->error;
+        return NULL;
+    }
+    return file->buffers[file->submitted % ASYNC_FILE_DEPTH].data;
+}
+
+void asyncFile_CommitWrite(AsyncFile_t* file, size_t size)
+{
+    if (size > 0)
+    {
+        asyncFile_Submit(file, size);
+    }
+}
+
+int asyncFile_Flush(AsyncFile_t* file)
+{
+    if (file->mode == ASYNC_FILE_WRITE)
+    {
+        while (file->completed < file->submitted)
+        {
+            asyncFile_ReapWrite(file);
+        }
+    }
+    else
+    {
+        /* Reads queued ahead are waited for and dropped, the buffers stay with the reader */
+        for (unsigned long n = file->completed; n < file->submitted; n++)
+        {
+            asyncFile_Wait(file, &file->buffers[n % ASYNC_FILE_DEPTH]);
+        }
+    }
+    if (file->error != 0)
+    {
+        errno = file->error;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int asyncFile_Close(AsyncFile_t* file)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    if (file->memory == NULL)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    int retval = asyncFile_Flush(file);
+    int error = file->error;
+    int drained = 1;
+
+    if (file->backend == ASYNC_FILE_BACKEND_URING)
+    {
+        /* Closing the ring does not wait for transfers still in flight, they must be done before the buffers go.
+         * Closing it unregisters the buffers */
+        if (asyncFile_RingDrain(file) != EXIT_SUCCESS)
+        {
+            printf("Error: io_uring transfers can not be drained, their buffers are not released\n");
+            drained = 0;
+            retval = EXIT_FAILURE;
+            error = (error != 0) ? error : EIO;
+        }
+        asyncFile_RingFree(&file->ring);
+    }
+    else
+    {
+        pthread_mutex_lock(&file->lock);
+        file->stop = 1;
+        pthread_cond_signal(&file->queued);
+        pthread_mutex_unlock(&file->lock);
+        pthread_join(file->thread, NULL);
+        pthread_cond_destroy(&file->done);
+        pthread_cond_destroy(&file->queued);
+        pthread_mutex_destroy(&file->lock);
+    }
+    if (drained)
+    {
+        heap->release(heap->context, file->memory);
+    }
+    file->memory = NULL;
+
+    errno = error;
+    return retval;
+}
@@ -0,0 +1,301 @@
+/**
+ * @file fastFloat.c
+ * @author shed258
+ * @brief Locale-independent float parsing and formatting for text sample files
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "fastFloat.h"
+
+#define FAST_FLOAT_MAX_EXACT_POWER  22      /* highest power of ten exactly representable in double */
+#define FAST_FLOAT_MAX_EXACT_DECIMALS 9     /* 5^9 < 2^21, a float times 10^9 fits the 53 bits of a double */
+#define FAST_FLOAT_MAX_SLOW_DIGITS  128     /* a halfway point between floats has at most 113 significant digits */
+
+static const double powersOfTen[FAST_FLOAT_MAX_EXACT_POWER + 1] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline int fastFloat_IsDigit(char character)
+{
+    return (unsigned char)(character - '0') < 10;
+}
+
+static inline int fastFloat_IsSpace(char character)
+{
+    return (character == ' ') || ((unsigned char)(character - '\t') < 5);
+}
+
+/**
+ * @brief Case-insensitive match of a lowercase word
+ * @return Number of characters matched or 0
+ */
+static size_t fastFloat_MatchWord(const char* begin, const char* end, const char* word)
+{
+    size_t length = strlen(word);
+
+    if ((size_t)(end - begin) < length)
+    {
+        return 0;
+    }
+    for (size_t i = 0; i < length; i++)
+    {
+        if ((begin[i] | 0x20) != word[i])
+        {
+            return 0;
+        }
+    }
+    return length;
+}
+
+/**
+ * @brief Check whether a double lies halfway between two floats, or in the subnormal float range.
+ * Rounding such a double to float may round the decimal value a second time in the wrong direction
+ */
+static inline int fastFloat_IsFloatHalfway(double value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    return ((bits & ((1ULL << 29) - 1)) == (1ULL << 28)) || (fabs(value) < FLT_MIN);
+}
+
+/**
+ * @brief Round the digits of a number times 10^<exponent> to float once, by the C library. The text
+ * passed on holds only digits and the exponent, so the locale does not matter. Digits beyond
+ * FAST_FLOAT_MAX_SLOW_DIGITS are replaced by one digit 1 when any of them is nonzero, which keeps the
+ * side of every halfway point between floats, as those have fewer significant digits
+ * @param digits    First digit of the number
+ * @param end       End of the digits and the decimal point
+ * @param exponent  Explicit exponent
+ * @return Correctly rounded value
+ */
+static float fastFloat_ParseSlow(const char* digits, const char* end, int exponent)
+{
+    char text[FAST_FLOAT_MAX_SLOW_DIGITS + 16];
+    size_t length = 0;
+    int fraction = 0;
+    int sticky = 0;
+
+    for (const char* p = digits; p < end; p++)
+    {
+        if (*p == '.')
+        {
+            fraction = 1;
+        }
+        else if ((length == 0) && (*p == '0'))
+        {
+            exponent -= fraction;
+        }
+        else if (length < FAST_FLOAT_MAX_SLOW_DIGITS)
+        {
+            text[length++] = *p;
+            exponent -= fraction;
+        }
+        else
+        {
+            exponent += !fraction;
+            sticky |= (*p != '0');
+        }
+    }
+    if (sticky)
+    {
+        text[length++] = '1';
+        exponent--;
+    }
+    if (length == 0)
+    {
+        text[length++] = '0';
+    }
+    snprintf(&text[length], sizeof(text) - length, "e%d", exponent);
+    return strtof(text, NULL);
+}
+
+const char* fastFloat_Parse(const char* begin, const char* end, float* value)
+{
+    const char* p = begin;
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    int negative = 0;
+    int explicitExponent = 0;
+    int anyDigit = 0;
+    int truncated = 0;
+    size_t matched;
+
+    while ((p < end) && fastFloat_IsSpace(*p))
+    {
+        p++;
+    }
+    if ((p < end) && ((*p == '-') || (*p == '+')))
+    {
+        negative = (*p == '-');
+        p++;
+    }
+    if (p == end)
+    {
+        return NULL;
+    }
+
+    if ((matched = fastFloat_MatchWord(p, end, "inf")) != 0)
+    {
+        p += matched;
+        p += fastFloat_MatchWord(p, end, "inity");
+        *value = negative ? -INFINITY : INFINITY;
+        return p;
+    }
+    if ((matched = fastFloat_MatchWord(p, end, "nan")) != 0)
+    {
+        *value = NAN;
+        return p + matched;
+    }
+    const char* digits = p;
+
+    /* Digits beyond 19 significant ones do not fit, they only scale the value */
+    for (; (p < end) && fastFloat_IsDigit(*p); p++)
+    {
+        if (mantissa < (UINT64_MAX - 9) / 10)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+        }
+        else
+        {
+            exponent++;
+            truncated |= (*p != '0');
+        }
+        anyDigit = 1;
+    }
+    if ((p < end) && (*p == '.'))
+    {
+        for (p++; (p < end) && fastFloat_IsDigit(*p); p++)
+        {
+            if (mantissa < (UINT64_MAX - 9) / 10)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                exponent--;
+            }
+            else
+            {
+                truncated |= (*p != '0');
+            }
+            anyDigit = 1;
+        }
+    }
+    if (anyDigit == 0)
+    {
+        return NULL;
+    }
+    const char* digitsEnd = p;
+
+    if ((p < end) && ((*p | 0x20) == 'e'))
+    {
+        const char* q = p + 1;
+        int exponentNegative = 0;
+
+        if ((q < end) && ((*q == '-') || (*q == '+')))
+        {
+            exponentNegative = (*q == '-');
+            q++;
+        }
+        if ((q < end) && fastFloat_IsDigit(*q))
+        {
+            for (; (q < end) && fastFloat_IsDigit(*q); q++)
+            {
+                if (explicitExponent < 10000)
+                {
+                    explicitExponent = explicitExponent * 10 + (*q - '0');
+                }
+            }
+            explicitExponent = exponentNegative ? -explicitExponent : explicitExponent;
+            exponent += explicitExponent;
+            p = q;
+        }
+    }
+
+    /* A mantissa and a power of ten exact in double give the double in one correctly rounded operation.
+     * Rounding it to float is then correct too, unless it landed on a halfway point between two floats */
+    float result;
+    if ((truncated == 0) && (mantissa < (1ULL << 53)) && (exponent >= -FAST_FLOAT_MAX_EXACT_POWER)
+        && (exponent <= FAST_FLOAT_MAX_EXACT_POWER))
+    {
+        const double scaled = (exponent < 0) ? ((double)mantissa / powersOfTen[-exponent])
+                                             : ((double)mantissa * powersOfTen[exponent]);
+
+        result = ((mantissa == 0) || (exponent == 0) || !fastFloat_IsFloatHalfway(scaled)) ?
+                 (float)scaled : fastFloat_ParseSlow(digits, digitsEnd, explicitExponent);
+    }
+    else
+    {
+        result = fastFloat_ParseSlow(digits, digitsEnd, explicitExponent);
+    }
+
+    *value = negative ? -result : result;
+    return p;
+}
+
+size_t fastFloat_FormatInteger(char* buffer, long value)
+{
+    char digits[24];
+    size_t count = 0;
+    size_t length = 0;
+    unsigned long magnitude = (value < 0) ? -(unsigned long)value : (unsigned long)value;
+
+    do
+    {
+        digits[count++] = '0' + (magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    if (value < 0)
+    {
+        buffer[length++] = '-';
+    }
+    while (count > 0)
+    {
+        buffer[length++] = digits[--count];
+    }
+    return length;
+}
+
+size_t fastFloat_Format(char* buffer, float value, int decimals)
+{
+    /* The 24 bit significand of a float times 10^decimals = 5^decimals * 2^decimals needs at most 45 bits
+     * up to FAST_FLOAT_MAX_EXACT_DECIMALS, so the product is exact in double. Rounding it to an integer in
+     * the current rounding mode gives the same digits as printf, more decimals are left to printf */
+    const double scaled = fabs((double)value) * powersOfTen[(decimals <= FAST_FLOAT_MAX_EXACT_DECIMALS) ? decimals : 0];
+    size_t length = 0;
+
+    if ((decimals > FAST_FLOAT_MAX_EXACT_DECIMALS) || !(scaled < 9007199254740992.0))  /* 2^53, also inf and nan */
+    {
+        return snprintf(buffer, FAST_FLOAT_MAX_TEXT_LENGTH, "%.*f", decimals, value);
+    }
+
+    const uint64_t fixedPoint = (uint64_t)nearbyint(scaled);
+    const uint64_t scale = (uint64_t)powersOfTen[decimals];
+    uint64_t fraction = fixedPoint % scale;
+
+    if (signbit(value))
+    {
+        buffer[length++] = '-';
+    }
+    length += fastFloat_FormatInteger(&buffer[length], (long)(fixedPoint / scale));
+
+    if (decimals > 0)
+    {
+        buffer[length++] = '.';
+        for (int i = decimals - 1; i >= 0; i--)
+        {
+            buffer[length + i] = '0' + (fraction % 10);
+            fraction /= 10;
+        }
+        length += decimals;
+    }
+    return length;
+}
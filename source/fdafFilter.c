@@ -0,0 +1,325 @@
+/**
+ * @file fdafFilter.c
+ * @author shed258
+ * @brief Frequency-domain block LMS filter (FDAF, partitioned overlap-save) source file
+ * @version 1.0.0
+ *
+ * Constrained overlap-save block LMS, the filter is split into P partitions of B taps, FFT size 2B:
+ *   X0 = FFT([previous block, current block]), Xp = X0 of p blocks ago
+ *   y = last B samples of IFFT(sum of Xp * Wp)
+ *   e = d - y,  E = FFT([0, e]),  Wp += step * FFT(first B samples of IFFT(conj(Xp) * E))
+ * The update is the sum of the time-domain LMS updates of the block with the same step size, so the
+ * filter converges like the time-domain filter, lagging by at most one block. Tolerance: for
+ * step * B * (largest eigenvalue of the input correlation) well below 1 the error power follows the
+ * time-domain filter within 0.5 dB. Holding the weights over a block narrows the stable step range
+ * by up to B for narrowband input, e.g. a pure sine, where the time-domain filter is more forgiving.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "lmsAllocator.h"
+#include "fdafFilter.h"
+
+/**
+ * @brief Multiply spectra bin by bin, <a> conjugated on request, and add the product to <result>
+ * or store it
+ */
+static void fdafFilter_MultiplySpectra(const float* a, const float* b, float* result, int numOfBins,
+                                       int conjugate, int accumulate)
+{
+    const float sign = conjugate ? -1.0f : 1.0f;
+
+    for (int k = 0; k < numOfBins; k++)
+    {
+        const float ar = a[2 * k];
+        const float ai = sign * a[2 * k + 1];
+        const float br = b[2 * k];
+        const float bi = b[2 * k + 1];
+        const float re = ar * br - ai * bi;
+        const float im = ar * bi + ai * br;
+
+        if (accumulate)
+        {
+            result[2 * k] += re;
+            result[2 * k + 1] += im;
+        }
+        else
+        {
+            result[2 * k] = re;
+            result[2 * k + 1] = im;
+        }
+    }
+}
+
+static inline float* fdafFilter_Weights(const FdafFilter_t* filter, int partition)
+{
+    return &filter->weights[(size_t)partition * 2 * (filter->blockSize + 1)];
+}
+
+/**
+ * @brief Input spectrum of the block <age> blocks ago, 0 for the current block
+ */
+static inline float* fdafFilter_Spectrum(const FdafFilter_t* filter, int age)
+{
+    const int slot = (filter->head + age) % filter->numOfPartitions;
+    return &filter->spectra[(size_t)slot * 2 * (filter->blockSize + 1)];
+}
+
+/**
+ * @brief Output of partitions 1 .. P-1 for the current block. These depend on complete past
+ * blocks only, so they are computed once per block
+ * @param filter    FDAF filter structure
+ */
+static void fdafFilter_PreparePastOutput(FdafFilter_t* filter)
+{
+    const int numOfBins = filter->blockSize + 1;
+
+    memset(filter->pastOutput, 0, 2 * numOfBins * sizeof(float));
+    for (int p = 1; p < filter->numOfPartitions; p++)
+    {
+        fdafFilter_MultiplySpectra(fdafFilter_Spectrum(filter, p), fdafFilter_Weights(filter, p),
+                                   filter->pastOutput, numOfBins, 0, 1);
+    }
+}
+
+/**
+ * @brief Filter samples <from> to <to> of the current block with the current weights
+ * @param filter    FDAF filter structure
+ * @param from      First sample
+ * @param to        One past the last sample, not greater than <fill>
+ * @param desired   Desired samples from <from> to <to>
+ * @param output    Filter output of the samples or NULL
+ * @param error     Error of the samples or NULL
+ * @return Output of the last sample
+ */
+static float fdafFilter_Evaluate(FdafFilter_t* filter, int from, int to, const float* desired,
+                                 float* output, float* error)
+{
+    const int blockSize = filter->blockSize;
+    const int numOfBins = blockSize + 1;
+    float* current = fdafFilter_Spectrum(filter, 0);
+    float y = 0.0f;
+
+    /* Input beyond <fill> is zero and does not affect outputs of earlier samples */
+    fft_Forward(&filter->fft, filter->input, current);
+    filter->spectrumFill = filter->fill;
+
+    memcpy(filter->workSpectrum, filter->pastOutput, 2 * numOfBins * sizeof(float));
+    fdafFilter_MultiplySpectra(current, fdafFilter_Weights(filter, 0), filter->workSpectrum, numOfBins, 0, 1);
+    fft_Inverse(&filter->fft, filter->workSpectrum, filter->work);
+
+    for (int i = from; i < to; i++)
+    {
+        y = filter->work[blockSize + i];
+        filter->error[i] = desired[i - from] - y;
+        if (output != NULL)
+        {
+            output[i - from] = y;
+        }
+        if (error != NULL)
+        {
+            error[i - from] = filter->error[i];
+        }
+    }
+    return y;
+}
+
+/**
+ * @brief Adapt the weights with errors of the completed block and start the next block
+ * @param filter    FDAF filter structure
+ */
+static void fdafFilter_CompleteBlock(FdafFilter_t* filter)
+{
+    const int blockSize = filter->blockSize;
+    const int numOfBins = blockSize + 1;
+
+    if (filter->spectrumFill != blockSize)
+    {
+        fft_Forward(&filter->fft, filter->input, fdafFilter_Spectrum(filter, 0));
+    }
+
+    memset(filter->work, 0, blockSize * sizeof(float));
+    memcpy(&filter->work[blockSize], filter->error, blockSize * sizeof(float));
+    fft_Forward(&filter->fft, filter->work, filter->errorSpectrum);
+
+    /* Correlation of error and input of every partition, constrained to the taps of the partition */
+    for (int p = 0; p < filter->numOfPartitions; p++)
+    {
+        const int taps = (filter->length - p * blockSize < blockSize) ? (filter->length - p * blockSize) : blockSize;
+        float* weights = fdafFilter_Weights(filter, p);
+
+        fdafFilter_MultiplySpectra(fdafFilter_Spectrum(filter, p), filter->errorSpectrum, filter->workSpectrum,
+                                   numOfBins, 1, 0);
+        fft_Inverse(&filter->fft, filter->workSpectrum, filter->work);
+        memset(&filter->work[taps], 0, (2 * blockSize - taps) * sizeof(float));
+        fft_Forward(&filter->fft, filter->work, filter->workSpectrum);
+
+        for (int k = 0; k < 2 * numOfBins; k++)
+        {
+            weights[k] += filter->step * filter->workSpectrum[k];
+        }
+    }
+
+    /* The oldest spectrum slot becomes the current one */
+    filter->head = (filter->head + filter->numOfPartitions - 1) % filter->numOfPartitions;
+    memcpy(filter->input, &filter->input[blockSize], blockSize * sizeof(float));
+    memset(&filter->input[blockSize], 0, blockSize * sizeof(float));
+    memset(filter->error, 0, blockSize * sizeof(float));
+    filter->fill = 0;
+    filter->spectrumFill = -1;
+    fdafFilter_PreparePastOutput(filter);
+}
+
+/**
+ * @brief Store an input sample in the current block and the reference delay line
+ * @param filter    FDAF filter structure
+ * @param sample    New input sample
+ * @return Oldest sample in the window, the reference without desired signal
+ */
+static inline float fdafFilter_Store(FdafFilter_t* filter, float sample)
+{
+    filter->input[filter->blockSize + filter->fill] = sample;
+    filter->delayLine[filter->delayIndex] = sample;
+    if (++filter->delayIndex == filter->length)
+    {
+        filter->delayIndex = 0;
+    }
+    return filter->delayLine[filter->delayIndex % filter->length];
+}
+
+int fdafFilter_BlockSize(int length)
+{
+    const int blockSize = fft_NextPowerOfTwo((length < 2) ? 2 : length);
+
+    return (blockSize > FDAF_FILTER_MAX_BLOCK_SIZE) ? FDAF_FILTER_MAX_BLOCK_SIZE : blockSize;
+}
+
+int fdafFilter_Init(FdafFilter_t* filter, float step, int length)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    memset(filter, 0, sizeof(*filter));
+    if (length < 1)
+    {
+        printf("Wrong filter length %d\n", length);
+        return EXIT_FAILURE;
+    }
+    filter->step = step;
+    filter->length = length;
+    filter->blockSize = fdafFilter_BlockSize(length);
+    filter->numOfPartitions = (length + filter->blockSize - 1) / filter->blockSize;
+    filter->spectrumFill = -1;
+
+    if (fft_Init(&filter->fft, 2 * filter->blockSize) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+
+    const size_t blockBytes = lmsAllocator_AlignedSize((size_t)filter->blockSize * sizeof(float));
+    const size_t binBytes = lmsAllocator_AlignedSize(2 * ((size_t)filter->blockSize + 1) * sizeof(float));
+    const size_t delayBytes = lmsAllocator_AlignedSize((size_t)length * sizeof(float));
+    const size_t totalBytes = (2 * (size_t)filter->numOfPartitions + 3) * binBytes + 5 * blockBytes + delayBytes;
+
+    filter->memory = heap->allocate(heap->context, totalBytes, LMS_ALLOCATOR_ALIGNMENT);
+    if (filter->memory == NULL)
+    {
+        printf("Error allocating filter of length %d\n", length);
+        fft_Free(&filter->fft);
+        return EXIT_FAILURE;
+    }
+    memset(filter->memory, 0, totalBytes);
+
+    unsigned char* next = (unsigned char*)filter->memory;
+    filter->weights = (float*)next;
+    next += filter->numOfPartitions * binBytes;
+    filter->spectra = (float*)next;
+    next += filter->numOfPartitions * binBytes;
+    filter->pastOutput = (float*)next;
+    next += binBytes;
+    filter->errorSpectrum = (float*)next;
+    next += binBytes;
+    filter->workSpectrum = (float*)next;
+    next += binBytes;
+    filter->input = (float*)next;
+    next += 2 * blockBytes;
+    filter->work = (float*)next;
+    next += 2 * blockBytes;
+    filter->error = (float*)next;
+    next += blockBytes;
+    filter->delayLine = (float*)next;
+
+    return EXIT_SUCCESS;
+}
+
+void fdafFilter_Free(FdafFilter_t* filter)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    heap->release(heap->context, filter->memory);
+    fft_Free(&filter->fft);
+    filter->memory = NULL;
+}
+
+void fdafFilter_PushSample(FdafFilter_t* filter, float sample)
+{
+    fdafFilter_Store(filter, sample);
+    filter->error[filter->fill] = 0.0f;
+    filter->spectrumFill = -1;
+    if (++filter->fill == filter->blockSize)
+    {
+        fdafFilter_CompleteBlock(filter);
+    }
+}
+
+int fdafFilter_ProcessBlock(FdafFilter_t* filter, const float* input, const float* desired,
+                            float* output, float* error, int numOfSamples)
+{
+    const int blockSize = filter->blockSize;
+    float y = 0.0f;
+    int n = 0;
+
+    while (n < numOfSamples)
+    {
+        const int from = filter->fill;
+        int count = blockSize - from;
+        if (count > numOfSamples - n)
+        {
+            count = numOfSamples - n;
+        }
+
+        /* Without desired signal the reference is the oldest sample in the window,
+         * kept in the error buffer until the output is known */
+        for (int i = 0; i < count; i++)
+        {
+            const float oldest = fdafFilter_Store(filter, input[n + i]);
+            filter->error[from + i] = (desired != NULL) ? desired[n + i] : oldest;
+            filter->fill++;
+        }
+
+        y = fdafFilter_Evaluate(filter, from, filter->fill, &filter->error[from],
+                                (output != NULL) ? &output[n] : NULL, (error != NULL) ? &error[n] : NULL);
+        if (filter->fill == blockSize)
+        {
+            fdafFilter_CompleteBlock(filter);
+        }
+        n += count;
+    }
+
+    /* Non-finite values propagate through weights, checking the last output is enough */
+    return (isfinite(y) == 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+void fdafFilter_GetCoefficients(FdafFilter_t* filter, float* coefficients)
+{
+    /* Impulse response h[j] weights x(n - j), LmsFilter_t coefficient k weights x(n - length + 1 + k) */
+    for (int p = 0; p < filter->numOfPartitions; p++)
+    {
+        fft_Inverse(&filter->fft, fdafFilter_Weights(filter, p), filter->work);
+        for (int j = 0; (j < filter->blockSize) && (p * filter->blockSize + j < filter->length); j++)
+        {
+            coefficients[filter->length - 1 - (p * filter->blockSize + j)] = filter->work[j];
+        }
+    }
+}
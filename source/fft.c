@@ -0,0 +1,198 @@
+/**
+ * @file fft.c
+ * @author shed258
+ * @brief Radix-2 real FFT source file. A real transform of N samples is computed as a complex
+ * transform of N / 2 samples followed by a split of even and odd parts
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "lmsAllocator.h"
+#include "fft.h"
+
+/**
+ * @brief In-place iterative radix-2 complex FFT of <fft->size> / 2 points
+ * @param fft       FFT structure
+ * @param data      Complex samples, interleaved real and imaginary parts, in bit-reversed order
+ * @param inverse   Non-zero for the inverse transform, not scaled
+ */
+static void fft_Complex(const Fft_t* fft, float* data, int inverse)
+{
+    const int n = fft->size / 2;
+    const float sign = inverse ? 1.0f : -1.0f;
+
+    for (int half = 1, step = n / 2; half < n; half *= 2, step /= 2)
+    {
+        for (int start = 0; start < n; start += 2 * half)
+        {
+            for (int k = 0; k < half; k++)
+            {
+                const float wr = fft->twiddles[2 * k * step];
+                const float wi = sign * fft->twiddles[2 * k * step + 1];
+                float* a = &data[2 * (start + k)];
+                float* b = &data[2 * (start + k + half)];
+                const float tr = b[0] * wr - b[1] * wi;
+                const float ti = b[0] * wi + b[1] * wr;
+
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+
+int fft_NextPowerOfTwo(int number)
+{
+    int power = 1;
+
+    while (power < number)
+    {
+        power *= 2;
+    }
+    return power;
+}
+
+int fft_Init(Fft_t* fft, int size)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+    const int n = size / 2;
+
+    memset(fft, 0, sizeof(*fft));
+    if ((size < 4) || ((size & (size - 1)) != 0))
+    {
+        printf("FFT size must be a power of two\n");
+        return EXIT_FAILURE;
+    }
+
+    const size_t twiddleBytes = lmsAllocator_AlignedSize((size_t)n * sizeof(float));
+    const size_t realTwiddleBytes = lmsAllocator_AlignedSize((size_t)n * 2 * sizeof(float));
+    const size_t bitReverseBytes = lmsAllocator_AlignedSize((size_t)n * sizeof(int));
+    const size_t workBytes = lmsAllocator_AlignedSize((size_t)size * 2 * sizeof(float));
+
+    fft->memory = heap->allocate(heap->context, twiddleBytes + realTwiddleBytes + bitReverseBytes + workBytes,
+                                 LMS_ALLOCATOR_ALIGNMENT);
+    if (fft->memory == NULL)
+    {
+        printf("Error allocating FFT\n");
+        return EXIT_FAILURE;
+    }
+    fft->size = size;
+    fft->twiddles = (float*)fft->memory;
+    fft->realTwiddles = (float*)((unsigned char*)fft->twiddles + twiddleBytes);
+    fft->bitReverse = (int*)((unsigned char*)fft->realTwiddles + realTwiddleBytes);
+    fft->work = (float*)((unsigned char*)fft->bitReverse + bitReverseBytes);
+
+    /* Twiddles are computed in double precision, so the error does not grow with the index */
+    for (int k = 0; k < n / 2; k++)
+    {
+        fft->twiddles[2 * k] = (float)cos(2.0 * M_PI * k / n);
+        fft->twiddles[2 * k + 1] = (float)sin(2.0 * M_PI * k / n);
+    }
+    for (int k = 0; k < n; k++)
+    {
+        fft->realTwiddles[2 * k] = (float)cos(2.0 * M_PI * k / size);
+        fft->realTwiddles[2 * k + 1] = (float)sin(2.0 * M_PI * k / size);
+    }
+
+    int bits = 0;
+    while ((1 << bits) < n)
+    {
+        bits++;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        int reversed = 0;
+        for (int b = 0; b < bits; b++)
+        {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        fft->bitReverse[i] = reversed;
+    }
+    return EXIT_SUCCESS;
+}
+
+void fft_Free(Fft_t* fft)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    heap->release(heap->context, fft->memory);
+    memset(fft, 0, sizeof(*fft));
+}
+
+void fft_Forward(const Fft_t* fft, const float* input, float* spectrum)
+{
+    const int n = fft->size / 2;
+    float* z = fft->work;
+
+    /* Even samples as real parts, odd samples as imaginary parts */
+    for (int i = 0; i < n; i++)
+    {
+        const int j = fft->bitReverse[i];
+        z[2 * j] = input[2 * i];
+        z[2 * j + 1] = input[2 * i + 1];
+    }
+    fft_Complex(fft, z, 0);
+
+    /* X[k] = Fe[k] + W^k * Fo[k], Fe and Fo being transforms of the even and odd samples */
+    spectrum[0] = z[0] + z[1];
+    spectrum[1] = 0.0f;
+    spectrum[2 * n] = z[0] - z[1];
+    spectrum[2 * n + 1] = 0.0f;
+    for (int k = 1; k < n; k++)
+    {
+        const float ar = z[2 * k];
+        const float ai = z[2 * k + 1];
+        const float br = z[2 * (n - k)];
+        const float bi = -z[2 * (n - k) + 1];
+        const float evenR = 0.5f * (ar + br);
+        const float evenI = 0.5f * (ai + bi);
+        const float oddR = 0.5f * (ai - bi);
+        const float oddI = -0.5f * (ar - br);
+        const float wr = fft->realTwiddles[2 * k];
+        const float wi = -fft->realTwiddles[2 * k + 1];
+
+        spectrum[2 * k] = evenR + oddR * wr - oddI * wi;
+        spectrum[2 * k + 1] = evenI + oddR * wi + oddI * wr;
+    }
+}
+
+void fft_Inverse(const Fft_t* fft, const float* spectrum, float* output)
+{
+    const int n = fft->size / 2;
+    float* z = fft->work;
+    const float scale = 1.0f / (float)fft->size;
+
+    /* Z[k] = Fe[k] + i * Fo[k], written in bit-reversed order for the complex transform */
+    for (int k = 0; k < n; k++)
+    {
+        const float ar = spectrum[2 * k];
+        const float ai = spectrum[2 * k + 1];
+        const float br = spectrum[2 * (n - k)];
+        const float bi = -spectrum[2 * (n - k) + 1];
+        const float evenR = ar + br;
+        const float evenI = ai + bi;
+        const float dr = ar - br;
+        const float di = ai - bi;
+        const float wr = fft->realTwiddles[2 * k];
+        const float wi = fft->realTwiddles[2 * k + 1];
+        const float oddR = dr * wr - di * wi;
+        const float oddI = dr * wi + di * wr;
+        const int j = fft->bitReverse[k];
+
+        z[2 * j] = evenR - oddI;
+        z[2 * j + 1] = evenI + oddR;
+    }
+    fft_Complex(fft, z, 1);
+
+    for (int i = 0; i < n; i++)
+    {
+        output[2 * i] = z[2 * i] * scale;
+        output[2 * i + 1] = z[2 * i + 1] * scale;
+    }
+}
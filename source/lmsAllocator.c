@@ -0,0 +1,72 @@
+/**
+ * @file lmsAllocator.c
+ * @author shed258
+ * @brief Aligned memory allocation for filter state: heap allocator and caller-supplied arena
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "lmsAllocator.h"
+
+static void* lmsAllocator_HeapAllocate(void* context, size_t size, size_t alignment)
+{
+    void* memory = NULL;
+
+    (void)context;
+    if (posix_memalign(&memory, alignment, size) != 0)
+    {
+        memory = NULL;
+    }
+    return memory;
+}
+
+static void lmsAllocator_HeapRelease(void* context, void* memory)
+{
+    (void)context;
+    free(memory);
+}
+
+static void* lmsArena_Allocate(void* context, size_t size, size_t alignment)
+{
+    LmsArena_t* arena = (LmsArena_t*)context;
+    const uintptr_t address = (uintptr_t)(arena->base + arena->used);
+    const size_t padding = (alignment - (address % alignment)) % alignment;
+
+    if ((arena->used + padding > arena->size) || (size > arena->size - arena->used - padding))
+    {
+        return NULL;
+    }
+    arena->used += padding + size;
+    return (void*)(address + padding);
+}
+
+const LmsAllocator_t* lmsAllocator_Heap(void)
+{
+    static const LmsAllocator_t heap = { lmsAllocator_HeapAllocate, lmsAllocator_HeapRelease, NULL };
+    return &heap;
+}
+
+void lmsArena_Init(LmsArena_t* arena, void* buffer, size_t size)
+{
+    arena->base = (unsigned char*)buffer;
+    arena->size = size;
+    arena->used = 0;
+}
+
+LmsAllocator_t lmsArena_Allocator(LmsArena_t* arena)
+{
+    LmsAllocator_t allocator = { lmsArena_Allocate, NULL, arena };
+    return allocator;
+}
+
+void lmsArena_Reset(LmsArena_t* arena)
+{
+    arena->used = 0;
+}
+
+size_t lmsAllocator_AlignedSize(size_t size)
+{
+    return (size + LMS_ALLOCATOR_ALIGNMENT - 1) / LMS_ALLOCATOR_ALIGNMENT * LMS_ALLOCATOR_ALIGNMENT;
+}
@@ -0,0 +1,704 @@
+/**
+ * @file lmsBench.c
+ * @author shed258
+ * @brief Filter throughput benchmark source file
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <math.h>
+#include "lmsBench.h"
+#include "lmsFilter.h"
+#include "lmsEngine.h"
+#include "fdafFilter.h"
+#include "rlsFilter.h"
+#include "apaFilter.h"
+#include "lmsFixed.h"
+#include "signalGenerator.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LMS_BENCH_TSC
+#include <x86intrin.h>
+#endif
+
+#define LMS_BENCH_SINE_RESOLUTION   100         /* samples in one period of the synthetic input */
+#define LMS_BENCH_STEP_SCALE        0.1f        /* step size is <scale> / <length>, stable for the sine */
+#define LMS_BENCH_SUBBAND_STEP      0.5f        /* normalized step of the subband engine */
+#define LMS_BENCH_APA_STEP          0.5f        /* normalized step of the affine projection engine */
+#define LMS_BENCH_RLS_MEMORY        10          /* RLS forgets over <memory> * <length> samples */
+#define LMS_BENCH_CONVERT_CHUNK     65536       /* samples converted to Q15 in one call */
+#define LMS_BENCH_TASK_SAMPLES      65536       /* longest convergence run */
+#define LMS_BENCH_TASK_SEED         2           /* seed of the unknown system, the input takes the default seed */
+#define LMS_BENCH_TASK_DECAY        4.0         /* unknown impulse response decays by e^-decay over its length */
+#define LMS_BENCH_TASK_BLOCK        256         /* convergence is checked once per block */
+#define LMS_BENCH_TASK_LEVEL        0.01        /* converged when error power falls below this part of desired power */
+
+/* Filters one block of input, the reference is the delayed input */
+typedef int (*LmsBenchProcess_t)(void* engine, const float* input, float* output, float* error, int numOfSamples);
+
+typedef struct
+{
+    const char* algorithm;
+    const char* variant;
+    const char* kernel;
+    int length;
+    int blockSize;
+    double medianNsPerSample;
+    double minNsPerSample;
+    double cyclesPerSample;         /* median of time stamp counter cycles, 0 when not available */
+    int stable;
+    long convergedAt;               /* samples of the identification task until converged, -1 when not converged */
+} LmsBenchResult_t;
+
+/* System identification: pink noise through a random decaying impulse response of the filter length */
+typedef struct
+{
+    float* input;
+    float* desired;
+    float* error;                   /* [LMS_BENCH_TASK_BLOCK] */
+    long numOfSamples;
+} LmsBenchTask_t;
+
+/* Engine measured through the engine interface */
+typedef struct
+{
+    int included;
+    const char* algorithm;
+    const char* variant;
+    const char* kernel;
+    LmsEngineSettings_t engine;
+    float sineStep;                 /* step size of the throughput run on the sine, 0 for the step of <engine> */
+} LmsBenchEngineCase_t;
+
+/* Q15 engine with its own copy of the input, converted once before measuring */
+typedef struct
+{
+    LmsFixed_t filter;
+    const float* source;            /* float input the block pointers point into */
+    int16_t* input;                 /* Q15 copy of <source> */
+} LmsBenchFixed_t;
+
+static int lmsBench_ProcessLms(void* engine, const float* input, float* output, float* error, int numOfSamples)
+{
+    return lmsFilter_ProcessBlock((LmsFilter_t*)engine, input, NULL, output, error, numOfSamples);
+}
+
+static int lmsBench_ProcessEngine(void* engine, const float* input, float* output, float* error, int numOfSamples)
+{
+    return lmsEngine_ProcessBlock((const LmsEngine_t*)engine, input, NULL, output, error, numOfSamples);
+}
+
+static int lmsBench_ProcessFixed(void* engine, const float* input, float* output, float* error, int numOfSamples)
+{
+    LmsBenchFixed_t* fixed = (LmsBenchFixed_t*)engine;
+
+    /* Q15 results take half of the float buffers */
+    lmsFixed_ProcessBlock(&fixed->filter, &fixed->input[input - fixed->source], NULL, (int16_t*)output,
+                          (int16_t*)error, numOfSamples);
+    return EXIT_SUCCESS;
+}
+
+static double lmsBench_Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static unsigned long long lmsBench_Cycles(void)
+{
+#ifdef LMS_BENCH_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static int lmsBench_CompareDouble(const void* a, const void* b)
+{
+    const double x = *(const double*)a;
+    const double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Run warmup and measured trials of one case. Every trial filters the whole input block by block,
+ * the filter state is carried over from trial to trial
+ * @param settings  Benchmark settings
+ * @param process   Block routine of the engine
+ * @param engine    Initialized engine
+ * @param input     Synthetic input of <numOfSamples> samples
+ * @param output    Buffer for one block of filter output
+ * @param error     Buffer for one block of error
+ * @param result    Case description, filled with measured values
+ * @return EXIT_SUCCESS when measured. Otherwise, return EXIT_FAILURE
+ */
+static int lmsBench_Measure(const LmsBenchSettings_t* settings, LmsBenchProcess_t process, void* engine,
+                            const float* input, float* output, float* error, LmsBenchResult_t* result)
+{
+    double* nsPerSample = (double*)malloc(2 * settings->trials * sizeof(double));
+    if (nsPerSample == NULL)
+    {
+        printf("Error allocating benchmark results\n");
+        return EXIT_FAILURE;
+    }
+    double* cyclesPerSample = &nsPerSample[settings->trials];
+
+    result->stable = 1;
+    for (int trial = -settings->warmupTrials; trial < settings->trials; trial++)
+    {
+        const double start = lmsBench_Now();
+        const unsigned long long startCycles = lmsBench_Cycles();
+
+        for (long n = 0; n < settings->numOfSamples; n += result->blockSize)
+        {
+            const long left = settings->numOfSamples - n;
+            const int count = (left < result->blockSize) ? (int)left : result->blockSize;
+            if (process(engine, &input[n], output, error, count) != EXIT_SUCCESS)
+            {
+                result->stable = 0;
+            }
+        }
+
+        const unsigned long long cycles = lmsBench_Cycles() - startCycles;
+        const double elapsed = lmsBench_Now() - start;
+        if (trial >= 0)
+        {
+            nsPerSample[trial] = elapsed / settings->numOfSamples;
+            cyclesPerSample[trial] = (double)cycles / settings->numOfSamples;
+        }
+    }
+
+    qsort(nsPerSample, settings->trials, sizeof(double), lmsBench_CompareDouble);
+    qsort(cyclesPerSample, settings->trials, sizeof(double), lmsBench_CompareDouble);
+    result->medianNsPerSample = nsPerSample[settings->trials / 2];
+    result->minNsPerSample = nsPerSample[0];
+    result->cyclesPerSample = cyclesPerSample[settings->trials / 2];
+
+    free(nsPerSample);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Desired signal of the identification task for a filter length, the unknown system is the same on
+ * every run
+ * @param task      Task with pink noise input of <numOfSamples> samples
+ * @param length    Length of the unknown impulse response
+ * @return EXIT_SUCCESS when created. Otherwise, return EXIT_FAILURE
+ */
+static int lmsBench_InitTask(LmsBenchTask_t* task, int length)
+{
+    SignalGenerator_t generator;
+    double norm = 0.0;
+
+    float* response = (float*)malloc(length * sizeof(float));
+    if (response == NULL)
+    {
+        printf("Error allocating benchmark buffers\n");
+        return EXIT_FAILURE;
+    }
+    signalGenerator_DefaultSettings(&generator);
+    generator.type = GEN_SIGNAL_WHITE;
+    generator.seed = LMS_BENCH_TASK_SEED;
+    signalGenerator_generateSamples(&generator, response, length);
+    for (int k = 0; k < length; k++)
+    {
+        response[k] *= (float)exp(-LMS_BENCH_TASK_DECAY * k / length);
+        norm += (double)response[k] * response[k];
+    }
+
+    /* Unit gain keeps the desired signal in the Q15 range */
+    const float scale = (float)(1.0 / sqrt(norm));
+    for (long n = 0; n < task->numOfSamples; n++)
+    {
+        const int taps = (n + 1 < length) ? (int)n + 1 : length;
+        double sum = 0.0;
+
+        for (int k = 0; k < taps; k++)
+        {
+            sum += (double)response[k] * task->input[n - k];
+        }
+        task->desired[n] = (float)sum * scale;
+    }
+    free(response);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Run the identification task with a fresh engine. Engines with latency, e.g. the subband
+ * filterbank, start with a silent error, so the error has to stay below the level to the end of the run
+ * @param task      Identification task
+ * @param engine    Engine with cleared weights and history
+ * @return Samples until the error power of every following block stays below LMS_BENCH_TASK_LEVEL of the
+ * desired power, -1 when it does not or the engine goes unstable
+ */
+static long lmsBench_Converge(const LmsBenchTask_t* task, const LmsEngine_t* engine)
+{
+    long convergedAt = -1;
+
+    for (long n = 0; n < task->numOfSamples; n += LMS_BENCH_TASK_BLOCK)
+    {
+        const long left = task->numOfSamples - n;
+        const int count = (left < LMS_BENCH_TASK_BLOCK) ? (int)left : LMS_BENCH_TASK_BLOCK;
+        double errorPower = 0.0;
+        double desiredPower = 0.0;
+
+        if (lmsEngine_ProcessBlock(engine, &task->input[n], &task->desired[n], NULL, task->error, count) != EXIT_SUCCESS)
+        {
+            return -1;
+        }
+        for (int i = 0; i < count; i++)
+        {
+            errorPower += (double)task->error[i] * task->error[i];
+            desiredPower += (double)task->desired[n + i] * task->desired[n + i];
+        }
+        if (!(errorPower < LMS_BENCH_TASK_LEVEL * desiredPower))
+        {
+            convergedAt = -1;
+        }
+        else if (convergedAt < 0)
+        {
+            convergedAt = n + count;
+        }
+    }
+    return convergedAt;
+}
+
+/**
+ * @brief Run the identification task with a new engine
+ * @param task              Identification task
+ * @param engineSettings    Engine to create
+ * @param filter            Initialized filter of the lms algorithm, NULL for the other algorithms
+ * @return Samples until converged, -1 when not converged or the engine cannot be created
+ */
+static long lmsBench_ConvergeEngine(const LmsBenchTask_t* task, const LmsEngineSettings_t* engineSettings,
+                                    LmsFilter_t* filter)
+{
+    LmsEngine_t engine;
+    long convergedAt = -1;
+
+    if (lmsEngine_Open(&engine, engineSettings, filter) == EXIT_SUCCESS)
+    {
+        convergedAt = lmsBench_Converge(task, &engine);
+        lmsEngine_Close(&engine);
+    }
+    return convergedAt;
+}
+
+/**
+ * @brief Measure an engine: throughput on the sine input, then convergence of a fresh engine on the task
+ * @param settings          Benchmark settings
+ * @param engineSettings    Engine to create, the algorithm must not be lms
+ * @param sineStep          Step size of the throughput run, 0 for the step of <engineSettings>
+ * @param task              Identification task
+ * @param input             Synthetic input of <numOfSamples> samples
+ * @param output            Buffer for one block of filter output
+ * @param error             Buffer for one block of error
+ * @param result            Case description, filled with measured values
+ * @return EXIT_SUCCESS when measured. Otherwise, return EXIT_FAILURE
+ */
+static int lmsBench_MeasureEngine(const LmsBenchSettings_t* settings, const LmsEngineSettings_t* engineSettings,
+                                  float sineStep, const LmsBenchTask_t* task, const float* input, float* output,
+                                  float* error, LmsBenchResult_t* result)
+{
+    LmsEngine_t engine;
+    LmsEngineSettings_t sineSettings = *engineSettings;
+
+    if (sineStep > 0.0f)
+    {
+        sineSettings.step = sineStep;
+    }
+    if (lmsEngine_Open(&engine, &sineSettings, NULL) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    const int retval = lmsBench_Measure(settings, lmsBench_ProcessEngine, &engine, input, output, error, result);
+    lmsEngine_Close(&engine);
+
+    result->convergedAt = lmsBench_ConvergeEngine(task, engineSettings, NULL);
+    return retval;
+}
+
+/**
+ * @brief Print the report header
+ * @param file      Output file
+ * @param settings  Benchmark settings
+ * @param task      Identification task of the convergence column
+ */
+static void lmsBench_PrintHeader(FILE* file, const LmsBenchSettings_t* settings, const LmsBenchTask_t* task)
+{
+    switch (settings->format)
+    {
+        case LMS_BENCH_FORMAT_CSV:
+            fprintf(file, "algorithm,variant,kernel,length,block,samples,trials,samples_per_sec,"
+                          "median_ns_per_sample,min_ns_per_sample,ns_per_tap,cycles_per_tap,stable,converged_at\n");
+            break;
+
+        case LMS_BENCH_FORMAT_JSON:
+            fprintf(file, "{\n");
+            fprintf(file, "  \"version\": \"%d.%d.%d\",\n", MAJOR_VERSION, MINOR_VERSION, PATCH_VERSION);
+            fprintf(file, "  \"best_kernel\": \"%s\",\n", lmsKernel_GetBest()->name);
+            fprintf(file, "  \"samples\": %ld,\n", settings->numOfSamples);
+            fprintf(file, "  \"trials\": %d,\n", settings->trials);
+            fprintf(file, "  \"warmup\": %d,\n", settings->warmupTrials);
+            fprintf(file, "  \"task_samples\": %ld,\n", task->numOfSamples);
+            fprintf(file, "  \"results\": [");
+            break;
+
+        default:
+            fprintf(file, "Samples per trial:            %ld\n", settings->numOfSamples);
+            fprintf(file, "Trials:                       %d (+%d warmup), median reported\n",
+                    settings->trials, settings->warmupTrials);
+            fprintf(file, "Convergence:                  samples until error is 20 dB below desired, pink noise through "
+                          "an unknown system of the filter length, %ld samples\n", task->numOfSamples);
+            fprintf(file, "%-9s %-10s %-7s %7s %6s %13s %10s %10s %9s %10s %9s\n", "algorithm", "variant", "kernel",
+                    "length", "block", "samples/s", "ns/sample", "min ns", "ns/tap", "cycles/tap", "converge");
+            break;
+    }
+}
+
+/**
+ * @brief Print one measured case
+ * @param file      Output file
+ * @param settings  Benchmark settings
+ * @param result    Measured case
+ * @param first     First case of the report
+ */
+static void lmsBench_PrintResult(FILE* file, const LmsBenchSettings_t* settings, const LmsBenchResult_t* result,
+                                 int first)
+{
+    const double samplesPerSecond = 1e9 / result->medianNsPerSample;
+    const double nsPerTap = result->medianNsPerSample / result->length;
+    const double cyclesPerTap = result->cyclesPerSample / result->length;
+    char convergedAt[24] = "-";
+
+    if (result->convergedAt >= 0)
+    {
+        snprintf(convergedAt, sizeof(convergedAt), "%ld", result->convergedAt);
+    }
+
+    switch (settings->format)
+    {
+        case LMS_BENCH_FORMAT_CSV:
+            fprintf(file, "%s,%s,%s,%d,%d,%ld,%d,%.0f,%.3f,%.3f,%.4f,%.4f,%d,%s\n", result->algorithm,
+                    result->variant, result->kernel, result->length, result->blockSize, settings->numOfSamples,
+                    settings->trials, samplesPerSecond, result->medianNsPerSample, result->minNsPerSample, nsPerTap,
+                    cyclesPerTap, result->stable, (result->convergedAt >= 0) ? convergedAt : "");
+            break;
+
+        case LMS_BENCH_FORMAT_JSON:
+            fprintf(file, "%s\n    { \"algorithm\": \"%s\", \"variant\": \"%s\", \"kernel\": \"%s\", "
+                          "\"length\": %d, \"block\": %d, \"samples_per_sec\": %.0f, "
+                          "\"median_ns_per_sample\": %.3f, \"min_ns_per_sample\": %.3f, "
+                          "\"ns_per_tap\": %.4f, \"cycles_per_tap\": %.4f, \"stable\": %s, \"converged_at\": %s }",
+                    first ? "" : ",", result->algorithm, result->variant, result->kernel, result->length,
+                    result->blockSize, samplesPerSecond, result->medianNsPerSample, result->minNsPerSample,
+                    nsPerTap, cyclesPerTap, result->stable ? "true" : "false",
+                    (result->convergedAt >= 0) ? convergedAt : "null");
+            break;
+
+        default:
+            fprintf(file, "%-9s %-10s %-7s %7d %6d %13.0f %10.2f %10.2f %9.4f %10.4f %9s%s\n", result->algorithm,
+                    result->variant, result->kernel, result->length, result->blockSize, samplesPerSecond,
+                    result->medianNsPerSample, result->minNsPerSample, nsPerTap, cyclesPerTap, convergedAt,
+                    result->stable ? "" : "  unstable");
+            break;
+    }
+    fflush(file);
+}
+
+void lmsBench_DefaultSettings(LmsBenchSettings_t* settings)
+{
+    static const int lengths[] = { 16, 64, 256, 1024 };
+    static const int blockSizes[] = { 64, 4096 };
+
+    memset(settings, 0, sizeof(*settings));
+    memcpy(settings->lengths, lengths, sizeof(lengths));
+    settings->numOfLengths = sizeof(lengths) / sizeof(lengths[0]);
+    memcpy(settings->blockSizes, blockSizes, sizeof(blockSizes));
+    settings->numOfBlockSizes = sizeof(blockSizes) / sizeof(blockSizes[0]);
+    settings->numOfSamples = LMS_BENCH_DEFAULT_SAMPLES;
+    settings->trials = LMS_BENCH_DEFAULT_TRIALS;
+    settings->warmupTrials = LMS_BENCH_DEFAULT_WARMUP;
+    settings->allVariants = 0;
+    settings->includeFdaf = 1;
+    settings->includeFixed = 1;
+    settings->includeSubband = 1;
+    settings->includeRls = 1;
+    settings->includeApa = 1;
+    settings->format = LMS_BENCH_FORMAT_TABLE;
+    settings->outputFileName = NULL;
+}
+
+LmsBenchFormat_t lmsBench_processArgumentFormat(const char* format)
+{
+    LmsBenchFormat_t retval = LMS_BENCH_FORMAT_UNKNOWN;
+
+    if (strcmp(format, "table") == 0)
+    {
+        retval = LMS_BENCH_FORMAT_TABLE;
+    }
+    else if (strcmp(format, "csv") == 0)
+    {
+        retval = LMS_BENCH_FORMAT_CSV;
+    }
+    else if (strcmp(format, "json") == 0)
+    {
+        retval = LMS_BENCH_FORMAT_JSON;
+    }
+    else
+    {
+        printf("ERROR: Argument <format> must be table, csv or json\n");
+    }
+    return retval;
+}
+
+int lmsBench_processArgumentList(const char* list, int* values, int maxValues)
+{
+    int count = 0;
+    const char* position = list;
+
+    while (*position != '\0')
+    {
+        char* end;
+        long value;
+
+        if (!isdigit((unsigned char)*position))
+        {
+            printf("ERROR: List must contain positive integers separated by commas\n");
+            return 0;
+        }
+        value = strtol(position, &end, 10);
+        if ((value < 1) || (value > 1000000) || (count == maxValues) || ((*end != ',') && (*end != '\0')))
+        {
+            printf("ERROR: List must contain up to %d positive integers separated by commas\n", maxValues);
+            return 0;
+        }
+        values[count++] = (int)value;
+        position = (*end == ',') ? end + 1 : end;
+    }
+    if (count == 0)
+    {
+        printf("ERROR: List is empty\n");
+    }
+    return count;
+}
+
+int lmsBench_Run(const LmsBenchSettings_t* settings)
+{
+    int retval = EXIT_SUCCESS;
+    int maxBlockSize = 1;
+    int first = 1;
+    FILE* file = stdout;
+    SignalGenerator_t generator;
+    LmsBenchTask_t task;
+    char apaVariant[16];
+
+    if ((settings->numOfSamples < 1) || (settings->trials < 1) || (settings->warmupTrials < 0))
+    {
+        printf("ERROR: Number of samples and trials must be positive\n");
+        return EXIT_FAILURE;
+    }
+    for (int b = 0; b < settings->numOfBlockSizes; b++)
+    {
+        if (settings->blockSizes[b] > maxBlockSize)
+        {
+            maxBlockSize = settings->blockSizes[b];
+        }
+    }
+    task.numOfSamples = (settings->numOfSamples < LMS_BENCH_TASK_SAMPLES) ? settings->numOfSamples :
+                        LMS_BENCH_TASK_SAMPLES;
+
+    float* input = (float*)malloc(settings->numOfSamples * sizeof(float));
+    float* output = (float*)malloc(maxBlockSize * sizeof(float));
+    float* error = (float*)malloc(maxBlockSize * sizeof(float));
+    int16_t* fixedInput = (int16_t*)malloc(settings->numOfSamples * sizeof(int16_t));
+    float* taskSamples = (float*)malloc((2 * task.numOfSamples + LMS_BENCH_TASK_BLOCK) * sizeof(float));
+    if ((input == NULL) || (output == NULL) || (error == NULL) || (fixedInput == NULL) || (taskSamples == NULL))
+    {
+        printf("Error allocating benchmark buffers\n");
+        free(input);
+        free(output);
+        free(error);
+        free(fixedInput);
+        free(taskSamples);
+        return EXIT_FAILURE;
+    }
+    signalGenerator_DefaultSettings(&generator);
+    generator.type = GEN_SIGNAL_SINE;
+    generator.resolution = LMS_BENCH_SINE_RESOLUTION;
+    signalGenerator_generateSamples(&generator, input, settings->numOfSamples);
+    for (long n = 0; n < settings->numOfSamples; n += LMS_BENCH_CONVERT_CHUNK)
+    {
+        const long left = settings->numOfSamples - n;
+        lmsFixed_FromFloat(&fixedInput[n], &input[n], (left < LMS_BENCH_CONVERT_CHUNK) ? (int)left : LMS_BENCH_CONVERT_CHUNK);
+    }
+    task.input = taskSamples;
+    task.desired = &taskSamples[task.numOfSamples];
+    task.error = &taskSamples[2 * task.numOfSamples];
+    signalGenerator_DefaultSettings(&generator);
+    generator.type = GEN_SIGNAL_PINK;
+    signalGenerator_generateSamples(&generator, task.input, task.numOfSamples);
+    snprintf(apaVariant, sizeof(apaVariant), "order-%d", APA_FILTER_DEFAULT_ORDER);
+
+    if (settings->outputFileName != NULL)
+    {
+        file = fopen(settings->outputFileName, "w");
+        if (file == NULL)
+        {
+            perror(settings->outputFileName);
+            free(input);
+            free(output);
+            free(error);
+            free(fixedInput);
+            free(taskSamples);
+            return EXIT_FAILURE;
+        }
+    }
+
+    lmsBench_PrintHeader(file, settings, &task);
+    for (int l = 0; (l < settings->numOfLengths) && (retval == EXIT_SUCCESS); l++)
+    {
+        const int length = settings->lengths[l];
+        const float step = LMS_BENCH_STEP_SCALE / length;
+        const LmsEngineSettings_t lmsSettings = { .algorithm = LMS_FILTER_ALGORITHM_LMS, .step = step, .length = length,
+                                                  .numOfThreads = 1 };
+        const LmsEngineSettings_t fixedSettings = { .algorithm = LMS_FILTER_ALGORITHM_FIXED, .step = step,
+                                                    .length = length, .numOfThreads = 1 };
+
+        /* Engines reached through the engine interface. The FDAF engine identifies the system with the step
+         * size of the time-domain filter, but its weights are held over a block, so on the narrowband sine the
+         * stable step shrinks with the block size. The subband engine runs on one thread */
+        const LmsBenchEngineCase_t engineCases[] =
+        {
+            { settings->includeFdaf, "fdaf", "lms", "fft",
+              { .algorithm = LMS_FILTER_ALGORITHM_FDAF, .step = step, .length = length,
+                .numOfThreads = 1 }, step / fdafFilter_BlockSize(length) },
+            { settings->includeSubband, "subband", "nlms", "dft",
+              { .algorithm = LMS_FILTER_ALGORITHM_SUBBAND, .step = LMS_BENCH_SUBBAND_STEP, .length = length,
+                .numOfThreads = 1 }, 0.0f },
+            { settings->includeRls, "rls",
+              rlsFilter_FormName((length <= RLS_FILTER_DIRECT_MAX_LENGTH) ? RLS_FILTER_FORM_DIRECT : RLS_FILTER_FORM_LATTICE),
+              "scalar",
+              { .algorithm = LMS_FILTER_ALGORITHM_RLS, .step = 1.0f / (LMS_BENCH_RLS_MEMORY * length), .length = length,
+                .numOfThreads = 1 }, 0.0f },
+            { settings->includeApa, "apa", apaVariant, lmsKernel_GetBest()->name,
+              { .algorithm = LMS_FILTER_ALGORITHM_APA, .step = LMS_BENCH_APA_STEP, .length = length,
+                .projectionOrder = APA_FILTER_DEFAULT_ORDER, .numOfThreads = 1 }, 0.0f },
+        };
+
+        if (lmsBench_InitTask(&task, length) != EXIT_SUCCESS)
+        {
+            retval = EXIT_FAILURE;
+            break;
+        }
+        for (int b = 0; (b < settings->numOfBlockSizes) && (retval == EXIT_SUCCESS); b++)
+        {
+            LmsBenchResult_t result = { "lms", NULL, NULL, length, settings->blockSizes[b], 0.0, 0.0, 0.0, 1, -1 };
+
+            /* Every kernel the CPU supports, the filter gets it in place of the best one */
+            for (int k = 0; (k < LMS_KERNEL_COUNT) && (retval == EXIT_SUCCESS); k++)
+            {
+                const LmsKernel_t* kernel = lmsKernel_Get((LmsKernelType_t)k);
+                const int numOfVariants = settings->allVariants ? LMS_FILTER_VARIANT_COUNT : 1;
+
+                for (int v = 0; (kernel != NULL) && (v < numOfVariants) && (retval == EXIT_SUCCESS); v++)
+                {
+                    LmsFilter_t filter;
+                    if (lmsFilter_InitVariant(&filter, step, length, (LmsFilterVariant_t)v, LMS_FILTER_DEFAULT_LEAKAGE,
+                                              NULL) != EXIT_SUCCESS)
+                    {
+                        retval = EXIT_FAILURE;
+                        break;
+                    }
+                    filter.kernel = kernel;
+                    result.variant = lmsFilter_VariantName((LmsFilterVariant_t)v);
+                    result.kernel = kernel->name;
+                    retval = lmsBench_Measure(settings, lmsBench_ProcessLms, &filter, input, output, error, &result);
+                    lmsFilter_Free(&filter);
+
+                    /* Same filter from scratch on the identification task */
+                    if ((retval == EXIT_SUCCESS)
+                        && ((retval = lmsFilter_InitVariant(&filter, step, length, (LmsFilterVariant_t)v,
+                                                            LMS_FILTER_DEFAULT_LEAKAGE, NULL)) == EXIT_SUCCESS))
+                    {
+                        filter.kernel = kernel;
+                        result.convergedAt = lmsBench_ConvergeEngine(&task, &lmsSettings, &filter);
+                        lmsFilter_Free(&filter);
+                        lmsBench_PrintResult(file, settings, &result, first);
+                        first = 0;
+                    }
+                }
+            }
+
+            /* Q15 engine with every fixed-point kernel the CPU supports */
+            for (int k = 0; settings->includeFixed && (k < LMS_KERNEL_COUNT) && (retval == EXIT_SUCCESS); k++)
+            {
+                const LmsFixedKernel_t* kernel = lmsFixed_GetKernel((LmsKernelType_t)k);
+                LmsBenchFixed_t fixed = { .source = input, .input = fixedInput };
+
+                if (kernel == NULL)
+                {
+                    continue;
+                }
+                if (lmsFixed_Init(&fixed.filter, lmsFixed_StepShift(step), length) != EXIT_SUCCESS)
+                {
+                    retval = EXIT_FAILURE;
+                    break;
+                }
+                fixed.filter.kernel = kernel;
+                result.algorithm = "q15";
+                result.variant = "lms";
+                result.kernel = kernel->name;
+                retval = lmsBench_Measure(settings, lmsBench_ProcessFixed, &fixed, input, output, error, &result);
+                if (retval == EXIT_SUCCESS)
+                {
+                    /* Every kernel is bit-exact, the engine takes the best one */
+                    result.convergedAt = lmsBench_ConvergeEngine(&task, &fixedSettings, NULL);
+                    lmsBench_PrintResult(file, settings, &result, first);
+                    first = 0;
+                }
+                lmsFixed_Free(&fixed.filter);
+            }
+
+            for (size_t e = 0; (e < sizeof(engineCases) / sizeof(engineCases[0])) && (retval == EXIT_SUCCESS); e++)
+            {
+                if (!engineCases[e].included)
+                {
+                    continue;
+                }
+                result.algorithm = engineCases[e].algorithm;
+                result.variant = engineCases[e].variant;
+                result.kernel = engineCases[e].kernel;
+                retval = lmsBench_MeasureEngine(settings, &engineCases[e].engine, engineCases[e].sineStep, &task, input,
+                                                output, error, &result);
+                if (retval == EXIT_SUCCESS)
+                {
+                    lmsBench_PrintResult(file, settings, &result, first);
+                    first = 0;
+                }
+            }
+        }
+    }
+    if (settings->format == LMS_BENCH_FORMAT_JSON)
+    {
+        fprintf(file, "\n  ]\n}\n");
+    }
+
+    if ((file != stdout) && (fclose(file) != 0))
+    {
+        perror(settings->outputFileName);
+        retval = EXIT_FAILURE;
+    }
+    free(input);
+    free(output);
+    free(error);
+    free(fixedInput);
+    free(taskSamples);
+    return retval;
+}
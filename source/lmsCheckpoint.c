@@ -0,0 +1,237 @@
+/**
+ * @file lmsCheckpoint.c
+ * @author shed258
+ * @brief Checkpoint file source file
+ * @version 1.0.0
+ *
+ * File layout, every part starting on a 64-byte boundary of the file and so of the mapping:
+ *   header      LMS_CHECKPOINT_HEADER_SIZE bytes
+ *   rows        numOfChannels x rowStride floats, the first <length> of each row are coefficients
+ *   window      length + 1 floats of a single filter, present when hasState is set
+ * The checksum is FNV-1a 64 over the header, with the checksum field zero, and the payload.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lmsAllocator.h"
+#include "lmsCheckpoint.h"
+
+#define CHECKPOINT_FNV_OFFSET   0xcbf29ce484222325ull
+#define CHECKPOINT_FNV_PRIME    0x100000001b3ull
+
+_Static_assert(sizeof(LmsCheckpointHeader_t) == LMS_CHECKPOINT_HEADER_SIZE, "checkpoint header size");
+
+/**
+ * @brief Continue an FNV-1a 64 hash over a block of bytes
+ */
+static uint64_t lmsCheckpoint_Hash(uint64_t hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * CHECKPOINT_FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Checksum of an image, the checksum field counts as zero
+ */
+static uint64_t lmsCheckpoint_Checksum(const LmsCheckpoint_t* checkpoint)
+{
+    LmsCheckpointHeader_t header = *checkpoint->header;
+
+    header.checksum = 0;
+    uint64_t hash = lmsCheckpoint_Hash(CHECKPOINT_FNV_OFFSET, &header, sizeof(header));
+    return lmsCheckpoint_Hash(hash, (const unsigned char*)checkpoint->header + LMS_CHECKPOINT_HEADER_SIZE,
+                              checkpoint->size - LMS_CHECKPOINT_HEADER_SIZE);
+}
+
+/**
+ * @brief Floats from one coefficient row to the next
+ */
+static size_t lmsCheckpoint_RowStride(int length)
+{
+    return lmsAllocator_AlignedSize((size_t)length * sizeof(float)) / sizeof(float);
+}
+
+/**
+ * @brief Bytes of the delay line of a single filter
+ */
+static size_t lmsCheckpoint_WindowBytes(int length)
+{
+    return lmsAllocator_AlignedSize(((size_t)length + 1) * sizeof(float));
+}
+
+/**
+ * @brief Point coefficients and window into the image
+ */
+static void lmsCheckpoint_Attach(LmsCheckpoint_t* checkpoint)
+{
+    const LmsCheckpointHeader_t* header = checkpoint->header;
+    unsigned char* payload = (unsigned char*)checkpoint->header + LMS_CHECKPOINT_HEADER_SIZE;
+
+    checkpoint->coefficients = (float*)payload;
+    checkpoint->window = NULL;
+    if (header->hasState != 0)
+    {
+        checkpoint->window = (float*)(payload + (size_t)header->numOfChannels * header->rowStride * sizeof(float));
+    }
+}
+
+int lmsCheckpoint_Create(LmsCheckpoint_t* checkpoint, int numOfChannels, int length, int hasState)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+    const size_t rowStride = lmsCheckpoint_RowStride(length);
+    const size_t payloadBytes = (size_t)numOfChannels * rowStride * sizeof(float)
+                              + ((hasState != 0) ? lmsCheckpoint_WindowBytes(length) : 0);
+
+    memset(checkpoint, 0, sizeof(*checkpoint));
+    checkpoint->size = LMS_CHECKPOINT_HEADER_SIZE + payloadBytes;
+    checkpoint->header = (LmsCheckpointHeader_t*)heap->allocate(heap->context, checkpoint->size, LMS_ALLOCATOR_ALIGNMENT);
+    if (checkpoint->header == NULL)
+    {
+        printf("Error allocating checkpoint of %d channels\n", numOfChannels);
+        return EXIT_FAILURE;
+    }
+    memset(checkpoint->header, 0, checkpoint->size);
+
+    LmsCheckpointHeader_t* header = checkpoint->header;
+    memcpy(header->magic, LMS_CHECKPOINT_MAGIC, sizeof(LMS_CHECKPOINT_MAGIC));
+    header->version = LMS_CHECKPOINT_VERSION;
+    header->byteOrder = LMS_CHECKPOINT_BYTE_ORDER;
+    header->headerSize = LMS_CHECKPOINT_HEADER_SIZE;
+    header->numOfChannels = (uint32_t)numOfChannels;
+    header->length = (uint32_t)length;
+    header->rowStride = (uint32_t)rowStride;
+    header->hasState = (hasState != 0) ? 1 : 0;
+    header->payloadBytes = payloadBytes;
+    lmsCheckpoint_Attach(checkpoint);
+
+    return EXIT_SUCCESS;
+}
+
+float* lmsCheckpoint_Row(const LmsCheckpoint_t* checkpoint, int channel)
+{
+    return &checkpoint->coefficients[(size_t)channel * checkpoint->header->rowStride];
+}
+
+int lmsCheckpoint_Write(LmsCheckpoint_t* checkpoint, const char* fileName)
+{
+    size_t nameLength = strlen(fileName);
+    char* tempFileName = malloc(nameLength + sizeof(".tmp"));
+
+    if (tempFileName == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+    memcpy(tempFileName, fileName, nameLength);
+    memcpy(&tempFileName[nameLength], ".tmp", sizeof(".tmp"));
+
+    checkpoint->header->checksum = lmsCheckpoint_Checksum(checkpoint);
+
+    int status = EXIT_FAILURE;
+    FILE* file = fopen(tempFileName, "wb");
+    if (file != NULL)
+    {
+        size_t written = fwrite(checkpoint->header, 1, checkpoint->size, file);
+        if ((fclose(file) == 0) && (written == checkpoint->size) && (rename(tempFileName, fileName) == 0))
+        {
+            status = EXIT_SUCCESS;
+        }
+        else
+        {
+            remove(tempFileName);
+        }
+    }
+    if (status != EXIT_SUCCESS)
+    {
+        printf("Error writing checkpoint %s\n", fileName);
+    }
+    free(tempFileName);
+    return status;
+}
+
+int lmsCheckpoint_Open(LmsCheckpoint_t* checkpoint, const char* fileName)
+{
+    struct stat fileStat;
+
+    memset(checkpoint, 0, sizeof(*checkpoint));
+    FILE* file = fopen(fileName, "rb");
+    if (file == NULL)
+    {
+        printf("Error opening checkpoint %s\n", fileName);
+        return EXIT_FAILURE;
+    }
+    if ((fstat(fileno(file), &fileStat) != 0) || (fileStat.st_size < LMS_CHECKPOINT_HEADER_SIZE))
+    {
+        printf("%s is not a checkpoint\n", fileName);
+        fclose(file);
+        return EXIT_FAILURE;
+    }
+
+    /* The mapping stays valid after the file is closed */
+    void* mapped = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+    fclose(file);
+    if (mapped == MAP_FAILED)
+    {
+        printf("Error mapping checkpoint %s\n", fileName);
+        return EXIT_FAILURE;
+    }
+    checkpoint->header = (LmsCheckpointHeader_t*)mapped;
+    checkpoint->size = (size_t)fileStat.st_size;
+    checkpoint->mapped = 1;
+
+    const LmsCheckpointHeader_t* header = checkpoint->header;
+    if (memcmp(header->magic, LMS_CHECKPOINT_MAGIC, sizeof(LMS_CHECKPOINT_MAGIC)) != 0)
+    {
+        printf("%s is not a checkpoint\n", fileName);
+    }
+    else if ((header->version != LMS_CHECKPOINT_VERSION) || (header->byteOrder != LMS_CHECKPOINT_BYTE_ORDER)
+          || (header->headerSize != LMS_CHECKPOINT_HEADER_SIZE))
+    {
+        printf("Checkpoint %s has version %u, byte order %08x, expected version %d of this machine\n",
+               fileName, header->version, header->byteOrder, LMS_CHECKPOINT_VERSION);
+    }
+    else if ((header->numOfChannels < 1) || (header->length < 1)
+          || (header->rowStride != lmsCheckpoint_RowStride((int)header->length))
+          || (header->payloadBytes != checkpoint->size - LMS_CHECKPOINT_HEADER_SIZE)
+          || (header->payloadBytes != (uint64_t)header->numOfChannels * header->rowStride * sizeof(float)
+                                    + ((header->hasState != 0) ? lmsCheckpoint_WindowBytes((int)header->length) : 0)))
+    {
+        printf("Checkpoint %s is truncated or has a wrong size\n", fileName);
+    }
+    else if (header->checksum != lmsCheckpoint_Checksum(checkpoint))
+    {
+        printf("Checkpoint %s is corrupted, checksum does not match\n", fileName);
+    }
+    else
+    {
+        lmsCheckpoint_Attach(checkpoint);
+        return EXIT_SUCCESS;
+    }
+
+    lmsCheckpoint_Close(checkpoint);
+    return EXIT_FAILURE;
+}
+
+void lmsCheckpoint_Close(LmsCheckpoint_t* checkpoint)
+{
+    if (checkpoint->header != NULL)
+    {
+        if (checkpoint->mapped != 0)
+        {
+            munmap(checkpoint->header, checkpoint->size);
+        }
+        else
+        {
+            const LmsAllocator_t* heap = lmsAllocator_Heap();
+            heap->release(heap->context, checkpoint->header);
+        }
+    }
+    memset(checkpoint, 0, sizeof(*checkpoint));
+}
@@ -0,0 +1,506 @@
+/**
+ * @file lmsEngine.c
+ * @author shed258
+ * @brief Adaptive filter engine source file
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "lmsEngine.h"
+#include "fdafFilter.h"
+#include "lmsFixed.h"
+#include "subbandFilter.h"
+#include "rlsFilter.h"
+#include "apaFilter.h"
+#include "threadPool.h"
+
+#define LMS_ENGINE_FIXED_CHUNK  4096    /* samples converted to Q15 at a time */
+
+/* Frequency-domain engine and the time-domain coefficients of its norm */
+typedef struct
+{
+    FdafFilter_t filter;
+    float* coefficients;        /* [length] */
+} LmsEngineFdaf_t;
+
+/* Q15 engine and its conversion buffers */
+typedef struct
+{
+    LmsFixed_t filter;
+    int16_t* samples;           /* [4 * LMS_ENGINE_FIXED_CHUNK] Q15 input, desired, output and error */
+} LmsEngineFixed_t;
+
+/* Subband engine and the threads adapting its bands */
+typedef struct
+{
+    SubbandFilter_t filter;
+    ThreadPool_t* pool;         /* NULL to adapt the bands on the filtering thread */
+} LmsEngineSubband_t;
+
+/*
+ * Time-domain LMS, the state is the filter given to lmsEngine_Open
+ */
+
+static int lmsEngine_LmsProcessBlock(void* state, const float* input, const float* desired, float* output,
+                                     float* error, int numOfSamples)
+{
+    return lmsFilter_ProcessBlock((LmsFilter_t*)state, input, desired, output, error, numOfSamples);
+}
+
+static void lmsEngine_LmsPushSample(void* state, float sample)
+{
+    lmsFilter_PushSample((LmsFilter_t*)state, sample);
+}
+
+static double lmsEngine_LmsNormSquared(void* state)
+{
+    const LmsFilter_t* filter = (const LmsFilter_t*)state;
+    double sum = 0.0;
+
+    for (int k = 0; k < filter->length; k++)
+    {
+        sum += (double)filter->coefficients[k] * filter->coefficients[k];
+    }
+    return sum;
+}
+
+static void lmsEngine_LmsClose(void* state)
+{
+    /* The filter belongs to the caller */
+    (void)state;
+}
+
+/*
+ * Frequency-domain block LMS
+ */
+
+static int lmsEngine_FdafProcessBlock(void* state, const float* input, const float* desired, float* output,
+                                      float* error, int numOfSamples)
+{
+    return fdafFilter_ProcessBlock(&((LmsEngineFdaf_t*)state)->filter, input, desired, output, error, numOfSamples);
+}
+
+static void lmsEngine_FdafPushSample(void* state, float sample)
+{
+    fdafFilter_PushSample(&((LmsEngineFdaf_t*)state)->filter, sample);
+}
+
+static double lmsEngine_FdafNormSquared(void* state)
+{
+    LmsEngineFdaf_t* fdaf = (LmsEngineFdaf_t*)state;
+    double sum = 0.0;
+
+    fdafFilter_GetCoefficients(&fdaf->filter, fdaf->coefficients);
+    for (int k = 0; k < fdaf->filter.length; k++)
+    {
+        sum += (double)fdaf->coefficients[k] * fdaf->coefficients[k];
+    }
+    return sum;
+}
+
+static void lmsEngine_FdafClose(void* state)
+{
+    LmsEngineFdaf_t* fdaf = (LmsEngineFdaf_t*)state;
+
+    fdafFilter_Free(&fdaf->filter);
+    free(fdaf->coefficients);
+    free(fdaf);
+}
+
+/*
+ * Q15 fixed-point LMS, float samples are converted through the engine buffers
+ */
+
+static int lmsEngine_FixedProcessBlock(void* state, const float* input, const float* desired, float* output,
+                                       float* error, int numOfSamples)
+{
+    LmsEngineFixed_t* fixed = (LmsEngineFixed_t*)state;
+    int16_t* fixedInput = fixed->samples;
+    int16_t* fixedDesired = &fixedInput[LMS_ENGINE_FIXED_CHUNK];
+    int16_t* fixedOutput = &fixedInput[2 * LMS_ENGINE_FIXED_CHUNK];
+    int16_t* fixedError = &fixedInput[3 * LMS_ENGINE_FIXED_CHUNK];
+
+    for (int i = 0; i < numOfSamples; i += LMS_ENGINE_FIXED_CHUNK)
+    {
+        const int n = (numOfSamples - i < LMS_ENGINE_FIXED_CHUNK) ? numOfSamples - i : LMS_ENGINE_FIXED_CHUNK;
+
+        lmsFixed_FromFloat(fixedInput, &input[i], n);
+        if (desired != NULL)
+        {
+            lmsFixed_FromFloat(fixedDesired, &desired[i], n);
+        }
+        lmsFixed_ProcessBlock(&fixed->filter, fixedInput, (desired != NULL) ? fixedDesired : NULL,
+                              fixedOutput, fixedError, n);
+        if (output != NULL)
+        {
+            lmsFixed_ToFloat(&output[i], fixedOutput, n);
+        }
+        if (error != NULL)
+        {
+            lmsFixed_ToFloat(&error[i], fixedError, n);
+        }
+    }
+    /* Saturating arithmetic cannot go unstable */
+    return EXIT_SUCCESS;
+}
+
+static void lmsEngine_FixedPushSample(void* state, float sample)
+{
+    int16_t fixedSample;
+
+    lmsFixed_FromFloat(&fixedSample, &sample, 1);
+    lmsFixed_PushSample(&((LmsEngineFixed_t*)state)->filter, fixedSample);
+}
+
+static double lmsEngine_FixedNormSquared(void* state)
+{
+    const LmsFixed_t* filter = &((const LmsEngineFixed_t*)state)->filter;
+    double sum = 0.0;
+
+    for (int k = 0; k < filter->length; k++)
+    {
+        sum += (double)filter->coefficients[k] * filter->coefficients[k];
+    }
+    return sum / ((double)LMS_FIXED_Q15_ONE * LMS_FIXED_Q15_ONE);
+}
+
+static void lmsEngine_FixedClose(void* state)
+{
+    LmsEngineFixed_t* fixed = (LmsEngineFixed_t*)state;
+
+    lmsFixed_Free(&fixed->filter);
+    free(fixed->samples);
+    free(fixed);
+}
+
+/*
+ * Subband filterbank
+ */
+
+static int lmsEngine_SubbandProcessBlock(void* state, const float* input, const float* desired, float* output,
+                                         float* error, int numOfSamples)
+{
+    return subbandFilter_ProcessBlock(&((LmsEngineSubband_t*)state)->filter, input, desired, output, error,
+                                      numOfSamples);
+}
+
+static void lmsEngine_SubbandPushSample(void* state, float sample)
+{
+    subbandFilter_PushSample(&((LmsEngineSubband_t*)state)->filter, sample);
+}
+
+static double lmsEngine_SubbandNormSquared(void* state)
+{
+    return subbandFilter_NormSquared(&((const LmsEngineSubband_t*)state)->filter);
+}
+
+static void lmsEngine_SubbandClose(void* state)
+{
+    LmsEngineSubband_t* subband = (LmsEngineSubband_t*)state;
+
+    if (subband->pool != NULL)
+    {
+        threadPool_Destroy(subband->pool);
+        free(subband->pool);
+    }
+    subbandFilter_Free(&subband->filter);
+    free(subband);
+}
+
+/*
+ * Recursive least squares
+ */
+
+static int lmsEngine_RlsProcessBlock(void* state, const float* input, const float* desired, float* output,
+                                     float* error, int numOfSamples)
+{
+    return rlsFilter_ProcessBlock((RlsFilter_t*)state, input, desired, output, error, numOfSamples);
+}
+
+static void lmsEngine_RlsPushSample(void* state, float sample)
+{
+    rlsFilter_PushSample((RlsFilter_t*)state, sample);
+}
+
+static double lmsEngine_RlsNormSquared(void* state)
+{
+    return rlsFilter_NormSquared((const RlsFilter_t*)state);
+}
+
+static void lmsEngine_RlsClose(void* state)
+{
+    rlsFilter_Free((RlsFilter_t*)state);
+    free(state);
+}
+
+/*
+ * Affine projection
+ */
+
+static int lmsEngine_ApaProcessBlock(void* state, const float* input, const float* desired, float* output,
+                                     float* error, int numOfSamples)
+{
+    return apaFilter_ProcessBlock((ApaFilter_t*)state, input, desired, output, error, numOfSamples);
+}
+
+static void lmsEngine_ApaPushSample(void* state, float sample)
+{
+    apaFilter_PushSample((ApaFilter_t*)state, sample);
+}
+
+static double lmsEngine_ApaNormSquared(void* state)
+{
+    return apaFilter_NormSquared((const ApaFilter_t*)state);
+}
+
+static void lmsEngine_ApaClose(void* state)
+{
+    apaFilter_Free((ApaFilter_t*)state);
+    free(state);
+}
+
+static const LmsEngineOps_t lmsEngineOps[] =
+{
+    [LMS_FILTER_ALGORITHM_LMS] =
+    {
+        "lms", lmsEngine_LmsProcessBlock, lmsEngine_LmsPushSample, lmsEngine_LmsNormSquared, lmsEngine_LmsClose
+    },
+    [LMS_FILTER_ALGORITHM_FDAF] =
+    {
+        "fdaf", lmsEngine_FdafProcessBlock, lmsEngine_FdafPushSample, lmsEngine_FdafNormSquared, lmsEngine_FdafClose
+    },
+    [LMS_FILTER_ALGORITHM_FIXED] =
+    {
+        "q15", lmsEngine_FixedProcessBlock, lmsEngine_FixedPushSample, lmsEngine_FixedNormSquared,
+        lmsEngine_FixedClose
+    },
+    [LMS_FILTER_ALGORITHM_SUBBAND] =
+    {
+        "subband", lmsEngine_SubbandProcessBlock, lmsEngine_SubbandPushSample, lmsEngine_SubbandNormSquared,
+        lmsEngine_SubbandClose
+    },
+    [LMS_FILTER_ALGORITHM_RLS] =
+    {
+        "rls", lmsEngine_RlsProcessBlock, lmsEngine_RlsPushSample, lmsEngine_RlsNormSquared, lmsEngine_RlsClose
+    },
+    [LMS_FILTER_ALGORITHM_APA] =
+    {
+        "apa", lmsEngine_ApaProcessBlock, lmsEngine_ApaPushSample, lmsEngine_ApaNormSquared, lmsEngine_ApaClose
+    },
+};
+
+/**
+ * @brief Create the frequency-domain engine
+ * @return Engine state or NULL
+ */
+static void* lmsEngine_OpenFdaf(const LmsEngineSettings_t* settings)
+{
+    LmsEngineFdaf_t* fdaf = (LmsEngineFdaf_t*)calloc(1, sizeof(LmsEngineFdaf_t));
+
+    if (fdaf == NULL)
+    {
+        printf("Error allocating FDAF engine\n");
+        return NULL;
+    }
+    if (fdafFilter_Init(&fdaf->filter, settings->step, settings->length) != EXIT_SUCCESS)
+    {
+        free(fdaf);
+        return NULL;
+    }
+    fdaf->coefficients = (float*)malloc(settings->length * sizeof(float));
+    if (fdaf->coefficients == NULL)
+    {
+        printf("Error allocating FDAF engine\n");
+        lmsEngine_FdafClose(fdaf);
+        return NULL;
+    }
+    return fdaf;
+}
+
+/**
+ * @brief Create the Q15 engine
+ * @return Engine state or NULL
+ */
+static void* lmsEngine_OpenFixed(const LmsEngineSettings_t* settings)
+{
+    LmsEngineFixed_t* fixed = (LmsEngineFixed_t*)calloc(1, sizeof(LmsEngineFixed_t));
+
+    if (fixed == NULL)
+    {
+        printf("Error allocating Q15 engine\n");
+        return NULL;
+    }
+    if (lmsFixed_Init(&fixed->filter, lmsFixed_StepShift(settings->step), settings->length) != EXIT_SUCCESS)
+    {
+        free(fixed);
+        return NULL;
+    }
+    fixed->samples = (int16_t*)malloc(4 * LMS_ENGINE_FIXED_CHUNK * sizeof(int16_t));
+    if (fixed->samples == NULL)
+    {
+        printf("Error allocating Q15 engine\n");
+        lmsEngine_FixedClose(fixed);
+        return NULL;
+    }
+    return fixed;
+}
+
+/**
+ * @brief Create the subband engine and the threads adapting its bands
+ * @return Engine state or NULL
+ */
+static void* lmsEngine_OpenSubband(const LmsEngineSettings_t* settings)
+{
+    LmsEngineSubband_t* subband = (LmsEngineSubband_t*)calloc(1, sizeof(LmsEngineSubband_t));
+    int numOfThreads = settings->numOfThreads;
+
+    if (subband == NULL)
+    {
+        printf("Error allocating subband engine\n");
+        return NULL;
+    }
+    if (subbandFilter_Init(&subband->filter, settings->step, settings->length, settings->numOfBands) != EXIT_SUCCESS)
+    {
+        free(subband);
+        return NULL;
+    }
+
+    /* More threads than adapted bands would idle */
+    if (numOfThreads == 0)
+    {
+        numOfThreads = threadPool_NumberOfCpus();
+    }
+    if (numOfThreads > subband->filter.numOfBins)
+    {
+        numOfThreads = subband->filter.numOfBins;
+    }
+    if (numOfThreads > 1)
+    {
+        subband->pool = (ThreadPool_t*)malloc(sizeof(ThreadPool_t));
+        if ((subband->pool == NULL) || (threadPool_Init(subband->pool, numOfThreads) != EXIT_SUCCESS))
+        {
+            free(subband->pool);
+            subband->pool = NULL;
+            lmsEngine_SubbandClose(subband);
+            return NULL;
+        }
+        subbandFilter_SetThreadPool(&subband->filter, subband->pool);
+    }
+    return subband;
+}
+
+/**
+ * @brief Create the RLS engine, the forgetting factor is 1 - step
+ * @return Engine state or NULL
+ */
+static void* lmsEngine_OpenRls(const LmsEngineSettings_t* settings)
+{
+    RlsFilter_t* rls = (RlsFilter_t*)malloc(sizeof(RlsFilter_t));
+
+    if (rls == NULL)
+    {
+        printf("Error allocating RLS engine\n");
+        return NULL;
+    }
+    if (rlsFilter_Init(rls, 1.0 - (double)settings->step, settings->length, RLS_FILTER_FORM_AUTO) != EXIT_SUCCESS)
+    {
+        free(rls);
+        return NULL;
+    }
+    return rls;
+}
+
+/**
+ * @brief Create the affine projection engine
+ * @return Engine state or NULL
+ */
+static void* lmsEngine_OpenApa(const LmsEngineSettings_t* settings)
+{
+    ApaFilter_t* apa = (ApaFilter_t*)malloc(sizeof(ApaFilter_t));
+
+    if (apa == NULL)
+    {
+        printf("Error allocating APA engine\n");
+        return NULL;
+    }
+    if (apaFilter_Init(apa, settings->step, settings->length, settings->projectionOrder) != EXIT_SUCCESS)
+    {
+        free(apa);
+        return NULL;
+    }
+    return apa;
+}
+
+int lmsEngine_Open(LmsEngine_t* engine, const LmsEngineSettings_t* settings, LmsFilter_t* filter)
+{
+    void* state = NULL;
+
+    engine->ops = NULL;
+    engine->state = NULL;
+    switch (settings->algorithm)
+    {
+        case LMS_FILTER_ALGORITHM_LMS:
+            state = filter;
+            break;
+        case LMS_FILTER_ALGORITHM_FDAF:
+            state = lmsEngine_OpenFdaf(settings);
+            break;
+        case LMS_FILTER_ALGORITHM_FIXED:
+            state = lmsEngine_OpenFixed(settings);
+            break;
+        case LMS_FILTER_ALGORITHM_SUBBAND:
+            state = lmsEngine_OpenSubband(settings);
+            break;
+        case LMS_FILTER_ALGORITHM_RLS:
+            state = lmsEngine_OpenRls(settings);
+            break;
+        case LMS_FILTER_ALGORITHM_APA:
+            state = lmsEngine_OpenApa(settings);
+            break;
+        default:
+            printf("Error: Unknown filter algorithm %d\n", (int)settings->algorithm);
+            break;
+    }
+    if (state == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+    engine->ops = &lmsEngineOps[settings->algorithm];
+    engine->state = state;
+    return EXIT_SUCCESS;
+}
+
+void lmsEngine_Close(LmsEngine_t* engine)
+{
+    if (engine->ops != NULL)
+    {
+        engine->ops->close(engine->state);
+    }
+    engine->ops = NULL;
+    engine->state = NULL;
+}
+
+int lmsEngine_ProcessBlock(const LmsEngine_t* engine, const float* input, const float* desired,
+                           float* output, float* error, int numOfSamples)
+{
+    return engine->ops->processBlock(engine->state, input, desired, output, error, numOfSamples);
+}
+
+void lmsEngine_PushSample(const LmsEngine_t* engine, float sample)
+{
+    engine->ops->pushSample(engine->state, sample);
+}
+
+double lmsEngine_NormSquared(const LmsEngine_t* engine)
+{
+    return engine->ops->normSquared(engine->state);
+}
+
+const char* lmsEngine_Name(const LmsEngine_t* engine)
+{
+    return engine->ops->name;
+}
@@ -12,108 +12,566 @@
 #include <stddef.h>
 #include <ctype.h>
 #include <math.h>
+#include <pthread.h>
+#include <time.h>
+#include <limits.h>
 #include "lmsFilter.h"
+#include "lmsFilterBank.h"
+#include "lmsEngine.h"
+#include "threadPool.h"
+#include "spscRing.h"
+
+#define LMS_FILTER_BLOCK_SIZE       4096
+#define LMS_FILTER_PIPELINE_DEPTH   4       /* blocks in flight between two pipeline stages */
+
+/* Filtering state of one input channel written to its own output file */
+typedef struct
+{
+    LmsFilter_t* filter;
+    LmsEngine_t engine;         /* algorithm of the channel, runs <filter> for the time-domain LMS */
+    LmsTelemetry_t* telemetry;  /* NULL when telemetry is off */
+    LmsPlot_t* plot;            /* NULL when no plot is saved */
+    SampleWriter_t writer;
+    const char* outputFileName;
+    int writerOpen;
+    int ownsFilter;             /* filter and file name are released with the channel */
+    char* ownedFileName;
+    int history;                /* samples kept in front of the block, <length> - 1 */
+    int fill;                   /* samples in the block buffer, history included */
+    int primed;                 /* history pushed into the filter delay line */
+    long inputSamples;
+    long index;                 /* samples written to the output file */
+    const LmsCheckpointSettings_t* checkpoint;  /* NULL when the channel saves no checkpoints */
+    long positionBase;          /* input samples consumed by the filter before the first output sample */
+    long nextCheckpoint;        /* position of the next periodic checkpoint */
+    long skip;                  /* input samples already filtered by a resumed state, still to be dropped */
+    int status;
+    float* samples;
+    float* output;
+    float* error;
+    float* frames;
+    SpscRing_t* outputRing;     /* frames go to the writer thread, NULL to write them directly */
+} LmsFilterChannel_t;
+
+/* Slot of the ring between the reader and the filter */
+typedef struct
+{
+    int count;
+    float samples[LMS_FILTER_BLOCK_SIZE];
+} LmsFilterInputBlock_t;
+
+/* Slot of the ring between the filter and the writer */
+typedef struct
+{
+    int count;
+    float frames[3 * LMS_FILTER_BLOCK_SIZE];
+} LmsFilterOutputBlock_t;
+
+/* Reader, filter and writer stages of one file, connected by two rings */
+typedef struct
+{
+    SampleReader_t* reader;
+    LmsFilterChannel_t* channel;
+    SpscRing_t input;
+    SpscRing_t output;
+    int stop;                   /* filtering or writing failed, the reader stops early */
+    int writeStatus;
+    int quiet;
+} LmsFilterPipeline_t;
+
+typedef struct
+{
+    LmsFilterChannel_t* channel;
+    const float* input;
+    int stride;
+    int count;                  /* 0 finishes the channel */
+} LmsFilterChannelJob_t;
+
+/* Signal and engine handed to the real-time worker thread */
+typedef struct
+{
+    LmsFilterChannel_t* channel;
+    const float* input;
+    const float* desired;
+    float* output;
+    float* error;
+    long count;
+    long processed;             /* samples filtered before the end or a failure */
+    LmsRealtime_t* realtime;
+    int status;
+} LmsFilterRealtimeJob_t;
+
+typedef struct
+{
+    const LmsFilter_t* prototype;
+    const char* inputFileName;
+    const LmsFilterFileSettings_t* settings;
+    int* filesDone;
+    int numOfFiles;
+    int status;
+} LmsFilterFileJob_t;
+
+static int lmsFilter_ChannelClose(LmsFilterChannel_t* channel);
 
 /**
- * @brief Function opens input file and calculate number of samples
- * @param fileName  Name of the file with input samples
- * @return Number of samples in file. If failed return -1
+ * @brief Store a sample in the delay line. The delay line keeps <length> + 1 samples, so after
+ * the push the window of the previous step is still available for the deferred update.
+ * The window power used by NLMS is updated with the incoming and the dropped sample
+ * @param filter    Pointer to LMS filter structure
+ * @param sample    New input sample
  */
-static int lmsFilter_countNumberOfSamplesInFile(const char* fileName)
+static inline void lmsFilter_DelayLinePush(LmsFilter_t* filter, float sample)
 {
-    FILE* fp = fopen(fileName, "r");
-    if (fp == NULL)
-    {
-        perror(fileName);
-        return -1;
-    }
-    int count = 0;
-    int ch;
-    while ((ch = fgetc(fp)) != EOF)
+    const int size = filter->length + 1;
+    const float dropped = filter->delayLine[filter->delayIndex + 1];
+
+    /* Overwrite the oldest sample in both halves, so the view starting at
+     * delayIndex always holds <length> + 1 contiguous samples */
+    filter->delayLine[filter->delayIndex] = sample;
+    filter->delayLine[filter->delayIndex + size] = sample;
+
+    if (++filter->delayIndex == size)
     {
-        if (ch == '\n')
-        {
-            count++;
-        }
+        filter->delayIndex = 0;
     }
-    if (fclose(fp))
+
+    filter->power += (double)sample * sample - (double)dropped * dropped;
+    if (filter->power < 0.0)
     {
-        perror(fileName);
-        return -1;
+        filter->power = 0.0;
     }
-    printf("Input file samples:           %d\n", count);
-
-    return count;
 }
 
 /**
  * @brief LMS filtering function. Applying the filter to the input signal and desired signal
- * This implementation is a type of acoustic silencer. The input and desired signals are equal
+ * Without desired signal it works as a type of acoustic silencer, the input and desired signals
+ * are equal. The coefficient update of the previous sample is fused with the output pass of this one.
+ * <variant> is a constant in every caller, so each variant compiles to its own loop without branches
  * @param filter        Pointer to LMS filter structure
- * @param input         Array of input samples, e.g. noise corrupted signal
- * @param desired       Array of additional input
- * @param output        Array of output
- * @param error         Mean square error
- * @return EXIT_SUCCESS when processed succesfully. Otherwise, return EXIT_FAILURE
+ * @param sample        Next input sample, pushed into the delay line
+ * @param desired       Desired sample or NULL to use the oldest sample in the window
+ * @param error         Output error
+ * @param variant       Update rule
+ * @return Filter output
  */
-static int lmsFilter_Lms(LmsFilter_t* filter, const float* input, const float* desired,
-                         float* output, float* error)
+static inline __attribute__((always_inline))
+float lmsFilter_Lms(LmsFilter_t* filter, float sample, const float* desired, float* error,
+                    const LmsFilterVariant_t variant)
 {
-    (void)desired;
+    float y;                               /* fitler output */
 
-    int retval = EXIT_SUCCESS;
-    float y = 0.0;                         /* fitler output */
-    float x[MAX_FILTER_LENGTH] = { 0 };    /* fitler input */
-    int k;
+    lmsFilter_DelayLinePush(filter, sample);
+
+    const float* previous = &filter->delayLine[filter->delayIndex];
+    const float* input = previous + 1;     /* fitler input */
+
+    switch (variant)
+    {
+        case LMS_FILTER_VARIANT_LEAKY:
+            /* The leak belongs to the pending update: after a flush, a push or a warm start there is none */
+            y = filter->kernel->leakyUpdateDot(filter->coefficients, previous, input, filter->pendingGain,
+                                               filter->pendingUpdate ? filter->leak : 1.0f, filter->length);
+            break;
+
+        case LMS_FILTER_VARIANT_SIGN_DATA:
+        case LMS_FILTER_VARIANT_SIGN_SIGN:
+            y = filter->kernel->signUpdateDot(filter->coefficients, previous, input, filter->pendingGain,
+                                              filter->length);
+            break;
 
-    for (k = 0; k < filter->length; k++)
+        default:
+            y = filter->kernel->updateDot(filter->coefficients, previous, input, filter->pendingGain,
+                                          filter->length);
+            break;
+    }
+
+    *error = ((desired != NULL) ? *desired : input[0]) - y;
+
+    switch (variant)
     {
-        x[k] = input[k];
-        y += filter->coefficients[k] * x[k];
+        case LMS_FILTER_VARIANT_NLMS:
+            filter->pendingGain = filter->step * (*error) / (float)(LMS_FILTER_NLMS_REGULARIZATION + filter->power);
+            break;
+
+        case LMS_FILTER_VARIANT_SIGN_ERROR:
+        case LMS_FILTER_VARIANT_SIGN_SIGN:
+            filter->pendingGain = filter->step * (float)((*error > 0.0f) - (*error < 0.0f));
+            break;
+
+        default:
+            filter->pendingGain = filter->step * (*error);
+            break;
+    }
+    filter->pendingUpdate = 1;
+
+    return y;
+}
 
-        /* The input and desired signals are equal */
-        *error = input[0] - y;
+/**
+ * @brief Block loop of one variant, see lmsFilter_ProcessBlock
+ */
+static inline __attribute__((always_inline))
+int lmsFilter_ProcessBlockVariant(LmsFilter_t* filter, const float* input, const float* desired,
+                                  float* output, float* error, int numOfSamples, const LmsFilterVariant_t variant)
+{
+    int retval = EXIT_SUCCESS;
+    float y = 0;
+    float e = 0;
 
-        /* By default in LMS algotithm it should go as in line below */
-        // *error = desired[n] - y;
+    for (int n = 0; n < numOfSamples; n++)
+    {
+        y = lmsFilter_Lms(filter, input[n], (desired != NULL) ? &desired[n] : NULL, &e, variant);
 
-        for (k = 0; k < filter->length; k++)
+        if (output != NULL)
+        {
+            output[n] = y;
+        }
+        if (error != NULL)
         {
-            filter->coefficients[k] += filter->step * (*error) * x[k];
+            error[n] = e;
         }
-        *output = y;
     }
 
-    if (isfinite(*output) == 0)
+    /* Non-finite values propagate through coefficients, checking the last output is enough */
+    if (isfinite(y) == 0)
     {
-        printf("WARNING: Algorithm goes unstable! stopped\n");
         retval = EXIT_FAILURE;
     }
     return retval;
 }
 
+static int lmsFilter_ProcessBlockLms(LmsFilter_t* filter, const float* input, const float* desired,
+                                     float* output, float* error, int numOfSamples)
+{
+    return lmsFilter_ProcessBlockVariant(filter, input, desired, output, error, numOfSamples,
+                                         LMS_FILTER_VARIANT_LMS);
+}
+
+static int lmsFilter_ProcessBlockNlms(LmsFilter_t* filter, const float* input, const float* desired,
+                                      float* output, float* error, int numOfSamples)
+{
+    return lmsFilter_ProcessBlockVariant(filter, input, desired, output, error, numOfSamples,
+                                         LMS_FILTER_VARIANT_NLMS);
+}
+
+static int lmsFilter_ProcessBlockLeaky(LmsFilter_t* filter, const float* input, const float* desired,
+                                       float* output, float* error, int numOfSamples)
+{
+    return lmsFilter_ProcessBlockVariant(filter, input, desired, output, error, numOfSamples,
+                                         LMS_FILTER_VARIANT_LEAKY);
+}
+
+static int lmsFilter_ProcessBlockSignError(LmsFilter_t* filter, const float* input, const float* desired,
+                                           float* output, float* error, int numOfSamples)
+{
+    return lmsFilter_ProcessBlockVariant(filter, input, desired, output, error, numOfSamples,
+                                         LMS_FILTER_VARIANT_SIGN_ERROR);
+}
+
+static int lmsFilter_ProcessBlockSignData(LmsFilter_t* filter, const float* input, const float* desired,
+                                          float* output, float* error, int numOfSamples)
+{
+    return lmsFilter_ProcessBlockVariant(filter, input, desired, output, error, numOfSamples,
+                                         LMS_FILTER_VARIANT_SIGN_DATA);
+}
+
+static int lmsFilter_ProcessBlockSignSign(LmsFilter_t* filter, const float* input, const float* desired,
+                                          float* output, float* error, int numOfSamples)
+{
+    return lmsFilter_ProcessBlockVariant(filter, input, desired, output, error, numOfSamples,
+                                         LMS_FILTER_VARIANT_SIGN_SIGN);
+}
+
+static const LmsFilterProcessBlock_t lmsFilterProcessBlocks[LMS_FILTER_VARIANT_COUNT] =
+{
+    [LMS_FILTER_VARIANT_LMS]        = lmsFilter_ProcessBlockLms,
+    [LMS_FILTER_VARIANT_NLMS]       = lmsFilter_ProcessBlockNlms,
+    [LMS_FILTER_VARIANT_LEAKY]      = lmsFilter_ProcessBlockLeaky,
+    [LMS_FILTER_VARIANT_SIGN_ERROR] = lmsFilter_ProcessBlockSignError,
+    [LMS_FILTER_VARIANT_SIGN_DATA]  = lmsFilter_ProcessBlockSignData,
+    [LMS_FILTER_VARIANT_SIGN_SIGN]  = lmsFilter_ProcessBlockSignSign,
+};
+
+static const char* const lmsFilterVariantNames[LMS_FILTER_VARIANT_COUNT] =
+{
+    [LMS_FILTER_VARIANT_LMS]        = "lms",
+    [LMS_FILTER_VARIANT_NLMS]       = "nlms",
+    [LMS_FILTER_VARIANT_LEAKY]      = "leaky",
+    [LMS_FILTER_VARIANT_SIGN_ERROR] = "sign-error",
+    [LMS_FILTER_VARIANT_SIGN_DATA]  = "sign-data",
+    [LMS_FILTER_VARIANT_SIGN_SIGN]  = "sign-sign",
+};
+
 int lmsFilter_Init(LmsFilter_t* filter, float step, int length)
+{
+    return lmsFilter_InitVariant(filter, step, length, LMS_FILTER_VARIANT_LMS, 0.0f, NULL);
+}
+
+int lmsFilter_InitWithAllocator(LmsFilter_t* filter, float step, int length, const LmsAllocator_t* allocator)
+{
+    return lmsFilter_InitVariant(filter, step, length, LMS_FILTER_VARIANT_LMS, 0.0f, allocator);
+}
+
+size_t lmsFilter_RequiredMemory(int length)
+{
+    /* Worst case padding of an allocation taken from an arena is included */
+    return lmsAllocator_AlignedSize((size_t)length * sizeof(float))
+           + lmsAllocator_AlignedSize(2 * ((size_t)length + 1) * sizeof(float))
+           + LMS_ALLOCATOR_ALIGNMENT;
+}
+
+int lmsFilter_InitVariant(LmsFilter_t* filter, float step, int length, LmsFilterVariant_t variant,
+                          float leakage, const LmsAllocator_t* allocator)
 {
     int retval = EXIT_FAILURE;
 
-    if (filter != NULL)
+    if (allocator == NULL)
     {
-        if (length <= MAX_FILTER_LENGTH)
+        allocator = lmsAllocator_Heap();
+    }
+    if ((filter != NULL) && (variant >= 0) && (variant < LMS_FILTER_VARIANT_COUNT))
+    {
+        if ((length > 0) && ((size_t)length < ((size_t)-1) / (4 * sizeof(float))))
         {
-            filter->step = step;
-            filter->length = length;
+            const size_t coefficientBytes = lmsAllocator_AlignedSize((size_t)length * sizeof(float));
+            const size_t delayLineBytes = 2 * ((size_t)length + 1) * sizeof(float);
+
+            filter->memory = allocator->allocate(allocator->context, coefficientBytes + delayLineBytes,
+                                                 LMS_ALLOCATOR_ALIGNMENT);
+            if (filter->memory != NULL)
+            {
+                filter->step = step;
+                filter->length = length;
+                filter->delayIndex = 0;
+                filter->pendingGain = 0.0;
+                filter->pendingUpdate = 0;
+                filter->power = 0.0;
+                filter->variant = variant;
+                filter->leakage = leakage;
+                filter->leak = 1.0f - step * leakage;
+                filter->processBlock = lmsFilterProcessBlocks[variant];
+                filter->kernel = lmsKernel_GetBest();
+                filter->allocator = *allocator;
+                filter->coefficients = (float*)filter->memory;
+                filter->delayLine = (float*)((unsigned char*)filter->memory + coefficientBytes);
 
-            for (int i = 0; i < length; i++)
+                memset(filter->memory, 0, coefficientBytes + delayLineBytes);
+                retval = EXIT_SUCCESS;
+            }
+            else
             {
-                filter->coefficients[i] = 0.0;
+                printf("Error allocating filter of length %d\n", length);
             }
-            retval = EXIT_SUCCESS;
         }
         else
         {
-            printf("Filter length exceeds MAX_FILTER_LENGTH %d\n", MAX_FILTER_LENGTH);
+            printf("Wrong filter length %d\n", length);
+        }
+    }
+    return retval;
+}
+
+void lmsFilter_Free(LmsFilter_t* filter)
+{
+    if ((filter->memory != NULL) && (filter->allocator.release != NULL))
+    {
+        filter->allocator.release(filter->allocator.context, filter->memory);
+    }
+    filter->memory = NULL;
+    filter->coefficients = NULL;
+    filter->delayLine = NULL;
+}
+
+void lmsFilter_PushSample(LmsFilter_t* filter, float sample)
+{
+    lmsFilter_FlushUpdate(filter);
+    lmsFilter_DelayLinePush(filter, sample);
+}
+
+void lmsFilter_FlushUpdate(LmsFilter_t* filter)
+{
+    if (filter->pendingUpdate)
+    {
+        float* coefficients = filter->coefficients;
+        const float* window = lmsFilter_GetWindow(filter);
+        const float gain = filter->pendingGain;
+
+        switch (filter->variant)
+        {
+            case LMS_FILTER_VARIANT_LEAKY:
+                for (int k = 0; k < filter->length; k++)
+                {
+                    coefficients[k] = filter->leak * coefficients[k] + gain * window[k];
+                }
+                break;
+
+            case LMS_FILTER_VARIANT_SIGN_DATA:
+            case LMS_FILTER_VARIANT_SIGN_SIGN:
+                for (int k = 0; k < filter->length; k++)
+                {
+                    coefficients[k] += gain * (float)((window[k] > 0.0f) - (window[k] < 0.0f));
+                }
+                break;
+
+            default:
+                filter->kernel->update(coefficients, window, gain, filter->length);
+                break;
+        }
+        filter->pendingGain = 0.0;
+        filter->pendingUpdate = 0;
+    }
+}
+
+const float* lmsFilter_GetWindow(const LmsFilter_t* filter)
+{
+    return &filter->delayLine[filter->delayIndex + 1];
+}
+
+int lmsFilter_ProcessBlock(LmsFilter_t* filter, const float* input, const float* desired,
+                           float* output, float* error, int numOfSamples)
+{
+    return filter->processBlock(filter, input, desired, output, error, numOfSamples);
+}
+
+/**
+ * @brief Fill the header fields describing the filter of a checkpoint
+ * @param header    Header of a created checkpoint
+ * @param filter    Filter giving step size, variant and leakage
+ * @param position  Input samples consumed
+ */
+static void lmsFilter_DescribeCheckpoint(LmsCheckpointHeader_t* header, const LmsFilter_t* filter, long position)
+{
+    header->variant = (uint32_t)filter->variant;
+    header->step = filter->step;
+    header->leakage = filter->leakage;
+    header->position = position;
+}
+
+int lmsFilter_SaveCheckpoint(const LmsFilter_t* filter, long position, const char* fileName)
+{
+    LmsCheckpoint_t checkpoint;
+
+    if (lmsCheckpoint_Create(&checkpoint, 1, filter->length, 1) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    lmsFilter_DescribeCheckpoint(checkpoint.header, filter, position);
+    checkpoint.header->pendingUpdate = filter->pendingUpdate;
+    checkpoint.header->pendingGain = filter->pendingGain;
+    checkpoint.header->power = filter->power;
+    memcpy(lmsCheckpoint_Row(&checkpoint, 0), filter->coefficients, (size_t)filter->length * sizeof(float));
+
+    /* The view at delayIndex holds the whole delay line from the oldest sample */
+    memcpy(checkpoint.window, &filter->delayLine[filter->delayIndex], ((size_t)filter->length + 1) * sizeof(float));
+
+    int retval = lmsCheckpoint_Write(&checkpoint, fileName);
+    lmsCheckpoint_Close(&checkpoint);
+    return retval;
+}
+
+int lmsFilter_LoadCheckpoint(LmsFilter_t* filter, const LmsCheckpoint_t* checkpoint, int channel, int resume)
+{
+    const LmsCheckpointHeader_t* header = checkpoint->header;
+    const size_t size = (size_t)filter->length + 1;
+
+    if ((int)header->length != filter->length)
+    {
+        printf("Error: Checkpoint filter length %u does not match %d\n", header->length, filter->length);
+        return EXIT_FAILURE;
+    }
+    if ((channel < 0) || ((uint32_t)channel >= header->numOfChannels))
+    {
+        printf("Error: Checkpoint has no channel %d\n", channel);
+        return EXIT_FAILURE;
+    }
+    if (resume)
+    {
+        if (header->hasState == 0)
+        {
+            printf("Error: Checkpoint holds coefficients only, it can be used for a warm start\n");
+            return EXIT_FAILURE;
+        }
+        if ((header->variant != (uint32_t)filter->variant) || (header->step != filter->step)
+            || ((filter->variant == LMS_FILTER_VARIANT_LEAKY) && (header->leakage != filter->leakage)))
+        {
+            printf("Error: Checkpoint was taken with variant %s, step size %g and leakage %g\n",
+                   (header->variant < LMS_FILTER_VARIANT_COUNT) ?
+                   lmsFilter_VariantName((LmsFilterVariant_t)header->variant) : "unknown",
+                   header->step, header->leakage);
+            return EXIT_FAILURE;
+        }
+    }
+
+    memcpy(filter->coefficients, lmsCheckpoint_Row(checkpoint, channel), (size_t)filter->length * sizeof(float));
+    filter->delayIndex = 0;
+    if (resume)
+    {
+        memcpy(filter->delayLine, checkpoint->window, size * sizeof(float));
+        memcpy(&filter->delayLine[size], checkpoint->window, size * sizeof(float));
+        filter->pendingUpdate = header->pendingUpdate;
+        filter->pendingGain = header->pendingGain;
+        filter->power = header->power;
+    }
+    else
+    {
+        memset(filter->delayLine, 0, 2 * size * sizeof(float));
+        filter->pendingUpdate = 0;
+        filter->pendingGain = 0.0;
+        filter->power = 0.0;
+    }
+    return EXIT_SUCCESS;
+}
+
+LmsFilterVariant_t lmsFilter_processArgumentVariant(const char* variant)
+{
+    for (int i = 0; i < LMS_FILTER_VARIANT_COUNT; i++)
+    {
+        if (strcmp(variant, lmsFilterVariantNames[i]) == 0)
+        {
+            return (LmsFilterVariant_t)i;
         }
     }
+    printf("ERROR: Argument <variant> must be lms, nlms, leaky, sign-error, sign-data or sign-sign\n");
+    return LMS_FILTER_VARIANT_COUNT;
+}
+
+const char* lmsFilter_VariantName(LmsFilterVariant_t variant)
+{
+    return ((variant >= 0) && (variant < LMS_FILTER_VARIANT_COUNT)) ? lmsFilterVariantNames[variant] : "unknown";
+}
+
+LmsFilterAlgorithm_t lmsFilter_processArgumentAlgorithm(const char* algorithm)
+{
+    LmsFilterAlgorithm_t retval = LMS_FILTER_ALGORITHM_UNKNOWN;
+
+    if (strcmp(algorithm, "lms") == 0)
+    {
+        retval = LMS_FILTER_ALGORITHM_LMS;
+    }
+    else if (strcmp(algorithm, "fdaf") == 0)
+    {
+        retval = LMS_FILTER_ALGORITHM_FDAF;
+    }
+    else if (strcmp(algorithm, "q15") == 0)
+    {
+        retval = LMS_FILTER_ALGORITHM_FIXED;
+    }
+    else if (strcmp(algorithm, "subband") == 0)
+    {
+        retval = LMS_FILTER_ALGORITHM_SUBBAND;
+    }
+    else if (strcmp(algorithm, "rls") == 0)
+    {
+        retval = LMS_FILTER_ALGORITHM_RLS;
+    }
+    else if (strcmp(algorithm, "apa") == 0)
+    {
+        retval = LMS_FILTER_ALGORITHM_APA;
+    }
+    else
+    {
+        printf("ERROR: Argument <algo> must be lms, fdaf, q15, subband, rls or apa\n");
+    }
     return retval;
 }
 
@@ -188,116 +646,1847 @@ float lmsFilter_processArgumentStepSize(const char* stepSize)
     return retval;
 }
 
-int lmsFilter_FilterSignalAndSaveToFile(LmsFilter_t* filter, const char* inputFileName)
+/**
+ * @brief Build output file name: <output> or <input>filtered, with .<channel> for multi-channel input
+ * @param inputFileName     Name of the input file
+ * @param settings          Filter file settings
+ * @param channel           Channel number or -1 for single channel input
+ * @return Allocated file name, NULL on failure
+ */
+static char* lmsFilter_OutputFileName(const char* inputFileName, const LmsFilterFileSettings_t* settings,
+                                      int channel)
 {
-    int retval = EXIT_SUCCESS;
+    const char* filteredFileSuffix = "filtered";
+    const char* baseName = (strcmp(inputFileName, SAMPLE_IO_STDIN) == 0) ? "stdin" : inputFileName;
+    char channelSuffix[16] = "";
 
-    FILE* fSamples = fopen(inputFileName, "r");
-    if (fSamples == NULL)
+    if (settings->outputFileName != NULL)
     {
-        perror(inputFileName);
-        return EXIT_FAILURE;
+        baseName = settings->outputFileName;
+        filteredFileSuffix = "";
+    }
+    if (channel >= 0)
+    {
+        snprintf(channelSuffix, sizeof(channelSuffix), ".%d", channel);
     }
 
-    int numOfSamples = lmsFilter_countNumberOfSamplesInFile(inputFileName);
-    if (filter->length > numOfSamples)
+    char* filteredFileName = (char*)malloc(strlen(baseName) + strlen(filteredFileSuffix) + strlen(channelSuffix) + 1);
+    if (filteredFileName != NULL)
     {
-        printf("Error: Filter length cannot be greater than number of samples in file\n");
-        fclose(fSamples);
-        return EXIT_FAILURE;
+        strcpy(filteredFileName, baseName);
+        strcat(filteredFileName, filteredFileSuffix);
+        strcat(filteredFileName, channelSuffix);
     }
+    return filteredFileName;
+}
 
-    char* filteredFileName = NULL;
-    const char* filteredFileSuffix = "filtered";
-    filteredFileName = (char*)malloc(strlen(inputFileName) + strlen(filteredFileSuffix) + 1);
-    strcpy(filteredFileName, inputFileName);
-    strcat(filteredFileName, filteredFileSuffix);
+/**
+ * @brief Allocate a filter with the same parameters as the prototype and cleared state
+ * @param prototype     Filter to copy parameters from
+ * @param allocator     Allocator of coefficients and delay line, NULL for the heap
+ * @return Allocated filter, NULL on failure
+ */
+static LmsFilter_t* lmsFilter_CreateLike(const LmsFilter_t* prototype, const LmsAllocator_t* allocator)
+{
+    LmsFilter_t* filter = (LmsFilter_t*)malloc(sizeof(LmsFilter_t));
 
-    FILE *fFiltered = fopen(filteredFileName, "w");
-    if (!fFiltered)
+    if ((filter != NULL) && (lmsFilter_InitVariant(filter, prototype->step, prototype->length, prototype->variant,
+                                                   prototype->leakage, allocator) != EXIT_SUCCESS))
     {
-        perror(filteredFileName);
-        return EXIT_FAILURE;
+        free(filter);
+        filter = NULL;
+    }
+    return filter;
+}
+
+/**
+ * @brief Release a filter created by lmsFilter_CreateLike
+ * @param filter    Filter to release, may be NULL
+ */
+static void lmsFilter_Destroy(LmsFilter_t* filter)
+{
+    if (filter != NULL)
+    {
+        lmsFilter_Free(filter);
+        free(filter);
     }
+}
+
+/**
+ * @brief Prepare a channel for filtering: buffers and output file
+ * @param channel           Channel structure
+ * @param filter            Initialized filter of the channel
+ * @param settings          File settings giving the algorithm, bands and telemetry. Engines other than
+ *                          the time-domain filter take step size and length from <filter>
+ * @param outputFileName    Name of the output file
+ * @param outputFormat      Format of the output file
+ * @param sampleRate        Sample rate of the input
+ * @param numOfThreads      Threads the engine may use, 0 for all CPUs, 1 for the filtering thread only
+ * @return EXIT_SUCCESS when prepared succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_ChannelOpen(LmsFilterChannel_t* channel, LmsFilter_t* filter, const LmsFilterFileSettings_t* settings,
+                                 const char* outputFileName, SampleFormat_t outputFormat, unsigned int sampleRate,
+                                 int numOfThreads)
+{
+    const LmsTelemetrySettings_t* telemetry = settings->telemetry;
 
-    rewind(fSamples);  /* Reset file position indicator to beginning of the file */
-    float window[filter->length];
-    int index = 0;
-    int zerosToAdd = filter->length - 1;
-    float output = 0;
-    float errror = 0;
-    int progress = 0;
+    memset(channel, 0, sizeof(*channel));
+    channel->filter = filter;
+    channel->outputFileName = outputFileName;
+    channel->nextCheckpoint = LONG_MAX;
+    channel->status = EXIT_SUCCESS;
 
-    /* Slide window through input file and print each subsequence */
-    while (index < numOfSamples)
+    const LmsEngineSettings_t engineSettings =
     {
-        if (index == 0)
-        {
-            /* Fill the first window with initial values */
-            for (int i = 0; i < filter->length; i++)
-            {
-                if (fscanf(fSamples, "%f;", &window[i]) != 1)
-                {
-                    printf("Error reading file %s\n", inputFileName);
-                    fclose(fSamples);
-                    return EXIT_FAILURE;
-                }
-            }
-        }
-        else
-        {
-            for (int i = 0; i < filter->length - 1; i++)    /* Shift window */
-            {
-                window[i] = window[i+1];
-            }
+        .algorithm = settings->algorithm,
+        .step = filter->step,
+        .length = filter->length,
+        .numOfBands = settings->numOfBands,
+        .projectionOrder = settings->projectionOrder,
+        .numOfThreads = numOfThreads,
+    };
+    if (lmsEngine_Open(&channel->engine, &engineSettings, filter) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
 
-            /* Fill last element of window with next value from file or zero if end of file is reached */
-            if (fscanf(fSamples, "%f;", &window[filter->length-1]) != 1)
-            {
-                window[filter->length-1] = 0;
-                if (--zerosToAdd < 0)
-                {
-                    break;
-                }
-            }
-        }
+    /* The filter gets samples <length> - 1 ahead of the reference, so the block buffer keeps
+     * that history in front of the new samples */
+    channel->history = filter->length - 1;
+    channel->positionBase = channel->history;
+    channel->fill = 0;
+    channel->samples = (float*)malloc((LMS_FILTER_BLOCK_SIZE + channel->history) * sizeof(float));
+    channel->output = (float*)malloc(LMS_FILTER_BLOCK_SIZE * sizeof(float));
+    channel->error = (float*)malloc(LMS_FILTER_BLOCK_SIZE * sizeof(float));
+    channel->frames = (float*)malloc(3 * LMS_FILTER_BLOCK_SIZE * sizeof(float));
+    if ((channel->samples == NULL) || (channel->output == NULL) || (channel->error == NULL) || (channel->frames == NULL))
+    {
+        printf("Error allocating filter buffers\n");
+        lmsFilter_ChannelClose(channel);
+        return EXIT_FAILURE;
+    }
 
-        retval = lmsFilter_Lms(filter, window, NULL, &output, &errror);
-        if (retval != EXIT_SUCCESS)
+    if (telemetry != NULL)
+    {
+        channel->telemetry = (LmsTelemetry_t*)malloc(sizeof(LmsTelemetry_t));
+        if ((channel->telemetry == NULL) || (lmsTelemetry_Init(channel->telemetry, telemetry, filter->length) != EXIT_SUCCESS))
         {
-            break;
+            lmsFilter_ChannelClose(channel);
+            return EXIT_FAILURE;
         }
-        fprintf(fFiltered, "%d;%.6lf;%.6lf;%.6lf;\n",index, window[0], output, errror);
-        index++;
+    }
 
-        if (((index % 10) == 0) || (index == numOfSamples))
+    if (settings->plot != NULL)
+    {
+        channel->plot = (LmsPlot_t*)malloc(sizeof(LmsPlot_t));
+        if ((channel->plot == NULL)
+            || (lmsPlot_Init(channel->plot, settings->plot, 3, lmsPlot_FilterSeriesNames()) != EXIT_SUCCESS))
         {
-            progress = ((float)index/numOfSamples)*100;
-            if (index == numOfSamples - 1)
-            {
-                progress = 100;
-            }
-            printf("LMS filtering progress:       %d%%\r", progress);
-            progress = 0;
-            fflush(stdout);
+            free(channel->plot);
+            channel->plot = NULL;
+            lmsFilter_ChannelClose(channel);
+            return EXIT_FAILURE;
         }
     }
 
-    fflush(stdout);
-    printf("\n");
-
-    if (fclose(fSamples))
-    {
-        perror(inputFileName);
-        return EXIT_FAILURE;
-    }
-    if (fclose(fFiltered))
+    /* Output frame: input, filter output, error */
+    if (sampleIo_OpenWriter(&channel->writer, outputFileName, outputFormat, 3, sampleRate) != EXIT_SUCCESS)
     {
-        perror(filteredFileName);
+        lmsFilter_ChannelClose(channel);
         return EXIT_FAILURE;
     }
+    channel->writerOpen = 1;
 
-    free(filteredFileName);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Filter samples with the engine of the channel
+ * @param channel   Channel structure
+ * @param input     Input samples
+ * @param desired   Desired samples
+ * @param output    Filter output samples
+ * @param error     Error samples
+ * @param count     Number of samples
+ * @return EXIT_SUCCESS when processed succesfully. EXIT_FAILURE when algorithm goes unstable
+ */
+static int lmsFilter_ChannelEngine(LmsFilterChannel_t* channel, const float* input, const float* desired,
+                                   float* output, float* error, int count)
+{
+    return lmsEngine_ProcessBlock(&channel->engine, input, desired, output, error, count);
+}
+
+/**
+ * @brief Push a sample into the delay line of the channel engine without filtering
+ * @param channel   Channel structure
+ * @param sample    Input sample
+ */
+static void lmsFilter_ChannelPush(LmsFilterChannel_t* channel, float sample)
+{
+    lmsEngine_PushSample(&channel->engine, sample);
+}
+
+/**
+ * @brief Update the telemetry of the channel with a filtered block
+ * @param channel   Channel structure with telemetry
+ * @param desired   Desired samples
+ * @param error     Error samples
+ * @param count     Number of samples
+ * @return Warnings raised by the block
+ */
+static int lmsFilter_ChannelObserve(LmsFilterChannel_t* channel, const float* desired, const float* error, int count)
+{
+    int raised = lmsTelemetry_Update(channel->telemetry, desired, error, count);
+
+    if (lmsTelemetry_NormDue(channel->telemetry))
+    {
+        raised |= lmsTelemetry_UpdateNorm(channel->telemetry, lmsEngine_NormSquared(&channel->engine));
+    }
+    return raised;
+}
+
+/**
+ * @brief Print telemetry warnings as they are raised
+ * @param channel   Channel structure with telemetry
+ * @param raised    Warnings raised by the last block
+ */
+static void lmsFilter_ChannelPrintWarnings(const LmsFilterChannel_t* channel, int raised)
+{
+    for (int warning = LMS_TELEMETRY_WARNING_ERROR_RISING; warning <= LMS_TELEMETRY_WARNING_NON_FINITE; warning <<= 1)
+    {
+        if (raised & warning)
+        {
+            printf("WARNING: %s: %s at sample %ld\n", channel->outputFileName, lmsTelemetry_WarningName(warning),
+                   channel->telemetry->samples);
+        }
+    }
+}
+
+/**
+ * @brief Filter a block with the engine of the channel into its output and error buffers
+ * @param channel   Channel structure
+ * @param input     Input samples
+ * @param desired   Desired samples
+ * @param count     Number of samples, at most LMS_FILTER_BLOCK_SIZE
+ */
+static void lmsFilter_ChannelFilter(LmsFilterChannel_t* channel, const float* input, const float* desired, int count)
+{
+    const int status = lmsFilter_ChannelEngine(channel, input, desired, channel->output, channel->error, count);
+
+    if (channel->telemetry != NULL)
+    {
+        lmsFilter_ChannelPrintWarnings(channel, lmsFilter_ChannelObserve(channel, desired, channel->error, count));
+    }
+    if (status != EXIT_SUCCESS)
+    {
+        printf("WARNING: Algorithm goes unstable! stopped\n");
+        channel->status = EXIT_FAILURE;
+    }
+}
+
+/**
+ * @brief Write frames of input, filter output and error of the last filtered block
+ * @param channel   Channel structure
+ * @param input     Input samples written in the first column
+ * @param count     Number of samples
+ */
+static void lmsFilter_ChannelWrite(LmsFilterChannel_t* channel, const float* input, int count)
+{
+    LmsFilterOutputBlock_t* block = NULL;
+    float* frames = channel->frames;
+
+    /* In a pipeline, frames are built in the ring slot and written by the writer thread */
+    if (channel->outputRing != NULL)
+    {
+        block = (LmsFilterOutputBlock_t*)spscRing_AcquireWrite(channel->outputRing);
+        frames = block->frames;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        frames[3 * i] = input[i];
+        frames[3 * i + 1] = channel->output[i];
+        frames[3 * i + 2] = channel->error[i];
+    }
+    if (channel->plot != NULL)
+    {
+        lmsPlot_AddFrames(channel->plot, frames, count);
+    }
+    if (block != NULL)
+    {
+        block->count = count;
+        spscRing_CommitWrite(channel->outputRing);
+    }
+    else if (sampleIo_Write(&channel->writer, frames, count) != EXIT_SUCCESS)
+    {
+        perror(channel->outputFileName);
+        channel->status = EXIT_FAILURE;
+    }
+    channel->index += count;
+}
+
+/**
+ * @brief Start a single filter channel from the resume or warm start checkpoint of the settings and
+ * keep them for saving. A resumed channel drops the input samples the saved state has already filtered
+ * @param channel   Opened channel
+ * @param settings  Checkpoint settings or NULL
+ * @param delayed   The reference is the input delayed by the channel history, which is then taken
+ *                  from the saved delay line
+ * @param quiet     Do not print the resumed position
+ * @return EXIT_SUCCESS when started succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_ChannelOpenCheckpoint(LmsFilterChannel_t* channel, const LmsCheckpointSettings_t* settings,
+                                           int delayed, int quiet)
+{
+    LmsCheckpoint_t checkpoint;
+    int retval = EXIT_SUCCESS;
+
+    channel->positionBase = delayed ? channel->history : 0;
+    if (settings == NULL)
+    {
+        return EXIT_SUCCESS;
+    }
+    channel->checkpoint = settings;
+
+    const int resume = (settings->resumeFileName != NULL);
+    const char* fileName = resume ? settings->resumeFileName : settings->warmStartFileName;
+    if (fileName != NULL)
+    {
+        if (lmsCheckpoint_Open(&checkpoint, fileName) != EXIT_SUCCESS)
+        {
+            return EXIT_FAILURE;
+        }
+        retval = lmsFilter_LoadCheckpoint(channel->filter, &checkpoint, 0, resume);
+        if ((retval == EXIT_SUCCESS) && resume)
+        {
+            channel->skip = checkpoint.header->position;
+            channel->positionBase = checkpoint.header->position;
+            if (delayed)
+            {
+                /* The newest samples of the delay line are the history in front of the next block */
+                memcpy(channel->samples, &checkpoint.window[channel->filter->length + 1 - channel->history],
+                       channel->history * sizeof(float));
+                channel->fill = channel->history;
+                channel->primed = 1;
+            }
+            if (quiet == 0)
+            {
+                printf("Resumed at input sample:      %ld\n", channel->skip);
+            }
+        }
+        lmsCheckpoint_Close(&checkpoint);
+    }
+    if (settings->interval > 0)
+    {
+        channel->nextCheckpoint = channel->positionBase + settings->interval;
+    }
+    return retval;
+}
+
+/**
+ * @brief Save the filter state of the channel to the checkpoint file, if it has one
+ * @param channel   Channel structure
+ */
+static void lmsFilter_ChannelSaveCheckpoint(LmsFilterChannel_t* channel)
+{
+    if ((channel->checkpoint != NULL) && (channel->checkpoint->saveFileName != NULL)
+        && (lmsFilter_SaveCheckpoint(channel->filter, channel->positionBase + channel->index,
+                                     channel->checkpoint->saveFileName) != EXIT_SUCCESS))
+    {
+        channel->status = EXIT_FAILURE;
+    }
+}
+
+/**
+ * @brief Save a periodic checkpoint once the filter has consumed the position of the next one
+ * @param channel   Channel structure
+ */
+static void lmsFilter_ChannelCheckpointIfDue(LmsFilterChannel_t* channel)
+{
+    const long position = channel->positionBase + channel->index;
+
+    if (position >= channel->nextCheckpoint)
+    {
+        lmsFilter_ChannelSaveCheckpoint(channel);
+        while (channel->nextCheckpoint <= position)
+        {
+            channel->nextCheckpoint += channel->checkpoint->interval;
+        }
+    }
+}
+
+/**
+ * @brief Filter samples collected in the channel buffer and write them to the output file
+ * @param channel   Channel structure
+ */
+static void lmsFilter_ChannelProcess(LmsFilterChannel_t* channel)
+{
+    const int history = channel->history;
+    const int count = channel->fill - history;
+
+    if ((count <= 0) || (channel->status != EXIT_SUCCESS))
+    {
+        return;
+    }
+
+    /* Fill the first window with initial values */
+    if (channel->primed == 0)
+    {
+        for (int i = 0; i < history; i++)
+        {
+            lmsFilter_ChannelPush(channel, channel->samples[i]);
+        }
+        channel->primed = 1;
+    }
+
+    /* The reference is the input delayed by <history> samples */
+    lmsFilter_ChannelFilter(channel, &channel->samples[history], channel->samples, count);
+    lmsFilter_ChannelWrite(channel, channel->samples, count);
+
+    memmove(channel->samples, &channel->samples[count], history * sizeof(float));
+    channel->fill = history;
+    lmsFilter_ChannelCheckpointIfDue(channel);
+}
+
+/**
+ * @brief Append input samples to the channel, filtering every full block
+ * @param channel   Channel structure
+ * @param input     Input samples
+ * @param stride    Distance between consecutive samples of the channel in <input>
+ * @param count     Number of samples
+ */
+static void lmsFilter_ChannelFeed(LmsFilterChannel_t* channel, const float* input, int stride, int count)
+{
+    const int capacity = LMS_FILTER_BLOCK_SIZE + channel->history;
+
+    channel->inputSamples += count;
+    if (channel->skip > 0)
+    {
+        const int skipped = (channel->skip < count) ? (int)channel->skip : count;
+        input += (long)skipped * stride;
+        count -= skipped;
+        channel->skip -= skipped;
+    }
+    while ((count > 0) && (channel->status == EXIT_SUCCESS))
+    {
+        int n = capacity - channel->fill;
+        if (n > count)
+        {
+            n = count;
+        }
+        float* dst = &channel->samples[channel->fill];
+        for (int i = 0; i < n; i++)
+        {
+            dst[i] = input[(long)i * stride];
+        }
+        channel->fill += n;
+        input += (long)n * stride;
+        count -= n;
+
+        if (channel->fill == capacity)
+        {
+            lmsFilter_ChannelProcess(channel);
+        }
+    }
+}
+
+/**
+ * @brief End of input: filter the rest of samples followed by <length> - 1 zeros. The final checkpoint
+ * is the state after the last input sample, so a resumed run continues as if the zeros never came
+ * @param channel   Channel structure
+ */
+static void lmsFilter_ChannelFinish(LmsFilterChannel_t* channel)
+{
+    static const float zeros[64] = { 0 };
+
+    if (channel->skip > 0)
+    {
+        printf("Error: Input ends before the position of the resumed checkpoint\n");
+        channel->status = EXIT_FAILURE;
+        return;
+    }
+    if (channel->inputSamples < channel->filter->length)
+    {
+        printf("Error: Filter length cannot be greater than number of samples in file\n");
+        channel->status = EXIT_FAILURE;
+        return;
+    }
+    if ((channel->checkpoint != NULL) && (channel->checkpoint->saveFileName != NULL))
+    {
+        lmsFilter_ChannelProcess(channel);
+        if (channel->status == EXIT_SUCCESS)
+        {
+            lmsFilter_ChannelSaveCheckpoint(channel);
+        }
+        channel->nextCheckpoint = LONG_MAX;
+    }
+    for (int left = channel->history; left > 0; left -= 64)
+    {
+        lmsFilter_ChannelFeed(channel, zeros, 1, (left < 64) ? left : 64);
+    }
+    lmsFilter_ChannelProcess(channel);
+    lmsFilter_FlushUpdate(channel->filter);
+}
+
+/**
+ * @brief Release channel buffers, filter and file names owned by the channel and close output file
+ * @param channel   Channel structure
+ * @return EXIT_SUCCESS when output file closed succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_ChannelClose(LmsFilterChannel_t* channel)
+{
+    int retval = EXIT_SUCCESS;
+
+    if (channel->writerOpen && (sampleIo_CloseWriter(&channel->writer) != EXIT_SUCCESS))
+    {
+        retval = EXIT_FAILURE;
+    }
+    if ((channel->telemetry != NULL) && (channel->telemetry->samples > 0))
+    {
+        LmsTelemetryStats_t stats;
+        lmsTelemetry_GetStats(channel->telemetry, &stats);
+        lmsTelemetry_PrintStats(&stats, channel->outputFileName);
+    }
+    free(channel->telemetry);
+    channel->telemetry = NULL;
+    if (channel->plot != NULL)
+    {
+        if ((channel->status == EXIT_SUCCESS) && (lmsPlot_Write(channel->plot, channel->outputFileName) != EXIT_SUCCESS))
+        {
+            retval = EXIT_FAILURE;
+        }
+        lmsPlot_Free(channel->plot);
+        free(channel->plot);
+        channel->plot = NULL;
+    }
+    channel->writerOpen = 0;
+    free(channel->samples);
+    free(channel->output);
+    free(channel->error);
+    free(channel->frames);
+    channel->samples = NULL;
+    channel->output = NULL;
+    channel->error = NULL;
+    channel->frames = NULL;
+    lmsEngine_Close(&channel->engine);
+    if (channel->ownsFilter)
+    {
+        lmsFilter_Destroy(channel->filter);
+        channel->filter = NULL;
+    }
+    free(channel->ownedFileName);
+    channel->ownedFileName = NULL;
+
+    return retval;
+}
+
+/**
+ * @brief Print filtering progress of a file, or the number of samples when its size is unknown
+ * @param reader    Reader of the input file
+ * @param index     Samples filtered so far
+ */
+static void lmsFilter_PrintProgress(const SampleReader_t* reader, long index)
+{
+    int progress = sampleIo_GetProgress(reader);
+    if (progress >= 0)
+    {
+        printf("LMS filtering progress:       %d%%\r", progress);
+    }
+    else
+    {
+        printf("LMS filtered samples:         %ld\r", index);
+    }
+    fflush(stdout);
+}
+
+/**
+ * @brief Reader stage: parse blocks of samples into the input ring until the end of file
+ * @param argument  Pointer to LmsFilterPipeline_t
+ * @return NULL
+ */
+static void* lmsFilter_ReaderStage(void* argument)
+{
+    LmsFilterPipeline_t* pipeline = (LmsFilterPipeline_t*)argument;
+    long samplesRead = 0;
+
+    while (__atomic_load_n(&pipeline->stop, __ATOMIC_RELAXED) == 0)
+    {
+        LmsFilterInputBlock_t* block = (LmsFilterInputBlock_t*)spscRing_AcquireWrite(&pipeline->input);
+        block->count = sampleIo_Read(pipeline->reader, block->samples, LMS_FILTER_BLOCK_SIZE);
+        if (block->count == 0)
+        {
+            break;
+        }
+        spscRing_CommitWrite(&pipeline->input);
+        samplesRead += block->count;
+
+        if (pipeline->quiet == 0)
+        {
+            lmsFilter_PrintProgress(pipeline->reader, samplesRead);
+        }
+    }
+    spscRing_Close(&pipeline->input);
+    return NULL;
+}
+
+/**
+ * @brief Writer stage: format and write frames from the output ring. After an error the ring
+ * is still drained, so the filter never waits for a free slot forever
+ * @param argument  Pointer to LmsFilterPipeline_t
+ * @return NULL
+ */
+static void* lmsFilter_WriterStage(void* argument)
+{
+    LmsFilterPipeline_t* pipeline = (LmsFilterPipeline_t*)argument;
+    const LmsFilterOutputBlock_t* block;
+
+    while ((block = (const LmsFilterOutputBlock_t*)spscRing_AcquireRead(&pipeline->output)) != NULL)
+    {
+        if ((pipeline->writeStatus == EXIT_SUCCESS)
+            && (sampleIo_Write(&pipeline->channel->writer, block->frames, block->count) != EXIT_SUCCESS))
+        {
+            perror(pipeline->channel->outputFileName);
+            pipeline->writeStatus = EXIT_FAILURE;
+            __atomic_store_n(&pipeline->stop, 1, __ATOMIC_RELAXED);
+        }
+        spscRing_ReleaseRead(&pipeline->output);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Filter a file with reading, filtering and writing on three threads. The calling thread
+ * filters, the other two stages exchange blocks with it through lock-free rings
+ * @param channel   Opened channel
+ * @param reader    Opened reader of the input file
+ * @param settings  Filter file settings
+ */
+static void lmsFilter_ChannelRunPipeline(LmsFilterChannel_t* channel, SampleReader_t* reader,
+                                         const LmsFilterFileSettings_t* settings)
+{
+    LmsFilterPipeline_t pipeline = { .reader = reader, .channel = channel, .stop = 0,
+                                     .writeStatus = EXIT_SUCCESS, .quiet = settings->quiet };
+    pthread_t readerThread;
+    pthread_t writerThread;
+
+    if (spscRing_Init(&pipeline.input, LMS_FILTER_PIPELINE_DEPTH, sizeof(LmsFilterInputBlock_t)) != EXIT_SUCCESS)
+    {
+        channel->status = EXIT_FAILURE;
+        return;
+    }
+    if (spscRing_Init(&pipeline.output, LMS_FILTER_PIPELINE_DEPTH, sizeof(LmsFilterOutputBlock_t)) != EXIT_SUCCESS)
+    {
+        spscRing_Free(&pipeline.input);
+        channel->status = EXIT_FAILURE;
+        return;
+    }
+    if (pthread_create(&readerThread, NULL, lmsFilter_ReaderStage, &pipeline) != 0)
+    {
+        perror("pthread_create");
+        spscRing_Free(&pipeline.input);
+        spscRing_Free(&pipeline.output);
+        channel->status = EXIT_FAILURE;
+        return;
+    }
+    if (pthread_create(&writerThread, NULL, lmsFilter_WriterStage, &pipeline) != 0)
+    {
+        perror("pthread_create");
+        __atomic_store_n(&pipeline.stop, 1, __ATOMIC_RELAXED);
+        while (spscRing_AcquireRead(&pipeline.input) != NULL)
+        {
+            spscRing_ReleaseRead(&pipeline.input);
+        }
+        pthread_join(readerThread, NULL);
+        spscRing_Free(&pipeline.input);
+        spscRing_Free(&pipeline.output);
+        channel->status = EXIT_FAILURE;
+        return;
+    }
+
+    channel->outputRing = &pipeline.output;
+    const LmsFilterInputBlock_t* block;
+    while ((block = (const LmsFilterInputBlock_t*)spscRing_AcquireRead(&pipeline.input)) != NULL)
+    {
+        /* After a failure the input is drained until the reader notices the stop */
+        if (channel->status == EXIT_SUCCESS)
+        {
+            lmsFilter_ChannelFeed(channel, block->samples, 1, block->count);
+        }
+        else
+        {
+            __atomic_store_n(&pipeline.stop, 1, __ATOMIC_RELAXED);
+        }
+        spscRing_ReleaseRead(&pipeline.input);
+    }
+    if (channel->status == EXIT_SUCCESS)
+    {
+        lmsFilter_ChannelFinish(channel);
+    }
+    spscRing_Close(&pipeline.output);
+
+    pthread_join(readerThread, NULL);
+    pthread_join(writerThread, NULL);
+    channel->outputRing = NULL;
+    if (pipeline.writeStatus != EXIT_SUCCESS)
+    {
+        channel->status = EXIT_FAILURE;
+    }
+    spscRing_Free(&pipeline.input);
+    spscRing_Free(&pipeline.output);
+}
+
+/**
+ * @brief Filter an input stream against a desired stream read in lock-step, either from a second
+ * file or from the second column of the input file. Blocks are read straight into the filter buffers
+ * @param filter            Pointer to LMS filter structure
+ * @param inputFileName     Name of the file containing input samples
+ * @param settings          Sample formats, output file name and desired signal source
+ * @return EXIT_SUCCESS when processed succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_FilterTwoStreams(LmsFilter_t* filter, const char* inputFileName,
+                                      const LmsFilterFileSettings_t* settings)
+{
+    int retval = EXIT_SUCCESS;
+    SampleReader_t reader;
+    SampleReader_t desiredReader;
+    LmsFilterChannel_t channel;
+    const int inputChannels = settings->twoColumn ? 2 : 1;
+
+    if (sampleIo_OpenReader(&reader, inputFileName, settings->inputFormat, inputChannels) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    if (reader.channels != inputChannels)
+    {
+        printf("Error: Input file must have %d channel(s)\n", inputChannels);
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+    if (settings->twoColumn == 0)
+    {
+        if (sampleIo_OpenReader(&desiredReader, settings->desiredFileName, settings->inputFormat, 1) != EXIT_SUCCESS)
+        {
+            sampleIo_CloseReader(&reader);
+            return EXIT_FAILURE;
+        }
+        if (desiredReader.channels != 1)
+        {
+            printf("Error: Desired signal file must have one channel\n");
+            sampleIo_CloseReader(&desiredReader);
+            sampleIo_CloseReader(&reader);
+            return EXIT_FAILURE;
+        }
+    }
+
+    char* filteredFileName = lmsFilter_OutputFileName(inputFileName, settings, -1);
+    const SampleFormat_t outputFormat = (settings->outputFormat != SAMPLE_FORMAT_UNKNOWN) ?
+                                        settings->outputFormat : reader.format;
+    float* desired = (float*)malloc(LMS_FILTER_BLOCK_SIZE * sizeof(float));
+    float* columns = settings->twoColumn ? (float*)malloc(2 * LMS_FILTER_BLOCK_SIZE * sizeof(float)) : NULL;
+
+    if ((filteredFileName == NULL) || (desired == NULL) || (settings->twoColumn && (columns == NULL))
+        || (lmsFilter_ChannelOpen(&channel, filter, settings, filteredFileName, outputFormat,
+                                  reader.sampleRate, settings->numOfThreads) != EXIT_SUCCESS))
+    {
+        free(filteredFileName);
+        free(desired);
+        free(columns);
+        if (settings->twoColumn == 0)
+        {
+            sampleIo_CloseReader(&desiredReader);
+        }
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+
+    if (lmsFilter_ChannelOpenCheckpoint(&channel, settings->checkpoint, 0, settings->quiet) != EXIT_SUCCESS)
+    {
+        channel.status = EXIT_FAILURE;
+    }
+
+    /* Input goes to the channel block buffer, no history is kept as the reference is not delayed */
+    float* input = channel.samples;
+    int desiredEnded = 0;
+    while (channel.status == EXIT_SUCCESS)
+    {
+        int count;
+        if (settings->twoColumn)
+        {
+            count = sampleIo_Read(&reader, columns, LMS_FILTER_BLOCK_SIZE);
+            for (int i = 0; i < count; i++)
+            {
+                input[i] = columns[2 * i];
+                desired[i] = columns[2 * i + 1];
+            }
+        }
+        else
+        {
+            count = sampleIo_Read(&reader, input, LMS_FILTER_BLOCK_SIZE);
+            int desiredCount = sampleIo_Read(&desiredReader, desired, count);
+            if (desiredCount < count)
+            {
+                printf("WARNING: Desired signal ends at sample %ld, before the input\n", channel.index + desiredCount);
+                count = desiredCount;
+                desiredEnded = 1;
+            }
+        }
+        if (count == 0)
+        {
+            break;
+        }
+        if (channel.skip > 0)
+        {
+            /* Frames the resumed state has already filtered */
+            const int skipped = (channel.skip < count) ? (int)channel.skip : count;
+            memmove(input, &input[skipped], (count - skipped) * sizeof(float));
+            memmove(desired, &desired[skipped], (count - skipped) * sizeof(float));
+            channel.skip -= skipped;
+            count -= skipped;
+        }
+        if (count > 0)
+        {
+            lmsFilter_ChannelFilter(&channel, input, desired, count);
+            lmsFilter_ChannelWrite(&channel, input, count);
+            lmsFilter_ChannelCheckpointIfDue(&channel);
+        }
+
+        if (settings->quiet == 0)
+        {
+            lmsFilter_PrintProgress(&reader, channel.index);
+        }
+        if (desiredEnded)
+        {
+            break;
+        }
+    }
+
+    float extra;
+    if ((settings->twoColumn == 0) && (desiredEnded == 0) && (channel.status == EXIT_SUCCESS)
+        && (sampleIo_Read(&desiredReader, &extra, 1) > 0))
+    {
+        printf("WARNING: Desired signal is longer than the input, the rest is ignored\n");
+    }
+    if ((channel.skip > 0) && (channel.status == EXIT_SUCCESS))
+    {
+        printf("Error: Input ends before the position of the resumed checkpoint\n");
+        channel.status = EXIT_FAILURE;
+    }
+    if (channel.status == EXIT_SUCCESS)
+    {
+        lmsFilter_ChannelSaveCheckpoint(&channel);
+    }
+    lmsFilter_FlushUpdate(filter);
+
+    if (settings->quiet == 0)
+    {
+        printf("\nFiltered samples:             %ld\n", channel.index);
+    }
+    retval = channel.status;
+
+    if (lmsFilter_ChannelClose(&channel) != EXIT_SUCCESS)
+    {
+        perror(filteredFileName);
+        retval = EXIT_FAILURE;
+    }
+
+    free(filteredFileName);
+    free(desired);
+    free(columns);
+    if ((settings->twoColumn == 0) && sampleIo_CloseReader(&desiredReader))
+    {
+        perror(settings->desiredFileName);
+        retval = EXIT_FAILURE;
+    }
+    if (sampleIo_CloseReader(&reader))
+    {
+        perror(inputFileName);
+        retval = EXIT_FAILURE;
+    }
+    return retval;
+}
+
+/**
+ * @brief Read the whole file into memory, so nothing but filtering is left for the real-time run
+ * @param reader    Opened reader
+ * @param samples   Allocated interleaved samples, followed by <padding> zero frames
+ * @param frames    Number of frames read, padding excluded
+ * @param padding   Zero frames appended after the last frame
+ * @return EXIT_SUCCESS when read succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_ReadAll(SampleReader_t* reader, float** samples, long* frames, int padding)
+{
+    const int channels = reader->channels;
+    long capacity = LMS_FILTER_BLOCK_SIZE;
+    long count = 0;
+    float* buffer = NULL;
+
+    for (;;)
+    {
+        if ((buffer == NULL) || (count + LMS_FILTER_BLOCK_SIZE + padding > capacity))
+        {
+            while (count + LMS_FILTER_BLOCK_SIZE + padding > capacity)
+            {
+                capacity *= 2;
+            }
+            float* grown = (float*)realloc(buffer, (size_t)capacity * channels * sizeof(float));
+            if (grown == NULL)
+            {
+                printf("Error allocating memory for samples\n");
+                free(buffer);
+                return EXIT_FAILURE;
+            }
+            buffer = grown;
+        }
+        int n = sampleIo_Read(reader, &buffer[count * channels], LMS_FILTER_BLOCK_SIZE);
+        if (n == 0)
+        {
+            break;
+        }
+        count += n;
+    }
+    memset(&buffer[count * channels], 0, (size_t)padding * channels * sizeof(float));
+    *samples = buffer;
+    *frames = count;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Real-time worker: set up its thread, then filter the signal block by block. Between the
+ * start and the end of the run it only filters and records block times, it does not allocate,
+ * print or take locks
+ * @param argument  Pointer to LmsFilterRealtimeJob_t
+ * @return NULL
+ */
+static void* lmsFilter_RealtimeWorker(void* argument)
+{
+    LmsFilterRealtimeJob_t* job = (LmsFilterRealtimeJob_t*)argument;
+    LmsRealtime_t* realtime = job->realtime;
+    const int blockSize = realtime->settings.blockSize;
+    struct timespec release;
+
+    lmsRealtime_ConfigureThread(&realtime->settings);
+    clock_gettime(CLOCK_MONOTONIC, &release);
+
+    for (long i = 0; i < job->count; i += blockSize)
+    {
+        const int count = (job->count - i < blockSize) ? (int)(job->count - i) : blockSize;
+        int status;
+
+        /* Paced blocks are released at the sample clock and timed from their release, so late
+         * wake-ups count against the deadline like they would in an audio callback */
+        if (realtime->settings.paced)
+        {
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &release, NULL);
+        }
+        const unsigned long long start = realtime->settings.paced ?
+                                         (unsigned long long)release.tv_sec * 1000000000ull + release.tv_nsec :
+                                         lmsRealtime_Now();
+
+        status = lmsFilter_ChannelEngine(job->channel, &job->input[i], &job->desired[i], &job->output[i],
+                                         &job->error[i], count);
+        lmsRealtime_Record(realtime, lmsRealtime_Now() - start);
+
+        /* Telemetry is taken outside of the timed block, its warnings are printed with the statistics */
+        if (job->channel->telemetry != NULL)
+        {
+            lmsFilter_ChannelObserve(job->channel, &job->desired[i], &job->error[i], count);
+        }
+        job->processed = i + count;
+        if (status != EXIT_SUCCESS)
+        {
+            job->status = EXIT_FAILURE;
+            break;
+        }
+
+        release.tv_nsec += (long)realtime->deadlineNs;
+        while (release.tv_nsec >= 1000000000L)
+        {
+            release.tv_nsec -= 1000000000L;
+            release.tv_sec++;
+        }
+    }
+    lmsFilter_FlushUpdate(job->channel->filter);
+    return NULL;
+}
+
+/**
+ * @brief Filter a file in real-time mode. The signal is loaded first and the output saved after
+ * the run, so the worker thread sees only the block API, as in a live audio path. Block processing
+ * times and deadline misses are printed at the end
+ * @param filter            Pointer to LMS filter structure
+ * @param inputFileName     Name of the file containing input samples
+ * @param settings          Sample formats, output file name, desired signal source and real-time settings
+ * @return EXIT_SUCCESS when processed succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_FilterRealtime(LmsFilter_t* filter, const char* inputFileName,
+                                    const LmsFilterFileSettings_t* settings)
+{
+    int retval = EXIT_SUCCESS;
+    SampleReader_t reader;
+    LmsFilterChannel_t channel;
+    LmsRealtimeSettings_t realtimeSettings = *settings->realtime;
+    LmsRealtime_t* realtime = NULL;
+    LmsFilterRealtimeJob_t job = { .channel = &channel, .status = EXIT_SUCCESS };
+    const int twoStreams = (settings->desiredFileName != NULL) || settings->twoColumn;
+    const int inputChannels = settings->twoColumn ? 2 : 1;
+    float* samples = NULL;
+    float* desired = NULL;
+    float* results = NULL;
+    long frames = 0;
+
+    if ((settings->checkpoint != NULL)
+        && ((settings->checkpoint->resumeFileName != NULL) || (settings->checkpoint->saveFileName != NULL)))
+    {
+        printf("Error: A real-time run can only warm start from a checkpoint\n");
+        return EXIT_FAILURE;
+    }
+    if (sampleIo_OpenReader(&reader, inputFileName, settings->inputFormat, inputChannels) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    if (reader.channels != inputChannels)
+    {
+        printf("Error: Input file must have %d channel(s)\n", inputChannels);
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+
+    /* Without a desired signal the input is followed by <length> - 1 zeros, as in the streaming path */
+    const int history = twoStreams ? 0 : filter->length - 1;
+    retval = lmsFilter_ReadAll(&reader, &samples, &frames, history);
+    if (sampleIo_CloseReader(&reader))
+    {
+        perror(inputFileName);
+        retval = EXIT_FAILURE;
+    }
+    if (retval != EXIT_SUCCESS)
+    {
+        free(samples);
+        return EXIT_FAILURE;
+    }
+
+    if (settings->twoColumn)
+    {
+        desired = (float*)malloc((frames + 1) * sizeof(float));
+        if (desired == NULL)
+        {
+            printf("Error allocating memory for samples\n");
+            free(samples);
+            return EXIT_FAILURE;
+        }
+        for (long i = 0; i < frames; i++)
+        {
+            samples[i] = samples[2 * i];
+            desired[i] = samples[2 * i + 1];
+        }
+    }
+    else if (settings->desiredFileName != NULL)
+    {
+        SampleReader_t desiredReader;
+        long desiredFrames = 0;
+
+        if (sampleIo_OpenReader(&desiredReader, settings->desiredFileName, settings->inputFormat, 1) != EXIT_SUCCESS)
+        {
+            free(samples);
+            return EXIT_FAILURE;
+        }
+        if ((desiredReader.channels != 1)
+            || (lmsFilter_ReadAll(&desiredReader, &desired, &desiredFrames, 0) != EXIT_SUCCESS))
+        {
+            if (desiredReader.channels != 1)
+            {
+                printf("Error: Desired signal file must have one channel\n");
+            }
+            sampleIo_CloseReader(&desiredReader);
+            free(samples);
+            return EXIT_FAILURE;
+        }
+        sampleIo_CloseReader(&desiredReader);
+        if (desiredFrames < frames)
+        {
+            printf("WARNING: Desired signal ends at sample %ld, before the input\n", desiredFrames);
+            frames = desiredFrames;
+        }
+        else if (desiredFrames > frames)
+        {
+            printf("WARNING: Desired signal is longer than the input, the rest is ignored\n");
+        }
+    }
+    else if (frames < filter->length)
+    {
+        printf("Error: Filter length cannot be greater than number of samples in file\n");
+        free(samples);
+        return EXIT_FAILURE;
+    }
+
+    if (realtimeSettings.sampleRate == 0)
+    {
+        realtimeSettings.sampleRate = reader.sampleRate;
+    }
+    char* filteredFileName = lmsFilter_OutputFileName(inputFileName, settings, -1);
+    const SampleFormat_t outputFormat = (settings->outputFormat != SAMPLE_FORMAT_UNKNOWN) ?
+                                        settings->outputFormat : reader.format;
+    realtime = (LmsRealtime_t*)malloc(sizeof(LmsRealtime_t));
+    results = (float*)malloc(2 * (frames + 1) * sizeof(float));
+
+    if ((filteredFileName == NULL) || (realtime == NULL) || (results == NULL)
+        || (lmsRealtime_Init(realtime, &realtimeSettings) != EXIT_SUCCESS)
+        || (lmsFilter_ChannelOpen(&channel, filter, settings, filteredFileName, outputFormat,
+                                  reader.sampleRate, 1) != EXIT_SUCCESS))
+    {
+        free(filteredFileName);
+        free(realtime);
+        free(results);
+        free(desired);
+        free(samples);
+        return EXIT_FAILURE;
+    }
+    if (lmsFilter_ChannelOpenCheckpoint(&channel, settings->checkpoint, !twoStreams, settings->quiet) != EXIT_SUCCESS)
+    {
+        lmsFilter_ChannelClose(&channel);
+        free(filteredFileName);
+        free(realtime);
+        free(results);
+        free(desired);
+        free(samples);
+        return EXIT_FAILURE;
+    }
+
+    /* Prime the window with the first <length> - 1 samples, the reference lags them */
+    for (int i = 0; i < history; i++)
+    {
+        lmsFilter_ChannelPush(&channel, samples[i]);
+    }
+    job.input = &samples[history];
+    job.desired = twoStreams ? desired : samples;
+    job.output = results;
+    job.error = &results[frames + 1];
+    job.count = frames;
+    job.realtime = realtime;
+
+    pthread_t worker;
+    if (pthread_create(&worker, NULL, lmsFilter_RealtimeWorker, &job) != 0)
+    {
+        perror("pthread_create");
+        job.status = EXIT_FAILURE;
+    }
+    else
+    {
+        pthread_join(worker, NULL);
+    }
+    if (job.status != EXIT_SUCCESS)
+    {
+        printf("WARNING: Algorithm goes unstable! stopped\n");
+        retval = EXIT_FAILURE;
+    }
+
+    /* Output of the processed blocks, the first column is the reference of each sample */
+    const float* firstColumn = twoStreams ? samples : job.desired;
+    for (long i = 0; (i < job.processed) && (retval == EXIT_SUCCESS); i += LMS_FILTER_BLOCK_SIZE)
+    {
+        const int count = (job.processed - i < LMS_FILTER_BLOCK_SIZE) ? (int)(job.processed - i) : LMS_FILTER_BLOCK_SIZE;
+        for (int j = 0; j < count; j++)
+        {
+            channel.frames[3 * j] = firstColumn[i + j];
+            channel.frames[3 * j + 1] = job.output[i + j];
+            channel.frames[3 * j + 2] = job.error[i + j];
+        }
+        if (channel.plot != NULL)
+        {
+            lmsPlot_AddFrames(channel.plot, channel.frames, count);
+        }
+        if (sampleIo_Write(&channel.writer, channel.frames, count) != EXIT_SUCCESS)
+        {
+            perror(filteredFileName);
+            retval = EXIT_FAILURE;
+        }
+    }
+
+    if (settings->quiet == 0)
+    {
+        LmsRealtimeStats_t stats;
+        lmsRealtime_GetStats(realtime, &stats);
+        printf("Filtered samples:             %ld\n", job.processed);
+        printf("Block size:                   %d samples at %u Hz\n", realtimeSettings.blockSize,
+               realtimeSettings.sampleRate);
+        lmsRealtime_PrintStats(&stats);
+    }
+
+    if (lmsFilter_ChannelClose(&channel) != EXIT_SUCCESS)
+    {
+        perror(filteredFileName);
+        retval = EXIT_FAILURE;
+    }
+    free(filteredFileName);
+    free(realtime);
+    free(results);
+    free(desired);
+    free(samples);
+    return retval;
+}
+
+/**
+ * @brief Thread pool job filtering one channel of an interleaved block
+ * @param argument  Pointer to LmsFilterChannelJob_t
+ */
+static void lmsFilter_ChannelTask(void* argument)
+{
+    LmsFilterChannelJob_t* job = (LmsFilterChannelJob_t*)argument;
+
+    if (job->count > 0)
+    {
+        lmsFilter_ChannelFeed(job->channel, job->input, job->stride, job->count);
+    }
+    else
+    {
+        lmsFilter_ChannelFinish(job->channel);
+    }
+}
+
+int lmsFilter_FilterSignalAndSaveToFile(LmsFilter_t* filter, const char* inputFileName,
+                                        const LmsFilterFileSettings_t* settings)
+{
+    int retval = EXIT_SUCCESS;
+    SampleReader_t reader;
+    LmsFilterChannel_t channel;
+
+    if (settings->realtime != NULL)
+    {
+        return lmsFilter_FilterRealtime(filter, inputFileName, settings);
+    }
+    if ((settings->desiredFileName != NULL) || settings->twoColumn)
+    {
+        return lmsFilter_FilterTwoStreams(filter, inputFileName, settings);
+    }
+    if (sampleIo_OpenReader(&reader, inputFileName, settings->inputFormat, 1) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    if (reader.channels != 1)
+    {
+        printf("Error: Input file must have one channel, use --channels for interleaved files\n");
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+
+    char* filteredFileName = lmsFilter_OutputFileName(inputFileName, settings, -1);
+    const SampleFormat_t outputFormat = (settings->outputFormat != SAMPLE_FORMAT_UNKNOWN) ?
+                                        settings->outputFormat : reader.format;
+    float* samples = (float*)malloc(LMS_FILTER_BLOCK_SIZE * sizeof(float));
+
+    if ((filteredFileName == NULL) || (samples == NULL)
+        || (lmsFilter_ChannelOpen(&channel, filter, settings, filteredFileName, outputFormat,
+                                  reader.sampleRate, settings->numOfThreads) != EXIT_SUCCESS))
+    {
+        free(filteredFileName);
+        free(samples);
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+
+    if (lmsFilter_ChannelOpenCheckpoint(&channel, settings->checkpoint, 1, settings->quiet) != EXIT_SUCCESS)
+    {
+        channel.status = EXIT_FAILURE;
+    }
+    else if (settings->pipelined)
+    {
+        lmsFilter_ChannelRunPipeline(&channel, &reader, settings);
+    }
+    else
+    {
+        /* Single pass through the input, until the end of file */
+        while (channel.status == EXIT_SUCCESS)
+        {
+            int count = sampleIo_Read(&reader, samples, LMS_FILTER_BLOCK_SIZE);
+            if (count == 0)
+            {
+                break;
+            }
+            lmsFilter_ChannelFeed(&channel, samples, 1, count);
+
+            if (settings->quiet == 0)
+            {
+                lmsFilter_PrintProgress(&reader, channel.index);
+            }
+        }
+        lmsFilter_ChannelFinish(&channel);
+    }
+
+    if (settings->quiet == 0)
+    {
+        printf("\nFiltered samples:             %ld\n", channel.index);
+    }
+    retval = channel.status;
+
+    free(samples);
+    if (lmsFilter_ChannelClose(&channel) != EXIT_SUCCESS)
+    {
+        perror(filteredFileName);
+        retval = EXIT_FAILURE;
+    }
+    if (sampleIo_CloseReader(&reader))
+    {
+        perror(inputFileName);
+        retval = EXIT_FAILURE;
+    }
+    free(filteredFileName);
+
+    return retval;
+}
+
+/**
+ * @brief Open the warm start checkpoint of a multi-channel run. It holds a row for every channel
+ * or a single row shared by all of them
+ * @param checkpoint        Checkpoint, its header is left NULL when the run does not warm start
+ * @param settings          Checkpoint settings or NULL
+ * @param length            Filter length of every channel
+ * @param numOfChannels     Channels of the input
+ * @return EXIT_SUCCESS when opened succesfully or not needed. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_OpenWarmStart(LmsCheckpoint_t* checkpoint, const LmsCheckpointSettings_t* settings,
+                                   int length, int numOfChannels)
+{
+    memset(checkpoint, 0, sizeof(*checkpoint));
+    if ((settings == NULL) || (settings->warmStartFileName == NULL))
+    {
+        return EXIT_SUCCESS;
+    }
+    if (lmsCheckpoint_Open(checkpoint, settings->warmStartFileName) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    const LmsCheckpointHeader_t* header = checkpoint->header;
+    if (((int)header->length != length) || ((header->numOfChannels != 1) && ((int)header->numOfChannels != numOfChannels)))
+    {
+        printf("Error: Checkpoint holds %u channel(s) of length %u, expected %d of length %d\n",
+               header->numOfChannels, header->length, numOfChannels, length);
+        lmsCheckpoint_Close(checkpoint);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Coefficient row of a channel in the warm start checkpoint of a multi-channel run
+ * @param checkpoint    Opened checkpoint
+ * @param channel       Channel number
+ * @return Row of the channel, or the only row
+ */
+static int lmsFilter_WarmStartRow(const LmsCheckpoint_t* checkpoint, int channel)
+{
+    return (checkpoint->header->numOfChannels == 1) ? 0 : channel;
+}
+
+/**
+ * @brief Allocate a checkpoint for the coefficients of every channel of a multi-channel run
+ * @param checkpoint        Checkpoint to create, rows are filled by the caller
+ * @param prototype         Filter with parameters used for every channel
+ * @param numOfChannels     Number of channels
+ * @param position          Input frames consumed
+ * @return EXIT_SUCCESS when created succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_CreateChannelsCheckpoint(LmsCheckpoint_t* checkpoint, const LmsFilter_t* prototype,
+                                              int numOfChannels, long position)
+{
+    if (lmsCheckpoint_Create(checkpoint, numOfChannels, prototype->length, 0) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    lmsFilter_DescribeCheckpoint(checkpoint->header, prototype, position);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Filter all channels of an interleaved file with one SoA filter bank on the calling thread
+ * @param prototype         Filter with parameters used for every channel
+ * @param inputFileName     Name of the file containing interleaved input samples
+ * @param settings          Sample formats and number of channels
+ * @return EXIT_SUCCESS when all channels processed succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int lmsFilter_FilterInterleavedFileBank(const LmsFilter_t* prototype, const char* inputFileName,
+                                               const LmsFilterFileSettings_t* settings)
+{
+    int retval = EXIT_SUCCESS;
+    SampleReader_t reader;
+    LmsFilterBank_t bank;
+
+    if (sampleIo_OpenReader(&reader, inputFileName, settings->inputFormat, settings->channels) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    const int numOfChannels = reader.channels;
+    const int history = prototype->length - 1;
+    const int capacity = LMS_FILTER_BLOCK_SIZE + history;
+    const SampleFormat_t outputFormat = (settings->outputFormat != SAMPLE_FORMAT_UNKNOWN) ?
+                                        settings->outputFormat : reader.format;
+
+    if (lmsFilterBank_Init(&bank, prototype->step, prototype->length, numOfChannels) != EXIT_SUCCESS)
+    {
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+
+    /* Checkpoint rows are transposed into the tap-major coefficients of the bank */
+    LmsCheckpoint_t checkpoint;
+    if (lmsFilter_OpenWarmStart(&checkpoint, settings->checkpoint, prototype->length, numOfChannels) != EXIT_SUCCESS)
+    {
+        lmsFilterBank_Free(&bank);
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+    if (checkpoint.header != NULL)
+    {
+        for (int c = 0; c < numOfChannels; c++)
+        {
+            const float* row = lmsCheckpoint_Row(&checkpoint, lmsFilter_WarmStartRow(&checkpoint, c));
+            for (int k = 0; k < prototype->length; k++)
+            {
+                bank.coefficients[(size_t)k * bank.stride + c] = row[k];
+            }
+        }
+        lmsCheckpoint_Close(&checkpoint);
+    }
+
+    SampleWriter_t* writers = (SampleWriter_t*)calloc(numOfChannels, sizeof(SampleWriter_t));
+    float* samples = (float*)calloc((size_t)capacity * numOfChannels, sizeof(float));
+    float* output = (float*)malloc((size_t)LMS_FILTER_BLOCK_SIZE * numOfChannels * sizeof(float));
+    float* error = (float*)malloc((size_t)LMS_FILTER_BLOCK_SIZE * numOfChannels * sizeof(float));
+    float* frames = (float*)malloc(3 * LMS_FILTER_BLOCK_SIZE * sizeof(float));
+    if ((writers == NULL) || (samples == NULL) || (output == NULL) || (error == NULL) || (frames == NULL))
+    {
+        printf("Error allocating filter buffers\n");
+        retval = EXIT_FAILURE;
+    }
+
+    int opened = 0;
+    for (; (retval == EXIT_SUCCESS) && (opened < numOfChannels); opened++)
+    {
+        char* filteredFileName = lmsFilter_OutputFileName(inputFileName, settings, opened);
+        if ((filteredFileName == NULL)
+            || (sampleIo_OpenWriter(&writers[opened], filteredFileName, outputFormat, 3,
+                                    reader.sampleRate) != EXIT_SUCCESS))
+        {
+            retval = EXIT_FAILURE;
+        }
+        free(filteredFileName);
+        if (retval != EXIT_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    if ((retval == EXIT_SUCCESS) && (settings->quiet == 0))
+    {
+        printf("Channels:                     %d\n", numOfChannels);
+        printf("Filter bank kernel:           %s\n", bank.kernel->name);
+    }
+
+    /* Same block scheme as for a single channel, with frames in place of samples */
+    long index = 0;
+    long inputFrames = 0;
+    int fill = 0;
+    int zerosToAdd = history;
+    int primed = 0;
+    while (retval == EXIT_SUCCESS)
+    {
+        int count = sampleIo_Read(&reader, &samples[(size_t)fill * numOfChannels], capacity - fill);
+        inputFrames += count;
+        fill += count;
+        if (fill < capacity)
+        {
+            if ((count == 0) && (inputFrames < prototype->length))
+            {
+                printf("Error: Filter length cannot be greater than number of samples in file\n");
+                retval = EXIT_FAILURE;
+                break;
+            }
+            if (count > 0)
+            {
+                continue;
+            }
+            int zeros = (zerosToAdd < capacity - fill) ? zerosToAdd : (capacity - fill);
+            memset(&samples[(size_t)fill * numOfChannels], 0, (size_t)zeros * numOfChannels * sizeof(float));
+            fill += zeros;
+            zerosToAdd -= zeros;
+        }
+
+        const int block = fill - history;
+        if (block <= 0)
+        {
+            break;
+        }
+        if (primed == 0)
+        {
+            for (int i = 0; i < history; i++)
+            {
+                lmsFilterBank_PushFrame(&bank, &samples[(size_t)i * numOfChannels]);
+            }
+            primed = 1;
+        }
+        if (lmsFilterBank_ProcessFrames(&bank, &samples[(size_t)history * numOfChannels], samples,
+                                        output, error, block) != EXIT_SUCCESS)
+        {
+            printf("WARNING: Algorithm goes unstable! stopped\n");
+            retval = EXIT_FAILURE;
+        }
+
+        for (int c = 0; c < numOfChannels; c++)
+        {
+            for (int i = 0; i < block; i++)
+            {
+                const size_t at = (size_t)i * numOfChannels + c;
+                frames[3 * i] = samples[at];
+                frames[3 * i + 1] = output[at];
+                frames[3 * i + 2] = error[at];
+            }
+            if (sampleIo_Write(&writers[c], frames, block) != EXIT_SUCCESS)
+            {
+                perror("write");
+                retval = EXIT_FAILURE;
+            }
+        }
+        memmove(samples, &samples[(size_t)block * numOfChannels], (size_t)history * numOfChannels * sizeof(float));
+        fill = history;
+        index += block;
+
+        if ((settings->quiet == 0) && (zerosToAdd == history))
+        {
+            lmsFilter_PrintProgress(&reader, index);
+        }
+        if (zerosToAdd == 0)
+        {
+            break;
+        }
+    }
+    lmsFilterBank_FlushUpdate(&bank);
+
+    if ((retval == EXIT_SUCCESS) && (settings->checkpoint != NULL) && (settings->checkpoint->saveFileName != NULL))
+    {
+        retval = lmsFilter_CreateChannelsCheckpoint(&checkpoint, prototype, numOfChannels, inputFrames);
+        if (retval == EXIT_SUCCESS)
+        {
+            for (int c = 0; c < numOfChannels; c++)
+            {
+                float* row = lmsCheckpoint_Row(&checkpoint, c);
+                for (int k = 0; k < prototype->length; k++)
+                {
+                    row[k] = bank.coefficients[(size_t)k * bank.stride + c];
+                }
+            }
+            retval = lmsCheckpoint_Write(&checkpoint, settings->checkpoint->saveFileName);
+            lmsCheckpoint_Close(&checkpoint);
+        }
+    }
+
+    if (settings->quiet == 0)
+    {
+        printf("\nFiltered samples per channel: %ld\n", index);
+    }
+
+    for (int c = 0; c < opened; c++)
+    {
+        if (sampleIo_CloseWriter(&writers[c]) != EXIT_SUCCESS)
+        {
+            retval = EXIT_FAILURE;
+        }
+    }
+    free(writers);
+    free(samples);
+    free(output);
+    free(error);
+    free(frames);
+    lmsFilterBank_Free(&bank);
+    if (sampleIo_CloseReader(&reader))
+    {
+        perror(inputFileName);
+        retval = EXIT_FAILURE;
+    }
+    return retval;
+}
+
+int lmsFilter_FilterInterleavedFile(const LmsFilter_t* prototype, const char* inputFileName,
+                                    const LmsFilterFileSettings_t* settings)
+{
+    int retval = EXIT_SUCCESS;
+    SampleReader_t reader;
+    ThreadPool_t pool;
+
+    if ((settings->desiredFileName != NULL) || settings->twoColumn)
+    {
+        printf("Error: Desired signal stream is supported for a single input channel only\n");
+        return EXIT_FAILURE;
+    }
+    if ((settings->checkpoint != NULL) && (settings->checkpoint->resumeFileName != NULL))
+    {
+        printf("Error: Only a single input channel can be resumed from a checkpoint\n");
+        return EXIT_FAILURE;
+    }
+    if (settings->plot != NULL)
+    {
+        printf("Error: Plot is supported for a single input channel only\n");
+        return EXIT_FAILURE;
+    }
+    if (settings->useBank)
+    {
+        if (settings->algorithm != LMS_FILTER_ALGORITHM_LMS)
+        {
+            printf("Error: Filter bank supports the lms algorithm only\n");
+            return EXIT_FAILURE;
+        }
+        return lmsFilter_FilterInterleavedFileBank(prototype, inputFileName, settings);
+    }
+    if (sampleIo_OpenReader(&reader, inputFileName, settings->inputFormat, settings->channels) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    const int numOfChannels = reader.channels;      /* WAV header wins over --channels */
+    const SampleFormat_t outputFormat = (settings->outputFormat != SAMPLE_FORMAT_UNKNOWN) ?
+                                        settings->outputFormat : reader.format;
+
+    LmsCheckpoint_t checkpoint;
+    if (lmsFilter_OpenWarmStart(&checkpoint, settings->checkpoint, prototype->length, numOfChannels) != EXIT_SUCCESS)
+    {
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+
+    /* The filters of all channels are carved from one arena, each one starts on its own cache line */
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+    const size_t arenaBytes = (size_t)numOfChannels * lmsFilter_RequiredMemory(prototype->length);
+    void* arenaMemory = heap->allocate(heap->context, arenaBytes, LMS_ALLOCATOR_ALIGNMENT);
+    LmsArena_t arena;
+    lmsArena_Init(&arena, arenaMemory, (arenaMemory != NULL) ? arenaBytes : 0);
+    const LmsAllocator_t arenaAllocator = lmsArena_Allocator(&arena);
+
+    LmsFilterChannel_t* channels = (LmsFilterChannel_t*)calloc(numOfChannels, sizeof(LmsFilterChannel_t));
+    LmsFilterChannelJob_t* jobs = (LmsFilterChannelJob_t*)calloc(numOfChannels, sizeof(LmsFilterChannelJob_t));
+    float* frames[2];
+    frames[0] = (float*)malloc(LMS_FILTER_BLOCK_SIZE * numOfChannels * sizeof(float));
+    frames[1] = (float*)malloc(LMS_FILTER_BLOCK_SIZE * numOfChannels * sizeof(float));
+    if ((arenaMemory == NULL) || (channels == NULL) || (jobs == NULL) || (frames[0] == NULL) || (frames[1] == NULL))
+    {
+        printf("Error allocating filter buffers\n");
+        retval = EXIT_FAILURE;
+    }
+
+    int opened = 0;
+    for (; (retval == EXIT_SUCCESS) && (opened < numOfChannels); opened++)
+    {
+        LmsFilter_t* filter = lmsFilter_CreateLike(prototype, &arenaAllocator);
+        char* filteredFileName = lmsFilter_OutputFileName(inputFileName, settings, opened);
+
+        if ((filter == NULL) || (filteredFileName == NULL)
+            || (lmsFilter_ChannelOpen(&channels[opened], filter, settings, filteredFileName,
+                                      outputFormat, reader.sampleRate, 1) != EXIT_SUCCESS))
+        {
+            lmsFilter_Destroy(filter);
+            free(filteredFileName);
+            retval = EXIT_FAILURE;
+            break;
+        }
+        channels[opened].ownsFilter = 1;
+        channels[opened].ownedFileName = filteredFileName;
+        if ((checkpoint.header != NULL)
+            && (lmsFilter_LoadCheckpoint(filter, &checkpoint, lmsFilter_WarmStartRow(&checkpoint, opened), 0) != EXIT_SUCCESS))
+        {
+            retval = EXIT_FAILURE;
+        }
+    }
+    lmsCheckpoint_Close(&checkpoint);
+
+    if ((retval == EXIT_SUCCESS) && (threadPool_Init(&pool, settings->numOfThreads) != EXIT_SUCCESS))
+    {
+        retval = EXIT_FAILURE;
+    }
+
+    if (retval == EXIT_SUCCESS)
+    {
+        if (settings->quiet == 0)
+        {
+            printf("Channels:                     %d\n", numOfChannels);
+            printf("Worker threads:               %d\n", pool.numOfThreads);
+        }
+
+        /* Every channel of a block is filtered by a separate job. Meanwhile the next block is read */
+        int current = 0;
+        int count = sampleIo_Read(&reader, frames[current], LMS_FILTER_BLOCK_SIZE);
+        for (;;)
+        {
+            for (int c = 0; c < numOfChannels; c++)
+            {
+                jobs[c].channel = &channels[c];
+                jobs[c].input = &frames[current][c];
+                jobs[c].stride = numOfChannels;
+                jobs[c].count = count;
+                threadPool_Submit(&pool, lmsFilter_ChannelTask, &jobs[c]);
+            }
+            if (count == 0)
+            {
+                threadPool_Wait(&pool);
+                break;
+            }
+
+            int next = sampleIo_Read(&reader, frames[current ^ 1], LMS_FILTER_BLOCK_SIZE);
+            threadPool_Wait(&pool);
+            current ^= 1;
+            count = next;
+
+            if (settings->quiet == 0)
+            {
+                lmsFilter_PrintProgress(&reader, channels[0].index);
+            }
+        }
+        threadPool_Destroy(&pool);
+
+        if (settings->quiet == 0)
+        {
+            printf("\nFiltered samples per channel: %ld\n", channels[0].index);
+        }
+    }
+
+    /* Coefficients of every channel, flushed when the channel finished */
+    if ((retval == EXIT_SUCCESS) && (settings->checkpoint != NULL) && (settings->checkpoint->saveFileName != NULL))
+    {
+        int failed = 0;
+        for (int c = 0; c < numOfChannels; c++)
+        {
+            failed |= (channels[c].status != EXIT_SUCCESS);
+        }
+        if (failed == 0)
+        {
+            retval = lmsFilter_CreateChannelsCheckpoint(&checkpoint, prototype, numOfChannels, channels[0].index);
+        }
+        if ((failed == 0) && (retval == EXIT_SUCCESS))
+        {
+            for (int c = 0; c < numOfChannels; c++)
+            {
+                memcpy(lmsCheckpoint_Row(&checkpoint, c), channels[c].filter->coefficients,
+                       (size_t)prototype->length * sizeof(float));
+            }
+            retval = lmsCheckpoint_Write(&checkpoint, settings->checkpoint->saveFileName);
+            lmsCheckpoint_Close(&checkpoint);
+        }
+    }
+
+    for (int c = 0; c < opened; c++)
+    {
+        if (channels[c].status != EXIT_SUCCESS)
+        {
+            printf("Channel %d failed\n", c);
+            retval = EXIT_FAILURE;
+        }
+        if (lmsFilter_ChannelClose(&channels[c]) != EXIT_SUCCESS)
+        {
+            retval = EXIT_FAILURE;
+        }
+    }
+    free(channels);
+    free(jobs);
+    free(frames[0]);
+    free(frames[1]);
+    if (arenaMemory != NULL)
+    {
+        heap->release(heap->context, arenaMemory);      /* filters of the channels were closed above */
+    }
+    if (sampleIo_CloseReader(&reader))
+    {
+        perror(inputFileName);
+        retval = EXIT_FAILURE;
+    }
+    return retval;
+}
+
+/**
+ * @brief Thread pool job filtering one file of the batch
+ * @param argument  Pointer to LmsFilterFileJob_t
+ */
+static void lmsFilter_FileTask(void* argument)
+{
+    LmsFilterFileJob_t* job = (LmsFilterFileJob_t*)argument;
+    LmsFilter_t* filter = lmsFilter_CreateLike(job->prototype, NULL);
+
+    job->status = EXIT_FAILURE;
+    if (filter != NULL)
+    {
+        job->status = lmsFilter_FilterSignalAndSaveToFile(filter, job->inputFileName, job->settings);
+        lmsFilter_Destroy(filter);
+    }
+
+    int done = __atomic_add_fetch(job->filesDone, 1, __ATOMIC_RELAXED);
+    if (job->settings->quiet == 0)
+    {
+        printf("Filtered files:               %d/%d\r", done, job->numOfFiles);
+        fflush(stdout);
+    }
+}
+
+int lmsFilter_FilterFiles(const LmsFilter_t* prototype, const char* const* inputFileNames, int numOfFiles,
+                          const LmsFilterFileSettings_t* settings)
+{
+    int retval = EXIT_SUCCESS;
+    ThreadPool_t pool;
+    int filesDone = 0;
+
+    /* Files of a batch are filtered as one channel each */
+    if ((settings->channels > 1) || settings->useBank)
+    {
+        printf("Error: Interleaved channels are not supported for a batch of files\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Every file gets its own output name, workers do not print progress of single files */
+    LmsFilterFileSettings_t fileSettings = *settings;
+    fileSettings.outputFileName = NULL;
+    fileSettings.quiet = 1;
+    fileSettings.pipelined = 0;         /* files are already filtered in parallel */
+    fileSettings.numOfThreads = 1;      /* subband engines adapt their bands on the file worker */
+    fileSettings.plot = NULL;           /* every file would overwrite the same plot */
+
+    LmsFilterFileJob_t* jobs = (LmsFilterFileJob_t*)calloc(numOfFiles, sizeof(LmsFilterFileJob_t));
+    if (jobs == NULL)
+    {
+        printf("Error allocating filter jobs\n");
+        return EXIT_FAILURE;
+    }
+    if (threadPool_Init(&pool, settings->numOfThreads) != EXIT_SUCCESS)
+    {
+        free(jobs);
+        return EXIT_FAILURE;
+    }
+    if (settings->quiet == 0)
+    {
+        printf("Input files:                  %d\n", numOfFiles);
+        printf("Worker threads:               %d\n", pool.numOfThreads);
+    }
+
+    for (int i = 0; i < numOfFiles; i++)
+    {
+        jobs[i].prototype = prototype;
+        jobs[i].inputFileName = inputFileNames[i];
+        jobs[i].settings = &fileSettings;
+        jobs[i].filesDone = &filesDone;
+        jobs[i].numOfFiles = numOfFiles;
+        jobs[i].status = EXIT_FAILURE;
+        if (threadPool_Submit(&pool, lmsFilter_FileTask, &jobs[i]) != EXIT_SUCCESS)
+        {
+            break;
+        }
+    }
+    threadPool_Wait(&pool);
+    threadPool_Destroy(&pool);
+
+    if (settings->quiet == 0)
+    {
+        printf("\n");
+    }
+    for (int i = 0; i < numOfFiles; i++)
+    {
+        if (jobs[i].status != EXIT_SUCCESS)
+        {
+            printf("Filtering failed: %s\n", inputFileNames[i]);
+            retval = EXIT_FAILURE;
+        }
+    }
+    free(jobs);
 
     return retval;
 }
@@ -0,0 +1,152 @@
+/**
+ * @file lmsFilterBank.c
+ * @author shed258
+ * @brief Multi-channel LMS filter bank source file
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "lmsAllocator.h"
+#include "lmsFilterBank.h"
+
+/**
+ * @brief Store a frame in the delay lines of all channels. Same mirrored layout as the single
+ * filter, with a row of <stride> channels in place of a sample
+ * @param bank      Filter bank structure
+ * @param frame     <numOfChannels> input samples
+ */
+static inline void lmsFilterBank_DelayLinePush(LmsFilterBank_t* bank, const float* frame)
+{
+    const int size = bank->length + 1;
+    float* row = &bank->delayLine[(size_t)bank->delayIndex * bank->stride];
+    float* mirror = &bank->delayLine[(size_t)(bank->delayIndex + size) * bank->stride];
+
+    memcpy(row, frame, bank->numOfChannels * sizeof(float));
+    memcpy(mirror, frame, bank->numOfChannels * sizeof(float));
+
+    if (++bank->delayIndex == size)
+    {
+        bank->delayIndex = 0;
+    }
+}
+
+int lmsFilterBank_Init(LmsFilterBank_t* bank, float step, int length, int numOfChannels)
+{
+    if ((bank == NULL) || (length < 1) || (numOfChannels < 1))
+    {
+        printf("Wrong filter bank parameters\n");
+        return EXIT_FAILURE;
+    }
+
+    memset(bank, 0, sizeof(*bank));
+    bank->step = step;
+    bank->length = length;
+    bank->numOfChannels = numOfChannels;
+    bank->stride = (numOfChannels + LMS_KERNEL_BANK_LANES - 1) / LMS_KERNEL_BANK_LANES * LMS_KERNEL_BANK_LANES;
+    bank->kernel = lmsKernel_GetBest();
+
+    /* Rows are multiples of 16 floats, so every array below starts 64-byte aligned */
+    const size_t rowBytes = (size_t)bank->stride * sizeof(float);
+    const size_t numOfRows = (size_t)length + 2 * ((size_t)length + 1) + 2;
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+    bank->memory = heap->allocate(heap->context, numOfRows * rowBytes, LMS_ALLOCATOR_ALIGNMENT);
+    if (bank->memory == NULL)
+    {
+        printf("Error allocating filter bank\n");
+        return EXIT_FAILURE;
+    }
+    memset(bank->memory, 0, numOfRows * rowBytes);
+
+    bank->coefficients = (float*)bank->memory;
+    bank->delayLine = &bank->coefficients[(size_t)length * bank->stride];
+    bank->pendingGain = &bank->delayLine[2 * ((size_t)length + 1) * bank->stride];
+    bank->output = &bank->pendingGain[bank->stride];
+
+    return EXIT_SUCCESS;
+}
+
+void lmsFilterBank_Free(LmsFilterBank_t* bank)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    heap->release(heap->context, bank->memory);
+    bank->memory = NULL;
+    bank->coefficients = NULL;
+    bank->delayLine = NULL;
+    bank->pendingGain = NULL;
+    bank->output = NULL;
+}
+
+void lmsFilterBank_PushFrame(LmsFilterBank_t* bank, const float* frame)
+{
+    lmsFilterBank_FlushUpdate(bank);
+    lmsFilterBank_DelayLinePush(bank, frame);
+}
+
+void lmsFilterBank_FlushUpdate(LmsFilterBank_t* bank)
+{
+    const int stride = bank->stride;
+    const float* window = &bank->delayLine[(size_t)(bank->delayIndex + 1) * stride];
+
+    for (int k = 0; k < bank->length; k++)
+    {
+        float* c = &bank->coefficients[(size_t)k * stride];
+        const float* x = &window[(size_t)k * stride];
+
+        for (int ch = 0; ch < stride; ch++)
+        {
+            c[ch] += bank->pendingGain[ch] * x[ch];
+        }
+    }
+    memset(bank->pendingGain, 0, stride * sizeof(float));
+}
+
+int lmsFilterBank_ProcessFrames(LmsFilterBank_t* bank, const float* input, const float* desired,
+                                float* output, float* error, int numOfFrames)
+{
+    const int channels = bank->numOfChannels;
+    const int stride = bank->stride;
+
+    for (int n = 0; n < numOfFrames; n++)
+    {
+        const size_t frame = (size_t)n * channels;
+
+        lmsFilterBank_DelayLinePush(bank, &input[frame]);
+
+        const float* previous = &bank->delayLine[(size_t)bank->delayIndex * stride];
+        const float* current = previous + stride;
+
+        bank->kernel->bankUpdateDot(bank->coefficients, previous, current, bank->pendingGain,
+                                    bank->output, bank->length, stride);
+
+        for (int ch = 0; ch < channels; ch++)
+        {
+            const float y = bank->output[ch];
+            const float e = ((desired != NULL) ? desired[frame + ch] : current[ch]) - y;
+
+            bank->pendingGain[ch] = bank->step * e;
+            if (output != NULL)
+            {
+                output[frame + ch] = y;
+            }
+            if (error != NULL)
+            {
+                error[frame + ch] = e;
+            }
+        }
+    }
+
+    /* Non-finite values propagate through coefficients, checking the last outputs is enough */
+    for (int ch = 0; ch < channels; ch++)
+    {
+        if (isfinite(bank->output[ch]) == 0)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
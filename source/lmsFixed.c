@@ -0,0 +1,317 @@
+/**
+ * @file lmsFixed.c
+ * @author shed258
+ * @brief Fixed-point LMS filter: Q15 samples and coefficients, wide accumulators, saturating
+ * arithmetic and a power of two step size. Results are bit-exact across kernels and hosts
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "lmsFixed.h"
+#include "lmsAllocator.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LMS_FIXED_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * Arithmetic shared by every kernel, so SIMD results equal the scalar ones bit for bit:
+ *  - gain = step * error, rounded to Q15 once per sample and kept within [-32767, 32767]
+ *  - update: delta = (gain * x + 2^14) >> 15, the rounding of pmulhrsw, then the coefficient
+ *    is saturated to [-32767, 32767]. Symmetric bounds keep a pair of Q30 products below 2^31,
+ *    so pmaddwd sums pairs in 32-bit lanes without overflow
+ *  - pair sums are added in 64 bits, integer addition does not depend on the order
+ */
+
+static inline int16_t lmsFixed_Saturate(int32_t value, int32_t minimum, int32_t maximum)
+{
+    return (int16_t)((value > maximum) ? maximum : ((value < minimum) ? minimum : value));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Portable scalar fallback                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+static int64_t lmsFixed_UpdateDotScalar(int16_t* coefficients, const int16_t* previous, const int16_t* current,
+                                        int16_t gain, int length)
+{
+    int64_t acc = 0;
+
+    for (int k = 0; k < length; k++)
+    {
+        const int32_t delta = ((int32_t)gain * previous[k] + (1 << 14)) >> 15;
+        const int16_t c = lmsFixed_Saturate(coefficients[k] + delta, -LMS_FIXED_COEFF_MAX, LMS_FIXED_COEFF_MAX);
+        coefficients[k] = c;
+        acc += (int32_t)c * current[k];
+    }
+    return acc;
+}
+
+#ifdef LMS_FIXED_X86
+
+/* ---------------------------------------------------------------------------------------------- */
+/* SSE2                                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+__attribute__((target("sse2")))
+static int64_t lmsFixed_UpdateDotSse2(int16_t* coefficients, const int16_t* previous, const int16_t* current,
+                                      int16_t gain, int length)
+{
+    const __m128i g = _mm_set1_epi16(gain);
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i minimum = _mm_set1_epi16(-LMS_FIXED_COEFF_MAX);
+    __m128i acc = _mm_setzero_si128();
+    int k = 0;
+
+    for (; k + 8 <= length; k += 8)
+    {
+        /* pmulhrsw is SSSE3: (p + 2^14) >> 15 = 2 * high + bit 15 + bit 14 of the low half */
+        const __m128i x = _mm_loadu_si128((const __m128i*)(previous + k));
+        const __m128i productLow = _mm_mullo_epi16(x, g);
+        const __m128i productHigh = _mm_mulhi_epi16(x, g);
+        __m128i delta = _mm_add_epi16(_mm_slli_epi16(productHigh, 1), _mm_srli_epi16(productLow, 15));
+        delta = _mm_add_epi16(delta, _mm_and_si128(_mm_srli_epi16(productLow, 14), one));
+
+        __m128i c = _mm_loadu_si128((const __m128i*)(coefficients + k));
+        c = _mm_max_epi16(_mm_adds_epi16(c, delta), minimum);
+        _mm_storeu_si128((__m128i*)(coefficients + k), c);
+
+        const __m128i pairs = _mm_madd_epi16(c, _mm_loadu_si128((const __m128i*)(current + k)));
+        const __m128i sign = _mm_srai_epi32(pairs, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(pairs, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(pairs, sign));
+    }
+
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, acc);
+    return lanes[0] + lanes[1] + lmsFixed_UpdateDotScalar(coefficients + k, previous + k, current + k, gain, length - k);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* AVX2                                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+__attribute__((target("avx2")))
+static int64_t lmsFixed_UpdateDotAvx2(int16_t* coefficients, const int16_t* previous, const int16_t* current,
+                                      int16_t gain, int length)
+{
+    const __m256i g = _mm256_set1_epi16(gain);
+    const __m256i minimum = _mm256_set1_epi16(-LMS_FIXED_COEFF_MAX);
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    int k = 0;
+
+    for (; k + 16 <= length; k += 16)
+    {
+        const __m256i delta = _mm256_mulhrs_epi16(_mm256_loadu_si256((const __m256i*)(previous + k)), g);
+        __m256i c = _mm256_loadu_si256((const __m256i*)(coefficients + k));
+        c = _mm256_max_epi16(_mm256_adds_epi16(c, delta), minimum);
+        _mm256_storeu_si256((__m256i*)(coefficients + k), c);
+
+        const __m256i pairs = _mm256_madd_epi16(c, _mm256_loadu_si256((const __m256i*)(current + k)));
+        acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(pairs)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(pairs, 1)));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(acc0, acc1));
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3])
+           + lmsFixed_UpdateDotScalar(coefficients + k, previous + k, current + k, gain, length - k);
+}
+
+#endif  /* LMS_FIXED_X86 */
+
+static const LmsFixedKernel_t lmsFixedKernels[LMS_KERNEL_COUNT] =
+{
+    [LMS_KERNEL_SCALAR] = { LMS_KERNEL_SCALAR, "scalar", lmsFixed_UpdateDotScalar },
+#ifdef LMS_FIXED_X86
+    [LMS_KERNEL_SSE2]   = { LMS_KERNEL_SSE2, "sse2", lmsFixed_UpdateDotSse2 },
+    [LMS_KERNEL_AVX2]   = { LMS_KERNEL_AVX2, "avx2", lmsFixed_UpdateDotAvx2 },
+#endif
+};
+
+const LmsFixedKernel_t* lmsFixed_GetKernel(LmsKernelType_t type)
+{
+    const LmsFixedKernel_t* retval = NULL;
+
+    if ((type < LMS_KERNEL_COUNT) && (lmsFixedKernels[type].updateDot != NULL) && lmsKernel_IsSupported(type))
+    {
+        retval = &lmsFixedKernels[type];
+    }
+    return retval;
+}
+
+const LmsFixedKernel_t* lmsFixed_GetBestKernel(void)
+{
+    int type;
+
+    for (type = lmsKernel_GetBest()->type; type > LMS_KERNEL_SCALAR; type--)
+    {
+        if (lmsFixed_GetKernel(type) != NULL)
+        {
+            break;
+        }
+    }
+    return &lmsFixedKernels[type];
+}
+
+int lmsFixed_Init(LmsFixed_t* filter, int stepShift, int length)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    if ((stepShift < 0) || (stepShift > LMS_FIXED_MAX_STEP_SHIFT))
+    {
+        printf("Wrong step shift %d, expected 0 to %d\n", stepShift, LMS_FIXED_MAX_STEP_SHIFT);
+        return EXIT_FAILURE;
+    }
+    if ((length <= 0) || ((size_t)length >= ((size_t)-1) / (4 * sizeof(int16_t))))
+    {
+        printf("Wrong filter length %d\n", length);
+        return EXIT_FAILURE;
+    }
+
+    const size_t coefficientBytes = lmsAllocator_AlignedSize((size_t)length * sizeof(int16_t));
+    const size_t delayLineBytes = lmsAllocator_AlignedSize(2 * ((size_t)length + 1) * sizeof(int16_t));
+    const size_t totalBytes = coefficientBytes + delayLineBytes;
+
+    filter->memory = heap->allocate(heap->context, totalBytes, LMS_ALLOCATOR_ALIGNMENT);
+    if (filter->memory == NULL)
+    {
+        printf("Error allocating filter of length %d\n", length);
+        return EXIT_FAILURE;
+    }
+    memset(filter->memory, 0, totalBytes);
+    filter->length = length;
+    filter->stepShift = stepShift;
+    filter->coefficients = (int16_t*)filter->memory;
+    filter->delayLine = (int16_t*)((unsigned char*)filter->memory + coefficientBytes);
+    filter->delayIndex = 0;
+    filter->pendingGain = 0;
+    filter->kernel = lmsFixed_GetBestKernel();
+    return EXIT_SUCCESS;
+}
+
+void lmsFixed_Free(LmsFixed_t* filter)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    heap->release(heap->context, filter->memory);
+    filter->memory = NULL;
+    filter->coefficients = NULL;
+    filter->delayLine = NULL;
+}
+
+/**
+ * @brief Store a sample in the mirrored delay line, see lmsFilter_DelayLinePush
+ * @param filter    Fixed-point filter structure
+ * @param sample    New input sample
+ */
+static inline void lmsFixed_DelayLinePush(LmsFixed_t* filter, int16_t sample)
+{
+    const int size = filter->length + 1;
+
+    filter->delayLine[filter->delayIndex] = sample;
+    filter->delayLine[filter->delayIndex + size] = sample;
+    if (++filter->delayIndex == size)
+    {
+        filter->delayIndex = 0;
+    }
+}
+
+void lmsFixed_PushSample(LmsFixed_t* filter, int16_t sample)
+{
+    /* Apply the pending update to the current window before it moves, the output is not needed */
+    if (filter->pendingGain != 0)
+    {
+        const int16_t* window = &filter->delayLine[filter->delayIndex + 1];
+        filter->kernel->updateDot(filter->coefficients, window, window, filter->pendingGain, filter->length);
+        filter->pendingGain = 0;
+    }
+    lmsFixed_DelayLinePush(filter, sample);
+}
+
+void lmsFixed_ProcessBlock(LmsFixed_t* filter, const int16_t* input, const int16_t* desired,
+                           int16_t* output, int16_t* error, int numOfSamples)
+{
+    const int32_t round = (filter->stepShift > 0) ? (1 << (filter->stepShift - 1)) : 0;
+
+    for (int n = 0; n < numOfSamples; n++)
+    {
+        lmsFixed_DelayLinePush(filter, input[n]);
+
+        const int16_t* previous = &filter->delayLine[filter->delayIndex];
+        const int16_t* current = previous + 1;
+
+        /* A zero gain leaves coefficients unchanged, so the first sample needs no special case */
+        const int64_t acc = filter->kernel->updateDot(filter->coefficients, previous, current, filter->pendingGain,
+                                                      filter->length);
+        int64_t rounded = (acc + (1 << 14)) >> 15;
+        if (rounded > LMS_FIXED_Q15_MAX)
+        {
+            rounded = LMS_FIXED_Q15_MAX;
+        }
+        else if (rounded < -LMS_FIXED_Q15_ONE)
+        {
+            rounded = -LMS_FIXED_Q15_ONE;
+        }
+        const int16_t y = (int16_t)rounded;
+        const int16_t d = (desired != NULL) ? desired[n] : current[0];
+        const int16_t e = lmsFixed_Saturate((int32_t)d - y, -LMS_FIXED_Q15_ONE, LMS_FIXED_Q15_MAX);
+
+        filter->pendingGain = lmsFixed_Saturate((e + round) >> filter->stepShift, -LMS_FIXED_COEFF_MAX,
+                                                LMS_FIXED_COEFF_MAX);
+        if (output != NULL)
+        {
+            output[n] = y;
+        }
+        if (error != NULL)
+        {
+            error[n] = e;
+        }
+    }
+}
+
+int lmsFixed_StepShift(float step)
+{
+    int shift = (step > 0.0f) ? (int)lrintf(-log2f(step)) : LMS_FIXED_MAX_STEP_SHIFT;
+
+    if (shift < 0)
+    {
+        shift = 0;
+    }
+    else if (shift > LMS_FIXED_MAX_STEP_SHIFT)
+    {
+        shift = LMS_FIXED_MAX_STEP_SHIFT;
+    }
+    return shift;
+}
+
+void lmsFixed_FromFloat(int16_t* dst, const float* src, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        float scaled = src[i] * (float)LMS_FIXED_Q15_ONE;
+        if (scaled > (float)LMS_FIXED_Q15_MAX)
+        {
+            scaled = (float)LMS_FIXED_Q15_MAX;
+        }
+        else if (scaled < -(float)LMS_FIXED_Q15_ONE)
+        {
+            scaled = -(float)LMS_FIXED_Q15_ONE;
+        }
+        dst[i] = (int16_t)lrintf(scaled);
+    }
+}
+
+void lmsFixed_ToFloat(float* dst, const int16_t* src, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        dst[i] = src[i] * (1.0f / LMS_FIXED_Q15_ONE);
+    }
+}
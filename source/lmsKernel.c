@@ -0,0 +1,811 @@
+/**
+ * @file lmsKernel.c
+ * @author shed258
+ * @brief Vectorized LMS kernels with runtime CPU dispatch
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "lmsKernel.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LMS_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Portable scalar fallback                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+static float lmsKernel_DotScalar(const float* a, const float* b, int length)
+{
+    float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    int k = 0;
+
+    for (; k + 4 <= length; k += 4)
+    {
+        sum0 += a[k] * b[k];
+        sum1 += a[k + 1] * b[k + 1];
+        sum2 += a[k + 2] * b[k + 2];
+        sum3 += a[k + 3] * b[k + 3];
+    }
+    for (; k < length; k++)
+    {
+        sum0 += a[k] * b[k];
+    }
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+static void lmsKernel_UpdateScalar(float* coefficients, const float* input, float gain, int length)
+{
+    for (int k = 0; k < length; k++)
+    {
+        coefficients[k] += gain * input[k];
+    }
+}
+
+static float lmsKernel_UpdateDotScalar(float* coefficients, const float* previous, const float* current,
+                                       float gain, int length)
+{
+    float sum0 = 0.0f, sum1 = 0.0f;
+    int k = 0;
+
+    for (; k + 2 <= length; k += 2)
+    {
+        coefficients[k] += gain * previous[k];
+        coefficients[k + 1] += gain * previous[k + 1];
+        sum0 += coefficients[k] * current[k];
+        sum1 += coefficients[k + 1] * current[k + 1];
+    }
+    for (; k < length; k++)
+    {
+        coefficients[k] += gain * previous[k];
+        sum0 += coefficients[k] * current[k];
+    }
+    return sum0 + sum1;
+}
+
+static float lmsKernel_LeakyUpdateDotScalar(float* coefficients, const float* previous, const float* current,
+                                            float gain, float leak, int length)
+{
+    float sum0 = 0.0f, sum1 = 0.0f;
+    int k = 0;
+
+    for (; k + 2 <= length; k += 2)
+    {
+        coefficients[k] = leak * coefficients[k] + gain * previous[k];
+        coefficients[k + 1] = leak * coefficients[k + 1] + gain * previous[k + 1];
+        sum0 += coefficients[k] * current[k];
+        sum1 += coefficients[k + 1] * current[k + 1];
+    }
+    for (; k < length; k++)
+    {
+        coefficients[k] = leak * coefficients[k] + gain * previous[k];
+        sum0 += coefficients[k] * current[k];
+    }
+    return sum0 + sum1;
+}
+
+static inline float lmsKernel_Sign(float x)
+{
+    return (float)((x > 0.0f) - (x < 0.0f));
+}
+
+static float lmsKernel_SignUpdateDotScalar(float* coefficients, const float* previous, const float* current,
+                                           float gain, int length)
+{
+    float sum0 = 0.0f, sum1 = 0.0f;
+    int k = 0;
+
+    for (; k + 2 <= length; k += 2)
+    {
+        coefficients[k] += gain * lmsKernel_Sign(previous[k]);
+        coefficients[k + 1] += gain * lmsKernel_Sign(previous[k + 1]);
+        sum0 += coefficients[k] * current[k];
+        sum1 += coefficients[k + 1] * current[k + 1];
+    }
+    for (; k < length; k++)
+    {
+        coefficients[k] += gain * lmsKernel_Sign(previous[k]);
+        sum0 += coefficients[k] * current[k];
+    }
+    return sum0 + sum1;
+}
+
+static void lmsKernel_BankUpdateDotScalar(float* coefficients, const float* previous, const float* current,
+                                          const float* gain, float* output, int length, int stride)
+{
+    for (int ch = 0; ch < stride; ch++)
+    {
+        output[ch] = 0.0f;
+    }
+    for (int k = 0; k < length; k++)
+    {
+        float* c = &coefficients[(size_t)k * stride];
+        const float* p = &previous[(size_t)k * stride];
+        const float* x = &current[(size_t)k * stride];
+
+        for (int ch = 0; ch < stride; ch++)
+        {
+            c[ch] += gain[ch] * p[ch];
+            output[ch] += c[ch] * x[ch];
+        }
+    }
+}
+
+#ifdef LMS_KERNEL_X86
+
+/* ---------------------------------------------------------------------------------------------- */
+/* SSE2                                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+__attribute__((target("sse2")))
+static inline float lmsKernel_HorizontalSumSse2(__m128 v)
+{
+    __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(v, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    sums = _mm_add_ss(sums, shuf);
+    return _mm_cvtss_f32(sums);
+}
+
+__attribute__((target("sse2")))
+static float lmsKernel_DotSse2(const float* a, const float* b, int length)
+{
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    int k = 0;
+
+    for (; k + 8 <= length; k += 8)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + k), _mm_loadu_ps(b + k)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + k + 4), _mm_loadu_ps(b + k + 4)));
+    }
+    float sum = lmsKernel_HorizontalSumSse2(_mm_add_ps(acc0, acc1));
+    for (; k < length; k++)
+    {
+        sum += a[k] * b[k];
+    }
+    return sum;
+}
+
+__attribute__((target("sse2")))
+static void lmsKernel_UpdateSse2(float* coefficients, const float* input, float gain, int length)
+{
+    const __m128 g = _mm_set1_ps(gain);
+    int k = 0;
+
+    for (; k + 4 <= length; k += 4)
+    {
+        __m128 c = _mm_loadu_ps(coefficients + k);
+        c = _mm_add_ps(c, _mm_mul_ps(g, _mm_loadu_ps(input + k)));
+        _mm_storeu_ps(coefficients + k, c);
+    }
+    for (; k < length; k++)
+    {
+        coefficients[k] += gain * input[k];
+    }
+}
+
+__attribute__((target("sse2")))
+static float lmsKernel_UpdateDotSse2(float* coefficients, const float* previous, const float* current,
+                                     float gain, int length)
+{
+    const __m128 g = _mm_set1_ps(gain);
+    __m128 acc = _mm_setzero_ps();
+    int k = 0;
+
+    for (; k + 4 <= length; k += 4)
+    {
+        __m128 c = _mm_loadu_ps(coefficients + k);
+        c = _mm_add_ps(c, _mm_mul_ps(g, _mm_loadu_ps(previous + k)));
+        _mm_storeu_ps(coefficients + k, c);
+        acc = _mm_add_ps(acc, _mm_mul_ps(c, _mm_loadu_ps(current + k)));
+    }
+    float sum = lmsKernel_HorizontalSumSse2(acc);
+    for (; k < length; k++)
+    {
+        coefficients[k] += gain * previous[k];
+        sum += coefficients[k] * current[k];
+    }
+    return sum;
+}
+
+__attribute__((target("sse2")))
+static float lmsKernel_LeakyUpdateDotSse2(float* coefficients, const float* previous, const float* current,
+                                          float gain, float leak, int length)
+{
+    const __m128 g = _mm_set1_ps(gain);
+    const __m128 l = _mm_set1_ps(leak);
+    __m128 acc = _mm_setzero_ps();
+    int k = 0;
+
+    for (; k + 4 <= length; k += 4)
+    {
+        __m128 c = _mm_mul_ps(l, _mm_loadu_ps(coefficients + k));
+        c = _mm_add_ps(c, _mm_mul_ps(g, _mm_loadu_ps(previous + k)));
+        _mm_storeu_ps(coefficients + k, c);
+        acc = _mm_add_ps(acc, _mm_mul_ps(c, _mm_loadu_ps(current + k)));
+    }
+    float sum = lmsKernel_HorizontalSumSse2(acc);
+    for (; k < length; k++)
+    {
+        coefficients[k] = leak * coefficients[k] + gain * previous[k];
+        sum += coefficients[k] * current[k];
+    }
+    return sum;
+}
+
+/* +gain, -gain or 0 depending on the sign of x */
+__attribute__((target("sse2")))
+static inline __m128 lmsKernel_SignedGainSse2(__m128 x, __m128 gain)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 positive = _mm_and_ps(_mm_cmpgt_ps(x, zero), gain);
+    const __m128 negative = _mm_and_ps(_mm_cmplt_ps(x, zero), gain);
+    return _mm_sub_ps(positive, negative);
+}
+
+__attribute__((target("sse2")))
+static float lmsKernel_SignUpdateDotSse2(float* coefficients, const float* previous, const float* current,
+                                         float gain, int length)
+{
+    const __m128 g = _mm_set1_ps(gain);
+    __m128 acc = _mm_setzero_ps();
+    int k = 0;
+
+    for (; k + 4 <= length; k += 4)
+    {
+        __m128 c = _mm_add_ps(_mm_loadu_ps(coefficients + k), lmsKernel_SignedGainSse2(_mm_loadu_ps(previous + k), g));
+        _mm_storeu_ps(coefficients + k, c);
+        acc = _mm_add_ps(acc, _mm_mul_ps(c, _mm_loadu_ps(current + k)));
+    }
+    float sum = lmsKernel_HorizontalSumSse2(acc);
+    for (; k < length; k++)
+    {
+        coefficients[k] += gain * lmsKernel_Sign(previous[k]);
+        sum += coefficients[k] * current[k];
+    }
+    return sum;
+}
+
+__attribute__((target("sse2")))
+static void lmsKernel_BankUpdateDotSse2(float* coefficients, const float* previous, const float* current,
+                                        const float* gain, float* output, int length, int stride)
+{
+    /* Accumulators of 16 channels stay in registers while walking the taps */
+    for (int ch = 0; ch < stride; ch += LMS_KERNEL_BANK_LANES)
+    {
+        const __m128 g0 = _mm_loadu_ps(gain + ch);
+        const __m128 g1 = _mm_loadu_ps(gain + ch + 4);
+        const __m128 g2 = _mm_loadu_ps(gain + ch + 8);
+        const __m128 g3 = _mm_loadu_ps(gain + ch + 12);
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        __m128 acc2 = _mm_setzero_ps();
+        __m128 acc3 = _mm_setzero_ps();
+
+        for (int k = 0; k < length; k++)
+        {
+            const size_t row = (size_t)k * stride + ch;
+            __m128 c0 = _mm_add_ps(_mm_loadu_ps(coefficients + row), _mm_mul_ps(g0, _mm_loadu_ps(previous + row)));
+            __m128 c1 = _mm_add_ps(_mm_loadu_ps(coefficients + row + 4), _mm_mul_ps(g1, _mm_loadu_ps(previous + row + 4)));
+            __m128 c2 = _mm_add_ps(_mm_loadu_ps(coefficients + row + 8), _mm_mul_ps(g2, _mm_loadu_ps(previous + row + 8)));
+            __m128 c3 = _mm_add_ps(_mm_loadu_ps(coefficients + row + 12), _mm_mul_ps(g3, _mm_loadu_ps(previous + row + 12)));
+            _mm_storeu_ps(coefficients + row, c0);
+            _mm_storeu_ps(coefficients + row + 4, c1);
+            _mm_storeu_ps(coefficients + row + 8, c2);
+            _mm_storeu_ps(coefficients + row + 12, c3);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(c0, _mm_loadu_ps(current + row)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(c1, _mm_loadu_ps(current + row + 4)));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(c2, _mm_loadu_ps(current + row + 8)));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(c3, _mm_loadu_ps(current + row + 12)));
+        }
+        _mm_storeu_ps(output + ch, acc0);
+        _mm_storeu_ps(output + ch + 4, acc1);
+        _mm_storeu_ps(output + ch + 8, acc2);
+        _mm_storeu_ps(output + ch + 12, acc3);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* AVX2 + FMA                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+__attribute__((target("avx2,fma")))
+static inline float lmsKernel_HorizontalSumAvx2(__m256 v)
+{
+    __m128 sums = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    __m128 shuf = _mm_movehdup_ps(sums);
+    sums = _mm_add_ps(sums, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    sums = _mm_add_ss(sums, shuf);
+    return _mm_cvtss_f32(sums);
+}
+
+__attribute__((target("avx2,fma")))
+static float lmsKernel_DotAvx2(const float* a, const float* b, int length)
+{
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int k = 0;
+
+    for (; k + 16 <= length; k += 16)
+    {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k + 8), _mm256_loadu_ps(b + k + 8), acc1);
+    }
+    for (; k + 8 <= length; k += 8)
+    {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), acc0);
+    }
+    float sum = lmsKernel_HorizontalSumAvx2(_mm256_add_ps(acc0, acc1));
+    for (; k < length; k++)
+    {
+        sum += a[k] * b[k];
+    }
+    return sum;
+}
+
+__attribute__((target("avx2,fma")))
+static void lmsKernel_UpdateAvx2(float* coefficients, const float* input, float gain, int length)
+{
+    const __m256 g = _mm256_set1_ps(gain);
+    int k = 0;
+
+    for (; k + 8 <= length; k += 8)
+    {
+        __m256 c = _mm256_loadu_ps(coefficients + k);
+        c = _mm256_fmadd_ps(g, _mm256_loadu_ps(input + k), c);
+        _mm256_storeu_ps(coefficients + k, c);
+    }
+    for (; k < length; k++)
+    {
+        coefficients[k] += gain * input[k];
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static float lmsKernel_UpdateDotAvx2(float* coefficients, const float* previous, const float* current,
+                                     float gain, int length)
+{
+    const __m256 g = _mm256_set1_ps(gain);
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int k = 0;
+
+    for (; k + 16 <= length; k += 16)
+    {
+        __m256 c0 = _mm256_loadu_ps(coefficients + k);
+        __m256 c1 = _mm256_loadu_ps(coefficients + k + 8);
+        c0 = _mm256_fmadd_ps(g, _mm256_loadu_ps(previous + k), c0);
+        c1 = _mm256_fmadd_ps(g, _mm256_loadu_ps(previous + k + 8), c1);
+        _mm256_storeu_ps(coefficients + k, c0);
+        _mm256_storeu_ps(coefficients + k + 8, c1);
+        acc0 = _mm256_fmadd_ps(c0, _mm256_loadu_ps(current + k), acc0);
+        acc1 = _mm256_fmadd_ps(c1, _mm256_loadu_ps(current + k + 8), acc1);
+    }
+    for (; k + 8 <= length; k += 8)
+    {
+        __m256 c = _mm256_loadu_ps(coefficients + k);
+        c = _mm256_fmadd_ps(g, _mm256_loadu_ps(previous + k), c);
+        _mm256_storeu_ps(coefficients + k, c);
+        acc0 = _mm256_fmadd_ps(c, _mm256_loadu_ps(current + k), acc0);
+    }
+    float sum = lmsKernel_HorizontalSumAvx2(_mm256_add_ps(acc0, acc1));
+    for (; k < length; k++)
+    {
+        coefficients[k] += gain * previous[k];
+        sum += coefficients[k] * current[k];
+    }
+    return sum;
+}
+
+__attribute__((target("avx2,fma")))
+static float lmsKernel_LeakyUpdateDotAvx2(float* coefficients, const float* previous, const float* current,
+                                          float gain, float leak, int length)
+{
+    const __m256 g = _mm256_set1_ps(gain);
+    const __m256 l = _mm256_set1_ps(leak);
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int k = 0;
+
+    for (; k + 16 <= length; k += 16)
+    {
+        __m256 c0 = _mm256_mul_ps(l, _mm256_loadu_ps(coefficients + k));
+        __m256 c1 = _mm256_mul_ps(l, _mm256_loadu_ps(coefficients + k + 8));
+        c0 = _mm256_fmadd_ps(g, _mm256_loadu_ps(previous + k), c0);
+        c1 = _mm256_fmadd_ps(g, _mm256_loadu_ps(previous + k + 8), c1);
+        _mm256_storeu_ps(coefficients + k, c0);
+        _mm256_storeu_ps(coefficients + k + 8, c1);
+        acc0 = _mm256_fmadd_ps(c0, _mm256_loadu_ps(current + k), acc0);
+        acc1 = _mm256_fmadd_ps(c1, _mm256_loadu_ps(current + k + 8), acc1);
+    }
+    for (; k + 8 <= length; k += 8)
+    {
+        __m256 c = _mm256_mul_ps(l, _mm256_loadu_ps(coefficients + k));
+        c = _mm256_fmadd_ps(g, _mm256_loadu_ps(previous + k), c);
+        _mm256_storeu_ps(coefficients + k, c);
+        acc0 = _mm256_fmadd_ps(c, _mm256_loadu_ps(current + k), acc0);
+    }
+    float sum = lmsKernel_HorizontalSumAvx2(_mm256_add_ps(acc0, acc1));
+    for (; k < length; k++)
+    {
+        coefficients[k] = leak * coefficients[k] + gain * previous[k];
+        sum += coefficients[k] * current[k];
+    }
+    return sum;
+}
+
+__attribute__((target("avx2,fma")))
+static inline __m256 lmsKernel_SignedGainAvx2(__m256 x, __m256 gain)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 positive = _mm256_and_ps(_mm256_cmp_ps(x, zero, _CMP_GT_OQ), gain);
+    const __m256 negative = _mm256_and_ps(_mm256_cmp_ps(x, zero, _CMP_LT_OQ), gain);
+    return _mm256_sub_ps(positive, negative);
+}
+
+__attribute__((target("avx2,fma")))
+static float lmsKernel_SignUpdateDotAvx2(float* coefficients, const float* previous, const float* current,
+                                         float gain, int length)
+{
+    const __m256 g = _mm256_set1_ps(gain);
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int k = 0;
+
+    for (; k + 16 <= length; k += 16)
+    {
+        __m256 c0 = _mm256_add_ps(_mm256_loadu_ps(coefficients + k),
+                                  lmsKernel_SignedGainAvx2(_mm256_loadu_ps(previous + k), g));
+        __m256 c1 = _mm256_add_ps(_mm256_loadu_ps(coefficients + k + 8),
+                                  lmsKernel_SignedGainAvx2(_mm256_loadu_ps(previous + k + 8), g));
+        _mm256_storeu_ps(coefficients + k, c0);
+        _mm256_storeu_ps(coefficients + k + 8, c1);
+        acc0 = _mm256_fmadd_ps(c0, _mm256_loadu_ps(current + k), acc0);
+        acc1 = _mm256_fmadd_ps(c1, _mm256_loadu_ps(current + k + 8), acc1);
+    }
+    for (; k + 8 <= length; k += 8)
+    {
+        __m256 c = _mm256_add_ps(_mm256_loadu_ps(coefficients + k),
+                                 lmsKernel_SignedGainAvx2(_mm256_loadu_ps(previous + k), g));
+        _mm256_storeu_ps(coefficients + k, c);
+        acc0 = _mm256_fmadd_ps(c, _mm256_loadu_ps(current + k), acc0);
+    }
+    float sum = lmsKernel_HorizontalSumAvx2(_mm256_add_ps(acc0, acc1));
+    for (; k < length; k++)
+    {
+        coefficients[k] += gain * lmsKernel_Sign(previous[k]);
+        sum += coefficients[k] * current[k];
+    }
+    return sum;
+}
+
+__attribute__((target("avx2,fma")))
+static void lmsKernel_BankUpdateDotAvx2(float* coefficients, const float* previous, const float* current,
+                                        const float* gain, float* output, int length, int stride)
+{
+    for (int ch = 0; ch < stride; ch += LMS_KERNEL_BANK_LANES)
+    {
+        const __m256 g0 = _mm256_loadu_ps(gain + ch);
+        const __m256 g1 = _mm256_loadu_ps(gain + ch + 8);
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+
+        for (int k = 0; k < length; k++)
+        {
+            const size_t row = (size_t)k * stride + ch;
+            __m256 c0 = _mm256_fmadd_ps(g0, _mm256_loadu_ps(previous + row), _mm256_loadu_ps(coefficients + row));
+            __m256 c1 = _mm256_fmadd_ps(g1, _mm256_loadu_ps(previous + row + 8), _mm256_loadu_ps(coefficients + row + 8));
+            _mm256_storeu_ps(coefficients + row, c0);
+            _mm256_storeu_ps(coefficients + row + 8, c1);
+            acc0 = _mm256_fmadd_ps(c0, _mm256_loadu_ps(current + row), acc0);
+            acc1 = _mm256_fmadd_ps(c1, _mm256_loadu_ps(current + row + 8), acc1);
+        }
+        _mm256_storeu_ps(output + ch, acc0);
+        _mm256_storeu_ps(output + ch + 8, acc1);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* AVX-512F                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+__attribute__((target("avx512f")))
+static float lmsKernel_DotAvx512(const float* a, const float* b, int length)
+{
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int k = 0;
+
+    for (; k + 32 <= length; k += 32)
+    {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k), _mm512_loadu_ps(b + k), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k + 16), _mm512_loadu_ps(b + k + 16), acc1);
+    }
+    for (; k + 16 <= length; k += 16)
+    {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + k), _mm512_loadu_ps(b + k), acc0);
+    }
+    if (k < length)
+    {
+        /* Masked tail, lanes outside the filter read as zero */
+        __mmask16 mask = (__mmask16)((1u << (length - k)) - 1u);
+        acc1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + k), _mm512_maskz_loadu_ps(mask, b + k), acc1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+__attribute__((target("avx512f")))
+static void lmsKernel_UpdateAvx512(float* coefficients, const float* input, float gain, int length)
+{
+    const __m512 g = _mm512_set1_ps(gain);
+    int k = 0;
+
+    for (; k + 16 <= length; k += 16)
+    {
+        __m512 c = _mm512_loadu_ps(coefficients + k);
+        c = _mm512_fmadd_ps(g, _mm512_loadu_ps(input + k), c);
+        _mm512_storeu_ps(coefficients + k, c);
+    }
+    if (k < length)
+    {
+        __mmask16 mask = (__mmask16)((1u << (length - k)) - 1u);
+        __m512 c = _mm512_maskz_loadu_ps(mask, coefficients + k);
+        c = _mm512_fmadd_ps(g, _mm512_maskz_loadu_ps(mask, input + k), c);
+        _mm512_mask_storeu_ps(coefficients + k, mask, c);
+    }
+}
+
+__attribute__((target("avx512f")))
+static float lmsKernel_UpdateDotAvx512(float* coefficients, const float* previous, const float* current,
+                                       float gain, int length)
+{
+    const __m512 g = _mm512_set1_ps(gain);
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int k = 0;
+
+    for (; k + 32 <= length; k += 32)
+    {
+        __m512 c0 = _mm512_loadu_ps(coefficients + k);
+        __m512 c1 = _mm512_loadu_ps(coefficients + k + 16);
+        c0 = _mm512_fmadd_ps(g, _mm512_loadu_ps(previous + k), c0);
+        c1 = _mm512_fmadd_ps(g, _mm512_loadu_ps(previous + k + 16), c1);
+        _mm512_storeu_ps(coefficients + k, c0);
+        _mm512_storeu_ps(coefficients + k + 16, c1);
+        acc0 = _mm512_fmadd_ps(c0, _mm512_loadu_ps(current + k), acc0);
+        acc1 = _mm512_fmadd_ps(c1, _mm512_loadu_ps(current + k + 16), acc1);
+    }
+    for (; k + 16 <= length; k += 16)
+    {
+        __m512 c = _mm512_loadu_ps(coefficients + k);
+        c = _mm512_fmadd_ps(g, _mm512_loadu_ps(previous + k), c);
+        _mm512_storeu_ps(coefficients + k, c);
+        acc0 = _mm512_fmadd_ps(c, _mm512_loadu_ps(current + k), acc0);
+    }
+    if (k < length)
+    {
+        __mmask16 mask = (__mmask16)((1u << (length - k)) - 1u);
+        __m512 c = _mm512_maskz_loadu_ps(mask, coefficients + k);
+        c = _mm512_fmadd_ps(g, _mm512_maskz_loadu_ps(mask, previous + k), c);
+        _mm512_mask_storeu_ps(coefficients + k, mask, c);
+        acc1 = _mm512_fmadd_ps(c, _mm512_maskz_loadu_ps(mask, current + k), acc1);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+__attribute__((target("avx512f")))
+static float lmsKernel_LeakyUpdateDotAvx512(float* coefficients, const float* previous, const float* current,
+                                            float gain, float leak, int length)
+{
+    const __m512 g = _mm512_set1_ps(gain);
+    const __m512 l = _mm512_set1_ps(leak);
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int k = 0;
+
+    for (; k + 32 <= length; k += 32)
+    {
+        __m512 c0 = _mm512_mul_ps(l, _mm512_loadu_ps(coefficients + k));
+        __m512 c1 = _mm512_mul_ps(l, _mm512_loadu_ps(coefficients + k + 16));
+        c0 = _mm512_fmadd_ps(g, _mm512_loadu_ps(previous + k), c0);
+        c1 = _mm512_fmadd_ps(g, _mm512_loadu_ps(previous + k + 16), c1);
+        _mm512_storeu_ps(coefficients + k, c0);
+        _mm512_storeu_ps(coefficients + k + 16, c1);
+        acc0 = _mm512_fmadd_ps(c0, _mm512_loadu_ps(current + k), acc0);
+        acc1 = _mm512_fmadd_ps(c1, _mm512_loadu_ps(current + k + 16), acc1);
+    }
+    for (; k < length; k += 16)
+    {
+        /* Full or masked tail, lanes outside the filter are neither read nor written */
+        __mmask16 mask = (length - k >= 16) ? (__mmask16)0xFFFF : (__mmask16)((1u << (length - k)) - 1u);
+        __m512 c = _mm512_mul_ps(l, _mm512_maskz_loadu_ps(mask, coefficients + k));
+        c = _mm512_fmadd_ps(g, _mm512_maskz_loadu_ps(mask, previous + k), c);
+        _mm512_mask_storeu_ps(coefficients + k, mask, c);
+        acc0 = _mm512_fmadd_ps(c, _mm512_maskz_loadu_ps(mask, current + k), acc0);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+__attribute__((target("avx512f")))
+static float lmsKernel_SignUpdateDotAvx512(float* coefficients, const float* previous, const float* current,
+                                           float gain, int length)
+{
+    const __m512 g = _mm512_set1_ps(gain);
+    const __m512 negativeGain = _mm512_set1_ps(-gain);
+    const __m512 zero = _mm512_setzero_ps();
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int k = 0;
+
+    for (; k + 32 <= length; k += 32)
+    {
+        const __m512 x0 = _mm512_loadu_ps(previous + k);
+        const __m512 x1 = _mm512_loadu_ps(previous + k + 16);
+        __m512 step0 = _mm512_mask_mov_ps(zero, _mm512_cmp_ps_mask(x0, zero, _CMP_GT_OQ), g);
+        __m512 step1 = _mm512_mask_mov_ps(zero, _mm512_cmp_ps_mask(x1, zero, _CMP_GT_OQ), g);
+        step0 = _mm512_mask_mov_ps(step0, _mm512_cmp_ps_mask(x0, zero, _CMP_LT_OQ), negativeGain);
+        step1 = _mm512_mask_mov_ps(step1, _mm512_cmp_ps_mask(x1, zero, _CMP_LT_OQ), negativeGain);
+        __m512 c0 = _mm512_add_ps(_mm512_loadu_ps(coefficients + k), step0);
+        __m512 c1 = _mm512_add_ps(_mm512_loadu_ps(coefficients + k + 16), step1);
+        _mm512_storeu_ps(coefficients + k, c0);
+        _mm512_storeu_ps(coefficients + k + 16, c1);
+        acc0 = _mm512_fmadd_ps(c0, _mm512_loadu_ps(current + k), acc0);
+        acc1 = _mm512_fmadd_ps(c1, _mm512_loadu_ps(current + k + 16), acc1);
+    }
+    for (; k < length; k += 16)
+    {
+        __mmask16 mask = (length - k >= 16) ? (__mmask16)0xFFFF : (__mmask16)((1u << (length - k)) - 1u);
+        const __m512 x = _mm512_maskz_loadu_ps(mask, previous + k);
+        __m512 step = _mm512_mask_mov_ps(zero, _mm512_cmp_ps_mask(x, zero, _CMP_GT_OQ), g);
+        step = _mm512_mask_mov_ps(step, _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ), negativeGain);
+        __m512 c = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, coefficients + k), step);
+        _mm512_mask_storeu_ps(coefficients + k, mask, c);
+        acc0 = _mm512_fmadd_ps(c, _mm512_maskz_loadu_ps(mask, current + k), acc0);
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+__attribute__((target("avx512f")))
+static void lmsKernel_BankUpdateDotAvx512(float* coefficients, const float* previous, const float* current,
+                                          const float* gain, float* output, int length, int stride)
+{
+    for (int ch = 0; ch < stride; ch += LMS_KERNEL_BANK_LANES)
+    {
+        const __m512 g = _mm512_loadu_ps(gain + ch);
+        __m512 acc0 = _mm512_setzero_ps();
+        __m512 acc1 = _mm512_setzero_ps();
+        int k = 0;
+
+        /* Two accumulators hide the FMA latency */
+        for (; k + 2 <= length; k += 2)
+        {
+            const size_t row0 = (size_t)k * stride + ch;
+            const size_t row1 = row0 + stride;
+            __m512 c0 = _mm512_fmadd_ps(g, _mm512_loadu_ps(previous + row0), _mm512_loadu_ps(coefficients + row0));
+            __m512 c1 = _mm512_fmadd_ps(g, _mm512_loadu_ps(previous + row1), _mm512_loadu_ps(coefficients + row1));
+            _mm512_storeu_ps(coefficients + row0, c0);
+            _mm512_storeu_ps(coefficients + row1, c1);
+            acc0 = _mm512_fmadd_ps(c0, _mm512_loadu_ps(current + row0), acc0);
+            acc1 = _mm512_fmadd_ps(c1, _mm512_loadu_ps(current + row1), acc1);
+        }
+        if (k < length)
+        {
+            const size_t row = (size_t)k * stride + ch;
+            __m512 c = _mm512_fmadd_ps(g, _mm512_loadu_ps(previous + row), _mm512_loadu_ps(coefficients + row));
+            _mm512_storeu_ps(coefficients + row, c);
+            acc0 = _mm512_fmadd_ps(c, _mm512_loadu_ps(current + row), acc0);
+        }
+        _mm512_storeu_ps(output + ch, _mm512_add_ps(acc0, acc1));
+    }
+}
+
+#endif  /* LMS_KERNEL_X86 */
+
+static const LmsKernel_t lmsKernels[LMS_KERNEL_COUNT] =
+{
+    [LMS_KERNEL_SCALAR] = { LMS_KERNEL_SCALAR, "scalar",
+                            lmsKernel_DotScalar, lmsKernel_UpdateScalar, lmsKernel_UpdateDotScalar,
+                            lmsKernel_LeakyUpdateDotScalar, lmsKernel_SignUpdateDotScalar,
+                            lmsKernel_BankUpdateDotScalar },
+#ifdef LMS_KERNEL_X86
+    [LMS_KERNEL_SSE2]   = { LMS_KERNEL_SSE2, "sse2",
+                            lmsKernel_DotSse2, lmsKernel_UpdateSse2, lmsKernel_UpdateDotSse2,
+                            lmsKernel_LeakyUpdateDotSse2, lmsKernel_SignUpdateDotSse2,
+                            lmsKernel_BankUpdateDotSse2 },
+    [LMS_KERNEL_AVX2]   = { LMS_KERNEL_AVX2, "avx2",
+                            lmsKernel_DotAvx2, lmsKernel_UpdateAvx2, lmsKernel_UpdateDotAvx2,
+                            lmsKernel_LeakyUpdateDotAvx2, lmsKernel_SignUpdateDotAvx2,
+                            lmsKernel_BankUpdateDotAvx2 },
+    [LMS_KERNEL_AVX512] = { LMS_KERNEL_AVX512, "avx512",
+                            lmsKernel_DotAvx512, lmsKernel_UpdateAvx512, lmsKernel_UpdateDotAvx512,
+                            lmsKernel_LeakyUpdateDotAvx512, lmsKernel_SignUpdateDotAvx512,
+                            lmsKernel_BankUpdateDotAvx512 },
+#endif
+};
+
+int lmsKernel_IsSupported(LmsKernelType_t type)
+{
+    int retval = 0;
+
+    switch (type)
+    {
+        case LMS_KERNEL_SCALAR:
+            retval = 1;
+            break;
+
+#ifdef LMS_KERNEL_X86
+        case LMS_KERNEL_SSE2:
+            __builtin_cpu_init();
+            retval = __builtin_cpu_supports("sse2");
+            break;
+
+        case LMS_KERNEL_AVX2:
+            __builtin_cpu_init();
+            retval = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            break;
+
+        case LMS_KERNEL_AVX512:
+            __builtin_cpu_init();
+            retval = __builtin_cpu_supports("avx512f");
+            break;
+#endif
+
+        default:
+            break;
+    }
+    return (retval != 0);
+}
+
+const LmsKernel_t* lmsKernel_Get(LmsKernelType_t type)
+{
+    const LmsKernel_t* retval = NULL;
+
+    if ((type < LMS_KERNEL_COUNT) && lmsKernel_IsSupported(type))
+    {
+        retval = &lmsKernels[type];
+    }
+    return retval;
+}
+
+static const LmsKernel_t* lmsKernelBest = NULL;
+static pthread_once_t lmsKernelBestOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Choose the kernel of lmsKernel_GetBest, run once for the whole process
+ */
+static void lmsKernel_ChooseBest(void)
+{
+    const char* forced = getenv("LMS_KERNEL");
+    int type;
+
+    /* LMS_KERNEL=<name> limits dispatch to given kernel, e.g. for comparing results across hosts */
+    for (type = LMS_KERNEL_COUNT - 1; type > LMS_KERNEL_SCALAR; type--)
+    {
+        if ((lmsKernel_Get(type) != NULL)
+            && ((forced == NULL) || (strcmp(forced, lmsKernels[type].name) == 0)))
+        {
+            break;
+        }
+    }
+    if ((forced != NULL) && (strcmp(forced, lmsKernels[type].name) != 0))
+    {
+        printf("WARNING: LMS_KERNEL=%s is unknown or not supported by this CPU, using the %s kernel\n",
+               forced, lmsKernels[type].name);
+    }
+    lmsKernelBest = &lmsKernels[type];
+}
+
+const LmsKernel_t* lmsKernel_GetBest(void)
+{
+    /* Filters are created on pool workers, the choice is made once and published by pthread_once */
+    pthread_once(&lmsKernelBestOnce, lmsKernel_ChooseBest);
+    return lmsKernelBest;
+}
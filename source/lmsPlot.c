@@ -0,0 +1,438 @@
+/**
+ * @file lmsPlot.c
+ * @author shed258
+ * @brief Decimated plot source file
+ * @version 1.0.0
+ *
+ * Streaming envelope: buckets start one frame wide. When all <width> buckets are complete, neighbours
+ * are merged in pairs and the bucket size doubles, so after n frames there are between <width> / 2 and
+ * <width> buckets of n / <width> to 2 n / <width> frames each, whatever n turns out to be. Minimum and
+ * maximum keep every peak of the signal, the sum of squares gives the RMS of the bucket.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include "lmsPlot.h"
+
+#define PLOT_SVG_WIDTH          1000    /* width of the drawing area in pixels */
+#define PLOT_SVG_PANEL_HEIGHT   180
+#define PLOT_SVG_MARGIN_LEFT    80
+#define PLOT_SVG_MARGIN_RIGHT   20
+#define PLOT_SVG_MARGIN_TOP     50
+#define PLOT_SVG_PANEL_GAP      40
+
+extern char** environ;
+
+static const char* const lmsPlotFilterSeries[] = { "input", "output", "error" };
+static const char* const lmsPlotColors[LMS_PLOT_MAX_SERIES] = { "#1f77b4", "#2ca02c", "#d62728", "#9467bd" };
+
+/**
+ * @brief Clear bucket <bucket>, ready for new frames
+ */
+static void lmsPlot_ClearBucket(LmsPlot_t* plot, int bucket)
+{
+    for (int s = 0; s < plot->numOfSeries; s++)
+    {
+        plot->minimum[bucket * plot->numOfSeries + s] = INFINITY;
+        plot->maximum[bucket * plot->numOfSeries + s] = -INFINITY;
+        plot->sumSquares[bucket * plot->numOfSeries + s] = 0.0;
+    }
+}
+
+/**
+ * @brief Close the bucket being filled. When it was the last one, merge all buckets in pairs
+ */
+static void lmsPlot_NextBucket(LmsPlot_t* plot)
+{
+    const int series = plot->numOfSeries;
+
+    if (++plot->buckets == plot->settings.width)
+    {
+        plot->buckets /= 2;
+        plot->bucketSize *= 2;
+        for (int b = 0; b < plot->buckets; b++)
+        {
+            for (int s = 0; s < series; s++)
+            {
+                const int first = 2 * b * series + s;
+                const int second = first + series;
+                plot->minimum[b * series + s] = fminf(plot->minimum[first], plot->minimum[second]);
+                plot->maximum[b * series + s] = fmaxf(plot->maximum[first], plot->maximum[second]);
+                plot->sumSquares[b * series + s] = plot->sumSquares[first] + plot->sumSquares[second];
+            }
+        }
+    }
+    lmsPlot_ClearBucket(plot, plot->buckets);
+    plot->fill = 0;
+}
+
+/**
+ * @brief Number of buckets holding frames, the partly filled one included
+ */
+static int lmsPlot_UsedBuckets(const LmsPlot_t* plot)
+{
+    return plot->buckets + ((plot->fill > 0) ? 1 : 0);
+}
+
+/**
+ * @brief Frames in bucket <bucket>
+ */
+static long lmsPlot_BucketFrames(const LmsPlot_t* plot, int bucket)
+{
+    return (bucket < plot->buckets) ? plot->bucketSize : plot->fill;
+}
+
+int lmsPlot_Init(LmsPlot_t* plot, const LmsPlotSettings_t* settings, int numOfSeries, const char* const* names)
+{
+    const char* extension = strrchr(settings->fileName, '.');
+
+    memset(plot, 0, sizeof(*plot));
+    if ((settings->width < LMS_PLOT_MIN_WIDTH) || (settings->width > LMS_PLOT_MAX_WIDTH)
+        || (numOfSeries < 1) || (numOfSeries > LMS_PLOT_MAX_SERIES))
+    {
+        printf("Wrong plot width %d or number of series %d\n", settings->width, numOfSeries);
+        return EXIT_FAILURE;
+    }
+    plot->settings = *settings;
+    plot->settings.width &= ~1;
+    plot->format = LMS_PLOT_FORMAT_HTML;
+    if ((extension != NULL) && (strcmp(extension, ".csv") == 0))
+    {
+        plot->format = LMS_PLOT_FORMAT_CSV;
+    }
+    else if ((extension != NULL) && (strcmp(extension, ".svg") == 0))
+    {
+        plot->format = LMS_PLOT_FORMAT_SVG;
+    }
+    plot->numOfSeries = numOfSeries;
+    plot->names = names;
+    plot->bucketSize = 1;
+
+    const size_t values = (size_t)plot->settings.width * numOfSeries;
+    plot->minimum = (float*)malloc(values * sizeof(float));
+    plot->maximum = (float*)malloc(values * sizeof(float));
+    plot->sumSquares = (double*)malloc(values * sizeof(double));
+    if ((plot->minimum == NULL) || (plot->maximum == NULL) || (plot->sumSquares == NULL))
+    {
+        printf("Error allocating plot of %d buckets\n", plot->settings.width);
+        lmsPlot_Free(plot);
+        return EXIT_FAILURE;
+    }
+    lmsPlot_ClearBucket(plot, 0);
+    return EXIT_SUCCESS;
+}
+
+void lmsPlot_Free(LmsPlot_t* plot)
+{
+    free(plot->minimum);
+    free(plot->maximum);
+    free(plot->sumSquares);
+    plot->minimum = NULL;
+    plot->maximum = NULL;
+    plot->sumSquares = NULL;
+}
+
+void lmsPlot_AddFrames(LmsPlot_t* plot, const float* frames, int count)
+{
+    const int series = plot->numOfSeries;
+
+    plot->frames += count;
+    while (count > 0)
+    {
+        if (plot->fill == plot->bucketSize)
+        {
+            lmsPlot_NextBucket(plot);
+        }
+
+        /* Frames that still fit into the current bucket, each series in one pass */
+        const int n = (plot->bucketSize - plot->fill < count) ? (int)(plot->bucketSize - plot->fill) : count;
+        for (int s = 0; s < series; s++)
+        {
+            float minimum = plot->minimum[plot->buckets * series + s];
+            float maximum = plot->maximum[plot->buckets * series + s];
+            double sumSquares = 0.0;
+
+            for (int i = 0; i < n; i++)
+            {
+                const float value = frames[i * series + s];
+                minimum = (value < minimum) ? value : minimum;
+                maximum = (value > maximum) ? value : maximum;
+                sumSquares += (double)value * value;
+            }
+            plot->minimum[plot->buckets * series + s] = minimum;
+            plot->maximum[plot->buckets * series + s] = maximum;
+            plot->sumSquares[plot->buckets * series + s] += sumSquares;
+        }
+        plot->fill += n;
+        frames += (long)n * series;
+        count -= n;
+    }
+}
+
+/**
+ * @brief Write text with the characters special to XML escaped
+ */
+static void lmsPlot_WriteEscaped(FILE* file, const char* text)
+{
+    for (; *text != '\0'; text++)
+    {
+        switch (*text)
+        {
+            case '&':
+                fputs("&amp;", file);
+                break;
+
+            case '<':
+                fputs("&lt;", file);
+                break;
+
+            case '>':
+                fputs("&gt;", file);
+                break;
+
+            case '"':
+                fputs("&quot;", file);
+                break;
+
+            default:
+                fputc(*text, file);
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Write one bucket per line: first frame, number of frames, then min, max and RMS of every series
+ */
+static void lmsPlot_WriteCsv(const LmsPlot_t* plot, FILE* file)
+{
+    const int series = plot->numOfSeries;
+
+    fprintf(file, "first_frame,frames");
+    for (int s = 0; s < series; s++)
+    {
+        fprintf(file, ",%s_min,%s_max,%s_rms", plot->names[s], plot->names[s], plot->names[s]);
+    }
+    fprintf(file, "\n");
+
+    for (int b = 0; b < lmsPlot_UsedBuckets(plot); b++)
+    {
+        const long frames = lmsPlot_BucketFrames(plot, b);
+        fprintf(file, "%ld,%ld", (long)b * plot->bucketSize, frames);
+        for (int s = 0; s < series; s++)
+        {
+            fprintf(file, ",%.6g,%.6g,%.6g", plot->minimum[b * series + s], plot->maximum[b * series + s],
+                    sqrt(plot->sumSquares[b * series + s] / frames));
+        }
+        fprintf(file, "\n");
+    }
+}
+
+/**
+ * @brief Write the SVG element: one panel per series, the envelope drawn as a filled band between
+ * the minimum and maximum of every bucket
+ */
+static void lmsPlot_WriteSvg(const LmsPlot_t* plot, FILE* file, const char* title)
+{
+    const int series = plot->numOfSeries;
+    const int used = lmsPlot_UsedBuckets(plot);
+    const int width = PLOT_SVG_MARGIN_LEFT + PLOT_SVG_WIDTH + PLOT_SVG_MARGIN_RIGHT;
+    const int height = PLOT_SVG_MARGIN_TOP + series * (PLOT_SVG_PANEL_HEIGHT + PLOT_SVG_PANEL_GAP);
+    const double framesPerPixel = (plot->frames > 0) ? (double)plot->frames / PLOT_SVG_WIDTH : 1.0;
+
+    fprintf(file, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" height=\"%d\" viewBox=\"0 0 %d %d\" "
+            "font-family=\"sans-serif\" font-size=\"12\">\n", width, height, width, height);
+    fprintf(file, "<rect width=\"100%%\" height=\"100%%\" fill=\"white\"/>\n");
+    fprintf(file, "<text x=\"%d\" y=\"24\" font-size=\"16\">", PLOT_SVG_MARGIN_LEFT);
+    lmsPlot_WriteEscaped(file, title);
+    fprintf(file, "</text>\n<text x=\"%d\" y=\"42\" fill=\"#555\">%ld frames, %ld per bucket</text>\n",
+            PLOT_SVG_MARGIN_LEFT, plot->frames, plot->bucketSize);
+
+    for (int s = 0; s < series; s++)
+    {
+        const int top = PLOT_SVG_MARGIN_TOP + s * (PLOT_SVG_PANEL_HEIGHT + PLOT_SVG_PANEL_GAP) + 10;
+        float low = INFINITY;
+        float high = -INFINITY;
+        double sumSquares = 0.0;
+
+        for (int b = 0; b < used; b++)
+        {
+            low = fminf(low, plot->minimum[b * series + s]);
+            high = fmaxf(high, plot->maximum[b * series + s]);
+            sumSquares += plot->sumSquares[b * series + s];
+        }
+        if (!(low <= high) || !isfinite(low) || !isfinite(high))
+        {
+            low = -1.0f;
+            high = 1.0f;
+        }
+        else if (high - low < 1e-12f * (1.0f + fabsf(high)))
+        {
+            low -= 0.5f * (1.0f + fabsf(low));
+            high += 0.5f * (1.0f + fabsf(high));
+        }
+        const double scale = PLOT_SVG_PANEL_HEIGHT / ((double)high - low);
+
+        fprintf(file, "<g>\n<rect x=\"%d\" y=\"%d\" width=\"%d\" height=\"%d\" fill=\"none\" stroke=\"#999\"/>\n",
+                PLOT_SVG_MARGIN_LEFT, top, PLOT_SVG_WIDTH, PLOT_SVG_PANEL_HEIGHT);
+        if ((low < 0.0f) && (high > 0.0f))
+        {
+            const double zero = top + high * scale;
+            fprintf(file, "<line x1=\"%d\" y1=\"%.1f\" x2=\"%d\" y2=\"%.1f\" stroke=\"#ccc\"/>\n",
+                    PLOT_SVG_MARGIN_LEFT, zero, PLOT_SVG_MARGIN_LEFT + PLOT_SVG_WIDTH, zero);
+        }
+        fprintf(file, "<text x=\"%d\" y=\"%d\" text-anchor=\"end\">%.4g</text>\n", PLOT_SVG_MARGIN_LEFT - 6, top + 10, high);
+        fprintf(file, "<text x=\"%d\" y=\"%d\" text-anchor=\"end\">%.4g</text>\n", PLOT_SVG_MARGIN_LEFT - 6,
+                top + PLOT_SVG_PANEL_HEIGHT, low);
+        fprintf(file, "<text x=\"%d\" y=\"%d\" fill=\"%s\">", PLOT_SVG_MARGIN_LEFT + 6, top + 16, lmsPlotColors[s]);
+        lmsPlot_WriteEscaped(file, plot->names[s]);
+        fprintf(file, " (RMS %.4g)</text>\n", (plot->frames > 0) ? sqrt(sumSquares / plot->frames) : 0.0);
+
+        /* Maximum from left to right, then minimum back, every bucket at its middle frame */
+        fprintf(file, "<polygon fill=\"%s\" fill-opacity=\"0.35\" stroke=\"%s\" stroke-width=\"0.8\" points=\"",
+                lmsPlotColors[s], lmsPlotColors[s]);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (int i = 0; i < used; i++)
+            {
+                const int b = (pass == 0) ? i : (used - 1 - i);
+                float value = (pass == 0) ? plot->maximum[b * series + s] : plot->minimum[b * series + s];
+                if (!isfinite(value))
+                {
+                    value = (pass == 0) ? high : low;
+                }
+                const double middle = b * (double)plot->bucketSize + 0.5 * lmsPlot_BucketFrames(plot, b);
+                fprintf(file, "%.1f,%.1f ", PLOT_SVG_MARGIN_LEFT + middle / framesPerPixel,
+                        top + ((double)high - value) * scale);
+            }
+        }
+        fprintf(file, "\"/>\n");
+
+        fprintf(file, "<text x=\"%d\" y=\"%d\">0</text>\n", PLOT_SVG_MARGIN_LEFT, top + PLOT_SVG_PANEL_HEIGHT + 16);
+        fprintf(file, "<text x=\"%d\" y=\"%d\" text-anchor=\"end\">%ld</text>\n</g>\n",
+                PLOT_SVG_MARGIN_LEFT + PLOT_SVG_WIDTH, top + PLOT_SVG_PANEL_HEIGHT + 16, plot->frames);
+    }
+    fprintf(file, "</svg>\n");
+}
+
+int lmsPlot_Write(const LmsPlot_t* plot, const char* title)
+{
+    FILE* file = fopen(plot->settings.fileName, "w");
+
+    if (file == NULL)
+    {
+        perror(plot->settings.fileName);
+        return EXIT_FAILURE;
+    }
+    switch (plot->format)
+    {
+        case LMS_PLOT_FORMAT_CSV:
+            lmsPlot_WriteCsv(plot, file);
+            break;
+
+        case LMS_PLOT_FORMAT_SVG:
+            fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+            lmsPlot_WriteSvg(plot, file, title);
+            break;
+
+        default:
+            fprintf(file, "<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n<title>");
+            lmsPlot_WriteEscaped(file, title);
+            fprintf(file, "</title>\n</head>\n<body style=\"margin:0\">\n");
+            lmsPlot_WriteSvg(plot, file, title);
+            fprintf(file, "</body>\n</html>\n");
+            break;
+    }
+
+    int retval = (ferror(file) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    if (fclose(file) != 0)
+    {
+        retval = EXIT_FAILURE;
+    }
+    if (retval != EXIT_SUCCESS)
+    {
+        perror(plot->settings.fileName);
+    }
+    return retval;
+}
+
+int lmsPlot_PlotFile(const char* inputFileName, SampleFormat_t format, const LmsPlotSettings_t* settings)
+{
+    SampleReader_t reader;
+    LmsPlot_t plot;
+
+    if (format == SAMPLE_FORMAT_UNKNOWN)
+    {
+        format = sampleIo_FormatFromFileName(inputFileName);
+    }
+
+    /* Text frames start with their index, it is skipped */
+    const int index = (format == SAMPLE_FORMAT_TEXT) ? 1 : 0;
+    if (sampleIo_OpenReader(&reader, inputFileName, format, 3 + index) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    if (reader.channels != 3 + index)
+    {
+        printf("Error: %s is not a filtered file with input, output and error\n", inputFileName);
+        sampleIo_CloseReader(&reader);
+        return EXIT_FAILURE;
+    }
+
+    float* frames = (float*)malloc((size_t)SAMPLE_IO_BUFFER_FRAMES * reader.channels * sizeof(float));
+    int retval = lmsPlot_Init(&plot, settings, 3, lmsPlot_FilterSeriesNames());
+    if (frames == NULL)
+    {
+        retval = EXIT_FAILURE;
+    }
+
+    int count;
+    while ((retval == EXIT_SUCCESS) && ((count = sampleIo_Read(&reader, frames, SAMPLE_IO_BUFFER_FRAMES)) > 0))
+    {
+        if (index != 0)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                memmove(&frames[3 * i], &frames[4 * i + 1], 3 * sizeof(float));
+            }
+        }
+        lmsPlot_AddFrames(&plot, frames, count);
+    }
+    if (retval == EXIT_SUCCESS)
+    {
+        retval = lmsPlot_Write(&plot, inputFileName);
+    }
+
+    lmsPlot_Free(&plot);
+    free(frames);
+    if (sampleIo_CloseReader(&reader))
+    {
+        perror(inputFileName);
+        retval = EXIT_FAILURE;
+    }
+    return retval;
+}
+
+int lmsPlot_Open(const char* fileName)
+{
+    char* const argv[] = { "xdg-open", (char*)fileName, NULL };
+    pid_t pid;
+    int status;
+
+    if ((posix_spawnp(&pid, argv[0], NULL, NULL, argv, environ) != 0)
+        || (waitpid(pid, &status, 0) != pid) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+    {
+        printf("Error opening %s with %s\n", fileName, argv[0]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+const char* const* lmsPlot_FilterSeriesNames(void)
+{
+    return lmsPlotFilterSeries;
+}
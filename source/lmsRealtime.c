@@ -0,0 +1,178 @@
+/**
+ * @file lmsRealtime.c
+ * @author shed258
+ * @brief Real-time processing support: worker thread setup, per-block latency histogram and deadline misses
+ * @version 1.0.0
+ *
+ */
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include "lmsRealtime.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LMS_REALTIME_X86
+#include <xmmintrin.h>
+#define LMS_REALTIME_MXCSR_FTZ_DAZ  0x8040
+#endif
+
+/**
+ * @brief Histogram bucket of a value: exact below LMS_REALTIME_SUB_BUCKETS, then
+ * LMS_REALTIME_SUB_BUCKETS buckets per power of two
+ */
+static unsigned int lmsRealtime_Bucket(unsigned long long value)
+{
+    if (value < LMS_REALTIME_SUB_BUCKETS)
+    {
+        return (unsigned int)value;
+    }
+    const unsigned int exponent = 63 - __builtin_clzll(value);
+    const unsigned int shift = exponent - LMS_REALTIME_SUB_BUCKETS_LOG2;
+    const unsigned int mantissa = (unsigned int)(value >> shift) & (LMS_REALTIME_SUB_BUCKETS - 1);
+    return (shift + 1) * LMS_REALTIME_SUB_BUCKETS + mantissa;
+}
+
+/**
+ * @brief Largest value that falls into the bucket
+ */
+static unsigned long long lmsRealtime_BucketUpperBound(unsigned int bucket)
+{
+    if (bucket < LMS_REALTIME_SUB_BUCKETS)
+    {
+        return bucket;
+    }
+    const unsigned int shift = bucket / LMS_REALTIME_SUB_BUCKETS - 1;
+    const unsigned long long mantissa = LMS_REALTIME_SUB_BUCKETS + bucket % LMS_REALTIME_SUB_BUCKETS;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+/**
+ * @brief Value below or at which <fraction> of recorded blocks are
+ */
+static unsigned long long lmsRealtime_Percentile(const LmsLatencyHistogram_t* histogram, double fraction)
+{
+    unsigned long long rank = (unsigned long long)(fraction * histogram->total + 0.5);
+    unsigned long long count = 0;
+
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+    for (unsigned int i = 0; i < LMS_REALTIME_BUCKETS; i++)
+    {
+        count += histogram->counts[i];
+        if (count >= rank)
+        {
+            const unsigned long long bound = lmsRealtime_BucketUpperBound(i);
+            return (bound < histogram->maxNs) ? bound : histogram->maxNs;
+        }
+    }
+    return histogram->maxNs;
+}
+
+int lmsRealtime_Init(LmsRealtime_t* realtime, const LmsRealtimeSettings_t* settings)
+{
+    if ((settings->sampleRate == 0) || (settings->blockSize < 1))
+    {
+        printf("ERROR: Real-time mode needs a sample rate and a positive block size\n");
+        return EXIT_FAILURE;
+    }
+    memset(realtime, 0, sizeof(*realtime));
+    realtime->settings = *settings;
+    realtime->deadlineNs = (unsigned long long)settings->blockSize * 1000000000ull / settings->sampleRate;
+    return EXIT_SUCCESS;
+}
+
+void lmsRealtime_ConfigureThread(const LmsRealtimeSettings_t* settings)
+{
+    if (settings->cpu >= 0)
+    {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(settings->cpu, &cpus);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0)
+        {
+            printf("WARNING: Cannot pin the worker thread to CPU %d\n", settings->cpu);
+        }
+    }
+    if (settings->priority > 0)
+    {
+        struct sched_param parameters = { .sched_priority = settings->priority };
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) != 0)
+        {
+            printf("WARNING: SCHED_FIFO priority %d not permitted, running with the default policy\n",
+                   settings->priority);
+        }
+
+        /* Page faults of a real-time thread are as bad as allocations */
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        {
+            printf("WARNING: Memory cannot be locked\n");
+        }
+    }
+
+#ifdef LMS_REALTIME_X86
+    /* Decaying coefficients and signals must not fall into slow denormal arithmetic */
+    _mm_setcsr(_mm_getcsr() | LMS_REALTIME_MXCSR_FTZ_DAZ);
+#endif
+}
+
+unsigned long long lmsRealtime_Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+void lmsRealtime_Record(LmsRealtime_t* realtime, unsigned long long elapsedNs)
+{
+    LmsLatencyHistogram_t* histogram = &realtime->histogram;
+
+    histogram->counts[lmsRealtime_Bucket(elapsedNs)]++;
+    histogram->total++;
+    histogram->sumNs += elapsedNs;
+    if (elapsedNs > histogram->maxNs)
+    {
+        histogram->maxNs = elapsedNs;
+    }
+    if (elapsedNs > realtime->deadlineNs)
+    {
+        realtime->deadlineMisses++;
+    }
+}
+
+void lmsRealtime_GetStats(const LmsRealtime_t* realtime, LmsRealtimeStats_t* stats)
+{
+    const LmsLatencyHistogram_t* histogram = &realtime->histogram;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->blocks = histogram->total;
+    stats->deadlineMisses = realtime->deadlineMisses;
+    stats->deadlineNs = realtime->deadlineNs;
+    if (histogram->total > 0)
+    {
+        stats->p50Ns = lmsRealtime_Percentile(histogram, 0.5);
+        stats->p99Ns = lmsRealtime_Percentile(histogram, 0.99);
+        stats->p999Ns = lmsRealtime_Percentile(histogram, 0.999);
+        stats->maxNs = histogram->maxNs;
+        stats->meanNs = (double)histogram->sumNs / histogram->total;
+    }
+}
+
+void lmsRealtime_PrintStats(const LmsRealtimeStats_t* stats)
+{
+    printf("Blocks:                       %llu\n", stats->blocks);
+    printf("Block deadline:               %.3f us\n", stats->deadlineNs / 1000.0);
+    printf("Block time mean:              %.3f us\n", stats->meanNs / 1000.0);
+    printf("Block time p50:               %.3f us\n", stats->p50Ns / 1000.0);
+    printf("Block time p99:               %.3f us\n", stats->p99Ns / 1000.0);
+    printf("Block time p99.9:             %.3f us\n", stats->p999Ns / 1000.0);
+    printf("Block time max:               %.3f us\n", stats->maxNs / 1000.0);
+    printf("Deadline misses:              %llu\n", stats->deadlineMisses);
+}
@@ -0,0 +1,249 @@
+/**
+ * @file lmsTelemetry.c
+ * @author shed258
+ * @brief Convergence telemetry of an adaptive filter: running MSE, coefficient norm drift,
+ * time to convergence and divergence warnings, updated in O(1) per sample
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "lmsTelemetry.h"
+
+#define LMS_TELEMETRY_POWER_FLOOR   1e-30   /* power of silence in dB conversions */
+
+/**
+ * @brief Power ratio in dB, silence is clamped to -300 dB
+ */
+static double lmsTelemetry_Db(double power)
+{
+    return 10.0 * log10((power > LMS_TELEMETRY_POWER_FLOOR) ? power : LMS_TELEMETRY_POWER_FLOOR);
+}
+
+/**
+ * @brief Record warnings, the first one keeps its sample
+ * @return Warnings not raised before
+ */
+static int lmsTelemetry_Raise(LmsTelemetry_t* telemetry, int warnings)
+{
+    const int raised = warnings & ~telemetry->warnings;
+
+    if ((raised != 0) && (telemetry->warnings == 0))
+    {
+        telemetry->firstWarningAt = telemetry->samples;
+    }
+    telemetry->warnings |= raised;
+    return raised;
+}
+
+void lmsTelemetry_DefaultSettings(LmsTelemetrySettings_t* settings)
+{
+    settings->shortWindow = LMS_TELEMETRY_DEFAULT_SHORT_WINDOW;
+    settings->longWindow = LMS_TELEMETRY_DEFAULT_LONG_WINDOW;
+    settings->convergenceMargin = LMS_TELEMETRY_DEFAULT_CONVERGENCE_MARGIN;
+    settings->convergenceLevel = LMS_TELEMETRY_DEFAULT_CONVERGENCE_LEVEL;
+    settings->divergenceMargin = LMS_TELEMETRY_DEFAULT_DIVERGENCE_MARGIN;
+}
+
+int lmsTelemetry_Init(LmsTelemetry_t* telemetry, const LmsTelemetrySettings_t* settings, int length)
+{
+    if ((settings->shortWindow < 1) || (settings->longWindow <= settings->shortWindow)
+        || !(settings->convergenceMargin > 0) || !(settings->divergenceMargin > 0) || !(settings->convergenceLevel < 0))
+    {
+        printf("ERROR: Telemetry needs 0 < short window < long window, positive margins and a negative level\n");
+        return EXIT_FAILURE;
+    }
+
+    memset(telemetry, 0, sizeof(*telemetry));
+    telemetry->settings = *settings;
+    telemetry->shortWeight = 1.0 / settings->shortWindow;
+    telemetry->longWeight = 1.0 / settings->longWindow;
+    telemetry->convergedHigh = pow(10.0, settings->convergenceMargin / 10.0);
+    telemetry->convergedLow = 1.0 / telemetry->convergedHigh;
+    telemetry->convergedLevel = pow(10.0, settings->convergenceLevel / 10.0);
+    telemetry->divergenceRatio = pow(10.0, settings->divergenceMargin / 10.0);
+    telemetry->holdStart = -1;
+    telemetry->convergedAt = -1;
+    telemetry->firstWarningAt = -1;
+
+    /* Norms cost O(length), taken once per <length> samples they stay O(1) per sample */
+    telemetry->normInterval = (length > LMS_TELEMETRY_NORM_INTERVAL) ? length : LMS_TELEMETRY_NORM_INTERVAL;
+    telemetry->nextNormCheck = telemetry->normInterval;
+
+    return EXIT_SUCCESS;
+}
+
+int lmsTelemetry_Update(LmsTelemetry_t* telemetry, const float* desired, const float* error, int count)
+{
+    const long shortWindow = telemetry->settings.shortWindow;
+    const long longWindow = telemetry->settings.longWindow;
+    double shortMse = telemetry->shortMse;
+    double longMse = telemetry->longMse;
+    double desiredPower = telemetry->desiredPower;
+    double shortDesiredPower = telemetry->shortDesiredPower;
+    int warnings = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const double e2 = (double)error[i] * error[i];
+        const double d2 = (double)desired[i] * desired[i];
+        const long n = ++telemetry->samples;
+
+        if (isfinite(e2) == 0)
+        {
+            warnings |= lmsTelemetry_Raise(telemetry, LMS_TELEMETRY_WARNING_NON_FINITE);
+            break;
+        }
+
+        /* Exponential averages start as plain means, so the first window is not biased towards zero */
+        const double shortWeight = (n < shortWindow) ? 1.0 / n : telemetry->shortWeight;
+        const double longWeight = (n < longWindow) ? 1.0 / n : telemetry->longWeight;
+        shortMse += shortWeight * (e2 - shortMse);
+        longMse += longWeight * (e2 - longMse);
+        desiredPower += longWeight * (d2 - desiredPower);
+        shortDesiredPower += shortWeight * (d2 - shortDesiredPower);
+
+        /* Both averages follow an exponentially growing error, so divergence is caught by the error
+         * getting louder than the signal it is to match, long before samples overflow. A sudden jump
+         * shows as the fast average leaving the slow one */
+        if ((n >= shortWindow) && ((shortMse > shortDesiredPower * telemetry->divergenceRatio)
+                                   || (shortMse > longMse * telemetry->divergenceRatio)))
+        {
+            warnings |= lmsTelemetry_Raise(telemetry, LMS_TELEMETRY_WARNING_ERROR_RISING);
+        }
+        if (n < longWindow)
+        {
+            continue;
+        }
+
+        /* Converged when the fast average stays near the slow one for a whole long window, or below the
+         * convergence level, as an error still falling towards the rounding floor never settles */
+        if (((shortMse >= longMse * telemetry->convergedLow) && (shortMse <= longMse * telemetry->convergedHigh))
+            || (shortMse <= shortDesiredPower * telemetry->convergedLevel))
+        {
+            if (telemetry->holdStart < 0)
+            {
+                telemetry->holdStart = n;
+            }
+            else if ((telemetry->convergedAt < 0) && (n - telemetry->holdStart >= longWindow))
+            {
+                telemetry->convergedAt = telemetry->holdStart;
+            }
+        }
+        else
+        {
+            telemetry->holdStart = -1;
+        }
+    }
+
+    telemetry->shortMse = shortMse;
+    telemetry->longMse = longMse;
+    telemetry->desiredPower = desiredPower;
+    telemetry->shortDesiredPower = shortDesiredPower;
+
+    return warnings;
+}
+
+int lmsTelemetry_NormDue(const LmsTelemetry_t* telemetry)
+{
+    return telemetry->samples >= telemetry->nextNormCheck;
+}
+
+int lmsTelemetry_UpdateNorm(LmsTelemetry_t* telemetry, double normSquared)
+{
+    int warnings = 0;
+
+    telemetry->nextNormCheck = telemetry->samples + telemetry->normInterval;
+    if (isfinite(normSquared) == 0)
+    {
+        return lmsTelemetry_Raise(telemetry, LMS_TELEMETRY_WARNING_NON_FINITE);
+    }
+
+    telemetry->norm = sqrt(normSquared);
+    if (telemetry->norm > telemetry->peakNorm)
+    {
+        telemetry->peakNorm = telemetry->norm;
+    }
+    if ((telemetry->convergedAt >= 0) && (telemetry->convergedNorm == 0.0))
+    {
+        telemetry->convergedNorm = telemetry->norm;
+    }
+    /* Norm is an amplitude, the margin is applied as 20 log10 */
+    if ((telemetry->convergedNorm > 0.0)
+        && (telemetry->norm * telemetry->norm > telemetry->convergedNorm * telemetry->convergedNorm * telemetry->divergenceRatio))
+    {
+        warnings = lmsTelemetry_Raise(telemetry, LMS_TELEMETRY_WARNING_NORM_DRIFT);
+    }
+    return warnings;
+}
+
+const char* lmsTelemetry_WarningName(int warning)
+{
+    switch (warning)
+    {
+        case LMS_TELEMETRY_WARNING_ERROR_RISING:
+            return "error rising above the desired signal or its long-term level";
+
+        case LMS_TELEMETRY_WARNING_NORM_DRIFT:
+            return "coefficient norm drifting since convergence";
+
+        case LMS_TELEMETRY_WARNING_NON_FINITE:
+            return "non-finite error or coefficients";
+
+        default:
+            return "unknown";
+    }
+}
+
+void lmsTelemetry_GetStats(const LmsTelemetry_t* telemetry, LmsTelemetryStats_t* stats)
+{
+    stats->samples = telemetry->samples;
+    stats->shortMseDb = lmsTelemetry_Db(telemetry->shortMse);
+    stats->longMseDb = lmsTelemetry_Db(telemetry->longMse);
+    stats->relativeMseDb = stats->longMseDb - lmsTelemetry_Db(telemetry->desiredPower);
+    stats->convergedAt = telemetry->convergedAt;
+    stats->norm = telemetry->norm;
+    stats->normDriftDb = (telemetry->convergedNorm > 0.0) ?
+                         20.0 * log10((telemetry->norm > 0.0) ? telemetry->norm / telemetry->convergedNorm : 1e-15) : 0.0;
+    stats->peakNorm = telemetry->peakNorm;
+    stats->warnings = telemetry->warnings;
+    stats->firstWarningAt = telemetry->firstWarningAt;
+}
+
+void lmsTelemetry_PrintStats(const LmsTelemetryStats_t* stats, const char* name)
+{
+    printf("Telemetry of:                 %s\n", name);
+    printf("MSE short / long window:      %.2f / %.2f dB\n", stats->shortMseDb, stats->longMseDb);
+    printf("MSE relative to desired:      %.2f dB\n", stats->relativeMseDb);
+    if (stats->convergedAt >= 0)
+    {
+        printf("Converged at sample:          %ld\n", stats->convergedAt);
+    }
+    else
+    {
+        printf("Converged at sample:          not converged in %ld samples\n", stats->samples);
+    }
+    printf("Coefficient norm:             %.6g (peak %.6g)\n", stats->norm, stats->peakNorm);
+    if (stats->convergedAt >= 0)
+    {
+        printf("Norm drift since convergence: %+.2f dB\n", stats->normDriftDb);
+    }
+    if (stats->warnings == 0)
+    {
+        printf("Warnings:                     none\n");
+    }
+    else
+    {
+        printf("Warnings:                     first at sample %ld\n", stats->firstWarningAt);
+        for (int warning = LMS_TELEMETRY_WARNING_ERROR_RISING; warning <= LMS_TELEMETRY_WARNING_NON_FINITE; warning <<= 1)
+        {
+            if (stats->warnings & warning)
+            {
+                printf("                              %s\n", lmsTelemetry_WarningName(warning));
+            }
+        }
+    }
+}
@@ -9,15 +9,21 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <glob.h>
 #include "lmsFilter.h"
+#include "lmsFixed.h"
+#include "subbandFilter.h"
+#include "rlsFilter.h"
+#include "apaFilter.h"
+#include "lmsBench.h"
+#include "lmsPlot.h"
 #include "signalGenerator.h"
 
-#define MAX_ARGC_NUMBER                 6
 #define ARGC_NUMBER_FOR_GENERATE_MODE   6
 #define ARGC_NUMBER_FOR_FILTER_MODE     5
 #define ARGC_NUMBER_FOR_PLOT_MODE       3
-
-static const char pythonPlotScript[20] = "../scripts/plot.py";
+#define ARGC_NUMBER_FOR_BENCH_MODE      2
 
 typedef enum
 {
@@ -42,9 +48,66 @@ static const char *const usage[] =
     "Options:\n",
     "  --help                                               Display this information.\n",
     "  --version                                            Display version information.\n",
-    "  --generate <type> <resolution> <cycles> <file>       Generate samples for the selected waveform and number of cycles and save them to a file\n",
-    "  --filter <length> <stepsize> <file>                  Filter the signal in the form of samples read from the file. The parameters of the LMS filter are filter length(order) and step size\n",
-    "  --plot <file>                                        Plot filtered waveform from file",
+    "  --generate <type> <resolution> <cycles> <file>       Generate samples for the selected waveform and number of cycles and save them to a file. Types: sine, square, sawtooth, chirp, white, pink, sine-noise\n",
+    "      [--amplitude <a>]                                Peak of periodic waveforms, noise RMS is <a> / 4. Default 1\n",
+    "      [--snr <db>]                                     Sine to noise ratio of sine-noise. Default 20\n",
+    "      [--end-resolution <n>]                           Samples per cycle at the end of a chirp, which starts at <resolution>. Default 4\n",
+    "      [--seed <n>]                                     Seed of noise, the same seed gives the same noise. Default 1\n",
+    "      [--threads <n>]                                  Threads generating binary files, the output does not depend on it. Default number of CPUs\n",
+    "      [--format <format>]                              Output sample format: text, f32, s16, wav, wavf32. Default from file extension (.f32, .s16, .wav), otherwise text\n",
+    "      [--io <io>]                                      File I/O: auto (io_uring, a pread/pwrite thread when not available), uring, thread or stdio (blocking, on the calling thread). Default auto\n",
+    "  --filter <length> <stepsize> <file>                  Filter the signal in the form of samples read from the file. The parameters of the LMS filter are filter length(order) and step size. Use - for <file> to read standard input. A glob pattern (quoted) or @<listfile> with one file per line filters a batch of files in parallel\n",
+    "      [--algo <algo>]                                  Filtering algorithm: lms (time domain), fdaf (frequency-domain block LMS, for filters of thousands of taps, adapts every 256 samples so narrowband input needs a smaller step), q15 (fixed-point time domain LMS, bit-exact on every CPU, step size rounded to a power of two), subband (normalized LMS in decimated filterbank bands, for long filters and colored input, step size 0 to 2 per band, output delayed by 8 * <bands> samples), rls (recursive least squares, step size is 1 - forgetting factor, e.g. 0.001, direct form up to 64 taps and O(L) lattice above) or apa (affine projection, converges fast on colored input, normalized step size 0 to 2, 1 for the fastest convergence). Default lms\n",
+    "      [--bands <n>]                                    Filterbank bands of the subband algorithm, power of two from 4 to 1024. Default 32\n",
+    "      [--projection <n>]                               Input vectors of one projection of the apa algorithm, 1 (NLMS) to 32. Default 4\n",
+    "      [--variant <variant>]                            LMS update rule: lms, nlms, leaky, sign-error, sign-data, sign-sign. Default lms\n",
+    "      [--leakage <leakage>]                            Leakage of the leaky variant, coefficients decay by stepsize * leakage per sample. Default 0.01\n",
+    "      [--desired <file>]                               Desired signal read in lock-step with the input, e.g. for system identification or echo cancellation. Default input delayed by <length> - 1 samples\n",
+    "      [--two-column]                                   Input file holds frames of input and desired samples\n",
+    "      [--format <format>]                              Input sample format. Default from file extension, WAV details from header\n",
+    "      [--output <file>]                                Output file. Default <file>filtered\n",
+    "      [--output-format <format>]                       Output sample format. Default same as input\n",
+    "      [--channels <n>]                                 Number of interleaved channels in raw and text input, each filtered separately to <output>.<channel>. Default 1\n",
+    "      [--bank]                                         Filter all interleaved channels with one vectorized filter bank (structure of arrays), for many channels with short filters\n",
+    "      [--threads <n>]                                  Worker threads for batch and multi-channel filtering and for the bands of a single subband filter. Default number of CPUs\n",
+    "      [--no-pipeline]                                  Read, filter and write a single file on one thread. Default separate reader, filter and writer threads\n",
+    "      [--realtime]                                     Load the file, filter it in small blocks on a real-time worker thread and report block time percentiles and deadline misses\n",
+    "      [--rt-block <n>]                                 Real-time block size in samples. Default 64\n",
+    "      [--rt-rate <hz>]                                 Sample rate giving the block deadline. Default from the input\n",
+    "      [--rt-priority <n>]                              SCHED_FIFO priority of the worker thread, where permitted. Default 0, normal scheduling\n",
+    "      [--rt-cpu <n>]                                   Pin the worker thread to a CPU. Default any\n",
+    "      [--rt-paced]                                     Release blocks at the sample clock instead of back-to-back\n",
+    "      [--telemetry]                                    Track running MSE, coefficient norm and convergence of every filter, warn when the error starts rising and print a summary per output\n",
+    "      [--telemetry-window <short> <long>]              Windows of the fast and slow MSE averages in samples. Default 256 8192\n",
+    "      [--telemetry-margin <converged> <diverging>]     Converged once both averages stay within <converged> dB for a long window, warn when the fast one or the norm rises <diverging> dB. Default 1.5 20\n",
+    "      [--telemetry-level <dB>]                         Also converged once the fast average stays <dB> below the desired signal power for a long window. Default -40\n",
+    "      [--checkpoint <file>]                            lms algorithm: save the adapted filter (coefficients, delay line, step size, variant) after the last input sample. Multi-channel runs save the coefficients of all channels in one file\n",
+    "      [--checkpoint-every <n>]                         Also save the checkpoint every <n> input samples of a single channel run\n",
+    "      [--resume <file>]                                Continue a single channel run from a checkpoint: the state is restored and the input samples it has filtered are skipped, the output continues bit-exactly\n",
+    "      [--warm-start <file>]                            Start from the coefficients of a checkpoint instead of zeros, one row per channel or one row for all channels\n",
+    "      [--plot <file>]                                  Save a min/max envelope of input, output and error, collected while filtering a single channel: .csv, .svg, otherwise self-contained HTML\n",
+    "      [--plot-width <n>]                               Buckets of the envelope, about one per pixel. Default 1024\n",
+    "      [--plot-open]                                    Open the saved plot with the desktop viewer\n",
+    "      [--io <io>]                                      File I/O: auto (io_uring, a pread/pwrite thread when not available), uring, thread or stdio (blocking, on the calling thread). Regular binary input is read ahead and regular output written behind in large buffers. Default auto\n",
+    "  --bench                                              Measure filter throughput on synthetic input in memory with every kernel the CPU supports, and the samples each algorithm needs to identify an unknown system driven by pink noise\n",
+    "      [--lengths <list>]                               Comma separated filter lengths. Default 16,64,256,1024\n",
+    "      [--blocks <list>]                                Comma separated block sizes. Default 64,4096\n",
+    "      [--samples <n>]                                  Samples filtered in one trial. Default 131072\n",
+    "      [--trials <n>]                                   Measured trials, median and minimum are reported. Default 5\n",
+    "      [--warmup <n>]                                   Trials run before measuring. Default 1\n",
+    "      [--variants]                                     Measure all LMS variants. Default lms only\n",
+    "      [--no-fdaf]                                      Skip the fdaf algorithm\n",
+    "      [--no-q15]                                       Skip the q15 fixed-point algorithm\n",
+    "      [--no-subband]                                   Skip the subband algorithm\n",
+    "      [--no-rls]                                       Skip the recursive least squares algorithm\n",
+    "      [--no-apa]                                       Skip the affine projection algorithm\n",
+    "      [--format <format>]                              Report format: table, csv, json. Default table\n",
+    "      [--output <file>]                                Report file. Default standard output\n",
+    "  --plot <file>                                        Save a min/max envelope plot of a filtered file, read as a stream\n",
+    "      [--output <file>]                                Plot file: .csv, .svg, otherwise self-contained HTML. Default <file>.html\n",
+    "      [--width <n>]                                    Buckets of the envelope, about one per pixel. Default 1024\n",
+    "      [--format <format>]                              Sample format of the filtered file. Default from file extension\n",
+    "      [--open]                                         Open the saved plot with the desktop viewer\n",
     NULL
 };
 
@@ -125,21 +188,19 @@ static int processGenerateArgumentFile(const char* filename)
 static int verifyFilterArgumentFile(const char* filename)
 {
     int retval = EXIT_SUCCESS;
-    FILE *file;
-    long fileSize;
-
-    file = fopen(filename, "r");
+    struct stat fileStat;
 
-    if (file != NULL)
+    if (strcmp(filename, SAMPLE_IO_STDIN) == 0)
+    {
+        /* Standard input is checked while reading */
+    }
+    else if (stat(filename, &fileStat) == 0)
     {
-        fseek(file, 0L, SEEK_END);
-        fileSize = ftell(file);
-        if (fileSize == 0)
+        if (S_ISREG(fileStat.st_mode) && (fileStat.st_size == 0))
         {
             printf("File is empty\n");
             retval = EXIT_FAILURE;
         }
-        fclose(file);
     }
     else
     {
@@ -149,6 +210,135 @@ static int verifyFilterArgumentFile(const char* filename)
     return retval;
 }
 
+/**
+ * @brief Check if argument <file> in filtering mode names a batch of files
+ * @param arg   Argument <file>
+ * @return 1 for a glob pattern or @<listfile>, otherwise 0
+ */
+static int isFilterFileBatch(const char* arg)
+{
+    return ((arg[0] == '@') || (strpbrk(arg, "*?[") != NULL)) ? 1 : 0;
+}
+
+/**
+ * @brief Append a copy of the file name to the list of input files
+ * @return EXIT_SUCCESS when appended
+ */
+static int appendInputFile(char*** fileNames, int* numOfFiles, int* capacity, const char* fileName)
+{
+    if (*numOfFiles == *capacity)
+    {
+        int newCapacity = (*capacity > 0) ? (2 * *capacity) : 16;
+        char** newFileNames = (char**)realloc(*fileNames, newCapacity * sizeof(char*));
+        if (newFileNames == NULL)
+        {
+            printf("Error allocating file list\n");
+            return EXIT_FAILURE;
+        }
+        *fileNames = newFileNames;
+        *capacity = newCapacity;
+    }
+    (*fileNames)[*numOfFiles] = strdup(fileName);
+    if ((*fileNames)[*numOfFiles] == NULL)
+    {
+        printf("Error allocating file list\n");
+        return EXIT_FAILURE;
+    }
+    (*numOfFiles)++;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Release list of input files
+ */
+static void freeInputFiles(char** fileNames, int numOfFiles)
+{
+    for (int i = 0; i < numOfFiles; i++)
+    {
+        free(fileNames[i]);
+    }
+    free(fileNames);
+}
+
+/**
+ * @brief Expand argument <file> in filtering mode to the list of input files.
+ * Argument is a single file, a glob pattern or @<listfile> with one file name per line
+ * @param arg           Argument <file>
+ * @param fileNames     Allocated list of file names
+ * @param numOfFiles    Number of files in the list
+ * @return EXIT_SUCCESS when all files exist and are not empty
+ */
+static int expandFilterArgumentFile(const char* arg, char*** fileNames, int* numOfFiles)
+{
+    int retval = EXIT_SUCCESS;
+    int capacity = 0;
+
+    *fileNames = NULL;
+    *numOfFiles = 0;
+
+    if (isFilterFileBatch(arg) == 0)
+    {
+        return appendInputFile(fileNames, numOfFiles, &capacity, arg);
+    }
+
+    if (arg[0] == '@')
+    {
+        FILE* listFile = fopen(&arg[1], "r");
+        char line[4096];
+
+        if (listFile == NULL)
+        {
+            perror(&arg[1]);
+            return EXIT_FAILURE;
+        }
+        while ((retval == EXIT_SUCCESS) && (fgets(line, sizeof(line), listFile) != NULL))
+        {
+            line[strcspn(line, "\r\n")] = '\0';
+            if (line[0] != '\0')
+            {
+                retval = appendInputFile(fileNames, numOfFiles, &capacity, line);
+            }
+        }
+        fclose(listFile);
+    }
+    else
+    {
+        glob_t globResult;
+
+        if (glob(arg, 0, NULL, &globResult) != 0)
+        {
+            printf("No files match %s\n", arg);
+            return EXIT_FAILURE;
+        }
+        for (size_t i = 0; (retval == EXIT_SUCCESS) && (i < globResult.gl_pathc); i++)
+        {
+            retval = appendInputFile(fileNames, numOfFiles, &capacity, globResult.gl_pathv[i]);
+        }
+        globfree(&globResult);
+    }
+
+    if ((retval == EXIT_SUCCESS) && (*numOfFiles == 0))
+    {
+        printf("No input files\n");
+        retval = EXIT_FAILURE;
+    }
+    for (int i = 0; (retval == EXIT_SUCCESS) && (i < *numOfFiles); i++)
+    {
+        if (verifyFilterArgumentFile((*fileNames)[i]) != EXIT_SUCCESS)
+        {
+            printf("Input file: %s\n", (*fileNames)[i]);
+            retval = EXIT_FAILURE;
+        }
+    }
+    if (retval != EXIT_SUCCESS)
+    {
+        freeInputFiles(*fileNames, *numOfFiles);
+        *fileNames = NULL;
+        *numOfFiles = 0;
+    }
+    return retval;
+}
+
 /**
  * @brief Process parameters for signal generation
  * @param arg       Program argument
@@ -200,6 +390,533 @@ static int processArgsToGenerateWaveform(char* arg, ArgGenerate_t index, SignalG
     return retval;
 }
 
+/**
+ * @brief Process optional parameters for signal generation
+ * @param argc      Number of program arguments
+ * @param argv      Program arguments
+ * @param settings  Set of parameters of generated signal
+ * @return EXIT_SUCCESS when all options correct
+ */
+static int processGenerateOptions(int argc, char** argv, SignalGenerator_t* settings)
+{
+    for (int i = ARGC_NUMBER_FOR_GENERATE_MODE; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--format") == 0) && (i + 1 < argc))
+        {
+            settings->format = sampleIo_processArgumentFormat(argv[++i]);
+            if (settings->format == SAMPLE_FORMAT_UNKNOWN)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--io") == 0) && (i + 1 < argc))
+        {
+            AsyncFileBackend_t backend = asyncFile_ProcessArgumentBackend(argv[++i]);
+            if (backend == ASYNC_FILE_BACKEND_UNKNOWN)
+            {
+                return EXIT_FAILURE;
+            }
+            sampleIo_SetBackend(backend);
+        }
+        else if ((strcmp(argv[i], "--amplitude") == 0) && (i + 1 < argc))
+        {
+            settings->amplitude = (float)atof(argv[++i]);
+            if (!(settings->amplitude > 0))
+            {
+                printf("ERROR: Argument <amplitude> must be a positive number\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--snr") == 0) && (i + 1 < argc))
+        {
+            settings->snr = (float)atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "--end-resolution") == 0) && (i + 1 < argc))
+        {
+            settings->endResolution = signalGenerator_processArgumentResolution(argv[++i]);
+            if (settings->endResolution < 1)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--seed") == 0) && (i + 1 < argc))
+        {
+            settings->seed = strtoull(argv[++i], NULL, 0);
+        }
+        else if ((strcmp(argv[i], "--threads") == 0) && (i + 1 < argc))
+        {
+            settings->numOfThreads = atoi(argv[++i]);
+            if (settings->numOfThreads < 1)
+            {
+                printf("ERROR: Number of threads must be positive\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else
+        {
+            printf("ERROR: Unknown option %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Check that checkpoint options fit the rest of the filtering options
+ * @param settings  Filter file settings
+ * @param batch     Input argument is a batch of files
+ * @return EXIT_SUCCESS when the options can be used together
+ */
+static int validateCheckpointOptions(const LmsFilterFileSettings_t* settings, int batch)
+{
+    const LmsCheckpointSettings_t* checkpoint = settings->checkpoint;
+    const int multiChannel = (settings->channels > 1) || settings->useBank;
+
+    if (checkpoint == NULL)
+    {
+        return EXIT_SUCCESS;
+    }
+    if (settings->algorithm != LMS_FILTER_ALGORITHM_LMS)
+    {
+        printf("ERROR: Checkpoints are supported by the lms algorithm only\n");
+        return EXIT_FAILURE;
+    }
+    if (batch)
+    {
+        printf("ERROR: Checkpoints cannot be used with multiple input files\n");
+        return EXIT_FAILURE;
+    }
+    if ((checkpoint->resumeFileName != NULL) && (checkpoint->warmStartFileName != NULL))
+    {
+        printf("ERROR: --resume cannot be used with --warm-start\n");
+        return EXIT_FAILURE;
+    }
+    if ((checkpoint->resumeFileName != NULL) && (multiChannel || (settings->realtime != NULL)))
+    {
+        printf("ERROR: --resume continues a single input file with one channel, without --realtime\n");
+        return EXIT_FAILURE;
+    }
+    if ((checkpoint->interval > 0) && ((checkpoint->saveFileName == NULL) || multiChannel))
+    {
+        printf("ERROR: --checkpoint-every needs --checkpoint and a single channel, multi-channel runs are saved at the end\n");
+        return EXIT_FAILURE;
+    }
+    if ((checkpoint->saveFileName != NULL) && (settings->realtime != NULL))
+    {
+        printf("ERROR: --checkpoint cannot be used with --realtime\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Process optional parameters for LMS adaptive filtering
+ * @param argc      Number of program arguments
+ * @param argv      Program arguments
+ * @param filter    Pointer to the structure holding LMS filter parameters
+ * @param settings  Filter file settings
+ * @param realtime  Real-time settings, used by <settings> when --realtime is given
+ * @param telemetry Telemetry settings, used by <settings> when --telemetry is given
+ * @param checkpoint Checkpoint settings, used by <settings> when a checkpoint option is given
+ * @param plot      Plot settings, used by <settings> when --plot is given
+ * @param openPlot  Set by --plot-open
+ * @return EXIT_SUCCESS when all options correct
+ */
+static int processFilterOptions(int argc, char** argv, LmsFilter_t* filter, LmsFilterFileSettings_t* settings,
+                                LmsRealtimeSettings_t* realtime, LmsTelemetrySettings_t* telemetry,
+                                LmsCheckpointSettings_t* checkpoint, LmsPlotSettings_t* plot, int* openPlot)
+{
+    for (int i = ARGC_NUMBER_FOR_FILTER_MODE; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--variant") == 0) && (i + 1 < argc))
+        {
+            filter->variant = lmsFilter_processArgumentVariant(argv[++i]);
+            if (filter->variant == LMS_FILTER_VARIANT_COUNT)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--leakage") == 0) && (i + 1 < argc))
+        {
+            filter->leakage = (float)atof(argv[++i]);
+            if (!(filter->leakage > 0))
+            {
+                printf("ERROR: Argument <leakage> must be a positive number\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--algo") == 0) && (i + 1 < argc))
+        {
+            settings->algorithm = lmsFilter_processArgumentAlgorithm(argv[++i]);
+            if (settings->algorithm == LMS_FILTER_ALGORITHM_UNKNOWN)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--bands") == 0) && (i + 1 < argc))
+        {
+            settings->numOfBands = atoi(argv[++i]);
+            if ((settings->numOfBands < SUBBAND_FILTER_MIN_BANDS) || (settings->numOfBands > SUBBAND_FILTER_MAX_BANDS)
+                || ((settings->numOfBands & (settings->numOfBands - 1)) != 0))
+            {
+                printf("ERROR: Number of bands must be a power of two from %d to %d\n", SUBBAND_FILTER_MIN_BANDS,
+                       SUBBAND_FILTER_MAX_BANDS);
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--projection") == 0) && (i + 1 < argc))
+        {
+            settings->projectionOrder = atoi(argv[++i]);
+            if ((settings->projectionOrder < 1) || (settings->projectionOrder > APA_FILTER_MAX_ORDER))
+            {
+                printf("ERROR: Projection order must be from 1 to %d\n", APA_FILTER_MAX_ORDER);
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--desired") == 0) && (i + 1 < argc))
+        {
+            settings->desiredFileName = argv[++i];
+            if (verifyFilterArgumentFile(settings->desiredFileName) != EXIT_SUCCESS)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--two-column") == 0)
+        {
+            settings->twoColumn = 1;
+        }
+        else if ((strcmp(argv[i], "--format") == 0) && (i + 1 < argc))
+        {
+            settings->inputFormat = sampleIo_processArgumentFormat(argv[++i]);
+            if (settings->inputFormat == SAMPLE_FORMAT_UNKNOWN)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+        {
+            settings->outputFileName = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--output-format") == 0) && (i + 1 < argc))
+        {
+            settings->outputFormat = sampleIo_processArgumentFormat(argv[++i]);
+            if (settings->outputFormat == SAMPLE_FORMAT_UNKNOWN)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--channels") == 0) && (i + 1 < argc))
+        {
+            settings->channels = atoi(argv[++i]);
+            if (settings->channels < 1)
+            {
+                printf("ERROR: Number of channels must be positive\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--bank") == 0)
+        {
+            settings->useBank = 1;
+        }
+        else if (strcmp(argv[i], "--no-pipeline") == 0)
+        {
+            settings->pipelined = 0;
+        }
+        else if (strcmp(argv[i], "--realtime") == 0)
+        {
+            settings->realtime = realtime;
+        }
+        else if ((strcmp(argv[i], "--rt-block") == 0) && (i + 1 < argc))
+        {
+            realtime->blockSize = atoi(argv[++i]);
+            if (realtime->blockSize < 1)
+            {
+                printf("ERROR: Real-time block size must be positive\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--rt-rate") == 0) && (i + 1 < argc))
+        {
+            int sampleRate = atoi(argv[++i]);
+            if (sampleRate < 1)
+            {
+                printf("ERROR: Sample rate must be positive\n");
+                return EXIT_FAILURE;
+            }
+            realtime->sampleRate = (unsigned int)sampleRate;
+        }
+        else if ((strcmp(argv[i], "--rt-priority") == 0) && (i + 1 < argc))
+        {
+            realtime->priority = atoi(argv[++i]);
+            if ((realtime->priority < 0) || (realtime->priority > 99))
+            {
+                printf("ERROR: Real-time priority must be from 0 to 99\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--rt-cpu") == 0) && (i + 1 < argc))
+        {
+            realtime->cpu = atoi(argv[++i]);
+            if (realtime->cpu < 0)
+            {
+                printf("ERROR: CPU number cannot be negative\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--rt-paced") == 0)
+        {
+            realtime->paced = 1;
+        }
+        else if (strcmp(argv[i], "--telemetry") == 0)
+        {
+            settings->telemetry = telemetry;
+        }
+        else if ((strcmp(argv[i], "--telemetry-window") == 0) && (i + 2 < argc))
+        {
+            telemetry->shortWindow = atoi(argv[++i]);
+            telemetry->longWindow = atoi(argv[++i]);
+            if ((telemetry->shortWindow < 1) || (telemetry->longWindow <= telemetry->shortWindow))
+            {
+                printf("ERROR: Telemetry windows must be positive and the long one longer than the short one\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--telemetry-level") == 0) && (i + 1 < argc))
+        {
+            telemetry->convergenceLevel = (float)atof(argv[++i]);
+            if (!(telemetry->convergenceLevel < 0))
+            {
+                printf("ERROR: Telemetry convergence level must be negative\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--telemetry-margin") == 0) && (i + 2 < argc))
+        {
+            telemetry->convergenceMargin = (float)atof(argv[++i]);
+            telemetry->divergenceMargin = (float)atof(argv[++i]);
+            if (!(telemetry->convergenceMargin > 0) || !(telemetry->divergenceMargin > 0))
+            {
+                printf("ERROR: Telemetry margins must be positive\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--checkpoint") == 0) && (i + 1 < argc))
+        {
+            checkpoint->saveFileName = argv[++i];
+            settings->checkpoint = checkpoint;
+        }
+        else if ((strcmp(argv[i], "--checkpoint-every") == 0) && (i + 1 < argc))
+        {
+            checkpoint->interval = atol(argv[++i]);
+            settings->checkpoint = checkpoint;
+            if (checkpoint->interval < 1)
+            {
+                printf("ERROR: Checkpoint interval must be positive\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--resume") == 0) && (i + 1 < argc))
+        {
+            checkpoint->resumeFileName = argv[++i];
+            settings->checkpoint = checkpoint;
+        }
+        else if ((strcmp(argv[i], "--warm-start") == 0) && (i + 1 < argc))
+        {
+            checkpoint->warmStartFileName = argv[++i];
+            settings->checkpoint = checkpoint;
+        }
+        else if ((strcmp(argv[i], "--plot") == 0) && (i + 1 < argc))
+        {
+            plot->fileName = argv[++i];
+            settings->plot = plot;
+        }
+        else if ((strcmp(argv[i], "--plot-width") == 0) && (i + 1 < argc))
+        {
+            plot->width = atoi(argv[++i]);
+            if ((plot->width < LMS_PLOT_MIN_WIDTH) || (plot->width > LMS_PLOT_MAX_WIDTH))
+            {
+                printf("ERROR: Plot width must be from %d to %d\n", LMS_PLOT_MIN_WIDTH, LMS_PLOT_MAX_WIDTH);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--plot-open") == 0)
+        {
+            *openPlot = 1;
+        }
+        else if ((strcmp(argv[i], "--io") == 0) && (i + 1 < argc))
+        {
+            AsyncFileBackend_t backend = asyncFile_ProcessArgumentBackend(argv[++i]);
+            if (backend == ASYNC_FILE_BACKEND_UNKNOWN)
+            {
+                return EXIT_FAILURE;
+            }
+            sampleIo_SetBackend(backend);
+        }
+        else if ((strcmp(argv[i], "--threads") == 0) && (i + 1 < argc))
+        {
+            settings->numOfThreads = atoi(argv[++i]);
+            if (settings->numOfThreads < 1)
+            {
+                printf("ERROR: Number of threads must be positive\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else
+        {
+            printf("ERROR: Unknown option %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Process optional parameters of the benchmark
+ * @param argc      Number of program arguments
+ * @param argv      Program arguments
+ * @param settings  Benchmark settings
+ * @return EXIT_SUCCESS when all options correct
+ */
+static int processBenchOptions(int argc, char** argv, LmsBenchSettings_t* settings)
+{
+    for (int i = ARGC_NUMBER_FOR_BENCH_MODE; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--lengths") == 0) && (i + 1 < argc))
+        {
+            settings->numOfLengths = lmsBench_processArgumentList(argv[++i], settings->lengths, LMS_BENCH_MAX_SWEEP);
+            if (settings->numOfLengths == 0)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--blocks") == 0) && (i + 1 < argc))
+        {
+            settings->numOfBlockSizes = lmsBench_processArgumentList(argv[++i], settings->blockSizes,
+                                                                     LMS_BENCH_MAX_SWEEP);
+            if (settings->numOfBlockSizes == 0)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--samples") == 0) && (i + 1 < argc))
+        {
+            settings->numOfSamples = atol(argv[++i]);
+            if (settings->numOfSamples < 1)
+            {
+                printf("ERROR: Number of samples must be positive\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--trials") == 0) && (i + 1 < argc))
+        {
+            settings->trials = atoi(argv[++i]);
+            if (settings->trials < 1)
+            {
+                printf("ERROR: Number of trials must be positive\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--warmup") == 0) && (i + 1 < argc))
+        {
+            settings->warmupTrials = atoi(argv[++i]);
+            if (settings->warmupTrials < 0)
+            {
+                printf("ERROR: Number of warmup trials must not be negative\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--variants") == 0)
+        {
+            settings->allVariants = 1;
+        }
+        else if (strcmp(argv[i], "--no-fdaf") == 0)
+        {
+            settings->includeFdaf = 0;
+        }
+        else if (strcmp(argv[i], "--no-q15") == 0)
+        {
+            settings->includeFixed = 0;
+        }
+        else if (strcmp(argv[i], "--no-subband") == 0)
+        {
+            settings->includeSubband = 0;
+        }
+        else if (strcmp(argv[i], "--no-rls") == 0)
+        {
+            settings->includeRls = 0;
+        }
+        else if (strcmp(argv[i], "--no-apa") == 0)
+        {
+            settings->includeApa = 0;
+        }
+        else if ((strcmp(argv[i], "--format") == 0) && (i + 1 < argc))
+        {
+            settings->format = lmsBench_processArgumentFormat(argv[++i]);
+            if (settings->format == LMS_BENCH_FORMAT_UNKNOWN)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+        {
+            settings->outputFileName = argv[++i];
+        }
+        else
+        {
+            printf("ERROR: Unknown option %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Process optional parameters for plotting a filtered file
+ * @param argc      Number of program arguments
+ * @param argv      Program arguments
+ * @param settings  Plot settings
+ * @param format    Sample format of the filtered file
+ * @param openPlot  Set by --open
+ * @return EXIT_SUCCESS when all options correct
+ */
+static int processPlotOptions(int argc, char** argv, LmsPlotSettings_t* settings, SampleFormat_t* format, int* openPlot)
+{
+    for (int i = ARGC_NUMBER_FOR_PLOT_MODE; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--output") == 0) && (i + 1 < argc))
+        {
+            settings->fileName = argv[++i];
+        }
+        else if ((strcmp(argv[i], "--width") == 0) && (i + 1 < argc))
+        {
+            settings->width = atoi(argv[++i]);
+            if ((settings->width < LMS_PLOT_MIN_WIDTH) || (settings->width > LMS_PLOT_MAX_WIDTH))
+            {
+                printf("ERROR: Plot width must be from %d to %d\n", LMS_PLOT_MIN_WIDTH, LMS_PLOT_MAX_WIDTH);
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((strcmp(argv[i], "--format") == 0) && (i + 1 < argc))
+        {
+            *format = sampleIo_processArgumentFormat(argv[++i]);
+            if (*format == SAMPLE_FORMAT_UNKNOWN)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--open") == 0)
+        {
+            *openPlot = 1;
+        }
+        else
+        {
+            printf("ERROR: Unknown option %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
 /**
  * @brief Process parameters for LMS adaptive filtering
  * @param arg       Program argument
@@ -238,7 +955,8 @@ static int processArgsToStartFiltering(char* arg, ArgFilter_t index, LmsFilter_t
             break;
 
         case FILTER_ARG_FILE:
-            if (verifyFilterArgumentFile(arg) != EXIT_SUCCESS)
+            /* Files of a batch are verified after expansion */
+            if ((isFilterFileBatch(arg) == 0) && (verifyFilterArgumentFile(arg) != EXIT_SUCCESS))
             {
                 retval = EXIT_FAILURE;
             }
@@ -255,7 +973,7 @@ int main(int argc, char **argv)
 {
 	int retval = EXIT_SUCCESS;
 
-    if ((argc > 1) && (argc <= MAX_ARGC_NUMBER))
+    if (argc > 1)
     {
         if (strncmp(argv[1], "--help", (sizeof("--help")-1)) == 0)
         {
@@ -267,17 +985,23 @@ int main(int argc, char **argv)
         }
         else if (strncmp(argv[1], "--generate", (sizeof("--generate")-1)) == 0)
         {
-            if (argc == ARGC_NUMBER_FOR_GENERATE_MODE)
+            if (argc >= ARGC_NUMBER_FOR_GENERATE_MODE)
             {
-                SignalGenerator_t signalSettings = { .type = GEN_SIGNAL_UNKNOWN };
+                SignalGenerator_t signalSettings;
+
+                signalGenerator_DefaultSettings(&signalSettings);
 
-                for (int i = 2; i < argc; i++)
+                for (int i = 2; i < ARGC_NUMBER_FOR_GENERATE_MODE; i++)
                 {
                     if (processArgsToGenerateWaveform(argv[i], i, &signalSettings) != EXIT_SUCCESS)
                     {
                         return EXIT_FAILURE;
                     }
                 }
+                if (processGenerateOptions(argc, argv, &signalSettings) != EXIT_SUCCESS)
+                {
+                    return EXIT_FAILURE;
+                }
                 retval = signalGenerator_generateSignal(&signalSettings, argv[GENERATE_ARG_FILE]);
             }
             else
@@ -288,35 +1012,192 @@ int main(int argc, char **argv)
         }
         else if (strncmp(argv[1], "--filter", (sizeof("--filter")-1)) == 0)
         {
-            if (argc == ARGC_NUMBER_FOR_FILTER_MODE)
+            if (argc >= ARGC_NUMBER_FOR_FILTER_MODE)
             {
-                LmsFilter_t filter;
+                LmsFilter_t filter = { .variant = LMS_FILTER_VARIANT_LMS, .leakage = LMS_FILTER_DEFAULT_LEAKAGE };
+                LmsFilterFileSettings_t fileSettings = { .algorithm = LMS_FILTER_ALGORITHM_LMS,
+                                                         .inputFormat = SAMPLE_FORMAT_UNKNOWN,
+                                                         .outputFormat = SAMPLE_FORMAT_UNKNOWN,
+                                                         .outputFileName = NULL,
+                                                         .desiredFileName = NULL,
+                                                         .twoColumn = 0,
+                                                         .channels = 1,
+                                                         .numOfThreads = 0,
+                                                         .numOfBands = 0,
+                                                         .projectionOrder = 0,
+                                                         .useBank = 0,
+                                                         .pipelined = 1,
+                                                         .realtime = NULL,
+                                                         .telemetry = NULL,
+                                                         .checkpoint = NULL,
+                                                         .plot = NULL,
+                                                         .quiet = 0 };
+                LmsRealtimeSettings_t realtimeSettings = { .sampleRate = 0,
+                                                           .blockSize = LMS_REALTIME_DEFAULT_BLOCK_SIZE,
+                                                           .priority = 0,
+                                                           .cpu = -1,
+                                                           .paced = 0 };
+                LmsTelemetrySettings_t telemetrySettings;
+                LmsCheckpointSettings_t checkpointSettings = { .saveFileName = NULL,
+                                                               .interval = 0,
+                                                               .resumeFileName = NULL,
+                                                               .warmStartFileName = NULL };
+                LmsPlotSettings_t plotSettings = { .fileName = NULL, .width = LMS_PLOT_DEFAULT_WIDTH };
+                int openPlot = 0;
+                char** inputFiles = NULL;
+                int numOfInputFiles = 0;
 
-                for (int i = 2; i < argc; i++)
+                lmsTelemetry_DefaultSettings(&telemetrySettings);
+
+                for (int i = 2; i < ARGC_NUMBER_FOR_FILTER_MODE; i++)
                 {
                     if (processArgsToStartFiltering(argv[i], i, &filter) != EXIT_SUCCESS)
                     {
                         return EXIT_FAILURE;
                     }
                 }
-                retval = lmsFilter_FilterSignalAndSaveToFile(&filter, argv[FILTER_ARG_FILE]);
-                if (retval == EXIT_SUCCESS)
+                if (processFilterOptions(argc, argv, &filter, &fileSettings, &realtimeSettings,
+                                         &telemetrySettings, &checkpointSettings, &plotSettings, &openPlot) != EXIT_SUCCESS)
+                {
+                    return EXIT_FAILURE;
+                }
+                if ((filter.variant != LMS_FILTER_VARIANT_LMS)
+                    && ((fileSettings.algorithm != LMS_FILTER_ALGORITHM_LMS) || fileSettings.useBank))
+                {
+                    printf("ERROR: --variant is supported by the lms algorithm without --bank only\n");
+                    return EXIT_FAILURE;
+                }
+                if (((fileSettings.desiredFileName != NULL) || fileSettings.twoColumn)
+                    && ((fileSettings.channels > 1) || fileSettings.useBank || isFilterFileBatch(argv[FILTER_ARG_FILE])))
+                {
+                    printf("ERROR: --desired and --two-column filter a single input file with one channel\n");
+                    return EXIT_FAILURE;
+                }
+                if ((fileSettings.realtime != NULL)
+                    && ((fileSettings.channels > 1) || fileSettings.useBank || isFilterFileBatch(argv[FILTER_ARG_FILE])))
+                {
+                    printf("ERROR: --realtime filters a single input file with one channel\n");
+                    return EXIT_FAILURE;
+                }
+                if ((fileSettings.telemetry != NULL) && fileSettings.useBank)
+                {
+                    printf("ERROR: --telemetry cannot be used with --bank\n");
+                    return EXIT_FAILURE;
+                }
+                if ((fileSettings.numOfBands != 0) && (fileSettings.algorithm != LMS_FILTER_ALGORITHM_SUBBAND))
+                {
+                    printf("ERROR: --bands is supported by the subband algorithm only\n");
+                    return EXIT_FAILURE;
+                }
+                if ((fileSettings.projectionOrder != 0) && (fileSettings.algorithm != LMS_FILTER_ALGORITHM_APA))
+                {
+                    printf("ERROR: --projection is supported by the apa algorithm only\n");
+                    return EXIT_FAILURE;
+                }
+                if ((fileSettings.algorithm == LMS_FILTER_ALGORITHM_RLS) && !(filter.step < 1.0f))
+                {
+                    printf("ERROR: Step size of the rls algorithm is 1 - forgetting factor and must be below 1\n");
+                    return EXIT_FAILURE;
+                }
+                if ((fileSettings.algorithm == LMS_FILTER_ALGORITHM_APA) && !(filter.step < 2.0f))
+                {
+                    printf("ERROR: Step size of the apa algorithm must be below 2\n");
+                    return EXIT_FAILURE;
+                }
+                if ((fileSettings.desiredFileName != NULL) && fileSettings.twoColumn)
+                {
+                    printf("ERROR: --desired cannot be used with --two-column\n");
+                    return EXIT_FAILURE;
+                }
+                if (validateCheckpointOptions(&fileSettings, isFilterFileBatch(argv[FILTER_ARG_FILE])) != EXIT_SUCCESS)
+                {
+                    return EXIT_FAILURE;
+                }
+                if ((fileSettings.plot != NULL)
+                    && ((fileSettings.channels > 1) || fileSettings.useBank || isFilterFileBatch(argv[FILTER_ARG_FILE])))
+                {
+                    printf("ERROR: --plot summarizes a single input file with one channel\n");
+                    return EXIT_FAILURE;
+                }
+                if (openPlot && (fileSettings.plot == NULL))
+                {
+                    printf("ERROR: --plot-open needs --plot\n");
+                    return EXIT_FAILURE;
+                }
+                if (lmsFilter_InitVariant(&filter, filter.step, filter.length, filter.variant, filter.leakage,
+                                          NULL) != EXIT_SUCCESS)
+                {
+                    return EXIT_FAILURE;
+                }
+                printf("Variant:                      %s\n", lmsFilter_VariantName(filter.variant));
+                if (fileSettings.algorithm == LMS_FILTER_ALGORITHM_FIXED)
+                {
+                    printf("Step shift:                   %d (step size %g)\n", lmsFixed_StepShift(filter.step),
+                           1.0 / (1 << lmsFixed_StepShift(filter.step)));
+                }
+                if (fileSettings.algorithm == LMS_FILTER_ALGORITHM_SUBBAND)
+                {
+                    const int numOfBands = (fileSettings.numOfBands != 0) ? fileSettings.numOfBands :
+                                           SUBBAND_FILTER_DEFAULT_BANDS;
+                    printf("Subband bands:                %d (output delayed by %d samples)\n", numOfBands,
+                           SUBBAND_FILTER_PROTOTYPE_FACTOR * numOfBands);
+                }
+                if (fileSettings.algorithm == LMS_FILTER_ALGORITHM_RLS)
+                {
+                    printf("RLS form:                     %s (forgetting factor %g)\n",
+                           rlsFilter_FormName((filter.length <= RLS_FILTER_DIRECT_MAX_LENGTH) ? RLS_FILTER_FORM_DIRECT :
+                                              RLS_FILTER_FORM_LATTICE), 1.0 - filter.step);
+                }
+                if (fileSettings.algorithm == LMS_FILTER_ALGORITHM_APA)
+                {
+                    printf("Projection order:             %d\n", (fileSettings.projectionOrder != 0) ?
+                           fileSettings.projectionOrder : APA_FILTER_DEFAULT_ORDER);
+                }
+                if (expandFilterArgumentFile(argv[FILTER_ARG_FILE], &inputFiles, &numOfInputFiles) != EXIT_SUCCESS)
+                {
+                    lmsFilter_Free(&filter);
+                    return EXIT_FAILURE;
+                }
+                if (numOfInputFiles > 1)
                 {
-                    int status = 0;
-                    const char* filteredFileSuffix = "filtered";
-                    char *command = NULL;
-                    command = (char*)malloc(strlen("python") + 1
-                                            + strlen(pythonPlotScript) + 1
-                                            + strlen(argv[FILTER_ARG_FILE])
-                                            + strlen(filteredFileSuffix) + 1);
-                    sprintf(command, "python %s %s%s", pythonPlotScript, argv[FILTER_ARG_FILE], filteredFileSuffix);
-                    status = system(command);
-                    if (status == -1)
+                    if (fileSettings.outputFileName != NULL)
                     {
-                        printf("Error executing script\n");
+                        printf("ERROR: --output cannot be used with multiple input files\n");
+                        freeInputFiles(inputFiles, numOfInputFiles);
+                        lmsFilter_Free(&filter);
                         return EXIT_FAILURE;
                     }
-                    free(command);
+                    if ((fileSettings.channels > 1) || fileSettings.useBank)
+                    {
+                        printf("ERROR: --channels and --bank cannot be used with multiple input files\n");
+                        freeInputFiles(inputFiles, numOfInputFiles);
+                        lmsFilter_Free(&filter);
+                        return EXIT_FAILURE;
+                    }
+                    retval = lmsFilter_FilterFiles(&filter, (const char* const*)inputFiles, numOfInputFiles,
+                                                   &fileSettings);
+                    freeInputFiles(inputFiles, numOfInputFiles);
+                    lmsFilter_Free(&filter);
+                    return retval;
+                }
+                if (fileSettings.channels > 1)
+                {
+                    retval = lmsFilter_FilterInterleavedFile(&filter, inputFiles[0], &fileSettings);
+                    freeInputFiles(inputFiles, numOfInputFiles);
+                    lmsFilter_Free(&filter);
+                    return retval;
+                }
+                retval = lmsFilter_FilterSignalAndSaveToFile(&filter, inputFiles[0], &fileSettings);
+                freeInputFiles(inputFiles, numOfInputFiles);
+                lmsFilter_Free(&filter);
+
+                if ((retval == EXIT_SUCCESS) && (fileSettings.plot != NULL))
+                {
+                    printf("Plot:                         %s\n", plotSettings.fileName);
+                    if (openPlot)
+                    {
+                        retval = lmsPlot_Open(plotSettings.fileName);
+                    }
                 }
             }
             else
@@ -325,23 +1206,52 @@ int main(int argc, char **argv)
                 return EXIT_FAILURE;
             }
         }
+        else if (strcmp(argv[1], "--bench") == 0)
+        {
+            LmsBenchSettings_t benchSettings;
+
+            lmsBench_DefaultSettings(&benchSettings);
+            if (processBenchOptions(argc, argv, &benchSettings) != EXIT_SUCCESS)
+            {
+                return EXIT_FAILURE;
+            }
+            retval = lmsBench_Run(&benchSettings);
+        }
         else if (strncmp(argv[1], "--plot", (sizeof("--plot")-1)) == 0)
         {
-            if (argc == ARGC_NUMBER_FOR_PLOT_MODE)
+            if (argc >= ARGC_NUMBER_FOR_PLOT_MODE)
             {
-                int status = 0;
-                char *command = NULL;
-                command = (char*)malloc(strlen("python") + 1
-                                        + strlen(pythonPlotScript) + 1
-                                        + strlen(argv[ARGC_NUMBER_FOR_PLOT_MODE-1]) + 1);
-                sprintf(command, "python %s %s", pythonPlotScript, argv[ARGC_NUMBER_FOR_PLOT_MODE-1]);
-                status = system(command);
-                if (status == -1)
+                const char* filteredFileName = argv[ARGC_NUMBER_FOR_PLOT_MODE - 1];
+                LmsPlotSettings_t plotSettings = { .fileName = NULL, .width = LMS_PLOT_DEFAULT_WIDTH };
+                SampleFormat_t format = SAMPLE_FORMAT_UNKNOWN;
+                char* plotFileName = NULL;
+                int openPlot = 0;
+
+                if (processPlotOptions(argc, argv, &plotSettings, &format, &openPlot) != EXIT_SUCCESS)
                 {
-                    printf("Error executing script\n");
                     return EXIT_FAILURE;
                 }
-                free(command);
+                if (plotSettings.fileName == NULL)
+                {
+                    const char* baseName = (strcmp(filteredFileName, SAMPLE_IO_STDIN) == 0) ? "stdin" : filteredFileName;
+                    plotFileName = (char*)malloc(strlen(baseName) + sizeof(".html"));
+                    if (plotFileName == NULL)
+                    {
+                        return EXIT_FAILURE;
+                    }
+                    sprintf(plotFileName, "%s.html", baseName);
+                    plotSettings.fileName = plotFileName;
+                }
+                retval = lmsPlot_PlotFile(filteredFileName, format, &plotSettings);
+                if (retval == EXIT_SUCCESS)
+                {
+                    printf("Plot:                         %s\n", plotSettings.fileName);
+                    if (openPlot)
+                    {
+                        retval = lmsPlot_Open(plotSettings.fileName);
+                    }
+                }
+                free(plotFileName);
             }
             else
             {
@@ -0,0 +1,289 @@
+/**
+ * @file rlsFilter.c
+ * @author shed258
+ * @brief Recursive least squares filter source file
+ * @version 1.0.0
+ *
+ * Direct form, x(n) holding the last L samples, P the inverse of the weighted input correlation:
+ *   pi = P x,  alpha = lambda + x' pi,  e = d - w' x,  w += pi e / alpha,  P = (P - pi pi' / alpha) / lambda
+ * Lattice form, stage m = 0 .. L-1 with a priori forward error eta, backward error beta, conversion gamma:
+ *   F(m) = lambda F(m) + gamma(m, n-1) eta(m)^2          B(m) = lambda B(m) + gamma(m) beta(m)^2
+ *   eta(m+1) = eta(m) + kf(m) beta(m, n-1)                beta(m+1) = beta(m, n-1) + kb(m) eta(m)
+ *   kf(m) -= gamma(m, n-1) beta(m, n-1) eta(m+1) / B(m, n-1)    kb(m) -= gamma(m, n-1) eta(m) beta(m+1) / F(m)
+ *   gamma(m+1) = gamma(m) - (gamma(m) beta(m))^2 / B(m)
+ *   xi(m+1) = xi(m) - k(m) beta(m),  k(m) += gamma(m) beta(m) xi(m+1) / B(m),  xi(0) = d, e = xi(L)
+ * The reflection coefficients are updated from the errors they produce (error feedback), which keeps
+ * rounding errors from accumulating. Backward errors are orthogonal, so every ladder coefficient
+ * converges on its own and the whole filter needs about 2 L samples whatever the input spectrum.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "lmsAllocator.h"
+#include "rlsFilter.h"
+
+#define RLS_FILTER_DELTA        1e-2    /* inverse correlation starts as the identity / delta, powers at delta */
+#define RLS_FILTER_MAX_GAIN     1e6     /* bound of the mean inverse correlation diagonal, stops windup without excitation */
+#define RLS_FILTER_MIN_POWER    1e-30   /* floor of lattice error powers */
+
+/**
+ * @brief Store a sample in the mirrored history, the window starts at the newest sample
+ */
+static inline const float* rlsFilter_Push(RlsFilter_t* filter, float sample)
+{
+    if (--filter->historyIndex < 0)
+    {
+        filter->historyIndex = filter->length - 1;
+    }
+    filter->history[filter->historyIndex] = sample;
+    filter->history[filter->historyIndex + filter->length] = sample;
+    return &filter->history[filter->historyIndex];
+}
+
+/**
+ * @brief One sample of the direct form
+ * @return A priori error
+ */
+static double rlsFilter_DirectSample(RlsFilter_t* filter, const float* x, double desired)
+{
+    const int length = filter->length;
+    double* weights = filter->weights;
+    double* gain = filter->gain;
+    double y = 0.0;
+    double alpha = filter->lambda;
+    double trace = 0.0;
+
+    for (int i = 0; i < length; i++)
+    {
+        const double* row = &filter->inverse[(size_t)i * length];
+        double sum = 0.0;
+
+        for (int j = 0; j < length; j++)
+        {
+            sum += row[j] * x[j];
+        }
+        gain[i] = sum;
+        alpha += x[i] * sum;
+        y += weights[i] * x[i];
+    }
+
+    const double e = desired - y;
+    const double inverseAlpha = 1.0 / alpha;
+    for (int i = 0; i < length; i++)
+    {
+        weights[i] += gain[i] * inverseAlpha * e;
+    }
+
+    /* Upper triangle, mirrored below, keeps the matrix exactly symmetric */
+    for (int i = 0; i < length; i++)
+    {
+        double* row = &filter->inverse[(size_t)i * length];
+        const double scaled = gain[i] * inverseAlpha;
+
+        for (int j = i; j < length; j++)
+        {
+            row[j] -= scaled * gain[j];
+            filter->inverse[(size_t)j * length + i] = row[j];
+        }
+        trace += row[i];
+    }
+
+    /* Directions the input does not excite grow by 1 / lambda every sample, the bound freezes them */
+    if (trace < RLS_FILTER_MAX_GAIN * length * filter->lambda)
+    {
+        const double scale = 1.0 / filter->lambda;
+        const size_t size = (size_t)length * length;
+
+        for (size_t k = 0; k < size; k++)
+        {
+            filter->inverse[k] *= scale;
+        }
+    }
+    return e;
+}
+
+/**
+ * @brief One sample of the lattice. The prediction stages adapt on the input alone, the ladder
+ * only when <adaptJoint> is set
+ * @return A priori error
+ */
+static double rlsFilter_LatticeSample(RlsFilter_t* filter, double sample, double desired, int adaptJoint)
+{
+    const double lambda = filter->lambda;
+    const int last = filter->length - 1;
+    double eta = sample;
+    double beta = sample;
+    double gamma = 1.0;
+    double xi = desired;
+
+    for (int m = 0; m <= last; m++)
+    {
+        const double previousBeta = filter->backwardError[m];
+        const double previousPower = filter->backwardPower[m];
+        const double previousGamma = filter->conversion[m];
+        double power = lambda * previousPower + gamma * beta * beta;
+
+        if (power < RLS_FILTER_MIN_POWER)
+        {
+            power = RLS_FILTER_MIN_POWER;
+        }
+        if (adaptJoint)
+        {
+            const double next = xi - filter->joint[m] * beta;
+            filter->joint[m] += gamma * beta * next / power;
+            xi = next;
+        }
+
+        double nextEta = 0.0;
+        double nextBeta = 0.0;
+        double nextGamma = 0.0;
+        if (m < last)
+        {
+            double forwardPower = lambda * filter->forwardPower[m] + previousGamma * eta * eta;
+            if (forwardPower < RLS_FILTER_MIN_POWER)
+            {
+                forwardPower = RLS_FILTER_MIN_POWER;
+            }
+            filter->forwardPower[m] = forwardPower;
+
+            nextEta = eta + filter->forwardReflection[m] * previousBeta;
+            nextBeta = previousBeta + filter->backwardReflection[m] * eta;
+            filter->forwardReflection[m] -= previousGamma * previousBeta * nextEta / previousPower;
+            filter->backwardReflection[m] -= previousGamma * eta * nextBeta / forwardPower;
+            nextGamma = gamma - (gamma * beta) * (gamma * beta) / power;
+        }
+
+        filter->backwardPower[m] = power;
+        filter->backwardError[m] = beta;
+        filter->conversion[m] = gamma;
+        eta = nextEta;
+        beta = nextBeta;
+        gamma = nextGamma;
+    }
+    return xi;
+}
+
+int rlsFilter_Init(RlsFilter_t* filter, double lambda, int length, RlsFilterForm_t form)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    memset(filter, 0, sizeof(*filter));
+    if ((length < 1) || !(lambda > 0.0) || !(lambda < 1.0))
+    {
+        printf("Wrong RLS filter length %d or forgetting factor %g\n", length, lambda);
+        return EXIT_FAILURE;
+    }
+    if (form == RLS_FILTER_FORM_AUTO)
+    {
+        form = (length <= RLS_FILTER_DIRECT_MAX_LENGTH) ? RLS_FILTER_FORM_DIRECT : RLS_FILTER_FORM_LATTICE;
+    }
+    filter->lambda = lambda;
+    filter->length = length;
+    filter->form = form;
+
+    const size_t historyBytes = lmsAllocator_AlignedSize(2 * (size_t)length * sizeof(float));
+    const size_t vectorBytes = lmsAllocator_AlignedSize((size_t)length * sizeof(double));
+    const size_t matrixBytes = lmsAllocator_AlignedSize((size_t)length * length * sizeof(double));
+    const size_t stateBytes = (form == RLS_FILTER_FORM_DIRECT) ? 2 * vectorBytes + matrixBytes : 7 * vectorBytes;
+
+    filter->memory = heap->allocate(heap->context, historyBytes + stateBytes, LMS_ALLOCATOR_ALIGNMENT);
+    if (filter->memory == NULL)
+    {
+        printf("Error allocating RLS filter of length %d\n", length);
+        return EXIT_FAILURE;
+    }
+    memset(filter->memory, 0, historyBytes + stateBytes);
+    filter->history = (float*)filter->memory;
+
+    unsigned char* next = (unsigned char*)filter->memory + historyBytes;
+    if (form == RLS_FILTER_FORM_DIRECT)
+    {
+        filter->weights = (double*)next;
+        filter->gain = (double*)(next + vectorBytes);
+        filter->inverse = (double*)(next + 2 * vectorBytes);
+        for (int i = 0; i < length; i++)
+        {
+            filter->inverse[(size_t)i * length + i] = 1.0 / RLS_FILTER_DELTA;
+        }
+    }
+    else
+    {
+        double** vectors[] =
+        {
+            &filter->forwardPower, &filter->backwardPower, &filter->backwardError, &filter->conversion,
+            &filter->forwardReflection, &filter->backwardReflection, &filter->joint,
+        };
+        for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++)
+        {
+            *vectors[v] = (double*)(next + v * vectorBytes);
+        }
+        for (int m = 0; m < length; m++)
+        {
+            filter->forwardPower[m] = RLS_FILTER_DELTA;
+            filter->backwardPower[m] = RLS_FILTER_DELTA;
+            filter->conversion[m] = 1.0;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+void rlsFilter_Free(RlsFilter_t* filter)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    heap->release(heap->context, filter->memory);
+    filter->memory = NULL;
+}
+
+void rlsFilter_PushSample(RlsFilter_t* filter, float sample)
+{
+    rlsFilter_Push(filter, sample);
+    if (filter->form == RLS_FILTER_FORM_LATTICE)
+    {
+        rlsFilter_LatticeSample(filter, sample, 0.0, 0);
+    }
+}
+
+int rlsFilter_ProcessBlock(RlsFilter_t* filter, const float* input, const float* desired,
+                           float* output, float* error, int numOfSamples)
+{
+    double y = 0.0;
+
+    for (int i = 0; i < numOfSamples; i++)
+    {
+        const float* x = rlsFilter_Push(filter, input[i]);
+        const double d = (desired != NULL) ? desired[i] : x[filter->length - 1];
+        const double e = (filter->form == RLS_FILTER_FORM_DIRECT) ? rlsFilter_DirectSample(filter, x, d) :
+                         rlsFilter_LatticeSample(filter, input[i], d, 1);
+
+        y = d - e;
+        if (output != NULL)
+        {
+            output[i] = (float)y;
+        }
+        if (error != NULL)
+        {
+            error[i] = (float)e;
+        }
+    }
+    return (isfinite(y) == 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+double rlsFilter_NormSquared(const RlsFilter_t* filter)
+{
+    const double* coefficients = (filter->form == RLS_FILTER_FORM_DIRECT) ? filter->weights : filter->joint;
+    double sum = 0.0;
+
+    for (int k = 0; k < filter->length; k++)
+    {
+        sum += coefficients[k] * coefficients[k];
+    }
+    return sum;
+}
+
+const char* rlsFilter_FormName(RlsFilterForm_t form)
+{
+    return (form == RLS_FILTER_FORM_DIRECT) ? "direct" : "lattice";
+}
@@ -0,0 +1,1000 @@
+/**
+ * @file sampleIo.c
+ * @author shed258
+ * @brief Sample file reader and writer source file
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "fastFloat.h"
+#include "sampleIo.h"
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#error "Binary sample formats are stored in host byte order, which must be little-endian"
+#endif
+
+#define WAV_HEADER_SIZE         44
+#define WAV_FORMAT_PCM          1
+#define WAV_FORMAT_IEEE_FLOAT   3
+#define WAV_FORMAT_EXTENSIBLE   0xFFFE
+
+#define TEXT_BUFFER_SIZE        (1 << 16)
+#define TEXT_LOOKAHEAD          256     /* buffered text is refilled when less is left */
+
+static const struct
+{
+    const char* name;
+    SampleFormat_t format;
+} sampleFormatNames[] =
+{
+    { "text",   SAMPLE_FORMAT_TEXT },
+    { "f32",    SAMPLE_FORMAT_F32 },
+    { "s16",    SAMPLE_FORMAT_S16 },
+    { "wav",    SAMPLE_FORMAT_WAV_S16 },
+    { "wavf32", SAMPLE_FORMAT_WAV_F32 },
+};
+
+static AsyncFileBackend_t sampleIoBackend = ASYNC_FILE_BACKEND_AUTO;
+
+/**
+ * @brief Size of one sample in a binary format
+ * @param format    Sample format
+ * @return Number of bytes, 0 for text
+ */
+static size_t sampleIo_BytesPerSample(SampleFormat_t format)
+{
+    size_t retval = 0;
+
+    switch (format)
+    {
+        case SAMPLE_FORMAT_F32:
+        case SAMPLE_FORMAT_WAV_F32:
+            retval = sizeof(float);
+            break;
+
+        case SAMPLE_FORMAT_S16:
+        case SAMPLE_FORMAT_WAV_S16:
+            retval = sizeof(int16_t);
+            break;
+
+        default:
+            break;
+    }
+    return retval;
+}
+
+static inline int sampleIo_IsWav(SampleFormat_t format)
+{
+    return (format == SAMPLE_FORMAT_WAV_S16) || (format == SAMPLE_FORMAT_WAV_F32);
+}
+
+static inline int16_t sampleIo_FloatToS16(float sample)
+{
+    float scaled = sample * 32767.0f;
+
+    if (scaled > 32767.0f)
+    {
+        scaled = 32767.0f;
+    }
+    else if (scaled < -32768.0f)
+    {
+        scaled = -32768.0f;
+    }
+    return (int16_t)lrintf(scaled);
+}
+
+static uint32_t sampleIo_GetLe32(const unsigned char* bytes)
+{
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static uint16_t sampleIo_GetLe16(const unsigned char* bytes)
+{
+    return (uint16_t)(bytes[0] | (bytes[1] << 8));
+}
+
+static void sampleIo_PutLe32(unsigned char* bytes, uint32_t value)
+{
+    bytes[0] = value & 0xFF;
+    bytes[1] = (value >> 8) & 0xFF;
+    bytes[2] = (value >> 16) & 0xFF;
+    bytes[3] = (value >> 24) & 0xFF;
+}
+
+static void sampleIo_PutLe16(unsigned char* bytes, uint16_t value)
+{
+    bytes[0] = value & 0xFF;
+    bytes[1] = (value >> 8) & 0xFF;
+}
+
+/**
+ * @brief Skip bytes of the input. Reads instead of seeking, so it works on pipes as well
+ * @param file      Opened file
+ * @param numOfBytes    Number of bytes to skip
+ * @return EXIT_SUCCESS when skipped. EXIT_FAILURE at the end of file
+ */
+static int sampleIo_Skip(FILE* file, long numOfBytes)
+{
+    unsigned char scratch[256];
+
+    while (numOfBytes > 0)
+    {
+        size_t request = (numOfBytes < (long)sizeof(scratch)) ? (size_t)numOfBytes : sizeof(scratch);
+        if (fread(scratch, 1, request, file) != request)
+        {
+            return EXIT_FAILURE;
+        }
+        numOfBytes -= request;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Parse RIFF/WAVE header and leave file positioned at the beginning of the data chunk
+ * @param reader    Reader structure with opened file
+ * @param fileName  Name of the file, used in error messages
+ * @return EXIT_SUCCESS when header is valid and format supported. Otherwise, return EXIT_FAILURE
+ */
+static int sampleIo_ReadWavHeader(SampleReader_t* reader, const char* fileName)
+{
+    unsigned char header[12];
+    unsigned char chunk[8];
+    unsigned char fmt[40];
+    int fmtFound = 0;
+
+    if ((fread(header, 1, sizeof(header), reader->file) != sizeof(header))
+        || (memcmp(header, "RIFF", 4) != 0) || (memcmp(&header[8], "WAVE", 4) != 0))
+    {
+        printf("ERROR: %s is not a WAV file\n", fileName);
+        return EXIT_FAILURE;
+    }
+
+    while (fread(chunk, 1, sizeof(chunk), reader->file) == sizeof(chunk))
+    {
+        uint32_t chunkSize = sampleIo_GetLe32(&chunk[4]);
+
+        if (memcmp(chunk, "fmt ", 4) == 0)
+        {
+            size_t fmtSize = (chunkSize < sizeof(fmt)) ? chunkSize : sizeof(fmt);
+            if ((chunkSize < 16) || (fread(fmt, 1, fmtSize, reader->file) != fmtSize))
+            {
+                break;
+            }
+            if (sampleIo_Skip(reader->file, (long)(chunkSize - fmtSize + (chunkSize & 1))) != EXIT_SUCCESS)
+            {
+                break;
+            }
+
+            uint16_t formatTag = sampleIo_GetLe16(&fmt[0]);
+            uint16_t bitsPerSample = sampleIo_GetLe16(&fmt[14]);
+            if ((formatTag == WAV_FORMAT_EXTENSIBLE) && (fmtSize >= 26))
+            {
+                formatTag = sampleIo_GetLe16(&fmt[24]);     /* first two bytes of SubFormat GUID */
+            }
+            reader->channels = sampleIo_GetLe16(&fmt[2]);
+            reader->sampleRate = sampleIo_GetLe32(&fmt[4]);
+
+            if ((formatTag == WAV_FORMAT_PCM) && (bitsPerSample == 16))
+            {
+                reader->format = SAMPLE_FORMAT_WAV_S16;
+            }
+            else if ((formatTag == WAV_FORMAT_IEEE_FLOAT) && (bitsPerSample == 32))
+            {
+                reader->format = SAMPLE_FORMAT_WAV_F32;
+            }
+            else
+            {
+                printf("ERROR: %s unsupported WAV format, only 16-bit PCM and 32-bit float\n", fileName);
+                return EXIT_FAILURE;
+            }
+            fmtFound = 1;
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            if ((fmtFound == 0) || (reader->channels < 1))
+            {
+                break;
+            }
+            /* Streamed WAV files may leave the size empty, then data lasts until the end of file */
+            if ((chunkSize != 0) && (chunkSize != 0xFFFFFFFFu))
+            {
+                reader->dataBytesLeft = chunkSize;
+                reader->numOfFrames = chunkSize / (sampleIo_BytesPerSample(reader->format) * reader->channels);
+            }
+            return EXIT_SUCCESS;
+        }
+        else if (sampleIo_Skip(reader->file, (long)(chunkSize + (chunkSize & 1))) != EXIT_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    printf("ERROR: %s has invalid WAV header\n", fileName);
+    return EXIT_FAILURE;
+}
+
+/**
+ * @brief Write RIFF/WAVE header for the frames written so far
+ * @param writer    Writer structure
+ * @return EXIT_SUCCESS when written succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int sampleIo_WriteWavHeader(SampleWriter_t* writer)
+{
+    unsigned char header[WAV_HEADER_SIZE];
+    const uint16_t bytesPerSample = sampleIo_BytesPerSample(writer->format);
+    const uint32_t dataSize = writer->numOfFrames * writer->channels * bytesPerSample;
+
+    memcpy(&header[0], "RIFF", 4);
+    sampleIo_PutLe32(&header[4], WAV_HEADER_SIZE - 8 + dataSize);
+    memcpy(&header[8], "WAVE", 4);
+    memcpy(&header[12], "fmt ", 4);
+    sampleIo_PutLe32(&header[16], 16);
+    sampleIo_PutLe16(&header[20], (writer->format == SAMPLE_FORMAT_WAV_F32) ? WAV_FORMAT_IEEE_FLOAT : WAV_FORMAT_PCM);
+    sampleIo_PutLe16(&header[22], writer->channels);
+    sampleIo_PutLe32(&header[24], writer->sampleRate);
+    sampleIo_PutLe32(&header[28], writer->sampleRate * writer->channels * bytesPerSample);
+    sampleIo_PutLe16(&header[32], writer->channels * bytesPerSample);
+    sampleIo_PutLe16(&header[34], 8 * bytesPerSample);
+    memcpy(&header[36], "data", 4);
+    sampleIo_PutLe32(&header[40], dataSize);
+
+    return (fwrite(header, 1, sizeof(header), writer->file) == sizeof(header)) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief Map a regular text file into memory. Falls back to buffered reading when not possible
+ * @param reader    Reader structure with opened text file
+ * @return EXIT_SUCCESS when mapped or buffer allocated. Otherwise, return EXIT_FAILURE
+ */
+static int sampleIo_OpenText(SampleReader_t* reader)
+{
+    if (reader->fileSize > 0)
+    {
+        void* mapped = mmap(NULL, reader->fileSize, PROT_READ, MAP_PRIVATE, fileno(reader->file), 0);
+        if (mapped != MAP_FAILED)
+        {
+            madvise(mapped, reader->fileSize, MADV_SEQUENTIAL);
+            reader->mappedSize = reader->fileSize;
+            reader->text = (const char*)mapped;
+            reader->textPos = reader->text;
+            reader->textEnd = reader->text + reader->mappedSize;
+            reader->textEof = 1;
+            return EXIT_SUCCESS;
+        }
+    }
+
+    reader->buffer = malloc(TEXT_BUFFER_SIZE);
+    if (reader->buffer == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+    reader->text = (const char*)reader->buffer;
+    reader->textPos = reader->text;
+    reader->textEnd = reader->text;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Move unparsed text to the beginning of the buffer and fill the rest from the file
+ * @param reader    Reader structure with buffered text file
+ */
+static void sampleIo_RefillText(SampleReader_t* reader)
+{
+    char* buffer = (char*)reader->buffer;
+    size_t left = reader->textEnd - reader->textPos;
+
+    memmove(buffer, reader->textPos, left);
+    size_t got = fread(&buffer[left], 1, TEXT_BUFFER_SIZE - left, reader->file);
+    if (got < TEXT_BUFFER_SIZE - left)
+    {
+        reader->textEof = 1;
+    }
+    reader->textPos = buffer;
+    reader->textEnd = buffer + left + got;
+}
+
+/**
+ * @brief Parse "%f;" separated samples, the separator is optional as in fscanf
+ * @param reader    Reader structure with text file
+ * @param samples   Buffer for samples
+ * @param count     Number of samples to read
+ * @return Number of samples read
+ */
+static int sampleIo_ReadText(SampleReader_t* reader, float* samples, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        if ((reader->textEof == 0) && (reader->textEnd - reader->textPos < TEXT_LOOKAHEAD))
+        {
+            sampleIo_RefillText(reader);
+        }
+
+        const char* next = fastFloat_Parse(reader->textPos, reader->textEnd, &samples[i]);
+        if (next == NULL)
+        {
+            break;
+        }
+        if ((next < reader->textEnd) && (*next == ';'))
+        {
+            next++;
+        }
+        reader->textPos = next;
+    }
+    return i;
+}
+
+/**
+ * @brief Write the bytes waiting in the buffer to the file. An asynchronous buffer is queued for
+ * writing and given up, the next one is acquired by sampleIo_AcquireBuffer
+ * @param writer    Writer structure with text file or asynchronous writes
+ * @return EXIT_SUCCESS when written succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int sampleIo_FlushBuffer(SampleWriter_t* writer)
+{
+    int retval = EXIT_SUCCESS;
+
+    if (writer->async)
+    {
+        if (writer->buffer != NULL)
+        {
+            asyncFile_CommitWrite(&writer->io, writer->bufferLength);
+            writer->buffer = NULL;
+        }
+    }
+    else if ((writer->bufferLength > 0)
+             && (fwrite(writer->buffer, 1, writer->bufferLength, writer->file) != writer->bufferLength))
+    {
+        retval = EXIT_FAILURE;
+    }
+    writer->bufferLength = 0;
+    return retval;
+}
+
+/**
+ * @brief Make sure the writer has a buffer, waiting for a free one of asynchronous writes
+ * @param writer    Writer structure
+ * @return EXIT_SUCCESS when the buffer is there. EXIT_FAILURE when an earlier write failed
+ */
+static int sampleIo_AcquireBuffer(SampleWriter_t* writer)
+{
+    if (writer->buffer == NULL)
+    {
+        writer->buffer = asyncFile_AcquireWrite(&writer->io);
+    }
+    return (writer->buffer != NULL) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief Format frames into the text buffer: "%f;" per line for one channel, otherwise
+ * "<index>;%.6f;%.6f;...;" per line
+ * @param writer        Writer structure with text file
+ * @param samples       Buffer with interleaved samples
+ * @param numOfFrames   Number of frames to write
+ * @return EXIT_SUCCESS when written succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int sampleIo_WriteText(SampleWriter_t* writer, const float* samples, int numOfFrames)
+{
+    const size_t maxLineLength = 24 + writer->channels * (FAST_FLOAT_MAX_TEXT_LENGTH + 1) + 1;
+
+    for (int n = 0; n < numOfFrames; n++)
+    {
+        const float* frame = &samples[n * writer->channels];
+        size_t length = writer->bufferLength;
+
+        if ((writer->bufferSize - length < maxLineLength) && (sampleIo_FlushBuffer(writer) != EXIT_SUCCESS))
+        {
+            return EXIT_FAILURE;
+        }
+        if (sampleIo_AcquireBuffer(writer) != EXIT_SUCCESS)
+        {
+            return EXIT_FAILURE;
+        }
+        length = writer->bufferLength;
+        char* buffer = (char*)writer->buffer;
+
+        if (writer->channels > 1)
+        {
+            length += fastFloat_FormatInteger(&buffer[length], writer->numOfFrames + n);
+            buffer[length++] = ';';
+        }
+        for (int c = 0; c < writer->channels; c++)
+        {
+            length += fastFloat_Format(&buffer[length], frame[c], 6);
+            buffer[length++] = ';';
+        }
+        buffer[length++] = '\n';
+        writer->bufferLength = length;
+    }
+    writer->numOfFrames += numOfFrames;
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Convert samples of asynchronous reads. Samples never straddle two buffers, every
+ * read except the last one is a multiple of the sample size
+ * @param reader    Reader structure with asynchronous reads
+ * @param samples   Buffer for samples
+ * @param count     Number of samples to read
+ * @return Number of samples read
+ */
+static size_t sampleIo_ReadAsync(SampleReader_t* reader, float* samples, size_t count)
+{
+    const size_t bytesPerSample = sampleIo_BytesPerSample(reader->format);
+    size_t done = 0;
+
+    while (done < count)
+    {
+        if (reader->ioPos == reader->ioLength)
+        {
+            if (reader->ioData != NULL)
+            {
+                asyncFile_ReleaseRead(&reader->io);
+                reader->ioData = NULL;
+            }
+            ssize_t got = asyncFile_AcquireRead(&reader->io, &reader->ioData);
+            if (got <= 0)
+            {
+                reader->ioData = NULL;
+                reader->ioLength = 0;
+                reader->ioPos = 0;
+                break;
+            }
+            reader->ioLength = (size_t)got - (size_t)got % bytesPerSample;
+            reader->ioPos = 0;
+            continue;
+        }
+
+        size_t n = (reader->ioLength - reader->ioPos) / bytesPerSample;
+        if (n > count - done)
+        {
+            n = count - done;
+        }
+        if (bytesPerSample == sizeof(float))
+        {
+            memcpy(&samples[done], &reader->ioData[reader->ioPos], n * sizeof(float));
+        }
+        else
+        {
+            const int16_t* src = (const int16_t*)&reader->ioData[reader->ioPos];
+            for (size_t i = 0; i < n; i++)
+            {
+                samples[done + i] = src[i] * (1.0f / 32768.0f);
+            }
+        }
+        done += n;
+        reader->ioPos += n * bytesPerSample;
+        reader->ioPosition += (long)(n * bytesPerSample);
+    }
+    return done;
+}
+
+/**
+ * @brief Convert samples into the buffers of asynchronous writes, each full buffer is queued for writing
+ * @param writer        Writer structure with asynchronous writes
+ * @param samples       Buffer with interleaved samples
+ * @param numOfFrames   Number of frames to write
+ * @return EXIT_SUCCESS when queued succesfully. Otherwise, return EXIT_FAILURE
+ */
+static int sampleIo_WriteAsync(SampleWriter_t* writer, const float* samples, int numOfFrames)
+{
+    const size_t bytesPerSample = sampleIo_BytesPerSample(writer->format);
+    const size_t count = (size_t)numOfFrames * writer->channels;
+    size_t done = 0;
+
+    while (done < count)
+    {
+        if ((writer->bufferLength == writer->bufferSize) && (sampleIo_FlushBuffer(writer) != EXIT_SUCCESS))
+        {
+            return EXIT_FAILURE;
+        }
+        if (sampleIo_AcquireBuffer(writer) != EXIT_SUCCESS)
+        {
+            return EXIT_FAILURE;
+        }
+
+        size_t n = (writer->bufferSize - writer->bufferLength) / bytesPerSample;
+        if (n > count - done)
+        {
+            n = count - done;
+        }
+        unsigned char* dst = (unsigned char*)writer->buffer + writer->bufferLength;
+        if (bytesPerSample == sizeof(float))
+        {
+            memcpy(dst, &samples[done], n * sizeof(float));
+        }
+        else
+        {
+            int16_t* converted = (int16_t*)dst;
+            for (size_t i = 0; i < n; i++)
+            {
+                converted[i] = sampleIo_FloatToS16(samples[done + i]);
+            }
+        }
+        writer->bufferLength += n * bytesPerSample;
+        done += n;
+    }
+    writer->numOfFrames += numOfFrames;
+
+    return EXIT_SUCCESS;
+}
+
+void sampleIo_SetBackend(AsyncFileBackend_t backend)
+{
+    sampleIoBackend = backend;
+}
+
+SampleFormat_t sampleIo_processArgumentFormat(const char* format)
+{
+    for (unsigned int i = 0; i < sizeof(sampleFormatNames) / sizeof(sampleFormatNames[0]); i++)
+    {
+        if (strcmp(format, sampleFormatNames[i].name) == 0)
+        {
+            return sampleFormatNames[i].format;
+        }
+    }
+    printf("ERROR: Unknown argument for <format>, expected text, f32, s16, wav or wavf32\n");
+    return SAMPLE_FORMAT_UNKNOWN;
+}
+
+SampleFormat_t sampleIo_FormatFromFileName(const char* fileName)
+{
+    SampleFormat_t retval = SAMPLE_FORMAT_TEXT;
+    const char* extension = strrchr(fileName, '.');
+
+    if (extension != NULL)
+    {
+        if (strcmp(extension, ".f32") == 0)
+        {
+            retval = SAMPLE_FORMAT_F32;
+        }
+        else if ((strcmp(extension, ".s16") == 0) || (strcmp(extension, ".pcm") == 0))
+        {
+            retval = SAMPLE_FORMAT_S16;
+        }
+        else if (strcmp(extension, ".wav") == 0)
+        {
+            retval = SAMPLE_FORMAT_WAV_S16;
+        }
+    }
+    return retval;
+}
+
+const char* sampleIo_FormatName(SampleFormat_t format)
+{
+    for (unsigned int i = 0; i < sizeof(sampleFormatNames) / sizeof(sampleFormatNames[0]); i++)
+    {
+        if (sampleFormatNames[i].format == format)
+        {
+            return sampleFormatNames[i].name;
+        }
+    }
+    return "unknown";
+}
+
+int sampleIo_OpenReader(SampleReader_t* reader, const char* fileName, SampleFormat_t format, int channels)
+{
+    struct stat fileStat;
+
+    memset(reader, 0, sizeof(*reader));
+    reader->format = (format != SAMPLE_FORMAT_UNKNOWN) ? format : sampleIo_FormatFromFileName(fileName);
+    reader->channels = channels;
+    reader->sampleRate = SAMPLE_IO_DEFAULT_SAMPLE_RATE;
+    reader->numOfFrames = -1;
+    reader->fileSize = -1;
+    reader->dataBytesLeft = -1;
+
+    if (strcmp(fileName, SAMPLE_IO_STDIN) == 0)
+    {
+        reader->file = stdin;
+    }
+    else
+    {
+        reader->file = fopen(fileName, (reader->format == SAMPLE_FORMAT_TEXT) ? "r" : "rb");
+    }
+    if (reader->file == NULL)
+    {
+        perror(fileName);
+        return EXIT_FAILURE;
+    }
+
+    /* Size is only known for regular files, progress of pipes is not reported */
+    if ((fstat(fileno(reader->file), &fileStat) == 0) && S_ISREG(fileStat.st_mode))
+    {
+        reader->fileSize = fileStat.st_size;
+    }
+
+    if (sampleIo_IsWav(reader->format))
+    {
+        if (sampleIo_ReadWavHeader(reader, fileName) != EXIT_SUCCESS)
+        {
+            sampleIo_CloseReader(reader);
+            return EXIT_FAILURE;
+        }
+    }
+    else if ((reader->format != SAMPLE_FORMAT_TEXT) && (reader->fileSize >= 0))
+    {
+        reader->numOfFrames = reader->fileSize / (long)(sampleIo_BytesPerSample(reader->format) * channels);
+    }
+
+    if (reader->format == SAMPLE_FORMAT_TEXT)
+    {
+        if (sampleIo_OpenText(reader) != EXIT_SUCCESS)
+        {
+            printf("Error allocating read buffer\n");
+            sampleIo_CloseReader(reader);
+            return EXIT_FAILURE;
+        }
+    }
+    else if ((sampleIoBackend != ASYNC_FILE_BACKEND_STDIO) && (reader->fileSize >= 0))
+    {
+        /* Reads start after the header, which was read through the file */
+        reader->ioPosition = ftell(reader->file);
+        long end = (reader->dataBytesLeft >= 0) ? reader->ioPosition + reader->dataBytesLeft : reader->fileSize;
+        if (end > reader->fileSize)
+        {
+            end = reader->fileSize;
+        }
+        if ((reader->ioPosition < 0) || (asyncFile_Open(&reader->io, fileno(reader->file), ASYNC_FILE_READ,
+                                                        sampleIoBackend, reader->ioPosition, end) != EXIT_SUCCESS))
+        {
+            sampleIo_CloseReader(reader);
+            return EXIT_FAILURE;
+        }
+        reader->async = 1;
+    }
+    else
+    {
+        reader->buffer = malloc(SAMPLE_IO_BUFFER_FRAMES * reader->channels * sampleIo_BytesPerSample(reader->format));
+        if (reader->buffer == NULL)
+        {
+            printf("Error allocating read buffer\n");
+            sampleIo_CloseReader(reader);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+int sampleIo_Read(SampleReader_t* reader, float* samples, int numOfFrames)
+{
+    int framesRead = 0;
+
+    if (reader->format == SAMPLE_FORMAT_TEXT)
+    {
+        return sampleIo_ReadText(reader, samples, numOfFrames * reader->channels) / reader->channels;
+    }
+    if (reader->async)
+    {
+        return (int)(sampleIo_ReadAsync(reader, samples, (size_t)numOfFrames * reader->channels) / reader->channels);
+    }
+
+    const size_t frameBytes = sampleIo_BytesPerSample(reader->format) * reader->channels;
+    /* Float samples need no conversion and are read straight into the caller's buffer */
+    const int direct = (reader->format == SAMPLE_FORMAT_F32) || (reader->format == SAMPLE_FORMAT_WAV_F32);
+
+    while (framesRead < numOfFrames)
+    {
+        size_t request = numOfFrames - framesRead;
+        if ((direct == 0) && (request > SAMPLE_IO_BUFFER_FRAMES))
+        {
+            request = SAMPLE_IO_BUFFER_FRAMES;
+        }
+        if ((reader->dataBytesLeft >= 0) && (request * frameBytes > (size_t)reader->dataBytesLeft))
+        {
+            request = reader->dataBytesLeft / frameBytes;
+        }
+        if (request == 0)
+        {
+            break;
+        }
+
+        float* dst = &samples[framesRead * reader->channels];
+        size_t got = fread(direct ? (void*)dst : reader->buffer, frameBytes, request, reader->file);
+        const size_t count = got * reader->channels;
+
+        if (direct == 0)
+        {
+            const int16_t* src = (const int16_t*)reader->buffer;
+            for (size_t i = 0; i < count; i++)
+            {
+                dst[i] = src[i] * (1.0f / 32768.0f);
+            }
+        }
+
+        if (reader->dataBytesLeft >= 0)
+        {
+            reader->dataBytesLeft -= got * frameBytes;
+        }
+        framesRead += got;
+        if (got < request)
+        {
+            break;
+        }
+    }
+    return framesRead;
+}
+
+int sampleIo_GetProgress(const SampleReader_t* reader)
+{
+    int retval = -1;
+
+    if (reader->fileSize > 0)
+    {
+        long position = reader->async ? reader->ioPosition : ftell(reader->file);
+        if (reader->mappedSize > 0)
+        {
+            position = reader->textPos - reader->text;
+        }
+        else if (reader->format == SAMPLE_FORMAT_TEXT)
+        {
+            position -= reader->textEnd - reader->textPos;
+        }
+        if (position >= 0)
+        {
+            retval = (int)(((double)position / reader->fileSize) * 100);
+        }
+    }
+    return retval;
+}
+
+int sampleIo_CloseReader(SampleReader_t* reader)
+{
+    int retval = EXIT_SUCCESS;
+
+    if (reader->mappedSize > 0)
+    {
+        munmap((void*)reader->text, reader->mappedSize);
+        reader->mappedSize = 0;
+    }
+    if (reader->async)
+    {
+        asyncFile_Close(&reader->io);
+        reader->async = 0;
+    }
+    free(reader->buffer);
+    reader->buffer = NULL;
+    if ((reader->file != stdin) && fclose(reader->file))
+    {
+        retval = EXIT_FAILURE;
+    }
+    return retval;
+}
+
+int sampleIo_OpenWriter(SampleWriter_t* writer, const char* fileName, SampleFormat_t format,
+                        int channels, unsigned int sampleRate)
+{
+    struct stat fileStat;
+
+    memset(writer, 0, sizeof(*writer));
+    writer->format = (format != SAMPLE_FORMAT_UNKNOWN) ? format : sampleIo_FormatFromFileName(fileName);
+    writer->channels = channels;
+    writer->sampleRate = sampleRate;
+
+    writer->file = fopen(fileName, (writer->format == SAMPLE_FORMAT_TEXT) ? "w" : "wb");
+    if (writer->file == NULL)
+    {
+        perror(fileName);
+        return EXIT_FAILURE;
+    }
+
+    /* Placeholder header, sizes are filled in when the writer is closed */
+    if (sampleIo_IsWav(writer->format) && ((sampleIo_WriteWavHeader(writer) != EXIT_SUCCESS) || (fflush(writer->file) != 0)))
+    {
+        perror(fileName);
+        fclose(writer->file);
+        return EXIT_FAILURE;
+    }
+
+    /* Regular files are written behind the caller, samples follow the header */
+    if ((sampleIoBackend != ASYNC_FILE_BACKEND_STDIO) && (fstat(fileno(writer->file), &fileStat) == 0)
+        && S_ISREG(fileStat.st_mode))
+    {
+        if (asyncFile_Open(&writer->io, fileno(writer->file), ASYNC_FILE_WRITE, sampleIoBackend,
+                           ftell(writer->file), 0) != EXIT_SUCCESS)
+        {
+            fclose(writer->file);
+            return EXIT_FAILURE;
+        }
+        writer->async = 1;
+        writer->bufferSize = ASYNC_FILE_BUFFER_SIZE;
+        return EXIT_SUCCESS;
+    }
+
+    if (writer->format == SAMPLE_FORMAT_TEXT)
+    {
+        writer->buffer = malloc(TEXT_BUFFER_SIZE);
+        writer->bufferSize = TEXT_BUFFER_SIZE;
+    }
+    else
+    {
+        writer->buffer = malloc(SAMPLE_IO_BUFFER_FRAMES * channels * sampleIo_BytesPerSample(writer->format));
+    }
+    if (writer->buffer == NULL)
+    {
+        printf("Error allocating write buffer\n");
+        fclose(writer->file);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int sampleIo_Write(SampleWriter_t* writer, const float* samples, int numOfFrames)
+{
+    if (writer->format == SAMPLE_FORMAT_TEXT)
+    {
+        return sampleIo_WriteText(writer, samples, numOfFrames);
+    }
+    if (writer->async)
+    {
+        return sampleIo_WriteAsync(writer, samples, numOfFrames);
+    }
+
+    const size_t bytesPerSample = sampleIo_BytesPerSample(writer->format);
+    int framesWritten = 0;
+
+    while (framesWritten < numOfFrames)
+    {
+        int frames = numOfFrames - framesWritten;
+        if (frames > SAMPLE_IO_BUFFER_FRAMES)
+        {
+            frames = SAMPLE_IO_BUFFER_FRAMES;
+        }
+        const float* src = &samples[framesWritten * writer->channels];
+        const size_t count = (size_t)frames * writer->channels;
+
+        if ((writer->format == SAMPLE_FORMAT_F32) || (writer->format == SAMPLE_FORMAT_WAV_F32))
+        {
+            /* Written straight from the caller buffer */
+            if (fwrite(src, sizeof(float), count, writer->file) != count)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        else
+        {
+            int16_t* dst = (int16_t*)writer->buffer;
+            for (size_t i = 0; i < count; i++)
+            {
+                dst[i] = sampleIo_FloatToS16(src[i]);
+            }
+            if (fwrite(dst, bytesPerSample, count, writer->file) != count)
+            {
+                return EXIT_FAILURE;
+            }
+        }
+        framesWritten += frames;
+    }
+    writer->numOfFrames += numOfFrames;
+
+    return EXIT_SUCCESS;
+}
+
+int sampleIo_ReserveFrames(SampleWriter_t* writer, long numOfFrames)
+{
+    const size_t frameBytes = (size_t)writer->channels * sampleIo_BytesPerSample(writer->format);
+
+    if (frameBytes == 0)
+    {
+        return EXIT_FAILURE;
+    }
+    if (writer->async)
+    {
+        /* Frames queued before must be on the file, writes queued later continue after the reserved frames */
+        if ((sampleIo_FlushBuffer(writer) != EXIT_SUCCESS) || (asyncFile_Flush(&writer->io) != EXIT_SUCCESS))
+        {
+            return EXIT_FAILURE;
+        }
+        writer->dataOffset = (long)writer->io.offset;
+        if (ftruncate(fileno(writer->file), writer->dataOffset + numOfFrames * (long)frameBytes) != 0)
+        {
+            return EXIT_FAILURE;
+        }
+        writer->io.offset += (off_t)(numOfFrames * (long)frameBytes);
+    }
+    else
+    {
+        if (fflush(writer->file) != 0)
+        {
+            return EXIT_FAILURE;
+        }
+        writer->dataOffset = ftell(writer->file);
+        if ((writer->dataOffset < 0)
+            || (ftruncate(fileno(writer->file), writer->dataOffset + numOfFrames * (long)frameBytes) != 0)
+            || (fseek(writer->file, 0L, SEEK_END) != 0))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    writer->numOfFrames += numOfFrames;
+
+    return EXIT_SUCCESS;
+}
+
+int sampleIo_WriteFramesAt(const SampleWriter_t* writer, const float* samples, int numOfFrames, long firstFrame)
+{
+    const size_t bytesPerSample = sampleIo_BytesPerSample(writer->format);
+    const int fd = fileno(writer->file);
+    int16_t converted[SAMPLE_IO_BUFFER_FRAMES];
+    size_t done = 0;
+    const size_t count = (size_t)numOfFrames * writer->channels;
+    off_t offset = writer->dataOffset + firstFrame * (long)(writer->channels * bytesPerSample);
+
+    /* The shared conversion buffer can not be used, samples are converted on the stack */
+    while (done < count)
+    {
+        size_t chunk = count - done;
+        const void* bytes = &samples[done];
+
+        if (bytesPerSample == sizeof(int16_t))
+        {
+            if (chunk > SAMPLE_IO_BUFFER_FRAMES)
+            {
+                chunk = SAMPLE_IO_BUFFER_FRAMES;
+            }
+            for (size_t i = 0; i < chunk; i++)
+            {
+                converted[i] = sampleIo_FloatToS16(samples[done + i]);
+            }
+            bytes = converted;
+        }
+
+        ssize_t written = pwrite(fd, bytes, chunk * bytesPerSample, offset);
+        if (written <= 0)
+        {
+            return EXIT_FAILURE;
+        }
+        /* Short writes continue at the next whole sample */
+        chunk = (size_t)written / bytesPerSample;
+        if (chunk == 0)
+        {
+            return EXIT_FAILURE;
+        }
+        done += chunk;
+        offset += (off_t)(chunk * bytesPerSample);
+    }
+    return EXIT_SUCCESS;
+}
+
+int sampleIo_CloseWriter(SampleWriter_t* writer)
+{
+    int retval = EXIT_SUCCESS;
+
+    if (((writer->format == SAMPLE_FORMAT_TEXT) || writer->async) && (sampleIo_FlushBuffer(writer) != EXIT_SUCCESS))
+    {
+        retval = EXIT_FAILURE;
+    }
+    if (writer->async)
+    {
+        if (asyncFile_Close(&writer->io) != EXIT_SUCCESS)
+        {
+            retval = EXIT_FAILURE;
+        }
+        writer->async = 0;
+        writer->buffer = NULL;
+    }
+    if (sampleIo_IsWav(writer->format))
+    {
+        if ((fseek(writer->file, 0L, SEEK_SET) != 0) || (sampleIo_WriteWavHeader(writer) != EXIT_SUCCESS))
+        {
+            retval = EXIT_FAILURE;
+        }
+    }
+    free(writer->buffer);
+    writer->buffer = NULL;
+    if (fclose(writer->file))
+    {
+        retval = EXIT_FAILURE;
+    }
+    return retval;
+}
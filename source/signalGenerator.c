@@ -11,94 +11,640 @@
 #include <string.h>
 #include <ctype.h>
 #include <math.h>
+#include <stdint.h>
+#include "threadPool.h"
 #include "signalGenerator.h"
 
 #define TWO_PI (2*M_PI)
+#define SIGNAL_GEN_BLOCK_SIZE               65536   /* samples generated and written at once */
+#define SIGNAL_GEN_CHUNK_SIZE               (16 * SIGNAL_GEN_BLOCK_SIZE)    /* samples of one parallel job */
+#define SIGNAL_GEN_CHUNKS_PER_THREAD        4       /* jobs queued per thread between progress updates */
+#define SIGNAL_GEN_LANES                    16      /* chirp phasors rotated together, vectors of doubles */
+#define SIGNAL_GEN_RESEED_INTERVAL          4096    /* samples between exact phases, bounds the rounding drift */
+#define SIGNAL_GEN_NOISE_BATCH              4096    /* noise samples added at once */
+#define SIGNAL_GEN_NOISE_PAIRS              256     /* Gaussian pairs computed at once */
+#define SIGNAL_GEN_DEFAULT_END_RESOLUTION   4
+
+/* Noise streams of one seed, every pink noise row has its own */
+#define SIGNAL_GEN_STREAM_WHITE     0
+#define SIGNAL_GEN_STREAM_PINK      1
+
+static const char* const signalGeneratorTypeNames[GEN_SIGNAL_COUNT] =
+{
+    [GEN_SIGNAL_UNKNOWN]    = "unknown",
+    [GEN_SIGNAL_SINE]       = "sine",
+    [GEN_SIGNAL_SQUARE]     = "square",
+    [GEN_SIGNAL_SAWTOOTH]   = "sawtooth",
+    [GEN_SIGNAL_CHIRP]      = "chirp",
+    [GEN_SIGNAL_WHITE]      = "white",
+    [GEN_SIGNAL_PINK]       = "pink",
+    [GEN_SIGNAL_SINE_NOISE] = "sine-noise",
+};
 
 /**
- * @brief Generate sine wave based on given parameters
- * @param settings          Parameters of signal
- * @param outputSamples     Buffer with generated samples
- * @return EXIT_SUCCESS when sine waveform generated and saved to the file
+ * @brief SplitMix64 output number <index> of the sequence starting at <key>. The generator is
+ * a counter, so any position is reached in O(1) and ranges of a stream can be generated apart
+ * @param key       Start of the sequence
+ * @param index     Position in the sequence
+ * @return 64 random bits
  */
-static int signalGenerator_generateSine(const SignalGenerator_t *settings, const char* outputFileName)
+static inline uint64_t signalGenerator_Random(uint64_t key, uint64_t index)
 {
-    int retval = EXIT_SUCCESS;
-    char outputSamplesAsCharacter[32];
+    uint64_t z = key + (index + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Key of a noise stream of the seed
+ * @param seed      Seed of the signal
+ * @param stream    Stream number
+ * @return Start of the stream sequence
+ */
+static uint64_t signalGenerator_StreamKey(uint64_t seed, unsigned int stream)
+{
+    return signalGenerator_Random(seed, stream);
+}
+
+/**
+ * @brief sin(x) for |x| <= pi/4, Taylor polynomial to x^17, below 1 ulp of double
+ */
+static inline double signalGenerator_SinPoly(double x)
+{
+    const double x2 = x * x;
 
-    float* outputSamples = NULL;
-    outputSamples = (float*)malloc(settings->resolution * sizeof(float));
+    return x + x * x2 * (-1.0 / 6 + x2 * (1.0 / 120 + x2 * (-1.0 / 5040 + x2 * (1.0 / 362880 +
+           x2 * (-1.0 / 39916800 + x2 * (1.0 / 6227020800.0 + x2 * (-1.0 / 1307674368000.0 +
+           x2 * (1.0 / 355687428096000.0))))))));
+}
 
-    FILE *file = fopen(outputFileName, "w");
-    if (!file)
+/**
+ * @brief cos(x) for |x| <= pi/4, Taylor polynomial to x^16
+ */
+static inline double signalGenerator_CosPoly(double x)
+{
+    const double x2 = x * x;
+
+    return 1.0 + x2 * (-1.0 / 2 + x2 * (1.0 / 24 + x2 * (-1.0 / 720 + x2 * (1.0 / 40320 +
+           x2 * (-1.0 / 3628800 + x2 * (1.0 / 479001600 + x2 * (-1.0 / 87178291200.0 +
+           x2 * (1.0 / 20922789888000.0))))))));
+}
+
+/**
+ * @brief Natural logarithm of <value> = <mantissa> * 2^<exponent>, the mantissa in [sqrt(1/2), sqrt(2))
+ * goes through the atanh series
+ * @param value     Positive integer
+ * @param power     2^<exponent> as an integer
+ * @param exponent  Exponent
+ */
+static inline double signalGenerator_Log(int32_t value, int32_t power, int32_t exponent)
+{
+    const double x = (double)value / (double)power;
+    const double s = (x - 1.0) / (x + 1.0);
+    const double s2 = s * s;
+
+    return exponent * M_LN2 + 2.0 * s * (1.0 + s2 * (1.0 / 3 + s2 * (1.0 / 5 + s2 * (1.0 / 7 + s2 * (1.0 / 9 +
+           s2 * (1.0 / 11 + s2 * (1.0 / 13)))))));
+}
+
+/**
+ * @brief sin and cos of an angle reduced exactly to a quarter period. The angle is
+ * (pi / 2) * (<quadrant> + <remainder> / <quarter>), the remainder is folded to [0, quarter / 2] so
+ * the polynomials only see |x| <= pi/4. Quarter periods come out exactly as 0 and +-1
+ */
+static inline void signalGenerator_SinCosQuadrant(unsigned int quadrant, unsigned int remainder, unsigned int quarter,
+                                                  double radiansPerUnit, double* sine, double* cosine)
+{
+    const unsigned int fold = (2 * remainder > quarter);
+    /* quarter - remainder when folded */
+    const double x = (int)(remainder + fold * (quarter - 2 * remainder)) * radiansPerUnit;
+    const double s = signalGenerator_SinPoly(x);
+    const double c = signalGenerator_CosPoly(x);
+    /* Selected by weights of exactly 0 and 1 instead of a branch, which the compiler would keep
+     * because floating point operations may trap. The blends are exact: both polynomials are >= 0
+     * here and adding a zero does not change a value. 0.0 - value, not -value, keeps zeros +0 */
+    const double swap = (double)(int)((quadrant & 1) ^ fold);
+    const double sineNegative = (double)(int)((quadrant >> 1) & 1);
+    const double cosineNegative = (double)(int)(((quadrant + 1) >> 1) & 1);
+    const double sineValue = s * (1.0 - swap) + c * swap;
+    const double cosineValue = c * (1.0 - swap) + s * swap;
+
+    *sine = sineValue * (1.0 - sineNegative) + (0.0 - sineValue) * sineNegative;
+    *cosine = cosineValue * (1.0 - cosineNegative) + (0.0 - cosineValue) * cosineNegative;
+}
+
+/**
+ * @brief Pairs of independent standard normal values from number <index> of the stream on
+ * (Box-Muller). The random bits of all pairs are drawn first, the logarithm, square root and
+ * angle then run as loops over the pairs, which the compiler vectorizes. The angle is a 24-bit
+ * fraction of the cycle, reduced exactly
+ * @param key           Key of the stream
+ * @param index         Index of the first pair
+ * @param numOfPairs    Number of pairs, at most SIGNAL_GEN_NOISE_PAIRS
+ * @param values        2 * <numOfPairs> Gaussian values, pair by pair
+ */
+static void signalGenerator_GaussianPairs(uint64_t key, uint64_t index, int numOfPairs, float* values)
+{
+    const double radiansPerUnit = M_PI_2 / (1 << 22);
+    int32_t magnitude[SIGNAL_GEN_NOISE_PAIRS];
+    int32_t power[SIGNAL_GEN_NOISE_PAIRS];
+    int32_t exponent[SIGNAL_GEN_NOISE_PAIRS];
+    int32_t angle[SIGNAL_GEN_NOISE_PAIRS];
+    double radius[SIGNAL_GEN_NOISE_PAIRS];
+
+    for (int j = 0; j < numOfPairs; j++)
     {
-        perror(outputFileName);
-        return EXIT_FAILURE;
+        const uint64_t bits = signalGenerator_Random(key, index + j);
+        const int32_t m = (int32_t)(bits >> 40) + 1;       /* (0, 1] in units of 2^-24 */
+        int32_t e = 31 - __builtin_clz((unsigned int)m);
+
+        /* m / 2^e in [sqrt(1/2), sqrt(2)) */
+        e += ((uint64_t)m * (uint64_t)m >= (2ull << (2 * e)));
+        magnitude[j] = m;
+        power[j] = 1 << e;
+        exponent[j] = e;
+        angle[j] = (int32_t)(bits & 0xFFFFFF);          /* [0, 1) cycle in units of 2^-24 */
+    }
+    for (int j = 0; j < numOfPairs; j++)
+    {
+        /* -2 ln(magnitude / 2^24) */
+        radius[j] = 2.0 * (24 * M_LN2 - signalGenerator_Log(magnitude[j], power[j], exponent[j]));
+    }
+    /* Apart, sqrt() may set errno, which keeps the loops around it from being vectorized */
+    for (int j = 0; j < numOfPairs; j++)
+    {
+        radius[j] = sqrt(radius[j]);
+    }
+    for (int j = 0; j < numOfPairs; j++)
+    {
+        double sine;
+        double cosine;
+
+        signalGenerator_SinCosQuadrant((unsigned int)angle[j] >> 22, (unsigned int)angle[j] & ((1 << 22) - 1), 1 << 22,
+                                       radiansPerUnit, &sine, &cosine);
+        values[2 * j] = (float)(radius[j] * cosine);
+        values[2 * j + 1] = (float)(radius[j] * sine);
     }
-    printf("Output file:                  %s \n", outputFileName);
+}
+
+/**
+ * @brief Standard normal values number <index> to <index> + <count> - 1 of the stream. Value <n> is
+ * half <n> % 2 of pair <n> / 2, so any range gives the same values as the whole stream
+ * @param key       Key of the stream
+ * @param index     Index of the first value
+ * @param count     Number of values
+ * @param values    Gaussian values
+ */
+static void signalGenerator_Gaussian(uint64_t key, uint64_t index, size_t count, float* values)
+{
+    float pairs[2 * SIGNAL_GEN_NOISE_PAIRS];
+    size_t skip = (size_t)(index & 1);
+
+    for (uint64_t pair = index >> 1; count > 0; pair += SIGNAL_GEN_NOISE_PAIRS)
+    {
+        /* Pairs holding the rest of the range, the last one may be used by half */
+        const size_t needed = (skip + count + 1) / 2;
+        const int numOfPairs = (needed < SIGNAL_GEN_NOISE_PAIRS) ? (int)needed : SIGNAL_GEN_NOISE_PAIRS;
+        const size_t available = 2 * (size_t)numOfPairs - skip;
+        const size_t n = (count < available) ? count : available;
+
+        signalGenerator_GaussianPairs(key, pair, numOfPairs, pairs);
+        memcpy(values, &pairs[skip], n * sizeof(float));
+        values += n;
+        count -= n;
+        skip = 0;
+    }
+}
+
+/**
+ * @brief Sine of the positions <begin> to <end> - 1 of one cycle. The phase is reduced exactly in
+ * integers, 4 * position = quadrant * resolution + remainder, and the remainder is folded to the
+ * nearer end of the quadrant, so sin or cos only sees |x| <= pi/4. Every eighth of the cycle is a
+ * loop with one polynomial and a remainder that moves by 4 per sample, which the compiler vectorizes.
+ * Quarter periods come out exactly as 0 and +-1
+ */
+static void signalGenerator_SineRange(float* out, unsigned int begin, unsigned int end, unsigned int resolution,
+                                      float amplitude)
+{
+    const double radiansPerUnit = M_PI_2 / resolution;
 
-    for (unsigned int n = 0; n < settings->cycles; n++)
+    for (unsigned int octant = 0; octant < 8; octant++)
     {
-        for (unsigned int i = 0; i < settings->resolution; i++)
+        const unsigned int quadrant = octant / 2;
+        const int fold = octant & 1;
+        /* Unfolded from 4 * position >= quadrant * resolution, folded from 8 * position > (2 * quadrant + 1) * resolution */
+        const unsigned int octantBegin = fold ? ((2 * quadrant + 1) * resolution) / 8 + 1 : (quadrant * resolution + 3) / 4;
+        const unsigned int octantEnd = fold ? ((quadrant + 1) * resolution + 3) / 4 : ((2 * quadrant + 1) * resolution) / 8 + 1;
+        const unsigned int from = (begin > octantBegin) ? begin : octantBegin;
+        const unsigned int to = (end < octantEnd) ? end : octantEnd;
+        const int count = (to > from) ? (int)(to - from) : 0;
+        /* Folded units count down from the end of the quadrant */
+        const int units = fold ? (int)((quadrant + 1) * resolution - 4 * from) : (int)(4 * from - quadrant * resolution);
+        const int step = fold ? -4 : 4;
+        /* + 0.0 turns the -0 of a zero times a negative amplitude into +0 and changes nothing else */
+        const double signedAmplitude = (quadrant >= 2) ? -(double)amplitude : (double)amplitude;
+        float* octantOut = &out[from - begin];
+
+        if ((quadrant & 1) ^ fold)
         {
-            if (n == 0) /* Generate one waveform in first iteration and then use it in next cycles */
-            {
-                outputSamples[i] = sin((i*TWO_PI)/settings->resolution);
-            }
-            snprintf(outputSamplesAsCharacter, sizeof(outputSamplesAsCharacter), "%f", outputSamples[i]);
-            if (fputs(outputSamplesAsCharacter, file) != EOF)
+            for (int i = 0; i < count; i++)
             {
-                if (fputs(";\n", file) == EOF)
-                {
-                    return EXIT_FAILURE;
-                }
+                octantOut[i] = (float)(signedAmplitude * signalGenerator_CosPoly((units + step * i) * radiansPerUnit) + 0.0);
             }
-            else
+        }
+        else
+        {
+            for (int i = 0; i < count; i++)
             {
-                return EXIT_FAILURE;
+                octantOut[i] = (float)(signedAmplitude * signalGenerator_SinPoly((units + step * i) * radiansPerUnit) + 0.0);
             }
         }
+    }
+}
+
+/**
+ * @brief Sine from the exact position of every sample in the cycle. Only the first period of the
+ * block is computed, the waveform repeats every <resolution> samples and the rest is copied from it
+ */
+static void signalGenerator_Sine(float* samples, uint64_t first, size_t numOfSamples, unsigned int resolution,
+                                 float amplitude)
+{
+    const size_t period = (numOfSamples < resolution) ? numOfSamples : resolution;
+    const unsigned int position = (unsigned int)(first % resolution);
+    /* The period wraps to the start of the cycle after resolution - position samples */
+    const unsigned int head = (period < resolution - position) ? (unsigned int)period : resolution - position;
+
+    signalGenerator_SineRange(samples, position, position + head, resolution, amplitude);
+    signalGenerator_SineRange(&samples[head], 0, (unsigned int)period - head, resolution, amplitude);
+    for (size_t i = period; i < numOfSamples; i += period)
+    {
+        const size_t count = (numOfSamples - i < period) ? numOfSamples - i : period;
+        memcpy(&samples[i], samples, count * sizeof(float));
+    }
+}
 
-        int progress = 0;
-        if (((n % 10) == 0) || (n == settings->cycles - 1))
+/**
+ * @brief Chirp interval of SIGNAL_GEN_RESEED_INTERVAL samples. Frequency goes from 1 / <resolution> to
+ * 1 / <endResolution> cycles per sample over the whole signal. Lane <j> takes every SIGNAL_GEN_LANES-th
+ * sample from sample <j>, its phasor and rotation start from the exact phase, then all lanes are
+ * rotated together. The rotation of every lane grows by the same acceleration
+ */
+static void signalGenerator_ChirpInterval(float* out, uint64_t first, const SignalGenerator_t* settings)
+{
+    const double length = (double)signalGenerator_NumOfSamples(settings);
+    const double startFrequency = 1.0 / settings->resolution;
+    const double sweep = (1.0 / settings->endResolution - startFrequency) / length;    /* per sample */
+    const double accelerationRe = cos(TWO_PI * sweep * SIGNAL_GEN_LANES * SIGNAL_GEN_LANES);
+    const double accelerationIm = sin(TWO_PI * sweep * SIGNAL_GEN_LANES * SIGNAL_GEN_LANES);
+    double re[SIGNAL_GEN_LANES];
+    double im[SIGNAL_GEN_LANES];
+    double rotationRe[SIGNAL_GEN_LANES];
+    double rotationIm[SIGNAL_GEN_LANES];
+
+    for (int j = 0; j < SIGNAL_GEN_LANES; j++)
+    {
+        const double n = (double)(first + j);
+        double cycles = n * (startFrequency + 0.5 * sweep * n);
+        /* cycles from sample n to n + SIGNAL_GEN_LANES */
+        double increment = SIGNAL_GEN_LANES * (startFrequency + sweep * (n + 0.5 * SIGNAL_GEN_LANES));
+
+        cycles -= floor(cycles);
+        increment -= floor(increment);
+        re[j] = cos(TWO_PI * cycles);
+        im[j] = sin(TWO_PI * cycles);
+        rotationRe[j] = cos(TWO_PI * increment);
+        rotationIm[j] = sin(TWO_PI * increment);
+    }
+    for (int i = 0; i < SIGNAL_GEN_RESEED_INTERVAL; i += SIGNAL_GEN_LANES)
+    {
+        for (int j = 0; j < SIGNAL_GEN_LANES; j++)
         {
-            progress = ((float)n/settings->cycles)*100;
-            if (n == settings->cycles - 1)
+            out[i + j] = (float)(settings->amplitude * im[j]);
+            const double nextRe = re[j] * rotationRe[j] - im[j] * rotationIm[j];
+            im[j] = im[j] * rotationRe[j] + re[j] * rotationIm[j];
+            re[j] = nextRe;
+            const double nextRotationRe = rotationRe[j] * accelerationRe - rotationIm[j] * accelerationIm;
+            rotationIm[j] = rotationIm[j] * accelerationRe + rotationRe[j] * accelerationIm;
+            rotationRe[j] = nextRotationRe;
+        }
+    }
+}
+
+/**
+ * @brief Chirp by intervals. Intervals start at multiples of SIGNAL_GEN_RESEED_INTERVAL of the
+ * sample index, not of <first>, so every sample is the same however the signal is split into blocks.
+ * Intervals cut by the block ends are generated whole into a scratch buffer
+ */
+static void signalGenerator_Chirp(const SignalGenerator_t* settings, float* samples, uint64_t first,
+                                  size_t numOfSamples)
+{
+    float scratch[SIGNAL_GEN_RESEED_INTERVAL];
+    const uint64_t end = first + numOfSamples;
+    uint64_t position = first;
+
+    while (position < end)
+    {
+        const uint64_t intervalStart = position - position % SIGNAL_GEN_RESEED_INTERVAL;
+        const uint64_t intervalEnd = (intervalStart + SIGNAL_GEN_RESEED_INTERVAL < end) ?
+                                     intervalStart + SIGNAL_GEN_RESEED_INTERVAL : end;
+        const int whole = (intervalStart == position) && (intervalEnd - intervalStart == SIGNAL_GEN_RESEED_INTERVAL);
+        float* out = whole ? &samples[position - first] : scratch;
+
+        signalGenerator_ChirpInterval(out, intervalStart, settings);
+        if (!whole)
+        {
+            memcpy(&samples[position - first], &scratch[position - intervalStart],
+                   (size_t)(intervalEnd - position) * sizeof(float));
+        }
+        position = intervalEnd;
+    }
+}
+
+/**
+ * @brief Square or sawtooth wave from the position in the cycle
+ */
+static void signalGenerator_SquareOrSawtooth(float* samples, uint64_t first, size_t numOfSamples,
+                                             unsigned int resolution, float amplitude, int square)
+{
+    unsigned int position = (unsigned int)(first % resolution);
+
+    for (size_t i = 0; i < numOfSamples; i++)
+    {
+        if (square)
+        {
+            samples[i] = (2 * position < resolution) ? amplitude : -amplitude;
+        }
+        else
+        {
+            samples[i] = amplitude * (2.0f * position / resolution - 1.0f);
+        }
+        if (++position == resolution)
+        {
+            position = 0;
+        }
+    }
+}
+
+/**
+ * @brief Add white Gaussian noise of given RMS, two samples from one random number
+ */
+static void signalGenerator_AddWhite(float* samples, uint64_t first, size_t numOfSamples, uint64_t key, float rms)
+{
+    float noise[SIGNAL_GEN_NOISE_BATCH];
+
+    for (size_t i = 0; i < numOfSamples; i += SIGNAL_GEN_NOISE_BATCH)
+    {
+        const size_t count = (numOfSamples - i < SIGNAL_GEN_NOISE_BATCH) ? numOfSamples - i : SIGNAL_GEN_NOISE_BATCH;
+
+        signalGenerator_Gaussian(key, first + i, count, noise);
+        for (size_t k = 0; k < count; k++)
+        {
+            samples[i + k] += rms * noise[k];
+        }
+    }
+}
+
+/**
+ * @brief Add pink Gaussian noise of given RMS (Voss-McCartney). Row <r> holds a Gaussian value
+ * that changes every 2^r samples, the rows and white noise are summed. Row values are drawn by
+ * sample index, the values of every row over a batch of samples at once, about one per sample
+ */
+static void signalGenerator_AddPink(float* samples, uint64_t first, size_t numOfSamples, uint64_t seed, float rms)
+{
+    const float scale = rms / sqrtf(SIGNAL_GEN_PINK_ROWS + 1);
+    uint64_t keys[SIGNAL_GEN_PINK_ROWS + 1];
+    /* Row r takes at most (SIGNAL_GEN_NOISE_BATCH - 1) / 2^r + 2 values of a batch */
+    float values[SIGNAL_GEN_NOISE_BATCH + 2 * SIGNAL_GEN_PINK_ROWS];
+    const float* rows[SIGNAL_GEN_PINK_ROWS + 1];
+    uint64_t bases[SIGNAL_GEN_PINK_ROWS + 1];
+    float sums[SIGNAL_GEN_PINK_ROWS + 2];
+
+    for (int r = 0; r <= SIGNAL_GEN_PINK_ROWS; r++)
+    {
+        keys[r] = signalGenerator_StreamKey(seed, SIGNAL_GEN_STREAM_PINK + r);
+    }
+    signalGenerator_AddWhite(samples, first, numOfSamples, keys[0], scale);
+
+    sums[SIGNAL_GEN_PINK_ROWS + 1] = 0.0f;
+    for (size_t i = 0; i < numOfSamples; i += SIGNAL_GEN_NOISE_BATCH)
+    {
+        const size_t count = (numOfSamples - i < SIGNAL_GEN_NOISE_BATCH) ? numOfSamples - i : SIGNAL_GEN_NOISE_BATCH;
+        const uint64_t start = first + i;
+        float* next = values;
+
+        for (int r = 1; r <= SIGNAL_GEN_PINK_ROWS; r++)
+        {
+            const size_t rowCount = (size_t)(((start + count - 1) >> r) - (start >> r) + 1);
+
+            bases[r] = start >> r;
+            signalGenerator_Gaussian(keys[r], bases[r], rowCount, next);
+            rows[r] = next;
+            next += rowCount;
+        }
+        for (size_t k = 0; k < count; k++)
+        {
+            const uint64_t n = start + k;
+            /* Rows 1 to <changed> change at sample n, all of them at the start of the batch */
+            int changed = ((k == 0) || (n == 0)) ? SIGNAL_GEN_PINK_ROWS : __builtin_ctzll(n);
+
+            changed = (changed < SIGNAL_GEN_PINK_ROWS) ? changed : SIGNAL_GEN_PINK_ROWS;
+            /* sums[r] is rows r to SIGNAL_GEN_PINK_ROWS added from the top row down, so only the sums of
+             * changed rows are added again, and rounding does not depend on where the block started */
+            for (int r = changed; r >= 1; r--)
             {
-                progress = 100;
+                sums[r] = rows[r][(n >> r) - bases[r]] + sums[r + 1];
             }
-            printf("Waveform generation progress: %d%%\r", progress);
-            fflush(stdout);
+            samples[i + k] += scale * sums[1];
         }
     }
-    printf("\n");
+}
 
-    free(outputSamples);
+typedef struct
+{
+    const SignalGenerator_t* settings;
+    const SampleWriter_t* writer;
+    uint64_t first;
+    size_t count;
+    int failed;
+} SignalGeneratorChunk_t;
 
-    if (fclose(file))
+/**
+ * @brief Thread pool task: generate a chunk block by block and write it at its place in the file
+ * @param argument  Chunk to generate, SignalGeneratorChunk_t
+ */
+static void signalGenerator_ChunkTask(void* argument)
+{
+    SignalGeneratorChunk_t* chunk = (SignalGeneratorChunk_t*)argument;
+    float* samples = (float*)malloc(SIGNAL_GEN_BLOCK_SIZE * sizeof(float));
+
+    chunk->failed = (samples == NULL);
+    for (size_t n = 0; (chunk->failed == 0) && (n < chunk->count); n += SIGNAL_GEN_BLOCK_SIZE)
+    {
+        const int count = (chunk->count - n < SIGNAL_GEN_BLOCK_SIZE) ? (int)(chunk->count - n) : SIGNAL_GEN_BLOCK_SIZE;
+
+        signalGenerator_generateBlock(chunk->settings, samples, chunk->first + n, count);
+        chunk->failed = (sampleIo_WriteFramesAt(chunk->writer, samples, count, (long)(chunk->first + n)) != EXIT_SUCCESS);
+    }
+    free(samples);
+}
+
+/**
+ * @brief Generate a binary file in chunks on a thread pool. Every chunk is written at its offset,
+ * so chunks finish in any order
+ * @param settings          Parameters of signal
+ * @param writer            Writer of a binary format, just opened
+ * @param outputFileName    The name of the file, for error messages
+ * @return EXIT_SUCCESS when waveform generated and written
+ */
+static int signalGenerator_generateParallel(const SignalGenerator_t *settings, SampleWriter_t* writer,
+                                            const char* outputFileName)
+{
+    int retval = EXIT_SUCCESS;
+    ThreadPool_t pool;
+    const uint64_t numOfSamples = signalGenerator_NumOfSamples(settings);
+
+    if (sampleIo_ReserveFrames(writer, (long)numOfSamples) != EXIT_SUCCESS)
     {
         perror(outputFileName);
         return EXIT_FAILURE;
     }
+    if (threadPool_Init(&pool, settings->numOfThreads) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    printf("Generator threads:            %d\n", pool.numOfThreads);
+
+    const int numOfChunks = pool.numOfThreads * SIGNAL_GEN_CHUNKS_PER_THREAD;
+    SignalGeneratorChunk_t* chunks = (SignalGeneratorChunk_t*)calloc(numOfChunks, sizeof(SignalGeneratorChunk_t));
+    if (chunks == NULL)
+    {
+        printf("Error allocating generator jobs\n");
+        threadPool_Destroy(&pool);
+        return EXIT_FAILURE;
+    }
+
+    /* Chunks are queued a round at a time, progress is shown between rounds */
+    for (uint64_t n = 0; (retval == EXIT_SUCCESS) && (n < numOfSamples);)
+    {
+        int queued = 0;
+
+        for (; (queued < numOfChunks) && (n < numOfSamples); queued++)
+        {
+            chunks[queued].settings = settings;
+            chunks[queued].writer = writer;
+            chunks[queued].first = n;
+            chunks[queued].count = (numOfSamples - n < SIGNAL_GEN_CHUNK_SIZE) ? (size_t)(numOfSamples - n) : SIGNAL_GEN_CHUNK_SIZE;
+            n += chunks[queued].count;
+            threadPool_Submit(&pool, signalGenerator_ChunkTask, &chunks[queued]);
+        }
+        threadPool_Wait(&pool);
+
+        for (int i = 0; i < queued; i++)
+        {
+            if (chunks[i].failed)
+            {
+                perror(outputFileName);
+                retval = EXIT_FAILURE;
+                break;
+            }
+        }
+        printf("Waveform generation progress: %d%%\r", (int)(100 * n / numOfSamples));
+        fflush(stdout);
+    }
+    printf("\n");
+
+    threadPool_Destroy(&pool);
+    free(chunks);
+
     return retval;
 }
 
-TypeOfGenSignal_t signalGenerator_processArgumentType(const char* type)
+/**
+ * @brief Generate waveform based on given parameters and save it. Text is generated and written
+ * block by block, binary formats in parallel
+ * @param settings          Parameters of signal
+ * @param outputFileName    The name of the file to save samples to
+ * @return EXIT_SUCCESS when waveform generated and saved to the file
+ */
+static int signalGenerator_generateToFile(const SignalGenerator_t *settings, const char* outputFileName)
 {
-    int retval = GEN_SIGNAL_UNKNOWN;
+    int retval = EXIT_SUCCESS;
+    SampleWriter_t writer;
+    const uint64_t numOfSamples = signalGenerator_NumOfSamples(settings);
+
+    if (sampleIo_OpenWriter(&writer, outputFileName, settings->format, 1, SAMPLE_IO_DEFAULT_SAMPLE_RATE) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+    printf("Output file:                  %s (%s)\n", outputFileName, sampleIo_FormatName(writer.format));
 
-    if (strncmp(type, "sine", (sizeof("--sine")-1)) == 0)
+    if (writer.format != SAMPLE_FORMAT_TEXT)
     {
-        retval = GEN_SIGNAL_SINE;
-        printf("Signal type:                  sine\n");
+        retval = signalGenerator_generateParallel(settings, &writer, outputFileName);
     }
     else
     {
-        printf("ERROR: Unknown argument for <type>\n");
+        float* outputSamples = (float*)malloc(SIGNAL_GEN_BLOCK_SIZE * sizeof(float));
+        if (outputSamples == NULL)
+        {
+            printf("Error allocating sample buffer\n");
+            retval = EXIT_FAILURE;
+        }
+
+        for (uint64_t n = 0; (retval == EXIT_SUCCESS) && (n < numOfSamples); n += SIGNAL_GEN_BLOCK_SIZE)
+        {
+            const int count = (numOfSamples - n < SIGNAL_GEN_BLOCK_SIZE) ? (int)(numOfSamples - n) : SIGNAL_GEN_BLOCK_SIZE;
+
+            signalGenerator_generateBlock(settings, outputSamples, n, count);
+            if (sampleIo_Write(&writer, outputSamples, count) != EXIT_SUCCESS)
+            {
+                perror(outputFileName);
+                retval = EXIT_FAILURE;
+                break;
+            }
+            printf("Waveform generation progress: %d%%\r", (int)(100 * (n + count) / numOfSamples));
+            fflush(stdout);
+        }
+        printf("\n");
+
+        free(outputSamples);
+    }
+
+    if (sampleIo_CloseWriter(&writer))
+    {
+        perror(outputFileName);
+        return EXIT_FAILURE;
     }
     return retval;
 }
 
+void signalGenerator_DefaultSettings(SignalGenerator_t* settings)
+{
+    memset(settings, 0, sizeof(*settings));
+    settings->type = GEN_SIGNAL_UNKNOWN;
+    settings->format = SAMPLE_FORMAT_UNKNOWN;
+    settings->amplitude = SIGNAL_GEN_DEFAULT_AMPLITUDE;
+    settings->snr = SIGNAL_GEN_DEFAULT_SNR;
+    settings->endResolution = SIGNAL_GEN_DEFAULT_END_RESOLUTION;
+    settings->seed = SIGNAL_GEN_DEFAULT_SEED;
+    settings->numOfThreads = 0;
+}
+
+TypeOfGenSignal_t signalGenerator_processArgumentType(const char* type)
+{
+    for (int i = GEN_SIGNAL_UNKNOWN + 1; i < GEN_SIGNAL_COUNT; i++)
+    {
+        if (strcmp(type, signalGeneratorTypeNames[i]) == 0)
+        {
+            printf("Signal type:                  %s\n", signalGeneratorTypeNames[i]);
+            return (TypeOfGenSignal_t)i;
+        }
+    }
+    printf("ERROR: Unknown argument for <type>, expected sine, square, sawtooth, chirp, white, pink or sine-noise\n");
+    return GEN_SIGNAL_UNKNOWN;
+}
+
 unsigned int signalGenerator_processArgumentCycles(const char* cycles)
 {
     unsigned int retval = 0;
@@ -155,20 +701,49 @@ unsigned int signalGenerator_processArgumentResolution(const char* resolution)
     return retval;
 }
 
-int signalGenerator_generateSignal(const SignalGenerator_t *settings, const char* outputFileName)
+uint64_t signalGenerator_NumOfSamples(const SignalGenerator_t* settings)
+{
+    return (uint64_t)settings->cycles * settings->resolution;
+}
+
+int signalGenerator_generateBlock(const SignalGenerator_t* settings, float* samples, uint64_t first,
+                                  size_t numOfSamples)
 {
     int retval = EXIT_SUCCESS;
+    const float noiseRms = settings->amplitude / SIGNAL_GEN_NOISE_CREST_FACTOR;
+    const uint64_t whiteKey = signalGenerator_StreamKey(settings->seed, SIGNAL_GEN_STREAM_WHITE);
 
     switch(settings->type)
     {
         case GEN_SIGNAL_SINE:
-            if (outputFileName != NULL)
-            {
-                if (signalGenerator_generateSine(settings, outputFileName) != EXIT_SUCCESS)
-                {
-                    retval = EXIT_FAILURE;
-                }
-            }
+            signalGenerator_Sine(samples, first, numOfSamples, settings->resolution, settings->amplitude);
+            break;
+
+        case GEN_SIGNAL_CHIRP:
+            signalGenerator_Chirp(settings, samples, first, numOfSamples);
+            break;
+
+        case GEN_SIGNAL_SQUARE:
+        case GEN_SIGNAL_SAWTOOTH:
+            signalGenerator_SquareOrSawtooth(samples, first, numOfSamples, settings->resolution, settings->amplitude,
+                                             settings->type == GEN_SIGNAL_SQUARE);
+            break;
+
+        case GEN_SIGNAL_WHITE:
+            memset(samples, 0, numOfSamples * sizeof(float));
+            signalGenerator_AddWhite(samples, first, numOfSamples, whiteKey, noiseRms);
+            break;
+
+        case GEN_SIGNAL_PINK:
+            memset(samples, 0, numOfSamples * sizeof(float));
+            signalGenerator_AddPink(samples, first, numOfSamples, settings->seed, noiseRms);
+            break;
+
+        case GEN_SIGNAL_SINE_NOISE:
+            /* Power of the sine is amplitude^2 / 2 */
+            signalGenerator_Sine(samples, first, numOfSamples, settings->resolution, settings->amplitude);
+            signalGenerator_AddWhite(samples, first, numOfSamples, whiteKey,
+                                     settings->amplitude * (float)(M_SQRT1_2 * pow(10.0, -settings->snr / 20.0)));
             break;
 
         default:
@@ -176,4 +751,20 @@ int signalGenerator_generateSignal(const SignalGenerator_t *settings, const char
             break;
     }
     return retval;
-}
\ No newline at end of file
+}
+
+int signalGenerator_generateSamples(const SignalGenerator_t *settings, float* samples, size_t numOfSamples)
+{
+    return signalGenerator_generateBlock(settings, samples, 0, numOfSamples);
+}
+
+int signalGenerator_generateSignal(const SignalGenerator_t *settings, const char* outputFileName)
+{
+    int retval = EXIT_FAILURE;
+
+    if ((settings->type > GEN_SIGNAL_UNKNOWN) && (settings->type < GEN_SIGNAL_COUNT) && (outputFileName != NULL))
+    {
+        retval = signalGenerator_generateToFile(settings, outputFileName);
+    }
+    return retval;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file spscRing.c
+ * @author shed258
+ * @brief Lock-free single-producer single-consumer ring of fixed-size slots source file
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <sched.h>
+#include <time.h>
+#include "spscRing.h"
+
+#define SPSC_RING_YIELDS_BEFORE_SLEEP   64
+#define SPSC_RING_SLEEP_NS              20000
+
+/**
+ * @brief Back off while the other side is busy: yield first, then sleep, so a stage blocked
+ * on I/O does not keep a CPU spinning
+ * @param waits     Number of times the caller waited already
+ */
+static void spscRing_Wait(unsigned int waits)
+{
+    if (waits < SPSC_RING_YIELDS_BEFORE_SLEEP)
+    {
+        sched_yield();
+    }
+    else
+    {
+        const struct timespec pause = { 0, SPSC_RING_SLEEP_NS };
+        nanosleep(&pause, NULL);
+    }
+}
+
+int spscRing_Init(SpscRing_t* ring, unsigned int capacity, size_t slotSize)
+{
+    unsigned int size = 1;
+
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    ring->capacity = size;
+    ring->slotSize = (slotSize + SPSC_RING_CACHE_LINE - 1) & ~(size_t)(SPSC_RING_CACHE_LINE - 1);
+    ring->head = 0;
+    ring->tail = 0;
+    ring->closed = 0;
+    ring->slots = (unsigned char*)aligned_alloc(SPSC_RING_CACHE_LINE, ring->slotSize * size);
+    if (ring->slots == NULL)
+    {
+        printf("Error allocating ring buffer\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+void spscRing_Free(SpscRing_t* ring)
+{
+    free(ring->slots);
+    ring->slots = NULL;
+}
+
+void* spscRing_AcquireWrite(SpscRing_t* ring)
+{
+    const unsigned int head = ring->head;
+
+    /* Indices run freely, the ring is full when the producer is a whole lap ahead */
+    for (unsigned int waits = 0; head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == ring->capacity; waits++)
+    {
+        spscRing_Wait(waits);
+    }
+    return &ring->slots[(size_t)(head & (ring->capacity - 1)) * ring->slotSize];
+}
+
+void spscRing_CommitWrite(SpscRing_t* ring)
+{
+    __atomic_store_n(&ring->head, ring->head + 1, __ATOMIC_RELEASE);
+}
+
+void spscRing_Close(SpscRing_t* ring)
+{
+    __atomic_store_n(&ring->closed, 1, __ATOMIC_RELEASE);
+}
+
+void* spscRing_AcquireRead(SpscRing_t* ring)
+{
+    const unsigned int tail = ring->tail;
+
+    for (unsigned int waits = 0; __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail; waits++)
+    {
+        /* Closed after the last commit, so the head is checked once more */
+        if (__atomic_load_n(&ring->closed, __ATOMIC_ACQUIRE))
+        {
+            if (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail)
+            {
+                return NULL;
+            }
+            break;
+        }
+        spscRing_Wait(waits);
+    }
+    return &ring->slots[(size_t)(tail & (ring->capacity - 1)) * ring->slotSize];
+}
+
+void spscRing_ReleaseRead(SpscRing_t* ring)
+{
+    __atomic_store_n(&ring->tail, ring->tail + 1, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,527 @@
+/**
+ * @file subbandFilter.c
+ * @author shed258
+ * @brief Subband adaptive filter source file
+ * @version 1.0.0
+ *
+ * Weighted overlap-add DFT filterbank with K bands decimated by D = K / 2, one frame every D samples:
+ *   v[r] = sum of h[j] * x(n - j) over j = r mod K,  X = FFT(v)          (analysis, bands 0 .. K/2)
+ *   Y = W * [X of the last Ls frames],  E = Dk - Y,  W += step * E * conj(X) / (|X|^2 + regularization)
+ *   z = K * IFFT(conj(Y)),  y(n + a) += f[a] * z[a mod K]                 (synthesis)
+ * h is a Kaiser windowed sinc with cutoff at half the band spacing, so shifted copies of its response
+ * add up to a flat one, f has twice the cutoff and passes a whole band while rejecting the images of
+ * the decimation. Both have 8 K + 1 taps, the bank delays the signal by 8 K samples. Bands above K / 2
+ * are the complex conjugates of the adapted ones. Every band filter sees the signal at 1 / D of the
+ * sample rate, so its length and the number of band updates per sample both shrink by D.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "lmsAllocator.h"
+#include "subbandFilter.h"
+
+#define SUBBAND_FILTER_KAISER_BETA      5.65    /* 60 dB stopband */
+#define SUBBAND_FILTER_REGULARIZATION   1e-6    /* added to the band window power per tap */
+#define SUBBAND_FILTER_LANES            16      /* band filter lengths are a multiple of it */
+
+/* Bands adapted by one thread pool job */
+typedef struct
+{
+    SubbandFilter_t* filter;
+    int firstBin;
+    int lastBin;
+    int numOfFrames;
+} SubbandFilterBandJob_t;
+
+/**
+ * @brief Modified Bessel function of the first kind, order zero, of the Kaiser window
+ */
+static double subbandFilter_BesselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+
+    for (int k = 1; k < 50; k++)
+    {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < 1e-12 * sum)
+        {
+            break;
+        }
+    }
+    return sum;
+}
+
+/**
+ * @brief Kaiser windowed sinc lowpass of odd length, scaled to the DC gain <gain>
+ * @param taps      Filter taps
+ * @param length    Odd number of taps
+ * @param cutoff    Cutoff in cycles per sample
+ * @param gain      Sum of the taps
+ */
+static void subbandFilter_DesignLowpass(float* taps, int length, double cutoff, double gain)
+{
+    const double center = (length - 1) / 2.0;
+    const double norm = subbandFilter_BesselI0(SUBBAND_FILTER_KAISER_BETA);
+    double sum = 0.0;
+
+    for (int j = 0; j < length; j++)
+    {
+        const double t = j - center;
+        const double ratio = t / center;
+        const double sinc = (t == 0.0) ? 2.0 * cutoff : sin(2.0 * M_PI * cutoff * t) / (M_PI * t);
+        const double window = subbandFilter_BesselI0(SUBBAND_FILTER_KAISER_BETA * sqrt(1.0 - ratio * ratio)) / norm;
+
+        taps[j] = (float)(sinc * window);
+        sum += taps[j];
+    }
+    for (int j = 0; j < length; j++)
+    {
+        taps[j] = (float)(taps[j] * gain / sum);
+    }
+}
+
+/**
+ * @brief Store a sample in a mirrored history, the newest <size> samples stay contiguous
+ */
+static inline void subbandFilter_HistoryPush(float* history, int size, int index, float sample)
+{
+    history[index] = sample;
+    history[index + size] = sample;
+}
+
+/**
+ * @brief Analyse the window of a signal into band values: polyphase sum of K samples and its FFT
+ * @param filter    Subband filter structure
+ * @param window    <prototypeLength> samples from the oldest to the newest
+ * @param bands     <numOfBins> complex band values
+ */
+static void subbandFilter_Analyse(SubbandFilter_t* filter, const float* window, float* bands)
+{
+    const int numOfBands = filter->numOfBands;
+    float* sum = filter->spectrum;
+
+    /* The prototype is symmetric, so it weights the window in time order. Sample j of the window is
+     * <prototypeLength> - 1 - j samples old and <prototypeLength> - 1 is a multiple of K, so it folds
+     * onto -j mod K. Sums are taken over whole rows of K, then rotated into place */
+    memcpy(sum, window, numOfBands * sizeof(float));
+    for (int r = 0; r < numOfBands; r++)
+    {
+        sum[r] *= filter->analysisWindow[r];
+    }
+    for (int m = numOfBands; m < filter->prototypeLength - 1; m += numOfBands)
+    {
+        for (int r = 0; r < numOfBands; r++)
+        {
+            sum[r] += filter->analysisWindow[m + r] * window[m + r];
+        }
+    }
+    sum[0] += filter->analysisWindow[filter->prototypeLength - 1] * window[filter->prototypeLength - 1];
+
+    filter->fold[0] = sum[0];
+    for (int r = 1; r < numOfBands; r++)
+    {
+        filter->fold[r] = sum[numOfBands - r];
+    }
+    fft_Forward(&filter->fft, filter->fold, bands);
+}
+
+/**
+ * @brief Synthesize one frame from band outputs into the overlap-add buffer and take the next
+ * D output samples from it
+ * @param filter    Subband filter structure
+ * @param bands     <numOfBins> complex band outputs
+ */
+static void subbandFilter_Synthesize(SubbandFilter_t* filter, const float* bands)
+{
+    const int numOfBands = filter->numOfBands;
+    const int decimation = filter->decimation;
+    const int length = filter->prototypeLength;
+
+    for (int k = 0; k < filter->numOfBins; k++)
+    {
+        filter->spectrum[2 * k] = bands[2 * k];
+        filter->spectrum[2 * k + 1] = -bands[2 * k + 1];
+    }
+    fft_Inverse(&filter->fft, filter->spectrum, filter->fold);
+
+    /* Rows of K taps; the last tap starts a new row */
+    for (int m = 0; m < length - 1; m += numOfBands)
+    {
+        for (int r = 0; r < numOfBands; r++)
+        {
+            filter->overlap[m + r] += filter->synthesisWindow[m + r] * filter->fold[r];
+        }
+    }
+    filter->overlap[length - 1] += filter->synthesisWindow[length - 1] * filter->fold[0];
+    memcpy(filter->ready, filter->overlap, decimation * sizeof(float));
+    memmove(filter->overlap, &filter->overlap[decimation], (length - decimation) * sizeof(float));
+    memset(&filter->overlap[length - decimation], 0, decimation * sizeof(float));
+    filter->readyIndex = 0;
+}
+
+/**
+ * @brief Run the band filters over the frames of a block. Bands do not share state, so any
+ * range of them can be adapted apart
+ * @param filter        Subband filter structure
+ * @param firstBin      First band
+ * @param lastBin       One past the last band
+ * @param numOfFrames   Frames of the block
+ */
+static void subbandFilter_AdaptBands(SubbandFilter_t* filter, int firstBin, int lastBin, int numOfFrames)
+{
+    const int taps = filter->subbandLength;
+    const int stride = 2 * filter->numOfBins;
+    const double regularization = SUBBAND_FILTER_REGULARIZATION * taps;
+    const double step = filter->step;
+    const float* frameInput = filter->frameInput;
+    float* frameDesired = filter->frameDesired;
+
+    for (int b = firstBin; b < lastBin; b++)
+    {
+        float* restrict weightsRe = &filter->weightsRe[(size_t)b * taps];
+        float* restrict weightsIm = &filter->weightsIm[(size_t)b * taps];
+        float* historyRe = &filter->windowRe[(size_t)b * 2 * taps];
+        float* historyIm = &filter->windowIm[(size_t)b * 2 * taps];
+        double power = filter->bandPower[b];
+        int index = filter->windowIndex;
+
+        for (int f = 0; f < numOfFrames; f++)
+        {
+            const float xRe = frameInput[f * stride + 2 * b];
+            const float xIm = frameInput[f * stride + 2 * b + 1];
+            float* band = &frameDesired[f * stride + 2 * b];
+
+            /* The oldest band sample leaves the window, the new one enters at both mirrored ends */
+            power += (double)xRe * xRe + (double)xIm * xIm
+                     - ((double)historyRe[index] * historyRe[index] + (double)historyIm[index] * historyIm[index]);
+            if (power < 0.0)
+            {
+                power = 0.0;
+            }
+            subbandFilter_HistoryPush(historyRe, taps, index, xRe);
+            subbandFilter_HistoryPush(historyIm, taps, index, xIm);
+            if (++index == taps)
+            {
+                index = 0;
+            }
+            const float* restrict windowRe = &historyRe[index];
+            const float* restrict windowIm = &historyIm[index];
+
+            /* Once per <taps> frames the power is summed again from the window, so rounding does not build up */
+            if (index == 0)
+            {
+                power = 0.0;
+                for (int l = 0; l < taps; l++)
+                {
+                    power += (double)windowRe[l] * windowRe[l] + (double)windowIm[l] * windowIm[l];
+                }
+            }
+
+            /* Partial sums in SUBBAND_FILTER_LANES lanes, unrolled by the compiler into whole vector registers */
+            float accRe[SUBBAND_FILTER_LANES] = { 0.0f };
+            float accIm[SUBBAND_FILTER_LANES] = { 0.0f };
+            for (int l = 0; l < taps; l += SUBBAND_FILTER_LANES)
+            {
+                for (int j = 0; j < SUBBAND_FILTER_LANES; j++)
+                {
+                    accRe[j] += weightsRe[l + j] * windowRe[l + j] - weightsIm[l + j] * windowIm[l + j];
+                    accIm[j] += weightsRe[l + j] * windowIm[l + j] + weightsIm[l + j] * windowRe[l + j];
+                }
+            }
+            float yRe = 0.0f;
+            float yIm = 0.0f;
+            for (int j = 0; j < SUBBAND_FILTER_LANES; j++)
+            {
+                yRe += accRe[j];
+                yIm += accIm[j];
+            }
+
+            const float eRe = band[0] - yRe;
+            const float eIm = band[1] - yIm;
+            const float gain = (float)(step / (power + regularization));
+            const float gRe = gain * eRe;
+            const float gIm = gain * eIm;
+            for (int l = 0; l < taps; l++)
+            {
+                weightsRe[l] += gRe * windowRe[l] + gIm * windowIm[l];
+                weightsIm[l] += gIm * windowRe[l] - gRe * windowIm[l];
+            }
+
+            /* The band output replaces the band desired value for the synthesis */
+            band[0] = yRe;
+            band[1] = yIm;
+        }
+        filter->bandPower[b] = power;
+    }
+}
+
+/**
+ * @brief Thread pool task: adapt a range of bands
+ * @param argument  Band job, SubbandFilterBandJob_t
+ */
+static void subbandFilter_BandTask(void* argument)
+{
+    SubbandFilterBandJob_t* job = (SubbandFilterBandJob_t*)argument;
+    subbandFilter_AdaptBands(job->filter, job->firstBin, job->lastBin, job->numOfFrames);
+}
+
+int subbandFilter_Init(SubbandFilter_t* filter, float step, int length, int numOfBands)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    memset(filter, 0, sizeof(*filter));
+    if (numOfBands == 0)
+    {
+        numOfBands = SUBBAND_FILTER_DEFAULT_BANDS;
+    }
+    if ((length < 1) || (numOfBands < SUBBAND_FILTER_MIN_BANDS) || (numOfBands > SUBBAND_FILTER_MAX_BANDS)
+        || (fft_NextPowerOfTwo(numOfBands) != numOfBands))
+    {
+        printf("Wrong subband filter length %d or number of bands %d\n", length, numOfBands);
+        return EXIT_FAILURE;
+    }
+    filter->step = step;
+    filter->length = length;
+    filter->numOfBands = numOfBands;
+    filter->decimation = numOfBands / 2;
+    filter->numOfBins = numOfBands / 2 + 1;
+    filter->prototypeLength = SUBBAND_FILTER_PROTOTYPE_FACTOR * numOfBands + 1;
+    filter->delay = filter->prototypeLength - 1;
+
+    /* The band filters cover the fullband response and the spread of the analysis prototype */
+    filter->subbandLength = (length + filter->prototypeLength / 2 + filter->decimation - 1) / filter->decimation;
+    filter->subbandLength = (filter->subbandLength + SUBBAND_FILTER_LANES - 1) & ~(SUBBAND_FILTER_LANES - 1);
+
+    if (fft_Init(&filter->fft, numOfBands) != EXIT_SUCCESS)
+    {
+        return EXIT_FAILURE;
+    }
+
+    const size_t bins = filter->numOfBins;
+    const size_t taps = filter->subbandLength;
+    const size_t sizes[] =
+    {
+        filter->prototypeLength * sizeof(float),                        /* analysisWindow */
+        filter->prototypeLength * sizeof(float),                        /* synthesisWindow */
+        2 * filter->prototypeLength * sizeof(float),                    /* inputHistory */
+        2 * filter->prototypeLength * sizeof(float),                    /* desiredHistory */
+        length * sizeof(float),                                         /* referenceLine */
+        filter->delay * sizeof(float),                                  /* desiredDelay */
+        filter->prototypeLength * sizeof(float),                        /* overlap */
+        filter->decimation * sizeof(float),                             /* ready */
+        bins * taps * sizeof(float),                                    /* weightsRe */
+        bins * taps * sizeof(float),                                    /* weightsIm */
+        bins * 2 * taps * sizeof(float),                                /* windowRe */
+        bins * 2 * taps * sizeof(float),                                /* windowIm */
+        bins * sizeof(double),                                          /* bandPower */
+        SUBBAND_FILTER_MAX_FRAMES * 2 * bins * sizeof(float),           /* frameInput */
+        SUBBAND_FILTER_MAX_FRAMES * 2 * bins * sizeof(float),           /* frameDesired */
+        SUBBAND_FILTER_MAX_FRAMES * sizeof(int),                        /* framePosition */
+        (size_t)SUBBAND_FILTER_MAX_FRAMES * filter->decimation * sizeof(float),    /* delayedDesired */
+        numOfBands * sizeof(float),                                     /* fold */
+        2 * bins * sizeof(float),                                       /* spectrum */
+    };
+    void** sections[] =
+    {
+        (void**)&filter->analysisWindow, (void**)&filter->synthesisWindow, (void**)&filter->inputHistory,
+        (void**)&filter->desiredHistory, (void**)&filter->referenceLine, (void**)&filter->desiredDelay,
+        (void**)&filter->overlap, (void**)&filter->ready, (void**)&filter->weightsRe, (void**)&filter->weightsIm,
+        (void**)&filter->windowRe, (void**)&filter->windowIm, (void**)&filter->bandPower,
+        (void**)&filter->frameInput, (void**)&filter->frameDesired, (void**)&filter->framePosition,
+        (void**)&filter->delayedDesired, (void**)&filter->fold, (void**)&filter->spectrum,
+    };
+    const int numOfSections = sizeof(sizes) / sizeof(sizes[0]);
+    size_t totalBytes = 0;
+
+    for (int i = 0; i < numOfSections; i++)
+    {
+        totalBytes += lmsAllocator_AlignedSize(sizes[i]);
+    }
+    filter->memory = heap->allocate(heap->context, totalBytes, LMS_ALLOCATOR_ALIGNMENT);
+    if (filter->memory == NULL)
+    {
+        printf("Error allocating subband filter of length %d\n", length);
+        fft_Free(&filter->fft);
+        return EXIT_FAILURE;
+    }
+    memset(filter->memory, 0, totalBytes);
+
+    unsigned char* next = (unsigned char*)filter->memory;
+    for (int i = 0; i < numOfSections; i++)
+    {
+        *sections[i] = next;
+        next += lmsAllocator_AlignedSize(sizes[i]);
+    }
+
+    /* Analysis DC gain 1, synthesis D: a frame every D samples puts the overall gain at 1. The synthesis
+     * taps also undo the 1 / K scaling of the inverse FFT */
+    subbandFilter_DesignLowpass(filter->analysisWindow, filter->prototypeLength, 0.5 / numOfBands, 1.0);
+    subbandFilter_DesignLowpass(filter->synthesisWindow, filter->prototypeLength, 1.0 / numOfBands,
+                                (double)filter->decimation * numOfBands);
+
+    return EXIT_SUCCESS;
+}
+
+void subbandFilter_Free(SubbandFilter_t* filter)
+{
+    const LmsAllocator_t* heap = lmsAllocator_Heap();
+
+    heap->release(heap->context, filter->memory);
+    fft_Free(&filter->fft);
+    filter->memory = NULL;
+}
+
+void subbandFilter_SetThreadPool(SubbandFilter_t* filter, ThreadPool_t* pool)
+{
+    filter->pool = pool;
+}
+
+void subbandFilter_PushSample(SubbandFilter_t* filter, float sample)
+{
+    subbandFilter_HistoryPush(filter->inputHistory, filter->prototypeLength, filter->historyIndex, sample);
+    subbandFilter_HistoryPush(filter->desiredHistory, filter->prototypeLength, filter->historyIndex, 0.0f);
+    if (++filter->historyIndex == filter->prototypeLength)
+    {
+        filter->historyIndex = 0;
+    }
+    filter->referenceLine[filter->referenceIndex] = sample;
+    if (++filter->referenceIndex == filter->length)
+    {
+        filter->referenceIndex = 0;
+    }
+}
+
+/**
+ * @brief Filter at most SUBBAND_FILTER_MAX_FRAMES frames worth of samples: analysis of all frames,
+ * band adaptation, then synthesis and output
+ */
+static void subbandFilter_ProcessFrames(SubbandFilter_t* filter, const float* input, const float* desired,
+                                        float* output, float* error, int numOfSamples)
+{
+    const int stride = 2 * filter->numOfBins;
+    int numOfFrames = 0;
+
+    for (int i = 0; i < numOfSamples; i++)
+    {
+        float reference;
+
+        filter->referenceLine[filter->referenceIndex] = input[i];
+        if (++filter->referenceIndex == filter->length)
+        {
+            filter->referenceIndex = 0;
+        }
+        reference = (desired != NULL) ? desired[i] : filter->referenceLine[filter->referenceIndex];
+
+        subbandFilter_HistoryPush(filter->inputHistory, filter->prototypeLength, filter->historyIndex, input[i]);
+        subbandFilter_HistoryPush(filter->desiredHistory, filter->prototypeLength, filter->historyIndex, reference);
+        if (++filter->historyIndex == filter->prototypeLength)
+        {
+            filter->historyIndex = 0;
+        }
+
+        filter->delayedDesired[i] = filter->desiredDelay[filter->desiredDelayIndex];
+        filter->desiredDelay[filter->desiredDelayIndex] = reference;
+        if (++filter->desiredDelayIndex == filter->delay)
+        {
+            filter->desiredDelayIndex = 0;
+        }
+
+        if (++filter->hop == filter->decimation)
+        {
+            filter->hop = 0;
+            subbandFilter_Analyse(filter, &filter->inputHistory[filter->historyIndex],
+                                  &filter->frameInput[numOfFrames * stride]);
+            subbandFilter_Analyse(filter, &filter->desiredHistory[filter->historyIndex],
+                                  &filter->frameDesired[numOfFrames * stride]);
+            filter->framePosition[numOfFrames++] = i;
+        }
+    }
+
+    if ((filter->pool != NULL) && (numOfFrames > 0))
+    {
+        SubbandFilterBandJob_t jobs[SUBBAND_FILTER_MAX_BANDS / 2 + 1];
+        const int numOfJobs = (filter->pool->numOfThreads < filter->numOfBins) ?
+                              filter->pool->numOfThreads : filter->numOfBins;
+
+        for (int j = 0; j < numOfJobs; j++)
+        {
+            jobs[j].filter = filter;
+            jobs[j].firstBin = j * filter->numOfBins / numOfJobs;
+            jobs[j].lastBin = (j + 1) * filter->numOfBins / numOfJobs;
+            jobs[j].numOfFrames = numOfFrames;
+            if (threadPool_Submit(filter->pool, subbandFilter_BandTask, &jobs[j]) != EXIT_SUCCESS)
+            {
+                subbandFilter_BandTask(&jobs[j]);
+            }
+        }
+        threadPool_Wait(filter->pool);
+    }
+    else
+    {
+        subbandFilter_AdaptBands(filter, 0, filter->numOfBins, numOfFrames);
+    }
+    filter->windowIndex = (filter->windowIndex + numOfFrames) % filter->subbandLength;
+
+    /* Samples up to a frame come from the previous frame, the frame sample starts the new one */
+    for (int i = 0, f = 0; i < numOfSamples; i++)
+    {
+        if ((f < numOfFrames) && (filter->framePosition[f] == i))
+        {
+            subbandFilter_Synthesize(filter, &filter->frameDesired[f * stride]);
+            f++;
+        }
+        const float y = filter->ready[filter->readyIndex++];
+
+        if (output != NULL)
+        {
+            output[i] = y;
+        }
+        if (error != NULL)
+        {
+            error[i] = filter->delayedDesired[i] - y;
+        }
+    }
+}
+
+int subbandFilter_ProcessBlock(SubbandFilter_t* filter, const float* input, const float* desired,
+                               float* output, float* error, int numOfSamples)
+{
+    /* A chunk of this size never holds more than SUBBAND_FILTER_MAX_FRAMES frames */
+    const int chunk = SUBBAND_FILTER_MAX_FRAMES * filter->decimation;
+
+    for (int i = 0; i < numOfSamples; i += chunk)
+    {
+        const int count = (numOfSamples - i < chunk) ? numOfSamples - i : chunk;
+
+        subbandFilter_ProcessFrames(filter, &input[i], (desired != NULL) ? &desired[i] : NULL,
+                                    (output != NULL) ? &output[i] : NULL, (error != NULL) ? &error[i] : NULL, count);
+    }
+
+    /* Non-finite values propagate through weights, checking the last output is enough */
+    const float y = filter->ready[(filter->readyIndex > 0) ? filter->readyIndex - 1 : 0];
+    return (isfinite(y) == 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+double subbandFilter_NormSquared(const SubbandFilter_t* filter)
+{
+    double sum = 0.0;
+
+    for (int b = 0; b < filter->numOfBins; b++)
+    {
+        /* Bands 1 .. K/2 - 1 stand for their mirror images as well */
+        const double weight = ((b == 0) || (b == filter->numOfBins - 1)) ? 1.0 : 2.0;
+        double band = 0.0;
+
+        for (int l = 0; l < filter->subbandLength; l++)
+        {
+            const size_t k = (size_t)b * filter->subbandLength + l;
+            band += (double)filter->weightsRe[k] * filter->weightsRe[k] + (double)filter->weightsIm[k] * filter->weightsIm[k];
+        }
+        sum += weight * band;
+    }
+    return sum;
+}
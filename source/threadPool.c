@@ -0,0 +1,269 @@
+/**
+ * @file threadPool.c
+ * @author shed258
+ * @brief Fixed-size work-stealing thread pool source file
+ * @version 1.0.0
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "threadPool.h"
+
+#define THREAD_POOL_QUEUE_CAPACITY  64
+
+typedef struct
+{
+    ThreadPool_t* pool;
+    int index;
+} ThreadPoolWorker_t;
+
+static __thread const ThreadPool_t* currentPool = NULL;
+static __thread int currentWorker = -1;
+
+/**
+ * @brief Push a job on the owner side of the queue, growing the queue when full
+ * @return EXIT_SUCCESS when pushed. Otherwise, return EXIT_FAILURE
+ */
+static int threadPool_QueuePush(ThreadPoolQueue_t* queue, const ThreadPoolJob_t* job)
+{
+    int retval = EXIT_SUCCESS;
+
+    pthread_mutex_lock(&queue->lock);
+    if (queue->count == queue->capacity)
+    {
+        ThreadPoolJob_t* jobs = (ThreadPoolJob_t*)malloc(2 * queue->capacity * sizeof(ThreadPoolJob_t));
+        if (jobs != NULL)
+        {
+            for (int i = 0; i < queue->count; i++)
+            {
+                jobs[i] = queue->jobs[(queue->head + i) % queue->capacity];
+            }
+            free(queue->jobs);
+            queue->jobs = jobs;
+            queue->capacity *= 2;
+            queue->head = 0;
+        }
+        else
+        {
+            retval = EXIT_FAILURE;
+        }
+    }
+    if (retval == EXIT_SUCCESS)
+    {
+        queue->jobs[(queue->head + queue->count) % queue->capacity] = *job;
+        queue->count++;
+    }
+    pthread_mutex_unlock(&queue->lock);
+
+    return retval;
+}
+
+/**
+ * @brief Take a job from the queue. The owner takes the newest one, thieves the oldest one
+ * @return 1 when job taken, 0 when queue is empty
+ */
+static int threadPool_QueueTake(ThreadPoolQueue_t* queue, ThreadPoolJob_t* job, int steal)
+{
+    int retval = 0;
+
+    pthread_mutex_lock(&queue->lock);
+    if (queue->count > 0)
+    {
+        if (steal)
+        {
+            *job = queue->jobs[queue->head];
+            queue->head = (queue->head + 1) % queue->capacity;
+        }
+        else
+        {
+            *job = queue->jobs[(queue->head + queue->count - 1) % queue->capacity];
+        }
+        queue->count--;
+        retval = 1;
+    }
+    pthread_mutex_unlock(&queue->lock);
+
+    return retval;
+}
+
+static void* threadPool_Worker(void* argument)
+{
+    ThreadPoolWorker_t* worker = (ThreadPoolWorker_t*)argument;
+    ThreadPool_t* pool = worker->pool;
+    const int index = worker->index;
+    ThreadPoolJob_t job;
+
+    free(worker);
+    currentPool = pool;
+    currentWorker = index;
+
+    for (;;)
+    {
+        /* Claim one of the queued jobs, so it is certainly in one of the queues */
+        pthread_mutex_lock(&pool->lock);
+        while ((pool->queued == 0) && (pool->shutdown == 0))
+        {
+            pthread_cond_wait(&pool->workAvailable, &pool->lock);
+        }
+        if (pool->queued == 0)
+        {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+        pool->queued--;
+        pthread_mutex_unlock(&pool->lock);
+
+        /* Own queue first, then steal from the others */
+        int found = threadPool_QueueTake(&pool->queues[index], &job, 0);
+        for (int i = 1; found == 0; i++)
+        {
+            found = threadPool_QueueTake(&pool->queues[(index + i) % pool->numOfThreads], &job, 1);
+        }
+
+        job.task(job.argument);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0)
+        {
+            pthread_cond_broadcast(&pool->allDone);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+int threadPool_NumberOfCpus(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cpus > 0) ? (int)cpus : 1;
+}
+
+int threadPool_Init(ThreadPool_t* pool, int numOfThreads)
+{
+    memset(pool, 0, sizeof(*pool));
+    pool->numOfThreads = (numOfThreads > 0) ? numOfThreads : threadPool_NumberOfCpus();
+
+    pool->threads = (pthread_t*)calloc(pool->numOfThreads, sizeof(pthread_t));
+    pool->queues = (ThreadPoolQueue_t*)calloc(pool->numOfThreads, sizeof(ThreadPoolQueue_t));
+    if ((pool->threads == NULL) || (pool->queues == NULL))
+    {
+        printf("Error allocating thread pool\n");
+        free(pool->threads);
+        free(pool->queues);
+        return EXIT_FAILURE;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->workAvailable, NULL);
+    pthread_cond_init(&pool->allDone, NULL);
+
+    pool->numOfQueues = pool->numOfThreads;
+    for (int i = 0; i < pool->numOfQueues; i++)
+    {
+        pthread_mutex_init(&pool->queues[i].lock, NULL);
+        pool->queues[i].capacity = THREAD_POOL_QUEUE_CAPACITY;
+        pool->queues[i].jobs = (ThreadPoolJob_t*)malloc(THREAD_POOL_QUEUE_CAPACITY * sizeof(ThreadPoolJob_t));
+    }
+
+    for (int i = 0; i < pool->numOfThreads; i++)
+    {
+        ThreadPoolWorker_t* worker = (ThreadPoolWorker_t*)malloc(sizeof(ThreadPoolWorker_t));
+        if ((pool->queues[i].jobs == NULL) || (worker == NULL))
+        {
+            printf("Error allocating thread pool\n");
+            free(worker);
+            pool->numOfThreads = i;
+            threadPool_Destroy(pool);
+            return EXIT_FAILURE;
+        }
+        worker->pool = pool;
+        worker->index = i;
+        if (pthread_create(&pool->threads[i], NULL, threadPool_Worker, worker) != 0)
+        {
+            perror("pthread_create");
+            free(worker);
+            pool->numOfThreads = i;
+            threadPool_Destroy(pool);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+int threadPool_Submit(ThreadPool_t* pool, ThreadPoolTask_t task, void* argument)
+{
+    const ThreadPoolJob_t job = { task, argument };
+    int queueIndex;
+
+    pthread_mutex_lock(&pool->lock);
+    if (currentPool == pool)
+    {
+        queueIndex = currentWorker;
+    }
+    else
+    {
+        queueIndex = pool->nextQueue;
+        pool->nextQueue = (pool->nextQueue + 1) % pool->numOfThreads;
+    }
+    pool->pending++;
+    pthread_mutex_unlock(&pool->lock);
+
+    if (threadPool_QueuePush(&pool->queues[queueIndex], &job) != EXIT_SUCCESS)
+    {
+        printf("Error allocating thread pool queue\n");
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0)
+        {
+            pthread_cond_broadcast(&pool->allDone);
+        }
+        pthread_mutex_unlock(&pool->lock);
+        return EXIT_FAILURE;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->queued++;
+    pthread_cond_signal(&pool->workAvailable);
+    pthread_mutex_unlock(&pool->lock);
+
+    return EXIT_SUCCESS;
+}
+
+void threadPool_Wait(ThreadPool_t* pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0)
+    {
+        pthread_cond_wait(&pool->allDone, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void threadPool_Destroy(ThreadPool_t* pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->workAvailable);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->numOfThreads; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    /* Queues of threads that failed to start are released as well */
+    for (int i = 0; i < pool->numOfQueues; i++)
+    {
+        free(pool->queues[i].jobs);
+        pthread_mutex_destroy(&pool->queues[i].lock);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->workAvailable);
+    pthread_cond_destroy(&pool->allDone);
+    free(pool->threads);
+    free(pool->queues);
+    pool->threads = NULL;
+    pool->queues = NULL;
+}